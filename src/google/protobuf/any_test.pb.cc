@@ -0,0 +1,448 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/any_test.proto
+
+#include "google/protobuf/any_test.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+
+inline constexpr TestAny::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_any_value_{},
+        text_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        any_value_{nullptr},
+        int32_value_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestAny::TestAny(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestAnyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestAnyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestAnyDefaultTypeInternal() {}
+  union {
+    TestAny _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestAnyDefaultTypeInternal _TestAny_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2fany_5ftest_2eproto[1];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2fany_5ftest_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2fany_5ftest_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2fany_5ftest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _impl_.int32_value_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _impl_.any_value_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _impl_.repeated_any_value_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _impl_.text_),
+    ~0u,
+    0,
+    ~0u,
+    ~0u,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 12, -1, sizeof(::protobuf_unittest::TestAny)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestAny_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2fany_5ftest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n\036google/protobuf/any_test.proto\022\021protob"
+    "uf_unittest\032\031google/protobuf/any.proto\"\207"
+    "\001\n\007TestAny\022\023\n\013int32_value\030\001 \001(\005\022\'\n\tany_v"
+    "alue\030\002 \001(\0132\024.google.protobuf.Any\0220\n\022repe"
+    "ated_any_value\030\003 \003(\0132\024.google.protobuf.A"
+    "ny\022\014\n\004text\030\004 \001(\tB\016B\014TestAnyProtob\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto = {
+    false,
+    false,
+    240,
+    descriptor_table_protodef_google_2fprotobuf_2fany_5ftest_2eproto,
+    "google/protobuf/any_test.proto",
+    &descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_once,
+    descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_deps,
+    1,
+    1,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2fany_5ftest_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2fany_5ftest_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2fany_5ftest_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2fany_5ftest_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2fany_5ftest_2eproto(&descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto);
+namespace protobuf_unittest {
+// ===================================================================
+
+class TestAny::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestAny>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestAny, _impl_._has_bits_);
+  static const ::google::protobuf::Any& any_value(const TestAny* msg);
+  static void set_has_any_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::Any& TestAny::_Internal::any_value(const TestAny* msg) {
+  return *msg->_impl_.any_value_;
+}
+void TestAny::clear_any_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.any_value_ != nullptr) _impl_.any_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestAny::clear_repeated_any_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_any_value_.Clear();
+}
+TestAny::TestAny(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestAny)
+}
+inline PROTOBUF_NDEBUG_INLINE TestAny::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_any_value_{visibility, arena, from.repeated_any_value_},
+        text_(arena, from.text_) {}
+
+TestAny::TestAny(
+    ::google::protobuf::Arena* arena,
+    const TestAny& from)
+    : ::google::protobuf::Message(arena) {
+  TestAny* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.any_value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Any>(arena, *from._impl_.any_value_)
+                : nullptr;
+  _impl_.int32_value_ = from._impl_.int32_value_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAny)
+}
+inline PROTOBUF_NDEBUG_INLINE TestAny::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_any_value_{visibility, arena},
+        text_(arena) {}
+
+inline void TestAny::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, any_value_),
+           0,
+           offsetof(Impl_, int32_value_) -
+               offsetof(Impl_, any_value_) +
+               sizeof(Impl_::int32_value_));
+}
+TestAny::~TestAny() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAny)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestAny::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.text_.Destroy();
+  delete _impl_.any_value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestAny::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAny)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_any_value_.Clear();
+  _impl_.text_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.any_value_ != nullptr);
+    _impl_.any_value_->Clear();
+  }
+  _impl_.int32_value_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestAny::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 2, 38, 2> TestAny::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestAny, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestAny_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string text = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(TestAny, _impl_.text_)}},
+    // int32 int32_value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestAny, _impl_.int32_value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestAny, _impl_.int32_value_)}},
+    // .google.protobuf.Any any_value = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(TestAny, _impl_.any_value_)}},
+    // repeated .google.protobuf.Any repeated_any_value = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 63, 1, PROTOBUF_FIELD_OFFSET(TestAny, _impl_.repeated_any_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 int32_value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestAny, _impl_.int32_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // .google.protobuf.Any any_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestAny, _impl_.any_value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Any repeated_any_value = 3;
+    {PROTOBUF_FIELD_OFFSET(TestAny, _impl_.repeated_any_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // string text = 4;
+    {PROTOBUF_FIELD_OFFSET(TestAny, _impl_.text_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+  }}, {{
+    "\31\0\0\0\4\0\0\0"
+    "protobuf_unittest.TestAny"
+    "text"
+  }},
+};
+
+::uint8_t* TestAny::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAny)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // int32 int32_value = 1;
+  if (this->_internal_int32_value() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_int32_value(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Any any_value = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::any_value(this),
+        _Internal::any_value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Any repeated_any_value = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_any_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_any_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string text = 4;
+  if (!this->_internal_text().empty()) {
+    const std::string& _s = this->_internal_text();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestAny.text");
+    target = stream->WriteStringMaybeAliased(4, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAny)
+  return target;
+}
+
+::size_t TestAny::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAny)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any repeated_any_value = 3;
+  total_size += 1UL * this->_internal_repeated_any_value_size();
+  for (const auto& msg : this->_internal_repeated_any_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // string text = 4;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_text());
+  }
+
+  // .google.protobuf.Any any_value = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.any_value_);
+  }
+
+  // int32 int32_value = 1;
+  if (this->_internal_int32_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_int32_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestAny::_class_data_ = {
+    TestAny::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestAny::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestAny::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestAny*>(&to_msg);
+  auto& from = static_cast<const TestAny&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAny)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_any_value()->MergeFrom(
+      from._internal_repeated_any_value());
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_any_value()->::google::protobuf::Any::MergeFrom(
+        from._internal_any_value());
+  }
+  if (from._internal_int32_value() != 0) {
+    _this->_internal_set_int32_value(from._internal_int32_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestAny::CopyFrom(const TestAny& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAny)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestAny::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestAny::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestAny::InternalSwap(TestAny* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_any_value_.InternalSwap(&other->_impl_.repeated_any_value_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.text_, &other->_impl_.text_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestAny, _impl_.int32_value_)
+      + sizeof(TestAny::_impl_.int32_value_)
+      - PROTOBUF_FIELD_OFFSET(TestAny, _impl_.any_value_)>(
+          reinterpret_cast<char*>(&_impl_.any_value_),
+          reinterpret_cast<char*>(&other->_impl_.any_value_));
+}
+
+::google::protobuf::Metadata TestAny::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fany_5ftest_2eproto[0]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,547 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/any_test.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fany_5ftest_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fany_5ftest_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/any.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fany_5ftest_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2fany_5ftest_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto;
+namespace protobuf_unittest {
+class TestAny;
+struct TestAnyDefaultTypeInternal;
+extern TestAnyDefaultTypeInternal _TestAny_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestAny final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAny) */ {
+ public:
+  inline TestAny() : TestAny(nullptr) {}
+  ~TestAny() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAny(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAny(const TestAny& from)
+      : TestAny(nullptr, from) {}
+  TestAny(TestAny&& from) noexcept
+    : TestAny() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAny& operator=(const TestAny& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAny& operator=(TestAny&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestAny& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAny* internal_default_instance() {
+    return reinterpret_cast<const TestAny*>(
+               &_TestAny_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestAny& a, TestAny& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAny* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAny* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAny* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAny>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestAny& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestAny& from) {
+    TestAny::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAny* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAny";
+  }
+  protected:
+  explicit TestAny(::google::protobuf::Arena* arena);
+  TestAny(::google::protobuf::Arena* arena, const TestAny& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedAnyValueFieldNumber = 3,
+    kTextFieldNumber = 4,
+    kAnyValueFieldNumber = 2,
+    kInt32ValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.Any repeated_any_value = 3;
+  int repeated_any_value_size() const;
+  private:
+  int _internal_repeated_any_value_size() const;
+
+  public:
+  void clear_repeated_any_value() ;
+  ::google::protobuf::Any* mutable_repeated_any_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any >*
+      mutable_repeated_any_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>& _internal_repeated_any_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>* _internal_mutable_repeated_any_value();
+  public:
+  const ::google::protobuf::Any& repeated_any_value(int index) const;
+  ::google::protobuf::Any* add_repeated_any_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any >&
+      repeated_any_value() const;
+  // string text = 4;
+  void clear_text() ;
+  const std::string& text() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_text(Arg_&& arg, Args_... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* value);
+
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(
+      const std::string& value);
+  std::string* _internal_mutable_text();
+
+  public:
+  // .google.protobuf.Any any_value = 2;
+  bool has_any_value() const;
+  void clear_any_value() ;
+  const ::google::protobuf::Any& any_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Any* release_any_value();
+  ::google::protobuf::Any* mutable_any_value();
+  void set_allocated_any_value(::google::protobuf::Any* value);
+  void unsafe_arena_set_allocated_any_value(::google::protobuf::Any* value);
+  ::google::protobuf::Any* unsafe_arena_release_any_value();
+
+  private:
+  const ::google::protobuf::Any& _internal_any_value() const;
+  ::google::protobuf::Any* _internal_mutable_any_value();
+
+  public:
+  // int32 int32_value = 1;
+  void clear_int32_value() ;
+  ::int32_t int32_value() const;
+  void set_int32_value(::int32_t value);
+
+  private:
+  ::int32_t _internal_int32_value() const;
+  void _internal_set_int32_value(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAny)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 2,
+      38, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any > repeated_any_value_;
+    ::google::protobuf::internal::ArenaStringPtr text_;
+    ::google::protobuf::Any* any_value_;
+    ::int32_t int32_value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fany_5ftest_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestAny
+
+// int32 int32_value = 1;
+inline void TestAny::clear_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int32_value_ = 0;
+}
+inline ::int32_t TestAny::int32_value() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAny.int32_value)
+  return _internal_int32_value();
+}
+inline void TestAny::set_int32_value(::int32_t value) {
+  _internal_set_int32_value(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAny.int32_value)
+}
+inline ::int32_t TestAny::_internal_int32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int32_value_;
+}
+inline void TestAny::_internal_set_int32_value(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.int32_value_ = value;
+}
+
+// .google.protobuf.Any any_value = 2;
+inline bool TestAny::has_any_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.any_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Any& TestAny::_internal_any_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Any* p = _impl_.any_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Any&>(::google::protobuf::_Any_default_instance_);
+}
+inline const ::google::protobuf::Any& TestAny::any_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAny.any_value)
+  return _internal_any_value();
+}
+inline void TestAny::unsafe_arena_set_allocated_any_value(::google::protobuf::Any* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.any_value_);
+  }
+  _impl_.any_value_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAny.any_value)
+}
+inline ::google::protobuf::Any* TestAny::release_any_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Any* released = _impl_.any_value_;
+  _impl_.any_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Any* TestAny::unsafe_arena_release_any_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAny.any_value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Any* temp = _impl_.any_value_;
+  _impl_.any_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Any* TestAny::_internal_mutable_any_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.any_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Any>(GetArena());
+    _impl_.any_value_ = reinterpret_cast<::google::protobuf::Any*>(p);
+  }
+  return _impl_.any_value_;
+}
+inline ::google::protobuf::Any* TestAny::mutable_any_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Any* _msg = _internal_mutable_any_value();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAny.any_value)
+  return _msg;
+}
+inline void TestAny::set_allocated_any_value(::google::protobuf::Any* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.any_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.any_value_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAny.any_value)
+}
+
+// repeated .google.protobuf.Any repeated_any_value = 3;
+inline int TestAny::_internal_repeated_any_value_size() const {
+  return _internal_repeated_any_value().size();
+}
+inline int TestAny::repeated_any_value_size() const {
+  return _internal_repeated_any_value_size();
+}
+inline ::google::protobuf::Any* TestAny::mutable_repeated_any_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAny.repeated_any_value)
+  return _internal_mutable_repeated_any_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>* TestAny::mutable_repeated_any_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAny.repeated_any_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_any_value();
+}
+inline const ::google::protobuf::Any& TestAny::repeated_any_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAny.repeated_any_value)
+  return _internal_repeated_any_value().Get(index);
+}
+inline ::google::protobuf::Any* TestAny::add_repeated_any_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Any* _add = _internal_mutable_repeated_any_value()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAny.repeated_any_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>& TestAny::repeated_any_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAny.repeated_any_value)
+  return _internal_repeated_any_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>&
+TestAny::_internal_repeated_any_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_any_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>*
+TestAny::_internal_mutable_repeated_any_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_any_value_;
+}
+
+// string text = 4;
+inline void TestAny::clear_text() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& TestAny::text() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAny.text)
+  return _internal_text();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAny::set_text(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.text_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAny.text)
+}
+inline std::string* TestAny::mutable_text() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAny.text)
+  return _s;
+}
+inline const std::string& TestAny::_internal_text() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.text_.Get();
+}
+inline void TestAny::_internal_set_text(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.text_.Set(value, GetArena());
+}
+inline std::string* TestAny::_internal_mutable_text() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.text_.Mutable( GetArena());
+}
+inline std::string* TestAny::release_text() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAny.text)
+  return _impl_.text_.Release();
+}
+inline void TestAny::set_allocated_text(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.text_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.text_.IsDefault()) {
+          _impl_.text_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAny.text)
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fany_5ftest_2eproto_2epb_2eh
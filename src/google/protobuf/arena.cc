@@ -20,6 +20,7 @@
 #include "absl/container/internal/layout.h"
 #include "absl/synchronization/mutex.h"
 #include "google/protobuf/arena_allocation_policy.h"
+#include "google/protobuf/arena_block_pool.h"
 #include "google/protobuf/arenaz_sampler.h"
 #include "google/protobuf/port.h"
 #include "google/protobuf/serial_arena.h"
@@ -30,6 +31,10 @@
 #include <sanitizer/asan_interface.h>
 #endif  // ADDRESS_SANITIZER
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif  // __linux__
+
 // Must be included last.
 #include "google/protobuf/port_def.inc"
 
@@ -59,16 +64,99 @@ ArenaBlock* SentryArenaBlock() {
 }
 #endif
 
+// Huge page regions are multiples of this size and aligned to it.
+constexpr size_t kHugePageSize = size_t{2} << 20;
+
+// In huge page mode, blocks larger than this are huge page regions. It is
+// below kHugePageSize so that a block can be classified from its size alone:
+// every other block allocator is asked for at most this much.
+constexpr size_t kMaxSmallBlockSize = kHugePageSize / 2;
+
+bool UsesHugePages(const AllocationPolicy& policy) {
+#ifdef __linux__
+  return policy.huge_pages != HugePageMode::kNone;
+#else
+  return false;
+#endif
+}
+
+bool IsHugePageBlock(const AllocationPolicy& policy, size_t size) {
+  return UsesHugePages(policy) && size > kMaxSmallBlockSize;
+}
+
+#ifdef __linux__
+SizedPtr AllocateHugePages(size_t size, HugePageMode mode) {
+  size = (size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+  constexpr int kFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+  if (mode == HugePageMode::kHugeTlb) {
+#ifdef MAP_HUGETLB
+    // MAP_HUGE_2MB, spelled out for older headers.
+    constexpr int kHuge2Mb = 21 << 26;
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   kFlags | MAP_HUGETLB | kHuge2Mb, -1, 0);
+    if (p != MAP_FAILED) return {p, size};
+#endif  // MAP_HUGETLB
+  }
+
+  // Over-map by one huge page so the region can be trimmed to alignment.
+  void* mapping = mmap(nullptr, size + kHugePageSize, PROT_READ | PROT_WRITE,
+                       kFlags, -1, 0);
+  ABSL_CHECK(mapping != MAP_FAILED)
+      << "Failed to map " << size << " bytes for an arena block";
+  auto start = reinterpret_cast<uintptr_t>(mapping);
+  auto aligned = (start + kHugePageSize - 1) & ~(kHugePageSize - 1);
+  if (aligned != start) {
+    munmap(mapping, aligned - start);
+  }
+  if (size_t tail = start + kHugePageSize - aligned) {
+    munmap(reinterpret_cast<void*>(aligned + size), tail);
+  }
+  void* p = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+  madvise(p, size, MADV_HUGEPAGE);
+#endif  // MADV_HUGEPAGE
+  return {p, size};
+}
+
+void FreeHugePages(SizedPtr mem) { munmap(mem.p, mem.n); }
+#else
+SizedPtr AllocateHugePages(size_t, HugePageMode) {
+  ABSL_LOG(FATAL) << "Huge pages are not supported on this platform";
+  return {nullptr, 0};
+}
+
+void FreeHugePages(SizedPtr) {}
+#endif  // __linux__
+
 }  // namespace
 
+struct ArenaBlockPoolAccess {
+  static SizedPtr Allocate(ArenaBlockPool* pool, size_t size) {
+    return pool->Allocate(size);
+  }
+  static size_t StartBlockSize(const ArenaBlockPool* pool) {
+    return pool->StartBlockSize();
+  }
+  static void Release(ArenaBlockPool* pool, SizedPtr mem) {
+    pool->Release(mem);
+  }
+  static void RecordArenaSize(ArenaBlockPool* pool, size_t bytes) {
+    pool->RecordArenaSize(bytes);
+  }
+};
+
+// `first_block` is set only for the block holding the AllocationPolicy, which
+// a block pool may size from the footprint of earlier arenas.
 static SizedPtr AllocateMemory(const AllocationPolicy* policy_ptr,
-                               size_t last_size, size_t min_bytes) {
+                               size_t last_size, size_t min_bytes,
+                               bool first_block = false) {
   AllocationPolicy policy;  // default policy
   if (policy_ptr) policy = *policy_ptr;
   size_t size;
   if (last_size != 0) {
     // Double the current block size, up to a limit.
     auto max_size = policy.max_block_size;
+    if (UsesHugePages(policy)) max_size = std::max(max_size, kHugePageSize);
     size = std::min(2 * last_size, max_size);
   } else {
     size = policy.start_block_size;
@@ -77,17 +165,32 @@ static SizedPtr AllocateMemory(const AllocationPolicy* policy_ptr,
   ABSL_CHECK_LE(min_bytes, std::numeric_limits<size_t>::max() -
                                SerialArena::kBlockHeaderSize);
   size = std::max(size, SerialArena::kBlockHeaderSize + min_bytes);
+  if (first_block && policy.block_pool != nullptr) {
+    size = std::max(size,
+                    ArenaBlockPoolAccess::StartBlockSize(policy.block_pool));
+  }
 
-  if (policy.block_alloc == nullptr) {
-    return AllocateAtLeast(size);
+  if (IsHugePageBlock(policy, size)) {
+    return AllocateHugePages(size, policy.huge_pages);
   }
-  return {policy.block_alloc(size), size};
+  if (policy.block_alloc != nullptr && policy.block_pool == nullptr) {
+    return {policy.block_alloc(size), size};
+  }
+  SizedPtr mem = policy.block_pool != nullptr
+                     ? ArenaBlockPoolAccess::Allocate(policy.block_pool, size)
+                     : AllocateAtLeast(size);
+  // Never let a block that was rounded up be taken for a huge page region.
+  // Sized delete accepts any size between the requested and the returned one.
+  if (IsHugePageBlock(policy, mem.n)) mem.n = size;
+  return mem;
 }
 
 class GetDeallocator {
  public:
   GetDeallocator(const AllocationPolicy* policy, size_t* space_allocated)
       : dealloc_(policy ? policy->block_dealloc : nullptr),
+        pool_(policy ? policy->block_pool : nullptr),
+        huge_pages_(policy != nullptr && UsesHugePages(*policy)),
         space_allocated_(space_allocated) {}
 
   void operator()(SizedPtr mem) const {
@@ -96,7 +199,11 @@ class GetDeallocator {
     // so return it in an unpoisoned state.
     ASAN_UNPOISON_MEMORY_REGION(mem.p, mem.n);
 #endif  // ADDRESS_SANITIZER
-    if (dealloc_) {
+    if (huge_pages_ && mem.n > kMaxSmallBlockSize) {
+      FreeHugePages(mem);
+    } else if (pool_) {
+      ArenaBlockPoolAccess::Release(pool_, mem);
+    } else if (dealloc_) {
       dealloc_(mem.p, mem.n);
     } else {
       internal::SizedDelete(mem.p, mem.n);
@@ -106,6 +213,8 @@ class GetDeallocator {
 
  private:
   void (*dealloc_)(void*, size_t);
+  ArenaBlockPool* pool_;
+  bool huge_pages_;
   size_t* space_allocated_;
 };
 
@@ -544,7 +653,7 @@ ArenaBlock* ThreadSafeArena::FirstBlock(void* buf, size_t size,
 
   SizedPtr mem;
   if (buf == nullptr || size < kBlockHeaderSize + kAllocPolicySize) {
-    mem = AllocateMemory(&policy, 0, kAllocPolicySize);
+    mem = AllocateMemory(&policy, 0, kAllocPolicySize, /*first_block=*/true);
   } else {
     mem = {buf, size};
     // Record user-owned block.
@@ -678,6 +787,9 @@ ThreadSafeArena::~ThreadSafeArena() {
   // refer to memory in other blocks.
   CleanupList();
 
+  // The policy lives in the first block, so read it before that is freed.
+  ArenaBlockPool* pool =
+      alloc_policy_.get() != nullptr ? alloc_policy_->block_pool : nullptr;
   size_t space_allocated = 0;
   auto mem = Free(&space_allocated);
   if (alloc_policy_.is_user_owned_initial_block()) {
@@ -689,6 +801,9 @@ ThreadSafeArena::~ThreadSafeArena() {
   } else if (mem.n > 0) {
     GetDeallocator(alloc_policy_.get(), &space_allocated)(mem);
   }
+  if (pool != nullptr) {
+    ArenaBlockPoolAccess::RecordArenaSize(pool, space_allocated);
+  }
 }
 
 SizedPtr ThreadSafeArena::Free(size_t* space_allocated) {
@@ -730,6 +845,11 @@ uint64_t ThreadSafeArena::Reset() {
   size_t space_allocated = 0;
   auto mem = Free(&space_allocated);
   space_allocated += mem.n;
+  if (alloc_policy_.get() != nullptr &&
+      alloc_policy_->block_pool != nullptr) {
+    ArenaBlockPoolAccess::RecordArenaSize(alloc_policy_->block_pool,
+                                          space_allocated);
+  }
 
   // Reset the first arena with the first block. This avoids redundant
   // free / allocation and re-allocating for AllocationPolicy. Adjust offset if
@@ -830,6 +950,28 @@ uint64_t ThreadSafeArena::SpaceAllocated() const {
   return space_allocated;
 }
 
+uint64_t ThreadSafeArena::SpaceAllocatedOnHugePages() const {
+  const AllocationPolicy* policy = alloc_policy_.get();
+  if (policy == nullptr || !UsesHugePages(*policy)) return 0;
+  // Blocks are only ever prepended and are not freed while the arena is in
+  // use, so the lists can be walked while other threads allocate.
+  uint64_t space_allocated = 0;
+  auto add_blocks = [&](const SerialArena* serial) {
+    for (const ArenaBlock* b = serial->head_.load(std::memory_order_acquire);
+         b != nullptr; b = b->next) {
+      // A user-owned initial block is never a huge page region.
+      if (b->next == nullptr && serial == &first_arena_ &&
+          alloc_policy_.is_user_owned_initial_block()) {
+        break;
+      }
+      if (IsHugePageBlock(*policy, b->size)) space_allocated += b->size;
+    }
+  };
+  add_blocks(&first_arena_);
+  PerConstSerialArenaInChunk(add_blocks);
+  return space_allocated;
+}
+
 uint64_t ThreadSafeArena::SpaceUsed() const {
   // First arena is inlined to ThreadSafeArena and the first block's overhead is
   // smaller than others that contain SerialArena.
@@ -44,6 +44,7 @@ namespace protobuf {
 
 struct ArenaOptions;  // defined below
 class Arena;    // defined below
+class ArenaBlockPool;  // defined in arena_block_pool.h
 class Message;  // defined in message.h
 class MessageLite;
 template <typename Key, typename T>
@@ -121,6 +122,25 @@ struct ArenaOptions {
   // calls free.
   void (*block_dealloc)(void*, size_t) = nullptr;
 
+  // A pool to take blocks from and return them to, or nullptr to allocate
+  // blocks directly. The pool must outlive the arena. When set, block_alloc
+  // and block_dealloc are ignored.
+  ArenaBlockPool* block_pool = nullptr;
+
+  // Whether to back large blocks with 2 MiB huge pages, which reduces TLB
+  // misses when traversing large arenas. In these modes blocks keep doubling
+  // past max_block_size until they reach 2 MiB; blocks over 1 MiB are then
+  // carved out of 2 MiB-aligned regions mapped directly from the kernel,
+  // bypassing block_alloc and block_pool. Arenas that stay small never use
+  // huge pages.
+  //
+  // kTransparent advises the kernel to use transparent huge pages for the
+  // regions. kHugeTlb maps them from the preallocated hugetlbfs pool and
+  // falls back to kTransparent when that pool is exhausted. Both are ignored
+  // on platforms other than Linux.
+  using HugePageMode = internal::HugePageMode;
+  HugePageMode huge_pages = HugePageMode::kNone;
+
  private:
   internal::AllocationPolicy AllocationPolicy() const {
     internal::AllocationPolicy res;
@@ -128,6 +148,8 @@ struct ArenaOptions {
     res.max_block_size = max_block_size;
     res.block_alloc = block_alloc;
     res.block_dealloc = block_dealloc;
+    res.block_pool = block_pool;
+    res.huge_pages = huge_pages;
     return res;
   }
 
@@ -319,6 +341,12 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
   // can lead to underestimates of the space used, and race conditions can lead
   // to overestimates (up to the current block size).
   uint64_t SpaceUsed() const { return impl_.SpaceUsed(); }
+  // Returns the part of SpaceAllocated() that lies in huge page regions, see
+  // `ArenaOptions::huge_pages`. With HugePageMode::kTransparent the kernel may
+  // still back some of these regions with small pages.
+  uint64_t SpaceAllocatedOnHugePages() const {
+    return impl_.SpaceAllocatedOnHugePages();
+  }
 
   // Frees all storage allocated by this arena after calling destructors
   // registered with OwnDestructor() and freeing objects registered with Own().
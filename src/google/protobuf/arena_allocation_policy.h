@@ -13,8 +13,17 @@
 
 namespace google {
 namespace protobuf {
+class ArenaBlockPool;  // defined in arena_block_pool.h
+
 namespace internal {
 
+// How an arena backs its large blocks. See `ArenaOptions::huge_pages`.
+enum class HugePageMode : uint8_t {
+  kNone,
+  kTransparent,
+  kHugeTlb,
+};
+
 // `AllocationPolicy` defines `Arena` allocation policies. Applications can
 // customize the initial and maximum sizes for arena allocation, as well as set
 // custom allocation and deallocation functions. `AllocationPolicy` is for
@@ -30,10 +39,15 @@ struct AllocationPolicy {
   void* (*block_alloc)(size_t) = nullptr;
   void (*block_dealloc)(void*, size_t) = nullptr;
 
+  ArenaBlockPool* block_pool = nullptr;
+
+  HugePageMode huge_pages = HugePageMode::kNone;
+
   bool IsDefault() const {
     return start_block_size == kDefaultStartBlockSize &&
            max_block_size == kDefaultMaxBlockSize && block_alloc == nullptr &&
-           block_dealloc == nullptr;
+           block_dealloc == nullptr && block_pool == nullptr &&
+           huge_pages == HugePageMode::kNone;
   }
 };
 
@@ -0,0 +1,143 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/arena_block_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/numeric/bits.h"
+#include "absl/synchronization/mutex.h"
+#include "google/protobuf/arena_allocation_policy.h"
+#include "google/protobuf/port.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+// Index of the largest size class not above `n`.
+int FloorClass(size_t n) { return absl::bit_width(n) - 1; }
+
+// Index of the smallest size class not below `n`.
+int CeilClass(size_t n) { return absl::bit_width(n - 1); }
+
+}  // namespace
+
+ArenaBlockPool::ArenaBlockPool() : ArenaBlockPool(Options()) {}
+
+ArenaBlockPool::ArenaBlockPool(const Options& options) : options_(options) {}
+
+ArenaBlockPool::~ArenaBlockPool() { Clear(); }
+
+ArenaBlockPool* ArenaBlockPool::Global() {
+  static ArenaBlockPool* pool = new ArenaBlockPool();
+  return pool;
+}
+
+ArenaBlockPool::Stats ArenaBlockPool::GetStats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.drops = drops_.load(std::memory_order_relaxed);
+  {
+    absl::MutexLock lock(&mutex_);
+    stats.cached_bytes = cached_bytes_;
+  }
+  stats.start_block_size = StartBlockSize();
+  return stats;
+}
+
+size_t ArenaBlockPool::StartBlockSize() const {
+  if (!options_.learn_start_block_size) return 0;
+  size_t size = average_arena_size_.load(std::memory_order_relaxed);
+  if (size == 0) return 0;
+  return std::min(size_t{1} << CeilClass(size),
+                  options_.max_pooled_block_size);
+}
+
+void ArenaBlockPool::Clear() {
+  FreeBlock* lists[kNumClasses];
+  {
+    absl::MutexLock lock(&mutex_);
+    std::copy(std::begin(free_lists_), std::end(free_lists_), lists);
+    std::fill(std::begin(free_lists_), std::end(free_lists_), nullptr);
+    cached_bytes_ = 0;
+  }
+  for (int c = 0; c < kNumClasses; ++c) {
+    const size_t size = size_t{1} << (c + kMinClass);
+    for (FreeBlock* b = lists[c]; b != nullptr;) {
+      FreeBlock* next = b->next;
+      internal::SizedDelete(b, size);
+      b = next;
+    }
+  }
+}
+
+internal::SizedPtr ArenaBlockPool::Allocate(size_t size) {
+  if (size > options_.max_pooled_block_size) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return internal::AllocateAtLeast(size);
+  }
+
+  const int c = std::max(CeilClass(size), kMinClass);
+  const size_t class_size = size_t{1} << c;
+  {
+    absl::MutexLock lock(&mutex_);
+    FreeBlock*& head = free_lists_[c - kMinClass];
+    if (head != nullptr) {
+      FreeBlock* b = head;
+      head = b->next;
+      cached_bytes_ -= class_size;
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return {b, class_size};
+    }
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return {::operator new(class_size), class_size};
+}
+
+void ArenaBlockPool::Release(internal::SizedPtr mem) {
+  if (mem.n >= (size_t{1} << kMinClass) &&
+      mem.n <= options_.max_pooled_block_size) {
+    // Pooled blocks are freed by Clear() using their class size, so only
+    // blocks whose size is exactly a class size can be cached.  Blocks from
+    // Allocate() always are, unless they were too large to pool.
+    const int c = FloorClass(mem.n);
+    if ((size_t{1} << c) == mem.n) {
+      absl::MutexLock lock(&mutex_);
+      if (cached_bytes_ + mem.n <= options_.max_cached_bytes) {
+        auto* b = static_cast<FreeBlock*>(mem.p);
+        b->next = free_lists_[c - kMinClass];
+        free_lists_[c - kMinClass] = b;
+        cached_bytes_ += mem.n;
+        return;
+      }
+    }
+  }
+  drops_.fetch_add(1, std::memory_order_relaxed);
+  internal::SizedDelete(mem.p, mem.n);
+}
+
+void ArenaBlockPool::RecordArenaSize(size_t bytes) {
+  // An exponential moving average that gives recent arenas a weight of 1/4.
+  // Races between concurrent updates only lose a sample.
+  size_t average = average_arena_size_.load(std::memory_order_relaxed);
+  average = average == 0 ? bytes : average - average / 4 + bytes / 4;
+  average_arena_size_.store(
+      std::min(average, options_.max_pooled_block_size),
+      std::memory_order_relaxed);
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
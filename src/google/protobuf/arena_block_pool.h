@@ -0,0 +1,130 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// This file defines ArenaBlockPool, a cache of memory blocks that can be
+// shared by many Arena instances.
+
+#ifndef GOOGLE_PROTOBUF_ARENA_BLOCK_POOL_H__
+#define GOOGLE_PROTOBUF_ARENA_BLOCK_POOL_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "google/protobuf/port.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace internal {
+struct ArenaBlockPoolAccess;  // defined in arena.cc
+}  // namespace internal
+
+// A pool of arena blocks shared by arenas created with
+// `ArenaOptions::block_pool`.
+//
+// An arena normally mallocs every block it uses and frees them all when it is
+// destroyed, so a server that creates one arena per request spends a
+// noticeable amount of time in malloc and free, and every arena starts again
+// from a tiny first block.  Arenas that use a pool instead take blocks from,
+// and return blocks to, the pool's free lists.  Blocks are kept in power of
+// two size classes; blocks larger than `Options::max_pooled_block_size` are
+// never cached.
+//
+// The pool also learns how much memory its arenas typically use: the first
+// block of a new arena is sized to a running average of the memory held by
+// previously destroyed (or reset) arenas.  Since that is only useful when the
+// arenas have similar footprints, use one pool per call site rather than one
+// pool for unrelated workloads; `Global()` is a reasonable default when there
+// is a single dominant use.
+//
+// ArenaBlockPool is thread-safe.  It must outlive every arena that uses it.
+class PROTOBUF_EXPORT ArenaBlockPool {
+ public:
+  struct Options {
+    // The total size of cached blocks is kept below this limit; blocks
+    // returned while the pool is full are freed.
+    size_t max_cached_bytes = size_t{64} << 20;
+
+    // Blocks larger than this are allocated and freed directly.
+    size_t max_pooled_block_size = size_t{1} << 20;
+
+    // Whether to size the first block of new arenas from the memory held by
+    // earlier ones.
+    bool learn_start_block_size = true;
+  };
+
+  struct Stats {
+    // Block requests served from the pool.
+    uint64_t hits = 0;
+    // Block requests that had to allocate.
+    uint64_t misses = 0;
+    // Blocks freed instead of cached, because they were too large or the pool
+    // was full.
+    uint64_t drops = 0;
+    // Bytes currently cached.
+    size_t cached_bytes = 0;
+    // Size given to the first block of new arenas.
+    size_t start_block_size = 0;
+  };
+
+  ArenaBlockPool();
+  explicit ArenaBlockPool(const Options& options);
+  ArenaBlockPool(const ArenaBlockPool&) = delete;
+  ArenaBlockPool& operator=(const ArenaBlockPool&) = delete;
+  ~ArenaBlockPool();
+
+  // A process-wide pool, never destroyed.
+  static ArenaBlockPool* Global();
+
+  Stats GetStats() const;
+
+  // Frees all cached blocks.
+  void Clear();
+
+ private:
+  friend struct internal::ArenaBlockPoolAccess;
+
+  // Smallest pooled size class: 2^kMinClass bytes.
+  static constexpr int kMinClass = 8;
+  static constexpr int kNumClasses = 56;
+
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  // Returns a block of at least `size` bytes.
+  internal::SizedPtr Allocate(size_t size);
+  // The learned size for the first block of an arena, or 0 if none.
+  size_t StartBlockSize() const;
+  void Release(internal::SizedPtr mem);
+  // Records the total memory held by an arena when it is destroyed or reset.
+  void RecordArenaSize(size_t bytes);
+
+  const Options options_;
+
+  mutable absl::Mutex mutex_;
+  FreeBlock* free_lists_[kNumClasses] ABSL_GUARDED_BY(mutex_) = {};
+  size_t cached_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> drops_{0};
+  // Running average of RecordArenaSize() arguments.
+  std::atomic<size_t> average_arena_size_{0};
+};
+
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_ARENA_BLOCK_POOL_H__
@@ -0,0 +1,187 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2023 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Measures random traversal of a large message tree parsed into arenas with
+// and without huge page backed blocks. Where perf events are available the
+// data TLB misses are reported next to the timings.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/unittest.pb.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // __linux__
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using ::protobuf_unittest::TestAllTypes;
+
+// Counts data TLB read misses of the calling thread, or reports -1 if perf
+// events are unavailable.
+class DtlbMissCounter {
+ public:
+  DtlbMissCounter() {
+#ifdef __linux__
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif  // __linux__
+  }
+  ~DtlbMissCounter() {
+#ifdef __linux__
+    if (fd_ >= 0) close(fd_);
+#endif  // __linux__
+  }
+
+  void Start() {
+#ifdef __linux__
+    if (fd_ < 0) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif  // __linux__
+  }
+
+  int64_t Stop() {
+#ifdef __linux__
+    if (fd_ < 0) return -1;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    int64_t count;
+    if (read(fd_, &count, sizeof(count)) != sizeof(count)) return -1;
+    return count;
+#else
+    return -1;
+#endif  // __linux__
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+// A message with many small sub-messages, interleaved with strings so that
+// the sub-messages are spread over the arena.
+std::string MakeInput(int num_elements) {
+  TestAllTypes message;
+  for (int i = 0; i < num_elements; ++i) {
+    message.add_repeated_nested_message()->set_bb(i);
+    message.add_repeated_string(std::string(40, 'x'));
+  }
+  return message.SerializeAsString();
+}
+
+struct Result {
+  std::string name;
+  double nanos_per_access;
+  int64_t dtlb_misses;
+  uint64_t space_allocated;
+  uint64_t space_on_huge_pages;
+};
+
+Result Traverse(absl::string_view name, const std::string& input,
+                ArenaOptions::HugePageMode mode) {
+  ArenaOptions options;
+  options.huge_pages = mode;
+  Arena arena(options);
+  auto* message = Arena::CreateMessage<TestAllTypes>(&arena);
+  if (!message->ParseFromString(input)) {
+    absl::PrintF("Failed to parse input\n");
+    abort();
+  }
+
+  const int size = message->repeated_nested_message_size();
+  std::vector<int> order(size);
+  for (int i = 0; i < size; ++i) order[i] = i;
+  absl::BitGen gen;
+  std::shuffle(order.begin(), order.end(), gen);
+
+  DtlbMissCounter counter;
+  constexpr int kRounds = 4;
+  int64_t sum = 0;
+  const absl::Time start = absl::Now();
+  counter.Start();
+  for (int round = 0; round < kRounds; ++round) {
+    for (int i : order) sum += message->repeated_nested_message(i).bb();
+  }
+  const int64_t misses = counter.Stop();
+  const absl::Duration elapsed = absl::Now() - start;
+  // Keep the traversal from being optimized away.
+  if (sum == -1) absl::PrintF("%d\n", sum);
+
+  return {std::string(name),
+          absl::ToDoubleNanoseconds(elapsed) / (kRounds * size), misses,
+          arena.SpaceAllocated(), arena.SpaceAllocatedOnHugePages()};
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main() {
+  using google::protobuf::ArenaOptions;
+  using google::protobuf::Result;
+
+  const std::string input = google::protobuf::MakeInput(4 << 20);
+  std::vector<Result> results;
+  results.push_back(google::protobuf::Traverse(
+      "SmallPages", input, ArenaOptions::HugePageMode::kNone));
+  results.push_back(google::protobuf::Traverse(
+      "TransparentHugePages", input,
+      ArenaOptions::HugePageMode::kTransparent));
+  results.push_back(google::protobuf::Traverse(
+      "HugeTlbPages", input, ArenaOptions::HugePageMode::kHugeTlb));
+
+  absl::PrintF("{\n");
+  absl::PrintF("  \"benchmarks\": [\n");
+  absl::string_view comma;
+  for (const auto& result : results) {
+    absl::PrintF("    %s{\n", comma);
+    absl::PrintF("      \"cpu_time\": %f,\n", result.nanos_per_access);
+    absl::PrintF("      \"real_time\": %f,\n", result.nanos_per_access);
+    absl::PrintF("      \"dtlb_misses\": %d,\n", result.dtlb_misses);
+    absl::PrintF("      \"space_allocated\": %d,\n", result.space_allocated);
+    absl::PrintF("      \"space_on_huge_pages\": %d,\n",
+                 result.space_on_huge_pages);
+    absl::PrintF("      \"iterations\": 1,\n");
+    absl::PrintF("      \"name\": \"%s\",\n",
+                 absl::StrCat("RandomTraversal/", result.name));
+    absl::PrintF("      \"time_unit\": \"ns\"\n");
+    absl::PrintF("    }\n");
+    comma = ",";
+  }
+  absl::PrintF("  ],\n");
+  absl::PrintF("  \"context\": {\n");
+  absl::PrintF("  }\n");
+  absl::PrintF("}\n");
+
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include "absl/log/absl_check.h"
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/barrier.h"
+#include "google/protobuf/arena_block_pool.h"
 #include "google/protobuf/arena_test_util.h"
 #include "google/protobuf/descriptor.h"
 #include "google/protobuf/extension_set.h"
@@ -1445,6 +1446,155 @@ TEST(ArenaTest, BlockSizeSmallerThanAllocation) {
   }
 }
 
+void FillArena(Arena* arena, int bytes) {
+  for (int i = 0; i < bytes / 64; ++i) {
+    memset(Arena::CreateArray<char>(arena, 64), 0, 64);
+  }
+}
+
+TEST(ArenaTest, BlockPoolReusesBlocks) {
+  ArenaBlockPool::Options pool_options;
+  pool_options.learn_start_block_size = false;
+  ArenaBlockPool pool(pool_options);
+  ArenaOptions options;
+  options.block_pool = &pool;
+
+  {
+    Arena arena(options);
+    FillArena(&arena, 100 << 10);
+  }
+  ArenaBlockPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_GT(stats.misses, 0);
+  EXPECT_EQ(stats.drops, 0);
+  EXPECT_GT(stats.cached_bytes, 100 << 10);
+
+  for (int i = 0; i < 3; ++i) {
+    Arena arena(options);
+    FillArena(&arena, 100 << 10);
+  }
+  EXPECT_EQ(pool.GetStats().misses, stats.misses);
+  EXPECT_EQ(pool.GetStats().hits, 3 * stats.misses);
+  EXPECT_EQ(pool.GetStats().cached_bytes, stats.cached_bytes);
+
+  pool.Clear();
+  EXPECT_EQ(pool.GetStats().cached_bytes, 0);
+}
+
+TEST(ArenaTest, BlockPoolLearnsStartBlockSize) {
+  ArenaBlockPool pool;
+  ArenaOptions options;
+  options.block_pool = &pool;
+  EXPECT_EQ(pool.GetStats().start_block_size, 0);
+
+  for (int i = 0; i < 4; ++i) {
+    Arena arena(options);
+    FillArena(&arena, 100 << 10);
+  }
+  const size_t start_block_size = pool.GetStats().start_block_size;
+  EXPECT_GE(start_block_size, 100 << 10);
+
+  Arena arena(options);
+  Arena::CreateArray<char>(&arena, 1);
+  EXPECT_GE(arena.SpaceAllocated(), start_block_size);
+  FillArena(&arena, 90 << 10);
+  EXPECT_EQ(arena.SpaceAllocated(), start_block_size);
+
+  // Reset also feeds the running average.
+  arena.Reset();
+  EXPECT_EQ(pool.GetStats().start_block_size, start_block_size);
+}
+
+TEST(ArenaTest, BlockPoolDropsBlocksWhenFull) {
+  ArenaBlockPool::Options pool_options;
+  pool_options.max_cached_bytes = 64 << 10;
+  pool_options.max_pooled_block_size = 16 << 10;
+  ArenaBlockPool pool(pool_options);
+  ArenaOptions options;
+  options.block_pool = &pool;
+  options.max_block_size = 32 << 10;
+
+  {
+    Arena arena(options);
+    FillArena(&arena, 1 << 20);
+  }
+  ArenaBlockPool::Stats stats = pool.GetStats();
+  EXPECT_GT(stats.drops, 0);
+  EXPECT_LE(stats.cached_bytes, 64 << 10);
+  EXPECT_LE(stats.start_block_size, 16 << 10);
+}
+
+TEST(ArenaTest, BlockPoolIsThreadSafe) {
+  ArenaBlockPool pool;
+  ArenaOptions options;
+  options.block_pool = &pool;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 50; ++i) {
+        Arena arena(options);
+        auto* message = Arena::CreateMessage<TestAllTypes>(&arena);
+        TestUtil::SetAllFields(message);
+        FillArena(&arena, 16 << 10);
+        TestUtil::ExpectAllFieldsSet(*message);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_GT(pool.GetStats().hits, 0);
+}
+
+TEST(ArenaTest, HugePages) {
+  for (auto mode : {ArenaOptions::HugePageMode::kTransparent,
+                    ArenaOptions::HugePageMode::kHugeTlb}) {
+    ArenaOptions options;
+    options.huge_pages = mode;
+    Arena arena(options);
+
+    // Small arenas only use small blocks.
+    FillArena(&arena, 64 << 10);
+    EXPECT_EQ(arena.SpaceAllocatedOnHugePages(), 0);
+
+    FillArena(&arena, 8 << 20);
+    char* large = Arena::CreateArray<char>(&arena, 3 << 20);
+    memset(large, 1, 3 << 20);
+#ifdef __linux__
+    EXPECT_GE(arena.SpaceAllocatedOnHugePages(), 8 << 20);
+    EXPECT_LE(arena.SpaceAllocatedOnHugePages(),
+              arena.SpaceAllocated() - (1 << 20));
+#else
+    EXPECT_EQ(arena.SpaceAllocatedOnHugePages(), 0);
+#endif
+
+    arena.Reset();
+    EXPECT_EQ(arena.SpaceAllocatedOnHugePages(), 0);
+    FillArena(&arena, 4 << 20);
+  }
+}
+
+TEST(ArenaTest, HugePagesWithInitialBlockAndPool) {
+  ArenaBlockPool pool;
+  std::vector<char> initial_block(2 << 20);
+  ArenaOptions options;
+  options.huge_pages = ArenaOptions::HugePageMode::kTransparent;
+  options.block_pool = &pool;
+  options.initial_block = initial_block.data();
+  options.initial_block_size = initial_block.size();
+
+  for (int i = 0; i < 3; ++i) {
+    Arena arena(options);
+    FillArena(&arena, 6 << 20);
+#ifdef __linux__
+    EXPECT_GE(arena.SpaceAllocatedOnHugePages(), 2 << 20);
+    EXPECT_LE(arena.SpaceAllocatedOnHugePages(),
+              arena.SpaceAllocated() - initial_block.size());
+#endif
+  }
+  // Huge page regions never end up in the pool.
+  EXPECT_LE(pool.GetStats().cached_bytes, 2 << 20);
+}
+
 TEST(ArenaTest, GetArenaShouldReturnTheArenaForArenaAllocatedMessages) {
   Arena arena;
   ArenaMessage* message = Arena::CreateMessage<ArenaMessage>(&arena);
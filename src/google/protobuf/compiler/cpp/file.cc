@@ -645,6 +645,11 @@ void FileGenerator::GenerateSourceIncludes(io::Printer* p) {
     IncludeFile("third_party/protobuf/generated_message_tctable_impl.h", p);
   }
 
+  if (options_.json_serializer && HasDescriptorMethods(file_, options_) &&
+      HasGeneratedMethods(file_, options_)) {
+    IncludeFile("third_party/protobuf/json/internal/generated_serializer.h", p);
+  }
+
   if (options_.proto_h) {
     // Use the smaller .proto.h files.
     for (int i = 0; i < file_->dependency_count(); ++i) {
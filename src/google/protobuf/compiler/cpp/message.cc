@@ -21,12 +21,14 @@
 #include <utility>
 #include <vector>
 
+#include "absl/algorithm/container.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/escaping.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
@@ -236,6 +238,64 @@ bool EmitFieldNonDefaultCondition(io::Printer* p, const std::string& prefix,
   return false;
 }
 
+// Messages whose known fields can never encode to more than this many bytes
+// are serialized through a stack buffer; see FixedLayoutMaxSize().
+constexpr size_t kMaxFixedLayoutSize = 128;
+
+// Returns an upper bound on the encoded size of a value of `field`, not
+// counting the tag, or 0 if the field is not a scalar.
+size_t MaxScalarValueSize(const FieldDescriptor* field) {
+  switch (field->type()) {
+    case FieldDescriptor::TYPE_BOOL:
+      return 1;
+    case FieldDescriptor::TYPE_FIXED32:
+    case FieldDescriptor::TYPE_SFIXED32:
+    case FieldDescriptor::TYPE_FLOAT:
+      return 4;
+    case FieldDescriptor::TYPE_FIXED64:
+    case FieldDescriptor::TYPE_SFIXED64:
+    case FieldDescriptor::TYPE_DOUBLE:
+      return 8;
+    case FieldDescriptor::TYPE_UINT32:
+    case FieldDescriptor::TYPE_SINT32:
+      return 5;
+    // Negative int32 and enum values are sign-extended to ten bytes.  Closed
+    // enums are not bounded more tightly: release builds don't check the
+    // value passed to the setter.
+    case FieldDescriptor::TYPE_INT32:
+    case FieldDescriptor::TYPE_ENUM:
+    case FieldDescriptor::TYPE_INT64:
+    case FieldDescriptor::TYPE_UINT64:
+    case FieldDescriptor::TYPE_SINT64:
+      return 10;
+    default:
+      return 0;
+  }
+}
+
+// Returns the maximum encoded size of the known fields of `descriptor` if they
+// are all singular, non-oneof scalars and that size is at most
+// kMaxFixedLayoutSize.  Returns 0 otherwise.
+size_t FixedLayoutMaxSize(const Descriptor* descriptor) {
+  if (descriptor->field_count() == 0 ||
+      descriptor->extension_range_count() > 0) {
+    return 0;
+  }
+  size_t max_size = 0;
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_repeated() || field->real_containing_oneof() ||
+        field->options().weak()) {
+      return 0;
+    }
+    size_t value_size = MaxScalarValueSize(field);
+    if (value_size == 0) return 0;
+    max_size +=
+        WireFormat::TagSize(field->number(), field->type()) + value_size;
+  }
+  return max_size <= kMaxFixedLayoutSize ? max_size : 0;
+}
+
 bool HasInternalHasMethod(const FieldDescriptor* field) {
   return !HasHasbit(field) &&
          field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE;
@@ -491,6 +551,47 @@ absl::flat_hash_map<absl::string_view, std::string> ClassVars(
   return vars;
 }
 
+// The name the JSON serializer uses for `field`; see
+// json_internal::Proto2Descriptor::FieldJsonName().
+absl::string_view JsonFieldName(const FieldDescriptor* field) {
+  return field->has_json_name() ? field->json_name() : field->camelcase_name();
+}
+
+bool IsPlainJsonName(absl::string_view name) {
+  return !name.empty() && absl::c_all_of(name, [](char c) {
+    return absl::ascii_isalnum(c) || c == '_';
+  });
+}
+
+// Returns true if the generated JSON serializer writes `field` itself rather
+// than handing it to the reflective serializer. Types in the google.protobuf
+// package may have a special JSON representation, and names that need escaping
+// are left to the writer.
+bool HasDirectJsonSerialization(const FieldDescriptor* field,
+                                const Options& options) {
+  if (field->is_map() || IsWeak(field, options) ||
+      field->type() == FieldDescriptor::TYPE_GROUP) {
+    return false;
+  }
+  if (!IsPlainJsonName(field->name()) ||
+      !IsPlainJsonName(JsonFieldName(field))) {
+    return false;
+  }
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+      // Other ctypes may have private or differently typed accessors.
+      return field->options().ctype() == FieldOptions::STRING;
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return !absl::StartsWith(field->enum_type()->full_name(),
+                               "google.protobuf.");
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return !absl::StartsWith(field->message_type()->full_name(),
+                               "google.protobuf.");
+    default:
+      return true;
+  }
+}
+
 }  // anonymous namespace
 
 // ===================================================================
@@ -2083,6 +2184,7 @@ void MessageGenerator::GenerateClassMethods(io::Printer* p) {
     GenerateByteSize(p);
     format("\n");
 
+    GenerateJsonSerializer(p);
     GenerateMergeFrom(p);
     format("\n");
 
@@ -3973,11 +4075,21 @@ void MessageGenerator::GenerateMergeFrom(io::Printer* p) {
                  )cc");
                }
              }},
+            {"json_serializer",
+             [&] {
+               // Left out otherwise, so that code generated without the
+               // option does not change.
+               if (!HasJsonSerializer()) return;
+               p->Emit(R"cc(
+                 &$classname$_json_serializer_,
+               )cc");
+             }},
         },
         R"cc(
           const ::$proto_ns$::Message::ClassData $classname$::_class_data_ = {
               $classname$::MergeImpl,
               $on_demand_register_arena_dtor$,
+              $json_serializer$,
           };
           const ::$proto_ns$::Message::ClassData* $classname$::GetClassData() const {
             return &_class_data_;
@@ -3994,6 +4106,197 @@ void MessageGenerator::GenerateMergeFrom(io::Printer* p) {
   }
 }
 
+bool MessageGenerator::HasJsonSerializer() const {
+  return options_.json_serializer &&
+         HasDescriptorMethods(descriptor_->file(), options_) &&
+         HasGeneratedMethods(descriptor_->file(), options_) &&
+         !HasSimpleBaseClass(descriptor_, options_) &&
+         !IsMapEntryMessage(descriptor_) &&
+         descriptor_->extension_range_count() == 0 &&
+         !IsWellKnownMessage(descriptor_->file());
+}
+
+void MessageGenerator::GenerateJsonSerializer(io::Printer* p) {
+  if (!HasJsonSerializer()) return;
+  // The serializer only uses the public accessors, so it does not need to be a
+  // member and the class definition is the same with or without it.
+  p->Emit(
+      {{"fields",
+        [&] {
+          for (const auto* field : SortFieldsByNumber(descriptor_)) {
+            GenerateJsonSerializeOneField(p, field);
+          }
+        }}},
+      R"cc(
+        namespace {
+        ::absl::Status $classname$_InternalSerializeJson(
+            const ::$proto_ns$::Message& msg,
+            ::$proto_ns$::json_internal::JsonWriter& writer, bool& first) {
+          const $classname$& this_ = static_cast<const $classname$&>(msg);
+          $fields$;
+          return ::absl::OkStatus();
+        }
+
+        constexpr ::$proto_ns$::json_internal::GeneratedSerializer
+            $classname$_json_serializer_ = {
+                $classname$_InternalSerializeJson,
+        };
+        }  // namespace
+      )cc");
+}
+
+void MessageGenerator::GenerateJsonSerializeOneField(
+    io::Printer* p, const FieldDescriptor* field) {
+  auto quoted = [](absl::string_view name) {
+    return absl::StrCat("\"\\\"", name, "\\\":\"");
+  };
+  auto v = p->WithVars({
+      {"name", FieldName(field)},
+      {"proto_name", field->name()},
+      {"number", field->number()},
+      {"index", field->index()},
+  });
+  auto write_reflectively = [&] {
+    p->Emit(R"cc(
+      ::absl::Status status =
+          ::$proto_ns$::json_internal::WriteFieldReflectively(
+              writer, this_, $classname$::descriptor()->field($index$), first);
+      if (!status.ok()) return status;
+    )cc");
+  };
+
+  if (!HasDirectJsonSerialization(field, options_)) {
+    p->Emit({{"write", write_reflectively}}, R"cc(
+      // $proto_name$ = $number$
+      {
+        $write$;
+      }
+    )cc");
+    return;
+  }
+
+  absl::string_view json_name = JsonFieldName(field);
+  std::string names = absl::StrCat(quoted(json_name), ", ");
+  if (absl::ascii_isupper(field->name()[0]) &&
+      !absl::ascii_isupper(json_name[0])) {
+    // The legacy JSON name is the field name itself; see WriteField() in
+    // json/internal/unparser.cc.
+    absl::StrAppend(&names, quoted(field->name()), ", ");
+  }
+  absl::StrAppend(&names, quoted(field->name()));
+
+  auto write_value = [&](absl::string_view value) {
+    auto v = p->WithVars({{"value", value}});
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_INT64:
+      case FieldDescriptor::CPPTYPE_UINT64:
+        p->Emit(R"cc(
+          ::$proto_ns$::json_internal::WriteInt64(writer, $value$);
+        )cc");
+        break;
+      case FieldDescriptor::CPPTYPE_BOOL:
+        p->Emit(R"cc(
+          ::$proto_ns$::json_internal::WriteBool(writer, $value$);
+        )cc");
+        break;
+      case FieldDescriptor::CPPTYPE_STRING:
+        if (field->type() == FieldDescriptor::TYPE_BYTES) {
+          p->Emit(R"cc(
+            writer.WriteBase64($value$);
+          )cc");
+        } else {
+          p->Emit(R"cc(
+            ::$proto_ns$::json_internal::WriteString(writer, $value$);
+          )cc");
+        }
+        break;
+      case FieldDescriptor::CPPTYPE_ENUM:
+        p->Emit(R"cc(
+          ::$proto_ns$::json_internal::WriteEnumField(
+              writer, $classname$::descriptor()->field($index$), $value$);
+        )cc");
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        p->Emit(R"cc(
+          {
+            ::absl::Status status =
+                ::$proto_ns$::json_internal::WriteMessageField(writer, $value$);
+            if (!status.ok()) return status;
+          }
+        )cc");
+        break;
+      default:
+        p->Emit(R"cc(
+          writer.Write($value$);
+        )cc");
+        break;
+    }
+  };
+
+  if (field->is_repeated()) {
+    p->Emit({{"names", names},
+             {"write_element", [&] { write_value("value"); }}},
+            R"cc(
+              // $proto_name$ = $number$
+              if (this_.$name$_size() > 0 ||
+                  writer.options().always_print_primitive_fields) {
+                ::$proto_ns$::json_internal::WriteFieldName(writer, first,
+                                                            $names$);
+                ::$proto_ns$::json_internal::StartList(writer);
+                bool first_element = true;
+                for (const auto& value : this_.$name$()) {
+                  ::$proto_ns$::json_internal::StartListElement(writer,
+                                                                first_element);
+                  $write_element$;
+                }
+                ::$proto_ns$::json_internal::EndList(writer, first_element);
+              }
+            )cc");
+    return;
+  }
+
+  p->Emit(
+      {{"names", names},
+       {"condition",
+        [&] {
+          if (field->has_presence()) {
+            p->Emit("this_.has_$name$()");
+          } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+            p->Emit("!this_.$name$().empty()");
+          } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_FLOAT ||
+                     field->cpp_type() == FieldDescriptor::CPPTYPE_DOUBLE) {
+            p->Emit("::$proto_ns$::json_internal::IsNonZero(this_.$name$())");
+          } else {
+            p->Emit("this_.$name$() != 0");
+          }
+        }},
+       {"write_value",
+        [&] { write_value(absl::StrCat("this_.", FieldName(field), "()")); }},
+       {"else",
+        [&] {
+          // Unset fields are printed with their default value under
+          // always_print_primitive_fields, unless they are part of a oneof or
+          // a message; see WriteFields() in json/internal/unparser.cc.
+          if (field->containing_oneof() != nullptr ||
+              field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+            p->Emit("}\n");
+            return;
+          }
+          p->Emit({{"write", write_reflectively}}, R"cc(
+            } else if (writer.options().always_print_primitive_fields) {
+              $write$;
+            }
+          )cc");
+        }}},
+      R"cc(
+        // $proto_name$ = $number$
+        if ($condition$) {
+          ::$proto_ns$::json_internal::WriteFieldName(writer, first, $names$);
+          $write_value$;
+        $else$;
+      )cc");
+}
+
 void MessageGenerator::GenerateClassSpecificMergeImpl(io::Printer* p) {
   if (HasSimpleBaseClass(descriptor_, options_)) return;
   // Generate the class-specific MergeFrom, which avoids the ABSL_CHECK and
@@ -4305,10 +4608,15 @@ void MessageGenerator::GenerateSerializeOneofFields(
 void MessageGenerator::GenerateSerializeOneField(io::Printer* p,
                                                  const FieldDescriptor* field,
                                                  int cached_has_bits_index) {
-  auto v = p->WithVars(FieldVars(field, options_));
-  auto emit_body = [&] {
+  GenerateSerializeOneField(p, field, cached_has_bits_index, [&] {
     field_generators_.get(field).GenerateSerializeWithCachedSizesToArray(p);
-  };
+  });
+}
+
+void MessageGenerator::GenerateSerializeOneField(
+    io::Printer* p, const FieldDescriptor* field, int cached_has_bits_index,
+    absl::FunctionRef<void()> emit_body) {
+  auto v = p->WithVars(FieldVars(field, options_));
 
   if (field->options().weak()) {
     emit_body();
@@ -4320,7 +4628,7 @@ void MessageGenerator::GenerateSerializeOneField(io::Printer* p,
   if (HasHasbit(field)) {
     p->Emit(
         {
-            {"body", emit_body},
+            {"body", [&] { emit_body(); }},
             {"cond",
              [&] {
                int has_bit_index = HasBitIndex(field);
@@ -4420,8 +4728,80 @@ void MessageGenerator::GenerateSerializeWithCachedSizesToArray(io::Printer* p) {
       )cc");
 }
 
+void MessageGenerator::GenerateSerializeUnknownFields(io::Printer* p) {
+  if (UseUnknownFieldSet(descriptor_->file(), options_)) {
+    p->Emit(R"cc(
+      target =
+          ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+              $unknown_fields$, target, stream);
+    )cc");
+  } else {
+    p->Emit(R"cc(
+      target = stream->WriteRaw(
+          $unknown_fields$.data(),
+          static_cast<int>($unknown_fields$.size()), target);
+    )cc");
+  }
+}
+
+void MessageGenerator::GenerateSerializeFixedLayoutBody(io::Printer* p,
+                                                        size_t max_size) {
+  // Emits the fields in number order, reloading cached_has_bits as needed.
+  // `unchecked` selects writes that skip the per-field EnsureSpace().
+  auto emit_fields = [&](bool unchecked) {
+    int cached_has_bit_index = kNoHasbit;
+    for (const auto* field : SortFieldsByNumber(descriptor_)) {
+      if (HasHasbit(field) &&
+          has_bit_indices_[field->index()] / 32 != cached_has_bit_index) {
+        cached_has_bit_index = has_bit_indices_[field->index()] / 32;
+        p->Emit({{"index", cached_has_bit_index}}, R"cc(
+          cached_has_bits = _impl_._has_bits_[$index$];
+        )cc");
+      }
+      if (!unchecked) {
+        GenerateSerializeOneField(p, field, cached_has_bit_index);
+        continue;
+      }
+      GenerateSerializeOneField(p, field, cached_has_bit_index, [&] {
+        p->Emit(R"cc(
+          target = ::_pbi::WireFormatLite::Write$DeclaredType$ToArray(
+              $number$, this->_internal_$name$(), target);
+        )cc");
+      });
+    }
+  };
+  p->Emit(
+      {
+          {"max_size", max_size},
+          {"unchecked_fields", [&] { emit_fields(true); }},
+          {"checked_fields", [&] { emit_fields(false); }},
+          {"handle_unknown_fields",
+           [&] { GenerateSerializeUnknownFields(p); }},
+      },
+      R"cc(
+        $uint32$ cached_has_bits = 0;
+        (void)cached_has_bits;
+
+        // All known fields are scalars that encode to at most $max_size$ bytes,
+        // so if the stream has that much room they are written without
+        // per-field bounds checks.
+        if (PROTOBUF_PREDICT_TRUE(stream->HasSpaceFor(target, $max_size$))) {
+          $unchecked_fields$;
+        } else {
+          $checked_fields$;
+        }
+        if (PROTOBUF_PREDICT_FALSE($have_unknown_fields$)) {
+          $handle_unknown_fields$;
+        }
+      )cc");
+}
+
 void MessageGenerator::GenerateSerializeWithCachedSizesBody(io::Printer* p) {
   if (HasSimpleBaseClass(descriptor_, options_)) return;
+  if (size_t max_size = FixedLayoutMaxSize(descriptor_)) {
+    GenerateSerializeFixedLayoutBody(p, max_size);
+    return;
+  }
   // If there are multiple fields in a row from the same oneof then we
   // coalesce them and emit a switch statement.  This is more efficient
   // because it lets the C++ compiler know this is a "at most one can happen"
@@ -4602,21 +4982,7 @@ void MessageGenerator::GenerateSerializeWithCachedSizesBody(io::Printer* p) {
              e.EmitIfNotNull(largest_weak_field.Release());
            }},
           {"handle_unknown_fields",
-           [&] {
-             if (UseUnknownFieldSet(descriptor_->file(), options_)) {
-               p->Emit(R"cc(
-                 target =
-                     ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                         $unknown_fields$, target, stream);
-               )cc");
-             } else {
-               p->Emit(R"cc(
-                 target = stream->WriteRaw(
-                     $unknown_fields$.data(),
-                     static_cast<int>($unknown_fields$.size()), target);
-               )cc");
-             }
-           }},
+           [&] { GenerateSerializeUnknownFields(p); }},
       },
       R"cc(
         $handle_weak_fields$;
@@ -4692,21 +5058,7 @@ void MessageGenerator::GenerateSerializeWithCachedSizesBodyShuffled(
              }
            }},
           {"handle_unknown_fields",
-           [&] {
-             if (UseUnknownFieldSet(descriptor_->file(), options_)) {
-               p->Emit(R"cc(
-                 target =
-                     ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                         $unknown_fields$, target, stream);
-               )cc");
-             } else {
-               p->Emit(R"cc(
-                 target = stream->WriteRaw(
-                     $unknown_fields$.data(),
-                     static_cast<int>($unknown_fields$.size()), target);
-               )cc");
-             }
-           }},
+           [&] { GenerateSerializeUnknownFields(p); }},
       },
       R"cc(
         $field_writer$;
@@ -12,6 +12,7 @@
 #ifndef GOOGLE_PROTOBUF_COMPILER_CPP_MESSAGE_H__
 #define GOOGLE_PROTOBUF_COMPILER_CPP_MESSAGE_H__
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -20,6 +21,7 @@
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/functional/function_ref.h"
 #include "google/protobuf/compiler/cpp/enum.h"
 #include "google/protobuf/compiler/cpp/extension.h"
 #include "google/protobuf/compiler/cpp/field.h"
@@ -118,9 +120,14 @@ class MessageGenerator {
   void GenerateSerializeWithCachedSizesToArray(io::Printer* p);
   void GenerateSerializeWithCachedSizesBody(io::Printer* p);
   void GenerateSerializeWithCachedSizesBodyShuffled(io::Printer* p);
+  void GenerateSerializeFixedLayoutBody(io::Printer* p, size_t max_size);
+  void GenerateSerializeUnknownFields(io::Printer* p);
   void GenerateByteSize(io::Printer* p);
   void GenerateMergeFrom(io::Printer* p);
   void GenerateClassSpecificMergeImpl(io::Printer* p);
+  void GenerateJsonSerializer(io::Printer* p);
+  void GenerateJsonSerializeOneField(io::Printer* p,
+                                      const FieldDescriptor* field);
   void GenerateCopyFrom(io::Printer* p);
   void GenerateSwap(io::Printer* p);
   void GenerateIsInitialized(io::Printer* p);
@@ -132,6 +139,10 @@ class MessageGenerator {
   // for cached_has_bit_index >= 0
   void GenerateSerializeOneField(io::Printer* p, const FieldDescriptor* field,
                                  int cached_has_bits_index);
+  // Same, but emits `emit_body` instead of the field generator's serializer.
+  void GenerateSerializeOneField(io::Printer* p, const FieldDescriptor* field,
+                                 int cached_has_bits_index,
+                                 absl::FunctionRef<void()> emit_body);
   // Generate a switch statement to serialize 2+ fields from the same oneof.
   // Or, if fields.size() == 1, just call GenerateSerializeOneField().
   void GenerateSerializeOneofFields(
@@ -169,6 +180,10 @@ class MessageGenerator {
   //   at construction.
   ArenaDtorNeeds NeedsArenaDestructor() const;
 
+  // Returns true if a JSON serializer is generated for this message; see
+  // json/internal/generated_serializer.h.
+  bool HasJsonSerializer() const;
+
   size_t HasBitsSize() const;
   size_t InlinedStringDonatedSize() const;
   absl::flat_hash_map<absl::string_view, std::string> HasBitVars(
@@ -93,6 +93,7 @@ class ParseFunctionGenerator::GeneratedOptionProvider final
         IsImplicitWeakField(field, gen_->options_, gen_->scc_analyzer_),
         UseDirectTcParserTable(field, gen_->options_),
         ShouldSplit(field, gen_->options_),
+        /* use_cord */ false,
     };
   }
 
@@ -211,14 +211,20 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> CppFeatures::_table_ = {
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
+  // All known fields are scalars that encode to at most 2 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[2];
+  ::uint8_t* ptr = buffer;
   cached_has_bits = _impl_._has_bits_[0];
   // optional bool legacy_closed_enum = 1 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_FILE, edition_defaults = {
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        1, this->_internal_legacy_closed_enum(), target);
+    ptr = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_legacy_closed_enum(), ptr);
   }
 
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -3534,21 +3534,26 @@ constexpr ::_pbi::TcParseTable<1, 2, 0, 0, 2> DescriptorProto_ReservedRange::_ta
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
+  // All known fields are scalars that encode to at most 22 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[22];
+  ::uint8_t* ptr = buffer;
   cached_has_bits = _impl_._has_bits_[0];
   // optional int32 start = 1;
   if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<1>(
-            stream, this->_internal_start(), target);
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_start(), ptr);
   }
 
   // optional int32 end = 2;
   if (cached_has_bits & 0x00000002u) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<2>(
-            stream, this->_internal_end(), target);
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_end(), ptr);
   }
 
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -5725,21 +5730,26 @@ constexpr ::_pbi::TcParseTable<1, 2, 0, 0, 2> EnumDescriptorProto_EnumReservedRa
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
+  // All known fields are scalars that encode to at most 22 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[22];
+  ::uint8_t* ptr = buffer;
   cached_has_bits = _impl_._has_bits_[0];
   // optional int32 start = 1;
   if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<1>(
-            stream, this->_internal_start(), target);
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_start(), ptr);
   }
 
   // optional int32 end = 2;
   if (cached_has_bits & 0x00000002u) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<2>(
-            stream, this->_internal_end(), target);
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_end(), ptr);
   }
 
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -46,6 +46,7 @@
 #include <memory>
 #include <new>
 
+#include "absl/strings/cord.h"
 #include "google/protobuf/arenastring.h"
 #include "google/protobuf/descriptor.h"
 #include "google/protobuf/descriptor.pb.h"
@@ -88,6 +89,20 @@ inline bool InRealOneof(const FieldDescriptor* field) {
          !OneofDescriptorLegacy(field->containing_oneof()).is_synthetic();
 }
 
+// Returns true if the field is laid out as an absl::Cord rather than an
+// ArenaStringPtr.  That is the case for singular bytes fields declared
+// [ctype=CORD], and for all other singular bytes fields if the factory was
+// asked to store bytes as Cords.  Oneof members keep their string storage.
+bool StoreAsCord(const FieldDescriptor* field, bool bytes_as_cord) {
+  if (field->type() != FieldDescriptor::TYPE_BYTES || field->is_repeated() ||
+      field->is_extension() || InRealOneof(field) ||
+      field->containing_type()->options().map_entry()) {
+    return false;
+  }
+  return bytes_as_cord ||
+         internal::cpp::EffectiveStringCType(field) == FieldOptions::CORD;
+}
+
 // Compute the byte size of the in-memory representation of the field.
 int FieldSpaceUsed(const FieldDescriptor* field) {
   typedef FieldDescriptor FD;  // avoid line wrapping
@@ -234,6 +249,9 @@ class DynamicMessage final : public Message {
 
   bool is_prototype() const;
 
+  // Whether field `i` was laid out as an absl::Cord; see StoreAsCord().
+  bool IsCordField(int i) const;
+
   inline void* OffsetToPointer(int offset) {
     return reinterpret_cast<uint8_t*>(this) + offset;
   }
@@ -318,7 +336,10 @@ DynamicMessage::DynamicMessage(DynamicMessageFactory::TypeInfo* type_info,
 }
 
 inline void* DynamicMessage::MutableRaw(int i) {
-  return OffsetToPointer(type_info_->offsets[i]);
+  return OffsetToPointer(type_info_->offsets[i] & ~internal::kCordMask);
+}
+inline bool DynamicMessage::IsCordField(int i) const {
+  return (type_info_->offsets[i] & internal::kCordMask) != 0;
 }
 inline void* DynamicMessage::MutableExtensionsRaw() {
   return OffsetToPointer(type_info_->extensions_offset);
@@ -390,6 +411,11 @@ void DynamicMessage::SharedCtor(bool lock_factory) {
         break;
 
       case FieldDescriptor::CPPTYPE_STRING:
+        if (IsCordField(i)) {
+          auto* cord = new (field_ptr) absl::Cord(field->default_value_string());
+          if (GetArena() != nullptr) GetArena()->OwnDestructor(cord);
+          break;
+        }
         switch (field->options().ctype()) {
           default:  // TODO:  Support other string reps.
           case FieldOptions::STRING:
@@ -536,6 +562,10 @@ DynamicMessage::~DynamicMessage() {
       }
 
     } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+      if (IsCordField(i)) {
+        reinterpret_cast<absl::Cord*>(field_ptr)->~Cord();
+        continue;
+      }
       switch (field->options().ctype()) {
         default:  // TODO:  Support other string reps.
         case FieldOptions::STRING: {
@@ -600,10 +630,14 @@ Metadata DynamicMessage::GetMetadata() const {
 // ===================================================================
 
 DynamicMessageFactory::DynamicMessageFactory()
-    : pool_(nullptr), delegate_to_generated_factory_(false) {}
+    : pool_(nullptr),
+      delegate_to_generated_factory_(false),
+      bytes_fields_as_cord_(false) {}
 
 DynamicMessageFactory::DynamicMessageFactory(const DescriptorPool* pool)
-    : pool_(pool), delegate_to_generated_factory_(false) {}
+    : pool_(pool),
+      delegate_to_generated_factory_(false),
+      bytes_fields_as_cord_(false) {}
 
 DynamicMessageFactory::~DynamicMessageFactory() {
   for (auto iter = prototypes_.begin(); iter != prototypes_.end(); ++iter) {
@@ -709,10 +743,13 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
   for (int i = 0; i < type->field_count(); i++) {
     // Make sure field is aligned to avoid bus errors.
     // Oneof fields do not use any space.
-    if (!InRealOneof(type->field(i))) {
-      int field_size = FieldSpaceUsed(type->field(i));
+    const FieldDescriptor* field = type->field(i);
+    if (!InRealOneof(field)) {
+      const bool as_cord = StoreAsCord(field, bytes_fields_as_cord_);
+      int field_size = as_cord ? sizeof(absl::Cord) : FieldSpaceUsed(field);
       size = AlignTo(size, std::min(kSafeAlignment, field_size));
       offsets[i] = size;
+      if (as_cord) offsets[i] |= internal::kCordMask;
       size += field_size;
     }
   }
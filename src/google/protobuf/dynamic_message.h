@@ -92,6 +92,15 @@ class PROTOBUF_EXPORT DynamicMessageFactory : public MessageFactory {
     delegate_to_generated_factory_ = enable;
   }
 
+  // Call this to store singular, non-oneof bytes fields of messages created
+  // by this factory as absl::Cord instead of std::string.  Parsing such a
+  // field from a Cord-backed stream (e.g. io::CordInputStream) then shares
+  // the input's buffers instead of copying large values, and
+  // Reflection::GetCord() returns the field without copying.  The trade-off
+  // is that Reflection::GetStringReference() must copy into its scratch
+  // string.  Must be called before the first call to GetPrototype().
+  void SetBytesFieldsAsCord(bool enable) { bytes_fields_as_cord_ = enable; }
+
   // implements MessageFactory ---------------------------------------
 
   // Given a Descriptor, constructs the default (prototype) Message of that
@@ -114,6 +123,7 @@ class PROTOBUF_EXPORT DynamicMessageFactory : public MessageFactory {
  private:
   const DescriptorPool* pool_;
   bool delegate_to_generated_factory_;
+  bool bytes_fields_as_cord_;
 
   struct TypeInfo;
   absl::flat_hash_map<const Descriptor*, const TypeInfo*> prototypes_;
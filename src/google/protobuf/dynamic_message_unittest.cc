@@ -20,7 +20,10 @@
 #include "google/protobuf/dynamic_message.h"
 
 #include <memory>
+#include <string>
 
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
 #include "google/protobuf/descriptor.pb.h"
 #include "google/protobuf/testing/googletest.h"
 #include <gtest/gtest.h>
@@ -296,6 +299,47 @@ TEST_F(DynamicMessageTest, Proto3) {
   delete message;
 }
 
+TEST_P(DynamicMessageTest, BytesFieldsAsCord) {
+  DynamicMessageFactory cord_factory(&pool_);
+  cord_factory.SetBytesFieldsAsCord(true);
+  const Message* cord_prototype = cord_factory.GetPrototype(descriptor_);
+
+  Arena arena;
+  Message* message = cord_prototype->New(GetParam() ? &arena : nullptr);
+  TestUtil::ReflectionTester reflection_tester(descriptor_);
+  reflection_tester.SetAllFieldsViaReflection(message);
+  reflection_tester.ExpectAllFieldsSetViaReflection(*message);
+
+  // The wire format must not depend on the in-memory representation.
+  std::unique_ptr<Message> string_message(prototype_->New());
+  reflection_tester.SetAllFieldsViaReflection(string_message.get());
+  EXPECT_EQ(message->SerializeAsString(), string_message->SerializeAsString());
+  EXPECT_EQ(message->ByteSizeLong(), string_message->ByteSizeLong());
+
+  // A large value parsed from a Cord shares the Cord's buffers.
+  const FieldDescriptor* optional_bytes =
+      descriptor_->FindFieldByName("optional_bytes");
+  const Reflection* reflection = message->GetReflection();
+  const std::string value(64 << 10, 'x');
+  string_message->GetReflection()->SetString(string_message.get(),
+                                             optional_bytes, value);
+  absl::Cord input;
+  ASSERT_TRUE(string_message->SerializeToCord(&input));
+  absl::string_view flat = input.Flatten();
+  ASSERT_TRUE(message->ParseFromCord(input));
+  absl::Cord parsed = reflection->GetCord(*message, optional_bytes);
+  EXPECT_EQ(parsed, value);
+  for (absl::string_view chunk : parsed.Chunks()) {
+    EXPECT_GE(chunk.data(), flat.data());
+    EXPECT_LE(chunk.data() + chunk.size(), flat.data() + flat.size());
+  }
+  EXPECT_EQ(reflection->GetString(*message, optional_bytes), value);
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(UseArena, DynamicMessageTest, ::testing::Bool());
 
 }  // namespace protobuf
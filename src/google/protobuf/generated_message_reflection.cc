@@ -426,7 +426,7 @@ size_t Reflection::SpaceUsedLong(const Message& message) const {
           break;
 
         case FieldDescriptor::CPPTYPE_STRING: {
-          switch (internal::cpp::EffectiveStringCType(field)) {
+          switch (EffectiveStringCType(field)) {
             case FieldOptions::CORD:
               if (schema_.InRealOneof(field)) {
                 total_size += GetField<absl::Cord*>(message, field)
@@ -673,7 +673,7 @@ template <bool unsafe_shallow_swap>
 void SwapFieldHelper::SwapStringField(const Reflection* r, Message* lhs,
                                       Message* rhs,
                                       const FieldDescriptor* field) {
-  switch (internal::cpp::EffectiveStringCType(field)) {
+  switch (r->EffectiveStringCType(field)) {
     case FieldOptions::CORD:
       // Always shallow swap for Cord.
       std::swap(*r->MutableRaw<absl::Cord>(lhs, field),
@@ -1367,7 +1367,7 @@ void Reflection::ClearField(Message* message,
           break;
 
         case FieldDescriptor::CPPTYPE_STRING: {
-          switch (internal::cpp::EffectiveStringCType(field)) {
+          switch (EffectiveStringCType(field)) {
             case FieldOptions::CORD:
               if (field->has_default_value()) {
                 *MutableRaw<absl::Cord>(message, field) =
@@ -1774,7 +1774,7 @@ std::string Reflection::GetString(const Message& message,
     if (schema_.InRealOneof(field) && !HasOneofField(message, field)) {
       return field->default_value_string();
     }
-    switch (internal::cpp::EffectiveStringCType(field)) {
+    switch (EffectiveStringCType(field)) {
       case FieldOptions::CORD:
         if (schema_.InRealOneof(field)) {
           return std::string(*GetField<absl::Cord*>(message, field));
@@ -1805,7 +1805,7 @@ const std::string& Reflection::GetStringReference(const Message& message,
     if (schema_.InRealOneof(field) && !HasOneofField(message, field)) {
       return field->default_value_string();
     }
-    switch (internal::cpp::EffectiveStringCType(field)) {
+    switch (EffectiveStringCType(field)) {
       case FieldOptions::CORD:
         if (schema_.InRealOneof(field)) {
           absl::CopyCordToString(*GetField<absl::Cord*>(message, field),
@@ -1836,7 +1836,7 @@ absl::Cord Reflection::GetCord(const Message& message,
     if (schema_.InRealOneof(field) && !HasOneofField(message, field)) {
       return absl::Cord(field->default_value_string());
     }
-    switch (internal::cpp::EffectiveStringCType(field)) {
+    switch (EffectiveStringCType(field)) {
       case FieldOptions::CORD:
         if (schema_.InRealOneof(field)) {
           return *GetField<absl::Cord*>(message, field);
@@ -1868,7 +1868,7 @@ void Reflection::SetString(Message* message, const FieldDescriptor* field,
     return MutableExtensionSet(message)->SetString(
         field->number(), field->type(), std::move(value), field);
   } else {
-    switch (internal::cpp::EffectiveStringCType(field)) {
+    switch (EffectiveStringCType(field)) {
       case FieldOptions::CORD:
         if (schema_.InRealOneof(field)) {
           if (!HasOneofField(*message, field)) {
@@ -1920,7 +1920,7 @@ void Reflection::SetString(Message* message, const FieldDescriptor* field,
                                   MutableExtensionSet(message)->MutableString(
                                       field->number(), field->type(), field));
   } else {
-    switch (internal::cpp::EffectiveStringCType(field)) {
+    switch (EffectiveStringCType(field)) {
       case FieldOptions::CORD:
         if (schema_.InRealOneof(field)) {
           if (!HasOneofField(*message, field)) {
@@ -2864,7 +2864,7 @@ bool Reflection::HasBit(const Message& message,
     // (which uses HasField()) needs to be consistent with this.
     switch (field->cpp_type()) {
       case FieldDescriptor::CPPTYPE_STRING:
-        switch (internal::cpp::EffectiveStringCType(field)) {
+        switch (EffectiveStringCType(field)) {
           case FieldOptions::CORD:
             return !GetField<const absl::Cord>(message, field).empty();
           default:
@@ -2979,7 +2979,7 @@ void Reflection::ClearOneof(Message* message,
     if (message->GetArena() == nullptr) {
       switch (field->cpp_type()) {
         case FieldDescriptor::CPPTYPE_STRING: {
-          switch (internal::cpp::EffectiveStringCType(field)) {
+          switch (EffectiveStringCType(field)) {
             case FieldOptions::CORD:
               delete *MutableRaw<absl::Cord*>(message, field);
               break;
@@ -3400,7 +3400,8 @@ const internal::TcParseTableBase* Reflection::CreateTcParseTable() const {
           // Might be easier to do when all messages support TDP.
           /* use_direct_tcparser_table */ false,
 
-          ref_.schema_.IsSplit(field),  //
+          ref_.schema_.IsSplit(field),     //
+          ref_.schema_.IsFieldCord(field),  //
       };
     }
 
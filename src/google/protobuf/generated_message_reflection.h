@@ -60,6 +60,10 @@ constexpr uint32_t kInvalidFieldOffsetTag = 0x40000000u;
 constexpr uint32_t kSplitFieldOffsetMask = 0x80000000u;
 constexpr uint32_t kLazyMask = 0x1u;
 constexpr uint32_t kInlinedMask = 0x1u;
+// Tag used on offsets of string/bytes fields that are stored as absl::Cord
+// even though they are not declared [ctype=CORD].  Only set by
+// DynamicMessageFactory.
+constexpr uint32_t kCordMask = 0x2u;
 
 // This struct describes the internal layout of the message, hence this is
 // used to act on the message reflectively.
@@ -136,6 +140,11 @@ struct ReflectionSchema {
     return Inlined(offsets_[field->index()], field->type());
   }
 
+  bool IsFieldCord(const FieldDescriptor* field) const {
+    return !field->is_extension() &&
+           Cord(offsets_[field->index()], field->type());
+  }
+
   uint32_t GetOneofCaseOffset(const OneofDescriptor* oneof_descriptor) const {
     return static_cast<uint32_t>(oneof_case_offset_) +
            static_cast<uint32_t>(
@@ -259,11 +268,18 @@ struct ReflectionSchema {
     if (type == FieldDescriptor::TYPE_MESSAGE ||
         type == FieldDescriptor::TYPE_STRING ||
         type == FieldDescriptor::TYPE_BYTES) {
-      return v & (~kSplitFieldOffsetMask) & (~kInlinedMask) & (~kLazyMask);
+      return v & (~kSplitFieldOffsetMask) & (~kInlinedMask) & (~kLazyMask) &
+             (~kCordMask);
     }
     return v & (~kSplitFieldOffsetMask);
   }
 
+  static bool Cord(uint32_t v, FieldDescriptor::Type type) {
+    return (type == FieldDescriptor::TYPE_STRING ||
+            type == FieldDescriptor::TYPE_BYTES) &&
+           (v & kCordMask) != 0u;
+  }
+
   static bool Inlined(uint32_t v, FieldDescriptor::Type type) {
     if (type == FieldDescriptor::TYPE_STRING ||
         type == FieldDescriptor::TYPE_BYTES) {
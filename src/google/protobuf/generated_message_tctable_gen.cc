@@ -112,10 +112,10 @@ TailCallTableInfo::FastFieldInfo::Field MakeFastFieldEntry(
    : field->is_repeated() ? PROTOBUF_PICK_FUNCTION(fn##R) \
                           : PROTOBUF_PICK_FUNCTION(fn##S))
 
-#define PROTOBUF_PICK_STRING_FUNCTION(fn)                       \
-  (field->options().ctype() == FieldOptions::CORD               \
-       ? PROTOBUF_PICK_FUNCTION(fn##cS)                         \
-   : options.is_string_inlined ? PROTOBUF_PICK_FUNCTION(fn##iS) \
+#define PROTOBUF_PICK_STRING_FUNCTION(fn)                              \
+  (field->options().ctype() == FieldOptions::CORD || options.use_cord \
+       ? PROTOBUF_PICK_FUNCTION(fn##cS)                                \
+   : options.is_string_inlined ? PROTOBUF_PICK_FUNCTION(fn##iS)        \
                                : PROTOBUF_PICK_REPEATABLE_FUNCTION(fn))
 
   const FieldDescriptor* field = entry.field;
@@ -249,9 +249,11 @@ bool IsFieldEligibleForFastParsing(
       // Some bytes fields can be handled on fast path.
     case FieldDescriptor::TYPE_STRING:
     case FieldDescriptor::TYPE_BYTES:
-      if (field->options().ctype() == FieldOptions::STRING) {
+      if (field->options().ctype() == FieldOptions::STRING &&
+          !options.use_cord) {
         // strings are fine...
-      } else if (field->options().ctype() == FieldOptions::CORD) {
+      } else if (field->options().ctype() == FieldOptions::CORD ||
+                 options.use_cord) {
         // Cords are worth putting into the fast table, if they're not repeated
         if (field->is_repeated()) return false;
       } else {
@@ -696,7 +698,8 @@ uint16_t MakeTypeCardForField(
   // Fill in extra information about string and bytes field representations.
   if (field->type() == FieldDescriptor::TYPE_BYTES ||
       field->type() == FieldDescriptor::TYPE_STRING) {
-    switch (internal::cpp::EffectiveStringCType(field)) {
+    switch (options.use_cord ? FieldOptions::CORD
+                             : internal::cpp::EffectiveStringCType(field)) {
       case FieldOptions::CORD:
         // `Cord` is always used, even for repeated fields.
         type_card |= fl::kRepCord;
@@ -48,6 +48,9 @@ struct PROTOBUF_EXPORT TailCallTableInfo {
     bool is_implicitly_weak;
     bool use_direct_tcparser_table;
     bool should_split;
+    // Singular string/bytes field stored as absl::Cord without being declared
+    // [ctype=CORD].
+    bool use_cord;
   };
   class OptionProvider {
    public:
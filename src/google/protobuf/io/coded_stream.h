@@ -658,6 +658,13 @@ class PROTOBUF_EXPORT EpsCopyOutputStream {
     return ptr;
   }
 
+  // Returns true if `size` bytes can be written at ptr without calling
+  // EnsureSpace() in between.  Unlike EnsureSpace() this does not flush, so
+  // callers need a fallback for when it returns false.
+  bool HasSpaceFor(const uint8_t* ptr, int size) const {
+    return end_ + kSlopBytes - ptr >= size;
+  }
+
   uint8_t* WriteRaw(const void* data, int size, uint8_t* ptr) {
     if (PROTOBUF_PREDICT_FALSE(end_ - ptr < size)) {
       return WriteRawFallback(data, size, ptr);
@@ -15,14 +15,27 @@
 #include <sys/types.h>
 #include <unistd.h>
 #endif
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 #include <errno.h>
+#include <limits.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
 
 #include "google/protobuf/stubs/common.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
 #include "google/protobuf/io/io_win32.h"
 #include "google/protobuf/io/zero_copy_stream_impl.h"
 
@@ -147,6 +160,160 @@ int FileInputStream::CopyingFileInputStream::Skip(int count) {
 
 // ===================================================================
 
+namespace {
+
+// Default maximum size of the buffers returned by MmapInputStream::Next().
+constexpr int kMmapDefaultBlockSize = 1 << 20;
+// Default number of bytes MmapInputStream asks the kernel to read ahead.
+constexpr int64_t kMmapDefaultReadahead = int64_t{8} << 20;
+// Consumed pages are released in batches of this size to limit syscalls.
+constexpr int64_t kMmapReleaseGranularity = int64_t{4} << 20;
+// ReadCord() copies reads smaller than this; an external Cord rep costs more
+// than copying a small string.
+constexpr int kMmapMinAliasedCordSize = 4096;
+
+}  // namespace
+
+class MmapInputStream::Mapping {
+ public:
+  Mapping(void* base, size_t length) : base_(base), length_(length) {}
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+  ~Mapping() {
+#ifndef _WIN32
+    munmap(base_, length_);
+#endif
+  }
+
+  const char* base() const { return static_cast<const char*>(base_); }
+
+ private:
+  void* const base_;
+  const size_t length_;
+};
+
+MmapInputStream::MmapInputStream(int file_descriptor, int block_size)
+    : readahead_(kMmapDefaultReadahead),
+      block_size_(block_size > 0 ? block_size : kMmapDefaultBlockSize) {
+#ifdef _WIN32
+  (void)file_descriptor;
+  errno_ = ENOSYS;
+#else
+  struct stat st;
+  if (fstat(file_descriptor, &st) != 0) {
+    errno_ = errno;
+    return;
+  }
+  if (!S_ISREG(st.st_mode)) {
+    errno_ = ENODEV;
+    return;
+  }
+  const off_t offset = lseek(file_descriptor, 0, SEEK_CUR);
+  if (offset == static_cast<off_t>(-1)) {
+    errno_ = errno;
+    return;
+  }
+  if (offset >= st.st_size) return;  // Nothing left to read.
+
+  const size_t length = static_cast<size_t>(st.st_size);
+  void* base =
+      mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  if (base == MAP_FAILED) {
+    errno_ = errno;
+    return;
+  }
+  madvise(base, length, MADV_SEQUENTIAL);
+  mapping_ = std::make_shared<const Mapping>(base, length);
+  data_ = mapping_->base() + offset;
+  size_ = st.st_size - offset;
+#endif
+}
+
+MmapInputStream::~MmapInputStream() = default;
+
+void MmapInputStream::Advise(int64_t position) {
+#ifndef _WIN32
+  static const uintptr_t kPageMask =
+      static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)) - 1;
+  auto page_down = [&](int64_t offset) {
+    return reinterpret_cast<char*>(
+        reinterpret_cast<uintptr_t>(data_ + offset) & ~kPageMask);
+  };
+
+  if (readahead_ > 0 && advised_until_ < size_ &&
+      advised_until_ - position < readahead_ / 2) {
+    const int64_t begin = std::max(advised_until_, position);
+    const int64_t end = std::min(size_, position + readahead_);
+    char* page = page_down(begin);
+    madvise(page, data_ + end - page, MADV_WILLNEED);
+    advised_until_ = end;
+  }
+
+  // Only pages before the start of the buffer being returned are released;
+  // BackUp() can never reach back further than that.
+  if (release_consumed_ &&
+      position - released_until_ >= kMmapReleaseGranularity) {
+    char* begin = page_down(released_until_);
+    char* end = page_down(position);
+    if (end > begin) madvise(begin, end - begin, MADV_DONTNEED);
+    released_until_ = position;
+  }
+#else
+  (void)position;
+#endif
+}
+
+bool MmapInputStream::Next(const void** data, int* size) {
+  if (position_ >= size_) {
+    last_returned_ = 0;
+    return false;
+  }
+  Advise(position_);
+  last_returned_ = std::min<int64_t>(block_size_, size_ - position_);
+  *data = data_ + position_;
+  *size = static_cast<int>(last_returned_);
+  position_ += last_returned_;
+  return true;
+}
+
+void MmapInputStream::BackUp(int count) {
+  ABSL_CHECK_GE(count, 0);
+  ABSL_CHECK_LE(count, last_returned_)
+      << " Can't back up over more bytes than were returned by the last call"
+         " to Next().";
+  position_ -= count;
+  last_returned_ = 0;
+}
+
+bool MmapInputStream::Skip(int count) {
+  ABSL_CHECK_GE(count, 0);
+  last_returned_ = 0;
+  if (count > size_ - position_) {
+    position_ = size_;
+    return false;
+  }
+  position_ += count;
+  return true;
+}
+
+int64_t MmapInputStream::ByteCount() const { return position_; }
+
+bool MmapInputStream::ReadCord(absl::Cord* cord, int count) {
+  if (count < kMmapMinAliasedCordSize) {
+    return ZeroCopyInputStream::ReadCord(cord, count);
+  }
+  last_returned_ = 0;
+  Advise(position_);
+  const int64_t n = std::min<int64_t>(count, size_ - position_);
+  cord->Append(absl::MakeCordFromExternal(
+      absl::string_view(data_ + position_, static_cast<size_t>(n)),
+      [mapping = mapping_] {}));
+  position_ += n;
+  return n == count;
+}
+
+// ===================================================================
+
 FileOutputStream::FileOutputStream(int file_descriptor, int block_size)
     : CopyingOutputStreamAdaptor(&copying_output_, block_size),
       copying_output_(file_descriptor) {}
@@ -225,6 +392,327 @@ bool FileOutputStream::CopyingFileOutputStream::Write(const void* buffer,
 
 // ===================================================================
 
+namespace {
+
+// Default size of the buffers returned by AsyncFileOutputStream::Next().
+constexpr int kAsyncDefaultBlockSize = 1 << 16;
+
+// Writes all of `data`, retrying on EINTR and short writes.  Returns zero on
+// success, otherwise an errno value.
+int WriteFully(int fd, const uint8_t* data, int size) {
+  while (size > 0) {
+    int bytes;
+    do {
+      bytes = write(fd, data, size);
+    } while (bytes < 0 && errno == EINTR);
+    if (bytes <= 0) return bytes < 0 ? errno : EIO;
+    data += bytes;
+    size -= bytes;
+  }
+  return 0;
+}
+
+}  // namespace
+
+AsyncFileOutputStream::AsyncFileOutputStream(int file_descriptor,
+                                             int block_size, int max_buffers)
+    : file_(file_descriptor),
+      block_size_(block_size > 0 ? block_size : kAsyncDefaultBlockSize),
+      max_buffers_(std::max(max_buffers, 2)),
+      writer_(&AsyncFileOutputStream::WriterLoop, this) {}
+
+AsyncFileOutputStream::~AsyncFileOutputStream() {
+  Flush();
+  {
+    absl::MutexLock lock(&mu_);
+    shutdown_ = true;
+  }
+  writer_.join();
+  if (close_on_delete_ && !is_closed_) {
+    if (!Close()) {
+      ABSL_LOG(ERROR) << "close() failed: " << strerror(GetErrno());
+    }
+  }
+}
+
+bool AsyncFileOutputStream::CanAcquireBuffer() const {
+  return !free_.empty() || num_buffers_ < max_buffers_ || errno_ != 0;
+}
+
+bool AsyncFileOutputStream::WriterHasWork() const {
+  return !pending_.empty() || shutdown_;
+}
+
+bool AsyncFileOutputStream::WriterIdle() const {
+  return pending_.empty() && !writing_;
+}
+
+bool AsyncFileOutputStream::Next(void** data, int* size) {
+  if (current_.data != nullptr && current_.size == block_size_) Submit();
+  if (current_.data == nullptr) {
+    absl::MutexLock lock(&mu_);
+    mu_.Await(absl::Condition(this, &AsyncFileOutputStream::CanAcquireBuffer));
+    if (errno_ != 0) return false;
+    if (!free_.empty()) {
+      current_ = std::move(free_.back());
+      free_.pop_back();
+    } else {
+      current_.data.reset(new uint8_t[block_size_]);
+      ++num_buffers_;
+    }
+  } else {
+    absl::MutexLock lock(&mu_);
+    if (errno_ != 0) return false;
+  }
+  *data = current_.data.get() + current_.size;
+  *size = block_size_ - current_.size;
+  current_.size = block_size_;
+  return true;
+}
+
+void AsyncFileOutputStream::BackUp(int count) {
+  if (count == 0) return;
+  ABSL_CHECK_GE(count, 0);
+  ABSL_CHECK(current_.data != nullptr)
+      << " BackUp() can only be called after Next().";
+  ABSL_CHECK_LE(count, current_.size)
+      << " Can't back up over more bytes than were returned by the last call"
+         " to Next().";
+  current_.size -= count;
+}
+
+int64_t AsyncFileOutputStream::ByteCount() const {
+  return bytes_submitted_ + current_.size;
+}
+
+int AsyncFileOutputStream::GetErrno() const {
+  absl::MutexLock lock(&mu_);
+  return errno_;
+}
+
+void AsyncFileOutputStream::Submit() {
+  if (current_.data == nullptr || current_.size == 0) return;
+  bytes_submitted_ += current_.size;
+  absl::MutexLock lock(&mu_);
+  pending_.push_back(std::move(current_));
+  current_ = Buffer();
+}
+
+void AsyncFileOutputStream::WriterLoop() {
+  while (true) {
+    Buffer buffer;
+    bool failed;
+    {
+      absl::MutexLock lock(&mu_);
+      mu_.Await(absl::Condition(this, &AsyncFileOutputStream::WriterHasWork));
+      if (pending_.empty()) return;
+      buffer = std::move(pending_.front());
+      pending_.pop_front();
+      writing_ = true;
+      failed = errno_ != 0;
+    }
+
+    // After an error the remaining buffers are dropped, like the data passed
+    // to a FileOutputStream after a failed write.
+    const int error =
+        failed ? 0 : WriteFully(file_, buffer.data.get(), buffer.size);
+
+    absl::MutexLock lock(&mu_);
+    if (error != 0 && errno_ == 0) errno_ = error;
+    buffer.size = 0;
+    free_.push_back(std::move(buffer));
+    writing_ = false;
+  }
+}
+
+bool AsyncFileOutputStream::Flush() {
+  Submit();
+  absl::MutexLock lock(&mu_);
+  mu_.Await(absl::Condition(this, &AsyncFileOutputStream::WriterIdle));
+  return errno_ == 0;
+}
+
+bool AsyncFileOutputStream::Sync() {
+  if (!Flush()) return false;
+#ifndef _WIN32
+  int result;
+  do {
+    result = fsync(file_);
+  } while (result < 0 && errno == EINTR);
+  if (result != 0) {
+    absl::MutexLock lock(&mu_);
+    errno_ = errno;
+    return false;
+  }
+#endif
+  return true;
+}
+
+bool AsyncFileOutputStream::Close() {
+  ABSL_CHECK(!is_closed_);
+
+  const bool flush_succeeded = Flush();
+  is_closed_ = true;
+  if (close_no_eintr(file_) != 0) {
+    absl::MutexLock lock(&mu_);
+    if (errno_ == 0) errno_ = errno;
+    return false;
+  }
+  return flush_succeeded;
+}
+
+// ===================================================================
+
+namespace {
+
+// Defaults for ScatterGatherOutputStream.  Below kDefaultMinAliasSize,
+// an extra iovec costs more than copying the data.
+constexpr int kScatterGatherDefaultBlockSize = 8192;
+constexpr int kScatterGatherDefaultMinAliasSize = 2048;
+
+}  // namespace
+
+ScatterGatherOutputStream::ScatterGatherOutputStream(int block_size,
+                                                     int min_alias_size)
+    : block_size_(block_size > 0 ? block_size
+                                 : kScatterGatherDefaultBlockSize),
+      min_alias_size_(min_alias_size > 0 ? min_alias_size
+                                         : kScatterGatherDefaultMinAliasSize) {}
+
+ScatterGatherOutputStream::~ScatterGatherOutputStream() = default;
+
+bool ScatterGatherOutputStream::Next(void** data, int* size) {
+  if (block_pos_ == block_end_) {
+    blocks_.emplace_back(new char[block_size_]);
+    block_pos_ = blocks_.back().get();
+    block_end_ = block_pos_ + block_size_;
+    last_piece_in_block_ = false;
+  }
+  *data = block_pos_;
+  *size = static_cast<int>(block_end_ - block_pos_);
+  if (last_piece_in_block_) {
+    absl::string_view& last = pieces_.back();
+    last = absl::string_view(last.data(), last.size() + *size);
+  } else {
+    pieces_.emplace_back(block_pos_, *size);
+    last_piece_in_block_ = true;
+  }
+  block_pos_ = block_end_;
+  byte_count_ += *size;
+  last_returned_size_ = *size;
+  return true;
+}
+
+void ScatterGatherOutputStream::BackUp(int count) {
+  if (count == 0) return;
+  ABSL_CHECK_GE(count, 0);
+  ABSL_CHECK_LE(count, last_returned_size_)
+      << " Can't back up over more bytes than were returned by the last call"
+         " to Next().";
+  absl::string_view& last = pieces_.back();
+  last.remove_suffix(count);
+  if (last.empty()) {
+    pieces_.pop_back();
+    last_piece_in_block_ = false;
+  }
+  block_pos_ -= count;
+  byte_count_ -= count;
+  last_returned_size_ = 0;
+}
+
+int64_t ScatterGatherOutputStream::ByteCount() const { return byte_count_; }
+
+void ScatterGatherOutputStream::WriteCopy(const void* data, int size) {
+  while (size > 0) {
+    void* out;
+    int out_size;
+    Next(&out, &out_size);
+    const int n = std::min(size, out_size);
+    std::memcpy(out, data, n);
+    BackUp(out_size - n);
+    data = static_cast<const char*>(data) + n;
+    size -= n;
+  }
+}
+
+void ScatterGatherOutputStream::AppendAliased(absl::string_view data) {
+  if (data.empty()) return;
+  pieces_.push_back(data);
+  last_piece_in_block_ = false;
+  last_returned_size_ = 0;
+  byte_count_ += data.size();
+}
+
+bool ScatterGatherOutputStream::WriteAliasedRaw(const void* data, int size) {
+  if (size < min_alias_size_) {
+    WriteCopy(data, size);
+  } else {
+    AppendAliased(absl::string_view(static_cast<const char*>(data), size));
+  }
+  return true;
+}
+
+bool ScatterGatherOutputStream::WriteCord(const absl::Cord& cord) {
+  if (cord.size() < static_cast<size_t>(min_alias_size_)) {
+    for (absl::string_view chunk : cord.Chunks()) {
+      WriteCopy(chunk.data(), static_cast<int>(chunk.size()));
+    }
+    return true;
+  }
+  cords_.push_back(cord);
+  for (absl::string_view chunk : cords_.back().Chunks()) {
+    AppendAliased(chunk);
+  }
+  return true;
+}
+
+#ifndef _WIN32
+std::vector<struct iovec> ScatterGatherOutputStream::ToIovecs() const {
+  std::vector<struct iovec> iovecs(pieces_.size());
+  for (size_t i = 0; i < pieces_.size(); ++i) {
+    iovecs[i].iov_base = const_cast<char*>(pieces_[i].data());
+    iovecs[i].iov_len = pieces_[i].size();
+  }
+  return iovecs;
+}
+
+bool ScatterGatherOutputStream::WriteTo(int file_descriptor) {
+  // POSIX only guarantees 16 iovecs per call, Linux accepts 1024.
+#ifdef IOV_MAX
+  constexpr int kMaxIovecs = IOV_MAX;
+#else
+  constexpr int kMaxIovecs = 16;
+#endif
+  std::vector<struct iovec> iovecs = ToIovecs();
+  struct iovec* next = iovecs.data();
+  struct iovec* end = next + iovecs.size();
+  while (next != end) {
+    const int count =
+        static_cast<int>(std::min<std::ptrdiff_t>(end - next, kMaxIovecs));
+    ssize_t bytes;
+    do {
+      bytes = writev(file_descriptor, next, count);
+    } while (bytes < 0 && errno == EINTR);
+    if (bytes <= 0) {
+      errno_ = bytes < 0 ? errno : EIO;
+      return false;
+    }
+    // Skip what was written, which may end in the middle of an iovec.
+    while (next != end && static_cast<size_t>(bytes) >= next->iov_len) {
+      bytes -= next->iov_len;
+      ++next;
+    }
+    if (bytes > 0) {
+      next->iov_base = static_cast<char*>(next->iov_base) + bytes;
+      next->iov_len -= bytes;
+    }
+  }
+  return true;
+}
+#endif  // !_WIN32
+
+// ===================================================================
+
 IstreamInputStream::IstreamInputStream(std::istream* input, int block_size)
     : copying_input_(input), impl_(&copying_input_, block_size) {}
 
@@ -17,10 +17,23 @@
 #ifndef GOOGLE_PROTOBUF_IO_ZERO_COPY_STREAM_IMPL_H__
 #define GOOGLE_PROTOBUF_IO_ZERO_COPY_STREAM_IMPL_H__
 
+#include <cstdint>
+#include <deque>
 #include <iosfwd>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
 
 #include "google/protobuf/stubs/common.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
 #include "google/protobuf/io/zero_copy_stream.h"
 #include "google/protobuf/io/zero_copy_stream_impl_lite.h"
 
@@ -110,6 +123,75 @@ class PROTOBUF_EXPORT FileInputStream final : public ZeroCopyInputStream {
 
 // ===================================================================
 
+// A ZeroCopyInputStream which reads a regular file by mapping it into memory.
+//
+// Unlike FileInputStream, Next() returns pointers into the mapping itself, so
+// the data is never copied into an intermediate buffer.  The stream reads from
+// the descriptor's current offset to the end of the file as it was when the
+// stream was created; the offset itself is not changed.
+//
+// As reading progresses the stream asks the kernel to read ahead of the
+// cursor (MADV_WILLNEED) and to drop pages that have been consumed
+// (MADV_DONTNEED), so that scanning a file much larger than RAM does not
+// build up resident memory.  Dropping a page does not invalidate it: the
+// mapping stays valid until the stream and every Cord created by ReadCord()
+// are destroyed, and a later access simply faults the page back in from the
+// file.  This makes the stream safe to use with aliasing parsers, as long as
+// the file is not truncated or modified while it is mapped.
+//
+// On platforms without mmap(), or for descriptors that cannot be mapped (e.g.
+// pipes), construction sets GetErrno() and the stream is empty.
+class PROTOBUF_EXPORT MmapInputStream final : public ZeroCopyInputStream {
+ public:
+  // Maps the remainder of the file referred to by `file_descriptor`.  The
+  // descriptor may be closed as soon as the constructor returns.  If a
+  // block_size is given, it specifies the maximum number of bytes returned
+  // by each call to Next().  Otherwise, a reasonable default is used.
+  explicit MmapInputStream(int file_descriptor, int block_size = -1);
+  MmapInputStream(const MmapInputStream&) = delete;
+  MmapInputStream& operator=(const MmapInputStream&) = delete;
+  ~MmapInputStream() override;
+
+  // If mapping the file failed, this is the errno from that error.
+  // Otherwise, this is zero.
+  int GetErrno() const { return errno_; }
+
+  // Number of bytes ahead of the cursor the kernel is asked to read in.
+  // Zero disables the hint.  The default is 8MiB.
+  void SetReadahead(int64_t bytes) { readahead_ = bytes; }
+
+  // Whether consumed pages are released with MADV_DONTNEED.  Defaults to true.
+  void SetReleaseConsumed(bool value) { release_consumed_ = value; }
+
+  // implements ZeroCopyInputStream ----------------------------------
+  bool Next(const void** data, int* size) override;
+  void BackUp(int count) override;
+  bool Skip(int count) override;
+  int64_t ByteCount() const override;
+
+  // Large reads produce Cords that reference the mapping instead of copying.
+  bool ReadCord(absl::Cord* cord, int count) override;
+
+ private:
+  class Mapping;
+
+  void Advise(int64_t position);
+
+  std::shared_ptr<const Mapping> mapping_;
+  const char* data_ = nullptr;  // Start of the readable range.
+  int64_t size_ = 0;            // Size of the readable range.
+  int64_t position_ = 0;        // Offset of the next byte Next() returns.
+  int64_t last_returned_ = 0;   // Size of the last buffer returned by Next().
+  int64_t advised_until_ = 0;   // End of the range passed to MADV_WILLNEED.
+  int64_t released_until_ = 0;  // End of the range passed to MADV_DONTNEED.
+  int64_t readahead_;
+  const int block_size_;
+  bool release_consumed_ = true;
+  int errno_ = 0;
+};
+
+// ===================================================================
+
 // A ZeroCopyOutputStream which writes to a file descriptor.
 //
 // FileOutputStream is preferred over using an ofstream with
@@ -179,6 +261,186 @@ class PROTOBUF_EXPORT FileOutputStream final
 
 // ===================================================================
 
+// A ZeroCopyOutputStream which writes to a file descriptor from a background
+// thread.
+//
+// FileOutputStream calls write() when its single buffer fills up, so the
+// serializing thread stalls for the duration of every write.  This stream
+// instead keeps a small pool of buffers: a full buffer is queued for the
+// writer thread and Next() immediately hands out a free one, so serialization
+// and I/O overlap.  The serializing thread only blocks when every buffer is
+// waiting to be written.
+//
+// Buffers are written in order with write(), so the descriptor does not need
+// to be seekable.  Flush() and Sync() are barriers: when they return, all data
+// produced so far has been handed to the kernel (and, for Sync(), to stable
+// storage).
+class PROTOBUF_EXPORT AsyncFileOutputStream final
+    : public ZeroCopyOutputStream {
+ public:
+  // Creates a stream that writes to the given Unix file descriptor.
+  // If a block_size is given, it specifies the size of the buffers
+  // that should be returned by Next().  Otherwise, a reasonable default
+  // is used.  At most `max_buffers` buffers (at least two) are allocated.
+  explicit AsyncFileOutputStream(int file_descriptor, int block_size = -1,
+                                 int max_buffers = 4);
+  AsyncFileOutputStream(const AsyncFileOutputStream&) = delete;
+  AsyncFileOutputStream& operator=(const AsyncFileOutputStream&) = delete;
+
+  // Flushes all buffers and stops the writer thread.
+  ~AsyncFileOutputStream() override;
+
+  // Waits until all data written so far has been passed to write().  Returns
+  // false if an error occurred; use GetErrno() to examine the error.
+  bool Flush();
+
+  // Like Flush(), then calls fsync() on the descriptor.
+  bool Sync();
+
+  // Flushes any buffers and closes the underlying file.  Returns false if
+  // an error occurs during the process; use GetErrno() to examine the error.
+  // Even if an error occurs, the file descriptor is closed when this returns.
+  bool Close();
+
+  // By default, the file descriptor is not closed when the stream is
+  // destroyed.  Call SetCloseOnDelete(true) to change that.
+  void SetCloseOnDelete(bool value) { close_on_delete_ = value; }
+
+  // If an I/O error has occurred on this file descriptor, this is the
+  // errno from that error.  Otherwise, this is zero.  Once an error
+  // occurs, the stream is broken and all subsequent operations will
+  // fail.
+  int GetErrno() const;
+
+  // implements ZeroCopyOutputStream ---------------------------------
+  bool Next(void** data, int* size) override;
+  void BackUp(int count) override;
+  int64_t ByteCount() const override;
+
+ private:
+  struct Buffer {
+    std::unique_ptr<uint8_t[]> data;
+    int size = 0;
+  };
+
+  // Queues the current buffer for writing if it holds any data.
+  void Submit();
+  void WriterLoop();
+
+  bool CanAcquireBuffer() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool WriterHasWork() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool WriterIdle() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const int file_;
+  const int block_size_;
+  const int max_buffers_;
+  bool close_on_delete_ = false;
+  bool is_closed_ = false;
+
+  // Owned by the producing thread.
+  Buffer current_;
+  int64_t bytes_submitted_ = 0;
+
+  mutable absl::Mutex mu_;
+  std::deque<Buffer> pending_ ABSL_GUARDED_BY(mu_);
+  std::vector<Buffer> free_ ABSL_GUARDED_BY(mu_);
+  int num_buffers_ ABSL_GUARDED_BY(mu_) = 0;
+  bool writing_ ABSL_GUARDED_BY(mu_) = false;
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  int errno_ ABSL_GUARDED_BY(mu_) = 0;
+
+  std::thread writer_;
+};
+
+// ===================================================================
+
+// A ZeroCopyOutputStream which collects its output as a list of pieces to be
+// sent with writev() or sendmsg(), instead of copying it into one buffer.
+//
+// Data written through Next() goes into small owned blocks.  Data passed to
+// WriteAliasedRaw() or WriteCord() is referenced instead of copied if it is
+// at least `min_alias_size` bytes long.  When serializing a message, call
+// CodedOutputStream::EnableAliasing(true) so that large singular string and
+// bytes fields reach WriteAliasedRaw(); Cord fields always reach WriteCord().
+// Messages that are mostly one large payload are then serialized without
+// copying the payload at all:
+//
+//   ScatterGatherOutputStream output;
+//   {
+//     CodedOutputStream coded(&output);
+//     coded.EnableAliasing(true);
+//     message.SerializeToCodedStream(&coded);
+//   }
+//   output.WriteTo(socket_fd);
+//
+// The caller must keep aliased strings alive and unmodified until the output
+// has been consumed.  Aliased Cords are retained by the stream.
+class PROTOBUF_EXPORT ScatterGatherOutputStream final
+    : public ZeroCopyOutputStream {
+ public:
+  // If a block_size is given, it specifies the size of the owned blocks
+  // returned by Next().  Writes shorter than `min_alias_size` are copied
+  // even when aliasing is possible.  Otherwise, reasonable defaults are used.
+  explicit ScatterGatherOutputStream(int block_size = -1,
+                                     int min_alias_size = -1);
+  ScatterGatherOutputStream(const ScatterGatherOutputStream&) = delete;
+  ScatterGatherOutputStream& operator=(const ScatterGatherOutputStream&) =
+      delete;
+  ~ScatterGatherOutputStream() override;
+
+  // Returns the output written so far as non-empty pieces, in order.  The
+  // pieces are valid until the stream is modified or destroyed, and as long
+  // as the aliased data stays alive.
+  const std::vector<absl::string_view>& pieces() const { return pieces_; }
+
+#ifndef _WIN32
+  // Returns pieces() as iovecs suitable for writev() or sendmsg().
+  std::vector<struct iovec> ToIovecs() const;
+
+  // Writes the whole output to the given Unix file descriptor with writev(),
+  // retrying on short writes.  Returns false if an error occurs; use
+  // GetErrno() to examine the error.
+  bool WriteTo(int file_descriptor);
+
+  // If WriteTo() failed, this is the errno from that error.  Otherwise, this
+  // is zero.
+  int GetErrno() const { return errno_; }
+#endif
+
+  // implements ZeroCopyOutputStream ---------------------------------
+  bool Next(void** data, int* size) override;
+  void BackUp(int count) override;
+  int64_t ByteCount() const override;
+  bool WriteAliasedRaw(const void* data, int size) override;
+  bool AllowsAliasing() const override { return true; }
+  bool WriteCord(const absl::Cord& cord) override;
+
+ private:
+  // Copies `data` into owned blocks.
+  void WriteCopy(const void* data, int size);
+  // Appends a piece that references memory not owned by the stream.
+  void AppendAliased(absl::string_view data);
+
+  const int block_size_;
+  const int min_alias_size_;
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* block_pos_ = nullptr;  // Start of the unused part of the last block.
+  char* block_end_ = nullptr;  // End of the last block.
+
+  std::vector<absl::string_view> pieces_;
+  // Whether pieces_.back() ends at block_pos_, so Next() can extend it.
+  bool last_piece_in_block_ = false;
+  // Size of the buffer returned by the last call to Next(), for BackUp().
+  int last_returned_size_ = 0;
+  // Copies of aliased Cords; a deque so their chunks never move.
+  std::deque<absl::Cord> cords_;
+  int64_t byte_count_ = 0;
+  int errno_ = 0;
+};
+
+// ===================================================================
+
 // A ZeroCopyInputStream which reads from a C++ istream.
 //
 // Note that for reading files (or anything represented by a file descriptor),
@@ -1496,6 +1496,296 @@ TEST_F(IoTest, BlockingFileIoWithTimeout) {
     EXPECT_EQ(EAGAIN, input.GetErrno());
   }
 }
+
+TEST_F(IoTest, AsyncFileIo) {
+  std::string filename =
+      absl::StrCat(TestTempDir(), "/zero_copy_stream_test_file");
+
+  for (int i = 0; i < kBlockSizeCount; i++) {
+    for (int j = 0; j < kBlockSizeCount; j++) {
+      int file =
+          open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0777);
+      ASSERT_GE(file, 0);
+
+      {
+        AsyncFileOutputStream output(file, kBlockSizes[i], 2);
+        WriteStuff(&output);
+        EXPECT_TRUE(output.Sync());
+        EXPECT_EQ(0, output.GetErrno());
+      }
+
+      ASSERT_NE(lseek(file, 0, SEEK_SET), (off_t)-1);
+
+      {
+        FileInputStream input(file, kBlockSizes[j]);
+        ReadStuff(&input);
+        EXPECT_EQ(0, input.GetErrno());
+      }
+
+      close(file);
+    }
+  }
+}
+
+TEST_F(IoTest, AsyncFileOutputOverlapsWithPipeReader) {
+  int fd[2];
+  ASSERT_EQ(pipe(fd), 0);
+
+  std::string received;
+  std::thread reader([&] {
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(fd[0], buffer, sizeof(buffer))) > 0) {
+      received.append(buffer, n);
+    }
+  });
+
+  std::string expected;
+  {
+    AsyncFileOutputStream output(fd[1], 1000, 3);
+    output.SetCloseOnDelete(true);
+    CodedOutputStream coded(&output);
+    for (int i = 0; i < 20000; ++i) {
+      std::string line = absl::StrCat("line ", i, "\n");
+      coded.WriteString(line);
+      expected += line;
+    }
+    coded.Trim();
+    EXPECT_EQ(output.ByteCount(), expected.size());
+    EXPECT_TRUE(output.Flush());
+  }
+  reader.join();
+  close(fd[0]);
+  EXPECT_EQ(received, expected);
+}
+
+TEST_F(IoTest, AsyncFileWriteError) {
+  AsyncFileOutputStream output(-1, 16);
+  void* buffer;
+  int size;
+  ASSERT_TRUE(output.Next(&buffer, &size));
+  EXPECT_FALSE(output.Flush());
+  EXPECT_EQ(EBADF, output.GetErrno());
+  EXPECT_FALSE(output.Next(&buffer, &size));
+}
+
+TEST_F(IoTest, MmapFileIo) {
+  std::string filename =
+      absl::StrCat(TestTempDir(), "/zero_copy_stream_test_file");
+
+  for (int i = 0; i < kBlockSizeCount; i++) {
+    for (int j = 0; j < kBlockSizeCount; j++) {
+      int file =
+          open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0777);
+      ASSERT_GE(file, 0);
+
+      {
+        FileOutputStream output(file, kBlockSizes[i]);
+        WriteStuffLarge(&output);
+        EXPECT_EQ(0, output.GetErrno());
+      }
+
+      ASSERT_NE(lseek(file, 0, SEEK_SET), (off_t)-1);
+
+      {
+        MmapInputStream input(file, kBlockSizes[j]);
+        input.SetReadahead(4096);
+        ReadStuffLarge(&input);
+        EXPECT_EQ(0, input.GetErrno());
+      }
+
+      close(file);
+    }
+  }
+}
+
+TEST_F(IoTest, MmapStartsAtCurrentOffsetAndAliasesCords) {
+  std::string filename =
+      absl::StrCat(TestTempDir(), "/zero_copy_stream_test_file");
+  std::string contents;
+  for (int i = 0; contents.size() < (12 << 20); ++i) {
+    absl::StrAppend(&contents, i, ",");
+  }
+  ASSERT_TRUE(File::SetContents(filename, contents, true).ok());
+
+  int file = open(filename.c_str(), O_RDONLY | O_BINARY);
+  ASSERT_GE(file, 0);
+  ASSERT_EQ(lseek(file, 10, SEEK_SET), 10);
+
+  absl::Cord large;
+  absl::Cord small;
+  {
+    MmapInputStream input(file);
+    close(file);
+    ASSERT_EQ(input.GetErrno(), 0);
+
+    const void* data;
+    int size;
+    ASSERT_TRUE(input.Next(&data, &size));
+    EXPECT_EQ(absl::string_view(static_cast<const char*>(data), 5),
+              contents.substr(10, 5));
+    input.BackUp(size - 5);
+    EXPECT_EQ(input.ByteCount(), 5);
+
+    // Large reads reference the mapping and must outlive the stream.
+    ASSERT_TRUE(input.ReadCord(&large, 10 << 20));
+    ASSERT_TRUE(input.ReadCord(&small, 100));
+    EXPECT_TRUE(input.Skip(1000));
+    EXPECT_EQ(input.ByteCount(), 5 + (10 << 20) + 100 + 1000);
+
+    const int remaining = static_cast<int>(contents.size()) - 10 -
+                          static_cast<int>(input.ByteCount());
+    EXPECT_FALSE(input.Skip(remaining + 1));
+    EXPECT_FALSE(input.Next(&data, &size));
+  }
+  EXPECT_EQ(large, contents.substr(15, 10 << 20));
+  EXPECT_EQ(small, contents.substr(15 + (10 << 20), 100));
+}
+
+TEST_F(IoTest, MmapReadError) {
+  MmapInputStream bad_fd(-1);
+  const void* buffer;
+  int size;
+  EXPECT_FALSE(bad_fd.Next(&buffer, &size));
+  EXPECT_EQ(EBADF, bad_fd.GetErrno());
+
+  int fd[2];
+  ASSERT_EQ(pipe(fd), 0);
+  {
+    MmapInputStream pipe_input(fd[0]);
+    EXPECT_FALSE(pipe_input.Next(&buffer, &size));
+    EXPECT_NE(0, pipe_input.GetErrno());
+  }
+  close(fd[0]);
+  close(fd[1]);
+}
+
+TEST_F(IoTest, ScatterGatherIo) {
+  for (int i = 0; i < kBlockSizeCount; i++) {
+    for (int j = 0; j < kBlockSizeCount; j++) {
+      ScatterGatherOutputStream output(kBlockSizes[i]);
+      WriteStuff(&output);
+
+      std::string joined;
+      for (absl::string_view piece : output.pieces()) {
+        EXPECT_FALSE(piece.empty());
+        absl::StrAppend(&joined, piece);
+      }
+      EXPECT_EQ(joined.size(), output.ByteCount());
+
+      ArrayInputStream input(joined.data(), joined.size(), kBlockSizes[j]);
+      ReadStuff(&input);
+    }
+  }
+}
+
+TEST_F(IoTest, ScatterGatherAliasesLargeWrites) {
+  const std::string large(100000, 'x');
+  const std::string small(100, 'y');
+  absl::Cord cord(std::string(50000, 'z'));
+
+  ScatterGatherOutputStream output(64, 1000);
+  std::string expected;
+  {
+    CodedOutputStream coded(&output);
+    coded.EnableAliasing(true);
+    for (const std::string* s : {&large, &small, &large}) {
+      coded.WriteTag(10);
+      coded.WriteVarint32(s->size());
+      coded.WriteRawMaybeAliased(s->data(), s->size());
+    }
+    coded.WriteTag(18);
+    coded.WriteVarint32(cord.size());
+    coded.WriteCord(cord);
+  }
+  {
+    StringOutputStream string_output(&expected);
+    CodedOutputStream coded(&string_output);
+    for (const std::string* s : {&large, &small, &large}) {
+      coded.WriteTag(10);
+      coded.WriteVarint32(s->size());
+      coded.WriteRaw(s->data(), s->size());
+    }
+    coded.WriteTag(18);
+    coded.WriteVarint32(cord.size());
+    coded.WriteCord(cord);
+  }
+  EXPECT_EQ(output.ByteCount(), expected.size());
+
+  // Both large writes reference `large`, the small one was copied.
+  int aliased = 0;
+  std::string joined;
+  for (absl::string_view piece : output.pieces()) {
+    if (piece.data() == large.data()) {
+      EXPECT_EQ(piece.size(), large.size());
+      ++aliased;
+    }
+    EXPECT_FALSE(piece.data() == small.data());
+    absl::StrAppend(&joined, piece);
+  }
+  EXPECT_EQ(aliased, 2);
+  EXPECT_EQ(joined, expected);
+
+  // The stream keeps the Cord's data alive.
+  cord.Clear();
+  std::vector<struct iovec> iovecs = output.ToIovecs();
+  ASSERT_EQ(iovecs.size(), output.pieces().size());
+  std::string from_iovecs;
+  for (const struct iovec& iov : iovecs) {
+    from_iovecs.append(static_cast<const char*>(iov.iov_base), iov.iov_len);
+  }
+  EXPECT_EQ(from_iovecs, expected);
+}
+
+TEST_F(IoTest, ScatterGatherWriteTo) {
+  int fd[2];
+  ASSERT_EQ(pipe(fd), 0);
+
+  std::string received;
+  std::thread reader([&] {
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(fd[0], buffer, sizeof(buffer))) > 0) {
+      received.append(buffer, n);
+    }
+  });
+
+  // Many more pieces than writev() accepts at once, and more data than the
+  // pipe buffer holds, so that writes come back short.
+  std::vector<std::string> payloads;
+  for (int i = 0; i < 5000; ++i) {
+    payloads.push_back(std::string(1000 + i % 7, 'a' + i % 26));
+  }
+  std::string expected;
+  ScatterGatherOutputStream output(16, 1000);
+  {
+    CodedOutputStream coded(&output);
+    coded.EnableAliasing(true);
+    for (const std::string& payload : payloads) {
+      coded.WriteVarint32(payload.size());
+      coded.WriteRawMaybeAliased(payload.data(), payload.size());
+    }
+  }
+  {
+    StringOutputStream string_output(&expected);
+    CodedOutputStream coded(&string_output);
+    for (const std::string& payload : payloads) {
+      coded.WriteVarint32(payload.size());
+      coded.WriteRaw(payload.data(), payload.size());
+    }
+  }
+  EXPECT_GT(output.pieces().size(), 1024);
+
+  EXPECT_TRUE(output.WriteTo(fd[1]));
+  EXPECT_EQ(0, output.GetErrno());
+  close(fd[1]);
+  reader.join();
+  close(fd[0]);
+  EXPECT_EQ(received, expected);
+
+  EXPECT_FALSE(output.WriteTo(-1));
+  EXPECT_EQ(EBADF, output.GetErrno());
+}
 #endif
 
 #if HAVE_ZLIB
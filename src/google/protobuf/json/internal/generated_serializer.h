@@ -0,0 +1,175 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Runtime support for the JSON serializers emitted by the C++ code generator
+// when it is run with the `json_serializer` option. Nothing in this file is
+// part of the public API; it may only be used by generated code.
+//
+// A generated serializer replaces the reflective walk over the fields of a
+// message (WriteFields() in unparser.cc) with direct calls to the message's
+// accessors. Its output must be byte-for-byte identical to that of the
+// reflective path, so everything that is not a plain field of a plain message
+// is handed back to the reflective code one field at a time.
+
+#ifndef GOOGLE_PROTOBUF_JSON_INTERNAL_GENERATED_SERIALIZER_H__
+#define GOOGLE_PROTOBUF_JSON_INTERNAL_GENERATED_SERIALIZER_H__
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "absl/base/casts.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/json/internal/writer.h"
+#include "google/protobuf/message.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace json_internal {
+
+// Referenced from a message's ClassData when the message has a generated
+// serializer.
+struct GeneratedSerializer {
+  // Writes the fields of `msg`, but not the enclosing braces, exactly like
+  // WriteFields() in unparser.cc. `first` tracks whether a comma is needed
+  // before the next field.
+  absl::Status (*write_fields)(const Message& msg, JsonWriter& writer,
+                               bool& first);
+};
+
+class GeneratedSerializerAccess {
+ public:
+  // Returns the generated serializer of `msg`'s class, or nullptr.
+  static const GeneratedSerializer* Get(const Message& msg) {
+    const Message::ClassData* data = msg.GetClassData();
+    return data == nullptr ? nullptr : data->json_serializer;
+  }
+};
+
+// Returns true if x round-trips through being cast to a double, i.e., if
+// x is represenable exactly as a double. This is a slightly weaker condition
+// than x < 2^52.
+template <typename Int>
+bool RoundTripsThroughDouble(Int x) {
+  auto d = static_cast<double>(x);
+  // d has guaranteed to be finite with no fractional part, because it came from
+  // an integer, so we only need to check that it is not outside of the
+  // representable range of `int`. The way to do this is somewhat not obvious:
+  // UINT64_MAX isn't representable, and what it gets rounded to when we go
+  // int->double is unspecified!
+  //
+  // Thus, we have to go through ldexp.
+  double min = 0;
+  double max_plus_one = std::ldexp(1.0, sizeof(Int) * 8);
+  if (std::is_signed<Int>::value) {
+    max_plus_one /= 2;
+    min = -max_plus_one;
+  }
+
+  if (d < min || d >= max_plus_one) {
+    return false;
+  }
+
+  return static_cast<Int>(d) == x;
+}
+
+// Writes the comma and name preceding a field's value. The names are quoted
+// and include the trailing colon, e.g. "\"fooBar\":".
+inline void WriteFieldName(JsonWriter& writer, bool& first,
+                           absl::string_view json_name,
+                           absl::string_view proto_name) {
+  writer.WriteComma(first);
+  writer.NewLine();
+  writer.Write(writer.options().preserve_proto_field_names ? proto_name
+                                                           : json_name);
+  writer.Whitespace(" ");
+}
+
+// As above, for fields whose name starts with an uppercase letter but whose
+// JSON name does not; legacy syntax capitalizes the JSON name.
+inline void WriteFieldName(JsonWriter& writer, bool& first,
+                           absl::string_view json_name,
+                           absl::string_view legacy_json_name,
+                           absl::string_view proto_name) {
+  WriteFieldName(writer, first,
+                 writer.options().allow_legacy_syntax ? legacy_json_name
+                                                      : json_name,
+                 proto_name);
+}
+
+// Returns true if a float or double field without presence is set. Like
+// Reflection::HasField(), this counts -0.0 as set.
+inline bool IsNonZero(float value) {
+  return absl::bit_cast<uint32_t>(value) != 0;
+}
+inline bool IsNonZero(double value) {
+  return absl::bit_cast<uint64_t>(value) != 0;
+}
+
+template <typename Int>
+void WriteInt64(JsonWriter& writer, Int value) {
+  if (writer.options().unquote_int64_if_possible &&
+      RoundTripsThroughDouble(value)) {
+    writer.Write(value);
+  } else {
+    writer.Write(MakeQuoted(value));
+  }
+}
+
+inline void WriteString(JsonWriter& writer, absl::string_view value) {
+  writer.Write(MakeQuoted(value));
+}
+
+inline void WriteBool(JsonWriter& writer, bool value) {
+  writer.Write(value ? "true" : "false");
+}
+
+inline void StartList(JsonWriter& writer) {
+  writer.Write("[");
+  writer.Push();
+}
+
+inline void StartListElement(JsonWriter& writer, bool& first) {
+  writer.WriteComma(first);
+  writer.NewLine();
+}
+
+inline void EndList(JsonWriter& writer, bool first) {
+  writer.Pop();
+  if (!first) {
+    writer.NewLine();
+  }
+  writer.Write("]");
+}
+
+// Writes an enum value of `field`, which must be an enum field.
+PROTOBUF_EXPORT void WriteEnumField(JsonWriter& writer,
+                                    const FieldDescriptor* field,
+                                    int32_t value);
+
+// Writes a message value, using its generated serializer if it has one.
+PROTOBUF_EXPORT absl::Status WriteMessageField(JsonWriter& writer,
+                                               const Message& msg);
+
+// Writes `field` of `msg` through reflection, including its name, if the
+// reflective serializer would print it.
+PROTOBUF_EXPORT absl::Status WriteFieldReflectively(
+    JsonWriter& writer, const Message& msg, const FieldDescriptor* field,
+    bool& first);
+
+}  // namespace json_internal
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_JSON_INTERNAL_GENERATED_SERIALIZER_H__
@@ -0,0 +1,247 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/json/internal/generated_serializer.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "absl/strings/str_cat.h"
+#include "google/protobuf/dynamic_message.h"
+#include "google/protobuf/json/internal/unparser.h"
+#include "google/protobuf/json/internal/writer.h"
+#include "google/protobuf/json/generated_serializer_proto3_test.pb.h"
+#include "google/protobuf/json/generated_serializer_test.pb.h"
+#include "google/protobuf/message.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace json_internal {
+namespace {
+
+using ::proto2_json_serializer_unittest::ClosedEnum;
+using ::proto2_json_serializer_unittest::Proto2Extendable;
+using ::proto2_json_serializer_unittest::Proto2Types;
+using ::proto3_json_serializer_unittest::OpenEnum;
+using ::proto3_json_serializer_unittest::Proto3Types;
+
+// Every combination of the options that change which fields are printed or
+// how.
+std::vector<WriterOptions> AllOptions() {
+  std::vector<WriterOptions> all;
+  for (int bits = 0; bits < 64; ++bits) {
+    WriterOptions options;
+    options.add_whitespace = bits & 1;
+    options.always_print_primitive_fields = bits & 2;
+    options.always_print_enums_as_ints = bits & 4;
+    options.preserve_proto_field_names = bits & 8;
+    options.unquote_int64_if_possible = bits & 16;
+    options.allow_legacy_syntax = bits & 32;
+    all.push_back(options);
+  }
+  return all;
+}
+
+std::string OptionsString(const WriterOptions& options) {
+  return absl::StrCat(
+      "add_whitespace=", options.add_whitespace,
+      " always_print_primitive_fields=", options.always_print_primitive_fields,
+      " always_print_enums_as_ints=", options.always_print_enums_as_ints,
+      " preserve_proto_field_names=", options.preserve_proto_field_names,
+      " unquote_int64_if_possible=", options.unquote_int64_if_possible,
+      " allow_legacy_syntax=", options.allow_legacy_syntax);
+}
+
+// Checks that `message` serializes to the same JSON as a DynamicMessage with
+// the same contents, which has no generated serializer.
+void ExpectSameAsReflection(const Message& message) {
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> dynamic(
+      factory.GetPrototype(message.GetDescriptor())->New());
+  ASSERT_TRUE(dynamic->ParseFromString(message.SerializeAsString()));
+  ASSERT_EQ(GeneratedSerializerAccess::Get(*dynamic), nullptr);
+
+  for (const WriterOptions& options : AllOptions()) {
+    SCOPED_TRACE(OptionsString(options));
+    std::string generated;
+    std::string reflective;
+    ASSERT_TRUE(MessageToJsonString(message, &generated, options).ok());
+    ASSERT_TRUE(MessageToJsonString(*dynamic, &reflective, options).ok());
+    EXPECT_EQ(generated, reflective);
+  }
+}
+
+void FillProto2(Proto2Types& message) {
+  message.set_optional_int32(-17);
+  message.set_optional_int64(int64_t{1} << 60);
+  message.set_optional_uint32(4000000000u);
+  message.set_optional_uint64(uint64_t{1} << 63);
+  message.set_optional_sint32(-3);
+  message.set_optional_sint64(-(int64_t{1} << 40));
+  message.set_optional_fixed32(7);
+  message.set_optional_fixed64(9007199254740993u);
+  message.set_optional_sfixed32(-8);
+  message.set_optional_sfixed64(-9);
+  message.set_optional_float(1.5f);
+  message.set_optional_double(-0.0);
+  message.set_optional_bool(false);
+  message.set_optional_string("quote \" backslash \\ \n ünïcode");
+  message.set_optional_bytes(std::string("\0\xff\x7f", 3));
+  message.set_optional_enum(proto2_json_serializer_unittest::CLOSED_ONE);
+  message.mutable_optional_nested()->set_value(3);
+  message.mutable_optional_nested()->add_names("x");
+
+  message.add_repeated_int32(1);
+  message.add_repeated_int32(-1);
+  message.add_repeated_int64(5);
+  message.add_repeated_uint64(18446744073709551615u);
+  message.add_repeated_float(std::numeric_limits<float>::infinity());
+  message.add_repeated_float(NAN);
+  message.add_repeated_double(1e300);
+  message.add_repeated_bool(true);
+  message.add_repeated_bool(false);
+  message.add_repeated_string("a");
+  message.add_repeated_string("");
+  message.add_repeated_bytes("b");
+  message.add_repeated_enum(proto2_json_serializer_unittest::CLOSED_TWO);
+  message.add_repeated_nested()->set_value(1);
+  message.add_repeated_nested();
+  message.add_packed_int32(2);
+
+  message.set_oneof_string("one");
+
+  message.mutable_optionalgroup()->set_a(1);
+  (*message.mutable_map_nested())["k"].set_value(2);
+  message.mutable_timestamp()->set_seconds(1);
+  message.mutable_duration()->set_nanos(5);
+  message.mutable_wrapped_int32()->set_value(0);
+  message.mutable_value()->set_number_value(1);
+  message.add_repeated_value();
+  message.add_repeated_value()->set_string_value("v");
+  (*message.mutable_struct_()->mutable_fields())["f"].set_bool_value(true);
+  message.set_null_value(google::protobuf::NULL_VALUE);
+  message.set_dashed_json_name(6);
+
+  message.set_pascalcase(7);
+  message.set_custom_json_name(8);
+  message.set_class_(9);
+  message.set_camelstring("camel");
+}
+
+void FillProto3(Proto3Types& message) {
+  message.set_int32(1);
+  message.set_int64(-(int64_t{1} << 53) - 1);
+  message.set_uint32(2);
+  message.set_uint64(3);
+  message.set_sint32(-4);
+  message.set_sint64(5);
+  message.set_fixed32(6);
+  message.set_fixed64(7);
+  message.set_sfixed32(-8);
+  message.set_sfixed64(-9);
+  message.set_float_(-0.0f);
+  message.set_double_(0.1);
+  message.set_bool_(true);
+  message.set_string("s");
+  message.set_bytes("b");
+  message.set_enum_(proto3_json_serializer_unittest::OPEN_TWO);
+  message.mutable_nested()->set_kind(static_cast<OpenEnum>(42));
+
+  message.set_optional_int32(0);
+  message.set_optional_string("");
+  message.set_optional_enum(proto3_json_serializer_unittest::OPEN_ZERO);
+  message.set_optional_double(0);
+
+  message.add_repeated_int32(0);
+  message.add_repeated_sint64(-1);
+  message.add_repeated_fixed64(2);
+  message.add_repeated_float(-std::numeric_limits<float>::infinity());
+  message.add_repeated_string("r");
+  message.add_repeated_bytes("");
+  message.add_repeated_enum(static_cast<OpenEnum>(-3));
+  message.add_repeated_nested()->set_value(4);
+
+  message.set_oneof_double(0);
+
+  (*message.mutable_map_enum())[1] = proto3_json_serializer_unittest::OPEN_ONE;
+  (*message.mutable_map_nested())["n"].set_value(1);
+  message.mutable_any();
+  message.mutable_field_mask()->add_paths("a.b");
+  message.mutable_wrapped_string()->set_value("w");
+  message.mutable_list_value()->add_values()->set_null_value(
+      google::protobuf::NULL_VALUE);
+}
+
+TEST(GeneratedSerializerTest, GeneratedOnlyWhereSupported) {
+  Proto2Types proto2;
+  Proto3Types proto3;
+  Proto2Extendable extendable;
+  EXPECT_NE(GeneratedSerializerAccess::Get(proto2), nullptr);
+  EXPECT_NE(GeneratedSerializerAccess::Get(proto2.optional_nested()), nullptr);
+  EXPECT_NE(GeneratedSerializerAccess::Get(proto3), nullptr);
+  EXPECT_EQ(GeneratedSerializerAccess::Get(extendable), nullptr);
+  EXPECT_EQ(GeneratedSerializerAccess::Get(proto2.timestamp()), nullptr);
+}
+
+TEST(GeneratedSerializerTest, EmptyMessages) {
+  ExpectSameAsReflection(Proto2Types());
+  ExpectSameAsReflection(Proto3Types());
+}
+
+TEST(GeneratedSerializerTest, Proto2) {
+  Proto2Types message;
+  FillProto2(message);
+  ExpectSameAsReflection(message);
+}
+
+TEST(GeneratedSerializerTest, Proto2DefaultsAndOneofs) {
+  Proto2Types message;
+  message.set_default_int32(0);
+  message.set_default_string("");
+  message.mutable_oneof_nested();
+  ExpectSameAsReflection(message);
+
+  message.set_oneof_enum(proto2_json_serializer_unittest::CLOSED_ZERO);
+  ExpectSameAsReflection(message);
+}
+
+TEST(GeneratedSerializerTest, Proto3) {
+  Proto3Types message;
+  FillProto3(message);
+  ExpectSameAsReflection(message);
+}
+
+TEST(GeneratedSerializerTest, Proto3Oneofs) {
+  Proto3Types message;
+  message.set_oneof_int64(0);
+  ExpectSameAsReflection(message);
+  message.set_oneof_bytes("");
+  ExpectSameAsReflection(message);
+  message.mutable_oneof_nested();
+  ExpectSameAsReflection(message);
+}
+
+TEST(GeneratedSerializerTest, NestedInReflectiveMessage) {
+  Proto2Extendable message;
+  FillProto2(*message.mutable_types());
+  message.SetExtension(proto2_json_serializer_unittest::extension_int32, 5);
+  ExpectSameAsReflection(message);
+}
+
+}  // namespace
+}  // namespace json_internal
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
@@ -29,7 +29,9 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "google/protobuf/json/internal/scan.h"
 #include "google/protobuf/stubs/status_macros.h"
+#include "utf8_validity.h"
 
 // Must be included last.
 #include "google/protobuf/port_def.inc"
@@ -190,19 +192,20 @@ absl::StatusOr<uint16_t> JsonLexer::ParseU16HexCodepoint() {
 absl::Status JsonLexer::SkipToToken() {
   while (true) {
     RETURN_IF_ERROR(stream_.BufferAtLeast(1).status());
-    switch (stream_.PeekChar()) {
-      case '\n':
-        RETURN_IF_ERROR(Advance(1));
-        ++json_loc_.line;
-        json_loc_.col = 0;
-        break;
-      case '\r':
-      case '\t':
-      case ' ':
-        RETURN_IF_ERROR(Advance(1));
-        break;
-      default:
-        return absl::OkStatus();
+    // Skip everything that is buffered in one go; if the whitespace continues
+    // into the next chunk, we will go around the loop again.
+    absl::string_view whitespace =
+        stream_.Unread().substr(0, ScanWhitespace(stream_.Unread()));
+    if (whitespace.empty()) {
+      return absl::OkStatus();
+    }
+
+    size_t last_newline = whitespace.rfind('\n');
+    int newlines = static_cast<int>(absl::c_count(whitespace, '\n'));
+    RETURN_IF_ERROR(Advance(whitespace.size()));
+    if (last_newline != absl::string_view::npos) {
+      json_loc_.line += newlines;
+      json_loc_.col = static_cast<int>(whitespace.size() - last_newline - 1);
     }
   }
 }
@@ -392,6 +395,24 @@ absl::StatusOr<LocationWith<MaybeOwnedString>> JsonLexer::ParseUtf8() {
   while (true) {
     RETURN_IF_ERROR(stream_.BufferAtLeast(1).status());
 
+    // Consume as much of the buffered input as we can in bulk: everything up
+    // to the next quote, escape or control character, so long as it is valid
+    // UTF-8. Whatever is left over, including anything invalid, goes through
+    // the character-at-a-time loop below, which produces the errors.
+    absl::string_view unread = stream_.Unread();
+    StringScan scan = ScanStringChars(unread, is_single_quote ? '\'' : '"');
+    size_t plain = scan.len;
+    if (scan.has_non_ascii) {
+      plain = utf8_range::SpanStructurallyValid(unread.substr(0, plain));
+    }
+    if (plain != 0) {
+      if (!on_heap.empty()) {
+        on_heap.append(unread.data(), plain);
+      }
+      RETURN_IF_ERROR(Advance(plain));
+      RETURN_IF_ERROR(stream_.BufferAtLeast(1).status());
+    }
+
     char c = stream_.PeekChar();
     RETURN_IF_ERROR(Advance(1));
     switch (c) {
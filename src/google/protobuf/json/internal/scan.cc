@@ -0,0 +1,236 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/json/internal/scan.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/log/absl_check.h"
+#include "absl/numeric/bits.h"
+#include "absl/strings/string_view.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define PROTOBUF_JSON_SCAN_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 is selected at runtime, so it needs per-function target attributes
+// and a way to query the CPU.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PROTOBUF_JSON_SCAN_AVX2 1
+#include <immintrin.h>
+#endif
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace json_internal {
+namespace {
+
+bool IsStringStop(char c, char quote) {
+  return c == quote || c == '\\' || static_cast<uint8_t>(c) < 0x20;
+}
+
+bool IsWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Finishes a scan from `i` onwards one byte at a time. This handles inputs
+// shorter than a vector, and the tail of longer ones.
+StringScan ScanStringCharsScalar(absl::string_view text, char quote,
+                                 size_t i, bool has_non_ascii) {
+  for (; i < text.size(); ++i) {
+    char c = text[i];
+    if (IsStringStop(c, quote)) break;
+    has_non_ascii |= static_cast<uint8_t>(c) >= 0x80;
+  }
+  return {i, has_non_ascii};
+}
+
+size_t ScanWhitespaceScalar(absl::string_view text, size_t i) {
+  while (i < text.size() && IsWhitespace(text[i])) ++i;
+  return i;
+}
+
+// Given the movemasks of a vector's worth of input, returns the scan result
+// if the vector contains a stop, or advances `i` past it otherwise.
+template <typename Mask>
+bool FinishStringBlock(Mask stops, Mask non_ascii, size_t& i,
+                       bool& has_non_ascii) {
+  if (stops == 0) {
+    has_non_ascii |= non_ascii != 0;
+    i += sizeof(Mask) * 8;
+    return false;
+  }
+  int stop = absl::countr_zero(stops);
+  // Only the bytes before the stop are part of the result.
+  has_non_ascii |= (non_ascii & ((Mask{1} << stop) - 1)) != 0;
+  i += static_cast<size_t>(stop);
+  return true;
+}
+
+#ifdef PROTOBUF_JSON_SCAN_SSE2
+StringScan ScanStringCharsSse2(absl::string_view text, char quote) {
+  const __m128i quotes = _mm_set1_epi8(quote);
+  const __m128i backslashes = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1f);
+
+  size_t i = 0;
+  bool has_non_ascii = false;
+  for (; i + 16 <= text.size();) {
+    __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+    // There is no unsigned byte comparison in SSE2, but v <= 0x1f if and only
+    // if min(v, 0x1f) == v.
+    __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(v, max_control), v);
+    __m128i stops = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, quotes), _mm_cmpeq_epi8(v, backslashes)),
+        control);
+    if (FinishStringBlock(static_cast<uint16_t>(_mm_movemask_epi8(stops)),
+                          static_cast<uint16_t>(_mm_movemask_epi8(v)), i,
+                          has_non_ascii)) {
+      return {i, has_non_ascii};
+    }
+  }
+  return ScanStringCharsScalar(text, quote, i, has_non_ascii);
+}
+
+size_t ScanWhitespaceSse2(absl::string_view text) {
+  const __m128i spaces = _mm_set1_epi8(' ');
+  const __m128i tabs = _mm_set1_epi8('\t');
+  const __m128i crs = _mm_set1_epi8('\r');
+  const __m128i lfs = _mm_set1_epi8('\n');
+
+  size_t i = 0;
+  for (; i + 16 <= text.size(); i += 16) {
+    __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+    __m128i ws = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, spaces), _mm_cmpeq_epi8(v, tabs)),
+        _mm_or_si128(_mm_cmpeq_epi8(v, crs), _mm_cmpeq_epi8(v, lfs)));
+    auto other = static_cast<uint16_t>(~_mm_movemask_epi8(ws));
+    if (other != 0) {
+      return i + static_cast<size_t>(absl::countr_zero(other));
+    }
+  }
+  return ScanWhitespaceScalar(text, i);
+}
+#endif  // PROTOBUF_JSON_SCAN_SSE2
+
+#ifdef PROTOBUF_JSON_SCAN_AVX2
+__attribute__((target("avx2"))) StringScan ScanStringCharsAvx2(
+    absl::string_view text, char quote) {
+  const __m256i quotes = _mm256_set1_epi8(quote);
+  const __m256i backslashes = _mm256_set1_epi8('\\');
+  const __m256i max_control = _mm256_set1_epi8(0x1f);
+
+  size_t i = 0;
+  bool has_non_ascii = false;
+  for (; i + 32 <= text.size();) {
+    __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + i));
+    __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(v, max_control), v);
+    __m256i stops = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, quotes),
+                        _mm256_cmpeq_epi8(v, backslashes)),
+        control);
+    if (FinishStringBlock(static_cast<uint32_t>(_mm256_movemask_epi8(stops)),
+                          static_cast<uint32_t>(_mm256_movemask_epi8(v)), i,
+                          has_non_ascii)) {
+      return {i, has_non_ascii};
+    }
+  }
+  return ScanStringCharsScalar(text, quote, i, has_non_ascii);
+}
+
+__attribute__((target("avx2"))) size_t ScanWhitespaceAvx2(
+    absl::string_view text) {
+  const __m256i spaces = _mm256_set1_epi8(' ');
+  const __m256i tabs = _mm256_set1_epi8('\t');
+  const __m256i crs = _mm256_set1_epi8('\r');
+  const __m256i lfs = _mm256_set1_epi8('\n');
+
+  size_t i = 0;
+  for (; i + 32 <= text.size(); i += 32) {
+    __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + i));
+    __m256i ws = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, spaces),
+                        _mm256_cmpeq_epi8(v, tabs)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, crs), _mm256_cmpeq_epi8(v, lfs)));
+    auto other = ~static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+    if (other != 0) {
+      return i + static_cast<size_t>(absl::countr_zero(other));
+    }
+  }
+  return ScanWhitespaceScalar(text, i);
+}
+#endif  // PROTOBUF_JSON_SCAN_AVX2
+
+ScanLevel DetectScanLevel() {
+#ifdef PROTOBUF_JSON_SCAN_AVX2
+  if (__builtin_cpu_supports("avx2")) return ScanLevel::kAvx2;
+#endif
+#ifdef PROTOBUF_JSON_SCAN_SSE2
+  return ScanLevel::kSse2;
+#else
+  return ScanLevel::kScalar;
+#endif
+}
+
+}  // namespace
+
+ScanLevel BestScanLevel() {
+  static const ScanLevel kLevel = DetectScanLevel();
+  return kLevel;
+}
+
+bool IsScanLevelSupported(ScanLevel level) {
+  return static_cast<int>(level) <= static_cast<int>(BestScanLevel());
+}
+
+StringScan ScanStringChars(absl::string_view text, char quote,
+                           ScanLevel level) {
+  ABSL_DCHECK(IsScanLevelSupported(level));
+  switch (level) {
+#ifdef PROTOBUF_JSON_SCAN_AVX2
+    case ScanLevel::kAvx2:
+      return ScanStringCharsAvx2(text, quote);
+#endif
+#ifdef PROTOBUF_JSON_SCAN_SSE2
+    case ScanLevel::kSse2:
+      return ScanStringCharsSse2(text, quote);
+#endif
+    default:
+      return ScanStringCharsScalar(text, quote, 0, false);
+  }
+}
+
+size_t ScanWhitespace(absl::string_view text, ScanLevel level) {
+  ABSL_DCHECK(IsScanLevelSupported(level));
+  switch (level) {
+#ifdef PROTOBUF_JSON_SCAN_AVX2
+    case ScanLevel::kAvx2:
+      return ScanWhitespaceAvx2(text);
+#endif
+#ifdef PROTOBUF_JSON_SCAN_SSE2
+    case ScanLevel::kSse2:
+      return ScanWhitespaceSse2(text);
+#endif
+    default:
+      return ScanWhitespaceScalar(text, 0);
+  }
+}
+
+}  // namespace json_internal
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,74 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Bulk scanning primitives for the JSON lexer.
+//
+// The lexer consumes its input one character at a time, which is needlessly
+// slow for the long runs of plain string contents and indentation that make
+// up most real-world JSON. The functions in this file find the end of such
+// runs a vector register at a time, so that the lexer only has to fall back
+// to its per-character state machine at "interesting" bytes.
+
+#ifndef GOOGLE_PROTOBUF_JSON_INTERNAL_SCAN_H__
+#define GOOGLE_PROTOBUF_JSON_INTERNAL_SCAN_H__
+
+#include <cstddef>
+
+#include "absl/strings/string_view.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace json_internal {
+
+// An instruction set that the scanning functions can be implemented with.
+enum class ScanLevel {
+  kScalar,
+  kSse2,
+  kAvx2,
+};
+
+// Returns the fastest ScanLevel supported by the CPU we are running on. The
+// result is computed once and cached.
+PROTOBUF_EXPORT ScanLevel BestScanLevel();
+
+// Returns whether `level` can be used on this CPU.
+PROTOBUF_EXPORT bool IsScanLevelSupported(ScanLevel level);
+
+// The result of ScanStringChars().
+struct StringScan {
+  // The length of the prefix of the input that consists of plain string
+  // characters.
+  size_t len;
+  // Whether any byte in that prefix is not ASCII, i.e., whether the prefix
+  // needs to be validated as UTF-8.
+  bool has_non_ascii;
+};
+
+// Returns the length of the longest prefix of `text` that contains no
+// `quote`, no backslash and no control character (a byte below 0x20). Such a
+// prefix can be copied into a string literal's value verbatim, provided it
+// is valid UTF-8.
+//
+// `level` must be supported by the CPU; it is exposed for testing and
+// benchmarking.
+PROTOBUF_EXPORT StringScan ScanStringChars(absl::string_view text, char quote,
+                                           ScanLevel level = BestScanLevel());
+
+// Returns the length of the longest prefix of `text` that consists only of
+// JSON whitespace: spaces, tabs, carriage returns and newlines.
+PROTOBUF_EXPORT size_t ScanWhitespace(absl::string_view text,
+                                      ScanLevel level = BestScanLevel());
+
+}  // namespace json_internal
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
+#endif  // GOOGLE_PROTOBUF_JSON_INTERNAL_SCAN_H__
@@ -0,0 +1,146 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Reports the throughput, in GB/s, of the JSON scanning primitives at every
+// ScanLevel the CPU supports, and of whole-document JSON parsing with and
+// without unknown fields to skip. Results are printed as one JSON object per
+// line.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "google/protobuf/empty.pb.h"
+#include "google/protobuf/json/internal/scan.h"
+#include "google/protobuf/json/json.h"
+#include "google/protobuf/struct.pb.h"
+
+namespace google {
+namespace protobuf {
+namespace json_internal {
+namespace {
+
+constexpr size_t kDocumentSize = 16 << 20;
+
+// Runs `fn` over `bytes` bytes of input until at least half a second has
+// passed, and returns the throughput in GB/s.
+template <typename Fn>
+double MeasureGbps(size_t bytes, Fn fn) {
+  int64_t iterations = 0;
+  absl::Time start = absl::Now();
+  absl::Duration elapsed;
+  do {
+    fn();
+    ++iterations;
+    elapsed = absl::Now() - start;
+  } while (elapsed < absl::Milliseconds(500));
+  return static_cast<double>(bytes) * static_cast<double>(iterations) /
+         absl::ToDoubleSeconds(elapsed) / 1e9;
+}
+
+const char* LevelName(ScanLevel level) {
+  switch (level) {
+    case ScanLevel::kScalar:
+      return "scalar";
+    case ScanLevel::kSse2:
+      return "sse2";
+    case ScanLevel::kAvx2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+// Returns a pretty-printed JSON object with `fields` string-valued fields,
+// where the strings are a mix of ASCII and multi-byte characters.
+std::string MakeDocument(absl::BitGen& gen, int fields) {
+  std::string json = "{\n";
+  for (int i = 0; i < fields; ++i) {
+    absl::StrAppend(&json, i == 0 ? "" : ",\n", "    \"field_", i, "\": \"");
+    size_t len = absl::Uniform<size_t>(gen, 8, 256);
+    for (size_t j = 0; j < len; ++j) {
+      if (absl::Bernoulli(gen, 0.02)) {
+        json += "\xc3\xa9";  // U+00E9
+      } else {
+        json.push_back(static_cast<char>(absl::Uniform<int>(gen, 'a', 'z')));
+      }
+    }
+    json += "\"";
+  }
+  json += "\n}\n";
+  return json;
+}
+
+void BenchmarkScanners(absl::BitGen& gen) {
+  std::string plain;
+  while (plain.size() < kDocumentSize) {
+    plain.push_back(static_cast<char>(absl::Uniform<int>(gen, 'a', 'z')));
+  }
+  std::string whitespace(kDocumentSize, ' ');
+  for (size_t i = 0; i < whitespace.size(); i += 81) whitespace[i] = '\n';
+
+  for (ScanLevel level :
+       {ScanLevel::kScalar, ScanLevel::kSse2, ScanLevel::kAvx2}) {
+    if (!IsScanLevelSupported(level)) continue;
+    size_t sink = 0;
+    double strings = MeasureGbps(plain.size(), [&] {
+      sink += ScanStringChars(plain, '"', level).len;
+    });
+    double spaces = MeasureGbps(whitespace.size(), [&] {
+      sink += ScanWhitespace(whitespace, level);
+    });
+    absl::PrintF(
+        "{\"benchmark\": \"scan\", \"level\": \"%s\", "
+        "\"string_gbps\": %.3f, \"whitespace_gbps\": %.3f, \"sink\": %d}\n",
+        LevelName(level), strings, spaces, sink % 2);
+  }
+}
+
+void BenchmarkParse(absl::BitGen& gen) {
+  std::string document = MakeDocument(gen, 8192);
+
+  Struct parsed;
+  double into_struct = MeasureGbps(document.size(), [&] {
+    parsed.Clear();
+    if (!json::JsonStringToMessage(document, &parsed).ok()) {
+      absl::PrintF("parse failed\n");
+    }
+  });
+
+  // Every field of the document is unknown to Empty, so this measures
+  // skipping values.
+  json::ParseOptions options;
+  options.ignore_unknown_fields = true;
+  Empty empty;
+  double skipped = MeasureGbps(document.size(), [&] {
+    if (!json::JsonStringToMessage(document, &empty, options).ok()) {
+      absl::PrintF("parse failed\n");
+    }
+  });
+
+  absl::PrintF(
+      "{\"benchmark\": \"parse\", \"level\": \"%s\", \"bytes\": %d, "
+      "\"struct_gbps\": %.3f, \"skip_unknown_gbps\": %.3f}\n",
+      LevelName(BestScanLevel()), document.size(), into_struct, skipped);
+}
+
+}  // namespace
+}  // namespace json_internal
+}  // namespace protobuf
+}  // namespace google
+
+int main() {
+  absl::BitGen gen;
+  google::protobuf::json_internal::BenchmarkScanners(gen);
+  google::protobuf::json_internal::BenchmarkParse(gen);
+  return 0;
+}
@@ -0,0 +1,148 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/json/internal/scan.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "absl/strings/string_view.h"
+
+namespace google {
+namespace protobuf {
+namespace json_internal {
+namespace {
+
+std::vector<ScanLevel> SupportedLevels() {
+  std::vector<ScanLevel> levels;
+  for (ScanLevel level :
+       {ScanLevel::kScalar, ScanLevel::kSse2, ScanLevel::kAvx2}) {
+    if (IsScanLevelSupported(level)) levels.push_back(level);
+  }
+  return levels;
+}
+
+// A straightforward reference implementation of ScanStringChars().
+StringScan ReferenceScanStringChars(absl::string_view text, char quote) {
+  StringScan scan = {0, false};
+  for (char c : text) {
+    if (c == quote || c == '\\' || static_cast<uint8_t>(c) < 0x20) break;
+    scan.has_non_ascii |= static_cast<uint8_t>(c) >= 0x80;
+    ++scan.len;
+  }
+  return scan;
+}
+
+size_t ReferenceScanWhitespace(absl::string_view text) {
+  size_t len = 0;
+  while (len < text.size() && absl::string_view(" \t\r\n").find(text[len]) !=
+                                  absl::string_view::npos) {
+    ++len;
+  }
+  return len;
+}
+
+class ScanTest : public testing::TestWithParam<ScanLevel> {};
+
+INSTANTIATE_TEST_SUITE_P(Levels, ScanTest,
+                         testing::ValuesIn(SupportedLevels()));
+
+TEST(ScanLevelTest, ScalarIsAlwaysSupported) {
+  EXPECT_TRUE(IsScanLevelSupported(ScanLevel::kScalar));
+  EXPECT_TRUE(IsScanLevelSupported(BestScanLevel()));
+}
+
+TEST_P(ScanTest, StringStopsAtEachSpecialCharacter) {
+  // Place each stop character at every offset of a string long enough to
+  // exercise both the vector loop and the scalar tail.
+  for (char stop : {'"', '\\', '\0', '\n', '\x1f'}) {
+    for (size_t pos = 0; pos < 80; ++pos) {
+      std::string text(100, 'a');
+      text[pos] = stop;
+      StringScan scan = ScanStringChars(text, '"', GetParam());
+      EXPECT_EQ(scan.len, pos) << static_cast<int>(stop);
+      EXPECT_FALSE(scan.has_non_ascii);
+    }
+  }
+}
+
+TEST_P(ScanTest, StringQuoteIsConfigurable) {
+  EXPECT_EQ(ScanStringChars("it's \"quoted\"", '"', GetParam()).len, 5);
+  EXPECT_EQ(ScanStringChars("it's \"quoted\"", '\'', GetParam()).len, 2);
+}
+
+TEST_P(ScanTest, StringHighBytesAreNotStops) {
+  // 0x80 and above must not be mistaken for control characters by a signed
+  // comparison.
+  std::string text;
+  for (int c = 0x20; c <= 0xff; ++c) {
+    if (c != '"' && c != '\\') text.push_back(static_cast<char>(c));
+  }
+  StringScan scan = ScanStringChars(text, '"', GetParam());
+  EXPECT_EQ(scan.len, text.size());
+  EXPECT_TRUE(scan.has_non_ascii);
+}
+
+TEST_P(ScanTest, StringNonAsciiAfterStopIsIgnored) {
+  for (size_t pos = 0; pos < 70; ++pos) {
+    std::string text(pos, 'a');
+    text += "\"\xc3\xa9";
+    text.append(40, 'b');
+    StringScan scan = ScanStringChars(text, '"', GetParam());
+    EXPECT_EQ(scan.len, pos);
+    EXPECT_FALSE(scan.has_non_ascii);
+  }
+}
+
+TEST_P(ScanTest, WhitespaceStopsAtFirstOtherCharacter) {
+  for (size_t pos = 0; pos < 80; ++pos) {
+    std::string text;
+    for (size_t i = 0; i < 100; ++i) text.push_back(" \t\r\n"[i % 4]);
+    text[pos] = '{';
+    EXPECT_EQ(ScanWhitespace(text, GetParam()), pos);
+  }
+  EXPECT_EQ(ScanWhitespace("", GetParam()), 0);
+  EXPECT_EQ(ScanWhitespace(std::string(64, ' '), GetParam()), 64);
+  EXPECT_EQ(ScanWhitespace(std::string(40, '\v'), GetParam()), 0);
+}
+
+TEST_P(ScanTest, MatchesReference) {
+  std::mt19937 rng(12345);
+  // Bias the alphabet towards characters that matter to the scanners.
+  const std::string alphabet = "  \t\r\n\"'\\\x01\x7f\x80\xc3\xff" "abc";
+  for (int iter = 0; iter < 2000; ++iter) {
+    size_t len = rng() % 100;
+    // Make long runs of plain characters likely, so that stops land in
+    // every position of a vector.
+    int density = 1 + static_cast<int>(rng() % 50);
+    std::string text;
+    for (size_t i = 0; i < len; ++i) {
+      if (static_cast<int>(rng() % density) == 0) {
+        text.push_back(alphabet[rng() % alphabet.size()]);
+      } else {
+        text.push_back(rng() % 2 ? ' ' : 'x');
+      }
+    }
+    for (char quote : {'"', '\''}) {
+      StringScan expected = ReferenceScanStringChars(text, quote);
+      StringScan actual = ScanStringChars(text, quote, GetParam());
+      EXPECT_EQ(actual.len, expected.len) << text;
+      EXPECT_EQ(actual.has_non_ascii, expected.has_non_ascii) << text;
+    }
+    EXPECT_EQ(ScanWhitespace(text, GetParam()), ReferenceScanWhitespace(text))
+        << text;
+  }
+}
+
+}  // namespace
+}  // namespace json_internal
+}  // namespace protobuf
+}  // namespace google
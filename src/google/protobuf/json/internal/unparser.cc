@@ -33,6 +33,7 @@
 #include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/io/zero_copy_stream.h"
 #include "google/protobuf/json/internal/descriptor_traits.h"
+#include "google/protobuf/json/internal/generated_serializer.h"
 #include "google/protobuf/json/internal/unparser_traits.h"
 #include "google/protobuf/json/internal/writer.h"
 #include "google/protobuf/message.h"
@@ -84,33 +85,6 @@ void WriteEnum(JsonWriter& writer, Field<Traits> field, int32_t value,
   }
 }
 
-// Returns true if x round-trips through being cast to a double, i.e., if
-// x is represenable exactly as a double. This is a slightly weaker condition
-// than x < 2^52.
-template <typename Int>
-bool RoundTripsThroughDouble(Int x) {
-  auto d = static_cast<double>(x);
-  // d has guaranteed to be finite with no fractional part, because it came from
-  // an integer, so we only need to check that it is not outside of the
-  // representable range of `int`. The way to do this is somewhat not obvious:
-  // UINT64_MAX isn't representable, and what it gets rounded to when we go
-  // int->double is unspecified!
-  //
-  // Thus, we have to go through ldexp.
-  double min = 0;
-  double max_plus_one = std::ldexp(1.0, sizeof(Int) * 8);
-  if (std::is_signed<Int>::value) {
-    max_plus_one /= 2;
-    min = -max_plus_one;
-  }
-
-  if (d < min || d >= max_plus_one) {
-    return false;
-  }
-
-  return static_cast<Int>(d) == x;
-}
-
 // Mutually recursive with functions that follow.
 template <typename Traits>
 absl::Status WriteMessage(JsonWriter& writer, const Msg<Traits>& msg,
@@ -485,6 +459,26 @@ absl::Status WriteFields(JsonWriter& writer, const Msg<Traits>& msg,
   return absl::OkStatus();
 }
 
+// Like WriteFields(), but uses the generated serializer of `msg` if it has
+// one. Only generated messages can have one.
+template <typename Traits>
+absl::Status WriteFieldsMaybeGenerated(JsonWriter& writer,
+                                       const Msg<Traits>& msg,
+                                       const Desc<Traits>& desc, bool& first) {
+  return WriteFields<Traits>(writer, msg, desc, first);
+}
+
+template <>
+absl::Status WriteFieldsMaybeGenerated<UnparseProto2Descriptor>(
+    JsonWriter& writer, const Message& msg, const Descriptor& desc,
+    bool& first) {
+  const GeneratedSerializer* serializer = GeneratedSerializerAccess::Get(msg);
+  if (serializer != nullptr) {
+    return serializer->write_fields(msg, writer, first);
+  }
+  return WriteFields<UnparseProto2Descriptor>(writer, msg, desc, first);
+}
+
 template <typename Traits>
 absl::Status WriteStructValue(JsonWriter& writer, const Msg<Traits>& msg,
                               const Desc<Traits>& desc);
@@ -818,7 +812,8 @@ absl::Status WriteMessage(JsonWriter& writer, const Msg<Traits>& msg,
       writer.Write("{");
       writer.Push();
       bool first = true;
-      RETURN_IF_ERROR(WriteFields<Traits>(writer, msg, desc, first));
+      RETURN_IF_ERROR(
+          WriteFieldsMaybeGenerated<Traits>(writer, msg, desc, first));
       writer.Pop();
       if (!first) {
         writer.NewLine();
@@ -830,6 +825,32 @@ absl::Status WriteMessage(JsonWriter& writer, const Msg<Traits>& msg,
 }
 }  // namespace
 
+void WriteEnumField(JsonWriter& writer, const FieldDescriptor* field,
+                    int32_t value) {
+  WriteEnum<UnparseProto2Descriptor>(writer, field, value);
+}
+
+absl::Status WriteMessageField(JsonWriter& writer, const Message& msg) {
+  return WriteMessage<UnparseProto2Descriptor>(writer, msg,
+                                               *msg.GetDescriptor());
+}
+
+absl::Status WriteFieldReflectively(JsonWriter& writer, const Message& msg,
+                                    const FieldDescriptor* field,
+                                    bool& first) {
+  // This must agree with the selection of fields in WriteFields().
+  bool has = UnparseProto2Descriptor::GetSize(field, msg) > 0;
+  if (writer.options().always_print_primitive_fields) {
+    bool is_singular_message =
+        !field->is_repeated() && field->type() == FieldDescriptor::TYPE_MESSAGE;
+    has |= !is_singular_message && field->containing_oneof() == nullptr;
+  }
+  if (!has) {
+    return absl::OkStatus();
+  }
+  return WriteField<UnparseProto2Descriptor>(writer, msg, field, first);
+}
+
 absl::Status MessageToJsonString(const Message& message, std::string* output,
                                  json_internal::WriterOptions options) {
   if (PROTOBUF_DEBUG) {
@@ -8,6 +8,7 @@
 #include "google/protobuf/map.h"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
 #include <string>
@@ -23,10 +24,41 @@
 
 namespace google {
 namespace protobuf {
+
+namespace {
+std::atomic<MapLayout> default_map_layout{MapLayout::kChained};
+}  // namespace
+
+void SetDefaultMapLayout(MapLayout layout) {
+  default_map_layout.store(layout, std::memory_order_relaxed);
+}
+
+MapLayout GetDefaultMapLayout() {
+  return default_map_layout.load(std::memory_order_relaxed);
+}
+
 namespace internal {
 
 const TableEntryPtr kGlobalEmptyTable[kGlobalEmptyTableSize] = {};
 
+map_index_t UntypedMapBase::SeedForNewTable() const {
+  const map_index_t seed = Seed() & ~kOpenAddressingSeedBit;
+  return GetDefaultMapLayout() == MapLayout::kOpenAddressing
+             ? seed | kOpenAddressingSeedBit
+             : seed;
+}
+
+map_index_t UntypedMapBase::FindFreeSlot(ProbeStart start) const {
+  const uint8_t* ctrl = CtrlBytes();
+  map_index_t group = start.group;
+  map_index_t stride = 0;
+  while (true) {
+    const uint32_t free = MapCtrlGroup(ctrl + group).MatchFree();
+    if (free != 0) return group + absl::countr_zero(free);
+    group = NextGroup(group, stride);
+  }
+}
+
 NodeBase* UntypedMapBase::DestroyTree(Tree* tree) {
   NodeBase* head = tree->empty() ? nullptr : tree->begin()->second;
   if (alloc_.arena() == nullptr) {
@@ -180,6 +212,10 @@ void UntypedMapBase::ClearTable(const ClearInput input) {
 
   if (input.reset_table) {
     std::fill(table_, table_ + num_buckets_, TableEntryPtr{});
+    if (IsOpenAddressing()) {
+      memset(CtrlBytes(), kMapCtrlEmpty, num_buckets_);
+      SetNumDeleted(0);
+    }
     num_elements_ = 0;
     index_of_first_non_null_ = num_buckets_;
   } else {
@@ -200,8 +236,8 @@ auto UntypedMapBase::FindFromTree(map_index_t b, VariantKey key,
 
 size_t UntypedMapBase::SpaceUsedInTable(size_t sizeof_node) const {
   size_t size = 0;
-  // The size of the table.
-  size += sizeof(void*) * num_buckets_;
+  // The size of the table, including the control bytes if any.
+  size += sizeof(void*) * TableAllocSize(num_buckets_);
   // All the nodes.
   size += sizeof_node * num_elements_;
   // For each tree, count the overhead of those nodes.
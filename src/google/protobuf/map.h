@@ -28,11 +28,16 @@
 #include <time.h>
 #endif
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "google/protobuf/stubs/common.h"
 #include "absl/base/attributes.h"
 #include "absl/container/btree_map.h"
 #include "absl/hash/hash.h"
 #include "absl/meta/type_traits.h"
+#include "absl/numeric/bits.h"
 #include "absl/strings/string_view.h"
 #include "google/protobuf/arena.h"
 #include "google/protobuf/generated_enum_util.h"
@@ -57,6 +62,25 @@ class Map;
 
 class MapIterator;
 
+// Hash table layout used by Map.
+enum class MapLayout {
+  // Separate chaining. Each bucket holds a linked list of nodes, which is
+  // converted into a tree when it gets too long. This is the default.
+  kChained,
+  // Open addressing. Each slot holds at most one node, and a parallel array of
+  // one byte tags is probed a group of slots at a time.
+  kOpenAddressing,
+};
+
+// Sets the layout used by maps that allocate their first table after this
+// call. A map keeps the layout it started with until it is destroyed, so maps
+// with different layouts can coexist. Elements are always stored in separately
+// allocated nodes, so pointers and references to elements stay valid across
+// rehashes regardless of the layout.
+// This function is thread-safe.
+PROTOBUF_EXPORT void SetDefaultMapLayout(MapLayout layout);
+PROTOBUF_EXPORT MapLayout GetDefaultMapLayout();
+
 template <typename Enum>
 struct is_proto_enum;
 
@@ -468,6 +492,66 @@ N MultiplyWithOverflow(N a, N b) {
 
 inline size_t SpaceUsedInValues(const void*) { return 0; }
 
+// Control bytes of the open addressing layout. A full slot stores a 7-bit tag
+// taken from the hash of its key. Empty and deleted slots have the high bit set
+// so that they never match a tag.
+enum : uint8_t {
+  kMapCtrlEmpty = 0x80,
+  kMapCtrlDeleted = 0xFE,
+};
+
+// A group of consecutive control bytes that is matched in one go.
+// Bit `i` of the returned masks refers to the `i`th slot of the group.
+class MapCtrlGroup {
+ public:
+  static constexpr map_index_t kWidth = 16;
+
+  explicit MapCtrlGroup(const uint8_t* ctrl) {
+#if defined(__SSE2__)
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    memcpy(ctrl_, ctrl, kWidth);
+#endif
+  }
+
+  // Slots whose tag is `tag`.
+  uint32_t Match(uint8_t tag) const {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), ctrl_)));
+#else
+    uint32_t mask = 0;
+    for (map_index_t i = 0; i < kWidth; ++i) {
+      mask |= static_cast<uint32_t>(ctrl_[i] == tag) << i;
+    }
+    return mask;
+#endif
+  }
+
+  // Slots that were never used since the last rehash.
+  uint32_t MatchEmpty() const { return Match(kMapCtrlEmpty); }
+
+  // Slots that are empty or deleted, ie available for insertion.
+  uint32_t MatchFree() const {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+    uint32_t mask = 0;
+    for (map_index_t i = 0; i < kWidth; ++i) {
+      mask |= static_cast<uint32_t>(ctrl_[i] >> 7) << i;
+    }
+    return mask;
+#endif
+  }
+
+ private:
+#if defined(__SSE2__)
+  __m128i ctrl_;
+#else
+  uint8_t ctrl_[kWidth];
+#endif
+};
+
 class UntypedMapBase;
 
 class UntypedMapIterator {
@@ -567,9 +651,12 @@ class PROTOBUF_EXPORT UntypedMapBase {
   friend struct MapBenchmarkPeer;
   friend class UntypedMapIterator;
 
+  // For the open addressing layout `bucket` is a slot index. When the key was
+  // not found it is the slot to insert into, and `tag` is the key's tag.
   struct NodeAndBucket {
     NodeBase* node;
     map_index_t bucket;
+    uint8_t tag = 0;
   };
 
   // Returns whether we should insert after the head of the list. For
@@ -618,13 +705,94 @@ class PROTOBUF_EXPORT UntypedMapBase {
     return internal::TableEntryIsTooLong(TableEntryToNode(table_[b]));
   }
 
-  // Return a power of two no less than max(kMinTableSize, n).
-  // Assumes either n < kMinTableSize or n is a power of two.
+  // Return a power of two no less than max(MinTableSize(), n).
+  // Assumes either n < MinTableSize() or n is a power of two.
   map_index_t TableSize(map_index_t n) {
-    return n < static_cast<map_index_t>(kMinTableSize)
-               ? static_cast<map_index_t>(kMinTableSize)
+    return n < MinTableSize() ? MinTableSize() : n;
+  }
+
+  // The layout is chosen when the first table is allocated and recorded in the
+  // lowest bit of the seed, which is otherwise only mixed into the hash.
+  static constexpr map_index_t kOpenAddressingSeedBit = 1;
+  bool IsOpenAddressing() const {
+    return (seed_ & kOpenAddressingSeedBit) != 0;
+  }
+
+  // The open addressing layout needs at least one full group of slots.
+  map_index_t MinTableSize() const {
+    return IsOpenAddressing() ? MapCtrlGroup::kWidth
+                              : static_cast<map_index_t>(kMinTableSize);
+  }
+
+  // With open addressing the allocation for `table_` also holds one control
+  // byte per slot followed by the number of deleted slots.
+  size_t TableAllocSize(map_index_t n) const {
+    return IsOpenAddressing()
+               ? n + n / sizeof(TableEntryPtr) +
+                     (sizeof(map_index_t) + sizeof(TableEntryPtr) - 1) /
+                         sizeof(TableEntryPtr)
                : n;
   }
+  uint8_t* CtrlBytes() const {
+    ABSL_DCHECK(IsOpenAddressing());
+    return reinterpret_cast<uint8_t*>(table_ + num_buckets_);
+  }
+  map_index_t NumDeleted() const {
+    map_index_t res;
+    memcpy(&res, CtrlBytes() + num_buckets_, sizeof(res));
+    return res;
+  }
+  void SetNumDeleted(map_index_t n) {
+    memcpy(CtrlBytes() + num_buckets_, &n, sizeof(n));
+  }
+
+  // Where to start probing for a hash, and the tag to look for.
+  struct ProbeStart {
+    map_index_t group;
+    uint8_t tag;
+  };
+  ProbeStart ProbeStartFromHash(uint64_t h) const {
+    // Same mixing as BucketNumberFromHash. The bucket bits select the group
+    // and the top seven bits, which are not used for the bucket, are the tag.
+    const uint64_t mixed = MultiplyWithOverflow(kHashMultiplier, h ^ seed_);
+    return {static_cast<map_index_t>(mixed >> 32) & (num_buckets_ - 1) &
+                ~(MapCtrlGroup::kWidth - 1),
+            static_cast<uint8_t>(mixed >> 57)};
+  }
+  // Groups are probed in triangular order, which visits every group exactly
+  // once when the number of groups is a power of two.
+  map_index_t NextGroup(map_index_t group, map_index_t& stride) const {
+    stride += MapCtrlGroup::kWidth;
+    return (group + stride) & (num_buckets_ - 1);
+  }
+
+  // Returns the first empty or deleted slot on the probe sequence of `start`.
+  map_index_t FindFreeSlot(ProbeStart start) const;
+
+  // Puts `node` in the free slot `b` and tags it with `tag`.
+  void InsertUniqueInSlot(map_index_t b, uint8_t tag, NodeBase* node) {
+    uint8_t* ctrl = CtrlBytes();
+    ABSL_DCHECK(ctrl[b] & kMapCtrlEmpty);
+    ABSL_DCHECK_EQ(tag & kMapCtrlEmpty, 0);
+    if (ctrl[b] == kMapCtrlDeleted) SetNumDeleted(NumDeleted() - 1);
+    ctrl[b] = tag;
+    node->next = nullptr;
+    table_[b] = NodeToTableEntry(node);
+    index_of_first_non_null_ = (std::min)(index_of_first_non_null_, b);
+  }
+
+  // Empties slot `b`. The slot only needs a tombstone if its group is full,
+  // because probing stops at the first group that has an empty slot.
+  void EraseFromSlot(map_index_t b) {
+    uint8_t* ctrl = CtrlBytes();
+    table_[b] = TableEntryPtr{};
+    if (MapCtrlGroup(ctrl + (b & ~(MapCtrlGroup::kWidth - 1))).MatchEmpty()) {
+      ctrl[b] = kMapCtrlEmpty;
+    } else {
+      ctrl[b] = kMapCtrlDeleted;
+      SetNumDeleted(NumDeleted() + 1);
+    }
+  }
 
   template <typename T>
   using AllocFor = absl::allocator_traits<Allocator>::template rebind_alloc<T>;
@@ -649,7 +817,7 @@ class PROTOBUF_EXPORT UntypedMapBase {
   }
 
   void DeleteTable(TableEntryPtr* table, map_index_t n) {
-    AllocFor<TableEntryPtr>(alloc_).deallocate(table, n);
+    AllocFor<TableEntryPtr>(alloc_).deallocate(table, TableAllocSize(n));
   }
 
   NodeBase* DestroyTree(Tree* tree);
@@ -667,20 +835,33 @@ class PROTOBUF_EXPORT UntypedMapBase {
     h ^= seed_;
 
     // We use the multiplication method to determine the bucket number from
-    // the hash value. The constant kPhi (suggested by Knuth) is roughly
-    // (sqrt(5) - 1) / 2 * 2^64.
-    constexpr uint64_t kPhi = uint64_t{0x9e3779b97f4a7c15};
-    return (MultiplyWithOverflow(kPhi, h) >> 32) & (num_buckets_ - 1);
+    // the hash value.
+    return (MultiplyWithOverflow(kHashMultiplier, h) >> 32) &
+           (num_buckets_ - 1);
   }
 
+  // The constant kPhi (suggested by Knuth) is roughly
+  // (sqrt(5) - 1) / 2 * 2^64.
+  static constexpr uint64_t kHashMultiplier = uint64_t{0x9e3779b97f4a7c15};
+
   TableEntryPtr* CreateEmptyTable(map_index_t n) {
-    ABSL_DCHECK_GE(n, map_index_t{kMinTableSize});
+    ABSL_DCHECK_GE(n, MinTableSize());
     ABSL_DCHECK_EQ(n & (n - 1), 0u);
-    TableEntryPtr* result = AllocFor<TableEntryPtr>(alloc_).allocate(n);
+    TableEntryPtr* result =
+        AllocFor<TableEntryPtr>(alloc_).allocate(TableAllocSize(n));
     memset(result, 0, n * sizeof(result[0]));
+    if (IsOpenAddressing()) {
+      memset(result + n, kMapCtrlEmpty, n);
+      const map_index_t num_deleted = 0;
+      memcpy(reinterpret_cast<uint8_t*>(result + n) + n, &num_deleted,
+             sizeof(num_deleted));
+    }
     return result;
   }
 
+  // Picks the seed for the first table, which also fixes the layout.
+  map_index_t SeedForNewTable() const;
+
   // Return a randomish value.
   map_index_t Seed() const {
     // We get a little bit of randomness from the address of the map. The
@@ -872,6 +1053,11 @@ struct KeyNode : NodeBase {
 // 6. Except for erase(iterator), any non-const method can reorder iterators.
 // 7. Uses VariantKey when using the Tree representation, which holds all
 //    possible key types as a variant value.
+// 8. When the map uses MapLayout::kOpenAddressing, every table entry is either
+//    empty or a list of exactly one node, and there are no trees. A control
+//    byte per slot holds a tag from the hash of the key, and lookups compare a
+//    whole group of tags at once before touching any node. Because the table
+//    entries keep the same shape, iteration and clearing work unchanged.
 
 template <typename Key>
 class KeyMapBase : public UntypedMapBase {
@@ -907,7 +1093,10 @@ class KeyMapBase : public UntypedMapBase {
   PROTOBUF_NOINLINE void erase_no_destroy(map_index_t b, KeyNode* node) {
     TreeIterator tree_it;
     const bool is_list = revalidate_if_necessary(b, node, &tree_it);
-    if (is_list) {
+    if (IsOpenAddressing()) {
+      ABSL_DCHECK(table_[b] == NodeToTableEntry(node));
+      EraseFromSlot(b);
+    } else if (is_list) {
       ABSL_DCHECK(TableEntryIsNonEmptyList(b));
       auto* head = TableEntryToNode(table_[b]);
       head = EraseFromLinkedList(node, head);
@@ -926,6 +1115,7 @@ class KeyMapBase : public UntypedMapBase {
 
   NodeAndBucket FindHelper(typename TS::ViewType k,
                            TreeIterator* it = nullptr) const {
+    if (IsOpenAddressing()) return FindInSlots(k);
     map_index_t b = BucketNumber(k);
     if (TableEntryIsNonEmptyList(b)) {
       auto* node = internal::TableEntryToNode(table_[b]);
@@ -942,6 +1132,32 @@ class KeyMapBase : public UntypedMapBase {
     return {nullptr, b};
   }
 
+  NodeAndBucket FindInSlots(typename TS::ViewType k) const {
+    const ProbeStart start = ProbeStartFromHash(hash_function()(k));
+    const uint8_t* ctrl = CtrlBytes();
+    map_index_t free_slot = num_buckets_;
+    map_index_t group = start.group;
+    map_index_t stride = 0;
+    while (true) {
+      const MapCtrlGroup g(ctrl + group);
+      for (uint32_t mask = g.Match(start.tag); mask != 0; mask &= mask - 1) {
+        const map_index_t b = group + absl::countr_zero(mask);
+        NodeBase* node = TableEntryToNode(table_[b]);
+        if (TS::Equals(static_cast<KeyNode*>(node)->key(), k)) {
+          return {node, b, start.tag};
+        }
+      }
+      if (free_slot == num_buckets_) {
+        const uint32_t free = g.MatchFree();
+        if (free != 0) free_slot = group + absl::countr_zero(free);
+      }
+      if (PROTOBUF_PREDICT_TRUE(g.MatchEmpty() != 0)) {
+        return {nullptr, free_slot, start.tag};
+      }
+      group = NextGroup(group, stride);
+    }
+  }
+
   // Insert the given node.
   // If the key is a duplicate, it inserts the new node and returns the old one.
   // Gives ownership to the caller.
@@ -955,17 +1171,26 @@ class KeyMapBase : public UntypedMapBase {
     } else if (ResizeIfLoadIsOutOfRange(num_elements_ + 1)) {
       p = FindHelper(node->key());
     }
-    const map_index_t b = p.bucket;  // bucket number
-    InsertUnique(b, node);
+    InsertUnique(p, node);
     ++num_elements_;
     return to_erase;
   }
 
+  // Insert the given node where a failed FindHelper said it belongs.
+  void InsertUnique(NodeAndBucket p, KeyNode* node) {
+    if (IsOpenAddressing()) {
+      InsertUniqueInSlot(p.bucket, p.tag, node);
+    } else {
+      InsertUnique(p.bucket, node);
+    }
+  }
+
   // Insert the given Node in bucket b.  If that would make bucket b too big,
   // and bucket b is not a tree, create a tree for buckets b.
   // Requires count(*KeyPtrFromNodePtr(node)) == 0 and that b is the correct
   // bucket.  num_elements_ is not modified.
   void InsertUnique(map_index_t b, KeyNode* node) {
+    ABSL_DCHECK(!IsOpenAddressing());
     ABSL_DCHECK(index_of_first_non_null_ == num_buckets_ ||
                 !TableEntryIsEmpty(index_of_first_non_null_));
     // In practice, the code that led to this point may have already
@@ -997,19 +1222,29 @@ class KeyMapBase : public UntypedMapBase {
   // policy that sometimes we resize down as well as up, clients can easily
   // keep O(size()) = O(number of buckets) if they want that.
   bool ResizeIfLoadIsOutOfRange(size_type new_size) {
-    const size_type kMaxMapLoadTimes16 = 12;  // controls RAM vs CPU tradeoff
+    // Controls RAM vs CPU tradeoff. Open addressing has to keep empty slots
+    // around for probing to terminate, and counts deleted slots as used.
+    const size_type kMaxMapLoadTimes16 = IsOpenAddressing() ? 14 : 12;
     const size_type hi_cutoff = num_buckets_ * kMaxMapLoadTimes16 / 16;
     const size_type lo_cutoff = hi_cutoff / 4;
+    const size_type used =
+        IsOpenAddressing() ? new_size + NumDeleted() : new_size;
     // We don't care how many elements are in trees.  If a lot are,
     // we may resize even though there are many empty buckets.  In
     // practice, this seems fine.
-    if (PROTOBUF_PREDICT_FALSE(new_size >= hi_cutoff)) {
+    if (PROTOBUF_PREDICT_FALSE(used >= hi_cutoff)) {
+      if (IsOpenAddressing() && new_size * 32 <= num_buckets_ * 25) {
+        // Enough of the used slots are deleted ones that dropping them is
+        // better than growing.
+        RehashInPlace();
+        return true;
+      }
       if (num_buckets_ <= max_size() / 2) {
         Resize(num_buckets_ * 2);
         return true;
       }
     } else if (PROTOBUF_PREDICT_FALSE(new_size <= lo_cutoff &&
-                                      num_buckets_ > kMinTableSize)) {
+                                      num_buckets_ > MinTableSize())) {
       size_type lg2_of_size_reduction_factor = 1;
       // It's possible we want to shrink a lot here... size() could even be 0.
       // So, estimate how much to shrink by making sure we don't shrink so
@@ -1019,7 +1254,7 @@ class KeyMapBase : public UntypedMapBase {
         ++lg2_of_size_reduction_factor;
       }
       size_type new_num_buckets = std::max<size_type>(
-          kMinTableSize, num_buckets_ >> lg2_of_size_reduction_factor);
+          MinTableSize(), num_buckets_ >> lg2_of_size_reduction_factor);
       if (new_num_buckets != num_buckets_) {
         Resize(new_num_buckets);
         return true;
@@ -1033,13 +1268,13 @@ class KeyMapBase : public UntypedMapBase {
     if (num_buckets_ == kGlobalEmptyTableSize) {
       // This is the global empty array.
       // Just overwrite with a new one. No need to transfer or free anything.
-      num_buckets_ = index_of_first_non_null_ = kMinTableSize;
+      seed_ = SeedForNewTable();
+      num_buckets_ = index_of_first_non_null_ = MinTableSize();
       table_ = CreateEmptyTable(num_buckets_);
-      seed_ = Seed();
       return;
     }
 
-    ABSL_DCHECK_GE(new_num_buckets, kMinTableSize);
+    ABSL_DCHECK_GE(new_num_buckets, MinTableSize());
     const auto old_table = table_;
     const map_index_t old_table_size = num_buckets_;
     num_buckets_ = new_num_buckets;
@@ -1047,7 +1282,13 @@ class KeyMapBase : public UntypedMapBase {
     const map_index_t start = index_of_first_non_null_;
     index_of_first_non_null_ = num_buckets_;
     for (map_index_t i = start; i < old_table_size; ++i) {
-      if (internal::TableEntryIsNonEmptyList(old_table[i])) {
+      if (IsOpenAddressing()) {
+        if (internal::TableEntryIsEmpty(old_table[i])) continue;
+        NodeBase* node = TableEntryToNode(old_table[i]);
+        const ProbeStart probe = ProbeStartFromHash(
+            hash_function()(static_cast<KeyNode*>(node)->key()));
+        InsertUniqueInSlot(FindFreeSlot(probe), probe.tag, node);
+      } else if (internal::TableEntryIsNonEmptyList(old_table[i])) {
         TransferList(static_cast<KeyNode*>(TableEntryToNode(old_table[i])));
       } else if (internal::TableEntryIsTree(old_table[i])) {
         this->TransferTree(TableEntryToTree(old_table[i]), NodeToVariantKey);
@@ -1056,6 +1297,31 @@ class KeyMapBase : public UntypedMapBase {
     DeleteTable(old_table, old_table_size);
   }
 
+  // Reinserts every node into the open addressing table to get rid of the
+  // deleted slots. The nodes are threaded through their unused `next` field in
+  // the meantime, so this does not allocate.
+  void RehashInPlace() {
+    ABSL_DCHECK(IsOpenAddressing());
+    NodeBase* list = nullptr;
+    for (map_index_t b = index_of_first_non_null_; b < num_buckets_; ++b) {
+      if (TableEntryIsEmpty(b)) continue;
+      NodeBase* node = TableEntryToNode(table_[b]);
+      node->next = list;
+      list = node;
+    }
+    std::fill(table_, table_ + num_buckets_, TableEntryPtr{});
+    memset(CtrlBytes(), kMapCtrlEmpty, num_buckets_);
+    SetNumDeleted(0);
+    index_of_first_non_null_ = num_buckets_;
+    while (list != nullptr) {
+      NodeBase* next = list->next;
+      const ProbeStart probe = ProbeStartFromHash(
+          hash_function()(static_cast<KeyNode*>(list)->key()));
+      InsertUniqueInSlot(FindFreeSlot(probe), probe.tag, list);
+      list = next;
+    }
+  }
+
   // Transfer all nodes in the list `node` into `this`.
   void TransferList(KeyNode* node) {
     do {
@@ -1590,7 +1856,6 @@ class Map : private internal::KeyMapBase<internal::KeyForBase<Key>> {
     if (this->ResizeIfLoadIsOutOfRange(this->num_elements_ + 1)) {
       p = this->FindHelper(TS::ToView(k));
     }
-    const auto b = p.bucket;  // bucket number
     // If K is not key_type, make the conversion to key_type explicit.
     using TypeToInit = typename std::conditional<
         std::is_same<typename std::decay<K>::type, key_type>::value, K&&,
@@ -1611,9 +1876,9 @@ class Map : private internal::KeyMapBase<internal::KeyForBase<Key>> {
     Arena::CreateInArenaStorage(&node->kv.second, this->alloc_.arena(),
                                 std::forward<Args>(args)...);
 
-    this->InsertUnique(b, node);
+    this->InsertUnique(p, node);
     ++this->num_elements_;
-    return std::make_pair(iterator(node, this, b), true);
+    return std::make_pair(iterator(node, this, p.bucket), true);
   }
 
   // A helper function to perform an assignment of `mapped_type`.
@@ -8,15 +8,20 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/random/random.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "google/protobuf/map.h"
+#include "google/protobuf/map_unittest.pb.h"
 
 namespace google::protobuf::internal {
 struct MapBenchmarkPeer {
@@ -28,6 +33,7 @@ struct MapBenchmarkPeer {
 
   template <typename T>
   static double GetMeanProbeLength(const T& map) {
+    if (map.IsOpenAddressing()) return GetMeanGroupProbeLength(map);
     double total_probe_cost = 0;
     for (map_index_t b = 0; b < map.num_buckets_; ++b) {
       if (map.TableEntryIsList(b)) {
@@ -49,6 +55,28 @@ struct MapBenchmarkPeer {
     return total_probe_cost / map.size();
   }
 
+  // For open addressing, the number of groups probed before the one holding
+  // the element.
+  template <typename T>
+  static double GetMeanGroupProbeLength(const T& map) {
+    double total_probe_cost = 0;
+    for (map_index_t b = 0; b < map.num_buckets_; ++b) {
+      if (map.TableEntryIsEmpty(b)) continue;
+      const auto* node =
+          static_cast<typename T::Node*>(TableEntryToNode(map.table_[b]));
+      const auto start =
+          map.ProbeStartFromHash(map.hash_function()(node->kv.first));
+      const map_index_t target = b & ~(MapCtrlGroup::kWidth - 1);
+      map_index_t group = start.group;
+      map_index_t stride = 0;
+      while (group != target) {
+        group = map.NextGroup(group, stride);
+        total_probe_cost += 1;
+      }
+    }
+    return total_probe_cost / map.size();
+  }
+
   template <typename T>
   static double GetPercentTree(const T& map) {
     size_t total_tree_size = 0;
@@ -61,12 +89,12 @@ struct MapBenchmarkPeer {
            static_cast<double>(map.size());
   }
 };
-}  // namespace protobuf
-}  // namespace google::internal
+}  // namespace google::protobuf::internal
 
 namespace {
 
 using Peer = google::protobuf::internal::MapBenchmarkPeer;
+using google::protobuf::MapLayout;
 
 absl::BitGen& GlobalBitGen() {
   static auto* value = new absl::BitGen;
@@ -81,30 +109,40 @@ struct LoadSizes {
   size_t max_load;
 };
 
-LoadSizes GetMinMaxLoadSizes() {
-  static const auto sizes = [] {
-    Table<int> t;
+LoadSizes ComputeMinMaxLoadSizes(MapLayout layout) {
+  const MapLayout old_layout = google::protobuf::GetDefaultMapLayout();
+  google::protobuf::SetDefaultMapLayout(layout);
+  Table<int> t;
 
-    // First, fill enough to have a good distribution.
-    constexpr size_t kMinSize = 10000;
-    while (t.size() < kMinSize) t[static_cast<int>(t.size())];
+  // First, fill enough to have a good distribution.
+  constexpr size_t kMinSize = 10000;
+  while (t.size() < kMinSize) t[static_cast<int>(t.size())];
 
-    const auto reach_min_load_factor = [&] {
-      const double lf = Peer::LoadFactor(t);
-      while (lf <= Peer::LoadFactor(t)) t[static_cast<int>(t.size())];
-    };
+  const auto reach_min_load_factor = [&] {
+    const double lf = Peer::LoadFactor(t);
+    while (lf <= Peer::LoadFactor(t)) t[static_cast<int>(t.size())];
+  };
 
-    // Then, insert until we reach min load factor.
-    reach_min_load_factor();
-    const size_t min_load_size = t.size();
+  // Then, insert until we reach min load factor.
+  reach_min_load_factor();
+  const size_t min_load_size = t.size();
 
-    // Keep going until we hit min load factor again, then go back one.
-    t[static_cast<int>(t.size())];
-    reach_min_load_factor();
+  // Keep going until we hit min load factor again, then go back one.
+  t[static_cast<int>(t.size())];
+  reach_min_load_factor();
 
-    return LoadSizes{min_load_size, t.size() - 1};
-  }();
-  return sizes;
+  google::protobuf::SetDefaultMapLayout(old_layout);
+  return LoadSizes{min_load_size, t.size() - 1};
+}
+
+// The load factor limits depend on the layout, so they are computed for the
+// default layout in effect.
+LoadSizes GetMinMaxLoadSizes() {
+  static const auto chained = ComputeMinMaxLoadSizes(MapLayout::kChained);
+  static const auto open_addressing =
+      ComputeMinMaxLoadSizes(MapLayout::kOpenAddressing);
+  return google::protobuf::GetDefaultMapLayout() == MapLayout::kChained ? chained
+                                                              : open_addressing;
 }
 
 struct Ratios {
@@ -247,6 +285,10 @@ std::string Name() {
   return Name(static_cast<T*>(nullptr));
 }
 
+std::string Name(MapLayout layout) {
+  return layout == MapLayout::kChained ? "Chained" : "OpenAddressing";
+}
+
 struct Result {
   std::string name;
   std::string dist_name;
@@ -255,7 +297,9 @@ struct Result {
 
 template <typename T, typename Dist>
 void RunForTypeAndDistribution(std::vector<Result>& results) {
-  results.push_back({Name<T>(), Name<Dist>(), CollectMeanProbeLengths<Dist>()});
+  results.push_back(
+      {absl::StrCat(Name(google::protobuf::GetDefaultMapLayout()), "/", Name<T>()),
+       Name<Dist>(), CollectMeanProbeLengths<Dist>()});
 }
 
 template <class T>
@@ -268,14 +312,94 @@ void RunForType(std::vector<Result>& results) {
   RunForTypeAndDistribution<T, Random<T, Zipf>>(results);
 }
 
-}  // namespace
+struct Timing {
+  std::string name;
+  double nanos_per_op;
+  size_t iterations;
+};
 
-int main(int argc, char** argv) {
-  std::vector<Result> results;
+// Returns the average wall time of `op` in nanoseconds, running it `count`
+// times per round for enough rounds to smooth out the noise.
+template <typename Op>
+Timing Time(std::string name, size_t count, Op op) {
+  constexpr int kRounds = 5;
+  const absl::Time start = absl::Now();
+  for (int i = 0; i < kRounds; ++i) op();
+  const double nanos = absl::ToDoubleNanoseconds(absl::Now() - start);
+  return {std::move(name), nanos / (count * kRounds), count * kRounds};
+}
+
+template <class T>
+void TimeForType(std::vector<Timing>& timings) {
+  constexpr size_t kNumKeys = 100000;
+  Random<T, Uniform> elem;
+  std::vector<decltype(elem())> keys;
+  while (keys.size() < kNumKeys) keys.push_back(elem());
+
+  const std::string prefix =
+      absl::StrCat(Name(google::protobuf::GetDefaultMapLayout()), "/", Name<T>(), "/");
+  timings.push_back(Time(absl::StrCat(prefix, "insert"), kNumKeys, [&] {
+    Table<decltype(elem())> t;
+    for (const auto& key : keys) t[key];
+  }));
+
+  Table<decltype(elem())> t;
+  for (const auto& key : keys) t[key];
+  size_t found = 0;
+  timings.push_back(Time(absl::StrCat(prefix, "lookup_hit"), kNumKeys, [&] {
+    for (const auto& key : keys) found += t.count(key);
+  }));
+  // Keep the lookups from being optimized away.
+  if (found == 0) absl::PrintF("# no keys found\n");
+}
+
+void TimeParse(std::vector<Timing>& timings) {
+  constexpr int kNumEntries = 10000;
+  protobuf_unittest::TestMap message;
+  for (int i = 0; i < kNumEntries; ++i) {
+    (*message.mutable_map_string_foreign_message())[absl::StrFormat(
+        kStringFormat, i)]
+        .set_c(i);
+  }
+  const std::string data = message.SerializeAsString();
+
+  constexpr size_t kParses = 20;
+  protobuf_unittest::TestMap parsed;
+  Timing timing = Time(
+      absl::StrCat(Name(google::protobuf::GetDefaultMapLayout()), "/parse_string_message"),
+      kParses, [&] {
+        for (size_t i = 0; i < kParses; ++i) {
+          // A fresh message each time, so that the map's table is allocated
+          // with the layout under test.
+          protobuf_unittest::TestMap fresh;
+          if (!fresh.ParseFromString(data)) abort();
+          parsed.Swap(&fresh);
+        }
+      });
+  timings.push_back(std::move(timing));
+}
+
+void RunAll(std::vector<Result>& results, std::vector<Timing>& timings) {
   RunForType<uint64_t>(results);
   RunForType<String<true>>(results);
   RunForType<String<false>>(results);
 
+  TimeForType<uint64_t>(timings);
+  TimeForType<String<true>>(timings);
+  TimeForType<String<false>>(timings);
+  TimeParse(timings);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<Result> results;
+  std::vector<Timing> timings;
+  for (MapLayout layout : {MapLayout::kChained, MapLayout::kOpenAddressing}) {
+    google::protobuf::SetDefaultMapLayout(layout);
+    RunAll(results, timings);
+  }
+
   absl::PrintF("{\n");
   absl::PrintF("  \"benchmarks\": [\n");
   absl::string_view comma;
@@ -299,6 +423,16 @@ int main(int argc, char** argv) {
     print("max", &Ratios::max_load);
     print("tree_percent", &Ratios::percent_tree);
   }
+  for (const auto& timing : timings) {
+    absl::PrintF("    %s{\n", comma);
+    absl::PrintF("      \"cpu_time\": %f,\n", timing.nanos_per_op);
+    absl::PrintF("      \"real_time\": %f,\n", timing.nanos_per_op);
+    absl::PrintF("      \"iterations\": %d,\n", timing.iterations);
+    absl::PrintF("      \"name\": \"%s\",\n", timing.name);
+    absl::PrintF("      \"time_unit\": \"ns\"\n");
+    absl::PrintF("    }\n");
+    comma = ",";
+  }
   absl::PrintF("  ],\n");
   absl::PrintF("  \"context\": {\n");
   absl::PrintF("  }\n");
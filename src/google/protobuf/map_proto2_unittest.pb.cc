@@ -0,0 +1,5176 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_proto2_unittest.proto
+
+#include "google/protobuf/map_proto2_unittest.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR TestProto2BytesMap_MapStringEntry_DoNotUse::TestProto2BytesMap_MapStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestProto2BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestProto2BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestProto2BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestProto2BytesMap_MapStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestProto2BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal _TestProto2BytesMap_MapStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestProto2BytesMap_MapBytesEntry_DoNotUse::TestProto2BytesMap_MapBytesEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestProto2BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestProto2BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestProto2BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestProto2BytesMap_MapBytesEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestProto2BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal _TestProto2BytesMap_MapBytesEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestIntIntMap_MEntry_DoNotUse::TestIntIntMap_MEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestIntIntMap_MEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestIntIntMap_MEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestIntIntMap_MEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestIntIntMap_MEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestIntIntMap_MEntry_DoNotUseDefaultTypeInternal _TestIntIntMap_MEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestImportEnumMap_ImportEnumAmpEntry_DoNotUse::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestImportEnumMap_ImportEnumAmpEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestImportEnumMap_ImportEnumAmpEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestImportEnumMap_ImportEnumAmpEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestImportEnumMap_ImportEnumAmpEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestImportEnumMap_ImportEnumAmpEntry_DoNotUseDefaultTypeInternal _TestImportEnumMap_ImportEnumAmpEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldStringEntry_DoNotUse::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldEntry_DoNotUse::TestEnumMap_UnknownMapFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap_KnownMapFieldEntry_DoNotUse::TestEnumMap_KnownMapFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestEnumMap_KnownMapFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMap_KnownMapFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMap_KnownMapFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestEnumMap_KnownMapFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMap_KnownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMap_KnownMapFieldEntry_DoNotUse_default_instance_;
+
+inline constexpr TestProto2BytesMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_bytes_{},
+        map_string_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestProto2BytesMap::TestProto2BytesMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestProto2BytesMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestProto2BytesMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestProto2BytesMapDefaultTypeInternal() {}
+  union {
+    TestProto2BytesMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestProto2BytesMapDefaultTypeInternal _TestProto2BytesMap_default_instance_;
+
+inline constexpr TestIntIntMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : m_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestIntIntMap::TestIntIntMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestIntIntMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestIntIntMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestIntIntMapDefaultTypeInternal() {}
+  union {
+    TestIntIntMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestIntIntMapDefaultTypeInternal _TestIntIntMap_default_instance_;
+
+inline constexpr TestImportEnumMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : import_enum_amp_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestImportEnumMap::TestImportEnumMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestImportEnumMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestImportEnumMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestImportEnumMapDefaultTypeInternal() {}
+  union {
+    TestImportEnumMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestImportEnumMapDefaultTypeInternal _TestImportEnumMap_default_instance_;
+
+inline constexpr TestEnumMapPlusExtra::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : known_map_field_{},
+        unknown_map_field_{},
+        unknown_map_field_int64_{},
+        unknown_map_field_uint64_{},
+        unknown_map_field_int32_{},
+        unknown_map_field_uint32_{},
+        unknown_map_field_fixed32_{},
+        unknown_map_field_fixed64_{},
+        unknown_map_field_bool_{},
+        unknown_map_field_string_{},
+        unknown_map_field_sint32_{},
+        unknown_map_field_sint64_{},
+        unknown_map_field_sfixed32_{},
+        unknown_map_field_sfixed64_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestEnumMapPlusExtra::TestEnumMapPlusExtra(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestEnumMapPlusExtraDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapPlusExtraDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapPlusExtraDefaultTypeInternal() {}
+  union {
+    TestEnumMapPlusExtra _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapPlusExtraDefaultTypeInternal _TestEnumMapPlusExtra_default_instance_;
+
+inline constexpr TestEnumMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : known_map_field_{},
+        unknown_map_field_{},
+        unknown_map_field_int64_{},
+        unknown_map_field_uint64_{},
+        unknown_map_field_int32_{},
+        unknown_map_field_uint32_{},
+        unknown_map_field_fixed32_{},
+        unknown_map_field_fixed64_{},
+        unknown_map_field_bool_{},
+        unknown_map_field_string_{},
+        unknown_map_field_sint32_{},
+        unknown_map_field_sint64_{},
+        unknown_map_field_sfixed32_{},
+        unknown_map_field_sfixed64_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestEnumMap::TestEnumMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestEnumMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumMapDefaultTypeInternal() {}
+  union {
+    TestEnumMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumMapDefaultTypeInternal _TestEnumMap_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MUint64Entry_DoNotUse::TestMaps_MUint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MUint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MUint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MUint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MUint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MUint64Entry_DoNotUseDefaultTypeInternal _TestMaps_MUint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MUint32Entry_DoNotUse::TestMaps_MUint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MUint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MUint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MUint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MUint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MUint32Entry_DoNotUseDefaultTypeInternal _TestMaps_MUint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MStringEntry_DoNotUse::TestMaps_MStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MStringEntry_DoNotUseDefaultTypeInternal _TestMaps_MStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MSint64Entry_DoNotUse::TestMaps_MSint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MSint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MSint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MSint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MSint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MSint64Entry_DoNotUseDefaultTypeInternal _TestMaps_MSint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MSint32Entry_DoNotUse::TestMaps_MSint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MSint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MSint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MSint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MSint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MSint32Entry_DoNotUseDefaultTypeInternal _TestMaps_MSint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MSfixed64Entry_DoNotUse::TestMaps_MSfixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MSfixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MSfixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MSfixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MSfixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MSfixed64Entry_DoNotUseDefaultTypeInternal _TestMaps_MSfixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MSfixed32Entry_DoNotUse::TestMaps_MSfixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MSfixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MSfixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MSfixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MSfixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MSfixed32Entry_DoNotUseDefaultTypeInternal _TestMaps_MSfixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MInt64Entry_DoNotUse::TestMaps_MInt64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MInt64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MInt64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MInt64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MInt64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MInt64Entry_DoNotUseDefaultTypeInternal _TestMaps_MInt64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MInt32Entry_DoNotUse::TestMaps_MInt32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MInt32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MInt32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MInt32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MInt32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MInt32Entry_DoNotUseDefaultTypeInternal _TestMaps_MInt32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MFixed64Entry_DoNotUse::TestMaps_MFixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MFixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MFixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MFixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MFixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MFixed64Entry_DoNotUseDefaultTypeInternal _TestMaps_MFixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MFixed32Entry_DoNotUse::TestMaps_MFixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MFixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MFixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MFixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MFixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MFixed32Entry_DoNotUseDefaultTypeInternal _TestMaps_MFixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMaps_MBoolEntry_DoNotUse::TestMaps_MBoolEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMaps_MBoolEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMaps_MBoolEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMaps_MBoolEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMaps_MBoolEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMaps_MBoolEntry_DoNotUseDefaultTypeInternal _TestMaps_MBoolEntry_DoNotUse_default_instance_;
+
+inline constexpr TestMaps::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : m_int32_{},
+        m_int64_{},
+        m_uint32_{},
+        m_uint64_{},
+        m_sint32_{},
+        m_sint64_{},
+        m_fixed32_{},
+        m_fixed64_{},
+        m_sfixed32_{},
+        m_sfixed64_{},
+        m_bool_{},
+        m_string_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMaps::TestMaps(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMapsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMapsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMapsDefaultTypeInternal() {}
+  union {
+    TestMaps _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMapsDefaultTypeInternal _TestMaps_default_instance_;
+
+inline constexpr TestSubmessageMaps::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        m_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestSubmessageMaps::TestSubmessageMaps(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestSubmessageMapsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestSubmessageMapsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestSubmessageMapsDefaultTypeInternal() {}
+  union {
+    TestSubmessageMaps _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestSubmessageMapsDefaultTypeInternal _TestSubmessageMaps_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[51];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_KnownMapFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_KnownMapFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_KnownMapFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_KnownMapFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.known_map_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_int64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_uint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_int32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_uint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_fixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_fixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_bool_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_sint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_sint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_sfixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMap, _impl_.unknown_map_field_sfixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.known_map_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_int64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_uint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_int32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_uint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_fixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_fixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_bool_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_sint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_sint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_sfixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestEnumMapPlusExtra, _impl_.unknown_map_field_sfixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestImportEnumMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestImportEnumMap, _impl_.import_enum_amp_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestIntIntMap_MEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestIntIntMap_MEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestIntIntMap_MEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestIntIntMap_MEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestIntIntMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestIntIntMap, _impl_.m_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MInt64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MUint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MFixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MSfixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MBoolEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MBoolEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MBoolEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MBoolEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps_MStringEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_int32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_int64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_uint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_uint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_sint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_sint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_fixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_fixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_sfixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_sfixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_bool_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMaps, _impl_.m_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSubmessageMaps, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSubmessageMaps, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSubmessageMaps, _impl_.m_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapBytesEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapBytesEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapBytesEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapBytesEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap_MapStringEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap, _impl_.map_bytes_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestProto2BytesMap, _impl_.map_string_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 10, -1, sizeof(::protobuf_unittest::TestEnumMap_KnownMapFieldEntry_DoNotUse)},
+        {12, 22, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldEntry_DoNotUse)},
+        {24, 34, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse)},
+        {36, 46, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse)},
+        {48, 58, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse)},
+        {60, 70, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse)},
+        {72, 82, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse)},
+        {84, 94, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse)},
+        {96, 106, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse)},
+        {108, 118, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse)},
+        {120, 130, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse)},
+        {132, 142, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse)},
+        {144, 154, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse)},
+        {156, 166, -1, sizeof(::protobuf_unittest::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse)},
+        {168, -1, -1, sizeof(::protobuf_unittest::TestEnumMap)},
+        {190, 200, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse)},
+        {202, 212, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse)},
+        {214, 224, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse)},
+        {226, 236, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse)},
+        {238, 248, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse)},
+        {250, 260, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse)},
+        {262, 272, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse)},
+        {274, 284, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse)},
+        {286, 296, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse)},
+        {298, 308, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse)},
+        {310, 320, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse)},
+        {322, 332, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse)},
+        {334, 344, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse)},
+        {346, 356, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse)},
+        {358, -1, -1, sizeof(::protobuf_unittest::TestEnumMapPlusExtra)},
+        {380, 390, -1, sizeof(::protobuf_unittest::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse)},
+        {392, -1, -1, sizeof(::protobuf_unittest::TestImportEnumMap)},
+        {401, 411, -1, sizeof(::protobuf_unittest::TestIntIntMap_MEntry_DoNotUse)},
+        {413, -1, -1, sizeof(::protobuf_unittest::TestIntIntMap)},
+        {422, 432, -1, sizeof(::protobuf_unittest::TestMaps_MInt32Entry_DoNotUse)},
+        {434, 444, -1, sizeof(::protobuf_unittest::TestMaps_MInt64Entry_DoNotUse)},
+        {446, 456, -1, sizeof(::protobuf_unittest::TestMaps_MUint32Entry_DoNotUse)},
+        {458, 468, -1, sizeof(::protobuf_unittest::TestMaps_MUint64Entry_DoNotUse)},
+        {470, 480, -1, sizeof(::protobuf_unittest::TestMaps_MSint32Entry_DoNotUse)},
+        {482, 492, -1, sizeof(::protobuf_unittest::TestMaps_MSint64Entry_DoNotUse)},
+        {494, 504, -1, sizeof(::protobuf_unittest::TestMaps_MFixed32Entry_DoNotUse)},
+        {506, 516, -1, sizeof(::protobuf_unittest::TestMaps_MFixed64Entry_DoNotUse)},
+        {518, 528, -1, sizeof(::protobuf_unittest::TestMaps_MSfixed32Entry_DoNotUse)},
+        {530, 540, -1, sizeof(::protobuf_unittest::TestMaps_MSfixed64Entry_DoNotUse)},
+        {542, 552, -1, sizeof(::protobuf_unittest::TestMaps_MBoolEntry_DoNotUse)},
+        {554, 564, -1, sizeof(::protobuf_unittest::TestMaps_MStringEntry_DoNotUse)},
+        {566, -1, -1, sizeof(::protobuf_unittest::TestMaps)},
+        {586, 595, -1, sizeof(::protobuf_unittest::TestSubmessageMaps)},
+        {596, 606, -1, sizeof(::protobuf_unittest::TestProto2BytesMap_MapBytesEntry_DoNotUse)},
+        {608, 618, -1, sizeof(::protobuf_unittest::TestProto2BytesMap_MapStringEntry_DoNotUse)},
+        {620, -1, -1, sizeof(::protobuf_unittest::TestProto2BytesMap)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestEnumMap_KnownMapFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldStringEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMap_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestEnumMapPlusExtra_default_instance_._instance,
+    &::protobuf_unittest::_TestImportEnumMap_ImportEnumAmpEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestImportEnumMap_default_instance_._instance,
+    &::protobuf_unittest::_TestIntIntMap_MEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestIntIntMap_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MInt32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MInt64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MUint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MUint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MSint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MSint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MFixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MFixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MSfixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MSfixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MBoolEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_MStringEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMaps_default_instance_._instance,
+    &::protobuf_unittest::_TestSubmessageMaps_default_instance_._instance,
+    &::protobuf_unittest::_TestProto2BytesMap_MapBytesEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestProto2BytesMap_MapStringEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestProto2BytesMap_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n)google/protobuf/map_proto2_unittest.pr"
+    "oto\022\021protobuf_unittest\032%google/protobuf/"
+    "unittest_import.proto\"\311\024\n\013TestEnumMap\022J\n"
+    "\017known_map_field\030e \003(\01321.protobuf_unitte"
+    "st.TestEnumMap.KnownMapFieldEntry\022N\n\021unk"
+    "nown_map_field\030f \003(\01323.protobuf_unittest"
+    ".TestEnumMap.UnknownMapFieldEntry\022Z\n\027unk"
+    "nown_map_field_int64\030\310\001 \003(\01328.protobuf_u"
+    "nittest.TestEnumMap.UnknownMapFieldInt64"
+    "Entry\022\\\n\030unknown_map_field_uint64\030\311\001 \003(\013"
+    "29.protobuf_unittest.TestEnumMap.Unknown"
+    "MapFieldUint64Entry\022Z\n\027unknown_map_field"
+    "_int32\030\312\001 \003(\01328.protobuf_unittest.TestEn"
+    "umMap.UnknownMapFieldInt32Entry\022\\\n\030unkno"
+    "wn_map_field_uint32\030\313\001 \003(\01329.protobuf_un"
+    "ittest.TestEnumMap.UnknownMapFieldUint32"
+    "Entry\022^\n\031unknown_map_field_fixed32\030\314\001 \003("
+    "\0132:.protobuf_unittest.TestEnumMap.Unknow"
+    "nMapFieldFixed32Entry\022^\n\031unknown_map_fie"
+    "ld_fixed64\030\315\001 \003(\0132:.protobuf_unittest.Te"
+    "stEnumMap.UnknownMapFieldFixed64Entry\022X\n"
+    "\026unknown_map_field_bool\030\316\001 \003(\01327.protobu"
+    "f_unittest.TestEnumMap.UnknownMapFieldBo"
+    "olEntry\022\\\n\030unknown_map_field_string\030\317\001 \003"
+    "(\01329.protobuf_unittest.TestEnumMap.Unkno"
+    "wnMapFieldStringEntry\022\\\n\030unknown_map_fie"
+    "ld_sint32\030\320\001 \003(\01329.protobuf_unittest.Tes"
+    "tEnumMap.UnknownMapFieldSint32Entry\022\\\n\030u"
+    "nknown_map_field_sint64\030\321\001 \003(\01329.protobu"
+    "f_unittest.TestEnumMap.UnknownMapFieldSi"
+    "nt64Entry\022`\n\032unknown_map_field_sfixed32\030"
+    "\322\001 \003(\0132;.protobuf_unittest.TestEnumMap.U"
+    "nknownMapFieldSfixed32Entry\022`\n\032unknown_m"
+    "ap_field_sfixed64\030\323\001 \003(\0132;.protobuf_unit"
+    "test.TestEnumMap.UnknownMapFieldSfixed64"
+    "Entry\032V\n\022KnownMapFieldEntry\022\013\n\003key\030\001 \001(\005"
+    "\022/\n\005value\030\002 \001(\0162 .protobuf_unittest.Prot"
+    "o2MapEnum:\0028\001\032X\n\024UnknownMapFieldEntry\022\013\n"
+    "\003key\030\001 \001(\005\022/\n\005value\030\002 \001(\0162 .protobuf_uni"
+    "ttest.Proto2MapEnum:\0028\001\032]\n\031UnknownMapFie"
+    "ldInt64Entry\022\013\n\003key\030\001 \001(\003\022/\n\005value\030\002 \001(\016"
+    "2 .protobuf_unittest.Proto2MapEnum:\0028\001\032^"
+    "\n\032UnknownMapFieldUint64Entry\022\013\n\003key\030\001 \001("
+    "\004\022/\n\005value\030\002 \001(\0162 .protobuf_unittest.Pro"
+    "to2MapEnum:\0028\001\032]\n\031UnknownMapFieldInt32En"
+    "try\022\013\n\003key\030\001 \001(\005\022/\n\005value\030\002 \001(\0162 .protob"
+    "uf_unittest.Proto2MapEnum:\0028\001\032^\n\032Unknown"
+    "MapFieldUint32Entry\022\013\n\003key\030\001 \001(\r\022/\n\005valu"
+    "e\030\002 \001(\0162 .protobuf_unittest.Proto2MapEnu"
+    "m:\0028\001\032_\n\033UnknownMapFieldFixed32Entry\022\013\n\003"
+    "key\030\001 \001(\007\022/\n\005value\030\002 \001(\0162 .protobuf_unit"
+    "test.Proto2MapEnum:\0028\001\032_\n\033UnknownMapFiel"
+    "dFixed64Entry\022\013\n\003key\030\001 \001(\006\022/\n\005value\030\002 \001("
+    "\0162 .protobuf_unittest.Proto2MapEnum:\0028\001\032"
+    "\\\n\030UnknownMapFieldBoolEntry\022\013\n\003key\030\001 \001(\010"
+    "\022/\n\005value\030\002 \001(\0162 .protobuf_unittest.Prot"
+    "o2MapEnum:\0028\001\032^\n\032UnknownMapFieldStringEn"
+    "try\022\013\n\003key\030\001 \001(\t\022/\n\005value\030\002 \001(\0162 .protob"
+    "uf_unittest.Proto2MapEnum:\0028\001\032^\n\032Unknown"
+    "MapFieldSint32Entry\022\013\n\003key\030\001 \001(\021\022/\n\005valu"
+    "e\030\002 \001(\0162 .protobuf_unittest.Proto2MapEnu"
+    "m:\0028\001\032^\n\032UnknownMapFieldSint64Entry\022\013\n\003k"
+    "ey\030\001 \001(\022\022/\n\005value\030\002 \001(\0162 .protobuf_unitt"
+    "est.Proto2MapEnum:\0028\001\032`\n\034UnknownMapField"
+    "Sfixed32Entry\022\013\n\003key\030\001 \001(\017\022/\n\005value\030\002 \001("
+    "\0162 .protobuf_unittest.Proto2MapEnum:\0028\001\032"
+    "`\n\034UnknownMapFieldSfixed64Entry\022\013\n\003key\030\001"
+    " \001(\020\022/\n\005value\030\002 \001(\0162 .protobuf_unittest."
+    "Proto2MapEnum:\0028\001\"\316\026\n\024TestEnumMapPlusExt"
+    "ra\022S\n\017known_map_field\030e \003(\0132:.protobuf_u"
+    "nittest.TestEnumMapPlusExtra.KnownMapFie"
+    "ldEntry\022W\n\021unknown_map_field\030f \003(\0132<.pro"
+    "tobuf_unittest.TestEnumMapPlusExtra.Unkn"
+    "ownMapFieldEntry\022c\n\027unknown_map_field_in"
+    "t64\030\310\001 \003(\0132A.protobuf_unittest.TestEnumM"
+    "apPlusExtra.UnknownMapFieldInt64Entry\022e\n"
+    "\030unknown_map_field_uint64\030\311\001 \003(\0132B.proto"
+    "buf_unittest.TestEnumMapPlusExtra.Unknow"
+    "nMapFieldUint64Entry\022c\n\027unknown_map_fiel"
+    "d_int32\030\312\001 \003(\0132A.protobuf_unittest.TestE"
+    "numMapPlusExtra.UnknownMapFieldInt32Entr"
+    "y\022e\n\030unknown_map_field_uint32\030\313\001 \003(\0132B.p"
+    "rotobuf_unittest.TestEnumMapPlusExtra.Un"
+    "knownMapFieldUint32Entry\022g\n\031unknown_map_"
+    "field_fixed32\030\314\001 \003(\0132C.protobuf_unittest"
+    ".TestEnumMapPlusExtra.UnknownMapFieldFix"
+    "ed32Entry\022g\n\031unknown_map_field_fixed64\030\315"
+    "\001 \003(\0132C.protobuf_unittest.TestEnumMapPlu"
+    "sExtra.UnknownMapFieldFixed64Entry\022a\n\026un"
+    "known_map_field_bool\030\316\001 \003(\0132@.protobuf_u"
+    "nittest.TestEnumMapPlusExtra.UnknownMapF"
+    "ieldBoolEntry\022e\n\030unknown_map_field_strin"
+    "g\030\317\001 \003(\0132B.protobuf_unittest.TestEnumMap"
+    "PlusExtra.UnknownMapFieldStringEntry\022e\n\030"
+    "unknown_map_field_sint32\030\320\001 \003(\0132B.protob"
+    "uf_unittest.TestEnumMapPlusExtra.Unknown"
+    "MapFieldSint32Entry\022e\n\030unknown_map_field"
+    "_sint64\030\321\001 \003(\0132B.protobuf_unittest.TestE"
+    "numMapPlusExtra.UnknownMapFieldSint64Ent"
+    "ry\022i\n\032unknown_map_field_sfixed32\030\322\001 \003(\0132"
+    "D.protobuf_unittest.TestEnumMapPlusExtra"
+    ".UnknownMapFieldSfixed32Entry\022i\n\032unknown"
+    "_map_field_sfixed64\030\323\001 \003(\0132D.protobuf_un"
+    "ittest.TestEnumMapPlusExtra.UnknownMapFi"
+    "eldSfixed64Entry\032_\n\022KnownMapFieldEntry\022\013"
+    "\n\003key\030\001 \001(\005\0228\n\005value\030\002 \001(\0162).protobuf_un"
+    "ittest.Proto2MapEnumPlusExtra:\0028\001\032a\n\024Unk"
+    "nownMapFieldEntry\022\013\n\003key\030\001 \001(\005\0228\n\005value\030"
+    "\002 \001(\0162).protobuf_unittest.Proto2MapEnumP"
+    "lusExtra:\0028\001\032f\n\031UnknownMapFieldInt64Entr"
+    "y\022\013\n\003key\030\001 \001(\003\0228\n\005value\030\002 \001(\0162).protobuf"
+    "_unittest.Proto2MapEnumPlusExtra:\0028\001\032g\n\032"
+    "UnknownMapFieldUint64Entry\022\013\n\003key\030\001 \001(\004\022"
+    "8\n\005value\030\002 \001(\0162).protobuf_unittest.Proto"
+    "2MapEnumPlusExtra:\0028\001\032f\n\031UnknownMapField"
+    "Int32Entry\022\013\n\003key\030\001 \001(\005\0228\n\005value\030\002 \001(\0162)"
+    ".protobuf_unittest.Proto2MapEnumPlusExtr"
+    "a:\0028\001\032g\n\032UnknownMapFieldUint32Entry\022\013\n\003k"
+    "ey\030\001 \001(\r\0228\n\005value\030\002 \001(\0162).protobuf_unitt"
+    "est.Proto2MapEnumPlusExtra:\0028\001\032h\n\033Unknow"
+    "nMapFieldFixed32Entry\022\013\n\003key\030\001 \001(\007\0228\n\005va"
+    "lue\030\002 \001(\0162).protobuf_unittest.Proto2MapE"
+    "numPlusExtra:\0028\001\032h\n\033UnknownMapFieldFixed"
+    "64Entry\022\013\n\003key\030\001 \001(\006\0228\n\005value\030\002 \001(\0162).pr"
+    "otobuf_unittest.Proto2MapEnumPlusExtra:\002"
+    "8\001\032e\n\030UnknownMapFieldBoolEntry\022\013\n\003key\030\001 "
+    "\001(\010\0228\n\005value\030\002 \001(\0162).protobuf_unittest.P"
+    "roto2MapEnumPlusExtra:\0028\001\032g\n\032UnknownMapF"
+    "ieldStringEntry\022\013\n\003key\030\001 \001(\t\0228\n\005value\030\002 "
+    "\001(\0162).protobuf_unittest.Proto2MapEnumPlu"
+    "sExtra:\0028\001\032g\n\032UnknownMapFieldSint32Entry"
+    "\022\013\n\003key\030\001 \001(\021\0228\n\005value\030\002 \001(\0162).protobuf_"
+    "unittest.Proto2MapEnumPlusExtra:\0028\001\032g\n\032U"
+    "nknownMapFieldSint64Entry\022\013\n\003key\030\001 \001(\022\0228"
+    "\n\005value\030\002 \001(\0162).protobuf_unittest.Proto2"
+    "MapEnumPlusExtra:\0028\001\032i\n\034UnknownMapFieldS"
+    "fixed32Entry\022\013\n\003key\030\001 \001(\017\0228\n\005value\030\002 \001(\016"
+    "2).protobuf_unittest.Proto2MapEnumPlusEx"
+    "tra:\0028\001\032i\n\034UnknownMapFieldSfixed64Entry\022"
+    "\013\n\003key\030\001 \001(\020\0228\n\005value\030\002 \001(\0162).protobuf_u"
+    "nittest.Proto2MapEnumPlusExtra:\0028\001\"\307\001\n\021T"
+    "estImportEnumMap\022P\n\017import_enum_amp\030\001 \003("
+    "\01327.protobuf_unittest.TestImportEnumMap."
+    "ImportEnumAmpEntry\032`\n\022ImportEnumAmpEntry"
+    "\022\013\n\003key\030\001 \001(\005\0229\n\005value\030\002 \001(\0162*.protobuf_"
+    "unittest_import.ImportEnumForMap:\0028\001\"m\n\r"
+    "TestIntIntMap\0222\n\001m\030\001 \003(\0132\'.protobuf_unit"
+    "test.TestIntIntMap.MEntry\032(\n\006MEntry\022\013\n\003k"
+    "ey\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\"\270\r\n\010TestMaps"
+    "\0228\n\007m_int32\030\001 \003(\0132\'.protobuf_unittest.Te"
+    "stMaps.MInt32Entry\0228\n\007m_int64\030\002 \003(\0132\'.pr"
+    "otobuf_unittest.TestMaps.MInt64Entry\022:\n\010"
+    "m_uint32\030\003 \003(\0132(.protobuf_unittest.TestM"
+    "aps.MUint32Entry\022:\n\010m_uint64\030\004 \003(\0132(.pro"
+    "tobuf_unittest.TestMaps.MUint64Entry\022:\n\010"
+    "m_sint32\030\005 \003(\0132(.protobuf_unittest.TestM"
+    "aps.MSint32Entry\022:\n\010m_sint64\030\006 \003(\0132(.pro"
+    "tobuf_unittest.TestMaps.MSint64Entry\022<\n\t"
+    "m_fixed32\030\007 \003(\0132).protobuf_unittest.Test"
+    "Maps.MFixed32Entry\022<\n\tm_fixed64\030\010 \003(\0132)."
+    "protobuf_unittest.TestMaps.MFixed64Entry"
+    "\022>\n\nm_sfixed32\030\t \003(\0132*.protobuf_unittest"
+    ".TestMaps.MSfixed32Entry\022>\n\nm_sfixed64\030\n"
+    " \003(\0132*.protobuf_unittest.TestMaps.MSfixe"
+    "d64Entry\0226\n\006m_bool\030\013 \003(\0132&.protobuf_unit"
+    "test.TestMaps.MBoolEntry\022:\n\010m_string\030\014 \003"
+    "(\0132(.protobuf_unittest.TestMaps.MStringE"
+    "ntry\032O\n\013MInt32Entry\022\013\n\003key\030\001 \001(\005\022/\n\005valu"
+    "e\030\002 \001(\0132 .protobuf_unittest.TestIntIntMa"
+    "p:\0028\001\032O\n\013MInt64Entry\022\013\n\003key\030\001 \001(\003\022/\n\005val"
+    "ue\030\002 \001(\0132 .protobuf_unittest.TestIntIntM"
+    "ap:\0028\001\032P\n\014MUint32Entry\022\013\n\003key\030\001 \001(\r\022/\n\005v"
+    "alue\030\002 \001(\0132 .protobuf_unittest.TestIntIn"
+    "tMap:\0028\001\032P\n\014MUint64Entry\022\013\n\003key\030\001 \001(\004\022/\n"
+    "\005value\030\002 \001(\0132 .protobuf_unittest.TestInt"
+    "IntMap:\0028\001\032P\n\014MSint32Entry\022\013\n\003key\030\001 \001(\021\022"
+    "/\n\005value\030\002 \001(\0132 .protobuf_unittest.TestI"
+    "ntIntMap:\0028\001\032P\n\014MSint64Entry\022\013\n\003key\030\001 \001("
+    "\022\022/\n\005value\030\002 \001(\0132 .protobuf_unittest.Tes"
+    "tIntIntMap:\0028\001\032Q\n\rMFixed32Entry\022\013\n\003key\030\001"
+    " \001(\007\022/\n\005value\030\002 \001(\0132 .protobuf_unittest."
+    "TestIntIntMap:\0028\001\032Q\n\rMFixed64Entry\022\013\n\003ke"
+    "y\030\001 \001(\006\022/\n\005value\030\002 \001(\0132 .protobuf_unitte"
+    "st.TestIntIntMap:\0028\001\032R\n\016MSfixed32Entry\022\013"
+    "\n\003key\030\001 \001(\017\022/\n\005value\030\002 \001(\0132 .protobuf_un"
+    "ittest.TestIntIntMap:\0028\001\032R\n\016MSfixed64Ent"
+    "ry\022\013\n\003key\030\001 \001(\020\022/\n\005value\030\002 \001(\0132 .protobu"
+    "f_unittest.TestIntIntMap:\0028\001\032N\n\nMBoolEnt"
+    "ry\022\013\n\003key\030\001 \001(\010\022/\n\005value\030\002 \001(\0132 .protobu"
+    "f_unittest.TestIntIntMap:\0028\001\032P\n\014MStringE"
+    "ntry\022\013\n\003key\030\001 \001(\t\022/\n\005value\030\002 \001(\0132 .proto"
+    "buf_unittest.TestIntIntMap:\0028\001\"<\n\022TestSu"
+    "bmessageMaps\022&\n\001m\030\001 \001(\0132\033.protobuf_unitt"
+    "est.TestMaps\"\211\002\n\022TestProto2BytesMap\022F\n\tm"
+    "ap_bytes\030\001 \003(\01323.protobuf_unittest.TestP"
+    "roto2BytesMap.MapBytesEntry\022H\n\nmap_strin"
+    "g\030\002 \003(\01324.protobuf_unittest.TestProto2By"
+    "tesMap.MapStringEntry\032/\n\rMapBytesEntry\022\013"
+    "\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\014:\0028\001\0320\n\016MapStr"
+    "ingEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\t:\0028\001"
+    "*Z\n\rProto2MapEnum\022\027\n\023PROTO2_MAP_ENUM_FOO"
+    "\020\000\022\027\n\023PROTO2_MAP_ENUM_BAR\020\001\022\027\n\023PROTO2_MA"
+    "P_ENUM_BAZ\020\002*\206\001\n\026Proto2MapEnumPlusExtra\022"
+    "\031\n\025E_PROTO2_MAP_ENUM_FOO\020\000\022\031\n\025E_PROTO2_M"
+    "AP_ENUM_BAR\020\001\022\031\n\025E_PROTO2_MAP_ENUM_BAZ\020\002"
+    "\022\033\n\027E_PROTO2_MAP_ENUM_EXTRA\020\003B\003\370\001\001"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2funittest_5fimport_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto = {
+    false,
+    false,
+    8234,
+    descriptor_table_protodef_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto,
+    "google/protobuf/map_proto2_unittest.proto",
+    &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+    descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_deps,
+    1,
+    51,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto(&descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto);
+namespace protobuf_unittest {
+const ::google::protobuf::EnumDescriptor* Proto2MapEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t Proto2MapEnum_internal_data_[] = {
+    196608u, 0u, };
+bool Proto2MapEnum_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+const ::google::protobuf::EnumDescriptor* Proto2MapEnumPlusExtra_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t Proto2MapEnumPlusExtra_internal_data_[] = {
+    262144u, 0u, };
+bool Proto2MapEnumPlusExtra_IsValid(int value) {
+  return 0 <= value && value <= 3;
+}
+// ===================================================================
+
+TestEnumMap_KnownMapFieldEntry_DoNotUse::TestEnumMap_KnownMapFieldEntry_DoNotUse() {}
+TestEnumMap_KnownMapFieldEntry_DoNotUse::TestEnumMap_KnownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_KnownMapFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[0]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldEntry_DoNotUse::TestEnumMap_UnknownMapFieldEntry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldEntry_DoNotUse::TestEnumMap_UnknownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[1]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse::TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[2]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse::TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[3]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse::TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[4]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse::TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[5]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse::TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[6]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse::TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[7]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse::TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[8]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldStringEntry_DoNotUse::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldStringEntry_DoNotUse::TestEnumMap_UnknownMapFieldStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[9]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse::TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[10]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse::TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[11]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse::TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[12]);
+}
+// ===================================================================
+
+TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse() {}
+TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse::TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[13]);
+}
+// ===================================================================
+
+class TestEnumMap::_Internal {
+ public:
+};
+
+TestEnumMap::TestEnumMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestEnumMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestEnumMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : known_map_field_{visibility, arena, from.known_map_field_},
+        unknown_map_field_{visibility, arena, from.unknown_map_field_},
+        unknown_map_field_int64_{visibility, arena, from.unknown_map_field_int64_},
+        unknown_map_field_uint64_{visibility, arena, from.unknown_map_field_uint64_},
+        unknown_map_field_int32_{visibility, arena, from.unknown_map_field_int32_},
+        unknown_map_field_uint32_{visibility, arena, from.unknown_map_field_uint32_},
+        unknown_map_field_fixed32_{visibility, arena, from.unknown_map_field_fixed32_},
+        unknown_map_field_fixed64_{visibility, arena, from.unknown_map_field_fixed64_},
+        unknown_map_field_bool_{visibility, arena, from.unknown_map_field_bool_},
+        unknown_map_field_string_{visibility, arena, from.unknown_map_field_string_},
+        unknown_map_field_sint32_{visibility, arena, from.unknown_map_field_sint32_},
+        unknown_map_field_sint64_{visibility, arena, from.unknown_map_field_sint64_},
+        unknown_map_field_sfixed32_{visibility, arena, from.unknown_map_field_sfixed32_},
+        unknown_map_field_sfixed64_{visibility, arena, from.unknown_map_field_sfixed64_},
+        _cached_size_{0} {}
+
+TestEnumMap::TestEnumMap(
+    ::google::protobuf::Arena* arena,
+    const TestEnumMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestEnumMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestEnumMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestEnumMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : known_map_field_{visibility, arena},
+        unknown_map_field_{visibility, arena},
+        unknown_map_field_int64_{visibility, arena},
+        unknown_map_field_uint64_{visibility, arena},
+        unknown_map_field_int32_{visibility, arena},
+        unknown_map_field_uint32_{visibility, arena},
+        unknown_map_field_fixed32_{visibility, arena},
+        unknown_map_field_fixed64_{visibility, arena},
+        unknown_map_field_bool_{visibility, arena},
+        unknown_map_field_string_{visibility, arena},
+        unknown_map_field_sint32_{visibility, arena},
+        unknown_map_field_sint64_{visibility, arena},
+        unknown_map_field_sfixed32_{visibility, arena},
+        unknown_map_field_sfixed64_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestEnumMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestEnumMap::~TestEnumMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestEnumMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestEnumMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestEnumMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestEnumMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.known_map_field_.Clear();
+  _impl_.unknown_map_field_.Clear();
+  _impl_.unknown_map_field_int64_.Clear();
+  _impl_.unknown_map_field_uint64_.Clear();
+  _impl_.unknown_map_field_int32_.Clear();
+  _impl_.unknown_map_field_uint32_.Clear();
+  _impl_.unknown_map_field_fixed32_.Clear();
+  _impl_.unknown_map_field_fixed64_.Clear();
+  _impl_.unknown_map_field_bool_.Clear();
+  _impl_.unknown_map_field_string_.Clear();
+  _impl_.unknown_map_field_sint32_.Clear();
+  _impl_.unknown_map_field_sint64_.Clear();
+  _impl_.unknown_map_field_sfixed32_.Clear();
+  _impl_.unknown_map_field_sfixed64_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestEnumMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 14, 28, 70, 12> TestEnumMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    211, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    14,  // num_field_entries
+    28,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestEnumMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    101, 0, 1,
+    65532, 0,200, 0, 1,
+     61440, 2,
+    65535, 65535
+  }}, {{
+    // map<int32, .protobuf_unittest.Proto2MapEnum> known_map_field = 101;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.known_map_field_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field = 102;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int64 = 200;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_int64_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint64 = 201;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_uint64_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int32 = 202;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_int32_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint32 = 203;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_uint32_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed32 = 204;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_fixed32_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed64 = 205;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_fixed64_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<bool, .protobuf_unittest.Proto2MapEnum> unknown_map_field_bool = 206;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_bool_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .protobuf_unittest.Proto2MapEnum> unknown_map_field_string = 207;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_string_), 0, 18,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint32 = 208;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_sint32_), 0, 20,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint64 = 209;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_sint64_), 0, 22,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed32 = 210;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_sfixed32_), 0, 24,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed64 = 211;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMap, _impl_.unknown_map_field_sfixed64_), 0, 26,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.known_map_field_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_int64_)>(
+        0, 1, 1, 3,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_uint64_)>(
+        0, 1, 1, 4,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_int32_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_uint32_)>(
+        0, 1, 1, 13,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_fixed32_)>(
+        0, 1, 1, 7,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_fixed64_)>(
+        0, 1, 1, 6,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_bool_)>(
+        0, 1, 1, 8,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_string_)>(
+        0, 1, 1, 9,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_sint32_)>(
+        0, 1, 1, 17,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_sint64_)>(
+        0, 1, 1, 18,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_sfixed32_)>(
+        0, 1, 1, 15,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMap()._impl_.unknown_map_field_sfixed64_)>(
+        0, 1, 1, 16,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnum_internal_data_},
+  }}, {{
+    "\35\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0"
+    "protobuf_unittest.TestEnumMap"
+    "unknown_map_field_string"
+  }},
+};
+
+::uint8_t* TestEnumMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestEnumMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnum> known_map_field = 101;
+  if (!_internal_known_map_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_known_map_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            101, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            101, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field = 102;
+  if (!_internal_unknown_map_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            102, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            102, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int64 = 200;
+  if (!_internal_unknown_map_field_int64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_int64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            200, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            200, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint64 = 201;
+  if (!_internal_unknown_map_field_uint64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_uint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            201, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            201, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int32 = 202;
+  if (!_internal_unknown_map_field_int32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_int32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            202, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            202, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint32 = 203;
+  if (!_internal_unknown_map_field_uint32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_uint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            203, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            203, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed32 = 204;
+  if (!_internal_unknown_map_field_fixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_fixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            204, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            204, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed64 = 205;
+  if (!_internal_unknown_map_field_fixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_fixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            205, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            205, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<bool, .protobuf_unittest.Proto2MapEnum> unknown_map_field_bool = 206;
+  if (!_internal_unknown_map_field_bool().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_bool();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            206, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            206, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, .protobuf_unittest.Proto2MapEnum> unknown_map_field_string = 207;
+  if (!_internal_unknown_map_field_string().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            207, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestEnumMap.unknown_map_field_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            207, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestEnumMap.unknown_map_field_string");
+      }
+    }
+  }
+
+  // map<sint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint32 = 208;
+  if (!_internal_unknown_map_field_sint32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            208, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            208, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint64 = 209;
+  if (!_internal_unknown_map_field_sint64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            209, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            209, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed32 = 210;
+  if (!_internal_unknown_map_field_sfixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sfixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            210, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            210, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed64 = 211;
+  if (!_internal_unknown_map_field_sfixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sfixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            211, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            211, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestEnumMap)
+  return target;
+}
+
+::size_t TestEnumMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestEnumMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnum> known_map_field = 101;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_known_map_field_size());
+  for (const auto& entry : _internal_known_map_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field = 102;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_size());
+  for (const auto& entry : _internal_unknown_map_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int64 = 200;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_int64_size());
+  for (const auto& entry : _internal_unknown_map_field_int64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint64 = 201;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_uint64_size());
+  for (const auto& entry : _internal_unknown_map_field_uint64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int32 = 202;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_int32_size());
+  for (const auto& entry : _internal_unknown_map_field_int32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint32 = 203;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_uint32_size());
+  for (const auto& entry : _internal_unknown_map_field_uint32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed32 = 204;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_fixed32_size());
+  for (const auto& entry : _internal_unknown_map_field_fixed32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed64 = 205;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_fixed64_size());
+  for (const auto& entry : _internal_unknown_map_field_fixed64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<bool, .protobuf_unittest.Proto2MapEnum> unknown_map_field_bool = 206;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_bool_size());
+  for (const auto& entry : _internal_unknown_map_field_bool()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .protobuf_unittest.Proto2MapEnum> unknown_map_field_string = 207;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_string_size());
+  for (const auto& entry : _internal_unknown_map_field_string()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint32 = 208;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sint32_size());
+  for (const auto& entry : _internal_unknown_map_field_sint32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint64 = 209;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sint64_size());
+  for (const auto& entry : _internal_unknown_map_field_sint64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed32 = 210;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sfixed32_size());
+  for (const auto& entry : _internal_unknown_map_field_sfixed32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed64 = 211;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sfixed64_size());
+  for (const auto& entry : _internal_unknown_map_field_sfixed64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestEnumMap::_class_data_ = {
+    TestEnumMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestEnumMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestEnumMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestEnumMap*>(&to_msg);
+  auto& from = static_cast<const TestEnumMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestEnumMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.known_map_field_.MergeFrom(from._impl_.known_map_field_);
+  _this->_impl_.unknown_map_field_.MergeFrom(from._impl_.unknown_map_field_);
+  _this->_impl_.unknown_map_field_int64_.MergeFrom(from._impl_.unknown_map_field_int64_);
+  _this->_impl_.unknown_map_field_uint64_.MergeFrom(from._impl_.unknown_map_field_uint64_);
+  _this->_impl_.unknown_map_field_int32_.MergeFrom(from._impl_.unknown_map_field_int32_);
+  _this->_impl_.unknown_map_field_uint32_.MergeFrom(from._impl_.unknown_map_field_uint32_);
+  _this->_impl_.unknown_map_field_fixed32_.MergeFrom(from._impl_.unknown_map_field_fixed32_);
+  _this->_impl_.unknown_map_field_fixed64_.MergeFrom(from._impl_.unknown_map_field_fixed64_);
+  _this->_impl_.unknown_map_field_bool_.MergeFrom(from._impl_.unknown_map_field_bool_);
+  _this->_impl_.unknown_map_field_string_.MergeFrom(from._impl_.unknown_map_field_string_);
+  _this->_impl_.unknown_map_field_sint32_.MergeFrom(from._impl_.unknown_map_field_sint32_);
+  _this->_impl_.unknown_map_field_sint64_.MergeFrom(from._impl_.unknown_map_field_sint64_);
+  _this->_impl_.unknown_map_field_sfixed32_.MergeFrom(from._impl_.unknown_map_field_sfixed32_);
+  _this->_impl_.unknown_map_field_sfixed64_.MergeFrom(from._impl_.unknown_map_field_sfixed64_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestEnumMap::CopyFrom(const TestEnumMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestEnumMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestEnumMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestEnumMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestEnumMap::InternalSwap(TestEnumMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.known_map_field_.InternalSwap(&other->_impl_.known_map_field_);
+  _impl_.unknown_map_field_.InternalSwap(&other->_impl_.unknown_map_field_);
+  _impl_.unknown_map_field_int64_.InternalSwap(&other->_impl_.unknown_map_field_int64_);
+  _impl_.unknown_map_field_uint64_.InternalSwap(&other->_impl_.unknown_map_field_uint64_);
+  _impl_.unknown_map_field_int32_.InternalSwap(&other->_impl_.unknown_map_field_int32_);
+  _impl_.unknown_map_field_uint32_.InternalSwap(&other->_impl_.unknown_map_field_uint32_);
+  _impl_.unknown_map_field_fixed32_.InternalSwap(&other->_impl_.unknown_map_field_fixed32_);
+  _impl_.unknown_map_field_fixed64_.InternalSwap(&other->_impl_.unknown_map_field_fixed64_);
+  _impl_.unknown_map_field_bool_.InternalSwap(&other->_impl_.unknown_map_field_bool_);
+  _impl_.unknown_map_field_string_.InternalSwap(&other->_impl_.unknown_map_field_string_);
+  _impl_.unknown_map_field_sint32_.InternalSwap(&other->_impl_.unknown_map_field_sint32_);
+  _impl_.unknown_map_field_sint64_.InternalSwap(&other->_impl_.unknown_map_field_sint64_);
+  _impl_.unknown_map_field_sfixed32_.InternalSwap(&other->_impl_.unknown_map_field_sfixed32_);
+  _impl_.unknown_map_field_sfixed64_.InternalSwap(&other->_impl_.unknown_map_field_sfixed64_);
+}
+
+::google::protobuf::Metadata TestEnumMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[14]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse() {}
+TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse::TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[15]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[16]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[17]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[18]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[19]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[20]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[21]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[22]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[23]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[24]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[25]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[26]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[27]);
+}
+// ===================================================================
+
+TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse() {}
+TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse::TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[28]);
+}
+// ===================================================================
+
+class TestEnumMapPlusExtra::_Internal {
+ public:
+};
+
+TestEnumMapPlusExtra::TestEnumMapPlusExtra(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestEnumMapPlusExtra)
+}
+inline PROTOBUF_NDEBUG_INLINE TestEnumMapPlusExtra::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : known_map_field_{visibility, arena, from.known_map_field_},
+        unknown_map_field_{visibility, arena, from.unknown_map_field_},
+        unknown_map_field_int64_{visibility, arena, from.unknown_map_field_int64_},
+        unknown_map_field_uint64_{visibility, arena, from.unknown_map_field_uint64_},
+        unknown_map_field_int32_{visibility, arena, from.unknown_map_field_int32_},
+        unknown_map_field_uint32_{visibility, arena, from.unknown_map_field_uint32_},
+        unknown_map_field_fixed32_{visibility, arena, from.unknown_map_field_fixed32_},
+        unknown_map_field_fixed64_{visibility, arena, from.unknown_map_field_fixed64_},
+        unknown_map_field_bool_{visibility, arena, from.unknown_map_field_bool_},
+        unknown_map_field_string_{visibility, arena, from.unknown_map_field_string_},
+        unknown_map_field_sint32_{visibility, arena, from.unknown_map_field_sint32_},
+        unknown_map_field_sint64_{visibility, arena, from.unknown_map_field_sint64_},
+        unknown_map_field_sfixed32_{visibility, arena, from.unknown_map_field_sfixed32_},
+        unknown_map_field_sfixed64_{visibility, arena, from.unknown_map_field_sfixed64_},
+        _cached_size_{0} {}
+
+TestEnumMapPlusExtra::TestEnumMapPlusExtra(
+    ::google::protobuf::Arena* arena,
+    const TestEnumMapPlusExtra& from)
+    : ::google::protobuf::Message(arena) {
+  TestEnumMapPlusExtra* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestEnumMapPlusExtra)
+}
+inline PROTOBUF_NDEBUG_INLINE TestEnumMapPlusExtra::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : known_map_field_{visibility, arena},
+        unknown_map_field_{visibility, arena},
+        unknown_map_field_int64_{visibility, arena},
+        unknown_map_field_uint64_{visibility, arena},
+        unknown_map_field_int32_{visibility, arena},
+        unknown_map_field_uint32_{visibility, arena},
+        unknown_map_field_fixed32_{visibility, arena},
+        unknown_map_field_fixed64_{visibility, arena},
+        unknown_map_field_bool_{visibility, arena},
+        unknown_map_field_string_{visibility, arena},
+        unknown_map_field_sint32_{visibility, arena},
+        unknown_map_field_sint64_{visibility, arena},
+        unknown_map_field_sfixed32_{visibility, arena},
+        unknown_map_field_sfixed64_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestEnumMapPlusExtra::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestEnumMapPlusExtra::~TestEnumMapPlusExtra() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestEnumMapPlusExtra)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestEnumMapPlusExtra::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestEnumMapPlusExtra::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestEnumMapPlusExtra)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.known_map_field_.Clear();
+  _impl_.unknown_map_field_.Clear();
+  _impl_.unknown_map_field_int64_.Clear();
+  _impl_.unknown_map_field_uint64_.Clear();
+  _impl_.unknown_map_field_int32_.Clear();
+  _impl_.unknown_map_field_uint32_.Clear();
+  _impl_.unknown_map_field_fixed32_.Clear();
+  _impl_.unknown_map_field_fixed64_.Clear();
+  _impl_.unknown_map_field_bool_.Clear();
+  _impl_.unknown_map_field_string_.Clear();
+  _impl_.unknown_map_field_sint32_.Clear();
+  _impl_.unknown_map_field_sint64_.Clear();
+  _impl_.unknown_map_field_sfixed32_.Clear();
+  _impl_.unknown_map_field_sfixed64_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestEnumMapPlusExtra::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 14, 28, 79, 12> TestEnumMapPlusExtra::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    211, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    14,  // num_field_entries
+    28,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestEnumMapPlusExtra_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    101, 0, 1,
+    65532, 0,200, 0, 1,
+     61440, 2,
+    65535, 65535
+  }}, {{
+    // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> known_map_field = 101;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.known_map_field_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field = 102;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int64 = 200;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_int64_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint64 = 201;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_uint64_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int32 = 202;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_int32_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint32 = 203;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_uint32_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed32 = 204;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_fixed32_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed64 = 205;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_fixed64_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<bool, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_bool = 206;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_bool_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_string = 207;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_string_), 0, 18,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint32 = 208;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_sint32_), 0, 20,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint64 = 209;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_sint64_), 0, 22,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed32 = 210;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_sfixed32_), 0, 24,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed64 = 211;
+    {PROTOBUF_FIELD_OFFSET(TestEnumMapPlusExtra, _impl_.unknown_map_field_sfixed64_), 0, 26,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.known_map_field_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_int64_)>(
+        0, 1, 1, 3,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_uint64_)>(
+        0, 1, 1, 4,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_int32_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_uint32_)>(
+        0, 1, 1, 13,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_fixed32_)>(
+        0, 1, 1, 7,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_fixed64_)>(
+        0, 1, 1, 6,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_bool_)>(
+        0, 1, 1, 8,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_string_)>(
+        0, 1, 1, 9,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_sint32_)>(
+        0, 1, 1, 17,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_sint64_)>(
+        0, 1, 1, 18,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_sfixed32_)>(
+        0, 1, 1, 15,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestEnumMapPlusExtra()._impl_.unknown_map_field_sfixed64_)>(
+        0, 1, 1, 16,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest::Proto2MapEnumPlusExtra_internal_data_},
+  }}, {{
+    "\46\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0"
+    "protobuf_unittest.TestEnumMapPlusExtra"
+    "unknown_map_field_string"
+  }},
+};
+
+::uint8_t* TestEnumMapPlusExtra::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestEnumMapPlusExtra)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> known_map_field = 101;
+  if (!_internal_known_map_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_known_map_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            101, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            101, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field = 102;
+  if (!_internal_unknown_map_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            102, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            102, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int64 = 200;
+  if (!_internal_unknown_map_field_int64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_int64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            200, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            200, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint64 = 201;
+  if (!_internal_unknown_map_field_uint64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_uint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            201, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            201, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int32 = 202;
+  if (!_internal_unknown_map_field_int32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_int32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            202, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            202, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint32 = 203;
+  if (!_internal_unknown_map_field_uint32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_uint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            203, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            203, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed32 = 204;
+  if (!_internal_unknown_map_field_fixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_fixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            204, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            204, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed64 = 205;
+  if (!_internal_unknown_map_field_fixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_fixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            205, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            205, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<bool, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_bool = 206;
+  if (!_internal_unknown_map_field_bool().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_bool();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            206, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            206, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_string = 207;
+  if (!_internal_unknown_map_field_string().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            207, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            207, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_string");
+      }
+    }
+  }
+
+  // map<sint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint32 = 208;
+  if (!_internal_unknown_map_field_sint32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            208, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            208, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint64 = 209;
+  if (!_internal_unknown_map_field_sint64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            209, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            209, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed32 = 210;
+  if (!_internal_unknown_map_field_sfixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sfixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            210, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            210, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed64 = 211;
+  if (!_internal_unknown_map_field_sfixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_unknown_map_field_sfixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            211, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            211, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestEnumMapPlusExtra)
+  return target;
+}
+
+::size_t TestEnumMapPlusExtra::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestEnumMapPlusExtra)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> known_map_field = 101;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_known_map_field_size());
+  for (const auto& entry : _internal_known_map_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field = 102;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_size());
+  for (const auto& entry : _internal_unknown_map_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int64 = 200;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_int64_size());
+  for (const auto& entry : _internal_unknown_map_field_int64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint64 = 201;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_uint64_size());
+  for (const auto& entry : _internal_unknown_map_field_uint64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int32 = 202;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_int32_size());
+  for (const auto& entry : _internal_unknown_map_field_int32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint32 = 203;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_uint32_size());
+  for (const auto& entry : _internal_unknown_map_field_uint32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed32 = 204;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_fixed32_size());
+  for (const auto& entry : _internal_unknown_map_field_fixed32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed64 = 205;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_fixed64_size());
+  for (const auto& entry : _internal_unknown_map_field_fixed64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<bool, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_bool = 206;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_bool_size());
+  for (const auto& entry : _internal_unknown_map_field_bool()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_string = 207;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_string_size());
+  for (const auto& entry : _internal_unknown_map_field_string()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint32 = 208;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sint32_size());
+  for (const auto& entry : _internal_unknown_map_field_sint32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint64 = 209;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sint64_size());
+  for (const auto& entry : _internal_unknown_map_field_sint64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed32 = 210;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sfixed32_size());
+  for (const auto& entry : _internal_unknown_map_field_sfixed32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed64 = 211;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_unknown_map_field_sfixed64_size());
+  for (const auto& entry : _internal_unknown_map_field_sfixed64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestEnumMapPlusExtra::_class_data_ = {
+    TestEnumMapPlusExtra::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestEnumMapPlusExtra::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestEnumMapPlusExtra::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestEnumMapPlusExtra*>(&to_msg);
+  auto& from = static_cast<const TestEnumMapPlusExtra&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestEnumMapPlusExtra)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.known_map_field_.MergeFrom(from._impl_.known_map_field_);
+  _this->_impl_.unknown_map_field_.MergeFrom(from._impl_.unknown_map_field_);
+  _this->_impl_.unknown_map_field_int64_.MergeFrom(from._impl_.unknown_map_field_int64_);
+  _this->_impl_.unknown_map_field_uint64_.MergeFrom(from._impl_.unknown_map_field_uint64_);
+  _this->_impl_.unknown_map_field_int32_.MergeFrom(from._impl_.unknown_map_field_int32_);
+  _this->_impl_.unknown_map_field_uint32_.MergeFrom(from._impl_.unknown_map_field_uint32_);
+  _this->_impl_.unknown_map_field_fixed32_.MergeFrom(from._impl_.unknown_map_field_fixed32_);
+  _this->_impl_.unknown_map_field_fixed64_.MergeFrom(from._impl_.unknown_map_field_fixed64_);
+  _this->_impl_.unknown_map_field_bool_.MergeFrom(from._impl_.unknown_map_field_bool_);
+  _this->_impl_.unknown_map_field_string_.MergeFrom(from._impl_.unknown_map_field_string_);
+  _this->_impl_.unknown_map_field_sint32_.MergeFrom(from._impl_.unknown_map_field_sint32_);
+  _this->_impl_.unknown_map_field_sint64_.MergeFrom(from._impl_.unknown_map_field_sint64_);
+  _this->_impl_.unknown_map_field_sfixed32_.MergeFrom(from._impl_.unknown_map_field_sfixed32_);
+  _this->_impl_.unknown_map_field_sfixed64_.MergeFrom(from._impl_.unknown_map_field_sfixed64_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestEnumMapPlusExtra::CopyFrom(const TestEnumMapPlusExtra& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestEnumMapPlusExtra)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestEnumMapPlusExtra::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestEnumMapPlusExtra::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestEnumMapPlusExtra::InternalSwap(TestEnumMapPlusExtra* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.known_map_field_.InternalSwap(&other->_impl_.known_map_field_);
+  _impl_.unknown_map_field_.InternalSwap(&other->_impl_.unknown_map_field_);
+  _impl_.unknown_map_field_int64_.InternalSwap(&other->_impl_.unknown_map_field_int64_);
+  _impl_.unknown_map_field_uint64_.InternalSwap(&other->_impl_.unknown_map_field_uint64_);
+  _impl_.unknown_map_field_int32_.InternalSwap(&other->_impl_.unknown_map_field_int32_);
+  _impl_.unknown_map_field_uint32_.InternalSwap(&other->_impl_.unknown_map_field_uint32_);
+  _impl_.unknown_map_field_fixed32_.InternalSwap(&other->_impl_.unknown_map_field_fixed32_);
+  _impl_.unknown_map_field_fixed64_.InternalSwap(&other->_impl_.unknown_map_field_fixed64_);
+  _impl_.unknown_map_field_bool_.InternalSwap(&other->_impl_.unknown_map_field_bool_);
+  _impl_.unknown_map_field_string_.InternalSwap(&other->_impl_.unknown_map_field_string_);
+  _impl_.unknown_map_field_sint32_.InternalSwap(&other->_impl_.unknown_map_field_sint32_);
+  _impl_.unknown_map_field_sint64_.InternalSwap(&other->_impl_.unknown_map_field_sint64_);
+  _impl_.unknown_map_field_sfixed32_.InternalSwap(&other->_impl_.unknown_map_field_sfixed32_);
+  _impl_.unknown_map_field_sfixed64_.InternalSwap(&other->_impl_.unknown_map_field_sfixed64_);
+}
+
+::google::protobuf::Metadata TestEnumMapPlusExtra::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[29]);
+}
+// ===================================================================
+
+TestImportEnumMap_ImportEnumAmpEntry_DoNotUse::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse() {}
+TestImportEnumMap_ImportEnumAmpEntry_DoNotUse::TestImportEnumMap_ImportEnumAmpEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestImportEnumMap_ImportEnumAmpEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[30]);
+}
+// ===================================================================
+
+class TestImportEnumMap::_Internal {
+ public:
+};
+
+TestImportEnumMap::TestImportEnumMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestImportEnumMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestImportEnumMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : import_enum_amp_{visibility, arena, from.import_enum_amp_},
+        _cached_size_{0} {}
+
+TestImportEnumMap::TestImportEnumMap(
+    ::google::protobuf::Arena* arena,
+    const TestImportEnumMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestImportEnumMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestImportEnumMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestImportEnumMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : import_enum_amp_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestImportEnumMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestImportEnumMap::~TestImportEnumMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestImportEnumMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestImportEnumMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestImportEnumMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestImportEnumMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.import_enum_amp_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestImportEnumMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 0, 2> TestImportEnumMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestImportEnumMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, .protobuf_unittest_import.ImportEnumForMap> import_enum_amp = 1;
+    {PROTOBUF_FIELD_OFFSET(TestImportEnumMap, _impl_.import_enum_amp_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestImportEnumMap()._impl_.import_enum_amp_)>(
+        0, 1, 1, 5,
+        14)},
+    {::_pbi::FieldAuxEnumData{}, ::protobuf_unittest_import::ImportEnumForMap_internal_data_},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestImportEnumMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestImportEnumMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .protobuf_unittest_import.ImportEnumForMap> import_enum_amp = 1;
+  if (!_internal_import_enum_amp().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest_import::ImportEnumForMap,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_import_enum_amp();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestImportEnumMap)
+  return target;
+}
+
+::size_t TestImportEnumMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestImportEnumMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest_import.ImportEnumForMap> import_enum_amp = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_import_enum_amp_size());
+  for (const auto& entry : _internal_import_enum_amp()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest_import::ImportEnumForMap,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestImportEnumMap::_class_data_ = {
+    TestImportEnumMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestImportEnumMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestImportEnumMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestImportEnumMap*>(&to_msg);
+  auto& from = static_cast<const TestImportEnumMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestImportEnumMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.import_enum_amp_.MergeFrom(from._impl_.import_enum_amp_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestImportEnumMap::CopyFrom(const TestImportEnumMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestImportEnumMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestImportEnumMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestImportEnumMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestImportEnumMap::InternalSwap(TestImportEnumMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.import_enum_amp_.InternalSwap(&other->_impl_.import_enum_amp_);
+}
+
+::google::protobuf::Metadata TestImportEnumMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[31]);
+}
+// ===================================================================
+
+TestIntIntMap_MEntry_DoNotUse::TestIntIntMap_MEntry_DoNotUse() {}
+TestIntIntMap_MEntry_DoNotUse::TestIntIntMap_MEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestIntIntMap_MEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[32]);
+}
+// ===================================================================
+
+class TestIntIntMap::_Internal {
+ public:
+};
+
+TestIntIntMap::TestIntIntMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestIntIntMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestIntIntMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : m_{visibility, arena, from.m_},
+        _cached_size_{0} {}
+
+TestIntIntMap::TestIntIntMap(
+    ::google::protobuf::Arena* arena,
+    const TestIntIntMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestIntIntMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestIntIntMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestIntIntMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : m_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestIntIntMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestIntIntMap::~TestIntIntMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestIntIntMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestIntIntMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestIntIntMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestIntIntMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.m_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestIntIntMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestIntIntMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestIntIntMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, int32> m = 1;
+    {PROTOBUF_FIELD_OFFSET(TestIntIntMap, _impl_.m_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestIntIntMap()._impl_.m_)>(
+        0, 1, 0, 5,
+        5)},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestIntIntMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestIntIntMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, int32> m = 1;
+  if (!_internal_m().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_m();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestIntIntMap)
+  return target;
+}
+
+::size_t TestIntIntMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestIntIntMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> m = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_size());
+  for (const auto& entry : _internal_m()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestIntIntMap::_class_data_ = {
+    TestIntIntMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestIntIntMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestIntIntMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestIntIntMap*>(&to_msg);
+  auto& from = static_cast<const TestIntIntMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestIntIntMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.m_.MergeFrom(from._impl_.m_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestIntIntMap::CopyFrom(const TestIntIntMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestIntIntMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestIntIntMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestIntIntMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestIntIntMap::InternalSwap(TestIntIntMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.m_.InternalSwap(&other->_impl_.m_);
+}
+
+::google::protobuf::Metadata TestIntIntMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[33]);
+}
+// ===================================================================
+
+TestMaps_MInt32Entry_DoNotUse::TestMaps_MInt32Entry_DoNotUse() {}
+TestMaps_MInt32Entry_DoNotUse::TestMaps_MInt32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MInt32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[34]);
+}
+// ===================================================================
+
+TestMaps_MInt64Entry_DoNotUse::TestMaps_MInt64Entry_DoNotUse() {}
+TestMaps_MInt64Entry_DoNotUse::TestMaps_MInt64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MInt64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[35]);
+}
+// ===================================================================
+
+TestMaps_MUint32Entry_DoNotUse::TestMaps_MUint32Entry_DoNotUse() {}
+TestMaps_MUint32Entry_DoNotUse::TestMaps_MUint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MUint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[36]);
+}
+// ===================================================================
+
+TestMaps_MUint64Entry_DoNotUse::TestMaps_MUint64Entry_DoNotUse() {}
+TestMaps_MUint64Entry_DoNotUse::TestMaps_MUint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MUint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[37]);
+}
+// ===================================================================
+
+TestMaps_MSint32Entry_DoNotUse::TestMaps_MSint32Entry_DoNotUse() {}
+TestMaps_MSint32Entry_DoNotUse::TestMaps_MSint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MSint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[38]);
+}
+// ===================================================================
+
+TestMaps_MSint64Entry_DoNotUse::TestMaps_MSint64Entry_DoNotUse() {}
+TestMaps_MSint64Entry_DoNotUse::TestMaps_MSint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MSint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[39]);
+}
+// ===================================================================
+
+TestMaps_MFixed32Entry_DoNotUse::TestMaps_MFixed32Entry_DoNotUse() {}
+TestMaps_MFixed32Entry_DoNotUse::TestMaps_MFixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MFixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[40]);
+}
+// ===================================================================
+
+TestMaps_MFixed64Entry_DoNotUse::TestMaps_MFixed64Entry_DoNotUse() {}
+TestMaps_MFixed64Entry_DoNotUse::TestMaps_MFixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MFixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[41]);
+}
+// ===================================================================
+
+TestMaps_MSfixed32Entry_DoNotUse::TestMaps_MSfixed32Entry_DoNotUse() {}
+TestMaps_MSfixed32Entry_DoNotUse::TestMaps_MSfixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MSfixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[42]);
+}
+// ===================================================================
+
+TestMaps_MSfixed64Entry_DoNotUse::TestMaps_MSfixed64Entry_DoNotUse() {}
+TestMaps_MSfixed64Entry_DoNotUse::TestMaps_MSfixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MSfixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[43]);
+}
+// ===================================================================
+
+TestMaps_MBoolEntry_DoNotUse::TestMaps_MBoolEntry_DoNotUse() {}
+TestMaps_MBoolEntry_DoNotUse::TestMaps_MBoolEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MBoolEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[44]);
+}
+// ===================================================================
+
+TestMaps_MStringEntry_DoNotUse::TestMaps_MStringEntry_DoNotUse() {}
+TestMaps_MStringEntry_DoNotUse::TestMaps_MStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMaps_MStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[45]);
+}
+// ===================================================================
+
+class TestMaps::_Internal {
+ public:
+};
+
+TestMaps::TestMaps(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMaps)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMaps::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : m_int32_{visibility, arena, from.m_int32_},
+        m_int64_{visibility, arena, from.m_int64_},
+        m_uint32_{visibility, arena, from.m_uint32_},
+        m_uint64_{visibility, arena, from.m_uint64_},
+        m_sint32_{visibility, arena, from.m_sint32_},
+        m_sint64_{visibility, arena, from.m_sint64_},
+        m_fixed32_{visibility, arena, from.m_fixed32_},
+        m_fixed64_{visibility, arena, from.m_fixed64_},
+        m_sfixed32_{visibility, arena, from.m_sfixed32_},
+        m_sfixed64_{visibility, arena, from.m_sfixed64_},
+        m_bool_{visibility, arena, from.m_bool_},
+        m_string_{visibility, arena, from.m_string_},
+        _cached_size_{0} {}
+
+TestMaps::TestMaps(
+    ::google::protobuf::Arena* arena,
+    const TestMaps& from)
+    : ::google::protobuf::Message(arena) {
+  TestMaps* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMaps)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMaps::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : m_int32_{visibility, arena},
+        m_int64_{visibility, arena},
+        m_uint32_{visibility, arena},
+        m_uint64_{visibility, arena},
+        m_sint32_{visibility, arena},
+        m_sint64_{visibility, arena},
+        m_fixed32_{visibility, arena},
+        m_fixed64_{visibility, arena},
+        m_sfixed32_{visibility, arena},
+        m_sfixed64_{visibility, arena},
+        m_bool_{visibility, arena},
+        m_string_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestMaps::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMaps::~TestMaps() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMaps)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMaps::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMaps::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMaps)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.m_int32_.Clear();
+  _impl_.m_int64_.Clear();
+  _impl_.m_uint32_.Clear();
+  _impl_.m_uint64_.Clear();
+  _impl_.m_sint32_.Clear();
+  _impl_.m_sint64_.Clear();
+  _impl_.m_fixed32_.Clear();
+  _impl_.m_fixed64_.Clear();
+  _impl_.m_sfixed32_.Clear();
+  _impl_.m_sfixed64_.Clear();
+  _impl_.m_bool_.Clear();
+  _impl_.m_string_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMaps::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 12, 24, 51, 2> TestMaps::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    12, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294963200,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    12,  // num_field_entries
+    24,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMaps_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, .protobuf_unittest.TestIntIntMap> m_int32 = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_int32_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, .protobuf_unittest.TestIntIntMap> m_int64 = 2;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_int64_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, .protobuf_unittest.TestIntIntMap> m_uint32 = 3;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_uint32_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, .protobuf_unittest.TestIntIntMap> m_uint64 = 4;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_uint64_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint32, .protobuf_unittest.TestIntIntMap> m_sint32 = 5;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_sint32_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint64, .protobuf_unittest.TestIntIntMap> m_sint64 = 6;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_sint64_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed32, .protobuf_unittest.TestIntIntMap> m_fixed32 = 7;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_fixed32_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed64, .protobuf_unittest.TestIntIntMap> m_fixed64 = 8;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_fixed64_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed32, .protobuf_unittest.TestIntIntMap> m_sfixed32 = 9;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_sfixed32_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed64, .protobuf_unittest.TestIntIntMap> m_sfixed64 = 10;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_sfixed64_), 0, 18,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<bool, .protobuf_unittest.TestIntIntMap> m_bool = 11;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_bool_), 0, 20,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .protobuf_unittest.TestIntIntMap> m_string = 12;
+    {PROTOBUF_FIELD_OFFSET(TestMaps, _impl_.m_string_), 0, 22,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_int32_)>(
+        0, 1, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_int64_)>(
+        0, 1, 0, 3,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_uint32_)>(
+        0, 1, 0, 13,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_uint64_)>(
+        0, 1, 0, 4,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_sint32_)>(
+        0, 1, 0, 17,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_sint64_)>(
+        0, 1, 0, 18,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_fixed32_)>(
+        0, 1, 0, 7,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_fixed64_)>(
+        0, 1, 0, 6,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_sfixed32_)>(
+        0, 1, 0, 15,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_sfixed64_)>(
+        0, 1, 0, 16,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_bool_)>(
+        0, 1, 0, 8,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMaps()._impl_.m_string_)>(
+        0, 1, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestIntIntMap>},
+  }}, {{
+    "\32\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0"
+    "protobuf_unittest.TestMaps"
+    "m_string"
+  }},
+};
+
+::uint8_t* TestMaps::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMaps)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestIntIntMap> m_int32 = 1;
+  if (!_internal_m_int32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_int32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, .protobuf_unittest.TestIntIntMap> m_int64 = 2;
+  if (!_internal_m_int64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_int64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .protobuf_unittest.TestIntIntMap> m_uint32 = 3;
+  if (!_internal_m_uint32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_uint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, .protobuf_unittest.TestIntIntMap> m_uint64 = 4;
+  if (!_internal_m_uint64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_uint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint32, .protobuf_unittest.TestIntIntMap> m_sint32 = 5;
+  if (!_internal_m_sint32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_sint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint64, .protobuf_unittest.TestIntIntMap> m_sint64 = 6;
+  if (!_internal_m_sint64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_sint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed32, .protobuf_unittest.TestIntIntMap> m_fixed32 = 7;
+  if (!_internal_m_fixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_fixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed64, .protobuf_unittest.TestIntIntMap> m_fixed64 = 8;
+  if (!_internal_m_fixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_fixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed32, .protobuf_unittest.TestIntIntMap> m_sfixed32 = 9;
+  if (!_internal_m_sfixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_sfixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed64, .protobuf_unittest.TestIntIntMap> m_sfixed64 = 10;
+  if (!_internal_m_sfixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_sfixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<bool, .protobuf_unittest.TestIntIntMap> m_bool = 11;
+  if (!_internal_m_bool().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_bool();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, .protobuf_unittest.TestIntIntMap> m_string = 12;
+  if (!_internal_m_string().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_m_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestMaps.m_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestMaps.m_string");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMaps)
+  return target;
+}
+
+::size_t TestMaps::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMaps)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestIntIntMap> m_int32 = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_int32_size());
+  for (const auto& entry : _internal_m_int32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, .protobuf_unittest.TestIntIntMap> m_int64 = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_int64_size());
+  for (const auto& entry : _internal_m_int64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, .protobuf_unittest.TestIntIntMap> m_uint32 = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_uint32_size());
+  for (const auto& entry : _internal_m_uint32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, .protobuf_unittest.TestIntIntMap> m_uint64 = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_uint64_size());
+  for (const auto& entry : _internal_m_uint64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint32, .protobuf_unittest.TestIntIntMap> m_sint32 = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_sint32_size());
+  for (const auto& entry : _internal_m_sint32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint64, .protobuf_unittest.TestIntIntMap> m_sint64 = 6;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_sint64_size());
+  for (const auto& entry : _internal_m_sint64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed32, .protobuf_unittest.TestIntIntMap> m_fixed32 = 7;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_fixed32_size());
+  for (const auto& entry : _internal_m_fixed32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed64, .protobuf_unittest.TestIntIntMap> m_fixed64 = 8;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_fixed64_size());
+  for (const auto& entry : _internal_m_fixed64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed32, .protobuf_unittest.TestIntIntMap> m_sfixed32 = 9;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_sfixed32_size());
+  for (const auto& entry : _internal_m_sfixed32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed64, .protobuf_unittest.TestIntIntMap> m_sfixed64 = 10;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_sfixed64_size());
+  for (const auto& entry : _internal_m_sfixed64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<bool, .protobuf_unittest.TestIntIntMap> m_bool = 11;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_bool_size());
+  for (const auto& entry : _internal_m_bool()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .protobuf_unittest.TestIntIntMap> m_string = 12;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_m_string_size());
+  for (const auto& entry : _internal_m_string()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::TestIntIntMap,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMaps::_class_data_ = {
+    TestMaps::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMaps::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMaps::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMaps*>(&to_msg);
+  auto& from = static_cast<const TestMaps&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMaps)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.m_int32_.MergeFrom(from._impl_.m_int32_);
+  _this->_impl_.m_int64_.MergeFrom(from._impl_.m_int64_);
+  _this->_impl_.m_uint32_.MergeFrom(from._impl_.m_uint32_);
+  _this->_impl_.m_uint64_.MergeFrom(from._impl_.m_uint64_);
+  _this->_impl_.m_sint32_.MergeFrom(from._impl_.m_sint32_);
+  _this->_impl_.m_sint64_.MergeFrom(from._impl_.m_sint64_);
+  _this->_impl_.m_fixed32_.MergeFrom(from._impl_.m_fixed32_);
+  _this->_impl_.m_fixed64_.MergeFrom(from._impl_.m_fixed64_);
+  _this->_impl_.m_sfixed32_.MergeFrom(from._impl_.m_sfixed32_);
+  _this->_impl_.m_sfixed64_.MergeFrom(from._impl_.m_sfixed64_);
+  _this->_impl_.m_bool_.MergeFrom(from._impl_.m_bool_);
+  _this->_impl_.m_string_.MergeFrom(from._impl_.m_string_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMaps::CopyFrom(const TestMaps& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMaps)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMaps::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMaps::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMaps::InternalSwap(TestMaps* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.m_int32_.InternalSwap(&other->_impl_.m_int32_);
+  _impl_.m_int64_.InternalSwap(&other->_impl_.m_int64_);
+  _impl_.m_uint32_.InternalSwap(&other->_impl_.m_uint32_);
+  _impl_.m_uint64_.InternalSwap(&other->_impl_.m_uint64_);
+  _impl_.m_sint32_.InternalSwap(&other->_impl_.m_sint32_);
+  _impl_.m_sint64_.InternalSwap(&other->_impl_.m_sint64_);
+  _impl_.m_fixed32_.InternalSwap(&other->_impl_.m_fixed32_);
+  _impl_.m_fixed64_.InternalSwap(&other->_impl_.m_fixed64_);
+  _impl_.m_sfixed32_.InternalSwap(&other->_impl_.m_sfixed32_);
+  _impl_.m_sfixed64_.InternalSwap(&other->_impl_.m_sfixed64_);
+  _impl_.m_bool_.InternalSwap(&other->_impl_.m_bool_);
+  _impl_.m_string_.InternalSwap(&other->_impl_.m_string_);
+}
+
+::google::protobuf::Metadata TestMaps::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[46]);
+}
+// ===================================================================
+
+class TestSubmessageMaps::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestSubmessageMaps>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestSubmessageMaps, _impl_._has_bits_);
+  static const ::protobuf_unittest::TestMaps& m(const TestSubmessageMaps* msg);
+  static void set_has_m(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestMaps& TestSubmessageMaps::_Internal::m(const TestSubmessageMaps* msg) {
+  return *msg->_impl_.m_;
+}
+TestSubmessageMaps::TestSubmessageMaps(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestSubmessageMaps)
+}
+inline PROTOBUF_NDEBUG_INLINE TestSubmessageMaps::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestSubmessageMaps::TestSubmessageMaps(
+    ::google::protobuf::Arena* arena,
+    const TestSubmessageMaps& from)
+    : ::google::protobuf::Message(arena) {
+  TestSubmessageMaps* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.m_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestMaps>(arena, *from._impl_.m_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestSubmessageMaps)
+}
+inline PROTOBUF_NDEBUG_INLINE TestSubmessageMaps::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestSubmessageMaps::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.m_ = {};
+}
+TestSubmessageMaps::~TestSubmessageMaps() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestSubmessageMaps)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestSubmessageMaps::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.m_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestSubmessageMaps::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestSubmessageMaps)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.m_ != nullptr);
+    _impl_.m_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestSubmessageMaps::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestSubmessageMaps::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestSubmessageMaps, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestSubmessageMaps_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional .protobuf_unittest.TestMaps m = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestSubmessageMaps, _impl_.m_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional .protobuf_unittest.TestMaps m = 1;
+    {PROTOBUF_FIELD_OFFSET(TestSubmessageMaps, _impl_.m_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestMaps>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestSubmessageMaps::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestSubmessageMaps)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .protobuf_unittest.TestMaps m = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::m(this),
+        _Internal::m(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestSubmessageMaps)
+  return target;
+}
+
+::size_t TestSubmessageMaps::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestSubmessageMaps)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.TestMaps m = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.m_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestSubmessageMaps::_class_data_ = {
+    TestSubmessageMaps::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestSubmessageMaps::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestSubmessageMaps::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestSubmessageMaps*>(&to_msg);
+  auto& from = static_cast<const TestSubmessageMaps&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestSubmessageMaps)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_m()->::protobuf_unittest::TestMaps::MergeFrom(
+        from._internal_m());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestSubmessageMaps::CopyFrom(const TestSubmessageMaps& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestSubmessageMaps)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestSubmessageMaps::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestSubmessageMaps::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestSubmessageMaps::InternalSwap(TestSubmessageMaps* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.m_, other->_impl_.m_);
+}
+
+::google::protobuf::Metadata TestSubmessageMaps::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[47]);
+}
+// ===================================================================
+
+TestProto2BytesMap_MapBytesEntry_DoNotUse::TestProto2BytesMap_MapBytesEntry_DoNotUse() {}
+TestProto2BytesMap_MapBytesEntry_DoNotUse::TestProto2BytesMap_MapBytesEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestProto2BytesMap_MapBytesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[48]);
+}
+// ===================================================================
+
+TestProto2BytesMap_MapStringEntry_DoNotUse::TestProto2BytesMap_MapStringEntry_DoNotUse() {}
+TestProto2BytesMap_MapStringEntry_DoNotUse::TestProto2BytesMap_MapStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestProto2BytesMap_MapStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[49]);
+}
+// ===================================================================
+
+class TestProto2BytesMap::_Internal {
+ public:
+};
+
+TestProto2BytesMap::TestProto2BytesMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestProto2BytesMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestProto2BytesMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_bytes_{visibility, arena, from.map_bytes_},
+        map_string_{visibility, arena, from.map_string_},
+        _cached_size_{0} {}
+
+TestProto2BytesMap::TestProto2BytesMap(
+    ::google::protobuf::Arena* arena,
+    const TestProto2BytesMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestProto2BytesMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestProto2BytesMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestProto2BytesMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_bytes_{visibility, arena},
+        map_string_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestProto2BytesMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestProto2BytesMap::~TestProto2BytesMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestProto2BytesMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestProto2BytesMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestProto2BytesMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestProto2BytesMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_bytes_.Clear();
+  _impl_.map_string_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestProto2BytesMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 2, 55, 2> TestProto2BytesMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestProto2BytesMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, bytes> map_bytes = 1;
+    {PROTOBUF_FIELD_OFFSET(TestProto2BytesMap, _impl_.map_bytes_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, string> map_string = 2;
+    {PROTOBUF_FIELD_OFFSET(TestProto2BytesMap, _impl_.map_string_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestProto2BytesMap()._impl_.map_bytes_)>(
+        0, 1, 0, 5,
+        12)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestProto2BytesMap()._impl_.map_string_)>(
+        0, 1, 0, 5,
+        9)},
+  }}, {{
+    "\44\0\12\0\0\0\0\0"
+    "protobuf_unittest.TestProto2BytesMap"
+    "map_string"
+  }},
+};
+
+::uint8_t* TestProto2BytesMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestProto2BytesMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, bytes> map_bytes = 1;
+  if (!_internal_map_bytes().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>;
+    const auto& field = _internal_map_bytes();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, string> map_string = 2;
+  if (!_internal_map_string().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestProto2BytesMap.map_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestProto2BytesMap.map_string");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestProto2BytesMap)
+  return target;
+}
+
+::size_t TestProto2BytesMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestProto2BytesMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, bytes> map_bytes = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_bytes_size());
+  for (const auto& entry : _internal_map_bytes()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, string> map_string = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_string_size());
+  for (const auto& entry : _internal_map_string()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestProto2BytesMap::_class_data_ = {
+    TestProto2BytesMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestProto2BytesMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestProto2BytesMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestProto2BytesMap*>(&to_msg);
+  auto& from = static_cast<const TestProto2BytesMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestProto2BytesMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_bytes_.MergeFrom(from._impl_.map_bytes_);
+  _this->_impl_.map_string_.MergeFrom(from._impl_.map_string_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestProto2BytesMap::CopyFrom(const TestProto2BytesMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestProto2BytesMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestProto2BytesMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestProto2BytesMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestProto2BytesMap::InternalSwap(TestProto2BytesMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_bytes_.InternalSwap(&other->_impl_.map_bytes_);
+  _impl_.map_string_.InternalSwap(&other->_impl_.map_string_);
+}
+
+::google::protobuf::Metadata TestProto2BytesMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto[50]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,4999 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_proto2_unittest.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/map.h"  // IWYU pragma: export
+#include "google/protobuf/map_entry.h"
+#include "google/protobuf/map_field_inl.h"
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/unittest_import.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+namespace protobuf_unittest {
+class TestEnumMap;
+struct TestEnumMapDefaultTypeInternal;
+extern TestEnumMapDefaultTypeInternal _TestEnumMap_default_instance_;
+class TestEnumMapPlusExtra;
+struct TestEnumMapPlusExtraDefaultTypeInternal;
+extern TestEnumMapPlusExtraDefaultTypeInternal _TestEnumMapPlusExtra_default_instance_;
+class TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse;
+struct TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse;
+struct TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse_default_instance_;
+class TestEnumMap_KnownMapFieldEntry_DoNotUse;
+struct TestEnumMap_KnownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_KnownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMap_KnownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldBoolEntry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldEntry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldInt32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldInt64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldSint32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldSint64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldStringEntry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldStringEntry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldStringEntry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldUint32Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse_default_instance_;
+class TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse;
+struct TestEnumMap_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal;
+extern TestEnumMap_UnknownMapFieldUint64Entry_DoNotUseDefaultTypeInternal _TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse_default_instance_;
+class TestImportEnumMap;
+struct TestImportEnumMapDefaultTypeInternal;
+extern TestImportEnumMapDefaultTypeInternal _TestImportEnumMap_default_instance_;
+class TestImportEnumMap_ImportEnumAmpEntry_DoNotUse;
+struct TestImportEnumMap_ImportEnumAmpEntry_DoNotUseDefaultTypeInternal;
+extern TestImportEnumMap_ImportEnumAmpEntry_DoNotUseDefaultTypeInternal _TestImportEnumMap_ImportEnumAmpEntry_DoNotUse_default_instance_;
+class TestIntIntMap;
+struct TestIntIntMapDefaultTypeInternal;
+extern TestIntIntMapDefaultTypeInternal _TestIntIntMap_default_instance_;
+class TestIntIntMap_MEntry_DoNotUse;
+struct TestIntIntMap_MEntry_DoNotUseDefaultTypeInternal;
+extern TestIntIntMap_MEntry_DoNotUseDefaultTypeInternal _TestIntIntMap_MEntry_DoNotUse_default_instance_;
+class TestMaps;
+struct TestMapsDefaultTypeInternal;
+extern TestMapsDefaultTypeInternal _TestMaps_default_instance_;
+class TestMaps_MBoolEntry_DoNotUse;
+struct TestMaps_MBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MBoolEntry_DoNotUseDefaultTypeInternal _TestMaps_MBoolEntry_DoNotUse_default_instance_;
+class TestMaps_MFixed32Entry_DoNotUse;
+struct TestMaps_MFixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MFixed32Entry_DoNotUseDefaultTypeInternal _TestMaps_MFixed32Entry_DoNotUse_default_instance_;
+class TestMaps_MFixed64Entry_DoNotUse;
+struct TestMaps_MFixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MFixed64Entry_DoNotUseDefaultTypeInternal _TestMaps_MFixed64Entry_DoNotUse_default_instance_;
+class TestMaps_MInt32Entry_DoNotUse;
+struct TestMaps_MInt32Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MInt32Entry_DoNotUseDefaultTypeInternal _TestMaps_MInt32Entry_DoNotUse_default_instance_;
+class TestMaps_MInt64Entry_DoNotUse;
+struct TestMaps_MInt64Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MInt64Entry_DoNotUseDefaultTypeInternal _TestMaps_MInt64Entry_DoNotUse_default_instance_;
+class TestMaps_MSfixed32Entry_DoNotUse;
+struct TestMaps_MSfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MSfixed32Entry_DoNotUseDefaultTypeInternal _TestMaps_MSfixed32Entry_DoNotUse_default_instance_;
+class TestMaps_MSfixed64Entry_DoNotUse;
+struct TestMaps_MSfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MSfixed64Entry_DoNotUseDefaultTypeInternal _TestMaps_MSfixed64Entry_DoNotUse_default_instance_;
+class TestMaps_MSint32Entry_DoNotUse;
+struct TestMaps_MSint32Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MSint32Entry_DoNotUseDefaultTypeInternal _TestMaps_MSint32Entry_DoNotUse_default_instance_;
+class TestMaps_MSint64Entry_DoNotUse;
+struct TestMaps_MSint64Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MSint64Entry_DoNotUseDefaultTypeInternal _TestMaps_MSint64Entry_DoNotUse_default_instance_;
+class TestMaps_MStringEntry_DoNotUse;
+struct TestMaps_MStringEntry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MStringEntry_DoNotUseDefaultTypeInternal _TestMaps_MStringEntry_DoNotUse_default_instance_;
+class TestMaps_MUint32Entry_DoNotUse;
+struct TestMaps_MUint32Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MUint32Entry_DoNotUseDefaultTypeInternal _TestMaps_MUint32Entry_DoNotUse_default_instance_;
+class TestMaps_MUint64Entry_DoNotUse;
+struct TestMaps_MUint64Entry_DoNotUseDefaultTypeInternal;
+extern TestMaps_MUint64Entry_DoNotUseDefaultTypeInternal _TestMaps_MUint64Entry_DoNotUse_default_instance_;
+class TestProto2BytesMap;
+struct TestProto2BytesMapDefaultTypeInternal;
+extern TestProto2BytesMapDefaultTypeInternal _TestProto2BytesMap_default_instance_;
+class TestProto2BytesMap_MapBytesEntry_DoNotUse;
+struct TestProto2BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal;
+extern TestProto2BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal _TestProto2BytesMap_MapBytesEntry_DoNotUse_default_instance_;
+class TestProto2BytesMap_MapStringEntry_DoNotUse;
+struct TestProto2BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal;
+extern TestProto2BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal _TestProto2BytesMap_MapStringEntry_DoNotUse_default_instance_;
+class TestSubmessageMaps;
+struct TestSubmessageMapsDefaultTypeInternal;
+extern TestSubmessageMapsDefaultTypeInternal _TestSubmessageMaps_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+enum Proto2MapEnum : int {
+  PROTO2_MAP_ENUM_FOO = 0,
+  PROTO2_MAP_ENUM_BAR = 1,
+  PROTO2_MAP_ENUM_BAZ = 2,
+};
+
+bool Proto2MapEnum_IsValid(int value);
+extern const uint32_t Proto2MapEnum_internal_data_[];
+constexpr Proto2MapEnum Proto2MapEnum_MIN = static_cast<Proto2MapEnum>(0);
+constexpr Proto2MapEnum Proto2MapEnum_MAX = static_cast<Proto2MapEnum>(2);
+constexpr int Proto2MapEnum_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+Proto2MapEnum_descriptor();
+template <typename T>
+const std::string& Proto2MapEnum_Name(T value) {
+  static_assert(std::is_same<T, Proto2MapEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to Proto2MapEnum_Name().");
+  return Proto2MapEnum_Name(static_cast<Proto2MapEnum>(value));
+}
+template <>
+inline const std::string& Proto2MapEnum_Name(Proto2MapEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<Proto2MapEnum_descriptor,
+                                                 0, 2>(
+      static_cast<int>(value));
+}
+inline bool Proto2MapEnum_Parse(absl::string_view name, Proto2MapEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<Proto2MapEnum>(
+      Proto2MapEnum_descriptor(), name, value);
+}
+enum Proto2MapEnumPlusExtra : int {
+  E_PROTO2_MAP_ENUM_FOO = 0,
+  E_PROTO2_MAP_ENUM_BAR = 1,
+  E_PROTO2_MAP_ENUM_BAZ = 2,
+  E_PROTO2_MAP_ENUM_EXTRA = 3,
+};
+
+bool Proto2MapEnumPlusExtra_IsValid(int value);
+extern const uint32_t Proto2MapEnumPlusExtra_internal_data_[];
+constexpr Proto2MapEnumPlusExtra Proto2MapEnumPlusExtra_MIN = static_cast<Proto2MapEnumPlusExtra>(0);
+constexpr Proto2MapEnumPlusExtra Proto2MapEnumPlusExtra_MAX = static_cast<Proto2MapEnumPlusExtra>(3);
+constexpr int Proto2MapEnumPlusExtra_ARRAYSIZE = 3 + 1;
+const ::google::protobuf::EnumDescriptor*
+Proto2MapEnumPlusExtra_descriptor();
+template <typename T>
+const std::string& Proto2MapEnumPlusExtra_Name(T value) {
+  static_assert(std::is_same<T, Proto2MapEnumPlusExtra>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to Proto2MapEnumPlusExtra_Name().");
+  return Proto2MapEnumPlusExtra_Name(static_cast<Proto2MapEnumPlusExtra>(value));
+}
+template <>
+inline const std::string& Proto2MapEnumPlusExtra_Name(Proto2MapEnumPlusExtra value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<Proto2MapEnumPlusExtra_descriptor,
+                                                 0, 3>(
+      static_cast<int>(value));
+}
+inline bool Proto2MapEnumPlusExtra_Parse(absl::string_view name, Proto2MapEnumPlusExtra* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<Proto2MapEnumPlusExtra>(
+      Proto2MapEnumPlusExtra_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestProto2BytesMap_MapStringEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestProto2BytesMap_MapStringEntry_DoNotUse, ::int32_t, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestProto2BytesMap_MapStringEntry_DoNotUse, ::int32_t, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  TestProto2BytesMap_MapStringEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto2BytesMap_MapStringEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestProto2BytesMap_MapStringEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestProto2BytesMap_MapStringEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestProto2BytesMap_MapStringEntry_DoNotUse*>(
+        &_TestProto2BytesMap_MapStringEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+#ifndef NDEBUG
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+       s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "protobuf_unittest.TestProto2BytesMap.MapStringEntry.value");
+#else
+    (void) s;
+#endif
+    return true;
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestProto2BytesMap_MapBytesEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestProto2BytesMap_MapBytesEntry_DoNotUse, ::int32_t, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BYTES> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestProto2BytesMap_MapBytesEntry_DoNotUse, ::int32_t, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BYTES>;
+  TestProto2BytesMap_MapBytesEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto2BytesMap_MapBytesEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestProto2BytesMap_MapBytesEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestProto2BytesMap_MapBytesEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestProto2BytesMap_MapBytesEntry_DoNotUse*>(
+        &_TestProto2BytesMap_MapBytesEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestIntIntMap_MEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestIntIntMap_MEntry_DoNotUse, ::int32_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestIntIntMap_MEntry_DoNotUse, ::int32_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestIntIntMap_MEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestIntIntMap_MEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestIntIntMap_MEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestIntIntMap_MEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestIntIntMap_MEntry_DoNotUse*>(
+        &_TestIntIntMap_MEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestImportEnumMap_ImportEnumAmpEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, ::int32_t, ::protobuf_unittest_import::ImportEnumForMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, ::int32_t, ::protobuf_unittest_import::ImportEnumForMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestImportEnumMap_ImportEnumAmpEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestImportEnumMap_ImportEnumAmpEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestImportEnumMap_ImportEnumAmpEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestImportEnumMap_ImportEnumAmpEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestImportEnumMap_ImportEnumAmpEntry_DoNotUse*>(
+        &_TestImportEnumMap_ImportEnumAmpEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+#ifndef NDEBUG
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+       s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "protobuf_unittest.TestEnumMapPlusExtra.UnknownMapFieldStringEntry.key");
+#else
+    (void) s;
+#endif
+    return true;
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, bool, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, bool, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse*>(
+        &_TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldStringEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, std::string, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, std::string, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldStringEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldStringEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldStringEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldStringEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldStringEntry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldStringEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+#ifndef NDEBUG
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+       s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "protobuf_unittest.TestEnumMap.UnknownMapFieldStringEntry.key");
+#else
+    (void) s;
+#endif
+    return true;
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldEntry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, bool, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, bool, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse*>(
+        &_TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMap_KnownMapFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestEnumMap_KnownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_ENUM> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestEnumMap_KnownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>;
+  TestEnumMap_KnownMapFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap_KnownMapFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestEnumMap_KnownMapFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestEnumMap_KnownMapFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap_KnownMapFieldEntry_DoNotUse*>(
+        &_TestEnumMap_KnownMapFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestProto2BytesMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestProto2BytesMap) */ {
+ public:
+  inline TestProto2BytesMap() : TestProto2BytesMap(nullptr) {}
+  ~TestProto2BytesMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto2BytesMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestProto2BytesMap(const TestProto2BytesMap& from)
+      : TestProto2BytesMap(nullptr, from) {}
+  TestProto2BytesMap(TestProto2BytesMap&& from) noexcept
+    : TestProto2BytesMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestProto2BytesMap& operator=(const TestProto2BytesMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestProto2BytesMap& operator=(TestProto2BytesMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestProto2BytesMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestProto2BytesMap* internal_default_instance() {
+    return reinterpret_cast<const TestProto2BytesMap*>(
+               &_TestProto2BytesMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    50;
+
+  friend void swap(TestProto2BytesMap& a, TestProto2BytesMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestProto2BytesMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestProto2BytesMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestProto2BytesMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestProto2BytesMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestProto2BytesMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestProto2BytesMap& from) {
+    TestProto2BytesMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestProto2BytesMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestProto2BytesMap";
+  }
+  protected:
+  explicit TestProto2BytesMap(::google::protobuf::Arena* arena);
+  TestProto2BytesMap(::google::protobuf::Arena* arena, const TestProto2BytesMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapBytesFieldNumber = 1,
+    kMapStringFieldNumber = 2,
+  };
+  // map<int32, bytes> map_bytes = 1;
+  int map_bytes_size() const;
+  private:
+  int _internal_map_bytes_size() const;
+
+  public:
+  void clear_map_bytes() ;
+  const ::google::protobuf::Map<::int32_t, std::string>& map_bytes() const;
+  ::google::protobuf::Map<::int32_t, std::string>* mutable_map_bytes();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, std::string>& _internal_map_bytes() const;
+  ::google::protobuf::Map<::int32_t, std::string>* _internal_mutable_map_bytes();
+
+  public:
+  // map<int32, string> map_string = 2;
+  int map_string_size() const;
+  private:
+  int _internal_map_string_size() const;
+
+  public:
+  void clear_map_string() ;
+  const ::google::protobuf::Map<::int32_t, std::string>& map_string() const;
+  ::google::protobuf::Map<::int32_t, std::string>* mutable_map_string();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, std::string>& _internal_map_string() const;
+  ::google::protobuf::Map<::int32_t, std::string>* _internal_mutable_map_string();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestProto2BytesMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 2, 2,
+      55, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestProto2BytesMap_MapBytesEntry_DoNotUse, ::int32_t, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BYTES>
+        map_bytes_;
+    ::google::protobuf::internal::MapField<TestProto2BytesMap_MapStringEntry_DoNotUse, ::int32_t, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map_string_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};// -------------------------------------------------------------------
+
+class TestIntIntMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestIntIntMap) */ {
+ public:
+  inline TestIntIntMap() : TestIntIntMap(nullptr) {}
+  ~TestIntIntMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestIntIntMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestIntIntMap(const TestIntIntMap& from)
+      : TestIntIntMap(nullptr, from) {}
+  TestIntIntMap(TestIntIntMap&& from) noexcept
+    : TestIntIntMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestIntIntMap& operator=(const TestIntIntMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestIntIntMap& operator=(TestIntIntMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestIntIntMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestIntIntMap* internal_default_instance() {
+    return reinterpret_cast<const TestIntIntMap*>(
+               &_TestIntIntMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(TestIntIntMap& a, TestIntIntMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestIntIntMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestIntIntMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestIntIntMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestIntIntMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestIntIntMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestIntIntMap& from) {
+    TestIntIntMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestIntIntMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestIntIntMap";
+  }
+  protected:
+  explicit TestIntIntMap(::google::protobuf::Arena* arena);
+  TestIntIntMap(::google::protobuf::Arena* arena, const TestIntIntMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMFieldNumber = 1,
+  };
+  // map<int32, int32> m = 1;
+  int m_size() const;
+  private:
+  int _internal_m_size() const;
+
+  public:
+  void clear_m() ;
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& m() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* mutable_m();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& _internal_m() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* _internal_mutable_m();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestIntIntMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestIntIntMap_MEntry_DoNotUse, ::int32_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        m_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};// -------------------------------------------------------------------
+
+class TestImportEnumMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestImportEnumMap) */ {
+ public:
+  inline TestImportEnumMap() : TestImportEnumMap(nullptr) {}
+  ~TestImportEnumMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestImportEnumMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestImportEnumMap(const TestImportEnumMap& from)
+      : TestImportEnumMap(nullptr, from) {}
+  TestImportEnumMap(TestImportEnumMap&& from) noexcept
+    : TestImportEnumMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestImportEnumMap& operator=(const TestImportEnumMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestImportEnumMap& operator=(TestImportEnumMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestImportEnumMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestImportEnumMap* internal_default_instance() {
+    return reinterpret_cast<const TestImportEnumMap*>(
+               &_TestImportEnumMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(TestImportEnumMap& a, TestImportEnumMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestImportEnumMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestImportEnumMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestImportEnumMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestImportEnumMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestImportEnumMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestImportEnumMap& from) {
+    TestImportEnumMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestImportEnumMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestImportEnumMap";
+  }
+  protected:
+  explicit TestImportEnumMap(::google::protobuf::Arena* arena);
+  TestImportEnumMap(::google::protobuf::Arena* arena, const TestImportEnumMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kImportEnumAmpFieldNumber = 1,
+  };
+  // map<int32, .protobuf_unittest_import.ImportEnumForMap> import_enum_amp = 1;
+  int import_enum_amp_size() const;
+  private:
+  int _internal_import_enum_amp_size() const;
+
+  public:
+  void clear_import_enum_amp() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>& import_enum_amp() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>* mutable_import_enum_amp();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>& _internal_import_enum_amp() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>* _internal_mutable_import_enum_amp();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestImportEnumMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestImportEnumMap_ImportEnumAmpEntry_DoNotUse, ::int32_t, ::protobuf_unittest_import::ImportEnumForMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        import_enum_amp_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtra final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEnumMapPlusExtra) */ {
+ public:
+  inline TestEnumMapPlusExtra() : TestEnumMapPlusExtra(nullptr) {}
+  ~TestEnumMapPlusExtra() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMapPlusExtra(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEnumMapPlusExtra(const TestEnumMapPlusExtra& from)
+      : TestEnumMapPlusExtra(nullptr, from) {}
+  TestEnumMapPlusExtra(TestEnumMapPlusExtra&& from) noexcept
+    : TestEnumMapPlusExtra() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEnumMapPlusExtra& operator=(const TestEnumMapPlusExtra& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEnumMapPlusExtra& operator=(TestEnumMapPlusExtra&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestEnumMapPlusExtra& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEnumMapPlusExtra* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtra*>(
+               &_TestEnumMapPlusExtra_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(TestEnumMapPlusExtra& a, TestEnumMapPlusExtra& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEnumMapPlusExtra* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEnumMapPlusExtra* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEnumMapPlusExtra* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEnumMapPlusExtra>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestEnumMapPlusExtra& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestEnumMapPlusExtra& from) {
+    TestEnumMapPlusExtra::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEnumMapPlusExtra* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestEnumMapPlusExtra";
+  }
+  protected:
+  explicit TestEnumMapPlusExtra(::google::protobuf::Arena* arena);
+  TestEnumMapPlusExtra(::google::protobuf::Arena* arena, const TestEnumMapPlusExtra& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownMapFieldFieldNumber = 101,
+    kUnknownMapFieldFieldNumber = 102,
+    kUnknownMapFieldInt64FieldNumber = 200,
+    kUnknownMapFieldUint64FieldNumber = 201,
+    kUnknownMapFieldInt32FieldNumber = 202,
+    kUnknownMapFieldUint32FieldNumber = 203,
+    kUnknownMapFieldFixed32FieldNumber = 204,
+    kUnknownMapFieldFixed64FieldNumber = 205,
+    kUnknownMapFieldBoolFieldNumber = 206,
+    kUnknownMapFieldStringFieldNumber = 207,
+    kUnknownMapFieldSint32FieldNumber = 208,
+    kUnknownMapFieldSint64FieldNumber = 209,
+    kUnknownMapFieldSfixed32FieldNumber = 210,
+    kUnknownMapFieldSfixed64FieldNumber = 211,
+  };
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> known_map_field = 101;
+  int known_map_field_size() const;
+  private:
+  int _internal_known_map_field_size() const;
+
+  public:
+  void clear_known_map_field() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& known_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_known_map_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_known_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_known_map_field();
+
+  public:
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field = 102;
+  int unknown_map_field_size() const;
+  private:
+  int _internal_unknown_map_field_size() const;
+
+  public:
+  void clear_unknown_map_field() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field();
+
+  public:
+  // map<int64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int64 = 200;
+  int unknown_map_field_int64_size() const;
+  private:
+  int _internal_unknown_map_field_int64_size() const;
+
+  public:
+  void clear_unknown_map_field_int64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_int64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_int64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_int64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_int64();
+
+  public:
+  // map<uint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint64 = 201;
+  int unknown_map_field_uint64_size() const;
+  private:
+  int _internal_unknown_map_field_uint64_size() const;
+
+  public:
+  void clear_unknown_map_field_uint64() ;
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_uint64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_uint64();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_uint64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_uint64();
+
+  public:
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int32 = 202;
+  int unknown_map_field_int32_size() const;
+  private:
+  int _internal_unknown_map_field_int32_size() const;
+
+  public:
+  void clear_unknown_map_field_int32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_int32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_int32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_int32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_int32();
+
+  public:
+  // map<uint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint32 = 203;
+  int unknown_map_field_uint32_size() const;
+  private:
+  int _internal_unknown_map_field_uint32_size() const;
+
+  public:
+  void clear_unknown_map_field_uint32() ;
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_uint32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_uint32();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_uint32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_uint32();
+
+  public:
+  // map<fixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed32 = 204;
+  int unknown_map_field_fixed32_size() const;
+  private:
+  int _internal_unknown_map_field_fixed32_size() const;
+
+  public:
+  void clear_unknown_map_field_fixed32() ;
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_fixed32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_fixed32();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_fixed32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_fixed32();
+
+  public:
+  // map<fixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed64 = 205;
+  int unknown_map_field_fixed64_size() const;
+  private:
+  int _internal_unknown_map_field_fixed64_size() const;
+
+  public:
+  void clear_unknown_map_field_fixed64() ;
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_fixed64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_fixed64();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_fixed64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_fixed64();
+
+  public:
+  // map<bool, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_bool = 206;
+  int unknown_map_field_bool_size() const;
+  private:
+  int _internal_unknown_map_field_bool_size() const;
+
+  public:
+  void clear_unknown_map_field_bool() ;
+  const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_bool() const;
+  ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_bool();
+
+  private:
+  const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_bool() const;
+  ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_bool();
+
+  public:
+  // map<string, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_string = 207;
+  int unknown_map_field_string_size() const;
+  private:
+  int _internal_unknown_map_field_string_size() const;
+
+  public:
+  void clear_unknown_map_field_string() ;
+  const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_string() const;
+  ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_string();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_string() const;
+  ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_string();
+
+  public:
+  // map<sint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint32 = 208;
+  int unknown_map_field_sint32_size() const;
+  private:
+  int _internal_unknown_map_field_sint32_size() const;
+
+  public:
+  void clear_unknown_map_field_sint32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_sint32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_sint32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_sint32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_sint32();
+
+  public:
+  // map<sint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint64 = 209;
+  int unknown_map_field_sint64_size() const;
+  private:
+  int _internal_unknown_map_field_sint64_size() const;
+
+  public:
+  void clear_unknown_map_field_sint64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_sint64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_sint64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_sint64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_sint64();
+
+  public:
+  // map<sfixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed32 = 210;
+  int unknown_map_field_sfixed32_size() const;
+  private:
+  int _internal_unknown_map_field_sfixed32_size() const;
+
+  public:
+  void clear_unknown_map_field_sfixed32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_sfixed32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_sfixed32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_sfixed32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_sfixed32();
+
+  public:
+  // map<sfixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed64 = 211;
+  int unknown_map_field_sfixed64_size() const;
+  private:
+  int _internal_unknown_map_field_sfixed64_size() const;
+
+  public:
+  void clear_unknown_map_field_sfixed64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& unknown_map_field_sfixed64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* mutable_unknown_map_field_sfixed64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& _internal_unknown_map_field_sfixed64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* _internal_mutable_unknown_map_field_sfixed64();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEnumMapPlusExtra)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 14, 28,
+      79, 12>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_KnownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        known_map_field_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_int64_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_uint64_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_int32_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_uint32_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_fixed32_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_fixed64_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldBoolEntry_DoNotUse, bool, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_bool_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldStringEntry_DoNotUse, std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_string_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sint32_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sint64_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sfixed32_;
+    ::google::protobuf::internal::MapField<TestEnumMapPlusExtra_UnknownMapFieldSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sfixed64_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};// -------------------------------------------------------------------
+
+class TestEnumMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEnumMap) */ {
+ public:
+  inline TestEnumMap() : TestEnumMap(nullptr) {}
+  ~TestEnumMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEnumMap(const TestEnumMap& from)
+      : TestEnumMap(nullptr, from) {}
+  TestEnumMap(TestEnumMap&& from) noexcept
+    : TestEnumMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEnumMap& operator=(const TestEnumMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEnumMap& operator=(TestEnumMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestEnumMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEnumMap* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMap*>(
+               &_TestEnumMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(TestEnumMap& a, TestEnumMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEnumMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEnumMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEnumMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEnumMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestEnumMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestEnumMap& from) {
+    TestEnumMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEnumMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestEnumMap";
+  }
+  protected:
+  explicit TestEnumMap(::google::protobuf::Arena* arena);
+  TestEnumMap(::google::protobuf::Arena* arena, const TestEnumMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownMapFieldFieldNumber = 101,
+    kUnknownMapFieldFieldNumber = 102,
+    kUnknownMapFieldInt64FieldNumber = 200,
+    kUnknownMapFieldUint64FieldNumber = 201,
+    kUnknownMapFieldInt32FieldNumber = 202,
+    kUnknownMapFieldUint32FieldNumber = 203,
+    kUnknownMapFieldFixed32FieldNumber = 204,
+    kUnknownMapFieldFixed64FieldNumber = 205,
+    kUnknownMapFieldBoolFieldNumber = 206,
+    kUnknownMapFieldStringFieldNumber = 207,
+    kUnknownMapFieldSint32FieldNumber = 208,
+    kUnknownMapFieldSint64FieldNumber = 209,
+    kUnknownMapFieldSfixed32FieldNumber = 210,
+    kUnknownMapFieldSfixed64FieldNumber = 211,
+  };
+  // map<int32, .protobuf_unittest.Proto2MapEnum> known_map_field = 101;
+  int known_map_field_size() const;
+  private:
+  int _internal_known_map_field_size() const;
+
+  public:
+  void clear_known_map_field() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& known_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_known_map_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_known_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_known_map_field();
+
+  public:
+  // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field = 102;
+  int unknown_map_field_size() const;
+  private:
+  int _internal_unknown_map_field_size() const;
+
+  public:
+  void clear_unknown_map_field() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field();
+
+  public:
+  // map<int64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int64 = 200;
+  int unknown_map_field_int64_size() const;
+  private:
+  int _internal_unknown_map_field_int64_size() const;
+
+  public:
+  void clear_unknown_map_field_int64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_int64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_int64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_int64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_int64();
+
+  public:
+  // map<uint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint64 = 201;
+  int unknown_map_field_uint64_size() const;
+  private:
+  int _internal_unknown_map_field_uint64_size() const;
+
+  public:
+  void clear_unknown_map_field_uint64() ;
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_uint64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_uint64();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_uint64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_uint64();
+
+  public:
+  // map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int32 = 202;
+  int unknown_map_field_int32_size() const;
+  private:
+  int _internal_unknown_map_field_int32_size() const;
+
+  public:
+  void clear_unknown_map_field_int32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_int32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_int32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_int32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_int32();
+
+  public:
+  // map<uint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint32 = 203;
+  int unknown_map_field_uint32_size() const;
+  private:
+  int _internal_unknown_map_field_uint32_size() const;
+
+  public:
+  void clear_unknown_map_field_uint32() ;
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_uint32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_uint32();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_uint32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_uint32();
+
+  public:
+  // map<fixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed32 = 204;
+  int unknown_map_field_fixed32_size() const;
+  private:
+  int _internal_unknown_map_field_fixed32_size() const;
+
+  public:
+  void clear_unknown_map_field_fixed32() ;
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_fixed32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_fixed32();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_fixed32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_fixed32();
+
+  public:
+  // map<fixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed64 = 205;
+  int unknown_map_field_fixed64_size() const;
+  private:
+  int _internal_unknown_map_field_fixed64_size() const;
+
+  public:
+  void clear_unknown_map_field_fixed64() ;
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_fixed64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_fixed64();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_fixed64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_fixed64();
+
+  public:
+  // map<bool, .protobuf_unittest.Proto2MapEnum> unknown_map_field_bool = 206;
+  int unknown_map_field_bool_size() const;
+  private:
+  int _internal_unknown_map_field_bool_size() const;
+
+  public:
+  void clear_unknown_map_field_bool() ;
+  const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_bool() const;
+  ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_bool();
+
+  private:
+  const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_bool() const;
+  ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_bool();
+
+  public:
+  // map<string, .protobuf_unittest.Proto2MapEnum> unknown_map_field_string = 207;
+  int unknown_map_field_string_size() const;
+  private:
+  int _internal_unknown_map_field_string_size() const;
+
+  public:
+  void clear_unknown_map_field_string() ;
+  const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_string() const;
+  ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_string();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_string() const;
+  ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_string();
+
+  public:
+  // map<sint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint32 = 208;
+  int unknown_map_field_sint32_size() const;
+  private:
+  int _internal_unknown_map_field_sint32_size() const;
+
+  public:
+  void clear_unknown_map_field_sint32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_sint32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_sint32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_sint32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_sint32();
+
+  public:
+  // map<sint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint64 = 209;
+  int unknown_map_field_sint64_size() const;
+  private:
+  int _internal_unknown_map_field_sint64_size() const;
+
+  public:
+  void clear_unknown_map_field_sint64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_sint64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_sint64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_sint64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_sint64();
+
+  public:
+  // map<sfixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed32 = 210;
+  int unknown_map_field_sfixed32_size() const;
+  private:
+  int _internal_unknown_map_field_sfixed32_size() const;
+
+  public:
+  void clear_unknown_map_field_sfixed32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_sfixed32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_sfixed32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_sfixed32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_sfixed32();
+
+  public:
+  // map<sfixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed64 = 211;
+  int unknown_map_field_sfixed64_size() const;
+  private:
+  int _internal_unknown_map_field_sfixed64_size() const;
+
+  public:
+  void clear_unknown_map_field_sfixed64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& unknown_map_field_sfixed64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* mutable_unknown_map_field_sfixed64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& _internal_unknown_map_field_sfixed64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* _internal_mutable_unknown_map_field_sfixed64();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEnumMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 14, 28,
+      70, 12>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestEnumMap_KnownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        known_map_field_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldEntry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_int64_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_uint64_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_int32_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_uint32_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_fixed32_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_fixed64_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldBoolEntry_DoNotUse, bool, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_bool_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldStringEntry_DoNotUse, std::string, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_string_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sint32_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sint64_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sfixed32_;
+    ::google::protobuf::internal::MapField<TestEnumMap_UnknownMapFieldSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::Proto2MapEnum,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>
+        unknown_map_field_sfixed64_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMaps_MUint64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MUint64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MUint64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MUint64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MUint64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MUint64Entry_DoNotUse*>(
+        &_TestMaps_MUint64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MUint32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MUint32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MUint32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MUint32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MUint32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MUint32Entry_DoNotUse*>(
+        &_TestMaps_MUint32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MStringEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MStringEntry_DoNotUse, std::string, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MStringEntry_DoNotUse, std::string, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MStringEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MStringEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MStringEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MStringEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MStringEntry_DoNotUse*>(
+        &_TestMaps_MStringEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+#ifndef NDEBUG
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+       s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "protobuf_unittest.TestMaps.MStringEntry.key");
+#else
+    (void) s;
+#endif
+    return true;
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MSint64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MSint64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MSint64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MSint64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MSint64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MSint64Entry_DoNotUse*>(
+        &_TestMaps_MSint64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MSint32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MSint32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MSint32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MSint32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MSint32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MSint32Entry_DoNotUse*>(
+        &_TestMaps_MSint32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MSfixed64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MSfixed64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MSfixed64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MSfixed64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MSfixed64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MSfixed64Entry_DoNotUse*>(
+        &_TestMaps_MSfixed64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MSfixed32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MSfixed32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MSfixed32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MSfixed32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MSfixed32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MSfixed32Entry_DoNotUse*>(
+        &_TestMaps_MSfixed32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MInt64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MInt64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MInt64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MInt64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MInt64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MInt64Entry_DoNotUse*>(
+        &_TestMaps_MInt64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MInt32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MInt32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MInt32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MInt32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MInt32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MInt32Entry_DoNotUse*>(
+        &_TestMaps_MInt32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MFixed64Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MFixed64Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MFixed64Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MFixed64Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MFixed64Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MFixed64Entry_DoNotUse*>(
+        &_TestMaps_MFixed64Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MFixed32Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MFixed32Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MFixed32Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MFixed32Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MFixed32Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MFixed32Entry_DoNotUse*>(
+        &_TestMaps_MFixed32Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps_MBoolEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMaps_MBoolEntry_DoNotUse, bool, ::protobuf_unittest::TestIntIntMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMaps_MBoolEntry_DoNotUse, bool, ::protobuf_unittest::TestIntIntMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestMaps_MBoolEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps_MBoolEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMaps_MBoolEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMaps_MBoolEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMaps_MBoolEntry_DoNotUse*>(
+        &_TestMaps_MBoolEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMaps final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMaps) */ {
+ public:
+  inline TestMaps() : TestMaps(nullptr) {}
+  ~TestMaps() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMaps(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMaps(const TestMaps& from)
+      : TestMaps(nullptr, from) {}
+  TestMaps(TestMaps&& from) noexcept
+    : TestMaps() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMaps& operator=(const TestMaps& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMaps& operator=(TestMaps&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestMaps& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMaps* internal_default_instance() {
+    return reinterpret_cast<const TestMaps*>(
+               &_TestMaps_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    46;
+
+  friend void swap(TestMaps& a, TestMaps& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMaps* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMaps* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMaps* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMaps>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestMaps& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestMaps& from) {
+    TestMaps::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMaps* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestMaps";
+  }
+  protected:
+  explicit TestMaps(::google::protobuf::Arena* arena);
+  TestMaps(::google::protobuf::Arena* arena, const TestMaps& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMInt32FieldNumber = 1,
+    kMInt64FieldNumber = 2,
+    kMUint32FieldNumber = 3,
+    kMUint64FieldNumber = 4,
+    kMSint32FieldNumber = 5,
+    kMSint64FieldNumber = 6,
+    kMFixed32FieldNumber = 7,
+    kMFixed64FieldNumber = 8,
+    kMSfixed32FieldNumber = 9,
+    kMSfixed64FieldNumber = 10,
+    kMBoolFieldNumber = 11,
+    kMStringFieldNumber = 12,
+  };
+  // map<int32, .protobuf_unittest.TestIntIntMap> m_int32 = 1;
+  int m_int32_size() const;
+  private:
+  int _internal_m_int32_size() const;
+
+  public:
+  void clear_m_int32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& m_int32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_int32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_int32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_int32();
+
+  public:
+  // map<int64, .protobuf_unittest.TestIntIntMap> m_int64 = 2;
+  int m_int64_size() const;
+  private:
+  int _internal_m_int64_size() const;
+
+  public:
+  void clear_m_int64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& m_int64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_int64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_int64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_int64();
+
+  public:
+  // map<uint32, .protobuf_unittest.TestIntIntMap> m_uint32 = 3;
+  int m_uint32_size() const;
+  private:
+  int _internal_m_uint32_size() const;
+
+  public:
+  void clear_m_uint32() ;
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& m_uint32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_uint32();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_uint32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_uint32();
+
+  public:
+  // map<uint64, .protobuf_unittest.TestIntIntMap> m_uint64 = 4;
+  int m_uint64_size() const;
+  private:
+  int _internal_m_uint64_size() const;
+
+  public:
+  void clear_m_uint64() ;
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& m_uint64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_uint64();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_uint64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_uint64();
+
+  public:
+  // map<sint32, .protobuf_unittest.TestIntIntMap> m_sint32 = 5;
+  int m_sint32_size() const;
+  private:
+  int _internal_m_sint32_size() const;
+
+  public:
+  void clear_m_sint32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& m_sint32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_sint32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_sint32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_sint32();
+
+  public:
+  // map<sint64, .protobuf_unittest.TestIntIntMap> m_sint64 = 6;
+  int m_sint64_size() const;
+  private:
+  int _internal_m_sint64_size() const;
+
+  public:
+  void clear_m_sint64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& m_sint64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_sint64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_sint64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_sint64();
+
+  public:
+  // map<fixed32, .protobuf_unittest.TestIntIntMap> m_fixed32 = 7;
+  int m_fixed32_size() const;
+  private:
+  int _internal_m_fixed32_size() const;
+
+  public:
+  void clear_m_fixed32() ;
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& m_fixed32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_fixed32();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_fixed32() const;
+  ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_fixed32();
+
+  public:
+  // map<fixed64, .protobuf_unittest.TestIntIntMap> m_fixed64 = 8;
+  int m_fixed64_size() const;
+  private:
+  int _internal_m_fixed64_size() const;
+
+  public:
+  void clear_m_fixed64() ;
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& m_fixed64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_fixed64();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_fixed64() const;
+  ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_fixed64();
+
+  public:
+  // map<sfixed32, .protobuf_unittest.TestIntIntMap> m_sfixed32 = 9;
+  int m_sfixed32_size() const;
+  private:
+  int _internal_m_sfixed32_size() const;
+
+  public:
+  void clear_m_sfixed32() ;
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& m_sfixed32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_sfixed32();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_sfixed32() const;
+  ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_sfixed32();
+
+  public:
+  // map<sfixed64, .protobuf_unittest.TestIntIntMap> m_sfixed64 = 10;
+  int m_sfixed64_size() const;
+  private:
+  int _internal_m_sfixed64_size() const;
+
+  public:
+  void clear_m_sfixed64() ;
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& m_sfixed64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* mutable_m_sfixed64();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& _internal_m_sfixed64() const;
+  ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_sfixed64();
+
+  public:
+  // map<bool, .protobuf_unittest.TestIntIntMap> m_bool = 11;
+  int m_bool_size() const;
+  private:
+  int _internal_m_bool_size() const;
+
+  public:
+  void clear_m_bool() ;
+  const ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>& m_bool() const;
+  ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>* mutable_m_bool();
+
+  private:
+  const ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>& _internal_m_bool() const;
+  ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_bool();
+
+  public:
+  // map<string, .protobuf_unittest.TestIntIntMap> m_string = 12;
+  int m_string_size() const;
+  private:
+  int _internal_m_string_size() const;
+
+  public:
+  void clear_m_string() ;
+  const ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>& m_string() const;
+  ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>* mutable_m_string();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>& _internal_m_string() const;
+  ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>* _internal_mutable_m_string();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMaps)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 12, 24,
+      51, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestMaps_MInt32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_int32_;
+    ::google::protobuf::internal::MapField<TestMaps_MInt64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_int64_;
+    ::google::protobuf::internal::MapField<TestMaps_MUint32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_uint32_;
+    ::google::protobuf::internal::MapField<TestMaps_MUint64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_uint64_;
+    ::google::protobuf::internal::MapField<TestMaps_MSint32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_sint32_;
+    ::google::protobuf::internal::MapField<TestMaps_MSint64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_sint64_;
+    ::google::protobuf::internal::MapField<TestMaps_MFixed32Entry_DoNotUse, ::uint32_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_fixed32_;
+    ::google::protobuf::internal::MapField<TestMaps_MFixed64Entry_DoNotUse, ::uint64_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_fixed64_;
+    ::google::protobuf::internal::MapField<TestMaps_MSfixed32Entry_DoNotUse, ::int32_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_sfixed32_;
+    ::google::protobuf::internal::MapField<TestMaps_MSfixed64Entry_DoNotUse, ::int64_t, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_sfixed64_;
+    ::google::protobuf::internal::MapField<TestMaps_MBoolEntry_DoNotUse, bool, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_bool_;
+    ::google::protobuf::internal::MapField<TestMaps_MStringEntry_DoNotUse, std::string, ::protobuf_unittest::TestIntIntMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        m_string_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};// -------------------------------------------------------------------
+
+class TestSubmessageMaps final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestSubmessageMaps) */ {
+ public:
+  inline TestSubmessageMaps() : TestSubmessageMaps(nullptr) {}
+  ~TestSubmessageMaps() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestSubmessageMaps(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestSubmessageMaps(const TestSubmessageMaps& from)
+      : TestSubmessageMaps(nullptr, from) {}
+  TestSubmessageMaps(TestSubmessageMaps&& from) noexcept
+    : TestSubmessageMaps() {
+    *this = ::std::move(from);
+  }
+
+  inline TestSubmessageMaps& operator=(const TestSubmessageMaps& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestSubmessageMaps& operator=(TestSubmessageMaps&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestSubmessageMaps& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestSubmessageMaps* internal_default_instance() {
+    return reinterpret_cast<const TestSubmessageMaps*>(
+               &_TestSubmessageMaps_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(TestSubmessageMaps& a, TestSubmessageMaps& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestSubmessageMaps* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestSubmessageMaps* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestSubmessageMaps* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestSubmessageMaps>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestSubmessageMaps& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestSubmessageMaps& from) {
+    TestSubmessageMaps::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestSubmessageMaps* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestSubmessageMaps";
+  }
+  protected:
+  explicit TestSubmessageMaps(::google::protobuf::Arena* arena);
+  TestSubmessageMaps(::google::protobuf::Arena* arena, const TestSubmessageMaps& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMFieldNumber = 1,
+  };
+  // optional .protobuf_unittest.TestMaps m = 1;
+  bool has_m() const;
+  void clear_m() ;
+  const ::protobuf_unittest::TestMaps& m() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestMaps* release_m();
+  ::protobuf_unittest::TestMaps* mutable_m();
+  void set_allocated_m(::protobuf_unittest::TestMaps* value);
+  void unsafe_arena_set_allocated_m(::protobuf_unittest::TestMaps* value);
+  ::protobuf_unittest::TestMaps* unsafe_arena_release_m();
+
+  private:
+  const ::protobuf_unittest::TestMaps& _internal_m() const;
+  ::protobuf_unittest::TestMaps* _internal_mutable_m();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestSubmessageMaps)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestMaps* m_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestEnumMap
+
+// map<int32, .protobuf_unittest.Proto2MapEnum> known_map_field = 101;
+inline int TestEnumMap::_internal_known_map_field_size() const {
+  return _internal_known_map_field().size();
+}
+inline int TestEnumMap::known_map_field_size() const {
+  return _internal_known_map_field_size();
+}
+inline void TestEnumMap::clear_known_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.known_map_field_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_known_map_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.known_map_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::known_map_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.known_map_field)
+  return _internal_known_map_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_known_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.known_map_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_known_map_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.known_map_field)
+  return _internal_mutable_known_map_field();
+}
+
+// map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field = 102;
+inline int TestEnumMap::_internal_unknown_map_field_size() const {
+  return _internal_unknown_map_field().size();
+}
+inline int TestEnumMap::unknown_map_field_size() const {
+  return _internal_unknown_map_field_size();
+}
+inline void TestEnumMap::clear_unknown_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field)
+  return _internal_unknown_map_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field)
+  return _internal_mutable_unknown_map_field();
+}
+
+// map<int64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int64 = 200;
+inline int TestEnumMap::_internal_unknown_map_field_int64_size() const {
+  return _internal_unknown_map_field_int64().size();
+}
+inline int TestEnumMap::unknown_map_field_int64_size() const {
+  return _internal_unknown_map_field_int64_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_int64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_int64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_int64)
+  return _internal_unknown_map_field_int64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_int64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_int64)
+  return _internal_mutable_unknown_map_field_int64();
+}
+
+// map<uint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint64 = 201;
+inline int TestEnumMap::_internal_unknown_map_field_uint64_size() const {
+  return _internal_unknown_map_field_uint64().size();
+}
+inline int TestEnumMap::unknown_map_field_uint64_size() const {
+  return _internal_unknown_map_field_uint64_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_uint64_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint64_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_uint64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_uint64)
+  return _internal_unknown_map_field_uint64();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint64_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_uint64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_uint64)
+  return _internal_mutable_unknown_map_field_uint64();
+}
+
+// map<int32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_int32 = 202;
+inline int TestEnumMap::_internal_unknown_map_field_int32_size() const {
+  return _internal_unknown_map_field_int32().size();
+}
+inline int TestEnumMap::unknown_map_field_int32_size() const {
+  return _internal_unknown_map_field_int32_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_int32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_int32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_int32)
+  return _internal_unknown_map_field_int32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_int32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_int32)
+  return _internal_mutable_unknown_map_field_int32();
+}
+
+// map<uint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_uint32 = 203;
+inline int TestEnumMap::_internal_unknown_map_field_uint32_size() const {
+  return _internal_unknown_map_field_uint32().size();
+}
+inline int TestEnumMap::unknown_map_field_uint32_size() const {
+  return _internal_unknown_map_field_uint32_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_uint32_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint32_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_uint32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_uint32)
+  return _internal_unknown_map_field_uint32();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint32_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_uint32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_uint32)
+  return _internal_mutable_unknown_map_field_uint32();
+}
+
+// map<fixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed32 = 204;
+inline int TestEnumMap::_internal_unknown_map_field_fixed32_size() const {
+  return _internal_unknown_map_field_fixed32().size();
+}
+inline int TestEnumMap::unknown_map_field_fixed32_size() const {
+  return _internal_unknown_map_field_fixed32_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_fixed32_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed32_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_fixed32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_fixed32)
+  return _internal_unknown_map_field_fixed32();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed32_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_fixed32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_fixed32)
+  return _internal_mutable_unknown_map_field_fixed32();
+}
+
+// map<fixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_fixed64 = 205;
+inline int TestEnumMap::_internal_unknown_map_field_fixed64_size() const {
+  return _internal_unknown_map_field_fixed64().size();
+}
+inline int TestEnumMap::unknown_map_field_fixed64_size() const {
+  return _internal_unknown_map_field_fixed64_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_fixed64_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed64_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_fixed64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_fixed64)
+  return _internal_unknown_map_field_fixed64();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed64_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_fixed64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_fixed64)
+  return _internal_mutable_unknown_map_field_fixed64();
+}
+
+// map<bool, .protobuf_unittest.Proto2MapEnum> unknown_map_field_bool = 206;
+inline int TestEnumMap::_internal_unknown_map_field_bool_size() const {
+  return _internal_unknown_map_field_bool().size();
+}
+inline int TestEnumMap::unknown_map_field_bool_size() const {
+  return _internal_unknown_map_field_bool_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_bool_.Clear();
+}
+inline const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_bool_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_bool() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_bool)
+  return _internal_unknown_map_field_bool();
+}
+inline ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_bool_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_bool() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_bool)
+  return _internal_mutable_unknown_map_field_bool();
+}
+
+// map<string, .protobuf_unittest.Proto2MapEnum> unknown_map_field_string = 207;
+inline int TestEnumMap::_internal_unknown_map_field_string_size() const {
+  return _internal_unknown_map_field_string().size();
+}
+inline int TestEnumMap::unknown_map_field_string_size() const {
+  return _internal_unknown_map_field_string_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_string_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_string_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_string)
+  return _internal_unknown_map_field_string();
+}
+inline ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_string_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_string)
+  return _internal_mutable_unknown_map_field_string();
+}
+
+// map<sint32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint32 = 208;
+inline int TestEnumMap::_internal_unknown_map_field_sint32_size() const {
+  return _internal_unknown_map_field_sint32().size();
+}
+inline int TestEnumMap::unknown_map_field_sint32_size() const {
+  return _internal_unknown_map_field_sint32_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sint32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_sint32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_sint32)
+  return _internal_unknown_map_field_sint32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_sint32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_sint32)
+  return _internal_mutable_unknown_map_field_sint32();
+}
+
+// map<sint64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sint64 = 209;
+inline int TestEnumMap::_internal_unknown_map_field_sint64_size() const {
+  return _internal_unknown_map_field_sint64().size();
+}
+inline int TestEnumMap::unknown_map_field_sint64_size() const {
+  return _internal_unknown_map_field_sint64_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sint64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_sint64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_sint64)
+  return _internal_unknown_map_field_sint64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_sint64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_sint64)
+  return _internal_mutable_unknown_map_field_sint64();
+}
+
+// map<sfixed32, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed32 = 210;
+inline int TestEnumMap::_internal_unknown_map_field_sfixed32_size() const {
+  return _internal_unknown_map_field_sfixed32().size();
+}
+inline int TestEnumMap::unknown_map_field_sfixed32_size() const {
+  return _internal_unknown_map_field_sfixed32_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sfixed32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_sfixed32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_sfixed32)
+  return _internal_unknown_map_field_sfixed32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_sfixed32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_sfixed32)
+  return _internal_mutable_unknown_map_field_sfixed32();
+}
+
+// map<sfixed64, .protobuf_unittest.Proto2MapEnum> unknown_map_field_sfixed64 = 211;
+inline int TestEnumMap::_internal_unknown_map_field_sfixed64_size() const {
+  return _internal_unknown_map_field_sfixed64().size();
+}
+inline int TestEnumMap::unknown_map_field_sfixed64_size() const {
+  return _internal_unknown_map_field_sfixed64_size();
+}
+inline void TestEnumMap::clear_unknown_map_field_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sfixed64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::_internal_unknown_map_field_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>& TestEnumMap::unknown_map_field_sfixed64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMap.unknown_map_field_sfixed64)
+  return _internal_unknown_map_field_sfixed64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::_internal_mutable_unknown_map_field_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnum>* TestEnumMap::mutable_unknown_map_field_sfixed64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMap.unknown_map_field_sfixed64)
+  return _internal_mutable_unknown_map_field_sfixed64();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestEnumMapPlusExtra
+
+// map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> known_map_field = 101;
+inline int TestEnumMapPlusExtra::_internal_known_map_field_size() const {
+  return _internal_known_map_field().size();
+}
+inline int TestEnumMapPlusExtra::known_map_field_size() const {
+  return _internal_known_map_field_size();
+}
+inline void TestEnumMapPlusExtra::clear_known_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.known_map_field_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_known_map_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.known_map_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::known_map_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.known_map_field)
+  return _internal_known_map_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_known_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.known_map_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_known_map_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.known_map_field)
+  return _internal_mutable_known_map_field();
+}
+
+// map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field = 102;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_size() const {
+  return _internal_unknown_map_field().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_size() const {
+  return _internal_unknown_map_field_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field)
+  return _internal_unknown_map_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field)
+  return _internal_mutable_unknown_map_field();
+}
+
+// map<int64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int64 = 200;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_int64_size() const {
+  return _internal_unknown_map_field_int64().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_int64_size() const {
+  return _internal_unknown_map_field_int64_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_int64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_int64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_int64)
+  return _internal_unknown_map_field_int64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_int64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_int64)
+  return _internal_mutable_unknown_map_field_int64();
+}
+
+// map<uint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint64 = 201;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_uint64_size() const {
+  return _internal_unknown_map_field_uint64().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_uint64_size() const {
+  return _internal_unknown_map_field_uint64_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_uint64_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint64_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_uint64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_uint64)
+  return _internal_unknown_map_field_uint64();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint64_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_uint64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_uint64)
+  return _internal_mutable_unknown_map_field_uint64();
+}
+
+// map<int32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_int32 = 202;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_int32_size() const {
+  return _internal_unknown_map_field_int32().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_int32_size() const {
+  return _internal_unknown_map_field_int32_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_int32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_int32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_int32)
+  return _internal_unknown_map_field_int32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_int32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_int32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_int32)
+  return _internal_mutable_unknown_map_field_int32();
+}
+
+// map<uint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_uint32 = 203;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_uint32_size() const {
+  return _internal_unknown_map_field_uint32().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_uint32_size() const {
+  return _internal_unknown_map_field_uint32_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_uint32_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint32_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_uint32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_uint32)
+  return _internal_unknown_map_field_uint32();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_uint32_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_uint32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_uint32)
+  return _internal_mutable_unknown_map_field_uint32();
+}
+
+// map<fixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed32 = 204;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_fixed32_size() const {
+  return _internal_unknown_map_field_fixed32().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_fixed32_size() const {
+  return _internal_unknown_map_field_fixed32_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_fixed32_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed32_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_fixed32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_fixed32)
+  return _internal_unknown_map_field_fixed32();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed32_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_fixed32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_fixed32)
+  return _internal_mutable_unknown_map_field_fixed32();
+}
+
+// map<fixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_fixed64 = 205;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_fixed64_size() const {
+  return _internal_unknown_map_field_fixed64().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_fixed64_size() const {
+  return _internal_unknown_map_field_fixed64_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_fixed64_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed64_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_fixed64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_fixed64)
+  return _internal_unknown_map_field_fixed64();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_fixed64_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_fixed64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_fixed64)
+  return _internal_mutable_unknown_map_field_fixed64();
+}
+
+// map<bool, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_bool = 206;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_bool_size() const {
+  return _internal_unknown_map_field_bool().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_bool_size() const {
+  return _internal_unknown_map_field_bool_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_bool_.Clear();
+}
+inline const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_bool_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_bool() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_bool)
+  return _internal_unknown_map_field_bool();
+}
+inline ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_bool_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_bool() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_bool)
+  return _internal_mutable_unknown_map_field_bool();
+}
+
+// map<string, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_string = 207;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_string_size() const {
+  return _internal_unknown_map_field_string().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_string_size() const {
+  return _internal_unknown_map_field_string_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_string_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_string_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_string)
+  return _internal_unknown_map_field_string();
+}
+inline ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_string_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_string)
+  return _internal_mutable_unknown_map_field_string();
+}
+
+// map<sint32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint32 = 208;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_sint32_size() const {
+  return _internal_unknown_map_field_sint32().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_sint32_size() const {
+  return _internal_unknown_map_field_sint32_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sint32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_sint32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sint32)
+  return _internal_unknown_map_field_sint32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_sint32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sint32)
+  return _internal_mutable_unknown_map_field_sint32();
+}
+
+// map<sint64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sint64 = 209;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_sint64_size() const {
+  return _internal_unknown_map_field_sint64().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_sint64_size() const {
+  return _internal_unknown_map_field_sint64_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sint64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_sint64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sint64)
+  return _internal_unknown_map_field_sint64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sint64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_sint64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sint64)
+  return _internal_mutable_unknown_map_field_sint64();
+}
+
+// map<sfixed32, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed32 = 210;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_sfixed32_size() const {
+  return _internal_unknown_map_field_sfixed32().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_sfixed32_size() const {
+  return _internal_unknown_map_field_sfixed32_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sfixed32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_sfixed32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sfixed32)
+  return _internal_unknown_map_field_sfixed32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_sfixed32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sfixed32)
+  return _internal_mutable_unknown_map_field_sfixed32();
+}
+
+// map<sfixed64, .protobuf_unittest.Proto2MapEnumPlusExtra> unknown_map_field_sfixed64 = 211;
+inline int TestEnumMapPlusExtra::_internal_unknown_map_field_sfixed64_size() const {
+  return _internal_unknown_map_field_sfixed64().size();
+}
+inline int TestEnumMapPlusExtra::unknown_map_field_sfixed64_size() const {
+  return _internal_unknown_map_field_sfixed64_size();
+}
+inline void TestEnumMapPlusExtra::clear_unknown_map_field_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.unknown_map_field_sfixed64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::_internal_unknown_map_field_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>& TestEnumMapPlusExtra::unknown_map_field_sfixed64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sfixed64)
+  return _internal_unknown_map_field_sfixed64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::_internal_mutable_unknown_map_field_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.unknown_map_field_sfixed64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::Proto2MapEnumPlusExtra>* TestEnumMapPlusExtra::mutable_unknown_map_field_sfixed64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtra.unknown_map_field_sfixed64)
+  return _internal_mutable_unknown_map_field_sfixed64();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestImportEnumMap
+
+// map<int32, .protobuf_unittest_import.ImportEnumForMap> import_enum_amp = 1;
+inline int TestImportEnumMap::_internal_import_enum_amp_size() const {
+  return _internal_import_enum_amp().size();
+}
+inline int TestImportEnumMap::import_enum_amp_size() const {
+  return _internal_import_enum_amp_size();
+}
+inline void TestImportEnumMap::clear_import_enum_amp() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.import_enum_amp_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>& TestImportEnumMap::_internal_import_enum_amp() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.import_enum_amp_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>& TestImportEnumMap::import_enum_amp() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestImportEnumMap.import_enum_amp)
+  return _internal_import_enum_amp();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>* TestImportEnumMap::_internal_mutable_import_enum_amp() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.import_enum_amp_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest_import::ImportEnumForMap>* TestImportEnumMap::mutable_import_enum_amp() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestImportEnumMap.import_enum_amp)
+  return _internal_mutable_import_enum_amp();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestIntIntMap
+
+// map<int32, int32> m = 1;
+inline int TestIntIntMap::_internal_m_size() const {
+  return _internal_m().size();
+}
+inline int TestIntIntMap::m_size() const {
+  return _internal_m_size();
+}
+inline void TestIntIntMap::clear_m() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& TestIntIntMap::_internal_m() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& TestIntIntMap::m() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestIntIntMap.m)
+  return _internal_m();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* TestIntIntMap::_internal_mutable_m() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* TestIntIntMap::mutable_m() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestIntIntMap.m)
+  return _internal_mutable_m();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMaps
+
+// map<int32, .protobuf_unittest.TestIntIntMap> m_int32 = 1;
+inline int TestMaps::_internal_m_int32_size() const {
+  return _internal_m_int32().size();
+}
+inline int TestMaps::m_int32_size() const {
+  return _internal_m_int32_size();
+}
+inline void TestMaps::clear_m_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_int32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_int32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_int32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_int32)
+  return _internal_m_int32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_int32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_int32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_int32)
+  return _internal_mutable_m_int32();
+}
+
+// map<int64, .protobuf_unittest.TestIntIntMap> m_int64 = 2;
+inline int TestMaps::_internal_m_int64_size() const {
+  return _internal_m_int64().size();
+}
+inline int TestMaps::m_int64_size() const {
+  return _internal_m_int64_size();
+}
+inline void TestMaps::clear_m_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_int64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_int64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_int64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_int64)
+  return _internal_m_int64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_int64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_int64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_int64)
+  return _internal_mutable_m_int64();
+}
+
+// map<uint32, .protobuf_unittest.TestIntIntMap> m_uint32 = 3;
+inline int TestMaps::_internal_m_uint32_size() const {
+  return _internal_m_uint32().size();
+}
+inline int TestMaps::m_uint32_size() const {
+  return _internal_m_uint32_size();
+}
+inline void TestMaps::clear_m_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_uint32_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_uint32_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_uint32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_uint32)
+  return _internal_m_uint32();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_uint32_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_uint32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_uint32)
+  return _internal_mutable_m_uint32();
+}
+
+// map<uint64, .protobuf_unittest.TestIntIntMap> m_uint64 = 4;
+inline int TestMaps::_internal_m_uint64_size() const {
+  return _internal_m_uint64().size();
+}
+inline int TestMaps::m_uint64_size() const {
+  return _internal_m_uint64_size();
+}
+inline void TestMaps::clear_m_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_uint64_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_uint64_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_uint64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_uint64)
+  return _internal_m_uint64();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_uint64_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_uint64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_uint64)
+  return _internal_mutable_m_uint64();
+}
+
+// map<sint32, .protobuf_unittest.TestIntIntMap> m_sint32 = 5;
+inline int TestMaps::_internal_m_sint32_size() const {
+  return _internal_m_sint32().size();
+}
+inline int TestMaps::m_sint32_size() const {
+  return _internal_m_sint32_size();
+}
+inline void TestMaps::clear_m_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_sint32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_sint32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_sint32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_sint32)
+  return _internal_m_sint32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_sint32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_sint32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_sint32)
+  return _internal_mutable_m_sint32();
+}
+
+// map<sint64, .protobuf_unittest.TestIntIntMap> m_sint64 = 6;
+inline int TestMaps::_internal_m_sint64_size() const {
+  return _internal_m_sint64().size();
+}
+inline int TestMaps::m_sint64_size() const {
+  return _internal_m_sint64_size();
+}
+inline void TestMaps::clear_m_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_sint64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_sint64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_sint64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_sint64)
+  return _internal_m_sint64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_sint64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_sint64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_sint64)
+  return _internal_mutable_m_sint64();
+}
+
+// map<fixed32, .protobuf_unittest.TestIntIntMap> m_fixed32 = 7;
+inline int TestMaps::_internal_m_fixed32_size() const {
+  return _internal_m_fixed32().size();
+}
+inline int TestMaps::m_fixed32_size() const {
+  return _internal_m_fixed32_size();
+}
+inline void TestMaps::clear_m_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_fixed32_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_fixed32_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_fixed32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_fixed32)
+  return _internal_m_fixed32();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_fixed32_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_fixed32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_fixed32)
+  return _internal_mutable_m_fixed32();
+}
+
+// map<fixed64, .protobuf_unittest.TestIntIntMap> m_fixed64 = 8;
+inline int TestMaps::_internal_m_fixed64_size() const {
+  return _internal_m_fixed64().size();
+}
+inline int TestMaps::m_fixed64_size() const {
+  return _internal_m_fixed64_size();
+}
+inline void TestMaps::clear_m_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_fixed64_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_fixed64_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_fixed64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_fixed64)
+  return _internal_m_fixed64();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_fixed64_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_fixed64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_fixed64)
+  return _internal_mutable_m_fixed64();
+}
+
+// map<sfixed32, .protobuf_unittest.TestIntIntMap> m_sfixed32 = 9;
+inline int TestMaps::_internal_m_sfixed32_size() const {
+  return _internal_m_sfixed32().size();
+}
+inline int TestMaps::m_sfixed32_size() const {
+  return _internal_m_sfixed32_size();
+}
+inline void TestMaps::clear_m_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_sfixed32_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_sfixed32_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_sfixed32() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_sfixed32)
+  return _internal_m_sfixed32();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_sfixed32_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_sfixed32() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_sfixed32)
+  return _internal_mutable_m_sfixed32();
+}
+
+// map<sfixed64, .protobuf_unittest.TestIntIntMap> m_sfixed64 = 10;
+inline int TestMaps::_internal_m_sfixed64_size() const {
+  return _internal_m_sfixed64().size();
+}
+inline int TestMaps::m_sfixed64_size() const {
+  return _internal_m_sfixed64_size();
+}
+inline void TestMaps::clear_m_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_sfixed64_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_sfixed64_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_sfixed64() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_sfixed64)
+  return _internal_m_sfixed64();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_sfixed64_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_sfixed64() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_sfixed64)
+  return _internal_mutable_m_sfixed64();
+}
+
+// map<bool, .protobuf_unittest.TestIntIntMap> m_bool = 11;
+inline int TestMaps::_internal_m_bool_size() const {
+  return _internal_m_bool().size();
+}
+inline int TestMaps::m_bool_size() const {
+  return _internal_m_bool_size();
+}
+inline void TestMaps::clear_m_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_bool_.Clear();
+}
+inline const ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_bool_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_bool() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_bool)
+  return _internal_m_bool();
+}
+inline ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_bool_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_bool() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_bool)
+  return _internal_mutable_m_bool();
+}
+
+// map<string, .protobuf_unittest.TestIntIntMap> m_string = 12;
+inline int TestMaps::_internal_m_string_size() const {
+  return _internal_m_string().size();
+}
+inline int TestMaps::m_string_size() const {
+  return _internal_m_string_size();
+}
+inline void TestMaps::clear_m_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.m_string_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>& TestMaps::_internal_m_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.m_string_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>& TestMaps::m_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMaps.m_string)
+  return _internal_m_string();
+}
+inline ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>* TestMaps::_internal_mutable_m_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.m_string_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::protobuf_unittest::TestIntIntMap>* TestMaps::mutable_m_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMaps.m_string)
+  return _internal_mutable_m_string();
+}
+
+// -------------------------------------------------------------------
+
+// TestSubmessageMaps
+
+// optional .protobuf_unittest.TestMaps m = 1;
+inline bool TestSubmessageMaps::has_m() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.m_ != nullptr);
+  return value;
+}
+inline void TestSubmessageMaps::clear_m() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.m_ != nullptr) _impl_.m_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestMaps& TestSubmessageMaps::_internal_m() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestMaps* p = _impl_.m_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestMaps&>(::protobuf_unittest::_TestMaps_default_instance_);
+}
+inline const ::protobuf_unittest::TestMaps& TestSubmessageMaps::m() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestSubmessageMaps.m)
+  return _internal_m();
+}
+inline void TestSubmessageMaps::unsafe_arena_set_allocated_m(::protobuf_unittest::TestMaps* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.m_);
+  }
+  _impl_.m_ = reinterpret_cast<::protobuf_unittest::TestMaps*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestSubmessageMaps.m)
+}
+inline ::protobuf_unittest::TestMaps* TestSubmessageMaps::release_m() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestMaps* released = _impl_.m_;
+  _impl_.m_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestMaps* TestSubmessageMaps::unsafe_arena_release_m() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestSubmessageMaps.m)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestMaps* temp = _impl_.m_;
+  _impl_.m_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestMaps* TestSubmessageMaps::_internal_mutable_m() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.m_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestMaps>(GetArena());
+    _impl_.m_ = reinterpret_cast<::protobuf_unittest::TestMaps*>(p);
+  }
+  return _impl_.m_;
+}
+inline ::protobuf_unittest::TestMaps* TestSubmessageMaps::mutable_m() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestMaps* _msg = _internal_mutable_m();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestSubmessageMaps.m)
+  return _msg;
+}
+inline void TestSubmessageMaps::set_allocated_m(::protobuf_unittest::TestMaps* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestMaps*>(_impl_.m_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestMaps*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.m_ = reinterpret_cast<::protobuf_unittest::TestMaps*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestSubmessageMaps.m)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestProto2BytesMap
+
+// map<int32, bytes> map_bytes = 1;
+inline int TestProto2BytesMap::_internal_map_bytes_size() const {
+  return _internal_map_bytes().size();
+}
+inline int TestProto2BytesMap::map_bytes_size() const {
+  return _internal_map_bytes_size();
+}
+inline void TestProto2BytesMap::clear_map_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_bytes_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto2BytesMap::_internal_map_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_bytes_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto2BytesMap::map_bytes() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestProto2BytesMap.map_bytes)
+  return _internal_map_bytes();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto2BytesMap::_internal_mutable_map_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_bytes_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto2BytesMap::mutable_map_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestProto2BytesMap.map_bytes)
+  return _internal_mutable_map_bytes();
+}
+
+// map<int32, string> map_string = 2;
+inline int TestProto2BytesMap::_internal_map_string_size() const {
+  return _internal_map_string().size();
+}
+inline int TestProto2BytesMap::map_string_size() const {
+  return _internal_map_string_size();
+}
+inline void TestProto2BytesMap::clear_map_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_string_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto2BytesMap::_internal_map_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_string_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto2BytesMap::map_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestProto2BytesMap.map_string)
+  return _internal_map_string();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto2BytesMap::_internal_mutable_map_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_string_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto2BytesMap::mutable_map_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestProto2BytesMap.map_string)
+  return _internal_mutable_map_string();
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::protobuf_unittest::Proto2MapEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::Proto2MapEnum>() {
+  return ::protobuf_unittest::Proto2MapEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::Proto2MapEnumPlusExtra> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::Proto2MapEnumPlusExtra>() {
+  return ::protobuf_unittest::Proto2MapEnumPlusExtra_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5fproto2_5funittest_2eproto_2epb_2eh
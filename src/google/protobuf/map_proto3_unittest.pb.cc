@@ -0,0 +1,445 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_proto3_unittest.proto
+
+#include "google/protobuf/map_proto3_unittest.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace proto3_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR TestProto3BytesMap_MapStringEntry_DoNotUse::TestProto3BytesMap_MapStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestProto3BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestProto3BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestProto3BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestProto3BytesMap_MapStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestProto3BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal _TestProto3BytesMap_MapStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestProto3BytesMap_MapBytesEntry_DoNotUse::TestProto3BytesMap_MapBytesEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestProto3BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestProto3BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestProto3BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestProto3BytesMap_MapBytesEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestProto3BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal _TestProto3BytesMap_MapBytesEntry_DoNotUse_default_instance_;
+
+inline constexpr TestProto3BytesMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_bytes_{},
+        map_string_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestProto3BytesMap::TestProto3BytesMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestProto3BytesMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestProto3BytesMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestProto3BytesMapDefaultTypeInternal() {}
+  union {
+    TestProto3BytesMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestProto3BytesMapDefaultTypeInternal _TestProto3BytesMap_default_instance_;
+}  // namespace proto3_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto[3];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapBytesEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapBytesEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapBytesEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapBytesEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap_MapStringEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap, _impl_.map_bytes_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestProto3BytesMap, _impl_.map_string_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 10, -1, sizeof(::proto3_unittest::TestProto3BytesMap_MapBytesEntry_DoNotUse)},
+        {12, 22, -1, sizeof(::proto3_unittest::TestProto3BytesMap_MapStringEntry_DoNotUse)},
+        {24, -1, -1, sizeof(::proto3_unittest::TestProto3BytesMap)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::proto3_unittest::_TestProto3BytesMap_MapBytesEntry_DoNotUse_default_instance_._instance,
+    &::proto3_unittest::_TestProto3BytesMap_MapStringEntry_DoNotUse_default_instance_._instance,
+    &::proto3_unittest::_TestProto3BytesMap_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n)google/protobuf/map_proto3_unittest.pr"
+    "oto\022\017proto3_unittest\"\205\002\n\022TestProto3Bytes"
+    "Map\022D\n\tmap_bytes\030\001 \003(\01321.proto3_unittest"
+    ".TestProto3BytesMap.MapBytesEntry\022F\n\nmap"
+    "_string\030\002 \003(\01322.proto3_unittest.TestProt"
+    "o3BytesMap.MapStringEntry\032/\n\rMapBytesEnt"
+    "ry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\014:\0028\001\0320\n\016Ma"
+    "pStringEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\t"
+    ":\0028\001B\005\222\003\002\010\002b\010editionsp\350\007"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto = {
+    false,
+    false,
+    344,
+    descriptor_table_protodef_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto,
+    "google/protobuf/map_proto3_unittest.proto",
+    &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_once,
+    nullptr,
+    0,
+    3,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto(&descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto);
+namespace proto3_unittest {
+// ===================================================================
+
+TestProto3BytesMap_MapBytesEntry_DoNotUse::TestProto3BytesMap_MapBytesEntry_DoNotUse() {}
+TestProto3BytesMap_MapBytesEntry_DoNotUse::TestProto3BytesMap_MapBytesEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestProto3BytesMap_MapBytesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto[0]);
+}
+// ===================================================================
+
+TestProto3BytesMap_MapStringEntry_DoNotUse::TestProto3BytesMap_MapStringEntry_DoNotUse() {}
+TestProto3BytesMap_MapStringEntry_DoNotUse::TestProto3BytesMap_MapStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestProto3BytesMap_MapStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto[1]);
+}
+// ===================================================================
+
+class TestProto3BytesMap::_Internal {
+ public:
+};
+
+TestProto3BytesMap::TestProto3BytesMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3_unittest.TestProto3BytesMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestProto3BytesMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_bytes_{visibility, arena, from.map_bytes_},
+        map_string_{visibility, arena, from.map_string_},
+        _cached_size_{0} {}
+
+TestProto3BytesMap::TestProto3BytesMap(
+    ::google::protobuf::Arena* arena,
+    const TestProto3BytesMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestProto3BytesMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3_unittest.TestProto3BytesMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestProto3BytesMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_bytes_{visibility, arena},
+        map_string_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestProto3BytesMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestProto3BytesMap::~TestProto3BytesMap() {
+  // @@protoc_insertion_point(destructor:proto3_unittest.TestProto3BytesMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestProto3BytesMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestProto3BytesMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3_unittest.TestProto3BytesMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_bytes_.Clear();
+  _impl_.map_string_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestProto3BytesMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 2, 53, 2> TestProto3BytesMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestProto3BytesMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, bytes> map_bytes = 1;
+    {PROTOBUF_FIELD_OFFSET(TestProto3BytesMap, _impl_.map_bytes_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, string> map_string = 2;
+    {PROTOBUF_FIELD_OFFSET(TestProto3BytesMap, _impl_.map_string_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestProto3BytesMap()._impl_.map_bytes_)>(
+        1, 0, 0, 5,
+        12)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestProto3BytesMap()._impl_.map_string_)>(
+        1, 0, 0, 5,
+        9)},
+  }}, {{
+    "\42\0\12\0\0\0\0\0"
+    "proto3_unittest.TestProto3BytesMap"
+    "map_string"
+  }},
+};
+
+::uint8_t* TestProto3BytesMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3_unittest.TestProto3BytesMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, bytes> map_bytes = 1;
+  if (!_internal_map_bytes().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>;
+    const auto& field = _internal_map_bytes();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, string> map_string = 2;
+  if (!_internal_map_string().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3_unittest.TestProto3BytesMap.map_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3_unittest.TestProto3BytesMap.map_string");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3_unittest.TestProto3BytesMap)
+  return target;
+}
+
+::size_t TestProto3BytesMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3_unittest.TestProto3BytesMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, bytes> map_bytes = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_bytes_size());
+  for (const auto& entry : _internal_map_bytes()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, string> map_string = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_string_size());
+  for (const auto& entry : _internal_map_string()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestProto3BytesMap::_class_data_ = {
+    TestProto3BytesMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestProto3BytesMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestProto3BytesMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestProto3BytesMap*>(&to_msg);
+  auto& from = static_cast<const TestProto3BytesMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3_unittest.TestProto3BytesMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_bytes_.MergeFrom(from._impl_.map_bytes_);
+  _this->_impl_.map_string_.MergeFrom(from._impl_.map_string_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestProto3BytesMap::CopyFrom(const TestProto3BytesMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3_unittest.TestProto3BytesMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestProto3BytesMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestProto3BytesMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestProto3BytesMap::InternalSwap(TestProto3BytesMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_bytes_.InternalSwap(&other->_impl_.map_bytes_);
+  _impl_.map_string_.InternalSwap(&other->_impl_.map_string_);
+}
+
+::google::protobuf::Metadata TestProto3BytesMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto[2]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
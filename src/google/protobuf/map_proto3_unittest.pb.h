@@ -0,0 +1,430 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_proto3_unittest.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/map.h"  // IWYU pragma: export
+#include "google/protobuf/map_entry.h"
+#include "google/protobuf/map_field_inl.h"
+#include "google/protobuf/unknown_field_set.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto;
+namespace proto3_unittest {
+class TestProto3BytesMap;
+struct TestProto3BytesMapDefaultTypeInternal;
+extern TestProto3BytesMapDefaultTypeInternal _TestProto3BytesMap_default_instance_;
+class TestProto3BytesMap_MapBytesEntry_DoNotUse;
+struct TestProto3BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal;
+extern TestProto3BytesMap_MapBytesEntry_DoNotUseDefaultTypeInternal _TestProto3BytesMap_MapBytesEntry_DoNotUse_default_instance_;
+class TestProto3BytesMap_MapStringEntry_DoNotUse;
+struct TestProto3BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal;
+extern TestProto3BytesMap_MapStringEntry_DoNotUseDefaultTypeInternal _TestProto3BytesMap_MapStringEntry_DoNotUse_default_instance_;
+}  // namespace proto3_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace proto3_unittest {
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestProto3BytesMap_MapStringEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestProto3BytesMap_MapStringEntry_DoNotUse, ::int32_t, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestProto3BytesMap_MapStringEntry_DoNotUse, ::int32_t, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  TestProto3BytesMap_MapStringEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto3BytesMap_MapStringEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestProto3BytesMap_MapStringEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestProto3BytesMap_MapStringEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestProto3BytesMap_MapStringEntry_DoNotUse*>(
+        &_TestProto3BytesMap_MapStringEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3_unittest.TestProto3BytesMap.MapStringEntry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestProto3BytesMap_MapBytesEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestProto3BytesMap_MapBytesEntry_DoNotUse, ::int32_t, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BYTES> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestProto3BytesMap_MapBytesEntry_DoNotUse, ::int32_t, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BYTES>;
+  TestProto3BytesMap_MapBytesEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto3BytesMap_MapBytesEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestProto3BytesMap_MapBytesEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestProto3BytesMap_MapBytesEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestProto3BytesMap_MapBytesEntry_DoNotUse*>(
+        &_TestProto3BytesMap_MapBytesEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestProto3BytesMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestProto3BytesMap) */ {
+ public:
+  inline TestProto3BytesMap() : TestProto3BytesMap(nullptr) {}
+  ~TestProto3BytesMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto3BytesMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestProto3BytesMap(const TestProto3BytesMap& from)
+      : TestProto3BytesMap(nullptr, from) {}
+  TestProto3BytesMap(TestProto3BytesMap&& from) noexcept
+    : TestProto3BytesMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestProto3BytesMap& operator=(const TestProto3BytesMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestProto3BytesMap& operator=(TestProto3BytesMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestProto3BytesMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestProto3BytesMap* internal_default_instance() {
+    return reinterpret_cast<const TestProto3BytesMap*>(
+               &_TestProto3BytesMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestProto3BytesMap& a, TestProto3BytesMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestProto3BytesMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestProto3BytesMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestProto3BytesMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestProto3BytesMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestProto3BytesMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestProto3BytesMap& from) {
+    TestProto3BytesMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestProto3BytesMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestProto3BytesMap";
+  }
+  protected:
+  explicit TestProto3BytesMap(::google::protobuf::Arena* arena);
+  TestProto3BytesMap(::google::protobuf::Arena* arena, const TestProto3BytesMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapBytesFieldNumber = 1,
+    kMapStringFieldNumber = 2,
+  };
+  // map<int32, bytes> map_bytes = 1;
+  int map_bytes_size() const;
+  private:
+  int _internal_map_bytes_size() const;
+
+  public:
+  void clear_map_bytes() ;
+  const ::google::protobuf::Map<::int32_t, std::string>& map_bytes() const;
+  ::google::protobuf::Map<::int32_t, std::string>* mutable_map_bytes();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, std::string>& _internal_map_bytes() const;
+  ::google::protobuf::Map<::int32_t, std::string>* _internal_mutable_map_bytes();
+
+  public:
+  // map<int32, string> map_string = 2;
+  int map_string_size() const;
+  private:
+  int _internal_map_string_size() const;
+
+  public:
+  void clear_map_string() ;
+  const ::google::protobuf::Map<::int32_t, std::string>& map_string() const;
+  ::google::protobuf::Map<::int32_t, std::string>* mutable_map_string();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, std::string>& _internal_map_string() const;
+  ::google::protobuf::Map<::int32_t, std::string>* _internal_mutable_map_string();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestProto3BytesMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 2, 2,
+      53, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestProto3BytesMap_MapBytesEntry_DoNotUse, ::int32_t, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BYTES>
+        map_bytes_;
+    ::google::protobuf::internal::MapField<TestProto3BytesMap_MapStringEntry_DoNotUse, ::int32_t, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map_string_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestProto3BytesMap
+
+// map<int32, bytes> map_bytes = 1;
+inline int TestProto3BytesMap::_internal_map_bytes_size() const {
+  return _internal_map_bytes().size();
+}
+inline int TestProto3BytesMap::map_bytes_size() const {
+  return _internal_map_bytes_size();
+}
+inline void TestProto3BytesMap::clear_map_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_bytes_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto3BytesMap::_internal_map_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_bytes_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto3BytesMap::map_bytes() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3_unittest.TestProto3BytesMap.map_bytes)
+  return _internal_map_bytes();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto3BytesMap::_internal_mutable_map_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_bytes_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto3BytesMap::mutable_map_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3_unittest.TestProto3BytesMap.map_bytes)
+  return _internal_mutable_map_bytes();
+}
+
+// map<int32, string> map_string = 2;
+inline int TestProto3BytesMap::_internal_map_string_size() const {
+  return _internal_map_string().size();
+}
+inline int TestProto3BytesMap::map_string_size() const {
+  return _internal_map_string_size();
+}
+inline void TestProto3BytesMap::clear_map_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_string_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto3BytesMap::_internal_map_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_string_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& TestProto3BytesMap::map_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3_unittest.TestProto3BytesMap.map_string)
+  return _internal_map_string();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto3BytesMap::_internal_mutable_map_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_string_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* TestProto3BytesMap::mutable_map_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3_unittest.TestProto3BytesMap.map_string)
+  return _internal_mutable_map_string();
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3_unittest
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5fproto3_5funittest_2eproto_2epb_2eh
@@ -0,0 +1,5442 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_unittest.proto
+
+#include "google/protobuf/map_unittest.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR TestSameTypeMap_Map2Entry_DoNotUse::TestSameTypeMap_Map2Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestSameTypeMap_Map2Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestSameTypeMap_Map2Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestSameTypeMap_Map2Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestSameTypeMap_Map2Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestSameTypeMap_Map2Entry_DoNotUseDefaultTypeInternal _TestSameTypeMap_Map2Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestSameTypeMap_Map1Entry_DoNotUse::TestSameTypeMap_Map1Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestSameTypeMap_Map1Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestSameTypeMap_Map1Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestSameTypeMap_Map1Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestSameTypeMap_Map1Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestSameTypeMap_Map1Entry_DoNotUseDefaultTypeInternal _TestSameTypeMap_Map1Entry_DoNotUse_default_instance_;
+
+inline constexpr TestRecursiveMapMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : a_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestRecursiveMapMessage::TestRecursiveMapMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestRecursiveMapMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestRecursiveMapMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestRecursiveMapMessageDefaultTypeInternal() {}
+  union {
+    TestRecursiveMapMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestRecursiveMapMessageDefaultTypeInternal _TestRecursiveMapMessage_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestRecursiveMapMessage_AEntry_DoNotUse::TestRecursiveMapMessage_AEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestRecursiveMapMessage_AEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestRecursiveMapMessage_AEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestRecursiveMapMessage_AEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestRecursiveMapMessage_AEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestRecursiveMapMessage_AEntry_DoNotUseDefaultTypeInternal _TestRecursiveMapMessage_AEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapUint64Uint64Entry_DoNotUse::TestMap_MapUint64Uint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapUint64Uint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal _TestMap_MapUint64Uint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapUint32Uint32Entry_DoNotUse::TestMap_MapUint32Uint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapUint32Uint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal _TestMap_MapUint32Uint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapStringStringEntry_DoNotUse::TestMap_MapStringStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapStringStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapStringStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapStringStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapStringStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapStringStringEntry_DoNotUseDefaultTypeInternal _TestMap_MapStringStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapSint64Sint64Entry_DoNotUse::TestMap_MapSint64Sint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapSint64Sint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal _TestMap_MapSint64Sint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapSint32Sint32Entry_DoNotUse::TestMap_MapSint32Sint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapSint32Sint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal _TestMap_MapSint32Sint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapSfixed64Sfixed64Entry_DoNotUse::TestMap_MapSfixed64Sfixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapSfixed64Sfixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal _TestMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapSfixed32Sfixed32Entry_DoNotUse::TestMap_MapSfixed32Sfixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapSfixed32Sfixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal _TestMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt64Int64Entry_DoNotUse::TestMap_MapInt64Int64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt64Int64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal _TestMap_MapInt64Int64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32Int32Entry_DoNotUse::TestMap_MapInt32Int32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32Int32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal _TestMap_MapInt32Int32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32FloatEntry_DoNotUse::TestMap_MapInt32FloatEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32FloatEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32FloatEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32EnumEntry_DoNotUse::TestMap_MapInt32EnumEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32EnumEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32EnumEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32DoubleEntry_DoNotUse::TestMap_MapInt32DoubleEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32DoubleEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32DoubleEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32BytesEntry_DoNotUse::TestMap_MapInt32BytesEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32BytesEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32BytesEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapFixed64Fixed64Entry_DoNotUse::TestMap_MapFixed64Fixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapFixed64Fixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal _TestMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapFixed32Fixed32Entry_DoNotUse::TestMap_MapFixed32Fixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapFixed32Fixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal _TestMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapBoolBoolEntry_DoNotUse::TestMap_MapBoolBoolEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapBoolBoolEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal _TestMap_MapBoolBoolEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapUint64Uint64Entry_DoNotUse::TestArenaMap_MapUint64Uint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapUint64Uint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapUint64Uint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapUint32Uint32Entry_DoNotUse::TestArenaMap_MapUint32Uint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapUint32Uint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapUint32Uint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapStringStringEntry_DoNotUse::TestArenaMap_MapStringStringEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapStringStringEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapStringStringEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapStringStringEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapStringStringEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapStringStringEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapStringStringEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapSint64Sint64Entry_DoNotUse::TestArenaMap_MapSint64Sint64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapSint64Sint64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSint64Sint64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapSint32Sint32Entry_DoNotUse::TestArenaMap_MapSint32Sint32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapSint32Sint32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSint32Sint32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt64Int64Entry_DoNotUse::TestArenaMap_MapInt64Int64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt64Int64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt64Int64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt32Int32Entry_DoNotUse::TestArenaMap_MapInt32Int32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt32Int32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32Int32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt32FloatEntry_DoNotUse::TestArenaMap_MapInt32FloatEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt32FloatEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32FloatEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt32EnumEntry_DoNotUse::TestArenaMap_MapInt32EnumEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt32EnumEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32EnumEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt32DoubleEntry_DoNotUse::TestArenaMap_MapInt32DoubleEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt32DoubleEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32DoubleEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt32BytesEntry_DoNotUse::TestArenaMap_MapInt32BytesEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt32BytesEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32BytesEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapFixed64Fixed64Entry_DoNotUse::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapFixed64Fixed64Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapFixed32Fixed32Entry_DoNotUse::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapFixed32Fixed32Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapBoolBoolEntry_DoNotUse::TestArenaMap_MapBoolBoolEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapBoolBoolEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapBoolBoolEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MessageContainingMapCalledEntry_EntryEntry_DoNotUse::MessageContainingMapCalledEntry_EntryEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MessageContainingMapCalledEntry_EntryEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageContainingMapCalledEntry_EntryEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageContainingMapCalledEntry_EntryEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MessageContainingMapCalledEntry_EntryEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageContainingMapCalledEntry_EntryEntry_DoNotUseDefaultTypeInternal _MessageContainingMapCalledEntry_EntryEntry_DoNotUse_default_instance_;
+
+inline constexpr MessageContainingEnumCalledType::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : type_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MessageContainingEnumCalledType::MessageContainingEnumCalledType(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MessageContainingEnumCalledTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageContainingEnumCalledTypeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageContainingEnumCalledTypeDefaultTypeInternal() {}
+  union {
+    MessageContainingEnumCalledType _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageContainingEnumCalledTypeDefaultTypeInternal _MessageContainingEnumCalledType_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MessageContainingEnumCalledType_TypeEntry_DoNotUse::MessageContainingEnumCalledType_TypeEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MessageContainingEnumCalledType_TypeEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageContainingEnumCalledType_TypeEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageContainingEnumCalledType_TypeEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MessageContainingEnumCalledType_TypeEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageContainingEnumCalledType_TypeEntry_DoNotUseDefaultTypeInternal _MessageContainingEnumCalledType_TypeEntry_DoNotUse_default_instance_;
+
+inline constexpr TestSameTypeMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map1_{},
+        map2_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestSameTypeMap::TestSameTypeMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestSameTypeMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestSameTypeMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestSameTypeMapDefaultTypeInternal() {}
+  union {
+    TestSameTypeMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestSameTypeMapDefaultTypeInternal _TestSameTypeMap_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapStringForeignMessageEntry_DoNotUse::TestMap_MapStringForeignMessageEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapStringForeignMessageEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapStringForeignMessageEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapStringForeignMessageEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapStringForeignMessageEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapStringForeignMessageEntry_DoNotUseDefaultTypeInternal _TestMap_MapStringForeignMessageEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32ForeignMessageEntry_DoNotUse::TestMap_MapInt32ForeignMessageEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32ForeignMessageEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestArenaMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+
+inline constexpr MessageContainingMapCalledEntry::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : entry_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MessageContainingMapCalledEntry::MessageContainingMapCalledEntry(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MessageContainingMapCalledEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageContainingMapCalledEntryDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageContainingMapCalledEntryDefaultTypeInternal() {}
+  union {
+    MessageContainingMapCalledEntry _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageContainingMapCalledEntryDefaultTypeInternal _MessageContainingMapCalledEntry_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestRequiredMessageMap_MapFieldEntry_DoNotUse::TestRequiredMessageMap_MapFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestRequiredMessageMap_MapFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestRequiredMessageMap_MapFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestRequiredMessageMap_MapFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestRequiredMessageMap_MapFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestRequiredMessageMap_MapFieldEntry_DoNotUseDefaultTypeInternal _TestRequiredMessageMap_MapFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMessageMap_MapInt32MessageEntry_DoNotUse::TestMessageMap_MapInt32MessageEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMessageMap_MapInt32MessageEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageMap_MapInt32MessageEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageMap_MapInt32MessageEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMessageMap_MapInt32MessageEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageMap_MapInt32MessageEntry_DoNotUseDefaultTypeInternal _TestMessageMap_MapInt32MessageEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_MapInt32AllTypesEntry_DoNotUse::TestMap_MapInt32AllTypesEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_MapInt32AllTypesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_MapInt32AllTypesEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_MapInt32AllTypesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_MapInt32AllTypesEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_MapInt32AllTypesEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32AllTypesEntry_DoNotUse_default_instance_;
+
+inline constexpr TestArenaMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_int32_int32_{},
+        map_int64_int64_{},
+        map_uint32_uint32_{},
+        map_uint64_uint64_{},
+        map_sint32_sint32_{},
+        map_sint64_sint64_{},
+        map_fixed32_fixed32_{},
+        map_fixed64_fixed64_{},
+        map_sfixed32_sfixed32_{},
+        map_sfixed64_sfixed64_{},
+        map_int32_float_{},
+        map_int32_double_{},
+        map_bool_bool_{},
+        map_string_string_{},
+        map_int32_bytes_{},
+        map_int32_enum_{},
+        map_int32_foreign_message_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestArenaMap::TestArenaMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestArenaMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestArenaMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestArenaMapDefaultTypeInternal() {}
+  union {
+    TestArenaMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestArenaMapDefaultTypeInternal _TestArenaMap_default_instance_;
+
+inline constexpr TestRequiredMessageMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_field_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestRequiredMessageMap::TestRequiredMessageMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestRequiredMessageMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestRequiredMessageMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestRequiredMessageMapDefaultTypeInternal() {}
+  union {
+    TestRequiredMessageMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestRequiredMessageMapDefaultTypeInternal _TestRequiredMessageMap_default_instance_;
+
+inline constexpr TestMessageMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_int32_message_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageMap::TestMessageMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageMapDefaultTypeInternal() {}
+  union {
+    TestMessageMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageMapDefaultTypeInternal _TestMessageMap_default_instance_;
+
+inline constexpr TestMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_int32_int32_{},
+        map_int64_int64_{},
+        map_uint32_uint32_{},
+        map_uint64_uint64_{},
+        map_sint32_sint32_{},
+        map_sint64_sint64_{},
+        map_fixed32_fixed32_{},
+        map_fixed64_fixed64_{},
+        map_sfixed32_sfixed32_{},
+        map_sfixed64_sfixed64_{},
+        map_int32_float_{},
+        map_int32_double_{},
+        map_bool_bool_{},
+        map_string_string_{},
+        map_int32_bytes_{},
+        map_int32_enum_{},
+        map_int32_foreign_message_{},
+        map_string_foreign_message_{},
+        map_int32_all_types_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMap::TestMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMapDefaultTypeInternal() {}
+  union {
+    TestMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMapDefaultTypeInternal _TestMap_default_instance_;
+
+inline constexpr TestMapSubmessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        test_map_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMapSubmessage::TestMapSubmessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMapSubmessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMapSubmessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMapSubmessageDefaultTypeInternal() {}
+  union {
+    TestMapSubmessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMapSubmessageDefaultTypeInternal _TestMapSubmessage_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[52];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2fmap_5funittest_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2fmap_5funittest_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_int32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int64_int64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_uint32_uint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_uint64_uint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_sint32_sint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_sint64_sint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_fixed32_fixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_fixed64_fixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_sfixed32_sfixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_sfixed64_sfixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_float_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_double_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_bool_bool_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_string_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_bytes_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_enum_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_foreign_message_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_string_foreign_message_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMap, _impl_.map_int32_all_types_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMapSubmessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMapSubmessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMapSubmessage, _impl_.test_map_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageMap, _impl_.map_int32_message_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap, _impl_.map1_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestSameTypeMap, _impl_.map2_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredMessageMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredMessageMap, _impl_.map_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int32_int32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int64_int64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_uint32_uint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_uint64_uint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_sint32_sint32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_sint64_sint64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_fixed32_fixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_fixed64_fixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_sfixed32_sfixed32_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_sfixed64_sfixed64_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int32_float_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int32_double_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_bool_bool_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_string_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int32_bytes_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int32_enum_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestArenaMap, _impl_.map_int32_foreign_message_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingEnumCalledType, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingEnumCalledType, _impl_.type_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingMapCalledEntry, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MessageContainingMapCalledEntry, _impl_.entry_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursiveMapMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursiveMapMessage, _impl_.a_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 10, -1, sizeof(::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse)},
+        {12, 22, -1, sizeof(::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse)},
+        {24, 34, -1, sizeof(::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse)},
+        {36, 46, -1, sizeof(::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse)},
+        {48, 58, -1, sizeof(::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse)},
+        {60, 70, -1, sizeof(::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse)},
+        {72, 82, -1, sizeof(::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse)},
+        {84, 94, -1, sizeof(::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse)},
+        {96, 106, -1, sizeof(::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse)},
+        {108, 118, -1, sizeof(::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse)},
+        {120, 130, -1, sizeof(::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse)},
+        {132, 142, -1, sizeof(::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse)},
+        {144, 154, -1, sizeof(::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse)},
+        {156, 166, -1, sizeof(::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse)},
+        {168, 178, -1, sizeof(::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse)},
+        {180, 190, -1, sizeof(::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse)},
+        {192, 202, -1, sizeof(::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse)},
+        {204, 214, -1, sizeof(::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse)},
+        {216, 226, -1, sizeof(::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse)},
+        {228, -1, -1, sizeof(::protobuf_unittest::TestMap)},
+        {255, 264, -1, sizeof(::protobuf_unittest::TestMapSubmessage)},
+        {265, 275, -1, sizeof(::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse)},
+        {277, -1, -1, sizeof(::protobuf_unittest::TestMessageMap)},
+        {286, 296, -1, sizeof(::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse)},
+        {298, 308, -1, sizeof(::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse)},
+        {310, -1, -1, sizeof(::protobuf_unittest::TestSameTypeMap)},
+        {320, 330, -1, sizeof(::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse)},
+        {332, -1, -1, sizeof(::protobuf_unittest::TestRequiredMessageMap)},
+        {341, 351, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse)},
+        {353, 363, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse)},
+        {365, 375, -1, sizeof(::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse)},
+        {377, 387, -1, sizeof(::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse)},
+        {389, 399, -1, sizeof(::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse)},
+        {401, 411, -1, sizeof(::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse)},
+        {413, 423, -1, sizeof(::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse)},
+        {425, 435, -1, sizeof(::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse)},
+        {437, 447, -1, sizeof(::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse)},
+        {449, 459, -1, sizeof(::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse)},
+        {461, 471, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse)},
+        {473, 483, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse)},
+        {485, 495, -1, sizeof(::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse)},
+        {497, 507, -1, sizeof(::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse)},
+        {509, 519, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse)},
+        {521, 531, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse)},
+        {533, 543, -1, sizeof(::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse)},
+        {545, -1, -1, sizeof(::protobuf_unittest::TestArenaMap)},
+        {570, 580, -1, sizeof(::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse)},
+        {582, -1, -1, sizeof(::protobuf_unittest::MessageContainingEnumCalledType)},
+        {591, 601, -1, sizeof(::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse)},
+        {603, -1, -1, sizeof(::protobuf_unittest::MessageContainingMapCalledEntry)},
+        {612, 622, -1, sizeof(::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse)},
+        {624, -1, -1, sizeof(::protobuf_unittest::TestRecursiveMapMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestMap_MapInt32Int32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt64Int64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapUint32Uint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapUint64Uint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapSint32Sint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapSint64Sint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt32FloatEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt32DoubleEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapBoolBoolEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapStringStringEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt32BytesEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt32EnumEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapStringForeignMessageEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_MapInt32AllTypesEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMap_default_instance_._instance,
+    &::protobuf_unittest::_TestMapSubmessage_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageMap_MapInt32MessageEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageMap_default_instance_._instance,
+    &::protobuf_unittest::_TestSameTypeMap_Map1Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestSameTypeMap_Map2Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestSameTypeMap_default_instance_._instance,
+    &::protobuf_unittest::_TestRequiredMessageMap_MapFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestRequiredMessageMap_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt32Int32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt64Int64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapUint32Uint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapUint64Uint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapSint32Sint32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapSint64Sint64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt32FloatEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt32DoubleEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapBoolBoolEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapStringStringEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt32BytesEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt32EnumEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestArenaMap_default_instance_._instance,
+    &::protobuf_unittest::_MessageContainingEnumCalledType_TypeEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MessageContainingEnumCalledType_default_instance_._instance,
+    &::protobuf_unittest::_MessageContainingMapCalledEntry_EntryEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MessageContainingMapCalledEntry_default_instance_._instance,
+    &::protobuf_unittest::_TestRecursiveMapMessage_AEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestRecursiveMapMessage_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2fmap_5funittest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n\"google/protobuf/map_unittest.proto\022\021pr"
+    "otobuf_unittest\032\036google/protobuf/unittes"
+    "t.proto\"\377\024\n\007TestMap\022F\n\017map_int32_int32\030\001"
+    " \003(\0132-.protobuf_unittest.TestMap.MapInt3"
+    "2Int32Entry\022F\n\017map_int64_int64\030\002 \003(\0132-.p"
+    "rotobuf_unittest.TestMap.MapInt64Int64En"
+    "try\022J\n\021map_uint32_uint32\030\003 \003(\0132/.protobu"
+    "f_unittest.TestMap.MapUint32Uint32Entry\022"
+    "J\n\021map_uint64_uint64\030\004 \003(\0132/.protobuf_un"
+    "ittest.TestMap.MapUint64Uint64Entry\022J\n\021m"
+    "ap_sint32_sint32\030\005 \003(\0132/.protobuf_unitte"
+    "st.TestMap.MapSint32Sint32Entry\022J\n\021map_s"
+    "int64_sint64\030\006 \003(\0132/.protobuf_unittest.T"
+    "estMap.MapSint64Sint64Entry\022N\n\023map_fixed"
+    "32_fixed32\030\007 \003(\01321.protobuf_unittest.Tes"
+    "tMap.MapFixed32Fixed32Entry\022N\n\023map_fixed"
+    "64_fixed64\030\010 \003(\01321.protobuf_unittest.Tes"
+    "tMap.MapFixed64Fixed64Entry\022R\n\025map_sfixe"
+    "d32_sfixed32\030\t \003(\01323.protobuf_unittest.T"
+    "estMap.MapSfixed32Sfixed32Entry\022R\n\025map_s"
+    "fixed64_sfixed64\030\n \003(\01323.protobuf_unitte"
+    "st.TestMap.MapSfixed64Sfixed64Entry\022F\n\017m"
+    "ap_int32_float\030\013 \003(\0132-.protobuf_unittest"
+    ".TestMap.MapInt32FloatEntry\022H\n\020map_int32"
+    "_double\030\014 \003(\0132..protobuf_unittest.TestMa"
+    "p.MapInt32DoubleEntry\022B\n\rmap_bool_bool\030\r"
+    " \003(\0132+.protobuf_unittest.TestMap.MapBool"
+    "BoolEntry\022J\n\021map_string_string\030\016 \003(\0132/.p"
+    "rotobuf_unittest.TestMap.MapStringString"
+    "Entry\022F\n\017map_int32_bytes\030\017 \003(\0132-.protobu"
+    "f_unittest.TestMap.MapInt32BytesEntry\022D\n"
+    "\016map_int32_enum\030\020 \003(\0132,.protobuf_unittes"
+    "t.TestMap.MapInt32EnumEntry\022Y\n\031map_int32"
+    "_foreign_message\030\021 \003(\01326.protobuf_unitte"
+    "st.TestMap.MapInt32ForeignMessageEntry\022["
+    "\n\032map_string_foreign_message\030\022 \003(\01327.pro"
+    "tobuf_unittest.TestMap.MapStringForeignM"
+    "essageEntry\022M\n\023map_int32_all_types\030\023 \003(\013"
+    "20.protobuf_unittest.TestMap.MapInt32All"
+    "TypesEntry\0324\n\022MapInt32Int32Entry\022\013\n\003key\030"
+    "\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\0324\n\022MapInt64Int6"
+    "4Entry\022\013\n\003key\030\001 \001(\003\022\r\n\005value\030\002 \001(\003:\0028\001\0326"
+    "\n\024MapUint32Uint32Entry\022\013\n\003key\030\001 \001(\r\022\r\n\005v"
+    "alue\030\002 \001(\r:\0028\001\0326\n\024MapUint64Uint64Entry\022\013"
+    "\n\003key\030\001 \001(\004\022\r\n\005value\030\002 \001(\004:\0028\001\0326\n\024MapSin"
+    "t32Sint32Entry\022\013\n\003key\030\001 \001(\021\022\r\n\005value\030\002 \001"
+    "(\021:\0028\001\0326\n\024MapSint64Sint64Entry\022\013\n\003key\030\001 "
+    "\001(\022\022\r\n\005value\030\002 \001(\022:\0028\001\0328\n\026MapFixed32Fixe"
+    "d32Entry\022\013\n\003key\030\001 \001(\007\022\r\n\005value\030\002 \001(\007:\0028\001"
+    "\0328\n\026MapFixed64Fixed64Entry\022\013\n\003key\030\001 \001(\006\022"
+    "\r\n\005value\030\002 \001(\006:\0028\001\032:\n\030MapSfixed32Sfixed3"
+    "2Entry\022\013\n\003key\030\001 \001(\017\022\r\n\005value\030\002 \001(\017:\0028\001\032:"
+    "\n\030MapSfixed64Sfixed64Entry\022\013\n\003key\030\001 \001(\020\022"
+    "\r\n\005value\030\002 \001(\020:\0028\001\0324\n\022MapInt32FloatEntry"
+    "\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\002:\0028\001\0325\n\023MapI"
+    "nt32DoubleEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 "
+    "\001(\001:\0028\001\0322\n\020MapBoolBoolEntry\022\013\n\003key\030\001 \001(\010"
+    "\022\r\n\005value\030\002 \001(\010:\0028\001\0326\n\024MapStringStringEn"
+    "try\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\0324\n\022M"
+    "apInt32BytesEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030"
+    "\002 \001(\014:\0028\001\032O\n\021MapInt32EnumEntry\022\013\n\003key\030\001 "
+    "\001(\005\022)\n\005value\030\002 \001(\0162\032.protobuf_unittest.M"
+    "apEnum:\0028\001\032`\n\033MapInt32ForeignMessageEntr"
+    "y\022\013\n\003key\030\001 \001(\005\0220\n\005value\030\002 \001(\0132!.protobuf"
+    "_unittest.ForeignMessage:\0028\001\032a\n\034MapStrin"
+    "gForeignMessageEntry\022\013\n\003key\030\001 \001(\t\0220\n\005val"
+    "ue\030\002 \001(\0132!.protobuf_unittest.ForeignMess"
+    "age:\0028\001\032X\n\025MapInt32AllTypesEntry\022\013\n\003key\030"
+    "\001 \001(\005\022.\n\005value\030\002 \001(\0132\037.protobuf_unittest"
+    ".TestAllTypes:\0028\001\"A\n\021TestMapSubmessage\022,"
+    "\n\010test_map\030\001 \001(\0132\032.protobuf_unittest.Tes"
+    "tMap\"\274\001\n\016TestMessageMap\022Q\n\021map_int32_mes"
+    "sage\030\001 \003(\01326.protobuf_unittest.TestMessa"
+    "geMap.MapInt32MessageEntry\032W\n\024MapInt32Me"
+    "ssageEntry\022\013\n\003key\030\001 \001(\005\022.\n\005value\030\002 \001(\0132\037"
+    ".protobuf_unittest.TestAllTypes:\0028\001\"\343\001\n\017"
+    "TestSameTypeMap\022:\n\004map1\030\001 \003(\0132,.protobuf"
+    "_unittest.TestSameTypeMap.Map1Entry\022:\n\004m"
+    "ap2\030\002 \003(\0132,.protobuf_unittest.TestSameTy"
+    "peMap.Map2Entry\032+\n\tMap1Entry\022\013\n\003key\030\001 \001("
+    "\005\022\r\n\005value\030\002 \001(\005:\0028\001\032+\n\tMap2Entry\022\013\n\003key"
+    "\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\"\266\001\n\026TestRequir"
+    "edMessageMap\022J\n\tmap_field\030\001 \003(\01327.protob"
+    "uf_unittest.TestRequiredMessageMap.MapFi"
+    "eldEntry\032P\n\rMapFieldEntry\022\013\n\003key\030\001 \001(\005\022."
+    "\n\005value\030\002 \001(\0132\037.protobuf_unittest.TestRe"
+    "quired:\0028\001\"\360\022\n\014TestArenaMap\022K\n\017map_int32"
+    "_int32\030\001 \003(\01322.protobuf_unittest.TestAre"
+    "naMap.MapInt32Int32Entry\022K\n\017map_int64_in"
+    "t64\030\002 \003(\01322.protobuf_unittest.TestArenaM"
+    "ap.MapInt64Int64Entry\022O\n\021map_uint32_uint"
+    "32\030\003 \003(\01324.protobuf_unittest.TestArenaMa"
+    "p.MapUint32Uint32Entry\022O\n\021map_uint64_uin"
+    "t64\030\004 \003(\01324.protobuf_unittest.TestArenaM"
+    "ap.MapUint64Uint64Entry\022O\n\021map_sint32_si"
+    "nt32\030\005 \003(\01324.protobuf_unittest.TestArena"
+    "Map.MapSint32Sint32Entry\022O\n\021map_sint64_s"
+    "int64\030\006 \003(\01324.protobuf_unittest.TestAren"
+    "aMap.MapSint64Sint64Entry\022S\n\023map_fixed32"
+    "_fixed32\030\007 \003(\01326.protobuf_unittest.TestA"
+    "renaMap.MapFixed32Fixed32Entry\022S\n\023map_fi"
+    "xed64_fixed64\030\010 \003(\01326.protobuf_unittest."
+    "TestArenaMap.MapFixed64Fixed64Entry\022W\n\025m"
+    "ap_sfixed32_sfixed32\030\t \003(\01328.protobuf_un"
+    "ittest.TestArenaMap.MapSfixed32Sfixed32E"
+    "ntry\022W\n\025map_sfixed64_sfixed64\030\n \003(\01328.pr"
+    "otobuf_unittest.TestArenaMap.MapSfixed64"
+    "Sfixed64Entry\022K\n\017map_int32_float\030\013 \003(\01322"
+    ".protobuf_unittest.TestArenaMap.MapInt32"
+    "FloatEntry\022M\n\020map_int32_double\030\014 \003(\01323.p"
+    "rotobuf_unittest.TestArenaMap.MapInt32Do"
+    "ubleEntry\022G\n\rmap_bool_bool\030\r \003(\01320.proto"
+    "buf_unittest.TestArenaMap.MapBoolBoolEnt"
+    "ry\022O\n\021map_string_string\030\016 \003(\01324.protobuf"
+    "_unittest.TestArenaMap.MapStringStringEn"
+    "try\022K\n\017map_int32_bytes\030\017 \003(\01322.protobuf_"
+    "unittest.TestArenaMap.MapInt32BytesEntry"
+    "\022I\n\016map_int32_enum\030\020 \003(\01321.protobuf_unit"
+    "test.TestArenaMap.MapInt32EnumEntry\022^\n\031m"
+    "ap_int32_foreign_message\030\021 \003(\0132;.protobu"
+    "f_unittest.TestArenaMap.MapInt32ForeignM"
+    "essageEntry\0324\n\022MapInt32Int32Entry\022\013\n\003key"
+    "\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\0324\n\022MapInt64Int"
+    "64Entry\022\013\n\003key\030\001 \001(\003\022\r\n\005value\030\002 \001(\003:\0028\001\032"
+    "6\n\024MapUint32Uint32Entry\022\013\n\003key\030\001 \001(\r\022\r\n\005"
+    "value\030\002 \001(\r:\0028\001\0326\n\024MapUint64Uint64Entry\022"
+    "\013\n\003key\030\001 \001(\004\022\r\n\005value\030\002 \001(\004:\0028\001\0326\n\024MapSi"
+    "nt32Sint32Entry\022\013\n\003key\030\001 \001(\021\022\r\n\005value\030\002 "
+    "\001(\021:\0028\001\0326\n\024MapSint64Sint64Entry\022\013\n\003key\030\001"
+    " \001(\022\022\r\n\005value\030\002 \001(\022:\0028\001\0328\n\026MapFixed32Fix"
+    "ed32Entry\022\013\n\003key\030\001 \001(\007\022\r\n\005value\030\002 \001(\007:\0028"
+    "\001\0328\n\026MapFixed64Fixed64Entry\022\013\n\003key\030\001 \001(\006"
+    "\022\r\n\005value\030\002 \001(\006:\0028\001\032:\n\030MapSfixed32Sfixed"
+    "32Entry\022\013\n\003key\030\001 \001(\017\022\r\n\005value\030\002 \001(\017:\0028\001\032"
+    ":\n\030MapSfixed64Sfixed64Entry\022\013\n\003key\030\001 \001(\020"
+    "\022\r\n\005value\030\002 \001(\020:\0028\001\0324\n\022MapInt32FloatEntr"
+    "y\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\002:\0028\001\0325\n\023Map"
+    "Int32DoubleEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002"
+    " \001(\001:\0028\001\0322\n\020MapBoolBoolEntry\022\013\n\003key\030\001 \001("
+    "\010\022\r\n\005value\030\002 \001(\010:\0028\001\0326\n\024MapStringStringE"
+    "ntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\0324\n\022"
+    "MapInt32BytesEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value"
+    "\030\002 \001(\014:\0028\001\032O\n\021MapInt32EnumEntry\022\013\n\003key\030\001"
+    " \001(\005\022)\n\005value\030\002 \001(\0162\032.protobuf_unittest."
+    "MapEnum:\0028\001\032`\n\033MapInt32ForeignMessageEnt"
+    "ry\022\013\n\003key\030\001 \001(\005\0220\n\005value\030\002 \001(\0132!.protobu"
+    "f_unittest.ForeignMessage:\0028\001\"\344\001\n\037Messag"
+    "eContainingEnumCalledType\022J\n\004type\030\001 \003(\0132"
+    "<.protobuf_unittest.MessageContainingEnu"
+    "mCalledType.TypeEntry\032_\n\tTypeEntry\022\013\n\003ke"
+    "y\030\001 \001(\t\022A\n\005value\030\002 \001(\01322.protobuf_unitte"
+    "st.MessageContainingEnumCalledType:\0028\001\"\024"
+    "\n\004Type\022\014\n\010TYPE_FOO\020\000\"\235\001\n\037MessageContaini"
+    "ngMapCalledEntry\022L\n\005entry\030\001 \003(\0132=.protob"
+    "uf_unittest.MessageContainingMapCalledEn"
+    "try.EntryEntry\032,\n\nEntryEntry\022\013\n\003key\030\001 \001("
+    "\005\022\r\n\005value\030\002 \001(\005:\0028\001\"\255\001\n\027TestRecursiveMa"
+    "pMessage\022<\n\001a\030\001 \003(\01321.protobuf_unittest."
+    "TestRecursiveMapMessage.AEntry\032T\n\006AEntry"
+    "\022\013\n\003key\030\001 \001(\t\0229\n\005value\030\002 \001(\0132*.protobuf_"
+    "unittest.TestRecursiveMapMessage:\0028\001*\?\n\007"
+    "MapEnum\022\020\n\014MAP_ENUM_FOO\020\000\022\020\n\014MAP_ENUM_BA"
+    "R\020\001\022\020\n\014MAP_ENUM_BAZ\020\002B\003\370\001\001b\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2funittest_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto = {
+    false,
+    false,
+    6514,
+    descriptor_table_protodef_google_2fprotobuf_2fmap_5funittest_2eproto,
+    "google/protobuf/map_unittest.proto",
+    &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+    descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_deps,
+    1,
+    52,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2fmap_5funittest_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2fmap_5funittest_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2fmap_5funittest_2eproto(&descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+namespace protobuf_unittest {
+const ::google::protobuf::EnumDescriptor* MessageContainingEnumCalledType_Type_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2fmap_5funittest_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t MessageContainingEnumCalledType_Type_internal_data_[] = {
+    65536u, 0u, };
+bool MessageContainingEnumCalledType_Type_IsValid(int value) {
+  return 0 <= value && value <= 0;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr MessageContainingEnumCalledType_Type MessageContainingEnumCalledType::TYPE_FOO;
+constexpr MessageContainingEnumCalledType_Type MessageContainingEnumCalledType::Type_MIN;
+constexpr MessageContainingEnumCalledType_Type MessageContainingEnumCalledType::Type_MAX;
+constexpr int MessageContainingEnumCalledType::Type_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* MapEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2fmap_5funittest_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t MapEnum_internal_data_[] = {
+    196608u, 0u, };
+bool MapEnum_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+// ===================================================================
+
+TestMap_MapInt32Int32Entry_DoNotUse::TestMap_MapInt32Int32Entry_DoNotUse() {}
+TestMap_MapInt32Int32Entry_DoNotUse::TestMap_MapInt32Int32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32Int32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[0]);
+}
+// ===================================================================
+
+TestMap_MapInt64Int64Entry_DoNotUse::TestMap_MapInt64Int64Entry_DoNotUse() {}
+TestMap_MapInt64Int64Entry_DoNotUse::TestMap_MapInt64Int64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt64Int64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[1]);
+}
+// ===================================================================
+
+TestMap_MapUint32Uint32Entry_DoNotUse::TestMap_MapUint32Uint32Entry_DoNotUse() {}
+TestMap_MapUint32Uint32Entry_DoNotUse::TestMap_MapUint32Uint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapUint32Uint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[2]);
+}
+// ===================================================================
+
+TestMap_MapUint64Uint64Entry_DoNotUse::TestMap_MapUint64Uint64Entry_DoNotUse() {}
+TestMap_MapUint64Uint64Entry_DoNotUse::TestMap_MapUint64Uint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapUint64Uint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[3]);
+}
+// ===================================================================
+
+TestMap_MapSint32Sint32Entry_DoNotUse::TestMap_MapSint32Sint32Entry_DoNotUse() {}
+TestMap_MapSint32Sint32Entry_DoNotUse::TestMap_MapSint32Sint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapSint32Sint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[4]);
+}
+// ===================================================================
+
+TestMap_MapSint64Sint64Entry_DoNotUse::TestMap_MapSint64Sint64Entry_DoNotUse() {}
+TestMap_MapSint64Sint64Entry_DoNotUse::TestMap_MapSint64Sint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapSint64Sint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[5]);
+}
+// ===================================================================
+
+TestMap_MapFixed32Fixed32Entry_DoNotUse::TestMap_MapFixed32Fixed32Entry_DoNotUse() {}
+TestMap_MapFixed32Fixed32Entry_DoNotUse::TestMap_MapFixed32Fixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapFixed32Fixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[6]);
+}
+// ===================================================================
+
+TestMap_MapFixed64Fixed64Entry_DoNotUse::TestMap_MapFixed64Fixed64Entry_DoNotUse() {}
+TestMap_MapFixed64Fixed64Entry_DoNotUse::TestMap_MapFixed64Fixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapFixed64Fixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[7]);
+}
+// ===================================================================
+
+TestMap_MapSfixed32Sfixed32Entry_DoNotUse::TestMap_MapSfixed32Sfixed32Entry_DoNotUse() {}
+TestMap_MapSfixed32Sfixed32Entry_DoNotUse::TestMap_MapSfixed32Sfixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapSfixed32Sfixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[8]);
+}
+// ===================================================================
+
+TestMap_MapSfixed64Sfixed64Entry_DoNotUse::TestMap_MapSfixed64Sfixed64Entry_DoNotUse() {}
+TestMap_MapSfixed64Sfixed64Entry_DoNotUse::TestMap_MapSfixed64Sfixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapSfixed64Sfixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[9]);
+}
+// ===================================================================
+
+TestMap_MapInt32FloatEntry_DoNotUse::TestMap_MapInt32FloatEntry_DoNotUse() {}
+TestMap_MapInt32FloatEntry_DoNotUse::TestMap_MapInt32FloatEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32FloatEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[10]);
+}
+// ===================================================================
+
+TestMap_MapInt32DoubleEntry_DoNotUse::TestMap_MapInt32DoubleEntry_DoNotUse() {}
+TestMap_MapInt32DoubleEntry_DoNotUse::TestMap_MapInt32DoubleEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32DoubleEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[11]);
+}
+// ===================================================================
+
+TestMap_MapBoolBoolEntry_DoNotUse::TestMap_MapBoolBoolEntry_DoNotUse() {}
+TestMap_MapBoolBoolEntry_DoNotUse::TestMap_MapBoolBoolEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapBoolBoolEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[12]);
+}
+// ===================================================================
+
+TestMap_MapStringStringEntry_DoNotUse::TestMap_MapStringStringEntry_DoNotUse() {}
+TestMap_MapStringStringEntry_DoNotUse::TestMap_MapStringStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapStringStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[13]);
+}
+// ===================================================================
+
+TestMap_MapInt32BytesEntry_DoNotUse::TestMap_MapInt32BytesEntry_DoNotUse() {}
+TestMap_MapInt32BytesEntry_DoNotUse::TestMap_MapInt32BytesEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32BytesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[14]);
+}
+// ===================================================================
+
+TestMap_MapInt32EnumEntry_DoNotUse::TestMap_MapInt32EnumEntry_DoNotUse() {}
+TestMap_MapInt32EnumEntry_DoNotUse::TestMap_MapInt32EnumEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32EnumEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[15]);
+}
+// ===================================================================
+
+TestMap_MapInt32ForeignMessageEntry_DoNotUse::TestMap_MapInt32ForeignMessageEntry_DoNotUse() {}
+TestMap_MapInt32ForeignMessageEntry_DoNotUse::TestMap_MapInt32ForeignMessageEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32ForeignMessageEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[16]);
+}
+// ===================================================================
+
+TestMap_MapStringForeignMessageEntry_DoNotUse::TestMap_MapStringForeignMessageEntry_DoNotUse() {}
+TestMap_MapStringForeignMessageEntry_DoNotUse::TestMap_MapStringForeignMessageEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapStringForeignMessageEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[17]);
+}
+// ===================================================================
+
+TestMap_MapInt32AllTypesEntry_DoNotUse::TestMap_MapInt32AllTypesEntry_DoNotUse() {}
+TestMap_MapInt32AllTypesEntry_DoNotUse::TestMap_MapInt32AllTypesEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_MapInt32AllTypesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[18]);
+}
+// ===================================================================
+
+class TestMap::_Internal {
+ public:
+};
+
+void TestMap::clear_map_int32_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_int32_foreign_message_.Clear();
+}
+void TestMap::clear_map_string_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_string_foreign_message_.Clear();
+}
+void TestMap::clear_map_int32_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_int32_all_types_.Clear();
+}
+TestMap::TestMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_int32_int32_{visibility, arena, from.map_int32_int32_},
+        map_int64_int64_{visibility, arena, from.map_int64_int64_},
+        map_uint32_uint32_{visibility, arena, from.map_uint32_uint32_},
+        map_uint64_uint64_{visibility, arena, from.map_uint64_uint64_},
+        map_sint32_sint32_{visibility, arena, from.map_sint32_sint32_},
+        map_sint64_sint64_{visibility, arena, from.map_sint64_sint64_},
+        map_fixed32_fixed32_{visibility, arena, from.map_fixed32_fixed32_},
+        map_fixed64_fixed64_{visibility, arena, from.map_fixed64_fixed64_},
+        map_sfixed32_sfixed32_{visibility, arena, from.map_sfixed32_sfixed32_},
+        map_sfixed64_sfixed64_{visibility, arena, from.map_sfixed64_sfixed64_},
+        map_int32_float_{visibility, arena, from.map_int32_float_},
+        map_int32_double_{visibility, arena, from.map_int32_double_},
+        map_bool_bool_{visibility, arena, from.map_bool_bool_},
+        map_string_string_{visibility, arena, from.map_string_string_},
+        map_int32_bytes_{visibility, arena, from.map_int32_bytes_},
+        map_int32_enum_{visibility, arena, from.map_int32_enum_},
+        map_int32_foreign_message_{visibility, arena, from.map_int32_foreign_message_},
+        map_string_foreign_message_{visibility, arena, from.map_string_foreign_message_},
+        map_int32_all_types_{visibility, arena, from.map_int32_all_types_},
+        _cached_size_{0} {}
+
+TestMap::TestMap(
+    ::google::protobuf::Arena* arena,
+    const TestMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_int32_int32_{visibility, arena},
+        map_int64_int64_{visibility, arena},
+        map_uint32_uint32_{visibility, arena},
+        map_uint64_uint64_{visibility, arena},
+        map_sint32_sint32_{visibility, arena},
+        map_sint64_sint64_{visibility, arena},
+        map_fixed32_fixed32_{visibility, arena},
+        map_fixed64_fixed64_{visibility, arena},
+        map_sfixed32_sfixed32_{visibility, arena},
+        map_sfixed64_sfixed64_{visibility, arena},
+        map_int32_float_{visibility, arena},
+        map_int32_double_{visibility, arena},
+        map_bool_bool_{visibility, arena},
+        map_string_string_{visibility, arena},
+        map_int32_bytes_{visibility, arena},
+        map_int32_enum_{visibility, arena},
+        map_int32_foreign_message_{visibility, arena},
+        map_string_foreign_message_{visibility, arena},
+        map_int32_all_types_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMap::~TestMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_int32_int32_.Clear();
+  _impl_.map_int64_int64_.Clear();
+  _impl_.map_uint32_uint32_.Clear();
+  _impl_.map_uint64_uint64_.Clear();
+  _impl_.map_sint32_sint32_.Clear();
+  _impl_.map_sint64_sint64_.Clear();
+  _impl_.map_fixed32_fixed32_.Clear();
+  _impl_.map_fixed64_fixed64_.Clear();
+  _impl_.map_sfixed32_sfixed32_.Clear();
+  _impl_.map_sfixed64_sfixed64_.Clear();
+  _impl_.map_int32_float_.Clear();
+  _impl_.map_int32_double_.Clear();
+  _impl_.map_bool_bool_.Clear();
+  _impl_.map_string_string_.Clear();
+  _impl_.map_int32_bytes_.Clear();
+  _impl_.map_int32_enum_.Clear();
+  _impl_.map_int32_foreign_message_.Clear();
+  _impl_.map_string_foreign_message_.Clear();
+  _impl_.map_int32_all_types_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 19, 22, 93, 2> TestMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    19, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294443008,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    19,  // num_field_entries
+    22,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, int32> map_int32_int32 = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_int32_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, int64> map_int64_int64 = 2;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int64_int64_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, uint32> map_uint32_uint32 = 3;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_uint32_uint32_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, uint64> map_uint64_uint64 = 4;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_uint64_uint64_), 0, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint32, sint32> map_sint32_sint32 = 5;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_sint32_sint32_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint64, sint64> map_sint64_sint64 = 6;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_sint64_sint64_), 0, 5,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_fixed32_fixed32_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_fixed64_fixed64_), 0, 7,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_sfixed32_sfixed32_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_sfixed64_sfixed64_), 0, 9,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, float> map_int32_float = 11;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_float_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, double> map_int32_double = 12;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_double_), 0, 11,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<bool, bool> map_bool_bool = 13;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_bool_bool_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, string> map_string_string = 14;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_string_string_), 0, 13,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, bytes> map_int32_bytes = 15;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_bytes_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_enum_), 0, 15,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_foreign_message_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .protobuf_unittest.ForeignMessage> map_string_foreign_message = 18;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_string_foreign_message_), 0, 18,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.TestAllTypes> map_int32_all_types = 19;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.map_int32_all_types_), 0, 20,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_int32_)>(
+        1, 0, 0, 5,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int64_int64_)>(
+        1, 0, 0, 3,
+        3)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_uint32_uint32_)>(
+        1, 0, 0, 13,
+        13)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_uint64_uint64_)>(
+        1, 0, 0, 4,
+        4)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_sint32_sint32_)>(
+        1, 0, 0, 17,
+        17)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_sint64_sint64_)>(
+        1, 0, 0, 18,
+        18)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_fixed32_fixed32_)>(
+        1, 0, 0, 7,
+        7)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_fixed64_fixed64_)>(
+        1, 0, 0, 6,
+        6)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_sfixed32_sfixed32_)>(
+        1, 0, 0, 15,
+        15)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_sfixed64_sfixed64_)>(
+        1, 0, 0, 16,
+        16)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_float_)>(
+        1, 0, 0, 5,
+        2)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_double_)>(
+        1, 0, 0, 5,
+        1)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_bool_bool_)>(
+        1, 0, 0, 8,
+        8)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_string_string_)>(
+        1, 0, 0, 9,
+        9)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_bytes_)>(
+        1, 0, 0, 5,
+        12)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_enum_)>(
+        1, 0, 0, 5,
+        14)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_foreign_message_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::ForeignMessage>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_string_foreign_message_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::ForeignMessage>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.map_int32_all_types_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestAllTypes>},
+  }}, {{
+    "\31\0\0\0\0\0\0\0\0\0\0\0\0\0\21\0\0\0\32\0\0\0\0\0"
+    "protobuf_unittest.TestMap"
+    "map_string_string"
+    "map_string_foreign_message"
+  }},
+};
+
+::uint8_t* TestMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  if (!_internal_map_int32_int32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_map_int32_int32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, int64> map_int64_int64 = 2;
+  if (!_internal_map_int64_int64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT64>;
+    const auto& field = _internal_map_int64_int64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  if (!_internal_map_uint32_uint32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::uint32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_UINT32>;
+    const auto& field = _internal_map_uint32_uint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  if (!_internal_map_uint64_uint64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::uint64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_UINT64>;
+    const auto& field = _internal_map_uint64_uint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  if (!_internal_map_sint32_sint32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_SINT32>;
+    const auto& field = _internal_map_sint32_sint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  if (!_internal_map_sint64_sint64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_SINT64>;
+    const auto& field = _internal_map_sint64_sint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  if (!_internal_map_fixed32_fixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::uint32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_FIXED32>;
+    const auto& field = _internal_map_fixed32_fixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  if (!_internal_map_fixed64_fixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::uint64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_FIXED64>;
+    const auto& field = _internal_map_fixed64_fixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  if (!_internal_map_sfixed32_sfixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32>;
+    const auto& field = _internal_map_sfixed32_sfixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  if (!_internal_map_sfixed64_sfixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64>;
+    const auto& field = _internal_map_sfixed64_sfixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, float> map_int32_float = 11;
+  if (!_internal_map_int32_float().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, float>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, float,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_FLOAT>;
+    const auto& field = _internal_map_int32_float();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, double> map_int32_double = 12;
+  if (!_internal_map_int32_double().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, double>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, double,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_DOUBLE>;
+    const auto& field = _internal_map_int32_double();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<bool, bool> map_bool_bool = 13;
+  if (!_internal_map_bool_bool().empty()) {
+    using MapType = ::google::protobuf::Map<bool, bool>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, bool,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_BOOL>;
+    const auto& field = _internal_map_bool_bool();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            13, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            13, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, string> map_string_string = 14;
+  if (!_internal_map_string_string().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map_string_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            14, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestMap.map_string_string");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestMap.map_string_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            14, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestMap.map_string_string");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestMap.map_string_string");
+      }
+    }
+  }
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  if (!_internal_map_int32_bytes().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>;
+    const auto& field = _internal_map_int32_bytes();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            15, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            15, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+  if (!_internal_map_int32_enum().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_map_int32_enum();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            16, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            16, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+  if (!_internal_map_int32_foreign_message().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::ForeignMessage>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::ForeignMessage,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_int32_foreign_message();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            17, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            17, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, .protobuf_unittest.ForeignMessage> map_string_foreign_message = 18;
+  if (!_internal_map_string_foreign_message().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::protobuf_unittest::ForeignMessage>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::ForeignMessage,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_string_foreign_message();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            18, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestMap.map_string_foreign_message");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            18, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestMap.map_string_foreign_message");
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.TestAllTypes> map_int32_all_types = 19;
+  if (!_internal_map_int32_all_types().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestAllTypes>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestAllTypes,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_int32_all_types();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            19, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            19, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMap)
+  return target;
+}
+
+::size_t TestMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_int32_size());
+  for (const auto& entry : _internal_map_int32_int32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, int64> map_int64_int64 = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int64_int64_size());
+  for (const auto& entry : _internal_map_int64_int64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_uint32_uint32_size());
+  for (const auto& entry : _internal_map_uint32_uint32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_UINT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_uint64_uint64_size());
+  for (const auto& entry : _internal_map_uint64_uint64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_UINT64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sint32_sint32_size());
+  for (const auto& entry : _internal_map_sint32_sint32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_SINT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sint64_sint64_size());
+  for (const auto& entry : _internal_map_sint64_sint64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_SINT64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_fixed32_fixed32_size());
+  for (const auto& entry : _internal_map_fixed32_fixed32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_FIXED32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_fixed64_fixed64_size());
+  for (const auto& entry : _internal_map_fixed64_fixed64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_FIXED64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sfixed32_sfixed32_size());
+  for (const auto& entry : _internal_map_sfixed32_sfixed32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sfixed64_sfixed64_size());
+  for (const auto& entry : _internal_map_sfixed64_sfixed64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, float> map_int32_float = 11;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_float_size());
+  for (const auto& entry : _internal_map_int32_float()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, float,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_FLOAT>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, double> map_int32_double = 12;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_double_size());
+  for (const auto& entry : _internal_map_int32_double()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, double,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_DOUBLE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<bool, bool> map_bool_bool = 13;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_bool_bool_size());
+  for (const auto& entry : _internal_map_bool_bool()) {
+    total_size += _pbi::MapEntryFuncs<bool, bool,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_BOOL>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, string> map_string_string = 14;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_string_string_size());
+  for (const auto& entry : _internal_map_string_string()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, bytes> map_int32_bytes = 15;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_bytes_size());
+  for (const auto& entry : _internal_map_int32_bytes()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_enum_size());
+  for (const auto& entry : _internal_map_int32_enum()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_foreign_message_size());
+  for (const auto& entry : _internal_map_int32_foreign_message()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::ForeignMessage,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .protobuf_unittest.ForeignMessage> map_string_foreign_message = 18;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_map_string_foreign_message_size());
+  for (const auto& entry : _internal_map_string_foreign_message()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::ForeignMessage,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.TestAllTypes> map_int32_all_types = 19;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_all_types_size());
+  for (const auto& entry : _internal_map_int32_all_types()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestAllTypes,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMap::_class_data_ = {
+    TestMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMap*>(&to_msg);
+  auto& from = static_cast<const TestMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_int32_int32_.MergeFrom(from._impl_.map_int32_int32_);
+  _this->_impl_.map_int64_int64_.MergeFrom(from._impl_.map_int64_int64_);
+  _this->_impl_.map_uint32_uint32_.MergeFrom(from._impl_.map_uint32_uint32_);
+  _this->_impl_.map_uint64_uint64_.MergeFrom(from._impl_.map_uint64_uint64_);
+  _this->_impl_.map_sint32_sint32_.MergeFrom(from._impl_.map_sint32_sint32_);
+  _this->_impl_.map_sint64_sint64_.MergeFrom(from._impl_.map_sint64_sint64_);
+  _this->_impl_.map_fixed32_fixed32_.MergeFrom(from._impl_.map_fixed32_fixed32_);
+  _this->_impl_.map_fixed64_fixed64_.MergeFrom(from._impl_.map_fixed64_fixed64_);
+  _this->_impl_.map_sfixed32_sfixed32_.MergeFrom(from._impl_.map_sfixed32_sfixed32_);
+  _this->_impl_.map_sfixed64_sfixed64_.MergeFrom(from._impl_.map_sfixed64_sfixed64_);
+  _this->_impl_.map_int32_float_.MergeFrom(from._impl_.map_int32_float_);
+  _this->_impl_.map_int32_double_.MergeFrom(from._impl_.map_int32_double_);
+  _this->_impl_.map_bool_bool_.MergeFrom(from._impl_.map_bool_bool_);
+  _this->_impl_.map_string_string_.MergeFrom(from._impl_.map_string_string_);
+  _this->_impl_.map_int32_bytes_.MergeFrom(from._impl_.map_int32_bytes_);
+  _this->_impl_.map_int32_enum_.MergeFrom(from._impl_.map_int32_enum_);
+  _this->_impl_.map_int32_foreign_message_.MergeFrom(from._impl_.map_int32_foreign_message_);
+  _this->_impl_.map_string_foreign_message_.MergeFrom(from._impl_.map_string_foreign_message_);
+  _this->_impl_.map_int32_all_types_.MergeFrom(from._impl_.map_int32_all_types_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMap::CopyFrom(const TestMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMap::InternalSwap(TestMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_int32_int32_.InternalSwap(&other->_impl_.map_int32_int32_);
+  _impl_.map_int64_int64_.InternalSwap(&other->_impl_.map_int64_int64_);
+  _impl_.map_uint32_uint32_.InternalSwap(&other->_impl_.map_uint32_uint32_);
+  _impl_.map_uint64_uint64_.InternalSwap(&other->_impl_.map_uint64_uint64_);
+  _impl_.map_sint32_sint32_.InternalSwap(&other->_impl_.map_sint32_sint32_);
+  _impl_.map_sint64_sint64_.InternalSwap(&other->_impl_.map_sint64_sint64_);
+  _impl_.map_fixed32_fixed32_.InternalSwap(&other->_impl_.map_fixed32_fixed32_);
+  _impl_.map_fixed64_fixed64_.InternalSwap(&other->_impl_.map_fixed64_fixed64_);
+  _impl_.map_sfixed32_sfixed32_.InternalSwap(&other->_impl_.map_sfixed32_sfixed32_);
+  _impl_.map_sfixed64_sfixed64_.InternalSwap(&other->_impl_.map_sfixed64_sfixed64_);
+  _impl_.map_int32_float_.InternalSwap(&other->_impl_.map_int32_float_);
+  _impl_.map_int32_double_.InternalSwap(&other->_impl_.map_int32_double_);
+  _impl_.map_bool_bool_.InternalSwap(&other->_impl_.map_bool_bool_);
+  _impl_.map_string_string_.InternalSwap(&other->_impl_.map_string_string_);
+  _impl_.map_int32_bytes_.InternalSwap(&other->_impl_.map_int32_bytes_);
+  _impl_.map_int32_enum_.InternalSwap(&other->_impl_.map_int32_enum_);
+  _impl_.map_int32_foreign_message_.InternalSwap(&other->_impl_.map_int32_foreign_message_);
+  _impl_.map_string_foreign_message_.InternalSwap(&other->_impl_.map_string_foreign_message_);
+  _impl_.map_int32_all_types_.InternalSwap(&other->_impl_.map_int32_all_types_);
+}
+
+::google::protobuf::Metadata TestMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[19]);
+}
+// ===================================================================
+
+class TestMapSubmessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMapSubmessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMapSubmessage, _impl_._has_bits_);
+  static const ::protobuf_unittest::TestMap& test_map(const TestMapSubmessage* msg);
+  static void set_has_test_map(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestMap& TestMapSubmessage::_Internal::test_map(const TestMapSubmessage* msg) {
+  return *msg->_impl_.test_map_;
+}
+TestMapSubmessage::TestMapSubmessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMapSubmessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMapSubmessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestMapSubmessage::TestMapSubmessage(
+    ::google::protobuf::Arena* arena,
+    const TestMapSubmessage& from)
+    : ::google::protobuf::Message(arena) {
+  TestMapSubmessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.test_map_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestMap>(arena, *from._impl_.test_map_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMapSubmessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMapSubmessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestMapSubmessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.test_map_ = {};
+}
+TestMapSubmessage::~TestMapSubmessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMapSubmessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMapSubmessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.test_map_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMapSubmessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMapSubmessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.test_map_ != nullptr);
+    _impl_.test_map_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMapSubmessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestMapSubmessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMapSubmessage, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMapSubmessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .protobuf_unittest.TestMap test_map = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestMapSubmessage, _impl_.test_map_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .protobuf_unittest.TestMap test_map = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMapSubmessage, _impl_.test_map_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestMap>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestMapSubmessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMapSubmessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .protobuf_unittest.TestMap test_map = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::test_map(this),
+        _Internal::test_map(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMapSubmessage)
+  return target;
+}
+
+::size_t TestMapSubmessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMapSubmessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestMap test_map = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.test_map_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMapSubmessage::_class_data_ = {
+    TestMapSubmessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMapSubmessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMapSubmessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMapSubmessage*>(&to_msg);
+  auto& from = static_cast<const TestMapSubmessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMapSubmessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_test_map()->::protobuf_unittest::TestMap::MergeFrom(
+        from._internal_test_map());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMapSubmessage::CopyFrom(const TestMapSubmessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMapSubmessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMapSubmessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMapSubmessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMapSubmessage::InternalSwap(TestMapSubmessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.test_map_, other->_impl_.test_map_);
+}
+
+::google::protobuf::Metadata TestMapSubmessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[20]);
+}
+// ===================================================================
+
+TestMessageMap_MapInt32MessageEntry_DoNotUse::TestMessageMap_MapInt32MessageEntry_DoNotUse() {}
+TestMessageMap_MapInt32MessageEntry_DoNotUse::TestMessageMap_MapInt32MessageEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMessageMap_MapInt32MessageEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[21]);
+}
+// ===================================================================
+
+class TestMessageMap::_Internal {
+ public:
+};
+
+void TestMessageMap::clear_map_int32_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_int32_message_.Clear();
+}
+TestMessageMap::TestMessageMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_int32_message_{visibility, arena, from.map_int32_message_},
+        _cached_size_{0} {}
+
+TestMessageMap::TestMessageMap(
+    ::google::protobuf::Arena* arena,
+    const TestMessageMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_int32_message_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestMessageMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMessageMap::~TestMessageMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessageMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_int32_message_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 0, 2> TestMessageMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMessageMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, .protobuf_unittest.TestAllTypes> map_int32_message = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMessageMap, _impl_.map_int32_message_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMessageMap()._impl_.map_int32_message_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestAllTypes>},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestMessageMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestAllTypes> map_int32_message = 1;
+  if (!_internal_map_int32_message().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestAllTypes>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestAllTypes,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_int32_message();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageMap)
+  return target;
+}
+
+::size_t TestMessageMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestAllTypes> map_int32_message = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_message_size());
+  for (const auto& entry : _internal_map_int32_message()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestAllTypes,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageMap::_class_data_ = {
+    TestMessageMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageMap*>(&to_msg);
+  auto& from = static_cast<const TestMessageMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_int32_message_.MergeFrom(from._impl_.map_int32_message_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageMap::CopyFrom(const TestMessageMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageMap::InternalSwap(TestMessageMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_int32_message_.InternalSwap(&other->_impl_.map_int32_message_);
+}
+
+::google::protobuf::Metadata TestMessageMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[22]);
+}
+// ===================================================================
+
+TestSameTypeMap_Map1Entry_DoNotUse::TestSameTypeMap_Map1Entry_DoNotUse() {}
+TestSameTypeMap_Map1Entry_DoNotUse::TestSameTypeMap_Map1Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestSameTypeMap_Map1Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[23]);
+}
+// ===================================================================
+
+TestSameTypeMap_Map2Entry_DoNotUse::TestSameTypeMap_Map2Entry_DoNotUse() {}
+TestSameTypeMap_Map2Entry_DoNotUse::TestSameTypeMap_Map2Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestSameTypeMap_Map2Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[24]);
+}
+// ===================================================================
+
+class TestSameTypeMap::_Internal {
+ public:
+};
+
+TestSameTypeMap::TestSameTypeMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestSameTypeMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestSameTypeMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map1_{visibility, arena, from.map1_},
+        map2_{visibility, arena, from.map2_},
+        _cached_size_{0} {}
+
+TestSameTypeMap::TestSameTypeMap(
+    ::google::protobuf::Arena* arena,
+    const TestSameTypeMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestSameTypeMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestSameTypeMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestSameTypeMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map1_{visibility, arena},
+        map2_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestSameTypeMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestSameTypeMap::~TestSameTypeMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestSameTypeMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestSameTypeMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestSameTypeMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestSameTypeMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map1_.Clear();
+  _impl_.map2_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestSameTypeMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 2, 0, 2> TestSameTypeMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestSameTypeMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, int32> map1 = 1;
+    {PROTOBUF_FIELD_OFFSET(TestSameTypeMap, _impl_.map1_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, int32> map2 = 2;
+    {PROTOBUF_FIELD_OFFSET(TestSameTypeMap, _impl_.map2_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestSameTypeMap()._impl_.map1_)>(
+        1, 0, 0, 5,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestSameTypeMap()._impl_.map2_)>(
+        1, 0, 0, 5,
+        5)},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestSameTypeMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestSameTypeMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, int32> map1 = 1;
+  if (!_internal_map1().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_map1();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, int32> map2 = 2;
+  if (!_internal_map2().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_map2();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestSameTypeMap)
+  return target;
+}
+
+::size_t TestSameTypeMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestSameTypeMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> map1 = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map1_size());
+  for (const auto& entry : _internal_map1()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, int32> map2 = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map2_size());
+  for (const auto& entry : _internal_map2()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestSameTypeMap::_class_data_ = {
+    TestSameTypeMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestSameTypeMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestSameTypeMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestSameTypeMap*>(&to_msg);
+  auto& from = static_cast<const TestSameTypeMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestSameTypeMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map1_.MergeFrom(from._impl_.map1_);
+  _this->_impl_.map2_.MergeFrom(from._impl_.map2_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestSameTypeMap::CopyFrom(const TestSameTypeMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestSameTypeMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestSameTypeMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestSameTypeMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestSameTypeMap::InternalSwap(TestSameTypeMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map1_.InternalSwap(&other->_impl_.map1_);
+  _impl_.map2_.InternalSwap(&other->_impl_.map2_);
+}
+
+::google::protobuf::Metadata TestSameTypeMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[25]);
+}
+// ===================================================================
+
+TestRequiredMessageMap_MapFieldEntry_DoNotUse::TestRequiredMessageMap_MapFieldEntry_DoNotUse() {}
+TestRequiredMessageMap_MapFieldEntry_DoNotUse::TestRequiredMessageMap_MapFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestRequiredMessageMap_MapFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[26]);
+}
+// ===================================================================
+
+class TestRequiredMessageMap::_Internal {
+ public:
+};
+
+void TestRequiredMessageMap::clear_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_field_.Clear();
+}
+TestRequiredMessageMap::TestRequiredMessageMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRequiredMessageMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestRequiredMessageMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_field_{visibility, arena, from.map_field_},
+        _cached_size_{0} {}
+
+TestRequiredMessageMap::TestRequiredMessageMap(
+    ::google::protobuf::Arena* arena,
+    const TestRequiredMessageMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestRequiredMessageMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRequiredMessageMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestRequiredMessageMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_field_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestRequiredMessageMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestRequiredMessageMap::~TestRequiredMessageMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRequiredMessageMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestRequiredMessageMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestRequiredMessageMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestRequiredMessageMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_field_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestRequiredMessageMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 0, 2> TestRequiredMessageMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestRequiredMessageMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, .protobuf_unittest.TestRequired> map_field = 1;
+    {PROTOBUF_FIELD_OFFSET(TestRequiredMessageMap, _impl_.map_field_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestRequiredMessageMap()._impl_.map_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestRequired>},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestRequiredMessageMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestRequiredMessageMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestRequired> map_field = 1;
+  if (!_internal_map_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::TestRequired>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestRequired,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestRequiredMessageMap)
+  return target;
+}
+
+::size_t TestRequiredMessageMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestRequiredMessageMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestRequired> map_field = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_field_size());
+  for (const auto& entry : _internal_map_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::TestRequired,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestRequiredMessageMap::_class_data_ = {
+    TestRequiredMessageMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestRequiredMessageMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestRequiredMessageMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestRequiredMessageMap*>(&to_msg);
+  auto& from = static_cast<const TestRequiredMessageMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestRequiredMessageMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_field_.MergeFrom(from._impl_.map_field_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestRequiredMessageMap::CopyFrom(const TestRequiredMessageMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestRequiredMessageMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestRequiredMessageMap::IsInitialized() const {
+  if (!::google::protobuf::internal::AllAreInitialized(_impl_.map_field_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestRequiredMessageMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestRequiredMessageMap::InternalSwap(TestRequiredMessageMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_field_.InternalSwap(&other->_impl_.map_field_);
+}
+
+::google::protobuf::Metadata TestRequiredMessageMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[27]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt32Int32Entry_DoNotUse::TestArenaMap_MapInt32Int32Entry_DoNotUse() {}
+TestArenaMap_MapInt32Int32Entry_DoNotUse::TestArenaMap_MapInt32Int32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt32Int32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[28]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt64Int64Entry_DoNotUse::TestArenaMap_MapInt64Int64Entry_DoNotUse() {}
+TestArenaMap_MapInt64Int64Entry_DoNotUse::TestArenaMap_MapInt64Int64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt64Int64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[29]);
+}
+// ===================================================================
+
+TestArenaMap_MapUint32Uint32Entry_DoNotUse::TestArenaMap_MapUint32Uint32Entry_DoNotUse() {}
+TestArenaMap_MapUint32Uint32Entry_DoNotUse::TestArenaMap_MapUint32Uint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapUint32Uint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[30]);
+}
+// ===================================================================
+
+TestArenaMap_MapUint64Uint64Entry_DoNotUse::TestArenaMap_MapUint64Uint64Entry_DoNotUse() {}
+TestArenaMap_MapUint64Uint64Entry_DoNotUse::TestArenaMap_MapUint64Uint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapUint64Uint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[31]);
+}
+// ===================================================================
+
+TestArenaMap_MapSint32Sint32Entry_DoNotUse::TestArenaMap_MapSint32Sint32Entry_DoNotUse() {}
+TestArenaMap_MapSint32Sint32Entry_DoNotUse::TestArenaMap_MapSint32Sint32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapSint32Sint32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[32]);
+}
+// ===================================================================
+
+TestArenaMap_MapSint64Sint64Entry_DoNotUse::TestArenaMap_MapSint64Sint64Entry_DoNotUse() {}
+TestArenaMap_MapSint64Sint64Entry_DoNotUse::TestArenaMap_MapSint64Sint64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapSint64Sint64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[33]);
+}
+// ===================================================================
+
+TestArenaMap_MapFixed32Fixed32Entry_DoNotUse::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse() {}
+TestArenaMap_MapFixed32Fixed32Entry_DoNotUse::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapFixed32Fixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[34]);
+}
+// ===================================================================
+
+TestArenaMap_MapFixed64Fixed64Entry_DoNotUse::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse() {}
+TestArenaMap_MapFixed64Fixed64Entry_DoNotUse::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapFixed64Fixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[35]);
+}
+// ===================================================================
+
+TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse() {}
+TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[36]);
+}
+// ===================================================================
+
+TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse() {}
+TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[37]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt32FloatEntry_DoNotUse::TestArenaMap_MapInt32FloatEntry_DoNotUse() {}
+TestArenaMap_MapInt32FloatEntry_DoNotUse::TestArenaMap_MapInt32FloatEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt32FloatEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[38]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt32DoubleEntry_DoNotUse::TestArenaMap_MapInt32DoubleEntry_DoNotUse() {}
+TestArenaMap_MapInt32DoubleEntry_DoNotUse::TestArenaMap_MapInt32DoubleEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt32DoubleEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[39]);
+}
+// ===================================================================
+
+TestArenaMap_MapBoolBoolEntry_DoNotUse::TestArenaMap_MapBoolBoolEntry_DoNotUse() {}
+TestArenaMap_MapBoolBoolEntry_DoNotUse::TestArenaMap_MapBoolBoolEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapBoolBoolEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[40]);
+}
+// ===================================================================
+
+TestArenaMap_MapStringStringEntry_DoNotUse::TestArenaMap_MapStringStringEntry_DoNotUse() {}
+TestArenaMap_MapStringStringEntry_DoNotUse::TestArenaMap_MapStringStringEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapStringStringEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[41]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt32BytesEntry_DoNotUse::TestArenaMap_MapInt32BytesEntry_DoNotUse() {}
+TestArenaMap_MapInt32BytesEntry_DoNotUse::TestArenaMap_MapInt32BytesEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt32BytesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[42]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt32EnumEntry_DoNotUse::TestArenaMap_MapInt32EnumEntry_DoNotUse() {}
+TestArenaMap_MapInt32EnumEntry_DoNotUse::TestArenaMap_MapInt32EnumEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt32EnumEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[43]);
+}
+// ===================================================================
+
+TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse() {}
+TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[44]);
+}
+// ===================================================================
+
+class TestArenaMap::_Internal {
+ public:
+};
+
+void TestArenaMap::clear_map_int32_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_int32_foreign_message_.Clear();
+}
+TestArenaMap::TestArenaMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestArenaMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestArenaMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_int32_int32_{visibility, arena, from.map_int32_int32_},
+        map_int64_int64_{visibility, arena, from.map_int64_int64_},
+        map_uint32_uint32_{visibility, arena, from.map_uint32_uint32_},
+        map_uint64_uint64_{visibility, arena, from.map_uint64_uint64_},
+        map_sint32_sint32_{visibility, arena, from.map_sint32_sint32_},
+        map_sint64_sint64_{visibility, arena, from.map_sint64_sint64_},
+        map_fixed32_fixed32_{visibility, arena, from.map_fixed32_fixed32_},
+        map_fixed64_fixed64_{visibility, arena, from.map_fixed64_fixed64_},
+        map_sfixed32_sfixed32_{visibility, arena, from.map_sfixed32_sfixed32_},
+        map_sfixed64_sfixed64_{visibility, arena, from.map_sfixed64_sfixed64_},
+        map_int32_float_{visibility, arena, from.map_int32_float_},
+        map_int32_double_{visibility, arena, from.map_int32_double_},
+        map_bool_bool_{visibility, arena, from.map_bool_bool_},
+        map_string_string_{visibility, arena, from.map_string_string_},
+        map_int32_bytes_{visibility, arena, from.map_int32_bytes_},
+        map_int32_enum_{visibility, arena, from.map_int32_enum_},
+        map_int32_foreign_message_{visibility, arena, from.map_int32_foreign_message_},
+        _cached_size_{0} {}
+
+TestArenaMap::TestArenaMap(
+    ::google::protobuf::Arena* arena,
+    const TestArenaMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestArenaMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestArenaMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestArenaMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_int32_int32_{visibility, arena},
+        map_int64_int64_{visibility, arena},
+        map_uint32_uint32_{visibility, arena},
+        map_uint64_uint64_{visibility, arena},
+        map_sint32_sint32_{visibility, arena},
+        map_sint64_sint64_{visibility, arena},
+        map_fixed32_fixed32_{visibility, arena},
+        map_fixed64_fixed64_{visibility, arena},
+        map_sfixed32_sfixed32_{visibility, arena},
+        map_sfixed64_sfixed64_{visibility, arena},
+        map_int32_float_{visibility, arena},
+        map_int32_double_{visibility, arena},
+        map_bool_bool_{visibility, arena},
+        map_string_string_{visibility, arena},
+        map_int32_bytes_{visibility, arena},
+        map_int32_enum_{visibility, arena},
+        map_int32_foreign_message_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestArenaMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestArenaMap::~TestArenaMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestArenaMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestArenaMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestArenaMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestArenaMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_int32_int32_.Clear();
+  _impl_.map_int64_int64_.Clear();
+  _impl_.map_uint32_uint32_.Clear();
+  _impl_.map_uint64_uint64_.Clear();
+  _impl_.map_sint32_sint32_.Clear();
+  _impl_.map_sint64_sint64_.Clear();
+  _impl_.map_fixed32_fixed32_.Clear();
+  _impl_.map_fixed64_fixed64_.Clear();
+  _impl_.map_sfixed32_sfixed32_.Clear();
+  _impl_.map_sfixed64_sfixed64_.Clear();
+  _impl_.map_int32_float_.Clear();
+  _impl_.map_int32_double_.Clear();
+  _impl_.map_bool_bool_.Clear();
+  _impl_.map_string_string_.Clear();
+  _impl_.map_int32_bytes_.Clear();
+  _impl_.map_int32_enum_.Clear();
+  _impl_.map_int32_foreign_message_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestArenaMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 17, 18, 72, 2> TestArenaMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    17, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294836224,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    17,  // num_field_entries
+    18,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestArenaMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, int32> map_int32_int32 = 1;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int32_int32_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, int64> map_int64_int64 = 2;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int64_int64_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, uint32> map_uint32_uint32 = 3;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_uint32_uint32_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, uint64> map_uint64_uint64 = 4;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_uint64_uint64_), 0, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint32, sint32> map_sint32_sint32 = 5;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_sint32_sint32_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sint64, sint64> map_sint64_sint64 = 6;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_sint64_sint64_), 0, 5,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_fixed32_fixed32_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_fixed64_fixed64_), 0, 7,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_sfixed32_sfixed32_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_sfixed64_sfixed64_), 0, 9,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, float> map_int32_float = 11;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int32_float_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, double> map_int32_double = 12;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int32_double_), 0, 11,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<bool, bool> map_bool_bool = 13;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_bool_bool_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, string> map_string_string = 14;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_string_string_), 0, 13,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, bytes> map_int32_bytes = 15;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int32_bytes_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int32_enum_), 0, 15,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+    {PROTOBUF_FIELD_OFFSET(TestArenaMap, _impl_.map_int32_foreign_message_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int32_int32_)>(
+        1, 0, 0, 5,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int64_int64_)>(
+        1, 0, 0, 3,
+        3)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_uint32_uint32_)>(
+        1, 0, 0, 13,
+        13)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_uint64_uint64_)>(
+        1, 0, 0, 4,
+        4)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_sint32_sint32_)>(
+        1, 0, 0, 17,
+        17)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_sint64_sint64_)>(
+        1, 0, 0, 18,
+        18)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_fixed32_fixed32_)>(
+        1, 0, 0, 7,
+        7)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_fixed64_fixed64_)>(
+        1, 0, 0, 6,
+        6)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_sfixed32_sfixed32_)>(
+        1, 0, 0, 15,
+        15)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_sfixed64_sfixed64_)>(
+        1, 0, 0, 16,
+        16)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int32_float_)>(
+        1, 0, 0, 5,
+        2)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int32_double_)>(
+        1, 0, 0, 5,
+        1)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_bool_bool_)>(
+        1, 0, 0, 8,
+        8)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_string_string_)>(
+        1, 0, 0, 9,
+        9)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int32_bytes_)>(
+        1, 0, 0, 5,
+        12)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int32_enum_)>(
+        1, 0, 0, 5,
+        14)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestArenaMap()._impl_.map_int32_foreign_message_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::ForeignMessage>},
+  }}, {{
+    "\36\0\0\0\0\0\0\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0\0"
+    "protobuf_unittest.TestArenaMap"
+    "map_string_string"
+  }},
+};
+
+::uint8_t* TestArenaMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestArenaMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  if (!_internal_map_int32_int32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_map_int32_int32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, int64> map_int64_int64 = 2;
+  if (!_internal_map_int64_int64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT64>;
+    const auto& field = _internal_map_int64_int64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  if (!_internal_map_uint32_uint32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::uint32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_UINT32>;
+    const auto& field = _internal_map_uint32_uint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  if (!_internal_map_uint64_uint64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::uint64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_UINT64>;
+    const auto& field = _internal_map_uint64_uint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  if (!_internal_map_sint32_sint32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_SINT32>;
+    const auto& field = _internal_map_sint32_sint32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  if (!_internal_map_sint64_sint64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_SINT64>;
+    const auto& field = _internal_map_sint64_sint64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  if (!_internal_map_fixed32_fixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::uint32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_FIXED32>;
+    const auto& field = _internal_map_fixed32_fixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  if (!_internal_map_fixed64_fixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::uint64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_FIXED64>;
+    const auto& field = _internal_map_fixed64_fixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  if (!_internal_map_sfixed32_sfixed32().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32>;
+    const auto& field = _internal_map_sfixed32_sfixed32();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  if (!_internal_map_sfixed64_sfixed64().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int64_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64>;
+    const auto& field = _internal_map_sfixed64_sfixed64();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, float> map_int32_float = 11;
+  if (!_internal_map_int32_float().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, float>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, float,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_FLOAT>;
+    const auto& field = _internal_map_int32_float();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, double> map_int32_double = 12;
+  if (!_internal_map_int32_double().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, double>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, double,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_DOUBLE>;
+    const auto& field = _internal_map_int32_double();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<bool, bool> map_bool_bool = 13;
+  if (!_internal_map_bool_bool().empty()) {
+    using MapType = ::google::protobuf::Map<bool, bool>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, bool,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_BOOL>;
+    const auto& field = _internal_map_bool_bool();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            13, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            13, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, string> map_string_string = 14;
+  if (!_internal_map_string_string().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map_string_string();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            14, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestArenaMap.map_string_string");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestArenaMap.map_string_string");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            14, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestArenaMap.map_string_string");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestArenaMap.map_string_string");
+      }
+    }
+  }
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  if (!_internal_map_int32_bytes().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>;
+    const auto& field = _internal_map_int32_bytes();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            15, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            15, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+  if (!_internal_map_int32_enum().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::MapEnum>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>;
+    const auto& field = _internal_map_int32_enum();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            16, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            16, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+  if (!_internal_map_int32_foreign_message().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::protobuf_unittest::ForeignMessage>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::ForeignMessage,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_int32_foreign_message();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            17, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            17, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestArenaMap)
+  return target;
+}
+
+::size_t TestArenaMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestArenaMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_int32_size());
+  for (const auto& entry : _internal_map_int32_int32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, int64> map_int64_int64 = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int64_int64_size());
+  for (const auto& entry : _internal_map_int64_int64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_uint32_uint32_size());
+  for (const auto& entry : _internal_map_uint32_uint32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_UINT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_uint64_uint64_size());
+  for (const auto& entry : _internal_map_uint64_uint64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_UINT64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sint32_sint32_size());
+  for (const auto& entry : _internal_map_sint32_sint32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SINT32,
+                                   _pbi::WireFormatLite::TYPE_SINT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sint64_sint64_size());
+  for (const auto& entry : _internal_map_sint64_sint64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SINT64,
+                                   _pbi::WireFormatLite::TYPE_SINT64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_fixed32_fixed32_size());
+  for (const auto& entry : _internal_map_fixed32_fixed32()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::uint32_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED32,
+                                   _pbi::WireFormatLite::TYPE_FIXED32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_fixed64_fixed64_size());
+  for (const auto& entry : _internal_map_fixed64_fixed64()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::uint64_t,
+                                   _pbi::WireFormatLite::TYPE_FIXED64,
+                                   _pbi::WireFormatLite::TYPE_FIXED64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sfixed32_sfixed32_size());
+  for (const auto& entry : _internal_map_sfixed32_sfixed32()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32,
+                                   _pbi::WireFormatLite::TYPE_SFIXED32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_sfixed64_sfixed64_size());
+  for (const auto& entry : _internal_map_sfixed64_sfixed64()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int64_t,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64,
+                                   _pbi::WireFormatLite::TYPE_SFIXED64>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, float> map_int32_float = 11;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_float_size());
+  for (const auto& entry : _internal_map_int32_float()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, float,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_FLOAT>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, double> map_int32_double = 12;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_double_size());
+  for (const auto& entry : _internal_map_int32_double()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, double,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_DOUBLE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<bool, bool> map_bool_bool = 13;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_bool_bool_size());
+  for (const auto& entry : _internal_map_bool_bool()) {
+    total_size += _pbi::MapEntryFuncs<bool, bool,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_BOOL>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, string> map_string_string = 14;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_string_string_size());
+  for (const auto& entry : _internal_map_string_string()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, bytes> map_int32_bytes = 15;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_bytes_size());
+  for (const auto& entry : _internal_map_int32_bytes()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BYTES>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_enum_size());
+  for (const auto& entry : _internal_map_int32_enum()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::MapEnum,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_ENUM>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_map_int32_foreign_message_size());
+  for (const auto& entry : _internal_map_int32_foreign_message()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::protobuf_unittest::ForeignMessage,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestArenaMap::_class_data_ = {
+    TestArenaMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestArenaMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestArenaMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestArenaMap*>(&to_msg);
+  auto& from = static_cast<const TestArenaMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestArenaMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_int32_int32_.MergeFrom(from._impl_.map_int32_int32_);
+  _this->_impl_.map_int64_int64_.MergeFrom(from._impl_.map_int64_int64_);
+  _this->_impl_.map_uint32_uint32_.MergeFrom(from._impl_.map_uint32_uint32_);
+  _this->_impl_.map_uint64_uint64_.MergeFrom(from._impl_.map_uint64_uint64_);
+  _this->_impl_.map_sint32_sint32_.MergeFrom(from._impl_.map_sint32_sint32_);
+  _this->_impl_.map_sint64_sint64_.MergeFrom(from._impl_.map_sint64_sint64_);
+  _this->_impl_.map_fixed32_fixed32_.MergeFrom(from._impl_.map_fixed32_fixed32_);
+  _this->_impl_.map_fixed64_fixed64_.MergeFrom(from._impl_.map_fixed64_fixed64_);
+  _this->_impl_.map_sfixed32_sfixed32_.MergeFrom(from._impl_.map_sfixed32_sfixed32_);
+  _this->_impl_.map_sfixed64_sfixed64_.MergeFrom(from._impl_.map_sfixed64_sfixed64_);
+  _this->_impl_.map_int32_float_.MergeFrom(from._impl_.map_int32_float_);
+  _this->_impl_.map_int32_double_.MergeFrom(from._impl_.map_int32_double_);
+  _this->_impl_.map_bool_bool_.MergeFrom(from._impl_.map_bool_bool_);
+  _this->_impl_.map_string_string_.MergeFrom(from._impl_.map_string_string_);
+  _this->_impl_.map_int32_bytes_.MergeFrom(from._impl_.map_int32_bytes_);
+  _this->_impl_.map_int32_enum_.MergeFrom(from._impl_.map_int32_enum_);
+  _this->_impl_.map_int32_foreign_message_.MergeFrom(from._impl_.map_int32_foreign_message_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestArenaMap::CopyFrom(const TestArenaMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestArenaMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestArenaMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestArenaMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestArenaMap::InternalSwap(TestArenaMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_int32_int32_.InternalSwap(&other->_impl_.map_int32_int32_);
+  _impl_.map_int64_int64_.InternalSwap(&other->_impl_.map_int64_int64_);
+  _impl_.map_uint32_uint32_.InternalSwap(&other->_impl_.map_uint32_uint32_);
+  _impl_.map_uint64_uint64_.InternalSwap(&other->_impl_.map_uint64_uint64_);
+  _impl_.map_sint32_sint32_.InternalSwap(&other->_impl_.map_sint32_sint32_);
+  _impl_.map_sint64_sint64_.InternalSwap(&other->_impl_.map_sint64_sint64_);
+  _impl_.map_fixed32_fixed32_.InternalSwap(&other->_impl_.map_fixed32_fixed32_);
+  _impl_.map_fixed64_fixed64_.InternalSwap(&other->_impl_.map_fixed64_fixed64_);
+  _impl_.map_sfixed32_sfixed32_.InternalSwap(&other->_impl_.map_sfixed32_sfixed32_);
+  _impl_.map_sfixed64_sfixed64_.InternalSwap(&other->_impl_.map_sfixed64_sfixed64_);
+  _impl_.map_int32_float_.InternalSwap(&other->_impl_.map_int32_float_);
+  _impl_.map_int32_double_.InternalSwap(&other->_impl_.map_int32_double_);
+  _impl_.map_bool_bool_.InternalSwap(&other->_impl_.map_bool_bool_);
+  _impl_.map_string_string_.InternalSwap(&other->_impl_.map_string_string_);
+  _impl_.map_int32_bytes_.InternalSwap(&other->_impl_.map_int32_bytes_);
+  _impl_.map_int32_enum_.InternalSwap(&other->_impl_.map_int32_enum_);
+  _impl_.map_int32_foreign_message_.InternalSwap(&other->_impl_.map_int32_foreign_message_);
+}
+
+::google::protobuf::Metadata TestArenaMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[45]);
+}
+// ===================================================================
+
+MessageContainingEnumCalledType_TypeEntry_DoNotUse::MessageContainingEnumCalledType_TypeEntry_DoNotUse() {}
+MessageContainingEnumCalledType_TypeEntry_DoNotUse::MessageContainingEnumCalledType_TypeEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MessageContainingEnumCalledType_TypeEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[46]);
+}
+// ===================================================================
+
+class MessageContainingEnumCalledType::_Internal {
+ public:
+};
+
+MessageContainingEnumCalledType::MessageContainingEnumCalledType(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.MessageContainingEnumCalledType)
+}
+inline PROTOBUF_NDEBUG_INLINE MessageContainingEnumCalledType::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : type_{visibility, arena, from.type_},
+        _cached_size_{0} {}
+
+MessageContainingEnumCalledType::MessageContainingEnumCalledType(
+    ::google::protobuf::Arena* arena,
+    const MessageContainingEnumCalledType& from)
+    : ::google::protobuf::Message(arena) {
+  MessageContainingEnumCalledType* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.MessageContainingEnumCalledType)
+}
+inline PROTOBUF_NDEBUG_INLINE MessageContainingEnumCalledType::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : type_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void MessageContainingEnumCalledType::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MessageContainingEnumCalledType::~MessageContainingEnumCalledType() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.MessageContainingEnumCalledType)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MessageContainingEnumCalledType::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MessageContainingEnumCalledType::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.MessageContainingEnumCalledType)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.type_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MessageContainingEnumCalledType::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 62, 2> MessageContainingEnumCalledType::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MessageContainingEnumCalledType_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, .protobuf_unittest.MessageContainingEnumCalledType> type = 1;
+    {PROTOBUF_FIELD_OFFSET(MessageContainingEnumCalledType, _impl_.type_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MessageContainingEnumCalledType()._impl_.type_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::MessageContainingEnumCalledType>},
+  }}, {{
+    "\61\4\0\0\0\0\0\0"
+    "protobuf_unittest.MessageContainingEnumCalledType"
+    "type"
+  }},
+};
+
+::uint8_t* MessageContainingEnumCalledType::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.MessageContainingEnumCalledType)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, .protobuf_unittest.MessageContainingEnumCalledType> type = 1;
+  if (!_internal_type().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::protobuf_unittest::MessageContainingEnumCalledType>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::MessageContainingEnumCalledType,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_type();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.MessageContainingEnumCalledType.type");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.MessageContainingEnumCalledType.type");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.MessageContainingEnumCalledType)
+  return target;
+}
+
+::size_t MessageContainingEnumCalledType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.MessageContainingEnumCalledType)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .protobuf_unittest.MessageContainingEnumCalledType> type = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_type_size());
+  for (const auto& entry : _internal_type()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::MessageContainingEnumCalledType,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MessageContainingEnumCalledType::_class_data_ = {
+    MessageContainingEnumCalledType::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MessageContainingEnumCalledType::GetClassData() const {
+  return &_class_data_;
+}
+
+void MessageContainingEnumCalledType::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MessageContainingEnumCalledType*>(&to_msg);
+  auto& from = static_cast<const MessageContainingEnumCalledType&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.MessageContainingEnumCalledType)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.type_.MergeFrom(from._impl_.type_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MessageContainingEnumCalledType::CopyFrom(const MessageContainingEnumCalledType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.MessageContainingEnumCalledType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MessageContainingEnumCalledType::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MessageContainingEnumCalledType::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MessageContainingEnumCalledType::InternalSwap(MessageContainingEnumCalledType* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.type_.InternalSwap(&other->_impl_.type_);
+}
+
+::google::protobuf::Metadata MessageContainingEnumCalledType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[47]);
+}
+// ===================================================================
+
+MessageContainingMapCalledEntry_EntryEntry_DoNotUse::MessageContainingMapCalledEntry_EntryEntry_DoNotUse() {}
+MessageContainingMapCalledEntry_EntryEntry_DoNotUse::MessageContainingMapCalledEntry_EntryEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MessageContainingMapCalledEntry_EntryEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[48]);
+}
+// ===================================================================
+
+class MessageContainingMapCalledEntry::_Internal {
+ public:
+};
+
+MessageContainingMapCalledEntry::MessageContainingMapCalledEntry(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.MessageContainingMapCalledEntry)
+}
+inline PROTOBUF_NDEBUG_INLINE MessageContainingMapCalledEntry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : entry_{visibility, arena, from.entry_},
+        _cached_size_{0} {}
+
+MessageContainingMapCalledEntry::MessageContainingMapCalledEntry(
+    ::google::protobuf::Arena* arena,
+    const MessageContainingMapCalledEntry& from)
+    : ::google::protobuf::Message(arena) {
+  MessageContainingMapCalledEntry* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.MessageContainingMapCalledEntry)
+}
+inline PROTOBUF_NDEBUG_INLINE MessageContainingMapCalledEntry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : entry_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void MessageContainingMapCalledEntry::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MessageContainingMapCalledEntry::~MessageContainingMapCalledEntry() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.MessageContainingMapCalledEntry)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MessageContainingMapCalledEntry::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MessageContainingMapCalledEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.MessageContainingMapCalledEntry)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entry_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MessageContainingMapCalledEntry::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> MessageContainingMapCalledEntry::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MessageContainingMapCalledEntry_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, int32> entry = 1;
+    {PROTOBUF_FIELD_OFFSET(MessageContainingMapCalledEntry, _impl_.entry_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MessageContainingMapCalledEntry()._impl_.entry_)>(
+        1, 0, 0, 5,
+        5)},
+  }}, {{
+  }},
+};
+
+::uint8_t* MessageContainingMapCalledEntry::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.MessageContainingMapCalledEntry)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, int32> entry = 1;
+  if (!_internal_entry().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_entry();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.MessageContainingMapCalledEntry)
+  return target;
+}
+
+::size_t MessageContainingMapCalledEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.MessageContainingMapCalledEntry)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> entry = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_entry_size());
+  for (const auto& entry : _internal_entry()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MessageContainingMapCalledEntry::_class_data_ = {
+    MessageContainingMapCalledEntry::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MessageContainingMapCalledEntry::GetClassData() const {
+  return &_class_data_;
+}
+
+void MessageContainingMapCalledEntry::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MessageContainingMapCalledEntry*>(&to_msg);
+  auto& from = static_cast<const MessageContainingMapCalledEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.MessageContainingMapCalledEntry)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entry_.MergeFrom(from._impl_.entry_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MessageContainingMapCalledEntry::CopyFrom(const MessageContainingMapCalledEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.MessageContainingMapCalledEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MessageContainingMapCalledEntry::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MessageContainingMapCalledEntry::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MessageContainingMapCalledEntry::InternalSwap(MessageContainingMapCalledEntry* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entry_.InternalSwap(&other->_impl_.entry_);
+}
+
+::google::protobuf::Metadata MessageContainingMapCalledEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[49]);
+}
+// ===================================================================
+
+TestRecursiveMapMessage_AEntry_DoNotUse::TestRecursiveMapMessage_AEntry_DoNotUse() {}
+TestRecursiveMapMessage_AEntry_DoNotUse::TestRecursiveMapMessage_AEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestRecursiveMapMessage_AEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[50]);
+}
+// ===================================================================
+
+class TestRecursiveMapMessage::_Internal {
+ public:
+};
+
+TestRecursiveMapMessage::TestRecursiveMapMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRecursiveMapMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestRecursiveMapMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : a_{visibility, arena, from.a_},
+        _cached_size_{0} {}
+
+TestRecursiveMapMessage::TestRecursiveMapMessage(
+    ::google::protobuf::Arena* arena,
+    const TestRecursiveMapMessage& from)
+    : ::google::protobuf::Message(arena) {
+  TestRecursiveMapMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRecursiveMapMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestRecursiveMapMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : a_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestRecursiveMapMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestRecursiveMapMessage::~TestRecursiveMapMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRecursiveMapMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestRecursiveMapMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestRecursiveMapMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestRecursiveMapMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.a_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestRecursiveMapMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 51, 2> TestRecursiveMapMessage::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestRecursiveMapMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, .protobuf_unittest.TestRecursiveMapMessage> a = 1;
+    {PROTOBUF_FIELD_OFFSET(TestRecursiveMapMessage, _impl_.a_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestRecursiveMapMessage()._impl_.a_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::protobuf_unittest::TestRecursiveMapMessage>},
+  }}, {{
+    "\51\1\0\0\0\0\0\0"
+    "protobuf_unittest.TestRecursiveMapMessage"
+    "a"
+  }},
+};
+
+::uint8_t* TestRecursiveMapMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestRecursiveMapMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, .protobuf_unittest.TestRecursiveMapMessage> a = 1;
+  if (!_internal_a().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::protobuf_unittest::TestRecursiveMapMessage>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::TestRecursiveMapMessage,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_a();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestRecursiveMapMessage.a");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "protobuf_unittest.TestRecursiveMapMessage.a");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestRecursiveMapMessage)
+  return target;
+}
+
+::size_t TestRecursiveMapMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestRecursiveMapMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .protobuf_unittest.TestRecursiveMapMessage> a = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_a_size());
+  for (const auto& entry : _internal_a()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::protobuf_unittest::TestRecursiveMapMessage,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestRecursiveMapMessage::_class_data_ = {
+    TestRecursiveMapMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestRecursiveMapMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestRecursiveMapMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestRecursiveMapMessage*>(&to_msg);
+  auto& from = static_cast<const TestRecursiveMapMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestRecursiveMapMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.a_.MergeFrom(from._impl_.a_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestRecursiveMapMessage::CopyFrom(const TestRecursiveMapMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestRecursiveMapMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestRecursiveMapMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestRecursiveMapMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestRecursiveMapMessage::InternalSwap(TestRecursiveMapMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.a_.InternalSwap(&other->_impl_.a_);
+}
+
+::google::protobuf::Metadata TestRecursiveMapMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2fmap_5funittest_2eproto[51]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
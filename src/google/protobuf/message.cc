@@ -34,6 +34,7 @@
 #include "google/protobuf/parse_context.h"
 #include "google/protobuf/reflection_internal.h"
 #include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/single_pass_serializer.h"
 #include "google/protobuf/unknown_field_set.h"
 #include "google/protobuf/wire_format.h"
 #include "google/protobuf/wire_format_lite.h"
@@ -129,6 +130,18 @@ void Message::DiscardUnknownFields() {
   return ReflectionOps::DiscardUnknownFields(this);
 }
 
+bool Message::SerializeToStringSinglePass(std::string* output) const {
+  ABSL_DCHECK(IsInitialized())
+      << "Can't serialize message of type \"" << GetTypeName()
+      << "\" because it is missing required fields: "
+      << InitializationErrorString();
+  return SerializePartialToStringSinglePass(output);
+}
+
+bool Message::SerializePartialToStringSinglePass(std::string* output) const {
+  return internal::SinglePassSerializer::SerializeToString(*this, output);
+}
+
 const char* Message::_InternalParse(const char* ptr,
                                     internal::ParseContext* ctx) {
 #if defined(PROTOBUF_USE_TABLE_PARSER_ON_REFLECTION)
@@ -180,6 +180,7 @@ class ReflectionOps;           // reflection_ops.h
 class MapKeySorter;            // wire_format.cc
 class WireFormat;              // wire_format.h
 class MapFieldReflectionTest;  // map_test.cc
+class SinglePassSerializer;    // single_pass_serializer.h
 }  // namespace internal
 
 template <typename T>
@@ -303,6 +304,16 @@ class PROTOBUF_EXPORT Message : public MessageLite {
     return internal::ToIntSize(SpaceUsedLong());
   }
 
+  // Like SerializeToString(), but encodes the message in a single traversal,
+  // without calling ByteSizeLong() first.  The output is identical, and the
+  // cached sizes are not updated.  This is considerably faster for messages
+  // without generated code, such as DynamicMessage, whose regular serializer
+  // goes through reflection twice.  Generated serializers are usually
+  // faster than this for generated messages.
+  bool SerializeToStringSinglePass(std::string* output) const;
+  // Like SerializeToStringSinglePass(), but allows missing required fields.
+  bool SerializePartialToStringSinglePass(std::string* output) const;
+
   // Debugging & Testing----------------------------------------------
 
   // Generates a human-readable form of this message for debugging purposes.
@@ -1063,6 +1074,7 @@ class PROTOBUF_EXPORT Reflection final {
   friend class internal::MessageUtil;
   friend class internal::WireFormat;
   friend class internal::ReflectionOps;
+  friend class internal::SinglePassSerializer;
   friend class internal::SwapFieldHelper;
   friend struct internal::FuzzPeer;
   // Needed for implementing text format for map.
@@ -1165,6 +1177,16 @@ class PROTOBUF_EXPORT Reflection final {
 
   inline bool IsInlined(const FieldDescriptor* field) const;
 
+  // Like internal::cpp::EffectiveStringCType(), but also reports CORD for
+  // bytes fields that DynamicMessageFactory chose to store as absl::Cord.
+  template <typename FieldOpts = FieldOptions>
+  typename FieldOpts::CType EffectiveStringCType(
+      const FieldDescriptor* field) const {
+    if (schema_.IsFieldCord(field)) return FieldOpts::CORD;
+    return internal::cpp::EffectiveStringCType<FieldDescriptor, FieldOpts>(
+        field);
+  }
+
   inline bool HasBit(const Message& message,
                      const FieldDescriptor* field) const;
   inline void SetBit(Message* message, const FieldDescriptor* field) const;
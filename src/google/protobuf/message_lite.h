@@ -60,6 +60,10 @@ class ZeroCopyInputStream;
 class ZeroCopyOutputStream;
 
 }  // namespace io
+namespace json_internal {
+struct GeneratedSerializer;
+class GeneratedSerializerAccess;
+}  // namespace json_internal
 namespace internal {
 
 // Allow easy change to regular int on platforms where the atomic might have a
@@ -527,6 +531,8 @@ class PROTOBUF_EXPORT MessageLite {
     // pointer becomes the first argument in the free function.
     void (*merge_to_from)(Message& to, const Message& from_msg);
     void (*on_demand_register_arena_dtor)(MessageLite& msg, Arena& arena);
+    // Set for messages generated with the `json_serializer` option.
+    const json_internal::GeneratedSerializer* json_serializer;
   };
 
   // GetClassData() returns a pointer to a ClassData struct which
@@ -582,6 +588,7 @@ class PROTOBUF_EXPORT MessageLite {
   friend class internal::TcParser;
   friend class internal::WeakFieldMap;
   friend class internal::WireFormatLite;
+  friend class json_internal::GeneratedSerializerAccess;
 
   template <typename Type>
   friend class Arena::InternalHelper;
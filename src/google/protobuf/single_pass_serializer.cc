@@ -0,0 +1,547 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/single_pass_serializer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/log/absl_check.h"
+#include "absl/log/absl_log.h"
+#include "absl/numeric/bits.h"
+#include "absl/strings/internal/resize_uninitialized.h"
+#include "absl/strings/string_view.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"
+#include "google/protobuf/repeated_ptr_field.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "utf8_validity.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+namespace fl = field_layout;
+using FieldEntry = TcParseTableBase::FieldEntry;
+
+// An output buffer that is filled from the end towards the beginning.  The
+// bytes written so far always occupy the tail of `out`; growing the buffer
+// moves them to the tail of the larger one.  Positions are therefore kept as
+// the number of bytes written, which growing does not change.
+class ReverseWriter {
+ public:
+  explicit ReverseWriter(std::string* out) : out_(out) {
+    // Start with whatever the string has allocated already, so that
+    // serializing into the same string repeatedly does not reallocate.
+    out_->clear();
+    Grow(std::max(out_->capacity(), kInitialSize));
+  }
+
+  size_t size() const { return static_cast<size_t>(end_ - ptr_); }
+
+  // Returns a pointer to `n` bytes right before everything written so far.
+  uint8_t* Reserve(size_t n) {
+    if (PROTOBUF_PREDICT_FALSE(static_cast<size_t>(ptr_ - begin_) < n)) {
+      Grow(n);
+    }
+    ptr_ -= n;
+    return ptr_;
+  }
+
+  void WriteVarint32(uint32_t value) {
+    io::CodedOutputStream::WriteVarint32ToArray(
+        value, Reserve(io::CodedOutputStream::VarintSize32(value)));
+  }
+
+  void WriteVarint64(uint64_t value) {
+    io::CodedOutputStream::WriteVarint64ToArray(
+        value, Reserve(io::CodedOutputStream::VarintSize64(value)));
+  }
+
+  void WriteTag(uint32_t field_number, WireFormatLite::WireType type) {
+    WriteVarint32(
+        WireFormatLite::MakeTag(static_cast<int>(field_number), type));
+  }
+
+  void WriteFixed32(uint32_t value) {
+    io::CodedOutputStream::WriteLittleEndian32ToArray(value, Reserve(4));
+  }
+
+  void WriteFixed64(uint64_t value) {
+    io::CodedOutputStream::WriteLittleEndian64ToArray(value, Reserve(8));
+  }
+
+  void WriteBytes(absl::string_view bytes) {
+    memcpy(Reserve(bytes.size()), bytes.data(), bytes.size());
+  }
+
+  // Writes the length of everything written since `start` was size(),
+  // followed by `tag`.
+  void WriteLengthAndTag(size_t start, uint32_t field_number) {
+    WriteVarint32(static_cast<uint32_t>(size() - start));
+    WriteTag(field_number, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+  }
+
+  // Moves the result to the beginning of the string and drops the rest.
+  void Finish() {
+    size_t n = size();
+    memmove(begin_, ptr_, n);
+    out_->resize(n);
+  }
+
+ private:
+  static constexpr size_t kInitialSize = 256;
+
+  PROTOBUF_NOINLINE void Grow(size_t n) {
+    size_t used = size();
+    size_t old_capacity = out_->size();
+    size_t capacity = std::max(old_capacity * 2, used + n);
+    capacity = std::max(capacity, kInitialSize);
+    absl::strings_internal::STLStringResizeUninitialized(out_, capacity);
+    begin_ = reinterpret_cast<uint8_t*>(&(*out_)[0]);
+    end_ = begin_ + capacity;
+    ptr_ = end_ - used;
+    memmove(ptr_, begin_ + old_capacity - used, used);
+  }
+
+  std::string* out_;
+  uint8_t* begin_ = nullptr;
+  uint8_t* end_ = nullptr;
+  uint8_t* ptr_ = nullptr;
+};
+
+template <typename T>
+const T& RefAt(const Message& msg, uint32_t offset) {
+  return *reinterpret_cast<const T*>(reinterpret_cast<const char*>(&msg) +
+                                     offset);
+}
+
+bool HasBit(const Message& msg, uint32_t has_idx) {
+  return (RefAt<uint32_t>(msg, has_idx / 32 * 4) >> (has_idx % 32)) & 1;
+}
+
+// Returns true if the table entry can be serialized directly from the
+// message layout.  Everything else goes through WireFormat.
+bool IsSupported(uint16_t type_card) {
+  if (type_card & fl::kSplitMask) return false;
+  uint16_t rep = type_card & fl::kRepMask;
+  switch (type_card & fl::kFkMask) {
+    case fl::kFkVarint:
+    case fl::kFkPackedVarint:
+    case fl::kFkFixed:
+    case fl::kFkPackedFixed:
+      return true;
+    case fl::kFkString:
+      return rep == fl::kRepAString || rep == fl::kRepSString;
+    case fl::kFkMessage:
+      return rep == fl::kRepMessage || rep == fl::kRepGroup;
+    default:
+      return false;
+  }
+}
+
+// Converts a varint field of the given representation to the value that is
+// put on the wire.
+template <typename T>
+uint64_t VarintValue(T value, uint16_t type_card) {
+  if (sizeof(T) == 1) return value != 0;
+  if ((type_card & fl::kTvMask) == fl::kTvZigZag) {
+    return sizeof(T) == 4 ? WireFormatLite::ZigZagEncode32(
+                                static_cast<int32_t>(value))
+                          : WireFormatLite::ZigZagEncode64(
+                                static_cast<int64_t>(value));
+  }
+  if (sizeof(T) == 4 && (type_card & fl::kFmtMask) != fl::kFmtUnsigned) {
+    // int32 and enum values are sign-extended.
+    return static_cast<uint64_t>(
+        static_cast<int64_t>(static_cast<int32_t>(value)));
+  }
+  return static_cast<uint64_t>(value);
+}
+
+}  // namespace
+
+class SinglePassSerializer::Impl {
+ public:
+  explicit Impl(ReverseWriter* writer)
+      : writer_(*writer),
+        deterministic_(
+            io::CodedOutputStream::IsDefaultSerializationDeterministic()) {}
+
+  void SerializeMessage(const Message& msg);
+
+ private:
+  template <typename T>
+  void SerializeVarint(const Message& msg, const FieldEntry& entry,
+                       uint32_t field_number);
+  template <typename T>
+  void SerializeFixed(const Message& msg, const FieldEntry& entry,
+                      uint32_t field_number);
+  void SerializeString(const Message& msg, const FieldEntry& entry,
+                       uint32_t field_number);
+  void SerializeSubMessage(const Message& msg, uint32_t field_number,
+                           bool is_group);
+  void SerializeMessageField(const Message& msg, const FieldEntry& entry,
+                             uint32_t field_number);
+  void SerializeField(const Message& msg, const FieldEntry& entry,
+                      uint32_t field_number);
+
+  void SerializeFieldFallback(const Message& msg, uint32_t field_number);
+  void SerializeMessageFallback(const Message& msg);
+  void SerializeUnknownFields(const UnknownFieldSet& unknown_fields);
+  void VerifyUtf8(const Message& msg, const std::string& value,
+                  uint16_t type_card, uint32_t field_number);
+
+  io::EpsCopyOutputStream MakeStream(uint8_t* ptr, size_t size) const {
+    return io::EpsCopyOutputStream(ptr, static_cast<int>(size),
+                                   deterministic_);
+  }
+
+  ReverseWriter& writer_;
+  bool deterministic_;
+};
+
+void SinglePassSerializer::Impl::SerializeMessage(const Message& msg) {
+  const Reflection* reflection = msg.GetReflection();
+  const TcParseTableBase* table = GetTable(*reflection);
+  // Extensions are interleaved with fields by number, and tables without
+  // entries for every field only exist to delegate to reflection.
+  if (table->extension_offset != 0 ||
+      (table->num_field_entries == 0 &&
+       (msg.GetDescriptor()->field_count() != 0 ||
+        msg.GetDescriptor()->extension_range_count() != 0))) {
+    SerializeMessageFallback(msg);
+    return;
+  }
+
+  // Everything is written back to front: unknown fields first, then the
+  // fields in decreasing field number order.
+  const UnknownFieldSet& unknown_fields = reflection->GetUnknownFields(msg);
+  if (!unknown_fields.empty()) SerializeUnknownFields(unknown_fields);
+
+  // The lookup table maps field numbers to entries, which are sorted by
+  // field number.  Fields 1 to 32 are covered by `skipmap32`, in which set
+  // bits mark numbers without a field.  Larger numbers are covered by
+  // groups of {first field number, count, {skipmap, entry offset}...}, with
+  // 16 field numbers per skipmap.  Groups are only found walking forward, so
+  // collect them first.
+  const FieldEntry* entries = table->field_entries_begin();
+  uint32_t num_entries = table->num_field_entries;
+  uint32_t remaining =
+      num_entries - static_cast<uint32_t>(absl::popcount(~table->skipmap32));
+  absl::InlinedVector<const uint16_t*, 4> groups;
+  for (const uint16_t* group = table->field_lookup_begin(); remaining > 0;) {
+    groups.push_back(group);
+    uint32_t num_skip_entries = group[2];
+    for (uint32_t i = 0; i < num_skip_entries; ++i) {
+      remaining -= absl::popcount(~uint32_t{group[3 + 2 * i]} & 0xFFFF);
+    }
+    group += 3 + 2 * num_skip_entries;
+  }
+
+  uint32_t idx = num_entries;
+  for (size_t g = groups.size(); g-- > 0;) {
+    const uint16_t* group = groups[g];
+    uint32_t fstart = group[0] | (uint32_t{group[1]} << 16);
+    for (uint32_t i = group[2]; i-- > 0;) {
+      for (uint32_t present = ~uint32_t{group[3 + 2 * i]} & 0xFFFF;
+           present != 0;) {
+        uint32_t bit = 31 - absl::countl_zero(present);
+        present ^= uint32_t{1} << bit;
+        SerializeField(msg, entries[--idx], fstart + 16 * i + bit);
+      }
+    }
+  }
+  for (uint32_t present = ~table->skipmap32; present != 0;) {
+    uint32_t bit = 31 - absl::countl_zero(present);
+    present ^= uint32_t{1} << bit;
+    SerializeField(msg, entries[--idx], 1 + bit);
+  }
+  ABSL_DCHECK_EQ(idx, 0u);
+}
+
+void SinglePassSerializer::Impl::SerializeField(
+    const Message& msg, const FieldEntry& entry, uint32_t field_number) {
+  // Presence is checked first, so that absent fields never take the slow
+  // path.  Entries the table leaves empty have singular cardinality.
+  const uint16_t type_card = entry.type_card;
+  switch (type_card & fl::kFcMask) {
+    case fl::kFcOptional:
+      if (!HasBit(msg, entry.has_idx)) return;
+      break;
+    case fl::kFcOneof:
+      // The oneof case offset is stored in place of the has-bit index.
+      if (RefAt<uint32_t>(msg, entry.has_idx) != field_number) return;
+      break;
+    default:
+      break;
+  }
+  if (!IsSupported(type_card)) {
+    SerializeFieldFallback(msg, field_number);
+    return;
+  }
+
+  const uint16_t rep = type_card & fl::kRepMask;
+  switch (type_card & fl::kFkMask) {
+    case fl::kFkVarint:
+    case fl::kFkPackedVarint:
+      if (rep == fl::kRep8Bits) {
+        SerializeVarint<bool>(msg, entry, field_number);
+      } else if (rep == fl::kRep32Bits) {
+        SerializeVarint<uint32_t>(msg, entry, field_number);
+      } else {
+        SerializeVarint<uint64_t>(msg, entry, field_number);
+      }
+      break;
+    case fl::kFkFixed:
+    case fl::kFkPackedFixed:
+      if (rep == fl::kRep32Bits) {
+        SerializeFixed<uint32_t>(msg, entry, field_number);
+      } else {
+        SerializeFixed<uint64_t>(msg, entry, field_number);
+      }
+      break;
+    case fl::kFkString:
+      SerializeString(msg, entry, field_number);
+      break;
+    case fl::kFkMessage:
+      SerializeMessageField(msg, entry, field_number);
+      break;
+  }
+}
+
+template <typename T>
+void SinglePassSerializer::Impl::SerializeVarint(
+    const Message& msg, const FieldEntry& entry, uint32_t field_number) {
+  const uint16_t type_card = entry.type_card;
+  if ((type_card & fl::kFcMask) != fl::kFcRepeated) {
+    T value = RefAt<T>(msg, entry.offset);
+    // Fields without presence are only written when they are not zero.
+    if ((type_card & fl::kFcMask) == fl::kFcSingular && value == 0) return;
+    writer_.WriteVarint64(VarintValue(value, type_card));
+    writer_.WriteTag(field_number, WireFormatLite::WIRETYPE_VARINT);
+    return;
+  }
+
+  const auto& field = RefAt<RepeatedField<T>>(msg, entry.offset);
+  if (field.empty()) return;
+  const T* data = field.data();
+  if ((type_card & fl::kFkMask) == fl::kFkPackedVarint) {
+    size_t start = writer_.size();
+    for (int i = field.size(); i-- > 0;) {
+      writer_.WriteVarint64(VarintValue(data[i], type_card));
+    }
+    writer_.WriteLengthAndTag(start, field_number);
+  } else {
+    for (int i = field.size(); i-- > 0;) {
+      writer_.WriteVarint64(VarintValue(data[i], type_card));
+      writer_.WriteTag(field_number, WireFormatLite::WIRETYPE_VARINT);
+    }
+  }
+}
+
+template <typename T>
+void SinglePassSerializer::Impl::SerializeFixed(
+    const Message& msg, const FieldEntry& entry, uint32_t field_number) {
+  constexpr auto kWireType = sizeof(T) == 4 ? WireFormatLite::WIRETYPE_FIXED32
+                                            : WireFormatLite::WIRETYPE_FIXED64;
+  const uint16_t type_card = entry.type_card;
+  if ((type_card & fl::kFcMask) != fl::kFcRepeated) {
+    // Floating point values are compared by their bits, so -0.0 is written.
+    T value = RefAt<T>(msg, entry.offset);
+    if ((type_card & fl::kFcMask) == fl::kFcSingular && value == 0) return;
+    if (sizeof(T) == 4) {
+      writer_.WriteFixed32(static_cast<uint32_t>(value));
+    } else {
+      writer_.WriteFixed64(value);
+    }
+    writer_.WriteTag(field_number, kWireType);
+    return;
+  }
+
+  const auto& field = RefAt<RepeatedField<T>>(msg, entry.offset);
+  if (field.empty()) return;
+  const T* data = field.data();
+  if ((type_card & fl::kFkMask) == fl::kFkPackedFixed) {
+    size_t start = writer_.size();
+    uint8_t* ptr = writer_.Reserve(field.size() * sizeof(T));
+#ifdef ABSL_IS_LITTLE_ENDIAN
+    memcpy(ptr, data, field.size() * sizeof(T));
+#else
+    for (int i = 0; i < field.size(); ++i, ptr += sizeof(T)) {
+      if (sizeof(T) == 4) {
+        io::CodedOutputStream::WriteLittleEndian32ToArray(data[i], ptr);
+      } else {
+        io::CodedOutputStream::WriteLittleEndian64ToArray(data[i], ptr);
+      }
+    }
+#endif
+    writer_.WriteLengthAndTag(start, field_number);
+  } else {
+    for (int i = field.size(); i-- > 0;) {
+      if (sizeof(T) == 4) {
+        writer_.WriteFixed32(static_cast<uint32_t>(data[i]));
+      } else {
+        writer_.WriteFixed64(data[i]);
+      }
+      writer_.WriteTag(field_number, kWireType);
+    }
+  }
+}
+
+void SinglePassSerializer::Impl::SerializeString(
+    const Message& msg, const FieldEntry& entry, uint32_t field_number) {
+  const uint16_t type_card = entry.type_card;
+  if ((type_card & fl::kFcMask) != fl::kFcRepeated) {
+    const std::string& value = RefAt<ArenaStringPtr>(msg, entry.offset).Get();
+    if ((type_card & fl::kFcMask) == fl::kFcSingular && value.empty()) return;
+    VerifyUtf8(msg, value, type_card, field_number);
+    size_t start = writer_.size();
+    writer_.WriteBytes(value);
+    writer_.WriteLengthAndTag(start, field_number);
+    return;
+  }
+
+  const auto& field = RefAt<RepeatedPtrField<std::string>>(msg, entry.offset);
+  for (int i = field.size(); i-- > 0;) {
+    const std::string& value = field.Get(i);
+    VerifyUtf8(msg, value, type_card, field_number);
+    size_t start = writer_.size();
+    writer_.WriteBytes(value);
+    writer_.WriteLengthAndTag(start, field_number);
+  }
+}
+
+void SinglePassSerializer::Impl::SerializeSubMessage(
+    const Message& msg, uint32_t field_number, bool is_group) {
+  if (is_group) {
+    writer_.WriteTag(field_number, WireFormatLite::WIRETYPE_END_GROUP);
+    SerializeMessage(msg);
+    writer_.WriteTag(field_number, WireFormatLite::WIRETYPE_START_GROUP);
+  } else {
+    size_t start = writer_.size();
+    SerializeMessage(msg);
+    writer_.WriteLengthAndTag(start, field_number);
+  }
+}
+
+void SinglePassSerializer::Impl::SerializeMessageField(
+    const Message& msg, const FieldEntry& entry, uint32_t field_number) {
+  const bool is_group = (entry.type_card & fl::kRepMask) == fl::kRepGroup;
+  if ((entry.type_card & fl::kFcMask) != fl::kFcRepeated) {
+    const Message* value = RefAt<const Message*>(msg, entry.offset);
+    if (value == nullptr) return;
+    SerializeSubMessage(*value, field_number, is_group);
+    return;
+  }
+
+  const auto& field = RefAt<RepeatedPtrField<Message>>(msg, entry.offset);
+  for (int i = field.size(); i-- > 0;) {
+    SerializeSubMessage(field.Get(i), field_number, is_group);
+  }
+}
+
+void SinglePassSerializer::Impl::VerifyUtf8(
+    const Message& msg, const std::string& value, uint16_t type_card,
+    uint32_t field_number) {
+  // Matches the generated code: strict fields are always checked, and the
+  // others only in debug builds.  Failures are logged but not fatal.
+  const uint16_t tv = type_card & fl::kTvMask;
+  bool check = tv == fl::kTvUtf8;
+#ifndef NDEBUG
+  check |= tv == fl::kTvUtf8Debug;
+#endif
+  if (!check || utf8_range::IsStructurallyValid(value)) return;
+  const FieldDescriptor* field =
+      msg.GetDescriptor()->FindFieldByNumber(static_cast<int>(field_number));
+  WireFormatLite::VerifyUtf8String(value.data(), static_cast<int>(value.size()),
+                                   WireFormatLite::SERIALIZE,
+                                   field->full_name().c_str());
+}
+
+void SinglePassSerializer::Impl::SerializeFieldFallback(
+    const Message& msg, uint32_t field_number) {
+  const FieldDescriptor* field =
+      msg.GetDescriptor()->FindFieldByNumber(static_cast<int>(field_number));
+  ABSL_DCHECK(field != nullptr);
+  // FieldByteSize() expects to only be called for fields that are present.
+  if (!field->is_repeated() && !msg.GetReflection()->HasField(msg, field)) {
+    return;
+  }
+  size_t size = WireFormat::FieldByteSize(field, msg);
+  if (size == 0) return;
+  uint8_t* ptr = writer_.Reserve(size);
+  io::EpsCopyOutputStream stream = MakeStream(ptr, size);
+  uint8_t* end = WireFormat::InternalSerializeField(field, msg, ptr, &stream);
+  ABSL_DCHECK_EQ(end, ptr + size);
+  (void)end;
+}
+
+void SinglePassSerializer::Impl::SerializeMessageFallback(const Message& msg) {
+  size_t size = msg.ByteSizeLong();
+  if (size == 0) return;
+  uint8_t* ptr = writer_.Reserve(size);
+  io::EpsCopyOutputStream stream = MakeStream(ptr, size);
+  uint8_t* end = msg._InternalSerialize(ptr, &stream);
+  ABSL_DCHECK_EQ(end, ptr + size);
+  (void)end;
+}
+
+void SinglePassSerializer::Impl::SerializeUnknownFields(
+    const UnknownFieldSet& unknown_fields) {
+  size_t size = WireFormat::ComputeUnknownFieldsSize(unknown_fields);
+  if (size == 0) return;
+  uint8_t* ptr = writer_.Reserve(size);
+  io::EpsCopyOutputStream stream = MakeStream(ptr, size);
+  uint8_t* end =
+      WireFormat::InternalSerializeUnknownFieldsToArray(unknown_fields, ptr,
+                                                        &stream);
+  ABSL_DCHECK_EQ(end, ptr + size);
+  (void)end;
+}
+
+const TcParseTableBase* SinglePassSerializer::GetTable(
+    const Reflection& reflection) {
+  return reflection.GetTcParseTable();
+}
+
+bool SinglePassSerializer::SerializeToString(const Message& message,
+                                             std::string* output) {
+  ReverseWriter writer(output);
+  Impl(&writer).SerializeMessage(message);
+  if (writer.size() > INT_MAX) {
+    ABSL_LOG(ERROR) << message.GetTypeName()
+                    << " exceeded maximum protobuf size of 2GB: "
+                    << writer.size();
+    output->clear();
+    return false;
+  }
+  writer.Finish();
+  return true;
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,61 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// This file is internal to the protobuf implementation.  Use
+// Message::SerializeToStringSinglePass() instead.
+
+#ifndef GOOGLE_PROTOBUF_SINGLE_PASS_SERIALIZER_H__
+#define GOOGLE_PROTOBUF_SINGLE_PASS_SERIALIZER_H__
+
+#include <string>
+
+#include "google/protobuf/message.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+struct TcParseTableBase;
+
+// Serializes messages without computing ByteSizeLong() first.
+//
+// The regular serializer needs the size of every sub-message before it can
+// write that sub-message's length prefix, so it walks the whole tree twice:
+// once in ByteSizeLong() and once in _InternalSerialize().  This serializer
+// instead writes the message back to front into a growable buffer.  Each
+// sub-message is written before its tag and length, so the length is simply
+// the number of bytes written in the meantime.
+//
+// Fields are described by the reflection-built TcParser table of each
+// message type.  Fields the table cannot describe directly (maps, cords,
+// lazy, inlined and split fields, closed enums with gaps) are serialized
+// through WireFormat, and messages with extension ranges or MessageSet wire
+// format through their regular two-pass serializer; the output is the same
+// either way.
+class PROTOBUF_EXPORT SinglePassSerializer {
+ public:
+  // Replaces the contents of `output` with the serialized `message`.
+  // Returns false if the result exceeds the 2GB limit.
+  static bool SerializeToString(const Message& message, std::string* output);
+
+ private:
+  class Impl;
+
+  // Returns the TcParser table that `reflection` builds for its type.
+  static const TcParseTableBase* GetTable(const Reflection& reflection);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_SINGLE_PASS_SERIALIZER_H__
@@ -0,0 +1,117 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Compares SerializeToString(), which computes ByteSizeLong() before
+// writing, with SerializeToStringSinglePass() on wide messages (many fields
+// and repeated sub-messages at few levels) and deep ones (long chains of
+// nested messages), for both generated and dynamic messages.  Results are
+// printed as one JSON object per line.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_format.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "google/protobuf/dynamic_message.h"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/test_util.h"
+#include "google/protobuf/unittest.pb.h"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+// Runs `fn` until at least half a second has passed, and returns the average
+// time per call in nanoseconds.
+template <typename Fn>
+double MeasureNanos(Fn fn) {
+  int64_t iterations = 0;
+  absl::Time start = absl::Now();
+  absl::Duration elapsed;
+  do {
+    fn();
+    ++iterations;
+    elapsed = absl::Now() - start;
+  } while (elapsed < absl::Milliseconds(500));
+  return absl::ToDoubleNanoseconds(elapsed) / static_cast<double>(iterations);
+}
+
+void BenchmarkOne(const std::string& name, const Message& message) {
+  std::string output;
+  size_t bytes = message.ByteSizeLong();
+  double two_pass = MeasureNanos([&] { message.SerializeToString(&output); });
+  double single_pass =
+      MeasureNanos([&] { message.SerializeToStringSinglePass(&output); });
+  absl::PrintF(
+      "{\"benchmark\": \"%s\", \"bytes\": %d, \"two_pass_ns\": %.0f, "
+      "\"single_pass_ns\": %.0f, \"speedup\": %.2f}\n",
+      name, bytes, two_pass, single_pass, two_pass / single_pass);
+}
+
+// Benchmarks `message` and a DynamicMessage copy of it, whose regular
+// serializer goes through reflection.
+void Benchmark(const std::string& name, const Message& message) {
+  BenchmarkOne(name, message);
+  static auto* factory = new DynamicMessageFactory;
+  std::unique_ptr<Message> dynamic(
+      factory->GetPrototype(message.GetDescriptor())->New());
+  std::string wire = message.SerializeAsString();
+  io::CodedInputStream input(reinterpret_cast<const uint8_t*>(wire.data()),
+                             static_cast<int>(wire.size()));
+  input.SetRecursionLimit(std::numeric_limits<int>::max());
+  dynamic->ParseFromCodedStream(&input);
+  BenchmarkOne(name + "_dynamic", *dynamic);
+}
+
+void BenchmarkWide() {
+  unittest::TestAllTypes all_fields;
+  TestUtil::SetAllFields(&all_fields);
+  Benchmark("wide_all_fields", all_fields);
+
+  unittest::TestAllTypes many_children;
+  for (int i = 0; i < 1000; ++i) {
+    many_children.add_repeated_nested_message()->set_bb(i);
+    many_children.add_repeated_foreign_message()->set_c(i);
+    many_children.add_repeated_string("value");
+  }
+  Benchmark("wide_repeated_messages", many_children);
+}
+
+void BenchmarkDeep() {
+  for (int depth : {10, 100, 1000}) {
+    unittest::TestRecursiveMessage chain;
+    unittest::TestRecursiveMessage* inner = &chain;
+    for (int i = 0; i < depth; ++i) {
+      inner->set_i(i);
+      inner = inner->mutable_a();
+    }
+    Benchmark(absl::StrFormat("deep_recursive_%d", depth), chain);
+  }
+
+  unittest::NestedTestAllTypes nested;
+  unittest::NestedTestAllTypes* level = &nested;
+  for (int i = 0; i < 50; ++i) {
+    TestUtil::SetAllFields(level->mutable_payload());
+    level = level->mutable_child();
+  }
+  Benchmark("deep_all_fields_50", nested);
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main() {
+  google::protobuf::BenchmarkWide();
+  google::protobuf::BenchmarkDeep();
+  return 0;
+}
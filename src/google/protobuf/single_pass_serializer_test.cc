@@ -0,0 +1,207 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/single_pass_serializer.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/dynamic_message.h"
+#include "google/protobuf/map_unittest.pb.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/test_util.h"
+#include "google/protobuf/unittest.pb.h"
+#include "google/protobuf/unittest_proto3.pb.h"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+// Serializes `message` both ways and expects identical bytes.
+void ExpectSameBytes(const Message& message) {
+  std::string expected;
+  ASSERT_TRUE(message.SerializePartialToString(&expected));
+  std::string actual = "garbage that must be replaced";
+  ASSERT_TRUE(message.SerializePartialToStringSinglePass(&actual));
+  EXPECT_EQ(actual, expected) << message.DebugString();
+}
+
+TEST(SinglePassSerializerTest, Empty) {
+  std::string output = "not empty";
+  EXPECT_TRUE(unittest::TestAllTypes().SerializeToStringSinglePass(&output));
+  EXPECT_EQ(output, "");
+}
+
+TEST(SinglePassSerializerTest, AllFields) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  ExpectSameBytes(message);
+
+  unittest::TestAllTypes parsed;
+  std::string output;
+  ASSERT_TRUE(message.SerializeToStringSinglePass(&output));
+  ASSERT_TRUE(parsed.ParseFromString(output));
+  TestUtil::ExpectAllFieldsSet(parsed);
+}
+
+TEST(SinglePassSerializerTest, PackedAndUnpacked) {
+  unittest::TestPackedTypes packed;
+  TestUtil::SetPackedFields(&packed);
+  ExpectSameBytes(packed);
+
+  unittest::TestUnpackedTypes unpacked;
+  TestUtil::SetUnpackedFields(&unpacked);
+  ExpectSameBytes(unpacked);
+}
+
+TEST(SinglePassSerializerTest, NegativeAndSignedValues) {
+  unittest::TestAllTypes message;
+  message.set_optional_int32(-1);
+  message.set_optional_int64(-2);
+  message.set_optional_sint32(-3);
+  message.set_optional_sint64(-4);
+  message.set_optional_sfixed32(-5);
+  message.set_optional_sfixed64(-6);
+  message.set_optional_uint32(0xFFFFFFFF);
+  message.add_repeated_int32(-7);
+  message.add_repeated_sint32(-8);
+  ExpectSameBytes(message);
+
+  unittest::TestPackedTypes packed;
+  packed.add_packed_int32(-1);
+  packed.add_packed_int32(0);
+  packed.add_packed_sint64(-1);
+  packed.add_packed_enum(unittest::FOREIGN_BAZ);
+  ExpectSameBytes(packed);
+}
+
+TEST(SinglePassSerializerTest, ImplicitPresence) {
+  proto3_unittest::TestAllTypes message;
+  // Zero values are skipped, but negative zero is not zero.
+  message.set_optional_int32(0);
+  message.set_optional_double(-0.0);
+  message.set_optional_string("");
+  message.set_optional_bytes("bytes");
+  message.set_optional_nested_enum(proto3_unittest::TestAllTypes::NEG);
+  message.mutable_optional_nested_message();
+  message.add_repeated_string("");
+  ExpectSameBytes(message);
+
+  message.Clear();
+  message.set_oneof_uint32(0);
+  ExpectSameBytes(message);
+  message.set_oneof_string("");
+  ExpectSameBytes(message);
+}
+
+TEST(SinglePassSerializerTest, Oneofs) {
+  unittest::TestOneof2 message;
+  TestUtil::SetOneof1(&message);
+  ExpectSameBytes(message);
+  TestUtil::SetOneof2(&message);
+  ExpectSameBytes(message);
+
+  unittest::TestAllTypes all;
+  TestUtil::SetOneofFields(&all);
+  ExpectSameBytes(all);
+}
+
+TEST(SinglePassSerializerTest, Extensions) {
+  unittest::TestAllExtensions message;
+  TestUtil::SetAllExtensions(&message);
+  ExpectSameBytes(message);
+
+  unittest::TestFieldOrderings orderings;
+  TestUtil::SetAllFieldsAndExtensions(&orderings);
+  ExpectSameBytes(orderings);
+}
+
+TEST(SinglePassSerializerTest, UnknownFields) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+
+  unittest::TestEmptyMessage empty;
+  ASSERT_TRUE(empty.ParseFromString(message.SerializeAsString()));
+  ExpectSameBytes(empty);
+
+  // Unknown fields go after the known ones.
+  unittest::TestAllTypes partial;
+  partial.set_optional_int32(1);
+  partial.GetReflection()->MutableUnknownFields(&partial)->AddVarint(12345,
+                                                                     7);
+  ExpectSameBytes(partial);
+}
+
+TEST(SinglePassSerializerTest, Maps) {
+  unittest::TestMap message;
+  (*message.mutable_map_int32_int32())[1] = -1;
+  (*message.mutable_map_string_string())["key"] = "value";
+  (*message.mutable_map_int32_foreign_message())[2].set_c(3);
+  (*message.mutable_map_int32_enum())[4] = unittest::MAP_ENUM_BAZ;
+  ExpectSameBytes(message);
+
+  unittest::TestMessageMap message_map;
+  TestUtil::SetAllFields(&(*message_map.mutable_map_int32_message())[5]);
+  ExpectSameBytes(message_map);
+}
+
+TEST(SinglePassSerializerTest, DeepNesting) {
+  unittest::TestRecursiveMessage message;
+  unittest::TestRecursiveMessage* inner = &message;
+  for (int i = 0; i < 100; ++i) {
+    inner->set_i(i);
+    inner = inner->mutable_a();
+  }
+  ExpectSameBytes(message);
+
+  unittest::NestedTestAllTypes nested;
+  unittest::NestedTestAllTypes* level = &nested;
+  for (int i = 0; i < 20; ++i) {
+    TestUtil::SetAllFields(level->mutable_payload());
+    level = level->mutable_child();
+  }
+  ExpectSameBytes(nested);
+}
+
+TEST(SinglePassSerializerTest, LargeFields) {
+  // Larger than the initial buffer, in several places of the message.
+  unittest::TestAllTypes message;
+  message.set_optional_bytes(std::string(100000, 'x'));
+  message.mutable_optional_nested_message()->set_bb(1);
+  for (int i = 0; i < 1000; ++i) {
+    message.add_repeated_string(std::string(i, 'y'));
+  }
+  for (int i = 0; i < 10000; ++i) message.add_repeated_fixed64(i);
+  ExpectSameBytes(message);
+}
+
+TEST(SinglePassSerializerTest, MissingRequiredFields) {
+  unittest::TestRequired message;
+  message.set_a(1);
+  ExpectSameBytes(message);
+}
+
+TEST(SinglePassSerializerTest, DynamicMessage) {
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> message(
+      factory.GetPrototype(unittest::TestAllTypes::descriptor())->New());
+  TestUtil::ReflectionTester tester(unittest::TestAllTypes::descriptor());
+  tester.SetAllFieldsViaReflection(message.get());
+  ExpectSameBytes(*message);
+
+  unittest::TestAllTypes generated;
+  std::string output;
+  ASSERT_TRUE(message->SerializeToStringSinglePass(&output));
+  ASSERT_TRUE(generated.ParseFromString(output));
+  TestUtil::ExpectAllFieldsSet(generated);
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
@@ -63,6 +63,7 @@ class PROTOBUF_EXPORT ThreadSafeArena {
 
   uint64_t SpaceAllocated() const;
   uint64_t SpaceUsed() const;
+  uint64_t SpaceAllocatedOnHugePages() const;
 
   template <AllocationClient alloc_client = AllocationClient::kDefault>
   void* AllocateAligned(size_t n) {
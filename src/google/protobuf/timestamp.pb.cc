@@ -220,20 +220,25 @@ const ::_pbi::TcParseTable<1, 2, 0, 0, 2> Timestamp::_table_ = {
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
+  // All known fields are scalars that encode to at most 22 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[22];
+  ::uint8_t* ptr = buffer;
   // int64 seconds = 1;
   if (this->_internal_seconds() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt64ToArrayWithField<1>(
-            stream, this->_internal_seconds(), target);
+    ptr = ::_pbi::WireFormatLite::WriteInt64ToArray(
+        1, this->_internal_seconds(), ptr);
   }
 
   // int32 nanos = 2;
   if (this->_internal_nanos() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<2>(
-            stream, this->_internal_nanos(), target);
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_nanos(), ptr);
   }
 
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
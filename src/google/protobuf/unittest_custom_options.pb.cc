@@ -0,0 +1,5336 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_custom_options.proto
+
+#include "google/protobuf/unittest_custom_options.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR VariousComplexOptions::VariousComplexOptions(::_pbi::ConstantInitialized) {}
+struct VariousComplexOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VariousComplexOptionsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VariousComplexOptionsDefaultTypeInternal() {}
+  union {
+    VariousComplexOptions _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VariousComplexOptionsDefaultTypeInternal _VariousComplexOptions_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMessageWithRequiredEnumOption::TestMessageWithRequiredEnumOption(::_pbi::ConstantInitialized) {}
+struct TestMessageWithRequiredEnumOptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageWithRequiredEnumOptionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageWithRequiredEnumOptionDefaultTypeInternal() {}
+  union {
+    TestMessageWithRequiredEnumOption _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageWithRequiredEnumOptionDefaultTypeInternal _TestMessageWithRequiredEnumOption_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMessageWithCustomOptions_MapFieldEntry_DoNotUse::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMessageWithCustomOptions_MapFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageWithCustomOptions_MapFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageWithCustomOptions_MapFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMessageWithCustomOptions_MapFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageWithCustomOptions_MapFieldEntry_DoNotUseDefaultTypeInternal _TestMessageWithCustomOptions_MapFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR SettingRealsFromPositiveInts::SettingRealsFromPositiveInts(::_pbi::ConstantInitialized) {}
+struct SettingRealsFromPositiveIntsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SettingRealsFromPositiveIntsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SettingRealsFromPositiveIntsDefaultTypeInternal() {}
+  union {
+    SettingRealsFromPositiveInts _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SettingRealsFromPositiveIntsDefaultTypeInternal _SettingRealsFromPositiveInts_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR SettingRealsFromNegativeInts::SettingRealsFromNegativeInts(::_pbi::ConstantInitialized) {}
+struct SettingRealsFromNegativeIntsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SettingRealsFromNegativeIntsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SettingRealsFromNegativeIntsDefaultTypeInternal() {}
+  union {
+    SettingRealsFromNegativeInts _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SettingRealsFromNegativeIntsDefaultTypeInternal _SettingRealsFromNegativeInts_default_instance_;
+
+inline constexpr OldOptionType::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        value_{static_cast< ::protobuf_unittest::OldOptionType_TestEnum >(0)} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OldOptionType::OldOptionType(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct OldOptionTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OldOptionTypeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OldOptionTypeDefaultTypeInternal() {}
+  union {
+    OldOptionType _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OldOptionTypeDefaultTypeInternal _OldOptionType_default_instance_;
+
+inline constexpr NewOptionType::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        value_{static_cast< ::protobuf_unittest::NewOptionType_TestEnum >(0)} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR NewOptionType::NewOptionType(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct NewOptionTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NewOptionTypeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NewOptionTypeDefaultTypeInternal() {}
+  union {
+    NewOptionType _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NewOptionTypeDefaultTypeInternal _NewOptionType_default_instance_;
+
+inline constexpr NestedOptionType_NestedMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        nested_field_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR NestedOptionType_NestedMessage::NestedOptionType_NestedMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct NestedOptionType_NestedMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NestedOptionType_NestedMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NestedOptionType_NestedMessageDefaultTypeInternal() {}
+  union {
+    NestedOptionType_NestedMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NestedOptionType_NestedMessageDefaultTypeInternal _NestedOptionType_NestedMessage_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR NestedOptionType::NestedOptionType(::_pbi::ConstantInitialized) {}
+struct NestedOptionTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NestedOptionTypeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NestedOptionTypeDefaultTypeInternal() {}
+  union {
+    NestedOptionType _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NestedOptionTypeDefaultTypeInternal _NestedOptionType_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR DummyMessageInvalidAsOptionType::DummyMessageInvalidAsOptionType(::_pbi::ConstantInitialized) {}
+struct DummyMessageInvalidAsOptionTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DummyMessageInvalidAsOptionTypeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DummyMessageInvalidAsOptionTypeDefaultTypeInternal() {}
+  union {
+    DummyMessageInvalidAsOptionType _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DummyMessageInvalidAsOptionTypeDefaultTypeInternal _DummyMessageInvalidAsOptionType_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR DummyMessageContainingEnum::DummyMessageContainingEnum(::_pbi::ConstantInitialized) {}
+struct DummyMessageContainingEnumDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DummyMessageContainingEnumDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DummyMessageContainingEnumDefaultTypeInternal() {}
+  union {
+    DummyMessageContainingEnum _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DummyMessageContainingEnumDefaultTypeInternal _DummyMessageContainingEnum_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionOtherValues::CustomOptionOtherValues(::_pbi::ConstantInitialized) {}
+struct CustomOptionOtherValuesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionOtherValuesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionOtherValuesDefaultTypeInternal() {}
+  union {
+    CustomOptionOtherValues _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionOtherValuesDefaultTypeInternal _CustomOptionOtherValues_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionMinIntegerValues::CustomOptionMinIntegerValues(::_pbi::ConstantInitialized) {}
+struct CustomOptionMinIntegerValuesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionMinIntegerValuesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionMinIntegerValuesDefaultTypeInternal() {}
+  union {
+    CustomOptionMinIntegerValues _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionMinIntegerValuesDefaultTypeInternal _CustomOptionMinIntegerValues_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionMaxIntegerValues::CustomOptionMaxIntegerValues(::_pbi::ConstantInitialized) {}
+struct CustomOptionMaxIntegerValuesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionMaxIntegerValuesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionMaxIntegerValuesDefaultTypeInternal() {}
+  union {
+    CustomOptionMaxIntegerValues _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionMaxIntegerValuesDefaultTypeInternal _CustomOptionMaxIntegerValues_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionFooServerMessage::CustomOptionFooServerMessage(::_pbi::ConstantInitialized) {}
+struct CustomOptionFooServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionFooServerMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionFooServerMessageDefaultTypeInternal() {}
+  union {
+    CustomOptionFooServerMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionFooServerMessageDefaultTypeInternal _CustomOptionFooServerMessage_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionFooResponse::CustomOptionFooResponse(::_pbi::ConstantInitialized) {}
+struct CustomOptionFooResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionFooResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionFooResponseDefaultTypeInternal() {}
+  union {
+    CustomOptionFooResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionFooResponseDefaultTypeInternal _CustomOptionFooResponse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionFooRequest::CustomOptionFooRequest(::_pbi::ConstantInitialized) {}
+struct CustomOptionFooRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionFooRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionFooRequestDefaultTypeInternal() {}
+  union {
+    CustomOptionFooRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionFooRequestDefaultTypeInternal _CustomOptionFooRequest_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR CustomOptionFooClientMessage::CustomOptionFooClientMessage(::_pbi::ConstantInitialized) {}
+struct CustomOptionFooClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomOptionFooClientMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomOptionFooClientMessageDefaultTypeInternal() {}
+  union {
+    CustomOptionFooClientMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomOptionFooClientMessageDefaultTypeInternal _CustomOptionFooClientMessage_default_instance_;
+
+inline constexpr ComplexOptionType3_ComplexOptionType5::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        plugh_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ComplexOptionType3_ComplexOptionType5::ComplexOptionType3_ComplexOptionType5(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ComplexOptionType3_ComplexOptionType5DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComplexOptionType3_ComplexOptionType5DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComplexOptionType3_ComplexOptionType5DefaultTypeInternal() {}
+  union {
+    ComplexOptionType3_ComplexOptionType5 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComplexOptionType3_ComplexOptionType5DefaultTypeInternal _ComplexOptionType3_ComplexOptionType5_default_instance_;
+
+inline constexpr ComplexOptionType2_ComplexOptionType4::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        waldo_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ComplexOptionType2_ComplexOptionType4::ComplexOptionType2_ComplexOptionType4(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ComplexOptionType2_ComplexOptionType4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComplexOptionType2_ComplexOptionType4DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComplexOptionType2_ComplexOptionType4DefaultTypeInternal() {}
+  union {
+    ComplexOptionType2_ComplexOptionType4 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComplexOptionType2_ComplexOptionType4DefaultTypeInternal _ComplexOptionType2_ComplexOptionType4_default_instance_;
+
+inline constexpr ComplexOptionType1::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        foo4_{},
+        foo_{0},
+        foo2_{0},
+        foo3_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ComplexOptionType1::ComplexOptionType1(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ComplexOptionType1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComplexOptionType1DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComplexOptionType1DefaultTypeInternal() {}
+  union {
+    ComplexOptionType1 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComplexOptionType1DefaultTypeInternal _ComplexOptionType1_default_instance_;
+
+inline constexpr ComplexOpt6::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        xyzzy_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ComplexOpt6::ComplexOpt6(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ComplexOpt6DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComplexOpt6DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComplexOpt6DefaultTypeInternal() {}
+  union {
+    ComplexOpt6 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComplexOpt6DefaultTypeInternal _ComplexOpt6_default_instance_;
+
+inline constexpr AggregateMessageSetElement::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        s_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR AggregateMessageSetElement::AggregateMessageSetElement(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct AggregateMessageSetElementDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AggregateMessageSetElementDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AggregateMessageSetElementDefaultTypeInternal() {}
+  union {
+    AggregateMessageSetElement _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AggregateMessageSetElementDefaultTypeInternal _AggregateMessageSetElement_default_instance_;
+
+inline constexpr AggregateMessageSet::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR AggregateMessageSet::AggregateMessageSet(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct AggregateMessageSetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AggregateMessageSetDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AggregateMessageSetDefaultTypeInternal() {}
+  union {
+    AggregateMessageSet _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AggregateMessageSetDefaultTypeInternal _AggregateMessageSet_default_instance_;
+
+inline constexpr AggregateMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        fieldname_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR AggregateMessage::AggregateMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct AggregateMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AggregateMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AggregateMessageDefaultTypeInternal() {}
+  union {
+    AggregateMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AggregateMessageDefaultTypeInternal _AggregateMessage_default_instance_;
+
+inline constexpr TestMessageWithCustomOptions::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        map_field_{},
+        field1_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        AnOneof_{},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageWithCustomOptions::TestMessageWithCustomOptions(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageWithCustomOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageWithCustomOptionsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageWithCustomOptionsDefaultTypeInternal() {}
+  union {
+    TestMessageWithCustomOptions _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageWithCustomOptionsDefaultTypeInternal _TestMessageWithCustomOptions_default_instance_;
+
+inline constexpr ComplexOptionType3::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        complexoptiontype5_{nullptr},
+        moo_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ComplexOptionType3::ComplexOptionType3(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ComplexOptionType3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComplexOptionType3DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComplexOptionType3DefaultTypeInternal() {}
+  union {
+    ComplexOptionType3 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComplexOptionType3DefaultTypeInternal _ComplexOptionType3_default_instance_;
+
+inline constexpr ComplexOptionType2::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        barney_{},
+        bar_{nullptr},
+        fred_{nullptr},
+        baz_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ComplexOptionType2::ComplexOptionType2(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ComplexOptionType2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComplexOptionType2DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComplexOptionType2DefaultTypeInternal() {}
+  union {
+    ComplexOptionType2 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComplexOptionType2DefaultTypeInternal _ComplexOptionType2_default_instance_;
+
+inline constexpr Aggregate::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        s_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        sub_{nullptr},
+        file_{nullptr},
+        mset_{nullptr},
+        any_{nullptr},
+        i_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR Aggregate::Aggregate(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct AggregateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AggregateDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AggregateDefaultTypeInternal() {}
+  union {
+    Aggregate _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AggregateDefaultTypeInternal _Aggregate_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[29];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[7];
+static const ::_pb::ServiceDescriptor*
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[2];
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _internal_metadata_),
+    ~0u,  // no _extensions_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _impl_.field1_),
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _impl_.map_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _impl_.AnOneof_),
+    0,
+    ~0u,
+    ~0u,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionFooRequest, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionFooResponse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionFooClientMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionFooServerMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::DummyMessageContainingEnum, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::DummyMessageInvalidAsOptionType, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionMinIntegerValues, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionMaxIntegerValues, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::CustomOptionOtherValues, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::SettingRealsFromPositiveInts, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::SettingRealsFromNegativeInts, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _impl_.foo_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _impl_.foo2_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _impl_.foo3_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType1, _impl_.foo4_),
+    0,
+    1,
+    2,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4, _impl_.waldo_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _impl_.bar_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _impl_.baz_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _impl_.fred_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType2, _impl_.barney_),
+    0,
+    2,
+    1,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5, _impl_.plugh_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3, _impl_.moo_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOptionType3, _impl_.complexoptiontype5_),
+    1,
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOpt6, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOpt6, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::ComplexOpt6, _impl_.xyzzy_),
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::VariousComplexOptions, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessageSet, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessageSet, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessageSetElement, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessageSetElement, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessageSetElement, _impl_.s_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_.i_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_.s_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_.sub_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_.file_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_.mset_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Aggregate, _impl_.any_),
+    5,
+    0,
+    1,
+    2,
+    3,
+    4,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::AggregateMessage, _impl_.fieldname_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedOptionType_NestedMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedOptionType_NestedMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedOptionType_NestedMessage, _impl_.nested_field_),
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedOptionType, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OldOptionType, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OldOptionType, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OldOptionType, _impl_.value_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NewOptionType, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NewOptionType, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NewOptionType, _impl_.value_),
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithRequiredEnumOption, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 10, -1, sizeof(::protobuf_unittest::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse)},
+        {12, 24, -1, sizeof(::protobuf_unittest::TestMessageWithCustomOptions)},
+        {27, -1, -1, sizeof(::protobuf_unittest::CustomOptionFooRequest)},
+        {35, -1, -1, sizeof(::protobuf_unittest::CustomOptionFooResponse)},
+        {43, -1, -1, sizeof(::protobuf_unittest::CustomOptionFooClientMessage)},
+        {51, -1, -1, sizeof(::protobuf_unittest::CustomOptionFooServerMessage)},
+        {59, -1, -1, sizeof(::protobuf_unittest::DummyMessageContainingEnum)},
+        {67, -1, -1, sizeof(::protobuf_unittest::DummyMessageInvalidAsOptionType)},
+        {75, -1, -1, sizeof(::protobuf_unittest::CustomOptionMinIntegerValues)},
+        {83, -1, -1, sizeof(::protobuf_unittest::CustomOptionMaxIntegerValues)},
+        {91, -1, -1, sizeof(::protobuf_unittest::CustomOptionOtherValues)},
+        {99, -1, -1, sizeof(::protobuf_unittest::SettingRealsFromPositiveInts)},
+        {107, -1, -1, sizeof(::protobuf_unittest::SettingRealsFromNegativeInts)},
+        {115, 127, -1, sizeof(::protobuf_unittest::ComplexOptionType1)},
+        {131, 140, -1, sizeof(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4)},
+        {141, 153, -1, sizeof(::protobuf_unittest::ComplexOptionType2)},
+        {157, 166, -1, sizeof(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5)},
+        {167, 177, -1, sizeof(::protobuf_unittest::ComplexOptionType3)},
+        {179, 188, -1, sizeof(::protobuf_unittest::ComplexOpt6)},
+        {189, -1, -1, sizeof(::protobuf_unittest::VariousComplexOptions)},
+        {197, -1, -1, sizeof(::protobuf_unittest::AggregateMessageSet)},
+        {205, 214, -1, sizeof(::protobuf_unittest::AggregateMessageSetElement)},
+        {215, 229, -1, sizeof(::protobuf_unittest::Aggregate)},
+        {235, 244, -1, sizeof(::protobuf_unittest::AggregateMessage)},
+        {245, 254, -1, sizeof(::protobuf_unittest::NestedOptionType_NestedMessage)},
+        {255, -1, -1, sizeof(::protobuf_unittest::NestedOptionType)},
+        {263, 272, -1, sizeof(::protobuf_unittest::OldOptionType)},
+        {273, 282, -1, sizeof(::protobuf_unittest::NewOptionType)},
+        {283, -1, -1, sizeof(::protobuf_unittest::TestMessageWithRequiredEnumOption)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestMessageWithCustomOptions_MapFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageWithCustomOptions_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionFooRequest_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionFooResponse_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionFooClientMessage_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionFooServerMessage_default_instance_._instance,
+    &::protobuf_unittest::_DummyMessageContainingEnum_default_instance_._instance,
+    &::protobuf_unittest::_DummyMessageInvalidAsOptionType_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionMinIntegerValues_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionMaxIntegerValues_default_instance_._instance,
+    &::protobuf_unittest::_CustomOptionOtherValues_default_instance_._instance,
+    &::protobuf_unittest::_SettingRealsFromPositiveInts_default_instance_._instance,
+    &::protobuf_unittest::_SettingRealsFromNegativeInts_default_instance_._instance,
+    &::protobuf_unittest::_ComplexOptionType1_default_instance_._instance,
+    &::protobuf_unittest::_ComplexOptionType2_ComplexOptionType4_default_instance_._instance,
+    &::protobuf_unittest::_ComplexOptionType2_default_instance_._instance,
+    &::protobuf_unittest::_ComplexOptionType3_ComplexOptionType5_default_instance_._instance,
+    &::protobuf_unittest::_ComplexOptionType3_default_instance_._instance,
+    &::protobuf_unittest::_ComplexOpt6_default_instance_._instance,
+    &::protobuf_unittest::_VariousComplexOptions_default_instance_._instance,
+    &::protobuf_unittest::_AggregateMessageSet_default_instance_._instance,
+    &::protobuf_unittest::_AggregateMessageSetElement_default_instance_._instance,
+    &::protobuf_unittest::_Aggregate_default_instance_._instance,
+    &::protobuf_unittest::_AggregateMessage_default_instance_._instance,
+    &::protobuf_unittest::_NestedOptionType_NestedMessage_default_instance_._instance,
+    &::protobuf_unittest::_NestedOptionType_default_instance_._instance,
+    &::protobuf_unittest::_OldOptionType_default_instance_._instance,
+    &::protobuf_unittest::_NewOptionType_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageWithRequiredEnumOption_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n-google/protobuf/unittest_custom_option"
+    "s.proto\022\021protobuf_unittest\032\031google/proto"
+    "buf/any.proto\032 google/protobuf/descripto"
+    "r.proto\"\320\002\n\034TestMessageWithCustomOptions"
+    "\022\036\n\006field1\030\001 \001(\tB\016\010\001\301\340\303\035-\341u\n\002\000\000\000\022\025\n\013oneo"
+    "f_field\030\002 \001(\005H\000\022^\n\tmap_field\030\003 \003(\0132=.pro"
+    "tobuf_unittest.TestMessageWithCustomOpti"
+    "ons.MapFieldEntryB\014\301\340\303\03590\000\000\000\000\000\000\032/\n\rMapFi"
+    "eldEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001"
+    "\";\n\006AnEnum\022\017\n\013ANENUM_VAL1\020\001\022\026\n\013ANENUM_VA"
+    "L2\020\002\032\005\260\206\372\005{\032\010\305\366\311\035\353\374\377\377:\020\010\000\340\351\302\035\310\377\377\377\377\377\377\377\377\001B"
+    "\031\n\007AnOneof\022\016\370\254\303\035\235\377\377\377\377\377\377\377\377\001\"\030\n\026CustomOpti"
+    "onFooRequest\"\031\n\027CustomOptionFooResponse\""
+    "\036\n\034CustomOptionFooClientMessage\"\036\n\034Custo"
+    "mOptionFooServerMessage\"m\n\032DummyMessageC"
+    "ontainingEnum\"O\n\014TestEnumType\022\032\n\026TEST_OP"
+    "TION_ENUM_TYPE1\020\026\022#\n\026TEST_OPTION_ENUM_TY"
+    "PE2\020\351\377\377\377\377\377\377\377\377\001\"!\n\037DummyMessageInvalidAsO"
+    "ptionType\"\212\001\n\034CustomOptionMinIntegerValu"
+    "es:j\231\326\250\035\000\000\000\000\000\000\000\200\255\215\257\035\000\000\000\200\221\356\257\035\000\000\000\000\000\000\000\000\235\365\257\035"
+    "\000\000\000\000\370\227\260\035\377\377\377\377\377\377\377\377\377\001\200\304\260\035\377\377\377\377\017\370\365\260\035\000\200\223\262\035\000\260\274\262"
+    "\035\200\200\200\200\200\200\200\200\200\001\350\306\262\035\200\200\200\200\370\377\377\377\377\001\320\336\262\035\000\"\221\001\n\034Custo"
+    "mOptionMaxIntegerValues:q\231\326\250\035\377\377\377\377\377\377\377\177\255\215\257"
+    "\035\377\377\377\177\221\356\257\035\377\377\377\377\377\377\377\377\235\365\257\035\377\377\377\377\370\227\260\035\376\377\377\377\377\377\377\377\377\001\200"
+    "\304\260\035\376\377\377\377\017\370\365\260\035\377\377\377\377\377\377\377\377\377\001\200\223\262\035\377\377\377\377\017\260\274\262\035\377\377\377\377\377"
+    "\377\377\377\177\350\306\262\035\377\377\377\377\007\320\336\262\035\001\"n\n\027CustomOptionOtherV"
+    "alues:S\210\331\242\035\351\377\377\377\377\377\377\377\377\001\262\331\242\035\013Hello\000World\252\334\242"
+    "\035\016Hello, \"World\"\351\334\242\035\373Y\214B\312\300\363\?\365\337\243\035\347\207EA\350\306\262\035"
+    "\234\377\377\377\377\377\377\377\377\001\"4\n\034SettingRealsFromPositiveIn"
+    "ts:\024\351\334\242\035\000\000\000\000\000@c@\365\337\243\035\000\000@A\"4\n\034SettingReals"
+    "FromNegativeInts:\024\351\334\242\035\000\000\000\000\000@c\300\365\337\243\035\000\000@\301\"U"
+    "\n\022ComplexOptionType1\022\013\n\003foo\030\001 \001(\005\022\014\n\004foo"
+    "2\030\002 \001(\005\022\014\n\004foo3\030\003 \001(\005\022\014\n\004foo4\030\004 \003(\005*\010\010d\020"
+    "\200\200\200\200\002\"\213\003\n\022ComplexOptionType2\0222\n\003bar\030\001 \001("
+    "\0132%.protobuf_unittest.ComplexOptionType1"
+    "\022\013\n\003baz\030\002 \001(\005\022F\n\004fred\030\003 \001(\01328.protobuf_u"
+    "nittest.ComplexOptionType2.ComplexOption"
+    "Type4\022H\n\006barney\030\004 \003(\01328.protobuf_unittes"
+    "t.ComplexOptionType2.ComplexOptionType4\032"
+    "\227\001\n\022ComplexOptionType4\022\r\n\005waldo\030\001 \001(\0052r\n"
+    "\014complex_opt4\022\037.google.protobuf.MessageO"
+    "ptions\030\212\365\321\003 \001(\01328.protobuf_unittest.Comp"
+    "lexOptionType2.ComplexOptionType4*\010\010d\020\200\200"
+    "\200\200\002\"\234\001\n\022ComplexOptionType3\022\013\n\003moo\030\001 \001(\005\022"
+    "T\n\022complexoptiontype5\030\002 \001(\n28.protobuf_u"
+    "nittest.ComplexOptionType3.ComplexOption"
+    "Type5\032#\n\022ComplexOptionType5\022\r\n\005plugh\030\003 \001"
+    "(\005\"\037\n\013ComplexOpt6\022\020\n\005xyzzy\030\337\277\317\003 \001(\005\"\227\001\n\025"
+    "VariousComplexOptions:~\343\334\374\034\370\375\373\034\030\344\334\374\034\322\250\217\035"
+    "\003\010\263\017\372\336\220\035\006\010\t\023\030\026\024\252\375\220\035@\n\021\010\347\005\222\365\235\035\003\010\330\017\330\205\236\035\317\017\020"
+    "\333\007\032\003\010\301\002\"\002\010e\"\003\010\324\001\302\254\227\035\021\010\345\005\222\365\235\035\003\010\311\020\330\205\236\035\316\017\370\346"
+    "\227\035\216\005\242\342\225\035\024\010* c X\222\365\235\035\003\010\354\006\330\205\236\035\304\002\"#\n\023Aggrega"
+    "teMessageSet*\010\010\004\020\377\377\377\377\007:\002\010\001\"\240\001\n\032Aggregate"
+    "MessageSetElement\022\t\n\001s\030\001 \001(\t2w\n\025message_"
+    "set_extension\022&.protobuf_unittest.Aggreg"
+    "ateMessageSet\030\366\353\256\007 \001(\0132-.protobuf_unitte"
+    "st.AggregateMessageSetElement\"\240\002\n\tAggreg"
+    "ate\022\t\n\001i\030\001 \001(\005\022\t\n\001s\030\002 \001(\t\022)\n\003sub\030\003 \001(\0132\034"
+    ".protobuf_unittest.Aggregate\022*\n\004file\030\004 \001"
+    "(\0132\034.google.protobuf.FileOptions\0224\n\004mset"
+    "\030\005 \001(\0132&.protobuf_unittest.AggregateMess"
+    "ageSet\022!\n\003any\030\006 \001(\0132\024.google.protobuf.An"
+    "y2M\n\006nested\022\034.google.protobuf.FileOption"
+    "s\030\247\321\260\007 \001(\0132\034.protobuf_unittest.Aggregate"
+    "\"Y\n\020AggregateMessage\022)\n\tfieldname\030\001 \001(\005B"
+    "\026\362\241\207;\021\022\017FieldAnnotation:\032\302\321\206;\025\010e\022\021Messag"
+    "eAnnotation\"\311\001\n\020NestedOptionType\032;\n\rNest"
+    "edMessage\022\"\n\014nested_field\030\001 \001(\005B\014\301\340\303\035\352\003\000"
+    "\000\000\000\000\000:\006\340\351\302\035\351\007\"5\n\nNestedEnum\022\035\n\021NESTED_EN"
+    "UM_VALUE\020\001\032\006\260\206\372\005\354\007\032\010\305\366\311\035\353\003\000\0002A\n\020nested_e"
+    "xtension\022\034.google.protobuf.FileOptions\030\375"
+    "\370\342\003 \001(\005B\006\310\213\312\035\355\007\"d\n\rOldOptionType\0228\n\005valu"
+    "e\030\001 \002(\0162).protobuf_unittest.OldOptionTyp"
+    "e.TestEnum\"\031\n\010TestEnum\022\r\n\tOLD_VALUE\020\000\"s\n"
+    "\rNewOptionType\0228\n\005value\030\001 \002(\0162).protobuf"
+    "_unittest.NewOptionType.TestEnum\"(\n\010Test"
+    "Enum\022\r\n\tOLD_VALUE\020\000\022\r\n\tNEW_VALUE\020\001\"-\n!Te"
+    "stMessageWithRequiredEnumOption:\010\372\350\374\224\003\002\010"
+    "\000*6\n\nMethodOpt1\022\023\n\017METHODOPT1_VAL1\020\001\022\023\n\017"
+    "METHODOPT1_VAL2\020\002*M\n\rAggregateEnum\022%\n\005VA"
+    "LUE\020\001\032\032\312\374\211;\025\022\023EnumValueAnnotation\032\025\222\225\210;\020"
+    "\022\016EnumAnnotation2\216\001\n\034TestServiceWithCust"
+    "omOptions\022c\n\003Foo\022).protobuf_unittest.Cus"
+    "tomOptionFooRequest\032*.protobuf_unittest."
+    "CustomOptionFooResponse\"\005\340\372\214\036\002\032\t\220\262\213\036\323\333\200\313"
+    "I2\231\001\n\020AggregateService\022k\n\006Method\022#.proto"
+    "buf_unittest.AggregateMessage\032#.protobuf"
+    "_unittest.AggregateMessage\"\027\312\310\226;\022\022\020Metho"
+    "dAnnotation\032\030\312\373\216;\023\022\021ServiceAnnotation:2\n"
+    "\tfile_opt1\022\034.google.protobuf.FileOptions"
+    "\030\216\235\330\003 \001(\004:8\n\014message_opt1\022\037.google.proto"
+    "buf.MessageOptions\030\234\255\330\003 \001(\005:4\n\nfield_opt"
+    "1\022\035.google.protobuf.FieldOptions\030\210\274\330\003 \001("
+    "\006:8\n\nfield_opt2\022\035.google.protobuf.FieldO"
+    "ptions\030\271\241\331\003 \001(\005:\00242:4\n\noneof_opt1\022\035.goog"
+    "le.protobuf.OneofOptions\030\317\265\330\003 \001(\005:2\n\tenu"
+    "m_opt1\022\034.google.protobuf.EnumOptions\030\350\236\331"
+    "\003 \001(\017:<\n\017enum_value_opt1\022!.google.protob"
+    "uf.EnumValueOptions\030\346\240_ \001(\005:8\n\014service_o"
+    "pt1\022\037.google.protobuf.ServiceOptions\030\242\266\341"
+    "\003 \001(\022:U\n\013method_opt1\022\036.google.protobuf.M"
+    "ethodOptions\030\254\317\341\003 \001(\0162\035.protobuf_unittes"
+    "t.MethodOpt1:4\n\010bool_opt\022\037.google.protob"
+    "uf.MessageOptions\030\352\253\326\003 \001(\010:5\n\tint32_opt\022"
+    "\037.google.protobuf.MessageOptions\030\355\250\326\003 \001("
+    "\005:5\n\tint64_opt\022\037.google.protobuf.Message"
+    "Options\030\306\247\326\003 \001(\003:6\n\nuint32_opt\022\037.google."
+    "protobuf.MessageOptions\030\260\242\326\003 \001(\r:6\n\nuint"
+    "64_opt\022\037.google.protobuf.MessageOptions\030"
+    "\337\216\326\003 \001(\004:6\n\nsint32_opt\022\037.google.protobuf"
+    ".MessageOptions\030\300\210\326\003 \001(\021:6\n\nsint64_opt\022\037"
+    ".google.protobuf.MessageOptions\030\377\202\326\003 \001(\022"
+    ":7\n\013fixed32_opt\022\037.google.protobuf.Messag"
+    "eOptions\030\323\376\325\003 \001(\007:7\n\013fixed64_opt\022\037.googl"
+    "e.protobuf.MessageOptions\030\342\375\325\003 \001(\006:8\n\014sf"
+    "ixed32_opt\022\037.google.protobuf.MessageOpti"
+    "ons\030\325\361\325\003 \001(\017:8\n\014sfixed64_opt\022\037.google.pr"
+    "otobuf.MessageOptions\030\343\212\325\003 \001(\020:5\n\tfloat_"
+    "opt\022\037.google.protobuf.MessageOptions\030\376\273\324"
+    "\003 \001(\002:6\n\ndouble_opt\022\037.google.protobuf.Me"
+    "ssageOptions\030\315\253\324\003 \001(\001:6\n\nstring_opt\022\037.go"
+    "ogle.protobuf.MessageOptions\030\305\253\324\003 \001(\t:5\n"
+    "\tbytes_opt\022\037.google.protobuf.MessageOpti"
+    "ons\030\226\253\324\003 \001(\014:p\n\010enum_opt\022\037.google.protob"
+    "uf.MessageOptions\030\221\253\324\003 \001(\0162:.protobuf_un"
+    "ittest.DummyMessageContainingEnum.TestEn"
+    "umType:p\n\020message_type_opt\022\037.google.prot"
+    "obuf.MessageOptions\030\257\362\323\003 \001(\01322.protobuf_"
+    "unittest.DummyMessageInvalidAsOptionType"
+    ":6\n\004mooo\022%.protobuf_unittest.ComplexOpti"
+    "onType1\030\333\340\323\003 \001(\005:^\n\005corge\022%.protobuf_uni"
+    "ttest.ComplexOptionType1\030\322\336\323\003 \001(\0132%.prot"
+    "obuf_unittest.ComplexOptionType3:8\n\006grau"
+    "lt\022%.protobuf_unittest.ComplexOptionType"
+    "2\030\357\374\322\003 \001(\005:_\n\006garply\022%.protobuf_unittest"
+    ".ComplexOptionType2\030\310\365\322\003 \001(\0132%.protobuf_"
+    "unittest.ComplexOptionType1:_\n\014complex_o"
+    "pt1\022\037.google.protobuf.MessageOptions\030\244\334\322"
+    "\003 \001(\0132%.protobuf_unittest.ComplexOptionT"
+    "ype1:_\n\014complex_opt2\022\037.google.protobuf.M"
+    "essageOptions\030\325\217\322\003 \001(\0132%.protobuf_unitte"
+    "st.ComplexOptionType2:_\n\014complex_opt3\022\037."
+    "google.protobuf.MessageOptions\030\357\213\322\003 \001(\0132"
+    "%.protobuf_unittest.ComplexOptionType3:W"
+    "\n\013complexopt6\022\037.google.protobuf.MessageO"
+    "ptions\030\314\313\317\003 \001(\n2\036.protobuf_unittest.Comp"
+    "lexOpt6:N\n\007fileopt\022\034.google.protobuf.Fil"
+    "eOptions\030\317\335\260\007 \001(\0132\034.protobuf_unittest.Ag"
+    "gregate:P\n\006msgopt\022\037.google.protobuf.Mess"
+    "ageOptions\030\230\352\260\007 \001(\0132\034.protobuf_unittest."
+    "Aggregate:P\n\010fieldopt\022\035.google.protobuf."
+    "FieldOptions\030\236\364\260\007 \001(\0132\034.protobuf_unittes"
+    "t.Aggregate:N\n\007enumopt\022\034.google.protobuf"
+    ".EnumOptions\030\322\202\261\007 \001(\0132\034.protobuf_unittes"
+    "t.Aggregate:V\n\nenumvalopt\022!.google.proto"
+    "buf.EnumValueOptions\030\311\237\261\007 \001(\0132\034.protobuf"
+    "_unittest.Aggregate:T\n\nserviceopt\022\037.goog"
+    "le.protobuf.ServiceOptions\030\271\357\261\007 \001(\0132\034.pr"
+    "otobuf_unittest.Aggregate:R\n\tmethodopt\022\036"
+    ".google.protobuf.MethodOptions\030\211\351\262\007 \001(\0132"
+    "\034.protobuf_unittest.Aggregate:_\n\021require"
+    "d_enum_opt\022\037.google.protobuf.MessageOpti"
+    "ons\030\217\315\3172 \001(\0132 .protobuf_unittest.OldOpti"
+    "onTypeB\351\001\200\001\001\210\001\001\220\001\001\360\350\301\035\352\255\300\345$\372\354\205;\321\001\010d\022\016Fil"
+    "eAnnotation\032\026\022\024NestedFileAnnotation\"\036\372\354\205"
+    ";\031\022\027FileExtensionAnnotation*$\013\020\366\353\256\007\032\033\n\031E"
+    "mbeddedMessageSetElement\0142_\n@type.google"
+    "apis.com/protobuf_unittest.AggregateMess"
+    "ageSetElement\022\033\n\031EmbeddedMessageSetEleme"
+    "nt"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_deps[2] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto = {
+    false,
+    false,
+    6762,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto,
+    "google/protobuf/unittest_custom_options.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_deps,
+    2,
+    29,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+namespace protobuf_unittest {
+const ::google::protobuf::EnumDescriptor* TestMessageWithCustomOptions_AnEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t TestMessageWithCustomOptions_AnEnum_internal_data_[] = {
+    131073u, 0u, };
+bool TestMessageWithCustomOptions_AnEnum_IsValid(int value) {
+  return 1 <= value && value <= 2;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions::ANENUM_VAL1;
+constexpr TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions::ANENUM_VAL2;
+constexpr TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions::AnEnum_MIN;
+constexpr TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions::AnEnum_MAX;
+constexpr int TestMessageWithCustomOptions::AnEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* DummyMessageContainingEnum_TestEnumType_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t DummyMessageContainingEnum_TestEnumType_internal_data_[] = {
+    131049u, 65536u, 22u, };
+bool DummyMessageContainingEnum_TestEnumType_IsValid(int value) {
+  return ::_pbi::ValidateEnum(value, DummyMessageContainingEnum_TestEnumType_internal_data_);
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum::TEST_OPTION_ENUM_TYPE1;
+constexpr DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum::TEST_OPTION_ENUM_TYPE2;
+constexpr DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum::TestEnumType_MIN;
+constexpr DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum::TestEnumType_MAX;
+constexpr int DummyMessageContainingEnum::TestEnumType_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* NestedOptionType_NestedEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[2];
+}
+PROTOBUF_CONSTINIT const uint32_t NestedOptionType_NestedEnum_internal_data_[] = {
+    65537u, 0u, };
+bool NestedOptionType_NestedEnum_IsValid(int value) {
+  return 1 <= value && value <= 1;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr NestedOptionType_NestedEnum NestedOptionType::NESTED_ENUM_VALUE;
+constexpr NestedOptionType_NestedEnum NestedOptionType::NestedEnum_MIN;
+constexpr NestedOptionType_NestedEnum NestedOptionType::NestedEnum_MAX;
+constexpr int NestedOptionType::NestedEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* OldOptionType_TestEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[3];
+}
+PROTOBUF_CONSTINIT const uint32_t OldOptionType_TestEnum_internal_data_[] = {
+    65536u, 0u, };
+bool OldOptionType_TestEnum_IsValid(int value) {
+  return 0 <= value && value <= 0;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr OldOptionType_TestEnum OldOptionType::OLD_VALUE;
+constexpr OldOptionType_TestEnum OldOptionType::TestEnum_MIN;
+constexpr OldOptionType_TestEnum OldOptionType::TestEnum_MAX;
+constexpr int OldOptionType::TestEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* NewOptionType_TestEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[4];
+}
+PROTOBUF_CONSTINIT const uint32_t NewOptionType_TestEnum_internal_data_[] = {
+    131072u, 0u, };
+bool NewOptionType_TestEnum_IsValid(int value) {
+  return 0 <= value && value <= 1;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr NewOptionType_TestEnum NewOptionType::OLD_VALUE;
+constexpr NewOptionType_TestEnum NewOptionType::NEW_VALUE;
+constexpr NewOptionType_TestEnum NewOptionType::TestEnum_MIN;
+constexpr NewOptionType_TestEnum NewOptionType::TestEnum_MAX;
+constexpr int NewOptionType::TestEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* MethodOpt1_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[5];
+}
+PROTOBUF_CONSTINIT const uint32_t MethodOpt1_internal_data_[] = {
+    131073u, 0u, };
+bool MethodOpt1_IsValid(int value) {
+  return 1 <= value && value <= 2;
+}
+const ::google::protobuf::EnumDescriptor* AggregateEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[6];
+}
+PROTOBUF_CONSTINIT const uint32_t AggregateEnum_internal_data_[] = {
+    65537u, 0u, };
+bool AggregateEnum_IsValid(int value) {
+  return 1 <= value && value <= 1;
+}
+// ===================================================================
+
+TestMessageWithCustomOptions_MapFieldEntry_DoNotUse::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse() {}
+TestMessageWithCustomOptions_MapFieldEntry_DoNotUse::TestMessageWithCustomOptions_MapFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMessageWithCustomOptions_MapFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[0]);
+}
+// ===================================================================
+
+class TestMessageWithCustomOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessageWithCustomOptions>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessageWithCustomOptions, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithCustomOptions, _impl_._oneof_case_);
+  static void set_has_field1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestMessageWithCustomOptions::TestMessageWithCustomOptions(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageWithCustomOptions)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageWithCustomOptions::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        map_field_{visibility, arena, from.map_field_},
+        field1_(arena, from.field1_),
+        AnOneof_{},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+TestMessageWithCustomOptions::TestMessageWithCustomOptions(
+    ::google::protobuf::Arena* arena,
+    const TestMessageWithCustomOptions& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageWithCustomOptions* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  switch (AnOneof_case()) {
+    case ANONEOF_NOT_SET:
+      break;
+      case kOneofField:
+        _impl_.AnOneof_.oneof_field_ = from._impl_.AnOneof_.oneof_field_;
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageWithCustomOptions)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageWithCustomOptions::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        map_field_{visibility, arena},
+        field1_(arena),
+        AnOneof_{},
+        _oneof_case_{} {}
+
+inline void TestMessageWithCustomOptions::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMessageWithCustomOptions::~TestMessageWithCustomOptions() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageWithCustomOptions)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageWithCustomOptions::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.field1_.Destroy();
+  if (has_AnOneof()) {
+    clear_AnOneof();
+  }
+  _impl_.~Impl_();
+}
+
+void TestMessageWithCustomOptions::clear_AnOneof() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TestMessageWithCustomOptions)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (AnOneof_case()) {
+    case kOneofField: {
+      // No need to clear
+      break;
+    }
+    case ANONEOF_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = ANONEOF_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void TestMessageWithCustomOptions::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageWithCustomOptions)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_field_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.field1_.ClearNonDefaultToEmpty();
+  }
+  clear_AnOneof();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageWithCustomOptions::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 3, 1, 70, 2> TestMessageWithCustomOptions::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessageWithCustomOptions, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMessageWithCustomOptions_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string field1 = 1 [ctype = CORD, (.protobuf_unittest.field_opt1) = 8765432109];
+    {::_pbi::TcParser::FastScS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestMessageWithCustomOptions, _impl_.field1_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional string field1 = 1 [ctype = CORD, (.protobuf_unittest.field_opt1) = 8765432109];
+    {PROTOBUF_FIELD_OFFSET(TestMessageWithCustomOptions, _impl_.field1_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // int32 oneof_field = 2;
+    {PROTOBUF_FIELD_OFFSET(TestMessageWithCustomOptions, _impl_.AnOneof_.oneof_field_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kInt32)},
+    // map<string, string> map_field = 3 [(.protobuf_unittest.field_opt1) = 12345];
+    {PROTOBUF_FIELD_OFFSET(TestMessageWithCustomOptions, _impl_.map_field_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMessageWithCustomOptions()._impl_.map_field_)>(
+        0, 1, 0, 9,
+        9)},
+  }}, {{
+    "\56\6\0\11\0\0\0\0"
+    "protobuf_unittest.TestMessageWithCustomOptions"
+    "field1"
+    "map_field"
+  }},
+};
+
+::uint8_t* TestMessageWithCustomOptions::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageWithCustomOptions)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string field1 = 1 [ctype = CORD, (.protobuf_unittest.field_opt1) = 8765432109];
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_field1();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestMessageWithCustomOptions.field1");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // int32 oneof_field = 2;
+  if (AnOneof_case() == kOneofField) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_oneof_field(), target);
+  }
+
+  // map<string, string> map_field = 3 [(.protobuf_unittest.field_opt1) = 12345];
+  if (!_internal_map_field().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestMessageWithCustomOptions.map_field");
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestMessageWithCustomOptions.map_field");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestMessageWithCustomOptions.map_field");
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestMessageWithCustomOptions.map_field");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageWithCustomOptions)
+  return target;
+}
+
+::size_t TestMessageWithCustomOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageWithCustomOptions)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> map_field = 3 [(.protobuf_unittest.field_opt1) = 12345];
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_field_size());
+  for (const auto& entry : _internal_map_field()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // optional string field1 = 1 [ctype = CORD, (.protobuf_unittest.field_opt1) = 8765432109];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_field1());
+  }
+
+  switch (AnOneof_case()) {
+    // int32 oneof_field = 2;
+    case kOneofField: {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_oneof_field());
+      break;
+    }
+    case ANONEOF_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageWithCustomOptions::_class_data_ = {
+    TestMessageWithCustomOptions::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageWithCustomOptions::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageWithCustomOptions::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageWithCustomOptions*>(&to_msg);
+  auto& from = static_cast<const TestMessageWithCustomOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageWithCustomOptions)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_field_.MergeFrom(from._impl_.map_field_);
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_field1(from._internal_field1());
+  }
+  switch (from.AnOneof_case()) {
+    case kOneofField: {
+      _this->_internal_set_oneof_field(from._internal_oneof_field());
+      break;
+    }
+    case ANONEOF_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageWithCustomOptions::CopyFrom(const TestMessageWithCustomOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageWithCustomOptions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageWithCustomOptions::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageWithCustomOptions::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageWithCustomOptions::InternalSwap(TestMessageWithCustomOptions* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.map_field_.InternalSwap(&other->_impl_.map_field_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.field1_, &other->_impl_.field1_, arena);
+  swap(_impl_.AnOneof_, other->_impl_.AnOneof_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata TestMessageWithCustomOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[1]);
+}
+// ===================================================================
+
+class CustomOptionFooRequest::_Internal {
+ public:
+};
+
+CustomOptionFooRequest::CustomOptionFooRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionFooRequest)
+}
+CustomOptionFooRequest::CustomOptionFooRequest(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionFooRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionFooRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionFooRequest)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionFooRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[2]);
+}
+// ===================================================================
+
+class CustomOptionFooResponse::_Internal {
+ public:
+};
+
+CustomOptionFooResponse::CustomOptionFooResponse(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionFooResponse)
+}
+CustomOptionFooResponse::CustomOptionFooResponse(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionFooResponse& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionFooResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionFooResponse)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionFooResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[3]);
+}
+// ===================================================================
+
+class CustomOptionFooClientMessage::_Internal {
+ public:
+};
+
+CustomOptionFooClientMessage::CustomOptionFooClientMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionFooClientMessage)
+}
+CustomOptionFooClientMessage::CustomOptionFooClientMessage(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionFooClientMessage& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionFooClientMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionFooClientMessage)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionFooClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[4]);
+}
+// ===================================================================
+
+class CustomOptionFooServerMessage::_Internal {
+ public:
+};
+
+CustomOptionFooServerMessage::CustomOptionFooServerMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionFooServerMessage)
+}
+CustomOptionFooServerMessage::CustomOptionFooServerMessage(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionFooServerMessage& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionFooServerMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionFooServerMessage)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionFooServerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[5]);
+}
+// ===================================================================
+
+class DummyMessageContainingEnum::_Internal {
+ public:
+};
+
+DummyMessageContainingEnum::DummyMessageContainingEnum(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.DummyMessageContainingEnum)
+}
+DummyMessageContainingEnum::DummyMessageContainingEnum(
+    ::google::protobuf::Arena* arena,
+    const DummyMessageContainingEnum& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  DummyMessageContainingEnum* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.DummyMessageContainingEnum)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata DummyMessageContainingEnum::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[6]);
+}
+// ===================================================================
+
+class DummyMessageInvalidAsOptionType::_Internal {
+ public:
+};
+
+DummyMessageInvalidAsOptionType::DummyMessageInvalidAsOptionType(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.DummyMessageInvalidAsOptionType)
+}
+DummyMessageInvalidAsOptionType::DummyMessageInvalidAsOptionType(
+    ::google::protobuf::Arena* arena,
+    const DummyMessageInvalidAsOptionType& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  DummyMessageInvalidAsOptionType* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.DummyMessageInvalidAsOptionType)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata DummyMessageInvalidAsOptionType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[7]);
+}
+// ===================================================================
+
+class CustomOptionMinIntegerValues::_Internal {
+ public:
+};
+
+CustomOptionMinIntegerValues::CustomOptionMinIntegerValues(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionMinIntegerValues)
+}
+CustomOptionMinIntegerValues::CustomOptionMinIntegerValues(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionMinIntegerValues& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionMinIntegerValues* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionMinIntegerValues)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionMinIntegerValues::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[8]);
+}
+// ===================================================================
+
+class CustomOptionMaxIntegerValues::_Internal {
+ public:
+};
+
+CustomOptionMaxIntegerValues::CustomOptionMaxIntegerValues(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionMaxIntegerValues)
+}
+CustomOptionMaxIntegerValues::CustomOptionMaxIntegerValues(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionMaxIntegerValues& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionMaxIntegerValues* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionMaxIntegerValues)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionMaxIntegerValues::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[9]);
+}
+// ===================================================================
+
+class CustomOptionOtherValues::_Internal {
+ public:
+};
+
+CustomOptionOtherValues::CustomOptionOtherValues(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.CustomOptionOtherValues)
+}
+CustomOptionOtherValues::CustomOptionOtherValues(
+    ::google::protobuf::Arena* arena,
+    const CustomOptionOtherValues& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  CustomOptionOtherValues* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.CustomOptionOtherValues)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata CustomOptionOtherValues::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[10]);
+}
+// ===================================================================
+
+class SettingRealsFromPositiveInts::_Internal {
+ public:
+};
+
+SettingRealsFromPositiveInts::SettingRealsFromPositiveInts(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.SettingRealsFromPositiveInts)
+}
+SettingRealsFromPositiveInts::SettingRealsFromPositiveInts(
+    ::google::protobuf::Arena* arena,
+    const SettingRealsFromPositiveInts& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  SettingRealsFromPositiveInts* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.SettingRealsFromPositiveInts)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata SettingRealsFromPositiveInts::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[11]);
+}
+// ===================================================================
+
+class SettingRealsFromNegativeInts::_Internal {
+ public:
+};
+
+SettingRealsFromNegativeInts::SettingRealsFromNegativeInts(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.SettingRealsFromNegativeInts)
+}
+SettingRealsFromNegativeInts::SettingRealsFromNegativeInts(
+    ::google::protobuf::Arena* arena,
+    const SettingRealsFromNegativeInts& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  SettingRealsFromNegativeInts* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.SettingRealsFromNegativeInts)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata SettingRealsFromNegativeInts::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[12]);
+}
+// ===================================================================
+
+class ComplexOptionType1::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ComplexOptionType1>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_._has_bits_);
+  static void set_has_foo(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_foo2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_foo3(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ComplexOptionType1::ComplexOptionType1(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ComplexOptionType1)
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        foo4_{visibility, arena, from.foo4_} {}
+
+ComplexOptionType1::ComplexOptionType1(
+    ::google::protobuf::Arena* arena,
+    const ComplexOptionType1& from)
+    : ::google::protobuf::Message(arena) {
+  ComplexOptionType1* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, foo_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, foo_),
+           offsetof(Impl_, foo3_) -
+               offsetof(Impl_, foo_) +
+               sizeof(Impl_::foo3_));
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.ComplexOptionType1)
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0},
+        foo4_{visibility, arena} {}
+
+inline void ComplexOptionType1::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, foo_),
+           0,
+           offsetof(Impl_, foo3_) -
+               offsetof(Impl_, foo_) +
+               sizeof(Impl_::foo3_));
+}
+ComplexOptionType1::~ComplexOptionType1() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ComplexOptionType1)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ComplexOptionType1::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ComplexOptionType1::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ComplexOptionType1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.foo4_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.foo_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.foo3_) -
+        reinterpret_cast<char*>(&_impl_.foo_)) + sizeof(_impl_.foo3_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ComplexOptionType1::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 0, 2> ComplexOptionType1::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_._extensions_),
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_ComplexOptionType1_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated int32 foo4 = 4;
+    {::_pbi::TcParser::FastV32R1,
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo4_)}},
+    // optional int32 foo = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType1, _impl_.foo_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo_)}},
+    // optional int32 foo2 = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType1, _impl_.foo2_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo2_)}},
+    // optional int32 foo3 = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType1, _impl_.foo3_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo3_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 foo = 1;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 foo2 = 2;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo2_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 foo3 = 3;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo3_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // repeated int32 foo4 = 4;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo4_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* ComplexOptionType1::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ComplexOptionType1)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 foo = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_foo(), target);
+  }
+
+  // optional int32 foo2 = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_foo2(), target);
+  }
+
+  // optional int32 foo3 = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<3>(
+            stream, this->_internal_foo3(), target);
+  }
+
+  // repeated int32 foo4 = 4;
+  for (int i = 0, n = this->_internal_foo4_size(); i < n; ++i) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        4, this->_internal_foo4().Get(i), target);
+  }
+
+  // Extension range [100, 536870912)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 100, 536870912, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ComplexOptionType1)
+  return target;
+}
+
+::size_t ComplexOptionType1::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ComplexOptionType1)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 foo4 = 4;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_foo4())
+    ;
+    std::size_t tag_size = std::size_t{1} *
+        ::_pbi::FromIntSize(this->_internal_foo4_size());
+    ;
+    total_size += tag_size + data_size;
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 foo = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_foo());
+    }
+
+    // optional int32 foo2 = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_foo2());
+    }
+
+    // optional int32 foo3 = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_foo3());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ComplexOptionType1::_class_data_ = {
+    ComplexOptionType1::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ComplexOptionType1::GetClassData() const {
+  return &_class_data_;
+}
+
+void ComplexOptionType1::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ComplexOptionType1*>(&to_msg);
+  auto& from = static_cast<const ComplexOptionType1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ComplexOptionType1)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_foo4()->MergeFrom(from._internal_foo4());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.foo_ = from._impl_.foo_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.foo2_ = from._impl_.foo2_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.foo3_ = from._impl_.foo3_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ComplexOptionType1::CopyFrom(const ComplexOptionType1& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ComplexOptionType1)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ComplexOptionType1::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* ComplexOptionType1::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ComplexOptionType1::InternalSwap(ComplexOptionType1* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.foo4_.InternalSwap(&other->_impl_.foo4_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo3_)
+      + sizeof(ComplexOptionType1::_impl_.foo3_)
+      - PROTOBUF_FIELD_OFFSET(ComplexOptionType1, _impl_.foo_)>(
+          reinterpret_cast<char*>(&_impl_.foo_),
+          reinterpret_cast<char*>(&other->_impl_.foo_));
+}
+
+::google::protobuf::Metadata ComplexOptionType1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[13]);
+}
+// ===================================================================
+
+class ComplexOptionType2_ComplexOptionType4::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ComplexOptionType2_ComplexOptionType4>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ComplexOptionType2_ComplexOptionType4, _impl_._has_bits_);
+  static void set_has_waldo(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ComplexOptionType2_ComplexOptionType4::ComplexOptionType2_ComplexOptionType4(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+}
+ComplexOptionType2_ComplexOptionType4::ComplexOptionType2_ComplexOptionType4(
+    ::google::protobuf::Arena* arena, const ComplexOptionType2_ComplexOptionType4& from)
+    : ComplexOptionType2_ComplexOptionType4(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType2_ComplexOptionType4::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void ComplexOptionType2_ComplexOptionType4::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.waldo_ = {};
+}
+ComplexOptionType2_ComplexOptionType4::~ComplexOptionType2_ComplexOptionType4() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ComplexOptionType2_ComplexOptionType4::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ComplexOptionType2_ComplexOptionType4::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.waldo_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ComplexOptionType2_ComplexOptionType4::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ComplexOptionType2_ComplexOptionType4::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType2_ComplexOptionType4, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_ComplexOptionType2_ComplexOptionType4_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional int32 waldo = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType2_ComplexOptionType4, _impl_.waldo_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType2_ComplexOptionType4, _impl_.waldo_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 waldo = 1;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType2_ComplexOptionType4, _impl_.waldo_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* ComplexOptionType2_ComplexOptionType4::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 waldo = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_waldo(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  return target;
+}
+
+::size_t ComplexOptionType2_ComplexOptionType4::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 waldo = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_waldo());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ComplexOptionType2_ComplexOptionType4::_class_data_ = {
+    ComplexOptionType2_ComplexOptionType4::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ComplexOptionType2_ComplexOptionType4::GetClassData() const {
+  return &_class_data_;
+}
+
+void ComplexOptionType2_ComplexOptionType4::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ComplexOptionType2_ComplexOptionType4*>(&to_msg);
+  auto& from = static_cast<const ComplexOptionType2_ComplexOptionType4&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_waldo(from._internal_waldo());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ComplexOptionType2_ComplexOptionType4::CopyFrom(const ComplexOptionType2_ComplexOptionType4& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ComplexOptionType2_ComplexOptionType4::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* ComplexOptionType2_ComplexOptionType4::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ComplexOptionType2_ComplexOptionType4::InternalSwap(ComplexOptionType2_ComplexOptionType4* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.waldo_, other->_impl_.waldo_);
+}
+
+::google::protobuf::Metadata ComplexOptionType2_ComplexOptionType4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[14]);
+}
+// ===================================================================
+
+class ComplexOptionType2::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ComplexOptionType2>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_._has_bits_);
+  static const ::protobuf_unittest::ComplexOptionType1& bar(const ComplexOptionType2* msg);
+  static void set_has_bar(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_baz(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& fred(const ComplexOptionType2* msg);
+  static void set_has_fred(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::protobuf_unittest::ComplexOptionType1& ComplexOptionType2::_Internal::bar(const ComplexOptionType2* msg) {
+  return *msg->_impl_.bar_;
+}
+const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& ComplexOptionType2::_Internal::fred(const ComplexOptionType2* msg) {
+  return *msg->_impl_.fred_;
+}
+ComplexOptionType2::ComplexOptionType2(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ComplexOptionType2)
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        barney_{visibility, arena, from.barney_} {}
+
+ComplexOptionType2::ComplexOptionType2(
+    ::google::protobuf::Arena* arena,
+    const ComplexOptionType2& from)
+    : ::google::protobuf::Message(arena) {
+  ComplexOptionType2* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.bar_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::ComplexOptionType1>(arena, *from._impl_.bar_)
+                : nullptr;
+  _impl_.fred_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>(arena, *from._impl_.fred_)
+                : nullptr;
+  _impl_.baz_ = from._impl_.baz_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.ComplexOptionType2)
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0},
+        barney_{visibility, arena} {}
+
+inline void ComplexOptionType2::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, bar_),
+           0,
+           offsetof(Impl_, baz_) -
+               offsetof(Impl_, bar_) +
+               sizeof(Impl_::baz_));
+}
+ComplexOptionType2::~ComplexOptionType2() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ComplexOptionType2)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ComplexOptionType2::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.bar_;
+  delete _impl_.fred_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ComplexOptionType2::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ComplexOptionType2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.barney_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.bar_ != nullptr);
+      _impl_.bar_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.fred_ != nullptr);
+      _impl_.fred_->Clear();
+    }
+  }
+  _impl_.baz_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ComplexOptionType2::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 3, 0, 2> ComplexOptionType2::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_._extensions_),
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    3,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_ComplexOptionType2_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 barney = 4;
+    {::_pbi::TcParser::FastMtR1,
+     {34, 63, 2, PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.barney_)}},
+    // optional .protobuf_unittest.ComplexOptionType1 bar = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.bar_)}},
+    // optional int32 baz = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType2, _impl_.baz_), 2>(),
+     {16, 2, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.baz_)}},
+    // optional .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 fred = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 1, 1, PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.fred_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional .protobuf_unittest.ComplexOptionType1 bar = 1;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.bar_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional int32 baz = 2;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.baz_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 fred = 3;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.fred_), _Internal::kHasBitsOffset + 1, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 barney = 4;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.barney_), -1, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::ComplexOptionType1>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* ComplexOptionType2::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ComplexOptionType2)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .protobuf_unittest.ComplexOptionType1 bar = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::bar(this),
+        _Internal::bar(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 baz = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_baz(), target);
+  }
+
+  // optional .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 fred = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::fred(this),
+        _Internal::fred(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 barney = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_barney_size()); i < n; i++) {
+    const auto& repfield = this->_internal_barney().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // Extension range [100, 536870912)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 100, 536870912, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ComplexOptionType2)
+  return target;
+}
+
+::size_t ComplexOptionType2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ComplexOptionType2)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 barney = 4;
+  total_size += 1UL * this->_internal_barney_size();
+  for (const auto& msg : this->_internal_barney()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .protobuf_unittest.ComplexOptionType1 bar = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.bar_);
+    }
+
+    // optional .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 fred = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.fred_);
+    }
+
+    // optional int32 baz = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_baz());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ComplexOptionType2::_class_data_ = {
+    ComplexOptionType2::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ComplexOptionType2::GetClassData() const {
+  return &_class_data_;
+}
+
+void ComplexOptionType2::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ComplexOptionType2*>(&to_msg);
+  auto& from = static_cast<const ComplexOptionType2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ComplexOptionType2)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_barney()->MergeFrom(
+      from._internal_barney());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_bar()->::protobuf_unittest::ComplexOptionType1::MergeFrom(
+          from._internal_bar());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_fred()->::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::MergeFrom(
+          from._internal_fred());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.baz_ = from._impl_.baz_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ComplexOptionType2::CopyFrom(const ComplexOptionType2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ComplexOptionType2)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ComplexOptionType2::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  if ((_impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (!_impl_.bar_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* ComplexOptionType2::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ComplexOptionType2::InternalSwap(ComplexOptionType2* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.barney_.InternalSwap(&other->_impl_.barney_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.baz_)
+      + sizeof(ComplexOptionType2::_impl_.baz_)
+      - PROTOBUF_FIELD_OFFSET(ComplexOptionType2, _impl_.bar_)>(
+          reinterpret_cast<char*>(&_impl_.bar_),
+          reinterpret_cast<char*>(&other->_impl_.bar_));
+}
+
+::google::protobuf::Metadata ComplexOptionType2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[15]);
+}
+// ===================================================================
+
+class ComplexOptionType3_ComplexOptionType5::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ComplexOptionType3_ComplexOptionType5>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ComplexOptionType3_ComplexOptionType5, _impl_._has_bits_);
+  static void set_has_plugh(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ComplexOptionType3_ComplexOptionType5::ComplexOptionType3_ComplexOptionType5(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+}
+ComplexOptionType3_ComplexOptionType5::ComplexOptionType3_ComplexOptionType5(
+    ::google::protobuf::Arena* arena, const ComplexOptionType3_ComplexOptionType5& from)
+    : ComplexOptionType3_ComplexOptionType5(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType3_ComplexOptionType5::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void ComplexOptionType3_ComplexOptionType5::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.plugh_ = {};
+}
+ComplexOptionType3_ComplexOptionType5::~ComplexOptionType3_ComplexOptionType5() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ComplexOptionType3_ComplexOptionType5::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ComplexOptionType3_ComplexOptionType5::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.plugh_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ComplexOptionType3_ComplexOptionType5::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 1, 0, 0, 2> ComplexOptionType3_ComplexOptionType5::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType3_ComplexOptionType5, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967291,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_ComplexOptionType3_ComplexOptionType5_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::FastEndG1, {20, 20}},
+    // optional int32 plugh = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType3_ComplexOptionType5, _impl_.plugh_), 0>(),
+     {24, 0, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType3_ComplexOptionType5, _impl_.plugh_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 plugh = 3;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType3_ComplexOptionType5, _impl_.plugh_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* ComplexOptionType3_ComplexOptionType5::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 plugh = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        3, this->_internal_plugh(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  return target;
+}
+
+::size_t ComplexOptionType3_ComplexOptionType5::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 plugh = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_plugh());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ComplexOptionType3_ComplexOptionType5::_class_data_ = {
+    ComplexOptionType3_ComplexOptionType5::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ComplexOptionType3_ComplexOptionType5::GetClassData() const {
+  return &_class_data_;
+}
+
+void ComplexOptionType3_ComplexOptionType5::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ComplexOptionType3_ComplexOptionType5*>(&to_msg);
+  auto& from = static_cast<const ComplexOptionType3_ComplexOptionType5&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_plugh(from._internal_plugh());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ComplexOptionType3_ComplexOptionType5::CopyFrom(const ComplexOptionType3_ComplexOptionType5& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ComplexOptionType3_ComplexOptionType5::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* ComplexOptionType3_ComplexOptionType5::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ComplexOptionType3_ComplexOptionType5::InternalSwap(ComplexOptionType3_ComplexOptionType5* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.plugh_, other->_impl_.plugh_);
+}
+
+::google::protobuf::Metadata ComplexOptionType3_ComplexOptionType5::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[16]);
+}
+// ===================================================================
+
+class ComplexOptionType3::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ComplexOptionType3>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_._has_bits_);
+  static void set_has_moo(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& complexoptiontype5(const ComplexOptionType3* msg);
+  static void set_has_complexoptiontype5(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& ComplexOptionType3::_Internal::complexoptiontype5(const ComplexOptionType3* msg) {
+  return *msg->_impl_.complexoptiontype5_;
+}
+ComplexOptionType3::ComplexOptionType3(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ComplexOptionType3)
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType3::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+ComplexOptionType3::ComplexOptionType3(
+    ::google::protobuf::Arena* arena,
+    const ComplexOptionType3& from)
+    : ::google::protobuf::Message(arena) {
+  ComplexOptionType3* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.complexoptiontype5_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5>(arena, *from._impl_.complexoptiontype5_)
+                : nullptr;
+  _impl_.moo_ = from._impl_.moo_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.ComplexOptionType3)
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOptionType3::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void ComplexOptionType3::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, complexoptiontype5_),
+           0,
+           offsetof(Impl_, moo_) -
+               offsetof(Impl_, complexoptiontype5_) +
+               sizeof(Impl_::moo_));
+}
+ComplexOptionType3::~ComplexOptionType3() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ComplexOptionType3)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ComplexOptionType3::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.complexoptiontype5_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ComplexOptionType3::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ComplexOptionType3)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.complexoptiontype5_ != nullptr);
+    _impl_.complexoptiontype5_->Clear();
+  }
+  _impl_.moo_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ComplexOptionType3::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 0, 2> ComplexOptionType3::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_ComplexOptionType3_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional group ComplexOptionType5 = 2 { ... };
+    {::_pbi::TcParser::FastGtS1,
+     {19, 0, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_.complexoptiontype5_)}},
+    // optional int32 moo = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ComplexOptionType3, _impl_.moo_), 1>(),
+     {8, 1, 0, PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_.moo_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 moo = 1;
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_.moo_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional group ComplexOptionType5 = 2 { ... };
+    {PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_.complexoptiontype5_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kRepGroup | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* ComplexOptionType3::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ComplexOptionType3)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 moo = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_moo(), target);
+  }
+
+  // optional group ComplexOptionType5 = 2 { ... };
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteGroup(
+        2, _Internal::complexoptiontype5(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ComplexOptionType3)
+  return target;
+}
+
+::size_t ComplexOptionType3::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ComplexOptionType3)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional group ComplexOptionType5 = 2 { ... };
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::GroupSize(*_impl_.complexoptiontype5_);
+    }
+
+    // optional int32 moo = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_moo());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ComplexOptionType3::_class_data_ = {
+    ComplexOptionType3::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ComplexOptionType3::GetClassData() const {
+  return &_class_data_;
+}
+
+void ComplexOptionType3::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ComplexOptionType3*>(&to_msg);
+  auto& from = static_cast<const ComplexOptionType3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ComplexOptionType3)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_complexoptiontype5()->::protobuf_unittest::ComplexOptionType3_ComplexOptionType5::MergeFrom(
+          from._internal_complexoptiontype5());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.moo_ = from._impl_.moo_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ComplexOptionType3::CopyFrom(const ComplexOptionType3& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ComplexOptionType3)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ComplexOptionType3::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* ComplexOptionType3::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ComplexOptionType3::InternalSwap(ComplexOptionType3* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_.moo_)
+      + sizeof(ComplexOptionType3::_impl_.moo_)
+      - PROTOBUF_FIELD_OFFSET(ComplexOptionType3, _impl_.complexoptiontype5_)>(
+          reinterpret_cast<char*>(&_impl_.complexoptiontype5_),
+          reinterpret_cast<char*>(&other->_impl_.complexoptiontype5_));
+}
+
+::google::protobuf::Metadata ComplexOptionType3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[17]);
+}
+// ===================================================================
+
+class ComplexOpt6::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ComplexOpt6>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ComplexOpt6, _impl_._has_bits_);
+  static void set_has_xyzzy(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ComplexOpt6::ComplexOpt6(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ComplexOpt6)
+}
+ComplexOpt6::ComplexOpt6(
+    ::google::protobuf::Arena* arena, const ComplexOpt6& from)
+    : ComplexOpt6(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE ComplexOpt6::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void ComplexOpt6::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.xyzzy_ = {};
+}
+ComplexOpt6::~ComplexOpt6() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ComplexOpt6)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ComplexOpt6::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ComplexOpt6::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ComplexOpt6)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.xyzzy_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ComplexOpt6::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 7> ComplexOpt6::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ComplexOpt6, _impl_._has_bits_),
+    0, // no _extensions_
+    7593951, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_ComplexOpt6_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    57311, 115, 1,
+    65534, 0,
+    65535, 65535
+  }}, {{
+    // optional int32 xyzzy = 7593951;
+    {PROTOBUF_FIELD_OFFSET(ComplexOpt6, _impl_.xyzzy_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* ComplexOpt6::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ComplexOpt6)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 14 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[14];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 xyzzy = 7593951;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        7593951, this->_internal_xyzzy(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ComplexOpt6)
+  return target;
+}
+
+::size_t ComplexOpt6::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ComplexOpt6)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 xyzzy = 7593951;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 4 + ::_pbi::WireFormatLite::Int32Size(
+                                    this->_internal_xyzzy());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ComplexOpt6::_class_data_ = {
+    ComplexOpt6::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ComplexOpt6::GetClassData() const {
+  return &_class_data_;
+}
+
+void ComplexOpt6::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ComplexOpt6*>(&to_msg);
+  auto& from = static_cast<const ComplexOpt6&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ComplexOpt6)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_xyzzy(from._internal_xyzzy());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ComplexOpt6::CopyFrom(const ComplexOpt6& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ComplexOpt6)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ComplexOpt6::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* ComplexOpt6::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ComplexOpt6::InternalSwap(ComplexOpt6* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.xyzzy_, other->_impl_.xyzzy_);
+}
+
+::google::protobuf::Metadata ComplexOpt6::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[18]);
+}
+// ===================================================================
+
+class VariousComplexOptions::_Internal {
+ public:
+};
+
+VariousComplexOptions::VariousComplexOptions(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.VariousComplexOptions)
+}
+VariousComplexOptions::VariousComplexOptions(
+    ::google::protobuf::Arena* arena,
+    const VariousComplexOptions& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  VariousComplexOptions* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.VariousComplexOptions)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata VariousComplexOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[19]);
+}
+// ===================================================================
+
+class AggregateMessageSet::_Internal {
+ public:
+};
+
+AggregateMessageSet::AggregateMessageSet(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.AggregateMessageSet)
+}
+inline PROTOBUF_NDEBUG_INLINE AggregateMessageSet::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+AggregateMessageSet::AggregateMessageSet(
+    ::google::protobuf::Arena* arena,
+    const AggregateMessageSet& from)
+    : ::google::protobuf::Message(arena) {
+  AggregateMessageSet* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.AggregateMessageSet)
+}
+inline PROTOBUF_NDEBUG_INLINE AggregateMessageSet::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void AggregateMessageSet::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+AggregateMessageSet::~AggregateMessageSet() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.AggregateMessageSet)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void AggregateMessageSet::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void AggregateMessageSet::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.AggregateMessageSet)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* AggregateMessageSet::_InternalParse(const char* ptr,
+                  ::_pbi::ParseContext* ctx) {
+  return _impl_._extensions_.ParseMessageSet(ptr, 
+      internal_default_instance(), &_internal_metadata_, ctx);
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 0, 0, 0, 2> AggregateMessageSet::_table_ = {
+  {
+    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(AggregateMessageSet, _impl_._extensions_),
+    0, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_names),  // no field_entries
+    0,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_AggregateMessageSet_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }},
+  // no field_entries, or aux_entries
+  {{
+  }},
+};
+
+::uint8_t* AggregateMessageSet::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+   target =
+      _impl_._extensions_.InternalSerializeMessageSetWithCachedSizesToArray(
+          internal_default_instance(), target, stream);
+  target = ::_pbi::InternalSerializeUnknownMessageSetItemsToArray(
+      _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  return target;
+}
+
+PROTOBUF_NOINLINE ::size_t AggregateMessageSet::ByteSizeLong() const {
+  // @@protoc_insertion_point(message_set_byte_size_start:protobuf_unittest.AggregateMessageSet)
+  ::size_t total_size = _impl_._extensions_.MessageSetByteSize();
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size += ::_pbi::ComputeUnknownMessageSetItemsSize(_internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance));
+  }
+  _impl_._cached_size_.Set(::_pbi::ToCachedSize(total_size));
+  return total_size;
+}
+
+const ::google::protobuf::Message::ClassData AggregateMessageSet::_class_data_ = {
+    AggregateMessageSet::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* AggregateMessageSet::GetClassData() const {
+  return &_class_data_;
+}
+
+void AggregateMessageSet::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<AggregateMessageSet*>(&to_msg);
+  auto& from = static_cast<const AggregateMessageSet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.AggregateMessageSet)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AggregateMessageSet::CopyFrom(const AggregateMessageSet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.AggregateMessageSet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool AggregateMessageSet::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* AggregateMessageSet::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void AggregateMessageSet::InternalSwap(AggregateMessageSet* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+}
+
+::google::protobuf::Metadata AggregateMessageSet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[20]);
+}
+// ===================================================================
+
+class AggregateMessageSetElement::_Internal {
+ public:
+  using HasBits = decltype(std::declval<AggregateMessageSetElement>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(AggregateMessageSetElement, _impl_._has_bits_);
+  static void set_has_s(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+AggregateMessageSetElement::AggregateMessageSetElement(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.AggregateMessageSetElement)
+}
+inline PROTOBUF_NDEBUG_INLINE AggregateMessageSetElement::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        s_(arena, from.s_) {}
+
+AggregateMessageSetElement::AggregateMessageSetElement(
+    ::google::protobuf::Arena* arena,
+    const AggregateMessageSetElement& from)
+    : ::google::protobuf::Message(arena) {
+  AggregateMessageSetElement* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.AggregateMessageSetElement)
+}
+inline PROTOBUF_NDEBUG_INLINE AggregateMessageSetElement::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        s_(arena) {}
+
+inline void AggregateMessageSetElement::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+AggregateMessageSetElement::~AggregateMessageSetElement() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.AggregateMessageSetElement)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void AggregateMessageSetElement::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.s_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void AggregateMessageSetElement::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.AggregateMessageSetElement)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.s_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* AggregateMessageSetElement::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 54, 2> AggregateMessageSetElement::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(AggregateMessageSetElement, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_AggregateMessageSetElement_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string s = 1;
+    {::_pbi::TcParser::FastSS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(AggregateMessageSetElement, _impl_.s_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional string s = 1;
+    {PROTOBUF_FIELD_OFFSET(AggregateMessageSetElement, _impl_.s_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\54\1\0\0\0\0\0\0"
+    "protobuf_unittest.AggregateMessageSetElement"
+    "s"
+  }},
+};
+
+::uint8_t* AggregateMessageSetElement::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.AggregateMessageSetElement)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string s = 1;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_s();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.AggregateMessageSetElement.s");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.AggregateMessageSetElement)
+  return target;
+}
+
+::size_t AggregateMessageSetElement::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.AggregateMessageSetElement)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string s = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_s());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData AggregateMessageSetElement::_class_data_ = {
+    AggregateMessageSetElement::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* AggregateMessageSetElement::GetClassData() const {
+  return &_class_data_;
+}
+
+void AggregateMessageSetElement::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<AggregateMessageSetElement*>(&to_msg);
+  auto& from = static_cast<const AggregateMessageSetElement&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.AggregateMessageSetElement)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_s(from._internal_s());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AggregateMessageSetElement::CopyFrom(const AggregateMessageSetElement& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.AggregateMessageSetElement)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool AggregateMessageSetElement::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* AggregateMessageSetElement::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void AggregateMessageSetElement::InternalSwap(AggregateMessageSetElement* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.s_, &other->_impl_.s_, arena);
+}
+
+::google::protobuf::Metadata AggregateMessageSetElement::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[21]);
+}
+// ===================================================================
+
+class Aggregate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Aggregate>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(Aggregate, _impl_._has_bits_);
+  static void set_has_i(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_s(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::protobuf_unittest::Aggregate& sub(const Aggregate* msg);
+  static void set_has_sub(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::google::protobuf::FileOptions& file(const Aggregate* msg);
+  static void set_has_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::protobuf_unittest::AggregateMessageSet& mset(const Aggregate* msg);
+  static void set_has_mset(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::google::protobuf::Any& any(const Aggregate* msg);
+  static void set_has_any(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::protobuf_unittest::Aggregate& Aggregate::_Internal::sub(const Aggregate* msg) {
+  return *msg->_impl_.sub_;
+}
+const ::google::protobuf::FileOptions& Aggregate::_Internal::file(const Aggregate* msg) {
+  return *msg->_impl_.file_;
+}
+const ::protobuf_unittest::AggregateMessageSet& Aggregate::_Internal::mset(const Aggregate* msg) {
+  return *msg->_impl_.mset_;
+}
+const ::google::protobuf::Any& Aggregate::_Internal::any(const Aggregate* msg) {
+  return *msg->_impl_.any_;
+}
+void Aggregate::clear_file() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.file_ != nullptr) _impl_.file_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+void Aggregate::clear_any() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.any_ != nullptr) _impl_.any_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+Aggregate::Aggregate(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.Aggregate)
+}
+inline PROTOBUF_NDEBUG_INLINE Aggregate::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        s_(arena, from.s_) {}
+
+Aggregate::Aggregate(
+    ::google::protobuf::Arena* arena,
+    const Aggregate& from)
+    : ::google::protobuf::Message(arena) {
+  Aggregate* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.sub_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::protobuf_unittest::Aggregate>(arena, *from._impl_.sub_)
+                : nullptr;
+  _impl_.file_ = (cached_has_bits & 0x00000004u)
+                ? CreateMaybeMessage<::google::protobuf::FileOptions>(arena, *from._impl_.file_)
+                : nullptr;
+  _impl_.mset_ = (cached_has_bits & 0x00000008u)
+                ? CreateMaybeMessage<::protobuf_unittest::AggregateMessageSet>(arena, *from._impl_.mset_)
+                : nullptr;
+  _impl_.any_ = (cached_has_bits & 0x00000010u)
+                ? CreateMaybeMessage<::google::protobuf::Any>(arena, *from._impl_.any_)
+                : nullptr;
+  _impl_.i_ = from._impl_.i_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.Aggregate)
+}
+inline PROTOBUF_NDEBUG_INLINE Aggregate::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        s_(arena) {}
+
+inline void Aggregate::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, sub_),
+           0,
+           offsetof(Impl_, i_) -
+               offsetof(Impl_, sub_) +
+               sizeof(Impl_::i_));
+}
+Aggregate::~Aggregate() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.Aggregate)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Aggregate::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.s_.Destroy();
+  delete _impl_.sub_;
+  delete _impl_.file_;
+  delete _impl_.mset_;
+  delete _impl_.any_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Aggregate::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.Aggregate)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.s_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.sub_ != nullptr);
+      _impl_.sub_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      ABSL_DCHECK(_impl_.file_ != nullptr);
+      _impl_.file_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      ABSL_DCHECK(_impl_.mset_ != nullptr);
+      _impl_.mset_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      ABSL_DCHECK(_impl_.any_ != nullptr);
+      _impl_.any_->Clear();
+    }
+  }
+  _impl_.i_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Aggregate::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 6, 4, 37, 2> Aggregate::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(Aggregate, _impl_._has_bits_),
+    0, // no _extensions_
+    6, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    4,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_Aggregate_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional int32 i = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Aggregate, _impl_.i_), 5>(),
+     {8, 5, 0, PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.i_)}},
+    // optional string s = 2;
+    {::_pbi::TcParser::FastSS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.s_)}},
+    // optional .protobuf_unittest.Aggregate sub = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 1, 0, PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.sub_)}},
+    // optional .google.protobuf.FileOptions file = 4;
+    {::_pbi::TcParser::FastMtS1,
+     {34, 2, 1, PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.file_)}},
+    // optional .protobuf_unittest.AggregateMessageSet mset = 5;
+    {::_pbi::TcParser::FastMdS1,
+     {42, 3, 2, PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.mset_)}},
+    // optional .google.protobuf.Any any = 6;
+    {::_pbi::TcParser::FastMtS1,
+     {50, 4, 3, PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.any_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 i = 1;
+    {PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.i_), _Internal::kHasBitsOffset + 5, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional string s = 2;
+    {PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.s_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // optional .protobuf_unittest.Aggregate sub = 3;
+    {PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.sub_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .google.protobuf.FileOptions file = 4;
+    {PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.file_), _Internal::kHasBitsOffset + 2, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .protobuf_unittest.AggregateMessageSet mset = 5;
+    {PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.mset_), _Internal::kHasBitsOffset + 3, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvDefault)},
+    // optional .google.protobuf.Any any = 6;
+    {PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.any_), _Internal::kHasBitsOffset + 4, 3,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::Aggregate>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FileOptions>()},
+    {::_pbi::FieldAuxDefaultMessage{}, &::protobuf_unittest::_AggregateMessageSet_default_instance_},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+  }}, {{
+    "\33\0\1\0\0\0\0\0"
+    "protobuf_unittest.Aggregate"
+    "s"
+  }},
+};
+
+::uint8_t* Aggregate::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.Aggregate)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 i = 1;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_i(), target);
+  }
+
+  // optional string s = 2;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_s();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.Aggregate.s");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
+  }
+
+  // optional .protobuf_unittest.Aggregate sub = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::sub(this),
+        _Internal::sub(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .google.protobuf.FileOptions file = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        4, _Internal::file(this),
+        _Internal::file(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .protobuf_unittest.AggregateMessageSet mset = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        5, _Internal::mset(this),
+        _Internal::mset(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .google.protobuf.Any any = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        6, _Internal::any(this),
+        _Internal::any(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.Aggregate)
+  return target;
+}
+
+::size_t Aggregate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.Aggregate)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string s = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_s());
+    }
+
+    // optional .protobuf_unittest.Aggregate sub = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.sub_);
+    }
+
+    // optional .google.protobuf.FileOptions file = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.file_);
+    }
+
+    // optional .protobuf_unittest.AggregateMessageSet mset = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.mset_);
+    }
+
+    // optional .google.protobuf.Any any = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.any_);
+    }
+
+    // optional int32 i = 1;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_i());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Aggregate::_class_data_ = {
+    Aggregate::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Aggregate::GetClassData() const {
+  return &_class_data_;
+}
+
+void Aggregate::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Aggregate*>(&to_msg);
+  auto& from = static_cast<const Aggregate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.Aggregate)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_s(from._internal_s());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_sub()->::protobuf_unittest::Aggregate::MergeFrom(
+          from._internal_sub());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_file()->::google::protobuf::FileOptions::MergeFrom(
+          from._internal_file());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_mset()->::protobuf_unittest::AggregateMessageSet::MergeFrom(
+          from._internal_mset());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_any()->::google::protobuf::Any::MergeFrom(
+          from._internal_any());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.i_ = from._impl_.i_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Aggregate::CopyFrom(const Aggregate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.Aggregate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Aggregate::IsInitialized() const {
+  if ((_impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (!_impl_.sub_->IsInitialized()) return false;
+  }
+  if ((_impl_._has_bits_[0] & 0x00000004u) != 0) {
+    if (!_impl_.file_->IsInitialized()) return false;
+  }
+  if ((_impl_._has_bits_[0] & 0x00000008u) != 0) {
+    if (!_impl_.mset_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* Aggregate::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Aggregate::InternalSwap(Aggregate* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.s_, &other->_impl_.s_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.i_)
+      + sizeof(Aggregate::_impl_.i_)
+      - PROTOBUF_FIELD_OFFSET(Aggregate, _impl_.sub_)>(
+          reinterpret_cast<char*>(&_impl_.sub_),
+          reinterpret_cast<char*>(&other->_impl_.sub_));
+}
+
+::google::protobuf::Metadata Aggregate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[22]);
+}
+// ===================================================================
+
+class AggregateMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<AggregateMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(AggregateMessage, _impl_._has_bits_);
+  static void set_has_fieldname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+AggregateMessage::AggregateMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.AggregateMessage)
+}
+AggregateMessage::AggregateMessage(
+    ::google::protobuf::Arena* arena, const AggregateMessage& from)
+    : AggregateMessage(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE AggregateMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void AggregateMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.fieldname_ = {};
+}
+AggregateMessage::~AggregateMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.AggregateMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void AggregateMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void AggregateMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.AggregateMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.fieldname_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* AggregateMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> AggregateMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(AggregateMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_AggregateMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional int32 fieldname = 1 [(.protobuf_unittest.fieldopt) = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AggregateMessage, _impl_.fieldname_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(AggregateMessage, _impl_.fieldname_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 fieldname = 1 [(.protobuf_unittest.fieldopt) = {
+    {PROTOBUF_FIELD_OFFSET(AggregateMessage, _impl_.fieldname_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* AggregateMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.AggregateMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 fieldname = 1 [(.protobuf_unittest.fieldopt) = {
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_fieldname(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.AggregateMessage)
+  return target;
+}
+
+::size_t AggregateMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.AggregateMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 fieldname = 1 [(.protobuf_unittest.fieldopt) = {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_fieldname());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData AggregateMessage::_class_data_ = {
+    AggregateMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* AggregateMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void AggregateMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<AggregateMessage*>(&to_msg);
+  auto& from = static_cast<const AggregateMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.AggregateMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_fieldname(from._internal_fieldname());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AggregateMessage::CopyFrom(const AggregateMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.AggregateMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool AggregateMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* AggregateMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void AggregateMessage::InternalSwap(AggregateMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.fieldname_, other->_impl_.fieldname_);
+}
+
+::google::protobuf::Metadata AggregateMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[23]);
+}
+// ===================================================================
+
+class NestedOptionType_NestedMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NestedOptionType_NestedMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(NestedOptionType_NestedMessage, _impl_._has_bits_);
+  static void set_has_nested_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+NestedOptionType_NestedMessage::NestedOptionType_NestedMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NestedOptionType.NestedMessage)
+}
+NestedOptionType_NestedMessage::NestedOptionType_NestedMessage(
+    ::google::protobuf::Arena* arena, const NestedOptionType_NestedMessage& from)
+    : NestedOptionType_NestedMessage(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE NestedOptionType_NestedMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void NestedOptionType_NestedMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.nested_field_ = {};
+}
+NestedOptionType_NestedMessage::~NestedOptionType_NestedMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.NestedOptionType.NestedMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void NestedOptionType_NestedMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void NestedOptionType_NestedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.NestedOptionType.NestedMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nested_field_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* NestedOptionType_NestedMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> NestedOptionType_NestedMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(NestedOptionType_NestedMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_NestedOptionType_NestedMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional int32 nested_field = 1 [(.protobuf_unittest.field_opt1) = 1002];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NestedOptionType_NestedMessage, _impl_.nested_field_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(NestedOptionType_NestedMessage, _impl_.nested_field_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 nested_field = 1 [(.protobuf_unittest.field_opt1) = 1002];
+    {PROTOBUF_FIELD_OFFSET(NestedOptionType_NestedMessage, _impl_.nested_field_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* NestedOptionType_NestedMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.NestedOptionType.NestedMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 nested_field = 1 [(.protobuf_unittest.field_opt1) = 1002];
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_nested_field(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.NestedOptionType.NestedMessage)
+  return target;
+}
+
+::size_t NestedOptionType_NestedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.NestedOptionType.NestedMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 nested_field = 1 [(.protobuf_unittest.field_opt1) = 1002];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_nested_field());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData NestedOptionType_NestedMessage::_class_data_ = {
+    NestedOptionType_NestedMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* NestedOptionType_NestedMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void NestedOptionType_NestedMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<NestedOptionType_NestedMessage*>(&to_msg);
+  auto& from = static_cast<const NestedOptionType_NestedMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.NestedOptionType.NestedMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_nested_field(from._internal_nested_field());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NestedOptionType_NestedMessage::CopyFrom(const NestedOptionType_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.NestedOptionType.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool NestedOptionType_NestedMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* NestedOptionType_NestedMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void NestedOptionType_NestedMessage::InternalSwap(NestedOptionType_NestedMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.nested_field_, other->_impl_.nested_field_);
+}
+
+::google::protobuf::Metadata NestedOptionType_NestedMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[24]);
+}
+// ===================================================================
+
+class NestedOptionType::_Internal {
+ public:
+};
+
+NestedOptionType::NestedOptionType(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NestedOptionType)
+}
+NestedOptionType::NestedOptionType(
+    ::google::protobuf::Arena* arena,
+    const NestedOptionType& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  NestedOptionType* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.NestedOptionType)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata NestedOptionType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[25]);
+}
+// ===================================================================
+
+class OldOptionType::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OldOptionType>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(OldOptionType, _impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+OldOptionType::OldOptionType(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.OldOptionType)
+}
+OldOptionType::OldOptionType(
+    ::google::protobuf::Arena* arena, const OldOptionType& from)
+    : OldOptionType(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE OldOptionType::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void OldOptionType::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+OldOptionType::~OldOptionType() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.OldOptionType)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void OldOptionType::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void OldOptionType::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.OldOptionType)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* OldOptionType::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> OldOptionType::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(OldOptionType, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_OldOptionType_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // required .protobuf_unittest.OldOptionType.TestEnum value = 1;
+    {::_pbi::TcParser::FastEr0S1,
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(OldOptionType, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required .protobuf_unittest.OldOptionType.TestEnum value = 1;
+    {PROTOBUF_FIELD_OFFSET(OldOptionType, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kEnumRange)},
+  }}, {{
+    {0, 1},
+  }}, {{
+  }},
+};
+
+::uint8_t* OldOptionType::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.OldOptionType)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .protobuf_unittest.OldOptionType.TestEnum value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.OldOptionType)
+  return target;
+}
+
+::size_t OldOptionType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.OldOptionType)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // required .protobuf_unittest.OldOptionType.TestEnum value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData OldOptionType::_class_data_ = {
+    OldOptionType::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* OldOptionType::GetClassData() const {
+  return &_class_data_;
+}
+
+void OldOptionType::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<OldOptionType*>(&to_msg);
+  auto& from = static_cast<const OldOptionType&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.OldOptionType)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OldOptionType::CopyFrom(const OldOptionType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.OldOptionType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool OldOptionType::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* OldOptionType::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void OldOptionType::InternalSwap(OldOptionType* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata OldOptionType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[26]);
+}
+// ===================================================================
+
+class NewOptionType::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NewOptionType>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(NewOptionType, _impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+NewOptionType::NewOptionType(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NewOptionType)
+}
+NewOptionType::NewOptionType(
+    ::google::protobuf::Arena* arena, const NewOptionType& from)
+    : NewOptionType(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE NewOptionType::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void NewOptionType::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+NewOptionType::~NewOptionType() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.NewOptionType)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void NewOptionType::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void NewOptionType::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.NewOptionType)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* NewOptionType::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> NewOptionType::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(NewOptionType, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_NewOptionType_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // required .protobuf_unittest.NewOptionType.TestEnum value = 1;
+    {::_pbi::TcParser::FastEr0S1,
+     {8, 0, 1, PROTOBUF_FIELD_OFFSET(NewOptionType, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required .protobuf_unittest.NewOptionType.TestEnum value = 1;
+    {PROTOBUF_FIELD_OFFSET(NewOptionType, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kEnumRange)},
+  }}, {{
+    {0, 2},
+  }}, {{
+  }},
+};
+
+::uint8_t* NewOptionType::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.NewOptionType)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .protobuf_unittest.NewOptionType.TestEnum value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.NewOptionType)
+  return target;
+}
+
+::size_t NewOptionType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.NewOptionType)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // required .protobuf_unittest.NewOptionType.TestEnum value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData NewOptionType::_class_data_ = {
+    NewOptionType::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* NewOptionType::GetClassData() const {
+  return &_class_data_;
+}
+
+void NewOptionType::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<NewOptionType*>(&to_msg);
+  auto& from = static_cast<const NewOptionType&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.NewOptionType)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NewOptionType::CopyFrom(const NewOptionType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.NewOptionType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool NewOptionType::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* NewOptionType::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void NewOptionType::InternalSwap(NewOptionType* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata NewOptionType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[27]);
+}
+// ===================================================================
+
+class TestMessageWithRequiredEnumOption::_Internal {
+ public:
+};
+
+TestMessageWithRequiredEnumOption::TestMessageWithRequiredEnumOption(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageWithRequiredEnumOption)
+}
+TestMessageWithRequiredEnumOption::TestMessageWithRequiredEnumOption(
+    ::google::protobuf::Arena* arena,
+    const TestMessageWithRequiredEnumOption& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  TestMessageWithRequiredEnumOption* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageWithRequiredEnumOption)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata TestMessageWithRequiredEnumOption::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[28]);
+}
+// ===================================================================
+
+const ::google::protobuf::ServiceDescriptor* TestServiceWithCustomOptions::descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_service_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[0];
+}
+
+const ::google::protobuf::ServiceDescriptor* TestServiceWithCustomOptions::GetDescriptor() {
+  return descriptor();
+}
+
+void TestServiceWithCustomOptions::Foo(::google::protobuf::RpcController* controller,
+                         const ::protobuf_unittest::CustomOptionFooRequest*, ::protobuf_unittest::CustomOptionFooResponse*, ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Foo() not implemented.");
+  done->Run();
+}
+
+void TestServiceWithCustomOptions::CallMethod(
+    const ::google::protobuf::MethodDescriptor* method,
+    ::google::protobuf::RpcController* controller,
+    const ::google::protobuf::Message* request,
+    ::google::protobuf::Message* response, ::google::protobuf::Closure* done) {
+  ABSL_DCHECK_EQ(method->service(), file_level_service_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[0]);
+  switch (method->index()) {
+    case 0:
+      Foo(controller,
+             ::google::protobuf::internal::DownCast<const ::protobuf_unittest::CustomOptionFooRequest*>(request),
+             ::google::protobuf::internal::DownCast<::protobuf_unittest::CustomOptionFooResponse*>(response), done);
+      break;
+
+    default:
+      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::google::protobuf::Message& TestServiceWithCustomOptions::GetRequestPrototype(
+    const ::google::protobuf::MethodDescriptor* method) const {
+  ABSL_DCHECK_EQ(method->service(), descriptor());
+  switch (method->index()) {
+    case 0:
+      return ::protobuf_unittest::CustomOptionFooRequest::default_instance();
+
+    default:
+      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::google::protobuf::MessageFactory::generated_factory()
+                  ->GetPrototype(method->input_type());
+  }
+}
+
+const ::google::protobuf::Message& TestServiceWithCustomOptions::GetResponsePrototype(
+    const ::google::protobuf::MethodDescriptor* method) const {
+  ABSL_DCHECK_EQ(method->service(), descriptor());
+  switch (method->index()) {
+    case 0:
+      return ::protobuf_unittest::CustomOptionFooResponse::default_instance();
+
+    default:
+      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::google::protobuf::MessageFactory::generated_factory()
+                  ->GetPrototype(method->output_type());
+  }
+}
+
+TestServiceWithCustomOptions_Stub::TestServiceWithCustomOptions_Stub(::google::protobuf::RpcChannel* channel)
+    : channel_(channel), owns_channel_(false) {}
+
+TestServiceWithCustomOptions_Stub::TestServiceWithCustomOptions_Stub(
+    ::google::protobuf::RpcChannel* channel,
+    ::google::protobuf::Service::ChannelOwnership ownership)
+    : channel_(channel),
+      owns_channel_(ownership ==
+                    ::google::protobuf::Service::STUB_OWNS_CHANNEL) {}
+
+TestServiceWithCustomOptions_Stub::~TestServiceWithCustomOptions_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void TestServiceWithCustomOptions_Stub::Foo(::google::protobuf::RpcController* controller,
+                              const ::protobuf_unittest::CustomOptionFooRequest* request,
+                              ::protobuf_unittest::CustomOptionFooResponse* response, ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0), controller,
+                       request, response, done);
+}
+// ===================================================================
+
+const ::google::protobuf::ServiceDescriptor* AggregateService::descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  return file_level_service_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[1];
+}
+
+const ::google::protobuf::ServiceDescriptor* AggregateService::GetDescriptor() {
+  return descriptor();
+}
+
+void AggregateService::Method(::google::protobuf::RpcController* controller,
+                         const ::protobuf_unittest::AggregateMessage*, ::protobuf_unittest::AggregateMessage*, ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Method() not implemented.");
+  done->Run();
+}
+
+void AggregateService::CallMethod(
+    const ::google::protobuf::MethodDescriptor* method,
+    ::google::protobuf::RpcController* controller,
+    const ::google::protobuf::Message* request,
+    ::google::protobuf::Message* response, ::google::protobuf::Closure* done) {
+  ABSL_DCHECK_EQ(method->service(), file_level_service_descriptors_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto[1]);
+  switch (method->index()) {
+    case 0:
+      Method(controller,
+             ::google::protobuf::internal::DownCast<const ::protobuf_unittest::AggregateMessage*>(request),
+             ::google::protobuf::internal::DownCast<::protobuf_unittest::AggregateMessage*>(response), done);
+      break;
+
+    default:
+      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::google::protobuf::Message& AggregateService::GetRequestPrototype(
+    const ::google::protobuf::MethodDescriptor* method) const {
+  ABSL_DCHECK_EQ(method->service(), descriptor());
+  switch (method->index()) {
+    case 0:
+      return ::protobuf_unittest::AggregateMessage::default_instance();
+
+    default:
+      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::google::protobuf::MessageFactory::generated_factory()
+                  ->GetPrototype(method->input_type());
+  }
+}
+
+const ::google::protobuf::Message& AggregateService::GetResponsePrototype(
+    const ::google::protobuf::MethodDescriptor* method) const {
+  ABSL_DCHECK_EQ(method->service(), descriptor());
+  switch (method->index()) {
+    case 0:
+      return ::protobuf_unittest::AggregateMessage::default_instance();
+
+    default:
+      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::google::protobuf::MessageFactory::generated_factory()
+                  ->GetPrototype(method->output_type());
+  }
+}
+
+AggregateService_Stub::AggregateService_Stub(::google::protobuf::RpcChannel* channel)
+    : channel_(channel), owns_channel_(false) {}
+
+AggregateService_Stub::AggregateService_Stub(
+    ::google::protobuf::RpcChannel* channel,
+    ::google::protobuf::Service::ChannelOwnership ownership)
+    : channel_(channel),
+      owns_channel_(ownership ==
+                    ::google::protobuf::Service::STUB_OWNS_CHANNEL) {}
+
+AggregateService_Stub::~AggregateService_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void AggregateService_Stub::Method(::google::protobuf::RpcController* controller,
+                              const ::protobuf_unittest::AggregateMessage* request,
+                              ::protobuf_unittest::AggregateMessage* response, ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0), controller,
+                       request, response, done);
+}
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int ComplexOptionType2_ComplexOptionType4::kComplexOpt4FieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4 >, 11, false>
+  ComplexOptionType2_ComplexOptionType4::complex_opt4(kComplexOpt4FieldNumber, ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::default_instance(), nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int AggregateMessageSetElement::kMessageSetExtensionFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::AggregateMessageSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::AggregateMessageSetElement >, 11, false>
+  AggregateMessageSetElement::message_set_extension(kMessageSetExtensionFieldNumber, ::protobuf_unittest::AggregateMessageSetElement::default_instance(), nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int Aggregate::kNestedFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  Aggregate::nested(kNestedFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int NestedOptionType::kNestedExtensionFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  NestedOptionType::nested_extension(kNestedExtensionFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 4, false>
+  file_opt1(kFileOpt1FieldNumber, ::uint64_t{0u}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  message_opt1(kMessageOpt1FieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 6, false>
+  field_opt1(kFieldOpt1FieldNumber, ::uint64_t{0u}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  field_opt2(kFieldOpt2FieldNumber, 42, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::OneofOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  oneof_opt1(kOneofOpt1FieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 15, false>
+  enum_opt1(kEnumOpt1FieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumValueOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  enum_value_opt1(kEnumValueOpt1FieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 18, false>
+  service_opt1(kServiceOpt1FieldNumber, ::int64_t{0}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::MethodOpt1, ::protobuf_unittest::MethodOpt1_IsValid>, 14, false>
+  method_opt1(kMethodOpt1FieldNumber, static_cast< ::protobuf_unittest::MethodOpt1 >(1), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false>
+  bool_opt(kBoolOptFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  int32_opt(kInt32OptFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 3, false>
+  int64_opt(kInt64OptFieldNumber, ::int64_t{0}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 13, false>
+  uint32_opt(kUint32OptFieldNumber, 0u, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 4, false>
+  uint64_opt(kUint64OptFieldNumber, ::uint64_t{0u}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 17, false>
+  sint32_opt(kSint32OptFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 18, false>
+  sint64_opt(kSint64OptFieldNumber, ::int64_t{0}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 7, false>
+  fixed32_opt(kFixed32OptFieldNumber, 0u, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 6, false>
+  fixed64_opt(kFixed64OptFieldNumber, ::uint64_t{0u}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 15, false>
+  sfixed32_opt(kSfixed32OptFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 16, false>
+  sfixed64_opt(kSfixed64OptFieldNumber, ::int64_t{0}, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< float >, 2, false>
+  float_opt(kFloatOptFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< double >, 1, false>
+  double_opt(kDoubleOptFieldNumber, 0, nullptr);
+const std::string string_opt_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::StringTypeTraits, 9, false>
+  string_opt(kStringOptFieldNumber, string_opt_default, nullptr);
+const std::string bytes_opt_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::StringTypeTraits, 12, false>
+  bytes_opt(kBytesOptFieldNumber, bytes_opt_default, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType, ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType_IsValid>, 14, false>
+  enum_opt(kEnumOptFieldNumber, static_cast< ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType >(22), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::DummyMessageInvalidAsOptionType >, 11, false>
+  message_type_opt(kMessageTypeOptFieldNumber, ::protobuf_unittest::DummyMessageInvalidAsOptionType::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType1,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  mooo(kMoooFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType1,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType3 >, 11, false>
+  corge(kCorgeFieldNumber, ::protobuf_unittest::ComplexOptionType3::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType2,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  grault(kGraultFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType2,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType1 >, 11, false>
+  garply(kGarplyFieldNumber, ::protobuf_unittest::ComplexOptionType1::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType1 >, 11, false>
+  complex_opt1(kComplexOpt1FieldNumber, ::protobuf_unittest::ComplexOptionType1::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType2 >, 11, false>
+  complex_opt2(kComplexOpt2FieldNumber, ::protobuf_unittest::ComplexOptionType2::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType3 >, 11, false>
+  complex_opt3(kComplexOpt3FieldNumber, ::protobuf_unittest::ComplexOptionType3::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOpt6 >, 10, false>
+  complexopt6(kComplexopt6FieldNumber, ::protobuf_unittest::ComplexOpt6::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  fileopt(kFileoptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  msgopt(kMsgoptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  fieldopt(kFieldoptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  enumopt(kEnumoptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumValueOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  enumvalopt(kEnumvaloptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  serviceopt(kServiceoptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false>
+  methodopt(kMethodoptFieldNumber, ::protobuf_unittest::Aggregate::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OldOptionType >, 11, false>
+  required_enum_opt(kRequiredEnumOptFieldNumber, ::protobuf_unittest::OldOptionType::default_instance(), nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
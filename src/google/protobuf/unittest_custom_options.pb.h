@@ -0,0 +1,7579 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_custom_options.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_bases.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/map.h"  // IWYU pragma: export
+#include "google/protobuf/map_entry.h"
+#include "google/protobuf/map_field_inl.h"
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/service.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/any.pb.h"
+#include "google/protobuf/descriptor.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+namespace protobuf_unittest {
+class Aggregate;
+struct AggregateDefaultTypeInternal;
+extern AggregateDefaultTypeInternal _Aggregate_default_instance_;
+class AggregateMessage;
+struct AggregateMessageDefaultTypeInternal;
+extern AggregateMessageDefaultTypeInternal _AggregateMessage_default_instance_;
+class AggregateMessageSet;
+struct AggregateMessageSetDefaultTypeInternal;
+extern AggregateMessageSetDefaultTypeInternal _AggregateMessageSet_default_instance_;
+class AggregateMessageSetElement;
+struct AggregateMessageSetElementDefaultTypeInternal;
+extern AggregateMessageSetElementDefaultTypeInternal _AggregateMessageSetElement_default_instance_;
+class ComplexOpt6;
+struct ComplexOpt6DefaultTypeInternal;
+extern ComplexOpt6DefaultTypeInternal _ComplexOpt6_default_instance_;
+class ComplexOptionType1;
+struct ComplexOptionType1DefaultTypeInternal;
+extern ComplexOptionType1DefaultTypeInternal _ComplexOptionType1_default_instance_;
+class ComplexOptionType2;
+struct ComplexOptionType2DefaultTypeInternal;
+extern ComplexOptionType2DefaultTypeInternal _ComplexOptionType2_default_instance_;
+class ComplexOptionType2_ComplexOptionType4;
+struct ComplexOptionType2_ComplexOptionType4DefaultTypeInternal;
+extern ComplexOptionType2_ComplexOptionType4DefaultTypeInternal _ComplexOptionType2_ComplexOptionType4_default_instance_;
+class ComplexOptionType3;
+struct ComplexOptionType3DefaultTypeInternal;
+extern ComplexOptionType3DefaultTypeInternal _ComplexOptionType3_default_instance_;
+class ComplexOptionType3_ComplexOptionType5;
+struct ComplexOptionType3_ComplexOptionType5DefaultTypeInternal;
+extern ComplexOptionType3_ComplexOptionType5DefaultTypeInternal _ComplexOptionType3_ComplexOptionType5_default_instance_;
+class CustomOptionFooClientMessage;
+struct CustomOptionFooClientMessageDefaultTypeInternal;
+extern CustomOptionFooClientMessageDefaultTypeInternal _CustomOptionFooClientMessage_default_instance_;
+class CustomOptionFooRequest;
+struct CustomOptionFooRequestDefaultTypeInternal;
+extern CustomOptionFooRequestDefaultTypeInternal _CustomOptionFooRequest_default_instance_;
+class CustomOptionFooResponse;
+struct CustomOptionFooResponseDefaultTypeInternal;
+extern CustomOptionFooResponseDefaultTypeInternal _CustomOptionFooResponse_default_instance_;
+class CustomOptionFooServerMessage;
+struct CustomOptionFooServerMessageDefaultTypeInternal;
+extern CustomOptionFooServerMessageDefaultTypeInternal _CustomOptionFooServerMessage_default_instance_;
+class CustomOptionMaxIntegerValues;
+struct CustomOptionMaxIntegerValuesDefaultTypeInternal;
+extern CustomOptionMaxIntegerValuesDefaultTypeInternal _CustomOptionMaxIntegerValues_default_instance_;
+class CustomOptionMinIntegerValues;
+struct CustomOptionMinIntegerValuesDefaultTypeInternal;
+extern CustomOptionMinIntegerValuesDefaultTypeInternal _CustomOptionMinIntegerValues_default_instance_;
+class CustomOptionOtherValues;
+struct CustomOptionOtherValuesDefaultTypeInternal;
+extern CustomOptionOtherValuesDefaultTypeInternal _CustomOptionOtherValues_default_instance_;
+class DummyMessageContainingEnum;
+struct DummyMessageContainingEnumDefaultTypeInternal;
+extern DummyMessageContainingEnumDefaultTypeInternal _DummyMessageContainingEnum_default_instance_;
+class DummyMessageInvalidAsOptionType;
+struct DummyMessageInvalidAsOptionTypeDefaultTypeInternal;
+extern DummyMessageInvalidAsOptionTypeDefaultTypeInternal _DummyMessageInvalidAsOptionType_default_instance_;
+class NestedOptionType;
+struct NestedOptionTypeDefaultTypeInternal;
+extern NestedOptionTypeDefaultTypeInternal _NestedOptionType_default_instance_;
+class NestedOptionType_NestedMessage;
+struct NestedOptionType_NestedMessageDefaultTypeInternal;
+extern NestedOptionType_NestedMessageDefaultTypeInternal _NestedOptionType_NestedMessage_default_instance_;
+class NewOptionType;
+struct NewOptionTypeDefaultTypeInternal;
+extern NewOptionTypeDefaultTypeInternal _NewOptionType_default_instance_;
+class OldOptionType;
+struct OldOptionTypeDefaultTypeInternal;
+extern OldOptionTypeDefaultTypeInternal _OldOptionType_default_instance_;
+class SettingRealsFromNegativeInts;
+struct SettingRealsFromNegativeIntsDefaultTypeInternal;
+extern SettingRealsFromNegativeIntsDefaultTypeInternal _SettingRealsFromNegativeInts_default_instance_;
+class SettingRealsFromPositiveInts;
+struct SettingRealsFromPositiveIntsDefaultTypeInternal;
+extern SettingRealsFromPositiveIntsDefaultTypeInternal _SettingRealsFromPositiveInts_default_instance_;
+class TestMessageWithCustomOptions;
+struct TestMessageWithCustomOptionsDefaultTypeInternal;
+extern TestMessageWithCustomOptionsDefaultTypeInternal _TestMessageWithCustomOptions_default_instance_;
+class TestMessageWithCustomOptions_MapFieldEntry_DoNotUse;
+struct TestMessageWithCustomOptions_MapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestMessageWithCustomOptions_MapFieldEntry_DoNotUseDefaultTypeInternal _TestMessageWithCustomOptions_MapFieldEntry_DoNotUse_default_instance_;
+class TestMessageWithRequiredEnumOption;
+struct TestMessageWithRequiredEnumOptionDefaultTypeInternal;
+extern TestMessageWithRequiredEnumOptionDefaultTypeInternal _TestMessageWithRequiredEnumOption_default_instance_;
+class VariousComplexOptions;
+struct VariousComplexOptionsDefaultTypeInternal;
+extern VariousComplexOptionsDefaultTypeInternal _VariousComplexOptions_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+enum TestMessageWithCustomOptions_AnEnum : int {
+  TestMessageWithCustomOptions_AnEnum_ANENUM_VAL1 = 1,
+  TestMessageWithCustomOptions_AnEnum_ANENUM_VAL2 = 2,
+};
+
+bool TestMessageWithCustomOptions_AnEnum_IsValid(int value);
+extern const uint32_t TestMessageWithCustomOptions_AnEnum_internal_data_[];
+constexpr TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions_AnEnum_AnEnum_MIN = static_cast<TestMessageWithCustomOptions_AnEnum>(1);
+constexpr TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions_AnEnum_AnEnum_MAX = static_cast<TestMessageWithCustomOptions_AnEnum>(2);
+constexpr int TestMessageWithCustomOptions_AnEnum_AnEnum_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+TestMessageWithCustomOptions_AnEnum_descriptor();
+template <typename T>
+const std::string& TestMessageWithCustomOptions_AnEnum_Name(T value) {
+  static_assert(std::is_same<T, TestMessageWithCustomOptions_AnEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to AnEnum_Name().");
+  return TestMessageWithCustomOptions_AnEnum_Name(static_cast<TestMessageWithCustomOptions_AnEnum>(value));
+}
+template <>
+inline const std::string& TestMessageWithCustomOptions_AnEnum_Name(TestMessageWithCustomOptions_AnEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<TestMessageWithCustomOptions_AnEnum_descriptor,
+                                                 1, 2>(
+      static_cast<int>(value));
+}
+inline bool TestMessageWithCustomOptions_AnEnum_Parse(absl::string_view name, TestMessageWithCustomOptions_AnEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TestMessageWithCustomOptions_AnEnum>(
+      TestMessageWithCustomOptions_AnEnum_descriptor(), name, value);
+}
+enum DummyMessageContainingEnum_TestEnumType : int {
+  DummyMessageContainingEnum_TestEnumType_TEST_OPTION_ENUM_TYPE1 = 22,
+  DummyMessageContainingEnum_TestEnumType_TEST_OPTION_ENUM_TYPE2 = -23,
+};
+
+bool DummyMessageContainingEnum_TestEnumType_IsValid(int value);
+extern const uint32_t DummyMessageContainingEnum_TestEnumType_internal_data_[];
+constexpr DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum_TestEnumType_TestEnumType_MIN = static_cast<DummyMessageContainingEnum_TestEnumType>(-23);
+constexpr DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum_TestEnumType_TestEnumType_MAX = static_cast<DummyMessageContainingEnum_TestEnumType>(22);
+constexpr int DummyMessageContainingEnum_TestEnumType_TestEnumType_ARRAYSIZE = 22 + 1;
+const ::google::protobuf::EnumDescriptor*
+DummyMessageContainingEnum_TestEnumType_descriptor();
+template <typename T>
+const std::string& DummyMessageContainingEnum_TestEnumType_Name(T value) {
+  static_assert(std::is_same<T, DummyMessageContainingEnum_TestEnumType>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to TestEnumType_Name().");
+  return ::google::protobuf::internal::NameOfEnum(DummyMessageContainingEnum_TestEnumType_descriptor(), value);
+}
+inline bool DummyMessageContainingEnum_TestEnumType_Parse(absl::string_view name, DummyMessageContainingEnum_TestEnumType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<DummyMessageContainingEnum_TestEnumType>(
+      DummyMessageContainingEnum_TestEnumType_descriptor(), name, value);
+}
+enum NestedOptionType_NestedEnum : int {
+  NestedOptionType_NestedEnum_NESTED_ENUM_VALUE = 1,
+};
+
+bool NestedOptionType_NestedEnum_IsValid(int value);
+extern const uint32_t NestedOptionType_NestedEnum_internal_data_[];
+constexpr NestedOptionType_NestedEnum NestedOptionType_NestedEnum_NestedEnum_MIN = static_cast<NestedOptionType_NestedEnum>(1);
+constexpr NestedOptionType_NestedEnum NestedOptionType_NestedEnum_NestedEnum_MAX = static_cast<NestedOptionType_NestedEnum>(1);
+constexpr int NestedOptionType_NestedEnum_NestedEnum_ARRAYSIZE = 1 + 1;
+const ::google::protobuf::EnumDescriptor*
+NestedOptionType_NestedEnum_descriptor();
+template <typename T>
+const std::string& NestedOptionType_NestedEnum_Name(T value) {
+  static_assert(std::is_same<T, NestedOptionType_NestedEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to NestedEnum_Name().");
+  return NestedOptionType_NestedEnum_Name(static_cast<NestedOptionType_NestedEnum>(value));
+}
+template <>
+inline const std::string& NestedOptionType_NestedEnum_Name(NestedOptionType_NestedEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<NestedOptionType_NestedEnum_descriptor,
+                                                 1, 1>(
+      static_cast<int>(value));
+}
+inline bool NestedOptionType_NestedEnum_Parse(absl::string_view name, NestedOptionType_NestedEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<NestedOptionType_NestedEnum>(
+      NestedOptionType_NestedEnum_descriptor(), name, value);
+}
+enum OldOptionType_TestEnum : int {
+  OldOptionType_TestEnum_OLD_VALUE = 0,
+};
+
+bool OldOptionType_TestEnum_IsValid(int value);
+extern const uint32_t OldOptionType_TestEnum_internal_data_[];
+constexpr OldOptionType_TestEnum OldOptionType_TestEnum_TestEnum_MIN = static_cast<OldOptionType_TestEnum>(0);
+constexpr OldOptionType_TestEnum OldOptionType_TestEnum_TestEnum_MAX = static_cast<OldOptionType_TestEnum>(0);
+constexpr int OldOptionType_TestEnum_TestEnum_ARRAYSIZE = 0 + 1;
+const ::google::protobuf::EnumDescriptor*
+OldOptionType_TestEnum_descriptor();
+template <typename T>
+const std::string& OldOptionType_TestEnum_Name(T value) {
+  static_assert(std::is_same<T, OldOptionType_TestEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to TestEnum_Name().");
+  return OldOptionType_TestEnum_Name(static_cast<OldOptionType_TestEnum>(value));
+}
+template <>
+inline const std::string& OldOptionType_TestEnum_Name(OldOptionType_TestEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<OldOptionType_TestEnum_descriptor,
+                                                 0, 0>(
+      static_cast<int>(value));
+}
+inline bool OldOptionType_TestEnum_Parse(absl::string_view name, OldOptionType_TestEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<OldOptionType_TestEnum>(
+      OldOptionType_TestEnum_descriptor(), name, value);
+}
+enum NewOptionType_TestEnum : int {
+  NewOptionType_TestEnum_OLD_VALUE = 0,
+  NewOptionType_TestEnum_NEW_VALUE = 1,
+};
+
+bool NewOptionType_TestEnum_IsValid(int value);
+extern const uint32_t NewOptionType_TestEnum_internal_data_[];
+constexpr NewOptionType_TestEnum NewOptionType_TestEnum_TestEnum_MIN = static_cast<NewOptionType_TestEnum>(0);
+constexpr NewOptionType_TestEnum NewOptionType_TestEnum_TestEnum_MAX = static_cast<NewOptionType_TestEnum>(1);
+constexpr int NewOptionType_TestEnum_TestEnum_ARRAYSIZE = 1 + 1;
+const ::google::protobuf::EnumDescriptor*
+NewOptionType_TestEnum_descriptor();
+template <typename T>
+const std::string& NewOptionType_TestEnum_Name(T value) {
+  static_assert(std::is_same<T, NewOptionType_TestEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to TestEnum_Name().");
+  return NewOptionType_TestEnum_Name(static_cast<NewOptionType_TestEnum>(value));
+}
+template <>
+inline const std::string& NewOptionType_TestEnum_Name(NewOptionType_TestEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<NewOptionType_TestEnum_descriptor,
+                                                 0, 1>(
+      static_cast<int>(value));
+}
+inline bool NewOptionType_TestEnum_Parse(absl::string_view name, NewOptionType_TestEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<NewOptionType_TestEnum>(
+      NewOptionType_TestEnum_descriptor(), name, value);
+}
+enum MethodOpt1 : int {
+  METHODOPT1_VAL1 = 1,
+  METHODOPT1_VAL2 = 2,
+};
+
+bool MethodOpt1_IsValid(int value);
+extern const uint32_t MethodOpt1_internal_data_[];
+constexpr MethodOpt1 MethodOpt1_MIN = static_cast<MethodOpt1>(1);
+constexpr MethodOpt1 MethodOpt1_MAX = static_cast<MethodOpt1>(2);
+constexpr int MethodOpt1_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+MethodOpt1_descriptor();
+template <typename T>
+const std::string& MethodOpt1_Name(T value) {
+  static_assert(std::is_same<T, MethodOpt1>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to MethodOpt1_Name().");
+  return MethodOpt1_Name(static_cast<MethodOpt1>(value));
+}
+template <>
+inline const std::string& MethodOpt1_Name(MethodOpt1 value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<MethodOpt1_descriptor,
+                                                 1, 2>(
+      static_cast<int>(value));
+}
+inline bool MethodOpt1_Parse(absl::string_view name, MethodOpt1* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<MethodOpt1>(
+      MethodOpt1_descriptor(), name, value);
+}
+enum AggregateEnum : int {
+  VALUE = 1,
+};
+
+bool AggregateEnum_IsValid(int value);
+extern const uint32_t AggregateEnum_internal_data_[];
+constexpr AggregateEnum AggregateEnum_MIN = static_cast<AggregateEnum>(1);
+constexpr AggregateEnum AggregateEnum_MAX = static_cast<AggregateEnum>(1);
+constexpr int AggregateEnum_ARRAYSIZE = 1 + 1;
+const ::google::protobuf::EnumDescriptor*
+AggregateEnum_descriptor();
+template <typename T>
+const std::string& AggregateEnum_Name(T value) {
+  static_assert(std::is_same<T, AggregateEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to AggregateEnum_Name().");
+  return AggregateEnum_Name(static_cast<AggregateEnum>(value));
+}
+template <>
+inline const std::string& AggregateEnum_Name(AggregateEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<AggregateEnum_descriptor,
+                                                 1, 1>(
+      static_cast<int>(value));
+}
+inline bool AggregateEnum_Parse(absl::string_view name, AggregateEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<AggregateEnum>(
+      AggregateEnum_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class VariousComplexOptions final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.VariousComplexOptions) */ {
+ public:
+  inline VariousComplexOptions() : VariousComplexOptions(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR VariousComplexOptions(::google::protobuf::internal::ConstantInitialized);
+
+  inline VariousComplexOptions(const VariousComplexOptions& from)
+      : VariousComplexOptions(nullptr, from) {}
+  VariousComplexOptions(VariousComplexOptions&& from) noexcept
+    : VariousComplexOptions() {
+    *this = ::std::move(from);
+  }
+
+  inline VariousComplexOptions& operator=(const VariousComplexOptions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VariousComplexOptions& operator=(VariousComplexOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VariousComplexOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VariousComplexOptions* internal_default_instance() {
+    return reinterpret_cast<const VariousComplexOptions*>(
+               &_VariousComplexOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(VariousComplexOptions& a, VariousComplexOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VariousComplexOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VariousComplexOptions* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VariousComplexOptions* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VariousComplexOptions>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const VariousComplexOptions& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const VariousComplexOptions& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.VariousComplexOptions";
+  }
+  protected:
+  explicit VariousComplexOptions(::google::protobuf::Arena* arena);
+  VariousComplexOptions(::google::protobuf::Arena* arena, const VariousComplexOptions& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.VariousComplexOptions)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMessageWithRequiredEnumOption final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMessageWithRequiredEnumOption) */ {
+ public:
+  inline TestMessageWithRequiredEnumOption() : TestMessageWithRequiredEnumOption(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMessageWithRequiredEnumOption(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMessageWithRequiredEnumOption(const TestMessageWithRequiredEnumOption& from)
+      : TestMessageWithRequiredEnumOption(nullptr, from) {}
+  TestMessageWithRequiredEnumOption(TestMessageWithRequiredEnumOption&& from) noexcept
+    : TestMessageWithRequiredEnumOption() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageWithRequiredEnumOption& operator=(const TestMessageWithRequiredEnumOption& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageWithRequiredEnumOption& operator=(TestMessageWithRequiredEnumOption&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestMessageWithRequiredEnumOption& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMessageWithRequiredEnumOption* internal_default_instance() {
+    return reinterpret_cast<const TestMessageWithRequiredEnumOption*>(
+               &_TestMessageWithRequiredEnumOption_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(TestMessageWithRequiredEnumOption& a, TestMessageWithRequiredEnumOption& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageWithRequiredEnumOption* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageWithRequiredEnumOption* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMessageWithRequiredEnumOption* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMessageWithRequiredEnumOption>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const TestMessageWithRequiredEnumOption& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const TestMessageWithRequiredEnumOption& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestMessageWithRequiredEnumOption";
+  }
+  protected:
+  explicit TestMessageWithRequiredEnumOption(::google::protobuf::Arena* arena);
+  TestMessageWithRequiredEnumOption(::google::protobuf::Arena* arena, const TestMessageWithRequiredEnumOption& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageWithRequiredEnumOption)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMessageWithCustomOptions_MapFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, std::string, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, std::string, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  TestMessageWithCustomOptions_MapFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMessageWithCustomOptions_MapFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMessageWithCustomOptions_MapFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMessageWithCustomOptions_MapFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMessageWithCustomOptions_MapFieldEntry_DoNotUse*>(
+        &_TestMessageWithCustomOptions_MapFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+#ifndef NDEBUG
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+       s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "protobuf_unittest.TestMessageWithCustomOptions.MapFieldEntry.key");
+#else
+    (void) s;
+#endif
+    return true;
+ }
+  static bool ValidateValue(std::string* s) {
+#ifndef NDEBUG
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+       s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "protobuf_unittest.TestMessageWithCustomOptions.MapFieldEntry.value");
+#else
+    (void) s;
+#endif
+    return true;
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SettingRealsFromPositiveInts final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.SettingRealsFromPositiveInts) */ {
+ public:
+  inline SettingRealsFromPositiveInts() : SettingRealsFromPositiveInts(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR SettingRealsFromPositiveInts(::google::protobuf::internal::ConstantInitialized);
+
+  inline SettingRealsFromPositiveInts(const SettingRealsFromPositiveInts& from)
+      : SettingRealsFromPositiveInts(nullptr, from) {}
+  SettingRealsFromPositiveInts(SettingRealsFromPositiveInts&& from) noexcept
+    : SettingRealsFromPositiveInts() {
+    *this = ::std::move(from);
+  }
+
+  inline SettingRealsFromPositiveInts& operator=(const SettingRealsFromPositiveInts& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SettingRealsFromPositiveInts& operator=(SettingRealsFromPositiveInts&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SettingRealsFromPositiveInts& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SettingRealsFromPositiveInts* internal_default_instance() {
+    return reinterpret_cast<const SettingRealsFromPositiveInts*>(
+               &_SettingRealsFromPositiveInts_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(SettingRealsFromPositiveInts& a, SettingRealsFromPositiveInts& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SettingRealsFromPositiveInts* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SettingRealsFromPositiveInts* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SettingRealsFromPositiveInts* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SettingRealsFromPositiveInts>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const SettingRealsFromPositiveInts& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const SettingRealsFromPositiveInts& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.SettingRealsFromPositiveInts";
+  }
+  protected:
+  explicit SettingRealsFromPositiveInts(::google::protobuf::Arena* arena);
+  SettingRealsFromPositiveInts(::google::protobuf::Arena* arena, const SettingRealsFromPositiveInts& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.SettingRealsFromPositiveInts)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class SettingRealsFromNegativeInts final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.SettingRealsFromNegativeInts) */ {
+ public:
+  inline SettingRealsFromNegativeInts() : SettingRealsFromNegativeInts(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR SettingRealsFromNegativeInts(::google::protobuf::internal::ConstantInitialized);
+
+  inline SettingRealsFromNegativeInts(const SettingRealsFromNegativeInts& from)
+      : SettingRealsFromNegativeInts(nullptr, from) {}
+  SettingRealsFromNegativeInts(SettingRealsFromNegativeInts&& from) noexcept
+    : SettingRealsFromNegativeInts() {
+    *this = ::std::move(from);
+  }
+
+  inline SettingRealsFromNegativeInts& operator=(const SettingRealsFromNegativeInts& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SettingRealsFromNegativeInts& operator=(SettingRealsFromNegativeInts&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SettingRealsFromNegativeInts& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SettingRealsFromNegativeInts* internal_default_instance() {
+    return reinterpret_cast<const SettingRealsFromNegativeInts*>(
+               &_SettingRealsFromNegativeInts_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SettingRealsFromNegativeInts& a, SettingRealsFromNegativeInts& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SettingRealsFromNegativeInts* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SettingRealsFromNegativeInts* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SettingRealsFromNegativeInts* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SettingRealsFromNegativeInts>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const SettingRealsFromNegativeInts& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const SettingRealsFromNegativeInts& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.SettingRealsFromNegativeInts";
+  }
+  protected:
+  explicit SettingRealsFromNegativeInts(::google::protobuf::Arena* arena);
+  SettingRealsFromNegativeInts(::google::protobuf::Arena* arena, const SettingRealsFromNegativeInts& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.SettingRealsFromNegativeInts)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class OldOptionType final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.OldOptionType) */ {
+ public:
+  inline OldOptionType() : OldOptionType(nullptr) {}
+  ~OldOptionType() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR OldOptionType(::google::protobuf::internal::ConstantInitialized);
+
+  inline OldOptionType(const OldOptionType& from)
+      : OldOptionType(nullptr, from) {}
+  OldOptionType(OldOptionType&& from) noexcept
+    : OldOptionType() {
+    *this = ::std::move(from);
+  }
+
+  inline OldOptionType& operator=(const OldOptionType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OldOptionType& operator=(OldOptionType&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OldOptionType& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OldOptionType* internal_default_instance() {
+    return reinterpret_cast<const OldOptionType*>(
+               &_OldOptionType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(OldOptionType& a, OldOptionType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OldOptionType* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OldOptionType* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OldOptionType* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OldOptionType>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const OldOptionType& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const OldOptionType& from) {
+    OldOptionType::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(OldOptionType* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.OldOptionType";
+  }
+  protected:
+  explicit OldOptionType(::google::protobuf::Arena* arena);
+  OldOptionType(::google::protobuf::Arena* arena, const OldOptionType& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using TestEnum = OldOptionType_TestEnum;
+  static constexpr TestEnum OLD_VALUE = OldOptionType_TestEnum_OLD_VALUE;
+  static inline bool TestEnum_IsValid(int value) {
+    return OldOptionType_TestEnum_IsValid(value);
+  }
+  static constexpr TestEnum TestEnum_MIN = OldOptionType_TestEnum_TestEnum_MIN;
+  static constexpr TestEnum TestEnum_MAX = OldOptionType_TestEnum_TestEnum_MAX;
+  static constexpr int TestEnum_ARRAYSIZE = OldOptionType_TestEnum_TestEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* TestEnum_descriptor() {
+    return OldOptionType_TestEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& TestEnum_Name(T value) {
+    return OldOptionType_TestEnum_Name(value);
+  }
+  static inline bool TestEnum_Parse(absl::string_view name, TestEnum* value) {
+    return OldOptionType_TestEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // required .protobuf_unittest.OldOptionType.TestEnum value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  ::protobuf_unittest::OldOptionType_TestEnum value() const;
+  void set_value(::protobuf_unittest::OldOptionType_TestEnum value);
+
+  private:
+  ::protobuf_unittest::OldOptionType_TestEnum _internal_value() const;
+  void _internal_set_value(::protobuf_unittest::OldOptionType_TestEnum value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.OldOptionType)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    int value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class NewOptionType final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.NewOptionType) */ {
+ public:
+  inline NewOptionType() : NewOptionType(nullptr) {}
+  ~NewOptionType() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR NewOptionType(::google::protobuf::internal::ConstantInitialized);
+
+  inline NewOptionType(const NewOptionType& from)
+      : NewOptionType(nullptr, from) {}
+  NewOptionType(NewOptionType&& from) noexcept
+    : NewOptionType() {
+    *this = ::std::move(from);
+  }
+
+  inline NewOptionType& operator=(const NewOptionType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NewOptionType& operator=(NewOptionType&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewOptionType& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NewOptionType* internal_default_instance() {
+    return reinterpret_cast<const NewOptionType*>(
+               &_NewOptionType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(NewOptionType& a, NewOptionType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NewOptionType* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NewOptionType* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NewOptionType* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NewOptionType>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const NewOptionType& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const NewOptionType& from) {
+    NewOptionType::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(NewOptionType* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.NewOptionType";
+  }
+  protected:
+  explicit NewOptionType(::google::protobuf::Arena* arena);
+  NewOptionType(::google::protobuf::Arena* arena, const NewOptionType& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using TestEnum = NewOptionType_TestEnum;
+  static constexpr TestEnum OLD_VALUE = NewOptionType_TestEnum_OLD_VALUE;
+  static constexpr TestEnum NEW_VALUE = NewOptionType_TestEnum_NEW_VALUE;
+  static inline bool TestEnum_IsValid(int value) {
+    return NewOptionType_TestEnum_IsValid(value);
+  }
+  static constexpr TestEnum TestEnum_MIN = NewOptionType_TestEnum_TestEnum_MIN;
+  static constexpr TestEnum TestEnum_MAX = NewOptionType_TestEnum_TestEnum_MAX;
+  static constexpr int TestEnum_ARRAYSIZE = NewOptionType_TestEnum_TestEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* TestEnum_descriptor() {
+    return NewOptionType_TestEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& TestEnum_Name(T value) {
+    return NewOptionType_TestEnum_Name(value);
+  }
+  static inline bool TestEnum_Parse(absl::string_view name, TestEnum* value) {
+    return NewOptionType_TestEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // required .protobuf_unittest.NewOptionType.TestEnum value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  ::protobuf_unittest::NewOptionType_TestEnum value() const;
+  void set_value(::protobuf_unittest::NewOptionType_TestEnum value);
+
+  private:
+  ::protobuf_unittest::NewOptionType_TestEnum _internal_value() const;
+  void _internal_set_value(::protobuf_unittest::NewOptionType_TestEnum value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.NewOptionType)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    int value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class NestedOptionType_NestedMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.NestedOptionType.NestedMessage) */ {
+ public:
+  inline NestedOptionType_NestedMessage() : NestedOptionType_NestedMessage(nullptr) {}
+  ~NestedOptionType_NestedMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR NestedOptionType_NestedMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline NestedOptionType_NestedMessage(const NestedOptionType_NestedMessage& from)
+      : NestedOptionType_NestedMessage(nullptr, from) {}
+  NestedOptionType_NestedMessage(NestedOptionType_NestedMessage&& from) noexcept
+    : NestedOptionType_NestedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline NestedOptionType_NestedMessage& operator=(const NestedOptionType_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NestedOptionType_NestedMessage& operator=(NestedOptionType_NestedMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NestedOptionType_NestedMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NestedOptionType_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const NestedOptionType_NestedMessage*>(
+               &_NestedOptionType_NestedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(NestedOptionType_NestedMessage& a, NestedOptionType_NestedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NestedOptionType_NestedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NestedOptionType_NestedMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NestedOptionType_NestedMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NestedOptionType_NestedMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const NestedOptionType_NestedMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const NestedOptionType_NestedMessage& from) {
+    NestedOptionType_NestedMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(NestedOptionType_NestedMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.NestedOptionType.NestedMessage";
+  }
+  protected:
+  explicit NestedOptionType_NestedMessage(::google::protobuf::Arena* arena);
+  NestedOptionType_NestedMessage(::google::protobuf::Arena* arena, const NestedOptionType_NestedMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNestedFieldFieldNumber = 1,
+  };
+  // optional int32 nested_field = 1 [(.protobuf_unittest.field_opt1) = 1002];
+  bool has_nested_field() const;
+  void clear_nested_field() ;
+  ::int32_t nested_field() const;
+  void set_nested_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_nested_field() const;
+  void _internal_set_nested_field(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.NestedOptionType.NestedMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t nested_field_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class NestedOptionType final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.NestedOptionType) */ {
+ public:
+  inline NestedOptionType() : NestedOptionType(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR NestedOptionType(::google::protobuf::internal::ConstantInitialized);
+
+  inline NestedOptionType(const NestedOptionType& from)
+      : NestedOptionType(nullptr, from) {}
+  NestedOptionType(NestedOptionType&& from) noexcept
+    : NestedOptionType() {
+    *this = ::std::move(from);
+  }
+
+  inline NestedOptionType& operator=(const NestedOptionType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NestedOptionType& operator=(NestedOptionType&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NestedOptionType& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NestedOptionType* internal_default_instance() {
+    return reinterpret_cast<const NestedOptionType*>(
+               &_NestedOptionType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(NestedOptionType& a, NestedOptionType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NestedOptionType* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NestedOptionType* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NestedOptionType* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NestedOptionType>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const NestedOptionType& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const NestedOptionType& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.NestedOptionType";
+  }
+  protected:
+  explicit NestedOptionType(::google::protobuf::Arena* arena);
+  NestedOptionType(::google::protobuf::Arena* arena, const NestedOptionType& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using NestedMessage = NestedOptionType_NestedMessage;
+
+  using NestedEnum = NestedOptionType_NestedEnum;
+  static constexpr NestedEnum NESTED_ENUM_VALUE = NestedOptionType_NestedEnum_NESTED_ENUM_VALUE;
+  static inline bool NestedEnum_IsValid(int value) {
+    return NestedOptionType_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN = NestedOptionType_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX = NestedOptionType_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE = NestedOptionType_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* NestedEnum_descriptor() {
+    return NestedOptionType_NestedEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& NestedEnum_Name(T value) {
+    return NestedOptionType_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(absl::string_view name, NestedEnum* value) {
+    return NestedOptionType_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  static const int kNestedExtensionFieldNumber = 7912573;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+      ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+    nested_extension;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.NestedOptionType)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class DummyMessageInvalidAsOptionType final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.DummyMessageInvalidAsOptionType) */ {
+ public:
+  inline DummyMessageInvalidAsOptionType() : DummyMessageInvalidAsOptionType(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR DummyMessageInvalidAsOptionType(::google::protobuf::internal::ConstantInitialized);
+
+  inline DummyMessageInvalidAsOptionType(const DummyMessageInvalidAsOptionType& from)
+      : DummyMessageInvalidAsOptionType(nullptr, from) {}
+  DummyMessageInvalidAsOptionType(DummyMessageInvalidAsOptionType&& from) noexcept
+    : DummyMessageInvalidAsOptionType() {
+    *this = ::std::move(from);
+  }
+
+  inline DummyMessageInvalidAsOptionType& operator=(const DummyMessageInvalidAsOptionType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DummyMessageInvalidAsOptionType& operator=(DummyMessageInvalidAsOptionType&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DummyMessageInvalidAsOptionType& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DummyMessageInvalidAsOptionType* internal_default_instance() {
+    return reinterpret_cast<const DummyMessageInvalidAsOptionType*>(
+               &_DummyMessageInvalidAsOptionType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(DummyMessageInvalidAsOptionType& a, DummyMessageInvalidAsOptionType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DummyMessageInvalidAsOptionType* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DummyMessageInvalidAsOptionType* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DummyMessageInvalidAsOptionType* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DummyMessageInvalidAsOptionType>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const DummyMessageInvalidAsOptionType& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const DummyMessageInvalidAsOptionType& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.DummyMessageInvalidAsOptionType";
+  }
+  protected:
+  explicit DummyMessageInvalidAsOptionType(::google::protobuf::Arena* arena);
+  DummyMessageInvalidAsOptionType(::google::protobuf::Arena* arena, const DummyMessageInvalidAsOptionType& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.DummyMessageInvalidAsOptionType)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class DummyMessageContainingEnum final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.DummyMessageContainingEnum) */ {
+ public:
+  inline DummyMessageContainingEnum() : DummyMessageContainingEnum(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR DummyMessageContainingEnum(::google::protobuf::internal::ConstantInitialized);
+
+  inline DummyMessageContainingEnum(const DummyMessageContainingEnum& from)
+      : DummyMessageContainingEnum(nullptr, from) {}
+  DummyMessageContainingEnum(DummyMessageContainingEnum&& from) noexcept
+    : DummyMessageContainingEnum() {
+    *this = ::std::move(from);
+  }
+
+  inline DummyMessageContainingEnum& operator=(const DummyMessageContainingEnum& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DummyMessageContainingEnum& operator=(DummyMessageContainingEnum&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DummyMessageContainingEnum& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DummyMessageContainingEnum* internal_default_instance() {
+    return reinterpret_cast<const DummyMessageContainingEnum*>(
+               &_DummyMessageContainingEnum_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(DummyMessageContainingEnum& a, DummyMessageContainingEnum& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DummyMessageContainingEnum* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DummyMessageContainingEnum* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DummyMessageContainingEnum* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DummyMessageContainingEnum>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const DummyMessageContainingEnum& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const DummyMessageContainingEnum& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.DummyMessageContainingEnum";
+  }
+  protected:
+  explicit DummyMessageContainingEnum(::google::protobuf::Arena* arena);
+  DummyMessageContainingEnum(::google::protobuf::Arena* arena, const DummyMessageContainingEnum& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using TestEnumType = DummyMessageContainingEnum_TestEnumType;
+  static constexpr TestEnumType TEST_OPTION_ENUM_TYPE1 = DummyMessageContainingEnum_TestEnumType_TEST_OPTION_ENUM_TYPE1;
+  static constexpr TestEnumType TEST_OPTION_ENUM_TYPE2 = DummyMessageContainingEnum_TestEnumType_TEST_OPTION_ENUM_TYPE2;
+  static inline bool TestEnumType_IsValid(int value) {
+    return DummyMessageContainingEnum_TestEnumType_IsValid(value);
+  }
+  static constexpr TestEnumType TestEnumType_MIN = DummyMessageContainingEnum_TestEnumType_TestEnumType_MIN;
+  static constexpr TestEnumType TestEnumType_MAX = DummyMessageContainingEnum_TestEnumType_TestEnumType_MAX;
+  static constexpr int TestEnumType_ARRAYSIZE = DummyMessageContainingEnum_TestEnumType_TestEnumType_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* TestEnumType_descriptor() {
+    return DummyMessageContainingEnum_TestEnumType_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& TestEnumType_Name(T value) {
+    return DummyMessageContainingEnum_TestEnumType_Name(value);
+  }
+  static inline bool TestEnumType_Parse(absl::string_view name, TestEnumType* value) {
+    return DummyMessageContainingEnum_TestEnumType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.DummyMessageContainingEnum)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionOtherValues final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionOtherValues) */ {
+ public:
+  inline CustomOptionOtherValues() : CustomOptionOtherValues(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionOtherValues(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionOtherValues(const CustomOptionOtherValues& from)
+      : CustomOptionOtherValues(nullptr, from) {}
+  CustomOptionOtherValues(CustomOptionOtherValues&& from) noexcept
+    : CustomOptionOtherValues() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionOtherValues& operator=(const CustomOptionOtherValues& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionOtherValues& operator=(CustomOptionOtherValues&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionOtherValues& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionOtherValues* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionOtherValues*>(
+               &_CustomOptionOtherValues_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CustomOptionOtherValues& a, CustomOptionOtherValues& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionOtherValues* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionOtherValues* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionOtherValues* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionOtherValues>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionOtherValues& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionOtherValues& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionOtherValues";
+  }
+  protected:
+  explicit CustomOptionOtherValues(::google::protobuf::Arena* arena);
+  CustomOptionOtherValues(::google::protobuf::Arena* arena, const CustomOptionOtherValues& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionOtherValues)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionMinIntegerValues final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionMinIntegerValues) */ {
+ public:
+  inline CustomOptionMinIntegerValues() : CustomOptionMinIntegerValues(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionMinIntegerValues(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionMinIntegerValues(const CustomOptionMinIntegerValues& from)
+      : CustomOptionMinIntegerValues(nullptr, from) {}
+  CustomOptionMinIntegerValues(CustomOptionMinIntegerValues&& from) noexcept
+    : CustomOptionMinIntegerValues() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionMinIntegerValues& operator=(const CustomOptionMinIntegerValues& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionMinIntegerValues& operator=(CustomOptionMinIntegerValues&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionMinIntegerValues& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionMinIntegerValues* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionMinIntegerValues*>(
+               &_CustomOptionMinIntegerValues_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(CustomOptionMinIntegerValues& a, CustomOptionMinIntegerValues& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionMinIntegerValues* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionMinIntegerValues* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionMinIntegerValues* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionMinIntegerValues>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionMinIntegerValues& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionMinIntegerValues& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionMinIntegerValues";
+  }
+  protected:
+  explicit CustomOptionMinIntegerValues(::google::protobuf::Arena* arena);
+  CustomOptionMinIntegerValues(::google::protobuf::Arena* arena, const CustomOptionMinIntegerValues& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionMinIntegerValues)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionMaxIntegerValues final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionMaxIntegerValues) */ {
+ public:
+  inline CustomOptionMaxIntegerValues() : CustomOptionMaxIntegerValues(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionMaxIntegerValues(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionMaxIntegerValues(const CustomOptionMaxIntegerValues& from)
+      : CustomOptionMaxIntegerValues(nullptr, from) {}
+  CustomOptionMaxIntegerValues(CustomOptionMaxIntegerValues&& from) noexcept
+    : CustomOptionMaxIntegerValues() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionMaxIntegerValues& operator=(const CustomOptionMaxIntegerValues& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionMaxIntegerValues& operator=(CustomOptionMaxIntegerValues&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionMaxIntegerValues& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionMaxIntegerValues* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionMaxIntegerValues*>(
+               &_CustomOptionMaxIntegerValues_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CustomOptionMaxIntegerValues& a, CustomOptionMaxIntegerValues& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionMaxIntegerValues* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionMaxIntegerValues* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionMaxIntegerValues* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionMaxIntegerValues>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionMaxIntegerValues& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionMaxIntegerValues& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionMaxIntegerValues";
+  }
+  protected:
+  explicit CustomOptionMaxIntegerValues(::google::protobuf::Arena* arena);
+  CustomOptionMaxIntegerValues(::google::protobuf::Arena* arena, const CustomOptionMaxIntegerValues& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionMaxIntegerValues)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionFooServerMessage final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionFooServerMessage) */ {
+ public:
+  inline CustomOptionFooServerMessage() : CustomOptionFooServerMessage(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionFooServerMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionFooServerMessage(const CustomOptionFooServerMessage& from)
+      : CustomOptionFooServerMessage(nullptr, from) {}
+  CustomOptionFooServerMessage(CustomOptionFooServerMessage&& from) noexcept
+    : CustomOptionFooServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionFooServerMessage& operator=(const CustomOptionFooServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionFooServerMessage& operator=(CustomOptionFooServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionFooServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionFooServerMessage* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionFooServerMessage*>(
+               &_CustomOptionFooServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CustomOptionFooServerMessage& a, CustomOptionFooServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionFooServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionFooServerMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionFooServerMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionFooServerMessage>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionFooServerMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionFooServerMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionFooServerMessage";
+  }
+  protected:
+  explicit CustomOptionFooServerMessage(::google::protobuf::Arena* arena);
+  CustomOptionFooServerMessage(::google::protobuf::Arena* arena, const CustomOptionFooServerMessage& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionFooServerMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionFooResponse final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionFooResponse) */ {
+ public:
+  inline CustomOptionFooResponse() : CustomOptionFooResponse(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionFooResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionFooResponse(const CustomOptionFooResponse& from)
+      : CustomOptionFooResponse(nullptr, from) {}
+  CustomOptionFooResponse(CustomOptionFooResponse&& from) noexcept
+    : CustomOptionFooResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionFooResponse& operator=(const CustomOptionFooResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionFooResponse& operator=(CustomOptionFooResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionFooResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionFooResponse* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionFooResponse*>(
+               &_CustomOptionFooResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CustomOptionFooResponse& a, CustomOptionFooResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionFooResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionFooResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionFooResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionFooResponse>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionFooResponse& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionFooResponse& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionFooResponse";
+  }
+  protected:
+  explicit CustomOptionFooResponse(::google::protobuf::Arena* arena);
+  CustomOptionFooResponse(::google::protobuf::Arena* arena, const CustomOptionFooResponse& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionFooResponse)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionFooRequest final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionFooRequest) */ {
+ public:
+  inline CustomOptionFooRequest() : CustomOptionFooRequest(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionFooRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionFooRequest(const CustomOptionFooRequest& from)
+      : CustomOptionFooRequest(nullptr, from) {}
+  CustomOptionFooRequest(CustomOptionFooRequest&& from) noexcept
+    : CustomOptionFooRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionFooRequest& operator=(const CustomOptionFooRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionFooRequest& operator=(CustomOptionFooRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionFooRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionFooRequest* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionFooRequest*>(
+               &_CustomOptionFooRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CustomOptionFooRequest& a, CustomOptionFooRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionFooRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionFooRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionFooRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionFooRequest>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionFooRequest& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionFooRequest& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionFooRequest";
+  }
+  protected:
+  explicit CustomOptionFooRequest(::google::protobuf::Arena* arena);
+  CustomOptionFooRequest(::google::protobuf::Arena* arena, const CustomOptionFooRequest& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionFooRequest)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class CustomOptionFooClientMessage final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.CustomOptionFooClientMessage) */ {
+ public:
+  inline CustomOptionFooClientMessage() : CustomOptionFooClientMessage(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR CustomOptionFooClientMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline CustomOptionFooClientMessage(const CustomOptionFooClientMessage& from)
+      : CustomOptionFooClientMessage(nullptr, from) {}
+  CustomOptionFooClientMessage(CustomOptionFooClientMessage&& from) noexcept
+    : CustomOptionFooClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomOptionFooClientMessage& operator=(const CustomOptionFooClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomOptionFooClientMessage& operator=(CustomOptionFooClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomOptionFooClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomOptionFooClientMessage* internal_default_instance() {
+    return reinterpret_cast<const CustomOptionFooClientMessage*>(
+               &_CustomOptionFooClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CustomOptionFooClientMessage& a, CustomOptionFooClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomOptionFooClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomOptionFooClientMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomOptionFooClientMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomOptionFooClientMessage>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CustomOptionFooClientMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CustomOptionFooClientMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.CustomOptionFooClientMessage";
+  }
+  protected:
+  explicit CustomOptionFooClientMessage(::google::protobuf::Arena* arena);
+  CustomOptionFooClientMessage(::google::protobuf::Arena* arena, const CustomOptionFooClientMessage& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionFooClientMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class ComplexOptionType3_ComplexOptionType5 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.ComplexOptionType3.ComplexOptionType5) */ {
+ public:
+  inline ComplexOptionType3_ComplexOptionType5() : ComplexOptionType3_ComplexOptionType5(nullptr) {}
+  ~ComplexOptionType3_ComplexOptionType5() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ComplexOptionType3_ComplexOptionType5(::google::protobuf::internal::ConstantInitialized);
+
+  inline ComplexOptionType3_ComplexOptionType5(const ComplexOptionType3_ComplexOptionType5& from)
+      : ComplexOptionType3_ComplexOptionType5(nullptr, from) {}
+  ComplexOptionType3_ComplexOptionType5(ComplexOptionType3_ComplexOptionType5&& from) noexcept
+    : ComplexOptionType3_ComplexOptionType5() {
+    *this = ::std::move(from);
+  }
+
+  inline ComplexOptionType3_ComplexOptionType5& operator=(const ComplexOptionType3_ComplexOptionType5& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ComplexOptionType3_ComplexOptionType5& operator=(ComplexOptionType3_ComplexOptionType5&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ComplexOptionType3_ComplexOptionType5& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ComplexOptionType3_ComplexOptionType5* internal_default_instance() {
+    return reinterpret_cast<const ComplexOptionType3_ComplexOptionType5*>(
+               &_ComplexOptionType3_ComplexOptionType5_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ComplexOptionType3_ComplexOptionType5& a, ComplexOptionType3_ComplexOptionType5& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ComplexOptionType3_ComplexOptionType5* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComplexOptionType3_ComplexOptionType5* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ComplexOptionType3_ComplexOptionType5* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ComplexOptionType3_ComplexOptionType5>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ComplexOptionType3_ComplexOptionType5& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ComplexOptionType3_ComplexOptionType5& from) {
+    ComplexOptionType3_ComplexOptionType5::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ComplexOptionType3_ComplexOptionType5* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ComplexOptionType3.ComplexOptionType5";
+  }
+  protected:
+  explicit ComplexOptionType3_ComplexOptionType5(::google::protobuf::Arena* arena);
+  ComplexOptionType3_ComplexOptionType5(::google::protobuf::Arena* arena, const ComplexOptionType3_ComplexOptionType5& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlughFieldNumber = 3,
+  };
+  // optional int32 plugh = 3;
+  bool has_plugh() const;
+  void clear_plugh() ;
+  ::int32_t plugh() const;
+  void set_plugh(::int32_t value);
+
+  private:
+  ::int32_t _internal_plugh() const;
+  void _internal_set_plugh(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t plugh_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class ComplexOptionType2_ComplexOptionType4 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.ComplexOptionType2.ComplexOptionType4) */ {
+ public:
+  inline ComplexOptionType2_ComplexOptionType4() : ComplexOptionType2_ComplexOptionType4(nullptr) {}
+  ~ComplexOptionType2_ComplexOptionType4() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ComplexOptionType2_ComplexOptionType4(::google::protobuf::internal::ConstantInitialized);
+
+  inline ComplexOptionType2_ComplexOptionType4(const ComplexOptionType2_ComplexOptionType4& from)
+      : ComplexOptionType2_ComplexOptionType4(nullptr, from) {}
+  ComplexOptionType2_ComplexOptionType4(ComplexOptionType2_ComplexOptionType4&& from) noexcept
+    : ComplexOptionType2_ComplexOptionType4() {
+    *this = ::std::move(from);
+  }
+
+  inline ComplexOptionType2_ComplexOptionType4& operator=(const ComplexOptionType2_ComplexOptionType4& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ComplexOptionType2_ComplexOptionType4& operator=(ComplexOptionType2_ComplexOptionType4&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ComplexOptionType2_ComplexOptionType4& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ComplexOptionType2_ComplexOptionType4* internal_default_instance() {
+    return reinterpret_cast<const ComplexOptionType2_ComplexOptionType4*>(
+               &_ComplexOptionType2_ComplexOptionType4_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ComplexOptionType2_ComplexOptionType4& a, ComplexOptionType2_ComplexOptionType4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ComplexOptionType2_ComplexOptionType4* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComplexOptionType2_ComplexOptionType4* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ComplexOptionType2_ComplexOptionType4* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ComplexOptionType2_ComplexOptionType4>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ComplexOptionType2_ComplexOptionType4& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ComplexOptionType2_ComplexOptionType4& from) {
+    ComplexOptionType2_ComplexOptionType4::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ComplexOptionType2_ComplexOptionType4* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ComplexOptionType2.ComplexOptionType4";
+  }
+  protected:
+  explicit ComplexOptionType2_ComplexOptionType4(::google::protobuf::Arena* arena);
+  ComplexOptionType2_ComplexOptionType4(::google::protobuf::Arena* arena, const ComplexOptionType2_ComplexOptionType4& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWaldoFieldNumber = 1,
+  };
+  // optional int32 waldo = 1;
+  bool has_waldo() const;
+  void clear_waldo() ;
+  ::int32_t waldo() const;
+  void set_waldo(::int32_t value);
+
+  private:
+  ::int32_t _internal_waldo() const;
+  void _internal_set_waldo(::int32_t value);
+
+  public:
+  static const int kComplexOpt4FieldNumber = 7633546;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+      ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4 >, 11, false >
+    complex_opt4;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t waldo_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class ComplexOptionType1 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.ComplexOptionType1) */ {
+ public:
+  inline ComplexOptionType1() : ComplexOptionType1(nullptr) {}
+  ~ComplexOptionType1() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ComplexOptionType1(::google::protobuf::internal::ConstantInitialized);
+
+  inline ComplexOptionType1(const ComplexOptionType1& from)
+      : ComplexOptionType1(nullptr, from) {}
+  ComplexOptionType1(ComplexOptionType1&& from) noexcept
+    : ComplexOptionType1() {
+    *this = ::std::move(from);
+  }
+
+  inline ComplexOptionType1& operator=(const ComplexOptionType1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ComplexOptionType1& operator=(ComplexOptionType1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ComplexOptionType1& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ComplexOptionType1* internal_default_instance() {
+    return reinterpret_cast<const ComplexOptionType1*>(
+               &_ComplexOptionType1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ComplexOptionType1& a, ComplexOptionType1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ComplexOptionType1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComplexOptionType1* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ComplexOptionType1* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ComplexOptionType1>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ComplexOptionType1& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ComplexOptionType1& from) {
+    ComplexOptionType1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ComplexOptionType1* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ComplexOptionType1";
+  }
+  protected:
+  explicit ComplexOptionType1(::google::protobuf::Arena* arena);
+  ComplexOptionType1(::google::protobuf::Arena* arena, const ComplexOptionType1& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFoo4FieldNumber = 4,
+    kFooFieldNumber = 1,
+    kFoo2FieldNumber = 2,
+    kFoo3FieldNumber = 3,
+  };
+  // repeated int32 foo4 = 4;
+  int foo4_size() const;
+  private:
+  int _internal_foo4_size() const;
+
+  public:
+  void clear_foo4() ;
+  ::int32_t foo4(int index) const;
+  void set_foo4(int index, ::int32_t value);
+  void add_foo4(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& foo4() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_foo4();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_foo4() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_foo4();
+
+  public:
+  // optional int32 foo = 1;
+  bool has_foo() const;
+  void clear_foo() ;
+  ::int32_t foo() const;
+  void set_foo(::int32_t value);
+
+  private:
+  ::int32_t _internal_foo() const;
+  void _internal_set_foo(::int32_t value);
+
+  public:
+  // optional int32 foo2 = 2;
+  bool has_foo2() const;
+  void clear_foo2() ;
+  ::int32_t foo2() const;
+  void set_foo2(::int32_t value);
+
+  private:
+  ::int32_t _internal_foo2() const;
+  void _internal_set_foo2(::int32_t value);
+
+  public:
+  // optional int32 foo3 = 3;
+  bool has_foo3() const;
+  void clear_foo3() ;
+  ::int32_t foo3() const;
+  void set_foo3(::int32_t value);
+
+  private:
+  ::int32_t _internal_foo3() const;
+  void _internal_set_foo3(::int32_t value);
+
+  public:
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType1, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType1)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<::int32_t> foo4_;
+    ::int32_t foo_;
+    ::int32_t foo2_;
+    ::int32_t foo3_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class ComplexOpt6 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.ComplexOpt6) */ {
+ public:
+  inline ComplexOpt6() : ComplexOpt6(nullptr) {}
+  ~ComplexOpt6() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ComplexOpt6(::google::protobuf::internal::ConstantInitialized);
+
+  inline ComplexOpt6(const ComplexOpt6& from)
+      : ComplexOpt6(nullptr, from) {}
+  ComplexOpt6(ComplexOpt6&& from) noexcept
+    : ComplexOpt6() {
+    *this = ::std::move(from);
+  }
+
+  inline ComplexOpt6& operator=(const ComplexOpt6& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ComplexOpt6& operator=(ComplexOpt6&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ComplexOpt6& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ComplexOpt6* internal_default_instance() {
+    return reinterpret_cast<const ComplexOpt6*>(
+               &_ComplexOpt6_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ComplexOpt6& a, ComplexOpt6& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ComplexOpt6* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComplexOpt6* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ComplexOpt6* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ComplexOpt6>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ComplexOpt6& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ComplexOpt6& from) {
+    ComplexOpt6::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ComplexOpt6* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ComplexOpt6";
+  }
+  protected:
+  explicit ComplexOpt6(::google::protobuf::Arena* arena);
+  ComplexOpt6(::google::protobuf::Arena* arena, const ComplexOpt6& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXyzzyFieldNumber = 7593951,
+  };
+  // optional int32 xyzzy = 7593951;
+  bool has_xyzzy() const;
+  void clear_xyzzy() ;
+  ::int32_t xyzzy() const;
+  void set_xyzzy(::int32_t value);
+
+  private:
+  ::int32_t _internal_xyzzy() const;
+  void _internal_set_xyzzy(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOpt6)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t xyzzy_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class AggregateMessageSetElement final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.AggregateMessageSetElement) */ {
+ public:
+  inline AggregateMessageSetElement() : AggregateMessageSetElement(nullptr) {}
+  ~AggregateMessageSetElement() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR AggregateMessageSetElement(::google::protobuf::internal::ConstantInitialized);
+
+  inline AggregateMessageSetElement(const AggregateMessageSetElement& from)
+      : AggregateMessageSetElement(nullptr, from) {}
+  AggregateMessageSetElement(AggregateMessageSetElement&& from) noexcept
+    : AggregateMessageSetElement() {
+    *this = ::std::move(from);
+  }
+
+  inline AggregateMessageSetElement& operator=(const AggregateMessageSetElement& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AggregateMessageSetElement& operator=(AggregateMessageSetElement&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AggregateMessageSetElement& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AggregateMessageSetElement* internal_default_instance() {
+    return reinterpret_cast<const AggregateMessageSetElement*>(
+               &_AggregateMessageSetElement_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(AggregateMessageSetElement& a, AggregateMessageSetElement& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AggregateMessageSetElement* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AggregateMessageSetElement* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AggregateMessageSetElement* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AggregateMessageSetElement>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const AggregateMessageSetElement& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const AggregateMessageSetElement& from) {
+    AggregateMessageSetElement::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(AggregateMessageSetElement* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.AggregateMessageSetElement";
+  }
+  protected:
+  explicit AggregateMessageSetElement(::google::protobuf::Arena* arena);
+  AggregateMessageSetElement(::google::protobuf::Arena* arena, const AggregateMessageSetElement& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSFieldNumber = 1,
+  };
+  // optional string s = 1;
+  bool has_s() const;
+  void clear_s() ;
+  const std::string& s() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_s(Arg_&& arg, Args_... args);
+  std::string* mutable_s();
+  PROTOBUF_NODISCARD std::string* release_s();
+  void set_allocated_s(std::string* value);
+
+  private:
+  const std::string& _internal_s() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_s(
+      const std::string& value);
+  std::string* _internal_mutable_s();
+
+  public:
+  static const int kMessageSetExtensionFieldNumber = 15447542;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::AggregateMessageSet,
+      ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::AggregateMessageSetElement >, 11, false >
+    message_set_extension;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.AggregateMessageSetElement)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      54, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr s_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class AggregateMessageSet final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.AggregateMessageSet) */ {
+ public:
+  inline AggregateMessageSet() : AggregateMessageSet(nullptr) {}
+  ~AggregateMessageSet() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR AggregateMessageSet(::google::protobuf::internal::ConstantInitialized);
+
+  inline AggregateMessageSet(const AggregateMessageSet& from)
+      : AggregateMessageSet(nullptr, from) {}
+  AggregateMessageSet(AggregateMessageSet&& from) noexcept
+    : AggregateMessageSet() {
+    *this = ::std::move(from);
+  }
+
+  inline AggregateMessageSet& operator=(const AggregateMessageSet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AggregateMessageSet& operator=(AggregateMessageSet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AggregateMessageSet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AggregateMessageSet* internal_default_instance() {
+    return reinterpret_cast<const AggregateMessageSet*>(
+               &_AggregateMessageSet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(AggregateMessageSet& a, AggregateMessageSet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AggregateMessageSet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AggregateMessageSet* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AggregateMessageSet* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AggregateMessageSet>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const AggregateMessageSet& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const AggregateMessageSet& from) {
+    AggregateMessageSet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(AggregateMessageSet* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.AggregateMessageSet";
+  }
+  protected:
+  explicit AggregateMessageSet(::google::protobuf::Arena* arena);
+  AggregateMessageSet(::google::protobuf::Arena* arena, const AggregateMessageSet& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<AggregateMessageSet, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.AggregateMessageSet)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class AggregateMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.AggregateMessage) */ {
+ public:
+  inline AggregateMessage() : AggregateMessage(nullptr) {}
+  ~AggregateMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR AggregateMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline AggregateMessage(const AggregateMessage& from)
+      : AggregateMessage(nullptr, from) {}
+  AggregateMessage(AggregateMessage&& from) noexcept
+    : AggregateMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline AggregateMessage& operator=(const AggregateMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AggregateMessage& operator=(AggregateMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AggregateMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AggregateMessage* internal_default_instance() {
+    return reinterpret_cast<const AggregateMessage*>(
+               &_AggregateMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(AggregateMessage& a, AggregateMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AggregateMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AggregateMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AggregateMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AggregateMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const AggregateMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const AggregateMessage& from) {
+    AggregateMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(AggregateMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.AggregateMessage";
+  }
+  protected:
+  explicit AggregateMessage(::google::protobuf::Arena* arena);
+  AggregateMessage(::google::protobuf::Arena* arena, const AggregateMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFieldnameFieldNumber = 1,
+  };
+  // optional int32 fieldname = 1 [(.protobuf_unittest.fieldopt) = {
+  bool has_fieldname() const;
+  void clear_fieldname() ;
+  ::int32_t fieldname() const;
+  void set_fieldname(::int32_t value);
+
+  private:
+  ::int32_t _internal_fieldname() const;
+  void _internal_set_fieldname(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.AggregateMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t fieldname_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMessageWithCustomOptions final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMessageWithCustomOptions) */ {
+ public:
+  inline TestMessageWithCustomOptions() : TestMessageWithCustomOptions(nullptr) {}
+  ~TestMessageWithCustomOptions() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMessageWithCustomOptions(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMessageWithCustomOptions(const TestMessageWithCustomOptions& from)
+      : TestMessageWithCustomOptions(nullptr, from) {}
+  TestMessageWithCustomOptions(TestMessageWithCustomOptions&& from) noexcept
+    : TestMessageWithCustomOptions() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageWithCustomOptions& operator=(const TestMessageWithCustomOptions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageWithCustomOptions& operator=(TestMessageWithCustomOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestMessageWithCustomOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  enum AnOneofCase {
+    kOneofField = 2,
+    ANONEOF_NOT_SET = 0,
+  };
+
+  static inline const TestMessageWithCustomOptions* internal_default_instance() {
+    return reinterpret_cast<const TestMessageWithCustomOptions*>(
+               &_TestMessageWithCustomOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestMessageWithCustomOptions& a, TestMessageWithCustomOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageWithCustomOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageWithCustomOptions* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMessageWithCustomOptions* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMessageWithCustomOptions>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestMessageWithCustomOptions& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestMessageWithCustomOptions& from) {
+    TestMessageWithCustomOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMessageWithCustomOptions* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestMessageWithCustomOptions";
+  }
+  protected:
+  explicit TestMessageWithCustomOptions(::google::protobuf::Arena* arena);
+  TestMessageWithCustomOptions(::google::protobuf::Arena* arena, const TestMessageWithCustomOptions& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  using AnEnum = TestMessageWithCustomOptions_AnEnum;
+  static constexpr AnEnum ANENUM_VAL1 = TestMessageWithCustomOptions_AnEnum_ANENUM_VAL1;
+  static constexpr AnEnum ANENUM_VAL2 = TestMessageWithCustomOptions_AnEnum_ANENUM_VAL2;
+  static inline bool AnEnum_IsValid(int value) {
+    return TestMessageWithCustomOptions_AnEnum_IsValid(value);
+  }
+  static constexpr AnEnum AnEnum_MIN = TestMessageWithCustomOptions_AnEnum_AnEnum_MIN;
+  static constexpr AnEnum AnEnum_MAX = TestMessageWithCustomOptions_AnEnum_AnEnum_MAX;
+  static constexpr int AnEnum_ARRAYSIZE = TestMessageWithCustomOptions_AnEnum_AnEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* AnEnum_descriptor() {
+    return TestMessageWithCustomOptions_AnEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& AnEnum_Name(T value) {
+    return TestMessageWithCustomOptions_AnEnum_Name(value);
+  }
+  static inline bool AnEnum_Parse(absl::string_view name, AnEnum* value) {
+    return TestMessageWithCustomOptions_AnEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldFieldNumber = 3,
+    kField1FieldNumber = 1,
+    kOneofFieldFieldNumber = 2,
+  };
+  // map<string, string> map_field = 3 [(.protobuf_unittest.field_opt1) = 12345];
+  int map_field_size() const;
+  private:
+  int _internal_map_field_size() const;
+
+  public:
+  void clear_map_field() ;
+  const ::google::protobuf::Map<std::string, std::string>& map_field() const;
+  ::google::protobuf::Map<std::string, std::string>* mutable_map_field();
+
+  private:
+  const ::google::protobuf::Map<std::string, std::string>& _internal_map_field() const;
+  ::google::protobuf::Map<std::string, std::string>* _internal_mutable_map_field();
+
+  public:
+  // optional string field1 = 1 [ctype = CORD, (.protobuf_unittest.field_opt1) = 8765432109];
+  bool has_field1() const;
+  void clear_field1() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& field1() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_field1(Arg_&& arg, Args_... args);
+  std::string* mutable_field1();
+  PROTOBUF_NODISCARD std::string* release_field1();
+  void set_allocated_field1(std::string* value);
+
+  private:
+  const std::string& _internal_field1() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_field1(
+      const std::string& value);
+  std::string* _internal_mutable_field1();
+
+  public:
+  // int32 oneof_field = 2;
+  bool has_oneof_field() const;
+  void clear_oneof_field() ;
+  ::int32_t oneof_field() const;
+  void set_oneof_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_oneof_field() const;
+  void _internal_set_oneof_field(::int32_t value);
+
+  public:
+  void clear_AnOneof();
+  AnOneofCase AnOneof_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageWithCustomOptions)
+ private:
+  class _Internal;
+  void set_has_oneof_field();
+
+  inline bool has_AnOneof() const;
+  inline void clear_has_AnOneof();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 3, 1,
+      70, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::MapField<TestMessageWithCustomOptions_MapFieldEntry_DoNotUse, std::string, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map_field_;
+    ::google::protobuf::internal::ArenaStringPtr field1_;
+    union AnOneofUnion {
+      constexpr AnOneofUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::int32_t oneof_field_;
+    } AnOneof_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class ComplexOptionType3 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.ComplexOptionType3) */ {
+ public:
+  inline ComplexOptionType3() : ComplexOptionType3(nullptr) {}
+  ~ComplexOptionType3() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ComplexOptionType3(::google::protobuf::internal::ConstantInitialized);
+
+  inline ComplexOptionType3(const ComplexOptionType3& from)
+      : ComplexOptionType3(nullptr, from) {}
+  ComplexOptionType3(ComplexOptionType3&& from) noexcept
+    : ComplexOptionType3() {
+    *this = ::std::move(from);
+  }
+
+  inline ComplexOptionType3& operator=(const ComplexOptionType3& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ComplexOptionType3& operator=(ComplexOptionType3&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ComplexOptionType3& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ComplexOptionType3* internal_default_instance() {
+    return reinterpret_cast<const ComplexOptionType3*>(
+               &_ComplexOptionType3_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ComplexOptionType3& a, ComplexOptionType3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ComplexOptionType3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComplexOptionType3* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ComplexOptionType3* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ComplexOptionType3>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ComplexOptionType3& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ComplexOptionType3& from) {
+    ComplexOptionType3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ComplexOptionType3* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ComplexOptionType3";
+  }
+  protected:
+  explicit ComplexOptionType3(::google::protobuf::Arena* arena);
+  ComplexOptionType3(::google::protobuf::Arena* arena, const ComplexOptionType3& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using ComplexOptionType5 = ComplexOptionType3_ComplexOptionType5;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComplexoptiontype5FieldNumber = 2,
+    kMooFieldNumber = 1,
+  };
+  // optional group ComplexOptionType5 = 2 { ... };
+  bool has_complexoptiontype5() const;
+  void clear_complexoptiontype5() ;
+  const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& complexoptiontype5() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* release_complexoptiontype5();
+  ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* mutable_complexoptiontype5();
+  void set_allocated_complexoptiontype5(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* value);
+  void unsafe_arena_set_allocated_complexoptiontype5(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* value);
+  ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* unsafe_arena_release_complexoptiontype5();
+
+  private:
+  const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& _internal_complexoptiontype5() const;
+  ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* _internal_mutable_complexoptiontype5();
+
+  public:
+  // optional int32 moo = 1;
+  bool has_moo() const;
+  void clear_moo() ;
+  ::int32_t moo() const;
+  void set_moo(::int32_t value);
+
+  private:
+  ::int32_t _internal_moo() const;
+  void _internal_set_moo(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType3)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* complexoptiontype5_;
+    ::int32_t moo_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class ComplexOptionType2 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.ComplexOptionType2) */ {
+ public:
+  inline ComplexOptionType2() : ComplexOptionType2(nullptr) {}
+  ~ComplexOptionType2() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ComplexOptionType2(::google::protobuf::internal::ConstantInitialized);
+
+  inline ComplexOptionType2(const ComplexOptionType2& from)
+      : ComplexOptionType2(nullptr, from) {}
+  ComplexOptionType2(ComplexOptionType2&& from) noexcept
+    : ComplexOptionType2() {
+    *this = ::std::move(from);
+  }
+
+  inline ComplexOptionType2& operator=(const ComplexOptionType2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ComplexOptionType2& operator=(ComplexOptionType2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ComplexOptionType2& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ComplexOptionType2* internal_default_instance() {
+    return reinterpret_cast<const ComplexOptionType2*>(
+               &_ComplexOptionType2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ComplexOptionType2& a, ComplexOptionType2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ComplexOptionType2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComplexOptionType2* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ComplexOptionType2* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ComplexOptionType2>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ComplexOptionType2& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ComplexOptionType2& from) {
+    ComplexOptionType2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ComplexOptionType2* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ComplexOptionType2";
+  }
+  protected:
+  explicit ComplexOptionType2(::google::protobuf::Arena* arena);
+  ComplexOptionType2(::google::protobuf::Arena* arena, const ComplexOptionType2& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using ComplexOptionType4 = ComplexOptionType2_ComplexOptionType4;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBarneyFieldNumber = 4,
+    kBarFieldNumber = 1,
+    kFredFieldNumber = 3,
+    kBazFieldNumber = 2,
+  };
+  // repeated .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 barney = 4;
+  int barney_size() const;
+  private:
+  int _internal_barney_size() const;
+
+  public:
+  void clear_barney() ;
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* mutable_barney(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4 >*
+      mutable_barney();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>& _internal_barney() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>* _internal_mutable_barney();
+  public:
+  const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& barney(int index) const;
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* add_barney();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4 >&
+      barney() const;
+  // optional .protobuf_unittest.ComplexOptionType1 bar = 1;
+  bool has_bar() const;
+  void clear_bar() ;
+  const ::protobuf_unittest::ComplexOptionType1& bar() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::ComplexOptionType1* release_bar();
+  ::protobuf_unittest::ComplexOptionType1* mutable_bar();
+  void set_allocated_bar(::protobuf_unittest::ComplexOptionType1* value);
+  void unsafe_arena_set_allocated_bar(::protobuf_unittest::ComplexOptionType1* value);
+  ::protobuf_unittest::ComplexOptionType1* unsafe_arena_release_bar();
+
+  private:
+  const ::protobuf_unittest::ComplexOptionType1& _internal_bar() const;
+  ::protobuf_unittest::ComplexOptionType1* _internal_mutable_bar();
+
+  public:
+  // optional .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 fred = 3;
+  bool has_fred() const;
+  void clear_fred() ;
+  const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& fred() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* release_fred();
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* mutable_fred();
+  void set_allocated_fred(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* value);
+  void unsafe_arena_set_allocated_fred(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* value);
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* unsafe_arena_release_fred();
+
+  private:
+  const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& _internal_fred() const;
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* _internal_mutable_fred();
+
+  public:
+  // optional int32 baz = 2;
+  bool has_baz() const;
+  void clear_baz() ;
+  ::int32_t baz() const;
+  void set_baz(::int32_t value);
+
+  private:
+  ::int32_t _internal_baz() const;
+  void _internal_set_baz(::int32_t value);
+
+  public:
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<ComplexOptionType2, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType2)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 3,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4 > barney_;
+    ::protobuf_unittest::ComplexOptionType1* bar_;
+    ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* fred_;
+    ::int32_t baz_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};// -------------------------------------------------------------------
+
+class Aggregate final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.Aggregate) */ {
+ public:
+  inline Aggregate() : Aggregate(nullptr) {}
+  ~Aggregate() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR Aggregate(::google::protobuf::internal::ConstantInitialized);
+
+  inline Aggregate(const Aggregate& from)
+      : Aggregate(nullptr, from) {}
+  Aggregate(Aggregate&& from) noexcept
+    : Aggregate() {
+    *this = ::std::move(from);
+  }
+
+  inline Aggregate& operator=(const Aggregate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Aggregate& operator=(Aggregate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Aggregate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Aggregate* internal_default_instance() {
+    return reinterpret_cast<const Aggregate*>(
+               &_Aggregate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(Aggregate& a, Aggregate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Aggregate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Aggregate* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Aggregate* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Aggregate>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const Aggregate& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const Aggregate& from) {
+    Aggregate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(Aggregate* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.Aggregate";
+  }
+  protected:
+  explicit Aggregate(::google::protobuf::Arena* arena);
+  Aggregate(::google::protobuf::Arena* arena, const Aggregate& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSFieldNumber = 2,
+    kSubFieldNumber = 3,
+    kFileFieldNumber = 4,
+    kMsetFieldNumber = 5,
+    kAnyFieldNumber = 6,
+    kIFieldNumber = 1,
+  };
+  // optional string s = 2;
+  bool has_s() const;
+  void clear_s() ;
+  const std::string& s() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_s(Arg_&& arg, Args_... args);
+  std::string* mutable_s();
+  PROTOBUF_NODISCARD std::string* release_s();
+  void set_allocated_s(std::string* value);
+
+  private:
+  const std::string& _internal_s() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_s(
+      const std::string& value);
+  std::string* _internal_mutable_s();
+
+  public:
+  // optional .protobuf_unittest.Aggregate sub = 3;
+  bool has_sub() const;
+  void clear_sub() ;
+  const ::protobuf_unittest::Aggregate& sub() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::Aggregate* release_sub();
+  ::protobuf_unittest::Aggregate* mutable_sub();
+  void set_allocated_sub(::protobuf_unittest::Aggregate* value);
+  void unsafe_arena_set_allocated_sub(::protobuf_unittest::Aggregate* value);
+  ::protobuf_unittest::Aggregate* unsafe_arena_release_sub();
+
+  private:
+  const ::protobuf_unittest::Aggregate& _internal_sub() const;
+  ::protobuf_unittest::Aggregate* _internal_mutable_sub();
+
+  public:
+  // optional .google.protobuf.FileOptions file = 4;
+  bool has_file() const;
+  void clear_file() ;
+  const ::google::protobuf::FileOptions& file() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FileOptions* release_file();
+  ::google::protobuf::FileOptions* mutable_file();
+  void set_allocated_file(::google::protobuf::FileOptions* value);
+  void unsafe_arena_set_allocated_file(::google::protobuf::FileOptions* value);
+  ::google::protobuf::FileOptions* unsafe_arena_release_file();
+
+  private:
+  const ::google::protobuf::FileOptions& _internal_file() const;
+  ::google::protobuf::FileOptions* _internal_mutable_file();
+
+  public:
+  // optional .protobuf_unittest.AggregateMessageSet mset = 5;
+  bool has_mset() const;
+  void clear_mset() ;
+  const ::protobuf_unittest::AggregateMessageSet& mset() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::AggregateMessageSet* release_mset();
+  ::protobuf_unittest::AggregateMessageSet* mutable_mset();
+  void set_allocated_mset(::protobuf_unittest::AggregateMessageSet* value);
+  void unsafe_arena_set_allocated_mset(::protobuf_unittest::AggregateMessageSet* value);
+  ::protobuf_unittest::AggregateMessageSet* unsafe_arena_release_mset();
+
+  private:
+  const ::protobuf_unittest::AggregateMessageSet& _internal_mset() const;
+  ::protobuf_unittest::AggregateMessageSet* _internal_mutable_mset();
+
+  public:
+  // optional .google.protobuf.Any any = 6;
+  bool has_any() const;
+  void clear_any() ;
+  const ::google::protobuf::Any& any() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Any* release_any();
+  ::google::protobuf::Any* mutable_any();
+  void set_allocated_any(::google::protobuf::Any* value);
+  void unsafe_arena_set_allocated_any(::google::protobuf::Any* value);
+  ::google::protobuf::Any* unsafe_arena_release_any();
+
+  private:
+  const ::google::protobuf::Any& _internal_any() const;
+  ::google::protobuf::Any* _internal_mutable_any();
+
+  public:
+  // optional int32 i = 1;
+  bool has_i() const;
+  void clear_i() ;
+  ::int32_t i() const;
+  void set_i(::int32_t value);
+
+  private:
+  ::int32_t _internal_i() const;
+  void _internal_set_i(::int32_t value);
+
+  public:
+  static const int kNestedFieldNumber = 15476903;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+      ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+    nested;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.Aggregate)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 6, 4,
+      37, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr s_;
+    ::protobuf_unittest::Aggregate* sub_;
+    ::google::protobuf::FileOptions* file_;
+    ::protobuf_unittest::AggregateMessageSet* mset_;
+    ::google::protobuf::Any* any_;
+    ::int32_t i_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto;
+};
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestServiceWithCustomOptions_Stub;
+class TestServiceWithCustomOptions : public ::google::protobuf::Service {
+ protected:
+  TestServiceWithCustomOptions() = default;
+
+ public:
+  using Stub = TestServiceWithCustomOptions_Stub;
+
+  TestServiceWithCustomOptions(const TestServiceWithCustomOptions&) = delete;
+  TestServiceWithCustomOptions& operator=(const TestServiceWithCustomOptions&) = delete;
+  virtual ~TestServiceWithCustomOptions() = default;
+
+  static const ::google::protobuf::ServiceDescriptor* descriptor();
+
+  virtual void Foo(::google::protobuf::RpcController* controller,
+                        const ::protobuf_unittest::CustomOptionFooRequest* request,
+                        ::protobuf_unittest::CustomOptionFooResponse* response,
+                        ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+  const ::google::protobuf::ServiceDescriptor* GetDescriptor() override;
+
+  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
+                  ::google::protobuf::RpcController* controller,
+                  const ::google::protobuf::Message* request,
+                  ::google::protobuf::Message* response,
+                  ::google::protobuf::Closure* done) override;
+
+  const ::google::protobuf::Message& GetRequestPrototype(
+      const ::google::protobuf::MethodDescriptor* method) const override;
+
+  const ::google::protobuf::Message& GetResponsePrototype(
+      const ::google::protobuf::MethodDescriptor* method) const override;
+};
+
+class TestServiceWithCustomOptions_Stub final : public TestServiceWithCustomOptions {
+ public:
+  TestServiceWithCustomOptions_Stub(::google::protobuf::RpcChannel* channel);
+  TestServiceWithCustomOptions_Stub(::google::protobuf::RpcChannel* channel,
+                   ::google::protobuf::Service::ChannelOwnership ownership);
+
+  TestServiceWithCustomOptions_Stub(const TestServiceWithCustomOptions_Stub&) = delete;
+  TestServiceWithCustomOptions_Stub& operator=(const TestServiceWithCustomOptions_Stub&) = delete;
+
+  ~TestServiceWithCustomOptions_Stub() override;
+
+  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
+
+  // implements TestServiceWithCustomOptions ------------------------------------------
+  void Foo(::google::protobuf::RpcController* controller,
+                        const ::protobuf_unittest::CustomOptionFooRequest* request,
+                        ::protobuf_unittest::CustomOptionFooResponse* response,
+                        ::google::protobuf::Closure* done) override;
+
+ private:
+  ::google::protobuf::RpcChannel* channel_;
+  bool owns_channel_;
+};
+// -------------------------------------------------------------------
+
+class AggregateService_Stub;
+class AggregateService : public ::google::protobuf::Service {
+ protected:
+  AggregateService() = default;
+
+ public:
+  using Stub = AggregateService_Stub;
+
+  AggregateService(const AggregateService&) = delete;
+  AggregateService& operator=(const AggregateService&) = delete;
+  virtual ~AggregateService() = default;
+
+  static const ::google::protobuf::ServiceDescriptor* descriptor();
+
+  virtual void Method(::google::protobuf::RpcController* controller,
+                        const ::protobuf_unittest::AggregateMessage* request,
+                        ::protobuf_unittest::AggregateMessage* response,
+                        ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+  const ::google::protobuf::ServiceDescriptor* GetDescriptor() override;
+
+  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
+                  ::google::protobuf::RpcController* controller,
+                  const ::google::protobuf::Message* request,
+                  ::google::protobuf::Message* response,
+                  ::google::protobuf::Closure* done) override;
+
+  const ::google::protobuf::Message& GetRequestPrototype(
+      const ::google::protobuf::MethodDescriptor* method) const override;
+
+  const ::google::protobuf::Message& GetResponsePrototype(
+      const ::google::protobuf::MethodDescriptor* method) const override;
+};
+
+class AggregateService_Stub final : public AggregateService {
+ public:
+  AggregateService_Stub(::google::protobuf::RpcChannel* channel);
+  AggregateService_Stub(::google::protobuf::RpcChannel* channel,
+                   ::google::protobuf::Service::ChannelOwnership ownership);
+
+  AggregateService_Stub(const AggregateService_Stub&) = delete;
+  AggregateService_Stub& operator=(const AggregateService_Stub&) = delete;
+
+  ~AggregateService_Stub() override;
+
+  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
+
+  // implements AggregateService ------------------------------------------
+  void Method(::google::protobuf::RpcController* controller,
+                        const ::protobuf_unittest::AggregateMessage* request,
+                        ::protobuf_unittest::AggregateMessage* response,
+                        ::google::protobuf::Closure* done) override;
+
+ private:
+  ::google::protobuf::RpcChannel* channel_;
+  bool owns_channel_;
+};
+// ===================================================================
+
+
+static const int kFileOpt1FieldNumber = 7736974;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 4, false >
+  file_opt1;
+static const int kMessageOpt1FieldNumber = 7739036;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  message_opt1;
+static const int kFieldOpt1FieldNumber = 7740936;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 6, false >
+  field_opt1;
+static const int kFieldOpt2FieldNumber = 7753913;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  field_opt2;
+static const int kOneofOpt1FieldNumber = 7740111;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::OneofOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  oneof_opt1;
+static const int kEnumOpt1FieldNumber = 7753576;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 15, false >
+  enum_opt1;
+static const int kEnumValueOpt1FieldNumber = 1560678;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumValueOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  enum_value_opt1;
+static const int kServiceOpt1FieldNumber = 7887650;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 18, false >
+  service_opt1;
+static const int kMethodOpt1FieldNumber = 7890860;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::MethodOpt1, ::protobuf_unittest::MethodOpt1_IsValid>, 14, false >
+  method_opt1;
+static const int kBoolOptFieldNumber = 7706090;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false >
+  bool_opt;
+static const int kInt32OptFieldNumber = 7705709;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  int32_opt;
+static const int kInt64OptFieldNumber = 7705542;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 3, false >
+  int64_opt;
+static const int kUint32OptFieldNumber = 7704880;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 13, false >
+  uint32_opt;
+static const int kUint64OptFieldNumber = 7702367;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 4, false >
+  uint64_opt;
+static const int kSint32OptFieldNumber = 7701568;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 17, false >
+  sint32_opt;
+static const int kSint64OptFieldNumber = 7700863;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 18, false >
+  sint64_opt;
+static const int kFixed32OptFieldNumber = 7700307;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 7, false >
+  fixed32_opt;
+static const int kFixed64OptFieldNumber = 7700194;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 6, false >
+  fixed64_opt;
+static const int kSfixed32OptFieldNumber = 7698645;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 15, false >
+  sfixed32_opt;
+static const int kSfixed64OptFieldNumber = 7685475;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 16, false >
+  sfixed64_opt;
+static const int kFloatOptFieldNumber = 7675390;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< float >, 2, false >
+  float_opt;
+static const int kDoubleOptFieldNumber = 7673293;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< double >, 1, false >
+  double_opt;
+static const int kStringOptFieldNumber = 7673285;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  string_opt;
+static const int kBytesOptFieldNumber = 7673238;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::StringTypeTraits, 12, false >
+  bytes_opt;
+static const int kEnumOptFieldNumber = 7673233;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType, ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType_IsValid>, 14, false >
+  enum_opt;
+static const int kMessageTypeOptFieldNumber = 7665967;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::DummyMessageInvalidAsOptionType >, 11, false >
+  message_type_opt;
+static const int kMoooFieldNumber = 7663707;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType1,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  mooo;
+static const int kCorgeFieldNumber = 7663442;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType1,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType3 >, 11, false >
+  corge;
+static const int kGraultFieldNumber = 7650927;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType2,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  grault;
+static const int kGarplyFieldNumber = 7649992;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType2,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType1 >, 11, false >
+  garply;
+static const int kComplexOpt1FieldNumber = 7646756;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType1 >, 11, false >
+  complex_opt1;
+static const int kComplexOpt2FieldNumber = 7636949;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType2 >, 11, false >
+  complex_opt2;
+static const int kComplexOpt3FieldNumber = 7636463;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType3 >, 11, false >
+  complex_opt3;
+static const int kComplexopt6FieldNumber = 7595468;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOpt6 >, 10, false >
+  complexopt6;
+static const int kFileoptFieldNumber = 15478479;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  fileopt;
+static const int kMsgoptFieldNumber = 15480088;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  msgopt;
+static const int kFieldoptFieldNumber = 15481374;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  fieldopt;
+static const int kEnumoptFieldNumber = 15483218;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  enumopt;
+static const int kEnumvaloptFieldNumber = 15486921;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumValueOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  enumvalopt;
+static const int kServiceoptFieldNumber = 15497145;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  serviceopt;
+static const int kMethodoptFieldNumber = 15512713;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::Aggregate >, 11, false >
+  methodopt;
+static const int kRequiredEnumOptFieldNumber = 106161807;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OldOptionType >, 11, false >
+  required_enum_opt;
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMessageWithCustomOptions
+
+// optional string field1 = 1 [ctype = CORD, (.protobuf_unittest.field_opt1) = 8765432109];
+inline bool TestMessageWithCustomOptions::has_field1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestMessageWithCustomOptions::clear_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.field1_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestMessageWithCustomOptions::field1() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestMessageWithCustomOptions.field1)
+  return _internal_field1();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestMessageWithCustomOptions::set_field1(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.field1_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestMessageWithCustomOptions.field1)
+}
+inline std::string* TestMessageWithCustomOptions::mutable_field1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_field1();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestMessageWithCustomOptions.field1)
+  return _s;
+}
+inline const std::string& TestMessageWithCustomOptions::_internal_field1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.field1_.Get();
+}
+inline void TestMessageWithCustomOptions::_internal_set_field1(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.field1_.Set(value, GetArena());
+}
+inline std::string* TestMessageWithCustomOptions::_internal_mutable_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.field1_.Mutable( GetArena());
+}
+inline std::string* TestMessageWithCustomOptions::release_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestMessageWithCustomOptions.field1)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.field1_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.field1_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestMessageWithCustomOptions::set_allocated_field1(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.field1_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.field1_.IsDefault()) {
+          _impl_.field1_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestMessageWithCustomOptions.field1)
+}
+
+// int32 oneof_field = 2;
+inline bool TestMessageWithCustomOptions::has_oneof_field() const {
+  return AnOneof_case() == kOneofField;
+}
+inline void TestMessageWithCustomOptions::set_has_oneof_field() {
+  _impl_._oneof_case_[0] = kOneofField;
+}
+inline void TestMessageWithCustomOptions::clear_oneof_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (AnOneof_case() == kOneofField) {
+    _impl_.AnOneof_.oneof_field_ = 0;
+    clear_has_AnOneof();
+  }
+}
+inline ::int32_t TestMessageWithCustomOptions::oneof_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestMessageWithCustomOptions.oneof_field)
+  return _internal_oneof_field();
+}
+inline void TestMessageWithCustomOptions::set_oneof_field(::int32_t value) {
+  _internal_set_oneof_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestMessageWithCustomOptions.oneof_field)
+}
+inline ::int32_t TestMessageWithCustomOptions::_internal_oneof_field() const {
+  if (AnOneof_case() == kOneofField) {
+    return _impl_.AnOneof_.oneof_field_;
+  }
+  return 0;
+}
+inline void TestMessageWithCustomOptions::_internal_set_oneof_field(::int32_t value) {
+  if (AnOneof_case() != kOneofField) {
+    clear_AnOneof();
+    set_has_oneof_field();
+  }
+  _impl_.AnOneof_.oneof_field_ = value;
+}
+
+// map<string, string> map_field = 3 [(.protobuf_unittest.field_opt1) = 12345];
+inline int TestMessageWithCustomOptions::_internal_map_field_size() const {
+  return _internal_map_field().size();
+}
+inline int TestMessageWithCustomOptions::map_field_size() const {
+  return _internal_map_field_size();
+}
+inline void TestMessageWithCustomOptions::clear_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_field_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& TestMessageWithCustomOptions::_internal_map_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_field_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& TestMessageWithCustomOptions::map_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMessageWithCustomOptions.map_field)
+  return _internal_map_field();
+}
+inline ::google::protobuf::Map<std::string, std::string>* TestMessageWithCustomOptions::_internal_mutable_map_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_field_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, std::string>* TestMessageWithCustomOptions::mutable_map_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMessageWithCustomOptions.map_field)
+  return _internal_mutable_map_field();
+}
+
+inline bool TestMessageWithCustomOptions::has_AnOneof() const {
+  return AnOneof_case() != ANONEOF_NOT_SET;
+}
+inline void TestMessageWithCustomOptions::clear_has_AnOneof() {
+  _impl_._oneof_case_[0] = ANONEOF_NOT_SET;
+}
+inline TestMessageWithCustomOptions::AnOneofCase TestMessageWithCustomOptions::AnOneof_case() const {
+  return TestMessageWithCustomOptions::AnOneofCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// CustomOptionFooRequest
+
+// -------------------------------------------------------------------
+
+// CustomOptionFooResponse
+
+// -------------------------------------------------------------------
+
+// CustomOptionFooClientMessage
+
+// -------------------------------------------------------------------
+
+// CustomOptionFooServerMessage
+
+// -------------------------------------------------------------------
+
+// DummyMessageContainingEnum
+
+// -------------------------------------------------------------------
+
+// DummyMessageInvalidAsOptionType
+
+// -------------------------------------------------------------------
+
+// CustomOptionMinIntegerValues
+
+// -------------------------------------------------------------------
+
+// CustomOptionMaxIntegerValues
+
+// -------------------------------------------------------------------
+
+// CustomOptionOtherValues
+
+// -------------------------------------------------------------------
+
+// SettingRealsFromPositiveInts
+
+// -------------------------------------------------------------------
+
+// SettingRealsFromNegativeInts
+
+// -------------------------------------------------------------------
+
+// ComplexOptionType1
+
+// optional int32 foo = 1;
+inline bool ComplexOptionType1::has_foo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void ComplexOptionType1::clear_foo() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.foo_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t ComplexOptionType1::foo() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType1.foo)
+  return _internal_foo();
+}
+inline void ComplexOptionType1::set_foo(::int32_t value) {
+  _internal_set_foo(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType1.foo)
+}
+inline ::int32_t ComplexOptionType1::_internal_foo() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.foo_;
+}
+inline void ComplexOptionType1::_internal_set_foo(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.foo_ = value;
+}
+
+// optional int32 foo2 = 2;
+inline bool ComplexOptionType1::has_foo2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void ComplexOptionType1::clear_foo2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.foo2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::int32_t ComplexOptionType1::foo2() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType1.foo2)
+  return _internal_foo2();
+}
+inline void ComplexOptionType1::set_foo2(::int32_t value) {
+  _internal_set_foo2(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType1.foo2)
+}
+inline ::int32_t ComplexOptionType1::_internal_foo2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.foo2_;
+}
+inline void ComplexOptionType1::_internal_set_foo2(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.foo2_ = value;
+}
+
+// optional int32 foo3 = 3;
+inline bool ComplexOptionType1::has_foo3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline void ComplexOptionType1::clear_foo3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.foo3_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::int32_t ComplexOptionType1::foo3() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType1.foo3)
+  return _internal_foo3();
+}
+inline void ComplexOptionType1::set_foo3(::int32_t value) {
+  _internal_set_foo3(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType1.foo3)
+}
+inline ::int32_t ComplexOptionType1::_internal_foo3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.foo3_;
+}
+inline void ComplexOptionType1::_internal_set_foo3(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.foo3_ = value;
+}
+
+// repeated int32 foo4 = 4;
+inline int ComplexOptionType1::_internal_foo4_size() const {
+  return _internal_foo4().size();
+}
+inline int ComplexOptionType1::foo4_size() const {
+  return _internal_foo4_size();
+}
+inline void ComplexOptionType1::clear_foo4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.foo4_.Clear();
+}
+inline ::int32_t ComplexOptionType1::foo4(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType1.foo4)
+  return _internal_foo4().Get(index);
+}
+inline void ComplexOptionType1::set_foo4(int index, ::int32_t value) {
+  _internal_mutable_foo4()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType1.foo4)
+}
+inline void ComplexOptionType1::add_foo4(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_foo4()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.ComplexOptionType1.foo4)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& ComplexOptionType1::foo4() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.ComplexOptionType1.foo4)
+  return _internal_foo4();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* ComplexOptionType1::mutable_foo4()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.ComplexOptionType1.foo4)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_foo4();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& ComplexOptionType1::_internal_foo4()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.foo4_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* ComplexOptionType1::_internal_mutable_foo4() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.foo4_;
+}
+
+// -------------------------------------------------------------------
+
+// ComplexOptionType2_ComplexOptionType4
+
+// optional int32 waldo = 1;
+inline bool ComplexOptionType2_ComplexOptionType4::has_waldo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void ComplexOptionType2_ComplexOptionType4::clear_waldo() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.waldo_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t ComplexOptionType2_ComplexOptionType4::waldo() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType2.ComplexOptionType4.waldo)
+  return _internal_waldo();
+}
+inline void ComplexOptionType2_ComplexOptionType4::set_waldo(::int32_t value) {
+  _internal_set_waldo(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType2.ComplexOptionType4.waldo)
+}
+inline ::int32_t ComplexOptionType2_ComplexOptionType4::_internal_waldo() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.waldo_;
+}
+inline void ComplexOptionType2_ComplexOptionType4::_internal_set_waldo(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.waldo_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ComplexOptionType2
+
+// optional .protobuf_unittest.ComplexOptionType1 bar = 1;
+inline bool ComplexOptionType2::has_bar() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.bar_ != nullptr);
+  return value;
+}
+inline void ComplexOptionType2::clear_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.bar_ != nullptr) _impl_.bar_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::ComplexOptionType1& ComplexOptionType2::_internal_bar() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::ComplexOptionType1* p = _impl_.bar_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::ComplexOptionType1&>(::protobuf_unittest::_ComplexOptionType1_default_instance_);
+}
+inline const ::protobuf_unittest::ComplexOptionType1& ComplexOptionType2::bar() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType2.bar)
+  return _internal_bar();
+}
+inline void ComplexOptionType2::unsafe_arena_set_allocated_bar(::protobuf_unittest::ComplexOptionType1* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bar_);
+  }
+  _impl_.bar_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType1*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.ComplexOptionType2.bar)
+}
+inline ::protobuf_unittest::ComplexOptionType1* ComplexOptionType2::release_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::ComplexOptionType1* released = _impl_.bar_;
+  _impl_.bar_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::ComplexOptionType1* ComplexOptionType2::unsafe_arena_release_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.ComplexOptionType2.bar)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::ComplexOptionType1* temp = _impl_.bar_;
+  _impl_.bar_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::ComplexOptionType1* ComplexOptionType2::_internal_mutable_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.bar_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::ComplexOptionType1>(GetArena());
+    _impl_.bar_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType1*>(p);
+  }
+  return _impl_.bar_;
+}
+inline ::protobuf_unittest::ComplexOptionType1* ComplexOptionType2::mutable_bar() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::ComplexOptionType1* _msg = _internal_mutable_bar();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.ComplexOptionType2.bar)
+  return _msg;
+}
+inline void ComplexOptionType2::set_allocated_bar(::protobuf_unittest::ComplexOptionType1* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::ComplexOptionType1*>(_impl_.bar_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::ComplexOptionType1*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.bar_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType1*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.ComplexOptionType2.bar)
+}
+
+// optional int32 baz = 2;
+inline bool ComplexOptionType2::has_baz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline void ComplexOptionType2::clear_baz() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.baz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::int32_t ComplexOptionType2::baz() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType2.baz)
+  return _internal_baz();
+}
+inline void ComplexOptionType2::set_baz(::int32_t value) {
+  _internal_set_baz(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType2.baz)
+}
+inline ::int32_t ComplexOptionType2::_internal_baz() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.baz_;
+}
+inline void ComplexOptionType2::_internal_set_baz(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.baz_ = value;
+}
+
+// optional .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 fred = 3;
+inline bool ComplexOptionType2::has_fred() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.fred_ != nullptr);
+  return value;
+}
+inline void ComplexOptionType2::clear_fred() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.fred_ != nullptr) _impl_.fred_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& ComplexOptionType2::_internal_fred() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* p = _impl_.fred_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4&>(::protobuf_unittest::_ComplexOptionType2_ComplexOptionType4_default_instance_);
+}
+inline const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& ComplexOptionType2::fred() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType2.fred)
+  return _internal_fred();
+}
+inline void ComplexOptionType2::unsafe_arena_set_allocated_fred(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.fred_);
+  }
+  _impl_.fred_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.ComplexOptionType2.fred)
+}
+inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::release_fred() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* released = _impl_.fred_;
+  _impl_.fred_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::unsafe_arena_release_fred() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.ComplexOptionType2.fred)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* temp = _impl_.fred_;
+  _impl_.fred_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::_internal_mutable_fred() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.fred_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>(GetArena());
+    _impl_.fred_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(p);
+  }
+  return _impl_.fred_;
+}
+inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::mutable_fred() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* _msg = _internal_mutable_fred();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.ComplexOptionType2.fred)
+  return _msg;
+}
+inline void ComplexOptionType2::set_allocated_fred(::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(_impl_.fred_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.fred_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.ComplexOptionType2.fred)
+}
+
+// repeated .protobuf_unittest.ComplexOptionType2.ComplexOptionType4 barney = 4;
+inline int ComplexOptionType2::_internal_barney_size() const {
+  return _internal_barney().size();
+}
+inline int ComplexOptionType2::barney_size() const {
+  return _internal_barney_size();
+}
+inline void ComplexOptionType2::clear_barney() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.barney_.Clear();
+}
+inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::mutable_barney(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.ComplexOptionType2.barney)
+  return _internal_mutable_barney()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>* ComplexOptionType2::mutable_barney()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.ComplexOptionType2.barney)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_barney();
+}
+inline const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& ComplexOptionType2::barney(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType2.barney)
+  return _internal_barney().Get(index);
+}
+inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::add_barney() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* _add = _internal_mutable_barney()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.ComplexOptionType2.barney)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>& ComplexOptionType2::barney() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.ComplexOptionType2.barney)
+  return _internal_barney();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>&
+ComplexOptionType2::_internal_barney() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.barney_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ComplexOptionType2_ComplexOptionType4>*
+ComplexOptionType2::_internal_mutable_barney() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.barney_;
+}
+
+// -------------------------------------------------------------------
+
+// ComplexOptionType3_ComplexOptionType5
+
+// optional int32 plugh = 3;
+inline bool ComplexOptionType3_ComplexOptionType5::has_plugh() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void ComplexOptionType3_ComplexOptionType5::clear_plugh() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.plugh_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t ComplexOptionType3_ComplexOptionType5::plugh() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType3.ComplexOptionType5.plugh)
+  return _internal_plugh();
+}
+inline void ComplexOptionType3_ComplexOptionType5::set_plugh(::int32_t value) {
+  _internal_set_plugh(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType3.ComplexOptionType5.plugh)
+}
+inline ::int32_t ComplexOptionType3_ComplexOptionType5::_internal_plugh() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.plugh_;
+}
+inline void ComplexOptionType3_ComplexOptionType5::_internal_set_plugh(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.plugh_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ComplexOptionType3
+
+// optional int32 moo = 1;
+inline bool ComplexOptionType3::has_moo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void ComplexOptionType3::clear_moo() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.moo_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::int32_t ComplexOptionType3::moo() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType3.moo)
+  return _internal_moo();
+}
+inline void ComplexOptionType3::set_moo(::int32_t value) {
+  _internal_set_moo(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOptionType3.moo)
+}
+inline ::int32_t ComplexOptionType3::_internal_moo() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.moo_;
+}
+inline void ComplexOptionType3::_internal_set_moo(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.moo_ = value;
+}
+
+// optional group ComplexOptionType5 = 2 { ... };
+inline bool ComplexOptionType3::has_complexoptiontype5() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.complexoptiontype5_ != nullptr);
+  return value;
+}
+inline void ComplexOptionType3::clear_complexoptiontype5() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.complexoptiontype5_ != nullptr) _impl_.complexoptiontype5_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& ComplexOptionType3::_internal_complexoptiontype5() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* p = _impl_.complexoptiontype5_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5&>(::protobuf_unittest::_ComplexOptionType3_ComplexOptionType5_default_instance_);
+}
+inline const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& ComplexOptionType3::complexoptiontype5() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOptionType3.complexoptiontype5)
+  return _internal_complexoptiontype5();
+}
+inline void ComplexOptionType3::unsafe_arena_set_allocated_complexoptiontype5(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.complexoptiontype5_);
+  }
+  _impl_.complexoptiontype5_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.ComplexOptionType3.complexoptiontype5)
+}
+inline ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* ComplexOptionType3::release_complexoptiontype5() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* released = _impl_.complexoptiontype5_;
+  _impl_.complexoptiontype5_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* ComplexOptionType3::unsafe_arena_release_complexoptiontype5() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.ComplexOptionType3.complexoptiontype5)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* temp = _impl_.complexoptiontype5_;
+  _impl_.complexoptiontype5_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* ComplexOptionType3::_internal_mutable_complexoptiontype5() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.complexoptiontype5_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5>(GetArena());
+    _impl_.complexoptiontype5_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(p);
+  }
+  return _impl_.complexoptiontype5_;
+}
+inline ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* ComplexOptionType3::mutable_complexoptiontype5() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* _msg = _internal_mutable_complexoptiontype5();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.ComplexOptionType3.complexoptiontype5)
+  return _msg;
+}
+inline void ComplexOptionType3::set_allocated_complexoptiontype5(::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(_impl_.complexoptiontype5_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.complexoptiontype5_ = reinterpret_cast<::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.ComplexOptionType3.complexoptiontype5)
+}
+
+// -------------------------------------------------------------------
+
+// ComplexOpt6
+
+// optional int32 xyzzy = 7593951;
+inline bool ComplexOpt6::has_xyzzy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void ComplexOpt6::clear_xyzzy() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.xyzzy_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t ComplexOpt6::xyzzy() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ComplexOpt6.xyzzy)
+  return _internal_xyzzy();
+}
+inline void ComplexOpt6::set_xyzzy(::int32_t value) {
+  _internal_set_xyzzy(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ComplexOpt6.xyzzy)
+}
+inline ::int32_t ComplexOpt6::_internal_xyzzy() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.xyzzy_;
+}
+inline void ComplexOpt6::_internal_set_xyzzy(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.xyzzy_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// VariousComplexOptions
+
+// -------------------------------------------------------------------
+
+// AggregateMessageSet
+
+// -------------------------------------------------------------------
+
+// AggregateMessageSetElement
+
+// optional string s = 1;
+inline bool AggregateMessageSetElement::has_s() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void AggregateMessageSetElement::clear_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.s_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AggregateMessageSetElement::s() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.AggregateMessageSetElement.s)
+  return _internal_s();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void AggregateMessageSetElement::set_s(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.s_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.AggregateMessageSetElement.s)
+}
+inline std::string* AggregateMessageSetElement::mutable_s() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_s();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.AggregateMessageSetElement.s)
+  return _s;
+}
+inline const std::string& AggregateMessageSetElement::_internal_s() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.s_.Get();
+}
+inline void AggregateMessageSetElement::_internal_set_s(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.s_.Set(value, GetArena());
+}
+inline std::string* AggregateMessageSetElement::_internal_mutable_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.s_.Mutable( GetArena());
+}
+inline std::string* AggregateMessageSetElement::release_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.AggregateMessageSetElement.s)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.s_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.s_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void AggregateMessageSetElement::set_allocated_s(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.s_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.s_.IsDefault()) {
+          _impl_.s_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.AggregateMessageSetElement.s)
+}
+
+// -------------------------------------------------------------------
+
+// Aggregate
+
+// optional int32 i = 1;
+inline bool Aggregate::has_i() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline void Aggregate::clear_i() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.i_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::int32_t Aggregate::i() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.Aggregate.i)
+  return _internal_i();
+}
+inline void Aggregate::set_i(::int32_t value) {
+  _internal_set_i(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.Aggregate.i)
+}
+inline ::int32_t Aggregate::_internal_i() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.i_;
+}
+inline void Aggregate::_internal_set_i(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.i_ = value;
+}
+
+// optional string s = 2;
+inline bool Aggregate::has_s() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void Aggregate::clear_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.s_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Aggregate::s() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.Aggregate.s)
+  return _internal_s();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void Aggregate::set_s(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.s_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.Aggregate.s)
+}
+inline std::string* Aggregate::mutable_s() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_s();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.Aggregate.s)
+  return _s;
+}
+inline const std::string& Aggregate::_internal_s() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.s_.Get();
+}
+inline void Aggregate::_internal_set_s(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.s_.Set(value, GetArena());
+}
+inline std::string* Aggregate::_internal_mutable_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.s_.Mutable( GetArena());
+}
+inline std::string* Aggregate::release_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.Aggregate.s)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.s_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.s_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void Aggregate::set_allocated_s(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.s_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.s_.IsDefault()) {
+          _impl_.s_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.Aggregate.s)
+}
+
+// optional .protobuf_unittest.Aggregate sub = 3;
+inline bool Aggregate::has_sub() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sub_ != nullptr);
+  return value;
+}
+inline void Aggregate::clear_sub() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.sub_ != nullptr) _impl_.sub_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::protobuf_unittest::Aggregate& Aggregate::_internal_sub() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::Aggregate* p = _impl_.sub_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::Aggregate&>(::protobuf_unittest::_Aggregate_default_instance_);
+}
+inline const ::protobuf_unittest::Aggregate& Aggregate::sub() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.Aggregate.sub)
+  return _internal_sub();
+}
+inline void Aggregate::unsafe_arena_set_allocated_sub(::protobuf_unittest::Aggregate* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.sub_);
+  }
+  _impl_.sub_ = reinterpret_cast<::protobuf_unittest::Aggregate*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.Aggregate.sub)
+}
+inline ::protobuf_unittest::Aggregate* Aggregate::release_sub() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::Aggregate* released = _impl_.sub_;
+  _impl_.sub_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::Aggregate* Aggregate::unsafe_arena_release_sub() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.Aggregate.sub)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::Aggregate* temp = _impl_.sub_;
+  _impl_.sub_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::Aggregate* Aggregate::_internal_mutable_sub() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.sub_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::Aggregate>(GetArena());
+    _impl_.sub_ = reinterpret_cast<::protobuf_unittest::Aggregate*>(p);
+  }
+  return _impl_.sub_;
+}
+inline ::protobuf_unittest::Aggregate* Aggregate::mutable_sub() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::Aggregate* _msg = _internal_mutable_sub();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.Aggregate.sub)
+  return _msg;
+}
+inline void Aggregate::set_allocated_sub(::protobuf_unittest::Aggregate* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::Aggregate*>(_impl_.sub_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::Aggregate*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.sub_ = reinterpret_cast<::protobuf_unittest::Aggregate*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.Aggregate.sub)
+}
+
+// optional .google.protobuf.FileOptions file = 4;
+inline bool Aggregate::has_file() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.file_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::FileOptions& Aggregate::_internal_file() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::FileOptions* p = _impl_.file_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::FileOptions&>(::google::protobuf::_FileOptions_default_instance_);
+}
+inline const ::google::protobuf::FileOptions& Aggregate::file() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.Aggregate.file)
+  return _internal_file();
+}
+inline void Aggregate::unsafe_arena_set_allocated_file(::google::protobuf::FileOptions* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.file_);
+  }
+  _impl_.file_ = reinterpret_cast<::google::protobuf::FileOptions*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.Aggregate.file)
+}
+inline ::google::protobuf::FileOptions* Aggregate::release_file() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::google::protobuf::FileOptions* released = _impl_.file_;
+  _impl_.file_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::FileOptions* Aggregate::unsafe_arena_release_file() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.Aggregate.file)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::google::protobuf::FileOptions* temp = _impl_.file_;
+  _impl_.file_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::FileOptions* Aggregate::_internal_mutable_file() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.file_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::FileOptions>(GetArena());
+    _impl_.file_ = reinterpret_cast<::google::protobuf::FileOptions*>(p);
+  }
+  return _impl_.file_;
+}
+inline ::google::protobuf::FileOptions* Aggregate::mutable_file() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FileOptions* _msg = _internal_mutable_file();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.Aggregate.file)
+  return _msg;
+}
+inline void Aggregate::set_allocated_file(::google::protobuf::FileOptions* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.file_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.file_ = reinterpret_cast<::google::protobuf::FileOptions*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.Aggregate.file)
+}
+
+// optional .protobuf_unittest.AggregateMessageSet mset = 5;
+inline bool Aggregate::has_mset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mset_ != nullptr);
+  return value;
+}
+inline void Aggregate::clear_mset() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.mset_ != nullptr) _impl_.mset_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::protobuf_unittest::AggregateMessageSet& Aggregate::_internal_mset() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::AggregateMessageSet* p = _impl_.mset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::AggregateMessageSet&>(::protobuf_unittest::_AggregateMessageSet_default_instance_);
+}
+inline const ::protobuf_unittest::AggregateMessageSet& Aggregate::mset() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.Aggregate.mset)
+  return _internal_mset();
+}
+inline void Aggregate::unsafe_arena_set_allocated_mset(::protobuf_unittest::AggregateMessageSet* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.mset_);
+  }
+  _impl_.mset_ = reinterpret_cast<::protobuf_unittest::AggregateMessageSet*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.Aggregate.mset)
+}
+inline ::protobuf_unittest::AggregateMessageSet* Aggregate::release_mset() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::protobuf_unittest::AggregateMessageSet* released = _impl_.mset_;
+  _impl_.mset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::AggregateMessageSet* Aggregate::unsafe_arena_release_mset() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.Aggregate.mset)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::protobuf_unittest::AggregateMessageSet* temp = _impl_.mset_;
+  _impl_.mset_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::AggregateMessageSet* Aggregate::_internal_mutable_mset() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.mset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::AggregateMessageSet>(GetArena());
+    _impl_.mset_ = reinterpret_cast<::protobuf_unittest::AggregateMessageSet*>(p);
+  }
+  return _impl_.mset_;
+}
+inline ::protobuf_unittest::AggregateMessageSet* Aggregate::mutable_mset() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::AggregateMessageSet* _msg = _internal_mutable_mset();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.Aggregate.mset)
+  return _msg;
+}
+inline void Aggregate::set_allocated_mset(::protobuf_unittest::AggregateMessageSet* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::AggregateMessageSet*>(_impl_.mset_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::AggregateMessageSet*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.mset_ = reinterpret_cast<::protobuf_unittest::AggregateMessageSet*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.Aggregate.mset)
+}
+
+// optional .google.protobuf.Any any = 6;
+inline bool Aggregate::has_any() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.any_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Any& Aggregate::_internal_any() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Any* p = _impl_.any_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Any&>(::google::protobuf::_Any_default_instance_);
+}
+inline const ::google::protobuf::Any& Aggregate::any() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.Aggregate.any)
+  return _internal_any();
+}
+inline void Aggregate::unsafe_arena_set_allocated_any(::google::protobuf::Any* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.any_);
+  }
+  _impl_.any_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.Aggregate.any)
+}
+inline ::google::protobuf::Any* Aggregate::release_any() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::google::protobuf::Any* released = _impl_.any_;
+  _impl_.any_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Any* Aggregate::unsafe_arena_release_any() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.Aggregate.any)
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::google::protobuf::Any* temp = _impl_.any_;
+  _impl_.any_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Any* Aggregate::_internal_mutable_any() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Any>(GetArena());
+    _impl_.any_ = reinterpret_cast<::google::protobuf::Any*>(p);
+  }
+  return _impl_.any_;
+}
+inline ::google::protobuf::Any* Aggregate::mutable_any() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Any* _msg = _internal_mutable_any();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.Aggregate.any)
+  return _msg;
+}
+inline void Aggregate::set_allocated_any(::google::protobuf::Any* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.any_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+
+  _impl_.any_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.Aggregate.any)
+}
+
+// -------------------------------------------------------------------
+
+// AggregateMessage
+
+// optional int32 fieldname = 1 [(.protobuf_unittest.fieldopt) = {
+inline bool AggregateMessage::has_fieldname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void AggregateMessage::clear_fieldname() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.fieldname_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t AggregateMessage::fieldname() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.AggregateMessage.fieldname)
+  return _internal_fieldname();
+}
+inline void AggregateMessage::set_fieldname(::int32_t value) {
+  _internal_set_fieldname(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.AggregateMessage.fieldname)
+}
+inline ::int32_t AggregateMessage::_internal_fieldname() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.fieldname_;
+}
+inline void AggregateMessage::_internal_set_fieldname(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.fieldname_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// NestedOptionType_NestedMessage
+
+// optional int32 nested_field = 1 [(.protobuf_unittest.field_opt1) = 1002];
+inline bool NestedOptionType_NestedMessage::has_nested_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void NestedOptionType_NestedMessage::clear_nested_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.nested_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t NestedOptionType_NestedMessage::nested_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.NestedOptionType.NestedMessage.nested_field)
+  return _internal_nested_field();
+}
+inline void NestedOptionType_NestedMessage::set_nested_field(::int32_t value) {
+  _internal_set_nested_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.NestedOptionType.NestedMessage.nested_field)
+}
+inline ::int32_t NestedOptionType_NestedMessage::_internal_nested_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.nested_field_;
+}
+inline void NestedOptionType_NestedMessage::_internal_set_nested_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.nested_field_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// NestedOptionType
+
+// -------------------------------------------------------------------
+
+// OldOptionType
+
+// required .protobuf_unittest.OldOptionType.TestEnum value = 1;
+inline bool OldOptionType::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void OldOptionType::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::protobuf_unittest::OldOptionType_TestEnum OldOptionType::value() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OldOptionType.value)
+  return _internal_value();
+}
+inline void OldOptionType::set_value(::protobuf_unittest::OldOptionType_TestEnum value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.OldOptionType.value)
+}
+inline ::protobuf_unittest::OldOptionType_TestEnum OldOptionType::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::OldOptionType_TestEnum>(_impl_.value_);
+}
+inline void OldOptionType::_internal_set_value(::protobuf_unittest::OldOptionType_TestEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::OldOptionType_TestEnum_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// NewOptionType
+
+// required .protobuf_unittest.NewOptionType.TestEnum value = 1;
+inline bool NewOptionType::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void NewOptionType::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::protobuf_unittest::NewOptionType_TestEnum NewOptionType::value() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.NewOptionType.value)
+  return _internal_value();
+}
+inline void NewOptionType::set_value(::protobuf_unittest::NewOptionType_TestEnum value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.NewOptionType.value)
+}
+inline ::protobuf_unittest::NewOptionType_TestEnum NewOptionType::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::NewOptionType_TestEnum>(_impl_.value_);
+}
+inline void NewOptionType::_internal_set_value(::protobuf_unittest::NewOptionType_TestEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::NewOptionType_TestEnum_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestMessageWithRequiredEnumOption
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::protobuf_unittest::TestMessageWithCustomOptions_AnEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::TestMessageWithCustomOptions_AnEnum>() {
+  return ::protobuf_unittest::TestMessageWithCustomOptions_AnEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::DummyMessageContainingEnum_TestEnumType> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::DummyMessageContainingEnum_TestEnumType>() {
+  return ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::NestedOptionType_NestedEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::NestedOptionType_NestedEnum>() {
+  return ::protobuf_unittest::NestedOptionType_NestedEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::OldOptionType_TestEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::OldOptionType_TestEnum>() {
+  return ::protobuf_unittest::OldOptionType_TestEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::NewOptionType_TestEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::NewOptionType_TestEnum>() {
+  return ::protobuf_unittest::NewOptionType_TestEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::MethodOpt1> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::MethodOpt1>() {
+  return ::protobuf_unittest::MethodOpt1_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::AggregateEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::AggregateEnum>() {
+  return ::protobuf_unittest::AggregateEnum_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_2epb_2eh
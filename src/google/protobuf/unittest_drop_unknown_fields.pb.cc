@@ -0,0 +1,647 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_drop_unknown_fields.proto
+
+#include "google/protobuf/unittest_drop_unknown_fields.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace unittest_drop_unknown_fields {
+
+inline constexpr FooWithExtraFields::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : int32_value_{0},
+        enum_value_{static_cast< ::unittest_drop_unknown_fields::FooWithExtraFields_NestedEnum >(0)},
+        extra_int32_value_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR FooWithExtraFields::FooWithExtraFields(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct FooWithExtraFieldsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FooWithExtraFieldsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FooWithExtraFieldsDefaultTypeInternal() {}
+  union {
+    FooWithExtraFields _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FooWithExtraFieldsDefaultTypeInternal _FooWithExtraFields_default_instance_;
+
+inline constexpr Foo::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : int32_value_{0},
+        enum_value_{static_cast< ::unittest_drop_unknown_fields::Foo_NestedEnum >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR Foo::Foo(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct FooDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FooDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FooDefaultTypeInternal() {}
+  union {
+    Foo _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FooDefaultTypeInternal _Foo_default_instance_;
+}  // namespace unittest_drop_unknown_fields
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::Foo, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::Foo, _impl_.int32_value_),
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::Foo, _impl_.enum_value_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::FooWithExtraFields, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::FooWithExtraFields, _impl_.int32_value_),
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::FooWithExtraFields, _impl_.enum_value_),
+    PROTOBUF_FIELD_OFFSET(::unittest_drop_unknown_fields::FooWithExtraFields, _impl_.extra_int32_value_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, -1, -1, sizeof(::unittest_drop_unknown_fields::Foo)},
+        {10, -1, -1, sizeof(::unittest_drop_unknown_fields::FooWithExtraFields)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::unittest_drop_unknown_fields::_Foo_default_instance_._instance,
+    &::unittest_drop_unknown_fields::_FooWithExtraFields_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n2google/protobuf/unittest_drop_unknown_"
+    "fields.proto\022\034unittest_drop_unknown_fiel"
+    "ds\"\205\001\n\003Foo\022\023\n\013int32_value\030\001 \001(\005\022@\n\nenum_"
+    "value\030\002 \001(\0162,.unittest_drop_unknown_fiel"
+    "ds.Foo.NestedEnum\"\'\n\nNestedEnum\022\007\n\003FOO\020\000"
+    "\022\007\n\003BAR\020\001\022\007\n\003BAZ\020\002\"\307\001\n\022FooWithExtraField"
+    "s\022\023\n\013int32_value\030\001 \001(\005\022O\n\nenum_value\030\002 \001"
+    "(\0162;.unittest_drop_unknown_fields.FooWit"
+    "hExtraFields.NestedEnum\022\031\n\021extra_int32_v"
+    "alue\030\003 \001(\005\"0\n\nNestedEnum\022\007\n\003FOO\020\000\022\007\n\003BAR"
+    "\020\001\022\007\n\003BAZ\020\002\022\007\n\003MOO\020\003B1\242\002\014DropUnknowns\252\002\032"
+    "Google.Protobuf.TestProtos\222\003\002\010\002b\010edition"
+    "sp\350\007"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto = {
+    false,
+    false,
+    484,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto,
+    "google/protobuf/unittest_drop_unknown_fields.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_once,
+    nullptr,
+    0,
+    2,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto);
+namespace unittest_drop_unknown_fields {
+const ::google::protobuf::EnumDescriptor* Foo_NestedEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t Foo_NestedEnum_internal_data_[] = {
+    196608u, 0u, };
+bool Foo_NestedEnum_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr Foo_NestedEnum Foo::FOO;
+constexpr Foo_NestedEnum Foo::BAR;
+constexpr Foo_NestedEnum Foo::BAZ;
+constexpr Foo_NestedEnum Foo::NestedEnum_MIN;
+constexpr Foo_NestedEnum Foo::NestedEnum_MAX;
+constexpr int Foo::NestedEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* FooWithExtraFields_NestedEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t FooWithExtraFields_NestedEnum_internal_data_[] = {
+    262144u, 0u, };
+bool FooWithExtraFields_NestedEnum_IsValid(int value) {
+  return 0 <= value && value <= 3;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr FooWithExtraFields_NestedEnum FooWithExtraFields::FOO;
+constexpr FooWithExtraFields_NestedEnum FooWithExtraFields::BAR;
+constexpr FooWithExtraFields_NestedEnum FooWithExtraFields::BAZ;
+constexpr FooWithExtraFields_NestedEnum FooWithExtraFields::MOO;
+constexpr FooWithExtraFields_NestedEnum FooWithExtraFields::NestedEnum_MIN;
+constexpr FooWithExtraFields_NestedEnum FooWithExtraFields::NestedEnum_MAX;
+constexpr int FooWithExtraFields::NestedEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+// ===================================================================
+
+class Foo::_Internal {
+ public:
+};
+
+Foo::Foo(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:unittest_drop_unknown_fields.Foo)
+}
+Foo::Foo(
+    ::google::protobuf::Arena* arena, const Foo& from)
+    : Foo(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE Foo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void Foo::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, int32_value_),
+           0,
+           offsetof(Impl_, enum_value_) -
+               offsetof(Impl_, int32_value_) +
+               sizeof(Impl_::enum_value_));
+}
+Foo::~Foo() {
+  // @@protoc_insertion_point(destructor:unittest_drop_unknown_fields.Foo)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Foo::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Foo::Clear() {
+// @@protoc_insertion_point(message_clear_start:unittest_drop_unknown_fields.Foo)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.int32_value_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.enum_value_) -
+      reinterpret_cast<char*>(&_impl_.int32_value_)) + sizeof(_impl_.enum_value_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Foo::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> Foo::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_Foo_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .unittest_drop_unknown_fields.Foo.NestedEnum enum_value = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Foo, _impl_.enum_value_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(Foo, _impl_.enum_value_)}},
+    // int32 int32_value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Foo, _impl_.int32_value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(Foo, _impl_.int32_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 int32_value = 1;
+    {PROTOBUF_FIELD_OFFSET(Foo, _impl_.int32_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // .unittest_drop_unknown_fields.Foo.NestedEnum enum_value = 2;
+    {PROTOBUF_FIELD_OFFSET(Foo, _impl_.enum_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* Foo::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:unittest_drop_unknown_fields.Foo)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 22 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[22];
+  ::uint8_t* ptr = buffer;
+  // int32 int32_value = 1;
+  if (this->_internal_int32_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_int32_value(), ptr);
+  }
+
+  // .unittest_drop_unknown_fields.Foo.NestedEnum enum_value = 2;
+  if (this->_internal_enum_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, this->_internal_enum_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:unittest_drop_unknown_fields.Foo)
+  return target;
+}
+
+::size_t Foo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:unittest_drop_unknown_fields.Foo)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 int32_value = 1;
+  if (this->_internal_int32_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_int32_value());
+  }
+
+  // .unittest_drop_unknown_fields.Foo.NestedEnum enum_value = 2;
+  if (this->_internal_enum_value() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Foo::_class_data_ = {
+    Foo::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Foo::GetClassData() const {
+  return &_class_data_;
+}
+
+void Foo::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Foo*>(&to_msg);
+  auto& from = static_cast<const Foo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:unittest_drop_unknown_fields.Foo)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_int32_value() != 0) {
+    _this->_internal_set_int32_value(from._internal_int32_value());
+  }
+  if (from._internal_enum_value() != 0) {
+    _this->_internal_set_enum_value(from._internal_enum_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Foo::CopyFrom(const Foo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:unittest_drop_unknown_fields.Foo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Foo::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* Foo::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Foo::InternalSwap(Foo* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Foo, _impl_.enum_value_)
+      + sizeof(Foo::_impl_.enum_value_)
+      - PROTOBUF_FIELD_OFFSET(Foo, _impl_.int32_value_)>(
+          reinterpret_cast<char*>(&_impl_.int32_value_),
+          reinterpret_cast<char*>(&other->_impl_.int32_value_));
+}
+
+::google::protobuf::Metadata Foo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[0]);
+}
+// ===================================================================
+
+class FooWithExtraFields::_Internal {
+ public:
+};
+
+FooWithExtraFields::FooWithExtraFields(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:unittest_drop_unknown_fields.FooWithExtraFields)
+}
+FooWithExtraFields::FooWithExtraFields(
+    ::google::protobuf::Arena* arena, const FooWithExtraFields& from)
+    : FooWithExtraFields(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE FooWithExtraFields::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void FooWithExtraFields::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, int32_value_),
+           0,
+           offsetof(Impl_, extra_int32_value_) -
+               offsetof(Impl_, int32_value_) +
+               sizeof(Impl_::extra_int32_value_));
+}
+FooWithExtraFields::~FooWithExtraFields() {
+  // @@protoc_insertion_point(destructor:unittest_drop_unknown_fields.FooWithExtraFields)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void FooWithExtraFields::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void FooWithExtraFields::Clear() {
+// @@protoc_insertion_point(message_clear_start:unittest_drop_unknown_fields.FooWithExtraFields)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.int32_value_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.extra_int32_value_) -
+      reinterpret_cast<char*>(&_impl_.int32_value_)) + sizeof(_impl_.extra_int32_value_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* FooWithExtraFields::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2> FooWithExtraFields::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_FooWithExtraFields_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int32 int32_value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FooWithExtraFields, _impl_.int32_value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.int32_value_)}},
+    // .unittest_drop_unknown_fields.FooWithExtraFields.NestedEnum enum_value = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FooWithExtraFields, _impl_.enum_value_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.enum_value_)}},
+    // int32 extra_int32_value = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FooWithExtraFields, _impl_.extra_int32_value_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.extra_int32_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 int32_value = 1;
+    {PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.int32_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // .unittest_drop_unknown_fields.FooWithExtraFields.NestedEnum enum_value = 2;
+    {PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.enum_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // int32 extra_int32_value = 3;
+    {PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.extra_int32_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* FooWithExtraFields::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:unittest_drop_unknown_fields.FooWithExtraFields)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 33 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[33];
+  ::uint8_t* ptr = buffer;
+  // int32 int32_value = 1;
+  if (this->_internal_int32_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_int32_value(), ptr);
+  }
+
+  // .unittest_drop_unknown_fields.FooWithExtraFields.NestedEnum enum_value = 2;
+  if (this->_internal_enum_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, this->_internal_enum_value(), ptr);
+  }
+
+  // int32 extra_int32_value = 3;
+  if (this->_internal_extra_int32_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        3, this->_internal_extra_int32_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:unittest_drop_unknown_fields.FooWithExtraFields)
+  return target;
+}
+
+::size_t FooWithExtraFields::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:unittest_drop_unknown_fields.FooWithExtraFields)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 int32_value = 1;
+  if (this->_internal_int32_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_int32_value());
+  }
+
+  // .unittest_drop_unknown_fields.FooWithExtraFields.NestedEnum enum_value = 2;
+  if (this->_internal_enum_value() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value());
+  }
+
+  // int32 extra_int32_value = 3;
+  if (this->_internal_extra_int32_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_extra_int32_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData FooWithExtraFields::_class_data_ = {
+    FooWithExtraFields::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* FooWithExtraFields::GetClassData() const {
+  return &_class_data_;
+}
+
+void FooWithExtraFields::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<FooWithExtraFields*>(&to_msg);
+  auto& from = static_cast<const FooWithExtraFields&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:unittest_drop_unknown_fields.FooWithExtraFields)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_int32_value() != 0) {
+    _this->_internal_set_int32_value(from._internal_int32_value());
+  }
+  if (from._internal_enum_value() != 0) {
+    _this->_internal_set_enum_value(from._internal_enum_value());
+  }
+  if (from._internal_extra_int32_value() != 0) {
+    _this->_internal_set_extra_int32_value(from._internal_extra_int32_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FooWithExtraFields::CopyFrom(const FooWithExtraFields& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:unittest_drop_unknown_fields.FooWithExtraFields)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool FooWithExtraFields::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* FooWithExtraFields::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void FooWithExtraFields::InternalSwap(FooWithExtraFields* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.extra_int32_value_)
+      + sizeof(FooWithExtraFields::_impl_.extra_int32_value_)
+      - PROTOBUF_FIELD_OFFSET(FooWithExtraFields, _impl_.int32_value_)>(
+          reinterpret_cast<char*>(&_impl_.int32_value_),
+          reinterpret_cast<char*>(&other->_impl_.int32_value_));
+}
+
+::google::protobuf::Metadata FooWithExtraFields::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fdrop_5funknown_5ffields_2eproto[1]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace unittest_drop_unknown_fields
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,441 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_embed_optimize_for.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/unittest_optimize_for.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto;
+namespace protobuf_unittest {
+class TestEmbedOptimizedForSize;
+struct TestEmbedOptimizedForSizeDefaultTypeInternal;
+extern TestEmbedOptimizedForSizeDefaultTypeInternal _TestEmbedOptimizedForSize_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestEmbedOptimizedForSize final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEmbedOptimizedForSize) */ {
+ public:
+  inline TestEmbedOptimizedForSize() : TestEmbedOptimizedForSize(nullptr) {}
+  ~TestEmbedOptimizedForSize() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEmbedOptimizedForSize(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEmbedOptimizedForSize(const TestEmbedOptimizedForSize& from)
+      : TestEmbedOptimizedForSize(nullptr, from) {}
+  TestEmbedOptimizedForSize(TestEmbedOptimizedForSize&& from) noexcept
+    : TestEmbedOptimizedForSize() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEmbedOptimizedForSize& operator=(const TestEmbedOptimizedForSize& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEmbedOptimizedForSize& operator=(TestEmbedOptimizedForSize&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestEmbedOptimizedForSize& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEmbedOptimizedForSize* internal_default_instance() {
+    return reinterpret_cast<const TestEmbedOptimizedForSize*>(
+               &_TestEmbedOptimizedForSize_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestEmbedOptimizedForSize& a, TestEmbedOptimizedForSize& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEmbedOptimizedForSize* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEmbedOptimizedForSize* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEmbedOptimizedForSize* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEmbedOptimizedForSize>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestEmbedOptimizedForSize& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestEmbedOptimizedForSize& from) {
+    TestEmbedOptimizedForSize::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEmbedOptimizedForSize* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestEmbedOptimizedForSize";
+  }
+  protected:
+  explicit TestEmbedOptimizedForSize(::google::protobuf::Arena* arena);
+  TestEmbedOptimizedForSize(::google::protobuf::Arena* arena, const TestEmbedOptimizedForSize& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedMessageFieldNumber = 2,
+    kOptionalMessageFieldNumber = 1,
+  };
+  // repeated .protobuf_unittest.TestOptimizedForSize repeated_message = 2;
+  int repeated_message_size() const;
+  private:
+  int _internal_repeated_message_size() const;
+
+  public:
+  void clear_repeated_message() ;
+  ::protobuf_unittest::TestOptimizedForSize* mutable_repeated_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestOptimizedForSize >*
+      mutable_repeated_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestOptimizedForSize>& _internal_repeated_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestOptimizedForSize>* _internal_mutable_repeated_message();
+  public:
+  const ::protobuf_unittest::TestOptimizedForSize& repeated_message(int index) const;
+  ::protobuf_unittest::TestOptimizedForSize* add_repeated_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestOptimizedForSize >&
+      repeated_message() const;
+  // optional .protobuf_unittest.TestOptimizedForSize optional_message = 1;
+  bool has_optional_message() const;
+  void clear_optional_message() ;
+  const ::protobuf_unittest::TestOptimizedForSize& optional_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestOptimizedForSize* release_optional_message();
+  ::protobuf_unittest::TestOptimizedForSize* mutable_optional_message();
+  void set_allocated_optional_message(::protobuf_unittest::TestOptimizedForSize* value);
+  void unsafe_arena_set_allocated_optional_message(::protobuf_unittest::TestOptimizedForSize* value);
+  ::protobuf_unittest::TestOptimizedForSize* unsafe_arena_release_optional_message();
+
+  private:
+  const ::protobuf_unittest::TestOptimizedForSize& _internal_optional_message() const;
+  ::protobuf_unittest::TestOptimizedForSize* _internal_mutable_optional_message();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEmbedOptimizedForSize)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestOptimizedForSize > repeated_message_;
+    ::protobuf_unittest::TestOptimizedForSize* optional_message_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestEmbedOptimizedForSize
+
+// optional .protobuf_unittest.TestOptimizedForSize optional_message = 1;
+inline bool TestEmbedOptimizedForSize::has_optional_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest::TestOptimizedForSize& TestEmbedOptimizedForSize::_internal_optional_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestOptimizedForSize* p = _impl_.optional_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestOptimizedForSize&>(::protobuf_unittest::_TestOptimizedForSize_default_instance_);
+}
+inline const ::protobuf_unittest::TestOptimizedForSize& TestEmbedOptimizedForSize::optional_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestEmbedOptimizedForSize.optional_message)
+  return _internal_optional_message();
+}
+inline void TestEmbedOptimizedForSize::unsafe_arena_set_allocated_optional_message(::protobuf_unittest::TestOptimizedForSize* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_message_);
+  }
+  _impl_.optional_message_ = reinterpret_cast<::protobuf_unittest::TestOptimizedForSize*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestEmbedOptimizedForSize.optional_message)
+}
+inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::release_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestOptimizedForSize* released = _impl_.optional_message_;
+  _impl_.optional_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::unsafe_arena_release_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestEmbedOptimizedForSize.optional_message)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestOptimizedForSize* temp = _impl_.optional_message_;
+  _impl_.optional_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::_internal_mutable_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.optional_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestOptimizedForSize>(GetArena());
+    _impl_.optional_message_ = reinterpret_cast<::protobuf_unittest::TestOptimizedForSize*>(p);
+  }
+  return _impl_.optional_message_;
+}
+inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::mutable_optional_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestOptimizedForSize* _msg = _internal_mutable_optional_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestEmbedOptimizedForSize.optional_message)
+  return _msg;
+}
+inline void TestEmbedOptimizedForSize::set_allocated_optional_message(::protobuf_unittest::TestOptimizedForSize* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.optional_message_ = reinterpret_cast<::protobuf_unittest::TestOptimizedForSize*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestEmbedOptimizedForSize.optional_message)
+}
+
+// repeated .protobuf_unittest.TestOptimizedForSize repeated_message = 2;
+inline int TestEmbedOptimizedForSize::_internal_repeated_message_size() const {
+  return _internal_repeated_message().size();
+}
+inline int TestEmbedOptimizedForSize::repeated_message_size() const {
+  return _internal_repeated_message_size();
+}
+inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::mutable_repeated_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestEmbedOptimizedForSize.repeated_message)
+  return _internal_mutable_repeated_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestOptimizedForSize>* TestEmbedOptimizedForSize::mutable_repeated_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestEmbedOptimizedForSize.repeated_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_message();
+}
+inline const ::protobuf_unittest::TestOptimizedForSize& TestEmbedOptimizedForSize::repeated_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestEmbedOptimizedForSize.repeated_message)
+  return _internal_repeated_message().Get(index);
+}
+inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::add_repeated_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestOptimizedForSize* _add = _internal_mutable_repeated_message()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestEmbedOptimizedForSize.repeated_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestOptimizedForSize>& TestEmbedOptimizedForSize::repeated_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestEmbedOptimizedForSize.repeated_message)
+  return _internal_repeated_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestOptimizedForSize>&
+TestEmbedOptimizedForSize::_internal_repeated_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestOptimizedForSize>*
+TestEmbedOptimizedForSize::_internal_mutable_repeated_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_message_;
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_2epb_2eh
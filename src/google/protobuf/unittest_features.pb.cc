@@ -0,0 +1,1346 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_features.proto
+
+#include "google/protobuf/unittest_features.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace pb {
+      template <typename>
+PROTOBUF_CONSTEXPR TestMessage_Nested::TestMessage_Nested(::_pbi::ConstantInitialized) {}
+struct TestMessage_NestedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessage_NestedDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessage_NestedDefaultTypeInternal() {}
+  union {
+    TestMessage_Nested _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessage_NestedDefaultTypeInternal _TestMessage_Nested_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMessage::TestMessage(::_pbi::ConstantInitialized) {}
+struct TestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageDefaultTypeInternal() {}
+  union {
+    TestMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageDefaultTypeInternal _TestMessage_default_instance_;
+
+inline constexpr TestFeatures_MessageFeature::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        string_field_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        bool_field_{false},
+        int_field_{0},
+        float_field_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestFeatures_MessageFeature::TestFeatures_MessageFeature(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestFeatures_MessageFeatureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestFeatures_MessageFeatureDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestFeatures_MessageFeatureDefaultTypeInternal() {}
+  union {
+    TestFeatures_MessageFeature _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestFeatures_MessageFeatureDefaultTypeInternal _TestFeatures_MessageFeature_default_instance_;
+
+inline constexpr TestFeatures::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        string_source_feature_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        message_field_feature_{nullptr},
+        int_file_feature_{0},
+        int_extension_range_feature_{0},
+        int_message_feature_{0},
+        int_field_feature_{0},
+        int_oneof_feature_{0},
+        int_enum_feature_{0},
+        int_enum_entry_feature_{0},
+        int_service_feature_{0},
+        int_method_feature_{0},
+        int_multiple_feature_{0},
+        bool_field_feature_{false},
+        float_field_feature_{0},
+        enum_field_feature_{static_cast< ::pb::TestFeatures_EnumFeature >(0)},
+        int_source_feature_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestFeatures::TestFeatures(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestFeaturesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestFeaturesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestFeaturesDefaultTypeInternal() {}
+  union {
+    TestFeatures _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestFeaturesDefaultTypeInternal _TestFeatures_default_instance_;
+}  // namespace pb
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5ffeatures_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5ffeatures_2eproto[1];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5ffeatures_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5ffeatures_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::pb::TestMessage_Nested, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::pb::TestMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures_MessageFeature, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures_MessageFeature, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures_MessageFeature, _impl_.bool_field_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures_MessageFeature, _impl_.int_field_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures_MessageFeature, _impl_.float_field_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures_MessageFeature, _impl_.string_field_),
+    1,
+    2,
+    3,
+    0,
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_file_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_extension_range_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_message_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_field_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_oneof_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_enum_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_enum_entry_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_service_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_method_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_multiple_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.bool_field_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.float_field_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.message_field_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.enum_field_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.int_source_feature_),
+    PROTOBUF_FIELD_OFFSET(::pb::TestFeatures, _impl_.string_source_feature_),
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    10,
+    11,
+    12,
+    13,
+    1,
+    14,
+    15,
+    0,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, -1, -1, sizeof(::pb::TestMessage_Nested)},
+        {8, -1, -1, sizeof(::pb::TestMessage)},
+        {16, 28, -1, sizeof(::pb::TestFeatures_MessageFeature)},
+        {32, 56, -1, sizeof(::pb::TestFeatures)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::pb::_TestMessage_Nested_default_instance_._instance,
+    &::pb::_TestMessage_default_instance_._instance,
+    &::pb::_TestFeatures_MessageFeature_default_instance_._instance,
+    &::pb::_TestFeatures_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5ffeatures_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n\'google/protobuf/unittest_features.prot"
+    "o\022\002pb\032 google/protobuf/descriptor.proto\""
+    "\242\001\n\013TestMessage\032M\n\006Nested2C\n\013test_nested"
+    "\022\033.google.protobuf.FeatureSet\030\215N \001(\0132\020.p"
+    "b.TestFeatures2D\n\014test_message\022\033.google."
+    "protobuf.FeatureSet\030\216N \001(\0132\020.pb.TestFeat"
+    "ures\"\375\n\n\014TestFeatures\022Q\n\020int_file_featur"
+    "e\030\001 \001(\005B7\210\001\001\230\001\001\242\001\007\022\002-2\030\346\007\242\001\007\022\002-3\030\347\007\242\001\006\022\001"
+    "1\030\350\007\242\001\007\022\0012\030\235\215\006\242\001\007\022\0013\030\236\215\006\0224\n\033int_extensio"
+    "n_range_feature\030\002 \001(\005B\017\210\001\001\230\001\002\242\001\006\022\0011\030\346\007\022,"
+    "\n\023int_message_feature\030\003 \001(\005B\017\210\001\001\230\001\003\242\001\006\022\001"
+    "1\030\346\007\022*\n\021int_field_feature\030\004 \001(\005B\017\210\001\001\230\001\004\242"
+    "\001\006\022\0011\030\346\007\022*\n\021int_oneof_feature\030\005 \001(\005B\017\210\001\001"
+    "\230\001\005\242\001\006\022\0011\030\346\007\022)\n\020int_enum_feature\030\006 \001(\005B\017"
+    "\210\001\001\230\001\006\242\001\006\022\0011\030\346\007\022/\n\026int_enum_entry_featur"
+    "e\030\007 \001(\005B\017\210\001\001\230\001\007\242\001\006\022\0011\030\346\007\022,\n\023int_service_"
+    "feature\030\010 \001(\005B\017\210\001\001\230\001\010\242\001\006\022\0011\030\346\007\022+\n\022int_me"
+    "thod_feature\030\t \001(\005B\017\210\001\001\230\001\t\242\001\006\022\0011\030\346\007\022E\n\024i"
+    "nt_multiple_feature\030\n \001(\005B\'\210\001\001\230\001\001\230\001\004\230\001\003\230"
+    "\001\006\230\001\007\230\001\010\230\001\t\230\001\005\230\001\002\242\001\006\022\0011\030\346\007\022<\n\022bool_field"
+    "_feature\030\013 \001(\010B \210\001\001\230\001\004\242\001\n\022\005false\030\346\007\242\001\n\022\004"
+    "true\030\235\215\006\022:\n\023float_field_feature\030\014 \001(\002B\035\210"
+    "\001\001\230\001\004\242\001\010\022\0031.1\030\346\007\242\001\t\022\0031.2\030\235\215\006\022\314\001\n\025message"
+    "_field_feature\030\r \001(\0132\037.pb.TestFeatures.M"
+    "essageFeatureB\213\001\210\001\001\230\001\004\242\001\022\022\014int_field: 2\030"
+    "\235\215\006\242\001\032\022\024string_field: \'2024\'\030\236\215\006\242\001H\022Cboo"
+    "l_field: true int_field: 1 float_field: "
+    "1.5 string_field: \'2023\'\030\350\007\242\001\005\022\000\030\346\007\022\234\001\n\022"
+    "enum_field_feature\030\016 \001(\0162\034.pb.TestFeatur"
+    "es.EnumFeatureBb\210\001\001\230\001\004\242\001\036\022\031TEST_ENUM_FEA"
+    "TURE_UNKNOWN\030\346\007\242\001\020\022\013ENUM_VALUE1\030\350\007\242\001\021\022\013E"
+    "NUM_VALUE2\030\235\215\006\242\001\021\022\013ENUM_VALUE3\030\236\215\006\022C\n\022in"
+    "t_source_feature\030\017 \001(\005B\'\210\001\002\230\001\001\230\001\004\230\001\003\230\001\006\230"
+    "\001\007\230\001\010\230\001\t\230\001\005\230\001\002\242\001\006\022\0011\030\346\007\022K\n\025string_source"
+    "_feature\030\020 \001(\tB,\210\001\002\230\001\001\230\001\004\230\001\003\230\001\006\230\001\007\230\001\010\230\001\t"
+    "\230\001\005\230\001\002\242\001\013\022\006\'2023\'\030\346\007\032b\n\016MessageFeature\022\022"
+    "\n\nbool_field\030\001 \001(\010\022\021\n\tint_field\030\002 \001(\005\022\023\n"
+    "\013float_field\030\003 \001(\002\022\024\n\014string_field\030\004 \001(\t"
+    "\"\201\001\n\013EnumFeature\022\035\n\031TEST_ENUM_FEATURE_UN"
+    "KNOWN\020\000\022\017\n\013ENUM_VALUE1\020\001\022\017\n\013ENUM_VALUE2\020"
+    "\002\022\017\n\013ENUM_VALUE3\020\003\022\017\n\013ENUM_VALUE4\020\004\022\017\n\013E"
+    "NUM_VALUE5\020\005:<\n\004test\022\033.google.protobuf.F"
+    "eatureSet\030\217N \001(\0132\020.pb.TestFeatures"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto = {
+    false,
+    false,
+    1714,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5ffeatures_2eproto,
+    "google/protobuf/unittest_features.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_deps,
+    1,
+    4,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5ffeatures_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5ffeatures_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5ffeatures_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5ffeatures_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5ffeatures_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto);
+namespace pb {
+const ::google::protobuf::EnumDescriptor* TestFeatures_EnumFeature_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5ffeatures_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t TestFeatures_EnumFeature_internal_data_[] = {
+    393216u, 0u, };
+bool TestFeatures_EnumFeature_IsValid(int value) {
+  return 0 <= value && value <= 5;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr TestFeatures_EnumFeature TestFeatures::TEST_ENUM_FEATURE_UNKNOWN;
+constexpr TestFeatures_EnumFeature TestFeatures::ENUM_VALUE1;
+constexpr TestFeatures_EnumFeature TestFeatures::ENUM_VALUE2;
+constexpr TestFeatures_EnumFeature TestFeatures::ENUM_VALUE3;
+constexpr TestFeatures_EnumFeature TestFeatures::ENUM_VALUE4;
+constexpr TestFeatures_EnumFeature TestFeatures::ENUM_VALUE5;
+constexpr TestFeatures_EnumFeature TestFeatures::EnumFeature_MIN;
+constexpr TestFeatures_EnumFeature TestFeatures::EnumFeature_MAX;
+constexpr int TestFeatures::EnumFeature_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+// ===================================================================
+
+class TestMessage_Nested::_Internal {
+ public:
+};
+
+TestMessage_Nested::TestMessage_Nested(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:pb.TestMessage.Nested)
+}
+TestMessage_Nested::TestMessage_Nested(
+    ::google::protobuf::Arena* arena,
+    const TestMessage_Nested& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  TestMessage_Nested* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:pb.TestMessage.Nested)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata TestMessage_Nested::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5ffeatures_2eproto[0]);
+}
+// ===================================================================
+
+class TestMessage::_Internal {
+ public:
+};
+
+TestMessage::TestMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:pb.TestMessage)
+}
+TestMessage::TestMessage(
+    ::google::protobuf::Arena* arena,
+    const TestMessage& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  TestMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:pb.TestMessage)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata TestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5ffeatures_2eproto[1]);
+}
+// ===================================================================
+
+class TestFeatures_MessageFeature::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestFeatures_MessageFeature>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_._has_bits_);
+  static void set_has_bool_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_int_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_float_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_string_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestFeatures_MessageFeature::TestFeatures_MessageFeature(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:pb.TestFeatures.MessageFeature)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFeatures_MessageFeature::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        string_field_(arena, from.string_field_) {}
+
+TestFeatures_MessageFeature::TestFeatures_MessageFeature(
+    ::google::protobuf::Arena* arena,
+    const TestFeatures_MessageFeature& from)
+    : ::google::protobuf::Message(arena) {
+  TestFeatures_MessageFeature* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, bool_field_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, bool_field_),
+           offsetof(Impl_, float_field_) -
+               offsetof(Impl_, bool_field_) +
+               sizeof(Impl_::float_field_));
+
+  // @@protoc_insertion_point(copy_constructor:pb.TestFeatures.MessageFeature)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFeatures_MessageFeature::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        string_field_(arena) {}
+
+inline void TestFeatures_MessageFeature::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, bool_field_),
+           0,
+           offsetof(Impl_, float_field_) -
+               offsetof(Impl_, bool_field_) +
+               sizeof(Impl_::float_field_));
+}
+TestFeatures_MessageFeature::~TestFeatures_MessageFeature() {
+  // @@protoc_insertion_point(destructor:pb.TestFeatures.MessageFeature)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestFeatures_MessageFeature::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.string_field_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestFeatures_MessageFeature::Clear() {
+// @@protoc_insertion_point(message_clear_start:pb.TestFeatures.MessageFeature)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.string_field_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.bool_field_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.float_field_) -
+        reinterpret_cast<char*>(&_impl_.bool_field_)) + sizeof(_impl_.float_field_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestFeatures_MessageFeature::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 51, 2> TestFeatures_MessageFeature::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestFeatures_MessageFeature_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string string_field = 4;
+    {::_pbi::TcParser::FastSS1,
+     {34, 0, 0, PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.string_field_)}},
+    // optional bool bool_field = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestFeatures_MessageFeature, _impl_.bool_field_), 1>(),
+     {8, 1, 0, PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.bool_field_)}},
+    // optional int32 int_field = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures_MessageFeature, _impl_.int_field_), 2>(),
+     {16, 2, 0, PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.int_field_)}},
+    // optional float float_field = 3;
+    {::_pbi::TcParser::FastF32S1,
+     {29, 3, 0, PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.float_field_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional bool bool_field = 1;
+    {PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.bool_field_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // optional int32 int_field = 2;
+    {PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.int_field_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional float float_field = 3;
+    {PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.float_field_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // optional string string_field = 4;
+    {PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.string_field_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\36\0\0\0\14\0\0\0"
+    "pb.TestFeatures.MessageFeature"
+    "string_field"
+  }},
+};
+
+::uint8_t* TestFeatures_MessageFeature::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pb.TestFeatures.MessageFeature)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool bool_field = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_bool_field(), target);
+  }
+
+  // optional int32 int_field = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_int_field(), target);
+  }
+
+  // optional float float_field = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        3, this->_internal_float_field(), target);
+  }
+
+  // optional string string_field = 4;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_string_field();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "pb.TestFeatures.MessageFeature.string_field");
+    target = stream->WriteStringMaybeAliased(4, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pb.TestFeatures.MessageFeature)
+  return target;
+}
+
+::size_t TestFeatures_MessageFeature::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pb.TestFeatures.MessageFeature)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string string_field = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_string_field());
+    }
+
+    // optional bool bool_field = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2;
+    }
+
+    // optional int32 int_field = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_field());
+    }
+
+    // optional float float_field = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 5;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestFeatures_MessageFeature::_class_data_ = {
+    TestFeatures_MessageFeature::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestFeatures_MessageFeature::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestFeatures_MessageFeature::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestFeatures_MessageFeature*>(&to_msg);
+  auto& from = static_cast<const TestFeatures_MessageFeature&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.TestFeatures.MessageFeature)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_string_field(from._internal_string_field());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.bool_field_ = from._impl_.bool_field_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.int_field_ = from._impl_.int_field_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.float_field_ = from._impl_.float_field_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestFeatures_MessageFeature::CopyFrom(const TestFeatures_MessageFeature& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pb.TestFeatures.MessageFeature)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestFeatures_MessageFeature::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestFeatures_MessageFeature::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestFeatures_MessageFeature::InternalSwap(TestFeatures_MessageFeature* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.string_field_, &other->_impl_.string_field_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.float_field_)
+      + sizeof(TestFeatures_MessageFeature::_impl_.float_field_)
+      - PROTOBUF_FIELD_OFFSET(TestFeatures_MessageFeature, _impl_.bool_field_)>(
+          reinterpret_cast<char*>(&_impl_.bool_field_),
+          reinterpret_cast<char*>(&other->_impl_.bool_field_));
+}
+
+::google::protobuf::Metadata TestFeatures_MessageFeature::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5ffeatures_2eproto[2]);
+}
+// ===================================================================
+
+class TestFeatures::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestFeatures>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_._has_bits_);
+  static void set_has_int_file_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_int_extension_range_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_int_message_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_int_field_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_int_oneof_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_int_enum_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_int_enum_entry_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_int_service_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_int_method_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_int_multiple_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_bool_field_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_float_field_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::pb::TestFeatures_MessageFeature& message_field_feature(const TestFeatures* msg);
+  static void set_has_message_field_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_enum_field_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_int_source_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_string_source_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::pb::TestFeatures_MessageFeature& TestFeatures::_Internal::message_field_feature(const TestFeatures* msg) {
+  return *msg->_impl_.message_field_feature_;
+}
+TestFeatures::TestFeatures(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:pb.TestFeatures)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFeatures::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        string_source_feature_(arena, from.string_source_feature_) {}
+
+TestFeatures::TestFeatures(
+    ::google::protobuf::Arena* arena,
+    const TestFeatures& from)
+    : ::google::protobuf::Message(arena) {
+  TestFeatures* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.message_field_feature_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::pb::TestFeatures_MessageFeature>(arena, *from._impl_.message_field_feature_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, int_file_feature_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, int_file_feature_),
+           offsetof(Impl_, int_source_feature_) -
+               offsetof(Impl_, int_file_feature_) +
+               sizeof(Impl_::int_source_feature_));
+
+  // @@protoc_insertion_point(copy_constructor:pb.TestFeatures)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFeatures::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        string_source_feature_(arena) {}
+
+inline void TestFeatures::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, message_field_feature_),
+           0,
+           offsetof(Impl_, int_source_feature_) -
+               offsetof(Impl_, message_field_feature_) +
+               sizeof(Impl_::int_source_feature_));
+}
+TestFeatures::~TestFeatures() {
+  // @@protoc_insertion_point(destructor:pb.TestFeatures)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestFeatures::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.string_source_feature_.Destroy();
+  delete _impl_.message_field_feature_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestFeatures::Clear() {
+// @@protoc_insertion_point(message_clear_start:pb.TestFeatures)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.string_source_feature_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.message_field_feature_ != nullptr);
+      _impl_.message_field_feature_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.int_file_feature_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.int_enum_feature_) -
+        reinterpret_cast<char*>(&_impl_.int_file_feature_)) + sizeof(_impl_.int_enum_feature_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.int_enum_entry_feature_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.int_source_feature_) -
+        reinterpret_cast<char*>(&_impl_.int_enum_entry_feature_)) + sizeof(_impl_.int_source_feature_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestFeatures::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<4, 16, 2, 61, 2> TestFeatures::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_._has_bits_),
+    0, // no _extensions_
+    16, 120,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294901760,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    16,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestFeatures_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string string_source_feature = 16 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {::_pbi::TcParser::FastSS2,
+     {386, 0, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.string_source_feature_)}},
+    // optional int32 int_file_feature = 1 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_file_feature_), 2>(),
+     {8, 2, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_file_feature_)}},
+    // optional int32 int_extension_range_feature = 2 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_extension_range_feature_), 3>(),
+     {16, 3, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_extension_range_feature_)}},
+    // optional int32 int_message_feature = 3 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_MESSAGE, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_message_feature_), 4>(),
+     {24, 4, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_message_feature_)}},
+    // optional int32 int_field_feature = 4 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_field_feature_), 5>(),
+     {32, 5, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_field_feature_)}},
+    // optional int32 int_oneof_feature = 5 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ONEOF, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_oneof_feature_), 6>(),
+     {40, 6, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_oneof_feature_)}},
+    // optional int32 int_enum_feature = 6 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_enum_feature_), 7>(),
+     {48, 7, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_enum_feature_)}},
+    // optional int32 int_enum_entry_feature = 7 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM_ENTRY, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_enum_entry_feature_), 8>(),
+     {56, 8, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_enum_entry_feature_)}},
+    // optional int32 int_service_feature = 8 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_SERVICE, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_service_feature_), 9>(),
+     {64, 9, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_service_feature_)}},
+    // optional int32 int_method_feature = 9 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_METHOD, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_method_feature_), 10>(),
+     {72, 10, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_method_feature_)}},
+    // optional int32 int_multiple_feature = 10 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_multiple_feature_), 11>(),
+     {80, 11, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_multiple_feature_)}},
+    // optional bool bool_field_feature = 11 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestFeatures, _impl_.bool_field_feature_), 12>(),
+     {88, 12, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.bool_field_feature_)}},
+    // optional float float_field_feature = 12 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {::_pbi::TcParser::FastF32S1,
+     {101, 13, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.float_field_feature_)}},
+    // optional .pb.TestFeatures.MessageFeature message_field_feature = 13 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {::_pbi::TcParser::FastMtS1,
+     {106, 1, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.message_field_feature_)}},
+    // optional .pb.TestFeatures.EnumFeature enum_field_feature = 14 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {::_pbi::TcParser::FastEr0S1,
+     {112, 14, 5, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.enum_field_feature_)}},
+    // optional int32 int_source_feature = 15 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFeatures, _impl_.int_source_feature_), 15>(),
+     {120, 15, 0, PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_source_feature_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 int_file_feature = 1 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_file_feature_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_extension_range_feature = 2 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_extension_range_feature_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_message_feature = 3 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_MESSAGE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_message_feature_), _Internal::kHasBitsOffset + 4, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_field_feature = 4 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_field_feature_), _Internal::kHasBitsOffset + 5, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_oneof_feature = 5 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ONEOF, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_oneof_feature_), _Internal::kHasBitsOffset + 6, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_enum_feature = 6 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_enum_feature_), _Internal::kHasBitsOffset + 7, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_enum_entry_feature = 7 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM_ENTRY, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_enum_entry_feature_), _Internal::kHasBitsOffset + 8, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_service_feature = 8 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_SERVICE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_service_feature_), _Internal::kHasBitsOffset + 9, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_method_feature = 9 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_METHOD, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_method_feature_), _Internal::kHasBitsOffset + 10, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 int_multiple_feature = 10 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_multiple_feature_), _Internal::kHasBitsOffset + 11, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional bool bool_field_feature = 11 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.bool_field_feature_), _Internal::kHasBitsOffset + 12, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // optional float float_field_feature = 12 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.float_field_feature_), _Internal::kHasBitsOffset + 13, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // optional .pb.TestFeatures.MessageFeature message_field_feature = 13 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.message_field_feature_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .pb.TestFeatures.EnumFeature enum_field_feature = 14 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.enum_field_feature_), _Internal::kHasBitsOffset + 14, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kEnumRange)},
+    // optional int32 int_source_feature = 15 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_source_feature_), _Internal::kHasBitsOffset + 15, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional string string_source_feature = 16 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    {PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.string_source_feature_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::pb::TestFeatures_MessageFeature>()},
+    {0, 6},
+  }}, {{
+    "\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+    "pb.TestFeatures"
+    "string_source_feature"
+  }},
+};
+
+::uint8_t* TestFeatures::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pb.TestFeatures)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 int_file_feature = 1 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, edition_defaults = {
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_int_file_feature(), target);
+  }
+
+  // optional int32 int_extension_range_feature = 2 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_int_extension_range_feature(), target);
+  }
+
+  // optional int32 int_message_feature = 3 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_MESSAGE, edition_defaults = {
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<3>(
+            stream, this->_internal_int_message_feature(), target);
+  }
+
+  // optional int32 int_field_feature = 4 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<4>(
+            stream, this->_internal_int_field_feature(), target);
+  }
+
+  // optional int32 int_oneof_feature = 5 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ONEOF, edition_defaults = {
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<5>(
+            stream, this->_internal_int_oneof_feature(), target);
+  }
+
+  // optional int32 int_enum_feature = 6 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM, edition_defaults = {
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<6>(
+            stream, this->_internal_int_enum_feature(), target);
+  }
+
+  // optional int32 int_enum_entry_feature = 7 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM_ENTRY, edition_defaults = {
+  if (cached_has_bits & 0x00000100u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<7>(
+            stream, this->_internal_int_enum_entry_feature(), target);
+  }
+
+  // optional int32 int_service_feature = 8 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_SERVICE, edition_defaults = {
+  if (cached_has_bits & 0x00000200u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<8>(
+            stream, this->_internal_int_service_feature(), target);
+  }
+
+  // optional int32 int_method_feature = 9 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_METHOD, edition_defaults = {
+  if (cached_has_bits & 0x00000400u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<9>(
+            stream, this->_internal_int_method_feature(), target);
+  }
+
+  // optional int32 int_multiple_feature = 10 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+  if (cached_has_bits & 0x00000800u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<10>(
+            stream, this->_internal_int_multiple_feature(), target);
+  }
+
+  // optional bool bool_field_feature = 11 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        11, this->_internal_bool_field_feature(), target);
+  }
+
+  // optional float float_field_feature = 12 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        12, this->_internal_float_field_feature(), target);
+  }
+
+  // optional .pb.TestFeatures.MessageFeature message_field_feature = 13 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        13, _Internal::message_field_feature(this),
+        _Internal::message_field_feature(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .pb.TestFeatures.EnumFeature enum_field_feature = 14 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        14, this->_internal_enum_field_feature(), target);
+  }
+
+  // optional int32 int_source_feature = 15 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+  if (cached_has_bits & 0x00008000u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<15>(
+            stream, this->_internal_int_source_feature(), target);
+  }
+
+  // optional string string_source_feature = 16 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_string_source_feature();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "pb.TestFeatures.string_source_feature");
+    target = stream->WriteStringMaybeAliased(16, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pb.TestFeatures)
+  return target;
+}
+
+::size_t TestFeatures::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pb.TestFeatures)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string string_source_feature = 16 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_string_source_feature());
+    }
+
+    // optional .pb.TestFeatures.MessageFeature message_field_feature = 13 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.message_field_feature_);
+    }
+
+    // optional int32 int_file_feature = 1 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, edition_defaults = {
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_file_feature());
+    }
+
+    // optional int32 int_extension_range_feature = 2 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_extension_range_feature());
+    }
+
+    // optional int32 int_message_feature = 3 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_MESSAGE, edition_defaults = {
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_message_feature());
+    }
+
+    // optional int32 int_field_feature = 4 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_field_feature());
+    }
+
+    // optional int32 int_oneof_feature = 5 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ONEOF, edition_defaults = {
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_oneof_feature());
+    }
+
+    // optional int32 int_enum_feature = 6 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM, edition_defaults = {
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_enum_feature());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional int32 int_enum_entry_feature = 7 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_ENUM_ENTRY, edition_defaults = {
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_enum_entry_feature());
+    }
+
+    // optional int32 int_service_feature = 8 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_SERVICE, edition_defaults = {
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_service_feature());
+    }
+
+    // optional int32 int_method_feature = 9 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_METHOD, edition_defaults = {
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_method_feature());
+    }
+
+    // optional int32 int_multiple_feature = 10 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_multiple_feature());
+    }
+
+    // optional bool bool_field_feature = 11 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2;
+    }
+
+    // optional float float_field_feature = 12 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 5;
+    }
+
+    // optional .pb.TestFeatures.EnumFeature enum_field_feature = 14 [retention = RETENTION_RUNTIME, targets = TARGET_TYPE_FIELD, edition_defaults = {
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_field_feature());
+    }
+
+    // optional int32 int_source_feature = 15 [retention = RETENTION_SOURCE, targets = TARGET_TYPE_FILE, targets = TARGET_TYPE_FIELD, targets = TARGET_TYPE_MESSAGE, targets = TARGET_TYPE_ENUM, targets = TARGET_TYPE_ENUM_ENTRY, targets = TARGET_TYPE_SERVICE, targets = TARGET_TYPE_METHOD, targets = TARGET_TYPE_ONEOF, targets = TARGET_TYPE_EXTENSION_RANGE, edition_defaults = {
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_int_source_feature());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestFeatures::_class_data_ = {
+    TestFeatures::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestFeatures::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestFeatures::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestFeatures*>(&to_msg);
+  auto& from = static_cast<const TestFeatures&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.TestFeatures)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_string_source_feature(from._internal_string_source_feature());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_message_field_feature()->::pb::TestFeatures_MessageFeature::MergeFrom(
+          from._internal_message_field_feature());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.int_file_feature_ = from._impl_.int_file_feature_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.int_extension_range_feature_ = from._impl_.int_extension_range_feature_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.int_message_feature_ = from._impl_.int_message_feature_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.int_field_feature_ = from._impl_.int_field_feature_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.int_oneof_feature_ = from._impl_.int_oneof_feature_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.int_enum_feature_ = from._impl_.int_enum_feature_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.int_enum_entry_feature_ = from._impl_.int_enum_entry_feature_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.int_service_feature_ = from._impl_.int_service_feature_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.int_method_feature_ = from._impl_.int_method_feature_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.int_multiple_feature_ = from._impl_.int_multiple_feature_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.bool_field_feature_ = from._impl_.bool_field_feature_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.float_field_feature_ = from._impl_.float_field_feature_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.enum_field_feature_ = from._impl_.enum_field_feature_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.int_source_feature_ = from._impl_.int_source_feature_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestFeatures::CopyFrom(const TestFeatures& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pb.TestFeatures)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestFeatures::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestFeatures::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestFeatures::InternalSwap(TestFeatures* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.string_source_feature_, &other->_impl_.string_source_feature_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.int_source_feature_)
+      + sizeof(TestFeatures::_impl_.int_source_feature_)
+      - PROTOBUF_FIELD_OFFSET(TestFeatures, _impl_.message_field_feature_)>(
+          reinterpret_cast<char*>(&_impl_.message_field_feature_),
+          reinterpret_cast<char*>(&other->_impl_.message_field_feature_));
+}
+
+::google::protobuf::Metadata TestFeatures::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5ffeatures_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5ffeatures_2eproto[3]);
+}
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestMessage_Nested::kTestNestedFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FeatureSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::pb::TestFeatures >, 11, false>
+  TestMessage_Nested::test_nested(kTestNestedFieldNumber, ::pb::TestFeatures::default_instance(), nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestMessage::kTestMessageFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FeatureSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::pb::TestFeatures >, 11, false>
+  TestMessage::test_message(kTestMessageFieldNumber, ::pb::TestFeatures::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FeatureSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::pb::TestFeatures >, 11, false>
+  test(kTestFieldNumber, ::pb::TestFeatures::default_instance(), nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace pb
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
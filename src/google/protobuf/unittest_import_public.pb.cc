@@ -0,0 +1,307 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_import_public.proto
+
+#include "google/protobuf/unittest_import_public.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest_import {
+
+inline constexpr PublicImportMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        e_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR PublicImportMessage::PublicImportMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct PublicImportMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PublicImportMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PublicImportMessageDefaultTypeInternal() {}
+  union {
+    PublicImportMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PublicImportMessageDefaultTypeInternal _PublicImportMessage_default_instance_;
+}  // namespace protobuf_unittest_import
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto[1];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest_import::PublicImportMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest_import::PublicImportMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest_import::PublicImportMessage, _impl_.e_),
+    0,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 9, -1, sizeof(::protobuf_unittest_import::PublicImportMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest_import::_PublicImportMessage_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n,google/protobuf/unittest_import_public"
+    ".proto\022\030protobuf_unittest_import\" \n\023Publ"
+    "icImportMessage\022\t\n\001e\030\001 \001(\005B\032\n\030com.google"
+    ".protobuf.test"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto = {
+    false,
+    false,
+    134,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto,
+    "google/protobuf/unittest_import_public.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto_once,
+    nullptr,
+    0,
+    1,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto);
+namespace protobuf_unittest_import {
+// ===================================================================
+
+class PublicImportMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PublicImportMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(PublicImportMessage, _impl_._has_bits_);
+  static void set_has_e(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+PublicImportMessage::PublicImportMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest_import.PublicImportMessage)
+}
+PublicImportMessage::PublicImportMessage(
+    ::google::protobuf::Arena* arena, const PublicImportMessage& from)
+    : PublicImportMessage(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE PublicImportMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void PublicImportMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.e_ = {};
+}
+PublicImportMessage::~PublicImportMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_import.PublicImportMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void PublicImportMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void PublicImportMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_import.PublicImportMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.e_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* PublicImportMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> PublicImportMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(PublicImportMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_PublicImportMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional int32 e = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(PublicImportMessage, _impl_.e_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(PublicImportMessage, _impl_.e_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 e = 1;
+    {PROTOBUF_FIELD_OFFSET(PublicImportMessage, _impl_.e_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* PublicImportMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_import.PublicImportMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 e = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_e(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_import.PublicImportMessage)
+  return target;
+}
+
+::size_t PublicImportMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_import.PublicImportMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 e = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_e());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData PublicImportMessage::_class_data_ = {
+    PublicImportMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* PublicImportMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void PublicImportMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<PublicImportMessage*>(&to_msg);
+  auto& from = static_cast<const PublicImportMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_import.PublicImportMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_e(from._internal_e());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PublicImportMessage::CopyFrom(const PublicImportMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_import.PublicImportMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool PublicImportMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* PublicImportMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void PublicImportMessage::InternalSwap(PublicImportMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.e_, other->_impl_.e_);
+}
+
+::google::protobuf::Metadata PublicImportMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto[0]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest_import
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,460 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lazy_dependencies.proto
+
+#include "google/protobuf/unittest_lazy_dependencies.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+namespace lazy_imports {
+      template <typename>
+PROTOBUF_CONSTEXPR MessageCustomOption2::MessageCustomOption2(::_pbi::ConstantInitialized) {}
+struct MessageCustomOption2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageCustomOption2DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageCustomOption2DefaultTypeInternal() {}
+  union {
+    MessageCustomOption2 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageCustomOption2DefaultTypeInternal _MessageCustomOption2_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MessageCustomOption::MessageCustomOption(::_pbi::ConstantInitialized) {}
+struct MessageCustomOptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageCustomOptionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageCustomOptionDefaultTypeInternal() {}
+  union {
+    MessageCustomOption _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageCustomOptionDefaultTypeInternal _MessageCustomOption_default_instance_;
+
+inline constexpr ImportedMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        lazy_message_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ImportedMessage::ImportedMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ImportedMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ImportedMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ImportedMessageDefaultTypeInternal() {}
+  union {
+    ImportedMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ImportedMessageDefaultTypeInternal _ImportedMessage_default_instance_;
+}  // namespace lazy_imports
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto[3];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::lazy_imports::ImportedMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::lazy_imports::ImportedMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::lazy_imports::ImportedMessage, _impl_.lazy_message_),
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::lazy_imports::MessageCustomOption, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::lazy_imports::MessageCustomOption2, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 9, -1, sizeof(::protobuf_unittest::lazy_imports::ImportedMessage)},
+        {10, -1, -1, sizeof(::protobuf_unittest::lazy_imports::MessageCustomOption)},
+        {18, -1, -1, sizeof(::protobuf_unittest::lazy_imports::MessageCustomOption2)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::lazy_imports::_ImportedMessage_default_instance_._instance,
+    &::protobuf_unittest::lazy_imports::_MessageCustomOption_default_instance_._instance,
+    &::protobuf_unittest::lazy_imports::_MessageCustomOption2_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n0google/protobuf/unittest_lazy_dependen"
+    "cies.proto\022\036protobuf_unittest.lazy_impor"
+    "ts\032>google/protobuf/unittest_lazy_depend"
+    "encies_custom_option.proto\"T\n\017ImportedMe"
+    "ssage\022A\n\014lazy_message\030\001 \001(\0132+.protobuf_u"
+    "nittest.lazy_imports.LazyMessage\"\025\n\023Mess"
+    "ageCustomOption\"\036\n\024MessageCustomOption2:"
+    "\006\370\376\331\220\004\000B(B\030UnittestLazyImportsProtoH\001\200\001\001"
+    "\210\001\001\220\001\001\370\001\001b\010editionsp\350\007"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fcustom_5foption_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto = {
+    false,
+    false,
+    342,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto,
+    "google/protobuf/unittest_lazy_dependencies.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_deps,
+    1,
+    3,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto);
+namespace protobuf_unittest {
+namespace lazy_imports {
+// ===================================================================
+
+class ImportedMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ImportedMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ImportedMessage, _impl_._has_bits_);
+  static const ::protobuf_unittest::lazy_imports::LazyMessage& lazy_message(const ImportedMessage* msg);
+  static void set_has_lazy_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::lazy_imports::LazyMessage& ImportedMessage::_Internal::lazy_message(const ImportedMessage* msg) {
+  return *msg->_impl_.lazy_message_;
+}
+void ImportedMessage::clear_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.lazy_message_ != nullptr) _impl_.lazy_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+ImportedMessage::ImportedMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.lazy_imports.ImportedMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE ImportedMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+ImportedMessage::ImportedMessage(
+    ::google::protobuf::Arena* arena,
+    const ImportedMessage& from)
+    : ::google::protobuf::Message(arena) {
+  ImportedMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.lazy_message_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::lazy_imports::LazyMessage>(arena, *from._impl_.lazy_message_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.lazy_imports.ImportedMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE ImportedMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void ImportedMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.lazy_message_ = {};
+}
+ImportedMessage::~ImportedMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.lazy_imports.ImportedMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void ImportedMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.lazy_message_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void ImportedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.lazy_imports.ImportedMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.lazy_message_ != nullptr);
+    _impl_.lazy_message_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* ImportedMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> ImportedMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ImportedMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_ImportedMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .protobuf_unittest.lazy_imports.LazyMessage lazy_message = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ImportedMessage, _impl_.lazy_message_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .protobuf_unittest.lazy_imports.LazyMessage lazy_message = 1;
+    {PROTOBUF_FIELD_OFFSET(ImportedMessage, _impl_.lazy_message_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::lazy_imports::LazyMessage>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* ImportedMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.lazy_imports.ImportedMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .protobuf_unittest.lazy_imports.LazyMessage lazy_message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::lazy_message(this),
+        _Internal::lazy_message(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.lazy_imports.ImportedMessage)
+  return target;
+}
+
+::size_t ImportedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.lazy_imports.ImportedMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.lazy_imports.LazyMessage lazy_message = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.lazy_message_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData ImportedMessage::_class_data_ = {
+    ImportedMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* ImportedMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void ImportedMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ImportedMessage*>(&to_msg);
+  auto& from = static_cast<const ImportedMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.lazy_imports.ImportedMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_lazy_message()->::protobuf_unittest::lazy_imports::LazyMessage::MergeFrom(
+        from._internal_lazy_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ImportedMessage::CopyFrom(const ImportedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.lazy_imports.ImportedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool ImportedMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* ImportedMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void ImportedMessage::InternalSwap(ImportedMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.lazy_message_, other->_impl_.lazy_message_);
+}
+
+::google::protobuf::Metadata ImportedMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto[0]);
+}
+// ===================================================================
+
+class MessageCustomOption::_Internal {
+ public:
+};
+
+MessageCustomOption::MessageCustomOption(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.lazy_imports.MessageCustomOption)
+}
+MessageCustomOption::MessageCustomOption(
+    ::google::protobuf::Arena* arena,
+    const MessageCustomOption& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  MessageCustomOption* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.lazy_imports.MessageCustomOption)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata MessageCustomOption::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto[1]);
+}
+// ===================================================================
+
+class MessageCustomOption2::_Internal {
+ public:
+};
+
+MessageCustomOption2::MessageCustomOption2(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.lazy_imports.MessageCustomOption2)
+}
+MessageCustomOption2::MessageCustomOption2(
+    ::google::protobuf::Arena* arena,
+    const MessageCustomOption2& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  MessageCustomOption2* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.lazy_imports.MessageCustomOption2)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata MessageCustomOption2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5flazy_5fdependencies_2eproto[2]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace lazy_imports
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
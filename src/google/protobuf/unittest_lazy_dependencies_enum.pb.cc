@@ -0,0 +1,95 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lazy_dependencies_enum.proto
+
+#include "google/protobuf/unittest_lazy_dependencies_enum.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+namespace lazy_imports {
+}  // namespace lazy_imports
+}  // namespace protobuf_unittest
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto[1];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n5google/protobuf/unittest_lazy_dependen"
+    "cies_enum.proto\022\036protobuf_unittest.lazy_"
+    "imports*,\n\010LazyEnum\022\017\n\013LAZY_ENUM_0\020\000\022\017\n\013"
+    "LAZY_ENUM_1\020\001B1B\034UnittestLazyImportsEnum"
+    "ProtoH\001\200\001\001\210\001\001\220\001\001\370\001\001\222\003\002\020\002b\010editionsp\350\007"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto = {
+    false,
+    false,
+    197,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto,
+    "google/protobuf/unittest_lazy_dependencies_enum.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto_once,
+    nullptr,
+    0,
+    0,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto::offsets,
+    nullptr,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto);
+namespace protobuf_unittest {
+namespace lazy_imports {
+const ::google::protobuf::EnumDescriptor* LazyEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5flazy_5fdependencies_5fenum_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t LazyEnum_internal_data_[] = {
+    131072u, 0u, };
+bool LazyEnum_IsValid(int value) {
+  return 0 <= value && value <= 1;
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace lazy_imports
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,17968 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lite.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5flite_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5flite_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/message_lite.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "absl/strings/cord.h"
+#include "google/protobuf/map.h"  // IWYU pragma: export
+#include "google/protobuf/map_field_lite.h"
+#include "google/protobuf/generated_enum_util.h"
+#include "google/protobuf/unittest_import_lite.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5flite_2eproto {
+  static const ::uint32_t offsets[];
+};
+namespace protobuf_unittest {
+class DupEnum;
+struct DupEnumDefaultTypeInternal;
+extern DupEnumDefaultTypeInternal _DupEnum_default_instance_;
+class ForeignMessageLite;
+struct ForeignMessageLiteDefaultTypeInternal;
+extern ForeignMessageLiteDefaultTypeInternal _ForeignMessageLite_default_instance_;
+class NonPackedFixed32;
+struct NonPackedFixed32DefaultTypeInternal;
+extern NonPackedFixed32DefaultTypeInternal _NonPackedFixed32_default_instance_;
+class NonPackedInt32;
+struct NonPackedInt32DefaultTypeInternal;
+extern NonPackedInt32DefaultTypeInternal _NonPackedInt32_default_instance_;
+class OptionalGroup_extension_lite;
+struct OptionalGroup_extension_liteDefaultTypeInternal;
+extern OptionalGroup_extension_liteDefaultTypeInternal _OptionalGroup_extension_lite_default_instance_;
+class PackedFixed32;
+struct PackedFixed32DefaultTypeInternal;
+extern PackedFixed32DefaultTypeInternal _PackedFixed32_default_instance_;
+class PackedInt32;
+struct PackedInt32DefaultTypeInternal;
+extern PackedInt32DefaultTypeInternal _PackedInt32_default_instance_;
+class RecursiveMessage;
+struct RecursiveMessageDefaultTypeInternal;
+extern RecursiveMessageDefaultTypeInternal _RecursiveMessage_default_instance_;
+class RepeatedGroup_extension_lite;
+struct RepeatedGroup_extension_liteDefaultTypeInternal;
+extern RepeatedGroup_extension_liteDefaultTypeInternal _RepeatedGroup_extension_lite_default_instance_;
+class TestAllExtensionsLite;
+struct TestAllExtensionsLiteDefaultTypeInternal;
+extern TestAllExtensionsLiteDefaultTypeInternal _TestAllExtensionsLite_default_instance_;
+class TestAllTypesLite;
+struct TestAllTypesLiteDefaultTypeInternal;
+extern TestAllTypesLiteDefaultTypeInternal _TestAllTypesLite_default_instance_;
+class TestAllTypesLite_NestedMessage;
+struct TestAllTypesLite_NestedMessageDefaultTypeInternal;
+extern TestAllTypesLite_NestedMessageDefaultTypeInternal _TestAllTypesLite_NestedMessage_default_instance_;
+class TestAllTypesLite_NestedMessage2;
+struct TestAllTypesLite_NestedMessage2DefaultTypeInternal;
+extern TestAllTypesLite_NestedMessage2DefaultTypeInternal _TestAllTypesLite_NestedMessage2_default_instance_;
+class TestAllTypesLite_OptionalGroup;
+struct TestAllTypesLite_OptionalGroupDefaultTypeInternal;
+extern TestAllTypesLite_OptionalGroupDefaultTypeInternal _TestAllTypesLite_OptionalGroup_default_instance_;
+class TestAllTypesLite_RepeatedGroup;
+struct TestAllTypesLite_RepeatedGroupDefaultTypeInternal;
+extern TestAllTypesLite_RepeatedGroupDefaultTypeInternal _TestAllTypesLite_RepeatedGroup_default_instance_;
+class TestDeprecatedLite;
+struct TestDeprecatedLiteDefaultTypeInternal;
+extern TestDeprecatedLiteDefaultTypeInternal _TestDeprecatedLite_default_instance_;
+class TestEmptyMessageLite;
+struct TestEmptyMessageLiteDefaultTypeInternal;
+extern TestEmptyMessageLiteDefaultTypeInternal _TestEmptyMessageLite_default_instance_;
+class TestEmptyMessageWithExtensionsLite;
+struct TestEmptyMessageWithExtensionsLiteDefaultTypeInternal;
+extern TestEmptyMessageWithExtensionsLiteDefaultTypeInternal _TestEmptyMessageWithExtensionsLite_default_instance_;
+class TestHugeFieldNumbersLite;
+struct TestHugeFieldNumbersLiteDefaultTypeInternal;
+extern TestHugeFieldNumbersLiteDefaultTypeInternal _TestHugeFieldNumbersLite_default_instance_;
+class TestHugeFieldNumbersLite_OptionalGroup;
+struct TestHugeFieldNumbersLite_OptionalGroupDefaultTypeInternal;
+extern TestHugeFieldNumbersLite_OptionalGroupDefaultTypeInternal _TestHugeFieldNumbersLite_OptionalGroup_default_instance_;
+class TestMergeExceptionLite;
+struct TestMergeExceptionLiteDefaultTypeInternal;
+extern TestMergeExceptionLiteDefaultTypeInternal _TestMergeExceptionLite_default_instance_;
+class TestMessageSetLite;
+struct TestMessageSetLiteDefaultTypeInternal;
+extern TestMessageSetLiteDefaultTypeInternal _TestMessageSetLite_default_instance_;
+class TestNestedExtensionLite;
+struct TestNestedExtensionLiteDefaultTypeInternal;
+extern TestNestedExtensionLiteDefaultTypeInternal _TestNestedExtensionLite_default_instance_;
+class TestOneofParsingLite;
+struct TestOneofParsingLiteDefaultTypeInternal;
+extern TestOneofParsingLiteDefaultTypeInternal _TestOneofParsingLite_default_instance_;
+class TestPackedExtensionsLite;
+struct TestPackedExtensionsLiteDefaultTypeInternal;
+extern TestPackedExtensionsLiteDefaultTypeInternal _TestPackedExtensionsLite_default_instance_;
+class TestPackedTypesLite;
+struct TestPackedTypesLiteDefaultTypeInternal;
+extern TestPackedTypesLiteDefaultTypeInternal _TestPackedTypesLite_default_instance_;
+class TestParsingMergeLite;
+struct TestParsingMergeLiteDefaultTypeInternal;
+extern TestParsingMergeLiteDefaultTypeInternal _TestParsingMergeLite_default_instance_;
+class TestParsingMergeLite_OptionalGroup;
+struct TestParsingMergeLite_OptionalGroupDefaultTypeInternal;
+extern TestParsingMergeLite_OptionalGroupDefaultTypeInternal _TestParsingMergeLite_OptionalGroup_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator;
+struct TestParsingMergeLite_RepeatedFieldsGeneratorDefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedFieldsGeneratorDefaultTypeInternal _TestParsingMergeLite_RepeatedFieldsGenerator_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group1;
+struct TestParsingMergeLite_RepeatedFieldsGenerator_Group1DefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedFieldsGenerator_Group1DefaultTypeInternal _TestParsingMergeLite_RepeatedFieldsGenerator_Group1_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group2;
+struct TestParsingMergeLite_RepeatedFieldsGenerator_Group2DefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedFieldsGenerator_Group2DefaultTypeInternal _TestParsingMergeLite_RepeatedFieldsGenerator_Group2_default_instance_;
+class TestParsingMergeLite_RepeatedGroup;
+struct TestParsingMergeLite_RepeatedGroupDefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedGroupDefaultTypeInternal _TestParsingMergeLite_RepeatedGroup_default_instance_;
+class V1MessageLite;
+struct V1MessageLiteDefaultTypeInternal;
+extern V1MessageLiteDefaultTypeInternal _V1MessageLite_default_instance_;
+class V2MessageLite;
+struct V2MessageLiteDefaultTypeInternal;
+extern V2MessageLiteDefaultTypeInternal _V2MessageLite_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+enum TestAllTypesLite_NestedEnum : int {
+  TestAllTypesLite_NestedEnum_FOO = 1,
+  TestAllTypesLite_NestedEnum_BAR = 2,
+  TestAllTypesLite_NestedEnum_BAZ = 3,
+};
+
+bool TestAllTypesLite_NestedEnum_IsValid(int value);
+extern const uint32_t TestAllTypesLite_NestedEnum_internal_data_[];
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite_NestedEnum_NestedEnum_MIN = static_cast<TestAllTypesLite_NestedEnum>(1);
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite_NestedEnum_NestedEnum_MAX = static_cast<TestAllTypesLite_NestedEnum>(3);
+constexpr int TestAllTypesLite_NestedEnum_NestedEnum_ARRAYSIZE = 3 + 1;
+const std::string& TestAllTypesLite_NestedEnum_Name(TestAllTypesLite_NestedEnum value);
+template <typename T>
+const std::string& TestAllTypesLite_NestedEnum_Name(T value) {
+  static_assert(std::is_same<T, TestAllTypesLite_NestedEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to NestedEnum_Name().");
+  return TestAllTypesLite_NestedEnum_Name(static_cast<TestAllTypesLite_NestedEnum>(value));
+}
+const std::string& TestAllTypesLite_NestedEnum_Name(TestAllTypesLite_NestedEnum value);
+bool TestAllTypesLite_NestedEnum_Parse(absl::string_view name, TestAllTypesLite_NestedEnum* value);
+enum DupEnum_TestEnumWithDupValueLite : int {
+  DupEnum_TestEnumWithDupValueLite_FOO1 = 1,
+  DupEnum_TestEnumWithDupValueLite_BAR1 = 2,
+  DupEnum_TestEnumWithDupValueLite_BAZ = 3,
+  DupEnum_TestEnumWithDupValueLite_FOO2 = 1,
+  DupEnum_TestEnumWithDupValueLite_BAR2 = 2,
+};
+
+bool DupEnum_TestEnumWithDupValueLite_IsValid(int value);
+extern const uint32_t DupEnum_TestEnumWithDupValueLite_internal_data_[];
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum_TestEnumWithDupValueLite_TestEnumWithDupValueLite_MIN = static_cast<DupEnum_TestEnumWithDupValueLite>(1);
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum_TestEnumWithDupValueLite_TestEnumWithDupValueLite_MAX = static_cast<DupEnum_TestEnumWithDupValueLite>(3);
+constexpr int DupEnum_TestEnumWithDupValueLite_TestEnumWithDupValueLite_ARRAYSIZE = 3 + 1;
+const std::string& DupEnum_TestEnumWithDupValueLite_Name(DupEnum_TestEnumWithDupValueLite value);
+template <typename T>
+const std::string& DupEnum_TestEnumWithDupValueLite_Name(T value) {
+  static_assert(std::is_same<T, DupEnum_TestEnumWithDupValueLite>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to TestEnumWithDupValueLite_Name().");
+  return DupEnum_TestEnumWithDupValueLite_Name(static_cast<DupEnum_TestEnumWithDupValueLite>(value));
+}
+const std::string& DupEnum_TestEnumWithDupValueLite_Name(DupEnum_TestEnumWithDupValueLite value);
+bool DupEnum_TestEnumWithDupValueLite_Parse(absl::string_view name, DupEnum_TestEnumWithDupValueLite* value);
+enum ForeignEnumLite : int {
+  FOREIGN_LITE_FOO = 4,
+  FOREIGN_LITE_BAZ = 6,
+  FOREIGN_LITE_BAR = 5,
+};
+
+bool ForeignEnumLite_IsValid(int value);
+extern const uint32_t ForeignEnumLite_internal_data_[];
+constexpr ForeignEnumLite ForeignEnumLite_MIN = static_cast<ForeignEnumLite>(4);
+constexpr ForeignEnumLite ForeignEnumLite_MAX = static_cast<ForeignEnumLite>(6);
+constexpr int ForeignEnumLite_ARRAYSIZE = 6 + 1;
+const std::string& ForeignEnumLite_Name(ForeignEnumLite value);
+template <typename T>
+const std::string& ForeignEnumLite_Name(T value) {
+  static_assert(std::is_same<T, ForeignEnumLite>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to ForeignEnumLite_Name().");
+  return ForeignEnumLite_Name(static_cast<ForeignEnumLite>(value));
+}
+const std::string& ForeignEnumLite_Name(ForeignEnumLite value);
+bool ForeignEnumLite_Parse(absl::string_view name, ForeignEnumLite* value);
+enum V1EnumLite : int {
+  V1_FIRST = 1,
+};
+
+bool V1EnumLite_IsValid(int value);
+extern const uint32_t V1EnumLite_internal_data_[];
+constexpr V1EnumLite V1EnumLite_MIN = static_cast<V1EnumLite>(1);
+constexpr V1EnumLite V1EnumLite_MAX = static_cast<V1EnumLite>(1);
+constexpr int V1EnumLite_ARRAYSIZE = 1 + 1;
+const std::string& V1EnumLite_Name(V1EnumLite value);
+template <typename T>
+const std::string& V1EnumLite_Name(T value) {
+  static_assert(std::is_same<T, V1EnumLite>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to V1EnumLite_Name().");
+  return V1EnumLite_Name(static_cast<V1EnumLite>(value));
+}
+const std::string& V1EnumLite_Name(V1EnumLite value);
+bool V1EnumLite_Parse(absl::string_view name, V1EnumLite* value);
+enum V2EnumLite : int {
+  V2_FIRST = 1,
+  V2_SECOND = 2,
+};
+
+bool V2EnumLite_IsValid(int value);
+extern const uint32_t V2EnumLite_internal_data_[];
+constexpr V2EnumLite V2EnumLite_MIN = static_cast<V2EnumLite>(1);
+constexpr V2EnumLite V2EnumLite_MAX = static_cast<V2EnumLite>(2);
+constexpr int V2EnumLite_ARRAYSIZE = 2 + 1;
+const std::string& V2EnumLite_Name(V2EnumLite value);
+template <typename T>
+const std::string& V2EnumLite_Name(T value) {
+  static_assert(std::is_same<T, V2EnumLite>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to V2EnumLite_Name().");
+  return V2EnumLite_Name(static_cast<V2EnumLite>(value));
+}
+const std::string& V2EnumLite_Name(V2EnumLite value);
+bool V2EnumLite_Parse(absl::string_view name, V2EnumLite* value);
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class V2MessageLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.V2MessageLite) */ {
+ public:
+  inline V2MessageLite() : V2MessageLite(nullptr) {}
+  ~V2MessageLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR V2MessageLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline V2MessageLite(const V2MessageLite& from)
+      : V2MessageLite(nullptr, from) {}
+  V2MessageLite(V2MessageLite&& from) noexcept
+    : V2MessageLite() {
+    *this = ::std::move(from);
+  }
+
+  inline V2MessageLite& operator=(const V2MessageLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline V2MessageLite& operator=(V2MessageLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const V2MessageLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const V2MessageLite* internal_default_instance() {
+    return reinterpret_cast<const V2MessageLite*>(
+               &_V2MessageLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(V2MessageLite& a, V2MessageLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(V2MessageLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(V2MessageLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  V2MessageLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<V2MessageLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const V2MessageLite& from);
+  void MergeFrom(const V2MessageLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(V2MessageLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.V2MessageLite";
+  }
+  protected:
+  explicit V2MessageLite(::google::protobuf::Arena* arena);
+  V2MessageLite(::google::protobuf::Arena* arena, const V2MessageLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIntFieldFieldNumber = 1,
+    kEnumFieldFieldNumber = 2,
+  };
+  // required int32 int_field = 1;
+  bool has_int_field() const;
+  void clear_int_field() ;
+  ::int32_t int_field() const;
+  void set_int_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_int_field() const;
+  void _internal_set_int_field(::int32_t value);
+
+  public:
+  // optional .protobuf_unittest.V2EnumLite enum_field = 2 [default = V2_FIRST];
+  bool has_enum_field() const;
+  void clear_enum_field() ;
+  ::protobuf_unittest::V2EnumLite enum_field() const;
+  void set_enum_field(::protobuf_unittest::V2EnumLite value);
+
+  private:
+  ::protobuf_unittest::V2EnumLite _internal_enum_field() const;
+  void _internal_set_enum_field(::protobuf_unittest::V2EnumLite value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.V2MessageLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t int_field_;
+    int enum_field_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class V1MessageLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.V1MessageLite) */ {
+ public:
+  inline V1MessageLite() : V1MessageLite(nullptr) {}
+  ~V1MessageLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR V1MessageLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline V1MessageLite(const V1MessageLite& from)
+      : V1MessageLite(nullptr, from) {}
+  V1MessageLite(V1MessageLite&& from) noexcept
+    : V1MessageLite() {
+    *this = ::std::move(from);
+  }
+
+  inline V1MessageLite& operator=(const V1MessageLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline V1MessageLite& operator=(V1MessageLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const V1MessageLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const V1MessageLite* internal_default_instance() {
+    return reinterpret_cast<const V1MessageLite*>(
+               &_V1MessageLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(V1MessageLite& a, V1MessageLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(V1MessageLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(V1MessageLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  V1MessageLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<V1MessageLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const V1MessageLite& from);
+  void MergeFrom(const V1MessageLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(V1MessageLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.V1MessageLite";
+  }
+  protected:
+  explicit V1MessageLite(::google::protobuf::Arena* arena);
+  V1MessageLite(::google::protobuf::Arena* arena, const V1MessageLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIntFieldFieldNumber = 1,
+    kEnumFieldFieldNumber = 2,
+  };
+  // required int32 int_field = 1;
+  bool has_int_field() const;
+  void clear_int_field() ;
+  ::int32_t int_field() const;
+  void set_int_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_int_field() const;
+  void _internal_set_int_field(::int32_t value);
+
+  public:
+  // optional .protobuf_unittest.V1EnumLite enum_field = 2 [default = V1_FIRST];
+  bool has_enum_field() const;
+  void clear_enum_field() ;
+  ::protobuf_unittest::V1EnumLite enum_field() const;
+  void set_enum_field(::protobuf_unittest::V1EnumLite value);
+
+  private:
+  ::protobuf_unittest::V1EnumLite _internal_enum_field() const;
+  void _internal_set_enum_field(::protobuf_unittest::V1EnumLite value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.V1MessageLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t int_field_;
+    int enum_field_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestPackedTypesLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestPackedTypesLite) */ {
+ public:
+  inline TestPackedTypesLite() : TestPackedTypesLite(nullptr) {}
+  ~TestPackedTypesLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestPackedTypesLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestPackedTypesLite(const TestPackedTypesLite& from)
+      : TestPackedTypesLite(nullptr, from) {}
+  TestPackedTypesLite(TestPackedTypesLite&& from) noexcept
+    : TestPackedTypesLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestPackedTypesLite& operator=(const TestPackedTypesLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestPackedTypesLite& operator=(TestPackedTypesLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestPackedTypesLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestPackedTypesLite* internal_default_instance() {
+    return reinterpret_cast<const TestPackedTypesLite*>(
+               &_TestPackedTypesLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(TestPackedTypesLite& a, TestPackedTypesLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestPackedTypesLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestPackedTypesLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestPackedTypesLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestPackedTypesLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestPackedTypesLite& from);
+  void MergeFrom(const TestPackedTypesLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestPackedTypesLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestPackedTypesLite";
+  }
+  protected:
+  explicit TestPackedTypesLite(::google::protobuf::Arena* arena);
+  TestPackedTypesLite(::google::protobuf::Arena* arena, const TestPackedTypesLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPackedInt32FieldNumber = 90,
+    kPackedInt64FieldNumber = 91,
+    kPackedUint32FieldNumber = 92,
+    kPackedUint64FieldNumber = 93,
+    kPackedSint32FieldNumber = 94,
+    kPackedSint64FieldNumber = 95,
+    kPackedFixed32FieldNumber = 96,
+    kPackedFixed64FieldNumber = 97,
+    kPackedSfixed32FieldNumber = 98,
+    kPackedSfixed64FieldNumber = 99,
+    kPackedFloatFieldNumber = 100,
+    kPackedDoubleFieldNumber = 101,
+    kPackedBoolFieldNumber = 102,
+    kPackedEnumFieldNumber = 103,
+  };
+  // repeated int32 packed_int32 = 90 [packed = true];
+  int packed_int32_size() const;
+  private:
+  int _internal_packed_int32_size() const;
+
+  public:
+  void clear_packed_int32() ;
+  ::int32_t packed_int32(int index) const;
+  void set_packed_int32(int index, ::int32_t value);
+  void add_packed_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_int32();
+
+  public:
+  // repeated int64 packed_int64 = 91 [packed = true];
+  int packed_int64_size() const;
+  private:
+  int _internal_packed_int64_size() const;
+
+  public:
+  void clear_packed_int64() ;
+  ::int64_t packed_int64(int index) const;
+  void set_packed_int64(int index, ::int64_t value);
+  void add_packed_int64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& packed_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_packed_int64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_packed_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_packed_int64();
+
+  public:
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  int packed_uint32_size() const;
+  private:
+  int _internal_packed_uint32_size() const;
+
+  public:
+  void clear_packed_uint32() ;
+  ::uint32_t packed_uint32(int index) const;
+  void set_packed_uint32(int index, ::uint32_t value);
+  void add_packed_uint32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& packed_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_packed_uint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_packed_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_packed_uint32();
+
+  public:
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  int packed_uint64_size() const;
+  private:
+  int _internal_packed_uint64_size() const;
+
+  public:
+  void clear_packed_uint64() ;
+  ::uint64_t packed_uint64(int index) const;
+  void set_packed_uint64(int index, ::uint64_t value);
+  void add_packed_uint64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& packed_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_packed_uint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_packed_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_packed_uint64();
+
+  public:
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  int packed_sint32_size() const;
+  private:
+  int _internal_packed_sint32_size() const;
+
+  public:
+  void clear_packed_sint32() ;
+  ::int32_t packed_sint32(int index) const;
+  void set_packed_sint32(int index, ::int32_t value);
+  void add_packed_sint32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_sint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_sint32();
+
+  public:
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  int packed_sint64_size() const;
+  private:
+  int _internal_packed_sint64_size() const;
+
+  public:
+  void clear_packed_sint64() ;
+  ::int64_t packed_sint64(int index) const;
+  void set_packed_sint64(int index, ::int64_t value);
+  void add_packed_sint64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& packed_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_packed_sint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_packed_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_packed_sint64();
+
+  public:
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  int packed_fixed32_size() const;
+  private:
+  int _internal_packed_fixed32_size() const;
+
+  public:
+  void clear_packed_fixed32() ;
+  ::uint32_t packed_fixed32(int index) const;
+  void set_packed_fixed32(int index, ::uint32_t value);
+  void add_packed_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& packed_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_packed_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_packed_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_packed_fixed32();
+
+  public:
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  int packed_fixed64_size() const;
+  private:
+  int _internal_packed_fixed64_size() const;
+
+  public:
+  void clear_packed_fixed64() ;
+  ::uint64_t packed_fixed64(int index) const;
+  void set_packed_fixed64(int index, ::uint64_t value);
+  void add_packed_fixed64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& packed_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_packed_fixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_packed_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_packed_fixed64();
+
+  public:
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  int packed_sfixed32_size() const;
+  private:
+  int _internal_packed_sfixed32_size() const;
+
+  public:
+  void clear_packed_sfixed32() ;
+  ::int32_t packed_sfixed32(int index) const;
+  void set_packed_sfixed32(int index, ::int32_t value);
+  void add_packed_sfixed32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_sfixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_sfixed32();
+
+  public:
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  int packed_sfixed64_size() const;
+  private:
+  int _internal_packed_sfixed64_size() const;
+
+  public:
+  void clear_packed_sfixed64() ;
+  ::int64_t packed_sfixed64(int index) const;
+  void set_packed_sfixed64(int index, ::int64_t value);
+  void add_packed_sfixed64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& packed_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_packed_sfixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_packed_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_packed_sfixed64();
+
+  public:
+  // repeated float packed_float = 100 [packed = true];
+  int packed_float_size() const;
+  private:
+  int _internal_packed_float_size() const;
+
+  public:
+  void clear_packed_float() ;
+  float packed_float(int index) const;
+  void set_packed_float(int index, float value);
+  void add_packed_float(float value);
+  const ::google::protobuf::RepeatedField<float>& packed_float() const;
+  ::google::protobuf::RepeatedField<float>* mutable_packed_float();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_packed_float() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_packed_float();
+
+  public:
+  // repeated double packed_double = 101 [packed = true];
+  int packed_double_size() const;
+  private:
+  int _internal_packed_double_size() const;
+
+  public:
+  void clear_packed_double() ;
+  double packed_double(int index) const;
+  void set_packed_double(int index, double value);
+  void add_packed_double(double value);
+  const ::google::protobuf::RepeatedField<double>& packed_double() const;
+  ::google::protobuf::RepeatedField<double>* mutable_packed_double();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_packed_double() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_packed_double();
+
+  public:
+  // repeated bool packed_bool = 102 [packed = true];
+  int packed_bool_size() const;
+  private:
+  int _internal_packed_bool_size() const;
+
+  public:
+  void clear_packed_bool() ;
+  bool packed_bool(int index) const;
+  void set_packed_bool(int index, bool value);
+  void add_packed_bool(bool value);
+  const ::google::protobuf::RepeatedField<bool>& packed_bool() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_packed_bool();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_packed_bool() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_packed_bool();
+
+  public:
+  // repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+  int packed_enum_size() const;
+  private:
+  int _internal_packed_enum_size() const;
+
+  public:
+  void clear_packed_enum() ;
+  public:
+  ::protobuf_unittest::ForeignEnumLite packed_enum(int index) const;
+  void set_packed_enum(int index, ::protobuf_unittest::ForeignEnumLite value);
+  void add_packed_enum(::protobuf_unittest::ForeignEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& packed_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_packed_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_packed_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_packed_enum();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestPackedTypesLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      4, 14, 1,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::int32_t> packed_int32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_int32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> packed_int64_;
+    mutable ::google::protobuf::internal::CachedSize _packed_int64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> packed_uint32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_uint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint64_t> packed_uint64_;
+    mutable ::google::protobuf::internal::CachedSize _packed_uint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int32_t> packed_sint32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_sint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> packed_sint64_;
+    mutable ::google::protobuf::internal::CachedSize _packed_sint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> packed_fixed32_;
+    ::google::protobuf::RepeatedField<::uint64_t> packed_fixed64_;
+    ::google::protobuf::RepeatedField<::int32_t> packed_sfixed32_;
+    ::google::protobuf::RepeatedField<::int64_t> packed_sfixed64_;
+    ::google::protobuf::RepeatedField<float> packed_float_;
+    ::google::protobuf::RepeatedField<double> packed_double_;
+    ::google::protobuf::RepeatedField<bool> packed_bool_;
+    ::google::protobuf::RepeatedField<int> packed_enum_;
+    mutable ::google::protobuf::internal::CachedSize _packed_enum_cached_byte_size_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestPackedExtensionsLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestPackedExtensionsLite) */ {
+ public:
+  inline TestPackedExtensionsLite() : TestPackedExtensionsLite(nullptr) {}
+  ~TestPackedExtensionsLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestPackedExtensionsLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestPackedExtensionsLite(const TestPackedExtensionsLite& from)
+      : TestPackedExtensionsLite(nullptr, from) {}
+  TestPackedExtensionsLite(TestPackedExtensionsLite&& from) noexcept
+    : TestPackedExtensionsLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestPackedExtensionsLite& operator=(const TestPackedExtensionsLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestPackedExtensionsLite& operator=(TestPackedExtensionsLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestPackedExtensionsLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestPackedExtensionsLite* internal_default_instance() {
+    return reinterpret_cast<const TestPackedExtensionsLite*>(
+               &_TestPackedExtensionsLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(TestPackedExtensionsLite& a, TestPackedExtensionsLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestPackedExtensionsLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestPackedExtensionsLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestPackedExtensionsLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestPackedExtensionsLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestPackedExtensionsLite& from);
+  void MergeFrom(const TestPackedExtensionsLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestPackedExtensionsLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestPackedExtensionsLite";
+  }
+  protected:
+  explicit TestPackedExtensionsLite(::google::protobuf::Arena* arena);
+  TestPackedExtensionsLite(::google::protobuf::Arena* arena, const TestPackedExtensionsLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestPackedExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestPackedExtensionsLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestNestedExtensionLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestNestedExtensionLite) */ {
+ public:
+  inline TestNestedExtensionLite() : TestNestedExtensionLite(nullptr) {}
+  ~TestNestedExtensionLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedExtensionLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestNestedExtensionLite(const TestNestedExtensionLite& from)
+      : TestNestedExtensionLite(nullptr, from) {}
+  TestNestedExtensionLite(TestNestedExtensionLite&& from) noexcept
+    : TestNestedExtensionLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestNestedExtensionLite& operator=(const TestNestedExtensionLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestNestedExtensionLite& operator=(TestNestedExtensionLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestNestedExtensionLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestNestedExtensionLite* internal_default_instance() {
+    return reinterpret_cast<const TestNestedExtensionLite*>(
+               &_TestNestedExtensionLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(TestNestedExtensionLite& a, TestNestedExtensionLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestNestedExtensionLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestNestedExtensionLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestNestedExtensionLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestNestedExtensionLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestNestedExtensionLite& from);
+  void MergeFrom(const TestNestedExtensionLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestNestedExtensionLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestNestedExtensionLite";
+  }
+  protected:
+  explicit TestNestedExtensionLite(::google::protobuf::Arena* arena);
+  TestNestedExtensionLite(::google::protobuf::Arena* arena, const TestNestedExtensionLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  static const int kNestedExtensionFieldNumber = 12345;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+      ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+    nested_extension;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestNestedExtensionLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMessageSetLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMessageSetLite) */ {
+ public:
+  inline TestMessageSetLite() : TestMessageSetLite(nullptr) {}
+  ~TestMessageSetLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMessageSetLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMessageSetLite(const TestMessageSetLite& from)
+      : TestMessageSetLite(nullptr, from) {}
+  TestMessageSetLite(TestMessageSetLite&& from) noexcept
+    : TestMessageSetLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageSetLite& operator=(const TestMessageSetLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageSetLite& operator=(TestMessageSetLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestMessageSetLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMessageSetLite* internal_default_instance() {
+    return reinterpret_cast<const TestMessageSetLite*>(
+               &_TestMessageSetLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(TestMessageSetLite& a, TestMessageSetLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageSetLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageSetLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMessageSetLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMessageSetLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestMessageSetLite& from);
+  void MergeFrom(const TestMessageSetLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMessageSetLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestMessageSetLite";
+  }
+  protected:
+  explicit TestMessageSetLite(::google::protobuf::Arena* arena);
+  TestMessageSetLite(::google::protobuf::Arena* arena, const TestMessageSetLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestMessageSetLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageSetLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+class TestHugeFieldNumbersLite_OptionalGroup final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup) */ {
+ public:
+  inline TestHugeFieldNumbersLite_OptionalGroup() : TestHugeFieldNumbersLite_OptionalGroup(nullptr) {}
+  ~TestHugeFieldNumbersLite_OptionalGroup() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestHugeFieldNumbersLite_OptionalGroup(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestHugeFieldNumbersLite_OptionalGroup(const TestHugeFieldNumbersLite_OptionalGroup& from)
+      : TestHugeFieldNumbersLite_OptionalGroup(nullptr, from) {}
+  TestHugeFieldNumbersLite_OptionalGroup(TestHugeFieldNumbersLite_OptionalGroup&& from) noexcept
+    : TestHugeFieldNumbersLite_OptionalGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline TestHugeFieldNumbersLite_OptionalGroup& operator=(const TestHugeFieldNumbersLite_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestHugeFieldNumbersLite_OptionalGroup& operator=(TestHugeFieldNumbersLite_OptionalGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestHugeFieldNumbersLite_OptionalGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestHugeFieldNumbersLite_OptionalGroup* internal_default_instance() {
+    return reinterpret_cast<const TestHugeFieldNumbersLite_OptionalGroup*>(
+               &_TestHugeFieldNumbersLite_OptionalGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(TestHugeFieldNumbersLite_OptionalGroup& a, TestHugeFieldNumbersLite_OptionalGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestHugeFieldNumbersLite_OptionalGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestHugeFieldNumbersLite_OptionalGroup* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestHugeFieldNumbersLite_OptionalGroup* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestHugeFieldNumbersLite_OptionalGroup>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestHugeFieldNumbersLite_OptionalGroup& from);
+  void MergeFrom(const TestHugeFieldNumbersLite_OptionalGroup& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestHugeFieldNumbersLite_OptionalGroup* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup";
+  }
+  protected:
+  explicit TestHugeFieldNumbersLite_OptionalGroup(::google::protobuf::Arena* arena);
+  TestHugeFieldNumbersLite_OptionalGroup(::google::protobuf::Arena* arena, const TestHugeFieldNumbersLite_OptionalGroup& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGroupAFieldNumber = 536870009,
+  };
+  // optional int32 group_a = 536870009;
+  bool has_group_a() const;
+  void clear_group_a() ;
+  ::int32_t group_a() const;
+  void set_group_a(::int32_t value);
+
+  private:
+  ::int32_t _internal_group_a() const;
+  void _internal_set_group_a(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t group_a_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestEmptyMessageWithExtensionsLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEmptyMessageWithExtensionsLite) */ {
+ public:
+  inline TestEmptyMessageWithExtensionsLite() : TestEmptyMessageWithExtensionsLite(nullptr) {}
+  ~TestEmptyMessageWithExtensionsLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEmptyMessageWithExtensionsLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEmptyMessageWithExtensionsLite(const TestEmptyMessageWithExtensionsLite& from)
+      : TestEmptyMessageWithExtensionsLite(nullptr, from) {}
+  TestEmptyMessageWithExtensionsLite(TestEmptyMessageWithExtensionsLite&& from) noexcept
+    : TestEmptyMessageWithExtensionsLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEmptyMessageWithExtensionsLite& operator=(const TestEmptyMessageWithExtensionsLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEmptyMessageWithExtensionsLite& operator=(TestEmptyMessageWithExtensionsLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestEmptyMessageWithExtensionsLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEmptyMessageWithExtensionsLite* internal_default_instance() {
+    return reinterpret_cast<const TestEmptyMessageWithExtensionsLite*>(
+               &_TestEmptyMessageWithExtensionsLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(TestEmptyMessageWithExtensionsLite& a, TestEmptyMessageWithExtensionsLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEmptyMessageWithExtensionsLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEmptyMessageWithExtensionsLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEmptyMessageWithExtensionsLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEmptyMessageWithExtensionsLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestEmptyMessageWithExtensionsLite& from);
+  void MergeFrom(const TestEmptyMessageWithExtensionsLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEmptyMessageWithExtensionsLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestEmptyMessageWithExtensionsLite";
+  }
+  protected:
+  explicit TestEmptyMessageWithExtensionsLite(::google::protobuf::Arena* arena);
+  TestEmptyMessageWithExtensionsLite(::google::protobuf::Arena* arena, const TestEmptyMessageWithExtensionsLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestEmptyMessageWithExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestEmptyMessageLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEmptyMessageLite) */ {
+ public:
+  inline TestEmptyMessageLite() : TestEmptyMessageLite(nullptr) {}
+  ~TestEmptyMessageLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEmptyMessageLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEmptyMessageLite(const TestEmptyMessageLite& from)
+      : TestEmptyMessageLite(nullptr, from) {}
+  TestEmptyMessageLite(TestEmptyMessageLite&& from) noexcept
+    : TestEmptyMessageLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEmptyMessageLite& operator=(const TestEmptyMessageLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEmptyMessageLite& operator=(TestEmptyMessageLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestEmptyMessageLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEmptyMessageLite* internal_default_instance() {
+    return reinterpret_cast<const TestEmptyMessageLite*>(
+               &_TestEmptyMessageLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TestEmptyMessageLite& a, TestEmptyMessageLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEmptyMessageLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEmptyMessageLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEmptyMessageLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEmptyMessageLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestEmptyMessageLite& from);
+  void MergeFrom(const TestEmptyMessageLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEmptyMessageLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestEmptyMessageLite";
+  }
+  protected:
+  explicit TestEmptyMessageLite(::google::protobuf::Arena* arena);
+  TestEmptyMessageLite(::google::protobuf::Arena* arena, const TestEmptyMessageLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEmptyMessageLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestDeprecatedLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestDeprecatedLite) */ {
+ public:
+  inline TestDeprecatedLite() : TestDeprecatedLite(nullptr) {}
+  ~TestDeprecatedLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestDeprecatedLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestDeprecatedLite(const TestDeprecatedLite& from)
+      : TestDeprecatedLite(nullptr, from) {}
+  TestDeprecatedLite(TestDeprecatedLite&& from) noexcept
+    : TestDeprecatedLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestDeprecatedLite& operator=(const TestDeprecatedLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestDeprecatedLite& operator=(TestDeprecatedLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestDeprecatedLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestDeprecatedLite* internal_default_instance() {
+    return reinterpret_cast<const TestDeprecatedLite*>(
+               &_TestDeprecatedLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TestDeprecatedLite& a, TestDeprecatedLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestDeprecatedLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestDeprecatedLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestDeprecatedLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestDeprecatedLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestDeprecatedLite& from);
+  void MergeFrom(const TestDeprecatedLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestDeprecatedLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestDeprecatedLite";
+  }
+  protected:
+  explicit TestDeprecatedLite(::google::protobuf::Arena* arena);
+  TestDeprecatedLite(::google::protobuf::Arena* arena, const TestDeprecatedLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeprecatedField3FieldNumber = 3,
+    kDeprecatedField4FieldNumber = 4,
+    kDeprecatedFieldFieldNumber = 1,
+    kDeprecatedField2FieldNumber = 2,
+  };
+  // optional string deprecated_field3 = 3 [deprecated = true];
+  [[deprecated]]  bool has_deprecated_field3() const;
+  [[deprecated]]  void clear_deprecated_field3() ;
+  [[deprecated]] const std::string& deprecated_field3() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  [[deprecated]] void set_deprecated_field3(Arg_&& arg, Args_... args);
+  [[deprecated]] std::string* mutable_deprecated_field3();
+  [[deprecated]] PROTOBUF_NODISCARD std::string* release_deprecated_field3();
+  [[deprecated]] void set_allocated_deprecated_field3(std::string* value);
+
+  private:
+  const std::string& _internal_deprecated_field3() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_deprecated_field3(
+      const std::string& value);
+  std::string* _internal_mutable_deprecated_field3();
+
+  public:
+  // optional .protobuf_unittest.TestDeprecatedLite deprecated_field4 = 4 [deprecated = true];
+  [[deprecated]]  bool has_deprecated_field4() const;
+  [[deprecated]]  void clear_deprecated_field4() ;
+  [[deprecated]] const ::protobuf_unittest::TestDeprecatedLite& deprecated_field4() const;
+  [[deprecated]] PROTOBUF_NODISCARD ::protobuf_unittest::TestDeprecatedLite* release_deprecated_field4();
+  [[deprecated]] ::protobuf_unittest::TestDeprecatedLite* mutable_deprecated_field4();
+  [[deprecated]] void set_allocated_deprecated_field4(::protobuf_unittest::TestDeprecatedLite* value);
+  [[deprecated]] void unsafe_arena_set_allocated_deprecated_field4(::protobuf_unittest::TestDeprecatedLite* value);
+  [[deprecated]] ::protobuf_unittest::TestDeprecatedLite* unsafe_arena_release_deprecated_field4();
+
+  private:
+  const ::protobuf_unittest::TestDeprecatedLite& _internal_deprecated_field4() const;
+  ::protobuf_unittest::TestDeprecatedLite* _internal_mutable_deprecated_field4();
+
+  public:
+  // optional int32 deprecated_field = 1 [deprecated = true];
+  [[deprecated]]  bool has_deprecated_field() const;
+  [[deprecated]]  void clear_deprecated_field() ;
+  [[deprecated]] ::int32_t deprecated_field() const;
+  [[deprecated]] void set_deprecated_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_deprecated_field() const;
+  void _internal_set_deprecated_field(::int32_t value);
+
+  public:
+  // required int32 deprecated_field2 = 2 [deprecated = true];
+  [[deprecated]]  bool has_deprecated_field2() const;
+  [[deprecated]]  void clear_deprecated_field2() ;
+  [[deprecated]] ::int32_t deprecated_field2() const;
+  [[deprecated]] void set_deprecated_field2(::int32_t value);
+
+  private:
+  ::int32_t _internal_deprecated_field2() const;
+  void _internal_set_deprecated_field2(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDeprecatedLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr deprecated_field3_;
+    ::protobuf_unittest::TestDeprecatedLite* deprecated_field4_;
+    ::int32_t deprecated_field_;
+    ::int32_t deprecated_field2_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypesLite_RepeatedGroup final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAllTypesLite.RepeatedGroup) */ {
+ public:
+  inline TestAllTypesLite_RepeatedGroup() : TestAllTypesLite_RepeatedGroup(nullptr) {}
+  ~TestAllTypesLite_RepeatedGroup() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypesLite_RepeatedGroup(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypesLite_RepeatedGroup(const TestAllTypesLite_RepeatedGroup& from)
+      : TestAllTypesLite_RepeatedGroup(nullptr, from) {}
+  TestAllTypesLite_RepeatedGroup(TestAllTypesLite_RepeatedGroup&& from) noexcept
+    : TestAllTypesLite_RepeatedGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypesLite_RepeatedGroup& operator=(const TestAllTypesLite_RepeatedGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypesLite_RepeatedGroup& operator=(TestAllTypesLite_RepeatedGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestAllTypesLite_RepeatedGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllTypesLite_RepeatedGroup* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypesLite_RepeatedGroup*>(
+               &_TestAllTypesLite_RepeatedGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TestAllTypesLite_RepeatedGroup& a, TestAllTypesLite_RepeatedGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypesLite_RepeatedGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypesLite_RepeatedGroup* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypesLite_RepeatedGroup* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypesLite_RepeatedGroup>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestAllTypesLite_RepeatedGroup& from);
+  void MergeFrom(const TestAllTypesLite_RepeatedGroup& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypesLite_RepeatedGroup* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAllTypesLite.RepeatedGroup";
+  }
+  protected:
+  explicit TestAllTypesLite_RepeatedGroup(::google::protobuf::Arena* arena);
+  TestAllTypesLite_RepeatedGroup(::google::protobuf::Arena* arena, const TestAllTypesLite_RepeatedGroup& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 47,
+  };
+  // optional int32 a = 47;
+  bool has_a() const;
+  void clear_a() ;
+  ::int32_t a() const;
+  void set_a(::int32_t value);
+
+  private:
+  ::int32_t _internal_a() const;
+  void _internal_set_a(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t a_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypesLite_OptionalGroup final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAllTypesLite.OptionalGroup) */ {
+ public:
+  inline TestAllTypesLite_OptionalGroup() : TestAllTypesLite_OptionalGroup(nullptr) {}
+  ~TestAllTypesLite_OptionalGroup() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypesLite_OptionalGroup(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypesLite_OptionalGroup(const TestAllTypesLite_OptionalGroup& from)
+      : TestAllTypesLite_OptionalGroup(nullptr, from) {}
+  TestAllTypesLite_OptionalGroup(TestAllTypesLite_OptionalGroup&& from) noexcept
+    : TestAllTypesLite_OptionalGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypesLite_OptionalGroup& operator=(const TestAllTypesLite_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypesLite_OptionalGroup& operator=(TestAllTypesLite_OptionalGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestAllTypesLite_OptionalGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllTypesLite_OptionalGroup* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypesLite_OptionalGroup*>(
+               &_TestAllTypesLite_OptionalGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestAllTypesLite_OptionalGroup& a, TestAllTypesLite_OptionalGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypesLite_OptionalGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypesLite_OptionalGroup* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypesLite_OptionalGroup* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypesLite_OptionalGroup>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestAllTypesLite_OptionalGroup& from);
+  void MergeFrom(const TestAllTypesLite_OptionalGroup& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypesLite_OptionalGroup* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAllTypesLite.OptionalGroup";
+  }
+  protected:
+  explicit TestAllTypesLite_OptionalGroup(::google::protobuf::Arena* arena);
+  TestAllTypesLite_OptionalGroup(::google::protobuf::Arena* arena, const TestAllTypesLite_OptionalGroup& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 17,
+  };
+  // optional int32 a = 17;
+  bool has_a() const;
+  void clear_a() ;
+  ::int32_t a() const;
+  void set_a(::int32_t value);
+
+  private:
+  ::int32_t _internal_a() const;
+  void _internal_set_a(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t a_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypesLite_NestedMessage2 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAllTypesLite.NestedMessage2) */ {
+ public:
+  inline TestAllTypesLite_NestedMessage2() : TestAllTypesLite_NestedMessage2(nullptr) {}
+  ~TestAllTypesLite_NestedMessage2() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypesLite_NestedMessage2(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypesLite_NestedMessage2(const TestAllTypesLite_NestedMessage2& from)
+      : TestAllTypesLite_NestedMessage2(nullptr, from) {}
+  TestAllTypesLite_NestedMessage2(TestAllTypesLite_NestedMessage2&& from) noexcept
+    : TestAllTypesLite_NestedMessage2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypesLite_NestedMessage2& operator=(const TestAllTypesLite_NestedMessage2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypesLite_NestedMessage2& operator=(TestAllTypesLite_NestedMessage2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestAllTypesLite_NestedMessage2& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllTypesLite_NestedMessage2* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypesLite_NestedMessage2*>(
+               &_TestAllTypesLite_NestedMessage2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestAllTypesLite_NestedMessage2& a, TestAllTypesLite_NestedMessage2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypesLite_NestedMessage2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypesLite_NestedMessage2* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypesLite_NestedMessage2* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypesLite_NestedMessage2>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestAllTypesLite_NestedMessage2& from);
+  void MergeFrom(const TestAllTypesLite_NestedMessage2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypesLite_NestedMessage2* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAllTypesLite.NestedMessage2";
+  }
+  protected:
+  explicit TestAllTypesLite_NestedMessage2(::google::protobuf::Arena* arena);
+  TestAllTypesLite_NestedMessage2(::google::protobuf::Arena* arena, const TestAllTypesLite_NestedMessage2& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDdFieldNumber = 1,
+  };
+  // optional int32 dd = 1;
+  bool has_dd() const;
+  void clear_dd() ;
+  ::int32_t dd() const;
+  void set_dd(::int32_t value);
+
+  private:
+  ::int32_t _internal_dd() const;
+  void _internal_set_dd(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.NestedMessage2)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t dd_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypesLite_NestedMessage final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAllTypesLite.NestedMessage) */ {
+ public:
+  inline TestAllTypesLite_NestedMessage() : TestAllTypesLite_NestedMessage(nullptr) {}
+  ~TestAllTypesLite_NestedMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypesLite_NestedMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypesLite_NestedMessage(const TestAllTypesLite_NestedMessage& from)
+      : TestAllTypesLite_NestedMessage(nullptr, from) {}
+  TestAllTypesLite_NestedMessage(TestAllTypesLite_NestedMessage&& from) noexcept
+    : TestAllTypesLite_NestedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypesLite_NestedMessage& operator=(const TestAllTypesLite_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypesLite_NestedMessage& operator=(TestAllTypesLite_NestedMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestAllTypesLite_NestedMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllTypesLite_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypesLite_NestedMessage*>(
+               &_TestAllTypesLite_NestedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestAllTypesLite_NestedMessage& a, TestAllTypesLite_NestedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypesLite_NestedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypesLite_NestedMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypesLite_NestedMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypesLite_NestedMessage>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestAllTypesLite_NestedMessage& from);
+  void MergeFrom(const TestAllTypesLite_NestedMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypesLite_NestedMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAllTypesLite.NestedMessage";
+  }
+  protected:
+  explicit TestAllTypesLite_NestedMessage(::google::protobuf::Arena* arena);
+  TestAllTypesLite_NestedMessage(::google::protobuf::Arena* arena, const TestAllTypesLite_NestedMessage& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDdFieldNumber = 3,
+    kCcFieldNumber = 2,
+    kBbFieldNumber = 1,
+  };
+  // repeated int32 dd = 3 [packed = true];
+  int dd_size() const;
+  private:
+  int _internal_dd_size() const;
+
+  public:
+  void clear_dd() ;
+  ::int32_t dd(int index) const;
+  void set_dd(int index, ::int32_t value);
+  void add_dd(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& dd() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_dd();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_dd() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_dd();
+
+  public:
+  // optional int64 cc = 2;
+  bool has_cc() const;
+  void clear_cc() ;
+  ::int64_t cc() const;
+  void set_cc(::int64_t value);
+
+  private:
+  ::int64_t _internal_cc() const;
+  void _internal_set_cc(::int64_t value);
+
+  public:
+  // optional int32 bb = 1;
+  bool has_bb() const;
+  void clear_bb() ;
+  ::int32_t bb() const;
+  void set_bb(::int32_t value);
+
+  private:
+  ::int32_t _internal_bb() const;
+  void _internal_set_bb(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.NestedMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<::int32_t> dd_;
+    mutable ::google::protobuf::internal::CachedSize _dd_cached_byte_size_;
+    ::int64_t cc_;
+    ::int32_t bb_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllExtensionsLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAllExtensionsLite) */ {
+ public:
+  inline TestAllExtensionsLite() : TestAllExtensionsLite(nullptr) {}
+  ~TestAllExtensionsLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllExtensionsLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllExtensionsLite(const TestAllExtensionsLite& from)
+      : TestAllExtensionsLite(nullptr, from) {}
+  TestAllExtensionsLite(TestAllExtensionsLite&& from) noexcept
+    : TestAllExtensionsLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllExtensionsLite& operator=(const TestAllExtensionsLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllExtensionsLite& operator=(TestAllExtensionsLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestAllExtensionsLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllExtensionsLite* internal_default_instance() {
+    return reinterpret_cast<const TestAllExtensionsLite*>(
+               &_TestAllExtensionsLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(TestAllExtensionsLite& a, TestAllExtensionsLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllExtensionsLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllExtensionsLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllExtensionsLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllExtensionsLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestAllExtensionsLite& from);
+  void MergeFrom(const TestAllExtensionsLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllExtensionsLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAllExtensionsLite";
+  }
+  protected:
+  explicit TestAllExtensionsLite(::google::protobuf::Arena* arena);
+  TestAllExtensionsLite(::google::protobuf::Arena* arena, const TestAllExtensionsLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestAllExtensionsLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllExtensionsLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class RepeatedGroup_extension_lite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.RepeatedGroup_extension_lite) */ {
+ public:
+  inline RepeatedGroup_extension_lite() : RepeatedGroup_extension_lite(nullptr) {}
+  ~RepeatedGroup_extension_lite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR RepeatedGroup_extension_lite(::google::protobuf::internal::ConstantInitialized);
+
+  inline RepeatedGroup_extension_lite(const RepeatedGroup_extension_lite& from)
+      : RepeatedGroup_extension_lite(nullptr, from) {}
+  RepeatedGroup_extension_lite(RepeatedGroup_extension_lite&& from) noexcept
+    : RepeatedGroup_extension_lite() {
+    *this = ::std::move(from);
+  }
+
+  inline RepeatedGroup_extension_lite& operator=(const RepeatedGroup_extension_lite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RepeatedGroup_extension_lite& operator=(RepeatedGroup_extension_lite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const RepeatedGroup_extension_lite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RepeatedGroup_extension_lite* internal_default_instance() {
+    return reinterpret_cast<const RepeatedGroup_extension_lite*>(
+               &_RepeatedGroup_extension_lite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(RepeatedGroup_extension_lite& a, RepeatedGroup_extension_lite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RepeatedGroup_extension_lite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RepeatedGroup_extension_lite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RepeatedGroup_extension_lite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RepeatedGroup_extension_lite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const RepeatedGroup_extension_lite& from);
+  void MergeFrom(const RepeatedGroup_extension_lite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(RepeatedGroup_extension_lite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.RepeatedGroup_extension_lite";
+  }
+  protected:
+  explicit RepeatedGroup_extension_lite(::google::protobuf::Arena* arena);
+  RepeatedGroup_extension_lite(::google::protobuf::Arena* arena, const RepeatedGroup_extension_lite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 47,
+  };
+  // optional int32 a = 47;
+  bool has_a() const;
+  void clear_a() ;
+  ::int32_t a() const;
+  void set_a(::int32_t value);
+
+  private:
+  ::int32_t _internal_a() const;
+  void _internal_set_a(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.RepeatedGroup_extension_lite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t a_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class RecursiveMessage final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.RecursiveMessage) */ {
+ public:
+  inline RecursiveMessage() : RecursiveMessage(nullptr) {}
+  ~RecursiveMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR RecursiveMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline RecursiveMessage(const RecursiveMessage& from)
+      : RecursiveMessage(nullptr, from) {}
+  RecursiveMessage(RecursiveMessage&& from) noexcept
+    : RecursiveMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RecursiveMessage& operator=(const RecursiveMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecursiveMessage& operator=(RecursiveMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const RecursiveMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecursiveMessage* internal_default_instance() {
+    return reinterpret_cast<const RecursiveMessage*>(
+               &_RecursiveMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(RecursiveMessage& a, RecursiveMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecursiveMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecursiveMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecursiveMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecursiveMessage>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const RecursiveMessage& from);
+  void MergeFrom(const RecursiveMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(RecursiveMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.RecursiveMessage";
+  }
+  protected:
+  explicit RecursiveMessage(::google::protobuf::Arena* arena);
+  RecursiveMessage(::google::protobuf::Arena* arena, const RecursiveMessage& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 2,
+    kRecurseFieldNumber = 1,
+  };
+  // optional bytes payload = 2;
+  bool has_payload() const;
+  void clear_payload() ;
+  const std::string& payload() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_payload(Arg_&& arg, Args_... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* value);
+
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(
+      const std::string& value);
+  std::string* _internal_mutable_payload();
+
+  public:
+  // optional .protobuf_unittest.RecursiveMessage recurse = 1;
+  bool has_recurse() const;
+  void clear_recurse() ;
+  const ::protobuf_unittest::RecursiveMessage& recurse() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::RecursiveMessage* release_recurse();
+  ::protobuf_unittest::RecursiveMessage* mutable_recurse();
+  void set_allocated_recurse(::protobuf_unittest::RecursiveMessage* value);
+  void unsafe_arena_set_allocated_recurse(::protobuf_unittest::RecursiveMessage* value);
+  ::protobuf_unittest::RecursiveMessage* unsafe_arena_release_recurse();
+
+  private:
+  const ::protobuf_unittest::RecursiveMessage& _internal_recurse() const;
+  ::protobuf_unittest::RecursiveMessage* _internal_mutable_recurse();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.RecursiveMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr payload_;
+    ::protobuf_unittest::RecursiveMessage* recurse_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class PackedInt32 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.PackedInt32) */ {
+ public:
+  inline PackedInt32() : PackedInt32(nullptr) {}
+  ~PackedInt32() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR PackedInt32(::google::protobuf::internal::ConstantInitialized);
+
+  inline PackedInt32(const PackedInt32& from)
+      : PackedInt32(nullptr, from) {}
+  PackedInt32(PackedInt32&& from) noexcept
+    : PackedInt32() {
+    *this = ::std::move(from);
+  }
+
+  inline PackedInt32& operator=(const PackedInt32& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedInt32& operator=(PackedInt32&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const PackedInt32& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PackedInt32* internal_default_instance() {
+    return reinterpret_cast<const PackedInt32*>(
+               &_PackedInt32_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(PackedInt32& a, PackedInt32& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackedInt32* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackedInt32* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PackedInt32* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackedInt32>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const PackedInt32& from);
+  void MergeFrom(const PackedInt32& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(PackedInt32* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.PackedInt32";
+  }
+  protected:
+  explicit PackedInt32(::google::protobuf::Arena* arena);
+  PackedInt32(::google::protobuf::Arena* arena, const PackedInt32& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 2048,
+  };
+  // repeated int32 repeated_int32 = 2048 [packed = true];
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.PackedInt32)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int32_cached_byte_size_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class PackedFixed32 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.PackedFixed32) */ {
+ public:
+  inline PackedFixed32() : PackedFixed32(nullptr) {}
+  ~PackedFixed32() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR PackedFixed32(::google::protobuf::internal::ConstantInitialized);
+
+  inline PackedFixed32(const PackedFixed32& from)
+      : PackedFixed32(nullptr, from) {}
+  PackedFixed32(PackedFixed32&& from) noexcept
+    : PackedFixed32() {
+    *this = ::std::move(from);
+  }
+
+  inline PackedFixed32& operator=(const PackedFixed32& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedFixed32& operator=(PackedFixed32&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const PackedFixed32& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PackedFixed32* internal_default_instance() {
+    return reinterpret_cast<const PackedFixed32*>(
+               &_PackedFixed32_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(PackedFixed32& a, PackedFixed32& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackedFixed32* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackedFixed32* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PackedFixed32* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackedFixed32>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const PackedFixed32& from);
+  void MergeFrom(const PackedFixed32& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(PackedFixed32* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.PackedFixed32";
+  }
+  protected:
+  explicit PackedFixed32(::google::protobuf::Arena* arena);
+  PackedFixed32(::google::protobuf::Arena* arena, const PackedFixed32& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedFixed32FieldNumber = 2048,
+  };
+  // repeated fixed32 repeated_fixed32 = 2048 [packed = true];
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+
+  public:
+  void clear_repeated_fixed32() ;
+  ::uint32_t repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::uint32_t value);
+  void add_repeated_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_fixed32();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.PackedFixed32)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_fixed32_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class OptionalGroup_extension_lite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.OptionalGroup_extension_lite) */ {
+ public:
+  inline OptionalGroup_extension_lite() : OptionalGroup_extension_lite(nullptr) {}
+  ~OptionalGroup_extension_lite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR OptionalGroup_extension_lite(::google::protobuf::internal::ConstantInitialized);
+
+  inline OptionalGroup_extension_lite(const OptionalGroup_extension_lite& from)
+      : OptionalGroup_extension_lite(nullptr, from) {}
+  OptionalGroup_extension_lite(OptionalGroup_extension_lite&& from) noexcept
+    : OptionalGroup_extension_lite() {
+    *this = ::std::move(from);
+  }
+
+  inline OptionalGroup_extension_lite& operator=(const OptionalGroup_extension_lite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OptionalGroup_extension_lite& operator=(OptionalGroup_extension_lite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const OptionalGroup_extension_lite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OptionalGroup_extension_lite* internal_default_instance() {
+    return reinterpret_cast<const OptionalGroup_extension_lite*>(
+               &_OptionalGroup_extension_lite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(OptionalGroup_extension_lite& a, OptionalGroup_extension_lite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OptionalGroup_extension_lite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OptionalGroup_extension_lite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OptionalGroup_extension_lite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OptionalGroup_extension_lite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const OptionalGroup_extension_lite& from);
+  void MergeFrom(const OptionalGroup_extension_lite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(OptionalGroup_extension_lite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.OptionalGroup_extension_lite";
+  }
+  protected:
+  explicit OptionalGroup_extension_lite(::google::protobuf::Arena* arena);
+  OptionalGroup_extension_lite(::google::protobuf::Arena* arena, const OptionalGroup_extension_lite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 17,
+  };
+  // optional int32 a = 17;
+  bool has_a() const;
+  void clear_a() ;
+  ::int32_t a() const;
+  void set_a(::int32_t value);
+
+  private:
+  ::int32_t _internal_a() const;
+  void _internal_set_a(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.OptionalGroup_extension_lite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t a_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class NonPackedInt32 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.NonPackedInt32) */ {
+ public:
+  inline NonPackedInt32() : NonPackedInt32(nullptr) {}
+  ~NonPackedInt32() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR NonPackedInt32(::google::protobuf::internal::ConstantInitialized);
+
+  inline NonPackedInt32(const NonPackedInt32& from)
+      : NonPackedInt32(nullptr, from) {}
+  NonPackedInt32(NonPackedInt32&& from) noexcept
+    : NonPackedInt32() {
+    *this = ::std::move(from);
+  }
+
+  inline NonPackedInt32& operator=(const NonPackedInt32& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NonPackedInt32& operator=(NonPackedInt32&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const NonPackedInt32& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NonPackedInt32* internal_default_instance() {
+    return reinterpret_cast<const NonPackedInt32*>(
+               &_NonPackedInt32_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(NonPackedInt32& a, NonPackedInt32& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NonPackedInt32* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NonPackedInt32* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NonPackedInt32* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NonPackedInt32>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const NonPackedInt32& from);
+  void MergeFrom(const NonPackedInt32& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(NonPackedInt32* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.NonPackedInt32";
+  }
+  protected:
+  explicit NonPackedInt32(::google::protobuf::Arena* arena);
+  NonPackedInt32(::google::protobuf::Arena* arena, const NonPackedInt32& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 2048,
+  };
+  // repeated int32 repeated_int32 = 2048;
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.NonPackedInt32)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class NonPackedFixed32 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.NonPackedFixed32) */ {
+ public:
+  inline NonPackedFixed32() : NonPackedFixed32(nullptr) {}
+  ~NonPackedFixed32() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR NonPackedFixed32(::google::protobuf::internal::ConstantInitialized);
+
+  inline NonPackedFixed32(const NonPackedFixed32& from)
+      : NonPackedFixed32(nullptr, from) {}
+  NonPackedFixed32(NonPackedFixed32&& from) noexcept
+    : NonPackedFixed32() {
+    *this = ::std::move(from);
+  }
+
+  inline NonPackedFixed32& operator=(const NonPackedFixed32& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NonPackedFixed32& operator=(NonPackedFixed32&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const NonPackedFixed32& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NonPackedFixed32* internal_default_instance() {
+    return reinterpret_cast<const NonPackedFixed32*>(
+               &_NonPackedFixed32_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(NonPackedFixed32& a, NonPackedFixed32& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NonPackedFixed32* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NonPackedFixed32* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NonPackedFixed32* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NonPackedFixed32>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const NonPackedFixed32& from);
+  void MergeFrom(const NonPackedFixed32& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(NonPackedFixed32* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.NonPackedFixed32";
+  }
+  protected:
+  explicit NonPackedFixed32(::google::protobuf::Arena* arena);
+  NonPackedFixed32(::google::protobuf::Arena* arena, const NonPackedFixed32& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedFixed32FieldNumber = 2048,
+  };
+  // repeated fixed32 repeated_fixed32 = 2048;
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+
+  public:
+  void clear_repeated_fixed32() ;
+  ::uint32_t repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::uint32_t value);
+  void add_repeated_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_fixed32();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.NonPackedFixed32)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_fixed32_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class ForeignMessageLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.ForeignMessageLite) */ {
+ public:
+  inline ForeignMessageLite() : ForeignMessageLite(nullptr) {}
+  ~ForeignMessageLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ForeignMessageLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline ForeignMessageLite(const ForeignMessageLite& from)
+      : ForeignMessageLite(nullptr, from) {}
+  ForeignMessageLite(ForeignMessageLite&& from) noexcept
+    : ForeignMessageLite() {
+    *this = ::std::move(from);
+  }
+
+  inline ForeignMessageLite& operator=(const ForeignMessageLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ForeignMessageLite& operator=(ForeignMessageLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ForeignMessageLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ForeignMessageLite* internal_default_instance() {
+    return reinterpret_cast<const ForeignMessageLite*>(
+               &_ForeignMessageLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ForeignMessageLite& a, ForeignMessageLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ForeignMessageLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ForeignMessageLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ForeignMessageLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ForeignMessageLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const ForeignMessageLite& from);
+  void MergeFrom(const ForeignMessageLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ForeignMessageLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.ForeignMessageLite";
+  }
+  protected:
+  explicit ForeignMessageLite(::google::protobuf::Arena* arena);
+  ForeignMessageLite(::google::protobuf::Arena* arena, const ForeignMessageLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCFieldNumber = 1,
+  };
+  // optional int32 c = 1;
+  bool has_c() const;
+  void clear_c() ;
+  ::int32_t c() const;
+  void set_c(::int32_t value);
+
+  private:
+  ::int32_t _internal_c() const;
+  void _internal_set_c(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ForeignMessageLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t c_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class DupEnum final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.DupEnum) */ {
+ public:
+  inline DupEnum() : DupEnum(nullptr) {}
+  ~DupEnum() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR DupEnum(::google::protobuf::internal::ConstantInitialized);
+
+  inline DupEnum(const DupEnum& from)
+      : DupEnum(nullptr, from) {}
+  DupEnum(DupEnum&& from) noexcept
+    : DupEnum() {
+    *this = ::std::move(from);
+  }
+
+  inline DupEnum& operator=(const DupEnum& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DupEnum& operator=(DupEnum&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const DupEnum& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DupEnum* internal_default_instance() {
+    return reinterpret_cast<const DupEnum*>(
+               &_DupEnum_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(DupEnum& a, DupEnum& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DupEnum* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DupEnum* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DupEnum* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DupEnum>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const DupEnum& from);
+  void MergeFrom(const DupEnum& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(DupEnum* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.DupEnum";
+  }
+  protected:
+  explicit DupEnum(::google::protobuf::Arena* arena);
+  DupEnum(::google::protobuf::Arena* arena, const DupEnum& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  using TestEnumWithDupValueLite = DupEnum_TestEnumWithDupValueLite;
+  static constexpr TestEnumWithDupValueLite FOO1 = DupEnum_TestEnumWithDupValueLite_FOO1;
+  static constexpr TestEnumWithDupValueLite BAR1 = DupEnum_TestEnumWithDupValueLite_BAR1;
+  static constexpr TestEnumWithDupValueLite BAZ = DupEnum_TestEnumWithDupValueLite_BAZ;
+  static constexpr TestEnumWithDupValueLite FOO2 = DupEnum_TestEnumWithDupValueLite_FOO2;
+  static constexpr TestEnumWithDupValueLite BAR2 = DupEnum_TestEnumWithDupValueLite_BAR2;
+  static inline bool TestEnumWithDupValueLite_IsValid(int value) {
+    return DupEnum_TestEnumWithDupValueLite_IsValid(value);
+  }
+  static constexpr TestEnumWithDupValueLite TestEnumWithDupValueLite_MIN = DupEnum_TestEnumWithDupValueLite_TestEnumWithDupValueLite_MIN;
+  static constexpr TestEnumWithDupValueLite TestEnumWithDupValueLite_MAX = DupEnum_TestEnumWithDupValueLite_TestEnumWithDupValueLite_MAX;
+  static constexpr int TestEnumWithDupValueLite_ARRAYSIZE = DupEnum_TestEnumWithDupValueLite_TestEnumWithDupValueLite_ARRAYSIZE;
+  template <typename T>
+  static inline const std::string& TestEnumWithDupValueLite_Name(T value) {
+    return DupEnum_TestEnumWithDupValueLite_Name(value);
+  }
+  static inline bool TestEnumWithDupValueLite_Parse(absl::string_view name, TestEnumWithDupValueLite* value) {
+    return DupEnum_TestEnumWithDupValueLite_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.DupEnum)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMergeExceptionLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMergeExceptionLite) */ {
+ public:
+  inline TestMergeExceptionLite() : TestMergeExceptionLite(nullptr) {}
+  ~TestMergeExceptionLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMergeExceptionLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMergeExceptionLite(const TestMergeExceptionLite& from)
+      : TestMergeExceptionLite(nullptr, from) {}
+  TestMergeExceptionLite(TestMergeExceptionLite&& from) noexcept
+    : TestMergeExceptionLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMergeExceptionLite& operator=(const TestMergeExceptionLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMergeExceptionLite& operator=(TestMergeExceptionLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestMergeExceptionLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMergeExceptionLite* internal_default_instance() {
+    return reinterpret_cast<const TestMergeExceptionLite*>(
+               &_TestMergeExceptionLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TestMergeExceptionLite& a, TestMergeExceptionLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMergeExceptionLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMergeExceptionLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMergeExceptionLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMergeExceptionLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestMergeExceptionLite& from);
+  void MergeFrom(const TestMergeExceptionLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMergeExceptionLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestMergeExceptionLite";
+  }
+  protected:
+  explicit TestMergeExceptionLite(::google::protobuf::Arena* arena);
+  TestMergeExceptionLite(::google::protobuf::Arena* arena, const TestMergeExceptionLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAllExtensionsFieldNumber = 1,
+  };
+  // optional .protobuf_unittest.TestAllExtensionsLite all_extensions = 1;
+  bool has_all_extensions() const;
+  void clear_all_extensions() ;
+  const ::protobuf_unittest::TestAllExtensionsLite& all_extensions() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllExtensionsLite* release_all_extensions();
+  ::protobuf_unittest::TestAllExtensionsLite* mutable_all_extensions();
+  void set_allocated_all_extensions(::protobuf_unittest::TestAllExtensionsLite* value);
+  void unsafe_arena_set_allocated_all_extensions(::protobuf_unittest::TestAllExtensionsLite* value);
+  ::protobuf_unittest::TestAllExtensionsLite* unsafe_arena_release_all_extensions();
+
+  private:
+  const ::protobuf_unittest::TestAllExtensionsLite& _internal_all_extensions() const;
+  ::protobuf_unittest::TestAllExtensionsLite* _internal_mutable_all_extensions();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMergeExceptionLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestAllExtensionsLite* all_extensions_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypesLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestAllTypesLite) */ {
+ public:
+  inline TestAllTypesLite() : TestAllTypesLite(nullptr) {}
+  ~TestAllTypesLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypesLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypesLite(const TestAllTypesLite& from)
+      : TestAllTypesLite(nullptr, from) {}
+  TestAllTypesLite(TestAllTypesLite&& from) noexcept
+    : TestAllTypesLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypesLite& operator=(const TestAllTypesLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypesLite& operator=(TestAllTypesLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestAllTypesLite& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofFieldCase {
+    kOneofUint32 = 111,
+    kOneofNestedMessage = 112,
+    kOneofString = 113,
+    kOneofBytes = 114,
+    kOneofLazyNestedMessage = 115,
+    kOneofNestedMessage2 = 117,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static inline const TestAllTypesLite* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypesLite*>(
+               &_TestAllTypesLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TestAllTypesLite& a, TestAllTypesLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypesLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypesLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypesLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypesLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestAllTypesLite& from);
+  void MergeFrom(const TestAllTypesLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypesLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestAllTypesLite";
+  }
+  protected:
+  explicit TestAllTypesLite(::google::protobuf::Arena* arena);
+  TestAllTypesLite(::google::protobuf::Arena* arena, const TestAllTypesLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  using NestedMessage = TestAllTypesLite_NestedMessage;
+  using NestedMessage2 = TestAllTypesLite_NestedMessage2;
+  using OptionalGroup = TestAllTypesLite_OptionalGroup;
+  using RepeatedGroup = TestAllTypesLite_RepeatedGroup;
+
+  using NestedEnum = TestAllTypesLite_NestedEnum;
+  static constexpr NestedEnum FOO = TestAllTypesLite_NestedEnum_FOO;
+  static constexpr NestedEnum BAR = TestAllTypesLite_NestedEnum_BAR;
+  static constexpr NestedEnum BAZ = TestAllTypesLite_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestAllTypesLite_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN = TestAllTypesLite_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX = TestAllTypesLite_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE = TestAllTypesLite_NestedEnum_NestedEnum_ARRAYSIZE;
+  template <typename T>
+  static inline const std::string& NestedEnum_Name(T value) {
+    return TestAllTypesLite_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(absl::string_view name, NestedEnum* value) {
+    return TestAllTypesLite_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 31,
+    kRepeatedInt64FieldNumber = 32,
+    kRepeatedUint32FieldNumber = 33,
+    kRepeatedUint64FieldNumber = 34,
+    kRepeatedSint32FieldNumber = 35,
+    kRepeatedSint64FieldNumber = 36,
+    kRepeatedFixed32FieldNumber = 37,
+    kRepeatedFixed64FieldNumber = 38,
+    kRepeatedSfixed32FieldNumber = 39,
+    kRepeatedSfixed64FieldNumber = 40,
+    kRepeatedFloatFieldNumber = 41,
+    kRepeatedDoubleFieldNumber = 42,
+    kRepeatedBoolFieldNumber = 43,
+    kRepeatedStringFieldNumber = 44,
+    kRepeatedBytesFieldNumber = 45,
+    kRepeatedgroupFieldNumber = 46,
+    kRepeatedNestedMessageFieldNumber = 48,
+    kRepeatedForeignMessageFieldNumber = 49,
+    kRepeatedImportMessageFieldNumber = 50,
+    kRepeatedNestedEnumFieldNumber = 51,
+    kRepeatedForeignEnumFieldNumber = 52,
+    kRepeatedImportEnumFieldNumber = 53,
+    kRepeatedStringPieceFieldNumber = 54,
+    kRepeatedCordFieldNumber = 55,
+    kRepeatedLazyMessageFieldNumber = 57,
+    kOptionalStringFieldNumber = 14,
+    kOptionalBytesFieldNumber = 15,
+    kOptionalStringPieceFieldNumber = 24,
+    kOptionalCordFieldNumber = 25,
+    kDefaultStringFieldNumber = 74,
+    kDefaultBytesFieldNumber = 75,
+    kDefaultStringPieceFieldNumber = 84,
+    kDefaultCordFieldNumber = 85,
+    kOptionalgroupFieldNumber = 16,
+    kOptionalNestedMessageFieldNumber = 18,
+    kOptionalForeignMessageFieldNumber = 19,
+    kOptionalImportMessageFieldNumber = 20,
+    kOptionalPublicImportMessageFieldNumber = 26,
+    kOptionalLazyMessageFieldNumber = 27,
+    kOptionalUnverifiedLazyMessageFieldNumber = 28,
+    kOptionalInt64FieldNumber = 2,
+    kOptionalInt32FieldNumber = 1,
+    kOptionalUint32FieldNumber = 3,
+    kOptionalUint64FieldNumber = 4,
+    kOptionalSint64FieldNumber = 6,
+    kOptionalSint32FieldNumber = 5,
+    kOptionalFixed32FieldNumber = 7,
+    kOptionalFixed64FieldNumber = 8,
+    kOptionalSfixed64FieldNumber = 10,
+    kOptionalSfixed32FieldNumber = 9,
+    kOptionalFloatFieldNumber = 11,
+    kOptionalDoubleFieldNumber = 12,
+    kOptionalBoolFieldNumber = 13,
+    kDeceptivelyNamedListFieldNumber = 116,
+    kDefaultImportEnumFieldNumber = 83,
+    kOptionalNestedEnumFieldNumber = 21,
+    kOptionalForeignEnumFieldNumber = 22,
+    kOptionalImportEnumFieldNumber = 23,
+    kDefaultInt32FieldNumber = 61,
+    kDefaultInt64FieldNumber = 62,
+    kDefaultUint64FieldNumber = 64,
+    kDefaultUint32FieldNumber = 63,
+    kDefaultSint32FieldNumber = 65,
+    kDefaultSint64FieldNumber = 66,
+    kDefaultFixed64FieldNumber = 68,
+    kDefaultFixed32FieldNumber = 67,
+    kDefaultSfixed32FieldNumber = 69,
+    kDefaultSfixed64FieldNumber = 70,
+    kDefaultDoubleFieldNumber = 72,
+    kDefaultFloatFieldNumber = 71,
+    kDefaultBoolFieldNumber = 73,
+    kDefaultNestedEnumFieldNumber = 81,
+    kDefaultForeignEnumFieldNumber = 82,
+    kOneofUint32FieldNumber = 111,
+    kOneofNestedMessageFieldNumber = 112,
+    kOneofStringFieldNumber = 113,
+    kOneofBytesFieldNumber = 114,
+    kOneofLazyNestedMessageFieldNumber = 115,
+    kOneofNestedMessage2FieldNumber = 117,
+  };
+  // repeated int32 repeated_int32 = 31;
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // repeated int64 repeated_int64 = 32;
+  int repeated_int64_size() const;
+  private:
+  int _internal_repeated_int64_size() const;
+
+  public:
+  void clear_repeated_int64() ;
+  ::int64_t repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::int64_t value);
+  void add_repeated_int64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_int64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_int64();
+
+  public:
+  // repeated uint32 repeated_uint32 = 33;
+  int repeated_uint32_size() const;
+  private:
+  int _internal_repeated_uint32_size() const;
+
+  public:
+  void clear_repeated_uint32() ;
+  ::uint32_t repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::uint32_t value);
+  void add_repeated_uint32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_uint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_uint32();
+
+  public:
+  // repeated uint64 repeated_uint64 = 34;
+  int repeated_uint64_size() const;
+  private:
+  int _internal_repeated_uint64_size() const;
+
+  public:
+  void clear_repeated_uint64() ;
+  ::uint64_t repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::uint64_t value);
+  void add_repeated_uint64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_uint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_uint64();
+
+  public:
+  // repeated sint32 repeated_sint32 = 35;
+  int repeated_sint32_size() const;
+  private:
+  int _internal_repeated_sint32_size() const;
+
+  public:
+  void clear_repeated_sint32() ;
+  ::int32_t repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::int32_t value);
+  void add_repeated_sint32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sint32();
+
+  public:
+  // repeated sint64 repeated_sint64 = 36;
+  int repeated_sint64_size() const;
+  private:
+  int _internal_repeated_sint64_size() const;
+
+  public:
+  void clear_repeated_sint64() ;
+  ::int64_t repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::int64_t value);
+  void add_repeated_sint64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sint64();
+
+  public:
+  // repeated fixed32 repeated_fixed32 = 37;
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+
+  public:
+  void clear_repeated_fixed32() ;
+  ::uint32_t repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::uint32_t value);
+  void add_repeated_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_fixed32();
+
+  public:
+  // repeated fixed64 repeated_fixed64 = 38;
+  int repeated_fixed64_size() const;
+  private:
+  int _internal_repeated_fixed64_size() const;
+
+  public:
+  void clear_repeated_fixed64() ;
+  ::uint64_t repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::uint64_t value);
+  void add_repeated_fixed64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_fixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_fixed64();
+
+  public:
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  int repeated_sfixed32_size() const;
+  private:
+  int _internal_repeated_sfixed32_size() const;
+
+  public:
+  void clear_repeated_sfixed32() ;
+  ::int32_t repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::int32_t value);
+  void add_repeated_sfixed32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sfixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sfixed32();
+
+  public:
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  int repeated_sfixed64_size() const;
+  private:
+  int _internal_repeated_sfixed64_size() const;
+
+  public:
+  void clear_repeated_sfixed64() ;
+  ::int64_t repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::int64_t value);
+  void add_repeated_sfixed64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sfixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sfixed64();
+
+  public:
+  // repeated float repeated_float = 41;
+  int repeated_float_size() const;
+  private:
+  int _internal_repeated_float_size() const;
+
+  public:
+  void clear_repeated_float() ;
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::google::protobuf::RepeatedField<float>& repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* mutable_repeated_float();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_repeated_float();
+
+  public:
+  // repeated double repeated_double = 42;
+  int repeated_double_size() const;
+  private:
+  int _internal_repeated_double_size() const;
+
+  public:
+  void clear_repeated_double() ;
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::google::protobuf::RepeatedField<double>& repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* mutable_repeated_double();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_repeated_double();
+
+  public:
+  // repeated bool repeated_bool = 43;
+  int repeated_bool_size() const;
+  private:
+  int _internal_repeated_bool_size() const;
+
+  public:
+  void clear_repeated_bool() ;
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::google::protobuf::RepeatedField<bool>& repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_repeated_bool();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_repeated_bool();
+
+  public:
+  // repeated string repeated_string = 44;
+  int repeated_string_size() const;
+  private:
+  int _internal_repeated_string_size() const;
+
+  public:
+  void clear_repeated_string() ;
+  const std::string& repeated_string(int index) const;
+  std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const std::string& value);
+  void set_repeated_string(int index, std::string&& value);
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, std::size_t size);
+  void set_repeated_string(int index, absl::string_view value);
+  std::string* add_repeated_string();
+  void add_repeated_string(const std::string& value);
+  void add_repeated_string(std::string&& value);
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, std::size_t size);
+  void add_repeated_string(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string();
+
+  public:
+  // repeated bytes repeated_bytes = 45;
+  int repeated_bytes_size() const;
+  private:
+  int _internal_repeated_bytes_size() const;
+
+  public:
+  void clear_repeated_bytes() ;
+  const std::string& repeated_bytes(int index) const;
+  std::string* mutable_repeated_bytes(int index);
+  void set_repeated_bytes(int index, const std::string& value);
+  void set_repeated_bytes(int index, std::string&& value);
+  void set_repeated_bytes(int index, const char* value);
+  void set_repeated_bytes(int index, const void* value, std::size_t size);
+  void set_repeated_bytes(int index, absl::string_view value);
+  std::string* add_repeated_bytes();
+  void add_repeated_bytes(const std::string& value);
+  void add_repeated_bytes(std::string&& value);
+  void add_repeated_bytes(const char* value);
+  void add_repeated_bytes(const void* value, std::size_t size);
+  void add_repeated_bytes(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_bytes();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_bytes();
+
+  public:
+  // repeated group RepeatedGroup = 46 { ... };
+  int repeatedgroup_size() const;
+  private:
+  int _internal_repeatedgroup_size() const;
+
+  public:
+  void clear_repeatedgroup() ;
+  ::protobuf_unittest::TestAllTypesLite_RepeatedGroup* mutable_repeatedgroup(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_RepeatedGroup >*
+      mutable_repeatedgroup();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_RepeatedGroup>& _internal_repeatedgroup() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_RepeatedGroup>* _internal_mutable_repeatedgroup();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite_RepeatedGroup& repeatedgroup(int index) const;
+  ::protobuf_unittest::TestAllTypesLite_RepeatedGroup* add_repeatedgroup();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_RepeatedGroup >&
+      repeatedgroup() const;
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_nested_message = 48;
+  int repeated_nested_message_size() const;
+  private:
+  int _internal_repeated_nested_message_size() const;
+
+  public:
+  void clear_repeated_nested_message() ;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_repeated_nested_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_NestedMessage >*
+      mutable_repeated_nested_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>& _internal_repeated_nested_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>* _internal_mutable_repeated_nested_message();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& repeated_nested_message(int index) const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* add_repeated_nested_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_NestedMessage >&
+      repeated_nested_message() const;
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  int repeated_foreign_message_size() const;
+  private:
+  int _internal_repeated_foreign_message_size() const;
+
+  public:
+  void clear_repeated_foreign_message() ;
+  ::protobuf_unittest::ForeignMessageLite* mutable_repeated_foreign_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >*
+      mutable_repeated_foreign_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ForeignMessageLite>& _internal_repeated_foreign_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ForeignMessageLite>* _internal_mutable_repeated_foreign_message();
+  public:
+  const ::protobuf_unittest::ForeignMessageLite& repeated_foreign_message(int index) const;
+  ::protobuf_unittest::ForeignMessageLite* add_repeated_foreign_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >&
+      repeated_foreign_message() const;
+  // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+  int repeated_import_message_size() const;
+  private:
+  int _internal_repeated_import_message_size() const;
+
+  public:
+  void clear_repeated_import_message() ;
+  ::protobuf_unittest_import::ImportMessageLite* mutable_repeated_import_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite >*
+      mutable_repeated_import_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessageLite>& _internal_repeated_import_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessageLite>* _internal_mutable_repeated_import_message();
+  public:
+  const ::protobuf_unittest_import::ImportMessageLite& repeated_import_message(int index) const;
+  ::protobuf_unittest_import::ImportMessageLite* add_repeated_import_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite >&
+      repeated_import_message() const;
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedEnum repeated_nested_enum = 51;
+  int repeated_nested_enum_size() const;
+  private:
+  int _internal_repeated_nested_enum_size() const;
+
+  public:
+  void clear_repeated_nested_enum() ;
+  public:
+  ::protobuf_unittest::TestAllTypesLite_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::protobuf_unittest::TestAllTypesLite_NestedEnum value);
+  void add_repeated_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_nested_enum();
+
+  public:
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  int repeated_foreign_enum_size() const;
+  private:
+  int _internal_repeated_foreign_enum_size() const;
+
+  public:
+  void clear_repeated_foreign_enum() ;
+  public:
+  ::protobuf_unittest::ForeignEnumLite repeated_foreign_enum(int index) const;
+  void set_repeated_foreign_enum(int index, ::protobuf_unittest::ForeignEnumLite value);
+  void add_repeated_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_foreign_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_foreign_enum();
+
+  public:
+  // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+  int repeated_import_enum_size() const;
+  private:
+  int _internal_repeated_import_enum_size() const;
+
+  public:
+  void clear_repeated_import_enum() ;
+  public:
+  ::protobuf_unittest_import::ImportEnumLite repeated_import_enum(int index) const;
+  void set_repeated_import_enum(int index, ::protobuf_unittest_import::ImportEnumLite value);
+  void add_repeated_import_enum(::protobuf_unittest_import::ImportEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& repeated_import_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_import_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_import_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_import_enum();
+
+  public:
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  int repeated_string_piece_size() const;
+  private:
+  int _internal_repeated_string_piece_size() const;
+
+  public:
+  void clear_repeated_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& repeated_string_piece(int index) const;
+  std::string* mutable_repeated_string_piece(int index);
+  void set_repeated_string_piece(int index, const std::string& value);
+  void set_repeated_string_piece(int index, std::string&& value);
+  void set_repeated_string_piece(int index, const char* value);
+  void set_repeated_string_piece(int index, const char* value, std::size_t size);
+  void set_repeated_string_piece(int index, absl::string_view value);
+  std::string* add_repeated_string_piece();
+  void add_repeated_string_piece(const std::string& value);
+  void add_repeated_string_piece(std::string&& value);
+  void add_repeated_string_piece(const char* value);
+  void add_repeated_string_piece(const char* value, std::size_t size);
+  void add_repeated_string_piece(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string_piece() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string_piece();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string_piece() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string_piece();
+
+  public:
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  int repeated_cord_size() const;
+  private:
+  int _internal_repeated_cord_size() const;
+
+  public:
+  void clear_repeated_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& repeated_cord(int index) const;
+  std::string* mutable_repeated_cord(int index);
+  void set_repeated_cord(int index, const std::string& value);
+  void set_repeated_cord(int index, std::string&& value);
+  void set_repeated_cord(int index, const char* value);
+  void set_repeated_cord(int index, const char* value, std::size_t size);
+  void set_repeated_cord(int index, absl::string_view value);
+  std::string* add_repeated_cord();
+  void add_repeated_cord(const std::string& value);
+  void add_repeated_cord(std::string&& value);
+  void add_repeated_cord(const char* value);
+  void add_repeated_cord(const char* value, std::size_t size);
+  void add_repeated_cord(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_cord() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_cord();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_cord() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_cord();
+
+  public:
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  int repeated_lazy_message_size() const;
+  private:
+  int _internal_repeated_lazy_message_size() const;
+
+  public:
+  void clear_repeated_lazy_message() ;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_repeated_lazy_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_NestedMessage >*
+      mutable_repeated_lazy_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>& _internal_repeated_lazy_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>* _internal_mutable_repeated_lazy_message();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& repeated_lazy_message(int index) const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* add_repeated_lazy_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_NestedMessage >&
+      repeated_lazy_message() const;
+  // optional string optional_string = 14;
+  bool has_optional_string() const;
+  void clear_optional_string() ;
+  const std::string& optional_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string();
+  PROTOBUF_NODISCARD std::string* release_optional_string();
+  void set_allocated_optional_string(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string();
+
+  public:
+  // optional bytes optional_bytes = 15;
+  bool has_optional_bytes() const;
+  void clear_optional_bytes() ;
+  const std::string& optional_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_bytes();
+  PROTOBUF_NODISCARD std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_optional_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_optional_bytes();
+
+  public:
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  bool has_optional_string_piece() const;
+  void clear_optional_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& optional_string_piece() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string_piece(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string_piece();
+  PROTOBUF_NODISCARD std::string* release_optional_string_piece();
+  void set_allocated_optional_string_piece(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string_piece() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string_piece(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string_piece();
+
+  public:
+  // optional string optional_cord = 25 [ctype = CORD];
+  bool has_optional_cord() const;
+  void clear_optional_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& optional_cord() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_cord(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_cord();
+  PROTOBUF_NODISCARD std::string* release_optional_cord();
+  void set_allocated_optional_cord(std::string* value);
+
+  private:
+  const std::string& _internal_optional_cord() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_cord(
+      const std::string& value);
+  std::string* _internal_mutable_optional_cord();
+
+  public:
+  // optional string default_string = 74 [default = "hello"];
+  bool has_default_string() const;
+  void clear_default_string() ;
+  const std::string& default_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_default_string(Arg_&& arg, Args_... args);
+  std::string* mutable_default_string();
+  PROTOBUF_NODISCARD std::string* release_default_string();
+  void set_allocated_default_string(std::string* value);
+
+  private:
+  const std::string& _internal_default_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_default_string(
+      const std::string& value);
+  std::string* _internal_mutable_default_string();
+
+  public:
+  // optional bytes default_bytes = 75 [default = "world"];
+  bool has_default_bytes() const;
+  void clear_default_bytes() ;
+  const std::string& default_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_default_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_default_bytes();
+  PROTOBUF_NODISCARD std::string* release_default_bytes();
+  void set_allocated_default_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_default_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_default_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_default_bytes();
+
+  public:
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  bool has_default_string_piece() const;
+  void clear_default_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& default_string_piece() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_default_string_piece(Arg_&& arg, Args_... args);
+  std::string* mutable_default_string_piece();
+  PROTOBUF_NODISCARD std::string* release_default_string_piece();
+  void set_allocated_default_string_piece(std::string* value);
+
+  private:
+  const std::string& _internal_default_string_piece() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_default_string_piece(
+      const std::string& value);
+  std::string* _internal_mutable_default_string_piece();
+
+  public:
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  bool has_default_cord() const;
+  void clear_default_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& default_cord() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_default_cord(Arg_&& arg, Args_... args);
+  std::string* mutable_default_cord();
+  PROTOBUF_NODISCARD std::string* release_default_cord();
+  void set_allocated_default_cord(std::string* value);
+
+  private:
+  const std::string& _internal_default_cord() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_default_cord(
+      const std::string& value);
+  std::string* _internal_mutable_default_cord();
+
+  public:
+  // optional group OptionalGroup = 16 { ... };
+  bool has_optionalgroup() const;
+  void clear_optionalgroup() ;
+  const ::protobuf_unittest::TestAllTypesLite_OptionalGroup& optionalgroup() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_OptionalGroup* release_optionalgroup();
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup* mutable_optionalgroup();
+  void set_allocated_optionalgroup(::protobuf_unittest::TestAllTypesLite_OptionalGroup* value);
+  void unsafe_arena_set_allocated_optionalgroup(::protobuf_unittest::TestAllTypesLite_OptionalGroup* value);
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup* unsafe_arena_release_optionalgroup();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_OptionalGroup& _internal_optionalgroup() const;
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup* _internal_mutable_optionalgroup();
+
+  public:
+  // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_nested_message = 18;
+  bool has_optional_nested_message() const;
+  void clear_optional_nested_message() ;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& optional_nested_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_NestedMessage* release_optional_nested_message();
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_optional_nested_message();
+  void set_allocated_optional_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* unsafe_arena_release_optional_nested_message();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& _internal_optional_nested_message() const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _internal_mutable_optional_nested_message();
+
+  public:
+  // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+  bool has_optional_foreign_message() const;
+  void clear_optional_foreign_message() ;
+  const ::protobuf_unittest::ForeignMessageLite& optional_foreign_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::ForeignMessageLite* release_optional_foreign_message();
+  ::protobuf_unittest::ForeignMessageLite* mutable_optional_foreign_message();
+  void set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* value);
+  void unsafe_arena_set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* value);
+  ::protobuf_unittest::ForeignMessageLite* unsafe_arena_release_optional_foreign_message();
+
+  private:
+  const ::protobuf_unittest::ForeignMessageLite& _internal_optional_foreign_message() const;
+  ::protobuf_unittest::ForeignMessageLite* _internal_mutable_optional_foreign_message();
+
+  public:
+  // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+  bool has_optional_import_message() const;
+  void clear_optional_import_message() ;
+  const ::protobuf_unittest_import::ImportMessageLite& optional_import_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest_import::ImportMessageLite* release_optional_import_message();
+  ::protobuf_unittest_import::ImportMessageLite* mutable_optional_import_message();
+  void set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessageLite* value);
+  void unsafe_arena_set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessageLite* value);
+  ::protobuf_unittest_import::ImportMessageLite* unsafe_arena_release_optional_import_message();
+
+  private:
+  const ::protobuf_unittest_import::ImportMessageLite& _internal_optional_import_message() const;
+  ::protobuf_unittest_import::ImportMessageLite* _internal_mutable_optional_import_message();
+
+  public:
+  // optional .protobuf_unittest_import.PublicImportMessageLite optional_public_import_message = 26;
+  bool has_optional_public_import_message() const;
+  void clear_optional_public_import_message() ;
+  const ::protobuf_unittest_import::PublicImportMessageLite& optional_public_import_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest_import::PublicImportMessageLite* release_optional_public_import_message();
+  ::protobuf_unittest_import::PublicImportMessageLite* mutable_optional_public_import_message();
+  void set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessageLite* value);
+  void unsafe_arena_set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessageLite* value);
+  ::protobuf_unittest_import::PublicImportMessageLite* unsafe_arena_release_optional_public_import_message();
+
+  private:
+  const ::protobuf_unittest_import::PublicImportMessageLite& _internal_optional_public_import_message() const;
+  ::protobuf_unittest_import::PublicImportMessageLite* _internal_mutable_optional_public_import_message();
+
+  public:
+  // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_lazy_message = 27 [lazy = true];
+  bool has_optional_lazy_message() const;
+  void clear_optional_lazy_message() ;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& optional_lazy_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_NestedMessage* release_optional_lazy_message();
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_optional_lazy_message();
+  void set_allocated_optional_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* unsafe_arena_release_optional_lazy_message();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& _internal_optional_lazy_message() const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _internal_mutable_optional_lazy_message();
+
+  public:
+  // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_unverified_lazy_message = 28 [unverified_lazy = true];
+  bool has_optional_unverified_lazy_message() const;
+  void clear_optional_unverified_lazy_message() ;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& optional_unverified_lazy_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_NestedMessage* release_optional_unverified_lazy_message();
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_optional_unverified_lazy_message();
+  void set_allocated_optional_unverified_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_unverified_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* unsafe_arena_release_optional_unverified_lazy_message();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& _internal_optional_unverified_lazy_message() const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _internal_mutable_optional_unverified_lazy_message();
+
+  public:
+  // optional int64 optional_int64 = 2;
+  bool has_optional_int64() const;
+  void clear_optional_int64() ;
+  ::int64_t optional_int64() const;
+  void set_optional_int64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_int64() const;
+  void _internal_set_optional_int64(::int64_t value);
+
+  public:
+  // optional int32 optional_int32 = 1;
+  bool has_optional_int32() const;
+  void clear_optional_int32() ;
+  ::int32_t optional_int32() const;
+  void set_optional_int32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_int32() const;
+  void _internal_set_optional_int32(::int32_t value);
+
+  public:
+  // optional uint32 optional_uint32 = 3;
+  bool has_optional_uint32() const;
+  void clear_optional_uint32() ;
+  ::uint32_t optional_uint32() const;
+  void set_optional_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_optional_uint32() const;
+  void _internal_set_optional_uint32(::uint32_t value);
+
+  public:
+  // optional uint64 optional_uint64 = 4;
+  bool has_optional_uint64() const;
+  void clear_optional_uint64() ;
+  ::uint64_t optional_uint64() const;
+  void set_optional_uint64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_optional_uint64() const;
+  void _internal_set_optional_uint64(::uint64_t value);
+
+  public:
+  // optional sint64 optional_sint64 = 6;
+  bool has_optional_sint64() const;
+  void clear_optional_sint64() ;
+  ::int64_t optional_sint64() const;
+  void set_optional_sint64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_sint64() const;
+  void _internal_set_optional_sint64(::int64_t value);
+
+  public:
+  // optional sint32 optional_sint32 = 5;
+  bool has_optional_sint32() const;
+  void clear_optional_sint32() ;
+  ::int32_t optional_sint32() const;
+  void set_optional_sint32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_sint32() const;
+  void _internal_set_optional_sint32(::int32_t value);
+
+  public:
+  // optional fixed32 optional_fixed32 = 7;
+  bool has_optional_fixed32() const;
+  void clear_optional_fixed32() ;
+  ::uint32_t optional_fixed32() const;
+  void set_optional_fixed32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_optional_fixed32() const;
+  void _internal_set_optional_fixed32(::uint32_t value);
+
+  public:
+  // optional fixed64 optional_fixed64 = 8;
+  bool has_optional_fixed64() const;
+  void clear_optional_fixed64() ;
+  ::uint64_t optional_fixed64() const;
+  void set_optional_fixed64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_optional_fixed64() const;
+  void _internal_set_optional_fixed64(::uint64_t value);
+
+  public:
+  // optional sfixed64 optional_sfixed64 = 10;
+  bool has_optional_sfixed64() const;
+  void clear_optional_sfixed64() ;
+  ::int64_t optional_sfixed64() const;
+  void set_optional_sfixed64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_sfixed64() const;
+  void _internal_set_optional_sfixed64(::int64_t value);
+
+  public:
+  // optional sfixed32 optional_sfixed32 = 9;
+  bool has_optional_sfixed32() const;
+  void clear_optional_sfixed32() ;
+  ::int32_t optional_sfixed32() const;
+  void set_optional_sfixed32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_sfixed32() const;
+  void _internal_set_optional_sfixed32(::int32_t value);
+
+  public:
+  // optional float optional_float = 11;
+  bool has_optional_float() const;
+  void clear_optional_float() ;
+  float optional_float() const;
+  void set_optional_float(float value);
+
+  private:
+  float _internal_optional_float() const;
+  void _internal_set_optional_float(float value);
+
+  public:
+  // optional double optional_double = 12;
+  bool has_optional_double() const;
+  void clear_optional_double() ;
+  double optional_double() const;
+  void set_optional_double(double value);
+
+  private:
+  double _internal_optional_double() const;
+  void _internal_set_optional_double(double value);
+
+  public:
+  // optional bool optional_bool = 13;
+  bool has_optional_bool() const;
+  void clear_optional_bool() ;
+  bool optional_bool() const;
+  void set_optional_bool(bool value);
+
+  private:
+  bool _internal_optional_bool() const;
+  void _internal_set_optional_bool(bool value);
+
+  public:
+  // optional int32 deceptively_named_list = 116;
+  bool has_deceptively_named_list() const;
+  void clear_deceptively_named_list() ;
+  ::int32_t deceptively_named_list() const;
+  void set_deceptively_named_list(::int32_t value);
+
+  private:
+  ::int32_t _internal_deceptively_named_list() const;
+  void _internal_set_deceptively_named_list(::int32_t value);
+
+  public:
+  // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+  bool has_default_import_enum() const;
+  void clear_default_import_enum() ;
+  ::protobuf_unittest_import::ImportEnumLite default_import_enum() const;
+  void set_default_import_enum(::protobuf_unittest_import::ImportEnumLite value);
+
+  private:
+  ::protobuf_unittest_import::ImportEnumLite _internal_default_import_enum() const;
+  void _internal_set_default_import_enum(::protobuf_unittest_import::ImportEnumLite value);
+
+  public:
+  // optional .protobuf_unittest.TestAllTypesLite.NestedEnum optional_nested_enum = 21;
+  bool has_optional_nested_enum() const;
+  void clear_optional_nested_enum() ;
+  ::protobuf_unittest::TestAllTypesLite_NestedEnum optional_nested_enum() const;
+  void set_optional_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value);
+
+  private:
+  ::protobuf_unittest::TestAllTypesLite_NestedEnum _internal_optional_nested_enum() const;
+  void _internal_set_optional_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value);
+
+  public:
+  // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+  bool has_optional_foreign_enum() const;
+  void clear_optional_foreign_enum() ;
+  ::protobuf_unittest::ForeignEnumLite optional_foreign_enum() const;
+  void set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  private:
+  ::protobuf_unittest::ForeignEnumLite _internal_optional_foreign_enum() const;
+  void _internal_set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  public:
+  // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+  bool has_optional_import_enum() const;
+  void clear_optional_import_enum() ;
+  ::protobuf_unittest_import::ImportEnumLite optional_import_enum() const;
+  void set_optional_import_enum(::protobuf_unittest_import::ImportEnumLite value);
+
+  private:
+  ::protobuf_unittest_import::ImportEnumLite _internal_optional_import_enum() const;
+  void _internal_set_optional_import_enum(::protobuf_unittest_import::ImportEnumLite value);
+
+  public:
+  // optional int32 default_int32 = 61 [default = 41];
+  bool has_default_int32() const;
+  void clear_default_int32() ;
+  ::int32_t default_int32() const;
+  void set_default_int32(::int32_t value);
+
+  private:
+  ::int32_t _internal_default_int32() const;
+  void _internal_set_default_int32(::int32_t value);
+
+  public:
+  // optional int64 default_int64 = 62 [default = 42];
+  bool has_default_int64() const;
+  void clear_default_int64() ;
+  ::int64_t default_int64() const;
+  void set_default_int64(::int64_t value);
+
+  private:
+  ::int64_t _internal_default_int64() const;
+  void _internal_set_default_int64(::int64_t value);
+
+  public:
+  // optional uint64 default_uint64 = 64 [default = 44];
+  bool has_default_uint64() const;
+  void clear_default_uint64() ;
+  ::uint64_t default_uint64() const;
+  void set_default_uint64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_default_uint64() const;
+  void _internal_set_default_uint64(::uint64_t value);
+
+  public:
+  // optional uint32 default_uint32 = 63 [default = 43];
+  bool has_default_uint32() const;
+  void clear_default_uint32() ;
+  ::uint32_t default_uint32() const;
+  void set_default_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_default_uint32() const;
+  void _internal_set_default_uint32(::uint32_t value);
+
+  public:
+  // optional sint32 default_sint32 = 65 [default = -45];
+  bool has_default_sint32() const;
+  void clear_default_sint32() ;
+  ::int32_t default_sint32() const;
+  void set_default_sint32(::int32_t value);
+
+  private:
+  ::int32_t _internal_default_sint32() const;
+  void _internal_set_default_sint32(::int32_t value);
+
+  public:
+  // optional sint64 default_sint64 = 66 [default = 46];
+  bool has_default_sint64() const;
+  void clear_default_sint64() ;
+  ::int64_t default_sint64() const;
+  void set_default_sint64(::int64_t value);
+
+  private:
+  ::int64_t _internal_default_sint64() const;
+  void _internal_set_default_sint64(::int64_t value);
+
+  public:
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  bool has_default_fixed64() const;
+  void clear_default_fixed64() ;
+  ::uint64_t default_fixed64() const;
+  void set_default_fixed64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_default_fixed64() const;
+  void _internal_set_default_fixed64(::uint64_t value);
+
+  public:
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  bool has_default_fixed32() const;
+  void clear_default_fixed32() ;
+  ::uint32_t default_fixed32() const;
+  void set_default_fixed32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_default_fixed32() const;
+  void _internal_set_default_fixed32(::uint32_t value);
+
+  public:
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  bool has_default_sfixed32() const;
+  void clear_default_sfixed32() ;
+  ::int32_t default_sfixed32() const;
+  void set_default_sfixed32(::int32_t value);
+
+  private:
+  ::int32_t _internal_default_sfixed32() const;
+  void _internal_set_default_sfixed32(::int32_t value);
+
+  public:
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  bool has_default_sfixed64() const;
+  void clear_default_sfixed64() ;
+  ::int64_t default_sfixed64() const;
+  void set_default_sfixed64(::int64_t value);
+
+  private:
+  ::int64_t _internal_default_sfixed64() const;
+  void _internal_set_default_sfixed64(::int64_t value);
+
+  public:
+  // optional double default_double = 72 [default = 52000];
+  bool has_default_double() const;
+  void clear_default_double() ;
+  double default_double() const;
+  void set_default_double(double value);
+
+  private:
+  double _internal_default_double() const;
+  void _internal_set_default_double(double value);
+
+  public:
+  // optional float default_float = 71 [default = 51.5];
+  bool has_default_float() const;
+  void clear_default_float() ;
+  float default_float() const;
+  void set_default_float(float value);
+
+  private:
+  float _internal_default_float() const;
+  void _internal_set_default_float(float value);
+
+  public:
+  // optional bool default_bool = 73 [default = true];
+  bool has_default_bool() const;
+  void clear_default_bool() ;
+  bool default_bool() const;
+  void set_default_bool(bool value);
+
+  private:
+  bool _internal_default_bool() const;
+  void _internal_set_default_bool(bool value);
+
+  public:
+  // optional .protobuf_unittest.TestAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+  bool has_default_nested_enum() const;
+  void clear_default_nested_enum() ;
+  ::protobuf_unittest::TestAllTypesLite_NestedEnum default_nested_enum() const;
+  void set_default_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value);
+
+  private:
+  ::protobuf_unittest::TestAllTypesLite_NestedEnum _internal_default_nested_enum() const;
+  void _internal_set_default_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value);
+
+  public:
+  // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+  bool has_default_foreign_enum() const;
+  void clear_default_foreign_enum() ;
+  ::protobuf_unittest::ForeignEnumLite default_foreign_enum() const;
+  void set_default_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  private:
+  ::protobuf_unittest::ForeignEnumLite _internal_default_foreign_enum() const;
+  void _internal_set_default_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  public:
+  // uint32 oneof_uint32 = 111;
+  bool has_oneof_uint32() const;
+  void clear_oneof_uint32() ;
+  ::uint32_t oneof_uint32() const;
+  void set_oneof_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_oneof_uint32() const;
+  void _internal_set_oneof_uint32(::uint32_t value);
+
+  public:
+  // .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_nested_message = 112;
+  bool has_oneof_nested_message() const;
+  private:
+  bool _internal_has_oneof_nested_message() const;
+
+  public:
+  void clear_oneof_nested_message() ;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& oneof_nested_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_NestedMessage* release_oneof_nested_message();
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_oneof_nested_message();
+  void set_allocated_oneof_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  void unsafe_arena_set_allocated_oneof_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* unsafe_arena_release_oneof_nested_message();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& _internal_oneof_nested_message() const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _internal_mutable_oneof_nested_message();
+
+  public:
+  // string oneof_string = 113;
+  bool has_oneof_string() const;
+  void clear_oneof_string() ;
+  const std::string& oneof_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string();
+  PROTOBUF_NODISCARD std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+
+  public:
+  // bytes oneof_bytes = 114;
+  bool has_oneof_bytes() const;
+  void clear_oneof_bytes() ;
+  const std::string& oneof_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_bytes();
+  PROTOBUF_NODISCARD std::string* release_oneof_bytes();
+  void set_allocated_oneof_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_bytes();
+
+  public:
+  // .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_lazy_nested_message = 115 [lazy = true];
+  bool has_oneof_lazy_nested_message() const;
+  private:
+  bool _internal_has_oneof_lazy_nested_message() const;
+
+  public:
+  void clear_oneof_lazy_nested_message() ;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& oneof_lazy_nested_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_NestedMessage* release_oneof_lazy_nested_message();
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* mutable_oneof_lazy_nested_message();
+  void set_allocated_oneof_lazy_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  void unsafe_arena_set_allocated_oneof_lazy_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* unsafe_arena_release_oneof_lazy_nested_message();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage& _internal_oneof_lazy_nested_message() const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _internal_mutable_oneof_lazy_nested_message();
+
+  public:
+  // .protobuf_unittest.TestAllTypesLite.NestedMessage2 oneof_nested_message2 = 117;
+  bool has_oneof_nested_message2() const;
+  private:
+  bool _internal_has_oneof_nested_message2() const;
+
+  public:
+  void clear_oneof_nested_message2() ;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage2& oneof_nested_message2() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite_NestedMessage2* release_oneof_nested_message2();
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage2* mutable_oneof_nested_message2();
+  void set_allocated_oneof_nested_message2(::protobuf_unittest::TestAllTypesLite_NestedMessage2* value);
+  void unsafe_arena_set_allocated_oneof_nested_message2(::protobuf_unittest::TestAllTypesLite_NestedMessage2* value);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage2* unsafe_arena_release_oneof_nested_message2();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage2& _internal_oneof_nested_message2() const;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage2* _internal_mutable_oneof_nested_message2();
+
+  public:
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite)
+ private:
+  class _Internal;
+  void set_has_oneof_uint32();
+  void set_has_oneof_nested_message();
+  void set_has_oneof_string();
+  void set_has_oneof_bytes();
+  void set_has_oneof_lazy_nested_message();
+  void set_has_oneof_nested_message2();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 79, 24,
+      0, 17>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<2> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_int64_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_uint32_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_uint64_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sint32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sint64_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_fixed32_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_fixed64_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sfixed32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sfixed64_;
+    ::google::protobuf::RepeatedField<float> repeated_float_;
+    ::google::protobuf::RepeatedField<double> repeated_double_;
+    ::google::protobuf::RepeatedField<bool> repeated_bool_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_bytes_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_RepeatedGroup > repeatedgroup_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_NestedMessage > repeated_nested_message_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite > repeated_foreign_message_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite > repeated_import_message_;
+    ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+    ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
+    ::google::protobuf::RepeatedField<int> repeated_import_enum_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_piece_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_cord_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite_NestedMessage > repeated_lazy_message_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_;
+    ::google::protobuf::internal::ArenaStringPtr optional_bytes_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_piece_;
+    ::google::protobuf::internal::ArenaStringPtr optional_cord_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_default_string_;
+    ::google::protobuf::internal::ArenaStringPtr default_string_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_default_bytes_;
+    ::google::protobuf::internal::ArenaStringPtr default_bytes_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_default_string_piece_;
+    ::google::protobuf::internal::ArenaStringPtr default_string_piece_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_default_cord_;
+    ::google::protobuf::internal::ArenaStringPtr default_cord_;
+    ::protobuf_unittest::TestAllTypesLite_OptionalGroup* optionalgroup_;
+    ::protobuf_unittest::TestAllTypesLite_NestedMessage* optional_nested_message_;
+    ::protobuf_unittest::ForeignMessageLite* optional_foreign_message_;
+    ::protobuf_unittest_import::ImportMessageLite* optional_import_message_;
+    ::protobuf_unittest_import::PublicImportMessageLite* optional_public_import_message_;
+    ::protobuf_unittest::TestAllTypesLite_NestedMessage* optional_lazy_message_;
+    ::protobuf_unittest::TestAllTypesLite_NestedMessage* optional_unverified_lazy_message_;
+    ::int64_t optional_int64_;
+    ::int32_t optional_int32_;
+    ::uint32_t optional_uint32_;
+    ::uint64_t optional_uint64_;
+    ::int64_t optional_sint64_;
+    ::int32_t optional_sint32_;
+    ::uint32_t optional_fixed32_;
+    ::uint64_t optional_fixed64_;
+    ::int64_t optional_sfixed64_;
+    ::int32_t optional_sfixed32_;
+    float optional_float_;
+    double optional_double_;
+    bool optional_bool_;
+    ::int32_t deceptively_named_list_;
+    int default_import_enum_;
+    int optional_nested_enum_;
+    int optional_foreign_enum_;
+    int optional_import_enum_;
+    ::int32_t default_int32_;
+    ::int64_t default_int64_;
+    ::uint64_t default_uint64_;
+    ::uint32_t default_uint32_;
+    ::int32_t default_sint32_;
+    ::int64_t default_sint64_;
+    ::uint64_t default_fixed64_;
+    ::uint32_t default_fixed32_;
+    ::int32_t default_sfixed32_;
+    ::int64_t default_sfixed64_;
+    double default_double_;
+    float default_float_;
+    bool default_bool_;
+    int default_nested_enum_;
+    int default_foreign_enum_;
+    union OneofFieldUnion {
+      constexpr OneofFieldUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::uint32_t oneof_uint32_;
+      ::protobuf_unittest::TestAllTypesLite_NestedMessage* oneof_nested_message_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_bytes_;
+      ::protobuf_unittest::TestAllTypesLite_NestedMessage* oneof_lazy_nested_message_;
+      ::protobuf_unittest::TestAllTypesLite_NestedMessage2* oneof_nested_message2_;
+    } oneof_field_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestParsingMergeLite_RepeatedGroup final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestParsingMergeLite.RepeatedGroup) */ {
+ public:
+  inline TestParsingMergeLite_RepeatedGroup() : TestParsingMergeLite_RepeatedGroup(nullptr) {}
+  ~TestParsingMergeLite_RepeatedGroup() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestParsingMergeLite_RepeatedGroup(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestParsingMergeLite_RepeatedGroup(const TestParsingMergeLite_RepeatedGroup& from)
+      : TestParsingMergeLite_RepeatedGroup(nullptr, from) {}
+  TestParsingMergeLite_RepeatedGroup(TestParsingMergeLite_RepeatedGroup&& from) noexcept
+    : TestParsingMergeLite_RepeatedGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline TestParsingMergeLite_RepeatedGroup& operator=(const TestParsingMergeLite_RepeatedGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestParsingMergeLite_RepeatedGroup& operator=(TestParsingMergeLite_RepeatedGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestParsingMergeLite_RepeatedGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestParsingMergeLite_RepeatedGroup* internal_default_instance() {
+    return reinterpret_cast<const TestParsingMergeLite_RepeatedGroup*>(
+               &_TestParsingMergeLite_RepeatedGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(TestParsingMergeLite_RepeatedGroup& a, TestParsingMergeLite_RepeatedGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestParsingMergeLite_RepeatedGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestParsingMergeLite_RepeatedGroup* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestParsingMergeLite_RepeatedGroup* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestParsingMergeLite_RepeatedGroup>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestParsingMergeLite_RepeatedGroup& from);
+  void MergeFrom(const TestParsingMergeLite_RepeatedGroup& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestParsingMergeLite_RepeatedGroup* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestParsingMergeLite.RepeatedGroup";
+  }
+  protected:
+  explicit TestParsingMergeLite_RepeatedGroup(::google::protobuf::Arena* arena);
+  TestParsingMergeLite_RepeatedGroup(::google::protobuf::Arena* arena, const TestParsingMergeLite_RepeatedGroup& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedGroupAllTypesFieldNumber = 21,
+  };
+  // optional .protobuf_unittest.TestAllTypesLite repeated_group_all_types = 21;
+  bool has_repeated_group_all_types() const;
+  void clear_repeated_group_all_types() ;
+  const ::protobuf_unittest::TestAllTypesLite& repeated_group_all_types() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_repeated_group_all_types();
+  ::protobuf_unittest::TestAllTypesLite* mutable_repeated_group_all_types();
+  void set_allocated_repeated_group_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_repeated_group_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_repeated_group_all_types();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_repeated_group_all_types() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_repeated_group_all_types();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestAllTypesLite* repeated_group_all_types_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group2 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2) */ {
+ public:
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group2() : TestParsingMergeLite_RepeatedFieldsGenerator_Group2(nullptr) {}
+  ~TestParsingMergeLite_RepeatedFieldsGenerator_Group2() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestParsingMergeLite_RepeatedFieldsGenerator_Group2(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group2(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from)
+      : TestParsingMergeLite_RepeatedFieldsGenerator_Group2(nullptr, from) {}
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group2(TestParsingMergeLite_RepeatedFieldsGenerator_Group2&& from) noexcept
+    : TestParsingMergeLite_RepeatedFieldsGenerator_Group2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group2& operator=(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group2& operator=(TestParsingMergeLite_RepeatedFieldsGenerator_Group2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestParsingMergeLite_RepeatedFieldsGenerator_Group2* internal_default_instance() {
+    return reinterpret_cast<const TestParsingMergeLite_RepeatedFieldsGenerator_Group2*>(
+               &_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(TestParsingMergeLite_RepeatedFieldsGenerator_Group2& a, TestParsingMergeLite_RepeatedFieldsGenerator_Group2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestParsingMergeLite_RepeatedFieldsGenerator_Group2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestParsingMergeLite_RepeatedFieldsGenerator_Group2* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group2* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestParsingMergeLite_RepeatedFieldsGenerator_Group2>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from);
+  void MergeFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestParsingMergeLite_RepeatedFieldsGenerator_Group2* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2";
+  }
+  protected:
+  explicit TestParsingMergeLite_RepeatedFieldsGenerator_Group2(::google::protobuf::Arena* arena);
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group2(::google::protobuf::Arena* arena, const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kField1FieldNumber = 21,
+  };
+  // optional .protobuf_unittest.TestAllTypesLite field1 = 21;
+  bool has_field1() const;
+  void clear_field1() ;
+  const ::protobuf_unittest::TestAllTypesLite& field1() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_field1();
+  ::protobuf_unittest::TestAllTypesLite* mutable_field1();
+  void set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_field1();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_field1() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_field1();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestAllTypesLite* field1_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group1 final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1) */ {
+ public:
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group1() : TestParsingMergeLite_RepeatedFieldsGenerator_Group1(nullptr) {}
+  ~TestParsingMergeLite_RepeatedFieldsGenerator_Group1() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestParsingMergeLite_RepeatedFieldsGenerator_Group1(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group1(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from)
+      : TestParsingMergeLite_RepeatedFieldsGenerator_Group1(nullptr, from) {}
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group1(TestParsingMergeLite_RepeatedFieldsGenerator_Group1&& from) noexcept
+    : TestParsingMergeLite_RepeatedFieldsGenerator_Group1() {
+    *this = ::std::move(from);
+  }
+
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group1& operator=(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestParsingMergeLite_RepeatedFieldsGenerator_Group1& operator=(TestParsingMergeLite_RepeatedFieldsGenerator_Group1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestParsingMergeLite_RepeatedFieldsGenerator_Group1* internal_default_instance() {
+    return reinterpret_cast<const TestParsingMergeLite_RepeatedFieldsGenerator_Group1*>(
+               &_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(TestParsingMergeLite_RepeatedFieldsGenerator_Group1& a, TestParsingMergeLite_RepeatedFieldsGenerator_Group1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestParsingMergeLite_RepeatedFieldsGenerator_Group1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestParsingMergeLite_RepeatedFieldsGenerator_Group1* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group1* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestParsingMergeLite_RepeatedFieldsGenerator_Group1>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from);
+  void MergeFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestParsingMergeLite_RepeatedFieldsGenerator_Group1* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1";
+  }
+  protected:
+  explicit TestParsingMergeLite_RepeatedFieldsGenerator_Group1(::google::protobuf::Arena* arena);
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group1(::google::protobuf::Arena* arena, const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kField1FieldNumber = 11,
+  };
+  // optional .protobuf_unittest.TestAllTypesLite field1 = 11;
+  bool has_field1() const;
+  void clear_field1() ;
+  const ::protobuf_unittest::TestAllTypesLite& field1() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_field1();
+  ::protobuf_unittest::TestAllTypesLite* mutable_field1();
+  void set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_field1();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_field1() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_field1();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestAllTypesLite* field1_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestParsingMergeLite_OptionalGroup final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestParsingMergeLite.OptionalGroup) */ {
+ public:
+  inline TestParsingMergeLite_OptionalGroup() : TestParsingMergeLite_OptionalGroup(nullptr) {}
+  ~TestParsingMergeLite_OptionalGroup() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestParsingMergeLite_OptionalGroup(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestParsingMergeLite_OptionalGroup(const TestParsingMergeLite_OptionalGroup& from)
+      : TestParsingMergeLite_OptionalGroup(nullptr, from) {}
+  TestParsingMergeLite_OptionalGroup(TestParsingMergeLite_OptionalGroup&& from) noexcept
+    : TestParsingMergeLite_OptionalGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline TestParsingMergeLite_OptionalGroup& operator=(const TestParsingMergeLite_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestParsingMergeLite_OptionalGroup& operator=(TestParsingMergeLite_OptionalGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestParsingMergeLite_OptionalGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestParsingMergeLite_OptionalGroup* internal_default_instance() {
+    return reinterpret_cast<const TestParsingMergeLite_OptionalGroup*>(
+               &_TestParsingMergeLite_OptionalGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(TestParsingMergeLite_OptionalGroup& a, TestParsingMergeLite_OptionalGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestParsingMergeLite_OptionalGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestParsingMergeLite_OptionalGroup* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestParsingMergeLite_OptionalGroup* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestParsingMergeLite_OptionalGroup>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestParsingMergeLite_OptionalGroup& from);
+  void MergeFrom(const TestParsingMergeLite_OptionalGroup& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestParsingMergeLite_OptionalGroup* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestParsingMergeLite.OptionalGroup";
+  }
+  protected:
+  explicit TestParsingMergeLite_OptionalGroup(::google::protobuf::Arena* arena);
+  TestParsingMergeLite_OptionalGroup(::google::protobuf::Arena* arena, const TestParsingMergeLite_OptionalGroup& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOptionalGroupAllTypesFieldNumber = 11,
+  };
+  // optional .protobuf_unittest.TestAllTypesLite optional_group_all_types = 11;
+  bool has_optional_group_all_types() const;
+  void clear_optional_group_all_types() ;
+  const ::protobuf_unittest::TestAllTypesLite& optional_group_all_types() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_optional_group_all_types();
+  ::protobuf_unittest::TestAllTypesLite* mutable_optional_group_all_types();
+  void set_allocated_optional_group_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_optional_group_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_optional_group_all_types();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_optional_group_all_types() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_optional_group_all_types();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestAllTypesLite* optional_group_all_types_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestOneofParsingLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestOneofParsingLite) */ {
+ public:
+  inline TestOneofParsingLite() : TestOneofParsingLite(nullptr) {}
+  ~TestOneofParsingLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestOneofParsingLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestOneofParsingLite(const TestOneofParsingLite& from)
+      : TestOneofParsingLite(nullptr, from) {}
+  TestOneofParsingLite(TestOneofParsingLite&& from) noexcept
+    : TestOneofParsingLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestOneofParsingLite& operator=(const TestOneofParsingLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestOneofParsingLite& operator=(TestOneofParsingLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestOneofParsingLite& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofFieldCase {
+    kOneofInt32 = 1,
+    kOneofSubmessage = 2,
+    kOneofString = 3,
+    kOneofBytes = 4,
+    kOneofStringCord = 5,
+    kOneofBytesCord = 6,
+    kOneofStringStringPiece = 7,
+    kOneofBytesStringPiece = 8,
+    kOneofEnum = 9,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static inline const TestOneofParsingLite* internal_default_instance() {
+    return reinterpret_cast<const TestOneofParsingLite*>(
+               &_TestOneofParsingLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(TestOneofParsingLite& a, TestOneofParsingLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestOneofParsingLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestOneofParsingLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestOneofParsingLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestOneofParsingLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestOneofParsingLite& from);
+  void MergeFrom(const TestOneofParsingLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestOneofParsingLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestOneofParsingLite";
+  }
+  protected:
+  explicit TestOneofParsingLite(::google::protobuf::Arena* arena);
+  TestOneofParsingLite(::google::protobuf::Arena* arena, const TestOneofParsingLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOneofInt32FieldNumber = 1,
+    kOneofSubmessageFieldNumber = 2,
+    kOneofStringFieldNumber = 3,
+    kOneofBytesFieldNumber = 4,
+    kOneofStringCordFieldNumber = 5,
+    kOneofBytesCordFieldNumber = 6,
+    kOneofStringStringPieceFieldNumber = 7,
+    kOneofBytesStringPieceFieldNumber = 8,
+    kOneofEnumFieldNumber = 9,
+  };
+  // int32 oneof_int32 = 1;
+  bool has_oneof_int32() const;
+  void clear_oneof_int32() ;
+  ::int32_t oneof_int32() const;
+  void set_oneof_int32(::int32_t value);
+
+  private:
+  ::int32_t _internal_oneof_int32() const;
+  void _internal_set_oneof_int32(::int32_t value);
+
+  public:
+  // .protobuf_unittest.TestAllTypesLite oneof_submessage = 2;
+  bool has_oneof_submessage() const;
+  private:
+  bool _internal_has_oneof_submessage() const;
+
+  public:
+  void clear_oneof_submessage() ;
+  const ::protobuf_unittest::TestAllTypesLite& oneof_submessage() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_oneof_submessage();
+  ::protobuf_unittest::TestAllTypesLite* mutable_oneof_submessage();
+  void set_allocated_oneof_submessage(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_oneof_submessage(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_oneof_submessage();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_oneof_submessage() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_oneof_submessage();
+
+  public:
+  // string oneof_string = 3;
+  bool has_oneof_string() const;
+  void clear_oneof_string() ;
+  const std::string& oneof_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string();
+  PROTOBUF_NODISCARD std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+
+  public:
+  // bytes oneof_bytes = 4 [default = "default bytes"];
+  bool has_oneof_bytes() const;
+  void clear_oneof_bytes() ;
+  const std::string& oneof_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_bytes();
+  PROTOBUF_NODISCARD std::string* release_oneof_bytes();
+  void set_allocated_oneof_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_bytes();
+
+  public:
+  // string oneof_string_cord = 5 [default = "default Cord", ctype = CORD];
+  bool has_oneof_string_cord() const;
+  void clear_oneof_string_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& oneof_string_cord() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string_cord(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string_cord();
+  PROTOBUF_NODISCARD std::string* release_oneof_string_cord();
+  void set_allocated_oneof_string_cord(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string_cord() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string_cord(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string_cord();
+
+  public:
+  // bytes oneof_bytes_cord = 6 [ctype = CORD];
+  bool has_oneof_bytes_cord() const;
+  void clear_oneof_bytes_cord() ;
+  const ::absl::Cord& oneof_bytes_cord() const;
+  void set_oneof_bytes_cord(const ::absl::Cord& value);
+  void set_oneof_bytes_cord(::absl::string_view value);
+  private:
+  const ::absl::Cord& _internal_oneof_bytes_cord() const;
+  void _internal_set_oneof_bytes_cord(const ::absl::Cord& value);
+  ::absl::Cord* _internal_mutable_oneof_bytes_cord();
+  public:
+  // string oneof_string_string_piece = 7 [ctype = STRING_PIECE];
+  bool has_oneof_string_string_piece() const;
+  void clear_oneof_string_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& oneof_string_string_piece() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string_string_piece(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string_string_piece();
+  PROTOBUF_NODISCARD std::string* release_oneof_string_string_piece();
+  void set_allocated_oneof_string_string_piece(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string_string_piece() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string_string_piece(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string_string_piece();
+
+  public:
+  // bytes oneof_bytes_string_piece = 8 [default = "default StringPiece", ctype = STRING_PIECE];
+  bool has_oneof_bytes_string_piece() const;
+  void clear_oneof_bytes_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& oneof_bytes_string_piece() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_bytes_string_piece(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_bytes_string_piece();
+  PROTOBUF_NODISCARD std::string* release_oneof_bytes_string_piece();
+  void set_allocated_oneof_bytes_string_piece(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_bytes_string_piece() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_bytes_string_piece(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_bytes_string_piece();
+
+  public:
+  // .protobuf_unittest.V2EnumLite oneof_enum = 9;
+  bool has_oneof_enum() const;
+  void clear_oneof_enum() ;
+  ::protobuf_unittest::V2EnumLite oneof_enum() const;
+  void set_oneof_enum(::protobuf_unittest::V2EnumLite value);
+
+  private:
+  ::protobuf_unittest::V2EnumLite _internal_oneof_enum() const;
+  void _internal_set_oneof_enum(::protobuf_unittest::V2EnumLite value);
+
+  public:
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestOneofParsingLite)
+ private:
+  class _Internal;
+  void set_has_oneof_int32();
+  void set_has_oneof_submessage();
+  void set_has_oneof_string();
+  void set_has_oneof_bytes();
+  void set_has_oneof_string_cord();
+  void set_has_oneof_bytes_cord();
+  void set_has_oneof_string_string_piece();
+  void set_has_oneof_bytes_string_piece();
+  void set_has_oneof_enum();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 9, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    union OneofFieldUnion {
+      constexpr OneofFieldUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::int32_t oneof_int32_;
+      ::protobuf_unittest::TestAllTypesLite* oneof_submessage_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_bytes_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_cord_;
+      ::absl::Cord *oneof_bytes_cord_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_string_piece_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_bytes_string_piece_;
+      int oneof_enum_;
+    } oneof_field_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_oneof_bytes_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_oneof_string_cord_;
+    static const ::google::protobuf::internal::LazyString _i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestHugeFieldNumbersLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestHugeFieldNumbersLite) */ {
+ public:
+  inline TestHugeFieldNumbersLite() : TestHugeFieldNumbersLite(nullptr) {}
+  ~TestHugeFieldNumbersLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestHugeFieldNumbersLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestHugeFieldNumbersLite(const TestHugeFieldNumbersLite& from)
+      : TestHugeFieldNumbersLite(nullptr, from) {}
+  TestHugeFieldNumbersLite(TestHugeFieldNumbersLite&& from) noexcept
+    : TestHugeFieldNumbersLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestHugeFieldNumbersLite& operator=(const TestHugeFieldNumbersLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestHugeFieldNumbersLite& operator=(TestHugeFieldNumbersLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestHugeFieldNumbersLite& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofFieldCase {
+    kOneofUint32 = 536870011,
+    kOneofTestAllTypes = 536870012,
+    kOneofString = 536870013,
+    kOneofBytes = 536870014,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static inline const TestHugeFieldNumbersLite* internal_default_instance() {
+    return reinterpret_cast<const TestHugeFieldNumbersLite*>(
+               &_TestHugeFieldNumbersLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(TestHugeFieldNumbersLite& a, TestHugeFieldNumbersLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestHugeFieldNumbersLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestHugeFieldNumbersLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestHugeFieldNumbersLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestHugeFieldNumbersLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestHugeFieldNumbersLite& from);
+  void MergeFrom(const TestHugeFieldNumbersLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestHugeFieldNumbersLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestHugeFieldNumbersLite";
+  }
+  protected:
+  explicit TestHugeFieldNumbersLite(::google::protobuf::Arena* arena);
+  TestHugeFieldNumbersLite(::google::protobuf::Arena* arena, const TestHugeFieldNumbersLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  using OptionalGroup = TestHugeFieldNumbersLite_OptionalGroup;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 536870002,
+    kPackedInt32FieldNumber = 536870003,
+    kStringStringMapFieldNumber = 536870010,
+    kOptionalStringFieldNumber = 536870005,
+    kOptionalBytesFieldNumber = 536870006,
+    kOptionalMessageFieldNumber = 536870007,
+    kOptionalgroupFieldNumber = 536870008,
+    kOptionalInt32FieldNumber = 536870000,
+    kFixed32FieldNumber = 536870001,
+    kOptionalEnumFieldNumber = 536870004,
+    kOneofUint32FieldNumber = 536870011,
+    kOneofTestAllTypesFieldNumber = 536870012,
+    kOneofStringFieldNumber = 536870013,
+    kOneofBytesFieldNumber = 536870014,
+  };
+  // repeated int32 repeated_int32 = 536870002 [packed = false];
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // repeated int32 packed_int32 = 536870003 [packed = true];
+  int packed_int32_size() const;
+  private:
+  int _internal_packed_int32_size() const;
+
+  public:
+  void clear_packed_int32() ;
+  ::int32_t packed_int32(int index) const;
+  void set_packed_int32(int index, ::int32_t value);
+  void add_packed_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_int32();
+
+  public:
+  // map<string, string> string_string_map = 536870010;
+  int string_string_map_size() const;
+  private:
+  int _internal_string_string_map_size() const;
+
+  public:
+  void clear_string_string_map() ;
+  const ::google::protobuf::Map<std::string, std::string>& string_string_map() const;
+  ::google::protobuf::Map<std::string, std::string>* mutable_string_string_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, std::string>& _internal_string_string_map() const;
+  ::google::protobuf::Map<std::string, std::string>* _internal_mutable_string_string_map();
+
+  public:
+  // optional string optional_string = 536870005;
+  bool has_optional_string() const;
+  void clear_optional_string() ;
+  const std::string& optional_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string();
+  PROTOBUF_NODISCARD std::string* release_optional_string();
+  void set_allocated_optional_string(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string();
+
+  public:
+  // optional bytes optional_bytes = 536870006;
+  bool has_optional_bytes() const;
+  void clear_optional_bytes() ;
+  const std::string& optional_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_bytes();
+  PROTOBUF_NODISCARD std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_optional_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_optional_bytes();
+
+  public:
+  // optional .protobuf_unittest.ForeignMessageLite optional_message = 536870007;
+  bool has_optional_message() const;
+  void clear_optional_message() ;
+  const ::protobuf_unittest::ForeignMessageLite& optional_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::ForeignMessageLite* release_optional_message();
+  ::protobuf_unittest::ForeignMessageLite* mutable_optional_message();
+  void set_allocated_optional_message(::protobuf_unittest::ForeignMessageLite* value);
+  void unsafe_arena_set_allocated_optional_message(::protobuf_unittest::ForeignMessageLite* value);
+  ::protobuf_unittest::ForeignMessageLite* unsafe_arena_release_optional_message();
+
+  private:
+  const ::protobuf_unittest::ForeignMessageLite& _internal_optional_message() const;
+  ::protobuf_unittest::ForeignMessageLite* _internal_mutable_optional_message();
+
+  public:
+  // optional group OptionalGroup = 536870008 { ... };
+  bool has_optionalgroup() const;
+  void clear_optionalgroup() ;
+  const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup& optionalgroup() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* release_optionalgroup();
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* mutable_optionalgroup();
+  void set_allocated_optionalgroup(::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* value);
+  void unsafe_arena_set_allocated_optionalgroup(::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* value);
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* unsafe_arena_release_optionalgroup();
+
+  private:
+  const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup& _internal_optionalgroup() const;
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* _internal_mutable_optionalgroup();
+
+  public:
+  // optional int32 optional_int32 = 536870000;
+  bool has_optional_int32() const;
+  void clear_optional_int32() ;
+  ::int32_t optional_int32() const;
+  void set_optional_int32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_int32() const;
+  void _internal_set_optional_int32(::int32_t value);
+
+  public:
+  // optional int32 fixed_32 = 536870001;
+  bool has_fixed_32() const;
+  void clear_fixed_32() ;
+  ::int32_t fixed_32() const;
+  void set_fixed_32(::int32_t value);
+
+  private:
+  ::int32_t _internal_fixed_32() const;
+  void _internal_set_fixed_32(::int32_t value);
+
+  public:
+  // optional .protobuf_unittest.ForeignEnumLite optional_enum = 536870004;
+  bool has_optional_enum() const;
+  void clear_optional_enum() ;
+  ::protobuf_unittest::ForeignEnumLite optional_enum() const;
+  void set_optional_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  private:
+  ::protobuf_unittest::ForeignEnumLite _internal_optional_enum() const;
+  void _internal_set_optional_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  public:
+  // uint32 oneof_uint32 = 536870011;
+  bool has_oneof_uint32() const;
+  void clear_oneof_uint32() ;
+  ::uint32_t oneof_uint32() const;
+  void set_oneof_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_oneof_uint32() const;
+  void _internal_set_oneof_uint32(::uint32_t value);
+
+  public:
+  // .protobuf_unittest.TestAllTypesLite oneof_test_all_types = 536870012;
+  bool has_oneof_test_all_types() const;
+  private:
+  bool _internal_has_oneof_test_all_types() const;
+
+  public:
+  void clear_oneof_test_all_types() ;
+  const ::protobuf_unittest::TestAllTypesLite& oneof_test_all_types() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_oneof_test_all_types();
+  ::protobuf_unittest::TestAllTypesLite* mutable_oneof_test_all_types();
+  void set_allocated_oneof_test_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_oneof_test_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_oneof_test_all_types();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_oneof_test_all_types() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_oneof_test_all_types();
+
+  public:
+  // string oneof_string = 536870013;
+  bool has_oneof_string() const;
+  void clear_oneof_string() ;
+  const std::string& oneof_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string();
+  PROTOBUF_NODISCARD std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+
+  public:
+  // bytes oneof_bytes = 536870014;
+  bool has_oneof_bytes() const;
+  void clear_oneof_bytes() ;
+  const std::string& oneof_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_bytes();
+  PROTOBUF_NODISCARD std::string* release_oneof_bytes();
+  void set_allocated_oneof_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_bytes();
+
+  public:
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestHugeFieldNumbersLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestHugeFieldNumbersLite)
+ private:
+  class _Internal;
+  void set_has_oneof_uint32();
+  void set_has_oneof_test_all_types();
+  void set_has_oneof_string();
+  void set_has_oneof_bytes();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 14, 5,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    ::google::protobuf::RepeatedField<::int32_t> packed_int32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_int32_cached_byte_size_;
+    ::google::protobuf::internal::MapFieldLite<std::string, std::string> string_string_map_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_;
+    ::google::protobuf::internal::ArenaStringPtr optional_bytes_;
+    ::protobuf_unittest::ForeignMessageLite* optional_message_;
+    ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* optionalgroup_;
+    ::int32_t optional_int32_;
+    ::int32_t fixed_32_;
+    int optional_enum_;
+    union OneofFieldUnion {
+      constexpr OneofFieldUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::uint32_t oneof_uint32_;
+      ::protobuf_unittest::TestAllTypesLite* oneof_test_all_types_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_bytes_;
+    } oneof_field_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestParsingMergeLite_RepeatedFieldsGenerator final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator) */ {
+ public:
+  inline TestParsingMergeLite_RepeatedFieldsGenerator() : TestParsingMergeLite_RepeatedFieldsGenerator(nullptr) {}
+  ~TestParsingMergeLite_RepeatedFieldsGenerator() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestParsingMergeLite_RepeatedFieldsGenerator(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestParsingMergeLite_RepeatedFieldsGenerator(const TestParsingMergeLite_RepeatedFieldsGenerator& from)
+      : TestParsingMergeLite_RepeatedFieldsGenerator(nullptr, from) {}
+  TestParsingMergeLite_RepeatedFieldsGenerator(TestParsingMergeLite_RepeatedFieldsGenerator&& from) noexcept
+    : TestParsingMergeLite_RepeatedFieldsGenerator() {
+    *this = ::std::move(from);
+  }
+
+  inline TestParsingMergeLite_RepeatedFieldsGenerator& operator=(const TestParsingMergeLite_RepeatedFieldsGenerator& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestParsingMergeLite_RepeatedFieldsGenerator& operator=(TestParsingMergeLite_RepeatedFieldsGenerator&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestParsingMergeLite_RepeatedFieldsGenerator& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestParsingMergeLite_RepeatedFieldsGenerator* internal_default_instance() {
+    return reinterpret_cast<const TestParsingMergeLite_RepeatedFieldsGenerator*>(
+               &_TestParsingMergeLite_RepeatedFieldsGenerator_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(TestParsingMergeLite_RepeatedFieldsGenerator& a, TestParsingMergeLite_RepeatedFieldsGenerator& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestParsingMergeLite_RepeatedFieldsGenerator* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestParsingMergeLite_RepeatedFieldsGenerator* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestParsingMergeLite_RepeatedFieldsGenerator* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestParsingMergeLite_RepeatedFieldsGenerator>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestParsingMergeLite_RepeatedFieldsGenerator& from);
+  void MergeFrom(const TestParsingMergeLite_RepeatedFieldsGenerator& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestParsingMergeLite_RepeatedFieldsGenerator* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator";
+  }
+  protected:
+  explicit TestParsingMergeLite_RepeatedFieldsGenerator(::google::protobuf::Arena* arena);
+  TestParsingMergeLite_RepeatedFieldsGenerator(::google::protobuf::Arena* arena, const TestParsingMergeLite_RepeatedFieldsGenerator& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  using Group1 = TestParsingMergeLite_RepeatedFieldsGenerator_Group1;
+  using Group2 = TestParsingMergeLite_RepeatedFieldsGenerator_Group2;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kField1FieldNumber = 1,
+    kField2FieldNumber = 2,
+    kField3FieldNumber = 3,
+    kGroup1FieldNumber = 10,
+    kGroup2FieldNumber = 20,
+    kExt1FieldNumber = 1000,
+    kExt2FieldNumber = 1001,
+  };
+  // repeated .protobuf_unittest.TestAllTypesLite field1 = 1;
+  int field1_size() const;
+  private:
+  int _internal_field1_size() const;
+
+  public:
+  void clear_field1() ;
+  ::protobuf_unittest::TestAllTypesLite* mutable_field1(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >*
+      mutable_field1();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& _internal_field1() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* _internal_mutable_field1();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite& field1(int index) const;
+  ::protobuf_unittest::TestAllTypesLite* add_field1();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >&
+      field1() const;
+  // repeated .protobuf_unittest.TestAllTypesLite field2 = 2;
+  int field2_size() const;
+  private:
+  int _internal_field2_size() const;
+
+  public:
+  void clear_field2() ;
+  ::protobuf_unittest::TestAllTypesLite* mutable_field2(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >*
+      mutable_field2();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& _internal_field2() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* _internal_mutable_field2();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite& field2(int index) const;
+  ::protobuf_unittest::TestAllTypesLite* add_field2();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >&
+      field2() const;
+  // repeated .protobuf_unittest.TestAllTypesLite field3 = 3;
+  int field3_size() const;
+  private:
+  int _internal_field3_size() const;
+
+  public:
+  void clear_field3() ;
+  ::protobuf_unittest::TestAllTypesLite* mutable_field3(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >*
+      mutable_field3();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& _internal_field3() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* _internal_mutable_field3();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite& field3(int index) const;
+  ::protobuf_unittest::TestAllTypesLite* add_field3();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >&
+      field3() const;
+  // repeated group Group1 = 10 { ... };
+  int group1_size() const;
+  private:
+  int _internal_group1_size() const;
+
+  public:
+  void clear_group1() ;
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1* mutable_group1(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1 >*
+      mutable_group1();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1>& _internal_group1() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1>* _internal_mutable_group1();
+  public:
+  const ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1& group1(int index) const;
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1* add_group1();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1 >&
+      group1() const;
+  // repeated group Group2 = 20 { ... };
+  int group2_size() const;
+  private:
+  int _internal_group2_size() const;
+
+  public:
+  void clear_group2() ;
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2* mutable_group2(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2 >*
+      mutable_group2();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2>& _internal_group2() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2>* _internal_mutable_group2();
+  public:
+  const ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2& group2(int index) const;
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2* add_group2();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2 >&
+      group2() const;
+  // repeated .protobuf_unittest.TestAllTypesLite ext1 = 1000;
+  int ext1_size() const;
+  private:
+  int _internal_ext1_size() const;
+
+  public:
+  void clear_ext1() ;
+  ::protobuf_unittest::TestAllTypesLite* mutable_ext1(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >*
+      mutable_ext1();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& _internal_ext1() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* _internal_mutable_ext1();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite& ext1(int index) const;
+  ::protobuf_unittest::TestAllTypesLite* add_ext1();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >&
+      ext1() const;
+  // repeated .protobuf_unittest.TestAllTypesLite ext2 = 1001;
+  int ext2_size() const;
+  private:
+  int _internal_ext2_size() const;
+
+  public:
+  void clear_ext2() ;
+  ::protobuf_unittest::TestAllTypesLite* mutable_ext2(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >*
+      mutable_ext2();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& _internal_ext2() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* _internal_mutable_ext2();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite& ext2(int index) const;
+  ::protobuf_unittest::TestAllTypesLite* add_ext2();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >&
+      ext2() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 7, 7,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite > field1_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite > field2_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite > field3_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1 > group1_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2 > group2_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite > ext1_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite > ext2_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};// -------------------------------------------------------------------
+
+class TestParsingMergeLite final :
+    public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestParsingMergeLite) */ {
+ public:
+  inline TestParsingMergeLite() : TestParsingMergeLite(nullptr) {}
+  ~TestParsingMergeLite() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestParsingMergeLite(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestParsingMergeLite(const TestParsingMergeLite& from)
+      : TestParsingMergeLite(nullptr, from) {}
+  TestParsingMergeLite(TestParsingMergeLite&& from) noexcept
+    : TestParsingMergeLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestParsingMergeLite& operator=(const TestParsingMergeLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestParsingMergeLite& operator=(TestParsingMergeLite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<std::string>(::google::protobuf::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestParsingMergeLite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestParsingMergeLite* internal_default_instance() {
+    return reinterpret_cast<const TestParsingMergeLite*>(
+               &_TestParsingMergeLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(TestParsingMergeLite& a, TestParsingMergeLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestParsingMergeLite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestParsingMergeLite* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestParsingMergeLite* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestParsingMergeLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)  final;
+  void CopyFrom(const TestParsingMergeLite& from);
+  void MergeFrom(const TestParsingMergeLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestParsingMergeLite* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestParsingMergeLite";
+  }
+  protected:
+  explicit TestParsingMergeLite(::google::protobuf::Arena* arena);
+  TestParsingMergeLite(::google::protobuf::Arena* arena, const TestParsingMergeLite& from);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  using RepeatedFieldsGenerator = TestParsingMergeLite_RepeatedFieldsGenerator;
+  using OptionalGroup = TestParsingMergeLite_OptionalGroup;
+  using RepeatedGroup = TestParsingMergeLite_RepeatedGroup;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedAllTypesFieldNumber = 3,
+    kRepeatedgroupFieldNumber = 20,
+    kRequiredAllTypesFieldNumber = 1,
+    kOptionalAllTypesFieldNumber = 2,
+    kOptionalgroupFieldNumber = 10,
+  };
+  // repeated .protobuf_unittest.TestAllTypesLite repeated_all_types = 3;
+  int repeated_all_types_size() const;
+  private:
+  int _internal_repeated_all_types_size() const;
+
+  public:
+  void clear_repeated_all_types() ;
+  ::protobuf_unittest::TestAllTypesLite* mutable_repeated_all_types(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >*
+      mutable_repeated_all_types();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& _internal_repeated_all_types() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* _internal_mutable_repeated_all_types();
+  public:
+  const ::protobuf_unittest::TestAllTypesLite& repeated_all_types(int index) const;
+  ::protobuf_unittest::TestAllTypesLite* add_repeated_all_types();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite >&
+      repeated_all_types() const;
+  // repeated group RepeatedGroup = 20 { ... };
+  int repeatedgroup_size() const;
+  private:
+  int _internal_repeatedgroup_size() const;
+
+  public:
+  void clear_repeatedgroup() ;
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup* mutable_repeatedgroup(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup >*
+      mutable_repeatedgroup();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedGroup>& _internal_repeatedgroup() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedGroup>* _internal_mutable_repeatedgroup();
+  public:
+  const ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup& repeatedgroup(int index) const;
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup* add_repeatedgroup();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup >&
+      repeatedgroup() const;
+  // required .protobuf_unittest.TestAllTypesLite required_all_types = 1;
+  bool has_required_all_types() const;
+  void clear_required_all_types() ;
+  const ::protobuf_unittest::TestAllTypesLite& required_all_types() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_required_all_types();
+  ::protobuf_unittest::TestAllTypesLite* mutable_required_all_types();
+  void set_allocated_required_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_required_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_required_all_types();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_required_all_types() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_required_all_types();
+
+  public:
+  // optional .protobuf_unittest.TestAllTypesLite optional_all_types = 2;
+  bool has_optional_all_types() const;
+  void clear_optional_all_types() ;
+  const ::protobuf_unittest::TestAllTypesLite& optional_all_types() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypesLite* release_optional_all_types();
+  ::protobuf_unittest::TestAllTypesLite* mutable_optional_all_types();
+  void set_allocated_optional_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  void unsafe_arena_set_allocated_optional_all_types(::protobuf_unittest::TestAllTypesLite* value);
+  ::protobuf_unittest::TestAllTypesLite* unsafe_arena_release_optional_all_types();
+
+  private:
+  const ::protobuf_unittest::TestAllTypesLite& _internal_optional_all_types() const;
+  ::protobuf_unittest::TestAllTypesLite* _internal_mutable_optional_all_types();
+
+  public:
+  // optional group OptionalGroup = 10 { ... };
+  bool has_optionalgroup() const;
+  void clear_optionalgroup() ;
+  const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup& optionalgroup() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* release_optionalgroup();
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* mutable_optionalgroup();
+  void set_allocated_optionalgroup(::protobuf_unittest::TestParsingMergeLite_OptionalGroup* value);
+  void unsafe_arena_set_allocated_optionalgroup(::protobuf_unittest::TestParsingMergeLite_OptionalGroup* value);
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* unsafe_arena_release_optionalgroup();
+
+  private:
+  const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup& _internal_optionalgroup() const;
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* _internal_mutable_optionalgroup();
+
+  public:
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestParsingMergeLite, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  static const int kOptionalExtFieldNumber = 1000;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestParsingMergeLite,
+      ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite >, 11, false >
+    optional_ext;
+  static const int kRepeatedExtFieldNumber = 1001;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestParsingMergeLite,
+      ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite >, 11, false >
+    repeated_ext;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestParsingMergeLite)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 5, 5,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypesLite > repeated_all_types_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup > repeatedgroup_;
+    ::protobuf_unittest::TestAllTypesLite* required_all_types_;
+    ::protobuf_unittest::TestAllTypesLite* optional_all_types_;
+    ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* optionalgroup_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_2eproto;
+};
+
+// ===================================================================
+
+
+
+static const int kOptionalInt32ExtensionLiteFieldNumber = 1;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  optional_int32_extension_lite;
+static const int kOptionalInt64ExtensionLiteFieldNumber = 2;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 3, false >
+  optional_int64_extension_lite;
+static const int kOptionalUint32ExtensionLiteFieldNumber = 3;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 13, false >
+  optional_uint32_extension_lite;
+static const int kOptionalUint64ExtensionLiteFieldNumber = 4;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 4, false >
+  optional_uint64_extension_lite;
+static const int kOptionalSint32ExtensionLiteFieldNumber = 5;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 17, false >
+  optional_sint32_extension_lite;
+static const int kOptionalSint64ExtensionLiteFieldNumber = 6;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 18, false >
+  optional_sint64_extension_lite;
+static const int kOptionalFixed32ExtensionLiteFieldNumber = 7;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 7, false >
+  optional_fixed32_extension_lite;
+static const int kOptionalFixed64ExtensionLiteFieldNumber = 8;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 6, false >
+  optional_fixed64_extension_lite;
+static const int kOptionalSfixed32ExtensionLiteFieldNumber = 9;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 15, false >
+  optional_sfixed32_extension_lite;
+static const int kOptionalSfixed64ExtensionLiteFieldNumber = 10;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 16, false >
+  optional_sfixed64_extension_lite;
+static const int kOptionalFloatExtensionLiteFieldNumber = 11;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< float >, 2, false >
+  optional_float_extension_lite;
+static const int kOptionalDoubleExtensionLiteFieldNumber = 12;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< double >, 1, false >
+  optional_double_extension_lite;
+static const int kOptionalBoolExtensionLiteFieldNumber = 13;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false >
+  optional_bool_extension_lite;
+static const int kOptionalStringExtensionLiteFieldNumber = 14;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  optional_string_extension_lite;
+static const int kOptionalBytesExtensionLiteFieldNumber = 15;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 12, false >
+  optional_bytes_extension_lite;
+static const int kOptionalgroupExtensionLiteFieldNumber = 16;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionalGroup_extension_lite >, 10, false >
+  optionalgroup_extension_lite;
+static const int kOptionalNestedMessageExtensionLiteFieldNumber = 18;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  optional_nested_message_extension_lite;
+static const int kOptionalForeignMessageExtensionLiteFieldNumber = 19;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ForeignMessageLite >, 11, false >
+  optional_foreign_message_extension_lite;
+static const int kOptionalImportMessageExtensionLiteFieldNumber = 20;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest_import::ImportMessageLite >, 11, false >
+  optional_import_message_extension_lite;
+static const int kOptionalNestedEnumExtensionLiteFieldNumber = 21;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
+  optional_nested_enum_extension_lite;
+static const int kOptionalForeignEnumExtensionLiteFieldNumber = 22;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, false >
+  optional_foreign_enum_extension_lite;
+static const int kOptionalImportEnumExtensionLiteFieldNumber = 23;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest_import::ImportEnumLite, ::protobuf_unittest_import::ImportEnumLite_IsValid>, 14, false >
+  optional_import_enum_extension_lite;
+static const int kOptionalStringPieceExtensionLiteFieldNumber = 24;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  optional_string_piece_extension_lite;
+static const int kOptionalCordExtensionLiteFieldNumber = 25;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  optional_cord_extension_lite;
+static const int kOptionalPublicImportMessageExtensionLiteFieldNumber = 26;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest_import::PublicImportMessageLite >, 11, false >
+  optional_public_import_message_extension_lite;
+static const int kOptionalLazyMessageExtensionLiteFieldNumber = 27;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  optional_lazy_message_extension_lite;
+static const int kOptionalUnverifiedLazyMessageExtensionLiteFieldNumber = 28;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  optional_unverified_lazy_message_extension_lite;
+static const int kRepeatedInt32ExtensionLiteFieldNumber = 31;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int32_t >, 5, false >
+  repeated_int32_extension_lite;
+static const int kRepeatedInt64ExtensionLiteFieldNumber = 32;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int64_t >, 3, false >
+  repeated_int64_extension_lite;
+static const int kRepeatedUint32ExtensionLiteFieldNumber = 33;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint32_t >, 13, false >
+  repeated_uint32_extension_lite;
+static const int kRepeatedUint64ExtensionLiteFieldNumber = 34;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint64_t >, 4, false >
+  repeated_uint64_extension_lite;
+static const int kRepeatedSint32ExtensionLiteFieldNumber = 35;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int32_t >, 17, false >
+  repeated_sint32_extension_lite;
+static const int kRepeatedSint64ExtensionLiteFieldNumber = 36;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int64_t >, 18, false >
+  repeated_sint64_extension_lite;
+static const int kRepeatedFixed32ExtensionLiteFieldNumber = 37;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint32_t >, 7, false >
+  repeated_fixed32_extension_lite;
+static const int kRepeatedFixed64ExtensionLiteFieldNumber = 38;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint64_t >, 6, false >
+  repeated_fixed64_extension_lite;
+static const int kRepeatedSfixed32ExtensionLiteFieldNumber = 39;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int32_t >, 15, false >
+  repeated_sfixed32_extension_lite;
+static const int kRepeatedSfixed64ExtensionLiteFieldNumber = 40;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int64_t >, 16, false >
+  repeated_sfixed64_extension_lite;
+static const int kRepeatedFloatExtensionLiteFieldNumber = 41;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< float >, 2, false >
+  repeated_float_extension_lite;
+static const int kRepeatedDoubleExtensionLiteFieldNumber = 42;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< double >, 1, false >
+  repeated_double_extension_lite;
+static const int kRepeatedBoolExtensionLiteFieldNumber = 43;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< bool >, 8, false >
+  repeated_bool_extension_lite;
+static const int kRepeatedStringExtensionLiteFieldNumber = 44;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  repeated_string_extension_lite;
+static const int kRepeatedBytesExtensionLiteFieldNumber = 45;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 12, false >
+  repeated_bytes_extension_lite;
+static const int kRepeatedgroupExtensionLiteFieldNumber = 46;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::RepeatedGroup_extension_lite >, 10, false >
+  repeatedgroup_extension_lite;
+static const int kRepeatedNestedMessageExtensionLiteFieldNumber = 48;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  repeated_nested_message_extension_lite;
+static const int kRepeatedForeignMessageExtensionLiteFieldNumber = 49;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::ForeignMessageLite >, 11, false >
+  repeated_foreign_message_extension_lite;
+static const int kRepeatedImportMessageExtensionLiteFieldNumber = 50;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest_import::ImportMessageLite >, 11, false >
+  repeated_import_message_extension_lite;
+static const int kRepeatedNestedEnumExtensionLiteFieldNumber = 51;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
+  repeated_nested_enum_extension_lite;
+static const int kRepeatedForeignEnumExtensionLiteFieldNumber = 52;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, false >
+  repeated_foreign_enum_extension_lite;
+static const int kRepeatedImportEnumExtensionLiteFieldNumber = 53;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedEnumTypeTraits< ::protobuf_unittest_import::ImportEnumLite, ::protobuf_unittest_import::ImportEnumLite_IsValid>, 14, false >
+  repeated_import_enum_extension_lite;
+static const int kRepeatedStringPieceExtensionLiteFieldNumber = 54;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  repeated_string_piece_extension_lite;
+static const int kRepeatedCordExtensionLiteFieldNumber = 55;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  repeated_cord_extension_lite;
+static const int kRepeatedLazyMessageExtensionLiteFieldNumber = 57;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  repeated_lazy_message_extension_lite;
+static const int kDefaultInt32ExtensionLiteFieldNumber = 61;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  default_int32_extension_lite;
+static const int kDefaultInt64ExtensionLiteFieldNumber = 62;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 3, false >
+  default_int64_extension_lite;
+static const int kDefaultUint32ExtensionLiteFieldNumber = 63;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 13, false >
+  default_uint32_extension_lite;
+static const int kDefaultUint64ExtensionLiteFieldNumber = 64;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 4, false >
+  default_uint64_extension_lite;
+static const int kDefaultSint32ExtensionLiteFieldNumber = 65;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 17, false >
+  default_sint32_extension_lite;
+static const int kDefaultSint64ExtensionLiteFieldNumber = 66;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 18, false >
+  default_sint64_extension_lite;
+static const int kDefaultFixed32ExtensionLiteFieldNumber = 67;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 7, false >
+  default_fixed32_extension_lite;
+static const int kDefaultFixed64ExtensionLiteFieldNumber = 68;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint64_t >, 6, false >
+  default_fixed64_extension_lite;
+static const int kDefaultSfixed32ExtensionLiteFieldNumber = 69;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 15, false >
+  default_sfixed32_extension_lite;
+static const int kDefaultSfixed64ExtensionLiteFieldNumber = 70;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int64_t >, 16, false >
+  default_sfixed64_extension_lite;
+static const int kDefaultFloatExtensionLiteFieldNumber = 71;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< float >, 2, false >
+  default_float_extension_lite;
+static const int kDefaultDoubleExtensionLiteFieldNumber = 72;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< double >, 1, false >
+  default_double_extension_lite;
+static const int kDefaultBoolExtensionLiteFieldNumber = 73;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false >
+  default_bool_extension_lite;
+static const int kDefaultStringExtensionLiteFieldNumber = 74;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  default_string_extension_lite;
+static const int kDefaultBytesExtensionLiteFieldNumber = 75;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 12, false >
+  default_bytes_extension_lite;
+static const int kDefaultNestedEnumExtensionLiteFieldNumber = 81;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
+  default_nested_enum_extension_lite;
+static const int kDefaultForeignEnumExtensionLiteFieldNumber = 82;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, false >
+  default_foreign_enum_extension_lite;
+static const int kDefaultImportEnumExtensionLiteFieldNumber = 83;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest_import::ImportEnumLite, ::protobuf_unittest_import::ImportEnumLite_IsValid>, 14, false >
+  default_import_enum_extension_lite;
+static const int kDefaultStringPieceExtensionLiteFieldNumber = 84;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  default_string_piece_extension_lite;
+static const int kDefaultCordExtensionLiteFieldNumber = 85;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  default_cord_extension_lite;
+static const int kOneofUint32ExtensionLiteFieldNumber = 111;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::uint32_t >, 13, false >
+  oneof_uint32_extension_lite;
+static const int kOneofNestedMessageExtensionLiteFieldNumber = 112;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  oneof_nested_message_extension_lite;
+static const int kOneofStringExtensionLiteFieldNumber = 113;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  oneof_string_extension_lite;
+static const int kOneofBytesExtensionLiteFieldNumber = 114;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::google::protobuf::internal::StringTypeTraits, 12, false >
+  oneof_bytes_extension_lite;
+static const int kPackedInt32ExtensionLiteFieldNumber = 90;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int32_t >, 5, true >
+  packed_int32_extension_lite;
+static const int kPackedInt64ExtensionLiteFieldNumber = 91;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int64_t >, 3, true >
+  packed_int64_extension_lite;
+static const int kPackedUint32ExtensionLiteFieldNumber = 92;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint32_t >, 13, true >
+  packed_uint32_extension_lite;
+static const int kPackedUint64ExtensionLiteFieldNumber = 93;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint64_t >, 4, true >
+  packed_uint64_extension_lite;
+static const int kPackedSint32ExtensionLiteFieldNumber = 94;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int32_t >, 17, true >
+  packed_sint32_extension_lite;
+static const int kPackedSint64ExtensionLiteFieldNumber = 95;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int64_t >, 18, true >
+  packed_sint64_extension_lite;
+static const int kPackedFixed32ExtensionLiteFieldNumber = 96;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint32_t >, 7, true >
+  packed_fixed32_extension_lite;
+static const int kPackedFixed64ExtensionLiteFieldNumber = 97;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::uint64_t >, 6, true >
+  packed_fixed64_extension_lite;
+static const int kPackedSfixed32ExtensionLiteFieldNumber = 98;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int32_t >, 15, true >
+  packed_sfixed32_extension_lite;
+static const int kPackedSfixed64ExtensionLiteFieldNumber = 99;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< ::int64_t >, 16, true >
+  packed_sfixed64_extension_lite;
+static const int kPackedFloatExtensionLiteFieldNumber = 100;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< float >, 2, true >
+  packed_float_extension_lite;
+static const int kPackedDoubleExtensionLiteFieldNumber = 101;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< double >, 1, true >
+  packed_double_extension_lite;
+static const int kPackedBoolExtensionLiteFieldNumber = 102;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedPrimitiveTypeTraits< bool >, 8, true >
+  packed_bool_extension_lite;
+static const int kPackedEnumExtensionLiteFieldNumber = 103;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::google::protobuf::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, true >
+  packed_enum_extension_lite;
+static const int kTestAllTypesLiteFieldNumber = 536860000;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestHugeFieldNumbersLite,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite >, 11, false >
+  test_all_types_lite;
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestAllTypesLite_NestedMessage
+
+// optional int32 bb = 1;
+inline bool TestAllTypesLite_NestedMessage::has_bb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void TestAllTypesLite_NestedMessage::clear_bb() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bb_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::int32_t TestAllTypesLite_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.NestedMessage.bb)
+  return _internal_bb();
+}
+inline void TestAllTypesLite_NestedMessage::set_bb(::int32_t value) {
+  _internal_set_bb(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.NestedMessage.bb)
+}
+inline ::int32_t TestAllTypesLite_NestedMessage::_internal_bb() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bb_;
+}
+inline void TestAllTypesLite_NestedMessage::_internal_set_bb(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bb_ = value;
+}
+
+// optional int64 cc = 2;
+inline bool TestAllTypesLite_NestedMessage::has_cc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestAllTypesLite_NestedMessage::clear_cc() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.cc_ = ::int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int64_t TestAllTypesLite_NestedMessage::cc() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.NestedMessage.cc)
+  return _internal_cc();
+}
+inline void TestAllTypesLite_NestedMessage::set_cc(::int64_t value) {
+  _internal_set_cc(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.NestedMessage.cc)
+}
+inline ::int64_t TestAllTypesLite_NestedMessage::_internal_cc() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.cc_;
+}
+inline void TestAllTypesLite_NestedMessage::_internal_set_cc(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cc_ = value;
+}
+
+// repeated int32 dd = 3 [packed = true];
+inline int TestAllTypesLite_NestedMessage::_internal_dd_size() const {
+  return _internal_dd().size();
+}
+inline int TestAllTypesLite_NestedMessage::dd_size() const {
+  return _internal_dd_size();
+}
+inline void TestAllTypesLite_NestedMessage::clear_dd() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.dd_.Clear();
+}
+inline ::int32_t TestAllTypesLite_NestedMessage::dd(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.NestedMessage.dd)
+  return _internal_dd().Get(index);
+}
+inline void TestAllTypesLite_NestedMessage::set_dd(int index, ::int32_t value) {
+  _internal_mutable_dd()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.NestedMessage.dd)
+}
+inline void TestAllTypesLite_NestedMessage::add_dd(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_dd()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.NestedMessage.dd)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite_NestedMessage::dd() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.NestedMessage.dd)
+  return _internal_dd();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite_NestedMessage::mutable_dd()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.NestedMessage.dd)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_dd();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite_NestedMessage::_internal_dd()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.dd_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite_NestedMessage::_internal_mutable_dd() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.dd_;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypesLite_NestedMessage2
+
+// optional int32 dd = 1;
+inline bool TestAllTypesLite_NestedMessage2::has_dd() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestAllTypesLite_NestedMessage2::clear_dd() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.dd_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t TestAllTypesLite_NestedMessage2::dd() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.NestedMessage2.dd)
+  return _internal_dd();
+}
+inline void TestAllTypesLite_NestedMessage2::set_dd(::int32_t value) {
+  _internal_set_dd(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.NestedMessage2.dd)
+}
+inline ::int32_t TestAllTypesLite_NestedMessage2::_internal_dd() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.dd_;
+}
+inline void TestAllTypesLite_NestedMessage2::_internal_set_dd(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.dd_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypesLite_OptionalGroup
+
+// optional int32 a = 17;
+inline bool TestAllTypesLite_OptionalGroup::has_a() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestAllTypesLite_OptionalGroup::clear_a() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.a_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t TestAllTypesLite_OptionalGroup::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.OptionalGroup.a)
+  return _internal_a();
+}
+inline void TestAllTypesLite_OptionalGroup::set_a(::int32_t value) {
+  _internal_set_a(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.OptionalGroup.a)
+}
+inline ::int32_t TestAllTypesLite_OptionalGroup::_internal_a() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.a_;
+}
+inline void TestAllTypesLite_OptionalGroup::_internal_set_a(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypesLite_RepeatedGroup
+
+// optional int32 a = 47;
+inline bool TestAllTypesLite_RepeatedGroup::has_a() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestAllTypesLite_RepeatedGroup::clear_a() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.a_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t TestAllTypesLite_RepeatedGroup::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.RepeatedGroup.a)
+  return _internal_a();
+}
+inline void TestAllTypesLite_RepeatedGroup::set_a(::int32_t value) {
+  _internal_set_a(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.RepeatedGroup.a)
+}
+inline ::int32_t TestAllTypesLite_RepeatedGroup::_internal_a() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.a_;
+}
+inline void TestAllTypesLite_RepeatedGroup::_internal_set_a(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypesLite
+
+// optional int32 optional_int32 = 1;
+inline bool TestAllTypesLite::has_optional_int32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int32_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline ::int32_t TestAllTypesLite::optional_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_int32)
+  return _internal_optional_int32();
+}
+inline void TestAllTypesLite::set_optional_int32(::int32_t value) {
+  _internal_set_optional_int32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_int32)
+}
+inline ::int32_t TestAllTypesLite::_internal_optional_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int32_;
+}
+inline void TestAllTypesLite::_internal_set_optional_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.optional_int32_ = value;
+}
+
+// optional int64 optional_int64 = 2;
+inline bool TestAllTypesLite::has_optional_int64() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int64_ = ::int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline ::int64_t TestAllTypesLite::optional_int64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_int64)
+  return _internal_optional_int64();
+}
+inline void TestAllTypesLite::set_optional_int64(::int64_t value) {
+  _internal_set_optional_int64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_int64)
+}
+inline ::int64_t TestAllTypesLite::_internal_optional_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int64_;
+}
+inline void TestAllTypesLite::_internal_set_optional_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.optional_int64_ = value;
+}
+
+// optional uint32 optional_uint32 = 3;
+inline bool TestAllTypesLite::has_optional_uint32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_uint32_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline ::uint32_t TestAllTypesLite::optional_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_uint32)
+  return _internal_optional_uint32();
+}
+inline void TestAllTypesLite::set_optional_uint32(::uint32_t value) {
+  _internal_set_optional_uint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_uint32)
+}
+inline ::uint32_t TestAllTypesLite::_internal_optional_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_uint32_;
+}
+inline void TestAllTypesLite::_internal_set_optional_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.optional_uint32_ = value;
+}
+
+// optional uint64 optional_uint64 = 4;
+inline bool TestAllTypesLite::has_optional_uint64() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_uint64_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline ::uint64_t TestAllTypesLite::optional_uint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_uint64)
+  return _internal_optional_uint64();
+}
+inline void TestAllTypesLite::set_optional_uint64(::uint64_t value) {
+  _internal_set_optional_uint64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_uint64)
+}
+inline ::uint64_t TestAllTypesLite::_internal_optional_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_uint64_;
+}
+inline void TestAllTypesLite::_internal_set_optional_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.optional_uint64_ = value;
+}
+
+// optional sint32 optional_sint32 = 5;
+inline bool TestAllTypesLite::has_optional_sint32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sint32_ = 0;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline ::int32_t TestAllTypesLite::optional_sint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_sint32)
+  return _internal_optional_sint32();
+}
+inline void TestAllTypesLite::set_optional_sint32(::int32_t value) {
+  _internal_set_optional_sint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_sint32)
+}
+inline ::int32_t TestAllTypesLite::_internal_optional_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sint32_;
+}
+inline void TestAllTypesLite::_internal_set_optional_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.optional_sint32_ = value;
+}
+
+// optional sint64 optional_sint64 = 6;
+inline bool TestAllTypesLite::has_optional_sint64() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sint64_ = ::int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline ::int64_t TestAllTypesLite::optional_sint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_sint64)
+  return _internal_optional_sint64();
+}
+inline void TestAllTypesLite::set_optional_sint64(::int64_t value) {
+  _internal_set_optional_sint64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_sint64)
+}
+inline ::int64_t TestAllTypesLite::_internal_optional_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sint64_;
+}
+inline void TestAllTypesLite::_internal_set_optional_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.optional_sint64_ = value;
+}
+
+// optional fixed32 optional_fixed32 = 7;
+inline bool TestAllTypesLite::has_optional_fixed32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_fixed32_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline ::uint32_t TestAllTypesLite::optional_fixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_fixed32)
+  return _internal_optional_fixed32();
+}
+inline void TestAllTypesLite::set_optional_fixed32(::uint32_t value) {
+  _internal_set_optional_fixed32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_fixed32)
+}
+inline ::uint32_t TestAllTypesLite::_internal_optional_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_fixed32_;
+}
+inline void TestAllTypesLite::_internal_set_optional_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.optional_fixed32_ = value;
+}
+
+// optional fixed64 optional_fixed64 = 8;
+inline bool TestAllTypesLite::has_optional_fixed64() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_fixed64_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline ::uint64_t TestAllTypesLite::optional_fixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_fixed64)
+  return _internal_optional_fixed64();
+}
+inline void TestAllTypesLite::set_optional_fixed64(::uint64_t value) {
+  _internal_set_optional_fixed64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_fixed64)
+}
+inline ::uint64_t TestAllTypesLite::_internal_optional_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_fixed64_;
+}
+inline void TestAllTypesLite::_internal_set_optional_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.optional_fixed64_ = value;
+}
+
+// optional sfixed32 optional_sfixed32 = 9;
+inline bool TestAllTypesLite::has_optional_sfixed32() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sfixed32_ = 0;
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline ::int32_t TestAllTypesLite::optional_sfixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_sfixed32)
+  return _internal_optional_sfixed32();
+}
+inline void TestAllTypesLite::set_optional_sfixed32(::int32_t value) {
+  _internal_set_optional_sfixed32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_sfixed32)
+}
+inline ::int32_t TestAllTypesLite::_internal_optional_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sfixed32_;
+}
+inline void TestAllTypesLite::_internal_set_optional_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.optional_sfixed32_ = value;
+}
+
+// optional sfixed64 optional_sfixed64 = 10;
+inline bool TestAllTypesLite::has_optional_sfixed64() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sfixed64_ = ::int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline ::int64_t TestAllTypesLite::optional_sfixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_sfixed64)
+  return _internal_optional_sfixed64();
+}
+inline void TestAllTypesLite::set_optional_sfixed64(::int64_t value) {
+  _internal_set_optional_sfixed64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_sfixed64)
+}
+inline ::int64_t TestAllTypesLite::_internal_optional_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sfixed64_;
+}
+inline void TestAllTypesLite::_internal_set_optional_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.optional_sfixed64_ = value;
+}
+
+// optional float optional_float = 11;
+inline bool TestAllTypesLite::has_optional_float() const {
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_float_ = 0;
+  _impl_._has_bits_[0] &= ~0x02000000u;
+}
+inline float TestAllTypesLite::optional_float() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_float)
+  return _internal_optional_float();
+}
+inline void TestAllTypesLite::set_optional_float(float value) {
+  _internal_set_optional_float(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_float)
+}
+inline float TestAllTypesLite::_internal_optional_float() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_float_;
+}
+inline void TestAllTypesLite::_internal_set_optional_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.optional_float_ = value;
+}
+
+// optional double optional_double = 12;
+inline bool TestAllTypesLite::has_optional_double() const {
+  bool value = (_impl_._has_bits_[0] & 0x04000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_double_ = 0;
+  _impl_._has_bits_[0] &= ~0x04000000u;
+}
+inline double TestAllTypesLite::optional_double() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_double)
+  return _internal_optional_double();
+}
+inline void TestAllTypesLite::set_optional_double(double value) {
+  _internal_set_optional_double(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_double)
+}
+inline double TestAllTypesLite::_internal_optional_double() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_double_;
+}
+inline void TestAllTypesLite::_internal_set_optional_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x04000000u;
+  _impl_.optional_double_ = value;
+}
+
+// optional bool optional_bool = 13;
+inline bool TestAllTypesLite::has_optional_bool() const {
+  bool value = (_impl_._has_bits_[0] & 0x08000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bool_ = false;
+  _impl_._has_bits_[0] &= ~0x08000000u;
+}
+inline bool TestAllTypesLite::optional_bool() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_bool)
+  return _internal_optional_bool();
+}
+inline void TestAllTypesLite::set_optional_bool(bool value) {
+  _internal_set_optional_bool(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_bool)
+}
+inline bool TestAllTypesLite::_internal_optional_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bool_;
+}
+inline void TestAllTypesLite::_internal_set_optional_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x08000000u;
+  _impl_.optional_bool_ = value;
+}
+
+// optional string optional_string = 14;
+inline bool TestAllTypesLite::has_optional_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestAllTypesLite::optional_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_string)
+  return _internal_optional_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_optional_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.optional_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_string)
+}
+inline std::string* TestAllTypesLite::mutable_optional_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_string)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_optional_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_.Get();
+}
+inline void TestAllTypesLite::_internal_set_optional_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.optional_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.optional_string_.Mutable( GetArena());
+}
+inline std::string* TestAllTypesLite::release_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_string)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.optional_string_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.optional_string_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestAllTypesLite::set_allocated_optional_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.optional_string_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_.IsDefault()) {
+          _impl_.optional_string_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_string)
+}
+
+// optional bytes optional_bytes = 15;
+inline bool TestAllTypesLite::has_optional_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bytes_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TestAllTypesLite::optional_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_bytes)
+  return _internal_optional_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_optional_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.optional_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_bytes)
+}
+inline std::string* TestAllTypesLite::mutable_optional_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_optional_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bytes_.Get();
+}
+inline void TestAllTypesLite::_internal_set_optional_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.optional_bytes_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.optional_bytes_.Mutable( GetArena());
+}
+inline std::string* TestAllTypesLite::release_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_bytes)
+  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* released = _impl_.optional_bytes_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.optional_bytes_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestAllTypesLite::set_allocated_optional_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.optional_bytes_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_bytes_.IsDefault()) {
+          _impl_.optional_bytes_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_bytes)
+}
+
+// optional group OptionalGroup = 16 { ... };
+inline bool TestAllTypesLite::has_optionalgroup() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optionalgroup_ != nullptr);
+  return value;
+}
+inline void TestAllTypesLite::clear_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optionalgroup_ != nullptr) _impl_.optionalgroup_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite_OptionalGroup& TestAllTypesLite::_internal_optionalgroup() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite_OptionalGroup* p = _impl_.optionalgroup_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite_OptionalGroup&>(::protobuf_unittest::_TestAllTypesLite_OptionalGroup_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_OptionalGroup& TestAllTypesLite::optionalgroup() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optionalgroup)
+  return _internal_optionalgroup();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optionalgroup(::protobuf_unittest::TestAllTypesLite_OptionalGroup* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optionalgroup_);
+  }
+  _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optionalgroup)
+}
+inline ::protobuf_unittest::TestAllTypesLite_OptionalGroup* TestAllTypesLite::release_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup* released = _impl_.optionalgroup_;
+  _impl_.optionalgroup_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite_OptionalGroup* TestAllTypesLite::unsafe_arena_release_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optionalgroup)
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup* temp = _impl_.optionalgroup_;
+  _impl_.optionalgroup_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite_OptionalGroup* TestAllTypesLite::_internal_mutable_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.optionalgroup_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_OptionalGroup>(GetArena());
+    _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(p);
+  }
+  return _impl_.optionalgroup_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_OptionalGroup* TestAllTypesLite::mutable_optionalgroup() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup* _msg = _internal_mutable_optionalgroup();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optionalgroup)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optionalgroup(::protobuf_unittest::TestAllTypesLite_OptionalGroup* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(_impl_.optionalgroup_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+
+  _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optionalgroup)
+}
+
+// optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_nested_message = 18;
+inline bool TestAllTypesLite::has_optional_nested_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_nested_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_nested_message_ != nullptr) _impl_.optional_nested_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::_internal_optional_nested_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage* p = _impl_.optional_nested_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite_NestedMessage&>(::protobuf_unittest::_TestAllTypesLite_NestedMessage_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::optional_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_nested_message)
+  return _internal_optional_nested_message();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optional_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_nested_message_);
+  }
+  _impl_.optional_nested_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optional_nested_message)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::release_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* released = _impl_.optional_nested_message_;
+  _impl_.optional_nested_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::unsafe_arena_release_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_nested_message)
+
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* temp = _impl_.optional_nested_message_;
+  _impl_.optional_nested_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::_internal_mutable_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.optional_nested_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_NestedMessage>(GetArena());
+    _impl_.optional_nested_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(p);
+  }
+  return _impl_.optional_nested_message_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_optional_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _msg = _internal_mutable_optional_nested_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_nested_message)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optional_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(_impl_.optional_nested_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+
+  _impl_.optional_nested_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_nested_message)
+}
+
+// optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+inline bool TestAllTypesLite::has_optional_foreign_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_foreign_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_foreign_message_ != nullptr) _impl_.optional_foreign_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestAllTypesLite::_internal_optional_foreign_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::ForeignMessageLite* p = _impl_.optional_foreign_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::ForeignMessageLite&>(::protobuf_unittest::_ForeignMessageLite_default_instance_);
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestAllTypesLite::optional_foreign_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_foreign_message)
+  return _internal_optional_foreign_message();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_foreign_message_);
+  }
+  _impl_.optional_foreign_message_ = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optional_foreign_message)
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::release_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::protobuf_unittest::ForeignMessageLite* released = _impl_.optional_foreign_message_;
+  _impl_.optional_foreign_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::unsafe_arena_release_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_foreign_message)
+
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::protobuf_unittest::ForeignMessageLite* temp = _impl_.optional_foreign_message_;
+  _impl_.optional_foreign_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::_internal_mutable_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.optional_foreign_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::ForeignMessageLite>(GetArena());
+    _impl_.optional_foreign_message_ = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(p);
+  }
+  return _impl_.optional_foreign_message_;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::mutable_optional_foreign_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::ForeignMessageLite* _msg = _internal_mutable_optional_foreign_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_foreign_message)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(_impl_.optional_foreign_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+
+  _impl_.optional_foreign_message_ = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_foreign_message)
+}
+
+// optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+inline bool TestAllTypesLite::has_optional_import_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_import_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest_import::ImportMessageLite& TestAllTypesLite::_internal_optional_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest_import::ImportMessageLite* p = _impl_.optional_import_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest_import::ImportMessageLite&>(::protobuf_unittest_import::_ImportMessageLite_default_instance_);
+}
+inline const ::protobuf_unittest_import::ImportMessageLite& TestAllTypesLite::optional_import_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_import_message)
+  return _internal_optional_import_message();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessageLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_import_message_);
+  }
+  _impl_.optional_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessageLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optional_import_message)
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::release_optional_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::protobuf_unittest_import::ImportMessageLite* released = _impl_.optional_import_message_;
+  _impl_.optional_import_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::unsafe_arena_release_optional_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_import_message)
+
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::protobuf_unittest_import::ImportMessageLite* temp = _impl_.optional_import_message_;
+  _impl_.optional_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::_internal_mutable_optional_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.optional_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::ImportMessageLite>(GetArena());
+    _impl_.optional_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessageLite*>(p);
+  }
+  return _impl_.optional_import_message_;
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::mutable_optional_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest_import::ImportMessageLite* _msg = _internal_mutable_optional_import_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_import_message)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessageLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_import_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+
+  _impl_.optional_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessageLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_import_message)
+}
+
+// optional .protobuf_unittest.TestAllTypesLite.NestedEnum optional_nested_enum = 21;
+inline bool TestAllTypesLite::has_optional_nested_enum() const {
+  bool value = (_impl_._has_bits_[0] & 0x40000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_nested_enum_ = 1;
+  _impl_._has_bits_[0] &= ~0x40000000u;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedEnum TestAllTypesLite::optional_nested_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_nested_enum)
+  return _internal_optional_nested_enum();
+}
+inline void TestAllTypesLite::set_optional_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value) {
+  _internal_set_optional_nested_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_nested_enum)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedEnum TestAllTypesLite::_internal_optional_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::TestAllTypesLite_NestedEnum>(_impl_.optional_nested_enum_);
+}
+inline void TestAllTypesLite::_internal_set_optional_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(value));
+  _impl_._has_bits_[0] |= 0x40000000u;
+  _impl_.optional_nested_enum_ = value;
+}
+
+// optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+inline bool TestAllTypesLite::has_optional_foreign_enum() const {
+  bool value = (_impl_._has_bits_[0] & 0x80000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_foreign_enum_ = 4;
+  _impl_._has_bits_[0] &= ~0x80000000u;
+}
+inline ::protobuf_unittest::ForeignEnumLite TestAllTypesLite::optional_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_foreign_enum)
+  return _internal_optional_foreign_enum();
+}
+inline void TestAllTypesLite::set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  _internal_set_optional_foreign_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_foreign_enum)
+}
+inline ::protobuf_unittest::ForeignEnumLite TestAllTypesLite::_internal_optional_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::ForeignEnumLite>(_impl_.optional_foreign_enum_);
+}
+inline void TestAllTypesLite::_internal_set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _impl_._has_bits_[0] |= 0x80000000u;
+  _impl_.optional_foreign_enum_ = value;
+}
+
+// optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+inline bool TestAllTypesLite::has_optional_import_enum() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_import_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_import_enum_ = 7;
+  _impl_._has_bits_[1] &= ~0x00000001u;
+}
+inline ::protobuf_unittest_import::ImportEnumLite TestAllTypesLite::optional_import_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_import_enum)
+  return _internal_optional_import_enum();
+}
+inline void TestAllTypesLite::set_optional_import_enum(::protobuf_unittest_import::ImportEnumLite value) {
+  _internal_set_optional_import_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_import_enum)
+}
+inline ::protobuf_unittest_import::ImportEnumLite TestAllTypesLite::_internal_optional_import_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest_import::ImportEnumLite>(_impl_.optional_import_enum_);
+}
+inline void TestAllTypesLite::_internal_set_optional_import_enum(::protobuf_unittest_import::ImportEnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  _impl_._has_bits_[1] |= 0x00000001u;
+  _impl_.optional_import_enum_ = value;
+}
+
+// optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+inline bool TestAllTypesLite::has_optional_string_piece() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_piece_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& TestAllTypesLite::optional_string_piece() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_string_piece)
+  return _internal_optional_string_piece();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_optional_string_piece(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.optional_string_piece_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_string_piece)
+}
+inline std::string* TestAllTypesLite::mutable_optional_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string_piece();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_optional_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_piece_.Get();
+}
+inline void TestAllTypesLite::_internal_set_optional_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.optional_string_piece_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.optional_string_piece_.Mutable( GetArena());
+}
+inline std::string* TestAllTypesLite::release_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_string_piece)
+  if ((_impl_._has_bits_[0] & 0x00000004u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* released = _impl_.optional_string_piece_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.optional_string_piece_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestAllTypesLite::set_allocated_optional_string_piece(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.optional_string_piece_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_piece_.IsDefault()) {
+          _impl_.optional_string_piece_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_string_piece)
+}
+
+// optional string optional_cord = 25 [ctype = CORD];
+inline bool TestAllTypesLite::has_optional_cord() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_cord_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& TestAllTypesLite::optional_cord() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_cord)
+  return _internal_optional_cord();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_optional_cord(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.optional_cord_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.optional_cord)
+}
+inline std::string* TestAllTypesLite::mutable_optional_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_cord();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_cord)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_optional_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_cord_.Get();
+}
+inline void TestAllTypesLite::_internal_set_optional_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.optional_cord_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.optional_cord_.Mutable( GetArena());
+}
+inline std::string* TestAllTypesLite::release_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_cord)
+  if ((_impl_._has_bits_[0] & 0x00000008u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* released = _impl_.optional_cord_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.optional_cord_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestAllTypesLite::set_allocated_optional_cord(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.optional_cord_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_cord_.IsDefault()) {
+          _impl_.optional_cord_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_cord)
+}
+
+// optional .protobuf_unittest_import.PublicImportMessageLite optional_public_import_message = 26;
+inline bool TestAllTypesLite::has_optional_public_import_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_public_import_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest_import::PublicImportMessageLite& TestAllTypesLite::_internal_optional_public_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest_import::PublicImportMessageLite* p = _impl_.optional_public_import_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest_import::PublicImportMessageLite&>(::protobuf_unittest_import::_PublicImportMessageLite_default_instance_);
+}
+inline const ::protobuf_unittest_import::PublicImportMessageLite& TestAllTypesLite::optional_public_import_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_public_import_message)
+  return _internal_optional_public_import_message();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessageLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_public_import_message_);
+  }
+  _impl_.optional_public_import_message_ = reinterpret_cast<::protobuf_unittest_import::PublicImportMessageLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optional_public_import_message)
+}
+inline ::protobuf_unittest_import::PublicImportMessageLite* TestAllTypesLite::release_optional_public_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::protobuf_unittest_import::PublicImportMessageLite* released = _impl_.optional_public_import_message_;
+  _impl_.optional_public_import_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest_import::PublicImportMessageLite* TestAllTypesLite::unsafe_arena_release_optional_public_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_public_import_message)
+
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::protobuf_unittest_import::PublicImportMessageLite* temp = _impl_.optional_public_import_message_;
+  _impl_.optional_public_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::PublicImportMessageLite* TestAllTypesLite::_internal_mutable_optional_public_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00001000u;
+  if (_impl_.optional_public_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::PublicImportMessageLite>(GetArena());
+    _impl_.optional_public_import_message_ = reinterpret_cast<::protobuf_unittest_import::PublicImportMessageLite*>(p);
+  }
+  return _impl_.optional_public_import_message_;
+}
+inline ::protobuf_unittest_import::PublicImportMessageLite* TestAllTypesLite::mutable_optional_public_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest_import::PublicImportMessageLite* _msg = _internal_mutable_optional_public_import_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_public_import_message)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessageLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_public_import_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+
+  _impl_.optional_public_import_message_ = reinterpret_cast<::protobuf_unittest_import::PublicImportMessageLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_public_import_message)
+}
+
+// optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_lazy_message = 27 [lazy = true];
+inline bool TestAllTypesLite::has_optional_lazy_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_lazy_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_lazy_message_ != nullptr) _impl_.optional_lazy_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::_internal_optional_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage* p = _impl_.optional_lazy_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite_NestedMessage&>(::protobuf_unittest::_TestAllTypesLite_NestedMessage_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::optional_lazy_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_lazy_message)
+  return _internal_optional_lazy_message();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optional_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_lazy_message_);
+  }
+  _impl_.optional_lazy_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optional_lazy_message)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::release_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* released = _impl_.optional_lazy_message_;
+  _impl_.optional_lazy_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::unsafe_arena_release_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_lazy_message)
+
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* temp = _impl_.optional_lazy_message_;
+  _impl_.optional_lazy_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::_internal_mutable_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00002000u;
+  if (_impl_.optional_lazy_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_NestedMessage>(GetArena());
+    _impl_.optional_lazy_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(p);
+  }
+  return _impl_.optional_lazy_message_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_optional_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _msg = _internal_mutable_optional_lazy_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_lazy_message)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optional_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(_impl_.optional_lazy_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+
+  _impl_.optional_lazy_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_lazy_message)
+}
+
+// optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_unverified_lazy_message = 28 [unverified_lazy = true];
+inline bool TestAllTypesLite::has_optional_unverified_lazy_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_unverified_lazy_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypesLite::clear_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_unverified_lazy_message_ != nullptr) _impl_.optional_unverified_lazy_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::_internal_optional_unverified_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage* p = _impl_.optional_unverified_lazy_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite_NestedMessage&>(::protobuf_unittest::_TestAllTypesLite_NestedMessage_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::optional_unverified_lazy_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.optional_unverified_lazy_message)
+  return _internal_optional_unverified_lazy_message();
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_optional_unverified_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_unverified_lazy_message_);
+  }
+  _impl_.optional_unverified_lazy_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00004000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00004000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.optional_unverified_lazy_message)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::release_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00004000u;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* released = _impl_.optional_unverified_lazy_message_;
+  _impl_.optional_unverified_lazy_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::unsafe_arena_release_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.optional_unverified_lazy_message)
+
+  _impl_._has_bits_[0] &= ~0x00004000u;
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* temp = _impl_.optional_unverified_lazy_message_;
+  _impl_.optional_unverified_lazy_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::_internal_mutable_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00004000u;
+  if (_impl_.optional_unverified_lazy_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_NestedMessage>(GetArena());
+    _impl_.optional_unverified_lazy_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(p);
+  }
+  return _impl_.optional_unverified_lazy_message_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_optional_unverified_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _msg = _internal_mutable_optional_unverified_lazy_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.optional_unverified_lazy_message)
+  return _msg;
+}
+inline void TestAllTypesLite::set_allocated_optional_unverified_lazy_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(_impl_.optional_unverified_lazy_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00004000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00004000u;
+  }
+
+  _impl_.optional_unverified_lazy_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.optional_unverified_lazy_message)
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestAllTypesLite::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int TestAllTypesLite::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestAllTypesLite::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t TestAllTypesLite::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_int32)
+}
+inline void TestAllTypesLite::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestAllTypesLite::_internal_repeated_int64_size() const {
+  return _internal_repeated_int64().size();
+}
+inline int TestAllTypesLite::repeated_int64_size() const {
+  return _internal_repeated_int64_size();
+}
+inline void TestAllTypesLite::clear_repeated_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int64_.Clear();
+}
+inline ::int64_t TestAllTypesLite::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_int64)
+  return _internal_repeated_int64().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_int64(int index, ::int64_t value) {
+  _internal_mutable_repeated_int64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_int64)
+}
+inline void TestAllTypesLite::add_repeated_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_int64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypesLite::repeated_int64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_int64)
+  return _internal_repeated_int64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypesLite::mutable_repeated_int64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_int64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypesLite::_internal_repeated_int64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypesLite::_internal_mutable_repeated_int64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestAllTypesLite::_internal_repeated_uint32_size() const {
+  return _internal_repeated_uint32().size();
+}
+inline int TestAllTypesLite::repeated_uint32_size() const {
+  return _internal_repeated_uint32_size();
+}
+inline void TestAllTypesLite::clear_repeated_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint32_.Clear();
+}
+inline ::uint32_t TestAllTypesLite::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_uint32)
+  return _internal_repeated_uint32().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_uint32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_uint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_uint32)
+}
+inline void TestAllTypesLite::add_repeated_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_uint32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypesLite::repeated_uint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_uint32)
+  return _internal_repeated_uint32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypesLite::mutable_repeated_uint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_uint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypesLite::_internal_repeated_uint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypesLite::_internal_mutable_repeated_uint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestAllTypesLite::_internal_repeated_uint64_size() const {
+  return _internal_repeated_uint64().size();
+}
+inline int TestAllTypesLite::repeated_uint64_size() const {
+  return _internal_repeated_uint64_size();
+}
+inline void TestAllTypesLite::clear_repeated_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint64_.Clear();
+}
+inline ::uint64_t TestAllTypesLite::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_uint64)
+  return _internal_repeated_uint64().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_uint64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_uint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_uint64)
+}
+inline void TestAllTypesLite::add_repeated_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_uint64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypesLite::repeated_uint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_uint64)
+  return _internal_repeated_uint64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypesLite::mutable_repeated_uint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_uint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypesLite::_internal_repeated_uint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypesLite::_internal_mutable_repeated_uint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestAllTypesLite::_internal_repeated_sint32_size() const {
+  return _internal_repeated_sint32().size();
+}
+inline int TestAllTypesLite::repeated_sint32_size() const {
+  return _internal_repeated_sint32_size();
+}
+inline void TestAllTypesLite::clear_repeated_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint32_.Clear();
+}
+inline ::int32_t TestAllTypesLite::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_sint32)
+  return _internal_repeated_sint32().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_sint32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_sint32)
+}
+inline void TestAllTypesLite::add_repeated_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_sint32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite::repeated_sint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_sint32)
+  return _internal_repeated_sint32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite::mutable_repeated_sint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_sint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite::_internal_repeated_sint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite::_internal_mutable_repeated_sint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestAllTypesLite::_internal_repeated_sint64_size() const {
+  return _internal_repeated_sint64().size();
+}
+inline int TestAllTypesLite::repeated_sint64_size() const {
+  return _internal_repeated_sint64_size();
+}
+inline void TestAllTypesLite::clear_repeated_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint64_.Clear();
+}
+inline ::int64_t TestAllTypesLite::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_sint64)
+  return _internal_repeated_sint64().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_sint64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_sint64)
+}
+inline void TestAllTypesLite::add_repeated_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_sint64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypesLite::repeated_sint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_sint64)
+  return _internal_repeated_sint64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypesLite::mutable_repeated_sint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_sint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypesLite::_internal_repeated_sint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypesLite::_internal_mutable_repeated_sint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestAllTypesLite::_internal_repeated_fixed32_size() const {
+  return _internal_repeated_fixed32().size();
+}
+inline int TestAllTypesLite::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void TestAllTypesLite::clear_repeated_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed32_.Clear();
+}
+inline ::uint32_t TestAllTypesLite::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_fixed32)
+  return _internal_repeated_fixed32().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_fixed32)
+}
+inline void TestAllTypesLite::add_repeated_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypesLite::repeated_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypesLite::mutable_repeated_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypesLite::_internal_repeated_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypesLite::_internal_mutable_repeated_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestAllTypesLite::_internal_repeated_fixed64_size() const {
+  return _internal_repeated_fixed64().size();
+}
+inline int TestAllTypesLite::repeated_fixed64_size() const {
+  return _internal_repeated_fixed64_size();
+}
+inline void TestAllTypesLite::clear_repeated_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed64_.Clear();
+}
+inline ::uint64_t TestAllTypesLite::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_fixed64)
+  return _internal_repeated_fixed64().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_fixed64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_fixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_fixed64)
+}
+inline void TestAllTypesLite::add_repeated_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_fixed64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypesLite::repeated_fixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_fixed64)
+  return _internal_repeated_fixed64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypesLite::mutable_repeated_fixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_fixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypesLite::_internal_repeated_fixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypesLite::_internal_mutable_repeated_fixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestAllTypesLite::_internal_repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32().size();
+}
+inline int TestAllTypesLite::repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32_size();
+}
+inline void TestAllTypesLite::clear_repeated_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed32_.Clear();
+}
+inline ::int32_t TestAllTypesLite::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_sfixed32)
+  return _internal_repeated_sfixed32().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_sfixed32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sfixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_sfixed32)
+}
+inline void TestAllTypesLite::add_repeated_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite::repeated_sfixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_sfixed32)
+  return _internal_repeated_sfixed32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite::mutable_repeated_sfixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_sfixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypesLite::_internal_repeated_sfixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypesLite::_internal_mutable_repeated_sfixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestAllTypesLite::_internal_repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64().size();
+}
+inline int TestAllTypesLite::repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64_size();
+}
+inline void TestAllTypesLite::clear_repeated_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed64_.Clear();
+}
+inline ::int64_t TestAllTypesLite::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_sfixed64)
+  return _internal_repeated_sfixed64().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_sfixed64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sfixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_sfixed64)
+}
+inline void TestAllTypesLite::add_repeated_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypesLite::repeated_sfixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_sfixed64)
+  return _internal_repeated_sfixed64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypesLite::mutable_repeated_sfixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_sfixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypesLite::_internal_repeated_sfixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypesLite::_internal_mutable_repeated_sfixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+inline int TestAllTypesLite::_internal_repeated_float_size() const {
+  return _internal_repeated_float().size();
+}
+inline int TestAllTypesLite::repeated_float_size() const {
+  return _internal_repeated_float_size();
+}
+inline void TestAllTypesLite::clear_repeated_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_float_.Clear();
+}
+inline float TestAllTypesLite::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_float)
+  return _internal_repeated_float().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_float(int index, float value) {
+  _internal_mutable_repeated_float()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_float)
+}
+inline void TestAllTypesLite::add_repeated_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_float()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_float)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestAllTypesLite::repeated_float() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_float)
+  return _internal_repeated_float();
+}
+inline ::google::protobuf::RepeatedField<float>* TestAllTypesLite::mutable_repeated_float()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_float)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_float();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestAllTypesLite::_internal_repeated_float()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_float_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestAllTypesLite::_internal_mutable_repeated_float() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+inline int TestAllTypesLite::_internal_repeated_double_size() const {
+  return _internal_repeated_double().size();
+}
+inline int TestAllTypesLite::repeated_double_size() const {
+  return _internal_repeated_double_size();
+}
+inline void TestAllTypesLite::clear_repeated_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_double_.Clear();
+}
+inline double TestAllTypesLite::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_double)
+  return _internal_repeated_double().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_double(int index, double value) {
+  _internal_mutable_repeated_double()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_double)
+}
+inline void TestAllTypesLite::add_repeated_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_double()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_double)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestAllTypesLite::repeated_double() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_double)
+  return _internal_repeated_double();
+}
+inline ::google::protobuf::RepeatedField<double>* TestAllTypesLite::mutable_repeated_double()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_double)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_double();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestAllTypesLite::_internal_repeated_double()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_double_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestAllTypesLite::_internal_mutable_repeated_double() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestAllTypesLite::_internal_repeated_bool_size() const {
+  return _internal_repeated_bool().size();
+}
+inline int TestAllTypesLite::repeated_bool_size() const {
+  return _internal_repeated_bool_size();
+}
+inline void TestAllTypesLite::clear_repeated_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bool_.Clear();
+}
+inline bool TestAllTypesLite::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_bool)
+  return _internal_repeated_bool().Get(index);
+}
+inline void TestAllTypesLite::set_repeated_bool(int index, bool value) {
+  _internal_mutable_repeated_bool()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_bool)
+}
+inline void TestAllTypesLite::add_repeated_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bool()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_bool)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestAllTypesLite::repeated_bool() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_bool)
+  return _internal_repeated_bool();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestAllTypesLite::mutable_repeated_bool()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_bool)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bool();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestAllTypesLite::_internal_repeated_bool()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestAllTypesLite::_internal_mutable_repeated_bool() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+inline int TestAllTypesLite::_internal_repeated_string_size() const {
+  return _internal_repeated_string().size();
+}
+inline int TestAllTypesLite::repeated_string_size() const {
+  return _internal_repeated_string_size();
+}
+inline void TestAllTypesLite::clear_repeated_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_.Clear();
+}
+inline std::string* TestAllTypesLite::add_repeated_string()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string()->Add();
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestAllTypesLite.repeated_string)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::repeated_string(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_string)
+  return _internal_repeated_string().Get(index);
+}
+inline std::string* TestAllTypesLite::mutable_repeated_string(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_string)
+  return _internal_mutable_repeated_string()->Mutable(index);
+}
+inline void TestAllTypesLite::set_repeated_string(int index, const std::string& value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::set_repeated_string(int index, std::string&& value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::set_repeated_string(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::set_repeated_string(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::set_repeated_string(int index, absl::string_view value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::add_repeated_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::add_repeated_string(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::add_repeated_string(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::add_repeated_string(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline void TestAllTypesLite::add_repeated_string(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:protobuf_unittest.TestAllTypesLite.repeated_string)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::repeated_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_string)
+  return _internal_repeated_string();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::mutable_repeated_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_string)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::_internal_repeated_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::_internal_mutable_repeated_string() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestAllTypesLite::_internal_repeated_bytes_size() const {
+  return _internal_repeated_bytes().size();
+}
+inline int TestAllTypesLite::repeated_bytes_size() const {
+  return _internal_repeated_bytes_size();
+}
+inline void TestAllTypesLite::clear_repeated_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bytes_.Clear();
+}
+inline std::string* TestAllTypesLite::add_repeated_bytes()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_bytes()->Add();
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::repeated_bytes(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+  return _internal_repeated_bytes().Get(index);
+}
+inline std::string* TestAllTypesLite::mutable_repeated_bytes(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+  return _internal_mutable_repeated_bytes()->Mutable(index);
+}
+inline void TestAllTypesLite::set_repeated_bytes(int index, const std::string& value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::set_repeated_bytes(int index, std::string&& value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::set_repeated_bytes(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::set_repeated_bytes(int index, const void* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::set_repeated_bytes(int index, absl::string_view value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::add_repeated_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::add_repeated_bytes(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::add_repeated_bytes(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::add_repeated_bytes(const void* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline void TestAllTypesLite::add_repeated_bytes(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::repeated_bytes() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+  return _internal_repeated_bytes();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::mutable_repeated_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_bytes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bytes();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::_internal_repeated_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bytes_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::_internal_mutable_repeated_bytes() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bytes_;
+}
+
+// repeated group RepeatedGroup = 46 { ... };
+inline int TestAllTypesLite::_internal_repeatedgroup_size() const {
+  return _internal_repeatedgroup().size();
+}
+inline int TestAllTypesLite::repeatedgroup_size() const {
+  return _internal_repeatedgroup_size();
+}
+inline void TestAllTypesLite::clear_repeatedgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeatedgroup_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite_RepeatedGroup* TestAllTypesLite::mutable_repeatedgroup(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeatedgroup)
+  return _internal_mutable_repeatedgroup()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_RepeatedGroup>* TestAllTypesLite::mutable_repeatedgroup()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeatedgroup)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeatedgroup();
+}
+inline const ::protobuf_unittest::TestAllTypesLite_RepeatedGroup& TestAllTypesLite::repeatedgroup(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeatedgroup)
+  return _internal_repeatedgroup().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite_RepeatedGroup* TestAllTypesLite::add_repeatedgroup() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite_RepeatedGroup* _add = _internal_mutable_repeatedgroup()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeatedgroup)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_RepeatedGroup>& TestAllTypesLite::repeatedgroup() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeatedgroup)
+  return _internal_repeatedgroup();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_RepeatedGroup>&
+TestAllTypesLite::_internal_repeatedgroup() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeatedgroup_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_RepeatedGroup>*
+TestAllTypesLite::_internal_mutable_repeatedgroup() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeatedgroup_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_nested_message = 48;
+inline int TestAllTypesLite::_internal_repeated_nested_message_size() const {
+  return _internal_repeated_nested_message().size();
+}
+inline int TestAllTypesLite::repeated_nested_message_size() const {
+  return _internal_repeated_nested_message_size();
+}
+inline void TestAllTypesLite::clear_repeated_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_message_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_repeated_nested_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_nested_message)
+  return _internal_mutable_repeated_nested_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>* TestAllTypesLite::mutable_repeated_nested_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_nested_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_message();
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::repeated_nested_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_nested_message)
+  return _internal_repeated_nested_message().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::add_repeated_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _add = _internal_mutable_repeated_nested_message()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_nested_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>& TestAllTypesLite::repeated_nested_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_nested_message)
+  return _internal_repeated_nested_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>&
+TestAllTypesLite::_internal_repeated_nested_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>*
+TestAllTypesLite::_internal_mutable_repeated_nested_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_message_;
+}
+
+// repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+inline int TestAllTypesLite::_internal_repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message().size();
+}
+inline int TestAllTypesLite::repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message_size();
+}
+inline void TestAllTypesLite::clear_repeated_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_foreign_message_.Clear();
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::mutable_repeated_foreign_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_foreign_message)
+  return _internal_mutable_repeated_foreign_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ForeignMessageLite>* TestAllTypesLite::mutable_repeated_foreign_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_foreign_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_foreign_message();
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestAllTypesLite::repeated_foreign_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_foreign_message)
+  return _internal_repeated_foreign_message().Get(index);
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::add_repeated_foreign_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::ForeignMessageLite* _add = _internal_mutable_repeated_foreign_message()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_foreign_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ForeignMessageLite>& TestAllTypesLite::repeated_foreign_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_foreign_message)
+  return _internal_repeated_foreign_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ForeignMessageLite>&
+TestAllTypesLite::_internal_repeated_foreign_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_foreign_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::ForeignMessageLite>*
+TestAllTypesLite::_internal_mutable_repeated_foreign_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+inline int TestAllTypesLite::_internal_repeated_import_message_size() const {
+  return _internal_repeated_import_message().size();
+}
+inline int TestAllTypesLite::repeated_import_message_size() const {
+  return _internal_repeated_import_message_size();
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::mutable_repeated_import_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_import_message)
+  return _internal_mutable_repeated_import_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessageLite>* TestAllTypesLite::mutable_repeated_import_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_import_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_import_message();
+}
+inline const ::protobuf_unittest_import::ImportMessageLite& TestAllTypesLite::repeated_import_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_import_message)
+  return _internal_repeated_import_message().Get(index);
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::add_repeated_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest_import::ImportMessageLite* _add = _internal_mutable_repeated_import_message()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_import_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessageLite>& TestAllTypesLite::repeated_import_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_import_message)
+  return _internal_repeated_import_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessageLite>&
+TestAllTypesLite::_internal_repeated_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_import_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessageLite>*
+TestAllTypesLite::_internal_mutable_repeated_import_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_import_message_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite.NestedEnum repeated_nested_enum = 51;
+inline int TestAllTypesLite::_internal_repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum().size();
+}
+inline int TestAllTypesLite::repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum_size();
+}
+inline void TestAllTypesLite::clear_repeated_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_enum_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedEnum TestAllTypesLite::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_nested_enum)
+  return static_cast<::protobuf_unittest::TestAllTypesLite_NestedEnum>(_internal_repeated_nested_enum().Get(index));
+}
+inline void TestAllTypesLite::set_repeated_nested_enum(int index, ::protobuf_unittest::TestAllTypesLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(value));
+  _internal_mutable_repeated_nested_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_nested_enum)
+}
+inline void TestAllTypesLite::add_repeated_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_nested_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_nested_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypesLite::repeated_nested_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_nested_enum)
+  return _internal_repeated_nested_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypesLite::mutable_repeated_nested_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_nested_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypesLite::_internal_repeated_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypesLite::_internal_mutable_repeated_nested_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_enum_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+inline int TestAllTypesLite::_internal_repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum().size();
+}
+inline int TestAllTypesLite::repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum_size();
+}
+inline void TestAllTypesLite::clear_repeated_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_foreign_enum_.Clear();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestAllTypesLite::repeated_foreign_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_foreign_enum)
+  return static_cast<::protobuf_unittest::ForeignEnumLite>(_internal_repeated_foreign_enum().Get(index));
+}
+inline void TestAllTypesLite::set_repeated_foreign_enum(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _internal_mutable_repeated_foreign_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_foreign_enum)
+}
+inline void TestAllTypesLite::add_repeated_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_foreign_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_foreign_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypesLite::repeated_foreign_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_foreign_enum)
+  return _internal_repeated_foreign_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypesLite::mutable_repeated_foreign_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_foreign_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_foreign_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypesLite::_internal_repeated_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_foreign_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypesLite::_internal_mutable_repeated_foreign_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_foreign_enum_;
+}
+
+// repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+inline int TestAllTypesLite::_internal_repeated_import_enum_size() const {
+  return _internal_repeated_import_enum().size();
+}
+inline int TestAllTypesLite::repeated_import_enum_size() const {
+  return _internal_repeated_import_enum_size();
+}
+inline void TestAllTypesLite::clear_repeated_import_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_import_enum_.Clear();
+}
+inline ::protobuf_unittest_import::ImportEnumLite TestAllTypesLite::repeated_import_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_import_enum)
+  return static_cast<::protobuf_unittest_import::ImportEnumLite>(_internal_repeated_import_enum().Get(index));
+}
+inline void TestAllTypesLite::set_repeated_import_enum(int index, ::protobuf_unittest_import::ImportEnumLite value) {
+  assert(::protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  _internal_mutable_repeated_import_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_import_enum)
+}
+inline void TestAllTypesLite::add_repeated_import_enum(::protobuf_unittest_import::ImportEnumLite value) {
+  assert(::protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_import_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_import_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypesLite::repeated_import_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_import_enum)
+  return _internal_repeated_import_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypesLite::mutable_repeated_import_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_import_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_import_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypesLite::_internal_repeated_import_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_import_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypesLite::_internal_mutable_repeated_import_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_import_enum_;
+}
+
+// repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+inline int TestAllTypesLite::_internal_repeated_string_piece_size() const {
+  return _internal_repeated_string_piece().size();
+}
+inline int TestAllTypesLite::repeated_string_piece_size() const {
+  return _internal_repeated_string_piece_size();
+}
+inline void TestAllTypesLite::clear_repeated_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_piece_.Clear();
+}
+inline std::string* TestAllTypesLite::add_repeated_string_piece()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string_piece()->Add();
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::repeated_string_piece(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+  return _internal_repeated_string_piece().Get(index);
+}
+inline std::string* TestAllTypesLite::mutable_repeated_string_piece(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+  return _internal_mutable_repeated_string_piece()->Mutable(index);
+}
+inline void TestAllTypesLite::set_repeated_string_piece(int index, const std::string& value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::set_repeated_string_piece(int index, std::string&& value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::set_repeated_string_piece(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::set_repeated_string_piece(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::set_repeated_string_piece(int index, absl::string_view value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::add_repeated_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::add_repeated_string_piece(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::add_repeated_string_piece(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::add_repeated_string_piece(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline void TestAllTypesLite::add_repeated_string_piece(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::repeated_string_piece() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+  return _internal_repeated_string_piece();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::mutable_repeated_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_string_piece)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string_piece();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::_internal_repeated_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_piece_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::_internal_mutable_repeated_string_piece() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_piece_;
+}
+
+// repeated string repeated_cord = 55 [ctype = CORD];
+inline int TestAllTypesLite::_internal_repeated_cord_size() const {
+  return _internal_repeated_cord().size();
+}
+inline int TestAllTypesLite::repeated_cord_size() const {
+  return _internal_repeated_cord_size();
+}
+inline void TestAllTypesLite::clear_repeated_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_cord_.Clear();
+}
+inline std::string* TestAllTypesLite::add_repeated_cord()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_cord()->Add();
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestAllTypesLite.repeated_cord)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::repeated_cord(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_cord)
+  return _internal_repeated_cord().Get(index);
+}
+inline std::string* TestAllTypesLite::mutable_repeated_cord(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_cord)
+  return _internal_mutable_repeated_cord()->Mutable(index);
+}
+inline void TestAllTypesLite::set_repeated_cord(int index, const std::string& value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::set_repeated_cord(int index, std::string&& value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::set_repeated_cord(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::set_repeated_cord(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::set_repeated_cord(int index, absl::string_view value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::add_repeated_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::add_repeated_cord(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::add_repeated_cord(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::add_repeated_cord(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline void TestAllTypesLite::add_repeated_cord(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:protobuf_unittest.TestAllTypesLite.repeated_cord)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::repeated_cord() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_cord)
+  return _internal_repeated_cord();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::mutable_repeated_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_cord)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_cord();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypesLite::_internal_repeated_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_cord_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypesLite::_internal_mutable_repeated_cord() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_cord_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_lazy_message = 57 [lazy = true];
+inline int TestAllTypesLite::_internal_repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message().size();
+}
+inline int TestAllTypesLite::repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message_size();
+}
+inline void TestAllTypesLite::clear_repeated_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_lazy_message_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_repeated_lazy_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.repeated_lazy_message)
+  return _internal_mutable_repeated_lazy_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>* TestAllTypesLite::mutable_repeated_lazy_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestAllTypesLite.repeated_lazy_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_lazy_message();
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::repeated_lazy_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.repeated_lazy_message)
+  return _internal_repeated_lazy_message().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::add_repeated_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _add = _internal_mutable_repeated_lazy_message()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestAllTypesLite.repeated_lazy_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>& TestAllTypesLite::repeated_lazy_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestAllTypesLite.repeated_lazy_message)
+  return _internal_repeated_lazy_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>&
+TestAllTypesLite::_internal_repeated_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_lazy_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite_NestedMessage>*
+TestAllTypesLite::_internal_mutable_repeated_lazy_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_lazy_message_;
+}
+
+// optional int32 default_int32 = 61 [default = 41];
+inline bool TestAllTypesLite::has_default_int32() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000002u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_int32_ = 41;
+  _impl_._has_bits_[1] &= ~0x00000002u;
+}
+inline ::int32_t TestAllTypesLite::default_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_int32)
+  return _internal_default_int32();
+}
+inline void TestAllTypesLite::set_default_int32(::int32_t value) {
+  _internal_set_default_int32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_int32)
+}
+inline ::int32_t TestAllTypesLite::_internal_default_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_int32_;
+}
+inline void TestAllTypesLite::_internal_set_default_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000002u;
+  _impl_.default_int32_ = value;
+}
+
+// optional int64 default_int64 = 62 [default = 42];
+inline bool TestAllTypesLite::has_default_int64() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000004u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_int64_ = ::int64_t{42};
+  _impl_._has_bits_[1] &= ~0x00000004u;
+}
+inline ::int64_t TestAllTypesLite::default_int64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_int64)
+  return _internal_default_int64();
+}
+inline void TestAllTypesLite::set_default_int64(::int64_t value) {
+  _internal_set_default_int64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_int64)
+}
+inline ::int64_t TestAllTypesLite::_internal_default_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_int64_;
+}
+inline void TestAllTypesLite::_internal_set_default_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000004u;
+  _impl_.default_int64_ = value;
+}
+
+// optional uint32 default_uint32 = 63 [default = 43];
+inline bool TestAllTypesLite::has_default_uint32() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000010u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_uint32_ = 43u;
+  _impl_._has_bits_[1] &= ~0x00000010u;
+}
+inline ::uint32_t TestAllTypesLite::default_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_uint32)
+  return _internal_default_uint32();
+}
+inline void TestAllTypesLite::set_default_uint32(::uint32_t value) {
+  _internal_set_default_uint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_uint32)
+}
+inline ::uint32_t TestAllTypesLite::_internal_default_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_uint32_;
+}
+inline void TestAllTypesLite::_internal_set_default_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000010u;
+  _impl_.default_uint32_ = value;
+}
+
+// optional uint64 default_uint64 = 64 [default = 44];
+inline bool TestAllTypesLite::has_default_uint64() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000008u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_uint64_ = ::uint64_t{44u};
+  _impl_._has_bits_[1] &= ~0x00000008u;
+}
+inline ::uint64_t TestAllTypesLite::default_uint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_uint64)
+  return _internal_default_uint64();
+}
+inline void TestAllTypesLite::set_default_uint64(::uint64_t value) {
+  _internal_set_default_uint64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_uint64)
+}
+inline ::uint64_t TestAllTypesLite::_internal_default_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_uint64_;
+}
+inline void TestAllTypesLite::_internal_set_default_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000008u;
+  _impl_.default_uint64_ = value;
+}
+
+// optional sint32 default_sint32 = 65 [default = -45];
+inline bool TestAllTypesLite::has_default_sint32() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000020u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_sint32_ = -45;
+  _impl_._has_bits_[1] &= ~0x00000020u;
+}
+inline ::int32_t TestAllTypesLite::default_sint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_sint32)
+  return _internal_default_sint32();
+}
+inline void TestAllTypesLite::set_default_sint32(::int32_t value) {
+  _internal_set_default_sint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_sint32)
+}
+inline ::int32_t TestAllTypesLite::_internal_default_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_sint32_;
+}
+inline void TestAllTypesLite::_internal_set_default_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000020u;
+  _impl_.default_sint32_ = value;
+}
+
+// optional sint64 default_sint64 = 66 [default = 46];
+inline bool TestAllTypesLite::has_default_sint64() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000040u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_sint64_ = ::int64_t{46};
+  _impl_._has_bits_[1] &= ~0x00000040u;
+}
+inline ::int64_t TestAllTypesLite::default_sint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_sint64)
+  return _internal_default_sint64();
+}
+inline void TestAllTypesLite::set_default_sint64(::int64_t value) {
+  _internal_set_default_sint64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_sint64)
+}
+inline ::int64_t TestAllTypesLite::_internal_default_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_sint64_;
+}
+inline void TestAllTypesLite::_internal_set_default_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000040u;
+  _impl_.default_sint64_ = value;
+}
+
+// optional fixed32 default_fixed32 = 67 [default = 47];
+inline bool TestAllTypesLite::has_default_fixed32() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000100u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_fixed32_ = 47u;
+  _impl_._has_bits_[1] &= ~0x00000100u;
+}
+inline ::uint32_t TestAllTypesLite::default_fixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_fixed32)
+  return _internal_default_fixed32();
+}
+inline void TestAllTypesLite::set_default_fixed32(::uint32_t value) {
+  _internal_set_default_fixed32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_fixed32)
+}
+inline ::uint32_t TestAllTypesLite::_internal_default_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_fixed32_;
+}
+inline void TestAllTypesLite::_internal_set_default_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000100u;
+  _impl_.default_fixed32_ = value;
+}
+
+// optional fixed64 default_fixed64 = 68 [default = 48];
+inline bool TestAllTypesLite::has_default_fixed64() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000080u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_fixed64_ = ::uint64_t{48u};
+  _impl_._has_bits_[1] &= ~0x00000080u;
+}
+inline ::uint64_t TestAllTypesLite::default_fixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_fixed64)
+  return _internal_default_fixed64();
+}
+inline void TestAllTypesLite::set_default_fixed64(::uint64_t value) {
+  _internal_set_default_fixed64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_fixed64)
+}
+inline ::uint64_t TestAllTypesLite::_internal_default_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_fixed64_;
+}
+inline void TestAllTypesLite::_internal_set_default_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000080u;
+  _impl_.default_fixed64_ = value;
+}
+
+// optional sfixed32 default_sfixed32 = 69 [default = 49];
+inline bool TestAllTypesLite::has_default_sfixed32() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000200u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_sfixed32_ = 49;
+  _impl_._has_bits_[1] &= ~0x00000200u;
+}
+inline ::int32_t TestAllTypesLite::default_sfixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_sfixed32)
+  return _internal_default_sfixed32();
+}
+inline void TestAllTypesLite::set_default_sfixed32(::int32_t value) {
+  _internal_set_default_sfixed32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_sfixed32)
+}
+inline ::int32_t TestAllTypesLite::_internal_default_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_sfixed32_;
+}
+inline void TestAllTypesLite::_internal_set_default_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000200u;
+  _impl_.default_sfixed32_ = value;
+}
+
+// optional sfixed64 default_sfixed64 = 70 [default = -50];
+inline bool TestAllTypesLite::has_default_sfixed64() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000400u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_sfixed64_ = ::int64_t{-50};
+  _impl_._has_bits_[1] &= ~0x00000400u;
+}
+inline ::int64_t TestAllTypesLite::default_sfixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_sfixed64)
+  return _internal_default_sfixed64();
+}
+inline void TestAllTypesLite::set_default_sfixed64(::int64_t value) {
+  _internal_set_default_sfixed64(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_sfixed64)
+}
+inline ::int64_t TestAllTypesLite::_internal_default_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_sfixed64_;
+}
+inline void TestAllTypesLite::_internal_set_default_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000400u;
+  _impl_.default_sfixed64_ = value;
+}
+
+// optional float default_float = 71 [default = 51.5];
+inline bool TestAllTypesLite::has_default_float() const {
+  bool value = (_impl_._has_bits_[1] & 0x00001000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_float_ = 51.5f;
+  _impl_._has_bits_[1] &= ~0x00001000u;
+}
+inline float TestAllTypesLite::default_float() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_float)
+  return _internal_default_float();
+}
+inline void TestAllTypesLite::set_default_float(float value) {
+  _internal_set_default_float(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_float)
+}
+inline float TestAllTypesLite::_internal_default_float() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_float_;
+}
+inline void TestAllTypesLite::_internal_set_default_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00001000u;
+  _impl_.default_float_ = value;
+}
+
+// optional double default_double = 72 [default = 52000];
+inline bool TestAllTypesLite::has_default_double() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000800u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_double_ = 52000;
+  _impl_._has_bits_[1] &= ~0x00000800u;
+}
+inline double TestAllTypesLite::default_double() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_double)
+  return _internal_default_double();
+}
+inline void TestAllTypesLite::set_default_double(double value) {
+  _internal_set_default_double(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_double)
+}
+inline double TestAllTypesLite::_internal_default_double() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_double_;
+}
+inline void TestAllTypesLite::_internal_set_default_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00000800u;
+  _impl_.default_double_ = value;
+}
+
+// optional bool default_bool = 73 [default = true];
+inline bool TestAllTypesLite::has_default_bool() const {
+  bool value = (_impl_._has_bits_[1] & 0x00002000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_bool_ = true;
+  _impl_._has_bits_[1] &= ~0x00002000u;
+}
+inline bool TestAllTypesLite::default_bool() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_bool)
+  return _internal_default_bool();
+}
+inline void TestAllTypesLite::set_default_bool(bool value) {
+  _internal_set_default_bool(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_bool)
+}
+inline bool TestAllTypesLite::_internal_default_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_bool_;
+}
+inline void TestAllTypesLite::_internal_set_default_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[1] |= 0x00002000u;
+  _impl_.default_bool_ = value;
+}
+
+// optional string default_string = 74 [default = "hello"];
+inline bool TestAllTypesLite::has_default_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_string_.ClearToDefault(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_string_, GetArena());
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& TestAllTypesLite::default_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_string)
+  if (_impl_.default_string_.IsDefault()) {
+    return Impl_::_i_give_permission_to_break_this_code_default_default_string_.get();
+  }
+  return _internal_default_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_default_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.default_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_string)
+}
+inline std::string* TestAllTypesLite::mutable_default_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_default_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.default_string)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_default_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_string_.Get();
+}
+inline void TestAllTypesLite::_internal_set_default_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.default_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_default_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.default_string_.Mutable(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_string_, GetArena());
+}
+inline std::string* TestAllTypesLite::release_default_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.default_string)
+  if ((_impl_._has_bits_[0] & 0x00000010u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  return _impl_.default_string_.Release();
+}
+inline void TestAllTypesLite::set_allocated_default_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.default_string_.SetAllocated(value, GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.default_string)
+}
+
+// optional bytes default_bytes = 75 [default = "world"];
+inline bool TestAllTypesLite::has_default_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_bytes_.ClearToDefault(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_bytes_, GetArena());
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const std::string& TestAllTypesLite::default_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_bytes)
+  if (_impl_.default_bytes_.IsDefault()) {
+    return Impl_::_i_give_permission_to_break_this_code_default_default_bytes_.get();
+  }
+  return _internal_default_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_default_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.default_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_bytes)
+}
+inline std::string* TestAllTypesLite::mutable_default_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_default_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.default_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_default_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_bytes_.Get();
+}
+inline void TestAllTypesLite::_internal_set_default_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.default_bytes_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_default_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  return _impl_.default_bytes_.Mutable(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_bytes_, GetArena());
+}
+inline std::string* TestAllTypesLite::release_default_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.default_bytes)
+  if ((_impl_._has_bits_[0] & 0x00000020u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  return _impl_.default_bytes_.Release();
+}
+inline void TestAllTypesLite::set_allocated_default_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.default_bytes_.SetAllocated(value, GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.default_bytes)
+}
+
+// optional .protobuf_unittest.TestAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+inline bool TestAllTypesLite::has_default_nested_enum() const {
+  bool value = (_impl_._has_bits_[1] & 0x00004000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_nested_enum_ = 2;
+  _impl_._has_bits_[1] &= ~0x00004000u;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedEnum TestAllTypesLite::default_nested_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_nested_enum)
+  return _internal_default_nested_enum();
+}
+inline void TestAllTypesLite::set_default_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value) {
+  _internal_set_default_nested_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_nested_enum)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedEnum TestAllTypesLite::_internal_default_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::TestAllTypesLite_NestedEnum>(_impl_.default_nested_enum_);
+}
+inline void TestAllTypesLite::_internal_set_default_nested_enum(::protobuf_unittest::TestAllTypesLite_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(value));
+  _impl_._has_bits_[1] |= 0x00004000u;
+  _impl_.default_nested_enum_ = value;
+}
+
+// optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+inline bool TestAllTypesLite::has_default_foreign_enum() const {
+  bool value = (_impl_._has_bits_[1] & 0x00008000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_foreign_enum_ = 5;
+  _impl_._has_bits_[1] &= ~0x00008000u;
+}
+inline ::protobuf_unittest::ForeignEnumLite TestAllTypesLite::default_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_foreign_enum)
+  return _internal_default_foreign_enum();
+}
+inline void TestAllTypesLite::set_default_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  _internal_set_default_foreign_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_foreign_enum)
+}
+inline ::protobuf_unittest::ForeignEnumLite TestAllTypesLite::_internal_default_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::ForeignEnumLite>(_impl_.default_foreign_enum_);
+}
+inline void TestAllTypesLite::_internal_set_default_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _impl_._has_bits_[1] |= 0x00008000u;
+  _impl_.default_foreign_enum_ = value;
+}
+
+// optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+inline bool TestAllTypesLite::has_default_import_enum() const {
+  bool value = (_impl_._has_bits_[0] & 0x20000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_import_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_import_enum_ = 8;
+  _impl_._has_bits_[0] &= ~0x20000000u;
+}
+inline ::protobuf_unittest_import::ImportEnumLite TestAllTypesLite::default_import_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_import_enum)
+  return _internal_default_import_enum();
+}
+inline void TestAllTypesLite::set_default_import_enum(::protobuf_unittest_import::ImportEnumLite value) {
+  _internal_set_default_import_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_import_enum)
+}
+inline ::protobuf_unittest_import::ImportEnumLite TestAllTypesLite::_internal_default_import_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest_import::ImportEnumLite>(_impl_.default_import_enum_);
+}
+inline void TestAllTypesLite::_internal_set_default_import_enum(::protobuf_unittest_import::ImportEnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  _impl_._has_bits_[0] |= 0x20000000u;
+  _impl_.default_import_enum_ = value;
+}
+
+// optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+inline bool TestAllTypesLite::has_default_string_piece() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_string_piece_.ClearToDefault(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_string_piece_, GetArena());
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const std::string& TestAllTypesLite::default_string_piece() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_string_piece)
+  if (_impl_.default_string_piece_.IsDefault()) {
+    return Impl_::_i_give_permission_to_break_this_code_default_default_string_piece_.get();
+  }
+  return _internal_default_string_piece();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_default_string_piece(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.default_string_piece_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_string_piece)
+}
+inline std::string* TestAllTypesLite::mutable_default_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_default_string_piece();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.default_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_default_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_string_piece_.Get();
+}
+inline void TestAllTypesLite::_internal_set_default_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.default_string_piece_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_default_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  return _impl_.default_string_piece_.Mutable(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_string_piece_, GetArena());
+}
+inline std::string* TestAllTypesLite::release_default_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.default_string_piece)
+  if ((_impl_._has_bits_[0] & 0x00000040u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  return _impl_.default_string_piece_.Release();
+}
+inline void TestAllTypesLite::set_allocated_default_string_piece(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.default_string_piece_.SetAllocated(value, GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.default_string_piece)
+}
+
+// optional string default_cord = 85 [default = "123", ctype = CORD];
+inline bool TestAllTypesLite::has_default_cord() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_default_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.default_cord_.ClearToDefault(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_cord_, GetArena());
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const std::string& TestAllTypesLite::default_cord() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.default_cord)
+  if (_impl_.default_cord_.IsDefault()) {
+    return Impl_::_i_give_permission_to_break_this_code_default_default_cord_.get();
+  }
+  return _internal_default_cord();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_default_cord(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.default_cord_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.default_cord)
+}
+inline std::string* TestAllTypesLite::mutable_default_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_default_cord();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.default_cord)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_default_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.default_cord_.Get();
+}
+inline void TestAllTypesLite::_internal_set_default_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.default_cord_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_default_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  return _impl_.default_cord_.Mutable(::protobuf_unittest::TestAllTypesLite::Impl_::_i_give_permission_to_break_this_code_default_default_cord_, GetArena());
+}
+inline std::string* TestAllTypesLite::release_default_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.default_cord)
+  if ((_impl_._has_bits_[0] & 0x00000080u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  return _impl_.default_cord_.Release();
+}
+inline void TestAllTypesLite::set_allocated_default_cord(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.default_cord_.SetAllocated(value, GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.default_cord)
+}
+
+// uint32 oneof_uint32 = 111;
+inline bool TestAllTypesLite::has_oneof_uint32() const {
+  return oneof_field_case() == kOneofUint32;
+}
+inline void TestAllTypesLite::set_has_oneof_uint32() {
+  _impl_._oneof_case_[0] = kOneofUint32;
+}
+inline void TestAllTypesLite::clear_oneof_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofUint32) {
+    _impl_.oneof_field_.oneof_uint32_ = 0u;
+    clear_has_oneof_field();
+  }
+}
+inline ::uint32_t TestAllTypesLite::oneof_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.oneof_uint32)
+  return _internal_oneof_uint32();
+}
+inline void TestAllTypesLite::set_oneof_uint32(::uint32_t value) {
+  _internal_set_oneof_uint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.oneof_uint32)
+}
+inline ::uint32_t TestAllTypesLite::_internal_oneof_uint32() const {
+  if (oneof_field_case() == kOneofUint32) {
+    return _impl_.oneof_field_.oneof_uint32_;
+  }
+  return 0u;
+}
+inline void TestAllTypesLite::_internal_set_oneof_uint32(::uint32_t value) {
+  if (oneof_field_case() != kOneofUint32) {
+    clear_oneof_field();
+    set_has_oneof_uint32();
+  }
+  _impl_.oneof_field_.oneof_uint32_ = value;
+}
+
+// .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_nested_message = 112;
+inline bool TestAllTypesLite::has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline bool TestAllTypesLite::_internal_has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline void TestAllTypesLite::set_has_oneof_nested_message() {
+  _impl_._oneof_case_[0] = kOneofNestedMessage;
+}
+inline void TestAllTypesLite::clear_oneof_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofNestedMessage) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_nested_message_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.oneof_nested_message)
+  if (oneof_field_case() == kOneofNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::_internal_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage ? *_impl_.oneof_field_.oneof_nested_message_ : reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage&>(::protobuf_unittest::_TestAllTypesLite_NestedMessage_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::oneof_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.oneof_nested_message)
+  return _internal_oneof_nested_message();
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::unsafe_arena_release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestAllTypesLite.oneof_nested_message)
+  if (oneof_field_case() == kOneofNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message_;
+    _impl_.oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_oneof_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_nested_message();
+    _impl_.oneof_field_.oneof_nested_message_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_nested_message)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::_internal_mutable_oneof_nested_message() {
+  if (oneof_field_case() != kOneofNestedMessage) {
+    clear_oneof_field();
+    set_has_oneof_nested_message();
+    _impl_.oneof_field_.oneof_nested_message_ = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_NestedMessage>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_nested_message_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_oneof_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _msg = _internal_mutable_oneof_nested_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.oneof_nested_message)
+  return _msg;
+}
+
+// string oneof_string = 113;
+inline bool TestAllTypesLite::has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline void TestAllTypesLite::set_has_oneof_string() {
+  _impl_._oneof_case_[0] = kOneofString;
+}
+inline void TestAllTypesLite::clear_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofString) {
+    _impl_.oneof_field_.oneof_string_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypesLite::oneof_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.oneof_string)
+  return _internal_oneof_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_oneof_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.oneof_string)
+}
+inline std::string* TestAllTypesLite::mutable_oneof_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.oneof_string)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_oneof_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_string_.Get();
+}
+inline void TestAllTypesLite::_internal_set_oneof_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_.Mutable( GetArena());
+}
+inline std::string* TestAllTypesLite::release_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.oneof_string)
+  if (oneof_field_case() != kOneofString) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_.Release();
+}
+inline void TestAllTypesLite::set_allocated_oneof_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_string)
+}
+
+// bytes oneof_bytes = 114;
+inline bool TestAllTypesLite::has_oneof_bytes() const {
+  return oneof_field_case() == kOneofBytes;
+}
+inline void TestAllTypesLite::set_has_oneof_bytes() {
+  _impl_._oneof_case_[0] = kOneofBytes;
+}
+inline void TestAllTypesLite::clear_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofBytes) {
+    _impl_.oneof_field_.oneof_bytes_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypesLite::oneof_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.oneof_bytes)
+  return _internal_oneof_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypesLite::set_oneof_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.oneof_bytes)
+}
+inline std::string* TestAllTypesLite::mutable_oneof_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.oneof_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypesLite::_internal_oneof_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Get();
+}
+inline void TestAllTypesLite::_internal_set_oneof_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.Set(value, GetArena());
+}
+inline std::string* TestAllTypesLite::_internal_mutable_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Mutable( GetArena());
+}
+inline std::string* TestAllTypesLite::release_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.oneof_bytes)
+  if (oneof_field_case() != kOneofBytes) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_bytes_.Release();
+}
+inline void TestAllTypesLite::set_allocated_oneof_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_bytes)
+}
+
+// .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_lazy_nested_message = 115 [lazy = true];
+inline bool TestAllTypesLite::has_oneof_lazy_nested_message() const {
+  return oneof_field_case() == kOneofLazyNestedMessage;
+}
+inline bool TestAllTypesLite::_internal_has_oneof_lazy_nested_message() const {
+  return oneof_field_case() == kOneofLazyNestedMessage;
+}
+inline void TestAllTypesLite::set_has_oneof_lazy_nested_message() {
+  _impl_._oneof_case_[0] = kOneofLazyNestedMessage;
+}
+inline void TestAllTypesLite::clear_oneof_lazy_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofLazyNestedMessage) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_lazy_nested_message_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::release_oneof_lazy_nested_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.oneof_lazy_nested_message)
+  if (oneof_field_case() == kOneofLazyNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_lazy_nested_message_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_lazy_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::_internal_oneof_lazy_nested_message() const {
+  return oneof_field_case() == kOneofLazyNestedMessage ? *_impl_.oneof_field_.oneof_lazy_nested_message_ : reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage&>(::protobuf_unittest::_TestAllTypesLite_NestedMessage_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::oneof_lazy_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.oneof_lazy_nested_message)
+  return _internal_oneof_lazy_nested_message();
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::unsafe_arena_release_oneof_lazy_nested_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestAllTypesLite.oneof_lazy_nested_message)
+  if (oneof_field_case() == kOneofLazyNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_lazy_nested_message_;
+    _impl_.oneof_field_.oneof_lazy_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_oneof_lazy_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_lazy_nested_message();
+    _impl_.oneof_field_.oneof_lazy_nested_message_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_lazy_nested_message)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::_internal_mutable_oneof_lazy_nested_message() {
+  if (oneof_field_case() != kOneofLazyNestedMessage) {
+    clear_oneof_field();
+    set_has_oneof_lazy_nested_message();
+    _impl_.oneof_field_.oneof_lazy_nested_message_ = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_NestedMessage>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_lazy_nested_message_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_oneof_lazy_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage* _msg = _internal_mutable_oneof_lazy_nested_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.oneof_lazy_nested_message)
+  return _msg;
+}
+
+// .protobuf_unittest.TestAllTypesLite.NestedMessage2 oneof_nested_message2 = 117;
+inline bool TestAllTypesLite::has_oneof_nested_message2() const {
+  return oneof_field_case() == kOneofNestedMessage2;
+}
+inline bool TestAllTypesLite::_internal_has_oneof_nested_message2() const {
+  return oneof_field_case() == kOneofNestedMessage2;
+}
+inline void TestAllTypesLite::set_has_oneof_nested_message2() {
+  _impl_._oneof_case_[0] = kOneofNestedMessage2;
+}
+inline void TestAllTypesLite::clear_oneof_nested_message2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofNestedMessage2) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_nested_message2_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage2* TestAllTypesLite::release_oneof_nested_message2() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestAllTypesLite.oneof_nested_message2)
+  if (oneof_field_case() == kOneofNestedMessage2) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message2_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_nested_message2_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage2& TestAllTypesLite::_internal_oneof_nested_message2() const {
+  return oneof_field_case() == kOneofNestedMessage2 ? *_impl_.oneof_field_.oneof_nested_message2_ : reinterpret_cast<::protobuf_unittest::TestAllTypesLite_NestedMessage2&>(::protobuf_unittest::_TestAllTypesLite_NestedMessage2_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage2& TestAllTypesLite::oneof_nested_message2() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.oneof_nested_message2)
+  return _internal_oneof_nested_message2();
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage2* TestAllTypesLite::unsafe_arena_release_oneof_nested_message2() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestAllTypesLite.oneof_nested_message2)
+  if (oneof_field_case() == kOneofNestedMessage2) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message2_;
+    _impl_.oneof_field_.oneof_nested_message2_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypesLite::unsafe_arena_set_allocated_oneof_nested_message2(::protobuf_unittest::TestAllTypesLite_NestedMessage2* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_nested_message2();
+    _impl_.oneof_field_.oneof_nested_message2_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_nested_message2)
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage2* TestAllTypesLite::_internal_mutable_oneof_nested_message2() {
+  if (oneof_field_case() != kOneofNestedMessage2) {
+    clear_oneof_field();
+    set_has_oneof_nested_message2();
+    _impl_.oneof_field_.oneof_nested_message2_ = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite_NestedMessage2>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_nested_message2_;
+}
+inline ::protobuf_unittest::TestAllTypesLite_NestedMessage2* TestAllTypesLite::mutable_oneof_nested_message2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage2* _msg = _internal_mutable_oneof_nested_message2();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestAllTypesLite.oneof_nested_message2)
+  return _msg;
+}
+
+// optional int32 deceptively_named_list = 116;
+inline bool TestAllTypesLite::has_deceptively_named_list() const {
+  bool value = (_impl_._has_bits_[0] & 0x10000000u) != 0;
+  return value;
+}
+inline void TestAllTypesLite::clear_deceptively_named_list() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.deceptively_named_list_ = 0;
+  _impl_._has_bits_[0] &= ~0x10000000u;
+}
+inline ::int32_t TestAllTypesLite::deceptively_named_list() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestAllTypesLite.deceptively_named_list)
+  return _internal_deceptively_named_list();
+}
+inline void TestAllTypesLite::set_deceptively_named_list(::int32_t value) {
+  _internal_set_deceptively_named_list(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestAllTypesLite.deceptively_named_list)
+}
+inline ::int32_t TestAllTypesLite::_internal_deceptively_named_list() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.deceptively_named_list_;
+}
+inline void TestAllTypesLite::_internal_set_deceptively_named_list(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x10000000u;
+  _impl_.deceptively_named_list_ = value;
+}
+
+inline bool TestAllTypesLite::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestAllTypesLite::clear_has_oneof_field() {
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestAllTypesLite::OneofFieldCase TestAllTypesLite::oneof_field_case() const {
+  return TestAllTypesLite::OneofFieldCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ForeignMessageLite
+
+// optional int32 c = 1;
+inline bool ForeignMessageLite::has_c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void ForeignMessageLite::clear_c() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.c_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t ForeignMessageLite::c() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ForeignMessageLite.c)
+  return _internal_c();
+}
+inline void ForeignMessageLite::set_c(::int32_t value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ForeignMessageLite.c)
+}
+inline ::int32_t ForeignMessageLite::_internal_c() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.c_;
+}
+inline void ForeignMessageLite::_internal_set_c(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.c_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestPackedTypesLite
+
+// repeated int32 packed_int32 = 90 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_int32_size() const {
+  return _internal_packed_int32().size();
+}
+inline int TestPackedTypesLite::packed_int32_size() const {
+  return _internal_packed_int32_size();
+}
+inline void TestPackedTypesLite::clear_packed_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_int32_.Clear();
+}
+inline ::int32_t TestPackedTypesLite::packed_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_int32)
+  return _internal_packed_int32().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_int32(int index, ::int32_t value) {
+  _internal_mutable_packed_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_int32)
+}
+inline void TestPackedTypesLite::add_packed_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypesLite::packed_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_int32)
+  return _internal_packed_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypesLite::mutable_packed_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypesLite::_internal_packed_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypesLite::_internal_mutable_packed_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_int32_;
+}
+
+// repeated int64 packed_int64 = 91 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_int64_size() const {
+  return _internal_packed_int64().size();
+}
+inline int TestPackedTypesLite::packed_int64_size() const {
+  return _internal_packed_int64_size();
+}
+inline void TestPackedTypesLite::clear_packed_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_int64_.Clear();
+}
+inline ::int64_t TestPackedTypesLite::packed_int64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_int64)
+  return _internal_packed_int64().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_int64(int index, ::int64_t value) {
+  _internal_mutable_packed_int64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_int64)
+}
+inline void TestPackedTypesLite::add_packed_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_int64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_int64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypesLite::packed_int64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_int64)
+  return _internal_packed_int64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypesLite::mutable_packed_int64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_int64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_int64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypesLite::_internal_packed_int64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_int64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypesLite::_internal_mutable_packed_int64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_int64_;
+}
+
+// repeated uint32 packed_uint32 = 92 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_uint32_size() const {
+  return _internal_packed_uint32().size();
+}
+inline int TestPackedTypesLite::packed_uint32_size() const {
+  return _internal_packed_uint32_size();
+}
+inline void TestPackedTypesLite::clear_packed_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_uint32_.Clear();
+}
+inline ::uint32_t TestPackedTypesLite::packed_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_uint32)
+  return _internal_packed_uint32().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_uint32(int index, ::uint32_t value) {
+  _internal_mutable_packed_uint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_uint32)
+}
+inline void TestPackedTypesLite::add_packed_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_uint32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_uint32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypesLite::packed_uint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_uint32)
+  return _internal_packed_uint32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypesLite::mutable_packed_uint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_uint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_uint32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypesLite::_internal_packed_uint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_uint32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypesLite::_internal_mutable_packed_uint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_uint32_;
+}
+
+// repeated uint64 packed_uint64 = 93 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_uint64_size() const {
+  return _internal_packed_uint64().size();
+}
+inline int TestPackedTypesLite::packed_uint64_size() const {
+  return _internal_packed_uint64_size();
+}
+inline void TestPackedTypesLite::clear_packed_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_uint64_.Clear();
+}
+inline ::uint64_t TestPackedTypesLite::packed_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_uint64)
+  return _internal_packed_uint64().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_uint64(int index, ::uint64_t value) {
+  _internal_mutable_packed_uint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_uint64)
+}
+inline void TestPackedTypesLite::add_packed_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_uint64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_uint64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypesLite::packed_uint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_uint64)
+  return _internal_packed_uint64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypesLite::mutable_packed_uint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_uint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_uint64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypesLite::_internal_packed_uint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_uint64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypesLite::_internal_mutable_packed_uint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_uint64_;
+}
+
+// repeated sint32 packed_sint32 = 94 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_sint32_size() const {
+  return _internal_packed_sint32().size();
+}
+inline int TestPackedTypesLite::packed_sint32_size() const {
+  return _internal_packed_sint32_size();
+}
+inline void TestPackedTypesLite::clear_packed_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sint32_.Clear();
+}
+inline ::int32_t TestPackedTypesLite::packed_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_sint32)
+  return _internal_packed_sint32().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_sint32(int index, ::int32_t value) {
+  _internal_mutable_packed_sint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_sint32)
+}
+inline void TestPackedTypesLite::add_packed_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sint32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_sint32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypesLite::packed_sint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_sint32)
+  return _internal_packed_sint32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypesLite::mutable_packed_sint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_sint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sint32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypesLite::_internal_packed_sint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sint32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypesLite::_internal_mutable_packed_sint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sint32_;
+}
+
+// repeated sint64 packed_sint64 = 95 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_sint64_size() const {
+  return _internal_packed_sint64().size();
+}
+inline int TestPackedTypesLite::packed_sint64_size() const {
+  return _internal_packed_sint64_size();
+}
+inline void TestPackedTypesLite::clear_packed_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sint64_.Clear();
+}
+inline ::int64_t TestPackedTypesLite::packed_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_sint64)
+  return _internal_packed_sint64().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_sint64(int index, ::int64_t value) {
+  _internal_mutable_packed_sint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_sint64)
+}
+inline void TestPackedTypesLite::add_packed_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sint64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_sint64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypesLite::packed_sint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_sint64)
+  return _internal_packed_sint64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypesLite::mutable_packed_sint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_sint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sint64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypesLite::_internal_packed_sint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sint64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypesLite::_internal_mutable_packed_sint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sint64_;
+}
+
+// repeated fixed32 packed_fixed32 = 96 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_fixed32_size() const {
+  return _internal_packed_fixed32().size();
+}
+inline int TestPackedTypesLite::packed_fixed32_size() const {
+  return _internal_packed_fixed32_size();
+}
+inline void TestPackedTypesLite::clear_packed_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_fixed32_.Clear();
+}
+inline ::uint32_t TestPackedTypesLite::packed_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_fixed32)
+  return _internal_packed_fixed32().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_packed_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_fixed32)
+}
+inline void TestPackedTypesLite::add_packed_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypesLite::packed_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_fixed32)
+  return _internal_packed_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypesLite::mutable_packed_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypesLite::_internal_packed_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypesLite::_internal_mutable_packed_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_fixed32_;
+}
+
+// repeated fixed64 packed_fixed64 = 97 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_fixed64_size() const {
+  return _internal_packed_fixed64().size();
+}
+inline int TestPackedTypesLite::packed_fixed64_size() const {
+  return _internal_packed_fixed64_size();
+}
+inline void TestPackedTypesLite::clear_packed_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_fixed64_.Clear();
+}
+inline ::uint64_t TestPackedTypesLite::packed_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_fixed64)
+  return _internal_packed_fixed64().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_fixed64(int index, ::uint64_t value) {
+  _internal_mutable_packed_fixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_fixed64)
+}
+inline void TestPackedTypesLite::add_packed_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_fixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_fixed64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypesLite::packed_fixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_fixed64)
+  return _internal_packed_fixed64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypesLite::mutable_packed_fixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_fixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_fixed64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypesLite::_internal_packed_fixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_fixed64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypesLite::_internal_mutable_packed_fixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_fixed64_;
+}
+
+// repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_sfixed32_size() const {
+  return _internal_packed_sfixed32().size();
+}
+inline int TestPackedTypesLite::packed_sfixed32_size() const {
+  return _internal_packed_sfixed32_size();
+}
+inline void TestPackedTypesLite::clear_packed_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sfixed32_.Clear();
+}
+inline ::int32_t TestPackedTypesLite::packed_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_sfixed32)
+  return _internal_packed_sfixed32().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_sfixed32(int index, ::int32_t value) {
+  _internal_mutable_packed_sfixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_sfixed32)
+}
+inline void TestPackedTypesLite::add_packed_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sfixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypesLite::packed_sfixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_sfixed32)
+  return _internal_packed_sfixed32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypesLite::mutable_packed_sfixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_sfixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sfixed32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypesLite::_internal_packed_sfixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypesLite::_internal_mutable_packed_sfixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sfixed32_;
+}
+
+// repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_sfixed64_size() const {
+  return _internal_packed_sfixed64().size();
+}
+inline int TestPackedTypesLite::packed_sfixed64_size() const {
+  return _internal_packed_sfixed64_size();
+}
+inline void TestPackedTypesLite::clear_packed_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sfixed64_.Clear();
+}
+inline ::int64_t TestPackedTypesLite::packed_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_sfixed64)
+  return _internal_packed_sfixed64().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_sfixed64(int index, ::int64_t value) {
+  _internal_mutable_packed_sfixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_sfixed64)
+}
+inline void TestPackedTypesLite::add_packed_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sfixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypesLite::packed_sfixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_sfixed64)
+  return _internal_packed_sfixed64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypesLite::mutable_packed_sfixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_sfixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sfixed64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypesLite::_internal_packed_sfixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypesLite::_internal_mutable_packed_sfixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sfixed64_;
+}
+
+// repeated float packed_float = 100 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_float_size() const {
+  return _internal_packed_float().size();
+}
+inline int TestPackedTypesLite::packed_float_size() const {
+  return _internal_packed_float_size();
+}
+inline void TestPackedTypesLite::clear_packed_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_float_.Clear();
+}
+inline float TestPackedTypesLite::packed_float(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_float)
+  return _internal_packed_float().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_float(int index, float value) {
+  _internal_mutable_packed_float()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_float)
+}
+inline void TestPackedTypesLite::add_packed_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_float()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_float)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestPackedTypesLite::packed_float() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_float)
+  return _internal_packed_float();
+}
+inline ::google::protobuf::RepeatedField<float>* TestPackedTypesLite::mutable_packed_float()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_float)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_float();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestPackedTypesLite::_internal_packed_float()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_float_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestPackedTypesLite::_internal_mutable_packed_float() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_float_;
+}
+
+// repeated double packed_double = 101 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_double_size() const {
+  return _internal_packed_double().size();
+}
+inline int TestPackedTypesLite::packed_double_size() const {
+  return _internal_packed_double_size();
+}
+inline void TestPackedTypesLite::clear_packed_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_double_.Clear();
+}
+inline double TestPackedTypesLite::packed_double(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_double)
+  return _internal_packed_double().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_double(int index, double value) {
+  _internal_mutable_packed_double()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_double)
+}
+inline void TestPackedTypesLite::add_packed_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_double()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_double)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestPackedTypesLite::packed_double() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_double)
+  return _internal_packed_double();
+}
+inline ::google::protobuf::RepeatedField<double>* TestPackedTypesLite::mutable_packed_double()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_double)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_double();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestPackedTypesLite::_internal_packed_double()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_double_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestPackedTypesLite::_internal_mutable_packed_double() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_double_;
+}
+
+// repeated bool packed_bool = 102 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_bool_size() const {
+  return _internal_packed_bool().size();
+}
+inline int TestPackedTypesLite::packed_bool_size() const {
+  return _internal_packed_bool_size();
+}
+inline void TestPackedTypesLite::clear_packed_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_bool_.Clear();
+}
+inline bool TestPackedTypesLite::packed_bool(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_bool)
+  return _internal_packed_bool().Get(index);
+}
+inline void TestPackedTypesLite::set_packed_bool(int index, bool value) {
+  _internal_mutable_packed_bool()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_bool)
+}
+inline void TestPackedTypesLite::add_packed_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_bool()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_bool)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestPackedTypesLite::packed_bool() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_bool)
+  return _internal_packed_bool();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestPackedTypesLite::mutable_packed_bool()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_bool)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_bool();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestPackedTypesLite::_internal_packed_bool()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_bool_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestPackedTypesLite::_internal_mutable_packed_bool() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_bool_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+inline int TestPackedTypesLite::_internal_packed_enum_size() const {
+  return _internal_packed_enum().size();
+}
+inline int TestPackedTypesLite::packed_enum_size() const {
+  return _internal_packed_enum_size();
+}
+inline void TestPackedTypesLite::clear_packed_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_enum_.Clear();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestPackedTypesLite::packed_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTypesLite.packed_enum)
+  return static_cast<::protobuf_unittest::ForeignEnumLite>(_internal_packed_enum().Get(index));
+}
+inline void TestPackedTypesLite::set_packed_enum(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _internal_mutable_packed_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTypesLite.packed_enum)
+}
+inline void TestPackedTypesLite::add_packed_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTypesLite.packed_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestPackedTypesLite::packed_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTypesLite.packed_enum)
+  return _internal_packed_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestPackedTypesLite::mutable_packed_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTypesLite.packed_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestPackedTypesLite::_internal_packed_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestPackedTypesLite::_internal_mutable_packed_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllExtensionsLite
+
+// -------------------------------------------------------------------
+
+// OptionalGroup_extension_lite
+
+// optional int32 a = 17;
+inline bool OptionalGroup_extension_lite::has_a() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void OptionalGroup_extension_lite::clear_a() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.a_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t OptionalGroup_extension_lite::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OptionalGroup_extension_lite.a)
+  return _internal_a();
+}
+inline void OptionalGroup_extension_lite::set_a(::int32_t value) {
+  _internal_set_a(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.OptionalGroup_extension_lite.a)
+}
+inline ::int32_t OptionalGroup_extension_lite::_internal_a() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.a_;
+}
+inline void OptionalGroup_extension_lite::_internal_set_a(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// RepeatedGroup_extension_lite
+
+// optional int32 a = 47;
+inline bool RepeatedGroup_extension_lite::has_a() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void RepeatedGroup_extension_lite::clear_a() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.a_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t RepeatedGroup_extension_lite::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedGroup_extension_lite.a)
+  return _internal_a();
+}
+inline void RepeatedGroup_extension_lite::set_a(::int32_t value) {
+  _internal_set_a(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.RepeatedGroup_extension_lite.a)
+}
+inline ::int32_t RepeatedGroup_extension_lite::_internal_a() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.a_;
+}
+inline void RepeatedGroup_extension_lite::_internal_set_a(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestPackedExtensionsLite
+
+// -------------------------------------------------------------------
+
+// TestNestedExtensionLite
+
+// -------------------------------------------------------------------
+
+// TestDeprecatedLite
+
+// optional int32 deprecated_field = 1 [deprecated = true];
+inline bool TestDeprecatedLite::has_deprecated_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline void TestDeprecatedLite::clear_deprecated_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.deprecated_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::int32_t TestDeprecatedLite::deprecated_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestDeprecatedLite.deprecated_field)
+  return _internal_deprecated_field();
+}
+inline void TestDeprecatedLite::set_deprecated_field(::int32_t value) {
+  _internal_set_deprecated_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestDeprecatedLite.deprecated_field)
+}
+inline ::int32_t TestDeprecatedLite::_internal_deprecated_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.deprecated_field_;
+}
+inline void TestDeprecatedLite::_internal_set_deprecated_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.deprecated_field_ = value;
+}
+
+// required int32 deprecated_field2 = 2 [deprecated = true];
+inline bool TestDeprecatedLite::has_deprecated_field2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline void TestDeprecatedLite::clear_deprecated_field2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.deprecated_field2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::int32_t TestDeprecatedLite::deprecated_field2() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestDeprecatedLite.deprecated_field2)
+  return _internal_deprecated_field2();
+}
+inline void TestDeprecatedLite::set_deprecated_field2(::int32_t value) {
+  _internal_set_deprecated_field2(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestDeprecatedLite.deprecated_field2)
+}
+inline ::int32_t TestDeprecatedLite::_internal_deprecated_field2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.deprecated_field2_;
+}
+inline void TestDeprecatedLite::_internal_set_deprecated_field2(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.deprecated_field2_ = value;
+}
+
+// optional string deprecated_field3 = 3 [deprecated = true];
+inline bool TestDeprecatedLite::has_deprecated_field3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestDeprecatedLite::clear_deprecated_field3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.deprecated_field3_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestDeprecatedLite::deprecated_field3() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestDeprecatedLite.deprecated_field3)
+  return _internal_deprecated_field3();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestDeprecatedLite::set_deprecated_field3(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.deprecated_field3_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestDeprecatedLite.deprecated_field3)
+}
+inline std::string* TestDeprecatedLite::mutable_deprecated_field3() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_deprecated_field3();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestDeprecatedLite.deprecated_field3)
+  return _s;
+}
+inline const std::string& TestDeprecatedLite::_internal_deprecated_field3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.deprecated_field3_.Get();
+}
+inline void TestDeprecatedLite::_internal_set_deprecated_field3(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.deprecated_field3_.Set(value, GetArena());
+}
+inline std::string* TestDeprecatedLite::_internal_mutable_deprecated_field3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.deprecated_field3_.Mutable( GetArena());
+}
+inline std::string* TestDeprecatedLite::release_deprecated_field3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestDeprecatedLite.deprecated_field3)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.deprecated_field3_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.deprecated_field3_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestDeprecatedLite::set_allocated_deprecated_field3(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.deprecated_field3_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.deprecated_field3_.IsDefault()) {
+          _impl_.deprecated_field3_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestDeprecatedLite.deprecated_field3)
+}
+
+// optional .protobuf_unittest.TestDeprecatedLite deprecated_field4 = 4 [deprecated = true];
+inline bool TestDeprecatedLite::has_deprecated_field4() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.deprecated_field4_ != nullptr);
+  return value;
+}
+inline void TestDeprecatedLite::clear_deprecated_field4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.deprecated_field4_ != nullptr) _impl_.deprecated_field4_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::protobuf_unittest::TestDeprecatedLite& TestDeprecatedLite::_internal_deprecated_field4() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestDeprecatedLite* p = _impl_.deprecated_field4_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestDeprecatedLite&>(::protobuf_unittest::_TestDeprecatedLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestDeprecatedLite& TestDeprecatedLite::deprecated_field4() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestDeprecatedLite.deprecated_field4)
+  return _internal_deprecated_field4();
+}
+inline void TestDeprecatedLite::unsafe_arena_set_allocated_deprecated_field4(::protobuf_unittest::TestDeprecatedLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.deprecated_field4_);
+  }
+  _impl_.deprecated_field4_ = reinterpret_cast<::protobuf_unittest::TestDeprecatedLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestDeprecatedLite.deprecated_field4)
+}
+inline ::protobuf_unittest::TestDeprecatedLite* TestDeprecatedLite::release_deprecated_field4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::TestDeprecatedLite* released = _impl_.deprecated_field4_;
+  _impl_.deprecated_field4_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestDeprecatedLite* TestDeprecatedLite::unsafe_arena_release_deprecated_field4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestDeprecatedLite.deprecated_field4)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::TestDeprecatedLite* temp = _impl_.deprecated_field4_;
+  _impl_.deprecated_field4_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestDeprecatedLite* TestDeprecatedLite::_internal_mutable_deprecated_field4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.deprecated_field4_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestDeprecatedLite>(GetArena());
+    _impl_.deprecated_field4_ = reinterpret_cast<::protobuf_unittest::TestDeprecatedLite*>(p);
+  }
+  return _impl_.deprecated_field4_;
+}
+inline ::protobuf_unittest::TestDeprecatedLite* TestDeprecatedLite::mutable_deprecated_field4() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestDeprecatedLite* _msg = _internal_mutable_deprecated_field4();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestDeprecatedLite.deprecated_field4)
+  return _msg;
+}
+inline void TestDeprecatedLite::set_allocated_deprecated_field4(::protobuf_unittest::TestDeprecatedLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestDeprecatedLite*>(_impl_.deprecated_field4_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestDeprecatedLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.deprecated_field4_ = reinterpret_cast<::protobuf_unittest::TestDeprecatedLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestDeprecatedLite.deprecated_field4)
+}
+
+// -------------------------------------------------------------------
+
+// TestParsingMergeLite_RepeatedFieldsGenerator_Group1
+
+// optional .protobuf_unittest.TestAllTypesLite field1 = 11;
+inline bool TestParsingMergeLite_RepeatedFieldsGenerator_Group1::has_field1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.field1_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::clear_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.field1_ != nullptr) _impl_.field1_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator_Group1::_internal_field1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite* p = _impl_.field1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator_Group1::field1() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1.field1)
+  return _internal_field1();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::unsafe_arena_set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.field1_);
+  }
+  _impl_.field1_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1.field1)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group1::release_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* released = _impl_.field1_;
+  _impl_.field1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group1::unsafe_arena_release_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1.field1)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* temp = _impl_.field1_;
+  _impl_.field1_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group1::_internal_mutable_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.field1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+    _impl_.field1_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(p);
+  }
+  return _impl_.field1_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group1::mutable_field1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_field1();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1.field1)
+  return _msg;
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(_impl_.field1_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.field1_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1.field1)
+}
+
+// -------------------------------------------------------------------
+
+// TestParsingMergeLite_RepeatedFieldsGenerator_Group2
+
+// optional .protobuf_unittest.TestAllTypesLite field1 = 21;
+inline bool TestParsingMergeLite_RepeatedFieldsGenerator_Group2::has_field1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.field1_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::clear_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.field1_ != nullptr) _impl_.field1_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator_Group2::_internal_field1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite* p = _impl_.field1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator_Group2::field1() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2.field1)
+  return _internal_field1();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::unsafe_arena_set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.field1_);
+  }
+  _impl_.field1_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2.field1)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group2::release_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* released = _impl_.field1_;
+  _impl_.field1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group2::unsafe_arena_release_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2.field1)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* temp = _impl_.field1_;
+  _impl_.field1_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group2::_internal_mutable_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.field1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+    _impl_.field1_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(p);
+  }
+  return _impl_.field1_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator_Group2::mutable_field1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_field1();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2.field1)
+  return _msg;
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::set_allocated_field1(::protobuf_unittest::TestAllTypesLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(_impl_.field1_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.field1_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2.field1)
+}
+
+// -------------------------------------------------------------------
+
+// TestParsingMergeLite_RepeatedFieldsGenerator
+
+// repeated .protobuf_unittest.TestAllTypesLite field1 = 1;
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_field1_size() const {
+  return _internal_field1().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::field1_size() const {
+  return _internal_field1_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_field1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.field1_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_field1(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field1)
+  return _internal_mutable_field1()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_field1()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_field1();
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator::field1(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field1)
+  return _internal_field1().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::add_field1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite* _add = _internal_mutable_field1()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field1)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& TestParsingMergeLite_RepeatedFieldsGenerator::field1() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field1)
+  return _internal_field1();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_field1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.field1_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_field1() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.field1_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite field2 = 2;
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_field2_size() const {
+  return _internal_field2().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::field2_size() const {
+  return _internal_field2_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_field2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.field2_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_field2(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field2)
+  return _internal_mutable_field2()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_field2()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_field2();
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator::field2(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field2)
+  return _internal_field2().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::add_field2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite* _add = _internal_mutable_field2()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field2)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& TestParsingMergeLite_RepeatedFieldsGenerator::field2() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field2)
+  return _internal_field2();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_field2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.field2_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_field2() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.field2_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite field3 = 3;
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_field3_size() const {
+  return _internal_field3().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::field3_size() const {
+  return _internal_field3_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_field3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.field3_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_field3(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field3)
+  return _internal_mutable_field3()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_field3()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field3)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_field3();
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator::field3(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field3)
+  return _internal_field3().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::add_field3() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite* _add = _internal_mutable_field3()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field3)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& TestParsingMergeLite_RepeatedFieldsGenerator::field3() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.field3)
+  return _internal_field3();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_field3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.field3_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_field3() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.field3_;
+}
+
+// repeated group Group1 = 10 { ... };
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_group1_size() const {
+  return _internal_group1().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::group1_size() const {
+  return _internal_group1_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_group1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.group1_.Clear();
+}
+inline ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_group1(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group1)
+  return _internal_mutable_group1()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_group1()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_group1();
+}
+inline const ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1& TestParsingMergeLite_RepeatedFieldsGenerator::group1(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group1)
+  return _internal_group1().Get(index);
+}
+inline ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1* TestParsingMergeLite_RepeatedFieldsGenerator::add_group1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1* _add = _internal_mutable_group1()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group1)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1>& TestParsingMergeLite_RepeatedFieldsGenerator::group1() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group1)
+  return _internal_group1();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_group1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.group1_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_group1() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.group1_;
+}
+
+// repeated group Group2 = 20 { ... };
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_group2_size() const {
+  return _internal_group2().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::group2_size() const {
+  return _internal_group2_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_group2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.group2_.Clear();
+}
+inline ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_group2(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group2)
+  return _internal_mutable_group2()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_group2()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_group2();
+}
+inline const ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2& TestParsingMergeLite_RepeatedFieldsGenerator::group2(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group2)
+  return _internal_group2().Get(index);
+}
+inline ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2* TestParsingMergeLite_RepeatedFieldsGenerator::add_group2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2* _add = _internal_mutable_group2()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group2)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2>& TestParsingMergeLite_RepeatedFieldsGenerator::group2() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.group2)
+  return _internal_group2();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_group2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.group2_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_group2() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.group2_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite ext1 = 1000;
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_ext1_size() const {
+  return _internal_ext1().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::ext1_size() const {
+  return _internal_ext1_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_ext1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.ext1_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_ext1(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext1)
+  return _internal_mutable_ext1()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_ext1()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_ext1();
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator::ext1(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext1)
+  return _internal_ext1().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::add_ext1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite* _add = _internal_mutable_ext1()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext1)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& TestParsingMergeLite_RepeatedFieldsGenerator::ext1() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext1)
+  return _internal_ext1();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_ext1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.ext1_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_ext1() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.ext1_;
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite ext2 = 1001;
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::_internal_ext2_size() const {
+  return _internal_ext2().size();
+}
+inline int TestParsingMergeLite_RepeatedFieldsGenerator::ext2_size() const {
+  return _internal_ext2_size();
+}
+inline void TestParsingMergeLite_RepeatedFieldsGenerator::clear_ext2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.ext2_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_ext2(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext2)
+  return _internal_mutable_ext2()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* TestParsingMergeLite_RepeatedFieldsGenerator::mutable_ext2()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_ext2();
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedFieldsGenerator::ext2(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext2)
+  return _internal_ext2().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedFieldsGenerator::add_ext2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite* _add = _internal_mutable_ext2()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext2)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& TestParsingMergeLite_RepeatedFieldsGenerator::ext2() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.ext2)
+  return _internal_ext2();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>&
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_ext2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.ext2_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>*
+TestParsingMergeLite_RepeatedFieldsGenerator::_internal_mutable_ext2() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.ext2_;
+}
+
+// -------------------------------------------------------------------
+
+// TestParsingMergeLite_OptionalGroup
+
+// optional .protobuf_unittest.TestAllTypesLite optional_group_all_types = 11;
+inline bool TestParsingMergeLite_OptionalGroup::has_optional_group_all_types() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_group_all_types_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite_OptionalGroup::clear_optional_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_group_all_types_ != nullptr) _impl_.optional_group_all_types_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_OptionalGroup::_internal_optional_group_all_types() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite* p = _impl_.optional_group_all_types_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_OptionalGroup::optional_group_all_types() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.OptionalGroup.optional_group_all_types)
+  return _internal_optional_group_all_types();
+}
+inline void TestParsingMergeLite_OptionalGroup::unsafe_arena_set_allocated_optional_group_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_group_all_types_);
+  }
+  _impl_.optional_group_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.OptionalGroup.optional_group_all_types)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_OptionalGroup::release_optional_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* released = _impl_.optional_group_all_types_;
+  _impl_.optional_group_all_types_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_OptionalGroup::unsafe_arena_release_optional_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.OptionalGroup.optional_group_all_types)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* temp = _impl_.optional_group_all_types_;
+  _impl_.optional_group_all_types_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_OptionalGroup::_internal_mutable_optional_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.optional_group_all_types_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+    _impl_.optional_group_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(p);
+  }
+  return _impl_.optional_group_all_types_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_OptionalGroup::mutable_optional_group_all_types() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_optional_group_all_types();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.OptionalGroup.optional_group_all_types)
+  return _msg;
+}
+inline void TestParsingMergeLite_OptionalGroup::set_allocated_optional_group_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(_impl_.optional_group_all_types_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.optional_group_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.OptionalGroup.optional_group_all_types)
+}
+
+// -------------------------------------------------------------------
+
+// TestParsingMergeLite_RepeatedGroup
+
+// optional .protobuf_unittest.TestAllTypesLite repeated_group_all_types = 21;
+inline bool TestParsingMergeLite_RepeatedGroup::has_repeated_group_all_types() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.repeated_group_all_types_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite_RepeatedGroup::clear_repeated_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.repeated_group_all_types_ != nullptr) _impl_.repeated_group_all_types_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedGroup::_internal_repeated_group_all_types() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite* p = _impl_.repeated_group_all_types_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite_RepeatedGroup::repeated_group_all_types() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.RepeatedGroup.repeated_group_all_types)
+  return _internal_repeated_group_all_types();
+}
+inline void TestParsingMergeLite_RepeatedGroup::unsafe_arena_set_allocated_repeated_group_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.repeated_group_all_types_);
+  }
+  _impl_.repeated_group_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.RepeatedGroup.repeated_group_all_types)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedGroup::release_repeated_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* released = _impl_.repeated_group_all_types_;
+  _impl_.repeated_group_all_types_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedGroup::unsafe_arena_release_repeated_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.RepeatedGroup.repeated_group_all_types)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* temp = _impl_.repeated_group_all_types_;
+  _impl_.repeated_group_all_types_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedGroup::_internal_mutable_repeated_group_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.repeated_group_all_types_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+    _impl_.repeated_group_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(p);
+  }
+  return _impl_.repeated_group_all_types_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite_RepeatedGroup::mutable_repeated_group_all_types() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_repeated_group_all_types();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.RepeatedGroup.repeated_group_all_types)
+  return _msg;
+}
+inline void TestParsingMergeLite_RepeatedGroup::set_allocated_repeated_group_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(_impl_.repeated_group_all_types_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.repeated_group_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.RepeatedGroup.repeated_group_all_types)
+}
+
+// -------------------------------------------------------------------
+
+// TestParsingMergeLite
+
+// required .protobuf_unittest.TestAllTypesLite required_all_types = 1;
+inline bool TestParsingMergeLite::has_required_all_types() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.required_all_types_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite::clear_required_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.required_all_types_ != nullptr) _impl_.required_all_types_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite::_internal_required_all_types() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite* p = _impl_.required_all_types_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite::required_all_types() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.required_all_types)
+  return _internal_required_all_types();
+}
+inline void TestParsingMergeLite::unsafe_arena_set_allocated_required_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.required_all_types_);
+  }
+  _impl_.required_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.required_all_types)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::release_required_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* released = _impl_.required_all_types_;
+  _impl_.required_all_types_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::unsafe_arena_release_required_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.required_all_types)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypesLite* temp = _impl_.required_all_types_;
+  _impl_.required_all_types_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::_internal_mutable_required_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.required_all_types_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+    _impl_.required_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(p);
+  }
+  return _impl_.required_all_types_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::mutable_required_all_types() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_required_all_types();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.required_all_types)
+  return _msg;
+}
+inline void TestParsingMergeLite::set_allocated_required_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(_impl_.required_all_types_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.required_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.required_all_types)
+}
+
+// optional .protobuf_unittest.TestAllTypesLite optional_all_types = 2;
+inline bool TestParsingMergeLite::has_optional_all_types() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_all_types_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite::clear_optional_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_all_types_ != nullptr) _impl_.optional_all_types_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite::_internal_optional_all_types() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypesLite* p = _impl_.optional_all_types_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite::optional_all_types() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.optional_all_types)
+  return _internal_optional_all_types();
+}
+inline void TestParsingMergeLite::unsafe_arena_set_allocated_optional_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_all_types_);
+  }
+  _impl_.optional_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.optional_all_types)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::release_optional_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::TestAllTypesLite* released = _impl_.optional_all_types_;
+  _impl_.optional_all_types_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::unsafe_arena_release_optional_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.optional_all_types)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::TestAllTypesLite* temp = _impl_.optional_all_types_;
+  _impl_.optional_all_types_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::_internal_mutable_optional_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.optional_all_types_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+    _impl_.optional_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(p);
+  }
+  return _impl_.optional_all_types_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::mutable_optional_all_types() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_optional_all_types();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.optional_all_types)
+  return _msg;
+}
+inline void TestParsingMergeLite::set_allocated_optional_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(_impl_.optional_all_types_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.optional_all_types_ = reinterpret_cast<::protobuf_unittest::TestAllTypesLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.optional_all_types)
+}
+
+// repeated .protobuf_unittest.TestAllTypesLite repeated_all_types = 3;
+inline int TestParsingMergeLite::_internal_repeated_all_types_size() const {
+  return _internal_repeated_all_types().size();
+}
+inline int TestParsingMergeLite::repeated_all_types_size() const {
+  return _internal_repeated_all_types_size();
+}
+inline void TestParsingMergeLite::clear_repeated_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_all_types_.Clear();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::mutable_repeated_all_types(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.repeated_all_types)
+  return _internal_mutable_repeated_all_types()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>* TestParsingMergeLite::mutable_repeated_all_types()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.repeated_all_types)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_all_types();
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestParsingMergeLite::repeated_all_types(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.repeated_all_types)
+  return _internal_repeated_all_types().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestParsingMergeLite::add_repeated_all_types() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypesLite* _add = _internal_mutable_repeated_all_types()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.repeated_all_types)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>& TestParsingMergeLite::repeated_all_types() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.repeated_all_types)
+  return _internal_repeated_all_types();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>&
+TestParsingMergeLite::_internal_repeated_all_types() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_all_types_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypesLite>*
+TestParsingMergeLite::_internal_mutable_repeated_all_types() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_all_types_;
+}
+
+// optional group OptionalGroup = 10 { ... };
+inline bool TestParsingMergeLite::has_optionalgroup() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optionalgroup_ != nullptr);
+  return value;
+}
+inline void TestParsingMergeLite::clear_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optionalgroup_ != nullptr) _impl_.optionalgroup_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup& TestParsingMergeLite::_internal_optionalgroup() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* p = _impl_.optionalgroup_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup&>(::protobuf_unittest::_TestParsingMergeLite_OptionalGroup_default_instance_);
+}
+inline const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup& TestParsingMergeLite::optionalgroup() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.optionalgroup)
+  return _internal_optionalgroup();
+}
+inline void TestParsingMergeLite::unsafe_arena_set_allocated_optionalgroup(::protobuf_unittest::TestParsingMergeLite_OptionalGroup* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optionalgroup_);
+  }
+  _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestParsingMergeLite_OptionalGroup*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestParsingMergeLite.optionalgroup)
+}
+inline ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* TestParsingMergeLite::release_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* released = _impl_.optionalgroup_;
+  _impl_.optionalgroup_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* TestParsingMergeLite::unsafe_arena_release_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestParsingMergeLite.optionalgroup)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* temp = _impl_.optionalgroup_;
+  _impl_.optionalgroup_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* TestParsingMergeLite::_internal_mutable_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.optionalgroup_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestParsingMergeLite_OptionalGroup>(GetArena());
+    _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestParsingMergeLite_OptionalGroup*>(p);
+  }
+  return _impl_.optionalgroup_;
+}
+inline ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* TestParsingMergeLite::mutable_optionalgroup() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* _msg = _internal_mutable_optionalgroup();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.optionalgroup)
+  return _msg;
+}
+inline void TestParsingMergeLite::set_allocated_optionalgroup(::protobuf_unittest::TestParsingMergeLite_OptionalGroup* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestParsingMergeLite_OptionalGroup*>(_impl_.optionalgroup_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestParsingMergeLite_OptionalGroup*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestParsingMergeLite_OptionalGroup*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestParsingMergeLite.optionalgroup)
+}
+
+// repeated group RepeatedGroup = 20 { ... };
+inline int TestParsingMergeLite::_internal_repeatedgroup_size() const {
+  return _internal_repeatedgroup().size();
+}
+inline int TestParsingMergeLite::repeatedgroup_size() const {
+  return _internal_repeatedgroup_size();
+}
+inline void TestParsingMergeLite::clear_repeatedgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeatedgroup_.Clear();
+}
+inline ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup* TestParsingMergeLite::mutable_repeatedgroup(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestParsingMergeLite.repeatedgroup)
+  return _internal_mutable_repeatedgroup()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedGroup>* TestParsingMergeLite::mutable_repeatedgroup()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestParsingMergeLite.repeatedgroup)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeatedgroup();
+}
+inline const ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup& TestParsingMergeLite::repeatedgroup(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestParsingMergeLite.repeatedgroup)
+  return _internal_repeatedgroup().Get(index);
+}
+inline ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup* TestParsingMergeLite::add_repeatedgroup() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup* _add = _internal_mutable_repeatedgroup()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestParsingMergeLite.repeatedgroup)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedGroup>& TestParsingMergeLite::repeatedgroup() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestParsingMergeLite.repeatedgroup)
+  return _internal_repeatedgroup();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedGroup>&
+TestParsingMergeLite::_internal_repeatedgroup() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeatedgroup_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestParsingMergeLite_RepeatedGroup>*
+TestParsingMergeLite::_internal_mutable_repeatedgroup() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeatedgroup_;
+}
+
+// -------------------------------------------------------------------
+
+// TestMergeExceptionLite
+
+// optional .protobuf_unittest.TestAllExtensionsLite all_extensions = 1;
+inline bool TestMergeExceptionLite::has_all_extensions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.all_extensions_ != nullptr);
+  return value;
+}
+inline void TestMergeExceptionLite::clear_all_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.all_extensions_ != nullptr) _impl_.all_extensions_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestAllExtensionsLite& TestMergeExceptionLite::_internal_all_extensions() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllExtensionsLite* p = _impl_.all_extensions_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllExtensionsLite&>(::protobuf_unittest::_TestAllExtensionsLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllExtensionsLite& TestMergeExceptionLite::all_extensions() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestMergeExceptionLite.all_extensions)
+  return _internal_all_extensions();
+}
+inline void TestMergeExceptionLite::unsafe_arena_set_allocated_all_extensions(::protobuf_unittest::TestAllExtensionsLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.all_extensions_);
+  }
+  _impl_.all_extensions_ = reinterpret_cast<::protobuf_unittest::TestAllExtensionsLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestMergeExceptionLite.all_extensions)
+}
+inline ::protobuf_unittest::TestAllExtensionsLite* TestMergeExceptionLite::release_all_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllExtensionsLite* released = _impl_.all_extensions_;
+  _impl_.all_extensions_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllExtensionsLite* TestMergeExceptionLite::unsafe_arena_release_all_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestMergeExceptionLite.all_extensions)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllExtensionsLite* temp = _impl_.all_extensions_;
+  _impl_.all_extensions_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllExtensionsLite* TestMergeExceptionLite::_internal_mutable_all_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.all_extensions_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllExtensionsLite>(GetArena());
+    _impl_.all_extensions_ = reinterpret_cast<::protobuf_unittest::TestAllExtensionsLite*>(p);
+  }
+  return _impl_.all_extensions_;
+}
+inline ::protobuf_unittest::TestAllExtensionsLite* TestMergeExceptionLite::mutable_all_extensions() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllExtensionsLite* _msg = _internal_mutable_all_extensions();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestMergeExceptionLite.all_extensions)
+  return _msg;
+}
+inline void TestMergeExceptionLite::set_allocated_all_extensions(::protobuf_unittest::TestAllExtensionsLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestAllExtensionsLite*>(_impl_.all_extensions_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestAllExtensionsLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.all_extensions_ = reinterpret_cast<::protobuf_unittest::TestAllExtensionsLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestMergeExceptionLite.all_extensions)
+}
+
+// -------------------------------------------------------------------
+
+// TestEmptyMessageLite
+
+// -------------------------------------------------------------------
+
+// TestEmptyMessageWithExtensionsLite
+
+// -------------------------------------------------------------------
+
+// V1MessageLite
+
+// required int32 int_field = 1;
+inline bool V1MessageLite::has_int_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void V1MessageLite::clear_int_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t V1MessageLite::int_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.V1MessageLite.int_field)
+  return _internal_int_field();
+}
+inline void V1MessageLite::set_int_field(::int32_t value) {
+  _internal_set_int_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.V1MessageLite.int_field)
+}
+inline ::int32_t V1MessageLite::_internal_int_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int_field_;
+}
+inline void V1MessageLite::_internal_set_int_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.int_field_ = value;
+}
+
+// optional .protobuf_unittest.V1EnumLite enum_field = 2 [default = V1_FIRST];
+inline bool V1MessageLite::has_enum_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void V1MessageLite::clear_enum_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.enum_field_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::protobuf_unittest::V1EnumLite V1MessageLite::enum_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.V1MessageLite.enum_field)
+  return _internal_enum_field();
+}
+inline void V1MessageLite::set_enum_field(::protobuf_unittest::V1EnumLite value) {
+  _internal_set_enum_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.V1MessageLite.enum_field)
+}
+inline ::protobuf_unittest::V1EnumLite V1MessageLite::_internal_enum_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::V1EnumLite>(_impl_.enum_field_);
+}
+inline void V1MessageLite::_internal_set_enum_field(::protobuf_unittest::V1EnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::V1EnumLite_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.enum_field_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// V2MessageLite
+
+// required int32 int_field = 1;
+inline bool V2MessageLite::has_int_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void V2MessageLite::clear_int_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t V2MessageLite::int_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.V2MessageLite.int_field)
+  return _internal_int_field();
+}
+inline void V2MessageLite::set_int_field(::int32_t value) {
+  _internal_set_int_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.V2MessageLite.int_field)
+}
+inline ::int32_t V2MessageLite::_internal_int_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int_field_;
+}
+inline void V2MessageLite::_internal_set_int_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.int_field_ = value;
+}
+
+// optional .protobuf_unittest.V2EnumLite enum_field = 2 [default = V2_FIRST];
+inline bool V2MessageLite::has_enum_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void V2MessageLite::clear_enum_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.enum_field_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::protobuf_unittest::V2EnumLite V2MessageLite::enum_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.V2MessageLite.enum_field)
+  return _internal_enum_field();
+}
+inline void V2MessageLite::set_enum_field(::protobuf_unittest::V2EnumLite value) {
+  _internal_set_enum_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.V2MessageLite.enum_field)
+}
+inline ::protobuf_unittest::V2EnumLite V2MessageLite::_internal_enum_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::V2EnumLite>(_impl_.enum_field_);
+}
+inline void V2MessageLite::_internal_set_enum_field(::protobuf_unittest::V2EnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::V2EnumLite_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.enum_field_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestHugeFieldNumbersLite_OptionalGroup
+
+// optional int32 group_a = 536870009;
+inline bool TestHugeFieldNumbersLite_OptionalGroup::has_group_a() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestHugeFieldNumbersLite_OptionalGroup::clear_group_a() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.group_a_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t TestHugeFieldNumbersLite_OptionalGroup::group_a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup.group_a)
+  return _internal_group_a();
+}
+inline void TestHugeFieldNumbersLite_OptionalGroup::set_group_a(::int32_t value) {
+  _internal_set_group_a(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup.group_a)
+}
+inline ::int32_t TestHugeFieldNumbersLite_OptionalGroup::_internal_group_a() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.group_a_;
+}
+inline void TestHugeFieldNumbersLite_OptionalGroup::_internal_set_group_a(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.group_a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestHugeFieldNumbersLite
+
+// optional int32 optional_int32 = 536870000;
+inline bool TestHugeFieldNumbersLite::has_optional_int32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_optional_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int32_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::int32_t TestHugeFieldNumbersLite::optional_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.optional_int32)
+  return _internal_optional_int32();
+}
+inline void TestHugeFieldNumbersLite::set_optional_int32(::int32_t value) {
+  _internal_set_optional_int32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.optional_int32)
+}
+inline ::int32_t TestHugeFieldNumbersLite::_internal_optional_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int32_;
+}
+inline void TestHugeFieldNumbersLite::_internal_set_optional_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.optional_int32_ = value;
+}
+
+// optional int32 fixed_32 = 536870001;
+inline bool TestHugeFieldNumbersLite::has_fixed_32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_fixed_32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.fixed_32_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::int32_t TestHugeFieldNumbersLite::fixed_32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.fixed_32)
+  return _internal_fixed_32();
+}
+inline void TestHugeFieldNumbersLite::set_fixed_32(::int32_t value) {
+  _internal_set_fixed_32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.fixed_32)
+}
+inline ::int32_t TestHugeFieldNumbersLite::_internal_fixed_32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.fixed_32_;
+}
+inline void TestHugeFieldNumbersLite::_internal_set_fixed_32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.fixed_32_ = value;
+}
+
+// repeated int32 repeated_int32 = 536870002 [packed = false];
+inline int TestHugeFieldNumbersLite::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int TestHugeFieldNumbersLite::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestHugeFieldNumbersLite::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t TestHugeFieldNumbersLite::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void TestHugeFieldNumbersLite::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.repeated_int32)
+}
+inline void TestHugeFieldNumbersLite::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestHugeFieldNumbersLite.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestHugeFieldNumbersLite::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestHugeFieldNumbersLite.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestHugeFieldNumbersLite::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestHugeFieldNumbersLite.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestHugeFieldNumbersLite::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestHugeFieldNumbersLite::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// repeated int32 packed_int32 = 536870003 [packed = true];
+inline int TestHugeFieldNumbersLite::_internal_packed_int32_size() const {
+  return _internal_packed_int32().size();
+}
+inline int TestHugeFieldNumbersLite::packed_int32_size() const {
+  return _internal_packed_int32_size();
+}
+inline void TestHugeFieldNumbersLite::clear_packed_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_int32_.Clear();
+}
+inline ::int32_t TestHugeFieldNumbersLite::packed_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.packed_int32)
+  return _internal_packed_int32().Get(index);
+}
+inline void TestHugeFieldNumbersLite::set_packed_int32(int index, ::int32_t value) {
+  _internal_mutable_packed_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.packed_int32)
+}
+inline void TestHugeFieldNumbersLite::add_packed_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestHugeFieldNumbersLite.packed_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestHugeFieldNumbersLite::packed_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestHugeFieldNumbersLite.packed_int32)
+  return _internal_packed_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestHugeFieldNumbersLite::mutable_packed_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestHugeFieldNumbersLite.packed_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestHugeFieldNumbersLite::_internal_packed_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestHugeFieldNumbersLite::_internal_mutable_packed_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_int32_;
+}
+
+// optional .protobuf_unittest.ForeignEnumLite optional_enum = 536870004;
+inline bool TestHugeFieldNumbersLite::has_optional_enum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_optional_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_enum_ = 4;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::protobuf_unittest::ForeignEnumLite TestHugeFieldNumbersLite::optional_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.optional_enum)
+  return _internal_optional_enum();
+}
+inline void TestHugeFieldNumbersLite::set_optional_enum(::protobuf_unittest::ForeignEnumLite value) {
+  _internal_set_optional_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.optional_enum)
+}
+inline ::protobuf_unittest::ForeignEnumLite TestHugeFieldNumbersLite::_internal_optional_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::protobuf_unittest::ForeignEnumLite>(_impl_.optional_enum_);
+}
+inline void TestHugeFieldNumbersLite::_internal_set_optional_enum(::protobuf_unittest::ForeignEnumLite value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.optional_enum_ = value;
+}
+
+// optional string optional_string = 536870005;
+inline bool TestHugeFieldNumbersLite::has_optional_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestHugeFieldNumbersLite::optional_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.optional_string)
+  return _internal_optional_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestHugeFieldNumbersLite::set_optional_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.optional_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.optional_string)
+}
+inline std::string* TestHugeFieldNumbersLite::mutable_optional_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.optional_string)
+  return _s;
+}
+inline const std::string& TestHugeFieldNumbersLite::_internal_optional_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_.Get();
+}
+inline void TestHugeFieldNumbersLite::_internal_set_optional_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.optional_string_.Set(value, GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::_internal_mutable_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.optional_string_.Mutable( GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::release_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.optional_string)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.optional_string_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.optional_string_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestHugeFieldNumbersLite::set_allocated_optional_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.optional_string_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_.IsDefault()) {
+          _impl_.optional_string_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.optional_string)
+}
+
+// optional bytes optional_bytes = 536870006;
+inline bool TestHugeFieldNumbersLite::has_optional_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bytes_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TestHugeFieldNumbersLite::optional_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.optional_bytes)
+  return _internal_optional_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestHugeFieldNumbersLite::set_optional_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.optional_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.optional_bytes)
+}
+inline std::string* TestHugeFieldNumbersLite::mutable_optional_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.optional_bytes)
+  return _s;
+}
+inline const std::string& TestHugeFieldNumbersLite::_internal_optional_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bytes_.Get();
+}
+inline void TestHugeFieldNumbersLite::_internal_set_optional_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.optional_bytes_.Set(value, GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::_internal_mutable_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.optional_bytes_.Mutable( GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::release_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.optional_bytes)
+  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* released = _impl_.optional_bytes_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.optional_bytes_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void TestHugeFieldNumbersLite::set_allocated_optional_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.optional_bytes_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_bytes_.IsDefault()) {
+          _impl_.optional_bytes_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.optional_bytes)
+}
+
+// optional .protobuf_unittest.ForeignMessageLite optional_message = 536870007;
+inline bool TestHugeFieldNumbersLite::has_optional_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_message_ != nullptr);
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_message_ != nullptr) _impl_.optional_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestHugeFieldNumbersLite::_internal_optional_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::ForeignMessageLite* p = _impl_.optional_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::ForeignMessageLite&>(::protobuf_unittest::_ForeignMessageLite_default_instance_);
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestHugeFieldNumbersLite::optional_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.optional_message)
+  return _internal_optional_message();
+}
+inline void TestHugeFieldNumbersLite::unsafe_arena_set_allocated_optional_message(::protobuf_unittest::ForeignMessageLite* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_message_);
+  }
+  _impl_.optional_message_ = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.optional_message)
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestHugeFieldNumbersLite::release_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest::ForeignMessageLite* released = _impl_.optional_message_;
+  _impl_.optional_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestHugeFieldNumbersLite::unsafe_arena_release_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.optional_message)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest::ForeignMessageLite* temp = _impl_.optional_message_;
+  _impl_.optional_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestHugeFieldNumbersLite::_internal_mutable_optional_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.optional_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::ForeignMessageLite>(GetArena());
+    _impl_.optional_message_ = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(p);
+  }
+  return _impl_.optional_message_;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestHugeFieldNumbersLite::mutable_optional_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::ForeignMessageLite* _msg = _internal_mutable_optional_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.optional_message)
+  return _msg;
+}
+inline void TestHugeFieldNumbersLite::set_allocated_optional_message(::protobuf_unittest::ForeignMessageLite* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(_impl_.optional_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.optional_message_ = reinterpret_cast<::protobuf_unittest::ForeignMessageLite*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.optional_message)
+}
+
+// optional group OptionalGroup = 536870008 { ... };
+inline bool TestHugeFieldNumbersLite::has_optionalgroup() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optionalgroup_ != nullptr);
+  return value;
+}
+inline void TestHugeFieldNumbersLite::clear_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optionalgroup_ != nullptr) _impl_.optionalgroup_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup& TestHugeFieldNumbersLite::_internal_optionalgroup() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* p = _impl_.optionalgroup_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup&>(::protobuf_unittest::_TestHugeFieldNumbersLite_OptionalGroup_default_instance_);
+}
+inline const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup& TestHugeFieldNumbersLite::optionalgroup() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.optionalgroup)
+  return _internal_optionalgroup();
+}
+inline void TestHugeFieldNumbersLite::unsafe_arena_set_allocated_optionalgroup(::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optionalgroup_);
+  }
+  _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.optionalgroup)
+}
+inline ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* TestHugeFieldNumbersLite::release_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* released = _impl_.optionalgroup_;
+  _impl_.optionalgroup_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* TestHugeFieldNumbersLite::unsafe_arena_release_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.optionalgroup)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* temp = _impl_.optionalgroup_;
+  _impl_.optionalgroup_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* TestHugeFieldNumbersLite::_internal_mutable_optionalgroup() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.optionalgroup_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup>(GetArena());
+    _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup*>(p);
+  }
+  return _impl_.optionalgroup_;
+}
+inline ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* TestHugeFieldNumbersLite::mutable_optionalgroup() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* _msg = _internal_mutable_optionalgroup();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.optionalgroup)
+  return _msg;
+}
+inline void TestHugeFieldNumbersLite::set_allocated_optionalgroup(::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup*>(_impl_.optionalgroup_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.optionalgroup_ = reinterpret_cast<::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.optionalgroup)
+}
+
+// map<string, string> string_string_map = 536870010;
+inline int TestHugeFieldNumbersLite::_internal_string_string_map_size() const {
+  return _internal_string_string_map().size();
+}
+inline int TestHugeFieldNumbersLite::string_string_map_size() const {
+  return _internal_string_string_map_size();
+}
+inline void TestHugeFieldNumbersLite::clear_string_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_string_map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& TestHugeFieldNumbersLite::_internal_string_string_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_string_map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& TestHugeFieldNumbersLite::string_string_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestHugeFieldNumbersLite.string_string_map)
+  return _internal_string_string_map();
+}
+inline ::google::protobuf::Map<std::string, std::string>* TestHugeFieldNumbersLite::_internal_mutable_string_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.string_string_map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, std::string>* TestHugeFieldNumbersLite::mutable_string_string_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestHugeFieldNumbersLite.string_string_map)
+  return _internal_mutable_string_string_map();
+}
+
+// uint32 oneof_uint32 = 536870011;
+inline bool TestHugeFieldNumbersLite::has_oneof_uint32() const {
+  return oneof_field_case() == kOneofUint32;
+}
+inline void TestHugeFieldNumbersLite::set_has_oneof_uint32() {
+  _impl_._oneof_case_[0] = kOneofUint32;
+}
+inline void TestHugeFieldNumbersLite::clear_oneof_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofUint32) {
+    _impl_.oneof_field_.oneof_uint32_ = 0u;
+    clear_has_oneof_field();
+  }
+}
+inline ::uint32_t TestHugeFieldNumbersLite::oneof_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.oneof_uint32)
+  return _internal_oneof_uint32();
+}
+inline void TestHugeFieldNumbersLite::set_oneof_uint32(::uint32_t value) {
+  _internal_set_oneof_uint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.oneof_uint32)
+}
+inline ::uint32_t TestHugeFieldNumbersLite::_internal_oneof_uint32() const {
+  if (oneof_field_case() == kOneofUint32) {
+    return _impl_.oneof_field_.oneof_uint32_;
+  }
+  return 0u;
+}
+inline void TestHugeFieldNumbersLite::_internal_set_oneof_uint32(::uint32_t value) {
+  if (oneof_field_case() != kOneofUint32) {
+    clear_oneof_field();
+    set_has_oneof_uint32();
+  }
+  _impl_.oneof_field_.oneof_uint32_ = value;
+}
+
+// .protobuf_unittest.TestAllTypesLite oneof_test_all_types = 536870012;
+inline bool TestHugeFieldNumbersLite::has_oneof_test_all_types() const {
+  return oneof_field_case() == kOneofTestAllTypes;
+}
+inline bool TestHugeFieldNumbersLite::_internal_has_oneof_test_all_types() const {
+  return oneof_field_case() == kOneofTestAllTypes;
+}
+inline void TestHugeFieldNumbersLite::set_has_oneof_test_all_types() {
+  _impl_._oneof_case_[0] = kOneofTestAllTypes;
+}
+inline void TestHugeFieldNumbersLite::clear_oneof_test_all_types() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofTestAllTypes) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_test_all_types_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestHugeFieldNumbersLite::release_oneof_test_all_types() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.oneof_test_all_types)
+  if (oneof_field_case() == kOneofTestAllTypes) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_test_all_types_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_test_all_types_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestHugeFieldNumbersLite::_internal_oneof_test_all_types() const {
+  return oneof_field_case() == kOneofTestAllTypes ? *_impl_.oneof_field_.oneof_test_all_types_ : reinterpret_cast<::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestHugeFieldNumbersLite::oneof_test_all_types() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.oneof_test_all_types)
+  return _internal_oneof_test_all_types();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestHugeFieldNumbersLite::unsafe_arena_release_oneof_test_all_types() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestHugeFieldNumbersLite.oneof_test_all_types)
+  if (oneof_field_case() == kOneofTestAllTypes) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_test_all_types_;
+    _impl_.oneof_field_.oneof_test_all_types_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestHugeFieldNumbersLite::unsafe_arena_set_allocated_oneof_test_all_types(::protobuf_unittest::TestAllTypesLite* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_test_all_types();
+    _impl_.oneof_field_.oneof_test_all_types_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.oneof_test_all_types)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestHugeFieldNumbersLite::_internal_mutable_oneof_test_all_types() {
+  if (oneof_field_case() != kOneofTestAllTypes) {
+    clear_oneof_field();
+    set_has_oneof_test_all_types();
+    _impl_.oneof_field_.oneof_test_all_types_ = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_test_all_types_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestHugeFieldNumbersLite::mutable_oneof_test_all_types() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_oneof_test_all_types();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.oneof_test_all_types)
+  return _msg;
+}
+
+// string oneof_string = 536870013;
+inline bool TestHugeFieldNumbersLite::has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline void TestHugeFieldNumbersLite::set_has_oneof_string() {
+  _impl_._oneof_case_[0] = kOneofString;
+}
+inline void TestHugeFieldNumbersLite::clear_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofString) {
+    _impl_.oneof_field_.oneof_string_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestHugeFieldNumbersLite::oneof_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.oneof_string)
+  return _internal_oneof_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestHugeFieldNumbersLite::set_oneof_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.oneof_string)
+}
+inline std::string* TestHugeFieldNumbersLite::mutable_oneof_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.oneof_string)
+  return _s;
+}
+inline const std::string& TestHugeFieldNumbersLite::_internal_oneof_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_string_.Get();
+}
+inline void TestHugeFieldNumbersLite::_internal_set_oneof_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(value, GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::_internal_mutable_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_.Mutable( GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::release_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.oneof_string)
+  if (oneof_field_case() != kOneofString) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_.Release();
+}
+inline void TestHugeFieldNumbersLite::set_allocated_oneof_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.oneof_string)
+}
+
+// bytes oneof_bytes = 536870014;
+inline bool TestHugeFieldNumbersLite::has_oneof_bytes() const {
+  return oneof_field_case() == kOneofBytes;
+}
+inline void TestHugeFieldNumbersLite::set_has_oneof_bytes() {
+  _impl_._oneof_case_[0] = kOneofBytes;
+}
+inline void TestHugeFieldNumbersLite::clear_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofBytes) {
+    _impl_.oneof_field_.oneof_bytes_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestHugeFieldNumbersLite::oneof_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestHugeFieldNumbersLite.oneof_bytes)
+  return _internal_oneof_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestHugeFieldNumbersLite::set_oneof_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestHugeFieldNumbersLite.oneof_bytes)
+}
+inline std::string* TestHugeFieldNumbersLite::mutable_oneof_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestHugeFieldNumbersLite.oneof_bytes)
+  return _s;
+}
+inline const std::string& TestHugeFieldNumbersLite::_internal_oneof_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Get();
+}
+inline void TestHugeFieldNumbersLite::_internal_set_oneof_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.Set(value, GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::_internal_mutable_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Mutable( GetArena());
+}
+inline std::string* TestHugeFieldNumbersLite::release_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestHugeFieldNumbersLite.oneof_bytes)
+  if (oneof_field_case() != kOneofBytes) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_bytes_.Release();
+}
+inline void TestHugeFieldNumbersLite::set_allocated_oneof_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.oneof_bytes)
+}
+
+inline bool TestHugeFieldNumbersLite::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestHugeFieldNumbersLite::clear_has_oneof_field() {
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestHugeFieldNumbersLite::OneofFieldCase TestHugeFieldNumbersLite::oneof_field_case() const {
+  return TestHugeFieldNumbersLite::OneofFieldCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TestOneofParsingLite
+
+// int32 oneof_int32 = 1;
+inline bool TestOneofParsingLite::has_oneof_int32() const {
+  return oneof_field_case() == kOneofInt32;
+}
+inline void TestOneofParsingLite::set_has_oneof_int32() {
+  _impl_._oneof_case_[0] = kOneofInt32;
+}
+inline void TestOneofParsingLite::clear_oneof_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofInt32) {
+    _impl_.oneof_field_.oneof_int32_ = 0;
+    clear_has_oneof_field();
+  }
+}
+inline ::int32_t TestOneofParsingLite::oneof_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_int32)
+  return _internal_oneof_int32();
+}
+inline void TestOneofParsingLite::set_oneof_int32(::int32_t value) {
+  _internal_set_oneof_int32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_int32)
+}
+inline ::int32_t TestOneofParsingLite::_internal_oneof_int32() const {
+  if (oneof_field_case() == kOneofInt32) {
+    return _impl_.oneof_field_.oneof_int32_;
+  }
+  return 0;
+}
+inline void TestOneofParsingLite::_internal_set_oneof_int32(::int32_t value) {
+  if (oneof_field_case() != kOneofInt32) {
+    clear_oneof_field();
+    set_has_oneof_int32();
+  }
+  _impl_.oneof_field_.oneof_int32_ = value;
+}
+
+// .protobuf_unittest.TestAllTypesLite oneof_submessage = 2;
+inline bool TestOneofParsingLite::has_oneof_submessage() const {
+  return oneof_field_case() == kOneofSubmessage;
+}
+inline bool TestOneofParsingLite::_internal_has_oneof_submessage() const {
+  return oneof_field_case() == kOneofSubmessage;
+}
+inline void TestOneofParsingLite::set_has_oneof_submessage() {
+  _impl_._oneof_case_[0] = kOneofSubmessage;
+}
+inline void TestOneofParsingLite::clear_oneof_submessage() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofSubmessage) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_submessage_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestOneofParsingLite::release_oneof_submessage() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOneofParsingLite.oneof_submessage)
+  if (oneof_field_case() == kOneofSubmessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_submessage_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_submessage_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestOneofParsingLite::_internal_oneof_submessage() const {
+  return oneof_field_case() == kOneofSubmessage ? *_impl_.oneof_field_.oneof_submessage_ : reinterpret_cast<::protobuf_unittest::TestAllTypesLite&>(::protobuf_unittest::_TestAllTypesLite_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypesLite& TestOneofParsingLite::oneof_submessage() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_submessage)
+  return _internal_oneof_submessage();
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestOneofParsingLite::unsafe_arena_release_oneof_submessage() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestOneofParsingLite.oneof_submessage)
+  if (oneof_field_case() == kOneofSubmessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_submessage_;
+    _impl_.oneof_field_.oneof_submessage_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestOneofParsingLite::unsafe_arena_set_allocated_oneof_submessage(::protobuf_unittest::TestAllTypesLite* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_submessage();
+    _impl_.oneof_field_.oneof_submessage_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_submessage)
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestOneofParsingLite::_internal_mutable_oneof_submessage() {
+  if (oneof_field_case() != kOneofSubmessage) {
+    clear_oneof_field();
+    set_has_oneof_submessage();
+    _impl_.oneof_field_.oneof_submessage_ = CreateMaybeMessage<::protobuf_unittest::TestAllTypesLite>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_submessage_;
+}
+inline ::protobuf_unittest::TestAllTypesLite* TestOneofParsingLite::mutable_oneof_submessage() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypesLite* _msg = _internal_mutable_oneof_submessage();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOneofParsingLite.oneof_submessage)
+  return _msg;
+}
+
+// string oneof_string = 3;
+inline bool TestOneofParsingLite::has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline void TestOneofParsingLite::set_has_oneof_string() {
+  _impl_._oneof_case_[0] = kOneofString;
+}
+inline void TestOneofParsingLite::clear_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofString) {
+    _impl_.oneof_field_.oneof_string_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestOneofParsingLite::oneof_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_string)
+  return _internal_oneof_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneofParsingLite::set_oneof_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_string)
+}
+inline std::string* TestOneofParsingLite::mutable_oneof_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOneofParsingLite.oneof_string)
+  return _s;
+}
+inline const std::string& TestOneofParsingLite::_internal_oneof_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_string_.Get();
+}
+inline void TestOneofParsingLite::_internal_set_oneof_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(value, GetArena());
+}
+inline std::string* TestOneofParsingLite::_internal_mutable_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_.Mutable( GetArena());
+}
+inline std::string* TestOneofParsingLite::release_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOneofParsingLite.oneof_string)
+  if (oneof_field_case() != kOneofString) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_.Release();
+}
+inline void TestOneofParsingLite::set_allocated_oneof_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_string)
+}
+
+// bytes oneof_bytes = 4 [default = "default bytes"];
+inline bool TestOneofParsingLite::has_oneof_bytes() const {
+  return oneof_field_case() == kOneofBytes;
+}
+inline void TestOneofParsingLite::set_has_oneof_bytes() {
+  _impl_._oneof_case_[0] = kOneofBytes;
+}
+inline void TestOneofParsingLite::clear_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofBytes) {
+    _impl_.oneof_field_.oneof_bytes_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestOneofParsingLite::oneof_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_bytes)
+  return _internal_oneof_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneofParsingLite::set_oneof_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_bytes)
+}
+inline std::string* TestOneofParsingLite::mutable_oneof_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOneofParsingLite.oneof_bytes)
+  return _s;
+}
+inline const std::string& TestOneofParsingLite::_internal_oneof_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    return ::protobuf_unittest::TestOneofParsingLite::Impl_::_i_give_permission_to_break_this_code_default_oneof_bytes_.get();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Get();
+}
+inline void TestOneofParsingLite::_internal_set_oneof_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.Set(value, GetArena());
+}
+inline std::string* TestOneofParsingLite::_internal_mutable_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Mutable(::protobuf_unittest::TestOneofParsingLite::Impl_::_i_give_permission_to_break_this_code_default_oneof_bytes_, GetArena());
+}
+inline std::string* TestOneofParsingLite::release_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOneofParsingLite.oneof_bytes)
+  if (oneof_field_case() != kOneofBytes) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_bytes_.Release();
+}
+inline void TestOneofParsingLite::set_allocated_oneof_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_bytes)
+}
+
+// string oneof_string_cord = 5 [default = "default Cord", ctype = CORD];
+inline bool TestOneofParsingLite::has_oneof_string_cord() const {
+  return oneof_field_case() == kOneofStringCord;
+}
+inline void TestOneofParsingLite::set_has_oneof_string_cord() {
+  _impl_._oneof_case_[0] = kOneofStringCord;
+}
+inline void TestOneofParsingLite::clear_oneof_string_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofStringCord) {
+    _impl_.oneof_field_.oneof_string_cord_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestOneofParsingLite::oneof_string_cord() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_string_cord)
+  return _internal_oneof_string_cord();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneofParsingLite::set_oneof_string_cord(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringCord) {
+    clear_oneof_field();
+
+    set_has_oneof_string_cord();
+    _impl_.oneof_field_.oneof_string_cord_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_cord_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_string_cord)
+}
+inline std::string* TestOneofParsingLite::mutable_oneof_string_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string_cord();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOneofParsingLite.oneof_string_cord)
+  return _s;
+}
+inline const std::string& TestOneofParsingLite::_internal_oneof_string_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringCord) {
+    return ::protobuf_unittest::TestOneofParsingLite::Impl_::_i_give_permission_to_break_this_code_default_oneof_string_cord_.get();
+  }
+  return _impl_.oneof_field_.oneof_string_cord_.Get();
+}
+inline void TestOneofParsingLite::_internal_set_oneof_string_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringCord) {
+    clear_oneof_field();
+
+    set_has_oneof_string_cord();
+    _impl_.oneof_field_.oneof_string_cord_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_cord_.Set(value, GetArena());
+}
+inline std::string* TestOneofParsingLite::_internal_mutable_oneof_string_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringCord) {
+    clear_oneof_field();
+
+    set_has_oneof_string_cord();
+    _impl_.oneof_field_.oneof_string_cord_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_cord_.Mutable(::protobuf_unittest::TestOneofParsingLite::Impl_::_i_give_permission_to_break_this_code_default_oneof_string_cord_, GetArena());
+}
+inline std::string* TestOneofParsingLite::release_oneof_string_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOneofParsingLite.oneof_string_cord)
+  if (oneof_field_case() != kOneofStringCord) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_cord_.Release();
+}
+inline void TestOneofParsingLite::set_allocated_oneof_string_cord(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string_cord();
+    _impl_.oneof_field_.oneof_string_cord_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_string_cord)
+}
+
+// bytes oneof_bytes_cord = 6 [ctype = CORD];
+inline bool TestOneofParsingLite::has_oneof_bytes_cord() const {
+  return oneof_field_case() == kOneofBytesCord;
+}
+inline void TestOneofParsingLite::set_has_oneof_bytes_cord() {
+  _impl_._oneof_case_[0] = kOneofBytesCord;
+}
+inline void TestOneofParsingLite::clear_oneof_bytes_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofBytesCord) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_bytes_cord_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline const ::absl::Cord& TestOneofParsingLite::_internal_oneof_bytes_cord() const {
+  if (oneof_field_case() == kOneofBytesCord) {
+    return *_impl_.oneof_field_.oneof_bytes_cord_;
+  }
+  return ::google::protobuf::internal::GetEmptyCordAlreadyInited();
+}
+inline const ::absl::Cord& TestOneofParsingLite::oneof_bytes_cord() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_bytes_cord)
+  return _internal_oneof_bytes_cord();
+}
+inline void TestOneofParsingLite::_internal_set_oneof_bytes_cord(const ::absl::Cord& value) {
+  if (oneof_field_case() != kOneofBytesCord) {
+    clear_oneof_field();
+    set_has_oneof_bytes_cord();
+    _impl_.oneof_field_.oneof_bytes_cord_ = new ::absl::Cord;
+    if (GetArena() != nullptr) {
+      GetArena()->Own(_impl_.oneof_field_.oneof_bytes_cord_);
+    }
+  }
+  *_impl_.oneof_field_.oneof_bytes_cord_ = value;
+}
+inline void TestOneofParsingLite::set_oneof_bytes_cord(const ::absl::Cord& value) {
+  _internal_set_oneof_bytes_cord(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_bytes_cord)
+}
+inline void TestOneofParsingLite::set_oneof_bytes_cord(::absl::string_view value) {
+  if (oneof_field_case() != kOneofBytesCord) {
+    clear_oneof_field();
+    set_has_oneof_bytes_cord();
+    _impl_.oneof_field_.oneof_bytes_cord_ = new ::absl::Cord;
+    if (GetArena() != nullptr) {
+      GetArena()->Own(_impl_.oneof_field_.oneof_bytes_cord_);
+    }
+  }
+  *_impl_.oneof_field_.oneof_bytes_cord_ = value;
+  // @@protoc_insertion_point(field_set_string_piece:protobuf_unittest.TestOneofParsingLite.oneof_bytes_cord)
+}
+inline ::absl::Cord* TestOneofParsingLite::_internal_mutable_oneof_bytes_cord() {
+  if (oneof_field_case() != kOneofBytesCord) {
+    clear_oneof_field();
+    set_has_oneof_bytes_cord();
+    _impl_.oneof_field_.oneof_bytes_cord_ = new ::absl::Cord;
+    if (GetArena() != nullptr) {
+      GetArena()->Own(_impl_.oneof_field_.oneof_bytes_cord_);
+    }
+  }
+  return _impl_.oneof_field_.oneof_bytes_cord_;
+}
+
+// string oneof_string_string_piece = 7 [ctype = STRING_PIECE];
+inline bool TestOneofParsingLite::has_oneof_string_string_piece() const {
+  return oneof_field_case() == kOneofStringStringPiece;
+}
+inline void TestOneofParsingLite::set_has_oneof_string_string_piece() {
+  _impl_._oneof_case_[0] = kOneofStringStringPiece;
+}
+inline void TestOneofParsingLite::clear_oneof_string_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofStringStringPiece) {
+    _impl_.oneof_field_.oneof_string_string_piece_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestOneofParsingLite::oneof_string_string_piece() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_string_string_piece)
+  return _internal_oneof_string_string_piece();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneofParsingLite::set_oneof_string_string_piece(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringStringPiece) {
+    clear_oneof_field();
+
+    set_has_oneof_string_string_piece();
+    _impl_.oneof_field_.oneof_string_string_piece_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_string_piece_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_string_string_piece)
+}
+inline std::string* TestOneofParsingLite::mutable_oneof_string_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string_string_piece();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOneofParsingLite.oneof_string_string_piece)
+  return _s;
+}
+inline const std::string& TestOneofParsingLite::_internal_oneof_string_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringStringPiece) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_string_string_piece_.Get();
+}
+inline void TestOneofParsingLite::_internal_set_oneof_string_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringStringPiece) {
+    clear_oneof_field();
+
+    set_has_oneof_string_string_piece();
+    _impl_.oneof_field_.oneof_string_string_piece_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_string_piece_.Set(value, GetArena());
+}
+inline std::string* TestOneofParsingLite::_internal_mutable_oneof_string_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofStringStringPiece) {
+    clear_oneof_field();
+
+    set_has_oneof_string_string_piece();
+    _impl_.oneof_field_.oneof_string_string_piece_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_string_piece_.Mutable( GetArena());
+}
+inline std::string* TestOneofParsingLite::release_oneof_string_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOneofParsingLite.oneof_string_string_piece)
+  if (oneof_field_case() != kOneofStringStringPiece) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_string_piece_.Release();
+}
+inline void TestOneofParsingLite::set_allocated_oneof_string_string_piece(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string_string_piece();
+    _impl_.oneof_field_.oneof_string_string_piece_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_string_string_piece)
+}
+
+// bytes oneof_bytes_string_piece = 8 [default = "default StringPiece", ctype = STRING_PIECE];
+inline bool TestOneofParsingLite::has_oneof_bytes_string_piece() const {
+  return oneof_field_case() == kOneofBytesStringPiece;
+}
+inline void TestOneofParsingLite::set_has_oneof_bytes_string_piece() {
+  _impl_._oneof_case_[0] = kOneofBytesStringPiece;
+}
+inline void TestOneofParsingLite::clear_oneof_bytes_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofBytesStringPiece) {
+    _impl_.oneof_field_.oneof_bytes_string_piece_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestOneofParsingLite::oneof_bytes_string_piece() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_bytes_string_piece)
+  return _internal_oneof_bytes_string_piece();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneofParsingLite::set_oneof_bytes_string_piece(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytesStringPiece) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes_string_piece();
+    _impl_.oneof_field_.oneof_bytes_string_piece_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_string_piece_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_bytes_string_piece)
+}
+inline std::string* TestOneofParsingLite::mutable_oneof_bytes_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_bytes_string_piece();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOneofParsingLite.oneof_bytes_string_piece)
+  return _s;
+}
+inline const std::string& TestOneofParsingLite::_internal_oneof_bytes_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytesStringPiece) {
+    return ::protobuf_unittest::TestOneofParsingLite::Impl_::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_.get();
+  }
+  return _impl_.oneof_field_.oneof_bytes_string_piece_.Get();
+}
+inline void TestOneofParsingLite::_internal_set_oneof_bytes_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytesStringPiece) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes_string_piece();
+    _impl_.oneof_field_.oneof_bytes_string_piece_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_string_piece_.Set(value, GetArena());
+}
+inline std::string* TestOneofParsingLite::_internal_mutable_oneof_bytes_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytesStringPiece) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes_string_piece();
+    _impl_.oneof_field_.oneof_bytes_string_piece_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_bytes_string_piece_.Mutable(::protobuf_unittest::TestOneofParsingLite::Impl_::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_, GetArena());
+}
+inline std::string* TestOneofParsingLite::release_oneof_bytes_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOneofParsingLite.oneof_bytes_string_piece)
+  if (oneof_field_case() != kOneofBytesStringPiece) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_bytes_string_piece_.Release();
+}
+inline void TestOneofParsingLite::set_allocated_oneof_bytes_string_piece(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_bytes_string_piece();
+    _impl_.oneof_field_.oneof_bytes_string_piece_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_bytes_string_piece)
+}
+
+// .protobuf_unittest.V2EnumLite oneof_enum = 9;
+inline bool TestOneofParsingLite::has_oneof_enum() const {
+  return oneof_field_case() == kOneofEnum;
+}
+inline void TestOneofParsingLite::set_has_oneof_enum() {
+  _impl_._oneof_case_[0] = kOneofEnum;
+}
+inline void TestOneofParsingLite::clear_oneof_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofEnum) {
+    _impl_.oneof_field_.oneof_enum_ = 1;
+    clear_has_oneof_field();
+  }
+}
+inline ::protobuf_unittest::V2EnumLite TestOneofParsingLite::oneof_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOneofParsingLite.oneof_enum)
+  return _internal_oneof_enum();
+}
+inline void TestOneofParsingLite::set_oneof_enum(::protobuf_unittest::V2EnumLite value) {
+  _internal_set_oneof_enum(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOneofParsingLite.oneof_enum)
+}
+inline ::protobuf_unittest::V2EnumLite TestOneofParsingLite::_internal_oneof_enum() const {
+  if (oneof_field_case() == kOneofEnum) {
+    return static_cast<::protobuf_unittest::V2EnumLite>(_impl_.oneof_field_.oneof_enum_);
+  }
+  return static_cast<::protobuf_unittest::V2EnumLite>(1);
+}
+inline void TestOneofParsingLite::_internal_set_oneof_enum(::protobuf_unittest::V2EnumLite value) {
+  assert(::protobuf_unittest::V2EnumLite_IsValid(value));
+  if (oneof_field_case() != kOneofEnum) {
+    clear_oneof_field();
+    set_has_oneof_enum();
+  }
+  _impl_.oneof_field_.oneof_enum_ = value;
+}
+
+inline bool TestOneofParsingLite::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestOneofParsingLite::clear_has_oneof_field() {
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestOneofParsingLite::OneofFieldCase TestOneofParsingLite::oneof_field_case() const {
+  return TestOneofParsingLite::OneofFieldCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TestMessageSetLite
+
+// -------------------------------------------------------------------
+
+// PackedInt32
+
+// repeated int32 repeated_int32 = 2048 [packed = true];
+inline int PackedInt32::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int PackedInt32::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void PackedInt32::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t PackedInt32::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.PackedInt32.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void PackedInt32::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.PackedInt32.repeated_int32)
+}
+inline void PackedInt32::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.PackedInt32.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& PackedInt32::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.PackedInt32.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PackedInt32::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.PackedInt32.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& PackedInt32::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PackedInt32::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// -------------------------------------------------------------------
+
+// NonPackedInt32
+
+// repeated int32 repeated_int32 = 2048;
+inline int NonPackedInt32::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int NonPackedInt32::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void NonPackedInt32::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t NonPackedInt32::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.NonPackedInt32.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void NonPackedInt32::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.NonPackedInt32.repeated_int32)
+}
+inline void NonPackedInt32::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.NonPackedInt32.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& NonPackedInt32::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.NonPackedInt32.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* NonPackedInt32::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.NonPackedInt32.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& NonPackedInt32::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* NonPackedInt32::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// -------------------------------------------------------------------
+
+// PackedFixed32
+
+// repeated fixed32 repeated_fixed32 = 2048 [packed = true];
+inline int PackedFixed32::_internal_repeated_fixed32_size() const {
+  return _internal_repeated_fixed32().size();
+}
+inline int PackedFixed32::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void PackedFixed32::clear_repeated_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed32_.Clear();
+}
+inline ::uint32_t PackedFixed32::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.PackedFixed32.repeated_fixed32)
+  return _internal_repeated_fixed32().Get(index);
+}
+inline void PackedFixed32::set_repeated_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.PackedFixed32.repeated_fixed32)
+}
+inline void PackedFixed32::add_repeated_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.PackedFixed32.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& PackedFixed32::repeated_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.PackedFixed32.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* PackedFixed32::mutable_repeated_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.PackedFixed32.repeated_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& PackedFixed32::_internal_repeated_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* PackedFixed32::_internal_mutable_repeated_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed32_;
+}
+
+// -------------------------------------------------------------------
+
+// NonPackedFixed32
+
+// repeated fixed32 repeated_fixed32 = 2048;
+inline int NonPackedFixed32::_internal_repeated_fixed32_size() const {
+  return _internal_repeated_fixed32().size();
+}
+inline int NonPackedFixed32::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void NonPackedFixed32::clear_repeated_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed32_.Clear();
+}
+inline ::uint32_t NonPackedFixed32::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.NonPackedFixed32.repeated_fixed32)
+  return _internal_repeated_fixed32().Get(index);
+}
+inline void NonPackedFixed32::set_repeated_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.NonPackedFixed32.repeated_fixed32)
+}
+inline void NonPackedFixed32::add_repeated_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.NonPackedFixed32.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& NonPackedFixed32::repeated_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.NonPackedFixed32.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* NonPackedFixed32::mutable_repeated_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.NonPackedFixed32.repeated_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& NonPackedFixed32::_internal_repeated_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* NonPackedFixed32::_internal_mutable_repeated_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed32_;
+}
+
+// -------------------------------------------------------------------
+
+// DupEnum
+
+// -------------------------------------------------------------------
+
+// RecursiveMessage
+
+// optional .protobuf_unittest.RecursiveMessage recurse = 1;
+inline bool RecursiveMessage::has_recurse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.recurse_ != nullptr);
+  return value;
+}
+inline void RecursiveMessage::clear_recurse() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.recurse_ != nullptr) _impl_.recurse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::protobuf_unittest::RecursiveMessage& RecursiveMessage::_internal_recurse() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::RecursiveMessage* p = _impl_.recurse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::RecursiveMessage&>(::protobuf_unittest::_RecursiveMessage_default_instance_);
+}
+inline const ::protobuf_unittest::RecursiveMessage& RecursiveMessage::recurse() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RecursiveMessage.recurse)
+  return _internal_recurse();
+}
+inline void RecursiveMessage::unsafe_arena_set_allocated_recurse(::protobuf_unittest::RecursiveMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.recurse_);
+  }
+  _impl_.recurse_ = reinterpret_cast<::protobuf_unittest::RecursiveMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.RecursiveMessage.recurse)
+}
+inline ::protobuf_unittest::RecursiveMessage* RecursiveMessage::release_recurse() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::RecursiveMessage* released = _impl_.recurse_;
+  _impl_.recurse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::RecursiveMessage* RecursiveMessage::unsafe_arena_release_recurse() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.RecursiveMessage.recurse)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::RecursiveMessage* temp = _impl_.recurse_;
+  _impl_.recurse_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::RecursiveMessage* RecursiveMessage::_internal_mutable_recurse() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.recurse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::RecursiveMessage>(GetArena());
+    _impl_.recurse_ = reinterpret_cast<::protobuf_unittest::RecursiveMessage*>(p);
+  }
+  return _impl_.recurse_;
+}
+inline ::protobuf_unittest::RecursiveMessage* RecursiveMessage::mutable_recurse() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::RecursiveMessage* _msg = _internal_mutable_recurse();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RecursiveMessage.recurse)
+  return _msg;
+}
+inline void RecursiveMessage::set_allocated_recurse(::protobuf_unittest::RecursiveMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::RecursiveMessage*>(_impl_.recurse_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::RecursiveMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.recurse_ = reinterpret_cast<::protobuf_unittest::RecursiveMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.RecursiveMessage.recurse)
+}
+
+// optional bytes payload = 2;
+inline bool RecursiveMessage::has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void RecursiveMessage::clear_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& RecursiveMessage::payload() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RecursiveMessage.payload)
+  return _internal_payload();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void RecursiveMessage::set_payload(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.RecursiveMessage.payload)
+}
+inline std::string* RecursiveMessage::mutable_payload() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RecursiveMessage.payload)
+  return _s;
+}
+inline const std::string& RecursiveMessage::_internal_payload() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.payload_.Get();
+}
+inline void RecursiveMessage::_internal_set_payload(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.Set(value, GetArena());
+}
+inline std::string* RecursiveMessage::_internal_mutable_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.payload_.Mutable( GetArena());
+}
+inline std::string* RecursiveMessage::release_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.RecursiveMessage.payload)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.payload_.Release();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.payload_.Set("", GetArena());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return released;
+}
+inline void RecursiveMessage::set_allocated_payload(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.payload_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.payload_.IsDefault()) {
+          _impl_.payload_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.RecursiveMessage.payload)
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::protobuf_unittest::TestAllTypesLite_NestedEnum> : std::true_type {};
+template <>
+struct is_proto_enum<::protobuf_unittest::DupEnum_TestEnumWithDupValueLite> : std::true_type {};
+template <>
+struct is_proto_enum<::protobuf_unittest::ForeignEnumLite> : std::true_type {};
+template <>
+struct is_proto_enum<::protobuf_unittest::V1EnumLite> : std::true_type {};
+template <>
+struct is_proto_enum<::protobuf_unittest::V2EnumLite> : std::true_type {};
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5flite_2eproto_2epb_2eh
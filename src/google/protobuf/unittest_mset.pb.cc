@@ -0,0 +1,2411 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_mset.proto
+
+#include "google/protobuf/unittest_mset.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+
+inline constexpr TestMessageSetExtension2::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        str_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageSetExtension2::TestMessageSetExtension2(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageSetExtension2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageSetExtension2DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageSetExtension2DefaultTypeInternal() {}
+  union {
+    TestMessageSetExtension2 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageSetExtension2DefaultTypeInternal _TestMessageSetExtension2_default_instance_;
+
+inline constexpr RawMessageSet_Item::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        message_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        type_id_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RawMessageSet_Item::RawMessageSet_Item(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct RawMessageSet_ItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RawMessageSet_ItemDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RawMessageSet_ItemDefaultTypeInternal() {}
+  union {
+    RawMessageSet_Item _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RawMessageSet_ItemDefaultTypeInternal _RawMessageSet_Item_default_instance_;
+
+inline constexpr NestedTestInt::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        child_{nullptr},
+        a_{0u},
+        b_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR NestedTestInt::NestedTestInt(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct NestedTestIntDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NestedTestIntDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NestedTestIntDefaultTypeInternal() {}
+  union {
+    NestedTestInt _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NestedTestIntDefaultTypeInternal _NestedTestInt_default_instance_;
+
+inline constexpr TestMessageSetExtension3::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        msg_{nullptr},
+        required_int_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageSetExtension3::TestMessageSetExtension3(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageSetExtension3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageSetExtension3DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageSetExtension3DefaultTypeInternal() {}
+  union {
+    TestMessageSetExtension3 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageSetExtension3DefaultTypeInternal _TestMessageSetExtension3_default_instance_;
+
+inline constexpr TestMessageSetExtension1::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        test_aliasing_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        recursive_{nullptr},
+        i_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageSetExtension1::TestMessageSetExtension1(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageSetExtension1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageSetExtension1DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageSetExtension1DefaultTypeInternal() {}
+  union {
+    TestMessageSetExtension1 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageSetExtension1DefaultTypeInternal _TestMessageSetExtension1_default_instance_;
+
+inline constexpr TestMessageSetContainer::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        message_set_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageSetContainer::TestMessageSetContainer(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageSetContainerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageSetContainerDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageSetContainerDefaultTypeInternal() {}
+  union {
+    TestMessageSetContainer _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageSetContainerDefaultTypeInternal _TestMessageSetContainer_default_instance_;
+
+inline constexpr RawMessageSet::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : item_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RawMessageSet::RawMessageSet(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct RawMessageSetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RawMessageSetDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RawMessageSetDefaultTypeInternal() {}
+  union {
+    RawMessageSet _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RawMessageSetDefaultTypeInternal _RawMessageSet_default_instance_;
+
+inline constexpr NestedTestMessageSetContainer::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        container_{nullptr},
+        child_{nullptr},
+        lazy_child_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR NestedTestMessageSetContainer::NestedTestMessageSetContainer(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct NestedTestMessageSetContainerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NestedTestMessageSetContainerDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NestedTestMessageSetContainerDefaultTypeInternal() {}
+  union {
+    NestedTestMessageSetContainer _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NestedTestMessageSetContainerDefaultTypeInternal _NestedTestMessageSetContainer_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[8];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fmset_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fmset_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fmset_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetContainer, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetContainer, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetContainer, _impl_.message_set_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestMessageSetContainer, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestMessageSetContainer, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestMessageSetContainer, _impl_.container_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestMessageSetContainer, _impl_.child_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestMessageSetContainer, _impl_.lazy_child_),
+    0,
+    1,
+    2,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestInt, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestInt, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestInt, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestInt, _impl_.b_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::NestedTestInt, _impl_.child_),
+    1,
+    2,
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension1, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension1, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension1, _impl_.i_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension1, _impl_.recursive_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension1, _impl_.test_aliasing_),
+    2,
+    1,
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension2, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension2, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension2, _impl_.str_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension3, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension3, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension3, _impl_.msg_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageSetExtension3, _impl_.required_int_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RawMessageSet_Item, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RawMessageSet_Item, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RawMessageSet_Item, _impl_.type_id_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RawMessageSet_Item, _impl_.message_),
+    1,
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RawMessageSet, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RawMessageSet, _impl_.item_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 9, -1, sizeof(::protobuf_unittest::TestMessageSetContainer)},
+        {10, 21, -1, sizeof(::protobuf_unittest::NestedTestMessageSetContainer)},
+        {24, 35, -1, sizeof(::protobuf_unittest::NestedTestInt)},
+        {38, 49, -1, sizeof(::protobuf_unittest::TestMessageSetExtension1)},
+        {52, 61, -1, sizeof(::protobuf_unittest::TestMessageSetExtension2)},
+        {62, 72, -1, sizeof(::protobuf_unittest::TestMessageSetExtension3)},
+        {74, 84, -1, sizeof(::protobuf_unittest::RawMessageSet_Item)},
+        {86, -1, -1, sizeof(::protobuf_unittest::RawMessageSet)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestMessageSetContainer_default_instance_._instance,
+    &::protobuf_unittest::_NestedTestMessageSetContainer_default_instance_._instance,
+    &::protobuf_unittest::_NestedTestInt_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageSetExtension1_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageSetExtension2_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageSetExtension3_default_instance_._instance,
+    &::protobuf_unittest::_RawMessageSet_Item_default_instance_._instance,
+    &::protobuf_unittest::_RawMessageSet_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fmset_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n#google/protobuf/unittest_mset.proto\022\021p"
+    "rotobuf_unittest\032/google/protobuf/unitte"
+    "st_mset_wire_format.proto\"Z\n\027TestMessage"
+    "SetContainer\022\?\n\013message_set\030\001 \001(\0132*.prot"
+    "o2_wireformat_unittest.TestMessageSet\"\351\001"
+    "\n\035NestedTestMessageSetContainer\022=\n\tconta"
+    "iner\030\001 \001(\0132*.protobuf_unittest.TestMessa"
+    "geSetContainer\022\?\n\005child\030\002 \001(\01320.protobuf"
+    "_unittest.NestedTestMessageSetContainer\022"
+    "H\n\nlazy_child\030\003 \001(\01320.protobuf_unittest."
+    "NestedTestMessageSetContainerB\002(\001\"V\n\rNes"
+    "tedTestInt\022\t\n\001a\030\001 \001(\007\022\t\n\001b\030\003 \001(\005\022/\n\005chil"
+    "d\030\002 \001(\0132 .protobuf_unittest.NestedTestIn"
+    "t\"\371\001\n\030TestMessageSetExtension1\022\t\n\001i\030\017 \001("
+    "\005\022=\n\trecursive\030\020 \001(\0132*.proto2_wireformat"
+    "_unittest.TestMessageSet\022\031\n\rtest_aliasin"
+    "g\030\021 \001(\tB\002\010\0022x\n\025message_set_extension\022*.p"
+    "roto2_wireformat_unittest.TestMessageSet"
+    "\030\260\246^ \001(\0132+.protobuf_unittest.TestMessage"
+    "SetExtension1\"\241\001\n\030TestMessageSetExtensio"
+    "n2\022\013\n\003str\030\031 \001(\t2x\n\025message_set_extension"
+    "\022*.proto2_wireformat_unittest.TestMessag"
+    "eSet\030\371\273^ \001(\0132+.protobuf_unittest.TestMes"
+    "sageSetExtension2\"\332\001\n\030TestMessageSetExte"
+    "nsion3\022-\n\003msg\030# \001(\0132 .protobuf_unittest."
+    "NestedTestInt\022\024\n\014required_int\030$ \002(\0052y\n\025m"
+    "essage_set_extension\022*.proto2_wireformat"
+    "_unittest.TestMessageSet\030\251\303\216] \001(\0132+.prot"
+    "obuf_unittest.TestMessageSetExtension3\"n"
+    "\n\rRawMessageSet\0223\n\004item\030\001 \003(\n2%.protobuf"
+    "_unittest.RawMessageSet.Item\032(\n\004Item\022\017\n\007"
+    "type_id\030\002 \002(\005\022\017\n\007message\030\003 \002(\014B\005H\001\370\001\001"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2funittest_5fmset_5fwire_5fformat_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto = {
+    false,
+    false,
+    1277,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fmset_2eproto,
+    "google/protobuf/unittest_mset.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_deps,
+    1,
+    8,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fmset_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fmset_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fmset_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fmset_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto);
+namespace protobuf_unittest {
+// ===================================================================
+
+class TestMessageSetContainer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessageSetContainer>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessageSetContainer, _impl_._has_bits_);
+  static const ::proto2_wireformat_unittest::TestMessageSet& message_set(const TestMessageSetContainer* msg);
+  static void set_has_message_set(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::proto2_wireformat_unittest::TestMessageSet& TestMessageSetContainer::_Internal::message_set(const TestMessageSetContainer* msg) {
+  return *msg->_impl_.message_set_;
+}
+void TestMessageSetContainer::clear_message_set() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.message_set_ != nullptr) _impl_.message_set_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+TestMessageSetContainer::TestMessageSetContainer(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageSetContainer)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetContainer::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestMessageSetContainer::TestMessageSetContainer(
+    ::google::protobuf::Arena* arena,
+    const TestMessageSetContainer& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageSetContainer* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.message_set_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::proto2_wireformat_unittest::TestMessageSet>(arena, *from._impl_.message_set_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageSetContainer)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetContainer::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestMessageSetContainer::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.message_set_ = {};
+}
+TestMessageSetContainer::~TestMessageSetContainer() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageSetContainer)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageSetContainer::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.message_set_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessageSetContainer::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageSetContainer)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.message_set_ != nullptr);
+    _impl_.message_set_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageSetContainer::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestMessageSetContainer::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessageSetContainer, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMessageSetContainer_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional .proto2_wireformat_unittest.TestMessageSet message_set = 1;
+    {::_pbi::TcParser::FastMdS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestMessageSetContainer, _impl_.message_set_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional .proto2_wireformat_unittest.TestMessageSet message_set = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetContainer, _impl_.message_set_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvDefault)},
+  }}, {{
+    {::_pbi::FieldAuxDefaultMessage{}, &::proto2_wireformat_unittest::_TestMessageSet_default_instance_},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestMessageSetContainer::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageSetContainer)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .proto2_wireformat_unittest.TestMessageSet message_set = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::message_set(this),
+        _Internal::message_set(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageSetContainer)
+  return target;
+}
+
+::size_t TestMessageSetContainer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageSetContainer)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .proto2_wireformat_unittest.TestMessageSet message_set = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.message_set_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageSetContainer::_class_data_ = {
+    TestMessageSetContainer::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageSetContainer::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageSetContainer::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageSetContainer*>(&to_msg);
+  auto& from = static_cast<const TestMessageSetContainer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageSetContainer)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_message_set()->::proto2_wireformat_unittest::TestMessageSet::MergeFrom(
+        from._internal_message_set());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageSetContainer::CopyFrom(const TestMessageSetContainer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageSetContainer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageSetContainer::IsInitialized() const {
+  if ((_impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (!_impl_.message_set_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageSetContainer::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageSetContainer::InternalSwap(TestMessageSetContainer* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.message_set_, other->_impl_.message_set_);
+}
+
+::google::protobuf::Metadata TestMessageSetContainer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[0]);
+}
+// ===================================================================
+
+class NestedTestMessageSetContainer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NestedTestMessageSetContainer>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_._has_bits_);
+  static const ::protobuf_unittest::TestMessageSetContainer& container(const NestedTestMessageSetContainer* msg);
+  static void set_has_container(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::protobuf_unittest::NestedTestMessageSetContainer& child(const NestedTestMessageSetContainer* msg);
+  static void set_has_child(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::NestedTestMessageSetContainer& lazy_child(const NestedTestMessageSetContainer* msg);
+  static void set_has_lazy_child(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::protobuf_unittest::TestMessageSetContainer& NestedTestMessageSetContainer::_Internal::container(const NestedTestMessageSetContainer* msg) {
+  return *msg->_impl_.container_;
+}
+const ::protobuf_unittest::NestedTestMessageSetContainer& NestedTestMessageSetContainer::_Internal::child(const NestedTestMessageSetContainer* msg) {
+  return *msg->_impl_.child_;
+}
+const ::protobuf_unittest::NestedTestMessageSetContainer& NestedTestMessageSetContainer::_Internal::lazy_child(const NestedTestMessageSetContainer* msg) {
+  return *msg->_impl_.lazy_child_;
+}
+NestedTestMessageSetContainer::NestedTestMessageSetContainer(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NestedTestMessageSetContainer)
+}
+inline PROTOBUF_NDEBUG_INLINE NestedTestMessageSetContainer::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+NestedTestMessageSetContainer::NestedTestMessageSetContainer(
+    ::google::protobuf::Arena* arena,
+    const NestedTestMessageSetContainer& from)
+    : ::google::protobuf::Message(arena) {
+  NestedTestMessageSetContainer* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.container_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestMessageSetContainer>(arena, *from._impl_.container_)
+                : nullptr;
+  _impl_.child_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::protobuf_unittest::NestedTestMessageSetContainer>(arena, *from._impl_.child_)
+                : nullptr;
+  _impl_.lazy_child_ = (cached_has_bits & 0x00000004u)
+                ? CreateMaybeMessage<::protobuf_unittest::NestedTestMessageSetContainer>(arena, *from._impl_.lazy_child_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.NestedTestMessageSetContainer)
+}
+inline PROTOBUF_NDEBUG_INLINE NestedTestMessageSetContainer::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void NestedTestMessageSetContainer::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, container_),
+           0,
+           offsetof(Impl_, lazy_child_) -
+               offsetof(Impl_, container_) +
+               sizeof(Impl_::lazy_child_));
+}
+NestedTestMessageSetContainer::~NestedTestMessageSetContainer() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.NestedTestMessageSetContainer)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void NestedTestMessageSetContainer::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.container_;
+  delete _impl_.child_;
+  delete _impl_.lazy_child_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void NestedTestMessageSetContainer::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.NestedTestMessageSetContainer)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.container_ != nullptr);
+      _impl_.container_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.child_ != nullptr);
+      _impl_.child_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      ABSL_DCHECK(_impl_.lazy_child_ != nullptr);
+      _impl_.lazy_child_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* NestedTestMessageSetContainer::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 3, 0, 2> NestedTestMessageSetContainer::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    3,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_NestedTestMessageSetContainer_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional .protobuf_unittest.TestMessageSetContainer container = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.container_)}},
+    // optional .protobuf_unittest.NestedTestMessageSetContainer child = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1, PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.child_)}},
+    // optional .protobuf_unittest.NestedTestMessageSetContainer lazy_child = 3 [lazy = true];
+    {::_pbi::TcParser::FastMtS1,
+     {26, 2, 2, PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.lazy_child_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional .protobuf_unittest.TestMessageSetContainer container = 1;
+    {PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.container_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .protobuf_unittest.NestedTestMessageSetContainer child = 2;
+    {PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.child_), _Internal::kHasBitsOffset + 1, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .protobuf_unittest.NestedTestMessageSetContainer lazy_child = 3 [lazy = true];
+    {PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.lazy_child_), _Internal::kHasBitsOffset + 2, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestMessageSetContainer>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::NestedTestMessageSetContainer>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::NestedTestMessageSetContainer>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* NestedTestMessageSetContainer::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.NestedTestMessageSetContainer)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .protobuf_unittest.TestMessageSetContainer container = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::container(this),
+        _Internal::container(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .protobuf_unittest.NestedTestMessageSetContainer child = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::child(this),
+        _Internal::child(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .protobuf_unittest.NestedTestMessageSetContainer lazy_child = 3 [lazy = true];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::lazy_child(this),
+        _Internal::lazy_child(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.NestedTestMessageSetContainer)
+  return target;
+}
+
+::size_t NestedTestMessageSetContainer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.NestedTestMessageSetContainer)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .protobuf_unittest.TestMessageSetContainer container = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.container_);
+    }
+
+    // optional .protobuf_unittest.NestedTestMessageSetContainer child = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.child_);
+    }
+
+    // optional .protobuf_unittest.NestedTestMessageSetContainer lazy_child = 3 [lazy = true];
+    if (cached_has_bits & 0x00000004u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.lazy_child_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData NestedTestMessageSetContainer::_class_data_ = {
+    NestedTestMessageSetContainer::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* NestedTestMessageSetContainer::GetClassData() const {
+  return &_class_data_;
+}
+
+void NestedTestMessageSetContainer::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<NestedTestMessageSetContainer*>(&to_msg);
+  auto& from = static_cast<const NestedTestMessageSetContainer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.NestedTestMessageSetContainer)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_container()->::protobuf_unittest::TestMessageSetContainer::MergeFrom(
+          from._internal_container());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_child()->::protobuf_unittest::NestedTestMessageSetContainer::MergeFrom(
+          from._internal_child());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_lazy_child()->::protobuf_unittest::NestedTestMessageSetContainer::MergeFrom(
+          from._internal_lazy_child());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NestedTestMessageSetContainer::CopyFrom(const NestedTestMessageSetContainer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.NestedTestMessageSetContainer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool NestedTestMessageSetContainer::IsInitialized() const {
+  if ((_impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (!_impl_.container_->IsInitialized()) return false;
+  }
+  if ((_impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (!_impl_.child_->IsInitialized()) return false;
+  }
+  if ((_impl_._has_bits_[0] & 0x00000004u) != 0) {
+    if (!_impl_.lazy_child_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* NestedTestMessageSetContainer::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void NestedTestMessageSetContainer::InternalSwap(NestedTestMessageSetContainer* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.lazy_child_)
+      + sizeof(NestedTestMessageSetContainer::_impl_.lazy_child_)
+      - PROTOBUF_FIELD_OFFSET(NestedTestMessageSetContainer, _impl_.container_)>(
+          reinterpret_cast<char*>(&_impl_.container_),
+          reinterpret_cast<char*>(&other->_impl_.container_));
+}
+
+::google::protobuf::Metadata NestedTestMessageSetContainer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[1]);
+}
+// ===================================================================
+
+class NestedTestInt::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NestedTestInt>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::protobuf_unittest::NestedTestInt& child(const NestedTestInt* msg);
+  static void set_has_child(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::NestedTestInt& NestedTestInt::_Internal::child(const NestedTestInt* msg) {
+  return *msg->_impl_.child_;
+}
+NestedTestInt::NestedTestInt(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NestedTestInt)
+}
+inline PROTOBUF_NDEBUG_INLINE NestedTestInt::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+NestedTestInt::NestedTestInt(
+    ::google::protobuf::Arena* arena,
+    const NestedTestInt& from)
+    : ::google::protobuf::Message(arena) {
+  NestedTestInt* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.child_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::NestedTestInt>(arena, *from._impl_.child_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, a_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, a_),
+           offsetof(Impl_, b_) -
+               offsetof(Impl_, a_) +
+               sizeof(Impl_::b_));
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.NestedTestInt)
+}
+inline PROTOBUF_NDEBUG_INLINE NestedTestInt::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void NestedTestInt::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, child_),
+           0,
+           offsetof(Impl_, b_) -
+               offsetof(Impl_, child_) +
+               sizeof(Impl_::b_));
+}
+NestedTestInt::~NestedTestInt() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.NestedTestInt)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void NestedTestInt::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.child_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void NestedTestInt::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.NestedTestInt)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.child_ != nullptr);
+    _impl_.child_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.a_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.b_) -
+        reinterpret_cast<char*>(&_impl_.a_)) + sizeof(_impl_.b_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* NestedTestInt::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 1, 0, 2> NestedTestInt::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_NestedTestInt_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional fixed32 a = 1;
+    {::_pbi::TcParser::FastF32S1,
+     {13, 1, 0, PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.a_)}},
+    // optional .protobuf_unittest.NestedTestInt child = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.child_)}},
+    // optional int32 b = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NestedTestInt, _impl_.b_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.b_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional fixed32 a = 1;
+    {PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.a_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFixed32)},
+    // optional .protobuf_unittest.NestedTestInt child = 2;
+    {PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.child_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional int32 b = 3;
+    {PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.b_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::NestedTestInt>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* NestedTestInt::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.NestedTestInt)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed32 a = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(
+        1, this->_internal_a(), target);
+  }
+
+  // optional .protobuf_unittest.NestedTestInt child = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::child(this),
+        _Internal::child(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 b = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<3>(
+            stream, this->_internal_b(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.NestedTestInt)
+  return target;
+}
+
+::size_t NestedTestInt::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.NestedTestInt)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .protobuf_unittest.NestedTestInt child = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.child_);
+    }
+
+    // optional fixed32 a = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 5;
+    }
+
+    // optional int32 b = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_b());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData NestedTestInt::_class_data_ = {
+    NestedTestInt::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* NestedTestInt::GetClassData() const {
+  return &_class_data_;
+}
+
+void NestedTestInt::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<NestedTestInt*>(&to_msg);
+  auto& from = static_cast<const NestedTestInt&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.NestedTestInt)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_child()->::protobuf_unittest::NestedTestInt::MergeFrom(
+          from._internal_child());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.b_ = from._impl_.b_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NestedTestInt::CopyFrom(const NestedTestInt& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.NestedTestInt)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool NestedTestInt::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* NestedTestInt::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void NestedTestInt::InternalSwap(NestedTestInt* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.b_)
+      + sizeof(NestedTestInt::_impl_.b_)
+      - PROTOBUF_FIELD_OFFSET(NestedTestInt, _impl_.child_)>(
+          reinterpret_cast<char*>(&_impl_.child_),
+          reinterpret_cast<char*>(&other->_impl_.child_));
+}
+
+::google::protobuf::Metadata NestedTestInt::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[2]);
+}
+// ===================================================================
+
+class TestMessageSetExtension1::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessageSetExtension1>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_._has_bits_);
+  static void set_has_i(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::proto2_wireformat_unittest::TestMessageSet& recursive(const TestMessageSetExtension1* msg);
+  static void set_has_recursive(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_test_aliasing(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::proto2_wireformat_unittest::TestMessageSet& TestMessageSetExtension1::_Internal::recursive(const TestMessageSetExtension1* msg) {
+  return *msg->_impl_.recursive_;
+}
+void TestMessageSetExtension1::clear_recursive() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.recursive_ != nullptr) _impl_.recursive_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+TestMessageSetExtension1::TestMessageSetExtension1(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageSetExtension1)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetExtension1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        test_aliasing_(arena, from.test_aliasing_) {}
+
+TestMessageSetExtension1::TestMessageSetExtension1(
+    ::google::protobuf::Arena* arena,
+    const TestMessageSetExtension1& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageSetExtension1* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.recursive_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::proto2_wireformat_unittest::TestMessageSet>(arena, *from._impl_.recursive_)
+                : nullptr;
+  _impl_.i_ = from._impl_.i_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageSetExtension1)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetExtension1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        test_aliasing_(arena) {}
+
+inline void TestMessageSetExtension1::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, recursive_),
+           0,
+           offsetof(Impl_, i_) -
+               offsetof(Impl_, recursive_) +
+               sizeof(Impl_::i_));
+}
+TestMessageSetExtension1::~TestMessageSetExtension1() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageSetExtension1)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageSetExtension1::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.test_aliasing_.Destroy();
+  delete _impl_.recursive_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessageSetExtension1::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageSetExtension1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.test_aliasing_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.recursive_ != nullptr);
+      _impl_.recursive_->Clear();
+    }
+  }
+  _impl_.i_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageSetExtension1::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 3, 1, 64, 2> TestMessageSetExtension1::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_._has_bits_),
+    0, // no _extensions_
+    17, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294852607,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMessageSetExtension1_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional .proto2_wireformat_unittest.TestMessageSet recursive = 16;
+    {::_pbi::TcParser::FastMdS2,
+     {386, 1, 0, PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.recursive_)}},
+    // optional int32 i = 15;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestMessageSetExtension1, _impl_.i_), 2>(),
+     {120, 2, 0, PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.i_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 i = 15;
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.i_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional .proto2_wireformat_unittest.TestMessageSet recursive = 16;
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.recursive_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvDefault)},
+    // optional string test_aliasing = 17 [ctype = STRING_PIECE];
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.test_aliasing_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }}, {{
+    {::_pbi::FieldAuxDefaultMessage{}, &::proto2_wireformat_unittest::_TestMessageSet_default_instance_},
+  }}, {{
+    "\52\0\0\15\0\0\0\0"
+    "protobuf_unittest.TestMessageSetExtension1"
+    "test_aliasing"
+  }},
+};
+
+::uint8_t* TestMessageSetExtension1::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageSetExtension1)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 i = 15;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<15>(
+            stream, this->_internal_i(), target);
+  }
+
+  // optional .proto2_wireformat_unittest.TestMessageSet recursive = 16;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        16, _Internal::recursive(this),
+        _Internal::recursive(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string test_aliasing = 17 [ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_test_aliasing();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestMessageSetExtension1.test_aliasing");
+    target = stream->WriteStringMaybeAliased(17, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageSetExtension1)
+  return target;
+}
+
+::size_t TestMessageSetExtension1::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageSetExtension1)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string test_aliasing = 17 [ctype = STRING_PIECE];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_test_aliasing());
+    }
+
+    // optional .proto2_wireformat_unittest.TestMessageSet recursive = 16;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.recursive_);
+    }
+
+    // optional int32 i = 15;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_i());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageSetExtension1::_class_data_ = {
+    TestMessageSetExtension1::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageSetExtension1::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageSetExtension1::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageSetExtension1*>(&to_msg);
+  auto& from = static_cast<const TestMessageSetExtension1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageSetExtension1)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_test_aliasing(from._internal_test_aliasing());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_recursive()->::proto2_wireformat_unittest::TestMessageSet::MergeFrom(
+          from._internal_recursive());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.i_ = from._impl_.i_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageSetExtension1::CopyFrom(const TestMessageSetExtension1& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageSetExtension1)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageSetExtension1::IsInitialized() const {
+  if ((_impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (!_impl_.recursive_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageSetExtension1::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageSetExtension1::InternalSwap(TestMessageSetExtension1* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.test_aliasing_, &other->_impl_.test_aliasing_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.i_)
+      + sizeof(TestMessageSetExtension1::_impl_.i_)
+      - PROTOBUF_FIELD_OFFSET(TestMessageSetExtension1, _impl_.recursive_)>(
+          reinterpret_cast<char*>(&_impl_.recursive_),
+          reinterpret_cast<char*>(&other->_impl_.recursive_));
+}
+
+::google::protobuf::Metadata TestMessageSetExtension1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[3]);
+}
+// ===================================================================
+
+class TestMessageSetExtension2::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessageSetExtension2>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessageSetExtension2, _impl_._has_bits_);
+  static void set_has_str(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestMessageSetExtension2::TestMessageSetExtension2(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageSetExtension2)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetExtension2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        str_(arena, from.str_) {}
+
+TestMessageSetExtension2::TestMessageSetExtension2(
+    ::google::protobuf::Arena* arena,
+    const TestMessageSetExtension2& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageSetExtension2* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageSetExtension2)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetExtension2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        str_(arena) {}
+
+inline void TestMessageSetExtension2::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMessageSetExtension2::~TestMessageSetExtension2() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageSetExtension2)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageSetExtension2::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.str_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessageSetExtension2::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageSetExtension2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.str_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageSetExtension2::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 54, 2> TestMessageSetExtension2::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessageSetExtension2, _impl_._has_bits_),
+    0, // no _extensions_
+    25, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4278190079,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestMessageSetExtension2_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string str = 25;
+    {::_pbi::TcParser::FastSS2,
+     {458, 0, 0, PROTOBUF_FIELD_OFFSET(TestMessageSetExtension2, _impl_.str_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional string str = 25;
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetExtension2, _impl_.str_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\52\3\0\0\0\0\0\0"
+    "protobuf_unittest.TestMessageSetExtension2"
+    "str"
+  }},
+};
+
+::uint8_t* TestMessageSetExtension2::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageSetExtension2)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string str = 25;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_str();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestMessageSetExtension2.str");
+    target = stream->WriteStringMaybeAliased(25, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageSetExtension2)
+  return target;
+}
+
+::size_t TestMessageSetExtension2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageSetExtension2)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string str = 25;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_str());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageSetExtension2::_class_data_ = {
+    TestMessageSetExtension2::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageSetExtension2::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageSetExtension2::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageSetExtension2*>(&to_msg);
+  auto& from = static_cast<const TestMessageSetExtension2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageSetExtension2)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_str(from._internal_str());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageSetExtension2::CopyFrom(const TestMessageSetExtension2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageSetExtension2)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageSetExtension2::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageSetExtension2::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageSetExtension2::InternalSwap(TestMessageSetExtension2* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.str_, &other->_impl_.str_, arena);
+}
+
+::google::protobuf::Metadata TestMessageSetExtension2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[4]);
+}
+// ===================================================================
+
+class TestMessageSetExtension3::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessageSetExtension3>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_._has_bits_);
+  static const ::protobuf_unittest::NestedTestInt& msg(const TestMessageSetExtension3* msg);
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_required_int(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+const ::protobuf_unittest::NestedTestInt& TestMessageSetExtension3::_Internal::msg(const TestMessageSetExtension3* msg) {
+  return *msg->_impl_.msg_;
+}
+TestMessageSetExtension3::TestMessageSetExtension3(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageSetExtension3)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetExtension3::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestMessageSetExtension3::TestMessageSetExtension3(
+    ::google::protobuf::Arena* arena,
+    const TestMessageSetExtension3& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageSetExtension3* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.msg_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::NestedTestInt>(arena, *from._impl_.msg_)
+                : nullptr;
+  _impl_.required_int_ = from._impl_.required_int_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageSetExtension3)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageSetExtension3::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestMessageSetExtension3::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, msg_),
+           0,
+           offsetof(Impl_, required_int_) -
+               offsetof(Impl_, msg_) +
+               sizeof(Impl_::required_int_));
+}
+TestMessageSetExtension3::~TestMessageSetExtension3() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageSetExtension3)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageSetExtension3::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.msg_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessageSetExtension3::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageSetExtension3)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.msg_ != nullptr);
+    _impl_.msg_->Clear();
+  }
+  _impl_.required_int_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageSetExtension3::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 0, 7> TestMessageSetExtension3::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_._has_bits_),
+    0, // no _extensions_
+    36, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMessageSetExtension3_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // required int32 required_int = 36;
+    {::_pbi::TcParser::FastV32S2,
+     {672, 1, 0, PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_.required_int_)}},
+    // optional .protobuf_unittest.NestedTestInt msg = 35;
+    {::_pbi::TcParser::FastMtS2,
+     {666, 0, 0, PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_.msg_)}},
+  }}, {{
+    35, 0, 1,
+    65532, 0,
+    65535, 65535
+  }}, {{
+    // optional .protobuf_unittest.NestedTestInt msg = 35;
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_.msg_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // required int32 required_int = 36;
+    {PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_.required_int_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::NestedTestInt>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestMessageSetExtension3::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageSetExtension3)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .protobuf_unittest.NestedTestInt msg = 35;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        35, _Internal::msg(this),
+        _Internal::msg(this).GetCachedSize(), target, stream);
+  }
+
+  // required int32 required_int = 36;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        36, this->_internal_required_int(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageSetExtension3)
+  return target;
+}
+
+::size_t TestMessageSetExtension3::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageSetExtension3)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.NestedTestInt msg = 35;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.msg_);
+  }
+
+  // required int32 required_int = 36;
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 2 + ::_pbi::WireFormatLite::Int32Size(
+                                    this->_internal_required_int());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageSetExtension3::_class_data_ = {
+    TestMessageSetExtension3::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageSetExtension3::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageSetExtension3::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageSetExtension3*>(&to_msg);
+  auto& from = static_cast<const TestMessageSetExtension3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageSetExtension3)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_msg()->::protobuf_unittest::NestedTestInt::MergeFrom(
+          from._internal_msg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.required_int_ = from._impl_.required_int_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageSetExtension3::CopyFrom(const TestMessageSetExtension3& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageSetExtension3)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageSetExtension3::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageSetExtension3::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageSetExtension3::InternalSwap(TestMessageSetExtension3* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_.required_int_)
+      + sizeof(TestMessageSetExtension3::_impl_.required_int_)
+      - PROTOBUF_FIELD_OFFSET(TestMessageSetExtension3, _impl_.msg_)>(
+          reinterpret_cast<char*>(&_impl_.msg_),
+          reinterpret_cast<char*>(&other->_impl_.msg_));
+}
+
+::google::protobuf::Metadata TestMessageSetExtension3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[5]);
+}
+// ===================================================================
+
+class RawMessageSet_Item::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RawMessageSet_Item>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(RawMessageSet_Item, _impl_._has_bits_);
+  static void set_has_type_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+RawMessageSet_Item::RawMessageSet_Item(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.RawMessageSet.Item)
+}
+inline PROTOBUF_NDEBUG_INLINE RawMessageSet_Item::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        message_(arena, from.message_) {}
+
+RawMessageSet_Item::RawMessageSet_Item(
+    ::google::protobuf::Arena* arena,
+    const RawMessageSet_Item& from)
+    : ::google::protobuf::Message(arena) {
+  RawMessageSet_Item* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.type_id_ = from._impl_.type_id_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.RawMessageSet.Item)
+}
+inline PROTOBUF_NDEBUG_INLINE RawMessageSet_Item::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        message_(arena) {}
+
+inline void RawMessageSet_Item::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.type_id_ = {};
+}
+RawMessageSet_Item::~RawMessageSet_Item() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.RawMessageSet.Item)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void RawMessageSet_Item::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.message_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void RawMessageSet_Item::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.RawMessageSet.Item)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.message_.ClearNonDefaultToEmpty();
+  }
+  _impl_.type_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* RawMessageSet_Item::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 2, 0, 0, 2> RawMessageSet_Item::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(RawMessageSet_Item, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967289,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_RawMessageSet_Item_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::FastEndG1, {12, 12}},
+    // required int32 type_id = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RawMessageSet_Item, _impl_.type_id_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(RawMessageSet_Item, _impl_.type_id_)}},
+    // required bytes message = 3;
+    {::_pbi::TcParser::FastBS1,
+     {26, 0, 0, PROTOBUF_FIELD_OFFSET(RawMessageSet_Item, _impl_.message_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required int32 type_id = 2;
+    {PROTOBUF_FIELD_OFFSET(RawMessageSet_Item, _impl_.type_id_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // required bytes message = 3;
+    {PROTOBUF_FIELD_OFFSET(RawMessageSet_Item, _impl_.message_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBytes | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* RawMessageSet_Item::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.RawMessageSet.Item)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 type_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_type_id(), target);
+  }
+
+  // required bytes message = 3;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_message();
+    target = stream->WriteBytesMaybeAliased(3, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.RawMessageSet.Item)
+  return target;
+}
+
+::size_t RawMessageSet_Item::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.RawMessageSet.Item)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // required bytes message = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
+                                      this->_internal_message());
+    }
+
+    // required int32 type_id = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_type_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData RawMessageSet_Item::_class_data_ = {
+    RawMessageSet_Item::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* RawMessageSet_Item::GetClassData() const {
+  return &_class_data_;
+}
+
+void RawMessageSet_Item::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<RawMessageSet_Item*>(&to_msg);
+  auto& from = static_cast<const RawMessageSet_Item&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.RawMessageSet.Item)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_id_ = from._impl_.type_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RawMessageSet_Item::CopyFrom(const RawMessageSet_Item& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.RawMessageSet.Item)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool RawMessageSet_Item::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* RawMessageSet_Item::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void RawMessageSet_Item::InternalSwap(RawMessageSet_Item* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
+        swap(_impl_.type_id_, other->_impl_.type_id_);
+}
+
+::google::protobuf::Metadata RawMessageSet_Item::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[6]);
+}
+// ===================================================================
+
+class RawMessageSet::_Internal {
+ public:
+};
+
+RawMessageSet::RawMessageSet(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.RawMessageSet)
+}
+inline PROTOBUF_NDEBUG_INLINE RawMessageSet::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : item_{visibility, arena, from.item_},
+        _cached_size_{0} {}
+
+RawMessageSet::RawMessageSet(
+    ::google::protobuf::Arena* arena,
+    const RawMessageSet& from)
+    : ::google::protobuf::Message(arena) {
+  RawMessageSet* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.RawMessageSet)
+}
+inline PROTOBUF_NDEBUG_INLINE RawMessageSet::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : item_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void RawMessageSet::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+RawMessageSet::~RawMessageSet() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.RawMessageSet)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void RawMessageSet::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void RawMessageSet::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.RawMessageSet)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.item_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* RawMessageSet::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> RawMessageSet::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_RawMessageSet_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated group Item = 1 { ... };
+    {::_pbi::TcParser::FastGtR1,
+     {11, 63, 0, PROTOBUF_FIELD_OFFSET(RawMessageSet, _impl_.item_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated group Item = 1 { ... };
+    {PROTOBUF_FIELD_OFFSET(RawMessageSet, _impl_.item_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kRepGroup | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::RawMessageSet_Item>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* RawMessageSet::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.RawMessageSet)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // repeated group Item = 1 { ... };
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_item_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteGroup(1, this->_internal_item().Get(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.RawMessageSet)
+  return target;
+}
+
+::size_t RawMessageSet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.RawMessageSet)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated group Item = 1 { ... };
+  total_size += 2UL * this->_internal_item_size();
+  for (const auto& msg : this->_internal_item()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::GroupSize(msg);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData RawMessageSet::_class_data_ = {
+    RawMessageSet::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* RawMessageSet::GetClassData() const {
+  return &_class_data_;
+}
+
+void RawMessageSet::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<RawMessageSet*>(&to_msg);
+  auto& from = static_cast<const RawMessageSet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.RawMessageSet)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_item()->MergeFrom(
+      from._internal_item());
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RawMessageSet::CopyFrom(const RawMessageSet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.RawMessageSet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool RawMessageSet::IsInitialized() const {
+  if (!::google::protobuf::internal::AllAreInitialized(_internal_item()))
+    return false;
+  return true;
+}
+
+::_pbi::CachedSize* RawMessageSet::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void RawMessageSet::InternalSwap(RawMessageSet* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.item_.InternalSwap(&other->_impl_.item_);
+}
+
+::google::protobuf::Metadata RawMessageSet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fmset_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fmset_2eproto[7]);
+}
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestMessageSetExtension1::kMessageSetExtensionFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::proto2_wireformat_unittest::TestMessageSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestMessageSetExtension1 >, 11, false>
+  TestMessageSetExtension1::message_set_extension(kMessageSetExtensionFieldNumber, ::protobuf_unittest::TestMessageSetExtension1::default_instance(), nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestMessageSetExtension2::kMessageSetExtensionFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::proto2_wireformat_unittest::TestMessageSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestMessageSetExtension2 >, 11, false>
+  TestMessageSetExtension2::message_set_extension(kMessageSetExtensionFieldNumber, ::protobuf_unittest::TestMessageSetExtension2::default_instance(), nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestMessageSetExtension3::kMessageSetExtensionFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::proto2_wireformat_unittest::TestMessageSet,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestMessageSetExtension3 >, 11, false>
+  TestMessageSetExtension3::message_set_extension(kMessageSetExtensionFieldNumber, ::protobuf_unittest::TestMessageSetExtension3::default_instance(), nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,4438 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_no_field_presence.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/unittest.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+namespace proto2_nofieldpresence_unittest {
+class ForeignMessage;
+struct ForeignMessageDefaultTypeInternal;
+extern ForeignMessageDefaultTypeInternal _ForeignMessage_default_instance_;
+class TestAllTypes;
+struct TestAllTypesDefaultTypeInternal;
+extern TestAllTypesDefaultTypeInternal _TestAllTypes_default_instance_;
+class TestAllTypes_NestedMessage;
+struct TestAllTypes_NestedMessageDefaultTypeInternal;
+extern TestAllTypes_NestedMessageDefaultTypeInternal _TestAllTypes_NestedMessage_default_instance_;
+class TestProto2Required;
+struct TestProto2RequiredDefaultTypeInternal;
+extern TestProto2RequiredDefaultTypeInternal _TestProto2Required_default_instance_;
+}  // namespace proto2_nofieldpresence_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace proto2_nofieldpresence_unittest {
+enum TestAllTypes_NestedEnum : int {
+  TestAllTypes_NestedEnum_FOO = 0,
+  TestAllTypes_NestedEnum_BAR = 1,
+  TestAllTypes_NestedEnum_BAZ = 2,
+  TestAllTypes_NestedEnum_TestAllTypes_NestedEnum_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  TestAllTypes_NestedEnum_TestAllTypes_NestedEnum_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool TestAllTypes_NestedEnum_IsValid(int value);
+extern const uint32_t TestAllTypes_NestedEnum_internal_data_[];
+constexpr TestAllTypes_NestedEnum TestAllTypes_NestedEnum_NestedEnum_MIN = static_cast<TestAllTypes_NestedEnum>(0);
+constexpr TestAllTypes_NestedEnum TestAllTypes_NestedEnum_NestedEnum_MAX = static_cast<TestAllTypes_NestedEnum>(2);
+constexpr int TestAllTypes_NestedEnum_NestedEnum_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+TestAllTypes_NestedEnum_descriptor();
+template <typename T>
+const std::string& TestAllTypes_NestedEnum_Name(T value) {
+  static_assert(std::is_same<T, TestAllTypes_NestedEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to NestedEnum_Name().");
+  return TestAllTypes_NestedEnum_Name(static_cast<TestAllTypes_NestedEnum>(value));
+}
+template <>
+inline const std::string& TestAllTypes_NestedEnum_Name(TestAllTypes_NestedEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<TestAllTypes_NestedEnum_descriptor,
+                                                 0, 2>(
+      static_cast<int>(value));
+}
+inline bool TestAllTypes_NestedEnum_Parse(absl::string_view name, TestAllTypes_NestedEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TestAllTypes_NestedEnum>(
+      TestAllTypes_NestedEnum_descriptor(), name, value);
+}
+enum ForeignEnum : int {
+  FOREIGN_FOO = 0,
+  FOREIGN_BAR = 1,
+  FOREIGN_BAZ = 2,
+  ForeignEnum_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  ForeignEnum_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool ForeignEnum_IsValid(int value);
+extern const uint32_t ForeignEnum_internal_data_[];
+constexpr ForeignEnum ForeignEnum_MIN = static_cast<ForeignEnum>(0);
+constexpr ForeignEnum ForeignEnum_MAX = static_cast<ForeignEnum>(2);
+constexpr int ForeignEnum_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+ForeignEnum_descriptor();
+template <typename T>
+const std::string& ForeignEnum_Name(T value) {
+  static_assert(std::is_same<T, ForeignEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to ForeignEnum_Name().");
+  return ForeignEnum_Name(static_cast<ForeignEnum>(value));
+}
+template <>
+inline const std::string& ForeignEnum_Name(ForeignEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<ForeignEnum_descriptor,
+                                                 0, 2>(
+      static_cast<int>(value));
+}
+inline bool ForeignEnum_Parse(absl::string_view name, ForeignEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<ForeignEnum>(
+      ForeignEnum_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestAllTypes_NestedMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage) */ {
+ public:
+  inline TestAllTypes_NestedMessage() : TestAllTypes_NestedMessage(nullptr) {}
+  ~TestAllTypes_NestedMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypes_NestedMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypes_NestedMessage(const TestAllTypes_NestedMessage& from)
+      : TestAllTypes_NestedMessage(nullptr, from) {}
+  TestAllTypes_NestedMessage(TestAllTypes_NestedMessage&& from) noexcept
+    : TestAllTypes_NestedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypes_NestedMessage& operator=(const TestAllTypes_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypes_NestedMessage& operator=(TestAllTypes_NestedMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestAllTypes_NestedMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllTypes_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypes_NestedMessage*>(
+               &_TestAllTypes_NestedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestAllTypes_NestedMessage& a, TestAllTypes_NestedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypes_NestedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypes_NestedMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypes_NestedMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypes_NestedMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestAllTypes_NestedMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestAllTypes_NestedMessage& from) {
+    TestAllTypes_NestedMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypes_NestedMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage";
+  }
+  protected:
+  explicit TestAllTypes_NestedMessage(::google::protobuf::Arena* arena);
+  TestAllTypes_NestedMessage(::google::protobuf::Arena* arena, const TestAllTypes_NestedMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBbFieldNumber = 1,
+  };
+  // int32 bb = 1;
+  void clear_bb() ;
+  ::int32_t bb() const;
+  void set_bb(::int32_t value);
+
+  private:
+  ::int32_t _internal_bb() const;
+  void _internal_set_bb(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t bb_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+};// -------------------------------------------------------------------
+
+class ForeignMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto2_nofieldpresence_unittest.ForeignMessage) */ {
+ public:
+  inline ForeignMessage() : ForeignMessage(nullptr) {}
+  ~ForeignMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ForeignMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline ForeignMessage(const ForeignMessage& from)
+      : ForeignMessage(nullptr, from) {}
+  ForeignMessage(ForeignMessage&& from) noexcept
+    : ForeignMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ForeignMessage& operator=(const ForeignMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ForeignMessage& operator=(ForeignMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ForeignMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ForeignMessage* internal_default_instance() {
+    return reinterpret_cast<const ForeignMessage*>(
+               &_ForeignMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ForeignMessage& a, ForeignMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ForeignMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ForeignMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ForeignMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ForeignMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ForeignMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ForeignMessage& from) {
+    ForeignMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ForeignMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto2_nofieldpresence_unittest.ForeignMessage";
+  }
+  protected:
+  explicit ForeignMessage(::google::protobuf::Arena* arena);
+  ForeignMessage(::google::protobuf::Arena* arena, const ForeignMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCFieldNumber = 1,
+  };
+  // int32 c = 1;
+  void clear_c() ;
+  ::int32_t c() const;
+  void set_c(::int32_t value);
+
+  private:
+  ::int32_t _internal_c() const;
+  void _internal_set_c(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto2_nofieldpresence_unittest.ForeignMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t c_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+};// -------------------------------------------------------------------
+
+class TestProto2Required final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto2_nofieldpresence_unittest.TestProto2Required) */ {
+ public:
+  inline TestProto2Required() : TestProto2Required(nullptr) {}
+  ~TestProto2Required() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestProto2Required(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestProto2Required(const TestProto2Required& from)
+      : TestProto2Required(nullptr, from) {}
+  TestProto2Required(TestProto2Required&& from) noexcept
+    : TestProto2Required() {
+    *this = ::std::move(from);
+  }
+
+  inline TestProto2Required& operator=(const TestProto2Required& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestProto2Required& operator=(TestProto2Required&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestProto2Required& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestProto2Required* internal_default_instance() {
+    return reinterpret_cast<const TestProto2Required*>(
+               &_TestProto2Required_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestProto2Required& a, TestProto2Required& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestProto2Required* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestProto2Required* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestProto2Required* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestProto2Required>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestProto2Required& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestProto2Required& from) {
+    TestProto2Required::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestProto2Required* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto2_nofieldpresence_unittest.TestProto2Required";
+  }
+  protected:
+  explicit TestProto2Required(::google::protobuf::Arena* arena);
+  TestProto2Required(::google::protobuf::Arena* arena, const TestProto2Required& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProto2FieldNumber = 1,
+  };
+  // .protobuf_unittest.TestRequired proto2 = 1;
+  bool has_proto2() const;
+  void clear_proto2() ;
+  const ::protobuf_unittest::TestRequired& proto2() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestRequired* release_proto2();
+  ::protobuf_unittest::TestRequired* mutable_proto2();
+  void set_allocated_proto2(::protobuf_unittest::TestRequired* value);
+  void unsafe_arena_set_allocated_proto2(::protobuf_unittest::TestRequired* value);
+  ::protobuf_unittest::TestRequired* unsafe_arena_release_proto2();
+
+  private:
+  const ::protobuf_unittest::TestRequired& _internal_proto2() const;
+  ::protobuf_unittest::TestRequired* _internal_mutable_proto2();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto2_nofieldpresence_unittest.TestProto2Required)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestRequired* proto2_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto2_nofieldpresence_unittest.TestAllTypes) */ {
+ public:
+  inline TestAllTypes() : TestAllTypes(nullptr) {}
+  ~TestAllTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypes(const TestAllTypes& from)
+      : TestAllTypes(nullptr, from) {}
+  TestAllTypes(TestAllTypes&& from) noexcept
+    : TestAllTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypes& operator=(const TestAllTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypes& operator=(TestAllTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestAllTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofFieldCase {
+    kOneofUint32 = 111,
+    kOneofNestedMessage = 112,
+    kOneofString = 113,
+    kOneofEnum = 114,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static inline const TestAllTypes* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypes*>(
+               &_TestAllTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestAllTypes& a, TestAllTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestAllTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestAllTypes& from) {
+    TestAllTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto2_nofieldpresence_unittest.TestAllTypes";
+  }
+  protected:
+  explicit TestAllTypes(::google::protobuf::Arena* arena);
+  TestAllTypes(::google::protobuf::Arena* arena, const TestAllTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using NestedMessage = TestAllTypes_NestedMessage;
+
+  using NestedEnum = TestAllTypes_NestedEnum;
+  static constexpr NestedEnum FOO = TestAllTypes_NestedEnum_FOO;
+  static constexpr NestedEnum BAR = TestAllTypes_NestedEnum_BAR;
+  static constexpr NestedEnum BAZ = TestAllTypes_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestAllTypes_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN = TestAllTypes_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX = TestAllTypes_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE = TestAllTypes_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* NestedEnum_descriptor() {
+    return TestAllTypes_NestedEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& NestedEnum_Name(T value) {
+    return TestAllTypes_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(absl::string_view name, NestedEnum* value) {
+    return TestAllTypes_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 31,
+    kRepeatedInt64FieldNumber = 32,
+    kRepeatedUint32FieldNumber = 33,
+    kRepeatedUint64FieldNumber = 34,
+    kRepeatedSint32FieldNumber = 35,
+    kRepeatedSint64FieldNumber = 36,
+    kRepeatedFixed32FieldNumber = 37,
+    kRepeatedFixed64FieldNumber = 38,
+    kRepeatedSfixed32FieldNumber = 39,
+    kRepeatedSfixed64FieldNumber = 40,
+    kRepeatedFloatFieldNumber = 41,
+    kRepeatedDoubleFieldNumber = 42,
+    kRepeatedBoolFieldNumber = 43,
+    kRepeatedStringFieldNumber = 44,
+    kRepeatedBytesFieldNumber = 45,
+    kRepeatedNestedMessageFieldNumber = 48,
+    kRepeatedForeignMessageFieldNumber = 49,
+    kRepeatedProto2MessageFieldNumber = 50,
+    kRepeatedNestedEnumFieldNumber = 51,
+    kRepeatedForeignEnumFieldNumber = 52,
+    kRepeatedStringPieceFieldNumber = 54,
+    kRepeatedCordFieldNumber = 55,
+    kRepeatedLazyMessageFieldNumber = 57,
+    kOptionalStringFieldNumber = 14,
+    kOptionalBytesFieldNumber = 15,
+    kOptionalStringPieceFieldNumber = 24,
+    kOptionalCordFieldNumber = 25,
+    kOptionalNestedMessageFieldNumber = 18,
+    kOptionalForeignMessageFieldNumber = 19,
+    kOptionalProto2MessageFieldNumber = 20,
+    kOptionalLazyMessageFieldNumber = 30,
+    kOptionalInt64FieldNumber = 2,
+    kOptionalInt32FieldNumber = 1,
+    kOptionalUint32FieldNumber = 3,
+    kOptionalUint64FieldNumber = 4,
+    kOptionalSint64FieldNumber = 6,
+    kOptionalSint32FieldNumber = 5,
+    kOptionalFixed32FieldNumber = 7,
+    kOptionalFixed64FieldNumber = 8,
+    kOptionalSfixed64FieldNumber = 10,
+    kOptionalSfixed32FieldNumber = 9,
+    kOptionalFloatFieldNumber = 11,
+    kOptionalDoubleFieldNumber = 12,
+    kOptionalBoolFieldNumber = 13,
+    kOptionalNestedEnumFieldNumber = 21,
+    kOptionalForeignEnumFieldNumber = 22,
+    kOneofUint32FieldNumber = 111,
+    kOneofNestedMessageFieldNumber = 112,
+    kOneofStringFieldNumber = 113,
+    kOneofEnumFieldNumber = 114,
+  };
+  // repeated int32 repeated_int32 = 31;
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // repeated int64 repeated_int64 = 32;
+  int repeated_int64_size() const;
+  private:
+  int _internal_repeated_int64_size() const;
+
+  public:
+  void clear_repeated_int64() ;
+  ::int64_t repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::int64_t value);
+  void add_repeated_int64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_int64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_int64();
+
+  public:
+  // repeated uint32 repeated_uint32 = 33;
+  int repeated_uint32_size() const;
+  private:
+  int _internal_repeated_uint32_size() const;
+
+  public:
+  void clear_repeated_uint32() ;
+  ::uint32_t repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::uint32_t value);
+  void add_repeated_uint32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_uint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_uint32();
+
+  public:
+  // repeated uint64 repeated_uint64 = 34;
+  int repeated_uint64_size() const;
+  private:
+  int _internal_repeated_uint64_size() const;
+
+  public:
+  void clear_repeated_uint64() ;
+  ::uint64_t repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::uint64_t value);
+  void add_repeated_uint64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_uint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_uint64();
+
+  public:
+  // repeated sint32 repeated_sint32 = 35;
+  int repeated_sint32_size() const;
+  private:
+  int _internal_repeated_sint32_size() const;
+
+  public:
+  void clear_repeated_sint32() ;
+  ::int32_t repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::int32_t value);
+  void add_repeated_sint32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sint32();
+
+  public:
+  // repeated sint64 repeated_sint64 = 36;
+  int repeated_sint64_size() const;
+  private:
+  int _internal_repeated_sint64_size() const;
+
+  public:
+  void clear_repeated_sint64() ;
+  ::int64_t repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::int64_t value);
+  void add_repeated_sint64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sint64();
+
+  public:
+  // repeated fixed32 repeated_fixed32 = 37;
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+
+  public:
+  void clear_repeated_fixed32() ;
+  ::uint32_t repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::uint32_t value);
+  void add_repeated_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_fixed32();
+
+  public:
+  // repeated fixed64 repeated_fixed64 = 38;
+  int repeated_fixed64_size() const;
+  private:
+  int _internal_repeated_fixed64_size() const;
+
+  public:
+  void clear_repeated_fixed64() ;
+  ::uint64_t repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::uint64_t value);
+  void add_repeated_fixed64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_fixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_fixed64();
+
+  public:
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  int repeated_sfixed32_size() const;
+  private:
+  int _internal_repeated_sfixed32_size() const;
+
+  public:
+  void clear_repeated_sfixed32() ;
+  ::int32_t repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::int32_t value);
+  void add_repeated_sfixed32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sfixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sfixed32();
+
+  public:
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  int repeated_sfixed64_size() const;
+  private:
+  int _internal_repeated_sfixed64_size() const;
+
+  public:
+  void clear_repeated_sfixed64() ;
+  ::int64_t repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::int64_t value);
+  void add_repeated_sfixed64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sfixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sfixed64();
+
+  public:
+  // repeated float repeated_float = 41;
+  int repeated_float_size() const;
+  private:
+  int _internal_repeated_float_size() const;
+
+  public:
+  void clear_repeated_float() ;
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::google::protobuf::RepeatedField<float>& repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* mutable_repeated_float();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_repeated_float();
+
+  public:
+  // repeated double repeated_double = 42;
+  int repeated_double_size() const;
+  private:
+  int _internal_repeated_double_size() const;
+
+  public:
+  void clear_repeated_double() ;
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::google::protobuf::RepeatedField<double>& repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* mutable_repeated_double();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_repeated_double();
+
+  public:
+  // repeated bool repeated_bool = 43;
+  int repeated_bool_size() const;
+  private:
+  int _internal_repeated_bool_size() const;
+
+  public:
+  void clear_repeated_bool() ;
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::google::protobuf::RepeatedField<bool>& repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_repeated_bool();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_repeated_bool();
+
+  public:
+  // repeated string repeated_string = 44;
+  int repeated_string_size() const;
+  private:
+  int _internal_repeated_string_size() const;
+
+  public:
+  void clear_repeated_string() ;
+  const std::string& repeated_string(int index) const;
+  std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const std::string& value);
+  void set_repeated_string(int index, std::string&& value);
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, std::size_t size);
+  void set_repeated_string(int index, absl::string_view value);
+  std::string* add_repeated_string();
+  void add_repeated_string(const std::string& value);
+  void add_repeated_string(std::string&& value);
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, std::size_t size);
+  void add_repeated_string(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string();
+
+  public:
+  // repeated bytes repeated_bytes = 45;
+  int repeated_bytes_size() const;
+  private:
+  int _internal_repeated_bytes_size() const;
+
+  public:
+  void clear_repeated_bytes() ;
+  const std::string& repeated_bytes(int index) const;
+  std::string* mutable_repeated_bytes(int index);
+  void set_repeated_bytes(int index, const std::string& value);
+  void set_repeated_bytes(int index, std::string&& value);
+  void set_repeated_bytes(int index, const char* value);
+  void set_repeated_bytes(int index, const void* value, std::size_t size);
+  void set_repeated_bytes(int index, absl::string_view value);
+  std::string* add_repeated_bytes();
+  void add_repeated_bytes(const std::string& value);
+  void add_repeated_bytes(std::string&& value);
+  void add_repeated_bytes(const char* value);
+  void add_repeated_bytes(const void* value, std::size_t size);
+  void add_repeated_bytes(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_bytes();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_bytes();
+
+  public:
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  int repeated_nested_message_size() const;
+  private:
+  int _internal_repeated_nested_message_size() const;
+
+  public:
+  void clear_repeated_nested_message() ;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* mutable_repeated_nested_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage >*
+      mutable_repeated_nested_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>& _internal_repeated_nested_message() const;
+  ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>* _internal_mutable_repeated_nested_message();
+  public:
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& repeated_nested_message(int index) const;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* add_repeated_nested_message();
+  const ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage >&
+      repeated_nested_message() const;
+  // repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+  int repeated_foreign_message_size() const;
+  private:
+  int _internal_repeated_foreign_message_size() const;
+
+  public:
+  void clear_repeated_foreign_message() ;
+  ::proto2_nofieldpresence_unittest::ForeignMessage* mutable_repeated_foreign_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::ForeignMessage >*
+      mutable_repeated_foreign_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::ForeignMessage>& _internal_repeated_foreign_message() const;
+  ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::ForeignMessage>* _internal_mutable_repeated_foreign_message();
+  public:
+  const ::proto2_nofieldpresence_unittest::ForeignMessage& repeated_foreign_message(int index) const;
+  ::proto2_nofieldpresence_unittest::ForeignMessage* add_repeated_foreign_message();
+  const ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::ForeignMessage >&
+      repeated_foreign_message() const;
+  // repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+  int repeated_proto2_message_size() const;
+  private:
+  int _internal_repeated_proto2_message_size() const;
+
+  public:
+  void clear_repeated_proto2_message() ;
+  ::protobuf_unittest::TestAllTypes* mutable_repeated_proto2_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypes >*
+      mutable_repeated_proto2_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypes>& _internal_repeated_proto2_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypes>* _internal_mutable_repeated_proto2_message();
+  public:
+  const ::protobuf_unittest::TestAllTypes& repeated_proto2_message(int index) const;
+  ::protobuf_unittest::TestAllTypes* add_repeated_proto2_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypes >&
+      repeated_proto2_message() const;
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  int repeated_nested_enum_size() const;
+  private:
+  int _internal_repeated_nested_enum_size() const;
+
+  public:
+  void clear_repeated_nested_enum() ;
+  public:
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value);
+  void add_repeated_nested_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_nested_enum();
+
+  public:
+  // repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+  int repeated_foreign_enum_size() const;
+  private:
+  int _internal_repeated_foreign_enum_size() const;
+
+  public:
+  void clear_repeated_foreign_enum() ;
+  public:
+  ::proto2_nofieldpresence_unittest::ForeignEnum repeated_foreign_enum(int index) const;
+  void set_repeated_foreign_enum(int index, ::proto2_nofieldpresence_unittest::ForeignEnum value);
+  void add_repeated_foreign_enum(::proto2_nofieldpresence_unittest::ForeignEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_foreign_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_foreign_enum();
+
+  public:
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  int repeated_string_piece_size() const;
+  private:
+  int _internal_repeated_string_piece_size() const;
+
+  public:
+  void clear_repeated_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& repeated_string_piece(int index) const;
+  std::string* mutable_repeated_string_piece(int index);
+  void set_repeated_string_piece(int index, const std::string& value);
+  void set_repeated_string_piece(int index, std::string&& value);
+  void set_repeated_string_piece(int index, const char* value);
+  void set_repeated_string_piece(int index, const char* value, std::size_t size);
+  void set_repeated_string_piece(int index, absl::string_view value);
+  std::string* add_repeated_string_piece();
+  void add_repeated_string_piece(const std::string& value);
+  void add_repeated_string_piece(std::string&& value);
+  void add_repeated_string_piece(const char* value);
+  void add_repeated_string_piece(const char* value, std::size_t size);
+  void add_repeated_string_piece(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string_piece() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string_piece();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string_piece() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string_piece();
+
+  public:
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  int repeated_cord_size() const;
+  private:
+  int _internal_repeated_cord_size() const;
+
+  public:
+  void clear_repeated_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& repeated_cord(int index) const;
+  std::string* mutable_repeated_cord(int index);
+  void set_repeated_cord(int index, const std::string& value);
+  void set_repeated_cord(int index, std::string&& value);
+  void set_repeated_cord(int index, const char* value);
+  void set_repeated_cord(int index, const char* value, std::size_t size);
+  void set_repeated_cord(int index, absl::string_view value);
+  std::string* add_repeated_cord();
+  void add_repeated_cord(const std::string& value);
+  void add_repeated_cord(std::string&& value);
+  void add_repeated_cord(const char* value);
+  void add_repeated_cord(const char* value, std::size_t size);
+  void add_repeated_cord(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_cord() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_cord();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_cord() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_cord();
+
+  public:
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  int repeated_lazy_message_size() const;
+  private:
+  int _internal_repeated_lazy_message_size() const;
+
+  public:
+  void clear_repeated_lazy_message() ;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* mutable_repeated_lazy_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage >*
+      mutable_repeated_lazy_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>& _internal_repeated_lazy_message() const;
+  ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>* _internal_mutable_repeated_lazy_message();
+  public:
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& repeated_lazy_message(int index) const;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* add_repeated_lazy_message();
+  const ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage >&
+      repeated_lazy_message() const;
+  // string optional_string = 14;
+  void clear_optional_string() ;
+  const std::string& optional_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string();
+  PROTOBUF_NODISCARD std::string* release_optional_string();
+  void set_allocated_optional_string(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string();
+
+  public:
+  // bytes optional_bytes = 15;
+  void clear_optional_bytes() ;
+  const std::string& optional_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_bytes();
+  PROTOBUF_NODISCARD std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_optional_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_optional_bytes();
+
+  public:
+  // string optional_string_piece = 24 [ctype = STRING_PIECE];
+  void clear_optional_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& optional_string_piece() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string_piece(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string_piece();
+  PROTOBUF_NODISCARD std::string* release_optional_string_piece();
+  void set_allocated_optional_string_piece(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string_piece() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string_piece(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string_piece();
+
+  public:
+  // string optional_cord = 25 [ctype = CORD];
+  void clear_optional_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& optional_cord() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_cord(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_cord();
+  PROTOBUF_NODISCARD std::string* release_optional_cord();
+  void set_allocated_optional_cord(std::string* value);
+
+  private:
+  const std::string& _internal_optional_cord() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_cord(
+      const std::string& value);
+  std::string* _internal_mutable_optional_cord();
+
+  public:
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+  bool has_optional_nested_message() const;
+  void clear_optional_nested_message() ;
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& optional_nested_message() const;
+  PROTOBUF_NODISCARD ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* release_optional_nested_message();
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* mutable_optional_nested_message();
+  void set_allocated_optional_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value);
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_nested_message();
+
+  private:
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& _internal_optional_nested_message() const;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_nested_message();
+
+  public:
+  // .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+  bool has_optional_foreign_message() const;
+  void clear_optional_foreign_message() ;
+  const ::proto2_nofieldpresence_unittest::ForeignMessage& optional_foreign_message() const;
+  PROTOBUF_NODISCARD ::proto2_nofieldpresence_unittest::ForeignMessage* release_optional_foreign_message();
+  ::proto2_nofieldpresence_unittest::ForeignMessage* mutable_optional_foreign_message();
+  void set_allocated_optional_foreign_message(::proto2_nofieldpresence_unittest::ForeignMessage* value);
+  void unsafe_arena_set_allocated_optional_foreign_message(::proto2_nofieldpresence_unittest::ForeignMessage* value);
+  ::proto2_nofieldpresence_unittest::ForeignMessage* unsafe_arena_release_optional_foreign_message();
+
+  private:
+  const ::proto2_nofieldpresence_unittest::ForeignMessage& _internal_optional_foreign_message() const;
+  ::proto2_nofieldpresence_unittest::ForeignMessage* _internal_mutable_optional_foreign_message();
+
+  public:
+  // .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+  bool has_optional_proto2_message() const;
+  void clear_optional_proto2_message() ;
+  const ::protobuf_unittest::TestAllTypes& optional_proto2_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllTypes* release_optional_proto2_message();
+  ::protobuf_unittest::TestAllTypes* mutable_optional_proto2_message();
+  void set_allocated_optional_proto2_message(::protobuf_unittest::TestAllTypes* value);
+  void unsafe_arena_set_allocated_optional_proto2_message(::protobuf_unittest::TestAllTypes* value);
+  ::protobuf_unittest::TestAllTypes* unsafe_arena_release_optional_proto2_message();
+
+  private:
+  const ::protobuf_unittest::TestAllTypes& _internal_optional_proto2_message() const;
+  ::protobuf_unittest::TestAllTypes* _internal_mutable_optional_proto2_message();
+
+  public:
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+  bool has_optional_lazy_message() const;
+  void clear_optional_lazy_message() ;
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& optional_lazy_message() const;
+  PROTOBUF_NODISCARD ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* release_optional_lazy_message();
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* mutable_optional_lazy_message();
+  void set_allocated_optional_lazy_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_lazy_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value);
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_lazy_message();
+
+  private:
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& _internal_optional_lazy_message() const;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_lazy_message();
+
+  public:
+  // int64 optional_int64 = 2;
+  void clear_optional_int64() ;
+  ::int64_t optional_int64() const;
+  void set_optional_int64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_int64() const;
+  void _internal_set_optional_int64(::int64_t value);
+
+  public:
+  // int32 optional_int32 = 1;
+  void clear_optional_int32() ;
+  ::int32_t optional_int32() const;
+  void set_optional_int32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_int32() const;
+  void _internal_set_optional_int32(::int32_t value);
+
+  public:
+  // uint32 optional_uint32 = 3;
+  void clear_optional_uint32() ;
+  ::uint32_t optional_uint32() const;
+  void set_optional_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_optional_uint32() const;
+  void _internal_set_optional_uint32(::uint32_t value);
+
+  public:
+  // uint64 optional_uint64 = 4;
+  void clear_optional_uint64() ;
+  ::uint64_t optional_uint64() const;
+  void set_optional_uint64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_optional_uint64() const;
+  void _internal_set_optional_uint64(::uint64_t value);
+
+  public:
+  // sint64 optional_sint64 = 6;
+  void clear_optional_sint64() ;
+  ::int64_t optional_sint64() const;
+  void set_optional_sint64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_sint64() const;
+  void _internal_set_optional_sint64(::int64_t value);
+
+  public:
+  // sint32 optional_sint32 = 5;
+  void clear_optional_sint32() ;
+  ::int32_t optional_sint32() const;
+  void set_optional_sint32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_sint32() const;
+  void _internal_set_optional_sint32(::int32_t value);
+
+  public:
+  // fixed32 optional_fixed32 = 7;
+  void clear_optional_fixed32() ;
+  ::uint32_t optional_fixed32() const;
+  void set_optional_fixed32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_optional_fixed32() const;
+  void _internal_set_optional_fixed32(::uint32_t value);
+
+  public:
+  // fixed64 optional_fixed64 = 8;
+  void clear_optional_fixed64() ;
+  ::uint64_t optional_fixed64() const;
+  void set_optional_fixed64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_optional_fixed64() const;
+  void _internal_set_optional_fixed64(::uint64_t value);
+
+  public:
+  // sfixed64 optional_sfixed64 = 10;
+  void clear_optional_sfixed64() ;
+  ::int64_t optional_sfixed64() const;
+  void set_optional_sfixed64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_sfixed64() const;
+  void _internal_set_optional_sfixed64(::int64_t value);
+
+  public:
+  // sfixed32 optional_sfixed32 = 9;
+  void clear_optional_sfixed32() ;
+  ::int32_t optional_sfixed32() const;
+  void set_optional_sfixed32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_sfixed32() const;
+  void _internal_set_optional_sfixed32(::int32_t value);
+
+  public:
+  // float optional_float = 11;
+  void clear_optional_float() ;
+  float optional_float() const;
+  void set_optional_float(float value);
+
+  private:
+  float _internal_optional_float() const;
+  void _internal_set_optional_float(float value);
+
+  public:
+  // double optional_double = 12;
+  void clear_optional_double() ;
+  double optional_double() const;
+  void set_optional_double(double value);
+
+  private:
+  double _internal_optional_double() const;
+  void _internal_set_optional_double(double value);
+
+  public:
+  // bool optional_bool = 13;
+  void clear_optional_bool() ;
+  bool optional_bool() const;
+  void set_optional_bool(bool value);
+
+  private:
+  bool _internal_optional_bool() const;
+  void _internal_set_optional_bool(bool value);
+
+  public:
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  void clear_optional_nested_enum() ;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum optional_nested_enum() const;
+  void set_optional_nested_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value);
+
+  private:
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum _internal_optional_nested_enum() const;
+  void _internal_set_optional_nested_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value);
+
+  public:
+  // .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+  void clear_optional_foreign_enum() ;
+  ::proto2_nofieldpresence_unittest::ForeignEnum optional_foreign_enum() const;
+  void set_optional_foreign_enum(::proto2_nofieldpresence_unittest::ForeignEnum value);
+
+  private:
+  ::proto2_nofieldpresence_unittest::ForeignEnum _internal_optional_foreign_enum() const;
+  void _internal_set_optional_foreign_enum(::proto2_nofieldpresence_unittest::ForeignEnum value);
+
+  public:
+  // uint32 oneof_uint32 = 111;
+  bool has_oneof_uint32() const;
+  void clear_oneof_uint32() ;
+  ::uint32_t oneof_uint32() const;
+  void set_oneof_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_oneof_uint32() const;
+  void _internal_set_oneof_uint32(::uint32_t value);
+
+  public:
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+  bool has_oneof_nested_message() const;
+  private:
+  bool _internal_has_oneof_nested_message() const;
+
+  public:
+  void clear_oneof_nested_message() ;
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& oneof_nested_message() const;
+  PROTOBUF_NODISCARD ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* release_oneof_nested_message();
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* mutable_oneof_nested_message();
+  void set_allocated_oneof_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_oneof_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value);
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_oneof_nested_message();
+
+  private:
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& _internal_oneof_nested_message() const;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _internal_mutable_oneof_nested_message();
+
+  public:
+  // string oneof_string = 113;
+  bool has_oneof_string() const;
+  void clear_oneof_string() ;
+  const std::string& oneof_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string();
+  PROTOBUF_NODISCARD std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+
+  public:
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+  bool has_oneof_enum() const;
+  void clear_oneof_enum() ;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum oneof_enum() const;
+  void set_oneof_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value);
+
+  private:
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum _internal_oneof_enum() const;
+  void _internal_set_oneof_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value);
+
+  public:
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:proto2_nofieldpresence_unittest.TestAllTypes)
+ private:
+  class _Internal;
+  void set_has_oneof_uint32();
+  void set_has_oneof_nested_message();
+  void set_has_oneof_string();
+  void set_has_oneof_enum();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 50, 9,
+      211, 17>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_int64_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_uint32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_uint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_uint64_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_uint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sint32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_sint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sint64_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_sint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_fixed32_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_fixed64_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sfixed32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sfixed64_;
+    ::google::protobuf::RepeatedField<float> repeated_float_;
+    ::google::protobuf::RepeatedField<double> repeated_double_;
+    ::google::protobuf::RepeatedField<bool> repeated_bool_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_bytes_;
+    ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage > repeated_nested_message_;
+    ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::ForeignMessage > repeated_foreign_message_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestAllTypes > repeated_proto2_message_;
+    ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_nested_enum_cached_byte_size_;
+    ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_foreign_enum_cached_byte_size_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_piece_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_cord_;
+    ::google::protobuf::RepeatedPtrField< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage > repeated_lazy_message_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_;
+    ::google::protobuf::internal::ArenaStringPtr optional_bytes_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_piece_;
+    ::google::protobuf::internal::ArenaStringPtr optional_cord_;
+    ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* optional_nested_message_;
+    ::proto2_nofieldpresence_unittest::ForeignMessage* optional_foreign_message_;
+    ::protobuf_unittest::TestAllTypes* optional_proto2_message_;
+    ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* optional_lazy_message_;
+    ::int64_t optional_int64_;
+    ::int32_t optional_int32_;
+    ::uint32_t optional_uint32_;
+    ::uint64_t optional_uint64_;
+    ::int64_t optional_sint64_;
+    ::int32_t optional_sint32_;
+    ::uint32_t optional_fixed32_;
+    ::uint64_t optional_fixed64_;
+    ::int64_t optional_sfixed64_;
+    ::int32_t optional_sfixed32_;
+    float optional_float_;
+    double optional_double_;
+    bool optional_bool_;
+    int optional_nested_enum_;
+    int optional_foreign_enum_;
+    union OneofFieldUnion {
+      constexpr OneofFieldUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::uint32_t oneof_uint32_;
+      ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* oneof_nested_message_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_;
+      int oneof_enum_;
+    } oneof_field_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestAllTypes_NestedMessage
+
+// int32 bb = 1;
+inline void TestAllTypes_NestedMessage::clear_bb() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bb_ = 0;
+}
+inline ::int32_t TestAllTypes_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage.bb)
+  return _internal_bb();
+}
+inline void TestAllTypes_NestedMessage::set_bb(::int32_t value) {
+  _internal_set_bb(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage.bb)
+}
+inline ::int32_t TestAllTypes_NestedMessage::_internal_bb() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bb_;
+}
+inline void TestAllTypes_NestedMessage::_internal_set_bb(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bb_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypes
+
+// int32 optional_int32 = 1;
+inline void TestAllTypes::clear_optional_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int32_ = 0;
+}
+inline ::int32_t TestAllTypes::optional_int32() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_int32)
+  return _internal_optional_int32();
+}
+inline void TestAllTypes::set_optional_int32(::int32_t value) {
+  _internal_set_optional_int32(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_int32)
+}
+inline ::int32_t TestAllTypes::_internal_optional_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int32_;
+}
+inline void TestAllTypes::_internal_set_optional_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_int32_ = value;
+}
+
+// int64 optional_int64 = 2;
+inline void TestAllTypes::clear_optional_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int64_ = ::int64_t{0};
+}
+inline ::int64_t TestAllTypes::optional_int64() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_int64)
+  return _internal_optional_int64();
+}
+inline void TestAllTypes::set_optional_int64(::int64_t value) {
+  _internal_set_optional_int64(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_int64)
+}
+inline ::int64_t TestAllTypes::_internal_optional_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int64_;
+}
+inline void TestAllTypes::_internal_set_optional_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_int64_ = value;
+}
+
+// uint32 optional_uint32 = 3;
+inline void TestAllTypes::clear_optional_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_uint32_ = 0u;
+}
+inline ::uint32_t TestAllTypes::optional_uint32() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_uint32)
+  return _internal_optional_uint32();
+}
+inline void TestAllTypes::set_optional_uint32(::uint32_t value) {
+  _internal_set_optional_uint32(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_uint32)
+}
+inline ::uint32_t TestAllTypes::_internal_optional_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_uint32_;
+}
+inline void TestAllTypes::_internal_set_optional_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_uint32_ = value;
+}
+
+// uint64 optional_uint64 = 4;
+inline void TestAllTypes::clear_optional_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_uint64_ = ::uint64_t{0u};
+}
+inline ::uint64_t TestAllTypes::optional_uint64() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_uint64)
+  return _internal_optional_uint64();
+}
+inline void TestAllTypes::set_optional_uint64(::uint64_t value) {
+  _internal_set_optional_uint64(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_uint64)
+}
+inline ::uint64_t TestAllTypes::_internal_optional_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_uint64_;
+}
+inline void TestAllTypes::_internal_set_optional_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_uint64_ = value;
+}
+
+// sint32 optional_sint32 = 5;
+inline void TestAllTypes::clear_optional_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sint32_ = 0;
+}
+inline ::int32_t TestAllTypes::optional_sint32() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_sint32)
+  return _internal_optional_sint32();
+}
+inline void TestAllTypes::set_optional_sint32(::int32_t value) {
+  _internal_set_optional_sint32(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_sint32)
+}
+inline ::int32_t TestAllTypes::_internal_optional_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sint32_;
+}
+inline void TestAllTypes::_internal_set_optional_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sint32_ = value;
+}
+
+// sint64 optional_sint64 = 6;
+inline void TestAllTypes::clear_optional_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sint64_ = ::int64_t{0};
+}
+inline ::int64_t TestAllTypes::optional_sint64() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_sint64)
+  return _internal_optional_sint64();
+}
+inline void TestAllTypes::set_optional_sint64(::int64_t value) {
+  _internal_set_optional_sint64(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_sint64)
+}
+inline ::int64_t TestAllTypes::_internal_optional_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sint64_;
+}
+inline void TestAllTypes::_internal_set_optional_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sint64_ = value;
+}
+
+// fixed32 optional_fixed32 = 7;
+inline void TestAllTypes::clear_optional_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_fixed32_ = 0u;
+}
+inline ::uint32_t TestAllTypes::optional_fixed32() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_fixed32)
+  return _internal_optional_fixed32();
+}
+inline void TestAllTypes::set_optional_fixed32(::uint32_t value) {
+  _internal_set_optional_fixed32(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_fixed32)
+}
+inline ::uint32_t TestAllTypes::_internal_optional_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_fixed32_;
+}
+inline void TestAllTypes::_internal_set_optional_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_fixed32_ = value;
+}
+
+// fixed64 optional_fixed64 = 8;
+inline void TestAllTypes::clear_optional_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_fixed64_ = ::uint64_t{0u};
+}
+inline ::uint64_t TestAllTypes::optional_fixed64() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_fixed64)
+  return _internal_optional_fixed64();
+}
+inline void TestAllTypes::set_optional_fixed64(::uint64_t value) {
+  _internal_set_optional_fixed64(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_fixed64)
+}
+inline ::uint64_t TestAllTypes::_internal_optional_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_fixed64_;
+}
+inline void TestAllTypes::_internal_set_optional_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_fixed64_ = value;
+}
+
+// sfixed32 optional_sfixed32 = 9;
+inline void TestAllTypes::clear_optional_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sfixed32_ = 0;
+}
+inline ::int32_t TestAllTypes::optional_sfixed32() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_sfixed32)
+  return _internal_optional_sfixed32();
+}
+inline void TestAllTypes::set_optional_sfixed32(::int32_t value) {
+  _internal_set_optional_sfixed32(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_sfixed32)
+}
+inline ::int32_t TestAllTypes::_internal_optional_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sfixed32_;
+}
+inline void TestAllTypes::_internal_set_optional_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sfixed32_ = value;
+}
+
+// sfixed64 optional_sfixed64 = 10;
+inline void TestAllTypes::clear_optional_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sfixed64_ = ::int64_t{0};
+}
+inline ::int64_t TestAllTypes::optional_sfixed64() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_sfixed64)
+  return _internal_optional_sfixed64();
+}
+inline void TestAllTypes::set_optional_sfixed64(::int64_t value) {
+  _internal_set_optional_sfixed64(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_sfixed64)
+}
+inline ::int64_t TestAllTypes::_internal_optional_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sfixed64_;
+}
+inline void TestAllTypes::_internal_set_optional_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sfixed64_ = value;
+}
+
+// float optional_float = 11;
+inline void TestAllTypes::clear_optional_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_float_ = 0;
+}
+inline float TestAllTypes::optional_float() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_float)
+  return _internal_optional_float();
+}
+inline void TestAllTypes::set_optional_float(float value) {
+  _internal_set_optional_float(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_float)
+}
+inline float TestAllTypes::_internal_optional_float() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_float_;
+}
+inline void TestAllTypes::_internal_set_optional_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_float_ = value;
+}
+
+// double optional_double = 12;
+inline void TestAllTypes::clear_optional_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_double_ = 0;
+}
+inline double TestAllTypes::optional_double() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_double)
+  return _internal_optional_double();
+}
+inline void TestAllTypes::set_optional_double(double value) {
+  _internal_set_optional_double(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_double)
+}
+inline double TestAllTypes::_internal_optional_double() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_double_;
+}
+inline void TestAllTypes::_internal_set_optional_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_double_ = value;
+}
+
+// bool optional_bool = 13;
+inline void TestAllTypes::clear_optional_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bool_ = false;
+}
+inline bool TestAllTypes::optional_bool() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_bool)
+  return _internal_optional_bool();
+}
+inline void TestAllTypes::set_optional_bool(bool value) {
+  _internal_set_optional_bool(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_bool)
+}
+inline bool TestAllTypes::_internal_optional_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bool_;
+}
+inline void TestAllTypes::_internal_set_optional_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_bool_ = value;
+}
+
+// string optional_string = 14;
+inline void TestAllTypes::clear_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_string)
+  return _internal_optional_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_string)
+}
+inline std::string* TestAllTypes::mutable_optional_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_string)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_string_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_string)
+  return _impl_.optional_string_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_.IsDefault()) {
+          _impl_.optional_string_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_string)
+}
+
+// bytes optional_bytes = 15;
+inline void TestAllTypes::clear_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bytes_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_bytes)
+  return _internal_optional_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_bytes)
+}
+inline std::string* TestAllTypes::mutable_optional_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_bytes();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bytes_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_bytes_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_bytes_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_bytes)
+  return _impl_.optional_bytes_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bytes_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_bytes_.IsDefault()) {
+          _impl_.optional_bytes_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_bytes)
+}
+
+// .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+inline bool TestAllTypes::has_optional_nested_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_nested_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_nested_message_ != nullptr) _impl_.optional_nested_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_nested_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* p = _impl_.optional_nested_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage&>(::proto2_nofieldpresence_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_message)
+  return _internal_optional_nested_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_nested_message_);
+  }
+  _impl_.optional_nested_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_message)
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* released = _impl_.optional_nested_message_;
+  _impl_.optional_nested_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_message)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* temp = _impl_.optional_nested_message_;
+  _impl_.optional_nested_message_ = nullptr;
+  return temp;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.optional_nested_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>(GetArena());
+    _impl_.optional_nested_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(p);
+  }
+  return _impl_.optional_nested_message_;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_optional_nested_message();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(_impl_.optional_nested_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.optional_nested_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_message)
+}
+
+// .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+inline bool TestAllTypes::has_optional_foreign_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_foreign_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_foreign_message_ != nullptr) _impl_.optional_foreign_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto2_nofieldpresence_unittest::ForeignMessage& TestAllTypes::_internal_optional_foreign_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto2_nofieldpresence_unittest::ForeignMessage* p = _impl_.optional_foreign_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto2_nofieldpresence_unittest::ForeignMessage&>(::proto2_nofieldpresence_unittest::_ForeignMessage_default_instance_);
+}
+inline const ::proto2_nofieldpresence_unittest::ForeignMessage& TestAllTypes::optional_foreign_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_message)
+  return _internal_optional_foreign_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_foreign_message(::proto2_nofieldpresence_unittest::ForeignMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_foreign_message_);
+  }
+  _impl_.optional_foreign_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::ForeignMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_message)
+}
+inline ::proto2_nofieldpresence_unittest::ForeignMessage* TestAllTypes::release_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto2_nofieldpresence_unittest::ForeignMessage* released = _impl_.optional_foreign_message_;
+  _impl_.optional_foreign_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto2_nofieldpresence_unittest::ForeignMessage* TestAllTypes::unsafe_arena_release_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_message)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto2_nofieldpresence_unittest::ForeignMessage* temp = _impl_.optional_foreign_message_;
+  _impl_.optional_foreign_message_ = nullptr;
+  return temp;
+}
+inline ::proto2_nofieldpresence_unittest::ForeignMessage* TestAllTypes::_internal_mutable_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.optional_foreign_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto2_nofieldpresence_unittest::ForeignMessage>(GetArena());
+    _impl_.optional_foreign_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::ForeignMessage*>(p);
+  }
+  return _impl_.optional_foreign_message_;
+}
+inline ::proto2_nofieldpresence_unittest::ForeignMessage* TestAllTypes::mutable_optional_foreign_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto2_nofieldpresence_unittest::ForeignMessage* _msg = _internal_mutable_optional_foreign_message();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_foreign_message(::proto2_nofieldpresence_unittest::ForeignMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto2_nofieldpresence_unittest::ForeignMessage*>(_impl_.optional_foreign_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto2_nofieldpresence_unittest::ForeignMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.optional_foreign_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::ForeignMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_message)
+}
+
+// .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+inline bool TestAllTypes::has_optional_proto2_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_proto2_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest::TestAllTypes& TestAllTypes::_internal_optional_proto2_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllTypes* p = _impl_.optional_proto2_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllTypes&>(::protobuf_unittest::_TestAllTypes_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypes& TestAllTypes::optional_proto2_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_proto2_message)
+  return _internal_optional_proto2_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_proto2_message(::protobuf_unittest::TestAllTypes* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_proto2_message_);
+  }
+  _impl_.optional_proto2_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypes*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_proto2_message)
+}
+inline ::protobuf_unittest::TestAllTypes* TestAllTypes::release_optional_proto2_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest::TestAllTypes* released = _impl_.optional_proto2_message_;
+  _impl_.optional_proto2_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllTypes* TestAllTypes::unsafe_arena_release_optional_proto2_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_proto2_message)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest::TestAllTypes* temp = _impl_.optional_proto2_message_;
+  _impl_.optional_proto2_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypes* TestAllTypes::_internal_mutable_optional_proto2_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.optional_proto2_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypes>(GetArena());
+    _impl_.optional_proto2_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypes*>(p);
+  }
+  return _impl_.optional_proto2_message_;
+}
+inline ::protobuf_unittest::TestAllTypes* TestAllTypes::mutable_optional_proto2_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllTypes* _msg = _internal_mutable_optional_proto2_message();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_proto2_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_proto2_message(::protobuf_unittest::TestAllTypes* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_proto2_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.optional_proto2_message_ = reinterpret_cast<::protobuf_unittest::TestAllTypes*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_proto2_message)
+}
+
+// .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+inline void TestAllTypes::clear_optional_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_nested_enum_ = 0;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum TestAllTypes::optional_nested_enum() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_enum)
+  return _internal_optional_nested_enum();
+}
+inline void TestAllTypes::set_optional_nested_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value) {
+  _internal_set_optional_nested_enum(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_nested_enum)
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum TestAllTypes::_internal_optional_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(_impl_.optional_nested_enum_);
+}
+inline void TestAllTypes::_internal_set_optional_nested_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_nested_enum_ = value;
+}
+
+// .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+inline void TestAllTypes::clear_optional_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_foreign_enum_ = 0;
+}
+inline ::proto2_nofieldpresence_unittest::ForeignEnum TestAllTypes::optional_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_enum)
+  return _internal_optional_foreign_enum();
+}
+inline void TestAllTypes::set_optional_foreign_enum(::proto2_nofieldpresence_unittest::ForeignEnum value) {
+  _internal_set_optional_foreign_enum(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_foreign_enum)
+}
+inline ::proto2_nofieldpresence_unittest::ForeignEnum TestAllTypes::_internal_optional_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto2_nofieldpresence_unittest::ForeignEnum>(_impl_.optional_foreign_enum_);
+}
+inline void TestAllTypes::_internal_set_optional_foreign_enum(::proto2_nofieldpresence_unittest::ForeignEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_foreign_enum_ = value;
+}
+
+// string optional_string_piece = 24 [ctype = STRING_PIECE];
+inline void TestAllTypes::clear_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_piece_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_string_piece() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece)
+  return _internal_optional_string_piece();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_string_piece(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_piece_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece)
+}
+inline std::string* TestAllTypes::mutable_optional_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string_piece();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_piece_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_piece_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_string_piece_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece)
+  return _impl_.optional_string_piece_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_string_piece(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_piece_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_piece_.IsDefault()) {
+          _impl_.optional_string_piece_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece)
+}
+
+// string optional_cord = 25 [ctype = CORD];
+inline void TestAllTypes::clear_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_cord_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_cord() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_cord)
+  return _internal_optional_cord();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_cord(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_cord_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.optional_cord)
+}
+inline std::string* TestAllTypes::mutable_optional_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_cord();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_cord)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_cord_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_cord_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_cord_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_cord)
+  return _impl_.optional_cord_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_cord(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_cord_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_cord_.IsDefault()) {
+          _impl_.optional_cord_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_cord)
+}
+
+// .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+inline bool TestAllTypes::has_optional_lazy_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_lazy_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_lazy_message_ != nullptr) _impl_.optional_lazy_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* p = _impl_.optional_lazy_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage&>(::proto2_nofieldpresence_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_lazy_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.optional_lazy_message)
+  return _internal_optional_lazy_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_lazy_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_lazy_message_);
+  }
+  _impl_.optional_lazy_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_lazy_message)
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* released = _impl_.optional_lazy_message_;
+  _impl_.optional_lazy_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.optional_lazy_message)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* temp = _impl_.optional_lazy_message_;
+  _impl_.optional_lazy_message_ = nullptr;
+  return temp;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.optional_lazy_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>(GetArena());
+    _impl_.optional_lazy_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(p);
+  }
+  return _impl_.optional_lazy_message_;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_optional_lazy_message();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.optional_lazy_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_lazy_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(_impl_.optional_lazy_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.optional_lazy_message_ = reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.optional_lazy_message)
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestAllTypes::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int TestAllTypes::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestAllTypes::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t TestAllTypes::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void TestAllTypes::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int32)
+}
+inline void TestAllTypes::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestAllTypes::_internal_repeated_int64_size() const {
+  return _internal_repeated_int64().size();
+}
+inline int TestAllTypes::repeated_int64_size() const {
+  return _internal_repeated_int64_size();
+}
+inline void TestAllTypes::clear_repeated_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int64_.Clear();
+}
+inline ::int64_t TestAllTypes::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int64)
+  return _internal_repeated_int64().Get(index);
+}
+inline void TestAllTypes::set_repeated_int64(int index, ::int64_t value) {
+  _internal_mutable_repeated_int64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int64)
+}
+inline void TestAllTypes::add_repeated_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::repeated_int64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int64)
+  return _internal_repeated_int64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::mutable_repeated_int64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_int64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::_internal_repeated_int64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::_internal_mutable_repeated_int64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestAllTypes::_internal_repeated_uint32_size() const {
+  return _internal_repeated_uint32().size();
+}
+inline int TestAllTypes::repeated_uint32_size() const {
+  return _internal_repeated_uint32_size();
+}
+inline void TestAllTypes::clear_repeated_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint32_.Clear();
+}
+inline ::uint32_t TestAllTypes::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint32)
+  return _internal_repeated_uint32().Get(index);
+}
+inline void TestAllTypes::set_repeated_uint32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_uint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint32)
+}
+inline void TestAllTypes::add_repeated_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::repeated_uint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint32)
+  return _internal_repeated_uint32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::mutable_repeated_uint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::_internal_repeated_uint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::_internal_mutable_repeated_uint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestAllTypes::_internal_repeated_uint64_size() const {
+  return _internal_repeated_uint64().size();
+}
+inline int TestAllTypes::repeated_uint64_size() const {
+  return _internal_repeated_uint64_size();
+}
+inline void TestAllTypes::clear_repeated_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint64_.Clear();
+}
+inline ::uint64_t TestAllTypes::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint64)
+  return _internal_repeated_uint64().Get(index);
+}
+inline void TestAllTypes::set_repeated_uint64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_uint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint64)
+}
+inline void TestAllTypes::add_repeated_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::repeated_uint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint64)
+  return _internal_repeated_uint64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::mutable_repeated_uint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_uint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::_internal_repeated_uint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::_internal_mutable_repeated_uint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestAllTypes::_internal_repeated_sint32_size() const {
+  return _internal_repeated_sint32().size();
+}
+inline int TestAllTypes::repeated_sint32_size() const {
+  return _internal_repeated_sint32_size();
+}
+inline void TestAllTypes::clear_repeated_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint32_.Clear();
+}
+inline ::int32_t TestAllTypes::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint32)
+  return _internal_repeated_sint32().Get(index);
+}
+inline void TestAllTypes::set_repeated_sint32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint32)
+}
+inline void TestAllTypes::add_repeated_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::repeated_sint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint32)
+  return _internal_repeated_sint32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::mutable_repeated_sint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::_internal_repeated_sint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::_internal_mutable_repeated_sint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestAllTypes::_internal_repeated_sint64_size() const {
+  return _internal_repeated_sint64().size();
+}
+inline int TestAllTypes::repeated_sint64_size() const {
+  return _internal_repeated_sint64_size();
+}
+inline void TestAllTypes::clear_repeated_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint64_.Clear();
+}
+inline ::int64_t TestAllTypes::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint64)
+  return _internal_repeated_sint64().Get(index);
+}
+inline void TestAllTypes::set_repeated_sint64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint64)
+}
+inline void TestAllTypes::add_repeated_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::repeated_sint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint64)
+  return _internal_repeated_sint64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::mutable_repeated_sint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::_internal_repeated_sint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::_internal_mutable_repeated_sint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestAllTypes::_internal_repeated_fixed32_size() const {
+  return _internal_repeated_fixed32().size();
+}
+inline int TestAllTypes::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void TestAllTypes::clear_repeated_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed32_.Clear();
+}
+inline ::uint32_t TestAllTypes::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_repeated_fixed32().Get(index);
+}
+inline void TestAllTypes::set_repeated_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed32)
+}
+inline void TestAllTypes::add_repeated_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::repeated_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::mutable_repeated_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::_internal_repeated_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::_internal_mutable_repeated_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestAllTypes::_internal_repeated_fixed64_size() const {
+  return _internal_repeated_fixed64().size();
+}
+inline int TestAllTypes::repeated_fixed64_size() const {
+  return _internal_repeated_fixed64_size();
+}
+inline void TestAllTypes::clear_repeated_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed64_.Clear();
+}
+inline ::uint64_t TestAllTypes::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_repeated_fixed64().Get(index);
+}
+inline void TestAllTypes::set_repeated_fixed64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_fixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed64)
+}
+inline void TestAllTypes::add_repeated_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::repeated_fixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_repeated_fixed64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::mutable_repeated_fixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_fixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::_internal_repeated_fixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::_internal_mutable_repeated_fixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestAllTypes::_internal_repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32().size();
+}
+inline int TestAllTypes::repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32_size();
+}
+inline void TestAllTypes::clear_repeated_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed32_.Clear();
+}
+inline ::int32_t TestAllTypes::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32().Get(index);
+}
+inline void TestAllTypes::set_repeated_sfixed32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sfixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed32)
+}
+inline void TestAllTypes::add_repeated_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::repeated_sfixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::mutable_repeated_sfixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::_internal_repeated_sfixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::_internal_mutable_repeated_sfixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestAllTypes::_internal_repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64().size();
+}
+inline int TestAllTypes::repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64_size();
+}
+inline void TestAllTypes::clear_repeated_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed64_.Clear();
+}
+inline ::int64_t TestAllTypes::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64().Get(index);
+}
+inline void TestAllTypes::set_repeated_sfixed64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sfixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed64)
+}
+inline void TestAllTypes::add_repeated_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::repeated_sfixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::mutable_repeated_sfixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_sfixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::_internal_repeated_sfixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::_internal_mutable_repeated_sfixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+inline int TestAllTypes::_internal_repeated_float_size() const {
+  return _internal_repeated_float().size();
+}
+inline int TestAllTypes::repeated_float_size() const {
+  return _internal_repeated_float_size();
+}
+inline void TestAllTypes::clear_repeated_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_float_.Clear();
+}
+inline float TestAllTypes::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_float)
+  return _internal_repeated_float().Get(index);
+}
+inline void TestAllTypes::set_repeated_float(int index, float value) {
+  _internal_mutable_repeated_float()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_float)
+}
+inline void TestAllTypes::add_repeated_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_float()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_float)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestAllTypes::repeated_float() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_float)
+  return _internal_repeated_float();
+}
+inline ::google::protobuf::RepeatedField<float>* TestAllTypes::mutable_repeated_float()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_float)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_float();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestAllTypes::_internal_repeated_float()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_float_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestAllTypes::_internal_mutable_repeated_float() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+inline int TestAllTypes::_internal_repeated_double_size() const {
+  return _internal_repeated_double().size();
+}
+inline int TestAllTypes::repeated_double_size() const {
+  return _internal_repeated_double_size();
+}
+inline void TestAllTypes::clear_repeated_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_double_.Clear();
+}
+inline double TestAllTypes::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_double)
+  return _internal_repeated_double().Get(index);
+}
+inline void TestAllTypes::set_repeated_double(int index, double value) {
+  _internal_mutable_repeated_double()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_double)
+}
+inline void TestAllTypes::add_repeated_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_double()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_double)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestAllTypes::repeated_double() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_double)
+  return _internal_repeated_double();
+}
+inline ::google::protobuf::RepeatedField<double>* TestAllTypes::mutable_repeated_double()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_double)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_double();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestAllTypes::_internal_repeated_double()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_double_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestAllTypes::_internal_mutable_repeated_double() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestAllTypes::_internal_repeated_bool_size() const {
+  return _internal_repeated_bool().size();
+}
+inline int TestAllTypes::repeated_bool_size() const {
+  return _internal_repeated_bool_size();
+}
+inline void TestAllTypes::clear_repeated_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bool_.Clear();
+}
+inline bool TestAllTypes::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bool)
+  return _internal_repeated_bool().Get(index);
+}
+inline void TestAllTypes::set_repeated_bool(int index, bool value) {
+  _internal_mutable_repeated_bool()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bool)
+}
+inline void TestAllTypes::add_repeated_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bool()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bool)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestAllTypes::repeated_bool() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bool)
+  return _internal_repeated_bool();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestAllTypes::mutable_repeated_bool()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bool)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bool();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestAllTypes::_internal_repeated_bool()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestAllTypes::_internal_mutable_repeated_bool() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+inline int TestAllTypes::_internal_repeated_string_size() const {
+  return _internal_repeated_string().size();
+}
+inline int TestAllTypes::repeated_string_size() const {
+  return _internal_repeated_string_size();
+}
+inline void TestAllTypes::clear_repeated_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_string()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_string(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+  return _internal_repeated_string().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_string(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+  return _internal_mutable_repeated_string()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_string(int index, const std::string& value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, std::string&& value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, absl::string_view value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+  return _internal_repeated_string();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_string() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestAllTypes::_internal_repeated_bytes_size() const {
+  return _internal_repeated_bytes().size();
+}
+inline int TestAllTypes::repeated_bytes_size() const {
+  return _internal_repeated_bytes_size();
+}
+inline void TestAllTypes::clear_repeated_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bytes_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_bytes()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_bytes()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_bytes(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+  return _internal_repeated_bytes().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_bytes(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+  return _internal_mutable_repeated_bytes()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const std::string& value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, std::string&& value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const void* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, absl::string_view value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const void* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_bytes() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+  return _internal_repeated_bytes();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_bytes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bytes();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bytes_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_bytes() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bytes_;
+}
+
+// repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+inline int TestAllTypes::_internal_repeated_nested_message_size() const {
+  return _internal_repeated_nested_message().size();
+}
+inline int TestAllTypes::repeated_nested_message_size() const {
+  return _internal_repeated_nested_message_size();
+}
+inline void TestAllTypes::clear_repeated_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_message_.Clear();
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_repeated_nested_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_mutable_repeated_nested_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>* TestAllTypes::mutable_repeated_nested_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_message();
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::repeated_nested_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_repeated_nested_message().Get(index);
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::add_repeated_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _add = _internal_mutable_repeated_nested_message()->Add();
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>& TestAllTypes::repeated_nested_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_repeated_nested_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>&
+TestAllTypes::_internal_repeated_nested_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>*
+TestAllTypes::_internal_mutable_repeated_nested_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_message_;
+}
+
+// repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+inline int TestAllTypes::_internal_repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message().size();
+}
+inline int TestAllTypes::repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message_size();
+}
+inline void TestAllTypes::clear_repeated_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_foreign_message_.Clear();
+}
+inline ::proto2_nofieldpresence_unittest::ForeignMessage* TestAllTypes::mutable_repeated_foreign_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_mutable_repeated_foreign_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::ForeignMessage>* TestAllTypes::mutable_repeated_foreign_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_foreign_message();
+}
+inline const ::proto2_nofieldpresence_unittest::ForeignMessage& TestAllTypes::repeated_foreign_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_repeated_foreign_message().Get(index);
+}
+inline ::proto2_nofieldpresence_unittest::ForeignMessage* TestAllTypes::add_repeated_foreign_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto2_nofieldpresence_unittest::ForeignMessage* _add = _internal_mutable_repeated_foreign_message()->Add();
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::ForeignMessage>& TestAllTypes::repeated_foreign_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_repeated_foreign_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::ForeignMessage>&
+TestAllTypes::_internal_repeated_foreign_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_foreign_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::ForeignMessage>*
+TestAllTypes::_internal_mutable_repeated_foreign_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+inline int TestAllTypes::_internal_repeated_proto2_message_size() const {
+  return _internal_repeated_proto2_message().size();
+}
+inline int TestAllTypes::repeated_proto2_message_size() const {
+  return _internal_repeated_proto2_message_size();
+}
+inline ::protobuf_unittest::TestAllTypes* TestAllTypes::mutable_repeated_proto2_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_proto2_message)
+  return _internal_mutable_repeated_proto2_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypes>* TestAllTypes::mutable_repeated_proto2_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_proto2_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_proto2_message();
+}
+inline const ::protobuf_unittest::TestAllTypes& TestAllTypes::repeated_proto2_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_proto2_message)
+  return _internal_repeated_proto2_message().Get(index);
+}
+inline ::protobuf_unittest::TestAllTypes* TestAllTypes::add_repeated_proto2_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest::TestAllTypes* _add = _internal_mutable_repeated_proto2_message()->Add();
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_proto2_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypes>& TestAllTypes::repeated_proto2_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_proto2_message)
+  return _internal_repeated_proto2_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypes>&
+TestAllTypes::_internal_repeated_proto2_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_proto2_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest::TestAllTypes>*
+TestAllTypes::_internal_mutable_repeated_proto2_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_proto2_message_;
+}
+
+// repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+inline int TestAllTypes::_internal_repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum().size();
+}
+inline int TestAllTypes::repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum_size();
+}
+inline void TestAllTypes::clear_repeated_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_enum_.Clear();
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum TestAllTypes::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_enum)
+  return static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(_internal_repeated_nested_enum().Get(index));
+}
+inline void TestAllTypes::set_repeated_nested_enum(int index, ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value) {
+  _internal_mutable_repeated_nested_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_enum)
+}
+inline void TestAllTypes::add_repeated_nested_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_nested_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::repeated_nested_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_enum)
+  return _internal_repeated_nested_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::mutable_repeated_nested_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_nested_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::_internal_repeated_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::_internal_mutable_repeated_nested_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_enum_;
+}
+
+// repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+inline int TestAllTypes::_internal_repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum().size();
+}
+inline int TestAllTypes::repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum_size();
+}
+inline void TestAllTypes::clear_repeated_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_foreign_enum_.Clear();
+}
+inline ::proto2_nofieldpresence_unittest::ForeignEnum TestAllTypes::repeated_foreign_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_enum)
+  return static_cast<::proto2_nofieldpresence_unittest::ForeignEnum>(_internal_repeated_foreign_enum().Get(index));
+}
+inline void TestAllTypes::set_repeated_foreign_enum(int index, ::proto2_nofieldpresence_unittest::ForeignEnum value) {
+  _internal_mutable_repeated_foreign_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_enum)
+}
+inline void TestAllTypes::add_repeated_foreign_enum(::proto2_nofieldpresence_unittest::ForeignEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_foreign_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::repeated_foreign_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_enum)
+  return _internal_repeated_foreign_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::mutable_repeated_foreign_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_foreign_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_foreign_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::_internal_repeated_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_foreign_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::_internal_mutable_repeated_foreign_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_foreign_enum_;
+}
+
+// repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+inline int TestAllTypes::_internal_repeated_string_piece_size() const {
+  return _internal_repeated_string_piece().size();
+}
+inline int TestAllTypes::repeated_string_piece_size() const {
+  return _internal_repeated_string_piece_size();
+}
+inline void TestAllTypes::clear_repeated_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_piece_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_string_piece()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string_piece()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_string_piece(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_repeated_string_piece().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_string_piece(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_mutable_repeated_string_piece()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const std::string& value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, std::string&& value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, absl::string_view value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_string_piece() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_repeated_string_piece();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string_piece();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_piece_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_string_piece() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_piece_;
+}
+
+// repeated string repeated_cord = 55 [ctype = CORD];
+inline int TestAllTypes::_internal_repeated_cord_size() const {
+  return _internal_repeated_cord().size();
+}
+inline int TestAllTypes::repeated_cord_size() const {
+  return _internal_repeated_cord_size();
+}
+inline void TestAllTypes::clear_repeated_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_cord_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_cord()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_cord()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_cord(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+  return _internal_repeated_cord().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_cord(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+  return _internal_mutable_repeated_cord()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_cord(int index, const std::string& value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, std::string&& value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, absl::string_view value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_cord() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+  return _internal_repeated_cord();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_cord();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_cord_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_cord() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_cord_;
+}
+
+// repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+inline int TestAllTypes::_internal_repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message().size();
+}
+inline int TestAllTypes::repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message_size();
+}
+inline void TestAllTypes::clear_repeated_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_lazy_message_.Clear();
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_repeated_lazy_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_mutable_repeated_lazy_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>* TestAllTypes::mutable_repeated_lazy_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_lazy_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_lazy_message();
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::repeated_lazy_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_repeated_lazy_message().Get(index);
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::add_repeated_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _add = _internal_mutable_repeated_lazy_message()->Add();
+  // @@protoc_insertion_point(field_add:proto2_nofieldpresence_unittest.TestAllTypes.repeated_lazy_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>& TestAllTypes::repeated_lazy_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_nofieldpresence_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_repeated_lazy_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>&
+TestAllTypes::_internal_repeated_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_lazy_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>*
+TestAllTypes::_internal_mutable_repeated_lazy_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_lazy_message_;
+}
+
+// uint32 oneof_uint32 = 111;
+inline bool TestAllTypes::has_oneof_uint32() const {
+  return oneof_field_case() == kOneofUint32;
+}
+inline void TestAllTypes::set_has_oneof_uint32() {
+  _impl_._oneof_case_[0] = kOneofUint32;
+}
+inline void TestAllTypes::clear_oneof_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofUint32) {
+    _impl_.oneof_field_.oneof_uint32_ = 0u;
+    clear_has_oneof_field();
+  }
+}
+inline ::uint32_t TestAllTypes::oneof_uint32() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.oneof_uint32)
+  return _internal_oneof_uint32();
+}
+inline void TestAllTypes::set_oneof_uint32(::uint32_t value) {
+  _internal_set_oneof_uint32(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.oneof_uint32)
+}
+inline ::uint32_t TestAllTypes::_internal_oneof_uint32() const {
+  if (oneof_field_case() == kOneofUint32) {
+    return _impl_.oneof_field_.oneof_uint32_;
+  }
+  return 0u;
+}
+inline void TestAllTypes::_internal_set_oneof_uint32(::uint32_t value) {
+  if (oneof_field_case() != kOneofUint32) {
+    clear_oneof_field();
+    set_has_oneof_uint32();
+  }
+  _impl_.oneof_field_.oneof_uint32_ = value;
+}
+
+// .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+inline bool TestAllTypes::has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline bool TestAllTypes::_internal_has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline void TestAllTypes::set_has_oneof_nested_message() {
+  _impl_._oneof_case_[0] = kOneofNestedMessage;
+}
+inline void TestAllTypes::clear_oneof_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofNestedMessage) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_nested_message_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.oneof_nested_message)
+  if (oneof_field_case() == kOneofNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage ? *_impl_.oneof_field_.oneof_nested_message_ : reinterpret_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage&>(::proto2_nofieldpresence_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& TestAllTypes::oneof_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.oneof_nested_message)
+  return _internal_oneof_nested_message();
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto2_nofieldpresence_unittest.TestAllTypes.oneof_nested_message)
+  if (oneof_field_case() == kOneofNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message_;
+    _impl_.oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_oneof_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_nested_message();
+    _impl_.oneof_field_.oneof_nested_message_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.oneof_nested_message)
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_oneof_nested_message() {
+  if (oneof_field_case() != kOneofNestedMessage) {
+    clear_oneof_field();
+    set_has_oneof_nested_message();
+    _impl_.oneof_field_.oneof_nested_message_ = CreateMaybeMessage<::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_nested_message_;
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_oneof_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_oneof_nested_message();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.oneof_nested_message)
+  return _msg;
+}
+
+// string oneof_string = 113;
+inline bool TestAllTypes::has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline void TestAllTypes::set_has_oneof_string() {
+  _impl_._oneof_case_[0] = kOneofString;
+}
+inline void TestAllTypes::clear_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofString) {
+    _impl_.oneof_field_.oneof_string_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypes::oneof_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.oneof_string)
+  return _internal_oneof_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_oneof_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.oneof_string)
+}
+inline std::string* TestAllTypes::mutable_oneof_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestAllTypes.oneof_string)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_oneof_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_string_.Get();
+}
+inline void TestAllTypes::_internal_set_oneof_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestAllTypes.oneof_string)
+  if (oneof_field_case() != kOneofString) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_.Release();
+}
+inline void TestAllTypes::set_allocated_oneof_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.oneof_string)
+}
+
+// .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+inline bool TestAllTypes::has_oneof_enum() const {
+  return oneof_field_case() == kOneofEnum;
+}
+inline void TestAllTypes::set_has_oneof_enum() {
+  _impl_._oneof_case_[0] = kOneofEnum;
+}
+inline void TestAllTypes::clear_oneof_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofEnum) {
+    _impl_.oneof_field_.oneof_enum_ = 0;
+    clear_has_oneof_field();
+  }
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum TestAllTypes::oneof_enum() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestAllTypes.oneof_enum)
+  return _internal_oneof_enum();
+}
+inline void TestAllTypes::set_oneof_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value) {
+  _internal_set_oneof_enum(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.TestAllTypes.oneof_enum)
+}
+inline ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum TestAllTypes::_internal_oneof_enum() const {
+  if (oneof_field_case() == kOneofEnum) {
+    return static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(_impl_.oneof_field_.oneof_enum_);
+  }
+  return static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(0);
+}
+inline void TestAllTypes::_internal_set_oneof_enum(::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum value) {
+  if (oneof_field_case() != kOneofEnum) {
+    clear_oneof_field();
+    set_has_oneof_enum();
+  }
+  _impl_.oneof_field_.oneof_enum_ = value;
+}
+
+inline bool TestAllTypes::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestAllTypes::clear_has_oneof_field() {
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestAllTypes::OneofFieldCase TestAllTypes::oneof_field_case() const {
+  return TestAllTypes::OneofFieldCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TestProto2Required
+
+// .protobuf_unittest.TestRequired proto2 = 1;
+inline bool TestProto2Required::has_proto2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.proto2_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest::TestRequired& TestProto2Required::_internal_proto2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestRequired* p = _impl_.proto2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestRequired&>(::protobuf_unittest::_TestRequired_default_instance_);
+}
+inline const ::protobuf_unittest::TestRequired& TestProto2Required::proto2() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.TestProto2Required.proto2)
+  return _internal_proto2();
+}
+inline void TestProto2Required::unsafe_arena_set_allocated_proto2(::protobuf_unittest::TestRequired* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.proto2_);
+  }
+  _impl_.proto2_ = reinterpret_cast<::protobuf_unittest::TestRequired*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto2_nofieldpresence_unittest.TestProto2Required.proto2)
+}
+inline ::protobuf_unittest::TestRequired* TestProto2Required::release_proto2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestRequired* released = _impl_.proto2_;
+  _impl_.proto2_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestRequired* TestProto2Required::unsafe_arena_release_proto2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto2_nofieldpresence_unittest.TestProto2Required.proto2)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestRequired* temp = _impl_.proto2_;
+  _impl_.proto2_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestRequired* TestProto2Required::_internal_mutable_proto2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.proto2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestRequired>(GetArena());
+    _impl_.proto2_ = reinterpret_cast<::protobuf_unittest::TestRequired*>(p);
+  }
+  return _impl_.proto2_;
+}
+inline ::protobuf_unittest::TestRequired* TestProto2Required::mutable_proto2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestRequired* _msg = _internal_mutable_proto2();
+  // @@protoc_insertion_point(field_mutable:proto2_nofieldpresence_unittest.TestProto2Required.proto2)
+  return _msg;
+}
+inline void TestProto2Required::set_allocated_proto2(::protobuf_unittest::TestRequired* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.proto2_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.proto2_ = reinterpret_cast<::protobuf_unittest::TestRequired*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestProto2Required.proto2)
+}
+
+// -------------------------------------------------------------------
+
+// ForeignMessage
+
+// int32 c = 1;
+inline void ForeignMessage::clear_c() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.c_ = 0;
+}
+inline ::int32_t ForeignMessage::c() const {
+  // @@protoc_insertion_point(field_get:proto2_nofieldpresence_unittest.ForeignMessage.c)
+  return _internal_c();
+}
+inline void ForeignMessage::set_c(::int32_t value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:proto2_nofieldpresence_unittest.ForeignMessage.c)
+}
+inline ::int32_t ForeignMessage::_internal_c() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.c_;
+}
+inline void ForeignMessage::_internal_set_c(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.c_ = value;
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto2_nofieldpresence_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>() {
+  return ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::proto2_nofieldpresence_unittest::ForeignEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto2_nofieldpresence_unittest::ForeignEnum>() {
+  return ::proto2_nofieldpresence_unittest::ForeignEnum_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto_2epb_2eh
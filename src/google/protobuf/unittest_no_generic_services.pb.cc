@@ -0,0 +1,350 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_no_generic_services.proto
+
+#include "google/protobuf/unittest_no_generic_services.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+namespace no_generic_services_test {
+
+inline constexpr TestMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        a_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessage::TestMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageDefaultTypeInternal() {}
+  union {
+    TestMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageDefaultTypeInternal _TestMessage_default_instance_;
+}  // namespace no_generic_services_test
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto[1];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::no_generic_services_test::TestMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::no_generic_services_test::TestMessage, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::no_generic_services_test::TestMessage, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::no_generic_services_test::TestMessage, _impl_.a_),
+    0,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 9, -1, sizeof(::protobuf_unittest::no_generic_services_test::TestMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::no_generic_services_test::_TestMessage_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n2google/protobuf/unittest_no_generic_se"
+    "rvices.proto\022*protobuf_unittest.no_gener"
+    "ic_services_test\"#\n\013TestMessage\022\t\n\001a\030\001 \001"
+    "(\005*\t\010\350\007\020\200\200\200\200\002*\023\n\010TestEnum\022\007\n\003FOO\020\0012\206\001\n\013T"
+    "estService\022w\n\003Foo\0227.protobuf_unittest.no"
+    "_generic_services_test.TestMessage\0327.pro"
+    "tobuf_unittest.no_generic_services_test."
+    "TestMessage:P\n\016test_extension\0227.protobuf"
+    "_unittest.no_generic_services_test.TestM"
+    "essage\030\350\007 \001(\005"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto = {
+    false,
+    false,
+    373,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto,
+    "google/protobuf/unittest_no_generic_services.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_once,
+    nullptr,
+    0,
+    1,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto);
+namespace protobuf_unittest {
+namespace no_generic_services_test {
+const ::google::protobuf::EnumDescriptor* TestEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t TestEnum_internal_data_[] = {
+    65537u, 0u, };
+bool TestEnum_IsValid(int value) {
+  return 1 <= value && value <= 1;
+}
+// ===================================================================
+
+class TestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessage, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestMessage::TestMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.no_generic_services_test.TestMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestMessage::TestMessage(
+    ::google::protobuf::Arena* arena,
+    const TestMessage& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+  _impl_.a_ = from._impl_.a_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.no_generic_services_test.TestMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.a_ = {};
+}
+TestMessage::~TestMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.no_generic_services_test.TestMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.no_generic_services_test.TestMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.a_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> TestMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(TestMessage, _impl_._extensions_),
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional int32 a = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestMessage, _impl_.a_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.a_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 a = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.a_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.no_generic_services_test.TestMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 a = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_a(), target);
+  }
+
+  // Extension range [1000, 536870912)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 1000, 536870912, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.no_generic_services_test.TestMessage)
+  return target;
+}
+
+::size_t TestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.no_generic_services_test.TestMessage)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_a());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessage::_class_data_ = {
+    TestMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessage*>(&to_msg);
+  auto& from = static_cast<const TestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.no_generic_services_test.TestMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_a(from._internal_a());
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessage::CopyFrom(const TestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.no_generic_services_test.TestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessage::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessage::InternalSwap(TestMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.a_, other->_impl_.a_);
+}
+
+::google::protobuf::Metadata TestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto[0]);
+}
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::no_generic_services_test::TestMessage,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  test_extension(kTestExtensionFieldNumber, 0, nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace no_generic_services_test
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,480 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_optimize_for.proto
+
+#include "google/protobuf/unittest_optimize_for.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace protobuf_unittest {
+
+inline constexpr TestRequiredOptimizedForSize::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        x_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestRequiredOptimizedForSize::TestRequiredOptimizedForSize(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestRequiredOptimizedForSizeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestRequiredOptimizedForSizeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestRequiredOptimizedForSizeDefaultTypeInternal() {}
+  union {
+    TestRequiredOptimizedForSize _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestRequiredOptimizedForSizeDefaultTypeInternal _TestRequiredOptimizedForSize_default_instance_;
+
+inline constexpr TestOptionalOptimizedForSize::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        o_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestOptionalOptimizedForSize::TestOptionalOptimizedForSize(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestOptionalOptimizedForSizeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestOptionalOptimizedForSizeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestOptionalOptimizedForSizeDefaultTypeInternal() {}
+  union {
+    TestOptionalOptimizedForSize _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestOptionalOptimizedForSizeDefaultTypeInternal _TestOptionalOptimizedForSize_default_instance_;
+
+inline constexpr TestOptimizedForSize::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        msg_{nullptr},
+        i_{0},
+        foo_{},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestOptimizedForSize::TestOptimizedForSize(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestOptimizedForSizeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestOptimizedForSizeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestOptimizedForSizeDefaultTypeInternal() {}
+  union {
+    TestOptimizedForSize _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestOptimizedForSizeDefaultTypeInternal _TestOptimizedForSize_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[3];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_._extensions_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_.i_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_.msg_),
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_.foo_),
+    1,
+    0,
+    ~0u,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredOptimizedForSize, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredOptimizedForSize, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredOptimizedForSize, _impl_.x_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptionalOptimizedForSize, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptionalOptimizedForSize, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptionalOptimizedForSize, _impl_.o_),
+    0,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 13, -1, sizeof(::protobuf_unittest::TestOptimizedForSize)},
+        {17, 26, -1, sizeof(::protobuf_unittest::TestRequiredOptimizedForSize)},
+        {27, 36, -1, sizeof(::protobuf_unittest::TestOptionalOptimizedForSize)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestOptimizedForSize_default_instance_._instance,
+    &::protobuf_unittest::_TestRequiredOptimizedForSize_default_instance_._instance,
+    &::protobuf_unittest::_TestOptionalOptimizedForSize_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n+google/protobuf/unittest_optimize_for."
+    "proto\022\021protobuf_unittest\032\036google/protobu"
+    "f/unittest.proto\"\312\002\n\024TestOptimizedForSiz"
+    "e\022\t\n\001i\030\001 \001(\005\022.\n\003msg\030\023 \001(\0132!.protobuf_uni"
+    "ttest.ForeignMessage\022\027\n\rinteger_field\030\002 "
+    "\001(\005H\000\022\026\n\014string_field\030\003 \001(\tH\000*\t\010\350\007\020\200\200\200\200\002"
+    "2@\n\016test_extension\022\'.protobuf_unittest.T"
+    "estOptimizedForSize\030\322\t \001(\0052r\n\017test_exten"
+    "sion2\022\'.protobuf_unittest.TestOptimizedF"
+    "orSize\030\323\t \001(\0132/.protobuf_unittest.TestRe"
+    "quiredOptimizedForSizeB\005\n\003foo\")\n\034TestReq"
+    "uiredOptimizedForSize\022\t\n\001x\030\001 \002(\005\"Z\n\034Test"
+    "OptionalOptimizedForSize\022:\n\001o\030\001 \001(\0132/.pr"
+    "otobuf_unittest.TestRequiredOptimizedFor"
+    "SizeB\002H\002"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2funittest_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = {
+    false,
+    false,
+    568,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto,
+    "google/protobuf/unittest_optimize_for.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_deps,
+    1,
+    3,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto);
+namespace protobuf_unittest {
+// ===================================================================
+
+class TestOptimizedForSize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestOptimizedForSize>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestOptimizedForSize, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _impl_._oneof_case_);
+  static void set_has_i(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::ForeignMessage& msg(const TestOptimizedForSize* msg);
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::ForeignMessage& TestOptimizedForSize::_Internal::msg(const TestOptimizedForSize* msg) {
+  return *msg->_impl_.msg_;
+}
+void TestOptimizedForSize::clear_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.msg_ != nullptr) _impl_.msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+TestOptimizedForSize::TestOptimizedForSize(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestOptimizedForSize)
+}
+inline PROTOBUF_NDEBUG_INLINE TestOptimizedForSize::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        foo_{},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+TestOptimizedForSize::TestOptimizedForSize(
+    ::google::protobuf::Arena* arena,
+    const TestOptimizedForSize& from)
+    : ::google::protobuf::Message(arena) {
+  TestOptimizedForSize* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.msg_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::ForeignMessage>(arena, *from._impl_.msg_)
+                : nullptr;
+  _impl_.i_ = from._impl_.i_;
+  switch (foo_case()) {
+    case FOO_NOT_SET:
+      break;
+      case kIntegerField:
+        _impl_.foo_.integer_field_ = from._impl_.foo_.integer_field_;
+        break;
+      case kStringField:
+        new (&_impl_.foo_.string_field_) decltype(_impl_.foo_.string_field_){arena, from._impl_.foo_.string_field_};
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestOptimizedForSize)
+}
+inline PROTOBUF_NDEBUG_INLINE TestOptimizedForSize::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0},
+        foo_{},
+        _oneof_case_{} {}
+
+inline void TestOptimizedForSize::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, msg_),
+           0,
+           offsetof(Impl_, i_) -
+               offsetof(Impl_, msg_) +
+               sizeof(Impl_::i_));
+}
+TestOptimizedForSize::~TestOptimizedForSize() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestOptimizedForSize)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestOptimizedForSize::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.msg_;
+  if (has_foo()) {
+    clear_foo();
+  }
+  _impl_.~Impl_();
+}
+
+void TestOptimizedForSize::clear_foo() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TestOptimizedForSize)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (foo_case()) {
+    case kIntegerField: {
+      // No need to clear
+      break;
+    }
+    case kStringField: {
+      _impl_.foo_.string_field_.Destroy();
+      break;
+    }
+    case FOO_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = FOO_NOT_SET;
+}
+
+
+::_pbi::CachedSize* TestOptimizedForSize::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestOptimizedForSize::InternalSwap(TestOptimizedForSize* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata TestOptimizedForSize::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[0]);
+}
+// ===================================================================
+
+class TestRequiredOptimizedForSize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestRequiredOptimizedForSize>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestRequiredOptimizedForSize, _impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+TestRequiredOptimizedForSize::TestRequiredOptimizedForSize(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRequiredOptimizedForSize)
+}
+TestRequiredOptimizedForSize::TestRequiredOptimizedForSize(
+    ::google::protobuf::Arena* arena, const TestRequiredOptimizedForSize& from)
+    : TestRequiredOptimizedForSize(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestRequiredOptimizedForSize::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestRequiredOptimizedForSize::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.x_ = {};
+}
+TestRequiredOptimizedForSize::~TestRequiredOptimizedForSize() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRequiredOptimizedForSize)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestRequiredOptimizedForSize::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+::_pbi::CachedSize* TestRequiredOptimizedForSize::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestRequiredOptimizedForSize::InternalSwap(TestRequiredOptimizedForSize* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata TestRequiredOptimizedForSize::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[1]);
+}
+// ===================================================================
+
+class TestOptionalOptimizedForSize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestOptionalOptimizedForSize>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestOptionalOptimizedForSize, _impl_._has_bits_);
+  static const ::protobuf_unittest::TestRequiredOptimizedForSize& o(const TestOptionalOptimizedForSize* msg);
+  static void set_has_o(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestRequiredOptimizedForSize& TestOptionalOptimizedForSize::_Internal::o(const TestOptionalOptimizedForSize* msg) {
+  return *msg->_impl_.o_;
+}
+TestOptionalOptimizedForSize::TestOptionalOptimizedForSize(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestOptionalOptimizedForSize)
+}
+inline PROTOBUF_NDEBUG_INLINE TestOptionalOptimizedForSize::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestOptionalOptimizedForSize::TestOptionalOptimizedForSize(
+    ::google::protobuf::Arena* arena,
+    const TestOptionalOptimizedForSize& from)
+    : ::google::protobuf::Message(arena) {
+  TestOptionalOptimizedForSize* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.o_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestRequiredOptimizedForSize>(arena, *from._impl_.o_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestOptionalOptimizedForSize)
+}
+inline PROTOBUF_NDEBUG_INLINE TestOptionalOptimizedForSize::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestOptionalOptimizedForSize::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.o_ = {};
+}
+TestOptionalOptimizedForSize::~TestOptionalOptimizedForSize() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestOptionalOptimizedForSize)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestOptionalOptimizedForSize::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.o_;
+  _impl_.~Impl_();
+}
+
+::_pbi::CachedSize* TestOptionalOptimizedForSize::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestOptionalOptimizedForSize::InternalSwap(TestOptionalOptimizedForSize* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata TestOptionalOptimizedForSize::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[2]);
+}
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestOptimizedForSize::kTestExtensionFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  TestOptimizedForSize::test_extension(kTestExtensionFieldNumber, 0, nullptr);
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestOptimizedForSize::kTestExtension2FieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestRequiredOptimizedForSize >, 11, false>
+  TestOptimizedForSize::test_extension2(kTestExtension2FieldNumber, ::protobuf_unittest::TestRequiredOptimizedForSize::default_instance(), nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
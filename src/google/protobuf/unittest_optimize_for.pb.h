@@ -0,0 +1,1208 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_optimize_for.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/unittest.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto;
+namespace protobuf_unittest {
+class TestOptimizedForSize;
+struct TestOptimizedForSizeDefaultTypeInternal;
+extern TestOptimizedForSizeDefaultTypeInternal _TestOptimizedForSize_default_instance_;
+class TestOptionalOptimizedForSize;
+struct TestOptionalOptimizedForSizeDefaultTypeInternal;
+extern TestOptionalOptimizedForSizeDefaultTypeInternal _TestOptionalOptimizedForSize_default_instance_;
+class TestRequiredOptimizedForSize;
+struct TestRequiredOptimizedForSizeDefaultTypeInternal;
+extern TestRequiredOptimizedForSizeDefaultTypeInternal _TestRequiredOptimizedForSize_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestRequiredOptimizedForSize final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRequiredOptimizedForSize) */ {
+ public:
+  inline TestRequiredOptimizedForSize() : TestRequiredOptimizedForSize(nullptr) {}
+  ~TestRequiredOptimizedForSize() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestRequiredOptimizedForSize(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestRequiredOptimizedForSize(const TestRequiredOptimizedForSize& from)
+      : TestRequiredOptimizedForSize(nullptr, from) {}
+  TestRequiredOptimizedForSize(TestRequiredOptimizedForSize&& from) noexcept
+    : TestRequiredOptimizedForSize() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRequiredOptimizedForSize& operator=(const TestRequiredOptimizedForSize& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRequiredOptimizedForSize& operator=(TestRequiredOptimizedForSize&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestRequiredOptimizedForSize& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestRequiredOptimizedForSize* internal_default_instance() {
+    return reinterpret_cast<const TestRequiredOptimizedForSize*>(
+               &_TestRequiredOptimizedForSize_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestRequiredOptimizedForSize& a, TestRequiredOptimizedForSize& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestRequiredOptimizedForSize* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestRequiredOptimizedForSize* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestRequiredOptimizedForSize* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestRequiredOptimizedForSize>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestRequiredOptimizedForSize* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestRequiredOptimizedForSize";
+  }
+  protected:
+  explicit TestRequiredOptimizedForSize(::google::protobuf::Arena* arena);
+  TestRequiredOptimizedForSize(::google::protobuf::Arena* arena, const TestRequiredOptimizedForSize& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+  };
+  // required int32 x = 1;
+  bool has_x() const;
+  void clear_x() ;
+  ::int32_t x() const;
+  void set_x(::int32_t value);
+
+  private:
+  ::int32_t _internal_x() const;
+  void _internal_set_x(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequiredOptimizedForSize)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t x_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto;
+};// -------------------------------------------------------------------
+
+class TestOptionalOptimizedForSize final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestOptionalOptimizedForSize) */ {
+ public:
+  inline TestOptionalOptimizedForSize() : TestOptionalOptimizedForSize(nullptr) {}
+  ~TestOptionalOptimizedForSize() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestOptionalOptimizedForSize(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestOptionalOptimizedForSize(const TestOptionalOptimizedForSize& from)
+      : TestOptionalOptimizedForSize(nullptr, from) {}
+  TestOptionalOptimizedForSize(TestOptionalOptimizedForSize&& from) noexcept
+    : TestOptionalOptimizedForSize() {
+    *this = ::std::move(from);
+  }
+
+  inline TestOptionalOptimizedForSize& operator=(const TestOptionalOptimizedForSize& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestOptionalOptimizedForSize& operator=(TestOptionalOptimizedForSize&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestOptionalOptimizedForSize& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestOptionalOptimizedForSize* internal_default_instance() {
+    return reinterpret_cast<const TestOptionalOptimizedForSize*>(
+               &_TestOptionalOptimizedForSize_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestOptionalOptimizedForSize& a, TestOptionalOptimizedForSize& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestOptionalOptimizedForSize* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestOptionalOptimizedForSize* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestOptionalOptimizedForSize* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestOptionalOptimizedForSize>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestOptionalOptimizedForSize* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestOptionalOptimizedForSize";
+  }
+  protected:
+  explicit TestOptionalOptimizedForSize(::google::protobuf::Arena* arena);
+  TestOptionalOptimizedForSize(::google::protobuf::Arena* arena, const TestOptionalOptimizedForSize& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOFieldNumber = 1,
+  };
+  // optional .protobuf_unittest.TestRequiredOptimizedForSize o = 1;
+  bool has_o() const;
+  void clear_o() ;
+  const ::protobuf_unittest::TestRequiredOptimizedForSize& o() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestRequiredOptimizedForSize* release_o();
+  ::protobuf_unittest::TestRequiredOptimizedForSize* mutable_o();
+  void set_allocated_o(::protobuf_unittest::TestRequiredOptimizedForSize* value);
+  void unsafe_arena_set_allocated_o(::protobuf_unittest::TestRequiredOptimizedForSize* value);
+  ::protobuf_unittest::TestRequiredOptimizedForSize* unsafe_arena_release_o();
+
+  private:
+  const ::protobuf_unittest::TestRequiredOptimizedForSize& _internal_o() const;
+  ::protobuf_unittest::TestRequiredOptimizedForSize* _internal_mutable_o();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestOptionalOptimizedForSize)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestRequiredOptimizedForSize* o_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto;
+};// -------------------------------------------------------------------
+
+class TestOptimizedForSize final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestOptimizedForSize) */ {
+ public:
+  inline TestOptimizedForSize() : TestOptimizedForSize(nullptr) {}
+  ~TestOptimizedForSize() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestOptimizedForSize(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestOptimizedForSize(const TestOptimizedForSize& from)
+      : TestOptimizedForSize(nullptr, from) {}
+  TestOptimizedForSize(TestOptimizedForSize&& from) noexcept
+    : TestOptimizedForSize() {
+    *this = ::std::move(from);
+  }
+
+  inline TestOptimizedForSize& operator=(const TestOptimizedForSize& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestOptimizedForSize& operator=(TestOptimizedForSize&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestOptimizedForSize& default_instance() {
+    return *internal_default_instance();
+  }
+  enum FooCase {
+    kIntegerField = 2,
+    kStringField = 3,
+    FOO_NOT_SET = 0,
+  };
+
+  static inline const TestOptimizedForSize* internal_default_instance() {
+    return reinterpret_cast<const TestOptimizedForSize*>(
+               &_TestOptimizedForSize_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestOptimizedForSize& a, TestOptimizedForSize& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestOptimizedForSize* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestOptimizedForSize* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestOptimizedForSize* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestOptimizedForSize>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestOptimizedForSize* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestOptimizedForSize";
+  }
+  protected:
+  explicit TestOptimizedForSize(::google::protobuf::Arena* arena);
+  TestOptimizedForSize(::google::protobuf::Arena* arena, const TestOptimizedForSize& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgFieldNumber = 19,
+    kIFieldNumber = 1,
+    kIntegerFieldFieldNumber = 2,
+    kStringFieldFieldNumber = 3,
+  };
+  // optional .protobuf_unittest.ForeignMessage msg = 19;
+  bool has_msg() const;
+  void clear_msg() ;
+  const ::protobuf_unittest::ForeignMessage& msg() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::ForeignMessage* release_msg();
+  ::protobuf_unittest::ForeignMessage* mutable_msg();
+  void set_allocated_msg(::protobuf_unittest::ForeignMessage* value);
+  void unsafe_arena_set_allocated_msg(::protobuf_unittest::ForeignMessage* value);
+  ::protobuf_unittest::ForeignMessage* unsafe_arena_release_msg();
+
+  private:
+  const ::protobuf_unittest::ForeignMessage& _internal_msg() const;
+  ::protobuf_unittest::ForeignMessage* _internal_mutable_msg();
+
+  public:
+  // optional int32 i = 1;
+  bool has_i() const;
+  void clear_i() ;
+  ::int32_t i() const;
+  void set_i(::int32_t value);
+
+  private:
+  ::int32_t _internal_i() const;
+  void _internal_set_i(::int32_t value);
+
+  public:
+  // int32 integer_field = 2;
+  bool has_integer_field() const;
+  void clear_integer_field() ;
+  ::int32_t integer_field() const;
+  void set_integer_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_integer_field() const;
+  void _internal_set_integer_field(::int32_t value);
+
+  public:
+  // string string_field = 3;
+  bool has_string_field() const;
+  void clear_string_field() ;
+  const std::string& string_field() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_string_field(Arg_&& arg, Args_... args);
+  std::string* mutable_string_field();
+  PROTOBUF_NODISCARD std::string* release_string_field();
+  void set_allocated_string_field(std::string* value);
+
+  private:
+  const std::string& _internal_string_field() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_field(
+      const std::string& value);
+  std::string* _internal_mutable_string_field();
+
+  public:
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TestOptimizedForSize, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  void clear_foo();
+  FooCase foo_case() const;
+  static const int kTestExtensionFieldNumber = 1234;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
+      ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+    test_extension;
+  static const int kTestExtension2FieldNumber = 1235;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
+      ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestRequiredOptimizedForSize >, 11, false >
+    test_extension2;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestOptimizedForSize)
+ private:
+  class _Internal;
+  void set_has_integer_field();
+  void set_has_string_field();
+
+  inline bool has_foo() const;
+  inline void clear_has_foo();
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::ForeignMessage* msg_;
+    ::int32_t i_;
+    union FooUnion {
+      constexpr FooUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::int32_t integer_field_;
+      ::google::protobuf::internal::ArenaStringPtr string_field_;
+    } foo_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestOptimizedForSize
+
+// optional int32 i = 1;
+inline bool TestOptimizedForSize::has_i() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void TestOptimizedForSize::clear_i() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.i_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::int32_t TestOptimizedForSize::i() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOptimizedForSize.i)
+  return _internal_i();
+}
+inline void TestOptimizedForSize::set_i(::int32_t value) {
+  _internal_set_i(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOptimizedForSize.i)
+}
+inline ::int32_t TestOptimizedForSize::_internal_i() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.i_;
+}
+inline void TestOptimizedForSize::_internal_set_i(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.i_ = value;
+}
+
+// optional .protobuf_unittest.ForeignMessage msg = 19;
+inline bool TestOptimizedForSize::has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.msg_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest::ForeignMessage& TestOptimizedForSize::_internal_msg() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::ForeignMessage* p = _impl_.msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::ForeignMessage&>(::protobuf_unittest::_ForeignMessage_default_instance_);
+}
+inline const ::protobuf_unittest::ForeignMessage& TestOptimizedForSize::msg() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOptimizedForSize.msg)
+  return _internal_msg();
+}
+inline void TestOptimizedForSize::unsafe_arena_set_allocated_msg(::protobuf_unittest::ForeignMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.msg_);
+  }
+  _impl_.msg_ = reinterpret_cast<::protobuf_unittest::ForeignMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestOptimizedForSize.msg)
+}
+inline ::protobuf_unittest::ForeignMessage* TestOptimizedForSize::release_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::ForeignMessage* released = _impl_.msg_;
+  _impl_.msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::ForeignMessage* TestOptimizedForSize::unsafe_arena_release_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOptimizedForSize.msg)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::ForeignMessage* temp = _impl_.msg_;
+  _impl_.msg_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::ForeignMessage* TestOptimizedForSize::_internal_mutable_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::ForeignMessage>(GetArena());
+    _impl_.msg_ = reinterpret_cast<::protobuf_unittest::ForeignMessage*>(p);
+  }
+  return _impl_.msg_;
+}
+inline ::protobuf_unittest::ForeignMessage* TestOptimizedForSize::mutable_msg() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::ForeignMessage* _msg = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOptimizedForSize.msg)
+  return _msg;
+}
+inline void TestOptimizedForSize::set_allocated_msg(::protobuf_unittest::ForeignMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.msg_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.msg_ = reinterpret_cast<::protobuf_unittest::ForeignMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOptimizedForSize.msg)
+}
+
+// int32 integer_field = 2;
+inline bool TestOptimizedForSize::has_integer_field() const {
+  return foo_case() == kIntegerField;
+}
+inline void TestOptimizedForSize::set_has_integer_field() {
+  _impl_._oneof_case_[0] = kIntegerField;
+}
+inline void TestOptimizedForSize::clear_integer_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (foo_case() == kIntegerField) {
+    _impl_.foo_.integer_field_ = 0;
+    clear_has_foo();
+  }
+}
+inline ::int32_t TestOptimizedForSize::integer_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOptimizedForSize.integer_field)
+  return _internal_integer_field();
+}
+inline void TestOptimizedForSize::set_integer_field(::int32_t value) {
+  _internal_set_integer_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOptimizedForSize.integer_field)
+}
+inline ::int32_t TestOptimizedForSize::_internal_integer_field() const {
+  if (foo_case() == kIntegerField) {
+    return _impl_.foo_.integer_field_;
+  }
+  return 0;
+}
+inline void TestOptimizedForSize::_internal_set_integer_field(::int32_t value) {
+  if (foo_case() != kIntegerField) {
+    clear_foo();
+    set_has_integer_field();
+  }
+  _impl_.foo_.integer_field_ = value;
+}
+
+// string string_field = 3;
+inline bool TestOptimizedForSize::has_string_field() const {
+  return foo_case() == kStringField;
+}
+inline void TestOptimizedForSize::set_has_string_field() {
+  _impl_._oneof_case_[0] = kStringField;
+}
+inline void TestOptimizedForSize::clear_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (foo_case() == kStringField) {
+    _impl_.foo_.string_field_.Destroy();
+    clear_has_foo();
+  }
+}
+inline const std::string& TestOptimizedForSize::string_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOptimizedForSize.string_field)
+  return _internal_string_field();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOptimizedForSize::set_string_field(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (foo_case() != kStringField) {
+    clear_foo();
+
+    set_has_string_field();
+    _impl_.foo_.string_field_.InitDefault();
+  }
+  _impl_.foo_.string_field_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestOptimizedForSize.string_field)
+}
+inline std::string* TestOptimizedForSize::mutable_string_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_string_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOptimizedForSize.string_field)
+  return _s;
+}
+inline const std::string& TestOptimizedForSize::_internal_string_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (foo_case() != kStringField) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.foo_.string_field_.Get();
+}
+inline void TestOptimizedForSize::_internal_set_string_field(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (foo_case() != kStringField) {
+    clear_foo();
+
+    set_has_string_field();
+    _impl_.foo_.string_field_.InitDefault();
+  }
+  _impl_.foo_.string_field_.Set(value, GetArena());
+}
+inline std::string* TestOptimizedForSize::_internal_mutable_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (foo_case() != kStringField) {
+    clear_foo();
+
+    set_has_string_field();
+    _impl_.foo_.string_field_.InitDefault();
+  }
+  return _impl_.foo_.string_field_.Mutable( GetArena());
+}
+inline std::string* TestOptimizedForSize::release_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOptimizedForSize.string_field)
+  if (foo_case() != kStringField) {
+    return nullptr;
+  }
+  clear_has_foo();
+  return _impl_.foo_.string_field_.Release();
+}
+inline void TestOptimizedForSize::set_allocated_string_field(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_foo()) {
+    clear_foo();
+  }
+  if (value != nullptr) {
+    set_has_string_field();
+    _impl_.foo_.string_field_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOptimizedForSize.string_field)
+}
+
+inline bool TestOptimizedForSize::has_foo() const {
+  return foo_case() != FOO_NOT_SET;
+}
+inline void TestOptimizedForSize::clear_has_foo() {
+  _impl_._oneof_case_[0] = FOO_NOT_SET;
+}
+inline TestOptimizedForSize::FooCase TestOptimizedForSize::foo_case() const {
+  return TestOptimizedForSize::FooCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TestRequiredOptimizedForSize
+
+// required int32 x = 1;
+inline bool TestRequiredOptimizedForSize::has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TestRequiredOptimizedForSize::clear_x() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t TestRequiredOptimizedForSize::x() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRequiredOptimizedForSize.x)
+  return _internal_x();
+}
+inline void TestRequiredOptimizedForSize::set_x(::int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRequiredOptimizedForSize.x)
+}
+inline ::int32_t TestRequiredOptimizedForSize::_internal_x() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.x_;
+}
+inline void TestRequiredOptimizedForSize::_internal_set_x(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestOptionalOptimizedForSize
+
+// optional .protobuf_unittest.TestRequiredOptimizedForSize o = 1;
+inline bool TestOptionalOptimizedForSize::has_o() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.o_ != nullptr);
+  return value;
+}
+inline void TestOptionalOptimizedForSize::clear_o() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.o_ != nullptr) _impl_.o_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestRequiredOptimizedForSize& TestOptionalOptimizedForSize::_internal_o() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestRequiredOptimizedForSize* p = _impl_.o_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestRequiredOptimizedForSize&>(::protobuf_unittest::_TestRequiredOptimizedForSize_default_instance_);
+}
+inline const ::protobuf_unittest::TestRequiredOptimizedForSize& TestOptionalOptimizedForSize::o() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestOptionalOptimizedForSize.o)
+  return _internal_o();
+}
+inline void TestOptionalOptimizedForSize::unsafe_arena_set_allocated_o(::protobuf_unittest::TestRequiredOptimizedForSize* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.o_);
+  }
+  _impl_.o_ = reinterpret_cast<::protobuf_unittest::TestRequiredOptimizedForSize*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestOptionalOptimizedForSize.o)
+}
+inline ::protobuf_unittest::TestRequiredOptimizedForSize* TestOptionalOptimizedForSize::release_o() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestRequiredOptimizedForSize* released = _impl_.o_;
+  _impl_.o_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestRequiredOptimizedForSize* TestOptionalOptimizedForSize::unsafe_arena_release_o() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestOptionalOptimizedForSize.o)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestRequiredOptimizedForSize* temp = _impl_.o_;
+  _impl_.o_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestRequiredOptimizedForSize* TestOptionalOptimizedForSize::_internal_mutable_o() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.o_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestRequiredOptimizedForSize>(GetArena());
+    _impl_.o_ = reinterpret_cast<::protobuf_unittest::TestRequiredOptimizedForSize*>(p);
+  }
+  return _impl_.o_;
+}
+inline ::protobuf_unittest::TestRequiredOptimizedForSize* TestOptionalOptimizedForSize::mutable_o() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestRequiredOptimizedForSize* _msg = _internal_mutable_o();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestOptionalOptimizedForSize.o)
+  return _msg;
+}
+inline void TestOptionalOptimizedForSize::set_allocated_o(::protobuf_unittest::TestRequiredOptimizedForSize* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::protobuf_unittest::TestRequiredOptimizedForSize*>(_impl_.o_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::protobuf_unittest::TestRequiredOptimizedForSize*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.o_ = reinterpret_cast<::protobuf_unittest::TestRequiredOptimizedForSize*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOptionalOptimizedForSize.o)
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_2epb_2eh
@@ -0,0 +1,1010 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_preserve_unknown_enum.proto
+
+#include "google/protobuf/unittest_preserve_unknown_enum.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace proto3_preserve_unknown_enum_unittest {
+
+inline constexpr MyMessagePlusExtra::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : repeated_e_{},
+        _repeated_e_cached_byte_size_{0},
+        repeated_packed_e_{},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{},
+        _repeated_packed_unexpected_e_cached_byte_size_{0},
+        e_{static_cast< ::proto3_preserve_unknown_enum_unittest::MyEnumPlusExtra >(0)},
+        o_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MyMessagePlusExtra::MyMessagePlusExtra(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MyMessagePlusExtraDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MyMessagePlusExtraDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MyMessagePlusExtraDefaultTypeInternal() {}
+  union {
+    MyMessagePlusExtra _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MyMessagePlusExtraDefaultTypeInternal _MyMessagePlusExtra_default_instance_;
+
+inline constexpr MyMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : repeated_e_{},
+        _repeated_e_cached_byte_size_{0},
+        repeated_packed_e_{},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{},
+        _repeated_packed_unexpected_e_cached_byte_size_{0},
+        e_{static_cast< ::proto3_preserve_unknown_enum_unittest::MyEnum >(0)},
+        o_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MyMessage::MyMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MyMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MyMessageDefaultTypeInternal() {}
+  union {
+    MyMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MyMessageDefaultTypeInternal _MyMessage_default_instance_;
+}  // namespace proto3_preserve_unknown_enum_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_.e_),
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_.repeated_e_),
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_.repeated_packed_e_),
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_.repeated_packed_unexpected_e_),
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_.o_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _internal_metadata_),
+    ~0u,  // no _extensions_
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_.e_),
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_.repeated_e_),
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_.repeated_packed_e_),
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_.repeated_packed_unexpected_e_),
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_.o_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, -1, -1, sizeof(::proto3_preserve_unknown_enum_unittest::MyMessage)},
+        {15, -1, -1, sizeof(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::proto3_preserve_unknown_enum_unittest::_MyMessage_default_instance_._instance,
+    &::proto3_preserve_unknown_enum_unittest::_MyMessagePlusExtra_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n4google/protobuf/unittest_preserve_unkn"
+    "own_enum.proto\022%proto3_preserve_unknown_"
+    "enum_unittest\"\275\003\n\tMyMessage\0228\n\001e\030\001 \001(\0162-"
+    ".proto3_preserve_unknown_enum_unittest.M"
+    "yEnum\022A\n\nrepeated_e\030\002 \003(\0162-.proto3_prese"
+    "rve_unknown_enum_unittest.MyEnum\022H\n\021repe"
+    "ated_packed_e\030\003 \003(\0162-.proto3_preserve_un"
+    "known_enum_unittest.MyEnum\022\\\n\034repeated_p"
+    "acked_unexpected_e\030\004 \003(\01626.proto3_preser"
+    "ve_unknown_enum_unittest.MyEnumPlusExtra"
+    "\022B\n\toneof_e_1\030\005 \001(\0162-.proto3_preserve_un"
+    "known_enum_unittest.MyEnumH\000\022B\n\toneof_e_"
+    "2\030\006 \001(\0162-.proto3_preserve_unknown_enum_u"
+    "nittest.MyEnumH\000B\003\n\001o\"\363\003\n\022MyMessagePlusE"
+    "xtra\022A\n\001e\030\001 \001(\01626.proto3_preserve_unknow"
+    "n_enum_unittest.MyEnumPlusExtra\022J\n\nrepea"
+    "ted_e\030\002 \003(\01626.proto3_preserve_unknown_en"
+    "um_unittest.MyEnumPlusExtra\022Q\n\021repeated_"
+    "packed_e\030\003 \003(\01626.proto3_preserve_unknown"
+    "_enum_unittest.MyEnumPlusExtra\022\\\n\034repeat"
+    "ed_packed_unexpected_e\030\004 \003(\01626.proto3_pr"
+    "eserve_unknown_enum_unittest.MyEnumPlusE"
+    "xtra\022K\n\toneof_e_1\030\005 \001(\01626.proto3_preserv"
+    "e_unknown_enum_unittest.MyEnumPlusExtraH"
+    "\000\022K\n\toneof_e_2\030\006 \001(\01626.proto3_preserve_u"
+    "nknown_enum_unittest.MyEnumPlusExtraH\000B\003"
+    "\n\001o*#\n\006MyEnum\022\007\n\003FOO\020\000\022\007\n\003BAR\020\001\022\007\n\003BAZ\020\002"
+    "*\?\n\017MyEnumPlusExtra\022\t\n\005E_FOO\020\000\022\t\n\005E_BAR\020"
+    "\001\022\t\n\005E_BAZ\020\002\022\013\n\007E_EXTRA\020\003B1\242\002\014UnknownEnu"
+    "ms\252\002\032Google.Protobuf.TestProtos\222\003\002\010\002b\010ed"
+    "itionsp\350\007"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto = {
+    false,
+    false,
+    1209,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto,
+    "google/protobuf/unittest_preserve_unknown_enum.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_once,
+    nullptr,
+    0,
+    2,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto);
+namespace proto3_preserve_unknown_enum_unittest {
+const ::google::protobuf::EnumDescriptor* MyEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t MyEnum_internal_data_[] = {
+    196608u, 0u, };
+bool MyEnum_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+const ::google::protobuf::EnumDescriptor* MyEnumPlusExtra_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t MyEnumPlusExtra_internal_data_[] = {
+    262144u, 0u, };
+bool MyEnumPlusExtra_IsValid(int value) {
+  return 0 <= value && value <= 3;
+}
+// ===================================================================
+
+class MyMessage::_Internal {
+ public:
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessage, _impl_._oneof_case_);
+};
+
+MyMessage::MyMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3_preserve_unknown_enum_unittest.MyMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE MyMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : repeated_e_{visibility, arena, from.repeated_e_},
+        _repeated_e_cached_byte_size_{0},
+        repeated_packed_e_{visibility, arena, from.repeated_packed_e_},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{visibility, arena, from.repeated_packed_unexpected_e_},
+        _repeated_packed_unexpected_e_cached_byte_size_{0},
+        o_{},
+        _cached_size_{0},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+MyMessage::MyMessage(
+    ::google::protobuf::Arena* arena,
+    const MyMessage& from)
+    : ::google::protobuf::Message(arena) {
+  MyMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.e_ = from._impl_.e_;
+  switch (o_case()) {
+    case O_NOT_SET:
+      break;
+      case kOneofE1:
+        _impl_.o_.oneof_e_1_ = from._impl_.o_.oneof_e_1_;
+        break;
+      case kOneofE2:
+        _impl_.o_.oneof_e_2_ = from._impl_.o_.oneof_e_2_;
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:proto3_preserve_unknown_enum_unittest.MyMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE MyMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : repeated_e_{visibility, arena},
+        _repeated_e_cached_byte_size_{0},
+        repeated_packed_e_{visibility, arena},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{visibility, arena},
+        _repeated_packed_unexpected_e_cached_byte_size_{0},
+        o_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+inline void MyMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.e_ = {};
+}
+MyMessage::~MyMessage() {
+  // @@protoc_insertion_point(destructor:proto3_preserve_unknown_enum_unittest.MyMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MyMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  if (has_o()) {
+    clear_o();
+  }
+  _impl_.~Impl_();
+}
+
+void MyMessage::clear_o() {
+// @@protoc_insertion_point(one_of_clear_start:proto3_preserve_unknown_enum_unittest.MyMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (o_case()) {
+    case kOneofE1: {
+      // No need to clear
+      break;
+    }
+    case kOneofE2: {
+      // No need to clear
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = O_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void MyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3_preserve_unknown_enum_unittest.MyMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_e_.Clear();
+  _impl_.repeated_packed_e_.Clear();
+  _impl_.repeated_packed_unexpected_e_.Clear();
+  _impl_.e_ = 0;
+  clear_o();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MyMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 6, 0, 0, 2> MyMessage::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    6, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MyMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+    {::_pbi::TcParser::FastV32P1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_unexpected_e_)}},
+    // .proto3_preserve_unknown_enum_unittest.MyEnum e = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(MyMessage, _impl_.e_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.e_)}},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+    {::_pbi::TcParser::FastV32P1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_e_)}},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3;
+    {::_pbi::TcParser::FastV32P1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_e_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .proto3_preserve_unknown_enum_unittest.MyEnum e = 1;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.e_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_e_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_e_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_unexpected_e_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // .proto3_preserve_unknown_enum_unittest.MyEnum oneof_e_1 = 5;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.o_.oneof_e_1_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+    // .proto3_preserve_unknown_enum_unittest.MyEnum oneof_e_2 = 6;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.o_.oneof_e_2_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* MyMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3_preserve_unknown_enum_unittest.MyMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // .proto3_preserve_unknown_enum_unittest.MyEnum e = 1;
+  if (this->_internal_e() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_e(), target);
+  }
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+  {
+    std::size_t byte_size = _impl_._repeated_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(2, _internal_repeated_e(),
+                                       byte_size, target);
+    }
+  }
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3;
+  {
+    std::size_t byte_size = _impl_._repeated_packed_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(3, _internal_repeated_packed_e(),
+                                       byte_size, target);
+    }
+  }
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+  {
+    std::size_t byte_size = _impl_._repeated_packed_unexpected_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(4, _internal_repeated_packed_unexpected_e(),
+                                       byte_size, target);
+    }
+  }
+
+  switch (o_case()) {
+    case kOneofE1: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          5, this->_internal_oneof_e_1(), target);
+      break;
+    }
+    case kOneofE2: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          6, this->_internal_oneof_e_2(), target);
+      break;
+    }
+    default:
+      break;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3_preserve_unknown_enum_unittest.MyMessage)
+  return target;
+}
+
+::size_t MyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3_preserve_unknown_enum_unittest.MyMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_packed_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_packed_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_packed_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_packed_unexpected_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_packed_unexpected_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_packed_unexpected_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // .proto3_preserve_unknown_enum_unittest.MyEnum e = 1;
+  if (this->_internal_e() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_e());
+  }
+
+  switch (o_case()) {
+    // .proto3_preserve_unknown_enum_unittest.MyEnum oneof_e_1 = 5;
+    case kOneofE1: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_e_1());
+      break;
+    }
+    // .proto3_preserve_unknown_enum_unittest.MyEnum oneof_e_2 = 6;
+    case kOneofE2: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_e_2());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MyMessage::_class_data_ = {
+    MyMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MyMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void MyMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MyMessage*>(&to_msg);
+  auto& from = static_cast<const MyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3_preserve_unknown_enum_unittest.MyMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_e()->MergeFrom(from._internal_repeated_e());
+  _this->_internal_mutable_repeated_packed_e()->MergeFrom(from._internal_repeated_packed_e());
+  _this->_internal_mutable_repeated_packed_unexpected_e()->MergeFrom(from._internal_repeated_packed_unexpected_e());
+  if (from._internal_e() != 0) {
+    _this->_internal_set_e(from._internal_e());
+  }
+  switch (from.o_case()) {
+    case kOneofE1: {
+      _this->_internal_set_oneof_e_1(from._internal_oneof_e_1());
+      break;
+    }
+    case kOneofE2: {
+      _this->_internal_set_oneof_e_2(from._internal_oneof_e_2());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MyMessage::CopyFrom(const MyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3_preserve_unknown_enum_unittest.MyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MyMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MyMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MyMessage::InternalSwap(MyMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.repeated_e_.InternalSwap(&other->_impl_.repeated_e_);
+  _impl_.repeated_packed_e_.InternalSwap(&other->_impl_.repeated_packed_e_);
+  _impl_.repeated_packed_unexpected_e_.InternalSwap(&other->_impl_.repeated_packed_unexpected_e_);
+  swap(_impl_.e_, other->_impl_.e_);
+  swap(_impl_.o_, other->_impl_.o_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata MyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[0]);
+}
+// ===================================================================
+
+class MyMessagePlusExtra::_Internal {
+ public:
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::proto3_preserve_unknown_enum_unittest::MyMessagePlusExtra, _impl_._oneof_case_);
+};
+
+MyMessagePlusExtra::MyMessagePlusExtra(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+}
+inline PROTOBUF_NDEBUG_INLINE MyMessagePlusExtra::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : repeated_e_{visibility, arena, from.repeated_e_},
+        _repeated_e_cached_byte_size_{0},
+        repeated_packed_e_{visibility, arena, from.repeated_packed_e_},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{visibility, arena, from.repeated_packed_unexpected_e_},
+        _repeated_packed_unexpected_e_cached_byte_size_{0},
+        o_{},
+        _cached_size_{0},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+MyMessagePlusExtra::MyMessagePlusExtra(
+    ::google::protobuf::Arena* arena,
+    const MyMessagePlusExtra& from)
+    : ::google::protobuf::Message(arena) {
+  MyMessagePlusExtra* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.e_ = from._impl_.e_;
+  switch (o_case()) {
+    case O_NOT_SET:
+      break;
+      case kOneofE1:
+        _impl_.o_.oneof_e_1_ = from._impl_.o_.oneof_e_1_;
+        break;
+      case kOneofE2:
+        _impl_.o_.oneof_e_2_ = from._impl_.o_.oneof_e_2_;
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+}
+inline PROTOBUF_NDEBUG_INLINE MyMessagePlusExtra::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : repeated_e_{visibility, arena},
+        _repeated_e_cached_byte_size_{0},
+        repeated_packed_e_{visibility, arena},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{visibility, arena},
+        _repeated_packed_unexpected_e_cached_byte_size_{0},
+        o_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+inline void MyMessagePlusExtra::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.e_ = {};
+}
+MyMessagePlusExtra::~MyMessagePlusExtra() {
+  // @@protoc_insertion_point(destructor:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MyMessagePlusExtra::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  if (has_o()) {
+    clear_o();
+  }
+  _impl_.~Impl_();
+}
+
+void MyMessagePlusExtra::clear_o() {
+// @@protoc_insertion_point(one_of_clear_start:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (o_case()) {
+    case kOneofE1: {
+      // No need to clear
+      break;
+    }
+    case kOneofE2: {
+      // No need to clear
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = O_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void MyMessagePlusExtra::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_e_.Clear();
+  _impl_.repeated_packed_e_.Clear();
+  _impl_.repeated_packed_unexpected_e_.Clear();
+  _impl_.e_ = 0;
+  clear_o();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MyMessagePlusExtra::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 6, 0, 0, 2> MyMessagePlusExtra::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    6, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MyMessagePlusExtra_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+    {::_pbi::TcParser::FastV32P1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.repeated_packed_unexpected_e_)}},
+    // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra e = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(MyMessagePlusExtra, _impl_.e_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.e_)}},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_e = 2;
+    {::_pbi::TcParser::FastV32P1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.repeated_e_)}},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_e = 3;
+    {::_pbi::TcParser::FastV32P1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.repeated_packed_e_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra e = 1;
+    {PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.e_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_e = 2;
+    {PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.repeated_e_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_e = 3;
+    {PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.repeated_packed_e_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+    {PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.repeated_packed_unexpected_e_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra oneof_e_1 = 5;
+    {PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.o_.oneof_e_1_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+    // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra oneof_e_2 = 6;
+    {PROTOBUF_FIELD_OFFSET(MyMessagePlusExtra, _impl_.o_.oneof_e_2_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* MyMessagePlusExtra::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra e = 1;
+  if (this->_internal_e() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_e(), target);
+  }
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_e = 2;
+  {
+    std::size_t byte_size = _impl_._repeated_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(2, _internal_repeated_e(),
+                                       byte_size, target);
+    }
+  }
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_e = 3;
+  {
+    std::size_t byte_size = _impl_._repeated_packed_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(3, _internal_repeated_packed_e(),
+                                       byte_size, target);
+    }
+  }
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+  {
+    std::size_t byte_size = _impl_._repeated_packed_unexpected_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(4, _internal_repeated_packed_unexpected_e(),
+                                       byte_size, target);
+    }
+  }
+
+  switch (o_case()) {
+    case kOneofE1: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          5, this->_internal_oneof_e_1(), target);
+      break;
+    }
+    case kOneofE2: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          6, this->_internal_oneof_e_2(), target);
+      break;
+    }
+    default:
+      break;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  return target;
+}
+
+::size_t MyMessagePlusExtra::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_e = 2;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_e = 3;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_packed_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_packed_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_packed_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // repeated .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra repeated_packed_unexpected_e = 4;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_packed_unexpected_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_packed_unexpected_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_packed_unexpected_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra e = 1;
+  if (this->_internal_e() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_e());
+  }
+
+  switch (o_case()) {
+    // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra oneof_e_1 = 5;
+    case kOneofE1: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_e_1());
+      break;
+    }
+    // .proto3_preserve_unknown_enum_unittest.MyEnumPlusExtra oneof_e_2 = 6;
+    case kOneofE2: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_e_2());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MyMessagePlusExtra::_class_data_ = {
+    MyMessagePlusExtra::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MyMessagePlusExtra::GetClassData() const {
+  return &_class_data_;
+}
+
+void MyMessagePlusExtra::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MyMessagePlusExtra*>(&to_msg);
+  auto& from = static_cast<const MyMessagePlusExtra&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_e()->MergeFrom(from._internal_repeated_e());
+  _this->_internal_mutable_repeated_packed_e()->MergeFrom(from._internal_repeated_packed_e());
+  _this->_internal_mutable_repeated_packed_unexpected_e()->MergeFrom(from._internal_repeated_packed_unexpected_e());
+  if (from._internal_e() != 0) {
+    _this->_internal_set_e(from._internal_e());
+  }
+  switch (from.o_case()) {
+    case kOneofE1: {
+      _this->_internal_set_oneof_e_1(from._internal_oneof_e_1());
+      break;
+    }
+    case kOneofE2: {
+      _this->_internal_set_oneof_e_2(from._internal_oneof_e_2());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MyMessagePlusExtra::CopyFrom(const MyMessagePlusExtra& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3_preserve_unknown_enum_unittest.MyMessagePlusExtra)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MyMessagePlusExtra::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MyMessagePlusExtra::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MyMessagePlusExtra::InternalSwap(MyMessagePlusExtra* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.repeated_e_.InternalSwap(&other->_impl_.repeated_e_);
+  _impl_.repeated_packed_e_.InternalSwap(&other->_impl_.repeated_packed_e_);
+  _impl_.repeated_packed_unexpected_e_.InternalSwap(&other->_impl_.repeated_packed_unexpected_e_);
+  swap(_impl_.e_, other->_impl_.e_);
+  swap(_impl_.o_, other->_impl_.o_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata MyMessagePlusExtra::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum_2eproto[1]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3_preserve_unknown_enum_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
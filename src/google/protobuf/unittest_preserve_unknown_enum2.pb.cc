@@ -0,0 +1,551 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_preserve_unknown_enum2.proto
+
+#include "google/protobuf/unittest_preserve_unknown_enum2.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace proto2_preserve_unknown_enum_unittest {
+
+inline constexpr MyMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_e_{},
+        repeated_packed_e_{},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{},
+        e_{static_cast< ::proto2_preserve_unknown_enum_unittest::MyEnum >(0)},
+        o_{},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MyMessage::MyMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MyMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MyMessageDefaultTypeInternal() {}
+  union {
+    MyMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MyMessageDefaultTypeInternal _MyMessage_default_instance_;
+}  // namespace proto2_preserve_unknown_enum_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto[1];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_.e_),
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_.repeated_e_),
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_.repeated_packed_e_),
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_.repeated_packed_unexpected_e_),
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_.o_),
+    0,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 15, -1, sizeof(::proto2_preserve_unknown_enum_unittest::MyMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::proto2_preserve_unknown_enum_unittest::_MyMessage_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n5google/protobuf/unittest_preserve_unkn"
+    "own_enum2.proto\022%proto2_preserve_unknown"
+    "_enum_unittest\"\273\003\n\tMyMessage\0228\n\001e\030\001 \001(\0162"
+    "-.proto2_preserve_unknown_enum_unittest."
+    "MyEnum\022A\n\nrepeated_e\030\002 \003(\0162-.proto2_pres"
+    "erve_unknown_enum_unittest.MyEnum\022O\n\021rep"
+    "eated_packed_e\030\003 \003(\0162-.proto2_preserve_u"
+    "nknown_enum_unittest.MyEnumB\005\252\001\002\030\001\022S\n\034re"
+    "peated_packed_unexpected_e\030\004 \003(\0162-.proto"
+    "2_preserve_unknown_enum_unittest.MyEnum\022"
+    "B\n\toneof_e_1\030\005 \001(\0162-.proto2_preserve_unk"
+    "nown_enum_unittest.MyEnumH\000\022B\n\toneof_e_2"
+    "\030\006 \001(\0162-.proto2_preserve_unknown_enum_un"
+    "ittest.MyEnumH\000B\003\n\001o*#\n\006MyEnum\022\007\n\003FOO\020\000\022"
+    "\007\n\003BAR\020\001\022\007\n\003BAZ\020\002B\007\222\003\004\020\002\030\002b\010editionsp\350\007"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto = {
+    false,
+    false,
+    599,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto,
+    "google/protobuf/unittest_preserve_unknown_enum2.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_once,
+    nullptr,
+    0,
+    1,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto);
+namespace proto2_preserve_unknown_enum_unittest {
+const ::google::protobuf::EnumDescriptor* MyEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t MyEnum_internal_data_[] = {
+    196608u, 0u, };
+bool MyEnum_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+// ===================================================================
+
+class MyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MyMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(MyMessage, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::proto2_preserve_unknown_enum_unittest::MyMessage, _impl_._oneof_case_);
+  static void set_has_e(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+MyMessage::MyMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto2_preserve_unknown_enum_unittest.MyMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE MyMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_e_{visibility, arena, from.repeated_e_},
+        repeated_packed_e_{visibility, arena, from.repeated_packed_e_},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{visibility, arena, from.repeated_packed_unexpected_e_},
+        o_{},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+MyMessage::MyMessage(
+    ::google::protobuf::Arena* arena,
+    const MyMessage& from)
+    : ::google::protobuf::Message(arena) {
+  MyMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.e_ = from._impl_.e_;
+  switch (o_case()) {
+    case O_NOT_SET:
+      break;
+      case kOneofE1:
+        _impl_.o_.oneof_e_1_ = from._impl_.o_.oneof_e_1_;
+        break;
+      case kOneofE2:
+        _impl_.o_.oneof_e_2_ = from._impl_.o_.oneof_e_2_;
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:proto2_preserve_unknown_enum_unittest.MyMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE MyMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_e_{visibility, arena},
+        repeated_packed_e_{visibility, arena},
+        _repeated_packed_e_cached_byte_size_{0},
+        repeated_packed_unexpected_e_{visibility, arena},
+        o_{},
+        _oneof_case_{} {}
+
+inline void MyMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.e_ = {};
+}
+MyMessage::~MyMessage() {
+  // @@protoc_insertion_point(destructor:proto2_preserve_unknown_enum_unittest.MyMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MyMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  if (has_o()) {
+    clear_o();
+  }
+  _impl_.~Impl_();
+}
+
+void MyMessage::clear_o() {
+// @@protoc_insertion_point(one_of_clear_start:proto2_preserve_unknown_enum_unittest.MyMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (o_case()) {
+    case kOneofE1: {
+      // No need to clear
+      break;
+    }
+    case kOneofE2: {
+      // No need to clear
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = O_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void MyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto2_preserve_unknown_enum_unittest.MyMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_e_.Clear();
+  _impl_.repeated_packed_e_.Clear();
+  _impl_.repeated_packed_unexpected_e_.Clear();
+  _impl_.e_ = 0;
+  clear_o();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MyMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 6, 6, 0, 2> MyMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(MyMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    6, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    6,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MyMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_unexpected_e = 4;
+    {::_pbi::TcParser::FastEr0R1,
+     {32, 63, 2, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_unexpected_e_)}},
+    // .proto2_preserve_unknown_enum_unittest.MyEnum e = 1;
+    {::_pbi::TcParser::FastEr0S1,
+     {8, 0, 2, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.e_)}},
+    // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+    {::_pbi::TcParser::FastEr0R1,
+     {16, 63, 2, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_e_)}},
+    // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3 [features = {
+    {::_pbi::TcParser::FastEr0P1,
+     {26, 63, 2, PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_e_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .proto2_preserve_unknown_enum_unittest.MyEnum e = 1;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.e_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kEnumRange)},
+    // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_e_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kEnumRange)},
+    // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3 [features = {
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_e_), -1, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedEnumRange)},
+    // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_unexpected_e = 4;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.repeated_packed_unexpected_e_), -1, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kEnumRange)},
+    // .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_1 = 5;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.o_.oneof_e_1_), _Internal::kOneofCaseOffset + 0, 4,
+    (0 | ::_fl::kFcOneof | ::_fl::kEnumRange)},
+    // .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_2 = 6;
+    {PROTOBUF_FIELD_OFFSET(MyMessage, _impl_.o_.oneof_e_2_), _Internal::kOneofCaseOffset + 0, 5,
+    (0 | ::_fl::kFcOneof | ::_fl::kEnumRange)},
+  }}, {{
+    {0, 3},
+    {0, 3},
+    {0, 3},
+    {0, 3},
+    {0, 3},
+    {0, 3},
+  }}, {{
+  }},
+};
+
+::uint8_t* MyMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto2_preserve_unknown_enum_unittest.MyMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .proto2_preserve_unknown_enum_unittest.MyEnum e = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_e(), target);
+  }
+
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+  for (int i = 0, n = this->_internal_repeated_e_size(); i < n; ++i) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(this->_internal_repeated_e().Get(i)),
+        target);
+  }
+
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3 [features = {
+  {
+    std::size_t byte_size = _impl_._repeated_packed_e_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(3, _internal_repeated_packed_e(),
+                                       byte_size, target);
+    }
+  }
+
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_unexpected_e = 4;
+  for (int i = 0, n = this->_internal_repeated_packed_unexpected_e_size(); i < n; ++i) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        4, static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(this->_internal_repeated_packed_unexpected_e().Get(i)),
+        target);
+  }
+
+  switch (o_case()) {
+    case kOneofE1: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          5, this->_internal_oneof_e_1(), target);
+      break;
+    }
+    case kOneofE2: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          6, this->_internal_oneof_e_2(), target);
+      break;
+    }
+    default:
+      break;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto2_preserve_unknown_enum_unittest.MyMessage)
+  return target;
+}
+
+::size_t MyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto2_preserve_unknown_enum_unittest.MyMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    total_size += std::size_t{1} * count;
+  }
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3 [features = {
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_packed_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_packed_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 1;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_packed_e_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_unexpected_e = 4;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_packed_unexpected_e_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_packed_unexpected_e().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    total_size += std::size_t{1} * count;
+  }
+  // .proto2_preserve_unknown_enum_unittest.MyEnum e = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_e());
+  }
+
+  switch (o_case()) {
+    // .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_1 = 5;
+    case kOneofE1: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_e_1());
+      break;
+    }
+    // .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_2 = 6;
+    case kOneofE2: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_e_2());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MyMessage::_class_data_ = {
+    MyMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MyMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void MyMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MyMessage*>(&to_msg);
+  auto& from = static_cast<const MyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto2_preserve_unknown_enum_unittest.MyMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_e()->MergeFrom(from._internal_repeated_e());
+  _this->_internal_mutable_repeated_packed_e()->MergeFrom(from._internal_repeated_packed_e());
+  _this->_internal_mutable_repeated_packed_unexpected_e()->MergeFrom(from._internal_repeated_packed_unexpected_e());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_e(from._internal_e());
+  }
+  switch (from.o_case()) {
+    case kOneofE1: {
+      _this->_internal_set_oneof_e_1(from._internal_oneof_e_1());
+      break;
+    }
+    case kOneofE2: {
+      _this->_internal_set_oneof_e_2(from._internal_oneof_e_2());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MyMessage::CopyFrom(const MyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto2_preserve_unknown_enum_unittest.MyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MyMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MyMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MyMessage::InternalSwap(MyMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_e_.InternalSwap(&other->_impl_.repeated_e_);
+  _impl_.repeated_packed_e_.InternalSwap(&other->_impl_.repeated_packed_e_);
+  _impl_.repeated_packed_unexpected_e_.InternalSwap(&other->_impl_.repeated_packed_unexpected_e_);
+  swap(_impl_.e_, other->_impl_.e_);
+  swap(_impl_.o_, other->_impl_.o_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata MyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto[0]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto2_preserve_unknown_enum_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,683 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_preserve_unknown_enum2.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/unknown_field_set.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto;
+namespace proto2_preserve_unknown_enum_unittest {
+class MyMessage;
+struct MyMessageDefaultTypeInternal;
+extern MyMessageDefaultTypeInternal _MyMessage_default_instance_;
+}  // namespace proto2_preserve_unknown_enum_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace proto2_preserve_unknown_enum_unittest {
+enum MyEnum : int {
+  FOO = 0,
+  BAR = 1,
+  BAZ = 2,
+};
+
+bool MyEnum_IsValid(int value);
+extern const uint32_t MyEnum_internal_data_[];
+constexpr MyEnum MyEnum_MIN = static_cast<MyEnum>(0);
+constexpr MyEnum MyEnum_MAX = static_cast<MyEnum>(2);
+constexpr int MyEnum_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+MyEnum_descriptor();
+template <typename T>
+const std::string& MyEnum_Name(T value) {
+  static_assert(std::is_same<T, MyEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to MyEnum_Name().");
+  return MyEnum_Name(static_cast<MyEnum>(value));
+}
+template <>
+inline const std::string& MyEnum_Name(MyEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<MyEnum_descriptor,
+                                                 0, 2>(
+      static_cast<int>(value));
+}
+inline bool MyEnum_Parse(absl::string_view name, MyEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<MyEnum>(
+      MyEnum_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class MyMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto2_preserve_unknown_enum_unittest.MyMessage) */ {
+ public:
+  inline MyMessage() : MyMessage(nullptr) {}
+  ~MyMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MyMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline MyMessage(const MyMessage& from)
+      : MyMessage(nullptr, from) {}
+  MyMessage(MyMessage&& from) noexcept
+    : MyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline MyMessage& operator=(const MyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MyMessage& operator=(MyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OCase {
+    kOneofE1 = 5,
+    kOneofE2 = 6,
+    O_NOT_SET = 0,
+  };
+
+  static inline const MyMessage* internal_default_instance() {
+    return reinterpret_cast<const MyMessage*>(
+               &_MyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MyMessage& a, MyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MyMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MyMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MyMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MyMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MyMessage& from) {
+    MyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MyMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto2_preserve_unknown_enum_unittest.MyMessage";
+  }
+  protected:
+  explicit MyMessage(::google::protobuf::Arena* arena);
+  MyMessage(::google::protobuf::Arena* arena, const MyMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedEFieldNumber = 2,
+    kRepeatedPackedEFieldNumber = 3,
+    kRepeatedPackedUnexpectedEFieldNumber = 4,
+    kEFieldNumber = 1,
+    kOneofE1FieldNumber = 5,
+    kOneofE2FieldNumber = 6,
+  };
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+  int repeated_e_size() const;
+  private:
+  int _internal_repeated_e_size() const;
+
+  public:
+  void clear_repeated_e() ;
+  public:
+  ::proto2_preserve_unknown_enum_unittest::MyEnum repeated_e(int index) const;
+  void set_repeated_e(int index, ::proto2_preserve_unknown_enum_unittest::MyEnum value);
+  void add_repeated_e(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_e() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_e();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_e() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_e();
+
+  public:
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3 [features = {
+  int repeated_packed_e_size() const;
+  private:
+  int _internal_repeated_packed_e_size() const;
+
+  public:
+  void clear_repeated_packed_e() ;
+  public:
+  ::proto2_preserve_unknown_enum_unittest::MyEnum repeated_packed_e(int index) const;
+  void set_repeated_packed_e(int index, ::proto2_preserve_unknown_enum_unittest::MyEnum value);
+  void add_repeated_packed_e(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_packed_e() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_packed_e();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_packed_e() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_packed_e();
+
+  public:
+  // repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_unexpected_e = 4;
+  int repeated_packed_unexpected_e_size() const;
+  private:
+  int _internal_repeated_packed_unexpected_e_size() const;
+
+  public:
+  void clear_repeated_packed_unexpected_e() ;
+  public:
+  ::proto2_preserve_unknown_enum_unittest::MyEnum repeated_packed_unexpected_e(int index) const;
+  void set_repeated_packed_unexpected_e(int index, ::proto2_preserve_unknown_enum_unittest::MyEnum value);
+  void add_repeated_packed_unexpected_e(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_packed_unexpected_e() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_packed_unexpected_e();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_packed_unexpected_e() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_packed_unexpected_e();
+
+  public:
+  // .proto2_preserve_unknown_enum_unittest.MyEnum e = 1;
+  bool has_e() const;
+  void clear_e() ;
+  ::proto2_preserve_unknown_enum_unittest::MyEnum e() const;
+  void set_e(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+
+  private:
+  ::proto2_preserve_unknown_enum_unittest::MyEnum _internal_e() const;
+  void _internal_set_e(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+
+  public:
+  // .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_1 = 5;
+  bool has_oneof_e_1() const;
+  void clear_oneof_e_1() ;
+  ::proto2_preserve_unknown_enum_unittest::MyEnum oneof_e_1() const;
+  void set_oneof_e_1(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+
+  private:
+  ::proto2_preserve_unknown_enum_unittest::MyEnum _internal_oneof_e_1() const;
+  void _internal_set_oneof_e_1(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+
+  public:
+  // .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_2 = 6;
+  bool has_oneof_e_2() const;
+  void clear_oneof_e_2() ;
+  ::proto2_preserve_unknown_enum_unittest::MyEnum oneof_e_2() const;
+  void set_oneof_e_2(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+
+  private:
+  ::proto2_preserve_unknown_enum_unittest::MyEnum _internal_oneof_e_2() const;
+  void _internal_set_oneof_e_2(::proto2_preserve_unknown_enum_unittest::MyEnum value);
+
+  public:
+  void clear_o();
+  OCase o_case() const;
+  // @@protoc_insertion_point(class_scope:proto2_preserve_unknown_enum_unittest.MyMessage)
+ private:
+  class _Internal;
+  void set_has_oneof_e_1();
+  void set_has_oneof_e_2();
+
+  inline bool has_o() const;
+  inline void clear_has_o();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 6, 6,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<int> repeated_e_;
+    ::google::protobuf::RepeatedField<int> repeated_packed_e_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_packed_e_cached_byte_size_;
+    ::google::protobuf::RepeatedField<int> repeated_packed_unexpected_e_;
+    int e_;
+    union OUnion {
+      constexpr OUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      int oneof_e_1_;
+      int oneof_e_2_;
+    } o_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// MyMessage
+
+// .proto2_preserve_unknown_enum_unittest.MyEnum e = 1;
+inline bool MyMessage::has_e() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void MyMessage::clear_e() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.e_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::e() const {
+  // @@protoc_insertion_point(field_get:proto2_preserve_unknown_enum_unittest.MyMessage.e)
+  return _internal_e();
+}
+inline void MyMessage::set_e(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  _internal_set_e(value);
+  // @@protoc_insertion_point(field_set:proto2_preserve_unknown_enum_unittest.MyMessage.e)
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::_internal_e() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(_impl_.e_);
+}
+inline void MyMessage::_internal_set_e(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.e_ = value;
+}
+
+// repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_e = 2;
+inline int MyMessage::_internal_repeated_e_size() const {
+  return _internal_repeated_e().size();
+}
+inline int MyMessage::repeated_e_size() const {
+  return _internal_repeated_e_size();
+}
+inline void MyMessage::clear_repeated_e() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_e_.Clear();
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::repeated_e(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_e)
+  return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(_internal_repeated_e().Get(index));
+}
+inline void MyMessage::set_repeated_e(int index, ::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  _internal_mutable_repeated_e()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_e)
+}
+inline void MyMessage::add_repeated_e(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_e()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_e)
+}
+inline const ::google::protobuf::RepeatedField<int>& MyMessage::repeated_e() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_e)
+  return _internal_repeated_e();
+}
+inline ::google::protobuf::RepeatedField<int>* MyMessage::mutable_repeated_e()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_e)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_e();
+}
+inline const ::google::protobuf::RepeatedField<int>& MyMessage::_internal_repeated_e() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_e_;
+}
+inline ::google::protobuf::RepeatedField<int>* MyMessage::_internal_mutable_repeated_e() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_e_;
+}
+
+// repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_e = 3 [features = {
+inline int MyMessage::_internal_repeated_packed_e_size() const {
+  return _internal_repeated_packed_e().size();
+}
+inline int MyMessage::repeated_packed_e_size() const {
+  return _internal_repeated_packed_e_size();
+}
+inline void MyMessage::clear_repeated_packed_e() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_packed_e_.Clear();
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::repeated_packed_e(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_e)
+  return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(_internal_repeated_packed_e().Get(index));
+}
+inline void MyMessage::set_repeated_packed_e(int index, ::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  _internal_mutable_repeated_packed_e()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_e)
+}
+inline void MyMessage::add_repeated_packed_e(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_packed_e()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_e)
+}
+inline const ::google::protobuf::RepeatedField<int>& MyMessage::repeated_packed_e() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_e)
+  return _internal_repeated_packed_e();
+}
+inline ::google::protobuf::RepeatedField<int>* MyMessage::mutable_repeated_packed_e()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_e)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_packed_e();
+}
+inline const ::google::protobuf::RepeatedField<int>& MyMessage::_internal_repeated_packed_e() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_packed_e_;
+}
+inline ::google::protobuf::RepeatedField<int>* MyMessage::_internal_mutable_repeated_packed_e() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_packed_e_;
+}
+
+// repeated .proto2_preserve_unknown_enum_unittest.MyEnum repeated_packed_unexpected_e = 4;
+inline int MyMessage::_internal_repeated_packed_unexpected_e_size() const {
+  return _internal_repeated_packed_unexpected_e().size();
+}
+inline int MyMessage::repeated_packed_unexpected_e_size() const {
+  return _internal_repeated_packed_unexpected_e_size();
+}
+inline void MyMessage::clear_repeated_packed_unexpected_e() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_packed_unexpected_e_.Clear();
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::repeated_packed_unexpected_e(int index) const {
+  // @@protoc_insertion_point(field_get:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_unexpected_e)
+  return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(_internal_repeated_packed_unexpected_e().Get(index));
+}
+inline void MyMessage::set_repeated_packed_unexpected_e(int index, ::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  _internal_mutable_repeated_packed_unexpected_e()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_unexpected_e)
+}
+inline void MyMessage::add_repeated_packed_unexpected_e(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_packed_unexpected_e()->Add(value);
+  // @@protoc_insertion_point(field_add:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_unexpected_e)
+}
+inline const ::google::protobuf::RepeatedField<int>& MyMessage::repeated_packed_unexpected_e() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_unexpected_e)
+  return _internal_repeated_packed_unexpected_e();
+}
+inline ::google::protobuf::RepeatedField<int>* MyMessage::mutable_repeated_packed_unexpected_e()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto2_preserve_unknown_enum_unittest.MyMessage.repeated_packed_unexpected_e)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_packed_unexpected_e();
+}
+inline const ::google::protobuf::RepeatedField<int>& MyMessage::_internal_repeated_packed_unexpected_e() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_packed_unexpected_e_;
+}
+inline ::google::protobuf::RepeatedField<int>* MyMessage::_internal_mutable_repeated_packed_unexpected_e() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_packed_unexpected_e_;
+}
+
+// .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_1 = 5;
+inline bool MyMessage::has_oneof_e_1() const {
+  return o_case() == kOneofE1;
+}
+inline void MyMessage::set_has_oneof_e_1() {
+  _impl_._oneof_case_[0] = kOneofE1;
+}
+inline void MyMessage::clear_oneof_e_1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (o_case() == kOneofE1) {
+    _impl_.o_.oneof_e_1_ = 0;
+    clear_has_o();
+  }
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::oneof_e_1() const {
+  // @@protoc_insertion_point(field_get:proto2_preserve_unknown_enum_unittest.MyMessage.oneof_e_1)
+  return _internal_oneof_e_1();
+}
+inline void MyMessage::set_oneof_e_1(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  _internal_set_oneof_e_1(value);
+  // @@protoc_insertion_point(field_set:proto2_preserve_unknown_enum_unittest.MyMessage.oneof_e_1)
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::_internal_oneof_e_1() const {
+  if (o_case() == kOneofE1) {
+    return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(_impl_.o_.oneof_e_1_);
+  }
+  return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(0);
+}
+inline void MyMessage::_internal_set_oneof_e_1(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  if (o_case() != kOneofE1) {
+    clear_o();
+    set_has_oneof_e_1();
+  }
+  _impl_.o_.oneof_e_1_ = value;
+}
+
+// .proto2_preserve_unknown_enum_unittest.MyEnum oneof_e_2 = 6;
+inline bool MyMessage::has_oneof_e_2() const {
+  return o_case() == kOneofE2;
+}
+inline void MyMessage::set_has_oneof_e_2() {
+  _impl_._oneof_case_[0] = kOneofE2;
+}
+inline void MyMessage::clear_oneof_e_2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (o_case() == kOneofE2) {
+    _impl_.o_.oneof_e_2_ = 0;
+    clear_has_o();
+  }
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::oneof_e_2() const {
+  // @@protoc_insertion_point(field_get:proto2_preserve_unknown_enum_unittest.MyMessage.oneof_e_2)
+  return _internal_oneof_e_2();
+}
+inline void MyMessage::set_oneof_e_2(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  _internal_set_oneof_e_2(value);
+  // @@protoc_insertion_point(field_set:proto2_preserve_unknown_enum_unittest.MyMessage.oneof_e_2)
+}
+inline ::proto2_preserve_unknown_enum_unittest::MyEnum MyMessage::_internal_oneof_e_2() const {
+  if (o_case() == kOneofE2) {
+    return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(_impl_.o_.oneof_e_2_);
+  }
+  return static_cast<::proto2_preserve_unknown_enum_unittest::MyEnum>(0);
+}
+inline void MyMessage::_internal_set_oneof_e_2(::proto2_preserve_unknown_enum_unittest::MyEnum value) {
+  assert(::proto2_preserve_unknown_enum_unittest::MyEnum_IsValid(value));
+  if (o_case() != kOneofE2) {
+    clear_o();
+    set_has_oneof_e_2();
+  }
+  _impl_.o_.oneof_e_2_ = value;
+}
+
+inline bool MyMessage::has_o() const {
+  return o_case() != O_NOT_SET;
+}
+inline void MyMessage::clear_has_o() {
+  _impl_._oneof_case_[0] = O_NOT_SET;
+}
+inline MyMessage::OCase MyMessage::o_case() const {
+  return MyMessage::OCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto2_preserve_unknown_enum_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::proto2_preserve_unknown_enum_unittest::MyEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto2_preserve_unknown_enum_unittest::MyEnum>() {
+  return ::proto2_preserve_unknown_enum_unittest::MyEnum_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fpreserve_5funknown_5fenum2_2eproto_2epb_2eh
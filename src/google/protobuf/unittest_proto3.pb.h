@@ -0,0 +1,7769 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_proto3.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fproto3_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fproto3_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_bases.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/unittest_import.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fproto3_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto;
+namespace proto3_unittest {
+class ForeignMessage;
+struct ForeignMessageDefaultTypeInternal;
+extern ForeignMessageDefaultTypeInternal _ForeignMessage_default_instance_;
+class NestedTestAllTypes;
+struct NestedTestAllTypesDefaultTypeInternal;
+extern NestedTestAllTypesDefaultTypeInternal _NestedTestAllTypes_default_instance_;
+class TestAllTypes;
+struct TestAllTypesDefaultTypeInternal;
+extern TestAllTypesDefaultTypeInternal _TestAllTypes_default_instance_;
+class TestAllTypes_NestedMessage;
+struct TestAllTypes_NestedMessageDefaultTypeInternal;
+extern TestAllTypes_NestedMessageDefaultTypeInternal _TestAllTypes_NestedMessage_default_instance_;
+class TestEmptyMessage;
+struct TestEmptyMessageDefaultTypeInternal;
+extern TestEmptyMessageDefaultTypeInternal _TestEmptyMessage_default_instance_;
+class TestMessageWithDummy;
+struct TestMessageWithDummyDefaultTypeInternal;
+extern TestMessageWithDummyDefaultTypeInternal _TestMessageWithDummy_default_instance_;
+class TestOneof2;
+struct TestOneof2DefaultTypeInternal;
+extern TestOneof2DefaultTypeInternal _TestOneof2_default_instance_;
+class TestPackedTypes;
+struct TestPackedTypesDefaultTypeInternal;
+extern TestPackedTypesDefaultTypeInternal _TestPackedTypes_default_instance_;
+class TestUnpackedTypes;
+struct TestUnpackedTypesDefaultTypeInternal;
+extern TestUnpackedTypesDefaultTypeInternal _TestUnpackedTypes_default_instance_;
+}  // namespace proto3_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace proto3_unittest {
+enum TestAllTypes_NestedEnum : int {
+  TestAllTypes_NestedEnum_ZERO = 0,
+  TestAllTypes_NestedEnum_FOO = 1,
+  TestAllTypes_NestedEnum_BAR = 2,
+  TestAllTypes_NestedEnum_BAZ = 3,
+  TestAllTypes_NestedEnum_NEG = -1,
+  TestAllTypes_NestedEnum_TestAllTypes_NestedEnum_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  TestAllTypes_NestedEnum_TestAllTypes_NestedEnum_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool TestAllTypes_NestedEnum_IsValid(int value);
+extern const uint32_t TestAllTypes_NestedEnum_internal_data_[];
+constexpr TestAllTypes_NestedEnum TestAllTypes_NestedEnum_NestedEnum_MIN = static_cast<TestAllTypes_NestedEnum>(-1);
+constexpr TestAllTypes_NestedEnum TestAllTypes_NestedEnum_NestedEnum_MAX = static_cast<TestAllTypes_NestedEnum>(3);
+constexpr int TestAllTypes_NestedEnum_NestedEnum_ARRAYSIZE = 3 + 1;
+const ::google::protobuf::EnumDescriptor*
+TestAllTypes_NestedEnum_descriptor();
+template <typename T>
+const std::string& TestAllTypes_NestedEnum_Name(T value) {
+  static_assert(std::is_same<T, TestAllTypes_NestedEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to NestedEnum_Name().");
+  return TestAllTypes_NestedEnum_Name(static_cast<TestAllTypes_NestedEnum>(value));
+}
+template <>
+inline const std::string& TestAllTypes_NestedEnum_Name(TestAllTypes_NestedEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<TestAllTypes_NestedEnum_descriptor,
+                                                 -1, 3>(
+      static_cast<int>(value));
+}
+inline bool TestAllTypes_NestedEnum_Parse(absl::string_view name, TestAllTypes_NestedEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TestAllTypes_NestedEnum>(
+      TestAllTypes_NestedEnum_descriptor(), name, value);
+}
+enum TestOneof2_NestedEnum : int {
+  TestOneof2_NestedEnum_UNKNOWN = 0,
+  TestOneof2_NestedEnum_FOO = 1,
+  TestOneof2_NestedEnum_BAR = 2,
+  TestOneof2_NestedEnum_BAZ = 3,
+  TestOneof2_NestedEnum_TestOneof2_NestedEnum_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  TestOneof2_NestedEnum_TestOneof2_NestedEnum_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool TestOneof2_NestedEnum_IsValid(int value);
+extern const uint32_t TestOneof2_NestedEnum_internal_data_[];
+constexpr TestOneof2_NestedEnum TestOneof2_NestedEnum_NestedEnum_MIN = static_cast<TestOneof2_NestedEnum>(0);
+constexpr TestOneof2_NestedEnum TestOneof2_NestedEnum_NestedEnum_MAX = static_cast<TestOneof2_NestedEnum>(3);
+constexpr int TestOneof2_NestedEnum_NestedEnum_ARRAYSIZE = 3 + 1;
+const ::google::protobuf::EnumDescriptor*
+TestOneof2_NestedEnum_descriptor();
+template <typename T>
+const std::string& TestOneof2_NestedEnum_Name(T value) {
+  static_assert(std::is_same<T, TestOneof2_NestedEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to NestedEnum_Name().");
+  return TestOneof2_NestedEnum_Name(static_cast<TestOneof2_NestedEnum>(value));
+}
+template <>
+inline const std::string& TestOneof2_NestedEnum_Name(TestOneof2_NestedEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<TestOneof2_NestedEnum_descriptor,
+                                                 0, 3>(
+      static_cast<int>(value));
+}
+inline bool TestOneof2_NestedEnum_Parse(absl::string_view name, TestOneof2_NestedEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TestOneof2_NestedEnum>(
+      TestOneof2_NestedEnum_descriptor(), name, value);
+}
+enum ForeignEnum : int {
+  FOREIGN_ZERO = 0,
+  FOREIGN_FOO = 4,
+  FOREIGN_BAR = 5,
+  FOREIGN_BAZ = 6,
+  ForeignEnum_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  ForeignEnum_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool ForeignEnum_IsValid(int value);
+extern const uint32_t ForeignEnum_internal_data_[];
+constexpr ForeignEnum ForeignEnum_MIN = static_cast<ForeignEnum>(0);
+constexpr ForeignEnum ForeignEnum_MAX = static_cast<ForeignEnum>(6);
+constexpr int ForeignEnum_ARRAYSIZE = 6 + 1;
+const ::google::protobuf::EnumDescriptor*
+ForeignEnum_descriptor();
+template <typename T>
+const std::string& ForeignEnum_Name(T value) {
+  static_assert(std::is_same<T, ForeignEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to ForeignEnum_Name().");
+  return ForeignEnum_Name(static_cast<ForeignEnum>(value));
+}
+template <>
+inline const std::string& ForeignEnum_Name(ForeignEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<ForeignEnum_descriptor,
+                                                 0, 6>(
+      static_cast<int>(value));
+}
+inline bool ForeignEnum_Parse(absl::string_view name, ForeignEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<ForeignEnum>(
+      ForeignEnum_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestUnpackedTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestUnpackedTypes) */ {
+ public:
+  inline TestUnpackedTypes() : TestUnpackedTypes(nullptr) {}
+  ~TestUnpackedTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestUnpackedTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestUnpackedTypes(const TestUnpackedTypes& from)
+      : TestUnpackedTypes(nullptr, from) {}
+  TestUnpackedTypes(TestUnpackedTypes&& from) noexcept
+    : TestUnpackedTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestUnpackedTypes& operator=(const TestUnpackedTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestUnpackedTypes& operator=(TestUnpackedTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestUnpackedTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestUnpackedTypes* internal_default_instance() {
+    return reinterpret_cast<const TestUnpackedTypes*>(
+               &_TestUnpackedTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TestUnpackedTypes& a, TestUnpackedTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestUnpackedTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestUnpackedTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestUnpackedTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestUnpackedTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestUnpackedTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestUnpackedTypes& from) {
+    TestUnpackedTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestUnpackedTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestUnpackedTypes";
+  }
+  protected:
+  explicit TestUnpackedTypes(::google::protobuf::Arena* arena);
+  TestUnpackedTypes(::google::protobuf::Arena* arena, const TestUnpackedTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 1,
+    kRepeatedInt64FieldNumber = 2,
+    kRepeatedUint32FieldNumber = 3,
+    kRepeatedUint64FieldNumber = 4,
+    kRepeatedSint32FieldNumber = 5,
+    kRepeatedSint64FieldNumber = 6,
+    kRepeatedFixed32FieldNumber = 7,
+    kRepeatedFixed64FieldNumber = 8,
+    kRepeatedSfixed32FieldNumber = 9,
+    kRepeatedSfixed64FieldNumber = 10,
+    kRepeatedFloatFieldNumber = 11,
+    kRepeatedDoubleFieldNumber = 12,
+    kRepeatedBoolFieldNumber = 13,
+    kRepeatedNestedEnumFieldNumber = 14,
+  };
+  // repeated int32 repeated_int32 = 1 [packed = false];
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // repeated int64 repeated_int64 = 2 [packed = false];
+  int repeated_int64_size() const;
+  private:
+  int _internal_repeated_int64_size() const;
+
+  public:
+  void clear_repeated_int64() ;
+  ::int64_t repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::int64_t value);
+  void add_repeated_int64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_int64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_int64();
+
+  public:
+  // repeated uint32 repeated_uint32 = 3 [packed = false];
+  int repeated_uint32_size() const;
+  private:
+  int _internal_repeated_uint32_size() const;
+
+  public:
+  void clear_repeated_uint32() ;
+  ::uint32_t repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::uint32_t value);
+  void add_repeated_uint32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_uint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_uint32();
+
+  public:
+  // repeated uint64 repeated_uint64 = 4 [packed = false];
+  int repeated_uint64_size() const;
+  private:
+  int _internal_repeated_uint64_size() const;
+
+  public:
+  void clear_repeated_uint64() ;
+  ::uint64_t repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::uint64_t value);
+  void add_repeated_uint64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_uint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_uint64();
+
+  public:
+  // repeated sint32 repeated_sint32 = 5 [packed = false];
+  int repeated_sint32_size() const;
+  private:
+  int _internal_repeated_sint32_size() const;
+
+  public:
+  void clear_repeated_sint32() ;
+  ::int32_t repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::int32_t value);
+  void add_repeated_sint32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sint32();
+
+  public:
+  // repeated sint64 repeated_sint64 = 6 [packed = false];
+  int repeated_sint64_size() const;
+  private:
+  int _internal_repeated_sint64_size() const;
+
+  public:
+  void clear_repeated_sint64() ;
+  ::int64_t repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::int64_t value);
+  void add_repeated_sint64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sint64();
+
+  public:
+  // repeated fixed32 repeated_fixed32 = 7 [packed = false];
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+
+  public:
+  void clear_repeated_fixed32() ;
+  ::uint32_t repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::uint32_t value);
+  void add_repeated_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_fixed32();
+
+  public:
+  // repeated fixed64 repeated_fixed64 = 8 [packed = false];
+  int repeated_fixed64_size() const;
+  private:
+  int _internal_repeated_fixed64_size() const;
+
+  public:
+  void clear_repeated_fixed64() ;
+  ::uint64_t repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::uint64_t value);
+  void add_repeated_fixed64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_fixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_fixed64();
+
+  public:
+  // repeated sfixed32 repeated_sfixed32 = 9 [packed = false];
+  int repeated_sfixed32_size() const;
+  private:
+  int _internal_repeated_sfixed32_size() const;
+
+  public:
+  void clear_repeated_sfixed32() ;
+  ::int32_t repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::int32_t value);
+  void add_repeated_sfixed32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sfixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sfixed32();
+
+  public:
+  // repeated sfixed64 repeated_sfixed64 = 10 [packed = false];
+  int repeated_sfixed64_size() const;
+  private:
+  int _internal_repeated_sfixed64_size() const;
+
+  public:
+  void clear_repeated_sfixed64() ;
+  ::int64_t repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::int64_t value);
+  void add_repeated_sfixed64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sfixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sfixed64();
+
+  public:
+  // repeated float repeated_float = 11 [packed = false];
+  int repeated_float_size() const;
+  private:
+  int _internal_repeated_float_size() const;
+
+  public:
+  void clear_repeated_float() ;
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::google::protobuf::RepeatedField<float>& repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* mutable_repeated_float();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_repeated_float();
+
+  public:
+  // repeated double repeated_double = 12 [packed = false];
+  int repeated_double_size() const;
+  private:
+  int _internal_repeated_double_size() const;
+
+  public:
+  void clear_repeated_double() ;
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::google::protobuf::RepeatedField<double>& repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* mutable_repeated_double();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_repeated_double();
+
+  public:
+  // repeated bool repeated_bool = 13 [packed = false];
+  int repeated_bool_size() const;
+  private:
+  int _internal_repeated_bool_size() const;
+
+  public:
+  void clear_repeated_bool() ;
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::google::protobuf::RepeatedField<bool>& repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_repeated_bool();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_repeated_bool();
+
+  public:
+  // repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 14 [packed = false];
+  int repeated_nested_enum_size() const;
+  private:
+  int _internal_repeated_nested_enum_size() const;
+
+  public:
+  void clear_repeated_nested_enum() ;
+  public:
+  ::proto3_unittest::TestAllTypes_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value);
+  void add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_nested_enum();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestUnpackedTypes)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      4, 14, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_int64_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_uint32_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_uint64_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sint32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sint64_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_fixed32_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_fixed64_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sfixed32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sfixed64_;
+    ::google::protobuf::RepeatedField<float> repeated_float_;
+    ::google::protobuf::RepeatedField<double> repeated_double_;
+    ::google::protobuf::RepeatedField<bool> repeated_bool_;
+    ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestPackedTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestPackedTypes) */ {
+ public:
+  inline TestPackedTypes() : TestPackedTypes(nullptr) {}
+  ~TestPackedTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestPackedTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestPackedTypes(const TestPackedTypes& from)
+      : TestPackedTypes(nullptr, from) {}
+  TestPackedTypes(TestPackedTypes&& from) noexcept
+    : TestPackedTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestPackedTypes& operator=(const TestPackedTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestPackedTypes& operator=(TestPackedTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestPackedTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestPackedTypes* internal_default_instance() {
+    return reinterpret_cast<const TestPackedTypes*>(
+               &_TestPackedTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestPackedTypes& a, TestPackedTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestPackedTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestPackedTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestPackedTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestPackedTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestPackedTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestPackedTypes& from) {
+    TestPackedTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestPackedTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestPackedTypes";
+  }
+  protected:
+  explicit TestPackedTypes(::google::protobuf::Arena* arena);
+  TestPackedTypes(::google::protobuf::Arena* arena, const TestPackedTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPackedInt32FieldNumber = 90,
+    kPackedInt64FieldNumber = 91,
+    kPackedUint32FieldNumber = 92,
+    kPackedUint64FieldNumber = 93,
+    kPackedSint32FieldNumber = 94,
+    kPackedSint64FieldNumber = 95,
+    kPackedFixed32FieldNumber = 96,
+    kPackedFixed64FieldNumber = 97,
+    kPackedSfixed32FieldNumber = 98,
+    kPackedSfixed64FieldNumber = 99,
+    kPackedFloatFieldNumber = 100,
+    kPackedDoubleFieldNumber = 101,
+    kPackedBoolFieldNumber = 102,
+    kPackedEnumFieldNumber = 103,
+  };
+  // repeated int32 packed_int32 = 90 [packed = true];
+  int packed_int32_size() const;
+  private:
+  int _internal_packed_int32_size() const;
+
+  public:
+  void clear_packed_int32() ;
+  ::int32_t packed_int32(int index) const;
+  void set_packed_int32(int index, ::int32_t value);
+  void add_packed_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_int32();
+
+  public:
+  // repeated int64 packed_int64 = 91 [packed = true];
+  int packed_int64_size() const;
+  private:
+  int _internal_packed_int64_size() const;
+
+  public:
+  void clear_packed_int64() ;
+  ::int64_t packed_int64(int index) const;
+  void set_packed_int64(int index, ::int64_t value);
+  void add_packed_int64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& packed_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_packed_int64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_packed_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_packed_int64();
+
+  public:
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  int packed_uint32_size() const;
+  private:
+  int _internal_packed_uint32_size() const;
+
+  public:
+  void clear_packed_uint32() ;
+  ::uint32_t packed_uint32(int index) const;
+  void set_packed_uint32(int index, ::uint32_t value);
+  void add_packed_uint32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& packed_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_packed_uint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_packed_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_packed_uint32();
+
+  public:
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  int packed_uint64_size() const;
+  private:
+  int _internal_packed_uint64_size() const;
+
+  public:
+  void clear_packed_uint64() ;
+  ::uint64_t packed_uint64(int index) const;
+  void set_packed_uint64(int index, ::uint64_t value);
+  void add_packed_uint64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& packed_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_packed_uint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_packed_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_packed_uint64();
+
+  public:
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  int packed_sint32_size() const;
+  private:
+  int _internal_packed_sint32_size() const;
+
+  public:
+  void clear_packed_sint32() ;
+  ::int32_t packed_sint32(int index) const;
+  void set_packed_sint32(int index, ::int32_t value);
+  void add_packed_sint32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_sint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_sint32();
+
+  public:
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  int packed_sint64_size() const;
+  private:
+  int _internal_packed_sint64_size() const;
+
+  public:
+  void clear_packed_sint64() ;
+  ::int64_t packed_sint64(int index) const;
+  void set_packed_sint64(int index, ::int64_t value);
+  void add_packed_sint64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& packed_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_packed_sint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_packed_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_packed_sint64();
+
+  public:
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  int packed_fixed32_size() const;
+  private:
+  int _internal_packed_fixed32_size() const;
+
+  public:
+  void clear_packed_fixed32() ;
+  ::uint32_t packed_fixed32(int index) const;
+  void set_packed_fixed32(int index, ::uint32_t value);
+  void add_packed_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& packed_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_packed_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_packed_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_packed_fixed32();
+
+  public:
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  int packed_fixed64_size() const;
+  private:
+  int _internal_packed_fixed64_size() const;
+
+  public:
+  void clear_packed_fixed64() ;
+  ::uint64_t packed_fixed64(int index) const;
+  void set_packed_fixed64(int index, ::uint64_t value);
+  void add_packed_fixed64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& packed_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_packed_fixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_packed_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_packed_fixed64();
+
+  public:
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  int packed_sfixed32_size() const;
+  private:
+  int _internal_packed_sfixed32_size() const;
+
+  public:
+  void clear_packed_sfixed32() ;
+  ::int32_t packed_sfixed32(int index) const;
+  void set_packed_sfixed32(int index, ::int32_t value);
+  void add_packed_sfixed32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& packed_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_packed_sfixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_packed_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_packed_sfixed32();
+
+  public:
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  int packed_sfixed64_size() const;
+  private:
+  int _internal_packed_sfixed64_size() const;
+
+  public:
+  void clear_packed_sfixed64() ;
+  ::int64_t packed_sfixed64(int index) const;
+  void set_packed_sfixed64(int index, ::int64_t value);
+  void add_packed_sfixed64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& packed_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_packed_sfixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_packed_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_packed_sfixed64();
+
+  public:
+  // repeated float packed_float = 100 [packed = true];
+  int packed_float_size() const;
+  private:
+  int _internal_packed_float_size() const;
+
+  public:
+  void clear_packed_float() ;
+  float packed_float(int index) const;
+  void set_packed_float(int index, float value);
+  void add_packed_float(float value);
+  const ::google::protobuf::RepeatedField<float>& packed_float() const;
+  ::google::protobuf::RepeatedField<float>* mutable_packed_float();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_packed_float() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_packed_float();
+
+  public:
+  // repeated double packed_double = 101 [packed = true];
+  int packed_double_size() const;
+  private:
+  int _internal_packed_double_size() const;
+
+  public:
+  void clear_packed_double() ;
+  double packed_double(int index) const;
+  void set_packed_double(int index, double value);
+  void add_packed_double(double value);
+  const ::google::protobuf::RepeatedField<double>& packed_double() const;
+  ::google::protobuf::RepeatedField<double>* mutable_packed_double();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_packed_double() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_packed_double();
+
+  public:
+  // repeated bool packed_bool = 102 [packed = true];
+  int packed_bool_size() const;
+  private:
+  int _internal_packed_bool_size() const;
+
+  public:
+  void clear_packed_bool() ;
+  bool packed_bool(int index) const;
+  void set_packed_bool(int index, bool value);
+  void add_packed_bool(bool value);
+  const ::google::protobuf::RepeatedField<bool>& packed_bool() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_packed_bool();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_packed_bool() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_packed_bool();
+
+  public:
+  // repeated .proto3_unittest.ForeignEnum packed_enum = 103 [packed = true];
+  int packed_enum_size() const;
+  private:
+  int _internal_packed_enum_size() const;
+
+  public:
+  void clear_packed_enum() ;
+  public:
+  ::proto3_unittest::ForeignEnum packed_enum(int index) const;
+  void set_packed_enum(int index, ::proto3_unittest::ForeignEnum value);
+  void add_packed_enum(::proto3_unittest::ForeignEnum value);
+  const ::google::protobuf::RepeatedField<int>& packed_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_packed_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_packed_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_packed_enum();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestPackedTypes)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      4, 14, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<::int32_t> packed_int32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_int32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> packed_int64_;
+    mutable ::google::protobuf::internal::CachedSize _packed_int64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> packed_uint32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_uint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint64_t> packed_uint64_;
+    mutable ::google::protobuf::internal::CachedSize _packed_uint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int32_t> packed_sint32_;
+    mutable ::google::protobuf::internal::CachedSize _packed_sint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> packed_sint64_;
+    mutable ::google::protobuf::internal::CachedSize _packed_sint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> packed_fixed32_;
+    ::google::protobuf::RepeatedField<::uint64_t> packed_fixed64_;
+    ::google::protobuf::RepeatedField<::int32_t> packed_sfixed32_;
+    ::google::protobuf::RepeatedField<::int64_t> packed_sfixed64_;
+    ::google::protobuf::RepeatedField<float> packed_float_;
+    ::google::protobuf::RepeatedField<double> packed_double_;
+    ::google::protobuf::RepeatedField<bool> packed_bool_;
+    ::google::protobuf::RepeatedField<int> packed_enum_;
+    mutable ::google::protobuf::internal::CachedSize _packed_enum_cached_byte_size_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestOneof2 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestOneof2) */ {
+ public:
+  inline TestOneof2() : TestOneof2(nullptr) {}
+  ~TestOneof2() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestOneof2(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestOneof2(const TestOneof2& from)
+      : TestOneof2(nullptr, from) {}
+  TestOneof2(TestOneof2&& from) noexcept
+    : TestOneof2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestOneof2& operator=(const TestOneof2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestOneof2& operator=(TestOneof2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestOneof2& default_instance() {
+    return *internal_default_instance();
+  }
+  enum FooCase {
+    kFooEnum = 6,
+    FOO_NOT_SET = 0,
+  };
+
+  static inline const TestOneof2* internal_default_instance() {
+    return reinterpret_cast<const TestOneof2*>(
+               &_TestOneof2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(TestOneof2& a, TestOneof2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestOneof2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestOneof2* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestOneof2* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestOneof2>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestOneof2& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestOneof2& from) {
+    TestOneof2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestOneof2* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestOneof2";
+  }
+  protected:
+  explicit TestOneof2(::google::protobuf::Arena* arena);
+  TestOneof2(::google::protobuf::Arena* arena, const TestOneof2& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using NestedEnum = TestOneof2_NestedEnum;
+  static constexpr NestedEnum UNKNOWN = TestOneof2_NestedEnum_UNKNOWN;
+  static constexpr NestedEnum FOO = TestOneof2_NestedEnum_FOO;
+  static constexpr NestedEnum BAR = TestOneof2_NestedEnum_BAR;
+  static constexpr NestedEnum BAZ = TestOneof2_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestOneof2_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN = TestOneof2_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX = TestOneof2_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE = TestOneof2_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* NestedEnum_descriptor() {
+    return TestOneof2_NestedEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& NestedEnum_Name(T value) {
+    return TestOneof2_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(absl::string_view name, NestedEnum* value) {
+    return TestOneof2_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFooEnumFieldNumber = 6,
+  };
+  // .proto3_unittest.TestOneof2.NestedEnum foo_enum = 6;
+  bool has_foo_enum() const;
+  void clear_foo_enum() ;
+  ::proto3_unittest::TestOneof2_NestedEnum foo_enum() const;
+  void set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value);
+
+  private:
+  ::proto3_unittest::TestOneof2_NestedEnum _internal_foo_enum() const;
+  void _internal_set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value);
+
+  public:
+  void clear_foo();
+  FooCase foo_case() const;
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestOneof2)
+ private:
+  class _Internal;
+  void set_has_foo_enum();
+
+  inline bool has_foo() const;
+  inline void clear_has_foo();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    union FooUnion {
+      constexpr FooUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      int foo_enum_;
+    } foo_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMessageWithDummy final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestMessageWithDummy) */ {
+ public:
+  inline TestMessageWithDummy() : TestMessageWithDummy(nullptr) {}
+  ~TestMessageWithDummy() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMessageWithDummy(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMessageWithDummy(const TestMessageWithDummy& from)
+      : TestMessageWithDummy(nullptr, from) {}
+  TestMessageWithDummy(TestMessageWithDummy&& from) noexcept
+    : TestMessageWithDummy() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageWithDummy& operator=(const TestMessageWithDummy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageWithDummy& operator=(TestMessageWithDummy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestMessageWithDummy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMessageWithDummy* internal_default_instance() {
+    return reinterpret_cast<const TestMessageWithDummy*>(
+               &_TestMessageWithDummy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(TestMessageWithDummy& a, TestMessageWithDummy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageWithDummy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageWithDummy* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMessageWithDummy* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMessageWithDummy>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestMessageWithDummy& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestMessageWithDummy& from) {
+    TestMessageWithDummy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMessageWithDummy* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestMessageWithDummy";
+  }
+  protected:
+  explicit TestMessageWithDummy(::google::protobuf::Arena* arena);
+  TestMessageWithDummy(::google::protobuf::Arena* arena, const TestMessageWithDummy& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDummyFieldNumber = 536870911,
+  };
+  // bool dummy = 536870911;
+  void clear_dummy() ;
+  bool dummy() const;
+  void set_dummy(bool value);
+
+  private:
+  bool _internal_dummy() const;
+  void _internal_set_dummy(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestMessageWithDummy)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 7>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    bool dummy_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestEmptyMessage final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:proto3_unittest.TestEmptyMessage) */ {
+ public:
+  inline TestEmptyMessage() : TestEmptyMessage(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEmptyMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEmptyMessage(const TestEmptyMessage& from)
+      : TestEmptyMessage(nullptr, from) {}
+  TestEmptyMessage(TestEmptyMessage&& from) noexcept
+    : TestEmptyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEmptyMessage& operator=(const TestEmptyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEmptyMessage& operator=(TestEmptyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestEmptyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEmptyMessage* internal_default_instance() {
+    return reinterpret_cast<const TestEmptyMessage*>(
+               &_TestEmptyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(TestEmptyMessage& a, TestEmptyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEmptyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEmptyMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEmptyMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEmptyMessage>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const TestEmptyMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const TestEmptyMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestEmptyMessage";
+  }
+  protected:
+  explicit TestEmptyMessage(::google::protobuf::Arena* arena);
+  TestEmptyMessage(::google::protobuf::Arena* arena, const TestEmptyMessage& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestEmptyMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypes_NestedMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestAllTypes.NestedMessage) */ {
+ public:
+  inline TestAllTypes_NestedMessage() : TestAllTypes_NestedMessage(nullptr) {}
+  ~TestAllTypes_NestedMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypes_NestedMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypes_NestedMessage(const TestAllTypes_NestedMessage& from)
+      : TestAllTypes_NestedMessage(nullptr, from) {}
+  TestAllTypes_NestedMessage(TestAllTypes_NestedMessage&& from) noexcept
+    : TestAllTypes_NestedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypes_NestedMessage& operator=(const TestAllTypes_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypes_NestedMessage& operator=(TestAllTypes_NestedMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestAllTypes_NestedMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAllTypes_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypes_NestedMessage*>(
+               &_TestAllTypes_NestedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestAllTypes_NestedMessage& a, TestAllTypes_NestedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypes_NestedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypes_NestedMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypes_NestedMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypes_NestedMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestAllTypes_NestedMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestAllTypes_NestedMessage& from) {
+    TestAllTypes_NestedMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypes_NestedMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestAllTypes.NestedMessage";
+  }
+  protected:
+  explicit TestAllTypes_NestedMessage(::google::protobuf::Arena* arena);
+  TestAllTypes_NestedMessage(::google::protobuf::Arena* arena, const TestAllTypes_NestedMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBbFieldNumber = 1,
+  };
+  // int32 bb = 1;
+  void clear_bb() ;
+  ::int32_t bb() const;
+  void set_bb(::int32_t value);
+
+  private:
+  ::int32_t _internal_bb() const;
+  void _internal_set_bb(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestAllTypes.NestedMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t bb_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class ForeignMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.ForeignMessage) */ {
+ public:
+  inline ForeignMessage() : ForeignMessage(nullptr) {}
+  ~ForeignMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR ForeignMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline ForeignMessage(const ForeignMessage& from)
+      : ForeignMessage(nullptr, from) {}
+  ForeignMessage(ForeignMessage&& from) noexcept
+    : ForeignMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ForeignMessage& operator=(const ForeignMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ForeignMessage& operator=(ForeignMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ForeignMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ForeignMessage* internal_default_instance() {
+    return reinterpret_cast<const ForeignMessage*>(
+               &_ForeignMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ForeignMessage& a, ForeignMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ForeignMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ForeignMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ForeignMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ForeignMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ForeignMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const ForeignMessage& from) {
+    ForeignMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(ForeignMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.ForeignMessage";
+  }
+  protected:
+  explicit ForeignMessage(::google::protobuf::Arena* arena);
+  ForeignMessage(::google::protobuf::Arena* arena, const ForeignMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCFieldNumber = 1,
+  };
+  // int32 c = 1;
+  void clear_c() ;
+  ::int32_t c() const;
+  void set_c(::int32_t value);
+
+  private:
+  ::int32_t _internal_c() const;
+  void _internal_set_c(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.ForeignMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t c_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAllTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestAllTypes) */ {
+ public:
+  inline TestAllTypes() : TestAllTypes(nullptr) {}
+  ~TestAllTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAllTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAllTypes(const TestAllTypes& from)
+      : TestAllTypes(nullptr, from) {}
+  TestAllTypes(TestAllTypes&& from) noexcept
+    : TestAllTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypes& operator=(const TestAllTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypes& operator=(TestAllTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestAllTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofFieldCase {
+    kOneofUint32 = 111,
+    kOneofNestedMessage = 112,
+    kOneofString = 113,
+    kOneofBytes = 114,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static inline const TestAllTypes* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypes*>(
+               &_TestAllTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestAllTypes& a, TestAllTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAllTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAllTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestAllTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestAllTypes& from) {
+    TestAllTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAllTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.TestAllTypes";
+  }
+  protected:
+  explicit TestAllTypes(::google::protobuf::Arena* arena);
+  TestAllTypes(::google::protobuf::Arena* arena, const TestAllTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using NestedMessage = TestAllTypes_NestedMessage;
+
+  using NestedEnum = TestAllTypes_NestedEnum;
+  static constexpr NestedEnum ZERO = TestAllTypes_NestedEnum_ZERO;
+  static constexpr NestedEnum FOO = TestAllTypes_NestedEnum_FOO;
+  static constexpr NestedEnum BAR = TestAllTypes_NestedEnum_BAR;
+  static constexpr NestedEnum BAZ = TestAllTypes_NestedEnum_BAZ;
+  static constexpr NestedEnum NEG = TestAllTypes_NestedEnum_NEG;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestAllTypes_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN = TestAllTypes_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX = TestAllTypes_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE = TestAllTypes_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* NestedEnum_descriptor() {
+    return TestAllTypes_NestedEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& NestedEnum_Name(T value) {
+    return TestAllTypes_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(absl::string_view name, NestedEnum* value) {
+    return TestAllTypes_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 31,
+    kRepeatedInt64FieldNumber = 32,
+    kRepeatedUint32FieldNumber = 33,
+    kRepeatedUint64FieldNumber = 34,
+    kRepeatedSint32FieldNumber = 35,
+    kRepeatedSint64FieldNumber = 36,
+    kRepeatedFixed32FieldNumber = 37,
+    kRepeatedFixed64FieldNumber = 38,
+    kRepeatedSfixed32FieldNumber = 39,
+    kRepeatedSfixed64FieldNumber = 40,
+    kRepeatedFloatFieldNumber = 41,
+    kRepeatedDoubleFieldNumber = 42,
+    kRepeatedBoolFieldNumber = 43,
+    kRepeatedStringFieldNumber = 44,
+    kRepeatedBytesFieldNumber = 45,
+    kRepeatedNestedMessageFieldNumber = 48,
+    kRepeatedForeignMessageFieldNumber = 49,
+    kRepeatedImportMessageFieldNumber = 50,
+    kRepeatedNestedEnumFieldNumber = 51,
+    kRepeatedForeignEnumFieldNumber = 52,
+    kRepeatedStringPieceFieldNumber = 54,
+    kRepeatedCordFieldNumber = 55,
+    kRepeatedLazyMessageFieldNumber = 57,
+    kOptionalStringFieldNumber = 14,
+    kOptionalBytesFieldNumber = 15,
+    kOptionalStringPieceFieldNumber = 24,
+    kOptionalCordFieldNumber = 25,
+    kOptionalNestedMessageFieldNumber = 18,
+    kOptionalForeignMessageFieldNumber = 19,
+    kOptionalImportMessageFieldNumber = 20,
+    kOptionalPublicImportMessageFieldNumber = 26,
+    kOptionalLazyMessageFieldNumber = 27,
+    kOptionalUnverifiedLazyMessageFieldNumber = 28,
+    kOptionalLazyImportMessageFieldNumber = 115,
+    kOptionalInt64FieldNumber = 2,
+    kOptionalInt32FieldNumber = 1,
+    kOptionalUint32FieldNumber = 3,
+    kOptionalUint64FieldNumber = 4,
+    kOptionalSint64FieldNumber = 6,
+    kOptionalSint32FieldNumber = 5,
+    kOptionalFixed32FieldNumber = 7,
+    kOptionalFixed64FieldNumber = 8,
+    kOptionalSfixed64FieldNumber = 10,
+    kOptionalSfixed32FieldNumber = 9,
+    kOptionalFloatFieldNumber = 11,
+    kOptionalDoubleFieldNumber = 12,
+    kOptionalBoolFieldNumber = 13,
+    kOptionalNestedEnumFieldNumber = 21,
+    kOptionalForeignEnumFieldNumber = 22,
+    kOneofUint32FieldNumber = 111,
+    kOneofNestedMessageFieldNumber = 112,
+    kOneofStringFieldNumber = 113,
+    kOneofBytesFieldNumber = 114,
+  };
+  // repeated int32 repeated_int32 = 31;
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+
+  public:
+  void clear_repeated_int32() ;
+  ::int32_t repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::int32_t value);
+  void add_repeated_int32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32();
+
+  public:
+  // repeated int64 repeated_int64 = 32;
+  int repeated_int64_size() const;
+  private:
+  int _internal_repeated_int64_size() const;
+
+  public:
+  void clear_repeated_int64() ;
+  ::int64_t repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::int64_t value);
+  void add_repeated_int64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_int64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_int64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_int64();
+
+  public:
+  // repeated uint32 repeated_uint32 = 33;
+  int repeated_uint32_size() const;
+  private:
+  int _internal_repeated_uint32_size() const;
+
+  public:
+  void clear_repeated_uint32() ;
+  ::uint32_t repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::uint32_t value);
+  void add_repeated_uint32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_uint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_uint32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_uint32();
+
+  public:
+  // repeated uint64 repeated_uint64 = 34;
+  int repeated_uint64_size() const;
+  private:
+  int _internal_repeated_uint64_size() const;
+
+  public:
+  void clear_repeated_uint64() ;
+  ::uint64_t repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::uint64_t value);
+  void add_repeated_uint64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_uint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_uint64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_uint64();
+
+  public:
+  // repeated sint32 repeated_sint32 = 35;
+  int repeated_sint32_size() const;
+  private:
+  int _internal_repeated_sint32_size() const;
+
+  public:
+  void clear_repeated_sint32() ;
+  ::int32_t repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::int32_t value);
+  void add_repeated_sint32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sint32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sint32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sint32();
+
+  public:
+  // repeated sint64 repeated_sint64 = 36;
+  int repeated_sint64_size() const;
+  private:
+  int _internal_repeated_sint64_size() const;
+
+  public:
+  void clear_repeated_sint64() ;
+  ::int64_t repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::int64_t value);
+  void add_repeated_sint64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sint64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sint64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sint64();
+
+  public:
+  // repeated fixed32 repeated_fixed32 = 37;
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+
+  public:
+  void clear_repeated_fixed32() ;
+  ::uint32_t repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::uint32_t value);
+  void add_repeated_fixed32(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_fixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_fixed32() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_fixed32();
+
+  public:
+  // repeated fixed64 repeated_fixed64 = 38;
+  int repeated_fixed64_size() const;
+  private:
+  int _internal_repeated_fixed64_size() const;
+
+  public:
+  void clear_repeated_fixed64() ;
+  ::uint64_t repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::uint64_t value);
+  void add_repeated_fixed64(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_fixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_fixed64() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_fixed64();
+
+  public:
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  int repeated_sfixed32_size() const;
+  private:
+  int _internal_repeated_sfixed32_size() const;
+
+  public:
+  void clear_repeated_sfixed32() ;
+  ::int32_t repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::int32_t value);
+  void add_repeated_sfixed32(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_sfixed32();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_sfixed32();
+
+  public:
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  int repeated_sfixed64_size() const;
+  private:
+  int _internal_repeated_sfixed64_size() const;
+
+  public:
+  void clear_repeated_sfixed64() ;
+  ::int64_t repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::int64_t value);
+  void add_repeated_sfixed64(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_sfixed64();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_sfixed64();
+
+  public:
+  // repeated float repeated_float = 41;
+  int repeated_float_size() const;
+  private:
+  int _internal_repeated_float_size() const;
+
+  public:
+  void clear_repeated_float() ;
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::google::protobuf::RepeatedField<float>& repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* mutable_repeated_float();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_repeated_float() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_repeated_float();
+
+  public:
+  // repeated double repeated_double = 42;
+  int repeated_double_size() const;
+  private:
+  int _internal_repeated_double_size() const;
+
+  public:
+  void clear_repeated_double() ;
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::google::protobuf::RepeatedField<double>& repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* mutable_repeated_double();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_repeated_double() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_repeated_double();
+
+  public:
+  // repeated bool repeated_bool = 43;
+  int repeated_bool_size() const;
+  private:
+  int _internal_repeated_bool_size() const;
+
+  public:
+  void clear_repeated_bool() ;
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::google::protobuf::RepeatedField<bool>& repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_repeated_bool();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_repeated_bool() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_repeated_bool();
+
+  public:
+  // repeated string repeated_string = 44;
+  int repeated_string_size() const;
+  private:
+  int _internal_repeated_string_size() const;
+
+  public:
+  void clear_repeated_string() ;
+  const std::string& repeated_string(int index) const;
+  std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const std::string& value);
+  void set_repeated_string(int index, std::string&& value);
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, std::size_t size);
+  void set_repeated_string(int index, absl::string_view value);
+  std::string* add_repeated_string();
+  void add_repeated_string(const std::string& value);
+  void add_repeated_string(std::string&& value);
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, std::size_t size);
+  void add_repeated_string(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string();
+
+  public:
+  // repeated bytes repeated_bytes = 45;
+  int repeated_bytes_size() const;
+  private:
+  int _internal_repeated_bytes_size() const;
+
+  public:
+  void clear_repeated_bytes() ;
+  const std::string& repeated_bytes(int index) const;
+  std::string* mutable_repeated_bytes(int index);
+  void set_repeated_bytes(int index, const std::string& value);
+  void set_repeated_bytes(int index, std::string&& value);
+  void set_repeated_bytes(int index, const char* value);
+  void set_repeated_bytes(int index, const void* value, std::size_t size);
+  void set_repeated_bytes(int index, absl::string_view value);
+  std::string* add_repeated_bytes();
+  void add_repeated_bytes(const std::string& value);
+  void add_repeated_bytes(std::string&& value);
+  void add_repeated_bytes(const char* value);
+  void add_repeated_bytes(const void* value, std::size_t size);
+  void add_repeated_bytes(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_bytes();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_bytes();
+
+  public:
+  // repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  int repeated_nested_message_size() const;
+  private:
+  int _internal_repeated_nested_message_size() const;
+
+  public:
+  void clear_repeated_nested_message() ;
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_repeated_nested_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >*
+      mutable_repeated_nested_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>& _internal_repeated_nested_message() const;
+  ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>* _internal_mutable_repeated_nested_message();
+  public:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& repeated_nested_message(int index) const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* add_repeated_nested_message();
+  const ::google::protobuf::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >&
+      repeated_nested_message() const;
+  // repeated .proto3_unittest.ForeignMessage repeated_foreign_message = 49;
+  int repeated_foreign_message_size() const;
+  private:
+  int _internal_repeated_foreign_message_size() const;
+
+  public:
+  void clear_repeated_foreign_message() ;
+  ::proto3_unittest::ForeignMessage* mutable_repeated_foreign_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3_unittest::ForeignMessage >*
+      mutable_repeated_foreign_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3_unittest::ForeignMessage>& _internal_repeated_foreign_message() const;
+  ::google::protobuf::RepeatedPtrField<::proto3_unittest::ForeignMessage>* _internal_mutable_repeated_foreign_message();
+  public:
+  const ::proto3_unittest::ForeignMessage& repeated_foreign_message(int index) const;
+  ::proto3_unittest::ForeignMessage* add_repeated_foreign_message();
+  const ::google::protobuf::RepeatedPtrField< ::proto3_unittest::ForeignMessage >&
+      repeated_foreign_message() const;
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  int repeated_import_message_size() const;
+  private:
+  int _internal_repeated_import_message_size() const;
+
+  public:
+  void clear_repeated_import_message() ;
+  ::protobuf_unittest_import::ImportMessage* mutable_repeated_import_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >*
+      mutable_repeated_import_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessage>& _internal_repeated_import_message() const;
+  ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessage>* _internal_mutable_repeated_import_message();
+  public:
+  const ::protobuf_unittest_import::ImportMessage& repeated_import_message(int index) const;
+  ::protobuf_unittest_import::ImportMessage* add_repeated_import_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >&
+      repeated_import_message() const;
+  // repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  int repeated_nested_enum_size() const;
+  private:
+  int _internal_repeated_nested_enum_size() const;
+
+  public:
+  void clear_repeated_nested_enum() ;
+  public:
+  ::proto3_unittest::TestAllTypes_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value);
+  void add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_nested_enum();
+
+  public:
+  // repeated .proto3_unittest.ForeignEnum repeated_foreign_enum = 52;
+  int repeated_foreign_enum_size() const;
+  private:
+  int _internal_repeated_foreign_enum_size() const;
+
+  public:
+  void clear_repeated_foreign_enum() ;
+  public:
+  ::proto3_unittest::ForeignEnum repeated_foreign_enum(int index) const;
+  void set_repeated_foreign_enum(int index, ::proto3_unittest::ForeignEnum value);
+  void add_repeated_foreign_enum(::proto3_unittest::ForeignEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_foreign_enum();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_foreign_enum();
+
+  public:
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  int repeated_string_piece_size() const;
+  private:
+  int _internal_repeated_string_piece_size() const;
+
+  public:
+  void clear_repeated_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& repeated_string_piece(int index) const;
+  std::string* mutable_repeated_string_piece(int index);
+  void set_repeated_string_piece(int index, const std::string& value);
+  void set_repeated_string_piece(int index, std::string&& value);
+  void set_repeated_string_piece(int index, const char* value);
+  void set_repeated_string_piece(int index, const char* value, std::size_t size);
+  void set_repeated_string_piece(int index, absl::string_view value);
+  std::string* add_repeated_string_piece();
+  void add_repeated_string_piece(const std::string& value);
+  void add_repeated_string_piece(std::string&& value);
+  void add_repeated_string_piece(const char* value);
+  void add_repeated_string_piece(const char* value, std::size_t size);
+  void add_repeated_string_piece(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string_piece() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string_piece();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string_piece() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string_piece();
+
+  public:
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  int repeated_cord_size() const;
+  private:
+  int _internal_repeated_cord_size() const;
+
+  public:
+  void clear_repeated_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& repeated_cord(int index) const;
+  std::string* mutable_repeated_cord(int index);
+  void set_repeated_cord(int index, const std::string& value);
+  void set_repeated_cord(int index, std::string&& value);
+  void set_repeated_cord(int index, const char* value);
+  void set_repeated_cord(int index, const char* value, std::size_t size);
+  void set_repeated_cord(int index, absl::string_view value);
+  std::string* add_repeated_cord();
+  void add_repeated_cord(const std::string& value);
+  void add_repeated_cord(std::string&& value);
+  void add_repeated_cord(const char* value);
+  void add_repeated_cord(const char* value, std::size_t size);
+  void add_repeated_cord(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_cord() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_cord();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_cord() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_cord();
+
+  public:
+  // repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  int repeated_lazy_message_size() const;
+  private:
+  int _internal_repeated_lazy_message_size() const;
+
+  public:
+  void clear_repeated_lazy_message() ;
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_repeated_lazy_message(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >*
+      mutable_repeated_lazy_message();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>& _internal_repeated_lazy_message() const;
+  ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>* _internal_mutable_repeated_lazy_message();
+  public:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& repeated_lazy_message(int index) const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* add_repeated_lazy_message();
+  const ::google::protobuf::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >&
+      repeated_lazy_message() const;
+  // string optional_string = 14;
+  void clear_optional_string() ;
+  const std::string& optional_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string();
+  PROTOBUF_NODISCARD std::string* release_optional_string();
+  void set_allocated_optional_string(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string();
+
+  public:
+  // bytes optional_bytes = 15;
+  void clear_optional_bytes() ;
+  const std::string& optional_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_bytes();
+  PROTOBUF_NODISCARD std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_optional_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_optional_bytes();
+
+  public:
+  // string optional_string_piece = 24 [ctype = STRING_PIECE];
+  void clear_optional_string_piece() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& optional_string_piece() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_string_piece(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_string_piece();
+  PROTOBUF_NODISCARD std::string* release_optional_string_piece();
+  void set_allocated_optional_string_piece(std::string* value);
+
+  private:
+  const std::string& _internal_optional_string_piece() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_string_piece(
+      const std::string& value);
+  std::string* _internal_mutable_optional_string_piece();
+
+  public:
+  // string optional_cord = 25 [ctype = CORD];
+  void clear_optional_cord() ;
+  private:  // Hidden due to unknown ctype option.
+  const std::string& optional_cord() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_optional_cord(Arg_&& arg, Args_... args);
+  std::string* mutable_optional_cord();
+  PROTOBUF_NODISCARD std::string* release_optional_cord();
+  void set_allocated_optional_cord(std::string* value);
+
+  private:
+  const std::string& _internal_optional_cord() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_optional_cord(
+      const std::string& value);
+  std::string* _internal_mutable_optional_cord();
+
+  public:
+  // optional .proto3_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+  bool has_optional_nested_message() const;
+  void clear_optional_nested_message() ;
+  const ::proto3_unittest::TestAllTypes_NestedMessage& optional_nested_message() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::TestAllTypes_NestedMessage* release_optional_nested_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_optional_nested_message();
+  void set_allocated_optional_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_nested_message();
+
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_optional_nested_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_nested_message();
+
+  public:
+  // .proto3_unittest.ForeignMessage optional_foreign_message = 19;
+  bool has_optional_foreign_message() const;
+  void clear_optional_foreign_message() ;
+  const ::proto3_unittest::ForeignMessage& optional_foreign_message() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::ForeignMessage* release_optional_foreign_message();
+  ::proto3_unittest::ForeignMessage* mutable_optional_foreign_message();
+  void set_allocated_optional_foreign_message(::proto3_unittest::ForeignMessage* value);
+  void unsafe_arena_set_allocated_optional_foreign_message(::proto3_unittest::ForeignMessage* value);
+  ::proto3_unittest::ForeignMessage* unsafe_arena_release_optional_foreign_message();
+
+  private:
+  const ::proto3_unittest::ForeignMessage& _internal_optional_foreign_message() const;
+  ::proto3_unittest::ForeignMessage* _internal_mutable_optional_foreign_message();
+
+  public:
+  // .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  bool has_optional_import_message() const;
+  void clear_optional_import_message() ;
+  const ::protobuf_unittest_import::ImportMessage& optional_import_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest_import::ImportMessage* release_optional_import_message();
+  ::protobuf_unittest_import::ImportMessage* mutable_optional_import_message();
+  void set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessage* value);
+  void unsafe_arena_set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessage* value);
+  ::protobuf_unittest_import::ImportMessage* unsafe_arena_release_optional_import_message();
+
+  private:
+  const ::protobuf_unittest_import::ImportMessage& _internal_optional_import_message() const;
+  ::protobuf_unittest_import::ImportMessage* _internal_mutable_optional_import_message();
+
+  public:
+  // .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+  bool has_optional_public_import_message() const;
+  void clear_optional_public_import_message() ;
+  const ::protobuf_unittest_import::PublicImportMessage& optional_public_import_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest_import::PublicImportMessage* release_optional_public_import_message();
+  ::protobuf_unittest_import::PublicImportMessage* mutable_optional_public_import_message();
+  void set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessage* value);
+  void unsafe_arena_set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessage* value);
+  ::protobuf_unittest_import::PublicImportMessage* unsafe_arena_release_optional_public_import_message();
+
+  private:
+  const ::protobuf_unittest_import::PublicImportMessage& _internal_optional_public_import_message() const;
+  ::protobuf_unittest_import::PublicImportMessage* _internal_mutable_optional_public_import_message();
+
+  public:
+  // .proto3_unittest.TestAllTypes.NestedMessage optional_lazy_message = 27 [lazy = true];
+  bool has_optional_lazy_message() const;
+  void clear_optional_lazy_message() ;
+  const ::proto3_unittest::TestAllTypes_NestedMessage& optional_lazy_message() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::TestAllTypes_NestedMessage* release_optional_lazy_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_optional_lazy_message();
+  void set_allocated_optional_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_lazy_message();
+
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_optional_lazy_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_lazy_message();
+
+  public:
+  // .proto3_unittest.TestAllTypes.NestedMessage optional_unverified_lazy_message = 28 [unverified_lazy = true];
+  bool has_optional_unverified_lazy_message() const;
+  void clear_optional_unverified_lazy_message() ;
+  const ::proto3_unittest::TestAllTypes_NestedMessage& optional_unverified_lazy_message() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::TestAllTypes_NestedMessage* release_optional_unverified_lazy_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_optional_unverified_lazy_message();
+  void set_allocated_optional_unverified_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_optional_unverified_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_unverified_lazy_message();
+
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_optional_unverified_lazy_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_unverified_lazy_message();
+
+  public:
+  // .protobuf_unittest_import.ImportMessage optional_lazy_import_message = 115 [lazy = true];
+  bool has_optional_lazy_import_message() const;
+  void clear_optional_lazy_import_message() ;
+  const ::protobuf_unittest_import::ImportMessage& optional_lazy_import_message() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest_import::ImportMessage* release_optional_lazy_import_message();
+  ::protobuf_unittest_import::ImportMessage* mutable_optional_lazy_import_message();
+  void set_allocated_optional_lazy_import_message(::protobuf_unittest_import::ImportMessage* value);
+  void unsafe_arena_set_allocated_optional_lazy_import_message(::protobuf_unittest_import::ImportMessage* value);
+  ::protobuf_unittest_import::ImportMessage* unsafe_arena_release_optional_lazy_import_message();
+
+  private:
+  const ::protobuf_unittest_import::ImportMessage& _internal_optional_lazy_import_message() const;
+  ::protobuf_unittest_import::ImportMessage* _internal_mutable_optional_lazy_import_message();
+
+  public:
+  // int64 optional_int64 = 2;
+  void clear_optional_int64() ;
+  ::int64_t optional_int64() const;
+  void set_optional_int64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_int64() const;
+  void _internal_set_optional_int64(::int64_t value);
+
+  public:
+  // int32 optional_int32 = 1;
+  void clear_optional_int32() ;
+  ::int32_t optional_int32() const;
+  void set_optional_int32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_int32() const;
+  void _internal_set_optional_int32(::int32_t value);
+
+  public:
+  // uint32 optional_uint32 = 3;
+  void clear_optional_uint32() ;
+  ::uint32_t optional_uint32() const;
+  void set_optional_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_optional_uint32() const;
+  void _internal_set_optional_uint32(::uint32_t value);
+
+  public:
+  // uint64 optional_uint64 = 4;
+  void clear_optional_uint64() ;
+  ::uint64_t optional_uint64() const;
+  void set_optional_uint64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_optional_uint64() const;
+  void _internal_set_optional_uint64(::uint64_t value);
+
+  public:
+  // sint64 optional_sint64 = 6;
+  void clear_optional_sint64() ;
+  ::int64_t optional_sint64() const;
+  void set_optional_sint64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_sint64() const;
+  void _internal_set_optional_sint64(::int64_t value);
+
+  public:
+  // sint32 optional_sint32 = 5;
+  void clear_optional_sint32() ;
+  ::int32_t optional_sint32() const;
+  void set_optional_sint32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_sint32() const;
+  void _internal_set_optional_sint32(::int32_t value);
+
+  public:
+  // fixed32 optional_fixed32 = 7;
+  void clear_optional_fixed32() ;
+  ::uint32_t optional_fixed32() const;
+  void set_optional_fixed32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_optional_fixed32() const;
+  void _internal_set_optional_fixed32(::uint32_t value);
+
+  public:
+  // fixed64 optional_fixed64 = 8;
+  void clear_optional_fixed64() ;
+  ::uint64_t optional_fixed64() const;
+  void set_optional_fixed64(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_optional_fixed64() const;
+  void _internal_set_optional_fixed64(::uint64_t value);
+
+  public:
+  // sfixed64 optional_sfixed64 = 10;
+  void clear_optional_sfixed64() ;
+  ::int64_t optional_sfixed64() const;
+  void set_optional_sfixed64(::int64_t value);
+
+  private:
+  ::int64_t _internal_optional_sfixed64() const;
+  void _internal_set_optional_sfixed64(::int64_t value);
+
+  public:
+  // sfixed32 optional_sfixed32 = 9;
+  void clear_optional_sfixed32() ;
+  ::int32_t optional_sfixed32() const;
+  void set_optional_sfixed32(::int32_t value);
+
+  private:
+  ::int32_t _internal_optional_sfixed32() const;
+  void _internal_set_optional_sfixed32(::int32_t value);
+
+  public:
+  // float optional_float = 11;
+  void clear_optional_float() ;
+  float optional_float() const;
+  void set_optional_float(float value);
+
+  private:
+  float _internal_optional_float() const;
+  void _internal_set_optional_float(float value);
+
+  public:
+  // double optional_double = 12;
+  void clear_optional_double() ;
+  double optional_double() const;
+  void set_optional_double(double value);
+
+  private:
+  double _internal_optional_double() const;
+  void _internal_set_optional_double(double value);
+
+  public:
+  // bool optional_bool = 13;
+  void clear_optional_bool() ;
+  bool optional_bool() const;
+  void set_optional_bool(bool value);
+
+  private:
+  bool _internal_optional_bool() const;
+  void _internal_set_optional_bool(bool value);
+
+  public:
+  // .proto3_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  void clear_optional_nested_enum() ;
+  ::proto3_unittest::TestAllTypes_NestedEnum optional_nested_enum() const;
+  void set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+
+  private:
+  ::proto3_unittest::TestAllTypes_NestedEnum _internal_optional_nested_enum() const;
+  void _internal_set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+
+  public:
+  // .proto3_unittest.ForeignEnum optional_foreign_enum = 22;
+  void clear_optional_foreign_enum() ;
+  ::proto3_unittest::ForeignEnum optional_foreign_enum() const;
+  void set_optional_foreign_enum(::proto3_unittest::ForeignEnum value);
+
+  private:
+  ::proto3_unittest::ForeignEnum _internal_optional_foreign_enum() const;
+  void _internal_set_optional_foreign_enum(::proto3_unittest::ForeignEnum value);
+
+  public:
+  // uint32 oneof_uint32 = 111;
+  bool has_oneof_uint32() const;
+  void clear_oneof_uint32() ;
+  ::uint32_t oneof_uint32() const;
+  void set_oneof_uint32(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_oneof_uint32() const;
+  void _internal_set_oneof_uint32(::uint32_t value);
+
+  public:
+  // .proto3_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+  bool has_oneof_nested_message() const;
+  private:
+  bool _internal_has_oneof_nested_message() const;
+
+  public:
+  void clear_oneof_nested_message() ;
+  const ::proto3_unittest::TestAllTypes_NestedMessage& oneof_nested_message() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::TestAllTypes_NestedMessage* release_oneof_nested_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_oneof_nested_message();
+  void set_allocated_oneof_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  void unsafe_arena_set_allocated_oneof_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_oneof_nested_message();
+
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_oneof_nested_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_oneof_nested_message();
+
+  public:
+  // string oneof_string = 113;
+  bool has_oneof_string() const;
+  void clear_oneof_string() ;
+  const std::string& oneof_string() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string();
+  PROTOBUF_NODISCARD std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+
+  public:
+  // bytes oneof_bytes = 114;
+  bool has_oneof_bytes() const;
+  void clear_oneof_bytes() ;
+  const std::string& oneof_bytes() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_bytes(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_bytes();
+  PROTOBUF_NODISCARD std::string* release_oneof_bytes();
+  void set_allocated_oneof_bytes(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_bytes(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_bytes();
+
+  public:
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestAllTypes)
+ private:
+  class _Internal;
+  void set_has_oneof_uint32();
+  void set_has_oneof_nested_message();
+  void set_has_oneof_string();
+  void set_has_oneof_bytes();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 53, 12,
+      195, 17>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_int64_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_uint32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_uint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_uint64_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_uint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sint32_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_sint32_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sint64_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_sint64_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_fixed32_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_fixed64_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_sfixed32_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_sfixed64_;
+    ::google::protobuf::RepeatedField<float> repeated_float_;
+    ::google::protobuf::RepeatedField<double> repeated_double_;
+    ::google::protobuf::RepeatedField<bool> repeated_bool_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_bytes_;
+    ::google::protobuf::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage > repeated_nested_message_;
+    ::google::protobuf::RepeatedPtrField< ::proto3_unittest::ForeignMessage > repeated_foreign_message_;
+    ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage > repeated_import_message_;
+    ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_nested_enum_cached_byte_size_;
+    ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_foreign_enum_cached_byte_size_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_piece_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_cord_;
+    ::google::protobuf::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage > repeated_lazy_message_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_;
+    ::google::protobuf::internal::ArenaStringPtr optional_bytes_;
+    ::google::protobuf::internal::ArenaStringPtr optional_string_piece_;
+    ::google::protobuf::internal::ArenaStringPtr optional_cord_;
+    ::proto3_unittest::TestAllTypes_NestedMessage* optional_nested_message_;
+    ::proto3_unittest::ForeignMessage* optional_foreign_message_;
+    ::protobuf_unittest_import::ImportMessage* optional_import_message_;
+    ::protobuf_unittest_import::PublicImportMessage* optional_public_import_message_;
+    ::proto3_unittest::TestAllTypes_NestedMessage* optional_lazy_message_;
+    ::proto3_unittest::TestAllTypes_NestedMessage* optional_unverified_lazy_message_;
+    ::protobuf_unittest_import::ImportMessage* optional_lazy_import_message_;
+    ::int64_t optional_int64_;
+    ::int32_t optional_int32_;
+    ::uint32_t optional_uint32_;
+    ::uint64_t optional_uint64_;
+    ::int64_t optional_sint64_;
+    ::int32_t optional_sint32_;
+    ::uint32_t optional_fixed32_;
+    ::uint64_t optional_fixed64_;
+    ::int64_t optional_sfixed64_;
+    ::int32_t optional_sfixed32_;
+    float optional_float_;
+    double optional_double_;
+    bool optional_bool_;
+    int optional_nested_enum_;
+    int optional_foreign_enum_;
+    union OneofFieldUnion {
+      constexpr OneofFieldUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::uint32_t oneof_uint32_;
+      ::proto3_unittest::TestAllTypes_NestedMessage* oneof_nested_message_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_bytes_;
+    } oneof_field_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class NestedTestAllTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.NestedTestAllTypes) */ {
+ public:
+  inline NestedTestAllTypes() : NestedTestAllTypes(nullptr) {}
+  ~NestedTestAllTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR NestedTestAllTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline NestedTestAllTypes(const NestedTestAllTypes& from)
+      : NestedTestAllTypes(nullptr, from) {}
+  NestedTestAllTypes(NestedTestAllTypes&& from) noexcept
+    : NestedTestAllTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline NestedTestAllTypes& operator=(const NestedTestAllTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NestedTestAllTypes& operator=(NestedTestAllTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NestedTestAllTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NestedTestAllTypes* internal_default_instance() {
+    return reinterpret_cast<const NestedTestAllTypes*>(
+               &_NestedTestAllTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(NestedTestAllTypes& a, NestedTestAllTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NestedTestAllTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NestedTestAllTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NestedTestAllTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NestedTestAllTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const NestedTestAllTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const NestedTestAllTypes& from) {
+    NestedTestAllTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(NestedTestAllTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3_unittest.NestedTestAllTypes";
+  }
+  protected:
+  explicit NestedTestAllTypes(::google::protobuf::Arena* arena);
+  NestedTestAllTypes(::google::protobuf::Arena* arena, const NestedTestAllTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChildFieldNumber = 1,
+    kPayloadFieldNumber = 2,
+  };
+  // .proto3_unittest.NestedTestAllTypes child = 1;
+  bool has_child() const;
+  void clear_child() ;
+  const ::proto3_unittest::NestedTestAllTypes& child() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::NestedTestAllTypes* release_child();
+  ::proto3_unittest::NestedTestAllTypes* mutable_child();
+  void set_allocated_child(::proto3_unittest::NestedTestAllTypes* value);
+  void unsafe_arena_set_allocated_child(::proto3_unittest::NestedTestAllTypes* value);
+  ::proto3_unittest::NestedTestAllTypes* unsafe_arena_release_child();
+
+  private:
+  const ::proto3_unittest::NestedTestAllTypes& _internal_child() const;
+  ::proto3_unittest::NestedTestAllTypes* _internal_mutable_child();
+
+  public:
+  // .proto3_unittest.TestAllTypes payload = 2;
+  bool has_payload() const;
+  void clear_payload() ;
+  const ::proto3_unittest::TestAllTypes& payload() const;
+  PROTOBUF_NODISCARD ::proto3_unittest::TestAllTypes* release_payload();
+  ::proto3_unittest::TestAllTypes* mutable_payload();
+  void set_allocated_payload(::proto3_unittest::TestAllTypes* value);
+  void unsafe_arena_set_allocated_payload(::proto3_unittest::TestAllTypes* value);
+  ::proto3_unittest::TestAllTypes* unsafe_arena_release_payload();
+
+  private:
+  const ::proto3_unittest::TestAllTypes& _internal_payload() const;
+  ::proto3_unittest::TestAllTypes* _internal_mutable_payload();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3_unittest.NestedTestAllTypes)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::proto3_unittest::NestedTestAllTypes* child_;
+    ::proto3_unittest::TestAllTypes* payload_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestAllTypes_NestedMessage
+
+// int32 bb = 1;
+inline void TestAllTypes_NestedMessage::clear_bb() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bb_ = 0;
+}
+inline ::int32_t TestAllTypes_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.NestedMessage.bb)
+  return _internal_bb();
+}
+inline void TestAllTypes_NestedMessage::set_bb(::int32_t value) {
+  _internal_set_bb(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.NestedMessage.bb)
+}
+inline ::int32_t TestAllTypes_NestedMessage::_internal_bb() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bb_;
+}
+inline void TestAllTypes_NestedMessage::_internal_set_bb(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bb_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypes
+
+// int32 optional_int32 = 1;
+inline void TestAllTypes::clear_optional_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int32_ = 0;
+}
+inline ::int32_t TestAllTypes::optional_int32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_int32)
+  return _internal_optional_int32();
+}
+inline void TestAllTypes::set_optional_int32(::int32_t value) {
+  _internal_set_optional_int32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_int32)
+}
+inline ::int32_t TestAllTypes::_internal_optional_int32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int32_;
+}
+inline void TestAllTypes::_internal_set_optional_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_int32_ = value;
+}
+
+// int64 optional_int64 = 2;
+inline void TestAllTypes::clear_optional_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_int64_ = ::int64_t{0};
+}
+inline ::int64_t TestAllTypes::optional_int64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_int64)
+  return _internal_optional_int64();
+}
+inline void TestAllTypes::set_optional_int64(::int64_t value) {
+  _internal_set_optional_int64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_int64)
+}
+inline ::int64_t TestAllTypes::_internal_optional_int64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_int64_;
+}
+inline void TestAllTypes::_internal_set_optional_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_int64_ = value;
+}
+
+// uint32 optional_uint32 = 3;
+inline void TestAllTypes::clear_optional_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_uint32_ = 0u;
+}
+inline ::uint32_t TestAllTypes::optional_uint32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_uint32)
+  return _internal_optional_uint32();
+}
+inline void TestAllTypes::set_optional_uint32(::uint32_t value) {
+  _internal_set_optional_uint32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_uint32)
+}
+inline ::uint32_t TestAllTypes::_internal_optional_uint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_uint32_;
+}
+inline void TestAllTypes::_internal_set_optional_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_uint32_ = value;
+}
+
+// uint64 optional_uint64 = 4;
+inline void TestAllTypes::clear_optional_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_uint64_ = ::uint64_t{0u};
+}
+inline ::uint64_t TestAllTypes::optional_uint64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_uint64)
+  return _internal_optional_uint64();
+}
+inline void TestAllTypes::set_optional_uint64(::uint64_t value) {
+  _internal_set_optional_uint64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_uint64)
+}
+inline ::uint64_t TestAllTypes::_internal_optional_uint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_uint64_;
+}
+inline void TestAllTypes::_internal_set_optional_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_uint64_ = value;
+}
+
+// sint32 optional_sint32 = 5;
+inline void TestAllTypes::clear_optional_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sint32_ = 0;
+}
+inline ::int32_t TestAllTypes::optional_sint32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sint32)
+  return _internal_optional_sint32();
+}
+inline void TestAllTypes::set_optional_sint32(::int32_t value) {
+  _internal_set_optional_sint32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sint32)
+}
+inline ::int32_t TestAllTypes::_internal_optional_sint32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sint32_;
+}
+inline void TestAllTypes::_internal_set_optional_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sint32_ = value;
+}
+
+// sint64 optional_sint64 = 6;
+inline void TestAllTypes::clear_optional_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sint64_ = ::int64_t{0};
+}
+inline ::int64_t TestAllTypes::optional_sint64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sint64)
+  return _internal_optional_sint64();
+}
+inline void TestAllTypes::set_optional_sint64(::int64_t value) {
+  _internal_set_optional_sint64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sint64)
+}
+inline ::int64_t TestAllTypes::_internal_optional_sint64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sint64_;
+}
+inline void TestAllTypes::_internal_set_optional_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sint64_ = value;
+}
+
+// fixed32 optional_fixed32 = 7;
+inline void TestAllTypes::clear_optional_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_fixed32_ = 0u;
+}
+inline ::uint32_t TestAllTypes::optional_fixed32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_fixed32)
+  return _internal_optional_fixed32();
+}
+inline void TestAllTypes::set_optional_fixed32(::uint32_t value) {
+  _internal_set_optional_fixed32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_fixed32)
+}
+inline ::uint32_t TestAllTypes::_internal_optional_fixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_fixed32_;
+}
+inline void TestAllTypes::_internal_set_optional_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_fixed32_ = value;
+}
+
+// fixed64 optional_fixed64 = 8;
+inline void TestAllTypes::clear_optional_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_fixed64_ = ::uint64_t{0u};
+}
+inline ::uint64_t TestAllTypes::optional_fixed64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_fixed64)
+  return _internal_optional_fixed64();
+}
+inline void TestAllTypes::set_optional_fixed64(::uint64_t value) {
+  _internal_set_optional_fixed64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_fixed64)
+}
+inline ::uint64_t TestAllTypes::_internal_optional_fixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_fixed64_;
+}
+inline void TestAllTypes::_internal_set_optional_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_fixed64_ = value;
+}
+
+// sfixed32 optional_sfixed32 = 9;
+inline void TestAllTypes::clear_optional_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sfixed32_ = 0;
+}
+inline ::int32_t TestAllTypes::optional_sfixed32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sfixed32)
+  return _internal_optional_sfixed32();
+}
+inline void TestAllTypes::set_optional_sfixed32(::int32_t value) {
+  _internal_set_optional_sfixed32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sfixed32)
+}
+inline ::int32_t TestAllTypes::_internal_optional_sfixed32() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sfixed32_;
+}
+inline void TestAllTypes::_internal_set_optional_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sfixed32_ = value;
+}
+
+// sfixed64 optional_sfixed64 = 10;
+inline void TestAllTypes::clear_optional_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_sfixed64_ = ::int64_t{0};
+}
+inline ::int64_t TestAllTypes::optional_sfixed64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sfixed64)
+  return _internal_optional_sfixed64();
+}
+inline void TestAllTypes::set_optional_sfixed64(::int64_t value) {
+  _internal_set_optional_sfixed64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sfixed64)
+}
+inline ::int64_t TestAllTypes::_internal_optional_sfixed64() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_sfixed64_;
+}
+inline void TestAllTypes::_internal_set_optional_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_sfixed64_ = value;
+}
+
+// float optional_float = 11;
+inline void TestAllTypes::clear_optional_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_float_ = 0;
+}
+inline float TestAllTypes::optional_float() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_float)
+  return _internal_optional_float();
+}
+inline void TestAllTypes::set_optional_float(float value) {
+  _internal_set_optional_float(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_float)
+}
+inline float TestAllTypes::_internal_optional_float() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_float_;
+}
+inline void TestAllTypes::_internal_set_optional_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_float_ = value;
+}
+
+// double optional_double = 12;
+inline void TestAllTypes::clear_optional_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_double_ = 0;
+}
+inline double TestAllTypes::optional_double() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_double)
+  return _internal_optional_double();
+}
+inline void TestAllTypes::set_optional_double(double value) {
+  _internal_set_optional_double(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_double)
+}
+inline double TestAllTypes::_internal_optional_double() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_double_;
+}
+inline void TestAllTypes::_internal_set_optional_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_double_ = value;
+}
+
+// bool optional_bool = 13;
+inline void TestAllTypes::clear_optional_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bool_ = false;
+}
+inline bool TestAllTypes::optional_bool() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_bool)
+  return _internal_optional_bool();
+}
+inline void TestAllTypes::set_optional_bool(bool value) {
+  _internal_set_optional_bool(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_bool)
+}
+inline bool TestAllTypes::_internal_optional_bool() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bool_;
+}
+inline void TestAllTypes::_internal_set_optional_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_bool_ = value;
+}
+
+// string optional_string = 14;
+inline void TestAllTypes::clear_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_string)
+  return _internal_optional_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_string)
+}
+inline std::string* TestAllTypes::mutable_optional_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_string)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_string_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_string)
+  return _impl_.optional_string_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_.IsDefault()) {
+          _impl_.optional_string_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_string)
+}
+
+// bytes optional_bytes = 15;
+inline void TestAllTypes::clear_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bytes_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_bytes)
+  return _internal_optional_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_bytes)
+}
+inline std::string* TestAllTypes::mutable_optional_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_bytes();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_bytes_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_bytes_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_bytes_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_bytes)
+  return _impl_.optional_bytes_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_bytes_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_bytes_.IsDefault()) {
+          _impl_.optional_bytes_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_bytes)
+}
+
+// optional .proto3_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+inline bool TestAllTypes::has_optional_nested_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_nested_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_nested_message_ != nullptr) _impl_.optional_nested_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_nested_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3_unittest::TestAllTypes_NestedMessage* p = _impl_.optional_nested_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3_unittest::TestAllTypes_NestedMessage&>(::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_nested_message)
+  return _internal_optional_nested_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_nested_message_);
+  }
+  _impl_.optional_nested_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_nested_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3_unittest::TestAllTypes_NestedMessage* released = _impl_.optional_nested_message_;
+  _impl_.optional_nested_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_nested_message)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = _impl_.optional_nested_message_;
+  _impl_.optional_nested_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.optional_nested_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(GetArena());
+    _impl_.optional_nested_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(p);
+  }
+  return _impl_.optional_nested_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_optional_nested_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_nested_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(_impl_.optional_nested_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.optional_nested_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_nested_message)
+}
+
+// .proto3_unittest.ForeignMessage optional_foreign_message = 19;
+inline bool TestAllTypes::has_optional_foreign_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_foreign_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_foreign_message_ != nullptr) _impl_.optional_foreign_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::_internal_optional_foreign_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3_unittest::ForeignMessage* p = _impl_.optional_foreign_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3_unittest::ForeignMessage&>(::proto3_unittest::_ForeignMessage_default_instance_);
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::optional_foreign_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_foreign_message)
+  return _internal_optional_foreign_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_foreign_message(::proto3_unittest::ForeignMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_foreign_message_);
+  }
+  _impl_.optional_foreign_message_ = reinterpret_cast<::proto3_unittest::ForeignMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_foreign_message)
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::release_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto3_unittest::ForeignMessage* released = _impl_.optional_foreign_message_;
+  _impl_.optional_foreign_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::unsafe_arena_release_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_foreign_message)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto3_unittest::ForeignMessage* temp = _impl_.optional_foreign_message_;
+  _impl_.optional_foreign_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::_internal_mutable_optional_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.optional_foreign_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::ForeignMessage>(GetArena());
+    _impl_.optional_foreign_message_ = reinterpret_cast<::proto3_unittest::ForeignMessage*>(p);
+  }
+  return _impl_.optional_foreign_message_;
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::mutable_optional_foreign_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::ForeignMessage* _msg = _internal_mutable_optional_foreign_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_foreign_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_foreign_message(::proto3_unittest::ForeignMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3_unittest::ForeignMessage*>(_impl_.optional_foreign_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3_unittest::ForeignMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.optional_foreign_message_ = reinterpret_cast<::proto3_unittest::ForeignMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_foreign_message)
+}
+
+// .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+inline bool TestAllTypes::has_optional_import_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_import_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::_internal_optional_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest_import::ImportMessage* p = _impl_.optional_import_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest_import::ImportMessage&>(::protobuf_unittest_import::_ImportMessage_default_instance_);
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::optional_import_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_import_message)
+  return _internal_optional_import_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_import_message_);
+  }
+  _impl_.optional_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_import_message)
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::release_optional_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest_import::ImportMessage* released = _impl_.optional_import_message_;
+  _impl_.optional_import_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::unsafe_arena_release_optional_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_import_message)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::protobuf_unittest_import::ImportMessage* temp = _impl_.optional_import_message_;
+  _impl_.optional_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::_internal_mutable_optional_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.optional_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::ImportMessage>(GetArena());
+    _impl_.optional_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessage*>(p);
+  }
+  return _impl_.optional_import_message_;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_optional_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest_import::ImportMessage* _msg = _internal_mutable_optional_import_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_import_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_import_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.optional_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_import_message)
+}
+
+// .proto3_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+inline void TestAllTypes::clear_optional_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_nested_enum_ = 0;
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::optional_nested_enum() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_nested_enum)
+  return _internal_optional_nested_enum();
+}
+inline void TestAllTypes::set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  _internal_set_optional_nested_enum(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_nested_enum)
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::_internal_optional_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3_unittest::TestAllTypes_NestedEnum>(_impl_.optional_nested_enum_);
+}
+inline void TestAllTypes::_internal_set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_nested_enum_ = value;
+}
+
+// .proto3_unittest.ForeignEnum optional_foreign_enum = 22;
+inline void TestAllTypes::clear_optional_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_foreign_enum_ = 0;
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::optional_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_foreign_enum)
+  return _internal_optional_foreign_enum();
+}
+inline void TestAllTypes::set_optional_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  _internal_set_optional_foreign_enum(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_foreign_enum)
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::_internal_optional_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3_unittest::ForeignEnum>(_impl_.optional_foreign_enum_);
+}
+inline void TestAllTypes::_internal_set_optional_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_foreign_enum_ = value;
+}
+
+// string optional_string_piece = 24 [ctype = STRING_PIECE];
+inline void TestAllTypes::clear_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_piece_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_string_piece() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_string_piece)
+  return _internal_optional_string_piece();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_string_piece(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_piece_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+inline std::string* TestAllTypes::mutable_optional_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_string_piece();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_string_piece_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_string_piece_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_string_piece_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_string_piece)
+  return _impl_.optional_string_piece_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_string_piece(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_string_piece_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_string_piece_.IsDefault()) {
+          _impl_.optional_string_piece_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+
+// string optional_cord = 25 [ctype = CORD];
+inline void TestAllTypes::clear_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_cord_.ClearToEmpty();
+}
+inline const std::string& TestAllTypes::optional_cord() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_cord)
+  return _internal_optional_cord();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_optional_cord(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_cord_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_cord)
+}
+inline std::string* TestAllTypes::mutable_optional_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_optional_cord();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_cord)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_optional_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.optional_cord_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.optional_cord_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.optional_cord_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_optional_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_cord)
+  return _impl_.optional_cord_.Release();
+}
+inline void TestAllTypes::set_allocated_optional_cord(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.optional_cord_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.optional_cord_.IsDefault()) {
+          _impl_.optional_cord_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_cord)
+}
+
+// .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+inline bool TestAllTypes::has_optional_public_import_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_public_import_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest_import::PublicImportMessage& TestAllTypes::_internal_optional_public_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest_import::PublicImportMessage* p = _impl_.optional_public_import_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest_import::PublicImportMessage&>(::protobuf_unittest_import::_PublicImportMessage_default_instance_);
+}
+inline const ::protobuf_unittest_import::PublicImportMessage& TestAllTypes::optional_public_import_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_public_import_message)
+  return _internal_optional_public_import_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_public_import_message_);
+  }
+  _impl_.optional_public_import_message_ = reinterpret_cast<::protobuf_unittest_import::PublicImportMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_public_import_message)
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::release_optional_public_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::protobuf_unittest_import::PublicImportMessage* released = _impl_.optional_public_import_message_;
+  _impl_.optional_public_import_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::unsafe_arena_release_optional_public_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_public_import_message)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::protobuf_unittest_import::PublicImportMessage* temp = _impl_.optional_public_import_message_;
+  _impl_.optional_public_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::_internal_mutable_optional_public_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.optional_public_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::PublicImportMessage>(GetArena());
+    _impl_.optional_public_import_message_ = reinterpret_cast<::protobuf_unittest_import::PublicImportMessage*>(p);
+  }
+  return _impl_.optional_public_import_message_;
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::mutable_optional_public_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest_import::PublicImportMessage* _msg = _internal_mutable_optional_public_import_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_public_import_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_public_import_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.optional_public_import_message_ = reinterpret_cast<::protobuf_unittest_import::PublicImportMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_public_import_message)
+}
+
+// .proto3_unittest.TestAllTypes.NestedMessage optional_lazy_message = 27 [lazy = true];
+inline bool TestAllTypes::has_optional_lazy_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_lazy_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_lazy_message_ != nullptr) _impl_.optional_lazy_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3_unittest::TestAllTypes_NestedMessage* p = _impl_.optional_lazy_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3_unittest::TestAllTypes_NestedMessage&>(::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_lazy_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_lazy_message)
+  return _internal_optional_lazy_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_lazy_message_);
+  }
+  _impl_.optional_lazy_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::proto3_unittest::TestAllTypes_NestedMessage* released = _impl_.optional_lazy_message_;
+  _impl_.optional_lazy_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_lazy_message)
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = _impl_.optional_lazy_message_;
+  _impl_.optional_lazy_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.optional_lazy_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(GetArena());
+    _impl_.optional_lazy_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(p);
+  }
+  return _impl_.optional_lazy_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_optional_lazy_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_lazy_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(_impl_.optional_lazy_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+
+  _impl_.optional_lazy_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_message)
+}
+
+// .proto3_unittest.TestAllTypes.NestedMessage optional_unverified_lazy_message = 28 [unverified_lazy = true];
+inline bool TestAllTypes::has_optional_unverified_lazy_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_unverified_lazy_message_ != nullptr);
+  return value;
+}
+inline void TestAllTypes::clear_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.optional_unverified_lazy_message_ != nullptr) _impl_.optional_unverified_lazy_message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_unverified_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3_unittest::TestAllTypes_NestedMessage* p = _impl_.optional_unverified_lazy_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3_unittest::TestAllTypes_NestedMessage&>(::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_unverified_lazy_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_unverified_lazy_message)
+  return _internal_optional_unverified_lazy_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_unverified_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_unverified_lazy_message_);
+  }
+  _impl_.optional_unverified_lazy_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_unverified_lazy_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::proto3_unittest::TestAllTypes_NestedMessage* released = _impl_.optional_unverified_lazy_message_;
+  _impl_.optional_unverified_lazy_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_unverified_lazy_message)
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = _impl_.optional_unverified_lazy_message_;
+  _impl_.optional_unverified_lazy_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_unverified_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.optional_unverified_lazy_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(GetArena());
+    _impl_.optional_unverified_lazy_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(p);
+  }
+  return _impl_.optional_unverified_lazy_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_unverified_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_optional_unverified_lazy_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_unverified_lazy_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_unverified_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(_impl_.optional_unverified_lazy_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+
+  _impl_.optional_unverified_lazy_message_ = reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_unverified_lazy_message)
+}
+
+// .protobuf_unittest_import.ImportMessage optional_lazy_import_message = 115 [lazy = true];
+inline bool TestAllTypes::has_optional_lazy_import_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optional_lazy_import_message_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::_internal_optional_lazy_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest_import::ImportMessage* p = _impl_.optional_lazy_import_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest_import::ImportMessage&>(::protobuf_unittest_import::_ImportMessage_default_instance_);
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::optional_lazy_import_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+  return _internal_optional_lazy_import_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_lazy_import_message(::protobuf_unittest_import::ImportMessage* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_lazy_import_message_);
+  }
+  _impl_.optional_lazy_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessage*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::release_optional_lazy_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::protobuf_unittest_import::ImportMessage* released = _impl_.optional_lazy_import_message_;
+  _impl_.optional_lazy_import_message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::unsafe_arena_release_optional_lazy_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::protobuf_unittest_import::ImportMessage* temp = _impl_.optional_lazy_import_message_;
+  _impl_.optional_lazy_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::_internal_mutable_optional_lazy_import_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.optional_lazy_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::ImportMessage>(GetArena());
+    _impl_.optional_lazy_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessage*>(p);
+  }
+  return _impl_.optional_lazy_import_message_;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_optional_lazy_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest_import::ImportMessage* _msg = _internal_mutable_optional_lazy_import_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+  return _msg;
+}
+inline void TestAllTypes::set_allocated_optional_lazy_import_message(::protobuf_unittest_import::ImportMessage* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.optional_lazy_import_message_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+
+  _impl_.optional_lazy_import_message_ = reinterpret_cast<::protobuf_unittest_import::ImportMessage*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestAllTypes::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int TestAllTypes::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestAllTypes::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t TestAllTypes::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void TestAllTypes::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_int32)
+}
+inline void TestAllTypes::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestAllTypes::_internal_repeated_int64_size() const {
+  return _internal_repeated_int64().size();
+}
+inline int TestAllTypes::repeated_int64_size() const {
+  return _internal_repeated_int64_size();
+}
+inline void TestAllTypes::clear_repeated_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int64_.Clear();
+}
+inline ::int64_t TestAllTypes::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_int64)
+  return _internal_repeated_int64().Get(index);
+}
+inline void TestAllTypes::set_repeated_int64(int index, ::int64_t value) {
+  _internal_mutable_repeated_int64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_int64)
+}
+inline void TestAllTypes::add_repeated_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_int64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::repeated_int64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_int64)
+  return _internal_repeated_int64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::mutable_repeated_int64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_int64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::_internal_repeated_int64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::_internal_mutable_repeated_int64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestAllTypes::_internal_repeated_uint32_size() const {
+  return _internal_repeated_uint32().size();
+}
+inline int TestAllTypes::repeated_uint32_size() const {
+  return _internal_repeated_uint32_size();
+}
+inline void TestAllTypes::clear_repeated_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint32_.Clear();
+}
+inline ::uint32_t TestAllTypes::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_uint32)
+  return _internal_repeated_uint32().Get(index);
+}
+inline void TestAllTypes::set_repeated_uint32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_uint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_uint32)
+}
+inline void TestAllTypes::add_repeated_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_uint32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::repeated_uint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_uint32)
+  return _internal_repeated_uint32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::mutable_repeated_uint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_uint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::_internal_repeated_uint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::_internal_mutable_repeated_uint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestAllTypes::_internal_repeated_uint64_size() const {
+  return _internal_repeated_uint64().size();
+}
+inline int TestAllTypes::repeated_uint64_size() const {
+  return _internal_repeated_uint64_size();
+}
+inline void TestAllTypes::clear_repeated_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint64_.Clear();
+}
+inline ::uint64_t TestAllTypes::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_uint64)
+  return _internal_repeated_uint64().Get(index);
+}
+inline void TestAllTypes::set_repeated_uint64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_uint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_uint64)
+}
+inline void TestAllTypes::add_repeated_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_uint64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::repeated_uint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_uint64)
+  return _internal_repeated_uint64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::mutable_repeated_uint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_uint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::_internal_repeated_uint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::_internal_mutable_repeated_uint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestAllTypes::_internal_repeated_sint32_size() const {
+  return _internal_repeated_sint32().size();
+}
+inline int TestAllTypes::repeated_sint32_size() const {
+  return _internal_repeated_sint32_size();
+}
+inline void TestAllTypes::clear_repeated_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint32_.Clear();
+}
+inline ::int32_t TestAllTypes::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sint32)
+  return _internal_repeated_sint32().Get(index);
+}
+inline void TestAllTypes::set_repeated_sint32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sint32)
+}
+inline void TestAllTypes::add_repeated_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sint32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::repeated_sint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sint32)
+  return _internal_repeated_sint32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::mutable_repeated_sint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::_internal_repeated_sint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::_internal_mutable_repeated_sint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestAllTypes::_internal_repeated_sint64_size() const {
+  return _internal_repeated_sint64().size();
+}
+inline int TestAllTypes::repeated_sint64_size() const {
+  return _internal_repeated_sint64_size();
+}
+inline void TestAllTypes::clear_repeated_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint64_.Clear();
+}
+inline ::int64_t TestAllTypes::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sint64)
+  return _internal_repeated_sint64().Get(index);
+}
+inline void TestAllTypes::set_repeated_sint64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sint64)
+}
+inline void TestAllTypes::add_repeated_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sint64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::repeated_sint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sint64)
+  return _internal_repeated_sint64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::mutable_repeated_sint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::_internal_repeated_sint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::_internal_mutable_repeated_sint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestAllTypes::_internal_repeated_fixed32_size() const {
+  return _internal_repeated_fixed32().size();
+}
+inline int TestAllTypes::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void TestAllTypes::clear_repeated_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed32_.Clear();
+}
+inline ::uint32_t TestAllTypes::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_repeated_fixed32().Get(index);
+}
+inline void TestAllTypes::set_repeated_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_fixed32)
+}
+inline void TestAllTypes::add_repeated_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::repeated_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::mutable_repeated_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestAllTypes::_internal_repeated_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestAllTypes::_internal_mutable_repeated_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestAllTypes::_internal_repeated_fixed64_size() const {
+  return _internal_repeated_fixed64().size();
+}
+inline int TestAllTypes::repeated_fixed64_size() const {
+  return _internal_repeated_fixed64_size();
+}
+inline void TestAllTypes::clear_repeated_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed64_.Clear();
+}
+inline ::uint64_t TestAllTypes::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_repeated_fixed64().Get(index);
+}
+inline void TestAllTypes::set_repeated_fixed64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_fixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_fixed64)
+}
+inline void TestAllTypes::add_repeated_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_fixed64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::repeated_fixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_repeated_fixed64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::mutable_repeated_fixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_fixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestAllTypes::_internal_repeated_fixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestAllTypes::_internal_mutable_repeated_fixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestAllTypes::_internal_repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32().size();
+}
+inline int TestAllTypes::repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32_size();
+}
+inline void TestAllTypes::clear_repeated_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed32_.Clear();
+}
+inline ::int32_t TestAllTypes::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32().Get(index);
+}
+inline void TestAllTypes::set_repeated_sfixed32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sfixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sfixed32)
+}
+inline void TestAllTypes::add_repeated_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::repeated_sfixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::mutable_repeated_sfixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sfixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestAllTypes::_internal_repeated_sfixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestAllTypes::_internal_mutable_repeated_sfixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestAllTypes::_internal_repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64().size();
+}
+inline int TestAllTypes::repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64_size();
+}
+inline void TestAllTypes::clear_repeated_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed64_.Clear();
+}
+inline ::int64_t TestAllTypes::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64().Get(index);
+}
+inline void TestAllTypes::set_repeated_sfixed64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sfixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sfixed64)
+}
+inline void TestAllTypes::add_repeated_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::repeated_sfixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::mutable_repeated_sfixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sfixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestAllTypes::_internal_repeated_sfixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestAllTypes::_internal_mutable_repeated_sfixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+inline int TestAllTypes::_internal_repeated_float_size() const {
+  return _internal_repeated_float().size();
+}
+inline int TestAllTypes::repeated_float_size() const {
+  return _internal_repeated_float_size();
+}
+inline void TestAllTypes::clear_repeated_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_float_.Clear();
+}
+inline float TestAllTypes::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_float)
+  return _internal_repeated_float().Get(index);
+}
+inline void TestAllTypes::set_repeated_float(int index, float value) {
+  _internal_mutable_repeated_float()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_float)
+}
+inline void TestAllTypes::add_repeated_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_float()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_float)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestAllTypes::repeated_float() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_float)
+  return _internal_repeated_float();
+}
+inline ::google::protobuf::RepeatedField<float>* TestAllTypes::mutable_repeated_float()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_float)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_float();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestAllTypes::_internal_repeated_float()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_float_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestAllTypes::_internal_mutable_repeated_float() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+inline int TestAllTypes::_internal_repeated_double_size() const {
+  return _internal_repeated_double().size();
+}
+inline int TestAllTypes::repeated_double_size() const {
+  return _internal_repeated_double_size();
+}
+inline void TestAllTypes::clear_repeated_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_double_.Clear();
+}
+inline double TestAllTypes::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_double)
+  return _internal_repeated_double().Get(index);
+}
+inline void TestAllTypes::set_repeated_double(int index, double value) {
+  _internal_mutable_repeated_double()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_double)
+}
+inline void TestAllTypes::add_repeated_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_double()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_double)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestAllTypes::repeated_double() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_double)
+  return _internal_repeated_double();
+}
+inline ::google::protobuf::RepeatedField<double>* TestAllTypes::mutable_repeated_double()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_double)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_double();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestAllTypes::_internal_repeated_double()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_double_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestAllTypes::_internal_mutable_repeated_double() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestAllTypes::_internal_repeated_bool_size() const {
+  return _internal_repeated_bool().size();
+}
+inline int TestAllTypes::repeated_bool_size() const {
+  return _internal_repeated_bool_size();
+}
+inline void TestAllTypes::clear_repeated_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bool_.Clear();
+}
+inline bool TestAllTypes::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_bool)
+  return _internal_repeated_bool().Get(index);
+}
+inline void TestAllTypes::set_repeated_bool(int index, bool value) {
+  _internal_mutable_repeated_bool()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_bool)
+}
+inline void TestAllTypes::add_repeated_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bool()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_bool)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestAllTypes::repeated_bool() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_bool)
+  return _internal_repeated_bool();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestAllTypes::mutable_repeated_bool()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_bool)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bool();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestAllTypes::_internal_repeated_bool()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestAllTypes::_internal_mutable_repeated_bool() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+inline int TestAllTypes::_internal_repeated_string_size() const {
+  return _internal_repeated_string().size();
+}
+inline int TestAllTypes::repeated_string_size() const {
+  return _internal_repeated_string_size();
+}
+inline void TestAllTypes::clear_repeated_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_string()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_string)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_string(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_string)
+  return _internal_repeated_string().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_string(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_string)
+  return _internal_mutable_repeated_string()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_string(int index, const std::string& value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, std::string&& value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, absl::string_view value) {
+  _internal_mutable_repeated_string()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_string)
+  return _internal_repeated_string();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_string)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_string() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestAllTypes::_internal_repeated_bytes_size() const {
+  return _internal_repeated_bytes().size();
+}
+inline int TestAllTypes::repeated_bytes_size() const {
+  return _internal_repeated_bytes_size();
+}
+inline void TestAllTypes::clear_repeated_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bytes_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_bytes()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_bytes()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_bytes(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_bytes)
+  return _internal_repeated_bytes().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_bytes(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_bytes)
+  return _internal_mutable_repeated_bytes()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const std::string& value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, std::string&& value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const void* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, absl::string_view value) {
+  _internal_mutable_repeated_bytes()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const void* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_bytes() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_bytes)
+  return _internal_repeated_bytes();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_bytes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bytes();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bytes_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_bytes() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bytes_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+inline int TestAllTypes::_internal_repeated_nested_message_size() const {
+  return _internal_repeated_nested_message().size();
+}
+inline int TestAllTypes::repeated_nested_message_size() const {
+  return _internal_repeated_nested_message_size();
+}
+inline void TestAllTypes::clear_repeated_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_message_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_repeated_nested_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_mutable_repeated_nested_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>* TestAllTypes::mutable_repeated_nested_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_nested_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_message();
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::repeated_nested_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_repeated_nested_message().Get(index);
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::add_repeated_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3_unittest::TestAllTypes_NestedMessage* _add = _internal_mutable_repeated_nested_message()->Add();
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>& TestAllTypes::repeated_nested_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_repeated_nested_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>&
+TestAllTypes::_internal_repeated_nested_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>*
+TestAllTypes::_internal_mutable_repeated_nested_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_message_;
+}
+
+// repeated .proto3_unittest.ForeignMessage repeated_foreign_message = 49;
+inline int TestAllTypes::_internal_repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message().size();
+}
+inline int TestAllTypes::repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message_size();
+}
+inline void TestAllTypes::clear_repeated_foreign_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_foreign_message_.Clear();
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::mutable_repeated_foreign_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_mutable_repeated_foreign_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3_unittest::ForeignMessage>* TestAllTypes::mutable_repeated_foreign_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_foreign_message();
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::repeated_foreign_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_repeated_foreign_message().Get(index);
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::add_repeated_foreign_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3_unittest::ForeignMessage* _add = _internal_mutable_repeated_foreign_message()->Add();
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3_unittest::ForeignMessage>& TestAllTypes::repeated_foreign_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_repeated_foreign_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3_unittest::ForeignMessage>&
+TestAllTypes::_internal_repeated_foreign_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_foreign_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3_unittest::ForeignMessage>*
+TestAllTypes::_internal_mutable_repeated_foreign_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+inline int TestAllTypes::_internal_repeated_import_message_size() const {
+  return _internal_repeated_import_message().size();
+}
+inline int TestAllTypes::repeated_import_message_size() const {
+  return _internal_repeated_import_message_size();
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_repeated_import_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_import_message)
+  return _internal_mutable_repeated_import_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessage>* TestAllTypes::mutable_repeated_import_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_import_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_import_message();
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::repeated_import_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_import_message)
+  return _internal_repeated_import_message().Get(index);
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::add_repeated_import_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::protobuf_unittest_import::ImportMessage* _add = _internal_mutable_repeated_import_message()->Add();
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_import_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessage>& TestAllTypes::repeated_import_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_import_message)
+  return _internal_repeated_import_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessage>&
+TestAllTypes::_internal_repeated_import_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_import_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::protobuf_unittest_import::ImportMessage>*
+TestAllTypes::_internal_mutable_repeated_import_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_import_message_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+inline int TestAllTypes::_internal_repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum().size();
+}
+inline int TestAllTypes::repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum_size();
+}
+inline void TestAllTypes::clear_repeated_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_enum_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  return static_cast<::proto3_unittest::TestAllTypes_NestedEnum>(_internal_repeated_nested_enum().Get(index));
+}
+inline void TestAllTypes::set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value) {
+  _internal_mutable_repeated_nested_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_nested_enum)
+}
+inline void TestAllTypes::add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_nested_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_nested_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::repeated_nested_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  return _internal_repeated_nested_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::mutable_repeated_nested_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::_internal_repeated_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::_internal_mutable_repeated_nested_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_enum_;
+}
+
+// repeated .proto3_unittest.ForeignEnum repeated_foreign_enum = 52;
+inline int TestAllTypes::_internal_repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum().size();
+}
+inline int TestAllTypes::repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum_size();
+}
+inline void TestAllTypes::clear_repeated_foreign_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_foreign_enum_.Clear();
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::repeated_foreign_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  return static_cast<::proto3_unittest::ForeignEnum>(_internal_repeated_foreign_enum().Get(index));
+}
+inline void TestAllTypes::set_repeated_foreign_enum(int index, ::proto3_unittest::ForeignEnum value) {
+  _internal_mutable_repeated_foreign_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+}
+inline void TestAllTypes::add_repeated_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_foreign_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::repeated_foreign_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  return _internal_repeated_foreign_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::mutable_repeated_foreign_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_foreign_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestAllTypes::_internal_repeated_foreign_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_foreign_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestAllTypes::_internal_mutable_repeated_foreign_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_foreign_enum_;
+}
+
+// repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+inline int TestAllTypes::_internal_repeated_string_piece_size() const {
+  return _internal_repeated_string_piece().size();
+}
+inline int TestAllTypes::repeated_string_piece_size() const {
+  return _internal_repeated_string_piece_size();
+}
+inline void TestAllTypes::clear_repeated_string_piece() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_piece_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_string_piece()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string_piece()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_string_piece(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_repeated_string_piece().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_string_piece(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_mutable_repeated_string_piece()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const std::string& value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, std::string&& value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, absl::string_view value) {
+  _internal_mutable_repeated_string_piece()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_piece()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_string_piece() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_repeated_string_piece();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_string_piece() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_string_piece)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string_piece();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_string_piece() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_piece_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_string_piece() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_piece_;
+}
+
+// repeated string repeated_cord = 55 [ctype = CORD];
+inline int TestAllTypes::_internal_repeated_cord_size() const {
+  return _internal_repeated_cord().size();
+}
+inline int TestAllTypes::repeated_cord_size() const {
+  return _internal_repeated_cord_size();
+}
+inline void TestAllTypes::clear_repeated_cord() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_cord_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_cord()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_cord()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_cord)
+  return _s;
+}
+inline const std::string& TestAllTypes::repeated_cord(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_cord)
+  return _internal_repeated_cord().Get(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_cord(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_cord)
+  return _internal_mutable_repeated_cord()->Mutable(index);
+}
+inline void TestAllTypes::set_repeated_cord(int index, const std::string& value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, std::string&& value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, absl::string_view value) {
+  _internal_mutable_repeated_cord()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_cord()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_cord() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_cord)
+  return _internal_repeated_cord();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_cord() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_cord)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_cord();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestAllTypes::_internal_repeated_cord() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_cord_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestAllTypes::_internal_mutable_repeated_cord() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_cord_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+inline int TestAllTypes::_internal_repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message().size();
+}
+inline int TestAllTypes::repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message_size();
+}
+inline void TestAllTypes::clear_repeated_lazy_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_lazy_message_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_repeated_lazy_message(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_mutable_repeated_lazy_message()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>* TestAllTypes::mutable_repeated_lazy_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_lazy_message();
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::repeated_lazy_message(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_repeated_lazy_message().Get(index);
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::add_repeated_lazy_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3_unittest::TestAllTypes_NestedMessage* _add = _internal_mutable_repeated_lazy_message()->Add();
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>& TestAllTypes::repeated_lazy_message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_repeated_lazy_message();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>&
+TestAllTypes::_internal_repeated_lazy_message() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_lazy_message_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3_unittest::TestAllTypes_NestedMessage>*
+TestAllTypes::_internal_mutable_repeated_lazy_message() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_lazy_message_;
+}
+
+// uint32 oneof_uint32 = 111;
+inline bool TestAllTypes::has_oneof_uint32() const {
+  return oneof_field_case() == kOneofUint32;
+}
+inline void TestAllTypes::set_has_oneof_uint32() {
+  _impl_._oneof_case_[0] = kOneofUint32;
+}
+inline void TestAllTypes::clear_oneof_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofUint32) {
+    _impl_.oneof_field_.oneof_uint32_ = 0u;
+    clear_has_oneof_field();
+  }
+}
+inline ::uint32_t TestAllTypes::oneof_uint32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_uint32)
+  return _internal_oneof_uint32();
+}
+inline void TestAllTypes::set_oneof_uint32(::uint32_t value) {
+  _internal_set_oneof_uint32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_uint32)
+}
+inline ::uint32_t TestAllTypes::_internal_oneof_uint32() const {
+  if (oneof_field_case() == kOneofUint32) {
+    return _impl_.oneof_field_.oneof_uint32_;
+  }
+  return 0u;
+}
+inline void TestAllTypes::_internal_set_oneof_uint32(::uint32_t value) {
+  if (oneof_field_case() != kOneofUint32) {
+    clear_oneof_field();
+    set_has_oneof_uint32();
+  }
+  _impl_.oneof_field_.oneof_uint32_ = value;
+}
+
+// .proto3_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+inline bool TestAllTypes::has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline bool TestAllTypes::_internal_has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline void TestAllTypes::set_has_oneof_nested_message() {
+  _impl_._oneof_case_[0] = kOneofNestedMessage;
+}
+inline void TestAllTypes::clear_oneof_nested_message() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofNestedMessage) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.oneof_nested_message_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.oneof_nested_message)
+  if (oneof_field_case() == kOneofNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage ? *_impl_.oneof_field_.oneof_nested_message_ : reinterpret_cast<::proto3_unittest::TestAllTypes_NestedMessage&>(::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::oneof_nested_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_nested_message)
+  return _internal_oneof_nested_message();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto3_unittest.TestAllTypes.oneof_nested_message)
+  if (oneof_field_case() == kOneofNestedMessage) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.oneof_nested_message_;
+    _impl_.oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_oneof_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_oneof_nested_message();
+    _impl_.oneof_field_.oneof_nested_message_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.oneof_nested_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_oneof_nested_message() {
+  if (oneof_field_case() != kOneofNestedMessage) {
+    clear_oneof_field();
+    set_has_oneof_nested_message();
+    _impl_.oneof_field_.oneof_nested_message_ = CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(GetArena());
+  }
+  return _impl_.oneof_field_.oneof_nested_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_oneof_nested_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::TestAllTypes_NestedMessage* _msg = _internal_mutable_oneof_nested_message();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.oneof_nested_message)
+  return _msg;
+}
+
+// string oneof_string = 113;
+inline bool TestAllTypes::has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline void TestAllTypes::set_has_oneof_string() {
+  _impl_._oneof_case_[0] = kOneofString;
+}
+inline void TestAllTypes::clear_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofString) {
+    _impl_.oneof_field_.oneof_string_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypes::oneof_string() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_string)
+  return _internal_oneof_string();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_oneof_string(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_string)
+}
+inline std::string* TestAllTypes::mutable_oneof_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.oneof_string)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_oneof_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_string_.Get();
+}
+inline void TestAllTypes::_internal_set_oneof_string(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_string_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofString) {
+    clear_oneof_field();
+
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_string_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_oneof_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.oneof_string)
+  if (oneof_field_case() != kOneofString) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_string_.Release();
+}
+inline void TestAllTypes::set_allocated_oneof_string(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string();
+    _impl_.oneof_field_.oneof_string_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.oneof_string)
+}
+
+// bytes oneof_bytes = 114;
+inline bool TestAllTypes::has_oneof_bytes() const {
+  return oneof_field_case() == kOneofBytes;
+}
+inline void TestAllTypes::set_has_oneof_bytes() {
+  _impl_._oneof_case_[0] = kOneofBytes;
+}
+inline void TestAllTypes::clear_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kOneofBytes) {
+    _impl_.oneof_field_.oneof_bytes_.Destroy();
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypes::oneof_bytes() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_bytes)
+  return _internal_oneof_bytes();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestAllTypes::set_oneof_bytes(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+inline std::string* TestAllTypes::mutable_oneof_bytes() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_bytes();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.oneof_bytes)
+  return _s;
+}
+inline const std::string& TestAllTypes::_internal_oneof_bytes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Get();
+}
+inline void TestAllTypes::_internal_set_oneof_bytes(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  _impl_.oneof_field_.oneof_bytes_.Set(value, GetArena());
+}
+inline std::string* TestAllTypes::_internal_mutable_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() != kOneofBytes) {
+    clear_oneof_field();
+
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitDefault();
+  }
+  return _impl_.oneof_field_.oneof_bytes_.Mutable( GetArena());
+}
+inline std::string* TestAllTypes::release_oneof_bytes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.oneof_bytes)
+  if (oneof_field_case() != kOneofBytes) {
+    return nullptr;
+  }
+  clear_has_oneof_field();
+  return _impl_.oneof_field_.oneof_bytes_.Release();
+}
+inline void TestAllTypes::set_allocated_oneof_bytes(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (value != nullptr) {
+    set_has_oneof_bytes();
+    _impl_.oneof_field_.oneof_bytes_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+
+inline bool TestAllTypes::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestAllTypes::clear_has_oneof_field() {
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestAllTypes::OneofFieldCase TestAllTypes::oneof_field_case() const {
+  return TestAllTypes::OneofFieldCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TestPackedTypes
+
+// repeated int32 packed_int32 = 90 [packed = true];
+inline int TestPackedTypes::_internal_packed_int32_size() const {
+  return _internal_packed_int32().size();
+}
+inline int TestPackedTypes::packed_int32_size() const {
+  return _internal_packed_int32_size();
+}
+inline void TestPackedTypes::clear_packed_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_int32_.Clear();
+}
+inline ::int32_t TestPackedTypes::packed_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_int32)
+  return _internal_packed_int32().Get(index);
+}
+inline void TestPackedTypes::set_packed_int32(int index, ::int32_t value) {
+  _internal_mutable_packed_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_int32)
+}
+inline void TestPackedTypes::add_packed_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypes::packed_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_int32)
+  return _internal_packed_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypes::mutable_packed_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypes::_internal_packed_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypes::_internal_mutable_packed_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_int32_;
+}
+
+// repeated int64 packed_int64 = 91 [packed = true];
+inline int TestPackedTypes::_internal_packed_int64_size() const {
+  return _internal_packed_int64().size();
+}
+inline int TestPackedTypes::packed_int64_size() const {
+  return _internal_packed_int64_size();
+}
+inline void TestPackedTypes::clear_packed_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_int64_.Clear();
+}
+inline ::int64_t TestPackedTypes::packed_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_int64)
+  return _internal_packed_int64().Get(index);
+}
+inline void TestPackedTypes::set_packed_int64(int index, ::int64_t value) {
+  _internal_mutable_packed_int64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_int64)
+}
+inline void TestPackedTypes::add_packed_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_int64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_int64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypes::packed_int64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_int64)
+  return _internal_packed_int64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypes::mutable_packed_int64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_int64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_int64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypes::_internal_packed_int64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_int64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypes::_internal_mutable_packed_int64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_int64_;
+}
+
+// repeated uint32 packed_uint32 = 92 [packed = true];
+inline int TestPackedTypes::_internal_packed_uint32_size() const {
+  return _internal_packed_uint32().size();
+}
+inline int TestPackedTypes::packed_uint32_size() const {
+  return _internal_packed_uint32_size();
+}
+inline void TestPackedTypes::clear_packed_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_uint32_.Clear();
+}
+inline ::uint32_t TestPackedTypes::packed_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_uint32)
+  return _internal_packed_uint32().Get(index);
+}
+inline void TestPackedTypes::set_packed_uint32(int index, ::uint32_t value) {
+  _internal_mutable_packed_uint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_uint32)
+}
+inline void TestPackedTypes::add_packed_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_uint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_uint32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypes::packed_uint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_uint32)
+  return _internal_packed_uint32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypes::mutable_packed_uint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_uint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_uint32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypes::_internal_packed_uint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_uint32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypes::_internal_mutable_packed_uint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_uint32_;
+}
+
+// repeated uint64 packed_uint64 = 93 [packed = true];
+inline int TestPackedTypes::_internal_packed_uint64_size() const {
+  return _internal_packed_uint64().size();
+}
+inline int TestPackedTypes::packed_uint64_size() const {
+  return _internal_packed_uint64_size();
+}
+inline void TestPackedTypes::clear_packed_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_uint64_.Clear();
+}
+inline ::uint64_t TestPackedTypes::packed_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_uint64)
+  return _internal_packed_uint64().Get(index);
+}
+inline void TestPackedTypes::set_packed_uint64(int index, ::uint64_t value) {
+  _internal_mutable_packed_uint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_uint64)
+}
+inline void TestPackedTypes::add_packed_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_uint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_uint64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypes::packed_uint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_uint64)
+  return _internal_packed_uint64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypes::mutable_packed_uint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_uint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_uint64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypes::_internal_packed_uint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_uint64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypes::_internal_mutable_packed_uint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_uint64_;
+}
+
+// repeated sint32 packed_sint32 = 94 [packed = true];
+inline int TestPackedTypes::_internal_packed_sint32_size() const {
+  return _internal_packed_sint32().size();
+}
+inline int TestPackedTypes::packed_sint32_size() const {
+  return _internal_packed_sint32_size();
+}
+inline void TestPackedTypes::clear_packed_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sint32_.Clear();
+}
+inline ::int32_t TestPackedTypes::packed_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sint32)
+  return _internal_packed_sint32().Get(index);
+}
+inline void TestPackedTypes::set_packed_sint32(int index, ::int32_t value) {
+  _internal_mutable_packed_sint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sint32)
+}
+inline void TestPackedTypes::add_packed_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sint32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypes::packed_sint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sint32)
+  return _internal_packed_sint32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypes::mutable_packed_sint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sint32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypes::_internal_packed_sint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sint32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypes::_internal_mutable_packed_sint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sint32_;
+}
+
+// repeated sint64 packed_sint64 = 95 [packed = true];
+inline int TestPackedTypes::_internal_packed_sint64_size() const {
+  return _internal_packed_sint64().size();
+}
+inline int TestPackedTypes::packed_sint64_size() const {
+  return _internal_packed_sint64_size();
+}
+inline void TestPackedTypes::clear_packed_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sint64_.Clear();
+}
+inline ::int64_t TestPackedTypes::packed_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sint64)
+  return _internal_packed_sint64().Get(index);
+}
+inline void TestPackedTypes::set_packed_sint64(int index, ::int64_t value) {
+  _internal_mutable_packed_sint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sint64)
+}
+inline void TestPackedTypes::add_packed_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sint64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypes::packed_sint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sint64)
+  return _internal_packed_sint64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypes::mutable_packed_sint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sint64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypes::_internal_packed_sint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sint64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypes::_internal_mutable_packed_sint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sint64_;
+}
+
+// repeated fixed32 packed_fixed32 = 96 [packed = true];
+inline int TestPackedTypes::_internal_packed_fixed32_size() const {
+  return _internal_packed_fixed32().size();
+}
+inline int TestPackedTypes::packed_fixed32_size() const {
+  return _internal_packed_fixed32_size();
+}
+inline void TestPackedTypes::clear_packed_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_fixed32_.Clear();
+}
+inline ::uint32_t TestPackedTypes::packed_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_fixed32)
+  return _internal_packed_fixed32().Get(index);
+}
+inline void TestPackedTypes::set_packed_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_packed_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_fixed32)
+}
+inline void TestPackedTypes::add_packed_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypes::packed_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_fixed32)
+  return _internal_packed_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypes::mutable_packed_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestPackedTypes::_internal_packed_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestPackedTypes::_internal_mutable_packed_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_fixed32_;
+}
+
+// repeated fixed64 packed_fixed64 = 97 [packed = true];
+inline int TestPackedTypes::_internal_packed_fixed64_size() const {
+  return _internal_packed_fixed64().size();
+}
+inline int TestPackedTypes::packed_fixed64_size() const {
+  return _internal_packed_fixed64_size();
+}
+inline void TestPackedTypes::clear_packed_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_fixed64_.Clear();
+}
+inline ::uint64_t TestPackedTypes::packed_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_fixed64)
+  return _internal_packed_fixed64().Get(index);
+}
+inline void TestPackedTypes::set_packed_fixed64(int index, ::uint64_t value) {
+  _internal_mutable_packed_fixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_fixed64)
+}
+inline void TestPackedTypes::add_packed_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_fixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_fixed64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypes::packed_fixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_fixed64)
+  return _internal_packed_fixed64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypes::mutable_packed_fixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_fixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_fixed64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestPackedTypes::_internal_packed_fixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_fixed64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestPackedTypes::_internal_mutable_packed_fixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_fixed64_;
+}
+
+// repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+inline int TestPackedTypes::_internal_packed_sfixed32_size() const {
+  return _internal_packed_sfixed32().size();
+}
+inline int TestPackedTypes::packed_sfixed32_size() const {
+  return _internal_packed_sfixed32_size();
+}
+inline void TestPackedTypes::clear_packed_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sfixed32_.Clear();
+}
+inline ::int32_t TestPackedTypes::packed_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sfixed32)
+  return _internal_packed_sfixed32().Get(index);
+}
+inline void TestPackedTypes::set_packed_sfixed32(int index, ::int32_t value) {
+  _internal_mutable_packed_sfixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sfixed32)
+}
+inline void TestPackedTypes::add_packed_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sfixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypes::packed_sfixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sfixed32)
+  return _internal_packed_sfixed32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypes::mutable_packed_sfixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sfixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sfixed32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestPackedTypes::_internal_packed_sfixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestPackedTypes::_internal_mutable_packed_sfixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sfixed32_;
+}
+
+// repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+inline int TestPackedTypes::_internal_packed_sfixed64_size() const {
+  return _internal_packed_sfixed64().size();
+}
+inline int TestPackedTypes::packed_sfixed64_size() const {
+  return _internal_packed_sfixed64_size();
+}
+inline void TestPackedTypes::clear_packed_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_sfixed64_.Clear();
+}
+inline ::int64_t TestPackedTypes::packed_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sfixed64)
+  return _internal_packed_sfixed64().Get(index);
+}
+inline void TestPackedTypes::set_packed_sfixed64(int index, ::int64_t value) {
+  _internal_mutable_packed_sfixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sfixed64)
+}
+inline void TestPackedTypes::add_packed_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_sfixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypes::packed_sfixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sfixed64)
+  return _internal_packed_sfixed64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypes::mutable_packed_sfixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sfixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_sfixed64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestPackedTypes::_internal_packed_sfixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestPackedTypes::_internal_mutable_packed_sfixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_sfixed64_;
+}
+
+// repeated float packed_float = 100 [packed = true];
+inline int TestPackedTypes::_internal_packed_float_size() const {
+  return _internal_packed_float().size();
+}
+inline int TestPackedTypes::packed_float_size() const {
+  return _internal_packed_float_size();
+}
+inline void TestPackedTypes::clear_packed_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_float_.Clear();
+}
+inline float TestPackedTypes::packed_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_float)
+  return _internal_packed_float().Get(index);
+}
+inline void TestPackedTypes::set_packed_float(int index, float value) {
+  _internal_mutable_packed_float()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_float)
+}
+inline void TestPackedTypes::add_packed_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_float()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_float)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestPackedTypes::packed_float() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_float)
+  return _internal_packed_float();
+}
+inline ::google::protobuf::RepeatedField<float>* TestPackedTypes::mutable_packed_float()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_float)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_float();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestPackedTypes::_internal_packed_float()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_float_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestPackedTypes::_internal_mutable_packed_float() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_float_;
+}
+
+// repeated double packed_double = 101 [packed = true];
+inline int TestPackedTypes::_internal_packed_double_size() const {
+  return _internal_packed_double().size();
+}
+inline int TestPackedTypes::packed_double_size() const {
+  return _internal_packed_double_size();
+}
+inline void TestPackedTypes::clear_packed_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_double_.Clear();
+}
+inline double TestPackedTypes::packed_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_double)
+  return _internal_packed_double().Get(index);
+}
+inline void TestPackedTypes::set_packed_double(int index, double value) {
+  _internal_mutable_packed_double()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_double)
+}
+inline void TestPackedTypes::add_packed_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_double()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_double)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestPackedTypes::packed_double() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_double)
+  return _internal_packed_double();
+}
+inline ::google::protobuf::RepeatedField<double>* TestPackedTypes::mutable_packed_double()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_double)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_double();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestPackedTypes::_internal_packed_double()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_double_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestPackedTypes::_internal_mutable_packed_double() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_double_;
+}
+
+// repeated bool packed_bool = 102 [packed = true];
+inline int TestPackedTypes::_internal_packed_bool_size() const {
+  return _internal_packed_bool().size();
+}
+inline int TestPackedTypes::packed_bool_size() const {
+  return _internal_packed_bool_size();
+}
+inline void TestPackedTypes::clear_packed_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_bool_.Clear();
+}
+inline bool TestPackedTypes::packed_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_bool)
+  return _internal_packed_bool().Get(index);
+}
+inline void TestPackedTypes::set_packed_bool(int index, bool value) {
+  _internal_mutable_packed_bool()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_bool)
+}
+inline void TestPackedTypes::add_packed_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_bool()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_bool)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestPackedTypes::packed_bool() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_bool)
+  return _internal_packed_bool();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestPackedTypes::mutable_packed_bool()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_bool)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_bool();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestPackedTypes::_internal_packed_bool()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_bool_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestPackedTypes::_internal_mutable_packed_bool() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_bool_;
+}
+
+// repeated .proto3_unittest.ForeignEnum packed_enum = 103 [packed = true];
+inline int TestPackedTypes::_internal_packed_enum_size() const {
+  return _internal_packed_enum().size();
+}
+inline int TestPackedTypes::packed_enum_size() const {
+  return _internal_packed_enum_size();
+}
+inline void TestPackedTypes::clear_packed_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.packed_enum_.Clear();
+}
+inline ::proto3_unittest::ForeignEnum TestPackedTypes::packed_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_enum)
+  return static_cast<::proto3_unittest::ForeignEnum>(_internal_packed_enum().Get(index));
+}
+inline void TestPackedTypes::set_packed_enum(int index, ::proto3_unittest::ForeignEnum value) {
+  _internal_mutable_packed_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_enum)
+}
+inline void TestPackedTypes::add_packed_enum(::proto3_unittest::ForeignEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_packed_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestPackedTypes::packed_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_enum)
+  return _internal_packed_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestPackedTypes::mutable_packed_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_packed_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestPackedTypes::_internal_packed_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.packed_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestPackedTypes::_internal_mutable_packed_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.packed_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// TestUnpackedTypes
+
+// repeated int32 repeated_int32 = 1 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_int32_size() const {
+  return _internal_repeated_int32().size();
+}
+inline int TestUnpackedTypes::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_int32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_.Clear();
+}
+inline ::int32_t TestUnpackedTypes::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_int32)
+  return _internal_repeated_int32().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_int32(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_int32)
+}
+inline void TestUnpackedTypes::add_repeated_int32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestUnpackedTypes::repeated_int32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestUnpackedTypes::mutable_repeated_int32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_int32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestUnpackedTypes::_internal_repeated_int32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestUnpackedTypes::_internal_mutable_repeated_int32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 2 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_int64_size() const {
+  return _internal_repeated_int64().size();
+}
+inline int TestUnpackedTypes::repeated_int64_size() const {
+  return _internal_repeated_int64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_int64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int64_.Clear();
+}
+inline ::int64_t TestUnpackedTypes::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_int64)
+  return _internal_repeated_int64().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_int64(int index, ::int64_t value) {
+  _internal_mutable_repeated_int64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_int64)
+}
+inline void TestUnpackedTypes::add_repeated_int64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_int64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestUnpackedTypes::repeated_int64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_int64)
+  return _internal_repeated_int64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestUnpackedTypes::mutable_repeated_int64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_int64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestUnpackedTypes::_internal_repeated_int64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestUnpackedTypes::_internal_mutable_repeated_int64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 3 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_uint32_size() const {
+  return _internal_repeated_uint32().size();
+}
+inline int TestUnpackedTypes::repeated_uint32_size() const {
+  return _internal_repeated_uint32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_uint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint32_.Clear();
+}
+inline ::uint32_t TestUnpackedTypes::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+  return _internal_repeated_uint32().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_uint32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_uint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+}
+inline void TestUnpackedTypes::add_repeated_uint32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestUnpackedTypes::repeated_uint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+  return _internal_repeated_uint32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestUnpackedTypes::mutable_repeated_uint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestUnpackedTypes::_internal_repeated_uint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestUnpackedTypes::_internal_mutable_repeated_uint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 4 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_uint64_size() const {
+  return _internal_repeated_uint64().size();
+}
+inline int TestUnpackedTypes::repeated_uint64_size() const {
+  return _internal_repeated_uint64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_uint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint64_.Clear();
+}
+inline ::uint64_t TestUnpackedTypes::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+  return _internal_repeated_uint64().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_uint64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_uint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+}
+inline void TestUnpackedTypes::add_repeated_uint64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestUnpackedTypes::repeated_uint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+  return _internal_repeated_uint64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestUnpackedTypes::mutable_repeated_uint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestUnpackedTypes::_internal_repeated_uint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestUnpackedTypes::_internal_mutable_repeated_uint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 5 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sint32_size() const {
+  return _internal_repeated_sint32().size();
+}
+inline int TestUnpackedTypes::repeated_sint32_size() const {
+  return _internal_repeated_sint32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sint32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint32_.Clear();
+}
+inline ::int32_t TestUnpackedTypes::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+  return _internal_repeated_sint32().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_sint32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sint32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+}
+inline void TestUnpackedTypes::add_repeated_sint32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestUnpackedTypes::repeated_sint32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+  return _internal_repeated_sint32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestUnpackedTypes::mutable_repeated_sint32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestUnpackedTypes::_internal_repeated_sint32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestUnpackedTypes::_internal_mutable_repeated_sint32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 6 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sint64_size() const {
+  return _internal_repeated_sint64().size();
+}
+inline int TestUnpackedTypes::repeated_sint64_size() const {
+  return _internal_repeated_sint64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sint64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sint64_.Clear();
+}
+inline ::int64_t TestUnpackedTypes::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+  return _internal_repeated_sint64().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_sint64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sint64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+}
+inline void TestUnpackedTypes::add_repeated_sint64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sint64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestUnpackedTypes::repeated_sint64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+  return _internal_repeated_sint64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestUnpackedTypes::mutable_repeated_sint64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sint64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestUnpackedTypes::_internal_repeated_sint64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestUnpackedTypes::_internal_mutable_repeated_sint64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 7 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_fixed32_size() const {
+  return _internal_repeated_fixed32().size();
+}
+inline int TestUnpackedTypes::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_fixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed32_.Clear();
+}
+inline ::uint32_t TestUnpackedTypes::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+  return _internal_repeated_fixed32().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_fixed32(int index, ::uint32_t value) {
+  _internal_mutable_repeated_fixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+}
+inline void TestUnpackedTypes::add_repeated_fixed32(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestUnpackedTypes::repeated_fixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestUnpackedTypes::mutable_repeated_fixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed32();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestUnpackedTypes::_internal_repeated_fixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestUnpackedTypes::_internal_mutable_repeated_fixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 8 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_fixed64_size() const {
+  return _internal_repeated_fixed64().size();
+}
+inline int TestUnpackedTypes::repeated_fixed64_size() const {
+  return _internal_repeated_fixed64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_fixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_fixed64_.Clear();
+}
+inline ::uint64_t TestUnpackedTypes::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+  return _internal_repeated_fixed64().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_fixed64(int index, ::uint64_t value) {
+  _internal_mutable_repeated_fixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+}
+inline void TestUnpackedTypes::add_repeated_fixed64(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_fixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestUnpackedTypes::repeated_fixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+  return _internal_repeated_fixed64();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestUnpackedTypes::mutable_repeated_fixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_fixed64();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestUnpackedTypes::_internal_repeated_fixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestUnpackedTypes::_internal_mutable_repeated_fixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 9 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32().size();
+}
+inline int TestUnpackedTypes::repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sfixed32() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed32_.Clear();
+}
+inline ::int32_t TestUnpackedTypes::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_sfixed32(int index, ::int32_t value) {
+  _internal_mutable_repeated_sfixed32()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+}
+inline void TestUnpackedTypes::add_repeated_sfixed32(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed32()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestUnpackedTypes::repeated_sfixed32() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestUnpackedTypes::mutable_repeated_sfixed32()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed32();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestUnpackedTypes::_internal_repeated_sfixed32()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestUnpackedTypes::_internal_mutable_repeated_sfixed32() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 10 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64().size();
+}
+inline int TestUnpackedTypes::repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sfixed64() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_sfixed64_.Clear();
+}
+inline ::int64_t TestUnpackedTypes::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_sfixed64(int index, ::int64_t value) {
+  _internal_mutable_repeated_sfixed64()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+}
+inline void TestUnpackedTypes::add_repeated_sfixed64(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_sfixed64()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestUnpackedTypes::repeated_sfixed64() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestUnpackedTypes::mutable_repeated_sfixed64()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_sfixed64();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestUnpackedTypes::_internal_repeated_sfixed64()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestUnpackedTypes::_internal_mutable_repeated_sfixed64() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 11 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_float_size() const {
+  return _internal_repeated_float().size();
+}
+inline int TestUnpackedTypes::repeated_float_size() const {
+  return _internal_repeated_float_size();
+}
+inline void TestUnpackedTypes::clear_repeated_float() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_float_.Clear();
+}
+inline float TestUnpackedTypes::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_float)
+  return _internal_repeated_float().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_float(int index, float value) {
+  _internal_mutable_repeated_float()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_float)
+}
+inline void TestUnpackedTypes::add_repeated_float(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_float()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_float)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestUnpackedTypes::repeated_float() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_float)
+  return _internal_repeated_float();
+}
+inline ::google::protobuf::RepeatedField<float>* TestUnpackedTypes::mutable_repeated_float()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_float)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_float();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestUnpackedTypes::_internal_repeated_float()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_float_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestUnpackedTypes::_internal_mutable_repeated_float() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_float_;
+}
+
+// repeated double repeated_double = 12 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_double_size() const {
+  return _internal_repeated_double().size();
+}
+inline int TestUnpackedTypes::repeated_double_size() const {
+  return _internal_repeated_double_size();
+}
+inline void TestUnpackedTypes::clear_repeated_double() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_double_.Clear();
+}
+inline double TestUnpackedTypes::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_double)
+  return _internal_repeated_double().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_double(int index, double value) {
+  _internal_mutable_repeated_double()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_double)
+}
+inline void TestUnpackedTypes::add_repeated_double(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_double()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_double)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestUnpackedTypes::repeated_double() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_double)
+  return _internal_repeated_double();
+}
+inline ::google::protobuf::RepeatedField<double>* TestUnpackedTypes::mutable_repeated_double()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_double)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_double();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestUnpackedTypes::_internal_repeated_double()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_double_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestUnpackedTypes::_internal_mutable_repeated_double() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_double_;
+}
+
+// repeated bool repeated_bool = 13 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_bool_size() const {
+  return _internal_repeated_bool().size();
+}
+inline int TestUnpackedTypes::repeated_bool_size() const {
+  return _internal_repeated_bool_size();
+}
+inline void TestUnpackedTypes::clear_repeated_bool() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bool_.Clear();
+}
+inline bool TestUnpackedTypes::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_bool)
+  return _internal_repeated_bool().Get(index);
+}
+inline void TestUnpackedTypes::set_repeated_bool(int index, bool value) {
+  _internal_mutable_repeated_bool()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_bool)
+}
+inline void TestUnpackedTypes::add_repeated_bool(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bool()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_bool)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestUnpackedTypes::repeated_bool() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_bool)
+  return _internal_repeated_bool();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestUnpackedTypes::mutable_repeated_bool()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_bool)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bool();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestUnpackedTypes::_internal_repeated_bool()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestUnpackedTypes::_internal_mutable_repeated_bool() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bool_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 14 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum().size();
+}
+inline int TestUnpackedTypes::repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum_size();
+}
+inline void TestUnpackedTypes::clear_repeated_nested_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_nested_enum_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestUnpackedTypes::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  return static_cast<::proto3_unittest::TestAllTypes_NestedEnum>(_internal_repeated_nested_enum().Get(index));
+}
+inline void TestUnpackedTypes::set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value) {
+  _internal_mutable_repeated_nested_enum()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+}
+inline void TestUnpackedTypes::add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_nested_enum()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestUnpackedTypes::repeated_nested_enum() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  return _internal_repeated_nested_enum();
+}
+inline ::google::protobuf::RepeatedField<int>* TestUnpackedTypes::mutable_repeated_nested_enum()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_nested_enum();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestUnpackedTypes::_internal_repeated_nested_enum() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestUnpackedTypes::_internal_mutable_repeated_nested_enum() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_nested_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// NestedTestAllTypes
+
+// .proto3_unittest.NestedTestAllTypes child = 1;
+inline bool NestedTestAllTypes::has_child() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.child_ != nullptr);
+  return value;
+}
+inline void NestedTestAllTypes::clear_child() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.child_ != nullptr) _impl_.child_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto3_unittest::NestedTestAllTypes& NestedTestAllTypes::_internal_child() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3_unittest::NestedTestAllTypes* p = _impl_.child_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3_unittest::NestedTestAllTypes&>(::proto3_unittest::_NestedTestAllTypes_default_instance_);
+}
+inline const ::proto3_unittest::NestedTestAllTypes& NestedTestAllTypes::child() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.NestedTestAllTypes.child)
+  return _internal_child();
+}
+inline void NestedTestAllTypes::unsafe_arena_set_allocated_child(::proto3_unittest::NestedTestAllTypes* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.child_);
+  }
+  _impl_.child_ = reinterpret_cast<::proto3_unittest::NestedTestAllTypes*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.NestedTestAllTypes.child)
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::release_child() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3_unittest::NestedTestAllTypes* released = _impl_.child_;
+  _impl_.child_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::unsafe_arena_release_child() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.NestedTestAllTypes.child)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3_unittest::NestedTestAllTypes* temp = _impl_.child_;
+  _impl_.child_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::_internal_mutable_child() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.child_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::NestedTestAllTypes>(GetArena());
+    _impl_.child_ = reinterpret_cast<::proto3_unittest::NestedTestAllTypes*>(p);
+  }
+  return _impl_.child_;
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::mutable_child() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::NestedTestAllTypes* _msg = _internal_mutable_child();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.NestedTestAllTypes.child)
+  return _msg;
+}
+inline void NestedTestAllTypes::set_allocated_child(::proto3_unittest::NestedTestAllTypes* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3_unittest::NestedTestAllTypes*>(_impl_.child_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3_unittest::NestedTestAllTypes*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.child_ = reinterpret_cast<::proto3_unittest::NestedTestAllTypes*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.NestedTestAllTypes.child)
+}
+
+// .proto3_unittest.TestAllTypes payload = 2;
+inline bool NestedTestAllTypes::has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.payload_ != nullptr);
+  return value;
+}
+inline void NestedTestAllTypes::clear_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.payload_ != nullptr) _impl_.payload_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto3_unittest::TestAllTypes& NestedTestAllTypes::_internal_payload() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3_unittest::TestAllTypes* p = _impl_.payload_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3_unittest::TestAllTypes&>(::proto3_unittest::_TestAllTypes_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes& NestedTestAllTypes::payload() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3_unittest.NestedTestAllTypes.payload)
+  return _internal_payload();
+}
+inline void NestedTestAllTypes::unsafe_arena_set_allocated_payload(::proto3_unittest::TestAllTypes* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.payload_);
+  }
+  _impl_.payload_ = reinterpret_cast<::proto3_unittest::TestAllTypes*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.NestedTestAllTypes.payload)
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::release_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto3_unittest::TestAllTypes* released = _impl_.payload_;
+  _impl_.payload_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::unsafe_arena_release_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3_unittest.NestedTestAllTypes.payload)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto3_unittest::TestAllTypes* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::_internal_mutable_payload() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.payload_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes>(GetArena());
+    _impl_.payload_ = reinterpret_cast<::proto3_unittest::TestAllTypes*>(p);
+  }
+  return _impl_.payload_;
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::mutable_payload() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3_unittest::TestAllTypes* _msg = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.NestedTestAllTypes.payload)
+  return _msg;
+}
+inline void NestedTestAllTypes::set_allocated_payload(::proto3_unittest::TestAllTypes* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3_unittest::TestAllTypes*>(_impl_.payload_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3_unittest::TestAllTypes*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.payload_ = reinterpret_cast<::proto3_unittest::TestAllTypes*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.NestedTestAllTypes.payload)
+}
+
+// -------------------------------------------------------------------
+
+// ForeignMessage
+
+// int32 c = 1;
+inline void ForeignMessage::clear_c() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.c_ = 0;
+}
+inline ::int32_t ForeignMessage::c() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.ForeignMessage.c)
+  return _internal_c();
+}
+inline void ForeignMessage::set_c(::int32_t value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.ForeignMessage.c)
+}
+inline ::int32_t ForeignMessage::_internal_c() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.c_;
+}
+inline void ForeignMessage::_internal_set_c(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.c_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestEmptyMessage
+
+// -------------------------------------------------------------------
+
+// TestMessageWithDummy
+
+// bool dummy = 536870911;
+inline void TestMessageWithDummy::clear_dummy() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.dummy_ = false;
+}
+inline bool TestMessageWithDummy::dummy() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestMessageWithDummy.dummy)
+  return _internal_dummy();
+}
+inline void TestMessageWithDummy::set_dummy(bool value) {
+  _internal_set_dummy(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestMessageWithDummy.dummy)
+}
+inline bool TestMessageWithDummy::_internal_dummy() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.dummy_;
+}
+inline void TestMessageWithDummy::_internal_set_dummy(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.dummy_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestOneof2
+
+// .proto3_unittest.TestOneof2.NestedEnum foo_enum = 6;
+inline bool TestOneof2::has_foo_enum() const {
+  return foo_case() == kFooEnum;
+}
+inline void TestOneof2::set_has_foo_enum() {
+  _impl_._oneof_case_[0] = kFooEnum;
+}
+inline void TestOneof2::clear_foo_enum() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (foo_case() == kFooEnum) {
+    _impl_.foo_.foo_enum_ = 0;
+    clear_has_foo();
+  }
+}
+inline ::proto3_unittest::TestOneof2_NestedEnum TestOneof2::foo_enum() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestOneof2.foo_enum)
+  return _internal_foo_enum();
+}
+inline void TestOneof2::set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value) {
+  _internal_set_foo_enum(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestOneof2.foo_enum)
+}
+inline ::proto3_unittest::TestOneof2_NestedEnum TestOneof2::_internal_foo_enum() const {
+  if (foo_case() == kFooEnum) {
+    return static_cast<::proto3_unittest::TestOneof2_NestedEnum>(_impl_.foo_.foo_enum_);
+  }
+  return static_cast<::proto3_unittest::TestOneof2_NestedEnum>(0);
+}
+inline void TestOneof2::_internal_set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value) {
+  if (foo_case() != kFooEnum) {
+    clear_foo();
+    set_has_foo_enum();
+  }
+  _impl_.foo_.foo_enum_ = value;
+}
+
+inline bool TestOneof2::has_foo() const {
+  return foo_case() != FOO_NOT_SET;
+}
+inline void TestOneof2::clear_has_foo() {
+  _impl_._oneof_case_[0] = FOO_NOT_SET;
+}
+inline TestOneof2::FooCase TestOneof2::foo_case() const {
+  return TestOneof2::FooCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::proto3_unittest::TestAllTypes_NestedEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto3_unittest::TestAllTypes_NestedEnum>() {
+  return ::proto3_unittest::TestAllTypes_NestedEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::proto3_unittest::TestOneof2_NestedEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto3_unittest::TestOneof2_NestedEnum>() {
+  return ::proto3_unittest::TestOneof2_NestedEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::proto3_unittest::ForeignEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto3_unittest::ForeignEnum>() {
+  return ::proto3_unittest::ForeignEnum_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fproto3_2eproto_2epb_2eh
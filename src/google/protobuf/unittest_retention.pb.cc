@@ -0,0 +1,1071 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_retention.proto
+
+#include "google/protobuf/unittest_retention.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR TopLevelMessage_NestedMessage::TopLevelMessage_NestedMessage(::_pbi::ConstantInitialized) {}
+struct TopLevelMessage_NestedMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopLevelMessage_NestedMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopLevelMessage_NestedMessageDefaultTypeInternal() {}
+  union {
+    TopLevelMessage_NestedMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopLevelMessage_NestedMessageDefaultTypeInternal _TopLevelMessage_NestedMessage_default_instance_;
+
+inline constexpr TopLevelMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        f_{0},
+        o_{},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TopLevelMessage::TopLevelMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TopLevelMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopLevelMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopLevelMessageDefaultTypeInternal() {}
+  union {
+    TopLevelMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopLevelMessageDefaultTypeInternal _TopLevelMessage_default_instance_;
+
+inline constexpr OptionsMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        plain_field_{0},
+        runtime_retention_field_{0},
+        source_retention_field_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OptionsMessage::OptionsMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct OptionsMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OptionsMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OptionsMessageDefaultTypeInternal() {}
+  union {
+    OptionsMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OptionsMessageDefaultTypeInternal _OptionsMessage_default_instance_;
+
+inline constexpr Extendee::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR Extendee::Extendee(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct ExtendeeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExtendeeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExtendeeDefaultTypeInternal() {}
+  union {
+    Extendee _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExtendeeDefaultTypeInternal _Extendee_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fretention_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fretention_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fretention_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OptionsMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OptionsMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OptionsMessage, _impl_.plain_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OptionsMessage, _impl_.runtime_retention_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OptionsMessage, _impl_.source_retention_field_),
+    0,
+    1,
+    2,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Extendee, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::Extendee, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage_NestedMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _impl_._extensions_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _impl_.f_),
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _impl_.o_),
+    0,
+    ~0u,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 11, -1, sizeof(::protobuf_unittest::OptionsMessage)},
+        {14, -1, -1, sizeof(::protobuf_unittest::Extendee)},
+        {22, -1, -1, sizeof(::protobuf_unittest::TopLevelMessage_NestedMessage)},
+        {30, 41, -1, sizeof(::protobuf_unittest::TopLevelMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_OptionsMessage_default_instance_._instance,
+    &::protobuf_unittest::_Extendee_default_instance_._instance,
+    &::protobuf_unittest::_TopLevelMessage_NestedMessage_default_instance_._instance,
+    &::protobuf_unittest::_TopLevelMessage_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fretention_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n(google/protobuf/unittest_retention.pro"
+    "to\022\021protobuf_unittest\032 google/protobuf/d"
+    "escriptor.proto\"p\n\016OptionsMessage\022\023\n\013pla"
+    "in_field\030\001 \001(\005\022$\n\027runtime_retention_fiel"
+    "d\030\002 \001(\005B\003\210\001\001\022#\n\026source_retention_field\030\003"
+    " \001(\005B\003\210\001\002\"\026\n\010Extendee*\004\010\001\020\002*\004\010\002\020\003\"\343\001\n\017To"
+    "pLevelMessage\022\025\n\001f\030\001 \001(\002B\n\232\272\355\204\017\004\010\001\020\002\022\013\n\001"
+    "i\030\002 \001(\003H\000\032\033\n\rNestedMessage:\n\232\305\336\205\017\004\010\001\020\002\","
+    "\n\nNestedEnum\022\022\n\016NESTED_UNKNOWN\020\000\032\n\372\236\252\204\017\004"
+    "\010\001\020\002*\020\010\n\020e\032\n\242\230\337\205\017\004\010\001\020\00222\n\001s\022\033.protobuf_u"
+    "nittest.Extendee\030\002 \001(\tB\n\232\272\355\204\017\004\010\001\020\002:\n\232\305\336\205"
+    "\017\004\010\001\020\002B\017\n\001o\022\n\212\333\267\204\017\004\010\001\020\002*=\n\014TopLevelEnum\022"
+    "!\n\021TOP_LEVEL_UNKNOWN\020\000\032\n\322\335\251\204\017\004\010\001\020\002\032\n\372\236\252\204"
+    "\017\004\010\001\020\0022t\n\007Service\022]\n\007DoStuff\022\".protobuf_"
+    "unittest.TopLevelMessage\032\".protobuf_unit"
+    "test.TopLevelMessage\"\n\342\256\370\203\017\004\010\001\020\002\032\n\352\207\213\204\017\004"
+    "\010\001\020\002:6\n\014plain_option\022\034.google.protobuf.F"
+    "ileOptions\030\306\265\354\360\001 \001(\005:G\n\030runtime_retentio"
+    "n_option\022\034.google.protobuf.FileOptions\030\234"
+    "\222\351\360\001 \001(\005B\003\210\001\001:F\n\027source_retention_option"
+    "\022\034.google.protobuf.FileOptions\030\324\254\337\360\001 \001(\005"
+    "B\003\210\001\002:X\n\013file_option\022\034.google.protobuf.F"
+    "ileOptions\030\200\362\336\360\001 \001(\0132!.protobuf_unittest"
+    ".OptionsMessage:]\n\020repeated_options\022\034.go"
+    "ogle.protobuf.FileOptions\030\222\376\333\360\001 \003(\0132!.pr"
+    "otobuf_unittest.OptionsMessage:m\n\026extens"
+    "ion_range_option\022&.google.protobuf.Exten"
+    "sionRangeOptions\030\204\363\333\360\001 \001(\0132!.protobuf_un"
+    "ittest.OptionsMessage:^\n\016message_option\022"
+    "\037.google.protobuf.MessageOptions\030\323\350\333\360\001 \001"
+    "(\0132!.protobuf_unittest.OptionsMessage:Z\n"
+    "\014field_option\022\035.google.protobuf.FieldOpt"
+    "ions\030\243\327\315\360\001 \001(\0132!.protobuf_unittest.Optio"
+    "nsMessage:Z\n\014oneof_option\022\035.google.proto"
+    "buf.OneofOptions\030\261\373\306\360\001 \001(\0132!.protobuf_un"
+    "ittest.OptionsMessage:X\n\013enum_option\022\034.g"
+    "oogle.protobuf.EnumOptions\030\357\243\305\360\001 \001(\0132!.p"
+    "rotobuf_unittest.OptionsMessage:c\n\021enum_"
+    "entry_option\022!.google.protobuf.EnumValue"
+    "Options\030\332\233\305\360\001 \001(\0132!.protobuf_unittest.Op"
+    "tionsMessage:^\n\016service_option\022\037.google."
+    "protobuf.ServiceOptions\030\375\260\301\360\001 \001(\0132!.prot"
+    "obuf_unittest.OptionsMessage:\\\n\rmethod_o"
+    "ption\022\036.google.protobuf.MethodOptions\030\354\205"
+    "\277\360\001 \001(\0132!.protobuf_unittest.OptionsMessa"
+    "ge:2\n\001i\022\033.protobuf_unittest.Extendee\030\001 \001"
+    "(\005B\n\232\272\355\204\017\004\010\001\020\002B3\252\002\020ProtobufUnittest\222\361\337\205\017"
+    "\004\010\001\020\002\202\220\367\205\017\004\010\001\020\002\340\221\311\206\017\002\260\254\343\206\017\001"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto = {
+    false,
+    false,
+    1907,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fretention_2eproto,
+    "google/protobuf/unittest_retention.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_deps,
+    1,
+    4,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fretention_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fretention_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fretention_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fretention_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto);
+namespace protobuf_unittest {
+const ::google::protobuf::EnumDescriptor* TopLevelMessage_NestedEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fretention_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t TopLevelMessage_NestedEnum_internal_data_[] = {
+    65536u, 0u, };
+bool TopLevelMessage_NestedEnum_IsValid(int value) {
+  return 0 <= value && value <= 0;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr TopLevelMessage_NestedEnum TopLevelMessage::NESTED_UNKNOWN;
+constexpr TopLevelMessage_NestedEnum TopLevelMessage::NestedEnum_MIN;
+constexpr TopLevelMessage_NestedEnum TopLevelMessage::NestedEnum_MAX;
+constexpr int TopLevelMessage::NestedEnum_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* TopLevelEnum_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fretention_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t TopLevelEnum_internal_data_[] = {
+    65536u, 0u, };
+bool TopLevelEnum_IsValid(int value) {
+  return 0 <= value && value <= 0;
+}
+// ===================================================================
+
+class OptionsMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OptionsMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_._has_bits_);
+  static void set_has_plain_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_runtime_retention_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_source_retention_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+OptionsMessage::OptionsMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.OptionsMessage)
+}
+OptionsMessage::OptionsMessage(
+    ::google::protobuf::Arena* arena, const OptionsMessage& from)
+    : OptionsMessage(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE OptionsMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void OptionsMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, plain_field_),
+           0,
+           offsetof(Impl_, source_retention_field_) -
+               offsetof(Impl_, plain_field_) +
+               sizeof(Impl_::source_retention_field_));
+}
+OptionsMessage::~OptionsMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.OptionsMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void OptionsMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void OptionsMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.OptionsMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.plain_field_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.source_retention_field_) -
+        reinterpret_cast<char*>(&_impl_.plain_field_)) + sizeof(_impl_.source_retention_field_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* OptionsMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2> OptionsMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_OptionsMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional int32 plain_field = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OptionsMessage, _impl_.plain_field_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.plain_field_)}},
+    // optional int32 runtime_retention_field = 2 [retention = RETENTION_RUNTIME];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OptionsMessage, _impl_.runtime_retention_field_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.runtime_retention_field_)}},
+    // optional int32 source_retention_field = 3 [retention = RETENTION_SOURCE];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OptionsMessage, _impl_.source_retention_field_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.source_retention_field_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 plain_field = 1;
+    {PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.plain_field_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 runtime_retention_field = 2 [retention = RETENTION_RUNTIME];
+    {PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.runtime_retention_field_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 source_retention_field = 3 [retention = RETENTION_SOURCE];
+    {PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.source_retention_field_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* OptionsMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.OptionsMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 33 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[33];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 plain_field = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_plain_field(), ptr);
+  }
+
+  // optional int32 runtime_retention_field = 2 [retention = RETENTION_RUNTIME];
+  if (cached_has_bits & 0x00000002u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_runtime_retention_field(), ptr);
+  }
+
+  // optional int32 source_retention_field = 3 [retention = RETENTION_SOURCE];
+  if (cached_has_bits & 0x00000004u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        3, this->_internal_source_retention_field(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.OptionsMessage)
+  return target;
+}
+
+::size_t OptionsMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.OptionsMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 plain_field = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_plain_field());
+    }
+
+    // optional int32 runtime_retention_field = 2 [retention = RETENTION_RUNTIME];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_runtime_retention_field());
+    }
+
+    // optional int32 source_retention_field = 3 [retention = RETENTION_SOURCE];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_source_retention_field());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData OptionsMessage::_class_data_ = {
+    OptionsMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* OptionsMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void OptionsMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<OptionsMessage*>(&to_msg);
+  auto& from = static_cast<const OptionsMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.OptionsMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.plain_field_ = from._impl_.plain_field_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.runtime_retention_field_ = from._impl_.runtime_retention_field_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.source_retention_field_ = from._impl_.source_retention_field_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OptionsMessage::CopyFrom(const OptionsMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.OptionsMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool OptionsMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* OptionsMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void OptionsMessage::InternalSwap(OptionsMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.source_retention_field_)
+      + sizeof(OptionsMessage::_impl_.source_retention_field_)
+      - PROTOBUF_FIELD_OFFSET(OptionsMessage, _impl_.plain_field_)>(
+          reinterpret_cast<char*>(&_impl_.plain_field_),
+          reinterpret_cast<char*>(&other->_impl_.plain_field_));
+}
+
+::google::protobuf::Metadata OptionsMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fretention_2eproto[0]);
+}
+// ===================================================================
+
+class Extendee::_Internal {
+ public:
+};
+
+Extendee::Extendee(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.Extendee)
+}
+inline PROTOBUF_NDEBUG_INLINE Extendee::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+Extendee::Extendee(
+    ::google::protobuf::Arena* arena,
+    const Extendee& from)
+    : ::google::protobuf::Message(arena) {
+  Extendee* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.Extendee)
+}
+inline PROTOBUF_NDEBUG_INLINE Extendee::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void Extendee::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+Extendee::~Extendee() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.Extendee)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Extendee::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Extendee::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.Extendee)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Extendee::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 0, 0, 0, 2> Extendee::_table_ = {
+  {
+    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(Extendee, _impl_._extensions_),
+    0, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_names),  // no field_entries
+    0,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_Extendee_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }},
+  // no field_entries, or aux_entries
+  {{
+  }},
+};
+
+::uint8_t* Extendee::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.Extendee)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // Extension range [1, 3)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 1, 3, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.Extendee)
+  return target;
+}
+
+::size_t Extendee::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.Extendee)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Extendee::_class_data_ = {
+    Extendee::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Extendee::GetClassData() const {
+  return &_class_data_;
+}
+
+void Extendee::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Extendee*>(&to_msg);
+  auto& from = static_cast<const Extendee&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.Extendee)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Extendee::CopyFrom(const Extendee& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.Extendee)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Extendee::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* Extendee::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Extendee::InternalSwap(Extendee* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+}
+
+::google::protobuf::Metadata Extendee::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fretention_2eproto[1]);
+}
+// ===================================================================
+
+class TopLevelMessage_NestedMessage::_Internal {
+ public:
+};
+
+TopLevelMessage_NestedMessage::TopLevelMessage_NestedMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TopLevelMessage.NestedMessage)
+}
+TopLevelMessage_NestedMessage::TopLevelMessage_NestedMessage(
+    ::google::protobuf::Arena* arena,
+    const TopLevelMessage_NestedMessage& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  TopLevelMessage_NestedMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TopLevelMessage.NestedMessage)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata TopLevelMessage_NestedMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fretention_2eproto[2]);
+}
+// ===================================================================
+
+class TopLevelMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TopLevelMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TopLevelMessage, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TopLevelMessage, _impl_._oneof_case_);
+  static void set_has_f(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TopLevelMessage::TopLevelMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TopLevelMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TopLevelMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        o_{},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+TopLevelMessage::TopLevelMessage(
+    ::google::protobuf::Arena* arena,
+    const TopLevelMessage& from)
+    : ::google::protobuf::Message(arena) {
+  TopLevelMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+  _impl_.f_ = from._impl_.f_;
+  switch (o_case()) {
+    case O_NOT_SET:
+      break;
+      case kI:
+        _impl_.o_.i_ = from._impl_.o_.i_;
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TopLevelMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TopLevelMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0},
+        o_{},
+        _oneof_case_{} {}
+
+inline void TopLevelMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.f_ = {};
+}
+TopLevelMessage::~TopLevelMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TopLevelMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TopLevelMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  if (has_o()) {
+    clear_o();
+  }
+  _impl_.~Impl_();
+}
+
+void TopLevelMessage::clear_o() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TopLevelMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (o_case()) {
+    case kI: {
+      // No need to clear
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = O_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void TopLevelMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TopLevelMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.f_ = 0;
+  clear_o();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TopLevelMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 0, 0, 2> TopLevelMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TopLevelMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(TopLevelMessage, _impl_._extensions_),
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TopLevelMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional float f = 1 [(.protobuf_unittest.field_option) = {
+    {::_pbi::TcParser::FastF32S1,
+     {13, 0, 0, PROTOBUF_FIELD_OFFSET(TopLevelMessage, _impl_.f_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional float f = 1 [(.protobuf_unittest.field_option) = {
+    {PROTOBUF_FIELD_OFFSET(TopLevelMessage, _impl_.f_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // int64 i = 2;
+    {PROTOBUF_FIELD_OFFSET(TopLevelMessage, _impl_.o_.i_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TopLevelMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TopLevelMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float f = 1 [(.protobuf_unittest.field_option) = {
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        1, this->_internal_f(), target);
+  }
+
+  // int64 i = 2;
+  if (o_case() == kI) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt64ToArrayWithField<2>(
+            stream, this->_internal_i(), target);
+  }
+
+  // Extension range [10, 101)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 10, 101, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TopLevelMessage)
+  return target;
+}
+
+::size_t TopLevelMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TopLevelMessage)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float f = 1 [(.protobuf_unittest.field_option) = {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 5;
+  }
+
+  switch (o_case()) {
+    // int64 i = 2;
+    case kI: {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+          this->_internal_i());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TopLevelMessage::_class_data_ = {
+    TopLevelMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TopLevelMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void TopLevelMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TopLevelMessage*>(&to_msg);
+  auto& from = static_cast<const TopLevelMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TopLevelMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_f(from._internal_f());
+  }
+  switch (from.o_case()) {
+    case kI: {
+      _this->_internal_set_i(from._internal_i());
+      break;
+    }
+    case O_NOT_SET: {
+      break;
+    }
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TopLevelMessage::CopyFrom(const TopLevelMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TopLevelMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TopLevelMessage::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TopLevelMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TopLevelMessage::InternalSwap(TopLevelMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+        swap(_impl_.f_, other->_impl_.f_);
+  swap(_impl_.o_, other->_impl_.o_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata TopLevelMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fretention_2eproto[3]);
+}
+const std::string TopLevelMessage_s_default("");
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TopLevelMessage::kSFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::Extendee,
+    ::google::protobuf::internal::StringTypeTraits, 9, false>
+  TopLevelMessage::s(kSFieldNumber, TopLevelMessage_s_default, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  plain_option(kPlainOptionFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  runtime_retention_option(kRuntimeRetentionOptionFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  source_retention_option(kSourceRetentionOptionFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  file_option(kFileOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  repeated_options(kRepeatedOptionsFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ExtensionRangeOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  extension_range_option(kExtensionRangeOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  message_option(kMessageOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  field_option(kFieldOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::OneofOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  oneof_option(kOneofOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  enum_option(kEnumOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumValueOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  enum_entry_option(kEnumEntryOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  service_option(kServiceOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false>
+  method_option(kMethodOptionFieldNumber, ::protobuf_unittest::OptionsMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::Extendee,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false>
+  i(kIFieldNumber, 0, nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
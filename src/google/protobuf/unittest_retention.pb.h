@@ -0,0 +1,1505 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_retention.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fretention_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fretention_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_bases.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/descriptor.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fretention_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fretention_2eproto;
+namespace protobuf_unittest {
+class Extendee;
+struct ExtendeeDefaultTypeInternal;
+extern ExtendeeDefaultTypeInternal _Extendee_default_instance_;
+class OptionsMessage;
+struct OptionsMessageDefaultTypeInternal;
+extern OptionsMessageDefaultTypeInternal _OptionsMessage_default_instance_;
+class TopLevelMessage;
+struct TopLevelMessageDefaultTypeInternal;
+extern TopLevelMessageDefaultTypeInternal _TopLevelMessage_default_instance_;
+class TopLevelMessage_NestedMessage;
+struct TopLevelMessage_NestedMessageDefaultTypeInternal;
+extern TopLevelMessage_NestedMessageDefaultTypeInternal _TopLevelMessage_NestedMessage_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+enum TopLevelMessage_NestedEnum : int {
+  TopLevelMessage_NestedEnum_NESTED_UNKNOWN = 0,
+};
+
+bool TopLevelMessage_NestedEnum_IsValid(int value);
+extern const uint32_t TopLevelMessage_NestedEnum_internal_data_[];
+constexpr TopLevelMessage_NestedEnum TopLevelMessage_NestedEnum_NestedEnum_MIN = static_cast<TopLevelMessage_NestedEnum>(0);
+constexpr TopLevelMessage_NestedEnum TopLevelMessage_NestedEnum_NestedEnum_MAX = static_cast<TopLevelMessage_NestedEnum>(0);
+constexpr int TopLevelMessage_NestedEnum_NestedEnum_ARRAYSIZE = 0 + 1;
+const ::google::protobuf::EnumDescriptor*
+TopLevelMessage_NestedEnum_descriptor();
+template <typename T>
+const std::string& TopLevelMessage_NestedEnum_Name(T value) {
+  static_assert(std::is_same<T, TopLevelMessage_NestedEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to NestedEnum_Name().");
+  return TopLevelMessage_NestedEnum_Name(static_cast<TopLevelMessage_NestedEnum>(value));
+}
+template <>
+inline const std::string& TopLevelMessage_NestedEnum_Name(TopLevelMessage_NestedEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<TopLevelMessage_NestedEnum_descriptor,
+                                                 0, 0>(
+      static_cast<int>(value));
+}
+inline bool TopLevelMessage_NestedEnum_Parse(absl::string_view name, TopLevelMessage_NestedEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TopLevelMessage_NestedEnum>(
+      TopLevelMessage_NestedEnum_descriptor(), name, value);
+}
+enum TopLevelEnum : int {
+  TOP_LEVEL_UNKNOWN = 0,
+};
+
+bool TopLevelEnum_IsValid(int value);
+extern const uint32_t TopLevelEnum_internal_data_[];
+constexpr TopLevelEnum TopLevelEnum_MIN = static_cast<TopLevelEnum>(0);
+constexpr TopLevelEnum TopLevelEnum_MAX = static_cast<TopLevelEnum>(0);
+constexpr int TopLevelEnum_ARRAYSIZE = 0 + 1;
+const ::google::protobuf::EnumDescriptor*
+TopLevelEnum_descriptor();
+template <typename T>
+const std::string& TopLevelEnum_Name(T value) {
+  static_assert(std::is_same<T, TopLevelEnum>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to TopLevelEnum_Name().");
+  return TopLevelEnum_Name(static_cast<TopLevelEnum>(value));
+}
+template <>
+inline const std::string& TopLevelEnum_Name(TopLevelEnum value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<TopLevelEnum_descriptor,
+                                                 0, 0>(
+      static_cast<int>(value));
+}
+inline bool TopLevelEnum_Parse(absl::string_view name, TopLevelEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TopLevelEnum>(
+      TopLevelEnum_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TopLevelMessage_NestedMessage final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:protobuf_unittest.TopLevelMessage.NestedMessage) */ {
+ public:
+  inline TopLevelMessage_NestedMessage() : TopLevelMessage_NestedMessage(nullptr) {}
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TopLevelMessage_NestedMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TopLevelMessage_NestedMessage(const TopLevelMessage_NestedMessage& from)
+      : TopLevelMessage_NestedMessage(nullptr, from) {}
+  TopLevelMessage_NestedMessage(TopLevelMessage_NestedMessage&& from) noexcept
+    : TopLevelMessage_NestedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TopLevelMessage_NestedMessage& operator=(const TopLevelMessage_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TopLevelMessage_NestedMessage& operator=(TopLevelMessage_NestedMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TopLevelMessage_NestedMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TopLevelMessage_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TopLevelMessage_NestedMessage*>(
+               &_TopLevelMessage_NestedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TopLevelMessage_NestedMessage& a, TopLevelMessage_NestedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopLevelMessage_NestedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TopLevelMessage_NestedMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TopLevelMessage_NestedMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopLevelMessage_NestedMessage>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const TopLevelMessage_NestedMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const TopLevelMessage_NestedMessage& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TopLevelMessage.NestedMessage";
+  }
+  protected:
+  explicit TopLevelMessage_NestedMessage(::google::protobuf::Arena* arena);
+  TopLevelMessage_NestedMessage(::google::protobuf::Arena* arena, const TopLevelMessage_NestedMessage& from);
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TopLevelMessage.NestedMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto;
+};// -------------------------------------------------------------------
+
+class TopLevelMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TopLevelMessage) */ {
+ public:
+  inline TopLevelMessage() : TopLevelMessage(nullptr) {}
+  ~TopLevelMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TopLevelMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TopLevelMessage(const TopLevelMessage& from)
+      : TopLevelMessage(nullptr, from) {}
+  TopLevelMessage(TopLevelMessage&& from) noexcept
+    : TopLevelMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TopLevelMessage& operator=(const TopLevelMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TopLevelMessage& operator=(TopLevelMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TopLevelMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OCase {
+    kI = 2,
+    O_NOT_SET = 0,
+  };
+
+  static inline const TopLevelMessage* internal_default_instance() {
+    return reinterpret_cast<const TopLevelMessage*>(
+               &_TopLevelMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TopLevelMessage& a, TopLevelMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopLevelMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TopLevelMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TopLevelMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopLevelMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TopLevelMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TopLevelMessage& from) {
+    TopLevelMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TopLevelMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TopLevelMessage";
+  }
+  protected:
+  explicit TopLevelMessage(::google::protobuf::Arena* arena);
+  TopLevelMessage(::google::protobuf::Arena* arena, const TopLevelMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using NestedMessage = TopLevelMessage_NestedMessage;
+
+  using NestedEnum = TopLevelMessage_NestedEnum;
+  static constexpr NestedEnum NESTED_UNKNOWN = TopLevelMessage_NestedEnum_NESTED_UNKNOWN;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TopLevelMessage_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN = TopLevelMessage_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX = TopLevelMessage_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE = TopLevelMessage_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* NestedEnum_descriptor() {
+    return TopLevelMessage_NestedEnum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& NestedEnum_Name(T value) {
+    return TopLevelMessage_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(absl::string_view name, NestedEnum* value) {
+    return TopLevelMessage_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFFieldNumber = 1,
+    kIFieldNumber = 2,
+  };
+  // optional float f = 1 [(.protobuf_unittest.field_option) = {
+  bool has_f() const;
+  void clear_f() ;
+  float f() const;
+  void set_f(float value);
+
+  private:
+  float _internal_f() const;
+  void _internal_set_f(float value);
+
+  public:
+  // int64 i = 2;
+  bool has_i() const;
+  void clear_i() ;
+  ::int64_t i() const;
+  void set_i(::int64_t value);
+
+  private:
+  ::int64_t _internal_i() const;
+  void _internal_set_i(::int64_t value);
+
+  public:
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<TopLevelMessage, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  void clear_o();
+  OCase o_case() const;
+  static const int kSFieldNumber = 2;
+  static ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::Extendee,
+      ::google::protobuf::internal::StringTypeTraits, 9, false >
+    s;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TopLevelMessage)
+ private:
+  class _Internal;
+  void set_has_i();
+
+  inline bool has_o() const;
+  inline void clear_has_o();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 2, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    float f_;
+    union OUnion {
+      constexpr OUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::int64_t i_;
+    } o_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto;
+};// -------------------------------------------------------------------
+
+class OptionsMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.OptionsMessage) */ {
+ public:
+  inline OptionsMessage() : OptionsMessage(nullptr) {}
+  ~OptionsMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR OptionsMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline OptionsMessage(const OptionsMessage& from)
+      : OptionsMessage(nullptr, from) {}
+  OptionsMessage(OptionsMessage&& from) noexcept
+    : OptionsMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline OptionsMessage& operator=(const OptionsMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OptionsMessage& operator=(OptionsMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OptionsMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OptionsMessage* internal_default_instance() {
+    return reinterpret_cast<const OptionsMessage*>(
+               &_OptionsMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(OptionsMessage& a, OptionsMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OptionsMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OptionsMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OptionsMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OptionsMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const OptionsMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const OptionsMessage& from) {
+    OptionsMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(OptionsMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.OptionsMessage";
+  }
+  protected:
+  explicit OptionsMessage(::google::protobuf::Arena* arena);
+  OptionsMessage(::google::protobuf::Arena* arena, const OptionsMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlainFieldFieldNumber = 1,
+    kRuntimeRetentionFieldFieldNumber = 2,
+    kSourceRetentionFieldFieldNumber = 3,
+  };
+  // optional int32 plain_field = 1;
+  bool has_plain_field() const;
+  void clear_plain_field() ;
+  ::int32_t plain_field() const;
+  void set_plain_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_plain_field() const;
+  void _internal_set_plain_field(::int32_t value);
+
+  public:
+  // optional int32 runtime_retention_field = 2 [retention = RETENTION_RUNTIME];
+  bool has_runtime_retention_field() const;
+  void clear_runtime_retention_field() ;
+  ::int32_t runtime_retention_field() const;
+  void set_runtime_retention_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_runtime_retention_field() const;
+  void _internal_set_runtime_retention_field(::int32_t value);
+
+  public:
+  // optional int32 source_retention_field = 3 [retention = RETENTION_SOURCE];
+  bool has_source_retention_field() const;
+  void clear_source_retention_field() ;
+  ::int32_t source_retention_field() const;
+  void set_source_retention_field(::int32_t value);
+
+  private:
+  ::int32_t _internal_source_retention_field() const;
+  void _internal_set_source_retention_field(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.OptionsMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::int32_t plain_field_;
+    ::int32_t runtime_retention_field_;
+    ::int32_t source_retention_field_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto;
+};// -------------------------------------------------------------------
+
+class Extendee final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.Extendee) */ {
+ public:
+  inline Extendee() : Extendee(nullptr) {}
+  ~Extendee() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR Extendee(::google::protobuf::internal::ConstantInitialized);
+
+  inline Extendee(const Extendee& from)
+      : Extendee(nullptr, from) {}
+  Extendee(Extendee&& from) noexcept
+    : Extendee() {
+    *this = ::std::move(from);
+  }
+
+  inline Extendee& operator=(const Extendee& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Extendee& operator=(Extendee&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Extendee& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Extendee* internal_default_instance() {
+    return reinterpret_cast<const Extendee*>(
+               &_Extendee_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Extendee& a, Extendee& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Extendee* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Extendee* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Extendee* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Extendee>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const Extendee& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const Extendee& from) {
+    Extendee::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(Extendee* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.Extendee";
+  }
+  protected:
+  explicit Extendee(::google::protobuf::Arena* arena);
+  Extendee(::google::protobuf::Arena* arena, const Extendee& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, id.default_value());
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), _field_type, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                           _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::Release(id.number(), _field_type, &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) {
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<!_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed,
+            std::enable_if_t<_proto_TypeTraits::kLifetimeBound, int> = 0>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index) ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id) const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits, ::google::protobuf::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::google::protobuf::internal::ExtensionIdentifier<Extendee, _proto_TypeTraits,
+                                       _field_type, _is_packed>& id)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.Extendee)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 0, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ExtensionSet _extensions_;
+
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fretention_2eproto;
+};
+
+// ===================================================================
+
+
+
+static const int kPlainOptionFieldNumber = 505092806;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  plain_option;
+static const int kRuntimeRetentionOptionFieldNumber = 505039132;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  runtime_retention_option;
+static const int kSourceRetentionOptionFieldNumber = 504878676;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  source_retention_option;
+static const int kFileOptionFieldNumber = 504871168;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  file_option;
+static const int kRepeatedOptionsFieldNumber = 504823570;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FileOptions,
+    ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  repeated_options;
+static const int kExtensionRangeOptionFieldNumber = 504822148;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ExtensionRangeOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  extension_range_option;
+static const int kMessageOptionFieldNumber = 504820819;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  message_option;
+static const int kFieldOptionFieldNumber = 504589219;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  field_option;
+static const int kOneofOptionFieldNumber = 504479153;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::OneofOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  oneof_option;
+static const int kEnumOptionFieldNumber = 504451567;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  enum_option;
+static const int kEnumEntryOptionFieldNumber = 504450522;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::EnumValueOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  enum_entry_option;
+static const int kServiceOptionFieldNumber = 504387709;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  service_option;
+static const int kMethodOptionFieldNumber = 504349420;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionsMessage >, 11, false >
+  method_option;
+static const int kIFieldNumber = 1;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::Extendee,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::int32_t >, 5, false >
+  i;
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// OptionsMessage
+
+// optional int32 plain_field = 1;
+inline bool OptionsMessage::has_plain_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void OptionsMessage::clear_plain_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.plain_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t OptionsMessage::plain_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OptionsMessage.plain_field)
+  return _internal_plain_field();
+}
+inline void OptionsMessage::set_plain_field(::int32_t value) {
+  _internal_set_plain_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.OptionsMessage.plain_field)
+}
+inline ::int32_t OptionsMessage::_internal_plain_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.plain_field_;
+}
+inline void OptionsMessage::_internal_set_plain_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.plain_field_ = value;
+}
+
+// optional int32 runtime_retention_field = 2 [retention = RETENTION_RUNTIME];
+inline bool OptionsMessage::has_runtime_retention_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline void OptionsMessage::clear_runtime_retention_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.runtime_retention_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::int32_t OptionsMessage::runtime_retention_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OptionsMessage.runtime_retention_field)
+  return _internal_runtime_retention_field();
+}
+inline void OptionsMessage::set_runtime_retention_field(::int32_t value) {
+  _internal_set_runtime_retention_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.OptionsMessage.runtime_retention_field)
+}
+inline ::int32_t OptionsMessage::_internal_runtime_retention_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.runtime_retention_field_;
+}
+inline void OptionsMessage::_internal_set_runtime_retention_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.runtime_retention_field_ = value;
+}
+
+// optional int32 source_retention_field = 3 [retention = RETENTION_SOURCE];
+inline bool OptionsMessage::has_source_retention_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline void OptionsMessage::clear_source_retention_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.source_retention_field_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::int32_t OptionsMessage::source_retention_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OptionsMessage.source_retention_field)
+  return _internal_source_retention_field();
+}
+inline void OptionsMessage::set_source_retention_field(::int32_t value) {
+  _internal_set_source_retention_field(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.OptionsMessage.source_retention_field)
+}
+inline ::int32_t OptionsMessage::_internal_source_retention_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.source_retention_field_;
+}
+inline void OptionsMessage::_internal_set_source_retention_field(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.source_retention_field_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Extendee
+
+// -------------------------------------------------------------------
+
+// TopLevelMessage_NestedMessage
+
+// -------------------------------------------------------------------
+
+// TopLevelMessage
+
+// optional float f = 1 [(.protobuf_unittest.field_option) = {
+inline bool TopLevelMessage::has_f() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline void TopLevelMessage::clear_f() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.f_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float TopLevelMessage::f() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TopLevelMessage.f)
+  return _internal_f();
+}
+inline void TopLevelMessage::set_f(float value) {
+  _internal_set_f(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TopLevelMessage.f)
+}
+inline float TopLevelMessage::_internal_f() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.f_;
+}
+inline void TopLevelMessage::_internal_set_f(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.f_ = value;
+}
+
+// int64 i = 2;
+inline bool TopLevelMessage::has_i() const {
+  return o_case() == kI;
+}
+inline void TopLevelMessage::set_has_i() {
+  _impl_._oneof_case_[0] = kI;
+}
+inline void TopLevelMessage::clear_i() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (o_case() == kI) {
+    _impl_.o_.i_ = ::int64_t{0};
+    clear_has_o();
+  }
+}
+inline ::int64_t TopLevelMessage::i() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TopLevelMessage.i)
+  return _internal_i();
+}
+inline void TopLevelMessage::set_i(::int64_t value) {
+  _internal_set_i(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TopLevelMessage.i)
+}
+inline ::int64_t TopLevelMessage::_internal_i() const {
+  if (o_case() == kI) {
+    return _impl_.o_.i_;
+  }
+  return ::int64_t{0};
+}
+inline void TopLevelMessage::_internal_set_i(::int64_t value) {
+  if (o_case() != kI) {
+    clear_o();
+    set_has_i();
+  }
+  _impl_.o_.i_ = value;
+}
+
+inline bool TopLevelMessage::has_o() const {
+  return o_case() != O_NOT_SET;
+}
+inline void TopLevelMessage::clear_has_o() {
+  _impl_._oneof_case_[0] = O_NOT_SET;
+}
+inline TopLevelMessage::OCase TopLevelMessage::o_case() const {
+  return TopLevelMessage::OCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::protobuf_unittest::TopLevelMessage_NestedEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::TopLevelMessage_NestedEnum>() {
+  return ::protobuf_unittest::TopLevelMessage_NestedEnum_descriptor();
+}
+template <>
+struct is_proto_enum<::protobuf_unittest::TopLevelEnum> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::protobuf_unittest::TopLevelEnum>() {
+  return ::protobuf_unittest::TopLevelEnum_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fretention_2eproto_2epb_2eh
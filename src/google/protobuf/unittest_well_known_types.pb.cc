@@ -0,0 +1,5111 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_well_known_types.proto
+
+#include "google/protobuf/unittest_well_known_types.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MapWellKnownTypes_Uint64FieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_Uint64FieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MapWellKnownTypes_Uint32FieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_Uint32FieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MapWellKnownTypes_TimestampFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_TimestampFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_StructFieldEntry_DoNotUse::MapWellKnownTypes_StructFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_StructFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_StringFieldEntry_DoNotUse::MapWellKnownTypes_StringFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_StringFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_SourceContextFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_Int64FieldEntry_DoNotUse::MapWellKnownTypes_Int64FieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_Int64FieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_Int32FieldEntry_DoNotUse::MapWellKnownTypes_Int32FieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_Int32FieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_FloatFieldEntry_DoNotUse::MapWellKnownTypes_FloatFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_FloatFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MapWellKnownTypes_EmptyFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_EmptyFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_DurationFieldEntry_DoNotUse::MapWellKnownTypes_DurationFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_DurationFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MapWellKnownTypes_DoubleFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_DoubleFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_BytesFieldEntry_DoNotUse::MapWellKnownTypes_BytesFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_BytesFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_BoolFieldEntry_DoNotUse::MapWellKnownTypes_BoolFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_BoolFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_AnyFieldEntry_DoNotUse::MapWellKnownTypes_AnyFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_AnyFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_;
+
+inline constexpr TestWellKnownTypes::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        any_field_{nullptr},
+        api_field_{nullptr},
+        duration_field_{nullptr},
+        empty_field_{nullptr},
+        field_mask_field_{nullptr},
+        source_context_field_{nullptr},
+        struct_field_{nullptr},
+        timestamp_field_{nullptr},
+        type_field_{nullptr},
+        double_field_{nullptr},
+        float_field_{nullptr},
+        int64_field_{nullptr},
+        uint64_field_{nullptr},
+        int32_field_{nullptr},
+        uint32_field_{nullptr},
+        bool_field_{nullptr},
+        string_field_{nullptr},
+        bytes_field_{nullptr},
+        value_field_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestWellKnownTypes::TestWellKnownTypes(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestWellKnownTypesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestWellKnownTypesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestWellKnownTypesDefaultTypeInternal() {}
+  union {
+    TestWellKnownTypes _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestWellKnownTypesDefaultTypeInternal _TestWellKnownTypes_default_instance_;
+
+inline constexpr RepeatedWellKnownTypes::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : any_field_{},
+        api_field_{},
+        duration_field_{},
+        empty_field_{},
+        field_mask_field_{},
+        source_context_field_{},
+        struct_field_{},
+        timestamp_field_{},
+        type_field_{},
+        double_field_{},
+        float_field_{},
+        int64_field_{},
+        uint64_field_{},
+        int32_field_{},
+        uint32_field_{},
+        bool_field_{},
+        string_field_{},
+        bytes_field_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RepeatedWellKnownTypes::RepeatedWellKnownTypes(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct RepeatedWellKnownTypesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RepeatedWellKnownTypesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RepeatedWellKnownTypesDefaultTypeInternal() {}
+  union {
+    RepeatedWellKnownTypes _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RepeatedWellKnownTypesDefaultTypeInternal _RepeatedWellKnownTypes_default_instance_;
+
+inline constexpr OneofWellKnownTypes::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : oneof_field_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OneofWellKnownTypes::OneofWellKnownTypes(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct OneofWellKnownTypesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OneofWellKnownTypesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OneofWellKnownTypesDefaultTypeInternal() {}
+  union {
+    OneofWellKnownTypes _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OneofWellKnownTypesDefaultTypeInternal _OneofWellKnownTypes_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_TypeFieldEntry_DoNotUse::MapWellKnownTypes_TypeFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_TypeFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes_ApiFieldEntry_DoNotUse::MapWellKnownTypes_ApiFieldEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes_ApiFieldEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_;
+
+inline constexpr MapWellKnownTypes::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : any_field_{},
+        api_field_{},
+        duration_field_{},
+        empty_field_{},
+        field_mask_field_{},
+        source_context_field_{},
+        struct_field_{},
+        timestamp_field_{},
+        type_field_{},
+        double_field_{},
+        float_field_{},
+        int64_field_{},
+        uint64_field_{},
+        int32_field_{},
+        uint32_field_{},
+        bool_field_{},
+        string_field_{},
+        bytes_field_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapWellKnownTypes::MapWellKnownTypes(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapWellKnownTypesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapWellKnownTypesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapWellKnownTypesDefaultTypeInternal() {}
+  union {
+    MapWellKnownTypes _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapWellKnownTypesDefaultTypeInternal _MapWellKnownTypes_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[22];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.any_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.api_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.duration_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.empty_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.field_mask_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.source_context_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.struct_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.timestamp_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.type_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.double_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.float_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.int64_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.uint64_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.int32_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.uint32_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.bool_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.string_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.bytes_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _impl_.value_field_),
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    10,
+    11,
+    12,
+    13,
+    14,
+    15,
+    16,
+    17,
+    18,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.any_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.api_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.duration_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.empty_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.field_mask_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.source_context_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.struct_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.timestamp_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.type_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.double_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.float_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.int64_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.uint64_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.int32_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.uint32_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.bool_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.string_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _impl_.bytes_field_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, _internal_metadata_),
+    ~0u,  // no _extensions_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, _impl_.oneof_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.any_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.api_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.duration_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.empty_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.field_mask_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.source_context_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.struct_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.timestamp_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.type_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.double_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.float_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.int64_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.uint64_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.int32_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.uint32_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.bool_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.string_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _impl_.bytes_field_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 27, -1, sizeof(::protobuf_unittest::TestWellKnownTypes)},
+        {46, -1, -1, sizeof(::protobuf_unittest::RepeatedWellKnownTypes)},
+        {72, -1, -1, sizeof(::protobuf_unittest::OneofWellKnownTypes)},
+        {99, 109, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse)},
+        {111, 121, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse)},
+        {123, 133, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse)},
+        {135, 145, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse)},
+        {147, 157, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse)},
+        {159, 169, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse)},
+        {171, 181, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse)},
+        {183, 193, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse)},
+        {195, 205, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse)},
+        {207, 217, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse)},
+        {219, 229, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse)},
+        {231, 241, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse)},
+        {243, 253, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse)},
+        {255, 265, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse)},
+        {267, 277, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse)},
+        {279, 289, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse)},
+        {291, 301, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse)},
+        {303, 313, -1, sizeof(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse)},
+        {315, -1, -1, sizeof(::protobuf_unittest::MapWellKnownTypes)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance,
+    &::protobuf_unittest::_RepeatedWellKnownTypes_default_instance_._instance,
+    &::protobuf_unittest::_OneofWellKnownTypes_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_MapWellKnownTypes_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n/google/protobuf/unittest_well_known_ty"
+    "pes.proto\022\021protobuf_unittest\032\031google/pro"
+    "tobuf/any.proto\032\031google/protobuf/api.pro"
+    "to\032\036google/protobuf/duration.proto\032\033goog"
+    "le/protobuf/empty.proto\032 google/protobuf"
+    "/field_mask.proto\032$google/protobuf/sourc"
+    "e_context.proto\032\034google/protobuf/struct."
+    "proto\032\037google/protobuf/timestamp.proto\032\032"
+    "google/protobuf/type.proto\032\036google/proto"
+    "buf/wrappers.proto\"\276\007\n\022TestWellKnownType"
+    "s\022\'\n\tany_field\030\001 \001(\0132\024.google.protobuf.A"
+    "ny\022\'\n\tapi_field\030\002 \001(\0132\024.google.protobuf."
+    "Api\0221\n\016duration_field\030\003 \001(\0132\031.google.pro"
+    "tobuf.Duration\022+\n\013empty_field\030\004 \001(\0132\026.go"
+    "ogle.protobuf.Empty\0224\n\020field_mask_field\030"
+    "\005 \001(\0132\032.google.protobuf.FieldMask\022<\n\024sou"
+    "rce_context_field\030\006 \001(\0132\036.google.protobu"
+    "f.SourceContext\022-\n\014struct_field\030\007 \001(\0132\027."
+    "google.protobuf.Struct\0223\n\017timestamp_fiel"
+    "d\030\010 \001(\0132\032.google.protobuf.Timestamp\022)\n\nt"
+    "ype_field\030\t \001(\0132\025.google.protobuf.Type\0222"
+    "\n\014double_field\030\n \001(\0132\034.google.protobuf.D"
+    "oubleValue\0220\n\013float_field\030\013 \001(\0132\033.google"
+    ".protobuf.FloatValue\0220\n\013int64_field\030\014 \001("
+    "\0132\033.google.protobuf.Int64Value\0222\n\014uint64"
+    "_field\030\r \001(\0132\034.google.protobuf.UInt64Val"
+    "ue\0220\n\013int32_field\030\016 \001(\0132\033.google.protobu"
+    "f.Int32Value\0222\n\014uint32_field\030\017 \001(\0132\034.goo"
+    "gle.protobuf.UInt32Value\022.\n\nbool_field\030\020"
+    " \001(\0132\032.google.protobuf.BoolValue\0222\n\014stri"
+    "ng_field\030\021 \001(\0132\034.google.protobuf.StringV"
+    "alue\0220\n\013bytes_field\030\022 \001(\0132\033.google.proto"
+    "buf.BytesValue\022+\n\013value_field\030\023 \001(\0132\026.go"
+    "ogle.protobuf.Value\"\225\007\n\026RepeatedWellKnow"
+    "nTypes\022\'\n\tany_field\030\001 \003(\0132\024.google.proto"
+    "buf.Any\022\'\n\tapi_field\030\002 \003(\0132\024.google.prot"
+    "obuf.Api\0221\n\016duration_field\030\003 \003(\0132\031.googl"
+    "e.protobuf.Duration\022+\n\013empty_field\030\004 \003(\013"
+    "2\026.google.protobuf.Empty\0224\n\020field_mask_f"
+    "ield\030\005 \003(\0132\032.google.protobuf.FieldMask\022<"
+    "\n\024source_context_field\030\006 \003(\0132\036.google.pr"
+    "otobuf.SourceContext\022-\n\014struct_field\030\007 \003"
+    "(\0132\027.google.protobuf.Struct\0223\n\017timestamp"
+    "_field\030\010 \003(\0132\032.google.protobuf.Timestamp"
+    "\022)\n\ntype_field\030\t \003(\0132\025.google.protobuf.T"
+    "ype\0222\n\014double_field\030\n \003(\0132\034.google.proto"
+    "buf.DoubleValue\0220\n\013float_field\030\013 \003(\0132\033.g"
+    "oogle.protobuf.FloatValue\0220\n\013int64_field"
+    "\030\014 \003(\0132\033.google.protobuf.Int64Value\0222\n\014u"
+    "int64_field\030\r \003(\0132\034.google.protobuf.UInt"
+    "64Value\0220\n\013int32_field\030\016 \003(\0132\033.google.pr"
+    "otobuf.Int32Value\0222\n\014uint32_field\030\017 \003(\0132"
+    "\034.google.protobuf.UInt32Value\022.\n\nbool_fi"
+    "eld\030\020 \003(\0132\032.google.protobuf.BoolValue\0222\n"
+    "\014string_field\030\021 \003(\0132\034.google.protobuf.St"
+    "ringValue\0220\n\013bytes_field\030\022 \003(\0132\033.google."
+    "protobuf.BytesValue\"\305\007\n\023OneofWellKnownTy"
+    "pes\022)\n\tany_field\030\001 \001(\0132\024.google.protobuf"
+    ".AnyH\000\022)\n\tapi_field\030\002 \001(\0132\024.google.proto"
+    "buf.ApiH\000\0223\n\016duration_field\030\003 \001(\0132\031.goog"
+    "le.protobuf.DurationH\000\022-\n\013empty_field\030\004 "
+    "\001(\0132\026.google.protobuf.EmptyH\000\0226\n\020field_m"
+    "ask_field\030\005 \001(\0132\032.google.protobuf.FieldM"
+    "askH\000\022>\n\024source_context_field\030\006 \001(\0132\036.go"
+    "ogle.protobuf.SourceContextH\000\022/\n\014struct_"
+    "field\030\007 \001(\0132\027.google.protobuf.StructH\000\0225"
+    "\n\017timestamp_field\030\010 \001(\0132\032.google.protobu"
+    "f.TimestampH\000\022+\n\ntype_field\030\t \001(\0132\025.goog"
+    "le.protobuf.TypeH\000\0224\n\014double_field\030\n \001(\013"
+    "2\034.google.protobuf.DoubleValueH\000\0222\n\013floa"
+    "t_field\030\013 \001(\0132\033.google.protobuf.FloatVal"
+    "ueH\000\0222\n\013int64_field\030\014 \001(\0132\033.google.proto"
+    "buf.Int64ValueH\000\0224\n\014uint64_field\030\r \001(\0132\034"
+    ".google.protobuf.UInt64ValueH\000\0222\n\013int32_"
+    "field\030\016 \001(\0132\033.google.protobuf.Int32Value"
+    "H\000\0224\n\014uint32_field\030\017 \001(\0132\034.google.protob"
+    "uf.UInt32ValueH\000\0220\n\nbool_field\030\020 \001(\0132\032.g"
+    "oogle.protobuf.BoolValueH\000\0224\n\014string_fie"
+    "ld\030\021 \001(\0132\034.google.protobuf.StringValueH\000"
+    "\0222\n\013bytes_field\030\022 \001(\0132\033.google.protobuf."
+    "BytesValueH\000B\r\n\013oneof_field\"\226\026\n\021MapWellK"
+    "nownTypes\022E\n\tany_field\030\001 \003(\01322.protobuf_"
+    "unittest.MapWellKnownTypes.AnyFieldEntry"
+    "\022E\n\tapi_field\030\002 \003(\01322.protobuf_unittest."
+    "MapWellKnownTypes.ApiFieldEntry\022O\n\016durat"
+    "ion_field\030\003 \003(\01327.protobuf_unittest.MapW"
+    "ellKnownTypes.DurationFieldEntry\022I\n\013empt"
+    "y_field\030\004 \003(\01324.protobuf_unittest.MapWel"
+    "lKnownTypes.EmptyFieldEntry\022R\n\020field_mas"
+    "k_field\030\005 \003(\01328.protobuf_unittest.MapWel"
+    "lKnownTypes.FieldMaskFieldEntry\022Z\n\024sourc"
+    "e_context_field\030\006 \003(\0132<.protobuf_unittes"
+    "t.MapWellKnownTypes.SourceContextFieldEn"
+    "try\022K\n\014struct_field\030\007 \003(\01325.protobuf_uni"
+    "ttest.MapWellKnownTypes.StructFieldEntry"
+    "\022Q\n\017timestamp_field\030\010 \003(\01328.protobuf_uni"
+    "ttest.MapWellKnownTypes.TimestampFieldEn"
+    "try\022G\n\ntype_field\030\t \003(\01323.protobuf_unitt"
+    "est.MapWellKnownTypes.TypeFieldEntry\022K\n\014"
+    "double_field\030\n \003(\01325.protobuf_unittest.M"
+    "apWellKnownTypes.DoubleFieldEntry\022I\n\013flo"
+    "at_field\030\013 \003(\01324.protobuf_unittest.MapWe"
+    "llKnownTypes.FloatFieldEntry\022I\n\013int64_fi"
+    "eld\030\014 \003(\01324.protobuf_unittest.MapWellKno"
+    "wnTypes.Int64FieldEntry\022K\n\014uint64_field\030"
+    "\r \003(\01325.protobuf_unittest.MapWellKnownTy"
+    "pes.Uint64FieldEntry\022I\n\013int32_field\030\016 \003("
+    "\01324.protobuf_unittest.MapWellKnownTypes."
+    "Int32FieldEntry\022K\n\014uint32_field\030\017 \003(\01325."
+    "protobuf_unittest.MapWellKnownTypes.Uint"
+    "32FieldEntry\022G\n\nbool_field\030\020 \003(\01323.proto"
+    "buf_unittest.MapWellKnownTypes.BoolField"
+    "Entry\022K\n\014string_field\030\021 \003(\01325.protobuf_u"
+    "nittest.MapWellKnownTypes.StringFieldEnt"
+    "ry\022I\n\013bytes_field\030\022 \003(\01324.protobuf_unitt"
+    "est.MapWellKnownTypes.BytesFieldEntry\032E\n"
+    "\rAnyFieldEntry\022\013\n\003key\030\001 \001(\005\022#\n\005value\030\002 \001"
+    "(\0132\024.google.protobuf.Any:\0028\001\032E\n\rApiField"
+    "Entry\022\013\n\003key\030\001 \001(\005\022#\n\005value\030\002 \001(\0132\024.goog"
+    "le.protobuf.Api:\0028\001\032O\n\022DurationFieldEntr"
+    "y\022\013\n\003key\030\001 \001(\005\022(\n\005value\030\002 \001(\0132\031.google.p"
+    "rotobuf.Duration:\0028\001\032I\n\017EmptyFieldEntry\022"
+    "\013\n\003key\030\001 \001(\005\022%\n\005value\030\002 \001(\0132\026.google.pro"
+    "tobuf.Empty:\0028\001\032Q\n\023FieldMaskFieldEntry\022\013"
+    "\n\003key\030\001 \001(\005\022)\n\005value\030\002 \001(\0132\032.google.prot"
+    "obuf.FieldMask:\0028\001\032Y\n\027SourceContextField"
+    "Entry\022\013\n\003key\030\001 \001(\005\022-\n\005value\030\002 \001(\0132\036.goog"
+    "le.protobuf.SourceContext:\0028\001\032K\n\020StructF"
+    "ieldEntry\022\013\n\003key\030\001 \001(\005\022&\n\005value\030\002 \001(\0132\027."
+    "google.protobuf.Struct:\0028\001\032Q\n\023TimestampF"
+    "ieldEntry\022\013\n\003key\030\001 \001(\005\022)\n\005value\030\002 \001(\0132\032."
+    "google.protobuf.Timestamp:\0028\001\032G\n\016TypeFie"
+    "ldEntry\022\013\n\003key\030\001 \001(\005\022$\n\005value\030\002 \001(\0132\025.go"
+    "ogle.protobuf.Type:\0028\001\032P\n\020DoubleFieldEnt"
+    "ry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.google."
+    "protobuf.DoubleValue:\0028\001\032N\n\017FloatFieldEn"
+    "try\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.google"
+    ".protobuf.FloatValue:\0028\001\032N\n\017Int64FieldEn"
+    "try\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.google"
+    ".protobuf.Int64Value:\0028\001\032P\n\020Uint64FieldE"
+    "ntry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.googl"
+    "e.protobuf.UInt64Value:\0028\001\032N\n\017Int32Field"
+    "Entry\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.goog"
+    "le.protobuf.Int32Value:\0028\001\032P\n\020Uint32Fiel"
+    "dEntry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.goo"
+    "gle.protobuf.UInt32Value:\0028\001\032L\n\016BoolFiel"
+    "dEntry\022\013\n\003key\030\001 \001(\005\022)\n\005value\030\002 \001(\0132\032.goo"
+    "gle.protobuf.BoolValue:\0028\001\032P\n\020StringFiel"
+    "dEntry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.goo"
+    "gle.protobuf.StringValue:\0028\001\032N\n\017BytesFie"
+    "ldEntry\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.go"
+    "ogle.protobuf.BytesValue:\0028\001B9\n\030com.goog"
+    "le.protobuf.testP\001\252\002\032Google.Protobuf.Tes"
+    "tProtosb\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_deps[10] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fapi_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fduration_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
+        &::descriptor_table_google_2fprotobuf_2ffield_5fmask_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fsource_5fcontext_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+        &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+        &::descriptor_table_google_2fprotobuf_2ftype_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = {
+    false,
+    false,
+    6135,
+    descriptor_table_protodef_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto,
+    "google/protobuf/unittest_well_known_types.proto",
+    &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+    descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_deps,
+    10,
+    22,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto(&descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto);
+namespace protobuf_unittest {
+// ===================================================================
+
+class TestWellKnownTypes::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestWellKnownTypes>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_._has_bits_);
+  static const ::google::protobuf::Any& any_field(const TestWellKnownTypes* msg);
+  static void set_has_any_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::google::protobuf::Api& api_field(const TestWellKnownTypes* msg);
+  static void set_has_api_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::google::protobuf::Duration& duration_field(const TestWellKnownTypes* msg);
+  static void set_has_duration_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::google::protobuf::Empty& empty_field(const TestWellKnownTypes* msg);
+  static void set_has_empty_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::google::protobuf::FieldMask& field_mask_field(const TestWellKnownTypes* msg);
+  static void set_has_field_mask_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::google::protobuf::SourceContext& source_context_field(const TestWellKnownTypes* msg);
+  static void set_has_source_context_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::google::protobuf::Struct& struct_field(const TestWellKnownTypes* msg);
+  static void set_has_struct_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::google::protobuf::Timestamp& timestamp_field(const TestWellKnownTypes* msg);
+  static void set_has_timestamp_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::google::protobuf::Type& type_field(const TestWellKnownTypes* msg);
+  static void set_has_type_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::google::protobuf::DoubleValue& double_field(const TestWellKnownTypes* msg);
+  static void set_has_double_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::google::protobuf::FloatValue& float_field(const TestWellKnownTypes* msg);
+  static void set_has_float_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::google::protobuf::Int64Value& int64_field(const TestWellKnownTypes* msg);
+  static void set_has_int64_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::google::protobuf::UInt64Value& uint64_field(const TestWellKnownTypes* msg);
+  static void set_has_uint64_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::google::protobuf::Int32Value& int32_field(const TestWellKnownTypes* msg);
+  static void set_has_int32_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::google::protobuf::UInt32Value& uint32_field(const TestWellKnownTypes* msg);
+  static void set_has_uint32_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static const ::google::protobuf::BoolValue& bool_field(const TestWellKnownTypes* msg);
+  static void set_has_bool_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static const ::google::protobuf::StringValue& string_field(const TestWellKnownTypes* msg);
+  static void set_has_string_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static const ::google::protobuf::BytesValue& bytes_field(const TestWellKnownTypes* msg);
+  static void set_has_bytes_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static const ::google::protobuf::Value& value_field(const TestWellKnownTypes* msg);
+  static void set_has_value_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+};
+
+const ::google::protobuf::Any& TestWellKnownTypes::_Internal::any_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.any_field_;
+}
+const ::google::protobuf::Api& TestWellKnownTypes::_Internal::api_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.api_field_;
+}
+const ::google::protobuf::Duration& TestWellKnownTypes::_Internal::duration_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.duration_field_;
+}
+const ::google::protobuf::Empty& TestWellKnownTypes::_Internal::empty_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.empty_field_;
+}
+const ::google::protobuf::FieldMask& TestWellKnownTypes::_Internal::field_mask_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.field_mask_field_;
+}
+const ::google::protobuf::SourceContext& TestWellKnownTypes::_Internal::source_context_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.source_context_field_;
+}
+const ::google::protobuf::Struct& TestWellKnownTypes::_Internal::struct_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.struct_field_;
+}
+const ::google::protobuf::Timestamp& TestWellKnownTypes::_Internal::timestamp_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.timestamp_field_;
+}
+const ::google::protobuf::Type& TestWellKnownTypes::_Internal::type_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.type_field_;
+}
+const ::google::protobuf::DoubleValue& TestWellKnownTypes::_Internal::double_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.double_field_;
+}
+const ::google::protobuf::FloatValue& TestWellKnownTypes::_Internal::float_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.float_field_;
+}
+const ::google::protobuf::Int64Value& TestWellKnownTypes::_Internal::int64_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.int64_field_;
+}
+const ::google::protobuf::UInt64Value& TestWellKnownTypes::_Internal::uint64_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.uint64_field_;
+}
+const ::google::protobuf::Int32Value& TestWellKnownTypes::_Internal::int32_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.int32_field_;
+}
+const ::google::protobuf::UInt32Value& TestWellKnownTypes::_Internal::uint32_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.uint32_field_;
+}
+const ::google::protobuf::BoolValue& TestWellKnownTypes::_Internal::bool_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.bool_field_;
+}
+const ::google::protobuf::StringValue& TestWellKnownTypes::_Internal::string_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.string_field_;
+}
+const ::google::protobuf::BytesValue& TestWellKnownTypes::_Internal::bytes_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.bytes_field_;
+}
+const ::google::protobuf::Value& TestWellKnownTypes::_Internal::value_field(const TestWellKnownTypes* msg) {
+  return *msg->_impl_.value_field_;
+}
+void TestWellKnownTypes::clear_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.any_field_ != nullptr) _impl_.any_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestWellKnownTypes::clear_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.api_field_ != nullptr) _impl_.api_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+void TestWellKnownTypes::clear_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.duration_field_ != nullptr) _impl_.duration_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+void TestWellKnownTypes::clear_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_field_ != nullptr) _impl_.empty_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+void TestWellKnownTypes::clear_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.field_mask_field_ != nullptr) _impl_.field_mask_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+void TestWellKnownTypes::clear_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.source_context_field_ != nullptr) _impl_.source_context_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+void TestWellKnownTypes::clear_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.struct_field_ != nullptr) _impl_.struct_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+void TestWellKnownTypes::clear_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.timestamp_field_ != nullptr) _impl_.timestamp_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+void TestWellKnownTypes::clear_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.type_field_ != nullptr) _impl_.type_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+void TestWellKnownTypes::clear_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.double_field_ != nullptr) _impl_.double_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+void TestWellKnownTypes::clear_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.float_field_ != nullptr) _impl_.float_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+void TestWellKnownTypes::clear_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.int64_field_ != nullptr) _impl_.int64_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+void TestWellKnownTypes::clear_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.uint64_field_ != nullptr) _impl_.uint64_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+void TestWellKnownTypes::clear_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.int32_field_ != nullptr) _impl_.int32_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+void TestWellKnownTypes::clear_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.uint32_field_ != nullptr) _impl_.uint32_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+void TestWellKnownTypes::clear_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.bool_field_ != nullptr) _impl_.bool_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+void TestWellKnownTypes::clear_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.string_field_ != nullptr) _impl_.string_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+void TestWellKnownTypes::clear_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.bytes_field_ != nullptr) _impl_.bytes_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+void TestWellKnownTypes::clear_value_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_field_ != nullptr) _impl_.value_field_->Clear();
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+TestWellKnownTypes::TestWellKnownTypes(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE TestWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestWellKnownTypes::TestWellKnownTypes(
+    ::google::protobuf::Arena* arena,
+    const TestWellKnownTypes& from)
+    : ::google::protobuf::Message(arena) {
+  TestWellKnownTypes* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.any_field_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Any>(arena, *from._impl_.any_field_)
+                : nullptr;
+  _impl_.api_field_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::google::protobuf::Api>(arena, *from._impl_.api_field_)
+                : nullptr;
+  _impl_.duration_field_ = (cached_has_bits & 0x00000004u)
+                ? CreateMaybeMessage<::google::protobuf::Duration>(arena, *from._impl_.duration_field_)
+                : nullptr;
+  _impl_.empty_field_ = (cached_has_bits & 0x00000008u)
+                ? CreateMaybeMessage<::google::protobuf::Empty>(arena, *from._impl_.empty_field_)
+                : nullptr;
+  _impl_.field_mask_field_ = (cached_has_bits & 0x00000010u)
+                ? CreateMaybeMessage<::google::protobuf::FieldMask>(arena, *from._impl_.field_mask_field_)
+                : nullptr;
+  _impl_.source_context_field_ = (cached_has_bits & 0x00000020u)
+                ? CreateMaybeMessage<::google::protobuf::SourceContext>(arena, *from._impl_.source_context_field_)
+                : nullptr;
+  _impl_.struct_field_ = (cached_has_bits & 0x00000040u)
+                ? CreateMaybeMessage<::google::protobuf::Struct>(arena, *from._impl_.struct_field_)
+                : nullptr;
+  _impl_.timestamp_field_ = (cached_has_bits & 0x00000080u)
+                ? CreateMaybeMessage<::google::protobuf::Timestamp>(arena, *from._impl_.timestamp_field_)
+                : nullptr;
+  _impl_.type_field_ = (cached_has_bits & 0x00000100u)
+                ? CreateMaybeMessage<::google::protobuf::Type>(arena, *from._impl_.type_field_)
+                : nullptr;
+  _impl_.double_field_ = (cached_has_bits & 0x00000200u)
+                ? CreateMaybeMessage<::google::protobuf::DoubleValue>(arena, *from._impl_.double_field_)
+                : nullptr;
+  _impl_.float_field_ = (cached_has_bits & 0x00000400u)
+                ? CreateMaybeMessage<::google::protobuf::FloatValue>(arena, *from._impl_.float_field_)
+                : nullptr;
+  _impl_.int64_field_ = (cached_has_bits & 0x00000800u)
+                ? CreateMaybeMessage<::google::protobuf::Int64Value>(arena, *from._impl_.int64_field_)
+                : nullptr;
+  _impl_.uint64_field_ = (cached_has_bits & 0x00001000u)
+                ? CreateMaybeMessage<::google::protobuf::UInt64Value>(arena, *from._impl_.uint64_field_)
+                : nullptr;
+  _impl_.int32_field_ = (cached_has_bits & 0x00002000u)
+                ? CreateMaybeMessage<::google::protobuf::Int32Value>(arena, *from._impl_.int32_field_)
+                : nullptr;
+  _impl_.uint32_field_ = (cached_has_bits & 0x00004000u)
+                ? CreateMaybeMessage<::google::protobuf::UInt32Value>(arena, *from._impl_.uint32_field_)
+                : nullptr;
+  _impl_.bool_field_ = (cached_has_bits & 0x00008000u)
+                ? CreateMaybeMessage<::google::protobuf::BoolValue>(arena, *from._impl_.bool_field_)
+                : nullptr;
+  _impl_.string_field_ = (cached_has_bits & 0x00010000u)
+                ? CreateMaybeMessage<::google::protobuf::StringValue>(arena, *from._impl_.string_field_)
+                : nullptr;
+  _impl_.bytes_field_ = (cached_has_bits & 0x00020000u)
+                ? CreateMaybeMessage<::google::protobuf::BytesValue>(arena, *from._impl_.bytes_field_)
+                : nullptr;
+  _impl_.value_field_ = (cached_has_bits & 0x00040000u)
+                ? CreateMaybeMessage<::google::protobuf::Value>(arena, *from._impl_.value_field_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE TestWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestWellKnownTypes::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, any_field_),
+           0,
+           offsetof(Impl_, value_field_) -
+               offsetof(Impl_, any_field_) +
+               sizeof(Impl_::value_field_));
+}
+TestWellKnownTypes::~TestWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestWellKnownTypes)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestWellKnownTypes::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.any_field_;
+  delete _impl_.api_field_;
+  delete _impl_.duration_field_;
+  delete _impl_.empty_field_;
+  delete _impl_.field_mask_field_;
+  delete _impl_.source_context_field_;
+  delete _impl_.struct_field_;
+  delete _impl_.timestamp_field_;
+  delete _impl_.type_field_;
+  delete _impl_.double_field_;
+  delete _impl_.float_field_;
+  delete _impl_.int64_field_;
+  delete _impl_.uint64_field_;
+  delete _impl_.int32_field_;
+  delete _impl_.uint32_field_;
+  delete _impl_.bool_field_;
+  delete _impl_.string_field_;
+  delete _impl_.bytes_field_;
+  delete _impl_.value_field_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestWellKnownTypes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.any_field_ != nullptr);
+      _impl_.any_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.api_field_ != nullptr);
+      _impl_.api_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      ABSL_DCHECK(_impl_.duration_field_ != nullptr);
+      _impl_.duration_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      ABSL_DCHECK(_impl_.empty_field_ != nullptr);
+      _impl_.empty_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      ABSL_DCHECK(_impl_.field_mask_field_ != nullptr);
+      _impl_.field_mask_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      ABSL_DCHECK(_impl_.source_context_field_ != nullptr);
+      _impl_.source_context_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      ABSL_DCHECK(_impl_.struct_field_ != nullptr);
+      _impl_.struct_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      ABSL_DCHECK(_impl_.timestamp_field_ != nullptr);
+      _impl_.timestamp_field_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      ABSL_DCHECK(_impl_.type_field_ != nullptr);
+      _impl_.type_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      ABSL_DCHECK(_impl_.double_field_ != nullptr);
+      _impl_.double_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      ABSL_DCHECK(_impl_.float_field_ != nullptr);
+      _impl_.float_field_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      ABSL_DCHECK(_impl_.int64_field_ != nullptr);
+      _impl_.int64_field_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      ABSL_DCHECK(_impl_.uint64_field_ != nullptr);
+      _impl_.uint64_field_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      ABSL_DCHECK(_impl_.int32_field_ != nullptr);
+      _impl_.int32_field_->Clear();
+    }
+    if (cached_has_bits & 0x00004000u) {
+      ABSL_DCHECK(_impl_.uint32_field_ != nullptr);
+      _impl_.uint32_field_->Clear();
+    }
+    if (cached_has_bits & 0x00008000u) {
+      ABSL_DCHECK(_impl_.bool_field_ != nullptr);
+      _impl_.bool_field_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00070000u) {
+    if (cached_has_bits & 0x00010000u) {
+      ABSL_DCHECK(_impl_.string_field_ != nullptr);
+      _impl_.string_field_->Clear();
+    }
+    if (cached_has_bits & 0x00020000u) {
+      ABSL_DCHECK(_impl_.bytes_field_ != nullptr);
+      _impl_.bytes_field_->Clear();
+    }
+    if (cached_has_bits & 0x00040000u) {
+      ABSL_DCHECK(_impl_.value_field_ != nullptr);
+      _impl_.value_field_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestWellKnownTypes::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<5, 19, 19, 0, 2> TestWellKnownTypes::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_._has_bits_),
+    0, // no _extensions_
+    19, 248,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294443008,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    19,  // num_field_entries
+    19,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestWellKnownTypes_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .google.protobuf.Any any_field = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.any_field_)}},
+    // .google.protobuf.Api api_field = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.api_field_)}},
+    // .google.protobuf.Duration duration_field = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 2, 2, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.duration_field_)}},
+    // .google.protobuf.Empty empty_field = 4;
+    {::_pbi::TcParser::FastMdS1,
+     {34, 3, 3, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.empty_field_)}},
+    // .google.protobuf.FieldMask field_mask_field = 5;
+    {::_pbi::TcParser::FastMtS1,
+     {42, 4, 4, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.field_mask_field_)}},
+    // .google.protobuf.SourceContext source_context_field = 6;
+    {::_pbi::TcParser::FastMtS1,
+     {50, 5, 5, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.source_context_field_)}},
+    // .google.protobuf.Struct struct_field = 7;
+    {::_pbi::TcParser::FastMtS1,
+     {58, 6, 6, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.struct_field_)}},
+    // .google.protobuf.Timestamp timestamp_field = 8;
+    {::_pbi::TcParser::FastMtS1,
+     {66, 7, 7, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.timestamp_field_)}},
+    // .google.protobuf.Type type_field = 9;
+    {::_pbi::TcParser::FastMtS1,
+     {74, 8, 8, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.type_field_)}},
+    // .google.protobuf.DoubleValue double_field = 10;
+    {::_pbi::TcParser::FastMtS1,
+     {82, 9, 9, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.double_field_)}},
+    // .google.protobuf.FloatValue float_field = 11;
+    {::_pbi::TcParser::FastMtS1,
+     {90, 10, 10, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.float_field_)}},
+    // .google.protobuf.Int64Value int64_field = 12;
+    {::_pbi::TcParser::FastMtS1,
+     {98, 11, 11, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.int64_field_)}},
+    // .google.protobuf.UInt64Value uint64_field = 13;
+    {::_pbi::TcParser::FastMtS1,
+     {106, 12, 12, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.uint64_field_)}},
+    // .google.protobuf.Int32Value int32_field = 14;
+    {::_pbi::TcParser::FastMtS1,
+     {114, 13, 13, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.int32_field_)}},
+    // .google.protobuf.UInt32Value uint32_field = 15;
+    {::_pbi::TcParser::FastMtS1,
+     {122, 14, 14, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.uint32_field_)}},
+    // .google.protobuf.BoolValue bool_field = 16;
+    {::_pbi::TcParser::FastMtS2,
+     {386, 15, 15, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.bool_field_)}},
+    // .google.protobuf.StringValue string_field = 17;
+    {::_pbi::TcParser::FastMtS2,
+     {394, 16, 16, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.string_field_)}},
+    // .google.protobuf.BytesValue bytes_field = 18;
+    {::_pbi::TcParser::FastMtS2,
+     {402, 17, 17, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.bytes_field_)}},
+    // .google.protobuf.Value value_field = 19;
+    {::_pbi::TcParser::FastMtS2,
+     {410, 18, 18, PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.value_field_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Any any_field = 1;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.any_field_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Api api_field = 2;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.api_field_), _Internal::kHasBitsOffset + 1, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Duration duration_field = 3;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.duration_field_), _Internal::kHasBitsOffset + 2, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Empty empty_field = 4;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.empty_field_), _Internal::kHasBitsOffset + 3, 3,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvDefault)},
+    // .google.protobuf.FieldMask field_mask_field = 5;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.field_mask_field_), _Internal::kHasBitsOffset + 4, 4,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.SourceContext source_context_field = 6;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.source_context_field_), _Internal::kHasBitsOffset + 5, 5,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Struct struct_field = 7;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.struct_field_), _Internal::kHasBitsOffset + 6, 6,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Timestamp timestamp_field = 8;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.timestamp_field_), _Internal::kHasBitsOffset + 7, 7,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Type type_field = 9;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.type_field_), _Internal::kHasBitsOffset + 8, 8,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.DoubleValue double_field = 10;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.double_field_), _Internal::kHasBitsOffset + 9, 9,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.FloatValue float_field = 11;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.float_field_), _Internal::kHasBitsOffset + 10, 10,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Int64Value int64_field = 12;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.int64_field_), _Internal::kHasBitsOffset + 11, 11,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.UInt64Value uint64_field = 13;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.uint64_field_), _Internal::kHasBitsOffset + 12, 12,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Int32Value int32_field = 14;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.int32_field_), _Internal::kHasBitsOffset + 13, 13,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.UInt32Value uint32_field = 15;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.uint32_field_), _Internal::kHasBitsOffset + 14, 14,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.BoolValue bool_field = 16;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.bool_field_), _Internal::kHasBitsOffset + 15, 15,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.StringValue string_field = 17;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.string_field_), _Internal::kHasBitsOffset + 16, 16,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.BytesValue bytes_field = 18;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.bytes_field_), _Internal::kHasBitsOffset + 17, 17,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Value value_field = 19;
+    {PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.value_field_), _Internal::kHasBitsOffset + 18, 18,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Api>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Duration>()},
+    {::_pbi::FieldAuxDefaultMessage{}, &::google::protobuf::_Empty_default_instance_},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FieldMask>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::SourceContext>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Struct>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Timestamp>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Type>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::DoubleValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FloatValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BoolValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::StringValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BytesValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Value>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestWellKnownTypes::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestWellKnownTypes)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Any any_field = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::any_field(this),
+        _Internal::any_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Api api_field = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::api_field(this),
+        _Internal::api_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Duration duration_field = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::duration_field(this),
+        _Internal::duration_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Empty empty_field = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        4, _Internal::empty_field(this),
+        _Internal::empty_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        5, _Internal::field_mask_field(this),
+        _Internal::field_mask_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.SourceContext source_context_field = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        6, _Internal::source_context_field(this),
+        _Internal::source_context_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Struct struct_field = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        7, _Internal::struct_field(this),
+        _Internal::struct_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        8, _Internal::timestamp_field(this),
+        _Internal::timestamp_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Type type_field = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        9, _Internal::type_field(this),
+        _Internal::type_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.DoubleValue double_field = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        10, _Internal::double_field(this),
+        _Internal::double_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.FloatValue float_field = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        11, _Internal::float_field(this),
+        _Internal::float_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Int64Value int64_field = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        12, _Internal::int64_field(this),
+        _Internal::int64_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        13, _Internal::uint64_field(this),
+        _Internal::uint64_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Int32Value int32_field = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        14, _Internal::int32_field(this),
+        _Internal::int32_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        15, _Internal::uint32_field(this),
+        _Internal::uint32_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.BoolValue bool_field = 16;
+  if (cached_has_bits & 0x00008000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        16, _Internal::bool_field(this),
+        _Internal::bool_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.StringValue string_field = 17;
+  if (cached_has_bits & 0x00010000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        17, _Internal::string_field(this),
+        _Internal::string_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.BytesValue bytes_field = 18;
+  if (cached_has_bits & 0x00020000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        18, _Internal::bytes_field(this),
+        _Internal::bytes_field(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Value value_field = 19;
+  if (cached_has_bits & 0x00040000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        19, _Internal::value_field(this),
+        _Internal::value_field(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestWellKnownTypes)
+  return target;
+}
+
+::size_t TestWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestWellKnownTypes)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // .google.protobuf.Any any_field = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.any_field_);
+    }
+
+    // .google.protobuf.Api api_field = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.api_field_);
+    }
+
+    // .google.protobuf.Duration duration_field = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.duration_field_);
+    }
+
+    // .google.protobuf.Empty empty_field = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_field_);
+    }
+
+    // .google.protobuf.FieldMask field_mask_field = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.field_mask_field_);
+    }
+
+    // .google.protobuf.SourceContext source_context_field = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.source_context_field_);
+    }
+
+    // .google.protobuf.Struct struct_field = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.struct_field_);
+    }
+
+    // .google.protobuf.Timestamp timestamp_field = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.timestamp_field_);
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // .google.protobuf.Type type_field = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.type_field_);
+    }
+
+    // .google.protobuf.DoubleValue double_field = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.double_field_);
+    }
+
+    // .google.protobuf.FloatValue float_field = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.float_field_);
+    }
+
+    // .google.protobuf.Int64Value int64_field = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.int64_field_);
+    }
+
+    // .google.protobuf.UInt64Value uint64_field = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.uint64_field_);
+    }
+
+    // .google.protobuf.Int32Value int32_field = 14;
+    if (cached_has_bits & 0x00002000u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.int32_field_);
+    }
+
+    // .google.protobuf.UInt32Value uint32_field = 15;
+    if (cached_has_bits & 0x00004000u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.uint32_field_);
+    }
+
+    // .google.protobuf.BoolValue bool_field = 16;
+    if (cached_has_bits & 0x00008000u) {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.bool_field_);
+    }
+
+  }
+  if (cached_has_bits & 0x00070000u) {
+    // .google.protobuf.StringValue string_field = 17;
+    if (cached_has_bits & 0x00010000u) {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.string_field_);
+    }
+
+    // .google.protobuf.BytesValue bytes_field = 18;
+    if (cached_has_bits & 0x00020000u) {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.bytes_field_);
+    }
+
+    // .google.protobuf.Value value_field = 19;
+    if (cached_has_bits & 0x00040000u) {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_field_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestWellKnownTypes::_class_data_ = {
+    TestWellKnownTypes::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestWellKnownTypes::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestWellKnownTypes::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestWellKnownTypes*>(&to_msg);
+  auto& from = static_cast<const TestWellKnownTypes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestWellKnownTypes)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_any_field()->::google::protobuf::Any::MergeFrom(
+          from._internal_any_field());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_api_field()->::google::protobuf::Api::MergeFrom(
+          from._internal_api_field());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_duration_field()->::google::protobuf::Duration::MergeFrom(
+          from._internal_duration_field());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_empty_field()->::google::protobuf::Empty::MergeFrom(
+          from._internal_empty_field());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_field_mask_field()->::google::protobuf::FieldMask::MergeFrom(
+          from._internal_field_mask_field());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_source_context_field()->::google::protobuf::SourceContext::MergeFrom(
+          from._internal_source_context_field());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_struct_field()->::google::protobuf::Struct::MergeFrom(
+          from._internal_struct_field());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_timestamp_field()->::google::protobuf::Timestamp::MergeFrom(
+          from._internal_timestamp_field());
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_type_field()->::google::protobuf::Type::MergeFrom(
+          from._internal_type_field());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_double_field()->::google::protobuf::DoubleValue::MergeFrom(
+          from._internal_double_field());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_float_field()->::google::protobuf::FloatValue::MergeFrom(
+          from._internal_float_field());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_int64_field()->::google::protobuf::Int64Value::MergeFrom(
+          from._internal_int64_field());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_internal_mutable_uint64_field()->::google::protobuf::UInt64Value::MergeFrom(
+          from._internal_uint64_field());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_internal_mutable_int32_field()->::google::protobuf::Int32Value::MergeFrom(
+          from._internal_int32_field());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_internal_mutable_uint32_field()->::google::protobuf::UInt32Value::MergeFrom(
+          from._internal_uint32_field());
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_internal_mutable_bool_field()->::google::protobuf::BoolValue::MergeFrom(
+          from._internal_bool_field());
+    }
+  }
+  if (cached_has_bits & 0x00070000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_internal_mutable_string_field()->::google::protobuf::StringValue::MergeFrom(
+          from._internal_string_field());
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_internal_mutable_bytes_field()->::google::protobuf::BytesValue::MergeFrom(
+          from._internal_bytes_field());
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_internal_mutable_value_field()->::google::protobuf::Value::MergeFrom(
+          from._internal_value_field());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestWellKnownTypes::CopyFrom(const TestWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestWellKnownTypes::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestWellKnownTypes::InternalSwap(TestWellKnownTypes* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.value_field_)
+      + sizeof(TestWellKnownTypes::_impl_.value_field_)
+      - PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, _impl_.any_field_)>(
+          reinterpret_cast<char*>(&_impl_.any_field_),
+          reinterpret_cast<char*>(&other->_impl_.any_field_));
+}
+
+::google::protobuf::Metadata TestWellKnownTypes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[0]);
+}
+// ===================================================================
+
+class RepeatedWellKnownTypes::_Internal {
+ public:
+};
+
+void RepeatedWellKnownTypes::clear_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.any_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.api_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.duration_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.empty_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.field_mask_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.source_context_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.struct_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.timestamp_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.type_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.double_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.float_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int64_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint64_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int32_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint32_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bytes_field_.Clear();
+}
+RepeatedWellKnownTypes::RepeatedWellKnownTypes(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.RepeatedWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE RepeatedWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : any_field_{visibility, arena, from.any_field_},
+        api_field_{visibility, arena, from.api_field_},
+        duration_field_{visibility, arena, from.duration_field_},
+        empty_field_{visibility, arena, from.empty_field_},
+        field_mask_field_{visibility, arena, from.field_mask_field_},
+        source_context_field_{visibility, arena, from.source_context_field_},
+        struct_field_{visibility, arena, from.struct_field_},
+        timestamp_field_{visibility, arena, from.timestamp_field_},
+        type_field_{visibility, arena, from.type_field_},
+        double_field_{visibility, arena, from.double_field_},
+        float_field_{visibility, arena, from.float_field_},
+        int64_field_{visibility, arena, from.int64_field_},
+        uint64_field_{visibility, arena, from.uint64_field_},
+        int32_field_{visibility, arena, from.int32_field_},
+        uint32_field_{visibility, arena, from.uint32_field_},
+        bool_field_{visibility, arena, from.bool_field_},
+        string_field_{visibility, arena, from.string_field_},
+        bytes_field_{visibility, arena, from.bytes_field_},
+        _cached_size_{0} {}
+
+RepeatedWellKnownTypes::RepeatedWellKnownTypes(
+    ::google::protobuf::Arena* arena,
+    const RepeatedWellKnownTypes& from)
+    : ::google::protobuf::Message(arena) {
+  RepeatedWellKnownTypes* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.RepeatedWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE RepeatedWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : any_field_{visibility, arena},
+        api_field_{visibility, arena},
+        duration_field_{visibility, arena},
+        empty_field_{visibility, arena},
+        field_mask_field_{visibility, arena},
+        source_context_field_{visibility, arena},
+        struct_field_{visibility, arena},
+        timestamp_field_{visibility, arena},
+        type_field_{visibility, arena},
+        double_field_{visibility, arena},
+        float_field_{visibility, arena},
+        int64_field_{visibility, arena},
+        uint64_field_{visibility, arena},
+        int32_field_{visibility, arena},
+        uint32_field_{visibility, arena},
+        bool_field_{visibility, arena},
+        string_field_{visibility, arena},
+        bytes_field_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void RepeatedWellKnownTypes::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+RepeatedWellKnownTypes::~RepeatedWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.RepeatedWellKnownTypes)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void RepeatedWellKnownTypes::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void RepeatedWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.RepeatedWellKnownTypes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.any_field_.Clear();
+  _impl_.api_field_.Clear();
+  _impl_.duration_field_.Clear();
+  _impl_.empty_field_.Clear();
+  _impl_.field_mask_field_.Clear();
+  _impl_.source_context_field_.Clear();
+  _impl_.struct_field_.Clear();
+  _impl_.timestamp_field_.Clear();
+  _impl_.type_field_.Clear();
+  _impl_.double_field_.Clear();
+  _impl_.float_field_.Clear();
+  _impl_.int64_field_.Clear();
+  _impl_.uint64_field_.Clear();
+  _impl_.int32_field_.Clear();
+  _impl_.uint32_field_.Clear();
+  _impl_.bool_field_.Clear();
+  _impl_.string_field_.Clear();
+  _impl_.bytes_field_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* RepeatedWellKnownTypes::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<5, 18, 18, 0, 2> RepeatedWellKnownTypes::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    18, 248,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294705152,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    18,  // num_field_entries
+    18,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_RepeatedWellKnownTypes_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // repeated .google.protobuf.Any any_field = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.any_field_)}},
+    // repeated .google.protobuf.Api api_field = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.api_field_)}},
+    // repeated .google.protobuf.Duration duration_field = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 63, 2, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.duration_field_)}},
+    // repeated .google.protobuf.Empty empty_field = 4;
+    {::_pbi::TcParser::FastMdR1,
+     {34, 63, 3, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.empty_field_)}},
+    // repeated .google.protobuf.FieldMask field_mask_field = 5;
+    {::_pbi::TcParser::FastMtR1,
+     {42, 63, 4, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.field_mask_field_)}},
+    // repeated .google.protobuf.SourceContext source_context_field = 6;
+    {::_pbi::TcParser::FastMtR1,
+     {50, 63, 5, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.source_context_field_)}},
+    // repeated .google.protobuf.Struct struct_field = 7;
+    {::_pbi::TcParser::FastMtR1,
+     {58, 63, 6, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.struct_field_)}},
+    // repeated .google.protobuf.Timestamp timestamp_field = 8;
+    {::_pbi::TcParser::FastMtR1,
+     {66, 63, 7, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.timestamp_field_)}},
+    // repeated .google.protobuf.Type type_field = 9;
+    {::_pbi::TcParser::FastMtR1,
+     {74, 63, 8, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.type_field_)}},
+    // repeated .google.protobuf.DoubleValue double_field = 10;
+    {::_pbi::TcParser::FastMtR1,
+     {82, 63, 9, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.double_field_)}},
+    // repeated .google.protobuf.FloatValue float_field = 11;
+    {::_pbi::TcParser::FastMtR1,
+     {90, 63, 10, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.float_field_)}},
+    // repeated .google.protobuf.Int64Value int64_field = 12;
+    {::_pbi::TcParser::FastMtR1,
+     {98, 63, 11, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.int64_field_)}},
+    // repeated .google.protobuf.UInt64Value uint64_field = 13;
+    {::_pbi::TcParser::FastMtR1,
+     {106, 63, 12, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.uint64_field_)}},
+    // repeated .google.protobuf.Int32Value int32_field = 14;
+    {::_pbi::TcParser::FastMtR1,
+     {114, 63, 13, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.int32_field_)}},
+    // repeated .google.protobuf.UInt32Value uint32_field = 15;
+    {::_pbi::TcParser::FastMtR1,
+     {122, 63, 14, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.uint32_field_)}},
+    // repeated .google.protobuf.BoolValue bool_field = 16;
+    {::_pbi::TcParser::FastMtR2,
+     {386, 63, 15, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.bool_field_)}},
+    // repeated .google.protobuf.StringValue string_field = 17;
+    {::_pbi::TcParser::FastMtR2,
+     {394, 63, 16, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.string_field_)}},
+    // repeated .google.protobuf.BytesValue bytes_field = 18;
+    {::_pbi::TcParser::FastMtR2,
+     {402, 63, 17, PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.bytes_field_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .google.protobuf.Any any_field = 1;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.any_field_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Api api_field = 2;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.api_field_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Duration duration_field = 3;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.duration_field_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Empty empty_field = 4;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.empty_field_), 0, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvDefault)},
+    // repeated .google.protobuf.FieldMask field_mask_field = 5;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.field_mask_field_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.SourceContext source_context_field = 6;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.source_context_field_), 0, 5,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Struct struct_field = 7;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.struct_field_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Timestamp timestamp_field = 8;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.timestamp_field_), 0, 7,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Type type_field = 9;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.type_field_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.DoubleValue double_field = 10;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.double_field_), 0, 9,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.FloatValue float_field = 11;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.float_field_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Int64Value int64_field = 12;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.int64_field_), 0, 11,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.UInt64Value uint64_field = 13;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.uint64_field_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Int32Value int32_field = 14;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.int32_field_), 0, 13,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.UInt32Value uint32_field = 15;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.uint32_field_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.BoolValue bool_field = 16;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.bool_field_), 0, 15,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.StringValue string_field = 17;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.string_field_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.BytesValue bytes_field = 18;
+    {PROTOBUF_FIELD_OFFSET(RepeatedWellKnownTypes, _impl_.bytes_field_), 0, 17,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Api>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Duration>()},
+    {::_pbi::FieldAuxDefaultMessage{}, &::google::protobuf::_Empty_default_instance_},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FieldMask>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::SourceContext>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Struct>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Timestamp>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Type>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::DoubleValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FloatValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BoolValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::StringValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BytesValue>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* RepeatedWellKnownTypes::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.RepeatedWellKnownTypes)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // repeated .google.protobuf.Any any_field = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_any_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_any_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Api api_field = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_api_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_api_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Duration duration_field = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_duration_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_duration_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Empty empty_field = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_empty_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_empty_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.FieldMask field_mask_field = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_field_mask_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_field_mask_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.SourceContext source_context_field = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_source_context_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_source_context_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Struct struct_field = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_struct_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_struct_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Timestamp timestamp_field = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_timestamp_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_timestamp_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Type type_field = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_type_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_type_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.DoubleValue double_field = 10;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_double_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_double_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.FloatValue float_field = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_float_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_float_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Int64Value int64_field = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_int64_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_int64_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt64Value uint64_field = 13;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_uint64_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_uint64_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(13, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Int32Value int32_field = 14;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_int32_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_int32_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(14, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt32Value uint32_field = 15;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_uint32_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_uint32_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(15, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.BoolValue bool_field = 16;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bool_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bool_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(16, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.StringValue string_field = 17;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_string_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_string_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(17, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.BytesValue bytes_field = 18;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bytes_field_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bytes_field().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(18, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.RepeatedWellKnownTypes)
+  return target;
+}
+
+::size_t RepeatedWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.RepeatedWellKnownTypes)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any any_field = 1;
+  total_size += 1UL * this->_internal_any_field_size();
+  for (const auto& msg : this->_internal_any_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Api api_field = 2;
+  total_size += 1UL * this->_internal_api_field_size();
+  for (const auto& msg : this->_internal_api_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Duration duration_field = 3;
+  total_size += 1UL * this->_internal_duration_field_size();
+  for (const auto& msg : this->_internal_duration_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Empty empty_field = 4;
+  total_size += 1UL * this->_internal_empty_field_size();
+  for (const auto& msg : this->_internal_empty_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.FieldMask field_mask_field = 5;
+  total_size += 1UL * this->_internal_field_mask_field_size();
+  for (const auto& msg : this->_internal_field_mask_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.SourceContext source_context_field = 6;
+  total_size += 1UL * this->_internal_source_context_field_size();
+  for (const auto& msg : this->_internal_source_context_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Struct struct_field = 7;
+  total_size += 1UL * this->_internal_struct_field_size();
+  for (const auto& msg : this->_internal_struct_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Timestamp timestamp_field = 8;
+  total_size += 1UL * this->_internal_timestamp_field_size();
+  for (const auto& msg : this->_internal_timestamp_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Type type_field = 9;
+  total_size += 1UL * this->_internal_type_field_size();
+  for (const auto& msg : this->_internal_type_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.DoubleValue double_field = 10;
+  total_size += 1UL * this->_internal_double_field_size();
+  for (const auto& msg : this->_internal_double_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.FloatValue float_field = 11;
+  total_size += 1UL * this->_internal_float_field_size();
+  for (const auto& msg : this->_internal_float_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Int64Value int64_field = 12;
+  total_size += 1UL * this->_internal_int64_field_size();
+  for (const auto& msg : this->_internal_int64_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.UInt64Value uint64_field = 13;
+  total_size += 1UL * this->_internal_uint64_field_size();
+  for (const auto& msg : this->_internal_uint64_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Int32Value int32_field = 14;
+  total_size += 1UL * this->_internal_int32_field_size();
+  for (const auto& msg : this->_internal_int32_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.UInt32Value uint32_field = 15;
+  total_size += 1UL * this->_internal_uint32_field_size();
+  for (const auto& msg : this->_internal_uint32_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.BoolValue bool_field = 16;
+  total_size += 2UL * this->_internal_bool_field_size();
+  for (const auto& msg : this->_internal_bool_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.StringValue string_field = 17;
+  total_size += 2UL * this->_internal_string_field_size();
+  for (const auto& msg : this->_internal_string_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.BytesValue bytes_field = 18;
+  total_size += 2UL * this->_internal_bytes_field_size();
+  for (const auto& msg : this->_internal_bytes_field()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData RepeatedWellKnownTypes::_class_data_ = {
+    RepeatedWellKnownTypes::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* RepeatedWellKnownTypes::GetClassData() const {
+  return &_class_data_;
+}
+
+void RepeatedWellKnownTypes::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<RepeatedWellKnownTypes*>(&to_msg);
+  auto& from = static_cast<const RepeatedWellKnownTypes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.RepeatedWellKnownTypes)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_any_field()->MergeFrom(
+      from._internal_any_field());
+  _this->_internal_mutable_api_field()->MergeFrom(
+      from._internal_api_field());
+  _this->_internal_mutable_duration_field()->MergeFrom(
+      from._internal_duration_field());
+  _this->_internal_mutable_empty_field()->MergeFrom(
+      from._internal_empty_field());
+  _this->_internal_mutable_field_mask_field()->MergeFrom(
+      from._internal_field_mask_field());
+  _this->_internal_mutable_source_context_field()->MergeFrom(
+      from._internal_source_context_field());
+  _this->_internal_mutable_struct_field()->MergeFrom(
+      from._internal_struct_field());
+  _this->_internal_mutable_timestamp_field()->MergeFrom(
+      from._internal_timestamp_field());
+  _this->_internal_mutable_type_field()->MergeFrom(
+      from._internal_type_field());
+  _this->_internal_mutable_double_field()->MergeFrom(
+      from._internal_double_field());
+  _this->_internal_mutable_float_field()->MergeFrom(
+      from._internal_float_field());
+  _this->_internal_mutable_int64_field()->MergeFrom(
+      from._internal_int64_field());
+  _this->_internal_mutable_uint64_field()->MergeFrom(
+      from._internal_uint64_field());
+  _this->_internal_mutable_int32_field()->MergeFrom(
+      from._internal_int32_field());
+  _this->_internal_mutable_uint32_field()->MergeFrom(
+      from._internal_uint32_field());
+  _this->_internal_mutable_bool_field()->MergeFrom(
+      from._internal_bool_field());
+  _this->_internal_mutable_string_field()->MergeFrom(
+      from._internal_string_field());
+  _this->_internal_mutable_bytes_field()->MergeFrom(
+      from._internal_bytes_field());
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RepeatedWellKnownTypes::CopyFrom(const RepeatedWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.RepeatedWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool RepeatedWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* RepeatedWellKnownTypes::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void RepeatedWellKnownTypes::InternalSwap(RepeatedWellKnownTypes* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.any_field_.InternalSwap(&other->_impl_.any_field_);
+  _impl_.api_field_.InternalSwap(&other->_impl_.api_field_);
+  _impl_.duration_field_.InternalSwap(&other->_impl_.duration_field_);
+  _impl_.empty_field_.InternalSwap(&other->_impl_.empty_field_);
+  _impl_.field_mask_field_.InternalSwap(&other->_impl_.field_mask_field_);
+  _impl_.source_context_field_.InternalSwap(&other->_impl_.source_context_field_);
+  _impl_.struct_field_.InternalSwap(&other->_impl_.struct_field_);
+  _impl_.timestamp_field_.InternalSwap(&other->_impl_.timestamp_field_);
+  _impl_.type_field_.InternalSwap(&other->_impl_.type_field_);
+  _impl_.double_field_.InternalSwap(&other->_impl_.double_field_);
+  _impl_.float_field_.InternalSwap(&other->_impl_.float_field_);
+  _impl_.int64_field_.InternalSwap(&other->_impl_.int64_field_);
+  _impl_.uint64_field_.InternalSwap(&other->_impl_.uint64_field_);
+  _impl_.int32_field_.InternalSwap(&other->_impl_.int32_field_);
+  _impl_.uint32_field_.InternalSwap(&other->_impl_.uint32_field_);
+  _impl_.bool_field_.InternalSwap(&other->_impl_.bool_field_);
+  _impl_.string_field_.InternalSwap(&other->_impl_.string_field_);
+  _impl_.bytes_field_.InternalSwap(&other->_impl_.bytes_field_);
+}
+
+::google::protobuf::Metadata RepeatedWellKnownTypes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[1]);
+}
+// ===================================================================
+
+class OneofWellKnownTypes::_Internal {
+ public:
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, _impl_._oneof_case_);
+  static const ::google::protobuf::Any& any_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Api& api_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Duration& duration_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Empty& empty_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::FieldMask& field_mask_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::SourceContext& source_context_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Struct& struct_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Timestamp& timestamp_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Type& type_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::DoubleValue& double_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::FloatValue& float_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Int64Value& int64_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::UInt64Value& uint64_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::Int32Value& int32_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::UInt32Value& uint32_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::BoolValue& bool_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::StringValue& string_field(const OneofWellKnownTypes* msg);
+  static const ::google::protobuf::BytesValue& bytes_field(const OneofWellKnownTypes* msg);
+};
+
+const ::google::protobuf::Any& OneofWellKnownTypes::_Internal::any_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.any_field_;
+}
+const ::google::protobuf::Api& OneofWellKnownTypes::_Internal::api_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.api_field_;
+}
+const ::google::protobuf::Duration& OneofWellKnownTypes::_Internal::duration_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.duration_field_;
+}
+const ::google::protobuf::Empty& OneofWellKnownTypes::_Internal::empty_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.empty_field_;
+}
+const ::google::protobuf::FieldMask& OneofWellKnownTypes::_Internal::field_mask_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.field_mask_field_;
+}
+const ::google::protobuf::SourceContext& OneofWellKnownTypes::_Internal::source_context_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.source_context_field_;
+}
+const ::google::protobuf::Struct& OneofWellKnownTypes::_Internal::struct_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.struct_field_;
+}
+const ::google::protobuf::Timestamp& OneofWellKnownTypes::_Internal::timestamp_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.timestamp_field_;
+}
+const ::google::protobuf::Type& OneofWellKnownTypes::_Internal::type_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.type_field_;
+}
+const ::google::protobuf::DoubleValue& OneofWellKnownTypes::_Internal::double_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.double_field_;
+}
+const ::google::protobuf::FloatValue& OneofWellKnownTypes::_Internal::float_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.float_field_;
+}
+const ::google::protobuf::Int64Value& OneofWellKnownTypes::_Internal::int64_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.int64_field_;
+}
+const ::google::protobuf::UInt64Value& OneofWellKnownTypes::_Internal::uint64_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.uint64_field_;
+}
+const ::google::protobuf::Int32Value& OneofWellKnownTypes::_Internal::int32_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.int32_field_;
+}
+const ::google::protobuf::UInt32Value& OneofWellKnownTypes::_Internal::uint32_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.uint32_field_;
+}
+const ::google::protobuf::BoolValue& OneofWellKnownTypes::_Internal::bool_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.bool_field_;
+}
+const ::google::protobuf::StringValue& OneofWellKnownTypes::_Internal::string_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.string_field_;
+}
+const ::google::protobuf::BytesValue& OneofWellKnownTypes::_Internal::bytes_field(const OneofWellKnownTypes* msg) {
+  return *msg->_impl_.oneof_field_.bytes_field_;
+}
+void OneofWellKnownTypes::set_allocated_any_field(::google::protobuf::Any* any_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (any_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(any_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      any_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, any_field, submessage_arena);
+    }
+    set_has_any_field();
+    _impl_.oneof_field_.any_field_ = any_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.any_field)
+}
+void OneofWellKnownTypes::clear_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kAnyField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.any_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_api_field(::google::protobuf::Api* api_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (api_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(api_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      api_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, api_field, submessage_arena);
+    }
+    set_has_api_field();
+    _impl_.oneof_field_.api_field_ = api_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.api_field)
+}
+void OneofWellKnownTypes::clear_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kApiField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.api_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_duration_field(::google::protobuf::Duration* duration_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (duration_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(duration_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, duration_field, submessage_arena);
+    }
+    set_has_duration_field();
+    _impl_.oneof_field_.duration_field_ = duration_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.duration_field)
+}
+void OneofWellKnownTypes::clear_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kDurationField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.duration_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_empty_field(::google::protobuf::Empty* empty_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (empty_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(empty_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      empty_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, empty_field, submessage_arena);
+    }
+    set_has_empty_field();
+    _impl_.oneof_field_.empty_field_ = empty_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.empty_field)
+}
+void OneofWellKnownTypes::clear_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kEmptyField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.empty_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_field_mask_field(::google::protobuf::FieldMask* field_mask_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (field_mask_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(field_mask_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      field_mask_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, field_mask_field, submessage_arena);
+    }
+    set_has_field_mask_field();
+    _impl_.oneof_field_.field_mask_field_ = field_mask_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+}
+void OneofWellKnownTypes::clear_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kFieldMaskField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.field_mask_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_source_context_field(::google::protobuf::SourceContext* source_context_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (source_context_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(source_context_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      source_context_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, source_context_field, submessage_arena);
+    }
+    set_has_source_context_field();
+    _impl_.oneof_field_.source_context_field_ = source_context_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+}
+void OneofWellKnownTypes::clear_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kSourceContextField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.source_context_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_struct_field(::google::protobuf::Struct* struct_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (struct_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(struct_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, struct_field, submessage_arena);
+    }
+    set_has_struct_field();
+    _impl_.oneof_field_.struct_field_ = struct_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.struct_field)
+}
+void OneofWellKnownTypes::clear_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kStructField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.struct_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_timestamp_field(::google::protobuf::Timestamp* timestamp_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (timestamp_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(timestamp_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      timestamp_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, timestamp_field, submessage_arena);
+    }
+    set_has_timestamp_field();
+    _impl_.oneof_field_.timestamp_field_ = timestamp_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+}
+void OneofWellKnownTypes::clear_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kTimestampField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.timestamp_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_type_field(::google::protobuf::Type* type_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (type_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(type_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      type_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, type_field, submessage_arena);
+    }
+    set_has_type_field();
+    _impl_.oneof_field_.type_field_ = type_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.type_field)
+}
+void OneofWellKnownTypes::clear_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kTypeField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.type_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_double_field(::google::protobuf::DoubleValue* double_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (double_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(double_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      double_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, double_field, submessage_arena);
+    }
+    set_has_double_field();
+    _impl_.oneof_field_.double_field_ = double_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.double_field)
+}
+void OneofWellKnownTypes::clear_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kDoubleField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.double_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_float_field(::google::protobuf::FloatValue* float_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (float_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(float_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      float_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, float_field, submessage_arena);
+    }
+    set_has_float_field();
+    _impl_.oneof_field_.float_field_ = float_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.float_field)
+}
+void OneofWellKnownTypes::clear_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kFloatField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.float_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_int64_field(::google::protobuf::Int64Value* int64_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (int64_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(int64_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      int64_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, int64_field, submessage_arena);
+    }
+    set_has_int64_field();
+    _impl_.oneof_field_.int64_field_ = int64_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.int64_field)
+}
+void OneofWellKnownTypes::clear_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kInt64Field) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.int64_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_uint64_field(::google::protobuf::UInt64Value* uint64_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (uint64_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(uint64_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint64_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, uint64_field, submessage_arena);
+    }
+    set_has_uint64_field();
+    _impl_.oneof_field_.uint64_field_ = uint64_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+}
+void OneofWellKnownTypes::clear_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kUint64Field) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.uint64_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_int32_field(::google::protobuf::Int32Value* int32_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (int32_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(int32_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      int32_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, int32_field, submessage_arena);
+    }
+    set_has_int32_field();
+    _impl_.oneof_field_.int32_field_ = int32_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.int32_field)
+}
+void OneofWellKnownTypes::clear_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kInt32Field) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.int32_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_uint32_field(::google::protobuf::UInt32Value* uint32_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (uint32_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(uint32_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint32_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, uint32_field, submessage_arena);
+    }
+    set_has_uint32_field();
+    _impl_.oneof_field_.uint32_field_ = uint32_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+}
+void OneofWellKnownTypes::clear_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kUint32Field) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.uint32_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_bool_field(::google::protobuf::BoolValue* bool_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (bool_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(bool_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      bool_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, bool_field, submessage_arena);
+    }
+    set_has_bool_field();
+    _impl_.oneof_field_.bool_field_ = bool_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.bool_field)
+}
+void OneofWellKnownTypes::clear_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kBoolField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.bool_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_string_field(::google::protobuf::StringValue* string_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (string_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(string_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      string_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, string_field, submessage_arena);
+    }
+    set_has_string_field();
+    _impl_.oneof_field_.string_field_ = string_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.string_field)
+}
+void OneofWellKnownTypes::clear_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kStringField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.string_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_bytes_field(::google::protobuf::BytesValue* bytes_field) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (bytes_field) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(bytes_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      bytes_field = ::google::protobuf::internal::GetOwnedMessage(message_arena, bytes_field, submessage_arena);
+    }
+    set_has_bytes_field();
+    _impl_.oneof_field_.bytes_field_ = bytes_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+}
+void OneofWellKnownTypes::clear_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_field_case() == kBytesField) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_field_.bytes_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+OneofWellKnownTypes::OneofWellKnownTypes(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.OneofWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE OneofWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : oneof_field_{},
+        _cached_size_{0},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+OneofWellKnownTypes::OneofWellKnownTypes(
+    ::google::protobuf::Arena* arena,
+    const OneofWellKnownTypes& from)
+    : ::google::protobuf::Message(arena) {
+  OneofWellKnownTypes* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  switch (oneof_field_case()) {
+    case ONEOF_FIELD_NOT_SET:
+      break;
+      case kAnyField:
+        _impl_.oneof_field_.any_field_ = CreateMaybeMessage<::google::protobuf::Any>(arena, *from._impl_.oneof_field_.any_field_);
+        break;
+      case kApiField:
+        _impl_.oneof_field_.api_field_ = CreateMaybeMessage<::google::protobuf::Api>(arena, *from._impl_.oneof_field_.api_field_);
+        break;
+      case kDurationField:
+        _impl_.oneof_field_.duration_field_ = CreateMaybeMessage<::google::protobuf::Duration>(arena, *from._impl_.oneof_field_.duration_field_);
+        break;
+      case kEmptyField:
+        _impl_.oneof_field_.empty_field_ = CreateMaybeMessage<::google::protobuf::Empty>(arena, *from._impl_.oneof_field_.empty_field_);
+        break;
+      case kFieldMaskField:
+        _impl_.oneof_field_.field_mask_field_ = CreateMaybeMessage<::google::protobuf::FieldMask>(arena, *from._impl_.oneof_field_.field_mask_field_);
+        break;
+      case kSourceContextField:
+        _impl_.oneof_field_.source_context_field_ = CreateMaybeMessage<::google::protobuf::SourceContext>(arena, *from._impl_.oneof_field_.source_context_field_);
+        break;
+      case kStructField:
+        _impl_.oneof_field_.struct_field_ = CreateMaybeMessage<::google::protobuf::Struct>(arena, *from._impl_.oneof_field_.struct_field_);
+        break;
+      case kTimestampField:
+        _impl_.oneof_field_.timestamp_field_ = CreateMaybeMessage<::google::protobuf::Timestamp>(arena, *from._impl_.oneof_field_.timestamp_field_);
+        break;
+      case kTypeField:
+        _impl_.oneof_field_.type_field_ = CreateMaybeMessage<::google::protobuf::Type>(arena, *from._impl_.oneof_field_.type_field_);
+        break;
+      case kDoubleField:
+        _impl_.oneof_field_.double_field_ = CreateMaybeMessage<::google::protobuf::DoubleValue>(arena, *from._impl_.oneof_field_.double_field_);
+        break;
+      case kFloatField:
+        _impl_.oneof_field_.float_field_ = CreateMaybeMessage<::google::protobuf::FloatValue>(arena, *from._impl_.oneof_field_.float_field_);
+        break;
+      case kInt64Field:
+        _impl_.oneof_field_.int64_field_ = CreateMaybeMessage<::google::protobuf::Int64Value>(arena, *from._impl_.oneof_field_.int64_field_);
+        break;
+      case kUint64Field:
+        _impl_.oneof_field_.uint64_field_ = CreateMaybeMessage<::google::protobuf::UInt64Value>(arena, *from._impl_.oneof_field_.uint64_field_);
+        break;
+      case kInt32Field:
+        _impl_.oneof_field_.int32_field_ = CreateMaybeMessage<::google::protobuf::Int32Value>(arena, *from._impl_.oneof_field_.int32_field_);
+        break;
+      case kUint32Field:
+        _impl_.oneof_field_.uint32_field_ = CreateMaybeMessage<::google::protobuf::UInt32Value>(arena, *from._impl_.oneof_field_.uint32_field_);
+        break;
+      case kBoolField:
+        _impl_.oneof_field_.bool_field_ = CreateMaybeMessage<::google::protobuf::BoolValue>(arena, *from._impl_.oneof_field_.bool_field_);
+        break;
+      case kStringField:
+        _impl_.oneof_field_.string_field_ = CreateMaybeMessage<::google::protobuf::StringValue>(arena, *from._impl_.oneof_field_.string_field_);
+        break;
+      case kBytesField:
+        _impl_.oneof_field_.bytes_field_ = CreateMaybeMessage<::google::protobuf::BytesValue>(arena, *from._impl_.oneof_field_.bytes_field_);
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.OneofWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE OneofWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : oneof_field_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+inline void OneofWellKnownTypes::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+OneofWellKnownTypes::~OneofWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.OneofWellKnownTypes)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void OneofWellKnownTypes::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  _impl_.~Impl_();
+}
+
+void OneofWellKnownTypes::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.OneofWellKnownTypes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (oneof_field_case()) {
+    case kAnyField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.any_field_;
+      }
+      break;
+    }
+    case kApiField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.api_field_;
+      }
+      break;
+    }
+    case kDurationField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.duration_field_;
+      }
+      break;
+    }
+    case kEmptyField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.empty_field_;
+      }
+      break;
+    }
+    case kFieldMaskField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.field_mask_field_;
+      }
+      break;
+    }
+    case kSourceContextField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.source_context_field_;
+      }
+      break;
+    }
+    case kStructField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.struct_field_;
+      }
+      break;
+    }
+    case kTimestampField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.timestamp_field_;
+      }
+      break;
+    }
+    case kTypeField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.type_field_;
+      }
+      break;
+    }
+    case kDoubleField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.double_field_;
+      }
+      break;
+    }
+    case kFloatField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.float_field_;
+      }
+      break;
+    }
+    case kInt64Field: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.int64_field_;
+      }
+      break;
+    }
+    case kUint64Field: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.uint64_field_;
+      }
+      break;
+    }
+    case kInt32Field: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.int32_field_;
+      }
+      break;
+    }
+    case kUint32Field: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.uint32_field_;
+      }
+      break;
+    }
+    case kBoolField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.bool_field_;
+      }
+      break;
+    }
+    case kStringField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.string_field_;
+      }
+      break;
+    }
+    case kBytesField: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_field_.bytes_field_;
+      }
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void OneofWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.OneofWellKnownTypes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_oneof_field();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* OneofWellKnownTypes::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 18, 18, 0, 2> OneofWellKnownTypes::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    18, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294705152,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    18,  // num_field_entries
+    18,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_OneofWellKnownTypes_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Any any_field = 1;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.any_field_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Api api_field = 2;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.api_field_), _Internal::kOneofCaseOffset + 0, 1,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Duration duration_field = 3;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.duration_field_), _Internal::kOneofCaseOffset + 0, 2,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Empty empty_field = 4;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.empty_field_), _Internal::kOneofCaseOffset + 0, 3,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvDefault)},
+    // .google.protobuf.FieldMask field_mask_field = 5;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.field_mask_field_), _Internal::kOneofCaseOffset + 0, 4,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.SourceContext source_context_field = 6;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.source_context_field_), _Internal::kOneofCaseOffset + 0, 5,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Struct struct_field = 7;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.struct_field_), _Internal::kOneofCaseOffset + 0, 6,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Timestamp timestamp_field = 8;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.timestamp_field_), _Internal::kOneofCaseOffset + 0, 7,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Type type_field = 9;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.type_field_), _Internal::kOneofCaseOffset + 0, 8,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.DoubleValue double_field = 10;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.double_field_), _Internal::kOneofCaseOffset + 0, 9,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.FloatValue float_field = 11;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.float_field_), _Internal::kOneofCaseOffset + 0, 10,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Int64Value int64_field = 12;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.int64_field_), _Internal::kOneofCaseOffset + 0, 11,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.UInt64Value uint64_field = 13;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.uint64_field_), _Internal::kOneofCaseOffset + 0, 12,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Int32Value int32_field = 14;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.int32_field_), _Internal::kOneofCaseOffset + 0, 13,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.UInt32Value uint32_field = 15;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.uint32_field_), _Internal::kOneofCaseOffset + 0, 14,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.BoolValue bool_field = 16;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.bool_field_), _Internal::kOneofCaseOffset + 0, 15,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.StringValue string_field = 17;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.string_field_), _Internal::kOneofCaseOffset + 0, 16,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.BytesValue bytes_field = 18;
+    {PROTOBUF_FIELD_OFFSET(OneofWellKnownTypes, _impl_.oneof_field_.bytes_field_), _Internal::kOneofCaseOffset + 0, 17,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Api>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Duration>()},
+    {::_pbi::FieldAuxDefaultMessage{}, &::google::protobuf::_Empty_default_instance_},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FieldMask>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::SourceContext>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Struct>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Timestamp>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Type>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::DoubleValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FloatValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BoolValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::StringValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BytesValue>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* OneofWellKnownTypes::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.OneofWellKnownTypes)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  switch (oneof_field_case()) {
+    case kAnyField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          1, _Internal::any_field(this),
+          _Internal::any_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kApiField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          2, _Internal::api_field(this),
+          _Internal::api_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kDurationField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          3, _Internal::duration_field(this),
+          _Internal::duration_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEmptyField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          4, _Internal::empty_field(this),
+          _Internal::empty_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFieldMaskField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          5, _Internal::field_mask_field(this),
+          _Internal::field_mask_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSourceContextField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          6, _Internal::source_context_field(this),
+          _Internal::source_context_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStructField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          7, _Internal::struct_field(this),
+          _Internal::struct_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kTimestampField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          8, _Internal::timestamp_field(this),
+          _Internal::timestamp_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kTypeField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          9, _Internal::type_field(this),
+          _Internal::type_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kDoubleField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          10, _Internal::double_field(this),
+          _Internal::double_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFloatField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          11, _Internal::float_field(this),
+          _Internal::float_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kInt64Field: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          12, _Internal::int64_field(this),
+          _Internal::int64_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUint64Field: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          13, _Internal::uint64_field(this),
+          _Internal::uint64_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kInt32Field: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          14, _Internal::int32_field(this),
+          _Internal::int32_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUint32Field: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          15, _Internal::uint32_field(this),
+          _Internal::uint32_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kBoolField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          16, _Internal::bool_field(this),
+          _Internal::bool_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStringField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          17, _Internal::string_field(this),
+          _Internal::string_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kBytesField: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          18, _Internal::bytes_field(this),
+          _Internal::bytes_field(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default:
+      break;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.OneofWellKnownTypes)
+  return target;
+}
+
+::size_t OneofWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.OneofWellKnownTypes)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (oneof_field_case()) {
+    // .google.protobuf.Any any_field = 1;
+    case kAnyField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.any_field_);
+      break;
+    }
+    // .google.protobuf.Api api_field = 2;
+    case kApiField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.api_field_);
+      break;
+    }
+    // .google.protobuf.Duration duration_field = 3;
+    case kDurationField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.duration_field_);
+      break;
+    }
+    // .google.protobuf.Empty empty_field = 4;
+    case kEmptyField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.empty_field_);
+      break;
+    }
+    // .google.protobuf.FieldMask field_mask_field = 5;
+    case kFieldMaskField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.field_mask_field_);
+      break;
+    }
+    // .google.protobuf.SourceContext source_context_field = 6;
+    case kSourceContextField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.source_context_field_);
+      break;
+    }
+    // .google.protobuf.Struct struct_field = 7;
+    case kStructField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.struct_field_);
+      break;
+    }
+    // .google.protobuf.Timestamp timestamp_field = 8;
+    case kTimestampField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.timestamp_field_);
+      break;
+    }
+    // .google.protobuf.Type type_field = 9;
+    case kTypeField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.type_field_);
+      break;
+    }
+    // .google.protobuf.DoubleValue double_field = 10;
+    case kDoubleField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.double_field_);
+      break;
+    }
+    // .google.protobuf.FloatValue float_field = 11;
+    case kFloatField: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.float_field_);
+      break;
+    }
+    // .google.protobuf.Int64Value int64_field = 12;
+    case kInt64Field: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.int64_field_);
+      break;
+    }
+    // .google.protobuf.UInt64Value uint64_field = 13;
+    case kUint64Field: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.uint64_field_);
+      break;
+    }
+    // .google.protobuf.Int32Value int32_field = 14;
+    case kInt32Field: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.int32_field_);
+      break;
+    }
+    // .google.protobuf.UInt32Value uint32_field = 15;
+    case kUint32Field: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.uint32_field_);
+      break;
+    }
+    // .google.protobuf.BoolValue bool_field = 16;
+    case kBoolField: {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.bool_field_);
+      break;
+    }
+    // .google.protobuf.StringValue string_field = 17;
+    case kStringField: {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.string_field_);
+      break;
+    }
+    // .google.protobuf.BytesValue bytes_field = 18;
+    case kBytesField: {
+      total_size +=
+          2 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_field_.bytes_field_);
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData OneofWellKnownTypes::_class_data_ = {
+    OneofWellKnownTypes::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* OneofWellKnownTypes::GetClassData() const {
+  return &_class_data_;
+}
+
+void OneofWellKnownTypes::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<OneofWellKnownTypes*>(&to_msg);
+  auto& from = static_cast<const OneofWellKnownTypes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.OneofWellKnownTypes)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.oneof_field_case()) {
+    case kAnyField: {
+      _this->_internal_mutable_any_field()->::google::protobuf::Any::MergeFrom(
+          from._internal_any_field());
+      break;
+    }
+    case kApiField: {
+      _this->_internal_mutable_api_field()->::google::protobuf::Api::MergeFrom(
+          from._internal_api_field());
+      break;
+    }
+    case kDurationField: {
+      _this->_internal_mutable_duration_field()->::google::protobuf::Duration::MergeFrom(
+          from._internal_duration_field());
+      break;
+    }
+    case kEmptyField: {
+      _this->_internal_mutable_empty_field()->::google::protobuf::Empty::MergeFrom(
+          from._internal_empty_field());
+      break;
+    }
+    case kFieldMaskField: {
+      _this->_internal_mutable_field_mask_field()->::google::protobuf::FieldMask::MergeFrom(
+          from._internal_field_mask_field());
+      break;
+    }
+    case kSourceContextField: {
+      _this->_internal_mutable_source_context_field()->::google::protobuf::SourceContext::MergeFrom(
+          from._internal_source_context_field());
+      break;
+    }
+    case kStructField: {
+      _this->_internal_mutable_struct_field()->::google::protobuf::Struct::MergeFrom(
+          from._internal_struct_field());
+      break;
+    }
+    case kTimestampField: {
+      _this->_internal_mutable_timestamp_field()->::google::protobuf::Timestamp::MergeFrom(
+          from._internal_timestamp_field());
+      break;
+    }
+    case kTypeField: {
+      _this->_internal_mutable_type_field()->::google::protobuf::Type::MergeFrom(
+          from._internal_type_field());
+      break;
+    }
+    case kDoubleField: {
+      _this->_internal_mutable_double_field()->::google::protobuf::DoubleValue::MergeFrom(
+          from._internal_double_field());
+      break;
+    }
+    case kFloatField: {
+      _this->_internal_mutable_float_field()->::google::protobuf::FloatValue::MergeFrom(
+          from._internal_float_field());
+      break;
+    }
+    case kInt64Field: {
+      _this->_internal_mutable_int64_field()->::google::protobuf::Int64Value::MergeFrom(
+          from._internal_int64_field());
+      break;
+    }
+    case kUint64Field: {
+      _this->_internal_mutable_uint64_field()->::google::protobuf::UInt64Value::MergeFrom(
+          from._internal_uint64_field());
+      break;
+    }
+    case kInt32Field: {
+      _this->_internal_mutable_int32_field()->::google::protobuf::Int32Value::MergeFrom(
+          from._internal_int32_field());
+      break;
+    }
+    case kUint32Field: {
+      _this->_internal_mutable_uint32_field()->::google::protobuf::UInt32Value::MergeFrom(
+          from._internal_uint32_field());
+      break;
+    }
+    case kBoolField: {
+      _this->_internal_mutable_bool_field()->::google::protobuf::BoolValue::MergeFrom(
+          from._internal_bool_field());
+      break;
+    }
+    case kStringField: {
+      _this->_internal_mutable_string_field()->::google::protobuf::StringValue::MergeFrom(
+          from._internal_string_field());
+      break;
+    }
+    case kBytesField: {
+      _this->_internal_mutable_bytes_field()->::google::protobuf::BytesValue::MergeFrom(
+          from._internal_bytes_field());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OneofWellKnownTypes::CopyFrom(const OneofWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.OneofWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool OneofWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* OneofWellKnownTypes::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void OneofWellKnownTypes::InternalSwap(OneofWellKnownTypes* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.oneof_field_, other->_impl_.oneof_field_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata OneofWellKnownTypes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[2]);
+}
+// ===================================================================
+
+MapWellKnownTypes_AnyFieldEntry_DoNotUse::MapWellKnownTypes_AnyFieldEntry_DoNotUse() {}
+MapWellKnownTypes_AnyFieldEntry_DoNotUse::MapWellKnownTypes_AnyFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_AnyFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[3]);
+}
+// ===================================================================
+
+MapWellKnownTypes_ApiFieldEntry_DoNotUse::MapWellKnownTypes_ApiFieldEntry_DoNotUse() {}
+MapWellKnownTypes_ApiFieldEntry_DoNotUse::MapWellKnownTypes_ApiFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_ApiFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[4]);
+}
+// ===================================================================
+
+MapWellKnownTypes_DurationFieldEntry_DoNotUse::MapWellKnownTypes_DurationFieldEntry_DoNotUse() {}
+MapWellKnownTypes_DurationFieldEntry_DoNotUse::MapWellKnownTypes_DurationFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_DurationFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[5]);
+}
+// ===================================================================
+
+MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MapWellKnownTypes_EmptyFieldEntry_DoNotUse() {}
+MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MapWellKnownTypes_EmptyFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_EmptyFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[6]);
+}
+// ===================================================================
+
+MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse() {}
+MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[7]);
+}
+// ===================================================================
+
+MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse() {}
+MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[8]);
+}
+// ===================================================================
+
+MapWellKnownTypes_StructFieldEntry_DoNotUse::MapWellKnownTypes_StructFieldEntry_DoNotUse() {}
+MapWellKnownTypes_StructFieldEntry_DoNotUse::MapWellKnownTypes_StructFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_StructFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[9]);
+}
+// ===================================================================
+
+MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MapWellKnownTypes_TimestampFieldEntry_DoNotUse() {}
+MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MapWellKnownTypes_TimestampFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_TimestampFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[10]);
+}
+// ===================================================================
+
+MapWellKnownTypes_TypeFieldEntry_DoNotUse::MapWellKnownTypes_TypeFieldEntry_DoNotUse() {}
+MapWellKnownTypes_TypeFieldEntry_DoNotUse::MapWellKnownTypes_TypeFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_TypeFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[11]);
+}
+// ===================================================================
+
+MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MapWellKnownTypes_DoubleFieldEntry_DoNotUse() {}
+MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MapWellKnownTypes_DoubleFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_DoubleFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[12]);
+}
+// ===================================================================
+
+MapWellKnownTypes_FloatFieldEntry_DoNotUse::MapWellKnownTypes_FloatFieldEntry_DoNotUse() {}
+MapWellKnownTypes_FloatFieldEntry_DoNotUse::MapWellKnownTypes_FloatFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_FloatFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[13]);
+}
+// ===================================================================
+
+MapWellKnownTypes_Int64FieldEntry_DoNotUse::MapWellKnownTypes_Int64FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Int64FieldEntry_DoNotUse::MapWellKnownTypes_Int64FieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_Int64FieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[14]);
+}
+// ===================================================================
+
+MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MapWellKnownTypes_Uint64FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MapWellKnownTypes_Uint64FieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_Uint64FieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[15]);
+}
+// ===================================================================
+
+MapWellKnownTypes_Int32FieldEntry_DoNotUse::MapWellKnownTypes_Int32FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Int32FieldEntry_DoNotUse::MapWellKnownTypes_Int32FieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_Int32FieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[16]);
+}
+// ===================================================================
+
+MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MapWellKnownTypes_Uint32FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MapWellKnownTypes_Uint32FieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_Uint32FieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[17]);
+}
+// ===================================================================
+
+MapWellKnownTypes_BoolFieldEntry_DoNotUse::MapWellKnownTypes_BoolFieldEntry_DoNotUse() {}
+MapWellKnownTypes_BoolFieldEntry_DoNotUse::MapWellKnownTypes_BoolFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_BoolFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[18]);
+}
+// ===================================================================
+
+MapWellKnownTypes_StringFieldEntry_DoNotUse::MapWellKnownTypes_StringFieldEntry_DoNotUse() {}
+MapWellKnownTypes_StringFieldEntry_DoNotUse::MapWellKnownTypes_StringFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_StringFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[19]);
+}
+// ===================================================================
+
+MapWellKnownTypes_BytesFieldEntry_DoNotUse::MapWellKnownTypes_BytesFieldEntry_DoNotUse() {}
+MapWellKnownTypes_BytesFieldEntry_DoNotUse::MapWellKnownTypes_BytesFieldEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapWellKnownTypes_BytesFieldEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[20]);
+}
+// ===================================================================
+
+class MapWellKnownTypes::_Internal {
+ public:
+};
+
+void MapWellKnownTypes::clear_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.any_field_.Clear();
+}
+void MapWellKnownTypes::clear_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.api_field_.Clear();
+}
+void MapWellKnownTypes::clear_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.duration_field_.Clear();
+}
+void MapWellKnownTypes::clear_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.empty_field_.Clear();
+}
+void MapWellKnownTypes::clear_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.field_mask_field_.Clear();
+}
+void MapWellKnownTypes::clear_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.source_context_field_.Clear();
+}
+void MapWellKnownTypes::clear_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.struct_field_.Clear();
+}
+void MapWellKnownTypes::clear_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.timestamp_field_.Clear();
+}
+void MapWellKnownTypes::clear_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.type_field_.Clear();
+}
+void MapWellKnownTypes::clear_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.double_field_.Clear();
+}
+void MapWellKnownTypes::clear_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.float_field_.Clear();
+}
+void MapWellKnownTypes::clear_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int64_field_.Clear();
+}
+void MapWellKnownTypes::clear_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint64_field_.Clear();
+}
+void MapWellKnownTypes::clear_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int32_field_.Clear();
+}
+void MapWellKnownTypes::clear_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint32_field_.Clear();
+}
+void MapWellKnownTypes::clear_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_field_.Clear();
+}
+void MapWellKnownTypes::clear_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_field_.Clear();
+}
+void MapWellKnownTypes::clear_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bytes_field_.Clear();
+}
+MapWellKnownTypes::MapWellKnownTypes(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.MapWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE MapWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : any_field_{visibility, arena, from.any_field_},
+        api_field_{visibility, arena, from.api_field_},
+        duration_field_{visibility, arena, from.duration_field_},
+        empty_field_{visibility, arena, from.empty_field_},
+        field_mask_field_{visibility, arena, from.field_mask_field_},
+        source_context_field_{visibility, arena, from.source_context_field_},
+        struct_field_{visibility, arena, from.struct_field_},
+        timestamp_field_{visibility, arena, from.timestamp_field_},
+        type_field_{visibility, arena, from.type_field_},
+        double_field_{visibility, arena, from.double_field_},
+        float_field_{visibility, arena, from.float_field_},
+        int64_field_{visibility, arena, from.int64_field_},
+        uint64_field_{visibility, arena, from.uint64_field_},
+        int32_field_{visibility, arena, from.int32_field_},
+        uint32_field_{visibility, arena, from.uint32_field_},
+        bool_field_{visibility, arena, from.bool_field_},
+        string_field_{visibility, arena, from.string_field_},
+        bytes_field_{visibility, arena, from.bytes_field_},
+        _cached_size_{0} {}
+
+MapWellKnownTypes::MapWellKnownTypes(
+    ::google::protobuf::Arena* arena,
+    const MapWellKnownTypes& from)
+    : ::google::protobuf::Message(arena) {
+  MapWellKnownTypes* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.MapWellKnownTypes)
+}
+inline PROTOBUF_NDEBUG_INLINE MapWellKnownTypes::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : any_field_{visibility, arena},
+        api_field_{visibility, arena},
+        duration_field_{visibility, arena},
+        empty_field_{visibility, arena},
+        field_mask_field_{visibility, arena},
+        source_context_field_{visibility, arena},
+        struct_field_{visibility, arena},
+        timestamp_field_{visibility, arena},
+        type_field_{visibility, arena},
+        double_field_{visibility, arena},
+        float_field_{visibility, arena},
+        int64_field_{visibility, arena},
+        uint64_field_{visibility, arena},
+        int32_field_{visibility, arena},
+        uint32_field_{visibility, arena},
+        bool_field_{visibility, arena},
+        string_field_{visibility, arena},
+        bytes_field_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void MapWellKnownTypes::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapWellKnownTypes::~MapWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.MapWellKnownTypes)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapWellKnownTypes::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.MapWellKnownTypes)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.any_field_.Clear();
+  _impl_.api_field_.Clear();
+  _impl_.duration_field_.Clear();
+  _impl_.empty_field_.Clear();
+  _impl_.field_mask_field_.Clear();
+  _impl_.source_context_field_.Clear();
+  _impl_.struct_field_.Clear();
+  _impl_.timestamp_field_.Clear();
+  _impl_.type_field_.Clear();
+  _impl_.double_field_.Clear();
+  _impl_.float_field_.Clear();
+  _impl_.int64_field_.Clear();
+  _impl_.uint64_field_.Clear();
+  _impl_.int32_field_.Clear();
+  _impl_.uint32_field_.Clear();
+  _impl_.bool_field_.Clear();
+  _impl_.string_field_.Clear();
+  _impl_.bytes_field_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapWellKnownTypes::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 18, 36, 0, 2> MapWellKnownTypes::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    18, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294705152,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    18,  // num_field_entries
+    36,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapWellKnownTypes_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, .google.protobuf.Any> any_field = 1;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.any_field_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Api> api_field = 2;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.api_field_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Duration> duration_field = 3;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.duration_field_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Empty> empty_field = 4;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.empty_field_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.field_mask_field_), 0, 8,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.source_context_field_), 0, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Struct> struct_field = 7;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.struct_field_), 0, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.timestamp_field_), 0, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Type> type_field = 9;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.type_field_), 0, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.double_field_), 0, 18,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.FloatValue> float_field = 11;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.float_field_), 0, 20,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.int64_field_), 0, 22,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.uint64_field_), 0, 24,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.int32_field_), 0, 26,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.uint32_field_), 0, 28,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.bool_field_), 0, 30,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.StringValue> string_field = 17;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.string_field_), 0, 32,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+    {PROTOBUF_FIELD_OFFSET(MapWellKnownTypes, _impl_.bytes_field_), 0, 34,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.any_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Any>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.api_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Api>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.duration_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Duration>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.empty_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Empty>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.field_mask_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::FieldMask>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.source_context_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::SourceContext>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.struct_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Struct>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.timestamp_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Timestamp>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.type_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Type>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.double_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::DoubleValue>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.float_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::FloatValue>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.int64_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Int64Value>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.uint64_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::UInt64Value>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.int32_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Int32Value>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.uint32_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::UInt32Value>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.bool_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::BoolValue>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.string_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::StringValue>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapWellKnownTypes()._impl_.bytes_field_)>(
+        1, 0, 0, 5,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::BytesValue>},
+  }}, {{
+  }},
+};
+
+::uint8_t* MapWellKnownTypes::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.MapWellKnownTypes)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, .google.protobuf.Any> any_field = 1;
+  if (!_internal_any_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Any,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_any_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Api> api_field = 2;
+  if (!_internal_api_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Api,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_api_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Duration> duration_field = 3;
+  if (!_internal_duration_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Duration,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_duration_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Empty> empty_field = 4;
+  if (!_internal_empty_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Empty,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_empty_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+  if (!_internal_field_mask_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::FieldMask,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_field_mask_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+  if (!_internal_source_context_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::SourceContext,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_source_context_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Struct> struct_field = 7;
+  if (!_internal_struct_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Struct,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_struct_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+  if (!_internal_timestamp_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Timestamp,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_timestamp_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Type> type_field = 9;
+  if (!_internal_type_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Type,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_type_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            9, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+  if (!_internal_double_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::DoubleValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_double_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            10, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.FloatValue> float_field = 11;
+  if (!_internal_float_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::FloatValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_float_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            11, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+  if (!_internal_int64_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Int64Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_int64_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            12, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+  if (!_internal_uint64_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::UInt64Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_uint64_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            13, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            13, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+  if (!_internal_int32_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Int32Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_int32_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            14, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            14, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+  if (!_internal_uint32_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::UInt32Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_uint32_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            15, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            15, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+  if (!_internal_bool_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::BoolValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_bool_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            16, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            16, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.StringValue> string_field = 17;
+  if (!_internal_string_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::StringValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_string_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            17, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            17, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+  if (!_internal_bytes_field().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::BytesValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_bytes_field();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            18, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            18, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.MapWellKnownTypes)
+  return target;
+}
+
+::size_t MapWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.MapWellKnownTypes)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .google.protobuf.Any> any_field = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_any_field_size());
+  for (const auto& entry : _internal_any_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Any,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Api> api_field = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_api_field_size());
+  for (const auto& entry : _internal_api_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Api,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Duration> duration_field = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_duration_field_size());
+  for (const auto& entry : _internal_duration_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Duration,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Empty> empty_field = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_empty_field_size());
+  for (const auto& entry : _internal_empty_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Empty,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_field_mask_field_size());
+  for (const auto& entry : _internal_field_mask_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::FieldMask,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_source_context_field_size());
+  for (const auto& entry : _internal_source_context_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::SourceContext,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Struct> struct_field = 7;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_struct_field_size());
+  for (const auto& entry : _internal_struct_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Struct,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_timestamp_field_size());
+  for (const auto& entry : _internal_timestamp_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Timestamp,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Type> type_field = 9;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_type_field_size());
+  for (const auto& entry : _internal_type_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Type,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_double_field_size());
+  for (const auto& entry : _internal_double_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::DoubleValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.FloatValue> float_field = 11;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_float_field_size());
+  for (const auto& entry : _internal_float_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::FloatValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_int64_field_size());
+  for (const auto& entry : _internal_int64_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Int64Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_uint64_field_size());
+  for (const auto& entry : _internal_uint64_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::UInt64Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_int32_field_size());
+  for (const auto& entry : _internal_int32_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::Int32Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_uint32_field_size());
+  for (const auto& entry : _internal_uint32_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::UInt32Value,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_bool_field_size());
+  for (const auto& entry : _internal_bool_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::BoolValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.StringValue> string_field = 17;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_string_field_size());
+  for (const auto& entry : _internal_string_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::StringValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_bytes_field_size());
+  for (const auto& entry : _internal_bytes_field()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::google::protobuf::BytesValue,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapWellKnownTypes::_class_data_ = {
+    MapWellKnownTypes::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapWellKnownTypes::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapWellKnownTypes::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapWellKnownTypes*>(&to_msg);
+  auto& from = static_cast<const MapWellKnownTypes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.MapWellKnownTypes)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.any_field_.MergeFrom(from._impl_.any_field_);
+  _this->_impl_.api_field_.MergeFrom(from._impl_.api_field_);
+  _this->_impl_.duration_field_.MergeFrom(from._impl_.duration_field_);
+  _this->_impl_.empty_field_.MergeFrom(from._impl_.empty_field_);
+  _this->_impl_.field_mask_field_.MergeFrom(from._impl_.field_mask_field_);
+  _this->_impl_.source_context_field_.MergeFrom(from._impl_.source_context_field_);
+  _this->_impl_.struct_field_.MergeFrom(from._impl_.struct_field_);
+  _this->_impl_.timestamp_field_.MergeFrom(from._impl_.timestamp_field_);
+  _this->_impl_.type_field_.MergeFrom(from._impl_.type_field_);
+  _this->_impl_.double_field_.MergeFrom(from._impl_.double_field_);
+  _this->_impl_.float_field_.MergeFrom(from._impl_.float_field_);
+  _this->_impl_.int64_field_.MergeFrom(from._impl_.int64_field_);
+  _this->_impl_.uint64_field_.MergeFrom(from._impl_.uint64_field_);
+  _this->_impl_.int32_field_.MergeFrom(from._impl_.int32_field_);
+  _this->_impl_.uint32_field_.MergeFrom(from._impl_.uint32_field_);
+  _this->_impl_.bool_field_.MergeFrom(from._impl_.bool_field_);
+  _this->_impl_.string_field_.MergeFrom(from._impl_.string_field_);
+  _this->_impl_.bytes_field_.MergeFrom(from._impl_.bytes_field_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapWellKnownTypes::CopyFrom(const MapWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.MapWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapWellKnownTypes::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapWellKnownTypes::InternalSwap(MapWellKnownTypes* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.any_field_.InternalSwap(&other->_impl_.any_field_);
+  _impl_.api_field_.InternalSwap(&other->_impl_.api_field_);
+  _impl_.duration_field_.InternalSwap(&other->_impl_.duration_field_);
+  _impl_.empty_field_.InternalSwap(&other->_impl_.empty_field_);
+  _impl_.field_mask_field_.InternalSwap(&other->_impl_.field_mask_field_);
+  _impl_.source_context_field_.InternalSwap(&other->_impl_.source_context_field_);
+  _impl_.struct_field_.InternalSwap(&other->_impl_.struct_field_);
+  _impl_.timestamp_field_.InternalSwap(&other->_impl_.timestamp_field_);
+  _impl_.type_field_.InternalSwap(&other->_impl_.type_field_);
+  _impl_.double_field_.InternalSwap(&other->_impl_.double_field_);
+  _impl_.float_field_.InternalSwap(&other->_impl_.float_field_);
+  _impl_.int64_field_.InternalSwap(&other->_impl_.int64_field_);
+  _impl_.uint64_field_.InternalSwap(&other->_impl_.uint64_field_);
+  _impl_.int32_field_.InternalSwap(&other->_impl_.int32_field_);
+  _impl_.uint32_field_.InternalSwap(&other->_impl_.uint32_field_);
+  _impl_.bool_field_.InternalSwap(&other->_impl_.bool_field_);
+  _impl_.string_field_.InternalSwap(&other->_impl_.string_field_);
+  _impl_.bytes_field_.InternalSwap(&other->_impl_.bytes_field_);
+}
+
+::google::protobuf::Metadata MapWellKnownTypes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_getter, &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[21]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
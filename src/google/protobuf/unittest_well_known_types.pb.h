@@ -0,0 +1,7007 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_well_known_types.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/map.h"  // IWYU pragma: export
+#include "google/protobuf/map_entry.h"
+#include "google/protobuf/map_field_inl.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/any.pb.h"
+#include "google/protobuf/api.pb.h"
+#include "google/protobuf/duration.pb.h"
+#include "google/protobuf/empty.pb.h"
+#include "google/protobuf/field_mask.pb.h"
+#include "google/protobuf/source_context.pb.h"
+#include "google/protobuf/struct.pb.h"
+#include "google/protobuf/timestamp.pb.h"
+#include "google/protobuf/type.pb.h"
+#include "google/protobuf/wrappers.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+namespace protobuf_unittest {
+class MapWellKnownTypes;
+struct MapWellKnownTypesDefaultTypeInternal;
+extern MapWellKnownTypesDefaultTypeInternal _MapWellKnownTypes_default_instance_;
+class MapWellKnownTypes_AnyFieldEntry_DoNotUse;
+struct MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_ApiFieldEntry_DoNotUse;
+struct MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_BoolFieldEntry_DoNotUse;
+struct MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_BytesFieldEntry_DoNotUse;
+struct MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_DoubleFieldEntry_DoNotUse;
+struct MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_DurationFieldEntry_DoNotUse;
+struct MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_EmptyFieldEntry_DoNotUse;
+struct MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse;
+struct MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_FloatFieldEntry_DoNotUse;
+struct MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Int32FieldEntry_DoNotUse;
+struct MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Int64FieldEntry_DoNotUse;
+struct MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_SourceContextFieldEntry_DoNotUse;
+struct MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_StringFieldEntry_DoNotUse;
+struct MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_StructFieldEntry_DoNotUse;
+struct MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_TimestampFieldEntry_DoNotUse;
+struct MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_TypeFieldEntry_DoNotUse;
+struct MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Uint32FieldEntry_DoNotUse;
+struct MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Uint64FieldEntry_DoNotUse;
+struct MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_;
+class OneofWellKnownTypes;
+struct OneofWellKnownTypesDefaultTypeInternal;
+extern OneofWellKnownTypesDefaultTypeInternal _OneofWellKnownTypes_default_instance_;
+class RepeatedWellKnownTypes;
+struct RepeatedWellKnownTypesDefaultTypeInternal;
+extern RepeatedWellKnownTypesDefaultTypeInternal _RepeatedWellKnownTypes_default_instance_;
+class TestWellKnownTypes;
+struct TestWellKnownTypesDefaultTypeInternal;
+extern TestWellKnownTypesDefaultTypeInternal _TestWellKnownTypes_default_instance_;
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace protobuf_unittest {
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Uint64FieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_Uint64FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::UInt64Value,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_Uint64FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::UInt64Value,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_Uint64FieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_Uint64FieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_Uint64FieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_Uint64FieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_Uint64FieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Uint32FieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_Uint32FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::UInt32Value,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_Uint32FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::UInt32Value,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_Uint32FieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_Uint32FieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_Uint32FieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_Uint32FieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_Uint32FieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_TimestampFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_TimestampFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Timestamp,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_TimestampFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Timestamp,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_TimestampFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_TimestampFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_TimestampFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_TimestampFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_TimestampFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_StructFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_StructFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Struct,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_StructFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Struct,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_StructFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_StructFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_StructFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_StructFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_StructFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_StringFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_StringFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::StringValue,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_StringFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::StringValue,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_StringFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_StringFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_StringFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_StringFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_StringFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_SourceContextFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::SourceContext,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::SourceContext,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_SourceContextFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_SourceContextFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_SourceContextFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_SourceContextFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_SourceContextFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Int64FieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_Int64FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Int64Value,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_Int64FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Int64Value,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_Int64FieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_Int64FieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_Int64FieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_Int64FieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_Int64FieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Int32FieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_Int32FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Int32Value,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_Int32FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Int32Value,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_Int32FieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_Int32FieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_Int32FieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_Int32FieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_Int32FieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_FloatFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_FloatFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::FloatValue,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_FloatFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::FloatValue,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_FloatFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_FloatFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_FloatFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_FloatFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_FloatFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::FieldMask,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::FieldMask,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_EmptyFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_EmptyFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Empty,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_EmptyFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Empty,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_EmptyFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_EmptyFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_EmptyFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_EmptyFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_EmptyFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_DurationFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_DurationFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Duration,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_DurationFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Duration,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_DurationFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_DurationFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_DurationFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_DurationFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_DurationFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_DoubleFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_DoubleFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::DoubleValue,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_DoubleFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::DoubleValue,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_DoubleFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_DoubleFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_DoubleFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_DoubleFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_DoubleFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_BytesFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_BytesFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::BytesValue,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_BytesFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::BytesValue,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_BytesFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_BytesFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_BytesFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_BytesFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_BytesFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_BoolFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_BoolFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::BoolValue,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_BoolFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::BoolValue,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_BoolFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_BoolFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_BoolFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_BoolFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_BoolFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_AnyFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_AnyFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Any,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_AnyFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Any,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_AnyFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_AnyFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_AnyFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_AnyFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_AnyFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestWellKnownTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestWellKnownTypes) */ {
+ public:
+  inline TestWellKnownTypes() : TestWellKnownTypes(nullptr) {}
+  ~TestWellKnownTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestWellKnownTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestWellKnownTypes(const TestWellKnownTypes& from)
+      : TestWellKnownTypes(nullptr, from) {}
+  TestWellKnownTypes(TestWellKnownTypes&& from) noexcept
+    : TestWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestWellKnownTypes& operator=(const TestWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestWellKnownTypes& operator=(TestWellKnownTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestWellKnownTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const TestWellKnownTypes*>(
+               &_TestWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestWellKnownTypes& a, TestWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestWellKnownTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestWellKnownTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestWellKnownTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestWellKnownTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestWellKnownTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestWellKnownTypes& from) {
+    TestWellKnownTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestWellKnownTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.TestWellKnownTypes";
+  }
+  protected:
+  explicit TestWellKnownTypes(::google::protobuf::Arena* arena);
+  TestWellKnownTypes(::google::protobuf::Arena* arena, const TestWellKnownTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnyFieldFieldNumber = 1,
+    kApiFieldFieldNumber = 2,
+    kDurationFieldFieldNumber = 3,
+    kEmptyFieldFieldNumber = 4,
+    kFieldMaskFieldFieldNumber = 5,
+    kSourceContextFieldFieldNumber = 6,
+    kStructFieldFieldNumber = 7,
+    kTimestampFieldFieldNumber = 8,
+    kTypeFieldFieldNumber = 9,
+    kDoubleFieldFieldNumber = 10,
+    kFloatFieldFieldNumber = 11,
+    kInt64FieldFieldNumber = 12,
+    kUint64FieldFieldNumber = 13,
+    kInt32FieldFieldNumber = 14,
+    kUint32FieldFieldNumber = 15,
+    kBoolFieldFieldNumber = 16,
+    kStringFieldFieldNumber = 17,
+    kBytesFieldFieldNumber = 18,
+    kValueFieldFieldNumber = 19,
+  };
+  // .google.protobuf.Any any_field = 1;
+  bool has_any_field() const;
+  void clear_any_field() ;
+  const ::google::protobuf::Any& any_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Any* release_any_field();
+  ::google::protobuf::Any* mutable_any_field();
+  void set_allocated_any_field(::google::protobuf::Any* value);
+  void unsafe_arena_set_allocated_any_field(::google::protobuf::Any* value);
+  ::google::protobuf::Any* unsafe_arena_release_any_field();
+
+  private:
+  const ::google::protobuf::Any& _internal_any_field() const;
+  ::google::protobuf::Any* _internal_mutable_any_field();
+
+  public:
+  // .google.protobuf.Api api_field = 2;
+  bool has_api_field() const;
+  void clear_api_field() ;
+  const ::google::protobuf::Api& api_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Api* release_api_field();
+  ::google::protobuf::Api* mutable_api_field();
+  void set_allocated_api_field(::google::protobuf::Api* value);
+  void unsafe_arena_set_allocated_api_field(::google::protobuf::Api* value);
+  ::google::protobuf::Api* unsafe_arena_release_api_field();
+
+  private:
+  const ::google::protobuf::Api& _internal_api_field() const;
+  ::google::protobuf::Api* _internal_mutable_api_field();
+
+  public:
+  // .google.protobuf.Duration duration_field = 3;
+  bool has_duration_field() const;
+  void clear_duration_field() ;
+  const ::google::protobuf::Duration& duration_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Duration* release_duration_field();
+  ::google::protobuf::Duration* mutable_duration_field();
+  void set_allocated_duration_field(::google::protobuf::Duration* value);
+  void unsafe_arena_set_allocated_duration_field(::google::protobuf::Duration* value);
+  ::google::protobuf::Duration* unsafe_arena_release_duration_field();
+
+  private:
+  const ::google::protobuf::Duration& _internal_duration_field() const;
+  ::google::protobuf::Duration* _internal_mutable_duration_field();
+
+  public:
+  // .google.protobuf.Empty empty_field = 4;
+  bool has_empty_field() const;
+  void clear_empty_field() ;
+  const ::google::protobuf::Empty& empty_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Empty* release_empty_field();
+  ::google::protobuf::Empty* mutable_empty_field();
+  void set_allocated_empty_field(::google::protobuf::Empty* value);
+  void unsafe_arena_set_allocated_empty_field(::google::protobuf::Empty* value);
+  ::google::protobuf::Empty* unsafe_arena_release_empty_field();
+
+  private:
+  const ::google::protobuf::Empty& _internal_empty_field() const;
+  ::google::protobuf::Empty* _internal_mutable_empty_field();
+
+  public:
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  bool has_field_mask_field() const;
+  void clear_field_mask_field() ;
+  const ::google::protobuf::FieldMask& field_mask_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FieldMask* release_field_mask_field();
+  ::google::protobuf::FieldMask* mutable_field_mask_field();
+  void set_allocated_field_mask_field(::google::protobuf::FieldMask* value);
+  void unsafe_arena_set_allocated_field_mask_field(::google::protobuf::FieldMask* value);
+  ::google::protobuf::FieldMask* unsafe_arena_release_field_mask_field();
+
+  private:
+  const ::google::protobuf::FieldMask& _internal_field_mask_field() const;
+  ::google::protobuf::FieldMask* _internal_mutable_field_mask_field();
+
+  public:
+  // .google.protobuf.SourceContext source_context_field = 6;
+  bool has_source_context_field() const;
+  void clear_source_context_field() ;
+  const ::google::protobuf::SourceContext& source_context_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::SourceContext* release_source_context_field();
+  ::google::protobuf::SourceContext* mutable_source_context_field();
+  void set_allocated_source_context_field(::google::protobuf::SourceContext* value);
+  void unsafe_arena_set_allocated_source_context_field(::google::protobuf::SourceContext* value);
+  ::google::protobuf::SourceContext* unsafe_arena_release_source_context_field();
+
+  private:
+  const ::google::protobuf::SourceContext& _internal_source_context_field() const;
+  ::google::protobuf::SourceContext* _internal_mutable_source_context_field();
+
+  public:
+  // .google.protobuf.Struct struct_field = 7;
+  bool has_struct_field() const;
+  void clear_struct_field() ;
+  const ::google::protobuf::Struct& struct_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Struct* release_struct_field();
+  ::google::protobuf::Struct* mutable_struct_field();
+  void set_allocated_struct_field(::google::protobuf::Struct* value);
+  void unsafe_arena_set_allocated_struct_field(::google::protobuf::Struct* value);
+  ::google::protobuf::Struct* unsafe_arena_release_struct_field();
+
+  private:
+  const ::google::protobuf::Struct& _internal_struct_field() const;
+  ::google::protobuf::Struct* _internal_mutable_struct_field();
+
+  public:
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  bool has_timestamp_field() const;
+  void clear_timestamp_field() ;
+  const ::google::protobuf::Timestamp& timestamp_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Timestamp* release_timestamp_field();
+  ::google::protobuf::Timestamp* mutable_timestamp_field();
+  void set_allocated_timestamp_field(::google::protobuf::Timestamp* value);
+  void unsafe_arena_set_allocated_timestamp_field(::google::protobuf::Timestamp* value);
+  ::google::protobuf::Timestamp* unsafe_arena_release_timestamp_field();
+
+  private:
+  const ::google::protobuf::Timestamp& _internal_timestamp_field() const;
+  ::google::protobuf::Timestamp* _internal_mutable_timestamp_field();
+
+  public:
+  // .google.protobuf.Type type_field = 9;
+  bool has_type_field() const;
+  void clear_type_field() ;
+  const ::google::protobuf::Type& type_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Type* release_type_field();
+  ::google::protobuf::Type* mutable_type_field();
+  void set_allocated_type_field(::google::protobuf::Type* value);
+  void unsafe_arena_set_allocated_type_field(::google::protobuf::Type* value);
+  ::google::protobuf::Type* unsafe_arena_release_type_field();
+
+  private:
+  const ::google::protobuf::Type& _internal_type_field() const;
+  ::google::protobuf::Type* _internal_mutable_type_field();
+
+  public:
+  // .google.protobuf.DoubleValue double_field = 10;
+  bool has_double_field() const;
+  void clear_double_field() ;
+  const ::google::protobuf::DoubleValue& double_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::DoubleValue* release_double_field();
+  ::google::protobuf::DoubleValue* mutable_double_field();
+  void set_allocated_double_field(::google::protobuf::DoubleValue* value);
+  void unsafe_arena_set_allocated_double_field(::google::protobuf::DoubleValue* value);
+  ::google::protobuf::DoubleValue* unsafe_arena_release_double_field();
+
+  private:
+  const ::google::protobuf::DoubleValue& _internal_double_field() const;
+  ::google::protobuf::DoubleValue* _internal_mutable_double_field();
+
+  public:
+  // .google.protobuf.FloatValue float_field = 11;
+  bool has_float_field() const;
+  void clear_float_field() ;
+  const ::google::protobuf::FloatValue& float_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FloatValue* release_float_field();
+  ::google::protobuf::FloatValue* mutable_float_field();
+  void set_allocated_float_field(::google::protobuf::FloatValue* value);
+  void unsafe_arena_set_allocated_float_field(::google::protobuf::FloatValue* value);
+  ::google::protobuf::FloatValue* unsafe_arena_release_float_field();
+
+  private:
+  const ::google::protobuf::FloatValue& _internal_float_field() const;
+  ::google::protobuf::FloatValue* _internal_mutable_float_field();
+
+  public:
+  // .google.protobuf.Int64Value int64_field = 12;
+  bool has_int64_field() const;
+  void clear_int64_field() ;
+  const ::google::protobuf::Int64Value& int64_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Int64Value* release_int64_field();
+  ::google::protobuf::Int64Value* mutable_int64_field();
+  void set_allocated_int64_field(::google::protobuf::Int64Value* value);
+  void unsafe_arena_set_allocated_int64_field(::google::protobuf::Int64Value* value);
+  ::google::protobuf::Int64Value* unsafe_arena_release_int64_field();
+
+  private:
+  const ::google::protobuf::Int64Value& _internal_int64_field() const;
+  ::google::protobuf::Int64Value* _internal_mutable_int64_field();
+
+  public:
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  bool has_uint64_field() const;
+  void clear_uint64_field() ;
+  const ::google::protobuf::UInt64Value& uint64_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::UInt64Value* release_uint64_field();
+  ::google::protobuf::UInt64Value* mutable_uint64_field();
+  void set_allocated_uint64_field(::google::protobuf::UInt64Value* value);
+  void unsafe_arena_set_allocated_uint64_field(::google::protobuf::UInt64Value* value);
+  ::google::protobuf::UInt64Value* unsafe_arena_release_uint64_field();
+
+  private:
+  const ::google::protobuf::UInt64Value& _internal_uint64_field() const;
+  ::google::protobuf::UInt64Value* _internal_mutable_uint64_field();
+
+  public:
+  // .google.protobuf.Int32Value int32_field = 14;
+  bool has_int32_field() const;
+  void clear_int32_field() ;
+  const ::google::protobuf::Int32Value& int32_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Int32Value* release_int32_field();
+  ::google::protobuf::Int32Value* mutable_int32_field();
+  void set_allocated_int32_field(::google::protobuf::Int32Value* value);
+  void unsafe_arena_set_allocated_int32_field(::google::protobuf::Int32Value* value);
+  ::google::protobuf::Int32Value* unsafe_arena_release_int32_field();
+
+  private:
+  const ::google::protobuf::Int32Value& _internal_int32_field() const;
+  ::google::protobuf::Int32Value* _internal_mutable_int32_field();
+
+  public:
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  bool has_uint32_field() const;
+  void clear_uint32_field() ;
+  const ::google::protobuf::UInt32Value& uint32_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::UInt32Value* release_uint32_field();
+  ::google::protobuf::UInt32Value* mutable_uint32_field();
+  void set_allocated_uint32_field(::google::protobuf::UInt32Value* value);
+  void unsafe_arena_set_allocated_uint32_field(::google::protobuf::UInt32Value* value);
+  ::google::protobuf::UInt32Value* unsafe_arena_release_uint32_field();
+
+  private:
+  const ::google::protobuf::UInt32Value& _internal_uint32_field() const;
+  ::google::protobuf::UInt32Value* _internal_mutable_uint32_field();
+
+  public:
+  // .google.protobuf.BoolValue bool_field = 16;
+  bool has_bool_field() const;
+  void clear_bool_field() ;
+  const ::google::protobuf::BoolValue& bool_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::BoolValue* release_bool_field();
+  ::google::protobuf::BoolValue* mutable_bool_field();
+  void set_allocated_bool_field(::google::protobuf::BoolValue* value);
+  void unsafe_arena_set_allocated_bool_field(::google::protobuf::BoolValue* value);
+  ::google::protobuf::BoolValue* unsafe_arena_release_bool_field();
+
+  private:
+  const ::google::protobuf::BoolValue& _internal_bool_field() const;
+  ::google::protobuf::BoolValue* _internal_mutable_bool_field();
+
+  public:
+  // .google.protobuf.StringValue string_field = 17;
+  bool has_string_field() const;
+  void clear_string_field() ;
+  const ::google::protobuf::StringValue& string_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::StringValue* release_string_field();
+  ::google::protobuf::StringValue* mutable_string_field();
+  void set_allocated_string_field(::google::protobuf::StringValue* value);
+  void unsafe_arena_set_allocated_string_field(::google::protobuf::StringValue* value);
+  ::google::protobuf::StringValue* unsafe_arena_release_string_field();
+
+  private:
+  const ::google::protobuf::StringValue& _internal_string_field() const;
+  ::google::protobuf::StringValue* _internal_mutable_string_field();
+
+  public:
+  // .google.protobuf.BytesValue bytes_field = 18;
+  bool has_bytes_field() const;
+  void clear_bytes_field() ;
+  const ::google::protobuf::BytesValue& bytes_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::BytesValue* release_bytes_field();
+  ::google::protobuf::BytesValue* mutable_bytes_field();
+  void set_allocated_bytes_field(::google::protobuf::BytesValue* value);
+  void unsafe_arena_set_allocated_bytes_field(::google::protobuf::BytesValue* value);
+  ::google::protobuf::BytesValue* unsafe_arena_release_bytes_field();
+
+  private:
+  const ::google::protobuf::BytesValue& _internal_bytes_field() const;
+  ::google::protobuf::BytesValue* _internal_mutable_bytes_field();
+
+  public:
+  // .google.protobuf.Value value_field = 19;
+  bool has_value_field() const;
+  void clear_value_field() ;
+  const ::google::protobuf::Value& value_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Value* release_value_field();
+  ::google::protobuf::Value* mutable_value_field();
+  void set_allocated_value_field(::google::protobuf::Value* value);
+  void unsafe_arena_set_allocated_value_field(::google::protobuf::Value* value);
+  ::google::protobuf::Value* unsafe_arena_release_value_field();
+
+  private:
+  const ::google::protobuf::Value& _internal_value_field() const;
+  ::google::protobuf::Value* _internal_mutable_value_field();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestWellKnownTypes)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 19, 19,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::Any* any_field_;
+    ::google::protobuf::Api* api_field_;
+    ::google::protobuf::Duration* duration_field_;
+    ::google::protobuf::Empty* empty_field_;
+    ::google::protobuf::FieldMask* field_mask_field_;
+    ::google::protobuf::SourceContext* source_context_field_;
+    ::google::protobuf::Struct* struct_field_;
+    ::google::protobuf::Timestamp* timestamp_field_;
+    ::google::protobuf::Type* type_field_;
+    ::google::protobuf::DoubleValue* double_field_;
+    ::google::protobuf::FloatValue* float_field_;
+    ::google::protobuf::Int64Value* int64_field_;
+    ::google::protobuf::UInt64Value* uint64_field_;
+    ::google::protobuf::Int32Value* int32_field_;
+    ::google::protobuf::UInt32Value* uint32_field_;
+    ::google::protobuf::BoolValue* bool_field_;
+    ::google::protobuf::StringValue* string_field_;
+    ::google::protobuf::BytesValue* bytes_field_;
+    ::google::protobuf::Value* value_field_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};// -------------------------------------------------------------------
+
+class RepeatedWellKnownTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.RepeatedWellKnownTypes) */ {
+ public:
+  inline RepeatedWellKnownTypes() : RepeatedWellKnownTypes(nullptr) {}
+  ~RepeatedWellKnownTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR RepeatedWellKnownTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline RepeatedWellKnownTypes(const RepeatedWellKnownTypes& from)
+      : RepeatedWellKnownTypes(nullptr, from) {}
+  RepeatedWellKnownTypes(RepeatedWellKnownTypes&& from) noexcept
+    : RepeatedWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline RepeatedWellKnownTypes& operator=(const RepeatedWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RepeatedWellKnownTypes& operator=(RepeatedWellKnownTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RepeatedWellKnownTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RepeatedWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const RepeatedWellKnownTypes*>(
+               &_RepeatedWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RepeatedWellKnownTypes& a, RepeatedWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RepeatedWellKnownTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RepeatedWellKnownTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RepeatedWellKnownTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RepeatedWellKnownTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const RepeatedWellKnownTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const RepeatedWellKnownTypes& from) {
+    RepeatedWellKnownTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(RepeatedWellKnownTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.RepeatedWellKnownTypes";
+  }
+  protected:
+  explicit RepeatedWellKnownTypes(::google::protobuf::Arena* arena);
+  RepeatedWellKnownTypes(::google::protobuf::Arena* arena, const RepeatedWellKnownTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnyFieldFieldNumber = 1,
+    kApiFieldFieldNumber = 2,
+    kDurationFieldFieldNumber = 3,
+    kEmptyFieldFieldNumber = 4,
+    kFieldMaskFieldFieldNumber = 5,
+    kSourceContextFieldFieldNumber = 6,
+    kStructFieldFieldNumber = 7,
+    kTimestampFieldFieldNumber = 8,
+    kTypeFieldFieldNumber = 9,
+    kDoubleFieldFieldNumber = 10,
+    kFloatFieldFieldNumber = 11,
+    kInt64FieldFieldNumber = 12,
+    kUint64FieldFieldNumber = 13,
+    kInt32FieldFieldNumber = 14,
+    kUint32FieldFieldNumber = 15,
+    kBoolFieldFieldNumber = 16,
+    kStringFieldFieldNumber = 17,
+    kBytesFieldFieldNumber = 18,
+  };
+  // repeated .google.protobuf.Any any_field = 1;
+  int any_field_size() const;
+  private:
+  int _internal_any_field_size() const;
+
+  public:
+  void clear_any_field() ;
+  ::google::protobuf::Any* mutable_any_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any >*
+      mutable_any_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>& _internal_any_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>* _internal_mutable_any_field();
+  public:
+  const ::google::protobuf::Any& any_field(int index) const;
+  ::google::protobuf::Any* add_any_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any >&
+      any_field() const;
+  // repeated .google.protobuf.Api api_field = 2;
+  int api_field_size() const;
+  private:
+  int _internal_api_field_size() const;
+
+  public:
+  void clear_api_field() ;
+  ::google::protobuf::Api* mutable_api_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Api >*
+      mutable_api_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Api>& _internal_api_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Api>* _internal_mutable_api_field();
+  public:
+  const ::google::protobuf::Api& api_field(int index) const;
+  ::google::protobuf::Api* add_api_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Api >&
+      api_field() const;
+  // repeated .google.protobuf.Duration duration_field = 3;
+  int duration_field_size() const;
+  private:
+  int _internal_duration_field_size() const;
+
+  public:
+  void clear_duration_field() ;
+  ::google::protobuf::Duration* mutable_duration_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Duration >*
+      mutable_duration_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>& _internal_duration_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>* _internal_mutable_duration_field();
+  public:
+  const ::google::protobuf::Duration& duration_field(int index) const;
+  ::google::protobuf::Duration* add_duration_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Duration >&
+      duration_field() const;
+  // repeated .google.protobuf.Empty empty_field = 4;
+  int empty_field_size() const;
+  private:
+  int _internal_empty_field_size() const;
+
+  public:
+  void clear_empty_field() ;
+  ::google::protobuf::Empty* mutable_empty_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Empty >*
+      mutable_empty_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Empty>& _internal_empty_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Empty>* _internal_mutable_empty_field();
+  public:
+  const ::google::protobuf::Empty& empty_field(int index) const;
+  ::google::protobuf::Empty* add_empty_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Empty >&
+      empty_field() const;
+  // repeated .google.protobuf.FieldMask field_mask_field = 5;
+  int field_mask_field_size() const;
+  private:
+  int _internal_field_mask_field_size() const;
+
+  public:
+  void clear_field_mask_field() ;
+  ::google::protobuf::FieldMask* mutable_field_mask_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::FieldMask >*
+      mutable_field_mask_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::FieldMask>& _internal_field_mask_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::FieldMask>* _internal_mutable_field_mask_field();
+  public:
+  const ::google::protobuf::FieldMask& field_mask_field(int index) const;
+  ::google::protobuf::FieldMask* add_field_mask_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::FieldMask >&
+      field_mask_field() const;
+  // repeated .google.protobuf.SourceContext source_context_field = 6;
+  int source_context_field_size() const;
+  private:
+  int _internal_source_context_field_size() const;
+
+  public:
+  void clear_source_context_field() ;
+  ::google::protobuf::SourceContext* mutable_source_context_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::SourceContext >*
+      mutable_source_context_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::SourceContext>& _internal_source_context_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::SourceContext>* _internal_mutable_source_context_field();
+  public:
+  const ::google::protobuf::SourceContext& source_context_field(int index) const;
+  ::google::protobuf::SourceContext* add_source_context_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::SourceContext >&
+      source_context_field() const;
+  // repeated .google.protobuf.Struct struct_field = 7;
+  int struct_field_size() const;
+  private:
+  int _internal_struct_field_size() const;
+
+  public:
+  void clear_struct_field() ;
+  ::google::protobuf::Struct* mutable_struct_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Struct >*
+      mutable_struct_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>& _internal_struct_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>* _internal_mutable_struct_field();
+  public:
+  const ::google::protobuf::Struct& struct_field(int index) const;
+  ::google::protobuf::Struct* add_struct_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Struct >&
+      struct_field() const;
+  // repeated .google.protobuf.Timestamp timestamp_field = 8;
+  int timestamp_field_size() const;
+  private:
+  int _internal_timestamp_field_size() const;
+
+  public:
+  void clear_timestamp_field() ;
+  ::google::protobuf::Timestamp* mutable_timestamp_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Timestamp >*
+      mutable_timestamp_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>& _internal_timestamp_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>* _internal_mutable_timestamp_field();
+  public:
+  const ::google::protobuf::Timestamp& timestamp_field(int index) const;
+  ::google::protobuf::Timestamp* add_timestamp_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Timestamp >&
+      timestamp_field() const;
+  // repeated .google.protobuf.Type type_field = 9;
+  int type_field_size() const;
+  private:
+  int _internal_type_field_size() const;
+
+  public:
+  void clear_type_field() ;
+  ::google::protobuf::Type* mutable_type_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Type >*
+      mutable_type_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Type>& _internal_type_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Type>* _internal_mutable_type_field();
+  public:
+  const ::google::protobuf::Type& type_field(int index) const;
+  ::google::protobuf::Type* add_type_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Type >&
+      type_field() const;
+  // repeated .google.protobuf.DoubleValue double_field = 10;
+  int double_field_size() const;
+  private:
+  int _internal_double_field_size() const;
+
+  public:
+  void clear_double_field() ;
+  ::google::protobuf::DoubleValue* mutable_double_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::DoubleValue >*
+      mutable_double_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>& _internal_double_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>* _internal_mutable_double_field();
+  public:
+  const ::google::protobuf::DoubleValue& double_field(int index) const;
+  ::google::protobuf::DoubleValue* add_double_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::DoubleValue >&
+      double_field() const;
+  // repeated .google.protobuf.FloatValue float_field = 11;
+  int float_field_size() const;
+  private:
+  int _internal_float_field_size() const;
+
+  public:
+  void clear_float_field() ;
+  ::google::protobuf::FloatValue* mutable_float_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::FloatValue >*
+      mutable_float_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>& _internal_float_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>* _internal_mutable_float_field();
+  public:
+  const ::google::protobuf::FloatValue& float_field(int index) const;
+  ::google::protobuf::FloatValue* add_float_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::FloatValue >&
+      float_field() const;
+  // repeated .google.protobuf.Int64Value int64_field = 12;
+  int int64_field_size() const;
+  private:
+  int _internal_int64_field_size() const;
+
+  public:
+  void clear_int64_field() ;
+  ::google::protobuf::Int64Value* mutable_int64_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int64Value >*
+      mutable_int64_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>& _internal_int64_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>* _internal_mutable_int64_field();
+  public:
+  const ::google::protobuf::Int64Value& int64_field(int index) const;
+  ::google::protobuf::Int64Value* add_int64_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int64Value >&
+      int64_field() const;
+  // repeated .google.protobuf.UInt64Value uint64_field = 13;
+  int uint64_field_size() const;
+  private:
+  int _internal_uint64_field_size() const;
+
+  public:
+  void clear_uint64_field() ;
+  ::google::protobuf::UInt64Value* mutable_uint64_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt64Value >*
+      mutable_uint64_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>& _internal_uint64_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>* _internal_mutable_uint64_field();
+  public:
+  const ::google::protobuf::UInt64Value& uint64_field(int index) const;
+  ::google::protobuf::UInt64Value* add_uint64_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt64Value >&
+      uint64_field() const;
+  // repeated .google.protobuf.Int32Value int32_field = 14;
+  int int32_field_size() const;
+  private:
+  int _internal_int32_field_size() const;
+
+  public:
+  void clear_int32_field() ;
+  ::google::protobuf::Int32Value* mutable_int32_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int32Value >*
+      mutable_int32_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>& _internal_int32_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>* _internal_mutable_int32_field();
+  public:
+  const ::google::protobuf::Int32Value& int32_field(int index) const;
+  ::google::protobuf::Int32Value* add_int32_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int32Value >&
+      int32_field() const;
+  // repeated .google.protobuf.UInt32Value uint32_field = 15;
+  int uint32_field_size() const;
+  private:
+  int _internal_uint32_field_size() const;
+
+  public:
+  void clear_uint32_field() ;
+  ::google::protobuf::UInt32Value* mutable_uint32_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt32Value >*
+      mutable_uint32_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>& _internal_uint32_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>* _internal_mutable_uint32_field();
+  public:
+  const ::google::protobuf::UInt32Value& uint32_field(int index) const;
+  ::google::protobuf::UInt32Value* add_uint32_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt32Value >&
+      uint32_field() const;
+  // repeated .google.protobuf.BoolValue bool_field = 16;
+  int bool_field_size() const;
+  private:
+  int _internal_bool_field_size() const;
+
+  public:
+  void clear_bool_field() ;
+  ::google::protobuf::BoolValue* mutable_bool_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::BoolValue >*
+      mutable_bool_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>& _internal_bool_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>* _internal_mutable_bool_field();
+  public:
+  const ::google::protobuf::BoolValue& bool_field(int index) const;
+  ::google::protobuf::BoolValue* add_bool_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::BoolValue >&
+      bool_field() const;
+  // repeated .google.protobuf.StringValue string_field = 17;
+  int string_field_size() const;
+  private:
+  int _internal_string_field_size() const;
+
+  public:
+  void clear_string_field() ;
+  ::google::protobuf::StringValue* mutable_string_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::StringValue >*
+      mutable_string_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>& _internal_string_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>* _internal_mutable_string_field();
+  public:
+  const ::google::protobuf::StringValue& string_field(int index) const;
+  ::google::protobuf::StringValue* add_string_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::StringValue >&
+      string_field() const;
+  // repeated .google.protobuf.BytesValue bytes_field = 18;
+  int bytes_field_size() const;
+  private:
+  int _internal_bytes_field_size() const;
+
+  public:
+  void clear_bytes_field() ;
+  ::google::protobuf::BytesValue* mutable_bytes_field(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::BytesValue >*
+      mutable_bytes_field();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>& _internal_bytes_field() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>* _internal_mutable_bytes_field();
+  public:
+  const ::google::protobuf::BytesValue& bytes_field(int index) const;
+  ::google::protobuf::BytesValue* add_bytes_field();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::BytesValue >&
+      bytes_field() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.RepeatedWellKnownTypes)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 18, 18,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any > any_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Api > api_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Duration > duration_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Empty > empty_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::FieldMask > field_mask_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::SourceContext > source_context_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Struct > struct_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Timestamp > timestamp_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Type > type_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::DoubleValue > double_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::FloatValue > float_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int64Value > int64_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt64Value > uint64_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int32Value > int32_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt32Value > uint32_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::BoolValue > bool_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::StringValue > string_field_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::BytesValue > bytes_field_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};// -------------------------------------------------------------------
+
+class OneofWellKnownTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.OneofWellKnownTypes) */ {
+ public:
+  inline OneofWellKnownTypes() : OneofWellKnownTypes(nullptr) {}
+  ~OneofWellKnownTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR OneofWellKnownTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline OneofWellKnownTypes(const OneofWellKnownTypes& from)
+      : OneofWellKnownTypes(nullptr, from) {}
+  OneofWellKnownTypes(OneofWellKnownTypes&& from) noexcept
+    : OneofWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline OneofWellKnownTypes& operator=(const OneofWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OneofWellKnownTypes& operator=(OneofWellKnownTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OneofWellKnownTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofFieldCase {
+    kAnyField = 1,
+    kApiField = 2,
+    kDurationField = 3,
+    kEmptyField = 4,
+    kFieldMaskField = 5,
+    kSourceContextField = 6,
+    kStructField = 7,
+    kTimestampField = 8,
+    kTypeField = 9,
+    kDoubleField = 10,
+    kFloatField = 11,
+    kInt64Field = 12,
+    kUint64Field = 13,
+    kInt32Field = 14,
+    kUint32Field = 15,
+    kBoolField = 16,
+    kStringField = 17,
+    kBytesField = 18,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static inline const OneofWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const OneofWellKnownTypes*>(
+               &_OneofWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(OneofWellKnownTypes& a, OneofWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OneofWellKnownTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OneofWellKnownTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OneofWellKnownTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OneofWellKnownTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const OneofWellKnownTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const OneofWellKnownTypes& from) {
+    OneofWellKnownTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(OneofWellKnownTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.OneofWellKnownTypes";
+  }
+  protected:
+  explicit OneofWellKnownTypes(::google::protobuf::Arena* arena);
+  OneofWellKnownTypes(::google::protobuf::Arena* arena, const OneofWellKnownTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnyFieldFieldNumber = 1,
+    kApiFieldFieldNumber = 2,
+    kDurationFieldFieldNumber = 3,
+    kEmptyFieldFieldNumber = 4,
+    kFieldMaskFieldFieldNumber = 5,
+    kSourceContextFieldFieldNumber = 6,
+    kStructFieldFieldNumber = 7,
+    kTimestampFieldFieldNumber = 8,
+    kTypeFieldFieldNumber = 9,
+    kDoubleFieldFieldNumber = 10,
+    kFloatFieldFieldNumber = 11,
+    kInt64FieldFieldNumber = 12,
+    kUint64FieldFieldNumber = 13,
+    kInt32FieldFieldNumber = 14,
+    kUint32FieldFieldNumber = 15,
+    kBoolFieldFieldNumber = 16,
+    kStringFieldFieldNumber = 17,
+    kBytesFieldFieldNumber = 18,
+  };
+  // .google.protobuf.Any any_field = 1;
+  bool has_any_field() const;
+  private:
+  bool _internal_has_any_field() const;
+
+  public:
+  void clear_any_field() ;
+  const ::google::protobuf::Any& any_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Any* release_any_field();
+  ::google::protobuf::Any* mutable_any_field();
+  void set_allocated_any_field(::google::protobuf::Any* value);
+  void unsafe_arena_set_allocated_any_field(::google::protobuf::Any* value);
+  ::google::protobuf::Any* unsafe_arena_release_any_field();
+
+  private:
+  const ::google::protobuf::Any& _internal_any_field() const;
+  ::google::protobuf::Any* _internal_mutable_any_field();
+
+  public:
+  // .google.protobuf.Api api_field = 2;
+  bool has_api_field() const;
+  private:
+  bool _internal_has_api_field() const;
+
+  public:
+  void clear_api_field() ;
+  const ::google::protobuf::Api& api_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Api* release_api_field();
+  ::google::protobuf::Api* mutable_api_field();
+  void set_allocated_api_field(::google::protobuf::Api* value);
+  void unsafe_arena_set_allocated_api_field(::google::protobuf::Api* value);
+  ::google::protobuf::Api* unsafe_arena_release_api_field();
+
+  private:
+  const ::google::protobuf::Api& _internal_api_field() const;
+  ::google::protobuf::Api* _internal_mutable_api_field();
+
+  public:
+  // .google.protobuf.Duration duration_field = 3;
+  bool has_duration_field() const;
+  private:
+  bool _internal_has_duration_field() const;
+
+  public:
+  void clear_duration_field() ;
+  const ::google::protobuf::Duration& duration_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Duration* release_duration_field();
+  ::google::protobuf::Duration* mutable_duration_field();
+  void set_allocated_duration_field(::google::protobuf::Duration* value);
+  void unsafe_arena_set_allocated_duration_field(::google::protobuf::Duration* value);
+  ::google::protobuf::Duration* unsafe_arena_release_duration_field();
+
+  private:
+  const ::google::protobuf::Duration& _internal_duration_field() const;
+  ::google::protobuf::Duration* _internal_mutable_duration_field();
+
+  public:
+  // .google.protobuf.Empty empty_field = 4;
+  bool has_empty_field() const;
+  private:
+  bool _internal_has_empty_field() const;
+
+  public:
+  void clear_empty_field() ;
+  const ::google::protobuf::Empty& empty_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Empty* release_empty_field();
+  ::google::protobuf::Empty* mutable_empty_field();
+  void set_allocated_empty_field(::google::protobuf::Empty* value);
+  void unsafe_arena_set_allocated_empty_field(::google::protobuf::Empty* value);
+  ::google::protobuf::Empty* unsafe_arena_release_empty_field();
+
+  private:
+  const ::google::protobuf::Empty& _internal_empty_field() const;
+  ::google::protobuf::Empty* _internal_mutable_empty_field();
+
+  public:
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  bool has_field_mask_field() const;
+  private:
+  bool _internal_has_field_mask_field() const;
+
+  public:
+  void clear_field_mask_field() ;
+  const ::google::protobuf::FieldMask& field_mask_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FieldMask* release_field_mask_field();
+  ::google::protobuf::FieldMask* mutable_field_mask_field();
+  void set_allocated_field_mask_field(::google::protobuf::FieldMask* value);
+  void unsafe_arena_set_allocated_field_mask_field(::google::protobuf::FieldMask* value);
+  ::google::protobuf::FieldMask* unsafe_arena_release_field_mask_field();
+
+  private:
+  const ::google::protobuf::FieldMask& _internal_field_mask_field() const;
+  ::google::protobuf::FieldMask* _internal_mutable_field_mask_field();
+
+  public:
+  // .google.protobuf.SourceContext source_context_field = 6;
+  bool has_source_context_field() const;
+  private:
+  bool _internal_has_source_context_field() const;
+
+  public:
+  void clear_source_context_field() ;
+  const ::google::protobuf::SourceContext& source_context_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::SourceContext* release_source_context_field();
+  ::google::protobuf::SourceContext* mutable_source_context_field();
+  void set_allocated_source_context_field(::google::protobuf::SourceContext* value);
+  void unsafe_arena_set_allocated_source_context_field(::google::protobuf::SourceContext* value);
+  ::google::protobuf::SourceContext* unsafe_arena_release_source_context_field();
+
+  private:
+  const ::google::protobuf::SourceContext& _internal_source_context_field() const;
+  ::google::protobuf::SourceContext* _internal_mutable_source_context_field();
+
+  public:
+  // .google.protobuf.Struct struct_field = 7;
+  bool has_struct_field() const;
+  private:
+  bool _internal_has_struct_field() const;
+
+  public:
+  void clear_struct_field() ;
+  const ::google::protobuf::Struct& struct_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Struct* release_struct_field();
+  ::google::protobuf::Struct* mutable_struct_field();
+  void set_allocated_struct_field(::google::protobuf::Struct* value);
+  void unsafe_arena_set_allocated_struct_field(::google::protobuf::Struct* value);
+  ::google::protobuf::Struct* unsafe_arena_release_struct_field();
+
+  private:
+  const ::google::protobuf::Struct& _internal_struct_field() const;
+  ::google::protobuf::Struct* _internal_mutable_struct_field();
+
+  public:
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  bool has_timestamp_field() const;
+  private:
+  bool _internal_has_timestamp_field() const;
+
+  public:
+  void clear_timestamp_field() ;
+  const ::google::protobuf::Timestamp& timestamp_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Timestamp* release_timestamp_field();
+  ::google::protobuf::Timestamp* mutable_timestamp_field();
+  void set_allocated_timestamp_field(::google::protobuf::Timestamp* value);
+  void unsafe_arena_set_allocated_timestamp_field(::google::protobuf::Timestamp* value);
+  ::google::protobuf::Timestamp* unsafe_arena_release_timestamp_field();
+
+  private:
+  const ::google::protobuf::Timestamp& _internal_timestamp_field() const;
+  ::google::protobuf::Timestamp* _internal_mutable_timestamp_field();
+
+  public:
+  // .google.protobuf.Type type_field = 9;
+  bool has_type_field() const;
+  private:
+  bool _internal_has_type_field() const;
+
+  public:
+  void clear_type_field() ;
+  const ::google::protobuf::Type& type_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Type* release_type_field();
+  ::google::protobuf::Type* mutable_type_field();
+  void set_allocated_type_field(::google::protobuf::Type* value);
+  void unsafe_arena_set_allocated_type_field(::google::protobuf::Type* value);
+  ::google::protobuf::Type* unsafe_arena_release_type_field();
+
+  private:
+  const ::google::protobuf::Type& _internal_type_field() const;
+  ::google::protobuf::Type* _internal_mutable_type_field();
+
+  public:
+  // .google.protobuf.DoubleValue double_field = 10;
+  bool has_double_field() const;
+  private:
+  bool _internal_has_double_field() const;
+
+  public:
+  void clear_double_field() ;
+  const ::google::protobuf::DoubleValue& double_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::DoubleValue* release_double_field();
+  ::google::protobuf::DoubleValue* mutable_double_field();
+  void set_allocated_double_field(::google::protobuf::DoubleValue* value);
+  void unsafe_arena_set_allocated_double_field(::google::protobuf::DoubleValue* value);
+  ::google::protobuf::DoubleValue* unsafe_arena_release_double_field();
+
+  private:
+  const ::google::protobuf::DoubleValue& _internal_double_field() const;
+  ::google::protobuf::DoubleValue* _internal_mutable_double_field();
+
+  public:
+  // .google.protobuf.FloatValue float_field = 11;
+  bool has_float_field() const;
+  private:
+  bool _internal_has_float_field() const;
+
+  public:
+  void clear_float_field() ;
+  const ::google::protobuf::FloatValue& float_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FloatValue* release_float_field();
+  ::google::protobuf::FloatValue* mutable_float_field();
+  void set_allocated_float_field(::google::protobuf::FloatValue* value);
+  void unsafe_arena_set_allocated_float_field(::google::protobuf::FloatValue* value);
+  ::google::protobuf::FloatValue* unsafe_arena_release_float_field();
+
+  private:
+  const ::google::protobuf::FloatValue& _internal_float_field() const;
+  ::google::protobuf::FloatValue* _internal_mutable_float_field();
+
+  public:
+  // .google.protobuf.Int64Value int64_field = 12;
+  bool has_int64_field() const;
+  private:
+  bool _internal_has_int64_field() const;
+
+  public:
+  void clear_int64_field() ;
+  const ::google::protobuf::Int64Value& int64_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Int64Value* release_int64_field();
+  ::google::protobuf::Int64Value* mutable_int64_field();
+  void set_allocated_int64_field(::google::protobuf::Int64Value* value);
+  void unsafe_arena_set_allocated_int64_field(::google::protobuf::Int64Value* value);
+  ::google::protobuf::Int64Value* unsafe_arena_release_int64_field();
+
+  private:
+  const ::google::protobuf::Int64Value& _internal_int64_field() const;
+  ::google::protobuf::Int64Value* _internal_mutable_int64_field();
+
+  public:
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  bool has_uint64_field() const;
+  private:
+  bool _internal_has_uint64_field() const;
+
+  public:
+  void clear_uint64_field() ;
+  const ::google::protobuf::UInt64Value& uint64_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::UInt64Value* release_uint64_field();
+  ::google::protobuf::UInt64Value* mutable_uint64_field();
+  void set_allocated_uint64_field(::google::protobuf::UInt64Value* value);
+  void unsafe_arena_set_allocated_uint64_field(::google::protobuf::UInt64Value* value);
+  ::google::protobuf::UInt64Value* unsafe_arena_release_uint64_field();
+
+  private:
+  const ::google::protobuf::UInt64Value& _internal_uint64_field() const;
+  ::google::protobuf::UInt64Value* _internal_mutable_uint64_field();
+
+  public:
+  // .google.protobuf.Int32Value int32_field = 14;
+  bool has_int32_field() const;
+  private:
+  bool _internal_has_int32_field() const;
+
+  public:
+  void clear_int32_field() ;
+  const ::google::protobuf::Int32Value& int32_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Int32Value* release_int32_field();
+  ::google::protobuf::Int32Value* mutable_int32_field();
+  void set_allocated_int32_field(::google::protobuf::Int32Value* value);
+  void unsafe_arena_set_allocated_int32_field(::google::protobuf::Int32Value* value);
+  ::google::protobuf::Int32Value* unsafe_arena_release_int32_field();
+
+  private:
+  const ::google::protobuf::Int32Value& _internal_int32_field() const;
+  ::google::protobuf::Int32Value* _internal_mutable_int32_field();
+
+  public:
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  bool has_uint32_field() const;
+  private:
+  bool _internal_has_uint32_field() const;
+
+  public:
+  void clear_uint32_field() ;
+  const ::google::protobuf::UInt32Value& uint32_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::UInt32Value* release_uint32_field();
+  ::google::protobuf::UInt32Value* mutable_uint32_field();
+  void set_allocated_uint32_field(::google::protobuf::UInt32Value* value);
+  void unsafe_arena_set_allocated_uint32_field(::google::protobuf::UInt32Value* value);
+  ::google::protobuf::UInt32Value* unsafe_arena_release_uint32_field();
+
+  private:
+  const ::google::protobuf::UInt32Value& _internal_uint32_field() const;
+  ::google::protobuf::UInt32Value* _internal_mutable_uint32_field();
+
+  public:
+  // .google.protobuf.BoolValue bool_field = 16;
+  bool has_bool_field() const;
+  private:
+  bool _internal_has_bool_field() const;
+
+  public:
+  void clear_bool_field() ;
+  const ::google::protobuf::BoolValue& bool_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::BoolValue* release_bool_field();
+  ::google::protobuf::BoolValue* mutable_bool_field();
+  void set_allocated_bool_field(::google::protobuf::BoolValue* value);
+  void unsafe_arena_set_allocated_bool_field(::google::protobuf::BoolValue* value);
+  ::google::protobuf::BoolValue* unsafe_arena_release_bool_field();
+
+  private:
+  const ::google::protobuf::BoolValue& _internal_bool_field() const;
+  ::google::protobuf::BoolValue* _internal_mutable_bool_field();
+
+  public:
+  // .google.protobuf.StringValue string_field = 17;
+  bool has_string_field() const;
+  private:
+  bool _internal_has_string_field() const;
+
+  public:
+  void clear_string_field() ;
+  const ::google::protobuf::StringValue& string_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::StringValue* release_string_field();
+  ::google::protobuf::StringValue* mutable_string_field();
+  void set_allocated_string_field(::google::protobuf::StringValue* value);
+  void unsafe_arena_set_allocated_string_field(::google::protobuf::StringValue* value);
+  ::google::protobuf::StringValue* unsafe_arena_release_string_field();
+
+  private:
+  const ::google::protobuf::StringValue& _internal_string_field() const;
+  ::google::protobuf::StringValue* _internal_mutable_string_field();
+
+  public:
+  // .google.protobuf.BytesValue bytes_field = 18;
+  bool has_bytes_field() const;
+  private:
+  bool _internal_has_bytes_field() const;
+
+  public:
+  void clear_bytes_field() ;
+  const ::google::protobuf::BytesValue& bytes_field() const;
+  PROTOBUF_NODISCARD ::google::protobuf::BytesValue* release_bytes_field();
+  ::google::protobuf::BytesValue* mutable_bytes_field();
+  void set_allocated_bytes_field(::google::protobuf::BytesValue* value);
+  void unsafe_arena_set_allocated_bytes_field(::google::protobuf::BytesValue* value);
+  ::google::protobuf::BytesValue* unsafe_arena_release_bytes_field();
+
+  private:
+  const ::google::protobuf::BytesValue& _internal_bytes_field() const;
+  ::google::protobuf::BytesValue* _internal_mutable_bytes_field();
+
+  public:
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.OneofWellKnownTypes)
+ private:
+  class _Internal;
+  void set_has_any_field();
+  void set_has_api_field();
+  void set_has_duration_field();
+  void set_has_empty_field();
+  void set_has_field_mask_field();
+  void set_has_source_context_field();
+  void set_has_struct_field();
+  void set_has_timestamp_field();
+  void set_has_type_field();
+  void set_has_double_field();
+  void set_has_float_field();
+  void set_has_int64_field();
+  void set_has_uint64_field();
+  void set_has_int32_field();
+  void set_has_uint32_field();
+  void set_has_bool_field();
+  void set_has_string_field();
+  void set_has_bytes_field();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 18, 18,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    union OneofFieldUnion {
+      constexpr OneofFieldUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::google::protobuf::Any* any_field_;
+      ::google::protobuf::Api* api_field_;
+      ::google::protobuf::Duration* duration_field_;
+      ::google::protobuf::Empty* empty_field_;
+      ::google::protobuf::FieldMask* field_mask_field_;
+      ::google::protobuf::SourceContext* source_context_field_;
+      ::google::protobuf::Struct* struct_field_;
+      ::google::protobuf::Timestamp* timestamp_field_;
+      ::google::protobuf::Type* type_field_;
+      ::google::protobuf::DoubleValue* double_field_;
+      ::google::protobuf::FloatValue* float_field_;
+      ::google::protobuf::Int64Value* int64_field_;
+      ::google::protobuf::UInt64Value* uint64_field_;
+      ::google::protobuf::Int32Value* int32_field_;
+      ::google::protobuf::UInt32Value* uint32_field_;
+      ::google::protobuf::BoolValue* bool_field_;
+      ::google::protobuf::StringValue* string_field_;
+      ::google::protobuf::BytesValue* bytes_field_;
+    } oneof_field_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};// -------------------------------------------------------------------
+
+class MapWellKnownTypes_TypeFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_TypeFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Type,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_TypeFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Type,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_TypeFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_TypeFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_TypeFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_TypeFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_TypeFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_ApiFieldEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapWellKnownTypes_ApiFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Api,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapWellKnownTypes_ApiFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Api,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapWellKnownTypes_ApiFieldEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes_ApiFieldEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapWellKnownTypes_ApiFieldEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapWellKnownTypes_ApiFieldEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes_ApiFieldEntry_DoNotUse*>(
+        &_MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.MapWellKnownTypes) */ {
+ public:
+  inline MapWellKnownTypes() : MapWellKnownTypes(nullptr) {}
+  ~MapWellKnownTypes() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapWellKnownTypes(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapWellKnownTypes(const MapWellKnownTypes& from)
+      : MapWellKnownTypes(nullptr, from) {}
+  MapWellKnownTypes(MapWellKnownTypes&& from) noexcept
+    : MapWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline MapWellKnownTypes& operator=(const MapWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapWellKnownTypes& operator=(MapWellKnownTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapWellKnownTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes*>(
+               &_MapWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(MapWellKnownTypes& a, MapWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapWellKnownTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapWellKnownTypes* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapWellKnownTypes* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapWellKnownTypes>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapWellKnownTypes& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapWellKnownTypes& from) {
+    MapWellKnownTypes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapWellKnownTypes* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "protobuf_unittest.MapWellKnownTypes";
+  }
+  protected:
+  explicit MapWellKnownTypes(::google::protobuf::Arena* arena);
+  MapWellKnownTypes(::google::protobuf::Arena* arena, const MapWellKnownTypes& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnyFieldFieldNumber = 1,
+    kApiFieldFieldNumber = 2,
+    kDurationFieldFieldNumber = 3,
+    kEmptyFieldFieldNumber = 4,
+    kFieldMaskFieldFieldNumber = 5,
+    kSourceContextFieldFieldNumber = 6,
+    kStructFieldFieldNumber = 7,
+    kTimestampFieldFieldNumber = 8,
+    kTypeFieldFieldNumber = 9,
+    kDoubleFieldFieldNumber = 10,
+    kFloatFieldFieldNumber = 11,
+    kInt64FieldFieldNumber = 12,
+    kUint64FieldFieldNumber = 13,
+    kInt32FieldFieldNumber = 14,
+    kUint32FieldFieldNumber = 15,
+    kBoolFieldFieldNumber = 16,
+    kStringFieldFieldNumber = 17,
+    kBytesFieldFieldNumber = 18,
+  };
+  // map<int32, .google.protobuf.Any> any_field = 1;
+  int any_field_size() const;
+  private:
+  int _internal_any_field_size() const;
+
+  public:
+  void clear_any_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>& any_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>* mutable_any_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>& _internal_any_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>* _internal_mutable_any_field();
+
+  public:
+  // map<int32, .google.protobuf.Api> api_field = 2;
+  int api_field_size() const;
+  private:
+  int _internal_api_field_size() const;
+
+  public:
+  void clear_api_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>& api_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>* mutable_api_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>& _internal_api_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>* _internal_mutable_api_field();
+
+  public:
+  // map<int32, .google.protobuf.Duration> duration_field = 3;
+  int duration_field_size() const;
+  private:
+  int _internal_duration_field_size() const;
+
+  public:
+  void clear_duration_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>& duration_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>* mutable_duration_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>& _internal_duration_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>* _internal_mutable_duration_field();
+
+  public:
+  // map<int32, .google.protobuf.Empty> empty_field = 4;
+  int empty_field_size() const;
+  private:
+  int _internal_empty_field_size() const;
+
+  public:
+  void clear_empty_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>& empty_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>* mutable_empty_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>& _internal_empty_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>* _internal_mutable_empty_field();
+
+  public:
+  // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+  int field_mask_field_size() const;
+  private:
+  int _internal_field_mask_field_size() const;
+
+  public:
+  void clear_field_mask_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>& field_mask_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>* mutable_field_mask_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>& _internal_field_mask_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>* _internal_mutable_field_mask_field();
+
+  public:
+  // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+  int source_context_field_size() const;
+  private:
+  int _internal_source_context_field_size() const;
+
+  public:
+  void clear_source_context_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>& source_context_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>* mutable_source_context_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>& _internal_source_context_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>* _internal_mutable_source_context_field();
+
+  public:
+  // map<int32, .google.protobuf.Struct> struct_field = 7;
+  int struct_field_size() const;
+  private:
+  int _internal_struct_field_size() const;
+
+  public:
+  void clear_struct_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>& struct_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>* mutable_struct_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>& _internal_struct_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>* _internal_mutable_struct_field();
+
+  public:
+  // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+  int timestamp_field_size() const;
+  private:
+  int _internal_timestamp_field_size() const;
+
+  public:
+  void clear_timestamp_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>& timestamp_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>* mutable_timestamp_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>& _internal_timestamp_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>* _internal_mutable_timestamp_field();
+
+  public:
+  // map<int32, .google.protobuf.Type> type_field = 9;
+  int type_field_size() const;
+  private:
+  int _internal_type_field_size() const;
+
+  public:
+  void clear_type_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>& type_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>* mutable_type_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>& _internal_type_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>* _internal_mutable_type_field();
+
+  public:
+  // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+  int double_field_size() const;
+  private:
+  int _internal_double_field_size() const;
+
+  public:
+  void clear_double_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>& double_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>* mutable_double_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>& _internal_double_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>* _internal_mutable_double_field();
+
+  public:
+  // map<int32, .google.protobuf.FloatValue> float_field = 11;
+  int float_field_size() const;
+  private:
+  int _internal_float_field_size() const;
+
+  public:
+  void clear_float_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>& float_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>* mutable_float_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>& _internal_float_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>* _internal_mutable_float_field();
+
+  public:
+  // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+  int int64_field_size() const;
+  private:
+  int _internal_int64_field_size() const;
+
+  public:
+  void clear_int64_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>& int64_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>* mutable_int64_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>& _internal_int64_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>* _internal_mutable_int64_field();
+
+  public:
+  // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+  int uint64_field_size() const;
+  private:
+  int _internal_uint64_field_size() const;
+
+  public:
+  void clear_uint64_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>& uint64_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>* mutable_uint64_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>& _internal_uint64_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>* _internal_mutable_uint64_field();
+
+  public:
+  // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+  int int32_field_size() const;
+  private:
+  int _internal_int32_field_size() const;
+
+  public:
+  void clear_int32_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>& int32_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>* mutable_int32_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>& _internal_int32_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>* _internal_mutable_int32_field();
+
+  public:
+  // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+  int uint32_field_size() const;
+  private:
+  int _internal_uint32_field_size() const;
+
+  public:
+  void clear_uint32_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>& uint32_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>* mutable_uint32_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>& _internal_uint32_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>* _internal_mutable_uint32_field();
+
+  public:
+  // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+  int bool_field_size() const;
+  private:
+  int _internal_bool_field_size() const;
+
+  public:
+  void clear_bool_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>& bool_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>* mutable_bool_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>& _internal_bool_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>* _internal_mutable_bool_field();
+
+  public:
+  // map<int32, .google.protobuf.StringValue> string_field = 17;
+  int string_field_size() const;
+  private:
+  int _internal_string_field_size() const;
+
+  public:
+  void clear_string_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>& string_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>* mutable_string_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>& _internal_string_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>* _internal_mutable_string_field();
+
+  public:
+  // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+  int bytes_field_size() const;
+  private:
+  int _internal_bytes_field_size() const;
+
+  public:
+  void clear_bytes_field() ;
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>& bytes_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>* mutable_bytes_field();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>& _internal_bytes_field() const;
+  ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>* _internal_mutable_bytes_field();
+
+  public:
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.MapWellKnownTypes)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 18, 36,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_AnyFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Any,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        any_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_ApiFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Api,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        api_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_DurationFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Duration,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        duration_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_EmptyFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Empty,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        empty_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::FieldMask,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        field_mask_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::SourceContext,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        source_context_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_StructFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Struct,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        struct_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_TimestampFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Timestamp,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        timestamp_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_TypeFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Type,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        type_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_DoubleFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::DoubleValue,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        double_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_FloatFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::FloatValue,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        float_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_Int64FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Int64Value,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        int64_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_Uint64FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::UInt64Value,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        uint64_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_Int32FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::Int32Value,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        int32_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_Uint32FieldEntry_DoNotUse, ::int32_t, ::google::protobuf::UInt32Value,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        uint32_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_BoolFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::BoolValue,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        bool_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_StringFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::StringValue,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        string_field_;
+    ::google::protobuf::internal::MapField<MapWellKnownTypes_BytesFieldEntry_DoNotUse, ::int32_t, ::google::protobuf::BytesValue,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        bytes_field_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// TestWellKnownTypes
+
+// .google.protobuf.Any any_field = 1;
+inline bool TestWellKnownTypes::has_any_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.any_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Any& TestWellKnownTypes::_internal_any_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Any* p = _impl_.any_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Any&>(::google::protobuf::_Any_default_instance_);
+}
+inline const ::google::protobuf::Any& TestWellKnownTypes::any_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.any_field)
+  return _internal_any_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_any_field(::google::protobuf::Any* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.any_field_);
+  }
+  _impl_.any_field_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.any_field)
+}
+inline ::google::protobuf::Any* TestWellKnownTypes::release_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Any* released = _impl_.any_field_;
+  _impl_.any_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Any* TestWellKnownTypes::unsafe_arena_release_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.any_field)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Any* temp = _impl_.any_field_;
+  _impl_.any_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Any* TestWellKnownTypes::_internal_mutable_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.any_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Any>(GetArena());
+    _impl_.any_field_ = reinterpret_cast<::google::protobuf::Any*>(p);
+  }
+  return _impl_.any_field_;
+}
+inline ::google::protobuf::Any* TestWellKnownTypes::mutable_any_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Any* _msg = _internal_mutable_any_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.any_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_any_field(::google::protobuf::Any* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.any_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.any_field_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.any_field)
+}
+
+// .google.protobuf.Api api_field = 2;
+inline bool TestWellKnownTypes::has_api_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.api_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Api& TestWellKnownTypes::_internal_api_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Api* p = _impl_.api_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Api&>(::google::protobuf::_Api_default_instance_);
+}
+inline const ::google::protobuf::Api& TestWellKnownTypes::api_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.api_field)
+  return _internal_api_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_api_field(::google::protobuf::Api* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.api_field_);
+  }
+  _impl_.api_field_ = reinterpret_cast<::google::protobuf::Api*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.api_field)
+}
+inline ::google::protobuf::Api* TestWellKnownTypes::release_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::google::protobuf::Api* released = _impl_.api_field_;
+  _impl_.api_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Api* TestWellKnownTypes::unsafe_arena_release_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.api_field)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::google::protobuf::Api* temp = _impl_.api_field_;
+  _impl_.api_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Api* TestWellKnownTypes::_internal_mutable_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.api_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Api>(GetArena());
+    _impl_.api_field_ = reinterpret_cast<::google::protobuf::Api*>(p);
+  }
+  return _impl_.api_field_;
+}
+inline ::google::protobuf::Api* TestWellKnownTypes::mutable_api_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Api* _msg = _internal_mutable_api_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.api_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_api_field(::google::protobuf::Api* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.api_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.api_field_ = reinterpret_cast<::google::protobuf::Api*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.api_field)
+}
+
+// .google.protobuf.Duration duration_field = 3;
+inline bool TestWellKnownTypes::has_duration_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.duration_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Duration& TestWellKnownTypes::_internal_duration_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Duration* p = _impl_.duration_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Duration&>(::google::protobuf::_Duration_default_instance_);
+}
+inline const ::google::protobuf::Duration& TestWellKnownTypes::duration_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.duration_field)
+  return _internal_duration_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_duration_field(::google::protobuf::Duration* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.duration_field_);
+  }
+  _impl_.duration_field_ = reinterpret_cast<::google::protobuf::Duration*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.duration_field)
+}
+inline ::google::protobuf::Duration* TestWellKnownTypes::release_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::google::protobuf::Duration* released = _impl_.duration_field_;
+  _impl_.duration_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Duration* TestWellKnownTypes::unsafe_arena_release_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.duration_field)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::google::protobuf::Duration* temp = _impl_.duration_field_;
+  _impl_.duration_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Duration* TestWellKnownTypes::_internal_mutable_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.duration_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Duration>(GetArena());
+    _impl_.duration_field_ = reinterpret_cast<::google::protobuf::Duration*>(p);
+  }
+  return _impl_.duration_field_;
+}
+inline ::google::protobuf::Duration* TestWellKnownTypes::mutable_duration_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Duration* _msg = _internal_mutable_duration_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.duration_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_duration_field(::google::protobuf::Duration* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.duration_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.duration_field_ = reinterpret_cast<::google::protobuf::Duration*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.duration_field)
+}
+
+// .google.protobuf.Empty empty_field = 4;
+inline bool TestWellKnownTypes::has_empty_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Empty& TestWellKnownTypes::_internal_empty_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Empty* p = _impl_.empty_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Empty&>(::google::protobuf::_Empty_default_instance_);
+}
+inline const ::google::protobuf::Empty& TestWellKnownTypes::empty_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.empty_field)
+  return _internal_empty_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_empty_field(::google::protobuf::Empty* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_field_);
+  }
+  _impl_.empty_field_ = reinterpret_cast<::google::protobuf::Empty*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.empty_field)
+}
+inline ::google::protobuf::Empty* TestWellKnownTypes::release_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::google::protobuf::Empty* released = _impl_.empty_field_;
+  _impl_.empty_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Empty* TestWellKnownTypes::unsafe_arena_release_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.empty_field)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::google::protobuf::Empty* temp = _impl_.empty_field_;
+  _impl_.empty_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Empty* TestWellKnownTypes::_internal_mutable_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.empty_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Empty>(GetArena());
+    _impl_.empty_field_ = reinterpret_cast<::google::protobuf::Empty*>(p);
+  }
+  return _impl_.empty_field_;
+}
+inline ::google::protobuf::Empty* TestWellKnownTypes::mutable_empty_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Empty* _msg = _internal_mutable_empty_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.empty_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_empty_field(::google::protobuf::Empty* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.empty_field_ = reinterpret_cast<::google::protobuf::Empty*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.empty_field)
+}
+
+// .google.protobuf.FieldMask field_mask_field = 5;
+inline bool TestWellKnownTypes::has_field_mask_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.field_mask_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::FieldMask& TestWellKnownTypes::_internal_field_mask_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::FieldMask* p = _impl_.field_mask_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::FieldMask&>(::google::protobuf::_FieldMask_default_instance_);
+}
+inline const ::google::protobuf::FieldMask& TestWellKnownTypes::field_mask_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+  return _internal_field_mask_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_field_mask_field(::google::protobuf::FieldMask* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.field_mask_field_);
+  }
+  _impl_.field_mask_field_ = reinterpret_cast<::google::protobuf::FieldMask*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+}
+inline ::google::protobuf::FieldMask* TestWellKnownTypes::release_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::google::protobuf::FieldMask* released = _impl_.field_mask_field_;
+  _impl_.field_mask_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::FieldMask* TestWellKnownTypes::unsafe_arena_release_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::google::protobuf::FieldMask* temp = _impl_.field_mask_field_;
+  _impl_.field_mask_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::FieldMask* TestWellKnownTypes::_internal_mutable_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.field_mask_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::FieldMask>(GetArena());
+    _impl_.field_mask_field_ = reinterpret_cast<::google::protobuf::FieldMask*>(p);
+  }
+  return _impl_.field_mask_field_;
+}
+inline ::google::protobuf::FieldMask* TestWellKnownTypes::mutable_field_mask_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FieldMask* _msg = _internal_mutable_field_mask_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_field_mask_field(::google::protobuf::FieldMask* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.field_mask_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+
+  _impl_.field_mask_field_ = reinterpret_cast<::google::protobuf::FieldMask*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+}
+
+// .google.protobuf.SourceContext source_context_field = 6;
+inline bool TestWellKnownTypes::has_source_context_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.source_context_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::SourceContext& TestWellKnownTypes::_internal_source_context_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::SourceContext* p = _impl_.source_context_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::SourceContext&>(::google::protobuf::_SourceContext_default_instance_);
+}
+inline const ::google::protobuf::SourceContext& TestWellKnownTypes::source_context_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.source_context_field)
+  return _internal_source_context_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_source_context_field(::google::protobuf::SourceContext* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.source_context_field_);
+  }
+  _impl_.source_context_field_ = reinterpret_cast<::google::protobuf::SourceContext*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.source_context_field)
+}
+inline ::google::protobuf::SourceContext* TestWellKnownTypes::release_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::google::protobuf::SourceContext* released = _impl_.source_context_field_;
+  _impl_.source_context_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::SourceContext* TestWellKnownTypes::unsafe_arena_release_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.source_context_field)
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::google::protobuf::SourceContext* temp = _impl_.source_context_field_;
+  _impl_.source_context_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::SourceContext* TestWellKnownTypes::_internal_mutable_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.source_context_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::SourceContext>(GetArena());
+    _impl_.source_context_field_ = reinterpret_cast<::google::protobuf::SourceContext*>(p);
+  }
+  return _impl_.source_context_field_;
+}
+inline ::google::protobuf::SourceContext* TestWellKnownTypes::mutable_source_context_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::SourceContext* _msg = _internal_mutable_source_context_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.source_context_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_source_context_field(::google::protobuf::SourceContext* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.source_context_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+
+  _impl_.source_context_field_ = reinterpret_cast<::google::protobuf::SourceContext*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.source_context_field)
+}
+
+// .google.protobuf.Struct struct_field = 7;
+inline bool TestWellKnownTypes::has_struct_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.struct_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Struct& TestWellKnownTypes::_internal_struct_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Struct* p = _impl_.struct_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Struct&>(::google::protobuf::_Struct_default_instance_);
+}
+inline const ::google::protobuf::Struct& TestWellKnownTypes::struct_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.struct_field)
+  return _internal_struct_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_struct_field(::google::protobuf::Struct* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.struct_field_);
+  }
+  _impl_.struct_field_ = reinterpret_cast<::google::protobuf::Struct*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.struct_field)
+}
+inline ::google::protobuf::Struct* TestWellKnownTypes::release_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::google::protobuf::Struct* released = _impl_.struct_field_;
+  _impl_.struct_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Struct* TestWellKnownTypes::unsafe_arena_release_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.struct_field)
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::google::protobuf::Struct* temp = _impl_.struct_field_;
+  _impl_.struct_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Struct* TestWellKnownTypes::_internal_mutable_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.struct_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Struct>(GetArena());
+    _impl_.struct_field_ = reinterpret_cast<::google::protobuf::Struct*>(p);
+  }
+  return _impl_.struct_field_;
+}
+inline ::google::protobuf::Struct* TestWellKnownTypes::mutable_struct_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Struct* _msg = _internal_mutable_struct_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.struct_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_struct_field(::google::protobuf::Struct* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.struct_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+
+  _impl_.struct_field_ = reinterpret_cast<::google::protobuf::Struct*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.struct_field)
+}
+
+// .google.protobuf.Timestamp timestamp_field = 8;
+inline bool TestWellKnownTypes::has_timestamp_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.timestamp_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Timestamp& TestWellKnownTypes::_internal_timestamp_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Timestamp* p = _impl_.timestamp_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Timestamp&>(::google::protobuf::_Timestamp_default_instance_);
+}
+inline const ::google::protobuf::Timestamp& TestWellKnownTypes::timestamp_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+  return _internal_timestamp_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_timestamp_field(::google::protobuf::Timestamp* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.timestamp_field_);
+  }
+  _impl_.timestamp_field_ = reinterpret_cast<::google::protobuf::Timestamp*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+}
+inline ::google::protobuf::Timestamp* TestWellKnownTypes::release_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::google::protobuf::Timestamp* released = _impl_.timestamp_field_;
+  _impl_.timestamp_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Timestamp* TestWellKnownTypes::unsafe_arena_release_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::google::protobuf::Timestamp* temp = _impl_.timestamp_field_;
+  _impl_.timestamp_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Timestamp* TestWellKnownTypes::_internal_mutable_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.timestamp_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Timestamp>(GetArena());
+    _impl_.timestamp_field_ = reinterpret_cast<::google::protobuf::Timestamp*>(p);
+  }
+  return _impl_.timestamp_field_;
+}
+inline ::google::protobuf::Timestamp* TestWellKnownTypes::mutable_timestamp_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Timestamp* _msg = _internal_mutable_timestamp_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_timestamp_field(::google::protobuf::Timestamp* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.timestamp_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+
+  _impl_.timestamp_field_ = reinterpret_cast<::google::protobuf::Timestamp*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+}
+
+// .google.protobuf.Type type_field = 9;
+inline bool TestWellKnownTypes::has_type_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.type_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Type& TestWellKnownTypes::_internal_type_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Type* p = _impl_.type_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Type&>(::google::protobuf::_Type_default_instance_);
+}
+inline const ::google::protobuf::Type& TestWellKnownTypes::type_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.type_field)
+  return _internal_type_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_type_field(::google::protobuf::Type* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.type_field_);
+  }
+  _impl_.type_field_ = reinterpret_cast<::google::protobuf::Type*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.type_field)
+}
+inline ::google::protobuf::Type* TestWellKnownTypes::release_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::google::protobuf::Type* released = _impl_.type_field_;
+  _impl_.type_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Type* TestWellKnownTypes::unsafe_arena_release_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.type_field)
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::google::protobuf::Type* temp = _impl_.type_field_;
+  _impl_.type_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Type* TestWellKnownTypes::_internal_mutable_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.type_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Type>(GetArena());
+    _impl_.type_field_ = reinterpret_cast<::google::protobuf::Type*>(p);
+  }
+  return _impl_.type_field_;
+}
+inline ::google::protobuf::Type* TestWellKnownTypes::mutable_type_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Type* _msg = _internal_mutable_type_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.type_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_type_field(::google::protobuf::Type* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.type_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+
+  _impl_.type_field_ = reinterpret_cast<::google::protobuf::Type*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.type_field)
+}
+
+// .google.protobuf.DoubleValue double_field = 10;
+inline bool TestWellKnownTypes::has_double_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.double_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::DoubleValue& TestWellKnownTypes::_internal_double_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::DoubleValue* p = _impl_.double_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::DoubleValue&>(::google::protobuf::_DoubleValue_default_instance_);
+}
+inline const ::google::protobuf::DoubleValue& TestWellKnownTypes::double_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.double_field)
+  return _internal_double_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_double_field(::google::protobuf::DoubleValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.double_field_);
+  }
+  _impl_.double_field_ = reinterpret_cast<::google::protobuf::DoubleValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.double_field)
+}
+inline ::google::protobuf::DoubleValue* TestWellKnownTypes::release_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::google::protobuf::DoubleValue* released = _impl_.double_field_;
+  _impl_.double_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::DoubleValue* TestWellKnownTypes::unsafe_arena_release_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.double_field)
+
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::google::protobuf::DoubleValue* temp = _impl_.double_field_;
+  _impl_.double_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::DoubleValue* TestWellKnownTypes::_internal_mutable_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.double_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::DoubleValue>(GetArena());
+    _impl_.double_field_ = reinterpret_cast<::google::protobuf::DoubleValue*>(p);
+  }
+  return _impl_.double_field_;
+}
+inline ::google::protobuf::DoubleValue* TestWellKnownTypes::mutable_double_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::DoubleValue* _msg = _internal_mutable_double_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.double_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_double_field(::google::protobuf::DoubleValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.double_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+
+  _impl_.double_field_ = reinterpret_cast<::google::protobuf::DoubleValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.double_field)
+}
+
+// .google.protobuf.FloatValue float_field = 11;
+inline bool TestWellKnownTypes::has_float_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.float_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::FloatValue& TestWellKnownTypes::_internal_float_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::FloatValue* p = _impl_.float_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::FloatValue&>(::google::protobuf::_FloatValue_default_instance_);
+}
+inline const ::google::protobuf::FloatValue& TestWellKnownTypes::float_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.float_field)
+  return _internal_float_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_float_field(::google::protobuf::FloatValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.float_field_);
+  }
+  _impl_.float_field_ = reinterpret_cast<::google::protobuf::FloatValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.float_field)
+}
+inline ::google::protobuf::FloatValue* TestWellKnownTypes::release_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::google::protobuf::FloatValue* released = _impl_.float_field_;
+  _impl_.float_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::FloatValue* TestWellKnownTypes::unsafe_arena_release_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.float_field)
+
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::google::protobuf::FloatValue* temp = _impl_.float_field_;
+  _impl_.float_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::FloatValue* TestWellKnownTypes::_internal_mutable_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.float_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::FloatValue>(GetArena());
+    _impl_.float_field_ = reinterpret_cast<::google::protobuf::FloatValue*>(p);
+  }
+  return _impl_.float_field_;
+}
+inline ::google::protobuf::FloatValue* TestWellKnownTypes::mutable_float_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FloatValue* _msg = _internal_mutable_float_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.float_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_float_field(::google::protobuf::FloatValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.float_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+
+  _impl_.float_field_ = reinterpret_cast<::google::protobuf::FloatValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.float_field)
+}
+
+// .google.protobuf.Int64Value int64_field = 12;
+inline bool TestWellKnownTypes::has_int64_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.int64_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Int64Value& TestWellKnownTypes::_internal_int64_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Int64Value* p = _impl_.int64_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Int64Value&>(::google::protobuf::_Int64Value_default_instance_);
+}
+inline const ::google::protobuf::Int64Value& TestWellKnownTypes::int64_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.int64_field)
+  return _internal_int64_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_int64_field(::google::protobuf::Int64Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int64_field_);
+  }
+  _impl_.int64_field_ = reinterpret_cast<::google::protobuf::Int64Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.int64_field)
+}
+inline ::google::protobuf::Int64Value* TestWellKnownTypes::release_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::google::protobuf::Int64Value* released = _impl_.int64_field_;
+  _impl_.int64_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Int64Value* TestWellKnownTypes::unsafe_arena_release_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.int64_field)
+
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::google::protobuf::Int64Value* temp = _impl_.int64_field_;
+  _impl_.int64_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Int64Value* TestWellKnownTypes::_internal_mutable_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.int64_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Int64Value>(GetArena());
+    _impl_.int64_field_ = reinterpret_cast<::google::protobuf::Int64Value*>(p);
+  }
+  return _impl_.int64_field_;
+}
+inline ::google::protobuf::Int64Value* TestWellKnownTypes::mutable_int64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Int64Value* _msg = _internal_mutable_int64_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.int64_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_int64_field(::google::protobuf::Int64Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int64_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+
+  _impl_.int64_field_ = reinterpret_cast<::google::protobuf::Int64Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.int64_field)
+}
+
+// .google.protobuf.UInt64Value uint64_field = 13;
+inline bool TestWellKnownTypes::has_uint64_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.uint64_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::UInt64Value& TestWellKnownTypes::_internal_uint64_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::UInt64Value* p = _impl_.uint64_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::UInt64Value&>(::google::protobuf::_UInt64Value_default_instance_);
+}
+inline const ::google::protobuf::UInt64Value& TestWellKnownTypes::uint64_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.uint64_field)
+  return _internal_uint64_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_uint64_field(::google::protobuf::UInt64Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint64_field_);
+  }
+  _impl_.uint64_field_ = reinterpret_cast<::google::protobuf::UInt64Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.uint64_field)
+}
+inline ::google::protobuf::UInt64Value* TestWellKnownTypes::release_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::google::protobuf::UInt64Value* released = _impl_.uint64_field_;
+  _impl_.uint64_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::UInt64Value* TestWellKnownTypes::unsafe_arena_release_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.uint64_field)
+
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::google::protobuf::UInt64Value* temp = _impl_.uint64_field_;
+  _impl_.uint64_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::UInt64Value* TestWellKnownTypes::_internal_mutable_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00001000u;
+  if (_impl_.uint64_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::UInt64Value>(GetArena());
+    _impl_.uint64_field_ = reinterpret_cast<::google::protobuf::UInt64Value*>(p);
+  }
+  return _impl_.uint64_field_;
+}
+inline ::google::protobuf::UInt64Value* TestWellKnownTypes::mutable_uint64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::UInt64Value* _msg = _internal_mutable_uint64_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.uint64_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_uint64_field(::google::protobuf::UInt64Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint64_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+
+  _impl_.uint64_field_ = reinterpret_cast<::google::protobuf::UInt64Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.uint64_field)
+}
+
+// .google.protobuf.Int32Value int32_field = 14;
+inline bool TestWellKnownTypes::has_int32_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.int32_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Int32Value& TestWellKnownTypes::_internal_int32_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Int32Value* p = _impl_.int32_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Int32Value&>(::google::protobuf::_Int32Value_default_instance_);
+}
+inline const ::google::protobuf::Int32Value& TestWellKnownTypes::int32_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.int32_field)
+  return _internal_int32_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_int32_field(::google::protobuf::Int32Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int32_field_);
+  }
+  _impl_.int32_field_ = reinterpret_cast<::google::protobuf::Int32Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.int32_field)
+}
+inline ::google::protobuf::Int32Value* TestWellKnownTypes::release_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::google::protobuf::Int32Value* released = _impl_.int32_field_;
+  _impl_.int32_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Int32Value* TestWellKnownTypes::unsafe_arena_release_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.int32_field)
+
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::google::protobuf::Int32Value* temp = _impl_.int32_field_;
+  _impl_.int32_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Int32Value* TestWellKnownTypes::_internal_mutable_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00002000u;
+  if (_impl_.int32_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Int32Value>(GetArena());
+    _impl_.int32_field_ = reinterpret_cast<::google::protobuf::Int32Value*>(p);
+  }
+  return _impl_.int32_field_;
+}
+inline ::google::protobuf::Int32Value* TestWellKnownTypes::mutable_int32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Int32Value* _msg = _internal_mutable_int32_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.int32_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_int32_field(::google::protobuf::Int32Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int32_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+
+  _impl_.int32_field_ = reinterpret_cast<::google::protobuf::Int32Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.int32_field)
+}
+
+// .google.protobuf.UInt32Value uint32_field = 15;
+inline bool TestWellKnownTypes::has_uint32_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.uint32_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::UInt32Value& TestWellKnownTypes::_internal_uint32_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::UInt32Value* p = _impl_.uint32_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::UInt32Value&>(::google::protobuf::_UInt32Value_default_instance_);
+}
+inline const ::google::protobuf::UInt32Value& TestWellKnownTypes::uint32_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.uint32_field)
+  return _internal_uint32_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_uint32_field(::google::protobuf::UInt32Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint32_field_);
+  }
+  _impl_.uint32_field_ = reinterpret_cast<::google::protobuf::UInt32Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00004000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00004000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.uint32_field)
+}
+inline ::google::protobuf::UInt32Value* TestWellKnownTypes::release_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00004000u;
+  ::google::protobuf::UInt32Value* released = _impl_.uint32_field_;
+  _impl_.uint32_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::UInt32Value* TestWellKnownTypes::unsafe_arena_release_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.uint32_field)
+
+  _impl_._has_bits_[0] &= ~0x00004000u;
+  ::google::protobuf::UInt32Value* temp = _impl_.uint32_field_;
+  _impl_.uint32_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::UInt32Value* TestWellKnownTypes::_internal_mutable_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00004000u;
+  if (_impl_.uint32_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::UInt32Value>(GetArena());
+    _impl_.uint32_field_ = reinterpret_cast<::google::protobuf::UInt32Value*>(p);
+  }
+  return _impl_.uint32_field_;
+}
+inline ::google::protobuf::UInt32Value* TestWellKnownTypes::mutable_uint32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::UInt32Value* _msg = _internal_mutable_uint32_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.uint32_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_uint32_field(::google::protobuf::UInt32Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint32_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00004000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00004000u;
+  }
+
+  _impl_.uint32_field_ = reinterpret_cast<::google::protobuf::UInt32Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.uint32_field)
+}
+
+// .google.protobuf.BoolValue bool_field = 16;
+inline bool TestWellKnownTypes::has_bool_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.bool_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::BoolValue& TestWellKnownTypes::_internal_bool_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::BoolValue* p = _impl_.bool_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::BoolValue&>(::google::protobuf::_BoolValue_default_instance_);
+}
+inline const ::google::protobuf::BoolValue& TestWellKnownTypes::bool_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.bool_field)
+  return _internal_bool_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_bool_field(::google::protobuf::BoolValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bool_field_);
+  }
+  _impl_.bool_field_ = reinterpret_cast<::google::protobuf::BoolValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00008000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00008000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.bool_field)
+}
+inline ::google::protobuf::BoolValue* TestWellKnownTypes::release_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00008000u;
+  ::google::protobuf::BoolValue* released = _impl_.bool_field_;
+  _impl_.bool_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::BoolValue* TestWellKnownTypes::unsafe_arena_release_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.bool_field)
+
+  _impl_._has_bits_[0] &= ~0x00008000u;
+  ::google::protobuf::BoolValue* temp = _impl_.bool_field_;
+  _impl_.bool_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::BoolValue* TestWellKnownTypes::_internal_mutable_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00008000u;
+  if (_impl_.bool_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::BoolValue>(GetArena());
+    _impl_.bool_field_ = reinterpret_cast<::google::protobuf::BoolValue*>(p);
+  }
+  return _impl_.bool_field_;
+}
+inline ::google::protobuf::BoolValue* TestWellKnownTypes::mutable_bool_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::BoolValue* _msg = _internal_mutable_bool_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.bool_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_bool_field(::google::protobuf::BoolValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bool_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00008000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00008000u;
+  }
+
+  _impl_.bool_field_ = reinterpret_cast<::google::protobuf::BoolValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.bool_field)
+}
+
+// .google.protobuf.StringValue string_field = 17;
+inline bool TestWellKnownTypes::has_string_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.string_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::StringValue& TestWellKnownTypes::_internal_string_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::StringValue* p = _impl_.string_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::StringValue&>(::google::protobuf::_StringValue_default_instance_);
+}
+inline const ::google::protobuf::StringValue& TestWellKnownTypes::string_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.string_field)
+  return _internal_string_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_string_field(::google::protobuf::StringValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.string_field_);
+  }
+  _impl_.string_field_ = reinterpret_cast<::google::protobuf::StringValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00010000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00010000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.string_field)
+}
+inline ::google::protobuf::StringValue* TestWellKnownTypes::release_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00010000u;
+  ::google::protobuf::StringValue* released = _impl_.string_field_;
+  _impl_.string_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::StringValue* TestWellKnownTypes::unsafe_arena_release_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.string_field)
+
+  _impl_._has_bits_[0] &= ~0x00010000u;
+  ::google::protobuf::StringValue* temp = _impl_.string_field_;
+  _impl_.string_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::StringValue* TestWellKnownTypes::_internal_mutable_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00010000u;
+  if (_impl_.string_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::StringValue>(GetArena());
+    _impl_.string_field_ = reinterpret_cast<::google::protobuf::StringValue*>(p);
+  }
+  return _impl_.string_field_;
+}
+inline ::google::protobuf::StringValue* TestWellKnownTypes::mutable_string_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::StringValue* _msg = _internal_mutable_string_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.string_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_string_field(::google::protobuf::StringValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.string_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00010000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00010000u;
+  }
+
+  _impl_.string_field_ = reinterpret_cast<::google::protobuf::StringValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.string_field)
+}
+
+// .google.protobuf.BytesValue bytes_field = 18;
+inline bool TestWellKnownTypes::has_bytes_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.bytes_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::BytesValue& TestWellKnownTypes::_internal_bytes_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::BytesValue* p = _impl_.bytes_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::BytesValue&>(::google::protobuf::_BytesValue_default_instance_);
+}
+inline const ::google::protobuf::BytesValue& TestWellKnownTypes::bytes_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.bytes_field)
+  return _internal_bytes_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_bytes_field(::google::protobuf::BytesValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bytes_field_);
+  }
+  _impl_.bytes_field_ = reinterpret_cast<::google::protobuf::BytesValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00020000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00020000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.bytes_field)
+}
+inline ::google::protobuf::BytesValue* TestWellKnownTypes::release_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00020000u;
+  ::google::protobuf::BytesValue* released = _impl_.bytes_field_;
+  _impl_.bytes_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::BytesValue* TestWellKnownTypes::unsafe_arena_release_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.bytes_field)
+
+  _impl_._has_bits_[0] &= ~0x00020000u;
+  ::google::protobuf::BytesValue* temp = _impl_.bytes_field_;
+  _impl_.bytes_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::BytesValue* TestWellKnownTypes::_internal_mutable_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00020000u;
+  if (_impl_.bytes_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::BytesValue>(GetArena());
+    _impl_.bytes_field_ = reinterpret_cast<::google::protobuf::BytesValue*>(p);
+  }
+  return _impl_.bytes_field_;
+}
+inline ::google::protobuf::BytesValue* TestWellKnownTypes::mutable_bytes_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::BytesValue* _msg = _internal_mutable_bytes_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.bytes_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_bytes_field(::google::protobuf::BytesValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bytes_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00020000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00020000u;
+  }
+
+  _impl_.bytes_field_ = reinterpret_cast<::google::protobuf::BytesValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.bytes_field)
+}
+
+// .google.protobuf.Value value_field = 19;
+inline bool TestWellKnownTypes::has_value_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_field_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Value& TestWellKnownTypes::_internal_value_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Value* p = _impl_.value_field_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Value&>(::google::protobuf::_Value_default_instance_);
+}
+inline const ::google::protobuf::Value& TestWellKnownTypes::value_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.value_field)
+  return _internal_value_field();
+}
+inline void TestWellKnownTypes::unsafe_arena_set_allocated_value_field(::google::protobuf::Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_field_);
+  }
+  _impl_.value_field_ = reinterpret_cast<::google::protobuf::Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00040000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00040000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestWellKnownTypes.value_field)
+}
+inline ::google::protobuf::Value* TestWellKnownTypes::release_value_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00040000u;
+  ::google::protobuf::Value* released = _impl_.value_field_;
+  _impl_.value_field_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Value* TestWellKnownTypes::unsafe_arena_release_value_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.value_field)
+
+  _impl_._has_bits_[0] &= ~0x00040000u;
+  ::google::protobuf::Value* temp = _impl_.value_field_;
+  _impl_.value_field_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Value* TestWellKnownTypes::_internal_mutable_value_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00040000u;
+  if (_impl_.value_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Value>(GetArena());
+    _impl_.value_field_ = reinterpret_cast<::google::protobuf::Value*>(p);
+  }
+  return _impl_.value_field_;
+}
+inline ::google::protobuf::Value* TestWellKnownTypes::mutable_value_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Value* _msg = _internal_mutable_value_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.value_field)
+  return _msg;
+}
+inline void TestWellKnownTypes::set_allocated_value_field(::google::protobuf::Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_field_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00040000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00040000u;
+  }
+
+  _impl_.value_field_ = reinterpret_cast<::google::protobuf::Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.value_field)
+}
+
+// -------------------------------------------------------------------
+
+// RepeatedWellKnownTypes
+
+// repeated .google.protobuf.Any any_field = 1;
+inline int RepeatedWellKnownTypes::_internal_any_field_size() const {
+  return _internal_any_field().size();
+}
+inline int RepeatedWellKnownTypes::any_field_size() const {
+  return _internal_any_field_size();
+}
+inline ::google::protobuf::Any* RepeatedWellKnownTypes::mutable_any_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return _internal_mutable_any_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>* RepeatedWellKnownTypes::mutable_any_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_any_field();
+}
+inline const ::google::protobuf::Any& RepeatedWellKnownTypes::any_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return _internal_any_field().Get(index);
+}
+inline ::google::protobuf::Any* RepeatedWellKnownTypes::add_any_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Any* _add = _internal_mutable_any_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>& RepeatedWellKnownTypes::any_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return _internal_any_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>&
+RepeatedWellKnownTypes::_internal_any_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.any_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>*
+RepeatedWellKnownTypes::_internal_mutable_any_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.any_field_;
+}
+
+// repeated .google.protobuf.Api api_field = 2;
+inline int RepeatedWellKnownTypes::_internal_api_field_size() const {
+  return _internal_api_field().size();
+}
+inline int RepeatedWellKnownTypes::api_field_size() const {
+  return _internal_api_field_size();
+}
+inline ::google::protobuf::Api* RepeatedWellKnownTypes::mutable_api_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return _internal_mutable_api_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Api>* RepeatedWellKnownTypes::mutable_api_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_api_field();
+}
+inline const ::google::protobuf::Api& RepeatedWellKnownTypes::api_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return _internal_api_field().Get(index);
+}
+inline ::google::protobuf::Api* RepeatedWellKnownTypes::add_api_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Api* _add = _internal_mutable_api_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Api>& RepeatedWellKnownTypes::api_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return _internal_api_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Api>&
+RepeatedWellKnownTypes::_internal_api_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.api_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Api>*
+RepeatedWellKnownTypes::_internal_mutable_api_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.api_field_;
+}
+
+// repeated .google.protobuf.Duration duration_field = 3;
+inline int RepeatedWellKnownTypes::_internal_duration_field_size() const {
+  return _internal_duration_field().size();
+}
+inline int RepeatedWellKnownTypes::duration_field_size() const {
+  return _internal_duration_field_size();
+}
+inline ::google::protobuf::Duration* RepeatedWellKnownTypes::mutable_duration_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return _internal_mutable_duration_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>* RepeatedWellKnownTypes::mutable_duration_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_duration_field();
+}
+inline const ::google::protobuf::Duration& RepeatedWellKnownTypes::duration_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return _internal_duration_field().Get(index);
+}
+inline ::google::protobuf::Duration* RepeatedWellKnownTypes::add_duration_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Duration* _add = _internal_mutable_duration_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>& RepeatedWellKnownTypes::duration_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return _internal_duration_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>&
+RepeatedWellKnownTypes::_internal_duration_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.duration_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>*
+RepeatedWellKnownTypes::_internal_mutable_duration_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.duration_field_;
+}
+
+// repeated .google.protobuf.Empty empty_field = 4;
+inline int RepeatedWellKnownTypes::_internal_empty_field_size() const {
+  return _internal_empty_field().size();
+}
+inline int RepeatedWellKnownTypes::empty_field_size() const {
+  return _internal_empty_field_size();
+}
+inline ::google::protobuf::Empty* RepeatedWellKnownTypes::mutable_empty_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return _internal_mutable_empty_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Empty>* RepeatedWellKnownTypes::mutable_empty_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_empty_field();
+}
+inline const ::google::protobuf::Empty& RepeatedWellKnownTypes::empty_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return _internal_empty_field().Get(index);
+}
+inline ::google::protobuf::Empty* RepeatedWellKnownTypes::add_empty_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Empty* _add = _internal_mutable_empty_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Empty>& RepeatedWellKnownTypes::empty_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return _internal_empty_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Empty>&
+RepeatedWellKnownTypes::_internal_empty_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.empty_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Empty>*
+RepeatedWellKnownTypes::_internal_mutable_empty_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.empty_field_;
+}
+
+// repeated .google.protobuf.FieldMask field_mask_field = 5;
+inline int RepeatedWellKnownTypes::_internal_field_mask_field_size() const {
+  return _internal_field_mask_field().size();
+}
+inline int RepeatedWellKnownTypes::field_mask_field_size() const {
+  return _internal_field_mask_field_size();
+}
+inline ::google::protobuf::FieldMask* RepeatedWellKnownTypes::mutable_field_mask_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return _internal_mutable_field_mask_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::FieldMask>* RepeatedWellKnownTypes::mutable_field_mask_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_field_mask_field();
+}
+inline const ::google::protobuf::FieldMask& RepeatedWellKnownTypes::field_mask_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return _internal_field_mask_field().Get(index);
+}
+inline ::google::protobuf::FieldMask* RepeatedWellKnownTypes::add_field_mask_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::FieldMask* _add = _internal_mutable_field_mask_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::FieldMask>& RepeatedWellKnownTypes::field_mask_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return _internal_field_mask_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::FieldMask>&
+RepeatedWellKnownTypes::_internal_field_mask_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.field_mask_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::FieldMask>*
+RepeatedWellKnownTypes::_internal_mutable_field_mask_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.field_mask_field_;
+}
+
+// repeated .google.protobuf.SourceContext source_context_field = 6;
+inline int RepeatedWellKnownTypes::_internal_source_context_field_size() const {
+  return _internal_source_context_field().size();
+}
+inline int RepeatedWellKnownTypes::source_context_field_size() const {
+  return _internal_source_context_field_size();
+}
+inline ::google::protobuf::SourceContext* RepeatedWellKnownTypes::mutable_source_context_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return _internal_mutable_source_context_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::SourceContext>* RepeatedWellKnownTypes::mutable_source_context_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_source_context_field();
+}
+inline const ::google::protobuf::SourceContext& RepeatedWellKnownTypes::source_context_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return _internal_source_context_field().Get(index);
+}
+inline ::google::protobuf::SourceContext* RepeatedWellKnownTypes::add_source_context_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::SourceContext* _add = _internal_mutable_source_context_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::SourceContext>& RepeatedWellKnownTypes::source_context_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return _internal_source_context_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::SourceContext>&
+RepeatedWellKnownTypes::_internal_source_context_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.source_context_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::SourceContext>*
+RepeatedWellKnownTypes::_internal_mutable_source_context_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.source_context_field_;
+}
+
+// repeated .google.protobuf.Struct struct_field = 7;
+inline int RepeatedWellKnownTypes::_internal_struct_field_size() const {
+  return _internal_struct_field().size();
+}
+inline int RepeatedWellKnownTypes::struct_field_size() const {
+  return _internal_struct_field_size();
+}
+inline ::google::protobuf::Struct* RepeatedWellKnownTypes::mutable_struct_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return _internal_mutable_struct_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>* RepeatedWellKnownTypes::mutable_struct_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_struct_field();
+}
+inline const ::google::protobuf::Struct& RepeatedWellKnownTypes::struct_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return _internal_struct_field().Get(index);
+}
+inline ::google::protobuf::Struct* RepeatedWellKnownTypes::add_struct_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Struct* _add = _internal_mutable_struct_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>& RepeatedWellKnownTypes::struct_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return _internal_struct_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>&
+RepeatedWellKnownTypes::_internal_struct_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.struct_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>*
+RepeatedWellKnownTypes::_internal_mutable_struct_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.struct_field_;
+}
+
+// repeated .google.protobuf.Timestamp timestamp_field = 8;
+inline int RepeatedWellKnownTypes::_internal_timestamp_field_size() const {
+  return _internal_timestamp_field().size();
+}
+inline int RepeatedWellKnownTypes::timestamp_field_size() const {
+  return _internal_timestamp_field_size();
+}
+inline ::google::protobuf::Timestamp* RepeatedWellKnownTypes::mutable_timestamp_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return _internal_mutable_timestamp_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>* RepeatedWellKnownTypes::mutable_timestamp_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_timestamp_field();
+}
+inline const ::google::protobuf::Timestamp& RepeatedWellKnownTypes::timestamp_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return _internal_timestamp_field().Get(index);
+}
+inline ::google::protobuf::Timestamp* RepeatedWellKnownTypes::add_timestamp_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Timestamp* _add = _internal_mutable_timestamp_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>& RepeatedWellKnownTypes::timestamp_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return _internal_timestamp_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>&
+RepeatedWellKnownTypes::_internal_timestamp_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.timestamp_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>*
+RepeatedWellKnownTypes::_internal_mutable_timestamp_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.timestamp_field_;
+}
+
+// repeated .google.protobuf.Type type_field = 9;
+inline int RepeatedWellKnownTypes::_internal_type_field_size() const {
+  return _internal_type_field().size();
+}
+inline int RepeatedWellKnownTypes::type_field_size() const {
+  return _internal_type_field_size();
+}
+inline ::google::protobuf::Type* RepeatedWellKnownTypes::mutable_type_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return _internal_mutable_type_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Type>* RepeatedWellKnownTypes::mutable_type_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_type_field();
+}
+inline const ::google::protobuf::Type& RepeatedWellKnownTypes::type_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return _internal_type_field().Get(index);
+}
+inline ::google::protobuf::Type* RepeatedWellKnownTypes::add_type_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Type* _add = _internal_mutable_type_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Type>& RepeatedWellKnownTypes::type_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return _internal_type_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Type>&
+RepeatedWellKnownTypes::_internal_type_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.type_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Type>*
+RepeatedWellKnownTypes::_internal_mutable_type_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.type_field_;
+}
+
+// repeated .google.protobuf.DoubleValue double_field = 10;
+inline int RepeatedWellKnownTypes::_internal_double_field_size() const {
+  return _internal_double_field().size();
+}
+inline int RepeatedWellKnownTypes::double_field_size() const {
+  return _internal_double_field_size();
+}
+inline ::google::protobuf::DoubleValue* RepeatedWellKnownTypes::mutable_double_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return _internal_mutable_double_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>* RepeatedWellKnownTypes::mutable_double_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_double_field();
+}
+inline const ::google::protobuf::DoubleValue& RepeatedWellKnownTypes::double_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return _internal_double_field().Get(index);
+}
+inline ::google::protobuf::DoubleValue* RepeatedWellKnownTypes::add_double_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::DoubleValue* _add = _internal_mutable_double_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>& RepeatedWellKnownTypes::double_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return _internal_double_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>&
+RepeatedWellKnownTypes::_internal_double_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.double_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>*
+RepeatedWellKnownTypes::_internal_mutable_double_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.double_field_;
+}
+
+// repeated .google.protobuf.FloatValue float_field = 11;
+inline int RepeatedWellKnownTypes::_internal_float_field_size() const {
+  return _internal_float_field().size();
+}
+inline int RepeatedWellKnownTypes::float_field_size() const {
+  return _internal_float_field_size();
+}
+inline ::google::protobuf::FloatValue* RepeatedWellKnownTypes::mutable_float_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return _internal_mutable_float_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>* RepeatedWellKnownTypes::mutable_float_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_float_field();
+}
+inline const ::google::protobuf::FloatValue& RepeatedWellKnownTypes::float_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return _internal_float_field().Get(index);
+}
+inline ::google::protobuf::FloatValue* RepeatedWellKnownTypes::add_float_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::FloatValue* _add = _internal_mutable_float_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>& RepeatedWellKnownTypes::float_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return _internal_float_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>&
+RepeatedWellKnownTypes::_internal_float_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.float_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>*
+RepeatedWellKnownTypes::_internal_mutable_float_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.float_field_;
+}
+
+// repeated .google.protobuf.Int64Value int64_field = 12;
+inline int RepeatedWellKnownTypes::_internal_int64_field_size() const {
+  return _internal_int64_field().size();
+}
+inline int RepeatedWellKnownTypes::int64_field_size() const {
+  return _internal_int64_field_size();
+}
+inline ::google::protobuf::Int64Value* RepeatedWellKnownTypes::mutable_int64_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return _internal_mutable_int64_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>* RepeatedWellKnownTypes::mutable_int64_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_int64_field();
+}
+inline const ::google::protobuf::Int64Value& RepeatedWellKnownTypes::int64_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return _internal_int64_field().Get(index);
+}
+inline ::google::protobuf::Int64Value* RepeatedWellKnownTypes::add_int64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Int64Value* _add = _internal_mutable_int64_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>& RepeatedWellKnownTypes::int64_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return _internal_int64_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>&
+RepeatedWellKnownTypes::_internal_int64_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int64_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>*
+RepeatedWellKnownTypes::_internal_mutable_int64_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.int64_field_;
+}
+
+// repeated .google.protobuf.UInt64Value uint64_field = 13;
+inline int RepeatedWellKnownTypes::_internal_uint64_field_size() const {
+  return _internal_uint64_field().size();
+}
+inline int RepeatedWellKnownTypes::uint64_field_size() const {
+  return _internal_uint64_field_size();
+}
+inline ::google::protobuf::UInt64Value* RepeatedWellKnownTypes::mutable_uint64_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return _internal_mutable_uint64_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>* RepeatedWellKnownTypes::mutable_uint64_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_uint64_field();
+}
+inline const ::google::protobuf::UInt64Value& RepeatedWellKnownTypes::uint64_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return _internal_uint64_field().Get(index);
+}
+inline ::google::protobuf::UInt64Value* RepeatedWellKnownTypes::add_uint64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::UInt64Value* _add = _internal_mutable_uint64_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>& RepeatedWellKnownTypes::uint64_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return _internal_uint64_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>&
+RepeatedWellKnownTypes::_internal_uint64_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint64_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>*
+RepeatedWellKnownTypes::_internal_mutable_uint64_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.uint64_field_;
+}
+
+// repeated .google.protobuf.Int32Value int32_field = 14;
+inline int RepeatedWellKnownTypes::_internal_int32_field_size() const {
+  return _internal_int32_field().size();
+}
+inline int RepeatedWellKnownTypes::int32_field_size() const {
+  return _internal_int32_field_size();
+}
+inline ::google::protobuf::Int32Value* RepeatedWellKnownTypes::mutable_int32_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return _internal_mutable_int32_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>* RepeatedWellKnownTypes::mutable_int32_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_int32_field();
+}
+inline const ::google::protobuf::Int32Value& RepeatedWellKnownTypes::int32_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return _internal_int32_field().Get(index);
+}
+inline ::google::protobuf::Int32Value* RepeatedWellKnownTypes::add_int32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Int32Value* _add = _internal_mutable_int32_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>& RepeatedWellKnownTypes::int32_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return _internal_int32_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>&
+RepeatedWellKnownTypes::_internal_int32_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int32_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>*
+RepeatedWellKnownTypes::_internal_mutable_int32_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.int32_field_;
+}
+
+// repeated .google.protobuf.UInt32Value uint32_field = 15;
+inline int RepeatedWellKnownTypes::_internal_uint32_field_size() const {
+  return _internal_uint32_field().size();
+}
+inline int RepeatedWellKnownTypes::uint32_field_size() const {
+  return _internal_uint32_field_size();
+}
+inline ::google::protobuf::UInt32Value* RepeatedWellKnownTypes::mutable_uint32_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return _internal_mutable_uint32_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>* RepeatedWellKnownTypes::mutable_uint32_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_uint32_field();
+}
+inline const ::google::protobuf::UInt32Value& RepeatedWellKnownTypes::uint32_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return _internal_uint32_field().Get(index);
+}
+inline ::google::protobuf::UInt32Value* RepeatedWellKnownTypes::add_uint32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::UInt32Value* _add = _internal_mutable_uint32_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>& RepeatedWellKnownTypes::uint32_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return _internal_uint32_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>&
+RepeatedWellKnownTypes::_internal_uint32_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint32_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>*
+RepeatedWellKnownTypes::_internal_mutable_uint32_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.uint32_field_;
+}
+
+// repeated .google.protobuf.BoolValue bool_field = 16;
+inline int RepeatedWellKnownTypes::_internal_bool_field_size() const {
+  return _internal_bool_field().size();
+}
+inline int RepeatedWellKnownTypes::bool_field_size() const {
+  return _internal_bool_field_size();
+}
+inline ::google::protobuf::BoolValue* RepeatedWellKnownTypes::mutable_bool_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return _internal_mutable_bool_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>* RepeatedWellKnownTypes::mutable_bool_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_bool_field();
+}
+inline const ::google::protobuf::BoolValue& RepeatedWellKnownTypes::bool_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return _internal_bool_field().Get(index);
+}
+inline ::google::protobuf::BoolValue* RepeatedWellKnownTypes::add_bool_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::BoolValue* _add = _internal_mutable_bool_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>& RepeatedWellKnownTypes::bool_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return _internal_bool_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>&
+RepeatedWellKnownTypes::_internal_bool_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>*
+RepeatedWellKnownTypes::_internal_mutable_bool_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.bool_field_;
+}
+
+// repeated .google.protobuf.StringValue string_field = 17;
+inline int RepeatedWellKnownTypes::_internal_string_field_size() const {
+  return _internal_string_field().size();
+}
+inline int RepeatedWellKnownTypes::string_field_size() const {
+  return _internal_string_field_size();
+}
+inline ::google::protobuf::StringValue* RepeatedWellKnownTypes::mutable_string_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return _internal_mutable_string_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>* RepeatedWellKnownTypes::mutable_string_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_string_field();
+}
+inline const ::google::protobuf::StringValue& RepeatedWellKnownTypes::string_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return _internal_string_field().Get(index);
+}
+inline ::google::protobuf::StringValue* RepeatedWellKnownTypes::add_string_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::StringValue* _add = _internal_mutable_string_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>& RepeatedWellKnownTypes::string_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return _internal_string_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>&
+RepeatedWellKnownTypes::_internal_string_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>*
+RepeatedWellKnownTypes::_internal_mutable_string_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.string_field_;
+}
+
+// repeated .google.protobuf.BytesValue bytes_field = 18;
+inline int RepeatedWellKnownTypes::_internal_bytes_field_size() const {
+  return _internal_bytes_field().size();
+}
+inline int RepeatedWellKnownTypes::bytes_field_size() const {
+  return _internal_bytes_field_size();
+}
+inline ::google::protobuf::BytesValue* RepeatedWellKnownTypes::mutable_bytes_field(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return _internal_mutable_bytes_field()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>* RepeatedWellKnownTypes::mutable_bytes_field()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_bytes_field();
+}
+inline const ::google::protobuf::BytesValue& RepeatedWellKnownTypes::bytes_field(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return _internal_bytes_field().Get(index);
+}
+inline ::google::protobuf::BytesValue* RepeatedWellKnownTypes::add_bytes_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::BytesValue* _add = _internal_mutable_bytes_field()->Add();
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>& RepeatedWellKnownTypes::bytes_field() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return _internal_bytes_field();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>&
+RepeatedWellKnownTypes::_internal_bytes_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bytes_field_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>*
+RepeatedWellKnownTypes::_internal_mutable_bytes_field() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.bytes_field_;
+}
+
+// -------------------------------------------------------------------
+
+// OneofWellKnownTypes
+
+// .google.protobuf.Any any_field = 1;
+inline bool OneofWellKnownTypes::has_any_field() const {
+  return oneof_field_case() == kAnyField;
+}
+inline bool OneofWellKnownTypes::_internal_has_any_field() const {
+  return oneof_field_case() == kAnyField;
+}
+inline void OneofWellKnownTypes::set_has_any_field() {
+  _impl_._oneof_case_[0] = kAnyField;
+}
+inline ::google::protobuf::Any* OneofWellKnownTypes::release_any_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.any_field)
+  if (oneof_field_case() == kAnyField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.any_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.any_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Any& OneofWellKnownTypes::_internal_any_field() const {
+  return oneof_field_case() == kAnyField ? *_impl_.oneof_field_.any_field_ : reinterpret_cast<::google::protobuf::Any&>(::google::protobuf::_Any_default_instance_);
+}
+inline const ::google::protobuf::Any& OneofWellKnownTypes::any_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.any_field)
+  return _internal_any_field();
+}
+inline ::google::protobuf::Any* OneofWellKnownTypes::unsafe_arena_release_any_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.any_field)
+  if (oneof_field_case() == kAnyField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.any_field_;
+    _impl_.oneof_field_.any_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_any_field(::google::protobuf::Any* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_any_field();
+    _impl_.oneof_field_.any_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.any_field)
+}
+inline ::google::protobuf::Any* OneofWellKnownTypes::_internal_mutable_any_field() {
+  if (oneof_field_case() != kAnyField) {
+    clear_oneof_field();
+    set_has_any_field();
+    _impl_.oneof_field_.any_field_ = CreateMaybeMessage<::google::protobuf::Any>(GetArena());
+  }
+  return _impl_.oneof_field_.any_field_;
+}
+inline ::google::protobuf::Any* OneofWellKnownTypes::mutable_any_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Any* _msg = _internal_mutable_any_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.any_field)
+  return _msg;
+}
+
+// .google.protobuf.Api api_field = 2;
+inline bool OneofWellKnownTypes::has_api_field() const {
+  return oneof_field_case() == kApiField;
+}
+inline bool OneofWellKnownTypes::_internal_has_api_field() const {
+  return oneof_field_case() == kApiField;
+}
+inline void OneofWellKnownTypes::set_has_api_field() {
+  _impl_._oneof_case_[0] = kApiField;
+}
+inline ::google::protobuf::Api* OneofWellKnownTypes::release_api_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.api_field)
+  if (oneof_field_case() == kApiField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.api_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.api_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Api& OneofWellKnownTypes::_internal_api_field() const {
+  return oneof_field_case() == kApiField ? *_impl_.oneof_field_.api_field_ : reinterpret_cast<::google::protobuf::Api&>(::google::protobuf::_Api_default_instance_);
+}
+inline const ::google::protobuf::Api& OneofWellKnownTypes::api_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.api_field)
+  return _internal_api_field();
+}
+inline ::google::protobuf::Api* OneofWellKnownTypes::unsafe_arena_release_api_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.api_field)
+  if (oneof_field_case() == kApiField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.api_field_;
+    _impl_.oneof_field_.api_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_api_field(::google::protobuf::Api* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_api_field();
+    _impl_.oneof_field_.api_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.api_field)
+}
+inline ::google::protobuf::Api* OneofWellKnownTypes::_internal_mutable_api_field() {
+  if (oneof_field_case() != kApiField) {
+    clear_oneof_field();
+    set_has_api_field();
+    _impl_.oneof_field_.api_field_ = CreateMaybeMessage<::google::protobuf::Api>(GetArena());
+  }
+  return _impl_.oneof_field_.api_field_;
+}
+inline ::google::protobuf::Api* OneofWellKnownTypes::mutable_api_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Api* _msg = _internal_mutable_api_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.api_field)
+  return _msg;
+}
+
+// .google.protobuf.Duration duration_field = 3;
+inline bool OneofWellKnownTypes::has_duration_field() const {
+  return oneof_field_case() == kDurationField;
+}
+inline bool OneofWellKnownTypes::_internal_has_duration_field() const {
+  return oneof_field_case() == kDurationField;
+}
+inline void OneofWellKnownTypes::set_has_duration_field() {
+  _impl_._oneof_case_[0] = kDurationField;
+}
+inline ::google::protobuf::Duration* OneofWellKnownTypes::release_duration_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  if (oneof_field_case() == kDurationField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.duration_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.duration_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Duration& OneofWellKnownTypes::_internal_duration_field() const {
+  return oneof_field_case() == kDurationField ? *_impl_.oneof_field_.duration_field_ : reinterpret_cast<::google::protobuf::Duration&>(::google::protobuf::_Duration_default_instance_);
+}
+inline const ::google::protobuf::Duration& OneofWellKnownTypes::duration_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  return _internal_duration_field();
+}
+inline ::google::protobuf::Duration* OneofWellKnownTypes::unsafe_arena_release_duration_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  if (oneof_field_case() == kDurationField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.duration_field_;
+    _impl_.oneof_field_.duration_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_duration_field(::google::protobuf::Duration* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_duration_field();
+    _impl_.oneof_field_.duration_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.duration_field)
+}
+inline ::google::protobuf::Duration* OneofWellKnownTypes::_internal_mutable_duration_field() {
+  if (oneof_field_case() != kDurationField) {
+    clear_oneof_field();
+    set_has_duration_field();
+    _impl_.oneof_field_.duration_field_ = CreateMaybeMessage<::google::protobuf::Duration>(GetArena());
+  }
+  return _impl_.oneof_field_.duration_field_;
+}
+inline ::google::protobuf::Duration* OneofWellKnownTypes::mutable_duration_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Duration* _msg = _internal_mutable_duration_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  return _msg;
+}
+
+// .google.protobuf.Empty empty_field = 4;
+inline bool OneofWellKnownTypes::has_empty_field() const {
+  return oneof_field_case() == kEmptyField;
+}
+inline bool OneofWellKnownTypes::_internal_has_empty_field() const {
+  return oneof_field_case() == kEmptyField;
+}
+inline void OneofWellKnownTypes::set_has_empty_field() {
+  _impl_._oneof_case_[0] = kEmptyField;
+}
+inline ::google::protobuf::Empty* OneofWellKnownTypes::release_empty_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  if (oneof_field_case() == kEmptyField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.empty_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.empty_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Empty& OneofWellKnownTypes::_internal_empty_field() const {
+  return oneof_field_case() == kEmptyField ? *_impl_.oneof_field_.empty_field_ : reinterpret_cast<::google::protobuf::Empty&>(::google::protobuf::_Empty_default_instance_);
+}
+inline const ::google::protobuf::Empty& OneofWellKnownTypes::empty_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  return _internal_empty_field();
+}
+inline ::google::protobuf::Empty* OneofWellKnownTypes::unsafe_arena_release_empty_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  if (oneof_field_case() == kEmptyField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.empty_field_;
+    _impl_.oneof_field_.empty_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_empty_field(::google::protobuf::Empty* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_empty_field();
+    _impl_.oneof_field_.empty_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.empty_field)
+}
+inline ::google::protobuf::Empty* OneofWellKnownTypes::_internal_mutable_empty_field() {
+  if (oneof_field_case() != kEmptyField) {
+    clear_oneof_field();
+    set_has_empty_field();
+    _impl_.oneof_field_.empty_field_ = CreateMaybeMessage<::google::protobuf::Empty>(GetArena());
+  }
+  return _impl_.oneof_field_.empty_field_;
+}
+inline ::google::protobuf::Empty* OneofWellKnownTypes::mutable_empty_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Empty* _msg = _internal_mutable_empty_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  return _msg;
+}
+
+// .google.protobuf.FieldMask field_mask_field = 5;
+inline bool OneofWellKnownTypes::has_field_mask_field() const {
+  return oneof_field_case() == kFieldMaskField;
+}
+inline bool OneofWellKnownTypes::_internal_has_field_mask_field() const {
+  return oneof_field_case() == kFieldMaskField;
+}
+inline void OneofWellKnownTypes::set_has_field_mask_field() {
+  _impl_._oneof_case_[0] = kFieldMaskField;
+}
+inline ::google::protobuf::FieldMask* OneofWellKnownTypes::release_field_mask_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  if (oneof_field_case() == kFieldMaskField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.field_mask_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.field_mask_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::FieldMask& OneofWellKnownTypes::_internal_field_mask_field() const {
+  return oneof_field_case() == kFieldMaskField ? *_impl_.oneof_field_.field_mask_field_ : reinterpret_cast<::google::protobuf::FieldMask&>(::google::protobuf::_FieldMask_default_instance_);
+}
+inline const ::google::protobuf::FieldMask& OneofWellKnownTypes::field_mask_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  return _internal_field_mask_field();
+}
+inline ::google::protobuf::FieldMask* OneofWellKnownTypes::unsafe_arena_release_field_mask_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  if (oneof_field_case() == kFieldMaskField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.field_mask_field_;
+    _impl_.oneof_field_.field_mask_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_field_mask_field(::google::protobuf::FieldMask* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_field_mask_field();
+    _impl_.oneof_field_.field_mask_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+}
+inline ::google::protobuf::FieldMask* OneofWellKnownTypes::_internal_mutable_field_mask_field() {
+  if (oneof_field_case() != kFieldMaskField) {
+    clear_oneof_field();
+    set_has_field_mask_field();
+    _impl_.oneof_field_.field_mask_field_ = CreateMaybeMessage<::google::protobuf::FieldMask>(GetArena());
+  }
+  return _impl_.oneof_field_.field_mask_field_;
+}
+inline ::google::protobuf::FieldMask* OneofWellKnownTypes::mutable_field_mask_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FieldMask* _msg = _internal_mutable_field_mask_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  return _msg;
+}
+
+// .google.protobuf.SourceContext source_context_field = 6;
+inline bool OneofWellKnownTypes::has_source_context_field() const {
+  return oneof_field_case() == kSourceContextField;
+}
+inline bool OneofWellKnownTypes::_internal_has_source_context_field() const {
+  return oneof_field_case() == kSourceContextField;
+}
+inline void OneofWellKnownTypes::set_has_source_context_field() {
+  _impl_._oneof_case_[0] = kSourceContextField;
+}
+inline ::google::protobuf::SourceContext* OneofWellKnownTypes::release_source_context_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  if (oneof_field_case() == kSourceContextField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.source_context_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.source_context_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::SourceContext& OneofWellKnownTypes::_internal_source_context_field() const {
+  return oneof_field_case() == kSourceContextField ? *_impl_.oneof_field_.source_context_field_ : reinterpret_cast<::google::protobuf::SourceContext&>(::google::protobuf::_SourceContext_default_instance_);
+}
+inline const ::google::protobuf::SourceContext& OneofWellKnownTypes::source_context_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  return _internal_source_context_field();
+}
+inline ::google::protobuf::SourceContext* OneofWellKnownTypes::unsafe_arena_release_source_context_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  if (oneof_field_case() == kSourceContextField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.source_context_field_;
+    _impl_.oneof_field_.source_context_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_source_context_field(::google::protobuf::SourceContext* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_source_context_field();
+    _impl_.oneof_field_.source_context_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+}
+inline ::google::protobuf::SourceContext* OneofWellKnownTypes::_internal_mutable_source_context_field() {
+  if (oneof_field_case() != kSourceContextField) {
+    clear_oneof_field();
+    set_has_source_context_field();
+    _impl_.oneof_field_.source_context_field_ = CreateMaybeMessage<::google::protobuf::SourceContext>(GetArena());
+  }
+  return _impl_.oneof_field_.source_context_field_;
+}
+inline ::google::protobuf::SourceContext* OneofWellKnownTypes::mutable_source_context_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::SourceContext* _msg = _internal_mutable_source_context_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  return _msg;
+}
+
+// .google.protobuf.Struct struct_field = 7;
+inline bool OneofWellKnownTypes::has_struct_field() const {
+  return oneof_field_case() == kStructField;
+}
+inline bool OneofWellKnownTypes::_internal_has_struct_field() const {
+  return oneof_field_case() == kStructField;
+}
+inline void OneofWellKnownTypes::set_has_struct_field() {
+  _impl_._oneof_case_[0] = kStructField;
+}
+inline ::google::protobuf::Struct* OneofWellKnownTypes::release_struct_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  if (oneof_field_case() == kStructField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.struct_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.struct_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Struct& OneofWellKnownTypes::_internal_struct_field() const {
+  return oneof_field_case() == kStructField ? *_impl_.oneof_field_.struct_field_ : reinterpret_cast<::google::protobuf::Struct&>(::google::protobuf::_Struct_default_instance_);
+}
+inline const ::google::protobuf::Struct& OneofWellKnownTypes::struct_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  return _internal_struct_field();
+}
+inline ::google::protobuf::Struct* OneofWellKnownTypes::unsafe_arena_release_struct_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  if (oneof_field_case() == kStructField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.struct_field_;
+    _impl_.oneof_field_.struct_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_struct_field(::google::protobuf::Struct* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_struct_field();
+    _impl_.oneof_field_.struct_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.struct_field)
+}
+inline ::google::protobuf::Struct* OneofWellKnownTypes::_internal_mutable_struct_field() {
+  if (oneof_field_case() != kStructField) {
+    clear_oneof_field();
+    set_has_struct_field();
+    _impl_.oneof_field_.struct_field_ = CreateMaybeMessage<::google::protobuf::Struct>(GetArena());
+  }
+  return _impl_.oneof_field_.struct_field_;
+}
+inline ::google::protobuf::Struct* OneofWellKnownTypes::mutable_struct_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Struct* _msg = _internal_mutable_struct_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  return _msg;
+}
+
+// .google.protobuf.Timestamp timestamp_field = 8;
+inline bool OneofWellKnownTypes::has_timestamp_field() const {
+  return oneof_field_case() == kTimestampField;
+}
+inline bool OneofWellKnownTypes::_internal_has_timestamp_field() const {
+  return oneof_field_case() == kTimestampField;
+}
+inline void OneofWellKnownTypes::set_has_timestamp_field() {
+  _impl_._oneof_case_[0] = kTimestampField;
+}
+inline ::google::protobuf::Timestamp* OneofWellKnownTypes::release_timestamp_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  if (oneof_field_case() == kTimestampField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.timestamp_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.timestamp_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Timestamp& OneofWellKnownTypes::_internal_timestamp_field() const {
+  return oneof_field_case() == kTimestampField ? *_impl_.oneof_field_.timestamp_field_ : reinterpret_cast<::google::protobuf::Timestamp&>(::google::protobuf::_Timestamp_default_instance_);
+}
+inline const ::google::protobuf::Timestamp& OneofWellKnownTypes::timestamp_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  return _internal_timestamp_field();
+}
+inline ::google::protobuf::Timestamp* OneofWellKnownTypes::unsafe_arena_release_timestamp_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  if (oneof_field_case() == kTimestampField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.timestamp_field_;
+    _impl_.oneof_field_.timestamp_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_timestamp_field(::google::protobuf::Timestamp* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_timestamp_field();
+    _impl_.oneof_field_.timestamp_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+}
+inline ::google::protobuf::Timestamp* OneofWellKnownTypes::_internal_mutable_timestamp_field() {
+  if (oneof_field_case() != kTimestampField) {
+    clear_oneof_field();
+    set_has_timestamp_field();
+    _impl_.oneof_field_.timestamp_field_ = CreateMaybeMessage<::google::protobuf::Timestamp>(GetArena());
+  }
+  return _impl_.oneof_field_.timestamp_field_;
+}
+inline ::google::protobuf::Timestamp* OneofWellKnownTypes::mutable_timestamp_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Timestamp* _msg = _internal_mutable_timestamp_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  return _msg;
+}
+
+// .google.protobuf.Type type_field = 9;
+inline bool OneofWellKnownTypes::has_type_field() const {
+  return oneof_field_case() == kTypeField;
+}
+inline bool OneofWellKnownTypes::_internal_has_type_field() const {
+  return oneof_field_case() == kTypeField;
+}
+inline void OneofWellKnownTypes::set_has_type_field() {
+  _impl_._oneof_case_[0] = kTypeField;
+}
+inline ::google::protobuf::Type* OneofWellKnownTypes::release_type_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.type_field)
+  if (oneof_field_case() == kTypeField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.type_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.type_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Type& OneofWellKnownTypes::_internal_type_field() const {
+  return oneof_field_case() == kTypeField ? *_impl_.oneof_field_.type_field_ : reinterpret_cast<::google::protobuf::Type&>(::google::protobuf::_Type_default_instance_);
+}
+inline const ::google::protobuf::Type& OneofWellKnownTypes::type_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.type_field)
+  return _internal_type_field();
+}
+inline ::google::protobuf::Type* OneofWellKnownTypes::unsafe_arena_release_type_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.type_field)
+  if (oneof_field_case() == kTypeField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.type_field_;
+    _impl_.oneof_field_.type_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_type_field(::google::protobuf::Type* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_type_field();
+    _impl_.oneof_field_.type_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.type_field)
+}
+inline ::google::protobuf::Type* OneofWellKnownTypes::_internal_mutable_type_field() {
+  if (oneof_field_case() != kTypeField) {
+    clear_oneof_field();
+    set_has_type_field();
+    _impl_.oneof_field_.type_field_ = CreateMaybeMessage<::google::protobuf::Type>(GetArena());
+  }
+  return _impl_.oneof_field_.type_field_;
+}
+inline ::google::protobuf::Type* OneofWellKnownTypes::mutable_type_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Type* _msg = _internal_mutable_type_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.type_field)
+  return _msg;
+}
+
+// .google.protobuf.DoubleValue double_field = 10;
+inline bool OneofWellKnownTypes::has_double_field() const {
+  return oneof_field_case() == kDoubleField;
+}
+inline bool OneofWellKnownTypes::_internal_has_double_field() const {
+  return oneof_field_case() == kDoubleField;
+}
+inline void OneofWellKnownTypes::set_has_double_field() {
+  _impl_._oneof_case_[0] = kDoubleField;
+}
+inline ::google::protobuf::DoubleValue* OneofWellKnownTypes::release_double_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.double_field)
+  if (oneof_field_case() == kDoubleField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.double_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.double_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::DoubleValue& OneofWellKnownTypes::_internal_double_field() const {
+  return oneof_field_case() == kDoubleField ? *_impl_.oneof_field_.double_field_ : reinterpret_cast<::google::protobuf::DoubleValue&>(::google::protobuf::_DoubleValue_default_instance_);
+}
+inline const ::google::protobuf::DoubleValue& OneofWellKnownTypes::double_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.double_field)
+  return _internal_double_field();
+}
+inline ::google::protobuf::DoubleValue* OneofWellKnownTypes::unsafe_arena_release_double_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.double_field)
+  if (oneof_field_case() == kDoubleField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.double_field_;
+    _impl_.oneof_field_.double_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_double_field(::google::protobuf::DoubleValue* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_double_field();
+    _impl_.oneof_field_.double_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.double_field)
+}
+inline ::google::protobuf::DoubleValue* OneofWellKnownTypes::_internal_mutable_double_field() {
+  if (oneof_field_case() != kDoubleField) {
+    clear_oneof_field();
+    set_has_double_field();
+    _impl_.oneof_field_.double_field_ = CreateMaybeMessage<::google::protobuf::DoubleValue>(GetArena());
+  }
+  return _impl_.oneof_field_.double_field_;
+}
+inline ::google::protobuf::DoubleValue* OneofWellKnownTypes::mutable_double_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::DoubleValue* _msg = _internal_mutable_double_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.double_field)
+  return _msg;
+}
+
+// .google.protobuf.FloatValue float_field = 11;
+inline bool OneofWellKnownTypes::has_float_field() const {
+  return oneof_field_case() == kFloatField;
+}
+inline bool OneofWellKnownTypes::_internal_has_float_field() const {
+  return oneof_field_case() == kFloatField;
+}
+inline void OneofWellKnownTypes::set_has_float_field() {
+  _impl_._oneof_case_[0] = kFloatField;
+}
+inline ::google::protobuf::FloatValue* OneofWellKnownTypes::release_float_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.float_field)
+  if (oneof_field_case() == kFloatField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.float_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.float_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::FloatValue& OneofWellKnownTypes::_internal_float_field() const {
+  return oneof_field_case() == kFloatField ? *_impl_.oneof_field_.float_field_ : reinterpret_cast<::google::protobuf::FloatValue&>(::google::protobuf::_FloatValue_default_instance_);
+}
+inline const ::google::protobuf::FloatValue& OneofWellKnownTypes::float_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.float_field)
+  return _internal_float_field();
+}
+inline ::google::protobuf::FloatValue* OneofWellKnownTypes::unsafe_arena_release_float_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.float_field)
+  if (oneof_field_case() == kFloatField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.float_field_;
+    _impl_.oneof_field_.float_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_float_field(::google::protobuf::FloatValue* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_float_field();
+    _impl_.oneof_field_.float_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.float_field)
+}
+inline ::google::protobuf::FloatValue* OneofWellKnownTypes::_internal_mutable_float_field() {
+  if (oneof_field_case() != kFloatField) {
+    clear_oneof_field();
+    set_has_float_field();
+    _impl_.oneof_field_.float_field_ = CreateMaybeMessage<::google::protobuf::FloatValue>(GetArena());
+  }
+  return _impl_.oneof_field_.float_field_;
+}
+inline ::google::protobuf::FloatValue* OneofWellKnownTypes::mutable_float_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FloatValue* _msg = _internal_mutable_float_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.float_field)
+  return _msg;
+}
+
+// .google.protobuf.Int64Value int64_field = 12;
+inline bool OneofWellKnownTypes::has_int64_field() const {
+  return oneof_field_case() == kInt64Field;
+}
+inline bool OneofWellKnownTypes::_internal_has_int64_field() const {
+  return oneof_field_case() == kInt64Field;
+}
+inline void OneofWellKnownTypes::set_has_int64_field() {
+  _impl_._oneof_case_[0] = kInt64Field;
+}
+inline ::google::protobuf::Int64Value* OneofWellKnownTypes::release_int64_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  if (oneof_field_case() == kInt64Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.int64_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.int64_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Int64Value& OneofWellKnownTypes::_internal_int64_field() const {
+  return oneof_field_case() == kInt64Field ? *_impl_.oneof_field_.int64_field_ : reinterpret_cast<::google::protobuf::Int64Value&>(::google::protobuf::_Int64Value_default_instance_);
+}
+inline const ::google::protobuf::Int64Value& OneofWellKnownTypes::int64_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  return _internal_int64_field();
+}
+inline ::google::protobuf::Int64Value* OneofWellKnownTypes::unsafe_arena_release_int64_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  if (oneof_field_case() == kInt64Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.int64_field_;
+    _impl_.oneof_field_.int64_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_int64_field(::google::protobuf::Int64Value* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_int64_field();
+    _impl_.oneof_field_.int64_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.int64_field)
+}
+inline ::google::protobuf::Int64Value* OneofWellKnownTypes::_internal_mutable_int64_field() {
+  if (oneof_field_case() != kInt64Field) {
+    clear_oneof_field();
+    set_has_int64_field();
+    _impl_.oneof_field_.int64_field_ = CreateMaybeMessage<::google::protobuf::Int64Value>(GetArena());
+  }
+  return _impl_.oneof_field_.int64_field_;
+}
+inline ::google::protobuf::Int64Value* OneofWellKnownTypes::mutable_int64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Int64Value* _msg = _internal_mutable_int64_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  return _msg;
+}
+
+// .google.protobuf.UInt64Value uint64_field = 13;
+inline bool OneofWellKnownTypes::has_uint64_field() const {
+  return oneof_field_case() == kUint64Field;
+}
+inline bool OneofWellKnownTypes::_internal_has_uint64_field() const {
+  return oneof_field_case() == kUint64Field;
+}
+inline void OneofWellKnownTypes::set_has_uint64_field() {
+  _impl_._oneof_case_[0] = kUint64Field;
+}
+inline ::google::protobuf::UInt64Value* OneofWellKnownTypes::release_uint64_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  if (oneof_field_case() == kUint64Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.uint64_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.uint64_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::UInt64Value& OneofWellKnownTypes::_internal_uint64_field() const {
+  return oneof_field_case() == kUint64Field ? *_impl_.oneof_field_.uint64_field_ : reinterpret_cast<::google::protobuf::UInt64Value&>(::google::protobuf::_UInt64Value_default_instance_);
+}
+inline const ::google::protobuf::UInt64Value& OneofWellKnownTypes::uint64_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  return _internal_uint64_field();
+}
+inline ::google::protobuf::UInt64Value* OneofWellKnownTypes::unsafe_arena_release_uint64_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  if (oneof_field_case() == kUint64Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.uint64_field_;
+    _impl_.oneof_field_.uint64_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_uint64_field(::google::protobuf::UInt64Value* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_uint64_field();
+    _impl_.oneof_field_.uint64_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+}
+inline ::google::protobuf::UInt64Value* OneofWellKnownTypes::_internal_mutable_uint64_field() {
+  if (oneof_field_case() != kUint64Field) {
+    clear_oneof_field();
+    set_has_uint64_field();
+    _impl_.oneof_field_.uint64_field_ = CreateMaybeMessage<::google::protobuf::UInt64Value>(GetArena());
+  }
+  return _impl_.oneof_field_.uint64_field_;
+}
+inline ::google::protobuf::UInt64Value* OneofWellKnownTypes::mutable_uint64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::UInt64Value* _msg = _internal_mutable_uint64_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  return _msg;
+}
+
+// .google.protobuf.Int32Value int32_field = 14;
+inline bool OneofWellKnownTypes::has_int32_field() const {
+  return oneof_field_case() == kInt32Field;
+}
+inline bool OneofWellKnownTypes::_internal_has_int32_field() const {
+  return oneof_field_case() == kInt32Field;
+}
+inline void OneofWellKnownTypes::set_has_int32_field() {
+  _impl_._oneof_case_[0] = kInt32Field;
+}
+inline ::google::protobuf::Int32Value* OneofWellKnownTypes::release_int32_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  if (oneof_field_case() == kInt32Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.int32_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.int32_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::Int32Value& OneofWellKnownTypes::_internal_int32_field() const {
+  return oneof_field_case() == kInt32Field ? *_impl_.oneof_field_.int32_field_ : reinterpret_cast<::google::protobuf::Int32Value&>(::google::protobuf::_Int32Value_default_instance_);
+}
+inline const ::google::protobuf::Int32Value& OneofWellKnownTypes::int32_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  return _internal_int32_field();
+}
+inline ::google::protobuf::Int32Value* OneofWellKnownTypes::unsafe_arena_release_int32_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  if (oneof_field_case() == kInt32Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.int32_field_;
+    _impl_.oneof_field_.int32_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_int32_field(::google::protobuf::Int32Value* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_int32_field();
+    _impl_.oneof_field_.int32_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.int32_field)
+}
+inline ::google::protobuf::Int32Value* OneofWellKnownTypes::_internal_mutable_int32_field() {
+  if (oneof_field_case() != kInt32Field) {
+    clear_oneof_field();
+    set_has_int32_field();
+    _impl_.oneof_field_.int32_field_ = CreateMaybeMessage<::google::protobuf::Int32Value>(GetArena());
+  }
+  return _impl_.oneof_field_.int32_field_;
+}
+inline ::google::protobuf::Int32Value* OneofWellKnownTypes::mutable_int32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Int32Value* _msg = _internal_mutable_int32_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  return _msg;
+}
+
+// .google.protobuf.UInt32Value uint32_field = 15;
+inline bool OneofWellKnownTypes::has_uint32_field() const {
+  return oneof_field_case() == kUint32Field;
+}
+inline bool OneofWellKnownTypes::_internal_has_uint32_field() const {
+  return oneof_field_case() == kUint32Field;
+}
+inline void OneofWellKnownTypes::set_has_uint32_field() {
+  _impl_._oneof_case_[0] = kUint32Field;
+}
+inline ::google::protobuf::UInt32Value* OneofWellKnownTypes::release_uint32_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  if (oneof_field_case() == kUint32Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.uint32_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.uint32_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::UInt32Value& OneofWellKnownTypes::_internal_uint32_field() const {
+  return oneof_field_case() == kUint32Field ? *_impl_.oneof_field_.uint32_field_ : reinterpret_cast<::google::protobuf::UInt32Value&>(::google::protobuf::_UInt32Value_default_instance_);
+}
+inline const ::google::protobuf::UInt32Value& OneofWellKnownTypes::uint32_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  return _internal_uint32_field();
+}
+inline ::google::protobuf::UInt32Value* OneofWellKnownTypes::unsafe_arena_release_uint32_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  if (oneof_field_case() == kUint32Field) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.uint32_field_;
+    _impl_.oneof_field_.uint32_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_uint32_field(::google::protobuf::UInt32Value* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_uint32_field();
+    _impl_.oneof_field_.uint32_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+}
+inline ::google::protobuf::UInt32Value* OneofWellKnownTypes::_internal_mutable_uint32_field() {
+  if (oneof_field_case() != kUint32Field) {
+    clear_oneof_field();
+    set_has_uint32_field();
+    _impl_.oneof_field_.uint32_field_ = CreateMaybeMessage<::google::protobuf::UInt32Value>(GetArena());
+  }
+  return _impl_.oneof_field_.uint32_field_;
+}
+inline ::google::protobuf::UInt32Value* OneofWellKnownTypes::mutable_uint32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::UInt32Value* _msg = _internal_mutable_uint32_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  return _msg;
+}
+
+// .google.protobuf.BoolValue bool_field = 16;
+inline bool OneofWellKnownTypes::has_bool_field() const {
+  return oneof_field_case() == kBoolField;
+}
+inline bool OneofWellKnownTypes::_internal_has_bool_field() const {
+  return oneof_field_case() == kBoolField;
+}
+inline void OneofWellKnownTypes::set_has_bool_field() {
+  _impl_._oneof_case_[0] = kBoolField;
+}
+inline ::google::protobuf::BoolValue* OneofWellKnownTypes::release_bool_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  if (oneof_field_case() == kBoolField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.bool_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.bool_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::BoolValue& OneofWellKnownTypes::_internal_bool_field() const {
+  return oneof_field_case() == kBoolField ? *_impl_.oneof_field_.bool_field_ : reinterpret_cast<::google::protobuf::BoolValue&>(::google::protobuf::_BoolValue_default_instance_);
+}
+inline const ::google::protobuf::BoolValue& OneofWellKnownTypes::bool_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  return _internal_bool_field();
+}
+inline ::google::protobuf::BoolValue* OneofWellKnownTypes::unsafe_arena_release_bool_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  if (oneof_field_case() == kBoolField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.bool_field_;
+    _impl_.oneof_field_.bool_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_bool_field(::google::protobuf::BoolValue* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_bool_field();
+    _impl_.oneof_field_.bool_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.bool_field)
+}
+inline ::google::protobuf::BoolValue* OneofWellKnownTypes::_internal_mutable_bool_field() {
+  if (oneof_field_case() != kBoolField) {
+    clear_oneof_field();
+    set_has_bool_field();
+    _impl_.oneof_field_.bool_field_ = CreateMaybeMessage<::google::protobuf::BoolValue>(GetArena());
+  }
+  return _impl_.oneof_field_.bool_field_;
+}
+inline ::google::protobuf::BoolValue* OneofWellKnownTypes::mutable_bool_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::BoolValue* _msg = _internal_mutable_bool_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  return _msg;
+}
+
+// .google.protobuf.StringValue string_field = 17;
+inline bool OneofWellKnownTypes::has_string_field() const {
+  return oneof_field_case() == kStringField;
+}
+inline bool OneofWellKnownTypes::_internal_has_string_field() const {
+  return oneof_field_case() == kStringField;
+}
+inline void OneofWellKnownTypes::set_has_string_field() {
+  _impl_._oneof_case_[0] = kStringField;
+}
+inline ::google::protobuf::StringValue* OneofWellKnownTypes::release_string_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.string_field)
+  if (oneof_field_case() == kStringField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.string_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.string_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::StringValue& OneofWellKnownTypes::_internal_string_field() const {
+  return oneof_field_case() == kStringField ? *_impl_.oneof_field_.string_field_ : reinterpret_cast<::google::protobuf::StringValue&>(::google::protobuf::_StringValue_default_instance_);
+}
+inline const ::google::protobuf::StringValue& OneofWellKnownTypes::string_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.string_field)
+  return _internal_string_field();
+}
+inline ::google::protobuf::StringValue* OneofWellKnownTypes::unsafe_arena_release_string_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.string_field)
+  if (oneof_field_case() == kStringField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.string_field_;
+    _impl_.oneof_field_.string_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_string_field(::google::protobuf::StringValue* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_string_field();
+    _impl_.oneof_field_.string_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.string_field)
+}
+inline ::google::protobuf::StringValue* OneofWellKnownTypes::_internal_mutable_string_field() {
+  if (oneof_field_case() != kStringField) {
+    clear_oneof_field();
+    set_has_string_field();
+    _impl_.oneof_field_.string_field_ = CreateMaybeMessage<::google::protobuf::StringValue>(GetArena());
+  }
+  return _impl_.oneof_field_.string_field_;
+}
+inline ::google::protobuf::StringValue* OneofWellKnownTypes::mutable_string_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::StringValue* _msg = _internal_mutable_string_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.string_field)
+  return _msg;
+}
+
+// .google.protobuf.BytesValue bytes_field = 18;
+inline bool OneofWellKnownTypes::has_bytes_field() const {
+  return oneof_field_case() == kBytesField;
+}
+inline bool OneofWellKnownTypes::_internal_has_bytes_field() const {
+  return oneof_field_case() == kBytesField;
+}
+inline void OneofWellKnownTypes::set_has_bytes_field() {
+  _impl_._oneof_case_[0] = kBytesField;
+}
+inline ::google::protobuf::BytesValue* OneofWellKnownTypes::release_bytes_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  if (oneof_field_case() == kBytesField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.bytes_field_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_field_.bytes_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::google::protobuf::BytesValue& OneofWellKnownTypes::_internal_bytes_field() const {
+  return oneof_field_case() == kBytesField ? *_impl_.oneof_field_.bytes_field_ : reinterpret_cast<::google::protobuf::BytesValue&>(::google::protobuf::_BytesValue_default_instance_);
+}
+inline const ::google::protobuf::BytesValue& OneofWellKnownTypes::bytes_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  return _internal_bytes_field();
+}
+inline ::google::protobuf::BytesValue* OneofWellKnownTypes::unsafe_arena_release_bytes_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  if (oneof_field_case() == kBytesField) {
+    clear_has_oneof_field();
+    auto* temp = _impl_.oneof_field_.bytes_field_;
+    _impl_.oneof_field_.bytes_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OneofWellKnownTypes::unsafe_arena_set_allocated_bytes_field(::google::protobuf::BytesValue* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_field();
+  if (value) {
+    set_has_bytes_field();
+    _impl_.oneof_field_.bytes_field_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+}
+inline ::google::protobuf::BytesValue* OneofWellKnownTypes::_internal_mutable_bytes_field() {
+  if (oneof_field_case() != kBytesField) {
+    clear_oneof_field();
+    set_has_bytes_field();
+    _impl_.oneof_field_.bytes_field_ = CreateMaybeMessage<::google::protobuf::BytesValue>(GetArena());
+  }
+  return _impl_.oneof_field_.bytes_field_;
+}
+inline ::google::protobuf::BytesValue* OneofWellKnownTypes::mutable_bytes_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::BytesValue* _msg = _internal_mutable_bytes_field();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  return _msg;
+}
+
+inline bool OneofWellKnownTypes::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void OneofWellKnownTypes::clear_has_oneof_field() {
+  _impl_._oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline OneofWellKnownTypes::OneofFieldCase OneofWellKnownTypes::oneof_field_case() const {
+  return OneofWellKnownTypes::OneofFieldCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapWellKnownTypes
+
+// map<int32, .google.protobuf.Any> any_field = 1;
+inline int MapWellKnownTypes::_internal_any_field_size() const {
+  return _internal_any_field().size();
+}
+inline int MapWellKnownTypes::any_field_size() const {
+  return _internal_any_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>& MapWellKnownTypes::_internal_any_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.any_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>& MapWellKnownTypes::any_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.any_field)
+  return _internal_any_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>* MapWellKnownTypes::_internal_mutable_any_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.any_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Any>* MapWellKnownTypes::mutable_any_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.any_field)
+  return _internal_mutable_any_field();
+}
+
+// map<int32, .google.protobuf.Api> api_field = 2;
+inline int MapWellKnownTypes::_internal_api_field_size() const {
+  return _internal_api_field().size();
+}
+inline int MapWellKnownTypes::api_field_size() const {
+  return _internal_api_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>& MapWellKnownTypes::_internal_api_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.api_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>& MapWellKnownTypes::api_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.api_field)
+  return _internal_api_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>* MapWellKnownTypes::_internal_mutable_api_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.api_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Api>* MapWellKnownTypes::mutable_api_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.api_field)
+  return _internal_mutable_api_field();
+}
+
+// map<int32, .google.protobuf.Duration> duration_field = 3;
+inline int MapWellKnownTypes::_internal_duration_field_size() const {
+  return _internal_duration_field().size();
+}
+inline int MapWellKnownTypes::duration_field_size() const {
+  return _internal_duration_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>& MapWellKnownTypes::_internal_duration_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.duration_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>& MapWellKnownTypes::duration_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.duration_field)
+  return _internal_duration_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>* MapWellKnownTypes::_internal_mutable_duration_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.duration_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Duration>* MapWellKnownTypes::mutable_duration_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.duration_field)
+  return _internal_mutable_duration_field();
+}
+
+// map<int32, .google.protobuf.Empty> empty_field = 4;
+inline int MapWellKnownTypes::_internal_empty_field_size() const {
+  return _internal_empty_field().size();
+}
+inline int MapWellKnownTypes::empty_field_size() const {
+  return _internal_empty_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>& MapWellKnownTypes::_internal_empty_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.empty_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>& MapWellKnownTypes::empty_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.empty_field)
+  return _internal_empty_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>* MapWellKnownTypes::_internal_mutable_empty_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.empty_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Empty>* MapWellKnownTypes::mutable_empty_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.empty_field)
+  return _internal_mutable_empty_field();
+}
+
+// map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+inline int MapWellKnownTypes::_internal_field_mask_field_size() const {
+  return _internal_field_mask_field().size();
+}
+inline int MapWellKnownTypes::field_mask_field_size() const {
+  return _internal_field_mask_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>& MapWellKnownTypes::_internal_field_mask_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.field_mask_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>& MapWellKnownTypes::field_mask_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.field_mask_field)
+  return _internal_field_mask_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>* MapWellKnownTypes::_internal_mutable_field_mask_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.field_mask_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::FieldMask>* MapWellKnownTypes::mutable_field_mask_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.field_mask_field)
+  return _internal_mutable_field_mask_field();
+}
+
+// map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+inline int MapWellKnownTypes::_internal_source_context_field_size() const {
+  return _internal_source_context_field().size();
+}
+inline int MapWellKnownTypes::source_context_field_size() const {
+  return _internal_source_context_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>& MapWellKnownTypes::_internal_source_context_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.source_context_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>& MapWellKnownTypes::source_context_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.source_context_field)
+  return _internal_source_context_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>* MapWellKnownTypes::_internal_mutable_source_context_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.source_context_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::SourceContext>* MapWellKnownTypes::mutable_source_context_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.source_context_field)
+  return _internal_mutable_source_context_field();
+}
+
+// map<int32, .google.protobuf.Struct> struct_field = 7;
+inline int MapWellKnownTypes::_internal_struct_field_size() const {
+  return _internal_struct_field().size();
+}
+inline int MapWellKnownTypes::struct_field_size() const {
+  return _internal_struct_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>& MapWellKnownTypes::_internal_struct_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.struct_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>& MapWellKnownTypes::struct_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.struct_field)
+  return _internal_struct_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>* MapWellKnownTypes::_internal_mutable_struct_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.struct_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Struct>* MapWellKnownTypes::mutable_struct_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.struct_field)
+  return _internal_mutable_struct_field();
+}
+
+// map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+inline int MapWellKnownTypes::_internal_timestamp_field_size() const {
+  return _internal_timestamp_field().size();
+}
+inline int MapWellKnownTypes::timestamp_field_size() const {
+  return _internal_timestamp_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>& MapWellKnownTypes::_internal_timestamp_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.timestamp_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>& MapWellKnownTypes::timestamp_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.timestamp_field)
+  return _internal_timestamp_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>* MapWellKnownTypes::_internal_mutable_timestamp_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.timestamp_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Timestamp>* MapWellKnownTypes::mutable_timestamp_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.timestamp_field)
+  return _internal_mutable_timestamp_field();
+}
+
+// map<int32, .google.protobuf.Type> type_field = 9;
+inline int MapWellKnownTypes::_internal_type_field_size() const {
+  return _internal_type_field().size();
+}
+inline int MapWellKnownTypes::type_field_size() const {
+  return _internal_type_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>& MapWellKnownTypes::_internal_type_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.type_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>& MapWellKnownTypes::type_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.type_field)
+  return _internal_type_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>* MapWellKnownTypes::_internal_mutable_type_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.type_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Type>* MapWellKnownTypes::mutable_type_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.type_field)
+  return _internal_mutable_type_field();
+}
+
+// map<int32, .google.protobuf.DoubleValue> double_field = 10;
+inline int MapWellKnownTypes::_internal_double_field_size() const {
+  return _internal_double_field().size();
+}
+inline int MapWellKnownTypes::double_field_size() const {
+  return _internal_double_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>& MapWellKnownTypes::_internal_double_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.double_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>& MapWellKnownTypes::double_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.double_field)
+  return _internal_double_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>* MapWellKnownTypes::_internal_mutable_double_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.double_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::DoubleValue>* MapWellKnownTypes::mutable_double_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.double_field)
+  return _internal_mutable_double_field();
+}
+
+// map<int32, .google.protobuf.FloatValue> float_field = 11;
+inline int MapWellKnownTypes::_internal_float_field_size() const {
+  return _internal_float_field().size();
+}
+inline int MapWellKnownTypes::float_field_size() const {
+  return _internal_float_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>& MapWellKnownTypes::_internal_float_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.float_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>& MapWellKnownTypes::float_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.float_field)
+  return _internal_float_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>* MapWellKnownTypes::_internal_mutable_float_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.float_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::FloatValue>* MapWellKnownTypes::mutable_float_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.float_field)
+  return _internal_mutable_float_field();
+}
+
+// map<int32, .google.protobuf.Int64Value> int64_field = 12;
+inline int MapWellKnownTypes::_internal_int64_field_size() const {
+  return _internal_int64_field().size();
+}
+inline int MapWellKnownTypes::int64_field_size() const {
+  return _internal_int64_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>& MapWellKnownTypes::_internal_int64_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int64_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>& MapWellKnownTypes::int64_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.int64_field)
+  return _internal_int64_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>* MapWellKnownTypes::_internal_mutable_int64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.int64_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Int64Value>* MapWellKnownTypes::mutable_int64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.int64_field)
+  return _internal_mutable_int64_field();
+}
+
+// map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+inline int MapWellKnownTypes::_internal_uint64_field_size() const {
+  return _internal_uint64_field().size();
+}
+inline int MapWellKnownTypes::uint64_field_size() const {
+  return _internal_uint64_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>& MapWellKnownTypes::_internal_uint64_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint64_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>& MapWellKnownTypes::uint64_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.uint64_field)
+  return _internal_uint64_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>* MapWellKnownTypes::_internal_mutable_uint64_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.uint64_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt64Value>* MapWellKnownTypes::mutable_uint64_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.uint64_field)
+  return _internal_mutable_uint64_field();
+}
+
+// map<int32, .google.protobuf.Int32Value> int32_field = 14;
+inline int MapWellKnownTypes::_internal_int32_field_size() const {
+  return _internal_int32_field().size();
+}
+inline int MapWellKnownTypes::int32_field_size() const {
+  return _internal_int32_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>& MapWellKnownTypes::_internal_int32_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int32_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>& MapWellKnownTypes::int32_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.int32_field)
+  return _internal_int32_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>* MapWellKnownTypes::_internal_mutable_int32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.int32_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::Int32Value>* MapWellKnownTypes::mutable_int32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.int32_field)
+  return _internal_mutable_int32_field();
+}
+
+// map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+inline int MapWellKnownTypes::_internal_uint32_field_size() const {
+  return _internal_uint32_field().size();
+}
+inline int MapWellKnownTypes::uint32_field_size() const {
+  return _internal_uint32_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>& MapWellKnownTypes::_internal_uint32_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint32_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>& MapWellKnownTypes::uint32_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.uint32_field)
+  return _internal_uint32_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>* MapWellKnownTypes::_internal_mutable_uint32_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.uint32_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::UInt32Value>* MapWellKnownTypes::mutable_uint32_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.uint32_field)
+  return _internal_mutable_uint32_field();
+}
+
+// map<int32, .google.protobuf.BoolValue> bool_field = 16;
+inline int MapWellKnownTypes::_internal_bool_field_size() const {
+  return _internal_bool_field().size();
+}
+inline int MapWellKnownTypes::bool_field_size() const {
+  return _internal_bool_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>& MapWellKnownTypes::_internal_bool_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>& MapWellKnownTypes::bool_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.bool_field)
+  return _internal_bool_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>* MapWellKnownTypes::_internal_mutable_bool_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.bool_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::BoolValue>* MapWellKnownTypes::mutable_bool_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.bool_field)
+  return _internal_mutable_bool_field();
+}
+
+// map<int32, .google.protobuf.StringValue> string_field = 17;
+inline int MapWellKnownTypes::_internal_string_field_size() const {
+  return _internal_string_field().size();
+}
+inline int MapWellKnownTypes::string_field_size() const {
+  return _internal_string_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>& MapWellKnownTypes::_internal_string_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>& MapWellKnownTypes::string_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.string_field)
+  return _internal_string_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>* MapWellKnownTypes::_internal_mutable_string_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.string_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::StringValue>* MapWellKnownTypes::mutable_string_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.string_field)
+  return _internal_mutable_string_field();
+}
+
+// map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+inline int MapWellKnownTypes::_internal_bytes_field_size() const {
+  return _internal_bytes_field().size();
+}
+inline int MapWellKnownTypes::bytes_field_size() const {
+  return _internal_bytes_field_size();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>& MapWellKnownTypes::_internal_bytes_field() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bytes_field_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>& MapWellKnownTypes::bytes_field() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.bytes_field)
+  return _internal_bytes_field();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>* MapWellKnownTypes::_internal_mutable_bytes_field() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.bytes_field_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::google::protobuf::BytesValue>* MapWellKnownTypes::mutable_bytes_field() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.bytes_field)
+  return _internal_mutable_bytes_field();
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_2epb_2eh
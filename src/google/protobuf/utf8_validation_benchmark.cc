@@ -0,0 +1,141 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2023 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Compares the UTF-8 validators used on parse: the byte-at-a-time
+// utf8_range::SpanStructurallyValid(), the compile-time selected
+// utf8_range2() that upb used, and the runtime-dispatched
+// utf8_range_IsValid() that both runtimes use now. Also measures parsing
+// proto3 messages full of strings, which validates every one of them.
+// Results are printed as one JSON object per line.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "google/protobuf/unittest_proto3.pb.h"
+#include "utf8_range.h"
+#include "utf8_validity.h"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+// Runs `fn`, which processes `bytes` bytes, until at least half a second has
+// passed, and returns the throughput in GB/s.
+template <typename Fn>
+double MeasureGbps(size_t bytes, Fn fn) {
+  int64_t iterations = 0;
+  absl::Time start = absl::Now();
+  absl::Duration elapsed;
+  do {
+    fn();
+    ++iterations;
+    elapsed = absl::Now() - start;
+  } while (elapsed < absl::Milliseconds(500));
+  return static_cast<double>(bytes) * static_cast<double>(iterations) /
+         absl::ToDoubleSeconds(elapsed) / 1e9;
+}
+
+// Returns `count` strings of `size` bytes. If `non_ascii` is set, about one
+// character in twenty is a two- or three-byte sequence.
+std::vector<std::string> MakeStrings(absl::BitGen& gen, size_t count,
+                                     size_t size, bool non_ascii) {
+  std::vector<std::string> strings(count);
+  for (std::string& str : strings) {
+    while (str.size() < size) {
+      if (non_ascii && size - str.size() >= 3 && absl::Bernoulli(gen, 0.05)) {
+        str += absl::Bernoulli(gen, 0.5) ? "\xc3\xa9" : "\xe2\x82\xac";
+      } else {
+        str.push_back(static_cast<char>(absl::Uniform<int>(gen, 'a', 'z')));
+      }
+    }
+  }
+  return strings;
+}
+
+void BenchmarkValidators(absl::BitGen& gen) {
+  for (bool non_ascii : {false, true}) {
+    for (size_t size : {8, 16, 32, 64, 128, 512, 4096}) {
+      // About 1MiB of strings in total, so that they stay in cache.
+      std::vector<std::string> strings =
+          MakeStrings(gen, (1 << 20) / size, size, non_ascii);
+      size_t total = strings.size() * size;
+      size_t valid = 0;
+
+      double span = MeasureGbps(total, [&] {
+        for (const std::string& str : strings) {
+          valid += utf8_range::SpanStructurallyValid(str) == str.size();
+        }
+      });
+      double range2 = MeasureGbps(total, [&] {
+        for (const std::string& str : strings) {
+          valid += utf8_range2(reinterpret_cast<const unsigned char*>(
+                                   str.data()),
+                               static_cast<int>(str.size())) == 0;
+        }
+      });
+      double dispatched = MeasureGbps(total, [&] {
+        for (const std::string& str : strings) {
+          valid += utf8_range_IsValid(str.data(), str.size());
+        }
+      });
+      double runtime = MeasureGbps(total, [&] {
+        for (const std::string& str : strings) {
+          valid += utf8_range::IsStructurallyValid(str);
+        }
+      });
+
+      absl::PrintF(
+          "{\"benchmark\": \"validate\", \"avx2\": %s, \"non_ascii\": %s, "
+          "\"size\": %d, \"span_gbps\": %.3f, \"utf8_range2_gbps\": %.3f, "
+          "\"utf8_range_IsValid_gbps\": %.3f, "
+          "\"IsStructurallyValid_gbps\": %.3f, \"valid\": %d}\n",
+          utf8_range_HasAvx2() ? "true" : "false",
+          non_ascii ? "true" : "false", size, span, range2, dispatched,
+          runtime, static_cast<int>(valid > 0));
+    }
+  }
+}
+
+void BenchmarkParse(absl::BitGen& gen) {
+  for (size_t size : {16, 64, 256}) {
+    proto3_unittest::TestAllTypes message;
+    for (std::string& str : MakeStrings(gen, 4096, size, true)) {
+      *message.add_repeated_string() = std::move(str);
+    }
+    std::string wire = message.SerializeAsString();
+
+    proto3_unittest::TestAllTypes parsed;
+    double gbps = MeasureGbps(wire.size(), [&] {
+      if (!parsed.ParseFromString(wire)) {
+        absl::PrintF("parse failed\n");
+      }
+    });
+    absl::PrintF(
+        "{\"benchmark\": \"parse_strings\", \"avx2\": %s, \"size\": %d, "
+        "\"gbps\": %.3f}\n",
+        utf8_range_HasAvx2() ? "true" : "false", size, gbps);
+  }
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main() {
+  absl::BitGen gen;
+  google::protobuf::BenchmarkValidators(gen);
+  google::protobuf::BenchmarkParse(gen);
+  return 0;
+}
@@ -10,12 +10,50 @@
 
 #include "google/protobuf/util/delimited_message_util.h"
 
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "google/protobuf/arena.h"
 #include "google/protobuf/io/coded_stream.h"
 
 namespace google {
 namespace protobuf {
 namespace util {
 
+namespace {
+
+// DelimitedReader replaces its CodedInputStream after this many bytes, so the
+// stream's INT_MAX total bytes limit is never reached.
+constexpr int kMaxBytesPerCodedStream = 1 << 30;
+
+// Parses a message of `size` bytes whose size prefix has just been read.
+bool ParseSizedFromCodedStream(MessageLite* message,
+                               io::CodedInputStream* input, uint32_t size) {
+  // Get the position after any size bytes have been read (and only the message
+  // itself remains).
+  int position_after_size = input->CurrentPosition();
+
+  // Tell the stream not to read beyond that size.
+  io::CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(size));
+
+  // Parse the message.
+  if (!message->MergeFromCodedStream(input)) return false;
+  if (!input->ConsumedEntireMessage()) return false;
+  if (input->CurrentPosition() - position_after_size != static_cast<int>(size))
+    return false;
+
+  // Release the limit.
+  input->PopLimit(limit);
+
+  return true;
+}
+
+}  // namespace
+
 bool SerializeDelimitedToFileDescriptor(const MessageLite& message,
                                         int file_descriptor) {
   io::FileOutputStream output(file_descriptor);
@@ -52,23 +90,7 @@ bool ParseDelimitedFromCodedStream(MessageLite* message,
     return false;
   }
 
-  // Get the position after any size bytes have been read (and only the message
-  // itself remains).
-  int position_after_size = input->CurrentPosition();
-
-  // Tell the stream not to read beyond that size.
-  io::CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(size));
-
-  // Parse the message.
-  if (!message->MergeFromCodedStream(input)) return false;
-  if (!input->ConsumedEntireMessage()) return false;
-  if (input->CurrentPosition() - position_after_size != static_cast<int>(size))
-    return false;
-
-  // Release the limit.
-  input->PopLimit(limit);
-
-  return true;
+  return ParseSizedFromCodedStream(message, input, size);
 }
 
 bool SerializeDelimitedToZeroCopyStream(const MessageLite& message,
@@ -101,6 +123,137 @@ bool SerializeDelimitedToCodedStream(const MessageLite& message,
   return true;
 }
 
+// ===================================================================
+
+DelimitedReader::DelimitedReader(io::ZeroCopyInputStream* input)
+    : input_(input) {}
+
+io::CodedInputStream* DelimitedReader::coded() {
+  if (!coded_.has_value() ||
+      coded_->CurrentPosition() > kMaxBytesPerCodedStream) {
+    // Destroying the old stream backs up its unread bytes into input_.
+    coded_.reset();
+    coded_.emplace(input_);
+  }
+  return &*coded_;
+}
+
+bool DelimitedReader::ReadNext(MessageLite* message, bool* clean_eof) {
+  io::CodedInputStream* input = coded();
+  int start = input->CurrentPosition();
+
+  uint32_t size;
+  if (!input->ReadVarint32(&size)) {
+    eof_ = input->CurrentPosition() == start;
+    if (clean_eof != nullptr) *clean_eof = eof_;
+    return false;
+  }
+  eof_ = false;
+  if (clean_eof != nullptr) *clean_eof = false;
+
+  // Optimization: parse records that are entirely in the current buffer
+  // straight from it, without pushing a limit or wrapping the stream.
+  const void* data;
+  int available;
+  if (size <= static_cast<uint32_t>(INT_MAX) &&
+      input->GetDirectBufferPointer(&data, &available) &&
+      static_cast<uint32_t>(available) >= size) {
+    if (!message->MergeFromString(
+            absl::string_view(static_cast<const char*>(data), size))) {
+      return false;
+    }
+    return input->Skip(static_cast<int>(size));
+  }
+
+  return ParseSizedFromCodedStream(message, input, size);
+}
+
+int DelimitedReader::ReadBatch(const MessageLite& prototype, Arena* arena,
+                               int max_records,
+                               std::vector<MessageLite*>* messages) {
+  int count = 0;
+  while (count < max_records) {
+    MessageLite* message = prototype.New(arena);
+    if (!ReadNext(message)) {
+      if (arena == nullptr) delete message;
+      break;
+    }
+    messages->push_back(message);
+    ++count;
+  }
+  return count;
+}
+
+// ===================================================================
+
+DelimitedWriter::DelimitedWriter(io::ZeroCopyOutputStream* output)
+    : coded_(output) {}
+
+bool DelimitedWriter::Write(const MessageLite& message) {
+  return SerializeDelimitedToCodedStream(message, &coded_) &&
+         !coded_.HadError();
+}
+
+bool DelimitedWriter::WriteBatch(
+    absl::Span<const MessageLite* const> messages) {
+  size_t total = 0;
+  for (const MessageLite* message : messages) {
+    size_t size = message->ByteSizeLong();
+    if (size > INT_MAX) return false;
+    total += io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(size)) +
+             size;
+  }
+
+  // Sizes are cached now; serialize the whole batch in one pass.
+  uint8_t* target =
+      total > INT_MAX
+          ? nullptr
+          : coded_.GetDirectBufferForNBytesAndAdvance(static_cast<int>(total));
+  if (target != nullptr) {
+    for (const MessageLite* message : messages) {
+      target = io::CodedOutputStream::WriteVarint32ToArray(
+          static_cast<uint32_t>(message->GetCachedSize()), target);
+      target = message->SerializeWithCachedSizesToArray(target);
+    }
+    return true;
+  }
+
+  for (const MessageLite* message : messages) {
+    coded_.WriteVarint32(static_cast<uint32_t>(message->GetCachedSize()));
+    message->SerializeWithCachedSizes(&coded_);
+  }
+  return !coded_.HadError();
+}
+
+bool DelimitedWriter::Flush() {
+  coded_.Trim();
+  return !coded_.HadError();
+}
+
+// ===================================================================
+
+RecyclingArena::RecyclingArena() : arena_(new Arena) {}
+
+RecyclingArena::~RecyclingArena() = default;
+
+void RecyclingArena::Reset() {
+  const size_t needed = static_cast<size_t>(arena_->SpaceAllocated());
+  if (needed <= block_size_) {
+    arena_->Reset();
+    return;
+  }
+
+  // Leave some headroom so that batches slightly larger than the last one do
+  // not immediately spill into a second block.
+  arena_.reset();
+  block_size_ = (needed + needed / 8 + 7) & ~size_t{7};
+  block_.reset(new char[block_size_]);
+  ArenaOptions options;
+  options.initial_block = block_.get();
+  options.initial_block_size = block_size_;
+  arena_.reset(new Arena(options));
+}
+
 }  // namespace util
 }  // namespace protobuf
 }  // namespace google
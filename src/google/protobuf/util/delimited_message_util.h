@@ -11,8 +11,14 @@
 #ifndef GOOGLE_PROTOBUF_UTIL_DELIMITED_MESSAGE_UTIL_H__
 #define GOOGLE_PROTOBUF_UTIL_DELIMITED_MESSAGE_UTIL_H__
 
+#include <cstddef>
+#include <memory>
 #include <ostream>
+#include <vector>
 
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+#include "google/protobuf/arena.h"
 #include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/io/zero_copy_stream_impl.h"
 #include "google/protobuf/message_lite.h"
@@ -76,6 +82,97 @@ bool PROTOBUF_EXPORT SerializeDelimitedToZeroCopyStream(
 bool PROTOBUF_EXPORT SerializeDelimitedToCodedStream(
     const MessageLite& message, io::CodedOutputStream* output);
 
+// Reads a sequence of size-delimited messages from a stream.
+//
+// Unlike calling ParseDelimitedFromZeroCopyStream() in a loop, the reader
+// keeps a single CodedInputStream for all records, and parses records that
+// lie entirely within the current buffer directly from that buffer.
+//
+// The reader must be used for all further reads from `input` (see the
+// comment on SerializeDelimitedToFileDescriptor()).
+class PROTOBUF_EXPORT DelimitedReader {
+ public:
+  explicit DelimitedReader(io::ZeroCopyInputStream* input);
+  DelimitedReader(const DelimitedReader&) = delete;
+  DelimitedReader& operator=(const DelimitedReader&) = delete;
+
+  // Merges the next message into `message`.  Has the same semantics as
+  // ParseDelimitedFromCodedStream(), including `clean_eof`.
+  bool ReadNext(MessageLite* message, bool* clean_eof = nullptr);
+
+  // Parses up to `max_records` messages into new instances of `prototype`'s
+  // type created on `arena` (or the heap if `arena` is null, in which case the
+  // caller takes ownership) and appends them to `messages`.  Returns the
+  // number of messages appended.  Fewer than `max_records` are returned at
+  // the end of the stream or on error; use eof() to tell them apart.
+  int ReadBatch(const MessageLite& prototype, Arena* arena, int max_records,
+                std::vector<MessageLite*>* messages);
+
+  // True once the stream ended cleanly between two records.
+  bool eof() const { return eof_; }
+
+ private:
+  io::CodedInputStream* coded();
+
+  io::ZeroCopyInputStream* const input_;
+  absl::optional<io::CodedInputStream> coded_;
+  bool eof_ = false;
+};
+
+// Writes a sequence of size-delimited messages to a stream, keeping a single
+// CodedOutputStream for all records.  Data is pushed to the underlying stream
+// when the writer is destroyed or Flush() is called.
+class PROTOBUF_EXPORT DelimitedWriter {
+ public:
+  explicit DelimitedWriter(io::ZeroCopyOutputStream* output);
+  DelimitedWriter(const DelimitedWriter&) = delete;
+  DelimitedWriter& operator=(const DelimitedWriter&) = delete;
+
+  bool Write(const MessageLite& message);
+
+  // Writes all of `messages`.  The sizes of the whole batch are computed
+  // first; if the output stream's current buffer can hold the batch it is
+  // serialized with a single pass over contiguous memory.
+  bool WriteBatch(absl::Span<const MessageLite* const> messages);
+
+  // Returns unused buffer space to the underlying stream.  Returns false if
+  // an error occurred while writing.
+  bool Flush();
+
+ private:
+  io::CodedOutputStream coded_;
+};
+
+// An arena for batch processing that recycles its memory.
+//
+// Arena::Reset() frees every block except the first, so an arena reused for
+// batches of similar size grows through the same sequence of blocks every
+// time.  RecyclingArena::Reset() instead remembers how much memory the last
+// batch needed and, if that no longer fits in its initial block, replaces the
+// block with one that does.  In steady state every batch is served from one
+// block with no calls to malloc.
+class PROTOBUF_EXPORT RecyclingArena {
+ public:
+  RecyclingArena();
+  RecyclingArena(const RecyclingArena&) = delete;
+  RecyclingArena& operator=(const RecyclingArena&) = delete;
+  ~RecyclingArena();
+
+  Arena* arena() { return arena_.get(); }
+
+  // Destroys all objects on the arena.
+  void Reset();
+
+  // Size of the block the arena currently starts with.
+  size_t block_size() const { return block_size_; }
+
+ private:
+  // Declared before arena_ so it outlives it.
+  std::unique_ptr<char[]> block_;
+  size_t block_size_ = 0;
+  std::unique_ptr<Arena> arena_;
+};
+
 }  // namespace util
 }  // namespace protobuf
 }  // namespace google
@@ -11,9 +11,12 @@
 #include "google/protobuf/util/delimited_message_util.h"
 
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "google/protobuf/testing/googletest.h"
 #include <gtest/gtest.h>
+#include "google/protobuf/io/zero_copy_stream_impl_lite.h"
 #include "google/protobuf/test_util.h"
 #include "google/protobuf/unittest.pb.h"
 
@@ -88,6 +91,113 @@ TEST(DelimitedMessageUtilTest, FailsAtEndOfStream) {
   }
 }
 
+TEST(DelimitedMessageUtilTest, ReaderAndWriter) {
+  std::string data;
+  protobuf_unittest::TestAllTypes all;
+  TestUtil::SetAllFields(&all);
+  std::vector<protobuf_unittest::ForeignMessage> foreign(10);
+  for (int i = 0; i < 10; ++i) foreign[i].set_c(i);
+
+  {
+    io::StringOutputStream output(&data);
+    DelimitedWriter writer(&output);
+    EXPECT_TRUE(writer.Write(all));
+    std::vector<const MessageLite*> batch;
+    for (const auto& message : foreign) batch.push_back(&message);
+    EXPECT_TRUE(writer.WriteBatch(batch));
+    EXPECT_TRUE(writer.Write(all));
+    EXPECT_TRUE(writer.Flush());
+  }
+
+  // Block size 7 forces records across buffer boundaries; -1 lets most of
+  // them be parsed directly from the buffer.
+  for (int block_size : {7, -1}) {
+    io::ArrayInputStream input(data.data(), static_cast<int>(data.size()),
+                               block_size);
+    DelimitedReader reader(&input);
+
+    protobuf_unittest::TestAllTypes message;
+    ASSERT_TRUE(reader.ReadNext(&message));
+    TestUtil::ExpectAllFieldsSet(message);
+
+    for (int i = 0; i < 10; ++i) {
+      protobuf_unittest::ForeignMessage f;
+      ASSERT_TRUE(reader.ReadNext(&f));
+      EXPECT_EQ(f.c(), i);
+    }
+
+    message.Clear();
+    ASSERT_TRUE(reader.ReadNext(&message));
+    TestUtil::ExpectAllFieldsSet(message);
+
+    bool clean_eof = false;
+    EXPECT_FALSE(reader.ReadNext(&message, &clean_eof));
+    EXPECT_TRUE(clean_eof);
+    EXPECT_TRUE(reader.eof());
+  }
+}
+
+TEST(DelimitedMessageUtilTest, ReaderRejectsTruncatedRecord) {
+  protobuf_unittest::ForeignMessage message;
+  message.set_c(42);
+  std::string data;
+  {
+    io::StringOutputStream output(&data);
+    DelimitedWriter writer(&output);
+    EXPECT_TRUE(writer.Write(message));
+  }
+  data.pop_back();
+
+  io::ArrayInputStream input(data.data(), static_cast<int>(data.size()));
+  DelimitedReader reader(&input);
+  EXPECT_FALSE(reader.ReadNext(&message));
+  EXPECT_FALSE(reader.eof());
+}
+
+TEST(DelimitedMessageUtilTest, ReadBatchIntoRecyclingArena) {
+  std::string data;
+  {
+    io::StringOutputStream output(&data);
+    DelimitedWriter writer(&output);
+    protobuf_unittest::TestAllTypes message;
+    TestUtil::SetAllFields(&message);
+    for (int i = 0; i < 100; ++i) EXPECT_TRUE(writer.Write(message));
+  }
+
+  io::ArrayInputStream input(data.data(), static_cast<int>(data.size()));
+  DelimitedReader reader(&input);
+  RecyclingArena arena;
+  const MessageLite& prototype =
+      protobuf_unittest::TestAllTypes::default_instance();
+  std::vector<MessageLite*> batch;
+  size_t block_size = 0;
+  int total = 0;
+  for (int round = 0; round < 5; ++round) {
+    batch.clear();
+    int n = reader.ReadBatch(prototype, arena.arena(), 20, &batch);
+    ASSERT_EQ(n, 20);
+    total += n;
+    for (MessageLite* message : batch) {
+      EXPECT_EQ(message->GetArena(), arena.arena());
+      TestUtil::ExpectAllFieldsSet(
+          *static_cast<protobuf_unittest::TestAllTypes*>(message));
+    }
+    if (round >= 2) {
+      // Same-sized batches fit in the recycled block.
+      EXPECT_EQ(arena.block_size(), block_size);
+      EXPECT_EQ(arena.arena()->SpaceAllocated(), block_size);
+    }
+    arena.Reset();
+    block_size = arena.block_size();
+  }
+  EXPECT_EQ(total, 100);
+  EXPECT_GT(block_size, 0);
+
+  batch.clear();
+  EXPECT_EQ(reader.ReadBatch(prototype, arena.arena(), 20, &batch), 0);
+  EXPECT_TRUE(reader.eof());
+}
+
 }  // namespace util
 }  // namespace protobuf
 }  // namespace google
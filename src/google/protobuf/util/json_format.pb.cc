@@ -0,0 +1,4814 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/json_format.proto
+
+#include "google/protobuf/util/json_format.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+      template <typename>
+PROTOBUF_CONSTEXPR TestStringSerializer_StringMapEntry_DoNotUse::TestStringSerializer_StringMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestStringSerializer_StringMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStringSerializer_StringMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStringSerializer_StringMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestStringSerializer_StringMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStringSerializer_StringMapEntry_DoNotUseDefaultTypeInternal _TestStringSerializer_StringMapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestStringMap_StringMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestStringMap_StringMapEntry_DoNotUse_default_instance_;
+
+inline constexpr TestRecursion::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        child_{nullptr},
+        value_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestRecursion::TestRecursion(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestRecursionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestRecursionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestRecursionDefaultTypeInternal() {}
+  union {
+    TestRecursion _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestRecursionDefaultTypeInternal _TestRecursion_default_instance_;
+
+inline constexpr TestNumbers::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        a_{static_cast< ::protobuf_unittest::TestNumbers_MyType >(0)},
+        b_{0},
+        c_{0},
+        d_{false},
+        e_{0},
+        f_{0u} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestNumbers::TestNumbers(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestNumbersDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNumbersDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNumbersDefaultTypeInternal() {}
+  union {
+    TestNumbers _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNumbersDefaultTypeInternal _TestNumbers_default_instance_;
+
+inline constexpr TestMessageWithExtension::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessageWithExtension::TestMessageWithExtension(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageWithExtensionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageWithExtensionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageWithExtensionDefaultTypeInternal() {}
+  union {
+    TestMessageWithExtension _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageWithExtensionDefaultTypeInternal _TestMessageWithExtension_default_instance_;
+
+inline constexpr TestLargeInt::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        a_{::int64_t{0}},
+        b_{::uint64_t{0u}} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestLargeInt::TestLargeInt(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestLargeIntDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestLargeIntDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestLargeIntDefaultTypeInternal() {}
+  union {
+    TestLargeInt _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestLargeIntDefaultTypeInternal _TestLargeInt_default_instance_;
+
+inline constexpr TestJavaScriptOrderJSON1::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        d_{0},
+        c_{0},
+        x_{false},
+        b_{0},
+        a_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestJavaScriptOrderJSON1::TestJavaScriptOrderJSON1(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestJavaScriptOrderJSON1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestJavaScriptOrderJSON1DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestJavaScriptOrderJSON1DefaultTypeInternal() {}
+  union {
+    TestJavaScriptOrderJSON1 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestJavaScriptOrderJSON1DefaultTypeInternal _TestJavaScriptOrderJSON1_default_instance_;
+
+inline constexpr TestJavaScriptJSON::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        in_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        var_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        a_{0},
+        final_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestJavaScriptJSON::TestJavaScriptJSON(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestJavaScriptJSONDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestJavaScriptJSONDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestJavaScriptJSONDefaultTypeInternal() {}
+  union {
+    TestJavaScriptJSON _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestJavaScriptJSONDefaultTypeInternal _TestJavaScriptJSON_default_instance_;
+
+inline constexpr TestFlagsAndStrings_RepeatedGroup::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        f_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestFlagsAndStrings_RepeatedGroup::TestFlagsAndStrings_RepeatedGroup(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestFlagsAndStrings_RepeatedGroupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestFlagsAndStrings_RepeatedGroupDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestFlagsAndStrings_RepeatedGroupDefaultTypeInternal() {}
+  union {
+    TestFlagsAndStrings_RepeatedGroup _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestFlagsAndStrings_RepeatedGroupDefaultTypeInternal _TestFlagsAndStrings_RepeatedGroup_default_instance_;
+
+inline constexpr TestExtension::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        value_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestExtension::TestExtension(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestExtensionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestExtensionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestExtensionDefaultTypeInternal() {}
+  union {
+    TestExtension _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestExtensionDefaultTypeInternal _TestExtension_default_instance_;
+
+inline constexpr TestDefaultEnumValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        enum_value_{static_cast< ::protobuf_unittest::EnumValue >(2)} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestDefaultEnumValue::TestDefaultEnumValue(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestDefaultEnumValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestDefaultEnumValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestDefaultEnumValueDefaultTypeInternal() {}
+  union {
+    TestDefaultEnumValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestDefaultEnumValueDefaultTypeInternal _TestDefaultEnumValue_default_instance_;
+
+inline constexpr TestCamelCase::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        normal_field_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        capital_field_{0},
+        camelcasefield_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestCamelCase::TestCamelCase(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestCamelCaseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestCamelCaseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestCamelCaseDefaultTypeInternal() {}
+  union {
+    TestCamelCase _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestCamelCaseDefaultTypeInternal _TestCamelCase_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestBoolMap_BoolMapEntry_DoNotUse::TestBoolMap_BoolMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestBoolMap_BoolMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestBoolMap_BoolMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestBoolMap_BoolMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestBoolMap_BoolMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestBoolMap_BoolMapEntry_DoNotUseDefaultTypeInternal _TestBoolMap_BoolMapEntry_DoNotUse_default_instance_;
+
+inline constexpr TestBase64ByteArrays::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        a_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestBase64ByteArrays::TestBase64ByteArrays(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestBase64ByteArraysDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestBase64ByteArraysDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestBase64ByteArraysDefaultTypeInternal() {}
+  union {
+    TestBase64ByteArrays _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestBase64ByteArraysDefaultTypeInternal _TestBase64ByteArrays_default_instance_;
+
+inline constexpr TestStringSerializer::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_string_{},
+        string_map_{},
+        scalar_string_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestStringSerializer::TestStringSerializer(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestStringSerializerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStringSerializerDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStringSerializerDefaultTypeInternal() {}
+  union {
+    TestStringSerializer _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStringSerializerDefaultTypeInternal _TestStringSerializer_default_instance_;
+
+inline constexpr TestStringMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : string_map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestStringMap::TestStringMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestStringMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStringMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStringMapDefaultTypeInternal() {}
+  union {
+    TestStringMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStringMapDefaultTypeInternal _TestStringMap_default_instance_;
+
+inline constexpr TestJavaScriptOrderJSON2::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        z_{},
+        d_{0},
+        c_{0},
+        x_{false},
+        b_{0},
+        a_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestJavaScriptOrderJSON2::TestJavaScriptOrderJSON2(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestJavaScriptOrderJSON2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestJavaScriptOrderJSON2DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestJavaScriptOrderJSON2DefaultTypeInternal() {}
+  union {
+    TestJavaScriptOrderJSON2 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestJavaScriptOrderJSON2DefaultTypeInternal _TestJavaScriptOrderJSON2_default_instance_;
+
+inline constexpr TestFlagsAndStrings::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeatedgroup_{},
+        a_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestFlagsAndStrings::TestFlagsAndStrings(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestFlagsAndStringsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestFlagsAndStringsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestFlagsAndStringsDefaultTypeInternal() {}
+  union {
+    TestFlagsAndStrings _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestFlagsAndStringsDefaultTypeInternal _TestFlagsAndStrings_default_instance_;
+
+inline constexpr TestBoolMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : bool_map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestBoolMap::TestBoolMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestBoolMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestBoolMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestBoolMapDefaultTypeInternal() {}
+  union {
+    TestBoolMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestBoolMapDefaultTypeInternal _TestBoolMap_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[19];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup, _impl_.f_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestFlagsAndStrings, _impl_.repeatedgroup_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBase64ByteArrays, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBase64ByteArrays, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBase64ByteArrays, _impl_.a_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptJSON, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptJSON, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptJSON, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptJSON, _impl_.final_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptJSON, _impl_.in_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptJSON, _impl_.var_),
+    2,
+    3,
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _impl_.d_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _impl_.c_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _impl_.x_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _impl_.b_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON1, _impl_.a_),
+    0,
+    1,
+    2,
+    3,
+    4,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_.d_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_.c_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_.x_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_.b_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestJavaScriptOrderJSON2, _impl_.z_),
+    0,
+    1,
+    2,
+    3,
+    4,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestLargeInt, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestLargeInt, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestLargeInt, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestLargeInt, _impl_.b_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_.b_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_.c_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_.d_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_.e_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestNumbers, _impl_.f_),
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestCamelCase, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestCamelCase, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestCamelCase, _impl_.normal_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestCamelCase, _impl_.capital_field_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestCamelCase, _impl_.camelcasefield_),
+    0,
+    1,
+    2,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBoolMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestBoolMap, _impl_.bool_map_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursion, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursion, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursion, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRecursion, _impl_.child_),
+    1,
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringMap, _impl_.string_map_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer, _impl_.scalar_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer, _impl_.repeated_string_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestStringSerializer, _impl_.string_map_),
+    0,
+    ~0u,
+    ~0u,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithExtension, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestMessageWithExtension, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestExtension, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestExtension, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestExtension, _impl_.value_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDefaultEnumValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDefaultEnumValue, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDefaultEnumValue, _impl_.enum_value_),
+    0,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 9, -1, sizeof(::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup)},
+        {10, 20, -1, sizeof(::protobuf_unittest::TestFlagsAndStrings)},
+        {22, 31, -1, sizeof(::protobuf_unittest::TestBase64ByteArrays)},
+        {32, 44, -1, sizeof(::protobuf_unittest::TestJavaScriptJSON)},
+        {48, 61, -1, sizeof(::protobuf_unittest::TestJavaScriptOrderJSON1)},
+        {66, 80, -1, sizeof(::protobuf_unittest::TestJavaScriptOrderJSON2)},
+        {86, 96, -1, sizeof(::protobuf_unittest::TestLargeInt)},
+        {98, 112, -1, sizeof(::protobuf_unittest::TestNumbers)},
+        {118, 129, -1, sizeof(::protobuf_unittest::TestCamelCase)},
+        {132, 142, -1, sizeof(::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse)},
+        {144, -1, -1, sizeof(::protobuf_unittest::TestBoolMap)},
+        {153, 163, -1, sizeof(::protobuf_unittest::TestRecursion)},
+        {165, 175, -1, sizeof(::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse)},
+        {177, -1, -1, sizeof(::protobuf_unittest::TestStringMap)},
+        {186, 196, -1, sizeof(::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse)},
+        {198, 209, -1, sizeof(::protobuf_unittest::TestStringSerializer)},
+        {212, -1, -1, sizeof(::protobuf_unittest::TestMessageWithExtension)},
+        {220, 229, -1, sizeof(::protobuf_unittest::TestExtension)},
+        {230, 239, -1, sizeof(::protobuf_unittest::TestDefaultEnumValue)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestFlagsAndStrings_RepeatedGroup_default_instance_._instance,
+    &::protobuf_unittest::_TestFlagsAndStrings_default_instance_._instance,
+    &::protobuf_unittest::_TestBase64ByteArrays_default_instance_._instance,
+    &::protobuf_unittest::_TestJavaScriptJSON_default_instance_._instance,
+    &::protobuf_unittest::_TestJavaScriptOrderJSON1_default_instance_._instance,
+    &::protobuf_unittest::_TestJavaScriptOrderJSON2_default_instance_._instance,
+    &::protobuf_unittest::_TestLargeInt_default_instance_._instance,
+    &::protobuf_unittest::_TestNumbers_default_instance_._instance,
+    &::protobuf_unittest::_TestCamelCase_default_instance_._instance,
+    &::protobuf_unittest::_TestBoolMap_BoolMapEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestBoolMap_default_instance_._instance,
+    &::protobuf_unittest::_TestRecursion_default_instance_._instance,
+    &::protobuf_unittest::_TestStringMap_StringMapEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestStringMap_default_instance_._instance,
+    &::protobuf_unittest::_TestStringSerializer_StringMapEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestStringSerializer_default_instance_._instance,
+    &::protobuf_unittest::_TestMessageWithExtension_default_instance_._instance,
+    &::protobuf_unittest::_TestExtension_default_instance_._instance,
+    &::protobuf_unittest::_TestDefaultEnumValue_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n&google/protobuf/util/json_format.proto"
+    "\022\021protobuf_unittest\"\211\001\n\023TestFlagsAndStri"
+    "ngs\022\t\n\001A\030\001 \002(\005\022K\n\rrepeatedgroup\030\002 \003(\n24."
+    "protobuf_unittest.TestFlagsAndStrings.Re"
+    "peatedGroup\032\032\n\rRepeatedGroup\022\t\n\001f\030\003 \002(\t\""
+    "!\n\024TestBase64ByteArrays\022\t\n\001a\030\001 \002(\014\"G\n\022Te"
+    "stJavaScriptJSON\022\t\n\001a\030\001 \001(\005\022\r\n\005final\030\002 \001"
+    "(\002\022\n\n\002in\030\003 \001(\t\022\013\n\003Var\030\004 \001(\t\"Q\n\030TestJavaS"
+    "criptOrderJSON1\022\t\n\001d\030\001 \001(\005\022\t\n\001c\030\002 \001(\005\022\t\n"
+    "\001x\030\003 \001(\010\022\t\n\001b\030\004 \001(\005\022\t\n\001a\030\005 \001(\005\"\211\001\n\030TestJ"
+    "avaScriptOrderJSON2\022\t\n\001d\030\001 \001(\005\022\t\n\001c\030\002 \001("
+    "\005\022\t\n\001x\030\003 \001(\010\022\t\n\001b\030\004 \001(\005\022\t\n\001a\030\005 \001(\005\0226\n\001z\030"
+    "\006 \003(\0132+.protobuf_unittest.TestJavaScript"
+    "OrderJSON1\"$\n\014TestLargeInt\022\t\n\001a\030\001 \002(\003\022\t\n"
+    "\001b\030\002 \002(\004\"\240\001\n\013TestNumbers\0220\n\001a\030\001 \001(\0162%.pr"
+    "otobuf_unittest.TestNumbers.MyType\022\t\n\001b\030"
+    "\002 \001(\005\022\t\n\001c\030\003 \001(\002\022\t\n\001d\030\004 \001(\010\022\t\n\001e\030\005 \001(\001\022\t"
+    "\n\001f\030\006 \001(\r\"(\n\006MyType\022\006\n\002OK\020\000\022\013\n\007WARNING\020\001"
+    "\022\t\n\005ERROR\020\002\"T\n\rTestCamelCase\022\024\n\014normal_f"
+    "ield\030\001 \001(\t\022\025\n\rCAPITAL_FIELD\030\002 \001(\005\022\026\n\016Cam"
+    "elCaseField\030\003 \001(\005\"|\n\013TestBoolMap\022=\n\010bool"
+    "_map\030\001 \003(\0132+.protobuf_unittest.TestBoolM"
+    "ap.BoolMapEntry\032.\n\014BoolMapEntry\022\013\n\003key\030\001"
+    " \001(\010\022\r\n\005value\030\002 \001(\005:\0028\001\"O\n\rTestRecursion"
+    "\022\r\n\005value\030\001 \001(\005\022/\n\005child\030\002 \001(\0132 .protobu"
+    "f_unittest.TestRecursion\"\206\001\n\rTestStringM"
+    "ap\022C\n\nstring_map\030\001 \003(\0132/.protobuf_unitte"
+    "st.TestStringMap.StringMapEntry\0320\n\016Strin"
+    "gMapEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028"
+    "\001\"\304\001\n\024TestStringSerializer\022\025\n\rscalar_str"
+    "ing\030\001 \001(\t\022\027\n\017repeated_string\030\002 \003(\t\022J\n\nst"
+    "ring_map\030\003 \003(\01326.protobuf_unittest.TestS"
+    "tringSerializer.StringMapEntry\0320\n\016String"
+    "MapEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001"
+    "\"$\n\030TestMessageWithExtension*\010\010d\020\200\200\200\200\002\"z"
+    "\n\rTestExtension\022\r\n\005value\030\001 \001(\t2Z\n\003ext\022+."
+    "protobuf_unittest.TestMessageWithExtensi"
+    "on\030d \001(\0132 .protobuf_unittest.TestExtensi"
+    "on\"Q\n\024TestDefaultEnumValue\0229\n\nenum_value"
+    "\030\001 \001(\0162\034.protobuf_unittest.EnumValue:\007DE"
+    "FAULT*2\n\tEnumValue\022\014\n\010PROTOCOL\020\000\022\n\n\006BUFF"
+    "ER\020\001\022\013\n\007DEFAULT\020\002"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto = {
+    false,
+    false,
+    1657,
+    descriptor_table_protodef_google_2fprotobuf_2futil_2fjson_5fformat_2eproto,
+    "google/protobuf/util/json_format.proto",
+    &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+    nullptr,
+    0,
+    19,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2futil_2fjson_5fformat_2eproto(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto);
+namespace protobuf_unittest {
+const ::google::protobuf::EnumDescriptor* TestNumbers_MyType_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t TestNumbers_MyType_internal_data_[] = {
+    196608u, 0u, };
+bool TestNumbers_MyType_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr TestNumbers_MyType TestNumbers::OK;
+constexpr TestNumbers_MyType TestNumbers::WARNING;
+constexpr TestNumbers_MyType TestNumbers::ERROR;
+constexpr TestNumbers_MyType TestNumbers::MyType_MIN;
+constexpr TestNumbers_MyType TestNumbers::MyType_MAX;
+constexpr int TestNumbers::MyType_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* EnumValue_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t EnumValue_internal_data_[] = {
+    196608u, 0u, };
+bool EnumValue_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+// ===================================================================
+
+class TestFlagsAndStrings_RepeatedGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestFlagsAndStrings_RepeatedGroup>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings_RepeatedGroup, _impl_._has_bits_);
+  static void set_has_f(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+TestFlagsAndStrings_RepeatedGroup::TestFlagsAndStrings_RepeatedGroup(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFlagsAndStrings_RepeatedGroup::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        f_(arena, from.f_) {}
+
+TestFlagsAndStrings_RepeatedGroup::TestFlagsAndStrings_RepeatedGroup(
+    ::google::protobuf::Arena* arena,
+    const TestFlagsAndStrings_RepeatedGroup& from)
+    : ::google::protobuf::Message(arena) {
+  TestFlagsAndStrings_RepeatedGroup* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFlagsAndStrings_RepeatedGroup::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        f_(arena) {}
+
+inline void TestFlagsAndStrings_RepeatedGroup::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestFlagsAndStrings_RepeatedGroup::~TestFlagsAndStrings_RepeatedGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestFlagsAndStrings_RepeatedGroup::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.f_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestFlagsAndStrings_RepeatedGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.f_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestFlagsAndStrings_RepeatedGroup::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 1, 0, 61, 2> TestFlagsAndStrings_RepeatedGroup::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings_RepeatedGroup, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967291,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestFlagsAndStrings_RepeatedGroup_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::FastEndG1, {20, 20}},
+    // required string f = 3;
+    {::_pbi::TcParser::FastSS1,
+     {26, 0, 0, PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings_RepeatedGroup, _impl_.f_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required string f = 3;
+    {PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings_RepeatedGroup, _impl_.f_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\63\1\0\0\0\0\0\0"
+    "protobuf_unittest.TestFlagsAndStrings.RepeatedGroup"
+    "f"
+  }},
+};
+
+::uint8_t* TestFlagsAndStrings_RepeatedGroup::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string f = 3;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_f();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f");
+    target = stream->WriteStringMaybeAliased(3, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  return target;
+}
+
+::size_t TestFlagsAndStrings_RepeatedGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // required string f = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_f());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestFlagsAndStrings_RepeatedGroup::_class_data_ = {
+    TestFlagsAndStrings_RepeatedGroup::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestFlagsAndStrings_RepeatedGroup::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestFlagsAndStrings_RepeatedGroup::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestFlagsAndStrings_RepeatedGroup*>(&to_msg);
+  auto& from = static_cast<const TestFlagsAndStrings_RepeatedGroup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_f(from._internal_f());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestFlagsAndStrings_RepeatedGroup::CopyFrom(const TestFlagsAndStrings_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestFlagsAndStrings_RepeatedGroup::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestFlagsAndStrings_RepeatedGroup::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestFlagsAndStrings_RepeatedGroup::InternalSwap(TestFlagsAndStrings_RepeatedGroup* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.f_, &other->_impl_.f_, arena);
+}
+
+::google::protobuf::Metadata TestFlagsAndStrings_RepeatedGroup::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[0]);
+}
+// ===================================================================
+
+class TestFlagsAndStrings::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestFlagsAndStrings>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+TestFlagsAndStrings::TestFlagsAndStrings(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestFlagsAndStrings)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFlagsAndStrings::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeatedgroup_{visibility, arena, from.repeatedgroup_} {}
+
+TestFlagsAndStrings::TestFlagsAndStrings(
+    ::google::protobuf::Arena* arena,
+    const TestFlagsAndStrings& from)
+    : ::google::protobuf::Message(arena) {
+  TestFlagsAndStrings* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.a_ = from._impl_.a_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestFlagsAndStrings)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFlagsAndStrings::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeatedgroup_{visibility, arena} {}
+
+inline void TestFlagsAndStrings::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.a_ = {};
+}
+TestFlagsAndStrings::~TestFlagsAndStrings() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestFlagsAndStrings)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestFlagsAndStrings::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestFlagsAndStrings::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestFlagsAndStrings)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeatedgroup_.Clear();
+  _impl_.a_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestFlagsAndStrings::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 0, 2> TestFlagsAndStrings::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestFlagsAndStrings_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated group RepeatedGroup = 2 { ... };
+    {::_pbi::TcParser::FastGtR1,
+     {19, 63, 0, PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings, _impl_.repeatedgroup_)}},
+    // required int32 A = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestFlagsAndStrings, _impl_.a_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings, _impl_.a_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required int32 A = 1;
+    {PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings, _impl_.a_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // repeated group RepeatedGroup = 2 { ... };
+    {PROTOBUF_FIELD_OFFSET(TestFlagsAndStrings, _impl_.repeatedgroup_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kRepGroup | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestFlagsAndStrings::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestFlagsAndStrings)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 A = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_a(), target);
+  }
+
+  // repeated group RepeatedGroup = 2 { ... };
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeatedgroup_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteGroup(2, this->_internal_repeatedgroup().Get(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestFlagsAndStrings)
+  return target;
+}
+
+::size_t TestFlagsAndStrings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestFlagsAndStrings)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated group RepeatedGroup = 2 { ... };
+  total_size += 2UL * this->_internal_repeatedgroup_size();
+  for (const auto& msg : this->_internal_repeatedgroup()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::GroupSize(msg);
+  }
+  // required int32 A = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_a());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestFlagsAndStrings::_class_data_ = {
+    TestFlagsAndStrings::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestFlagsAndStrings::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestFlagsAndStrings::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestFlagsAndStrings*>(&to_msg);
+  auto& from = static_cast<const TestFlagsAndStrings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestFlagsAndStrings)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeatedgroup()->MergeFrom(
+      from._internal_repeatedgroup());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_a(from._internal_a());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestFlagsAndStrings::CopyFrom(const TestFlagsAndStrings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestFlagsAndStrings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestFlagsAndStrings::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  if (!::google::protobuf::internal::AllAreInitialized(_internal_repeatedgroup()))
+    return false;
+  return true;
+}
+
+::_pbi::CachedSize* TestFlagsAndStrings::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestFlagsAndStrings::InternalSwap(TestFlagsAndStrings* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeatedgroup_.InternalSwap(&other->_impl_.repeatedgroup_);
+        swap(_impl_.a_, other->_impl_.a_);
+}
+
+::google::protobuf::Metadata TestFlagsAndStrings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[1]);
+}
+// ===================================================================
+
+class TestBase64ByteArrays::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestBase64ByteArrays>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestBase64ByteArrays, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+TestBase64ByteArrays::TestBase64ByteArrays(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestBase64ByteArrays)
+}
+inline PROTOBUF_NDEBUG_INLINE TestBase64ByteArrays::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        a_(arena, from.a_) {}
+
+TestBase64ByteArrays::TestBase64ByteArrays(
+    ::google::protobuf::Arena* arena,
+    const TestBase64ByteArrays& from)
+    : ::google::protobuf::Message(arena) {
+  TestBase64ByteArrays* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestBase64ByteArrays)
+}
+inline PROTOBUF_NDEBUG_INLINE TestBase64ByteArrays::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        a_(arena) {}
+
+inline void TestBase64ByteArrays::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestBase64ByteArrays::~TestBase64ByteArrays() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestBase64ByteArrays)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestBase64ByteArrays::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.a_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestBase64ByteArrays::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestBase64ByteArrays)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.a_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestBase64ByteArrays::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> TestBase64ByteArrays::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestBase64ByteArrays, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestBase64ByteArrays_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // required bytes a = 1;
+    {::_pbi::TcParser::FastBS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestBase64ByteArrays, _impl_.a_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required bytes a = 1;
+    {PROTOBUF_FIELD_OFFSET(TestBase64ByteArrays, _impl_.a_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBytes | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestBase64ByteArrays::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestBase64ByteArrays)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes a = 1;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_a();
+    target = stream->WriteBytesMaybeAliased(1, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestBase64ByteArrays)
+  return target;
+}
+
+::size_t TestBase64ByteArrays::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestBase64ByteArrays)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // required bytes a = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
+                                    this->_internal_a());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestBase64ByteArrays::_class_data_ = {
+    TestBase64ByteArrays::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestBase64ByteArrays::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestBase64ByteArrays::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestBase64ByteArrays*>(&to_msg);
+  auto& from = static_cast<const TestBase64ByteArrays&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestBase64ByteArrays)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_a(from._internal_a());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestBase64ByteArrays::CopyFrom(const TestBase64ByteArrays& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestBase64ByteArrays)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestBase64ByteArrays::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestBase64ByteArrays::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestBase64ByteArrays::InternalSwap(TestBase64ByteArrays* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.a_, &other->_impl_.a_, arena);
+}
+
+::google::protobuf::Metadata TestBase64ByteArrays::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[2]);
+}
+// ===================================================================
+
+class TestJavaScriptJSON::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestJavaScriptJSON>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_final(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_in(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_var(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+TestJavaScriptJSON::TestJavaScriptJSON(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestJavaScriptJSON)
+}
+inline PROTOBUF_NDEBUG_INLINE TestJavaScriptJSON::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        in_(arena, from.in_),
+        var_(arena, from.var_) {}
+
+TestJavaScriptJSON::TestJavaScriptJSON(
+    ::google::protobuf::Arena* arena,
+    const TestJavaScriptJSON& from)
+    : ::google::protobuf::Message(arena) {
+  TestJavaScriptJSON* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, a_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, a_),
+           offsetof(Impl_, final_) -
+               offsetof(Impl_, a_) +
+               sizeof(Impl_::final_));
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestJavaScriptJSON)
+}
+inline PROTOBUF_NDEBUG_INLINE TestJavaScriptJSON::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        in_(arena),
+        var_(arena) {}
+
+inline void TestJavaScriptJSON::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, a_),
+           0,
+           offsetof(Impl_, final_) -
+               offsetof(Impl_, a_) +
+               sizeof(Impl_::final_));
+}
+TestJavaScriptJSON::~TestJavaScriptJSON() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestJavaScriptJSON)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestJavaScriptJSON::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.in_.Destroy();
+  _impl_.var_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestJavaScriptJSON::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestJavaScriptJSON)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.in_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.var_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.a_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.final_) -
+        reinterpret_cast<char*>(&_impl_.a_)) + sizeof(_impl_.final_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestJavaScriptJSON::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 50, 2> TestJavaScriptJSON::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestJavaScriptJSON_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string Var = 4;
+    {::_pbi::TcParser::FastSS1,
+     {34, 1, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.var_)}},
+    // optional int32 a = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptJSON, _impl_.a_), 2>(),
+     {8, 2, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.a_)}},
+    // optional float final = 2;
+    {::_pbi::TcParser::FastF32S1,
+     {21, 3, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.final_)}},
+    // optional string in = 3;
+    {::_pbi::TcParser::FastSS1,
+     {26, 0, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.in_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 a = 1;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.a_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional float final = 2;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.final_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // optional string in = 3;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.in_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // optional string Var = 4;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.var_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\44\0\0\2\3\0\0\0"
+    "protobuf_unittest.TestJavaScriptJSON"
+    "in"
+    "Var"
+  }},
+};
+
+::uint8_t* TestJavaScriptJSON::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestJavaScriptJSON)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 a = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_a(), target);
+  }
+
+  // optional float final = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        2, this->_internal_final(), target);
+  }
+
+  // optional string in = 3;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_in();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestJavaScriptJSON.in");
+    target = stream->WriteStringMaybeAliased(3, _s, target);
+  }
+
+  // optional string Var = 4;
+  if (cached_has_bits & 0x00000002u) {
+    const std::string& _s = this->_internal_var();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestJavaScriptJSON.Var");
+    target = stream->WriteStringMaybeAliased(4, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestJavaScriptJSON)
+  return target;
+}
+
+::size_t TestJavaScriptJSON::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestJavaScriptJSON)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string in = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_in());
+    }
+
+    // optional string Var = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_var());
+    }
+
+    // optional int32 a = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_a());
+    }
+
+    // optional float final = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 5;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestJavaScriptJSON::_class_data_ = {
+    TestJavaScriptJSON::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestJavaScriptJSON::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestJavaScriptJSON::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestJavaScriptJSON*>(&to_msg);
+  auto& from = static_cast<const TestJavaScriptJSON&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestJavaScriptJSON)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_in(from._internal_in());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_var(from._internal_var());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.final_ = from._impl_.final_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestJavaScriptJSON::CopyFrom(const TestJavaScriptJSON& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestJavaScriptJSON)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestJavaScriptJSON::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestJavaScriptJSON::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestJavaScriptJSON::InternalSwap(TestJavaScriptJSON* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.in_, &other->_impl_.in_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.var_, &other->_impl_.var_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.final_)
+      + sizeof(TestJavaScriptJSON::_impl_.final_)
+      - PROTOBUF_FIELD_OFFSET(TestJavaScriptJSON, _impl_.a_)>(
+          reinterpret_cast<char*>(&_impl_.a_),
+          reinterpret_cast<char*>(&other->_impl_.a_));
+}
+
+::google::protobuf::Metadata TestJavaScriptJSON::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[3]);
+}
+// ===================================================================
+
+class TestJavaScriptOrderJSON1::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestJavaScriptOrderJSON1>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_._has_bits_);
+  static void set_has_d(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+TestJavaScriptOrderJSON1::TestJavaScriptOrderJSON1(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestJavaScriptOrderJSON1)
+}
+TestJavaScriptOrderJSON1::TestJavaScriptOrderJSON1(
+    ::google::protobuf::Arena* arena, const TestJavaScriptOrderJSON1& from)
+    : TestJavaScriptOrderJSON1(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestJavaScriptOrderJSON1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestJavaScriptOrderJSON1::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, d_),
+           0,
+           offsetof(Impl_, a_) -
+               offsetof(Impl_, d_) +
+               sizeof(Impl_::a_));
+}
+TestJavaScriptOrderJSON1::~TestJavaScriptOrderJSON1() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestJavaScriptOrderJSON1)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestJavaScriptOrderJSON1::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestJavaScriptOrderJSON1::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestJavaScriptOrderJSON1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.d_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.a_) -
+        reinterpret_cast<char*>(&_impl_.d_)) + sizeof(_impl_.a_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestJavaScriptOrderJSON1::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 0, 0, 2> TestJavaScriptOrderJSON1::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_._has_bits_),
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestJavaScriptOrderJSON1_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional int32 d = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON1, _impl_.d_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.d_)}},
+    // optional int32 c = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON1, _impl_.c_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.c_)}},
+    // optional bool x = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestJavaScriptOrderJSON1, _impl_.x_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.x_)}},
+    // optional int32 b = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON1, _impl_.b_), 3>(),
+     {32, 3, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.b_)}},
+    // optional int32 a = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON1, _impl_.a_), 4>(),
+     {40, 4, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.a_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 d = 1;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.d_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 c = 2;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.c_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional bool x = 3;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.x_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // optional int32 b = 4;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.b_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 a = 5;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.a_), _Internal::kHasBitsOffset + 4, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestJavaScriptOrderJSON1::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestJavaScriptOrderJSON1)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 46 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[46];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 d = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_d(), ptr);
+  }
+
+  // optional int32 c = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_c(), ptr);
+  }
+
+  // optional bool x = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ptr = ::_pbi::WireFormatLite::WriteBoolToArray(
+        3, this->_internal_x(), ptr);
+  }
+
+  // optional int32 b = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        4, this->_internal_b(), ptr);
+  }
+
+  // optional int32 a = 5;
+  if (cached_has_bits & 0x00000010u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        5, this->_internal_a(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestJavaScriptOrderJSON1)
+  return target;
+}
+
+::size_t TestJavaScriptOrderJSON1::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestJavaScriptOrderJSON1)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional int32 d = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_d());
+    }
+
+    // optional int32 c = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_c());
+    }
+
+    // optional bool x = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2;
+    }
+
+    // optional int32 b = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_b());
+    }
+
+    // optional int32 a = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_a());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestJavaScriptOrderJSON1::_class_data_ = {
+    TestJavaScriptOrderJSON1::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestJavaScriptOrderJSON1::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestJavaScriptOrderJSON1::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestJavaScriptOrderJSON1*>(&to_msg);
+  auto& from = static_cast<const TestJavaScriptOrderJSON1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestJavaScriptOrderJSON1)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.d_ = from._impl_.d_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.b_ = from._impl_.b_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestJavaScriptOrderJSON1::CopyFrom(const TestJavaScriptOrderJSON1& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestJavaScriptOrderJSON1)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestJavaScriptOrderJSON1::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestJavaScriptOrderJSON1::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestJavaScriptOrderJSON1::InternalSwap(TestJavaScriptOrderJSON1* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.a_)
+      + sizeof(TestJavaScriptOrderJSON1::_impl_.a_)
+      - PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON1, _impl_.d_)>(
+          reinterpret_cast<char*>(&_impl_.d_),
+          reinterpret_cast<char*>(&other->_impl_.d_));
+}
+
+::google::protobuf::Metadata TestJavaScriptOrderJSON1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[4]);
+}
+// ===================================================================
+
+class TestJavaScriptOrderJSON2::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestJavaScriptOrderJSON2>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_._has_bits_);
+  static void set_has_d(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+TestJavaScriptOrderJSON2::TestJavaScriptOrderJSON2(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestJavaScriptOrderJSON2)
+}
+inline PROTOBUF_NDEBUG_INLINE TestJavaScriptOrderJSON2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        z_{visibility, arena, from.z_} {}
+
+TestJavaScriptOrderJSON2::TestJavaScriptOrderJSON2(
+    ::google::protobuf::Arena* arena,
+    const TestJavaScriptOrderJSON2& from)
+    : ::google::protobuf::Message(arena) {
+  TestJavaScriptOrderJSON2* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, d_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, d_),
+           offsetof(Impl_, a_) -
+               offsetof(Impl_, d_) +
+               sizeof(Impl_::a_));
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestJavaScriptOrderJSON2)
+}
+inline PROTOBUF_NDEBUG_INLINE TestJavaScriptOrderJSON2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        z_{visibility, arena} {}
+
+inline void TestJavaScriptOrderJSON2::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, d_),
+           0,
+           offsetof(Impl_, a_) -
+               offsetof(Impl_, d_) +
+               sizeof(Impl_::a_));
+}
+TestJavaScriptOrderJSON2::~TestJavaScriptOrderJSON2() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestJavaScriptOrderJSON2)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestJavaScriptOrderJSON2::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestJavaScriptOrderJSON2::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestJavaScriptOrderJSON2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.z_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.d_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.a_) -
+        reinterpret_cast<char*>(&_impl_.d_)) + sizeof(_impl_.a_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestJavaScriptOrderJSON2::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 6, 1, 0, 2> TestJavaScriptOrderJSON2::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_._has_bits_),
+    0, // no _extensions_
+    6, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestJavaScriptOrderJSON2_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional int32 d = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON2, _impl_.d_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.d_)}},
+    // optional int32 c = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON2, _impl_.c_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.c_)}},
+    // optional bool x = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestJavaScriptOrderJSON2, _impl_.x_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.x_)}},
+    // optional int32 b = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON2, _impl_.b_), 3>(),
+     {32, 3, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.b_)}},
+    // optional int32 a = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestJavaScriptOrderJSON2, _impl_.a_), 4>(),
+     {40, 4, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.a_)}},
+    // repeated .protobuf_unittest.TestJavaScriptOrderJSON1 z = 6;
+    {::_pbi::TcParser::FastMtR1,
+     {50, 63, 0, PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.z_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 d = 1;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.d_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 c = 2;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.c_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional bool x = 3;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.x_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // optional int32 b = 4;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.b_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 a = 5;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.a_), _Internal::kHasBitsOffset + 4, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // repeated .protobuf_unittest.TestJavaScriptOrderJSON1 z = 6;
+    {PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.z_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestJavaScriptOrderJSON1>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestJavaScriptOrderJSON2::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestJavaScriptOrderJSON2)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 d = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_d(), target);
+  }
+
+  // optional int32 c = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_c(), target);
+  }
+
+  // optional bool x = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        3, this->_internal_x(), target);
+  }
+
+  // optional int32 b = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<4>(
+            stream, this->_internal_b(), target);
+  }
+
+  // optional int32 a = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<5>(
+            stream, this->_internal_a(), target);
+  }
+
+  // repeated .protobuf_unittest.TestJavaScriptOrderJSON1 z = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_z_size()); i < n; i++) {
+    const auto& repfield = this->_internal_z().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestJavaScriptOrderJSON2)
+  return target;
+}
+
+::size_t TestJavaScriptOrderJSON2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestJavaScriptOrderJSON2)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protobuf_unittest.TestJavaScriptOrderJSON1 z = 6;
+  total_size += 1UL * this->_internal_z_size();
+  for (const auto& msg : this->_internal_z()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional int32 d = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_d());
+    }
+
+    // optional int32 c = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_c());
+    }
+
+    // optional bool x = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2;
+    }
+
+    // optional int32 b = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_b());
+    }
+
+    // optional int32 a = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_a());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestJavaScriptOrderJSON2::_class_data_ = {
+    TestJavaScriptOrderJSON2::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestJavaScriptOrderJSON2::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestJavaScriptOrderJSON2::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestJavaScriptOrderJSON2*>(&to_msg);
+  auto& from = static_cast<const TestJavaScriptOrderJSON2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestJavaScriptOrderJSON2)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_z()->MergeFrom(
+      from._internal_z());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.d_ = from._impl_.d_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.b_ = from._impl_.b_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestJavaScriptOrderJSON2::CopyFrom(const TestJavaScriptOrderJSON2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestJavaScriptOrderJSON2)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestJavaScriptOrderJSON2::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestJavaScriptOrderJSON2::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestJavaScriptOrderJSON2::InternalSwap(TestJavaScriptOrderJSON2* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.z_.InternalSwap(&other->_impl_.z_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.a_)
+      + sizeof(TestJavaScriptOrderJSON2::_impl_.a_)
+      - PROTOBUF_FIELD_OFFSET(TestJavaScriptOrderJSON2, _impl_.d_)>(
+          reinterpret_cast<char*>(&_impl_.d_),
+          reinterpret_cast<char*>(&other->_impl_.d_));
+}
+
+::google::protobuf::Metadata TestJavaScriptOrderJSON2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[5]);
+}
+// ===================================================================
+
+class TestLargeInt::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestLargeInt>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TestLargeInt::TestLargeInt(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestLargeInt)
+}
+TestLargeInt::TestLargeInt(
+    ::google::protobuf::Arena* arena, const TestLargeInt& from)
+    : TestLargeInt(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestLargeInt::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestLargeInt::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, a_),
+           0,
+           offsetof(Impl_, b_) -
+               offsetof(Impl_, a_) +
+               sizeof(Impl_::b_));
+}
+TestLargeInt::~TestLargeInt() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestLargeInt)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestLargeInt::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestLargeInt::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestLargeInt)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.a_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.b_) -
+        reinterpret_cast<char*>(&_impl_.a_)) + sizeof(_impl_.b_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestLargeInt::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> TestLargeInt::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestLargeInt_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // required uint64 b = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TestLargeInt, _impl_.b_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_.b_)}},
+    // required int64 a = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TestLargeInt, _impl_.a_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_.a_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // required int64 a = 1;
+    {PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_.a_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt64)},
+    // required uint64 b = 2;
+    {PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_.b_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestLargeInt::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestLargeInt)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 22 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[22];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 a = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt64ToArray(
+        1, this->_internal_a(), ptr);
+  }
+
+  // required uint64 b = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ptr = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        2, this->_internal_b(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestLargeInt)
+  return target;
+}
+
+::size_t TestLargeInt::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestLargeInt)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // required int64 a = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+          this->_internal_a());
+    }
+
+    // required uint64 b = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+          this->_internal_b());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestLargeInt::_class_data_ = {
+    TestLargeInt::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestLargeInt::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestLargeInt::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestLargeInt*>(&to_msg);
+  auto& from = static_cast<const TestLargeInt&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestLargeInt)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.b_ = from._impl_.b_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestLargeInt::CopyFrom(const TestLargeInt& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestLargeInt)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestLargeInt::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestLargeInt::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestLargeInt::InternalSwap(TestLargeInt* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_.b_)
+      + sizeof(TestLargeInt::_impl_.b_)
+      - PROTOBUF_FIELD_OFFSET(TestLargeInt, _impl_.a_)>(
+          reinterpret_cast<char*>(&_impl_.a_),
+          reinterpret_cast<char*>(&other->_impl_.a_));
+}
+
+::google::protobuf::Metadata TestLargeInt::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[6]);
+}
+// ===================================================================
+
+class TestNumbers::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestNumbers>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_d(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_e(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_f(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+TestNumbers::TestNumbers(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestNumbers)
+}
+TestNumbers::TestNumbers(
+    ::google::protobuf::Arena* arena, const TestNumbers& from)
+    : TestNumbers(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestNumbers::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestNumbers::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, a_),
+           0,
+           offsetof(Impl_, f_) -
+               offsetof(Impl_, a_) +
+               sizeof(Impl_::f_));
+}
+TestNumbers::~TestNumbers() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestNumbers)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestNumbers::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestNumbers::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestNumbers)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.a_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.f_) -
+        reinterpret_cast<char*>(&_impl_.a_)) + sizeof(_impl_.f_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestNumbers::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 6, 1, 0, 2> TestNumbers::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_._has_bits_),
+    0, // no _extensions_
+    6, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestNumbers_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional .protobuf_unittest.TestNumbers.MyType a = 1;
+    {::_pbi::TcParser::FastEr0S1,
+     {8, 0, 2, PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.a_)}},
+    // optional int32 b = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestNumbers, _impl_.b_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.b_)}},
+    // optional float c = 3;
+    {::_pbi::TcParser::FastF32S1,
+     {29, 2, 0, PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.c_)}},
+    // optional bool d = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestNumbers, _impl_.d_), 3>(),
+     {32, 3, 0, PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.d_)}},
+    // optional double e = 5;
+    {::_pbi::TcParser::FastF64S1,
+     {41, 4, 0, PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.e_)}},
+    // optional uint32 f = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestNumbers, _impl_.f_), 5>(),
+     {48, 5, 0, PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.f_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional .protobuf_unittest.TestNumbers.MyType a = 1;
+    {PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.a_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kEnumRange)},
+    // optional int32 b = 2;
+    {PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.b_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional float c = 3;
+    {PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.c_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // optional bool d = 4;
+    {PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.d_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // optional double e = 5;
+    {PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.e_), _Internal::kHasBitsOffset + 4, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kDouble)},
+    // optional uint32 f = 6;
+    {PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.f_), _Internal::kHasBitsOffset + 5, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+  }}, {{
+    {0, 3},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestNumbers::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestNumbers)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 44 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[44];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .protobuf_unittest.TestNumbers.MyType a = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_a(), ptr);
+  }
+
+  // optional int32 b = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_b(), ptr);
+  }
+
+  // optional float c = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ptr = ::_pbi::WireFormatLite::WriteFloatToArray(
+        3, this->_internal_c(), ptr);
+  }
+
+  // optional bool d = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ptr = ::_pbi::WireFormatLite::WriteBoolToArray(
+        4, this->_internal_d(), ptr);
+  }
+
+  // optional double e = 5;
+  if (cached_has_bits & 0x00000010u) {
+    ptr = ::_pbi::WireFormatLite::WriteDoubleToArray(
+        5, this->_internal_e(), ptr);
+  }
+
+  // optional uint32 f = 6;
+  if (cached_has_bits & 0x00000020u) {
+    ptr = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        6, this->_internal_f(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestNumbers)
+  return target;
+}
+
+::size_t TestNumbers::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestNumbers)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional .protobuf_unittest.TestNumbers.MyType a = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_a());
+    }
+
+    // optional int32 b = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_b());
+    }
+
+    // optional float c = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 5;
+    }
+
+    // optional bool d = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2;
+    }
+
+    // optional double e = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 9;
+    }
+
+    // optional uint32 f = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+          this->_internal_f());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestNumbers::_class_data_ = {
+    TestNumbers::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestNumbers::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestNumbers::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestNumbers*>(&to_msg);
+  auto& from = static_cast<const TestNumbers&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestNumbers)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.b_ = from._impl_.b_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.d_ = from._impl_.d_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.e_ = from._impl_.e_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.f_ = from._impl_.f_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestNumbers::CopyFrom(const TestNumbers& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestNumbers)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestNumbers::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestNumbers::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestNumbers::InternalSwap(TestNumbers* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.f_)
+      + sizeof(TestNumbers::_impl_.f_)
+      - PROTOBUF_FIELD_OFFSET(TestNumbers, _impl_.a_)>(
+          reinterpret_cast<char*>(&_impl_.a_),
+          reinterpret_cast<char*>(&other->_impl_.a_));
+}
+
+::google::protobuf::Metadata TestNumbers::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[7]);
+}
+// ===================================================================
+
+class TestCamelCase::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestCamelCase>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_._has_bits_);
+  static void set_has_normal_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_capital_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_camelcasefield(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+TestCamelCase::TestCamelCase(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestCamelCase)
+}
+inline PROTOBUF_NDEBUG_INLINE TestCamelCase::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        normal_field_(arena, from.normal_field_) {}
+
+TestCamelCase::TestCamelCase(
+    ::google::protobuf::Arena* arena,
+    const TestCamelCase& from)
+    : ::google::protobuf::Message(arena) {
+  TestCamelCase* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, capital_field_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, capital_field_),
+           offsetof(Impl_, camelcasefield_) -
+               offsetof(Impl_, capital_field_) +
+               sizeof(Impl_::camelcasefield_));
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestCamelCase)
+}
+inline PROTOBUF_NDEBUG_INLINE TestCamelCase::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        normal_field_(arena) {}
+
+inline void TestCamelCase::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, capital_field_),
+           0,
+           offsetof(Impl_, camelcasefield_) -
+               offsetof(Impl_, capital_field_) +
+               sizeof(Impl_::camelcasefield_));
+}
+TestCamelCase::~TestCamelCase() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestCamelCase)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestCamelCase::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.normal_field_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestCamelCase::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestCamelCase)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.normal_field_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.capital_field_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.camelcasefield_) -
+        reinterpret_cast<char*>(&_impl_.capital_field_)) + sizeof(_impl_.camelcasefield_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestCamelCase::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 52, 2> TestCamelCase::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestCamelCase_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional string normal_field = 1;
+    {::_pbi::TcParser::FastSS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.normal_field_)}},
+    // optional int32 CAPITAL_FIELD = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestCamelCase, _impl_.capital_field_), 1>(),
+     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.capital_field_)}},
+    // optional int32 CamelCaseField = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestCamelCase, _impl_.camelcasefield_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.camelcasefield_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional string normal_field = 1;
+    {PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.normal_field_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // optional int32 CAPITAL_FIELD = 2;
+    {PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.capital_field_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 CamelCaseField = 3;
+    {PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.camelcasefield_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\37\14\0\0\0\0\0\0"
+    "protobuf_unittest.TestCamelCase"
+    "normal_field"
+  }},
+};
+
+::uint8_t* TestCamelCase::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestCamelCase)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string normal_field = 1;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_normal_field();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestCamelCase.normal_field");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // optional int32 CAPITAL_FIELD = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_capital_field(), target);
+  }
+
+  // optional int32 CamelCaseField = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<3>(
+            stream, this->_internal_camelcasefield(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestCamelCase)
+  return target;
+}
+
+::size_t TestCamelCase::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestCamelCase)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string normal_field = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_normal_field());
+    }
+
+    // optional int32 CAPITAL_FIELD = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_capital_field());
+    }
+
+    // optional int32 CamelCaseField = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_camelcasefield());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestCamelCase::_class_data_ = {
+    TestCamelCase::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestCamelCase::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestCamelCase::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestCamelCase*>(&to_msg);
+  auto& from = static_cast<const TestCamelCase&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestCamelCase)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_normal_field(from._internal_normal_field());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.capital_field_ = from._impl_.capital_field_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.camelcasefield_ = from._impl_.camelcasefield_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestCamelCase::CopyFrom(const TestCamelCase& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestCamelCase)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestCamelCase::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestCamelCase::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestCamelCase::InternalSwap(TestCamelCase* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.normal_field_, &other->_impl_.normal_field_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.camelcasefield_)
+      + sizeof(TestCamelCase::_impl_.camelcasefield_)
+      - PROTOBUF_FIELD_OFFSET(TestCamelCase, _impl_.capital_field_)>(
+          reinterpret_cast<char*>(&_impl_.capital_field_),
+          reinterpret_cast<char*>(&other->_impl_.capital_field_));
+}
+
+::google::protobuf::Metadata TestCamelCase::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[8]);
+}
+// ===================================================================
+
+TestBoolMap_BoolMapEntry_DoNotUse::TestBoolMap_BoolMapEntry_DoNotUse() {}
+TestBoolMap_BoolMapEntry_DoNotUse::TestBoolMap_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestBoolMap_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[9]);
+}
+// ===================================================================
+
+class TestBoolMap::_Internal {
+ public:
+};
+
+TestBoolMap::TestBoolMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestBoolMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestBoolMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : bool_map_{visibility, arena, from.bool_map_},
+        _cached_size_{0} {}
+
+TestBoolMap::TestBoolMap(
+    ::google::protobuf::Arena* arena,
+    const TestBoolMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestBoolMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestBoolMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestBoolMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : bool_map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestBoolMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestBoolMap::~TestBoolMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestBoolMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestBoolMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestBoolMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestBoolMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bool_map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestBoolMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestBoolMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestBoolMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<bool, int32> bool_map = 1;
+    {PROTOBUF_FIELD_OFFSET(TestBoolMap, _impl_.bool_map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestBoolMap()._impl_.bool_map_)>(
+        0, 1, 0, 8,
+        5)},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestBoolMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestBoolMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  if (!_internal_bool_map().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_bool_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestBoolMap)
+  return target;
+}
+
+::size_t TestBoolMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestBoolMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_bool_map_size());
+  for (const auto& entry : _internal_bool_map()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestBoolMap::_class_data_ = {
+    TestBoolMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestBoolMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestBoolMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestBoolMap*>(&to_msg);
+  auto& from = static_cast<const TestBoolMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestBoolMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bool_map_.MergeFrom(from._impl_.bool_map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestBoolMap::CopyFrom(const TestBoolMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestBoolMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestBoolMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestBoolMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestBoolMap::InternalSwap(TestBoolMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bool_map_.InternalSwap(&other->_impl_.bool_map_);
+}
+
+::google::protobuf::Metadata TestBoolMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[10]);
+}
+// ===================================================================
+
+class TestRecursion::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestRecursion>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::TestRecursion& child(const TestRecursion* msg);
+  static void set_has_child(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestRecursion& TestRecursion::_Internal::child(const TestRecursion* msg) {
+  return *msg->_impl_.child_;
+}
+TestRecursion::TestRecursion(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRecursion)
+}
+inline PROTOBUF_NDEBUG_INLINE TestRecursion::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestRecursion::TestRecursion(
+    ::google::protobuf::Arena* arena,
+    const TestRecursion& from)
+    : ::google::protobuf::Message(arena) {
+  TestRecursion* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.child_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestRecursion>(arena, *from._impl_.child_)
+                : nullptr;
+  _impl_.value_ = from._impl_.value_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRecursion)
+}
+inline PROTOBUF_NDEBUG_INLINE TestRecursion::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestRecursion::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, child_),
+           0,
+           offsetof(Impl_, value_) -
+               offsetof(Impl_, child_) +
+               sizeof(Impl_::value_));
+}
+TestRecursion::~TestRecursion() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRecursion)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestRecursion::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.child_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestRecursion::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestRecursion)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.child_ != nullptr);
+    _impl_.child_->Clear();
+  }
+  _impl_.value_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestRecursion::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 0, 2> TestRecursion::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestRecursion_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional .protobuf_unittest.TestRecursion child = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_.child_)}},
+    // optional int32 value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestRecursion, _impl_.value_), 1>(),
+     {8, 1, 0, PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_.value_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional .protobuf_unittest.TestRecursion child = 2;
+    {PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_.child_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestRecursion>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestRecursion::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestRecursion)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 value = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_value(), target);
+  }
+
+  // optional .protobuf_unittest.TestRecursion child = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::child(this),
+        _Internal::child(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestRecursion)
+  return target;
+}
+
+::size_t TestRecursion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestRecursion)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .protobuf_unittest.TestRecursion child = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.child_);
+    }
+
+    // optional int32 value = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_value());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestRecursion::_class_data_ = {
+    TestRecursion::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestRecursion::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestRecursion::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestRecursion*>(&to_msg);
+  auto& from = static_cast<const TestRecursion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestRecursion)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_child()->::protobuf_unittest::TestRecursion::MergeFrom(
+          from._internal_child());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.value_ = from._impl_.value_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestRecursion::CopyFrom(const TestRecursion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestRecursion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestRecursion::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestRecursion::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestRecursion::InternalSwap(TestRecursion* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_.value_)
+      + sizeof(TestRecursion::_impl_.value_)
+      - PROTOBUF_FIELD_OFFSET(TestRecursion, _impl_.child_)>(
+          reinterpret_cast<char*>(&_impl_.child_),
+          reinterpret_cast<char*>(&other->_impl_.child_));
+}
+
+::google::protobuf::Metadata TestRecursion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[11]);
+}
+// ===================================================================
+
+TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse() {}
+TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestStringMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[12]);
+}
+// ===================================================================
+
+class TestStringMap::_Internal {
+ public:
+};
+
+TestStringMap::TestStringMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestStringMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStringMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : string_map_{visibility, arena, from.string_map_},
+        _cached_size_{0} {}
+
+TestStringMap::TestStringMap(
+    ::google::protobuf::Arena* arena,
+    const TestStringMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestStringMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestStringMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStringMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : string_map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestStringMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestStringMap::~TestStringMap() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestStringMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestStringMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestStringMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestStringMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.string_map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestStringMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 50, 2> TestStringMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestStringMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, string> string_map = 1;
+    {PROTOBUF_FIELD_OFFSET(TestStringMap, _impl_.string_map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestStringMap()._impl_.string_map_)>(
+        0, 1, 0, 9,
+        9)},
+  }}, {{
+    "\37\12\0\0\0\0\0\0"
+    "protobuf_unittest.TestStringMap"
+    "string_map"
+  }},
+};
+
+::uint8_t* TestStringMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestStringMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, string> string_map = 1;
+  if (!_internal_string_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_string_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringMap.string_map");
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringMap.string_map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringMap.string_map");
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringMap.string_map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestStringMap)
+  return target;
+}
+
+::size_t TestStringMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestStringMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> string_map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_string_map_size());
+  for (const auto& entry : _internal_string_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestStringMap::_class_data_ = {
+    TestStringMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestStringMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestStringMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestStringMap*>(&to_msg);
+  auto& from = static_cast<const TestStringMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestStringMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.string_map_.MergeFrom(from._impl_.string_map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestStringMap::CopyFrom(const TestStringMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestStringMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestStringMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestStringMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestStringMap::InternalSwap(TestStringMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.string_map_.InternalSwap(&other->_impl_.string_map_);
+}
+
+::google::protobuf::Metadata TestStringMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[13]);
+}
+// ===================================================================
+
+TestStringSerializer_StringMapEntry_DoNotUse::TestStringSerializer_StringMapEntry_DoNotUse() {}
+TestStringSerializer_StringMapEntry_DoNotUse::TestStringSerializer_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestStringSerializer_StringMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[14]);
+}
+// ===================================================================
+
+class TestStringSerializer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestStringSerializer>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_._has_bits_);
+  static void set_has_scalar_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestStringSerializer::TestStringSerializer(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestStringSerializer)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStringSerializer::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_string_{visibility, arena, from.repeated_string_},
+        string_map_{visibility, arena, from.string_map_},
+        scalar_string_(arena, from.scalar_string_) {}
+
+TestStringSerializer::TestStringSerializer(
+    ::google::protobuf::Arena* arena,
+    const TestStringSerializer& from)
+    : ::google::protobuf::Message(arena) {
+  TestStringSerializer* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestStringSerializer)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStringSerializer::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_string_{visibility, arena},
+        string_map_{visibility, arena},
+        scalar_string_(arena) {}
+
+inline void TestStringSerializer::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestStringSerializer::~TestStringSerializer() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestStringSerializer)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestStringSerializer::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.scalar_string_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestStringSerializer::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestStringSerializer)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_string_.Clear();
+  _impl_.string_map_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.scalar_string_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestStringSerializer::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 3, 1, 85, 2> TestStringSerializer::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestStringSerializer_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated string repeated_string = 2;
+    {::_pbi::TcParser::FastSR1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_.repeated_string_)}},
+    // optional string scalar_string = 1;
+    {::_pbi::TcParser::FastSS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_.scalar_string_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional string scalar_string = 1;
+    {PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_.scalar_string_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // repeated string repeated_string = 2;
+    {PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_.repeated_string_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kRawString | ::_fl::kRepSString)},
+    // map<string, string> string_map = 3;
+    {PROTOBUF_FIELD_OFFSET(TestStringSerializer, _impl_.string_map_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestStringSerializer()._impl_.string_map_)>(
+        0, 1, 0, 9,
+        9)},
+  }}, {{
+    "\46\15\17\12\0\0\0\0"
+    "protobuf_unittest.TestStringSerializer"
+    "scalar_string"
+    "repeated_string"
+    "string_map"
+  }},
+};
+
+::uint8_t* TestStringSerializer::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestStringSerializer)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string scalar_string = 1;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_scalar_string();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestStringSerializer.scalar_string");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // repeated string repeated_string = 2;
+  for (int i = 0, n = this->_internal_repeated_string_size(); i < n; ++i) {
+    const auto& s = this->_internal_repeated_string().Get(i);
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestStringSerializer.repeated_string");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // map<string, string> string_map = 3;
+  if (!_internal_string_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_string_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringSerializer.string_map");
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringSerializer.string_map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringSerializer.string_map");
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestStringSerializer.string_map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestStringSerializer)
+  return target;
+}
+
+::size_t TestStringSerializer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestStringSerializer)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string repeated_string = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_repeated_string().size());
+  for (int i = 0, n = _internal_repeated_string().size(); i < n; ++i) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+        _internal_repeated_string().Get(i));
+  }
+  // map<string, string> string_map = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_string_map_size());
+  for (const auto& entry : _internal_string_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // optional string scalar_string = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_scalar_string());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestStringSerializer::_class_data_ = {
+    TestStringSerializer::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestStringSerializer::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestStringSerializer::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestStringSerializer*>(&to_msg);
+  auto& from = static_cast<const TestStringSerializer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestStringSerializer)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_string()->MergeFrom(from._internal_repeated_string());
+  _this->_impl_.string_map_.MergeFrom(from._impl_.string_map_);
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_scalar_string(from._internal_scalar_string());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestStringSerializer::CopyFrom(const TestStringSerializer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestStringSerializer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestStringSerializer::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestStringSerializer::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestStringSerializer::InternalSwap(TestStringSerializer* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_string_.InternalSwap(&other->_impl_.repeated_string_);
+  _impl_.string_map_.InternalSwap(&other->_impl_.string_map_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.scalar_string_, &other->_impl_.scalar_string_, arena);
+}
+
+::google::protobuf::Metadata TestStringSerializer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[15]);
+}
+// ===================================================================
+
+class TestMessageWithExtension::_Internal {
+ public:
+};
+
+TestMessageWithExtension::TestMessageWithExtension(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageWithExtension)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageWithExtension::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+TestMessageWithExtension::TestMessageWithExtension(
+    ::google::protobuf::Arena* arena,
+    const TestMessageWithExtension& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessageWithExtension* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageWithExtension)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessageWithExtension::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestMessageWithExtension::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMessageWithExtension::~TestMessageWithExtension() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageWithExtension)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessageWithExtension::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessageWithExtension::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageWithExtension)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessageWithExtension::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 0, 0, 0, 2> TestMessageWithExtension::_table_ = {
+  {
+    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(TestMessageWithExtension, _impl_._extensions_),
+    0, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_names),  // no field_entries
+    0,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestMessageWithExtension_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }},
+  // no field_entries, or aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestMessageWithExtension::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestMessageWithExtension)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // Extension range [100, 536870912)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 100, 536870912, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestMessageWithExtension)
+  return target;
+}
+
+::size_t TestMessageWithExtension::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageWithExtension)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessageWithExtension::_class_data_ = {
+    TestMessageWithExtension::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessageWithExtension::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessageWithExtension::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessageWithExtension*>(&to_msg);
+  auto& from = static_cast<const TestMessageWithExtension&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageWithExtension)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessageWithExtension::CopyFrom(const TestMessageWithExtension& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageWithExtension)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessageWithExtension::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestMessageWithExtension::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessageWithExtension::InternalSwap(TestMessageWithExtension* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+}
+
+::google::protobuf::Metadata TestMessageWithExtension::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[16]);
+}
+// ===================================================================
+
+class TestExtension::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestExtension>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestExtension, _impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestExtension::TestExtension(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestExtension)
+}
+inline PROTOBUF_NDEBUG_INLINE TestExtension::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        value_(arena, from.value_) {}
+
+TestExtension::TestExtension(
+    ::google::protobuf::Arena* arena,
+    const TestExtension& from)
+    : ::google::protobuf::Message(arena) {
+  TestExtension* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestExtension)
+}
+inline PROTOBUF_NDEBUG_INLINE TestExtension::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        value_(arena) {}
+
+inline void TestExtension::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestExtension::~TestExtension() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestExtension)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestExtension::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.value_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestExtension::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestExtension)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.value_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestExtension::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 45, 2> TestExtension::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestExtension, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestExtension_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional string value = 1;
+    {::_pbi::TcParser::FastSS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestExtension, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional string value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestExtension, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\37\5\0\0\0\0\0\0"
+    "protobuf_unittest.TestExtension"
+    "value"
+  }},
+};
+
+::uint8_t* TestExtension::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestExtension)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_value();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestExtension.value");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestExtension)
+  return target;
+}
+
+::size_t TestExtension::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestExtension)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestExtension::_class_data_ = {
+    TestExtension::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestExtension::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestExtension::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestExtension*>(&to_msg);
+  auto& from = static_cast<const TestExtension&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestExtension)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestExtension::CopyFrom(const TestExtension& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestExtension)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestExtension::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestExtension::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestExtension::InternalSwap(TestExtension* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.value_, &other->_impl_.value_, arena);
+}
+
+::google::protobuf::Metadata TestExtension::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[17]);
+}
+// ===================================================================
+
+class TestDefaultEnumValue::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestDefaultEnumValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestDefaultEnumValue, _impl_._has_bits_);
+  static void set_has_enum_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestDefaultEnumValue::TestDefaultEnumValue(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestDefaultEnumValue)
+}
+TestDefaultEnumValue::TestDefaultEnumValue(
+    ::google::protobuf::Arena* arena, const TestDefaultEnumValue& from)
+    : TestDefaultEnumValue(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestDefaultEnumValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        enum_value_{static_cast< ::protobuf_unittest::EnumValue >(2)} {}
+
+inline void TestDefaultEnumValue::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestDefaultEnumValue::~TestDefaultEnumValue() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestDefaultEnumValue)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestDefaultEnumValue::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestDefaultEnumValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestDefaultEnumValue)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.enum_value_ = 2;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestDefaultEnumValue::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestDefaultEnumValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestDefaultEnumValue, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestDefaultEnumValue_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // optional .protobuf_unittest.EnumValue enum_value = 1 [default = DEFAULT];
+    {::_pbi::TcParser::FastEr0S1,
+     {8, 0, 2, PROTOBUF_FIELD_OFFSET(TestDefaultEnumValue, _impl_.enum_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional .protobuf_unittest.EnumValue enum_value = 1 [default = DEFAULT];
+    {PROTOBUF_FIELD_OFFSET(TestDefaultEnumValue, _impl_.enum_value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kEnumRange)},
+  }}, {{
+    {0, 3},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestDefaultEnumValue::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestDefaultEnumValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .protobuf_unittest.EnumValue enum_value = 1 [default = DEFAULT];
+  if (cached_has_bits & 0x00000001u) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_enum_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestDefaultEnumValue)
+  return target;
+}
+
+::size_t TestDefaultEnumValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestDefaultEnumValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.EnumValue enum_value = 1 [default = DEFAULT];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestDefaultEnumValue::_class_data_ = {
+    TestDefaultEnumValue::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestDefaultEnumValue::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestDefaultEnumValue::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestDefaultEnumValue*>(&to_msg);
+  auto& from = static_cast<const TestDefaultEnumValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestDefaultEnumValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_set_enum_value(from._internal_enum_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestDefaultEnumValue::CopyFrom(const TestDefaultEnumValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestDefaultEnumValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestDefaultEnumValue::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestDefaultEnumValue::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestDefaultEnumValue::InternalSwap(TestDefaultEnumValue* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.enum_value_, other->_impl_.enum_value_);
+}
+
+::google::protobuf::Metadata TestDefaultEnumValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_2eproto[18]);
+}
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestExtension::kExtFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestMessageWithExtension,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestExtension >, 11, false>
+  TestExtension::ext(kExtFieldNumber, ::protobuf_unittest::TestExtension::default_instance(), nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,13525 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/json_format_proto3.proto
+
+#include "google/protobuf/util/json_format_proto3.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace proto3 {
+      template <typename>
+PROTOBUF_CONSTEXPR TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestStringMap_StringMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestStringMap_StringMapEntry_DoNotUse_default_instance_;
+
+inline constexpr TestNullValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : repeated_null_value_{},
+        _repeated_null_value_cached_byte_size_{0},
+        null_value_{static_cast< ::google::protobuf::NullValue >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestNullValue::TestNullValue(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestNullValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNullValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNullValueDefaultTypeInternal() {}
+  union {
+    TestNullValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNullValueDefaultTypeInternal _TestNullValue_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_Uint64MapEntry_DoNotUse::TestNestedMap_Uint64MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_Uint64MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_Uint32MapEntry_DoNotUse::TestNestedMap_Uint32MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_Uint32MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_StringMapEntry_DoNotUse::TestNestedMap_StringMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_StringMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_StringMapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_Int64MapEntry_DoNotUse::TestNestedMap_Int64MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_Int64MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Int64MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_Int32MapEntry_DoNotUse::TestNestedMap_Int32MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_Int32MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Int32MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_BoolMapEntry_DoNotUse::TestNestedMap_BoolMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_BoolMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_BoolMapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_Uint64MapEntry_DoNotUse::TestMap_Uint64MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_Uint64MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal _TestMap_Uint64MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_Uint32MapEntry_DoNotUse::TestMap_Uint32MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_Uint32MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal _TestMap_Uint32MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_StringMapEntry_DoNotUse::TestMap_StringMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_StringMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_StringMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_StringMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestMap_StringMapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_Int64MapEntry_DoNotUse::TestMap_Int64MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_Int64MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal _TestMap_Int64MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_Int32MapEntry_DoNotUse::TestMap_Int32MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_Int32MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal _TestMap_Int32MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestMap_BoolMapEntry_DoNotUse::TestMap_BoolMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestMap_BoolMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal _TestMap_BoolMapEntry_DoNotUse_default_instance_;
+
+inline constexpr TestEvilJson::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : regular_value_{0},
+        script_{0},
+        quotes_{0},
+        script_and_quotes_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestEvilJson::TestEvilJson(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestEvilJsonDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEvilJsonDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEvilJsonDefaultTypeInternal() {}
+  union {
+    TestEvilJson _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEvilJsonDefaultTypeInternal _TestEvilJson_default_instance_;
+
+inline constexpr TestEnumValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : enum_value1_{static_cast< ::proto3::EnumType >(0)},
+        enum_value2_{static_cast< ::proto3::EnumType >(0)},
+        enum_value3_{static_cast< ::proto3::EnumType >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestEnumValue::TestEnumValue(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestEnumValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestEnumValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestEnumValueDefaultTypeInternal() {}
+  union {
+    TestEnumValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestEnumValueDefaultTypeInternal _TestEnumValue_default_instance_;
+
+inline constexpr TestCustomJsonName::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : value_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestCustomJsonName::TestCustomJsonName(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestCustomJsonNameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestCustomJsonNameDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestCustomJsonNameDefaultTypeInternal() {}
+  union {
+    TestCustomJsonName _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestCustomJsonNameDefaultTypeInternal _TestCustomJsonName_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestBoolValue_BoolMapEntry_DoNotUse::TestBoolValue_BoolMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestBoolValue_BoolMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal _TestBoolValue_BoolMapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR StringtoInt_MapEntry_DoNotUse::StringtoInt_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct StringtoInt_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StringtoInt_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StringtoInt_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    StringtoInt_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StringtoInt_MapEntry_DoNotUseDefaultTypeInternal _StringtoInt_MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR Mixed2_MapEntry_DoNotUse::Mixed2_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct Mixed2_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mixed2_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mixed2_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Mixed2_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mixed2_MapEntry_DoNotUseDefaultTypeInternal _Mixed2_MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR Mixed1_MapEntry_DoNotUse::Mixed1_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct Mixed1_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mixed1_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mixed1_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Mixed1_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mixed1_MapEntry_DoNotUseDefaultTypeInternal _Mixed1_MapEntry_DoNotUse_default_instance_;
+
+inline constexpr MessageType::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : value_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MessageType::MessageType(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MessageTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageTypeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageTypeDefaultTypeInternal() {}
+  union {
+    MessageType _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageTypeDefaultTypeInternal _MessageType_default_instance_;
+
+inline constexpr MapOutWireFormat_Map4Entry::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : value_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        key_{false},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOutWireFormat_Map4Entry::MapOutWireFormat_Map4Entry(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOutWireFormat_Map4EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOutWireFormat_Map4EntryDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOutWireFormat_Map4EntryDefaultTypeInternal() {}
+  union {
+    MapOutWireFormat_Map4Entry _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOutWireFormat_Map4EntryDefaultTypeInternal _MapOutWireFormat_Map4Entry_default_instance_;
+
+inline constexpr MapOutWireFormat_Map3Entry::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : value_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        key_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOutWireFormat_Map3Entry::MapOutWireFormat_Map3Entry(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOutWireFormat_Map3EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOutWireFormat_Map3EntryDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOutWireFormat_Map3EntryDefaultTypeInternal() {}
+  union {
+    MapOutWireFormat_Map3Entry _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOutWireFormat_Map3EntryDefaultTypeInternal _MapOutWireFormat_Map3Entry_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapOut_Map4Entry_DoNotUse::MapOut_Map4Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapOut_Map4Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOut_Map4Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOut_Map4Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapOut_Map4Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOut_Map4Entry_DoNotUseDefaultTypeInternal _MapOut_Map4Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapOut_Map3Entry_DoNotUse::MapOut_Map3Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapOut_Map3Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOut_Map3Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOut_Map3Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapOut_Map3Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOut_Map3Entry_DoNotUseDefaultTypeInternal _MapOut_Map3Entry_DoNotUse_default_instance_;
+
+inline constexpr MapOfObjects_M::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : inner_text_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOfObjects_M::MapOfObjects_M(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOfObjects_MDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOfObjects_MDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOfObjects_MDefaultTypeInternal() {}
+  union {
+    MapOfObjects_M _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOfObjects_MDefaultTypeInternal _MapOfObjects_M_default_instance_;
+
+inline constexpr MapM::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : foo_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapM::MapM(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapMDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapMDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapMDefaultTypeInternal() {}
+  union {
+    MapM _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapMDefaultTypeInternal _MapM_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapIn_MapInputEntry_DoNotUse::MapIn_MapInputEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapIn_MapInputEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapIn_MapInputEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapIn_MapInputEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapIn_MapInputEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapIn_MapInputEntry_DoNotUseDefaultTypeInternal _MapIn_MapInputEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR IntToString_MapEntry_DoNotUse::IntToString_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct IntToString_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntToString_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntToString_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    IntToString_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntToString_MapEntry_DoNotUseDefaultTypeInternal _IntToString_MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR EmptyMap_MapEntry_DoNotUse::EmptyMap_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct EmptyMap_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmptyMap_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmptyMap_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    EmptyMap_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmptyMap_MapEntry_DoNotUseDefaultTypeInternal _EmptyMap_MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR BoolToString_MapEntry_DoNotUse::BoolToString_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct BoolToString_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BoolToString_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BoolToString_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    BoolToString_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BoolToString_MapEntry_DoNotUseDefaultTypeInternal _BoolToString_MapEntry_DoNotUse_default_instance_;
+
+inline constexpr TestWrapper::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_bool_value_{},
+        repeated_int32_value_{},
+        repeated_int64_value_{},
+        repeated_uint32_value_{},
+        repeated_uint64_value_{},
+        repeated_float_value_{},
+        repeated_double_value_{},
+        repeated_string_value_{},
+        repeated_bytes_value_{},
+        bool_value_{nullptr},
+        int32_value_{nullptr},
+        int64_value_{nullptr},
+        uint32_value_{nullptr},
+        uint64_value_{nullptr},
+        float_value_{nullptr},
+        double_value_{nullptr},
+        string_value_{nullptr},
+        bytes_value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestWrapper::TestWrapper(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestWrapperDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestWrapperDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestWrapperDefaultTypeInternal() {}
+  union {
+    TestWrapper _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestWrapperDefaultTypeInternal _TestWrapper_default_instance_;
+
+inline constexpr TestValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_value_{},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestValue::TestValue(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestValueDefaultTypeInternal() {}
+  union {
+    TestValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestValueDefaultTypeInternal _TestValue_default_instance_;
+
+inline constexpr TestTimestamp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_value_{},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestTimestamp::TestTimestamp(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestTimestampDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestTimestampDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestTimestampDefaultTypeInternal() {}
+  union {
+    TestTimestamp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestTimestampDefaultTypeInternal _TestTimestamp_default_instance_;
+
+inline constexpr TestStruct::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_value_{},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestStruct::TestStruct(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestStructDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStructDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStructDefaultTypeInternal() {}
+  union {
+    TestStruct _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStructDefaultTypeInternal _TestStruct_default_instance_;
+
+inline constexpr TestStringMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : string_map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestStringMap::TestStringMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestStringMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestStringMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestStringMapDefaultTypeInternal() {}
+  union {
+    TestStringMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestStringMapDefaultTypeInternal _TestStringMap_default_instance_;
+
+inline constexpr TestOneof::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : oneof_value_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestOneof::TestOneof(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestOneofDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestOneofDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestOneofDefaultTypeInternal() {}
+  union {
+    TestOneof _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestOneofDefaultTypeInternal _TestOneof_default_instance_;
+
+inline constexpr TestNestedMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : bool_map_{},
+        int32_map_{},
+        int64_map_{},
+        uint32_map_{},
+        uint64_map_{},
+        string_map_{},
+        map_map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap::TestNestedMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestNestedMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMapDefaultTypeInternal() {}
+  union {
+    TestNestedMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMapDefaultTypeInternal _TestNestedMap_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestNestedMap_MapMapEntry_DoNotUse::TestNestedMap_MapMapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestNestedMap_MapMapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_MapMapEntry_DoNotUse_default_instance_;
+
+inline constexpr TestMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_bool_value_{},
+        repeated_int32_value_{},
+        _repeated_int32_value_cached_byte_size_{0},
+        repeated_int64_value_{},
+        _repeated_int64_value_cached_byte_size_{0},
+        repeated_uint32_value_{},
+        _repeated_uint32_value_cached_byte_size_{0},
+        repeated_uint64_value_{},
+        _repeated_uint64_value_cached_byte_size_{0},
+        repeated_float_value_{},
+        repeated_double_value_{},
+        repeated_string_value_{},
+        repeated_bytes_value_{},
+        repeated_enum_value_{},
+        _repeated_enum_value_cached_byte_size_{0},
+        repeated_message_value_{},
+        string_value_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        bytes_value_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        message_value_{nullptr},
+        bool_value_{false},
+        int32_value_{0},
+        int64_value_{::int64_t{0}},
+        uint64_value_{::uint64_t{0u}},
+        uint32_value_{0u},
+        float_value_{0},
+        double_value_{0},
+        enum_value_{static_cast< ::proto3::EnumType >(0)} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMessage::TestMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageDefaultTypeInternal() {}
+  union {
+    TestMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageDefaultTypeInternal _TestMessage_default_instance_;
+
+inline constexpr TestMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : bool_map_{},
+        int32_map_{},
+        int64_map_{},
+        uint32_map_{},
+        uint64_map_{},
+        string_map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestMap::TestMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMapDefaultTypeInternal() {}
+  union {
+    TestMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMapDefaultTypeInternal _TestMap_default_instance_;
+
+inline constexpr TestListValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_value_{},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestListValue::TestListValue(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestListValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestListValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestListValueDefaultTypeInternal() {}
+  union {
+    TestListValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestListValueDefaultTypeInternal _TestListValue_default_instance_;
+
+inline constexpr TestFieldMask::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestFieldMask::TestFieldMask(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestFieldMaskDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestFieldMaskDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestFieldMaskDefaultTypeInternal() {}
+  union {
+    TestFieldMask _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestFieldMaskDefaultTypeInternal _TestFieldMask_default_instance_;
+
+inline constexpr TestExtensions::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        extensions_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestExtensions::TestExtensions(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestExtensionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestExtensionsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestExtensionsDefaultTypeInternal() {}
+  union {
+    TestExtensions _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestExtensionsDefaultTypeInternal _TestExtensions_default_instance_;
+
+inline constexpr TestDuration::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_value_{},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestDuration::TestDuration(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestDurationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestDurationDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestDurationDefaultTypeInternal() {}
+  union {
+    TestDuration _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestDurationDefaultTypeInternal _TestDuration_default_instance_;
+
+inline constexpr TestBoolValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : bool_map_{},
+        bool_value_{false},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestBoolValue::TestBoolValue(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestBoolValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestBoolValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestBoolValueDefaultTypeInternal() {}
+  union {
+    TestBoolValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestBoolValueDefaultTypeInternal _TestBoolValue_default_instance_;
+
+inline constexpr TestAny::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        repeated_value_{},
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestAny::TestAny(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestAnyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestAnyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestAnyDefaultTypeInternal() {}
+  union {
+    TestAny _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestAnyDefaultTypeInternal _TestAny_default_instance_;
+
+inline constexpr StringtoInt::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StringtoInt::StringtoInt(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct StringtoIntDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StringtoIntDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StringtoIntDefaultTypeInternal() {}
+  union {
+    StringtoInt _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StringtoIntDefaultTypeInternal _StringtoInt_default_instance_;
+
+inline constexpr Mixed2::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        ee_{static_cast< ::proto3::Mixed2_E >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR Mixed2::Mixed2(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct Mixed2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mixed2DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mixed2DefaultTypeInternal() {}
+  union {
+    Mixed2 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mixed2DefaultTypeInternal _Mixed2_default_instance_;
+
+inline constexpr Mixed1::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        msg_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR Mixed1::Mixed1(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct Mixed1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mixed1DefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mixed1DefaultTypeInternal() {}
+  union {
+    Mixed1 _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mixed1DefaultTypeInternal _Mixed1_default_instance_;
+
+inline constexpr MapOutWireFormat_Map1Entry::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        key_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOutWireFormat_Map1Entry::MapOutWireFormat_Map1Entry(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOutWireFormat_Map1EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOutWireFormat_Map1EntryDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOutWireFormat_Map1EntryDefaultTypeInternal() {}
+  union {
+    MapOutWireFormat_Map1Entry _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOutWireFormat_Map1EntryDefaultTypeInternal _MapOutWireFormat_Map1Entry_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapOut_Map1Entry_DoNotUse::MapOut_Map1Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapOut_Map1Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOut_Map1Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOut_Map1Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapOut_Map1Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOut_Map1Entry_DoNotUseDefaultTypeInternal _MapOut_Map1Entry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapOfObjects_MapEntry_DoNotUse::MapOfObjects_MapEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapOfObjects_MapEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal _MapOfObjects_MapEntry_DoNotUse_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapIn_MapAnyEntry_DoNotUse::MapIn_MapAnyEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapIn_MapAnyEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal _MapIn_MapAnyEntry_DoNotUse_default_instance_;
+
+inline constexpr IntToString::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR IntToString::IntToString(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct IntToStringDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntToStringDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntToStringDefaultTypeInternal() {}
+  union {
+    IntToString _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntToStringDefaultTypeInternal _IntToString_default_instance_;
+
+inline constexpr EmptyMap::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR EmptyMap::EmptyMap(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct EmptyMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmptyMapDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmptyMapDefaultTypeInternal() {}
+  union {
+    EmptyMap _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmptyMapDefaultTypeInternal _EmptyMap_default_instance_;
+
+inline constexpr BoolToString::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR BoolToString::BoolToString(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct BoolToStringDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BoolToStringDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BoolToStringDefaultTypeInternal() {}
+  union {
+    BoolToString _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BoolToStringDefaultTypeInternal _BoolToString_default_instance_;
+
+inline constexpr MapOut::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map1_{},
+        map2_{},
+        map3_{},
+        map4_{},
+        bar_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOut::MapOut(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOutDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOutDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOutDefaultTypeInternal() {}
+  union {
+    MapOut _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOutDefaultTypeInternal _MapOut_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR MapOut_Map2Entry_DoNotUse::MapOut_Map2Entry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct MapOut_Map2Entry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOut_Map2Entry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOut_Map2Entry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MapOut_Map2Entry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOut_Map2Entry_DoNotUseDefaultTypeInternal _MapOut_Map2Entry_DoNotUse_default_instance_;
+
+inline constexpr MapOfObjects::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOfObjects::MapOfObjects(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOfObjectsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOfObjectsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOfObjectsDefaultTypeInternal() {}
+  union {
+    MapOfObjects _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOfObjectsDefaultTypeInternal _MapOfObjects_default_instance_;
+
+inline constexpr MapIn::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : things_{},
+        map_input_{},
+        map_any_{},
+        other_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapIn::MapIn(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapInDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapInDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapInDefaultTypeInternal() {}
+  union {
+    MapIn _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapInDefaultTypeInternal _MapIn_default_instance_;
+
+inline constexpr MapsTestCases::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        empty_map_{nullptr},
+        string_to_int_{nullptr},
+        int_to_string_{nullptr},
+        mixed1_{nullptr},
+        mixed2_{nullptr},
+        map_of_objects_{nullptr},
+        empty_key_string_to_int1_{nullptr},
+        empty_key_string_to_int2_{nullptr},
+        empty_key_string_to_int3_{nullptr},
+        empty_key_bool_to_string_{nullptr},
+        empty_key_int_to_string_{nullptr},
+        empty_key_mixed_{nullptr},
+        empty_key_map_objects_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapsTestCases::MapsTestCases(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapsTestCasesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapsTestCasesDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapsTestCasesDefaultTypeInternal() {}
+  union {
+    MapsTestCases _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapsTestCasesDefaultTypeInternal _MapsTestCases_default_instance_;
+
+inline constexpr MapOutWireFormat_Map2Entry::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        key_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        value_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOutWireFormat_Map2Entry::MapOutWireFormat_Map2Entry(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOutWireFormat_Map2EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOutWireFormat_Map2EntryDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOutWireFormat_Map2EntryDefaultTypeInternal() {}
+  union {
+    MapOutWireFormat_Map2Entry _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOutWireFormat_Map2EntryDefaultTypeInternal _MapOutWireFormat_Map2Entry_default_instance_;
+
+inline constexpr MapOutWireFormat::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : map1_{},
+        map2_{},
+        map3_{},
+        map4_{},
+        bar_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR MapOutWireFormat::MapOutWireFormat(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct MapOutWireFormatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MapOutWireFormatDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MapOutWireFormatDefaultTypeInternal() {}
+  union {
+    MapOutWireFormat _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapOutWireFormatDefaultTypeInternal _MapOutWireFormat_default_instance_;
+}  // namespace proto3
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[65];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[2];
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MessageType, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MessageType, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.bool_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.int32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.int64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.uint32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.uint64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.float_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.double_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.string_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.bytes_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.enum_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.message_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_bool_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_int32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_int64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_uint32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_uint64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_float_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_double_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_string_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_bytes_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_enum_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _impl_.repeated_message_value_),
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    0,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, _internal_metadata_),
+    ~0u,  // no _extensions_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, _impl_._oneof_case_[0]),
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, _impl_.oneof_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _impl_.bool_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _impl_.int32_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _impl_.int64_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _impl_.uint32_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _impl_.uint64_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _impl_.string_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.bool_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.int32_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.int64_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.uint32_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.uint64_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.string_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _impl_.map_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap, _impl_.string_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.bool_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.int32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.int64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.uint32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.uint64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.float_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.double_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.string_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.bytes_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_bool_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_int32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_int64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_uint32_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_uint64_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_float_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_double_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_string_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _impl_.repeated_bytes_value_),
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, _impl_.repeated_value_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, _impl_.repeated_value_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestFieldMask, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestFieldMask, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestFieldMask, _impl_.value_),
+    0,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, _impl_.repeated_value_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestAny, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestAny, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestAny, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestAny, _impl_.repeated_value_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestValue, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestValue, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestValue, _impl_.repeated_value_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, _impl_.value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, _impl_.repeated_value_),
+    0,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue, _impl_.bool_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue, _impl_.bool_map_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNullValue, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNullValue, _impl_.null_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestNullValue, _impl_.repeated_null_value_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestCustomJsonName, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestCustomJsonName, _impl_.value_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEvilJson, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEvilJson, _impl_.regular_value_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEvilJson, _impl_.script_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEvilJson, _impl_.quotes_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEvilJson, _impl_.script_and_quotes_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestExtensions, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestExtensions, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestExtensions, _impl_.extensions_),
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, _impl_.enum_value1_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, _impl_.enum_value2_),
+    PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, _impl_.enum_value3_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.string_to_int_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.int_to_string_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.mixed1_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.mixed2_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.map_of_objects_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_string_to_int1_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_string_to_int2_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_string_to_int3_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_bool_to_string_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_int_to_string_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_mixed_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapsTestCases, _impl_.empty_key_map_objects_),
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    10,
+    11,
+    12,
+    PROTOBUF_FIELD_OFFSET(::proto3::EmptyMap_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::EmptyMap_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::EmptyMap_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::EmptyMap_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::EmptyMap, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::EmptyMap, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::StringtoInt_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::StringtoInt_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::StringtoInt_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::StringtoInt_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::StringtoInt, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::StringtoInt, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::IntToString_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::IntToString_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::IntToString_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::IntToString_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::IntToString, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::IntToString, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::BoolToString_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::BoolToString_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::BoolToString_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::BoolToString_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::BoolToString, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::BoolToString, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1, _impl_.msg_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed1, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::Mixed2, _impl_.ee_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects_M, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects_M, _impl_.inner_text_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects_MapEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects_MapEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects_MapEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects_MapEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOfObjects, _impl_.map_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapInputEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapInputEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapInputEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapInputEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapAnyEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapAnyEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapAnyEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn_MapAnyEntry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn, _impl_.other_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn, _impl_.things_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn, _impl_.map_input_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapIn, _impl_.map_any_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map1Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map1Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map1Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map1Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map2Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map2Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map2Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map2Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map3Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map3Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map3Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map3Entry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map4Entry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map4Entry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map4Entry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut_Map4Entry_DoNotUse, value_),
+    0,
+    1,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut, _impl_.map1_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut, _impl_.map2_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut, _impl_.map3_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut, _impl_.map4_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOut, _impl_.bar_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map1Entry, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map1Entry, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map1Entry, _impl_.key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map1Entry, _impl_.value_),
+    ~0u,
+    0,
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map2Entry, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map2Entry, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map2Entry, _impl_.key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map2Entry, _impl_.value_),
+    ~0u,
+    0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map3Entry, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map3Entry, _impl_.key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map3Entry, _impl_.value_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map4Entry, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map4Entry, _impl_.key_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat_Map4Entry, _impl_.value_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat, _impl_.map1_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat, _impl_.map2_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat, _impl_.map3_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat, _impl_.map4_),
+    PROTOBUF_FIELD_OFFSET(::proto3::MapOutWireFormat, _impl_.bar_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::proto3::MapM, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3::MapM, _impl_.foo_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, -1, -1, sizeof(::proto3::MessageType)},
+        {9, 39, -1, sizeof(::proto3::TestMessage)},
+        {61, -1, -1, sizeof(::proto3::TestOneof)},
+        {76, 86, -1, sizeof(::proto3::TestMap_BoolMapEntry_DoNotUse)},
+        {88, 98, -1, sizeof(::proto3::TestMap_Int32MapEntry_DoNotUse)},
+        {100, 110, -1, sizeof(::proto3::TestMap_Int64MapEntry_DoNotUse)},
+        {112, 122, -1, sizeof(::proto3::TestMap_Uint32MapEntry_DoNotUse)},
+        {124, 134, -1, sizeof(::proto3::TestMap_Uint64MapEntry_DoNotUse)},
+        {136, 146, -1, sizeof(::proto3::TestMap_StringMapEntry_DoNotUse)},
+        {148, -1, -1, sizeof(::proto3::TestMap)},
+        {162, 172, -1, sizeof(::proto3::TestNestedMap_BoolMapEntry_DoNotUse)},
+        {174, 184, -1, sizeof(::proto3::TestNestedMap_Int32MapEntry_DoNotUse)},
+        {186, 196, -1, sizeof(::proto3::TestNestedMap_Int64MapEntry_DoNotUse)},
+        {198, 208, -1, sizeof(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse)},
+        {210, 220, -1, sizeof(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse)},
+        {222, 232, -1, sizeof(::proto3::TestNestedMap_StringMapEntry_DoNotUse)},
+        {234, 244, -1, sizeof(::proto3::TestNestedMap_MapMapEntry_DoNotUse)},
+        {246, -1, -1, sizeof(::proto3::TestNestedMap)},
+        {261, 271, -1, sizeof(::proto3::TestStringMap_StringMapEntry_DoNotUse)},
+        {273, -1, -1, sizeof(::proto3::TestStringMap)},
+        {282, 308, -1, sizeof(::proto3::TestWrapper)},
+        {326, 336, -1, sizeof(::proto3::TestTimestamp)},
+        {338, 348, -1, sizeof(::proto3::TestDuration)},
+        {350, 359, -1, sizeof(::proto3::TestFieldMask)},
+        {360, 370, -1, sizeof(::proto3::TestStruct)},
+        {372, 382, -1, sizeof(::proto3::TestAny)},
+        {384, 394, -1, sizeof(::proto3::TestValue)},
+        {396, 406, -1, sizeof(::proto3::TestListValue)},
+        {408, 418, -1, sizeof(::proto3::TestBoolValue_BoolMapEntry_DoNotUse)},
+        {420, -1, -1, sizeof(::proto3::TestBoolValue)},
+        {430, -1, -1, sizeof(::proto3::TestNullValue)},
+        {440, -1, -1, sizeof(::proto3::TestCustomJsonName)},
+        {449, -1, -1, sizeof(::proto3::TestEvilJson)},
+        {461, 470, -1, sizeof(::proto3::TestExtensions)},
+        {471, -1, -1, sizeof(::proto3::TestEnumValue)},
+        {482, 503, -1, sizeof(::proto3::MapsTestCases)},
+        {516, 526, -1, sizeof(::proto3::EmptyMap_MapEntry_DoNotUse)},
+        {528, -1, -1, sizeof(::proto3::EmptyMap)},
+        {537, 547, -1, sizeof(::proto3::StringtoInt_MapEntry_DoNotUse)},
+        {549, -1, -1, sizeof(::proto3::StringtoInt)},
+        {558, 568, -1, sizeof(::proto3::IntToString_MapEntry_DoNotUse)},
+        {570, -1, -1, sizeof(::proto3::IntToString)},
+        {579, 589, -1, sizeof(::proto3::BoolToString_MapEntry_DoNotUse)},
+        {591, -1, -1, sizeof(::proto3::BoolToString)},
+        {600, 610, -1, sizeof(::proto3::Mixed1_MapEntry_DoNotUse)},
+        {612, -1, -1, sizeof(::proto3::Mixed1)},
+        {622, 632, -1, sizeof(::proto3::Mixed2_MapEntry_DoNotUse)},
+        {634, -1, -1, sizeof(::proto3::Mixed2)},
+        {644, -1, -1, sizeof(::proto3::MapOfObjects_M)},
+        {653, 663, -1, sizeof(::proto3::MapOfObjects_MapEntry_DoNotUse)},
+        {665, -1, -1, sizeof(::proto3::MapOfObjects)},
+        {674, 684, -1, sizeof(::proto3::MapIn_MapInputEntry_DoNotUse)},
+        {686, 696, -1, sizeof(::proto3::MapIn_MapAnyEntry_DoNotUse)},
+        {698, -1, -1, sizeof(::proto3::MapIn)},
+        {710, 720, -1, sizeof(::proto3::MapOut_Map1Entry_DoNotUse)},
+        {722, 732, -1, sizeof(::proto3::MapOut_Map2Entry_DoNotUse)},
+        {734, 744, -1, sizeof(::proto3::MapOut_Map3Entry_DoNotUse)},
+        {746, 756, -1, sizeof(::proto3::MapOut_Map4Entry_DoNotUse)},
+        {758, -1, -1, sizeof(::proto3::MapOut)},
+        {771, 781, -1, sizeof(::proto3::MapOutWireFormat_Map1Entry)},
+        {783, 793, -1, sizeof(::proto3::MapOutWireFormat_Map2Entry)},
+        {795, -1, -1, sizeof(::proto3::MapOutWireFormat_Map3Entry)},
+        {805, -1, -1, sizeof(::proto3::MapOutWireFormat_Map4Entry)},
+        {815, -1, -1, sizeof(::proto3::MapOutWireFormat)},
+        {828, -1, -1, sizeof(::proto3::MapM)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::proto3::_MessageType_default_instance_._instance,
+    &::proto3::_TestMessage_default_instance_._instance,
+    &::proto3::_TestOneof_default_instance_._instance,
+    &::proto3::_TestMap_BoolMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestMap_Int32MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestMap_Int64MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestMap_Uint32MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestMap_Uint64MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestMap_StringMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestMap_default_instance_._instance,
+    &::proto3::_TestNestedMap_BoolMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_Int32MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_Int64MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_StringMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_MapMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestNestedMap_default_instance_._instance,
+    &::proto3::_TestStringMap_StringMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestStringMap_default_instance_._instance,
+    &::proto3::_TestWrapper_default_instance_._instance,
+    &::proto3::_TestTimestamp_default_instance_._instance,
+    &::proto3::_TestDuration_default_instance_._instance,
+    &::proto3::_TestFieldMask_default_instance_._instance,
+    &::proto3::_TestStruct_default_instance_._instance,
+    &::proto3::_TestAny_default_instance_._instance,
+    &::proto3::_TestValue_default_instance_._instance,
+    &::proto3::_TestListValue_default_instance_._instance,
+    &::proto3::_TestBoolValue_BoolMapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_TestBoolValue_default_instance_._instance,
+    &::proto3::_TestNullValue_default_instance_._instance,
+    &::proto3::_TestCustomJsonName_default_instance_._instance,
+    &::proto3::_TestEvilJson_default_instance_._instance,
+    &::proto3::_TestExtensions_default_instance_._instance,
+    &::proto3::_TestEnumValue_default_instance_._instance,
+    &::proto3::_MapsTestCases_default_instance_._instance,
+    &::proto3::_EmptyMap_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_EmptyMap_default_instance_._instance,
+    &::proto3::_StringtoInt_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_StringtoInt_default_instance_._instance,
+    &::proto3::_IntToString_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_IntToString_default_instance_._instance,
+    &::proto3::_BoolToString_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_BoolToString_default_instance_._instance,
+    &::proto3::_Mixed1_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_Mixed1_default_instance_._instance,
+    &::proto3::_Mixed2_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_Mixed2_default_instance_._instance,
+    &::proto3::_MapOfObjects_M_default_instance_._instance,
+    &::proto3::_MapOfObjects_MapEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapOfObjects_default_instance_._instance,
+    &::proto3::_MapIn_MapInputEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapIn_MapAnyEntry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapIn_default_instance_._instance,
+    &::proto3::_MapOut_Map1Entry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapOut_Map2Entry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapOut_Map3Entry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapOut_Map4Entry_DoNotUse_default_instance_._instance,
+    &::proto3::_MapOut_default_instance_._instance,
+    &::proto3::_MapOutWireFormat_Map1Entry_default_instance_._instance,
+    &::proto3::_MapOutWireFormat_Map2Entry_default_instance_._instance,
+    &::proto3::_MapOutWireFormat_Map3Entry_default_instance_._instance,
+    &::proto3::_MapOutWireFormat_Map4Entry_default_instance_._instance,
+    &::proto3::_MapOutWireFormat_default_instance_._instance,
+    &::proto3::_MapM_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n-google/protobuf/util/json_format_proto"
+    "3.proto\022\006proto3\032\031google/protobuf/any.pro"
+    "to\032\036google/protobuf/duration.proto\032 goog"
+    "le/protobuf/field_mask.proto\032\034google/pro"
+    "tobuf/struct.proto\032\037google/protobuf/time"
+    "stamp.proto\032\036google/protobuf/wrappers.pr"
+    "oto\032\036google/protobuf/unittest.proto\"\034\n\013M"
+    "essageType\022\r\n\005value\030\001 \001(\005\"\224\005\n\013TestMessag"
+    "e\022\022\n\nbool_value\030\001 \001(\010\022\023\n\013int32_value\030\002 \001"
+    "(\005\022\023\n\013int64_value\030\003 \001(\003\022\024\n\014uint32_value\030"
+    "\004 \001(\r\022\024\n\014uint64_value\030\005 \001(\004\022\023\n\013float_val"
+    "ue\030\006 \001(\002\022\024\n\014double_value\030\007 \001(\001\022\024\n\014string"
+    "_value\030\010 \001(\t\022\023\n\013bytes_value\030\t \001(\014\022$\n\nenu"
+    "m_value\030\n \001(\0162\020.proto3.EnumType\022*\n\rmessa"
+    "ge_value\030\013 \001(\0132\023.proto3.MessageType\022\033\n\023r"
+    "epeated_bool_value\030\025 \003(\010\022\034\n\024repeated_int"
+    "32_value\030\026 \003(\005\022\034\n\024repeated_int64_value\030\027"
+    " \003(\003\022\035\n\025repeated_uint32_value\030\030 \003(\r\022\035\n\025r"
+    "epeated_uint64_value\030\031 \003(\004\022\034\n\024repeated_f"
+    "loat_value\030\032 \003(\002\022\035\n\025repeated_double_valu"
+    "e\030\033 \003(\001\022\035\n\025repeated_string_value\030\034 \003(\t\022\034"
+    "\n\024repeated_bytes_value\030\035 \003(\014\022-\n\023repeated"
+    "_enum_value\030\036 \003(\0162\020.proto3.EnumType\0223\n\026r"
+    "epeated_message_value\030\037 \003(\0132\023.proto3.Mes"
+    "sageType\"\214\002\n\tTestOneof\022\033\n\021oneof_int32_va"
+    "lue\030\001 \001(\005H\000\022\034\n\022oneof_string_value\030\002 \001(\tH"
+    "\000\022\033\n\021oneof_bytes_value\030\003 \001(\014H\000\022,\n\020oneof_"
+    "enum_value\030\004 \001(\0162\020.proto3.EnumTypeH\000\0222\n\023"
+    "oneof_message_value\030\005 \001(\0132\023.proto3.Messa"
+    "geTypeH\000\0226\n\020oneof_null_value\030\006 \001(\0162\032.goo"
+    "gle.protobuf.NullValueH\000B\r\n\013oneof_value\""
+    "\341\004\n\007TestMap\022.\n\010bool_map\030\001 \003(\0132\034.proto3.T"
+    "estMap.BoolMapEntry\0220\n\tint32_map\030\002 \003(\0132\035"
+    ".proto3.TestMap.Int32MapEntry\0220\n\tint64_m"
+    "ap\030\003 \003(\0132\035.proto3.TestMap.Int64MapEntry\022"
+    "2\n\nuint32_map\030\004 \003(\0132\036.proto3.TestMap.Uin"
+    "t32MapEntry\0222\n\nuint64_map\030\005 \003(\0132\036.proto3"
+    ".TestMap.Uint64MapEntry\0222\n\nstring_map\030\006 "
+    "\003(\0132\036.proto3.TestMap.StringMapEntry\032.\n\014B"
+    "oolMapEntry\022\013\n\003key\030\001 \001(\010\022\r\n\005value\030\002 \001(\005:"
+    "\0028\001\032/\n\rInt32MapEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005val"
+    "ue\030\002 \001(\005:\0028\001\032/\n\rInt64MapEntry\022\013\n\003key\030\001 \001"
+    "(\003\022\r\n\005value\030\002 \001(\005:\0028\001\0320\n\016Uint32MapEntry\022"
+    "\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\005:\0028\001\0320\n\016Uint6"
+    "4MapEntry\022\013\n\003key\030\001 \001(\004\022\r\n\005value\030\002 \001(\005:\0028"
+    "\001\0320\n\016StringMapEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005valu"
+    "e\030\002 \001(\005:\0028\001\"\205\006\n\rTestNestedMap\0224\n\010bool_ma"
+    "p\030\001 \003(\0132\".proto3.TestNestedMap.BoolMapEn"
+    "try\0226\n\tint32_map\030\002 \003(\0132#.proto3.TestNest"
+    "edMap.Int32MapEntry\0226\n\tint64_map\030\003 \003(\0132#"
+    ".proto3.TestNestedMap.Int64MapEntry\0228\n\nu"
+    "int32_map\030\004 \003(\0132$.proto3.TestNestedMap.U"
+    "int32MapEntry\0228\n\nuint64_map\030\005 \003(\0132$.prot"
+    "o3.TestNestedMap.Uint64MapEntry\0228\n\nstrin"
+    "g_map\030\006 \003(\0132$.proto3.TestNestedMap.Strin"
+    "gMapEntry\0222\n\007map_map\030\007 \003(\0132!.proto3.Test"
+    "NestedMap.MapMapEntry\032.\n\014BoolMapEntry\022\013\n"
+    "\003key\030\001 \001(\010\022\r\n\005value\030\002 \001(\005:\0028\001\032/\n\rInt32Ma"
+    "pEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\032/"
+    "\n\rInt64MapEntry\022\013\n\003key\030\001 \001(\003\022\r\n\005value\030\002 "
+    "\001(\005:\0028\001\0320\n\016Uint32MapEntry\022\013\n\003key\030\001 \001(\r\022\r"
+    "\n\005value\030\002 \001(\005:\0028\001\0320\n\016Uint64MapEntry\022\013\n\003k"
+    "ey\030\001 \001(\004\022\r\n\005value\030\002 \001(\005:\0028\001\0320\n\016StringMap"
+    "Entry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001\032D\n"
+    "\013MapMapEntry\022\013\n\003key\030\001 \001(\t\022$\n\005value\030\002 \001(\013"
+    "2\025.proto3.TestNestedMap:\0028\001\"{\n\rTestStrin"
+    "gMap\0228\n\nstring_map\030\001 \003(\0132$.proto3.TestSt"
+    "ringMap.StringMapEntry\0320\n\016StringMapEntry"
+    "\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\356\007\n\013Tes"
+    "tWrapper\022.\n\nbool_value\030\001 \001(\0132\032.google.pr"
+    "otobuf.BoolValue\0220\n\013int32_value\030\002 \001(\0132\033."
+    "google.protobuf.Int32Value\0220\n\013int64_valu"
+    "e\030\003 \001(\0132\033.google.protobuf.Int64Value\0222\n\014"
+    "uint32_value\030\004 \001(\0132\034.google.protobuf.UIn"
+    "t32Value\0222\n\014uint64_value\030\005 \001(\0132\034.google."
+    "protobuf.UInt64Value\0220\n\013float_value\030\006 \001("
+    "\0132\033.google.protobuf.FloatValue\0222\n\014double"
+    "_value\030\007 \001(\0132\034.google.protobuf.DoubleVal"
+    "ue\0222\n\014string_value\030\010 \001(\0132\034.google.protob"
+    "uf.StringValue\0220\n\013bytes_value\030\t \001(\0132\033.go"
+    "ogle.protobuf.BytesValue\0227\n\023repeated_boo"
+    "l_value\030\013 \003(\0132\032.google.protobuf.BoolValu"
+    "e\0229\n\024repeated_int32_value\030\014 \003(\0132\033.google"
+    ".protobuf.Int32Value\0229\n\024repeated_int64_v"
+    "alue\030\r \003(\0132\033.google.protobuf.Int64Value\022"
+    ";\n\025repeated_uint32_value\030\016 \003(\0132\034.google."
+    "protobuf.UInt32Value\022;\n\025repeated_uint64_"
+    "value\030\017 \003(\0132\034.google.protobuf.UInt64Valu"
+    "e\0229\n\024repeated_float_value\030\020 \003(\0132\033.google"
+    ".protobuf.FloatValue\022;\n\025repeated_double_"
+    "value\030\021 \003(\0132\034.google.protobuf.DoubleValu"
+    "e\022;\n\025repeated_string_value\030\022 \003(\0132\034.googl"
+    "e.protobuf.StringValue\0229\n\024repeated_bytes"
+    "_value\030\023 \003(\0132\033.google.protobuf.BytesValu"
+    "e\"n\n\rTestTimestamp\022)\n\005value\030\001 \001(\0132\032.goog"
+    "le.protobuf.Timestamp\0222\n\016repeated_value\030"
+    "\002 \003(\0132\032.google.protobuf.Timestamp\"k\n\014Tes"
+    "tDuration\022(\n\005value\030\001 \001(\0132\031.google.protob"
+    "uf.Duration\0221\n\016repeated_value\030\002 \003(\0132\031.go"
+    "ogle.protobuf.Duration\":\n\rTestFieldMask\022"
+    ")\n\005value\030\001 \001(\0132\032.google.protobuf.FieldMa"
+    "sk\"e\n\nTestStruct\022&\n\005value\030\001 \001(\0132\027.google"
+    ".protobuf.Struct\022/\n\016repeated_value\030\002 \003(\013"
+    "2\027.google.protobuf.Struct\"\\\n\007TestAny\022#\n\005"
+    "value\030\001 \001(\0132\024.google.protobuf.Any\022,\n\016rep"
+    "eated_value\030\002 \003(\0132\024.google.protobuf.Any\""
+    "b\n\tTestValue\022%\n\005value\030\001 \001(\0132\026.google.pro"
+    "tobuf.Value\022.\n\016repeated_value\030\002 \003(\0132\026.go"
+    "ogle.protobuf.Value\"n\n\rTestListValue\022)\n\005"
+    "value\030\001 \001(\0132\032.google.protobuf.ListValue\022"
+    "2\n\016repeated_value\030\002 \003(\0132\032.google.protobu"
+    "f.ListValue\"\211\001\n\rTestBoolValue\022\022\n\nbool_va"
+    "lue\030\001 \001(\010\0224\n\010bool_map\030\002 \003(\0132\".proto3.Tes"
+    "tBoolValue.BoolMapEntry\032.\n\014BoolMapEntry\022"
+    "\013\n\003key\030\001 \001(\010\022\r\n\005value\030\002 \001(\005:\0028\001\"x\n\rTestN"
+    "ullValue\022.\n\nnull_value\030\024 \001(\0162\032.google.pr"
+    "otobuf.NullValue\0227\n\023repeated_null_value\030"
+    "\025 \003(\0162\032.google.protobuf.NullValue\"+\n\022Tes"
+    "tCustomJsonName\022\025\n\005value\030\001 \001(\005R\006@value\"\257"
+    "\001\n\014TestEvilJson\022#\n\rregular_value\030\001 \001(\005R\014"
+    "regular_name\022\031\n\006script\030\002 \001(\005R\t</script>\022"
+    "!\n\006quotes\030\003 \001(\005R\021unbalanced\"quotes\022<\n\021sc"
+    "ript_and_quotes\030\004 \001(\005R!\"<script>alert(\'h"
+    "ello!);</script>\"J\n\016TestExtensions\0228\n\nex"
+    "tensions\030\001 \001(\0132$.protobuf_unittest.TestA"
+    "llExtensions\"\204\001\n\rTestEnumValue\022%\n\013enum_v"
+    "alue1\030\001 \001(\0162\020.proto3.EnumType\022%\n\013enum_va"
+    "lue2\030\002 \001(\0162\020.proto3.EnumType\022%\n\013enum_val"
+    "ue3\030\003 \001(\0162\020.proto3.EnumType\"\353\004\n\rMapsTest"
+    "Cases\022#\n\tempty_map\030\001 \001(\0132\020.proto3.EmptyM"
+    "ap\022*\n\rstring_to_int\030\002 \001(\0132\023.proto3.Strin"
+    "gtoInt\022*\n\rint_to_string\030\003 \001(\0132\023.proto3.I"
+    "ntToString\022\036\n\006mixed1\030\004 \001(\0132\016.proto3.Mixe"
+    "d1\022\036\n\006mixed2\030\005 \001(\0132\016.proto3.Mixed2\022,\n\016ma"
+    "p_of_objects\030\006 \001(\0132\024.proto3.MapOfObjects"
+    "\0225\n\030empty_key_string_to_int1\030\007 \001(\0132\023.pro"
+    "to3.StringtoInt\0225\n\030empty_key_string_to_i"
+    "nt2\030\010 \001(\0132\023.proto3.StringtoInt\0225\n\030empty_"
+    "key_string_to_int3\030\t \001(\0132\023.proto3.String"
+    "toInt\0226\n\030empty_key_bool_to_string\030\n \001(\0132"
+    "\024.proto3.BoolToString\0224\n\027empty_key_int_t"
+    "o_string\030\013 \001(\0132\023.proto3.IntToString\022\'\n\017e"
+    "mpty_key_mixed\030\014 \001(\0132\016.proto3.Mixed1\0223\n\025"
+    "empty_key_map_objects\030\r \001(\0132\024.proto3.Map"
+    "OfObjects\"^\n\010EmptyMap\022&\n\003map\030\001 \003(\0132\031.pro"
+    "to3.EmptyMap.MapEntry\032*\n\010MapEntry\022\013\n\003key"
+    "\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\"d\n\013StringtoInt"
+    "\022)\n\003map\030\001 \003(\0132\034.proto3.StringtoInt.MapEn"
+    "try\032*\n\010MapEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 "
+    "\001(\005:\0028\001\"d\n\013IntToString\022)\n\003map\030\001 \003(\0132\034.pr"
+    "oto3.IntToString.MapEntry\032*\n\010MapEntry\022\013\n"
+    "\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\t:\0028\001\"f\n\014BoolToS"
+    "tring\022*\n\003map\030\001 \003(\0132\035.proto3.BoolToString"
+    ".MapEntry\032*\n\010MapEntry\022\013\n\003key\030\001 \001(\010\022\r\n\005va"
+    "lue\030\002 \001(\t:\0028\001\"g\n\006Mixed1\022\013\n\003msg\030\001 \001(\t\022$\n\003"
+    "map\030\002 \003(\0132\027.proto3.Mixed1.MapEntry\032*\n\010Ma"
+    "pEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\002:\0028\001\"\235"
+    "\001\n\006Mixed2\022$\n\003map\030\001 \003(\0132\027.proto3.Mixed2.M"
+    "apEntry\022\034\n\002ee\030\002 \001(\0162\020.proto3.Mixed2.E\032*\n"
+    "\010MapEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\010:\0028"
+    "\001\"#\n\001E\022\006\n\002E0\020\000\022\006\n\002E1\020\001\022\006\n\002E2\020\002\022\006\n\002E3\020\003\"\227"
+    "\001\n\014MapOfObjects\022*\n\003map\030\001 \003(\0132\035.proto3.Ma"
+    "pOfObjects.MapEntry\032\027\n\001M\022\022\n\ninner_text\030\001"
+    " \001(\t\032B\n\010MapEntry\022\013\n\003key\030\001 \001(\t\022%\n\005value\030\002"
+    " \001(\0132\026.proto3.MapOfObjects.M:\0028\001\"\370\001\n\005Map"
+    "In\022\r\n\005other\030\001 \001(\t\022\016\n\006things\030\002 \003(\t\022.\n\tmap"
+    "_input\030\003 \003(\0132\033.proto3.MapIn.MapInputEntr"
+    "y\022*\n\007map_any\030\004 \003(\0132\031.proto3.MapIn.MapAny"
+    "Entry\032/\n\rMapInputEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005v"
+    "alue\030\002 \001(\t:\0028\001\032C\n\013MapAnyEntry\022\013\n\003key\030\001 \001"
+    "(\t\022#\n\005value\030\002 \001(\0132\024.google.protobuf.Any:"
+    "\0028\001\"\207\003\n\006MapOut\022&\n\004map1\030\001 \003(\0132\030.proto3.Ma"
+    "pOut.Map1Entry\022&\n\004map2\030\002 \003(\0132\030.proto3.Ma"
+    "pOut.Map2Entry\022&\n\004map3\030\003 \003(\0132\030.proto3.Ma"
+    "pOut.Map3Entry\022&\n\004map4\030\005 \003(\0132\030.proto3.Ma"
+    "pOut.Map4Entry\022\013\n\003bar\030\004 \001(\t\0329\n\tMap1Entry"
+    "\022\013\n\003key\030\001 \001(\t\022\033\n\005value\030\002 \001(\0132\014.proto3.Ma"
+    "pM:\0028\001\032;\n\tMap2Entry\022\013\n\003key\030\001 \001(\t\022\035\n\005valu"
+    "e\030\002 \001(\0132\016.proto3.MapOut:\0028\001\032+\n\tMap3Entry"
+    "\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\t:\0028\001\032+\n\tMap4"
+    "Entry\022\013\n\003key\030\001 \001(\010\022\r\n\005value\030\002 \001(\t:\0028\001\"\251\003"
+    "\n\020MapOutWireFormat\0220\n\004map1\030\001 \003(\0132\".proto"
+    "3.MapOutWireFormat.Map1Entry\0220\n\004map2\030\002 \003"
+    "(\0132\".proto3.MapOutWireFormat.Map2Entry\0220"
+    "\n\004map3\030\003 \003(\0132\".proto3.MapOutWireFormat.M"
+    "ap3Entry\0220\n\004map4\030\005 \003(\0132\".proto3.MapOutWi"
+    "reFormat.Map4Entry\022\013\n\003bar\030\004 \001(\t\0325\n\tMap1E"
+    "ntry\022\013\n\003key\030\001 \001(\t\022\033\n\005value\030\002 \001(\0132\014.proto"
+    "3.MapM\0327\n\tMap2Entry\022\013\n\003key\030\001 \001(\t\022\035\n\005valu"
+    "e\030\002 \001(\0132\016.proto3.MapOut\032\'\n\tMap3Entry\022\013\n\003"
+    "key\030\001 \001(\005\022\r\n\005value\030\002 \001(\t\032\'\n\tMap4Entry\022\013\n"
+    "\003key\030\001 \001(\010\022\r\n\005value\030\002 \001(\t\"\023\n\004MapM\022\013\n\003foo"
+    "\030\001 \001(\t*)\n\010EnumType\022\007\n\003FOO\020\000\022\007\n\003BAR\020\001\022\013\n\007"
+    "TLSv1_2\020\002B,\n\030com.google.protobuf.utilB\020J"
+    "sonFormatProto3b\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_deps[7] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fduration_2eproto,
+        &::descriptor_table_google_2fprotobuf_2ffield_5fmask_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+        &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+        &::descriptor_table_google_2fprotobuf_2funittest_2eproto,
+        &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto = {
+    false,
+    false,
+    7783,
+    descriptor_table_protodef_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto,
+    "google/protobuf/util/json_format_proto3.proto",
+    &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+    descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_deps,
+    7,
+    65,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto);
+namespace proto3 {
+const ::google::protobuf::EnumDescriptor* Mixed2_E_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t Mixed2_E_internal_data_[] = {
+    262144u, 0u, };
+bool Mixed2_E_IsValid(int value) {
+  return 0 <= value && value <= 3;
+}
+#if (__cplusplus < 201703) && \
+  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+constexpr Mixed2_E Mixed2::E0;
+constexpr Mixed2_E Mixed2::E1;
+constexpr Mixed2_E Mixed2::E2;
+constexpr Mixed2_E Mixed2::E3;
+constexpr Mixed2_E Mixed2::E_MIN;
+constexpr Mixed2_E Mixed2::E_MAX;
+constexpr int Mixed2::E_ARRAYSIZE;
+
+#endif  // (__cplusplus < 201703) &&
+        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::google::protobuf::EnumDescriptor* EnumType_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t EnumType_internal_data_[] = {
+    196608u, 0u, };
+bool EnumType_IsValid(int value) {
+  return 0 <= value && value <= 2;
+}
+// ===================================================================
+
+class MessageType::_Internal {
+ public:
+};
+
+MessageType::MessageType(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MessageType)
+}
+MessageType::MessageType(
+    ::google::protobuf::Arena* arena, const MessageType& from)
+    : MessageType(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE MessageType::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void MessageType::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+MessageType::~MessageType() {
+  // @@protoc_insertion_point(destructor:proto3.MessageType)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MessageType::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MessageType::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MessageType)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MessageType::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> MessageType::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MessageType_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // int32 value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(MessageType, _impl_.value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(MessageType, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 value = 1;
+    {PROTOBUF_FIELD_OFFSET(MessageType, _impl_.value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* MessageType::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MessageType)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  // int32 value = 1;
+  if (this->_internal_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MessageType)
+  return target;
+}
+
+::size_t MessageType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MessageType)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 value = 1;
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MessageType::_class_data_ = {
+    MessageType::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MessageType::GetClassData() const {
+  return &_class_data_;
+}
+
+void MessageType::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MessageType*>(&to_msg);
+  auto& from = static_cast<const MessageType&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MessageType)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MessageType::CopyFrom(const MessageType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MessageType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MessageType::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MessageType::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MessageType::InternalSwap(MessageType* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata MessageType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[0]);
+}
+// ===================================================================
+
+class TestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestMessage, _impl_._has_bits_);
+  static const ::proto3::MessageType& message_value(const TestMessage* msg);
+  static void set_has_message_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::proto3::MessageType& TestMessage::_Internal::message_value(const TestMessage* msg) {
+  return *msg->_impl_.message_value_;
+}
+TestMessage::TestMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_bool_value_{visibility, arena, from.repeated_bool_value_},
+        repeated_int32_value_{visibility, arena, from.repeated_int32_value_},
+        _repeated_int32_value_cached_byte_size_{0},
+        repeated_int64_value_{visibility, arena, from.repeated_int64_value_},
+        _repeated_int64_value_cached_byte_size_{0},
+        repeated_uint32_value_{visibility, arena, from.repeated_uint32_value_},
+        _repeated_uint32_value_cached_byte_size_{0},
+        repeated_uint64_value_{visibility, arena, from.repeated_uint64_value_},
+        _repeated_uint64_value_cached_byte_size_{0},
+        repeated_float_value_{visibility, arena, from.repeated_float_value_},
+        repeated_double_value_{visibility, arena, from.repeated_double_value_},
+        repeated_string_value_{visibility, arena, from.repeated_string_value_},
+        repeated_bytes_value_{visibility, arena, from.repeated_bytes_value_},
+        repeated_enum_value_{visibility, arena, from.repeated_enum_value_},
+        _repeated_enum_value_cached_byte_size_{0},
+        repeated_message_value_{visibility, arena, from.repeated_message_value_},
+        string_value_(arena, from.string_value_),
+        bytes_value_(arena, from.bytes_value_) {}
+
+TestMessage::TestMessage(
+    ::google::protobuf::Arena* arena,
+    const TestMessage& from)
+    : ::google::protobuf::Message(arena) {
+  TestMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.message_value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::proto3::MessageType>(arena, *from._impl_.message_value_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, bool_value_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, bool_value_),
+           offsetof(Impl_, enum_value_) -
+               offsetof(Impl_, bool_value_) +
+               sizeof(Impl_::enum_value_));
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_bool_value_{visibility, arena},
+        repeated_int32_value_{visibility, arena},
+        _repeated_int32_value_cached_byte_size_{0},
+        repeated_int64_value_{visibility, arena},
+        _repeated_int64_value_cached_byte_size_{0},
+        repeated_uint32_value_{visibility, arena},
+        _repeated_uint32_value_cached_byte_size_{0},
+        repeated_uint64_value_{visibility, arena},
+        _repeated_uint64_value_cached_byte_size_{0},
+        repeated_float_value_{visibility, arena},
+        repeated_double_value_{visibility, arena},
+        repeated_string_value_{visibility, arena},
+        repeated_bytes_value_{visibility, arena},
+        repeated_enum_value_{visibility, arena},
+        _repeated_enum_value_cached_byte_size_{0},
+        repeated_message_value_{visibility, arena},
+        string_value_(arena),
+        bytes_value_(arena) {}
+
+inline void TestMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, message_value_),
+           0,
+           offsetof(Impl_, enum_value_) -
+               offsetof(Impl_, message_value_) +
+               sizeof(Impl_::enum_value_));
+}
+TestMessage::~TestMessage() {
+  // @@protoc_insertion_point(destructor:proto3.TestMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.string_value_.Destroy();
+  _impl_.bytes_value_.Destroy();
+  delete _impl_.message_value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_bool_value_.Clear();
+  _impl_.repeated_int32_value_.Clear();
+  _impl_.repeated_int64_value_.Clear();
+  _impl_.repeated_uint32_value_.Clear();
+  _impl_.repeated_uint64_value_.Clear();
+  _impl_.repeated_float_value_.Clear();
+  _impl_.repeated_double_value_.Clear();
+  _impl_.repeated_string_value_.Clear();
+  _impl_.repeated_bytes_value_.Clear();
+  _impl_.repeated_enum_value_.Clear();
+  _impl_.repeated_message_value_.Clear();
+  _impl_.string_value_.ClearToEmpty();
+  _impl_.bytes_value_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.message_value_ != nullptr);
+    _impl_.message_value_->Clear();
+  }
+  ::memset(&_impl_.bool_value_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.enum_value_) -
+      reinterpret_cast<char*>(&_impl_.bool_value_)) + sizeof(_impl_.enum_value_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<5, 22, 2, 76, 2> TestMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    31, 248,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    2148530176,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    22,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // bool bool_value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestMessage, _impl_.bool_value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.bool_value_)}},
+    // int32 int32_value = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestMessage, _impl_.int32_value_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.int32_value_)}},
+    // int64 int64_value = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TestMessage, _impl_.int64_value_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.int64_value_)}},
+    // uint32 uint32_value = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestMessage, _impl_.uint32_value_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.uint32_value_)}},
+    // uint64 uint64_value = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TestMessage, _impl_.uint64_value_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.uint64_value_)}},
+    // float float_value = 6;
+    {::_pbi::TcParser::FastF32S1,
+     {53, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.float_value_)}},
+    // double double_value = 7;
+    {::_pbi::TcParser::FastF64S1,
+     {57, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.double_value_)}},
+    // string string_value = 8;
+    {::_pbi::TcParser::FastUS1,
+     {66, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.string_value_)}},
+    // bytes bytes_value = 9;
+    {::_pbi::TcParser::FastBS1,
+     {74, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.bytes_value_)}},
+    // .proto3.EnumType enum_value = 10;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestMessage, _impl_.enum_value_), 63>(),
+     {80, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.enum_value_)}},
+    // .proto3.MessageType message_value = 11;
+    {::_pbi::TcParser::FastMtS1,
+     {90, 0, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.message_value_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    // repeated bool repeated_bool_value = 21;
+    {::_pbi::TcParser::FastV8P2,
+     {426, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_bool_value_)}},
+    // repeated int32 repeated_int32_value = 22;
+    {::_pbi::TcParser::FastV32P2,
+     {434, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_int32_value_)}},
+    // repeated int64 repeated_int64_value = 23;
+    {::_pbi::TcParser::FastV64P2,
+     {442, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_int64_value_)}},
+    // repeated uint32 repeated_uint32_value = 24;
+    {::_pbi::TcParser::FastV32P2,
+     {450, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_uint32_value_)}},
+    // repeated uint64 repeated_uint64_value = 25;
+    {::_pbi::TcParser::FastV64P2,
+     {458, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_uint64_value_)}},
+    // repeated float repeated_float_value = 26;
+    {::_pbi::TcParser::FastF32P2,
+     {466, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_float_value_)}},
+    // repeated double repeated_double_value = 27;
+    {::_pbi::TcParser::FastF64P2,
+     {474, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_double_value_)}},
+    // repeated string repeated_string_value = 28;
+    {::_pbi::TcParser::FastUR2,
+     {482, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_string_value_)}},
+    // repeated bytes repeated_bytes_value = 29;
+    {::_pbi::TcParser::FastBR2,
+     {490, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_bytes_value_)}},
+    // repeated .proto3.EnumType repeated_enum_value = 30;
+    {::_pbi::TcParser::FastV32P2,
+     {498, 63, 0, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_enum_value_)}},
+    // repeated .proto3.MessageType repeated_message_value = 31;
+    {::_pbi::TcParser::FastMtR2,
+     {506, 63, 1, PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_message_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool bool_value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.bool_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 int32_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.int32_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int64 int64_value = 3;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.int64_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // uint32 uint32_value = 4;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.uint32_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
+    // uint64 uint64_value = 5;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.uint64_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // float float_value = 6;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.float_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // double double_value = 7;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.double_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
+    // string string_value = 8;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.string_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // bytes bytes_value = 9;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.bytes_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBytes | ::_fl::kRepAString)},
+    // .proto3.EnumType enum_value = 10;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.enum_value_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // .proto3.MessageType message_value = 11;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.message_value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated bool repeated_bool_value = 21;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_bool_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedBool)},
+    // repeated int32 repeated_int32_value = 22;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_int32_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedInt32)},
+    // repeated int64 repeated_int64_value = 23;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_int64_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedInt64)},
+    // repeated uint32 repeated_uint32_value = 24;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_uint32_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedUInt32)},
+    // repeated uint64 repeated_uint64_value = 25;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_uint64_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedUInt64)},
+    // repeated float repeated_float_value = 26;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_float_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedFloat)},
+    // repeated double repeated_double_value = 27;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_double_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedDouble)},
+    // repeated string repeated_string_value = 28;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_string_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
+    // repeated bytes repeated_bytes_value = 29;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_bytes_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kBytes | ::_fl::kRepSString)},
+    // repeated .proto3.EnumType repeated_enum_value = 30;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_enum_value_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+    // repeated .proto3.MessageType repeated_message_value = 31;
+    {PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.repeated_message_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3::MessageType>()},
+    {::_pbi::TcParser::GetTable<::proto3::MessageType>()},
+  }}, {{
+    "\22\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\25\0\0\0\0"
+    "proto3.TestMessage"
+    "string_value"
+    "repeated_string_value"
+  }},
+};
+
+::uint8_t* TestMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // bool bool_value = 1;
+  if (this->_internal_bool_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_bool_value(), target);
+  }
+
+  // int32 int32_value = 2;
+  if (this->_internal_int32_value() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_int32_value(), target);
+  }
+
+  // int64 int64_value = 3;
+  if (this->_internal_int64_value() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt64ToArrayWithField<3>(
+            stream, this->_internal_int64_value(), target);
+  }
+
+  // uint32 uint32_value = 4;
+  if (this->_internal_uint32_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        4, this->_internal_uint32_value(), target);
+  }
+
+  // uint64 uint64_value = 5;
+  if (this->_internal_uint64_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        5, this->_internal_uint64_value(), target);
+  }
+
+  // float float_value = 6;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_float_value = this->_internal_float_value();
+  ::uint32_t raw_float_value;
+  memcpy(&raw_float_value, &tmp_float_value, sizeof(tmp_float_value));
+  if (raw_float_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        6, this->_internal_float_value(), target);
+  }
+
+  // double double_value = 7;
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_double_value = this->_internal_double_value();
+  ::uint64_t raw_double_value;
+  memcpy(&raw_double_value, &tmp_double_value, sizeof(tmp_double_value));
+  if (raw_double_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
+        7, this->_internal_double_value(), target);
+  }
+
+  // string string_value = 8;
+  if (!this->_internal_string_value().empty()) {
+    const std::string& _s = this->_internal_string_value();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestMessage.string_value");
+    target = stream->WriteStringMaybeAliased(8, _s, target);
+  }
+
+  // bytes bytes_value = 9;
+  if (!this->_internal_bytes_value().empty()) {
+    const std::string& _s = this->_internal_bytes_value();
+    target = stream->WriteBytesMaybeAliased(9, _s, target);
+  }
+
+  // .proto3.EnumType enum_value = 10;
+  if (this->_internal_enum_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        10, this->_internal_enum_value(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .proto3.MessageType message_value = 11;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        11, _Internal::message_value(this),
+        _Internal::message_value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated bool repeated_bool_value = 21;
+  if (this->_internal_repeated_bool_value_size() > 0) {
+    target = stream->WriteFixedPacked(21, _internal_repeated_bool_value(), target);
+  }
+
+  // repeated int32 repeated_int32_value = 22;
+  {
+    int byte_size = _impl_._repeated_int32_value_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          22, _internal_repeated_int32_value(), byte_size, target);
+    }
+  }
+
+  // repeated int64 repeated_int64_value = 23;
+  {
+    int byte_size = _impl_._repeated_int64_value_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          23, _internal_repeated_int64_value(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 repeated_uint32_value = 24;
+  {
+    int byte_size = _impl_._repeated_uint32_value_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          24, _internal_repeated_uint32_value(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 repeated_uint64_value = 25;
+  {
+    int byte_size = _impl_._repeated_uint64_value_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          25, _internal_repeated_uint64_value(), byte_size, target);
+    }
+  }
+
+  // repeated float repeated_float_value = 26;
+  if (this->_internal_repeated_float_value_size() > 0) {
+    target = stream->WriteFixedPacked(26, _internal_repeated_float_value(), target);
+  }
+
+  // repeated double repeated_double_value = 27;
+  if (this->_internal_repeated_double_value_size() > 0) {
+    target = stream->WriteFixedPacked(27, _internal_repeated_double_value(), target);
+  }
+
+  // repeated string repeated_string_value = 28;
+  for (int i = 0, n = this->_internal_repeated_string_value_size(); i < n; ++i) {
+    const auto& s = this->_internal_repeated_string_value().Get(i);
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestMessage.repeated_string_value");
+    target = stream->WriteString(28, s, target);
+  }
+
+  // repeated bytes repeated_bytes_value = 29;
+  for (int i = 0, n = this->_internal_repeated_bytes_value_size(); i < n; ++i) {
+    const auto& s = this->_internal_repeated_bytes_value().Get(i);
+    target = stream->WriteBytes(29, s, target);
+  }
+
+  // repeated .proto3.EnumType repeated_enum_value = 30;
+  {
+    std::size_t byte_size = _impl_._repeated_enum_value_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(30, _internal_repeated_enum_value(),
+                                       byte_size, target);
+    }
+  }
+
+  // repeated .proto3.MessageType repeated_message_value = 31;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_message_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_message_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(31, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestMessage)
+  return target;
+}
+
+::size_t TestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bool repeated_bool_value = 21;
+  {
+    std::size_t data_size = std::size_t{1} *
+        ::_pbi::FromIntSize(this->_internal_repeated_bool_value_size())
+    ;
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated int32 repeated_int32_value = 22;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_repeated_int32_value())
+    ;
+    _impl_._repeated_int32_value_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated int64 repeated_int64_value = 23;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int64Size(
+        this->_internal_repeated_int64_value())
+    ;
+    _impl_._repeated_int64_value_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated uint32 repeated_uint32_value = 24;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_repeated_uint32_value())
+    ;
+    _impl_._repeated_uint32_value_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated uint64 repeated_uint64_value = 25;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_repeated_uint64_value())
+    ;
+    _impl_._repeated_uint64_value_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated float repeated_float_value = 26;
+  {
+    std::size_t data_size = std::size_t{4} *
+        ::_pbi::FromIntSize(this->_internal_repeated_float_value_size())
+    ;
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated double repeated_double_value = 27;
+  {
+    std::size_t data_size = std::size_t{8} *
+        ::_pbi::FromIntSize(this->_internal_repeated_double_value_size())
+    ;
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 2 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated string repeated_string_value = 28;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_repeated_string_value().size());
+  for (int i = 0, n = _internal_repeated_string_value().size(); i < n; ++i) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+        _internal_repeated_string_value().Get(i));
+  }
+  // repeated bytes repeated_bytes_value = 29;
+  total_size += 2 * ::google::protobuf::internal::FromIntSize(_internal_repeated_bytes_value().size());
+  for (int i = 0, n = _internal_repeated_bytes_value().size(); i < n; ++i) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+        _internal_repeated_bytes_value().Get(i));
+  }
+  // repeated .proto3.EnumType repeated_enum_value = 30;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_enum_value_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_enum_value().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 2;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_enum_value_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // repeated .proto3.MessageType repeated_message_value = 31;
+  total_size += 2UL * this->_internal_repeated_message_value_size();
+  for (const auto& msg : this->_internal_repeated_message_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // string string_value = 8;
+  if (!this->_internal_string_value().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_string_value());
+  }
+
+  // bytes bytes_value = 9;
+  if (!this->_internal_bytes_value().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
+                                    this->_internal_bytes_value());
+  }
+
+  // .proto3.MessageType message_value = 11;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.message_value_);
+  }
+
+  // bool bool_value = 1;
+  if (this->_internal_bool_value() != 0) {
+    total_size += 2;
+  }
+
+  // int32 int32_value = 2;
+  if (this->_internal_int32_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_int32_value());
+  }
+
+  // int64 int64_value = 3;
+  if (this->_internal_int64_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+        this->_internal_int64_value());
+  }
+
+  // uint64 uint64_value = 5;
+  if (this->_internal_uint64_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_uint64_value());
+  }
+
+  // uint32 uint32_value = 4;
+  if (this->_internal_uint32_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+        this->_internal_uint32_value());
+  }
+
+  // float float_value = 6;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_float_value = this->_internal_float_value();
+  ::uint32_t raw_float_value;
+  memcpy(&raw_float_value, &tmp_float_value, sizeof(tmp_float_value));
+  if (raw_float_value != 0) {
+    total_size += 5;
+  }
+
+  // double double_value = 7;
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_double_value = this->_internal_double_value();
+  ::uint64_t raw_double_value;
+  memcpy(&raw_double_value, &tmp_double_value, sizeof(tmp_double_value));
+  if (raw_double_value != 0) {
+    total_size += 9;
+  }
+
+  // .proto3.EnumType enum_value = 10;
+  if (this->_internal_enum_value() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMessage::_class_data_ = {
+    TestMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMessage*>(&to_msg);
+  auto& from = static_cast<const TestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_bool_value()->MergeFrom(from._internal_repeated_bool_value());
+  _this->_internal_mutable_repeated_int32_value()->MergeFrom(from._internal_repeated_int32_value());
+  _this->_internal_mutable_repeated_int64_value()->MergeFrom(from._internal_repeated_int64_value());
+  _this->_internal_mutable_repeated_uint32_value()->MergeFrom(from._internal_repeated_uint32_value());
+  _this->_internal_mutable_repeated_uint64_value()->MergeFrom(from._internal_repeated_uint64_value());
+  _this->_internal_mutable_repeated_float_value()->MergeFrom(from._internal_repeated_float_value());
+  _this->_internal_mutable_repeated_double_value()->MergeFrom(from._internal_repeated_double_value());
+  _this->_internal_mutable_repeated_string_value()->MergeFrom(from._internal_repeated_string_value());
+  _this->_internal_mutable_repeated_bytes_value()->MergeFrom(from._internal_repeated_bytes_value());
+  _this->_internal_mutable_repeated_enum_value()->MergeFrom(from._internal_repeated_enum_value());
+  _this->_internal_mutable_repeated_message_value()->MergeFrom(
+      from._internal_repeated_message_value());
+  if (!from._internal_string_value().empty()) {
+    _this->_internal_set_string_value(from._internal_string_value());
+  }
+  if (!from._internal_bytes_value().empty()) {
+    _this->_internal_set_bytes_value(from._internal_bytes_value());
+  }
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_message_value()->::proto3::MessageType::MergeFrom(
+        from._internal_message_value());
+  }
+  if (from._internal_bool_value() != 0) {
+    _this->_internal_set_bool_value(from._internal_bool_value());
+  }
+  if (from._internal_int32_value() != 0) {
+    _this->_internal_set_int32_value(from._internal_int32_value());
+  }
+  if (from._internal_int64_value() != 0) {
+    _this->_internal_set_int64_value(from._internal_int64_value());
+  }
+  if (from._internal_uint64_value() != 0) {
+    _this->_internal_set_uint64_value(from._internal_uint64_value());
+  }
+  if (from._internal_uint32_value() != 0) {
+    _this->_internal_set_uint32_value(from._internal_uint32_value());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_float_value = from._internal_float_value();
+  ::uint32_t raw_float_value;
+  memcpy(&raw_float_value, &tmp_float_value, sizeof(tmp_float_value));
+  if (raw_float_value != 0) {
+    _this->_internal_set_float_value(from._internal_float_value());
+  }
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_double_value = from._internal_double_value();
+  ::uint64_t raw_double_value;
+  memcpy(&raw_double_value, &tmp_double_value, sizeof(tmp_double_value));
+  if (raw_double_value != 0) {
+    _this->_internal_set_double_value(from._internal_double_value());
+  }
+  if (from._internal_enum_value() != 0) {
+    _this->_internal_set_enum_value(from._internal_enum_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessage::CopyFrom(const TestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMessage::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMessage::InternalSwap(TestMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_bool_value_.InternalSwap(&other->_impl_.repeated_bool_value_);
+  _impl_.repeated_int32_value_.InternalSwap(&other->_impl_.repeated_int32_value_);
+  _impl_.repeated_int64_value_.InternalSwap(&other->_impl_.repeated_int64_value_);
+  _impl_.repeated_uint32_value_.InternalSwap(&other->_impl_.repeated_uint32_value_);
+  _impl_.repeated_uint64_value_.InternalSwap(&other->_impl_.repeated_uint64_value_);
+  _impl_.repeated_float_value_.InternalSwap(&other->_impl_.repeated_float_value_);
+  _impl_.repeated_double_value_.InternalSwap(&other->_impl_.repeated_double_value_);
+  _impl_.repeated_string_value_.InternalSwap(&other->_impl_.repeated_string_value_);
+  _impl_.repeated_bytes_value_.InternalSwap(&other->_impl_.repeated_bytes_value_);
+  _impl_.repeated_enum_value_.InternalSwap(&other->_impl_.repeated_enum_value_);
+  _impl_.repeated_message_value_.InternalSwap(&other->_impl_.repeated_message_value_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.string_value_, &other->_impl_.string_value_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.bytes_value_, &other->_impl_.bytes_value_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.enum_value_)
+      + sizeof(TestMessage::_impl_.enum_value_)
+      - PROTOBUF_FIELD_OFFSET(TestMessage, _impl_.message_value_)>(
+          reinterpret_cast<char*>(&_impl_.message_value_),
+          reinterpret_cast<char*>(&other->_impl_.message_value_));
+}
+
+::google::protobuf::Metadata TestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[1]);
+}
+// ===================================================================
+
+class TestOneof::_Internal {
+ public:
+  static constexpr ::int32_t kOneofCaseOffset =
+    PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, _impl_._oneof_case_);
+  static const ::proto3::MessageType& oneof_message_value(const TestOneof* msg);
+};
+
+const ::proto3::MessageType& TestOneof::_Internal::oneof_message_value(const TestOneof* msg) {
+  return *msg->_impl_.oneof_value_.oneof_message_value_;
+}
+void TestOneof::set_allocated_oneof_message_value(::proto3::MessageType* oneof_message_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_oneof_value();
+  if (oneof_message_value) {
+    ::google::protobuf::Arena* submessage_arena = oneof_message_value->GetArena();
+    if (message_arena != submessage_arena) {
+      oneof_message_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, oneof_message_value, submessage_arena);
+    }
+    set_has_oneof_message_value();
+    _impl_.oneof_value_.oneof_message_value_ = oneof_message_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestOneof.oneof_message_value)
+}
+TestOneof::TestOneof(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestOneof)
+}
+inline PROTOBUF_NDEBUG_INLINE TestOneof::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : oneof_value_{},
+        _cached_size_{0},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+TestOneof::TestOneof(
+    ::google::protobuf::Arena* arena,
+    const TestOneof& from)
+    : ::google::protobuf::Message(arena) {
+  TestOneof* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  switch (oneof_value_case()) {
+    case ONEOF_VALUE_NOT_SET:
+      break;
+      case kOneofInt32Value:
+        _impl_.oneof_value_.oneof_int32_value_ = from._impl_.oneof_value_.oneof_int32_value_;
+        break;
+      case kOneofStringValue:
+        new (&_impl_.oneof_value_.oneof_string_value_) decltype(_impl_.oneof_value_.oneof_string_value_){arena, from._impl_.oneof_value_.oneof_string_value_};
+        break;
+      case kOneofBytesValue:
+        new (&_impl_.oneof_value_.oneof_bytes_value_) decltype(_impl_.oneof_value_.oneof_bytes_value_){arena, from._impl_.oneof_value_.oneof_bytes_value_};
+        break;
+      case kOneofEnumValue:
+        _impl_.oneof_value_.oneof_enum_value_ = from._impl_.oneof_value_.oneof_enum_value_;
+        break;
+      case kOneofMessageValue:
+        _impl_.oneof_value_.oneof_message_value_ = CreateMaybeMessage<::proto3::MessageType>(arena, *from._impl_.oneof_value_.oneof_message_value_);
+        break;
+      case kOneofNullValue:
+        _impl_.oneof_value_.oneof_null_value_ = from._impl_.oneof_value_.oneof_null_value_;
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestOneof)
+}
+inline PROTOBUF_NDEBUG_INLINE TestOneof::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : oneof_value_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+inline void TestOneof::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestOneof::~TestOneof() {
+  // @@protoc_insertion_point(destructor:proto3.TestOneof)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestOneof::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  if (has_oneof_value()) {
+    clear_oneof_value();
+  }
+  _impl_.~Impl_();
+}
+
+void TestOneof::clear_oneof_value() {
+// @@protoc_insertion_point(one_of_clear_start:proto3.TestOneof)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  switch (oneof_value_case()) {
+    case kOneofInt32Value: {
+      // No need to clear
+      break;
+    }
+    case kOneofStringValue: {
+      _impl_.oneof_value_.oneof_string_value_.Destroy();
+      break;
+    }
+    case kOneofBytesValue: {
+      _impl_.oneof_value_.oneof_bytes_value_.Destroy();
+      break;
+    }
+    case kOneofEnumValue: {
+      // No need to clear
+      break;
+    }
+    case kOneofMessageValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.oneof_value_.oneof_message_value_;
+      }
+      break;
+    }
+    case kOneofNullValue: {
+      // No need to clear
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = ONEOF_VALUE_NOT_SET;
+}
+
+
+PROTOBUF_NOINLINE void TestOneof::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestOneof)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_oneof_value();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestOneof::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 6, 1, 43, 2> TestOneof::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    6, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestOneof_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 oneof_int32_value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestOneof, _impl_.oneof_value_.oneof_int32_value_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kInt32)},
+    // string oneof_string_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestOneof, _impl_.oneof_value_.oneof_string_value_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // bytes oneof_bytes_value = 3;
+    {PROTOBUF_FIELD_OFFSET(TestOneof, _impl_.oneof_value_.oneof_bytes_value_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kBytes | ::_fl::kRepAString)},
+    // .proto3.EnumType oneof_enum_value = 4;
+    {PROTOBUF_FIELD_OFFSET(TestOneof, _impl_.oneof_value_.oneof_enum_value_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+    // .proto3.MessageType oneof_message_value = 5;
+    {PROTOBUF_FIELD_OFFSET(TestOneof, _impl_.oneof_value_.oneof_message_value_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.NullValue oneof_null_value = 6;
+    {PROTOBUF_FIELD_OFFSET(TestOneof, _impl_.oneof_value_.oneof_null_value_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3::MessageType>()},
+  }}, {{
+    "\20\0\22\0\0\0\0\0"
+    "proto3.TestOneof"
+    "oneof_string_value"
+  }},
+};
+
+::uint8_t* TestOneof::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestOneof)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  switch (oneof_value_case()) {
+    case kOneofInt32Value: {
+      target = ::google::protobuf::internal::WireFormatLite::
+          WriteInt32ToArrayWithField<1>(
+              stream, this->_internal_oneof_int32_value(), target);
+      break;
+    }
+    case kOneofStringValue: {
+      const std::string& _s = this->_internal_oneof_string_value();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestOneof.oneof_string_value");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+      break;
+    }
+    case kOneofBytesValue: {
+      const std::string& _s = this->_internal_oneof_bytes_value();
+      target = stream->WriteBytesMaybeAliased(3, _s, target);
+      break;
+    }
+    case kOneofEnumValue: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          4, this->_internal_oneof_enum_value(), target);
+      break;
+    }
+    case kOneofMessageValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          5, _Internal::oneof_message_value(this),
+          _Internal::oneof_message_value(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kOneofNullValue: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          6, this->_internal_oneof_null_value(), target);
+      break;
+    }
+    default:
+      break;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestOneof)
+  return target;
+}
+
+::size_t TestOneof::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestOneof)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (oneof_value_case()) {
+    // int32 oneof_int32_value = 1;
+    case kOneofInt32Value: {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_oneof_int32_value());
+      break;
+    }
+    // string oneof_string_value = 2;
+    case kOneofStringValue: {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_oneof_string_value());
+      break;
+    }
+    // bytes oneof_bytes_value = 3;
+    case kOneofBytesValue: {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
+                                      this->_internal_oneof_bytes_value());
+      break;
+    }
+    // .proto3.EnumType oneof_enum_value = 4;
+    case kOneofEnumValue: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_enum_value());
+      break;
+    }
+    // .proto3.MessageType oneof_message_value = 5;
+    case kOneofMessageValue: {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.oneof_value_.oneof_message_value_);
+      break;
+    }
+    // .google.protobuf.NullValue oneof_null_value = 6;
+    case kOneofNullValue: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this->_internal_oneof_null_value());
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestOneof::_class_data_ = {
+    TestOneof::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestOneof::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestOneof::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestOneof*>(&to_msg);
+  auto& from = static_cast<const TestOneof&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestOneof)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.oneof_value_case()) {
+    case kOneofInt32Value: {
+      _this->_internal_set_oneof_int32_value(from._internal_oneof_int32_value());
+      break;
+    }
+    case kOneofStringValue: {
+      _this->_internal_set_oneof_string_value(from._internal_oneof_string_value());
+      break;
+    }
+    case kOneofBytesValue: {
+      _this->_internal_set_oneof_bytes_value(from._internal_oneof_bytes_value());
+      break;
+    }
+    case kOneofEnumValue: {
+      _this->_internal_set_oneof_enum_value(from._internal_oneof_enum_value());
+      break;
+    }
+    case kOneofMessageValue: {
+      _this->_internal_mutable_oneof_message_value()->::proto3::MessageType::MergeFrom(
+          from._internal_oneof_message_value());
+      break;
+    }
+    case kOneofNullValue: {
+      _this->_internal_set_oneof_null_value(from._internal_oneof_null_value());
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestOneof::CopyFrom(const TestOneof& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestOneof)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestOneof::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestOneof::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestOneof::InternalSwap(TestOneof* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.oneof_value_, other->_impl_.oneof_value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata TestOneof::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[2]);
+}
+// ===================================================================
+
+TestMap_BoolMapEntry_DoNotUse::TestMap_BoolMapEntry_DoNotUse() {}
+TestMap_BoolMapEntry_DoNotUse::TestMap_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[3]);
+}
+// ===================================================================
+
+TestMap_Int32MapEntry_DoNotUse::TestMap_Int32MapEntry_DoNotUse() {}
+TestMap_Int32MapEntry_DoNotUse::TestMap_Int32MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_Int32MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[4]);
+}
+// ===================================================================
+
+TestMap_Int64MapEntry_DoNotUse::TestMap_Int64MapEntry_DoNotUse() {}
+TestMap_Int64MapEntry_DoNotUse::TestMap_Int64MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_Int64MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[5]);
+}
+// ===================================================================
+
+TestMap_Uint32MapEntry_DoNotUse::TestMap_Uint32MapEntry_DoNotUse() {}
+TestMap_Uint32MapEntry_DoNotUse::TestMap_Uint32MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_Uint32MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[6]);
+}
+// ===================================================================
+
+TestMap_Uint64MapEntry_DoNotUse::TestMap_Uint64MapEntry_DoNotUse() {}
+TestMap_Uint64MapEntry_DoNotUse::TestMap_Uint64MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_Uint64MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[7]);
+}
+// ===================================================================
+
+TestMap_StringMapEntry_DoNotUse::TestMap_StringMapEntry_DoNotUse() {}
+TestMap_StringMapEntry_DoNotUse::TestMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[8]);
+}
+// ===================================================================
+
+class TestMap::_Internal {
+ public:
+};
+
+TestMap::TestMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : bool_map_{visibility, arena, from.bool_map_},
+        int32_map_{visibility, arena, from.int32_map_},
+        int64_map_{visibility, arena, from.int64_map_},
+        uint32_map_{visibility, arena, from.uint32_map_},
+        uint64_map_{visibility, arena, from.uint64_map_},
+        string_map_{visibility, arena, from.string_map_},
+        _cached_size_{0} {}
+
+TestMap::TestMap(
+    ::google::protobuf::Arena* arena,
+    const TestMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : bool_map_{visibility, arena},
+        int32_map_{visibility, arena},
+        int64_map_{visibility, arena},
+        uint32_map_{visibility, arena},
+        uint64_map_{visibility, arena},
+        string_map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestMap::~TestMap() {
+  // @@protoc_insertion_point(destructor:proto3.TestMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bool_map_.Clear();
+  _impl_.int32_map_.Clear();
+  _impl_.int64_map_.Clear();
+  _impl_.uint32_map_.Clear();
+  _impl_.uint64_map_.Clear();
+  _impl_.string_map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 6, 6, 33, 2> TestMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    6, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    6,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<bool, int32> bool_map = 1;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.bool_map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, int32> int32_map = 2;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.int32_map_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, int32> int64_map = 3;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.int64_map_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, int32> uint32_map = 4;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.uint32_map_), 0, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, int32> uint64_map = 5;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.uint64_map_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, int32> string_map = 6;
+    {PROTOBUF_FIELD_OFFSET(TestMap, _impl_.string_map_), 0, 5,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.bool_map_)>(
+        1, 0, 0, 8,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.int32_map_)>(
+        1, 0, 0, 5,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.int64_map_)>(
+        1, 0, 0, 3,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.uint32_map_)>(
+        1, 0, 0, 13,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.uint64_map_)>(
+        1, 0, 0, 4,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestMap()._impl_.string_map_)>(
+        1, 0, 0, 9,
+        5)},
+  }}, {{
+    "\16\0\0\0\0\0\12\0"
+    "proto3.TestMap"
+    "string_map"
+  }},
+};
+
+::uint8_t* TestMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  if (!_internal_bool_map().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_bool_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, int32> int32_map = 2;
+  if (!_internal_int32_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_int32_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, int32> int64_map = 3;
+  if (!_internal_int64_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_int64_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, int32> uint32_map = 4;
+  if (!_internal_uint32_map().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_uint32_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, int32> uint64_map = 5;
+  if (!_internal_uint64_map().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_uint64_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, int32> string_map = 6;
+  if (!_internal_string_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_string_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestMap.string_map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestMap.string_map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestMap)
+  return target;
+}
+
+::size_t TestMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_bool_map_size());
+  for (const auto& entry : _internal_bool_map()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, int32> int32_map = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_int32_map_size());
+  for (const auto& entry : _internal_int32_map()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, int32> int64_map = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_int64_map_size());
+  for (const auto& entry : _internal_int64_map()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, int32> uint32_map = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_uint32_map_size());
+  for (const auto& entry : _internal_uint32_map()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, int32> uint64_map = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_uint64_map_size());
+  for (const auto& entry : _internal_uint64_map()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, int32> string_map = 6;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_string_map_size());
+  for (const auto& entry : _internal_string_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestMap::_class_data_ = {
+    TestMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestMap*>(&to_msg);
+  auto& from = static_cast<const TestMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bool_map_.MergeFrom(from._impl_.bool_map_);
+  _this->_impl_.int32_map_.MergeFrom(from._impl_.int32_map_);
+  _this->_impl_.int64_map_.MergeFrom(from._impl_.int64_map_);
+  _this->_impl_.uint32_map_.MergeFrom(from._impl_.uint32_map_);
+  _this->_impl_.uint64_map_.MergeFrom(from._impl_.uint64_map_);
+  _this->_impl_.string_map_.MergeFrom(from._impl_.string_map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMap::CopyFrom(const TestMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestMap::InternalSwap(TestMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bool_map_.InternalSwap(&other->_impl_.bool_map_);
+  _impl_.int32_map_.InternalSwap(&other->_impl_.int32_map_);
+  _impl_.int64_map_.InternalSwap(&other->_impl_.int64_map_);
+  _impl_.uint32_map_.InternalSwap(&other->_impl_.uint32_map_);
+  _impl_.uint64_map_.InternalSwap(&other->_impl_.uint64_map_);
+  _impl_.string_map_.InternalSwap(&other->_impl_.string_map_);
+}
+
+::google::protobuf::Metadata TestMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[9]);
+}
+// ===================================================================
+
+TestNestedMap_BoolMapEntry_DoNotUse::TestNestedMap_BoolMapEntry_DoNotUse() {}
+TestNestedMap_BoolMapEntry_DoNotUse::TestNestedMap_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[10]);
+}
+// ===================================================================
+
+TestNestedMap_Int32MapEntry_DoNotUse::TestNestedMap_Int32MapEntry_DoNotUse() {}
+TestNestedMap_Int32MapEntry_DoNotUse::TestNestedMap_Int32MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_Int32MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[11]);
+}
+// ===================================================================
+
+TestNestedMap_Int64MapEntry_DoNotUse::TestNestedMap_Int64MapEntry_DoNotUse() {}
+TestNestedMap_Int64MapEntry_DoNotUse::TestNestedMap_Int64MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_Int64MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[12]);
+}
+// ===================================================================
+
+TestNestedMap_Uint32MapEntry_DoNotUse::TestNestedMap_Uint32MapEntry_DoNotUse() {}
+TestNestedMap_Uint32MapEntry_DoNotUse::TestNestedMap_Uint32MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_Uint32MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[13]);
+}
+// ===================================================================
+
+TestNestedMap_Uint64MapEntry_DoNotUse::TestNestedMap_Uint64MapEntry_DoNotUse() {}
+TestNestedMap_Uint64MapEntry_DoNotUse::TestNestedMap_Uint64MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_Uint64MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[14]);
+}
+// ===================================================================
+
+TestNestedMap_StringMapEntry_DoNotUse::TestNestedMap_StringMapEntry_DoNotUse() {}
+TestNestedMap_StringMapEntry_DoNotUse::TestNestedMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[15]);
+}
+// ===================================================================
+
+TestNestedMap_MapMapEntry_DoNotUse::TestNestedMap_MapMapEntry_DoNotUse() {}
+TestNestedMap_MapMapEntry_DoNotUse::TestNestedMap_MapMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestNestedMap_MapMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[16]);
+}
+// ===================================================================
+
+class TestNestedMap::_Internal {
+ public:
+};
+
+TestNestedMap::TestNestedMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestNestedMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestNestedMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : bool_map_{visibility, arena, from.bool_map_},
+        int32_map_{visibility, arena, from.int32_map_},
+        int64_map_{visibility, arena, from.int64_map_},
+        uint32_map_{visibility, arena, from.uint32_map_},
+        uint64_map_{visibility, arena, from.uint64_map_},
+        string_map_{visibility, arena, from.string_map_},
+        map_map_{visibility, arena, from.map_map_},
+        _cached_size_{0} {}
+
+TestNestedMap::TestNestedMap(
+    ::google::protobuf::Arena* arena,
+    const TestNestedMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestNestedMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestNestedMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestNestedMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : bool_map_{visibility, arena},
+        int32_map_{visibility, arena},
+        int64_map_{visibility, arena},
+        uint32_map_{visibility, arena},
+        uint64_map_{visibility, arena},
+        string_map_{visibility, arena},
+        map_map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestNestedMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestNestedMap::~TestNestedMap() {
+  // @@protoc_insertion_point(destructor:proto3.TestNestedMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestNestedMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestNestedMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestNestedMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bool_map_.Clear();
+  _impl_.int32_map_.Clear();
+  _impl_.int64_map_.Clear();
+  _impl_.uint32_map_.Clear();
+  _impl_.uint64_map_.Clear();
+  _impl_.string_map_.Clear();
+  _impl_.map_map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestNestedMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 7, 8, 46, 2> TestNestedMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    8,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestNestedMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<bool, int32> bool_map = 1;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.bool_map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, int32> int32_map = 2;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.int32_map_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int64, int32> int64_map = 3;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.int64_map_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint32, int32> uint32_map = 4;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.uint32_map_), 0, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<uint64, int32> uint64_map = 5;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.uint64_map_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, int32> string_map = 6;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.string_map_), 0, 5,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .proto3.TestNestedMap> map_map = 7;
+    {PROTOBUF_FIELD_OFFSET(TestNestedMap, _impl_.map_map_), 0, 6,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.bool_map_)>(
+        1, 0, 0, 8,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.int32_map_)>(
+        1, 0, 0, 5,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.int64_map_)>(
+        1, 0, 0, 3,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.uint32_map_)>(
+        1, 0, 0, 13,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.uint64_map_)>(
+        1, 0, 0, 4,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.string_map_)>(
+        1, 0, 0, 9,
+        5)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestNestedMap()._impl_.map_map_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::proto3::TestNestedMap>},
+  }}, {{
+    "\24\0\0\0\0\0\12\7"
+    "proto3.TestNestedMap"
+    "string_map"
+    "map_map"
+  }},
+};
+
+::uint8_t* TestNestedMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestNestedMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  if (!_internal_bool_map().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_bool_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, int32> int32_map = 2;
+  if (!_internal_int32_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_int32_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, int32> int64_map = 3;
+  if (!_internal_int64_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int64_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_int64_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, int32> uint32_map = 4;
+  if (!_internal_uint32_map().empty()) {
+    using MapType = ::google::protobuf::Map<::uint32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_uint32_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, int32> uint64_map = 5;
+  if (!_internal_uint64_map().empty()) {
+    using MapType = ::google::protobuf::Map<::uint64_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::uint64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_uint64_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<string, int32> string_map = 6;
+  if (!_internal_string_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_string_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestNestedMap.string_map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            6, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestNestedMap.string_map");
+      }
+    }
+  }
+
+  // map<string, .proto3.TestNestedMap> map_map = 7;
+  if (!_internal_map_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::proto3::TestNestedMap,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestNestedMap.map_map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            7, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestNestedMap.map_map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestNestedMap)
+  return target;
+}
+
+::size_t TestNestedMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestNestedMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_bool_map_size());
+  for (const auto& entry : _internal_bool_map()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, int32> int32_map = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_int32_map_size());
+  for (const auto& entry : _internal_int32_map()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int64, int32> int64_map = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_int64_map_size());
+  for (const auto& entry : _internal_int64_map()) {
+    total_size += _pbi::MapEntryFuncs<::int64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint32, int32> uint32_map = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_uint32_map_size());
+  for (const auto& entry : _internal_uint32_map()) {
+    total_size += _pbi::MapEntryFuncs<::uint32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<uint64, int32> uint64_map = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_uint64_map_size());
+  for (const auto& entry : _internal_uint64_map()) {
+    total_size += _pbi::MapEntryFuncs<::uint64_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_UINT64,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, int32> string_map = 6;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_string_map_size());
+  for (const auto& entry : _internal_string_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .proto3.TestNestedMap> map_map = 7;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_map_size());
+  for (const auto& entry : _internal_map_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::proto3::TestNestedMap,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestNestedMap::_class_data_ = {
+    TestNestedMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestNestedMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestNestedMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestNestedMap*>(&to_msg);
+  auto& from = static_cast<const TestNestedMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestNestedMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bool_map_.MergeFrom(from._impl_.bool_map_);
+  _this->_impl_.int32_map_.MergeFrom(from._impl_.int32_map_);
+  _this->_impl_.int64_map_.MergeFrom(from._impl_.int64_map_);
+  _this->_impl_.uint32_map_.MergeFrom(from._impl_.uint32_map_);
+  _this->_impl_.uint64_map_.MergeFrom(from._impl_.uint64_map_);
+  _this->_impl_.string_map_.MergeFrom(from._impl_.string_map_);
+  _this->_impl_.map_map_.MergeFrom(from._impl_.map_map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestNestedMap::CopyFrom(const TestNestedMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestNestedMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestNestedMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestNestedMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestNestedMap::InternalSwap(TestNestedMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bool_map_.InternalSwap(&other->_impl_.bool_map_);
+  _impl_.int32_map_.InternalSwap(&other->_impl_.int32_map_);
+  _impl_.int64_map_.InternalSwap(&other->_impl_.int64_map_);
+  _impl_.uint32_map_.InternalSwap(&other->_impl_.uint32_map_);
+  _impl_.uint64_map_.InternalSwap(&other->_impl_.uint64_map_);
+  _impl_.string_map_.InternalSwap(&other->_impl_.string_map_);
+  _impl_.map_map_.InternalSwap(&other->_impl_.map_map_);
+}
+
+::google::protobuf::Metadata TestNestedMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[17]);
+}
+// ===================================================================
+
+TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse() {}
+TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestStringMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[18]);
+}
+// ===================================================================
+
+class TestStringMap::_Internal {
+ public:
+};
+
+TestStringMap::TestStringMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestStringMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStringMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : string_map_{visibility, arena, from.string_map_},
+        _cached_size_{0} {}
+
+TestStringMap::TestStringMap(
+    ::google::protobuf::Arena* arena,
+    const TestStringMap& from)
+    : ::google::protobuf::Message(arena) {
+  TestStringMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestStringMap)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStringMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : string_map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestStringMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+TestStringMap::~TestStringMap() {
+  // @@protoc_insertion_point(destructor:proto3.TestStringMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestStringMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestStringMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestStringMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.string_map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestStringMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 39, 2> TestStringMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestStringMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, string> string_map = 1;
+    {PROTOBUF_FIELD_OFFSET(TestStringMap, _impl_.string_map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestStringMap()._impl_.string_map_)>(
+        1, 0, 0, 9,
+        9)},
+  }}, {{
+    "\24\12\0\0\0\0\0\0"
+    "proto3.TestStringMap"
+    "string_map"
+  }},
+};
+
+::uint8_t* TestStringMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestStringMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, string> string_map = 1;
+  if (!_internal_string_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_string_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestStringMap.string_map");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestStringMap.string_map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestStringMap.string_map");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.TestStringMap.string_map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestStringMap)
+  return target;
+}
+
+::size_t TestStringMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestStringMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> string_map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_string_map_size());
+  for (const auto& entry : _internal_string_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestStringMap::_class_data_ = {
+    TestStringMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestStringMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestStringMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestStringMap*>(&to_msg);
+  auto& from = static_cast<const TestStringMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestStringMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.string_map_.MergeFrom(from._impl_.string_map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestStringMap::CopyFrom(const TestStringMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestStringMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestStringMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestStringMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestStringMap::InternalSwap(TestStringMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.string_map_.InternalSwap(&other->_impl_.string_map_);
+}
+
+::google::protobuf::Metadata TestStringMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[19]);
+}
+// ===================================================================
+
+class TestWrapper::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestWrapper>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_._has_bits_);
+  static const ::google::protobuf::BoolValue& bool_value(const TestWrapper* msg);
+  static void set_has_bool_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::google::protobuf::Int32Value& int32_value(const TestWrapper* msg);
+  static void set_has_int32_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::google::protobuf::Int64Value& int64_value(const TestWrapper* msg);
+  static void set_has_int64_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::google::protobuf::UInt32Value& uint32_value(const TestWrapper* msg);
+  static void set_has_uint32_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::google::protobuf::UInt64Value& uint64_value(const TestWrapper* msg);
+  static void set_has_uint64_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::google::protobuf::FloatValue& float_value(const TestWrapper* msg);
+  static void set_has_float_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::google::protobuf::DoubleValue& double_value(const TestWrapper* msg);
+  static void set_has_double_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::google::protobuf::StringValue& string_value(const TestWrapper* msg);
+  static void set_has_string_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::google::protobuf::BytesValue& bytes_value(const TestWrapper* msg);
+  static void set_has_bytes_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+};
+
+const ::google::protobuf::BoolValue& TestWrapper::_Internal::bool_value(const TestWrapper* msg) {
+  return *msg->_impl_.bool_value_;
+}
+const ::google::protobuf::Int32Value& TestWrapper::_Internal::int32_value(const TestWrapper* msg) {
+  return *msg->_impl_.int32_value_;
+}
+const ::google::protobuf::Int64Value& TestWrapper::_Internal::int64_value(const TestWrapper* msg) {
+  return *msg->_impl_.int64_value_;
+}
+const ::google::protobuf::UInt32Value& TestWrapper::_Internal::uint32_value(const TestWrapper* msg) {
+  return *msg->_impl_.uint32_value_;
+}
+const ::google::protobuf::UInt64Value& TestWrapper::_Internal::uint64_value(const TestWrapper* msg) {
+  return *msg->_impl_.uint64_value_;
+}
+const ::google::protobuf::FloatValue& TestWrapper::_Internal::float_value(const TestWrapper* msg) {
+  return *msg->_impl_.float_value_;
+}
+const ::google::protobuf::DoubleValue& TestWrapper::_Internal::double_value(const TestWrapper* msg) {
+  return *msg->_impl_.double_value_;
+}
+const ::google::protobuf::StringValue& TestWrapper::_Internal::string_value(const TestWrapper* msg) {
+  return *msg->_impl_.string_value_;
+}
+const ::google::protobuf::BytesValue& TestWrapper::_Internal::bytes_value(const TestWrapper* msg) {
+  return *msg->_impl_.bytes_value_;
+}
+void TestWrapper::clear_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.bool_value_ != nullptr) _impl_.bool_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestWrapper::clear_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.int32_value_ != nullptr) _impl_.int32_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+void TestWrapper::clear_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.int64_value_ != nullptr) _impl_.int64_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+void TestWrapper::clear_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.uint32_value_ != nullptr) _impl_.uint32_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+void TestWrapper::clear_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.uint64_value_ != nullptr) _impl_.uint64_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+void TestWrapper::clear_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.float_value_ != nullptr) _impl_.float_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+void TestWrapper::clear_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.double_value_ != nullptr) _impl_.double_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+void TestWrapper::clear_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.string_value_ != nullptr) _impl_.string_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+void TestWrapper::clear_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.bytes_value_ != nullptr) _impl_.bytes_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+void TestWrapper::clear_repeated_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bool_value_.Clear();
+}
+void TestWrapper::clear_repeated_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_value_.Clear();
+}
+void TestWrapper::clear_repeated_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int64_value_.Clear();
+}
+void TestWrapper::clear_repeated_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint32_value_.Clear();
+}
+void TestWrapper::clear_repeated_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint64_value_.Clear();
+}
+void TestWrapper::clear_repeated_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_float_value_.Clear();
+}
+void TestWrapper::clear_repeated_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_double_value_.Clear();
+}
+void TestWrapper::clear_repeated_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_value_.Clear();
+}
+void TestWrapper::clear_repeated_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bytes_value_.Clear();
+}
+TestWrapper::TestWrapper(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestWrapper)
+}
+inline PROTOBUF_NDEBUG_INLINE TestWrapper::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_bool_value_{visibility, arena, from.repeated_bool_value_},
+        repeated_int32_value_{visibility, arena, from.repeated_int32_value_},
+        repeated_int64_value_{visibility, arena, from.repeated_int64_value_},
+        repeated_uint32_value_{visibility, arena, from.repeated_uint32_value_},
+        repeated_uint64_value_{visibility, arena, from.repeated_uint64_value_},
+        repeated_float_value_{visibility, arena, from.repeated_float_value_},
+        repeated_double_value_{visibility, arena, from.repeated_double_value_},
+        repeated_string_value_{visibility, arena, from.repeated_string_value_},
+        repeated_bytes_value_{visibility, arena, from.repeated_bytes_value_} {}
+
+TestWrapper::TestWrapper(
+    ::google::protobuf::Arena* arena,
+    const TestWrapper& from)
+    : ::google::protobuf::Message(arena) {
+  TestWrapper* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.bool_value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::BoolValue>(arena, *from._impl_.bool_value_)
+                : nullptr;
+  _impl_.int32_value_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::google::protobuf::Int32Value>(arena, *from._impl_.int32_value_)
+                : nullptr;
+  _impl_.int64_value_ = (cached_has_bits & 0x00000004u)
+                ? CreateMaybeMessage<::google::protobuf::Int64Value>(arena, *from._impl_.int64_value_)
+                : nullptr;
+  _impl_.uint32_value_ = (cached_has_bits & 0x00000008u)
+                ? CreateMaybeMessage<::google::protobuf::UInt32Value>(arena, *from._impl_.uint32_value_)
+                : nullptr;
+  _impl_.uint64_value_ = (cached_has_bits & 0x00000010u)
+                ? CreateMaybeMessage<::google::protobuf::UInt64Value>(arena, *from._impl_.uint64_value_)
+                : nullptr;
+  _impl_.float_value_ = (cached_has_bits & 0x00000020u)
+                ? CreateMaybeMessage<::google::protobuf::FloatValue>(arena, *from._impl_.float_value_)
+                : nullptr;
+  _impl_.double_value_ = (cached_has_bits & 0x00000040u)
+                ? CreateMaybeMessage<::google::protobuf::DoubleValue>(arena, *from._impl_.double_value_)
+                : nullptr;
+  _impl_.string_value_ = (cached_has_bits & 0x00000080u)
+                ? CreateMaybeMessage<::google::protobuf::StringValue>(arena, *from._impl_.string_value_)
+                : nullptr;
+  _impl_.bytes_value_ = (cached_has_bits & 0x00000100u)
+                ? CreateMaybeMessage<::google::protobuf::BytesValue>(arena, *from._impl_.bytes_value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestWrapper)
+}
+inline PROTOBUF_NDEBUG_INLINE TestWrapper::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_bool_value_{visibility, arena},
+        repeated_int32_value_{visibility, arena},
+        repeated_int64_value_{visibility, arena},
+        repeated_uint32_value_{visibility, arena},
+        repeated_uint64_value_{visibility, arena},
+        repeated_float_value_{visibility, arena},
+        repeated_double_value_{visibility, arena},
+        repeated_string_value_{visibility, arena},
+        repeated_bytes_value_{visibility, arena} {}
+
+inline void TestWrapper::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, bool_value_),
+           0,
+           offsetof(Impl_, bytes_value_) -
+               offsetof(Impl_, bool_value_) +
+               sizeof(Impl_::bytes_value_));
+}
+TestWrapper::~TestWrapper() {
+  // @@protoc_insertion_point(destructor:proto3.TestWrapper)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestWrapper::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.bool_value_;
+  delete _impl_.int32_value_;
+  delete _impl_.int64_value_;
+  delete _impl_.uint32_value_;
+  delete _impl_.uint64_value_;
+  delete _impl_.float_value_;
+  delete _impl_.double_value_;
+  delete _impl_.string_value_;
+  delete _impl_.bytes_value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestWrapper)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_bool_value_.Clear();
+  _impl_.repeated_int32_value_.Clear();
+  _impl_.repeated_int64_value_.Clear();
+  _impl_.repeated_uint32_value_.Clear();
+  _impl_.repeated_uint64_value_.Clear();
+  _impl_.repeated_float_value_.Clear();
+  _impl_.repeated_double_value_.Clear();
+  _impl_.repeated_string_value_.Clear();
+  _impl_.repeated_bytes_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.bool_value_ != nullptr);
+      _impl_.bool_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.int32_value_ != nullptr);
+      _impl_.int32_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      ABSL_DCHECK(_impl_.int64_value_ != nullptr);
+      _impl_.int64_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      ABSL_DCHECK(_impl_.uint32_value_ != nullptr);
+      _impl_.uint32_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      ABSL_DCHECK(_impl_.uint64_value_ != nullptr);
+      _impl_.uint64_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      ABSL_DCHECK(_impl_.float_value_ != nullptr);
+      _impl_.float_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      ABSL_DCHECK(_impl_.double_value_ != nullptr);
+      _impl_.double_value_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      ABSL_DCHECK(_impl_.string_value_ != nullptr);
+      _impl_.string_value_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    ABSL_DCHECK(_impl_.bytes_value_ != nullptr);
+    _impl_.bytes_value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestWrapper::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<5, 18, 18, 0, 2> TestWrapper::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_._has_bits_),
+    0, // no _extensions_
+    19, 248,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294443520,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    18,  // num_field_entries
+    18,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestWrapper_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .google.protobuf.BoolValue bool_value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.bool_value_)}},
+    // .google.protobuf.Int32Value int32_value = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.int32_value_)}},
+    // .google.protobuf.Int64Value int64_value = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 2, 2, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.int64_value_)}},
+    // .google.protobuf.UInt32Value uint32_value = 4;
+    {::_pbi::TcParser::FastMtS1,
+     {34, 3, 3, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.uint32_value_)}},
+    // .google.protobuf.UInt64Value uint64_value = 5;
+    {::_pbi::TcParser::FastMtS1,
+     {42, 4, 4, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.uint64_value_)}},
+    // .google.protobuf.FloatValue float_value = 6;
+    {::_pbi::TcParser::FastMtS1,
+     {50, 5, 5, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.float_value_)}},
+    // .google.protobuf.DoubleValue double_value = 7;
+    {::_pbi::TcParser::FastMtS1,
+     {58, 6, 6, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.double_value_)}},
+    // .google.protobuf.StringValue string_value = 8;
+    {::_pbi::TcParser::FastMtS1,
+     {66, 7, 7, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.string_value_)}},
+    // .google.protobuf.BytesValue bytes_value = 9;
+    {::_pbi::TcParser::FastMtS1,
+     {74, 8, 8, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.bytes_value_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+    {::_pbi::TcParser::FastMtR1,
+     {90, 63, 9, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_bool_value_)}},
+    // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+    {::_pbi::TcParser::FastMtR1,
+     {98, 63, 10, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_int32_value_)}},
+    // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+    {::_pbi::TcParser::FastMtR1,
+     {106, 63, 11, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_int64_value_)}},
+    // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+    {::_pbi::TcParser::FastMtR1,
+     {114, 63, 12, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_uint32_value_)}},
+    // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+    {::_pbi::TcParser::FastMtR1,
+     {122, 63, 13, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_uint64_value_)}},
+    // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+    {::_pbi::TcParser::FastMtR2,
+     {386, 63, 14, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_float_value_)}},
+    // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+    {::_pbi::TcParser::FastMtR2,
+     {394, 63, 15, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_double_value_)}},
+    // repeated .google.protobuf.StringValue repeated_string_value = 18;
+    {::_pbi::TcParser::FastMtR2,
+     {402, 63, 16, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_string_value_)}},
+    // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+    {::_pbi::TcParser::FastMtR2,
+     {410, 63, 17, PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_bytes_value_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.BoolValue bool_value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.bool_value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Int32Value int32_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.int32_value_), _Internal::kHasBitsOffset + 1, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.Int64Value int64_value = 3;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.int64_value_), _Internal::kHasBitsOffset + 2, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.UInt32Value uint32_value = 4;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.uint32_value_), _Internal::kHasBitsOffset + 3, 3,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.UInt64Value uint64_value = 5;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.uint64_value_), _Internal::kHasBitsOffset + 4, 4,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.FloatValue float_value = 6;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.float_value_), _Internal::kHasBitsOffset + 5, 5,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.DoubleValue double_value = 7;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.double_value_), _Internal::kHasBitsOffset + 6, 6,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.StringValue string_value = 8;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.string_value_), _Internal::kHasBitsOffset + 7, 7,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .google.protobuf.BytesValue bytes_value = 9;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.bytes_value_), _Internal::kHasBitsOffset + 8, 8,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_bool_value_), -1, 9,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_int32_value_), -1, 10,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_int64_value_), -1, 11,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_uint32_value_), -1, 12,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_uint64_value_), -1, 13,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_float_value_), -1, 14,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_double_value_), -1, 15,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.StringValue repeated_string_value = 18;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_string_value_), -1, 16,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+    {PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.repeated_bytes_value_), -1, 17,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::BoolValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FloatValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::DoubleValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::StringValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BytesValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BoolValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Int64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt32Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::UInt64Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::FloatValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::DoubleValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::StringValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::BytesValue>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestWrapper::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestWrapper)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.BoolValue bool_value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::bool_value(this),
+        _Internal::bool_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Int32Value int32_value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::int32_value(this),
+        _Internal::int32_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.Int64Value int64_value = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::int64_value(this),
+        _Internal::int64_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value uint32_value = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        4, _Internal::uint32_value(this),
+        _Internal::uint32_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt64Value uint64_value = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        5, _Internal::uint64_value(this),
+        _Internal::uint64_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.FloatValue float_value = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        6, _Internal::float_value(this),
+        _Internal::float_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.DoubleValue double_value = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        7, _Internal::double_value(this),
+        _Internal::double_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.StringValue string_value = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        8, _Internal::string_value(this),
+        _Internal::string_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.BytesValue bytes_value = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        9, _Internal::bytes_value(this),
+        _Internal::bytes_value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_bool_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_bool_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_int32_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_int32_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_int64_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_int64_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(13, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_uint32_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_uint32_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(14, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_uint64_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_uint64_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(15, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_float_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_float_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(16, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_double_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_double_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(17, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.StringValue repeated_string_value = 18;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_string_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_string_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(18, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_bytes_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_bytes_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(19, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestWrapper)
+  return target;
+}
+
+::size_t TestWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestWrapper)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+  total_size += 1UL * this->_internal_repeated_bool_value_size();
+  for (const auto& msg : this->_internal_repeated_bool_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+  total_size += 1UL * this->_internal_repeated_int32_value_size();
+  for (const auto& msg : this->_internal_repeated_int32_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+  total_size += 1UL * this->_internal_repeated_int64_value_size();
+  for (const auto& msg : this->_internal_repeated_int64_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+  total_size += 1UL * this->_internal_repeated_uint32_value_size();
+  for (const auto& msg : this->_internal_repeated_uint32_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+  total_size += 1UL * this->_internal_repeated_uint64_value_size();
+  for (const auto& msg : this->_internal_repeated_uint64_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+  total_size += 2UL * this->_internal_repeated_float_value_size();
+  for (const auto& msg : this->_internal_repeated_float_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+  total_size += 2UL * this->_internal_repeated_double_value_size();
+  for (const auto& msg : this->_internal_repeated_double_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.StringValue repeated_string_value = 18;
+  total_size += 2UL * this->_internal_repeated_string_value_size();
+  for (const auto& msg : this->_internal_repeated_string_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+  total_size += 2UL * this->_internal_repeated_bytes_value_size();
+  for (const auto& msg : this->_internal_repeated_bytes_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // .google.protobuf.BoolValue bool_value = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.bool_value_);
+    }
+
+    // .google.protobuf.Int32Value int32_value = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.int32_value_);
+    }
+
+    // .google.protobuf.Int64Value int64_value = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.int64_value_);
+    }
+
+    // .google.protobuf.UInt32Value uint32_value = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.uint32_value_);
+    }
+
+    // .google.protobuf.UInt64Value uint64_value = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.uint64_value_);
+    }
+
+    // .google.protobuf.FloatValue float_value = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.float_value_);
+    }
+
+    // .google.protobuf.DoubleValue double_value = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.double_value_);
+    }
+
+    // .google.protobuf.StringValue string_value = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.string_value_);
+    }
+
+  }
+  // .google.protobuf.BytesValue bytes_value = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.bytes_value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestWrapper::_class_data_ = {
+    TestWrapper::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestWrapper::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestWrapper::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestWrapper*>(&to_msg);
+  auto& from = static_cast<const TestWrapper&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestWrapper)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_bool_value()->MergeFrom(
+      from._internal_repeated_bool_value());
+  _this->_internal_mutable_repeated_int32_value()->MergeFrom(
+      from._internal_repeated_int32_value());
+  _this->_internal_mutable_repeated_int64_value()->MergeFrom(
+      from._internal_repeated_int64_value());
+  _this->_internal_mutable_repeated_uint32_value()->MergeFrom(
+      from._internal_repeated_uint32_value());
+  _this->_internal_mutable_repeated_uint64_value()->MergeFrom(
+      from._internal_repeated_uint64_value());
+  _this->_internal_mutable_repeated_float_value()->MergeFrom(
+      from._internal_repeated_float_value());
+  _this->_internal_mutable_repeated_double_value()->MergeFrom(
+      from._internal_repeated_double_value());
+  _this->_internal_mutable_repeated_string_value()->MergeFrom(
+      from._internal_repeated_string_value());
+  _this->_internal_mutable_repeated_bytes_value()->MergeFrom(
+      from._internal_repeated_bytes_value());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_bool_value()->::google::protobuf::BoolValue::MergeFrom(
+          from._internal_bool_value());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_int32_value()->::google::protobuf::Int32Value::MergeFrom(
+          from._internal_int32_value());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_int64_value()->::google::protobuf::Int64Value::MergeFrom(
+          from._internal_int64_value());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_uint32_value()->::google::protobuf::UInt32Value::MergeFrom(
+          from._internal_uint32_value());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_uint64_value()->::google::protobuf::UInt64Value::MergeFrom(
+          from._internal_uint64_value());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_float_value()->::google::protobuf::FloatValue::MergeFrom(
+          from._internal_float_value());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_double_value()->::google::protobuf::DoubleValue::MergeFrom(
+          from._internal_double_value());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_string_value()->::google::protobuf::StringValue::MergeFrom(
+          from._internal_string_value());
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_mutable_bytes_value()->::google::protobuf::BytesValue::MergeFrom(
+        from._internal_bytes_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestWrapper::CopyFrom(const TestWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestWrapper::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestWrapper::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestWrapper::InternalSwap(TestWrapper* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_bool_value_.InternalSwap(&other->_impl_.repeated_bool_value_);
+  _impl_.repeated_int32_value_.InternalSwap(&other->_impl_.repeated_int32_value_);
+  _impl_.repeated_int64_value_.InternalSwap(&other->_impl_.repeated_int64_value_);
+  _impl_.repeated_uint32_value_.InternalSwap(&other->_impl_.repeated_uint32_value_);
+  _impl_.repeated_uint64_value_.InternalSwap(&other->_impl_.repeated_uint64_value_);
+  _impl_.repeated_float_value_.InternalSwap(&other->_impl_.repeated_float_value_);
+  _impl_.repeated_double_value_.InternalSwap(&other->_impl_.repeated_double_value_);
+  _impl_.repeated_string_value_.InternalSwap(&other->_impl_.repeated_string_value_);
+  _impl_.repeated_bytes_value_.InternalSwap(&other->_impl_.repeated_bytes_value_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.bytes_value_)
+      + sizeof(TestWrapper::_impl_.bytes_value_)
+      - PROTOBUF_FIELD_OFFSET(TestWrapper, _impl_.bool_value_)>(
+          reinterpret_cast<char*>(&_impl_.bool_value_),
+          reinterpret_cast<char*>(&other->_impl_.bool_value_));
+}
+
+::google::protobuf::Metadata TestWrapper::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[20]);
+}
+// ===================================================================
+
+class TestTimestamp::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestTimestamp>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestTimestamp, _impl_._has_bits_);
+  static const ::google::protobuf::Timestamp& value(const TestTimestamp* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::Timestamp& TestTimestamp::_Internal::value(const TestTimestamp* msg) {
+  return *msg->_impl_.value_;
+}
+void TestTimestamp::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestTimestamp::clear_repeated_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_value_.Clear();
+}
+TestTimestamp::TestTimestamp(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestTimestamp)
+}
+inline PROTOBUF_NDEBUG_INLINE TestTimestamp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_value_{visibility, arena, from.repeated_value_} {}
+
+TestTimestamp::TestTimestamp(
+    ::google::protobuf::Arena* arena,
+    const TestTimestamp& from)
+    : ::google::protobuf::Message(arena) {
+  TestTimestamp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Timestamp>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestTimestamp)
+}
+inline PROTOBUF_NDEBUG_INLINE TestTimestamp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_value_{visibility, arena} {}
+
+inline void TestTimestamp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestTimestamp::~TestTimestamp() {
+  // @@protoc_insertion_point(destructor:proto3.TestTimestamp)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestTimestamp::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestTimestamp::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestTimestamp)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestTimestamp::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> TestTimestamp::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestTimestamp, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestTimestamp_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.Timestamp repeated_value = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(TestTimestamp, _impl_.repeated_value_)}},
+    // .google.protobuf.Timestamp value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestTimestamp, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Timestamp value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestTimestamp, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Timestamp repeated_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestTimestamp, _impl_.repeated_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Timestamp>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Timestamp>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestTimestamp::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestTimestamp)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Timestamp value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Timestamp repeated_value = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestTimestamp)
+  return target;
+}
+
+::size_t TestTimestamp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestTimestamp)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Timestamp repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->_internal_repeated_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .google.protobuf.Timestamp value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestTimestamp::_class_data_ = {
+    TestTimestamp::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestTimestamp::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestTimestamp::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestTimestamp*>(&to_msg);
+  auto& from = static_cast<const TestTimestamp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestTimestamp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_value()->MergeFrom(
+      from._internal_repeated_value());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::Timestamp::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestTimestamp::CopyFrom(const TestTimestamp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestTimestamp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestTimestamp::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestTimestamp::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestTimestamp::InternalSwap(TestTimestamp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_value_.InternalSwap(&other->_impl_.repeated_value_);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestTimestamp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[21]);
+}
+// ===================================================================
+
+class TestDuration::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestDuration>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestDuration, _impl_._has_bits_);
+  static const ::google::protobuf::Duration& value(const TestDuration* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::Duration& TestDuration::_Internal::value(const TestDuration* msg) {
+  return *msg->_impl_.value_;
+}
+void TestDuration::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestDuration::clear_repeated_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_value_.Clear();
+}
+TestDuration::TestDuration(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestDuration)
+}
+inline PROTOBUF_NDEBUG_INLINE TestDuration::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_value_{visibility, arena, from.repeated_value_} {}
+
+TestDuration::TestDuration(
+    ::google::protobuf::Arena* arena,
+    const TestDuration& from)
+    : ::google::protobuf::Message(arena) {
+  TestDuration* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Duration>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestDuration)
+}
+inline PROTOBUF_NDEBUG_INLINE TestDuration::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_value_{visibility, arena} {}
+
+inline void TestDuration::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestDuration::~TestDuration() {
+  // @@protoc_insertion_point(destructor:proto3.TestDuration)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestDuration::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestDuration::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestDuration)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestDuration::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> TestDuration::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestDuration, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestDuration_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.Duration repeated_value = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(TestDuration, _impl_.repeated_value_)}},
+    // .google.protobuf.Duration value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestDuration, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Duration value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestDuration, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Duration repeated_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestDuration, _impl_.repeated_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Duration>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Duration>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestDuration::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestDuration)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Duration value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Duration repeated_value = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestDuration)
+  return target;
+}
+
+::size_t TestDuration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestDuration)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Duration repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->_internal_repeated_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .google.protobuf.Duration value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestDuration::_class_data_ = {
+    TestDuration::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestDuration::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestDuration::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestDuration*>(&to_msg);
+  auto& from = static_cast<const TestDuration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestDuration)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_value()->MergeFrom(
+      from._internal_repeated_value());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::Duration::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestDuration::CopyFrom(const TestDuration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestDuration)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestDuration::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestDuration::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestDuration::InternalSwap(TestDuration* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_value_.InternalSwap(&other->_impl_.repeated_value_);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestDuration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[22]);
+}
+// ===================================================================
+
+class TestFieldMask::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestFieldMask>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestFieldMask, _impl_._has_bits_);
+  static const ::google::protobuf::FieldMask& value(const TestFieldMask* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::FieldMask& TestFieldMask::_Internal::value(const TestFieldMask* msg) {
+  return *msg->_impl_.value_;
+}
+void TestFieldMask::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+TestFieldMask::TestFieldMask(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestFieldMask)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFieldMask::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestFieldMask::TestFieldMask(
+    ::google::protobuf::Arena* arena,
+    const TestFieldMask& from)
+    : ::google::protobuf::Message(arena) {
+  TestFieldMask* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::FieldMask>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestFieldMask)
+}
+inline PROTOBUF_NDEBUG_INLINE TestFieldMask::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestFieldMask::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestFieldMask::~TestFieldMask() {
+  // @@protoc_insertion_point(destructor:proto3.TestFieldMask)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestFieldMask::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestFieldMask::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestFieldMask)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestFieldMask::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestFieldMask::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestFieldMask, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestFieldMask_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .google.protobuf.FieldMask value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestFieldMask, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.FieldMask value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestFieldMask, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::FieldMask>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestFieldMask::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestFieldMask)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.FieldMask value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestFieldMask)
+  return target;
+}
+
+::size_t TestFieldMask::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestFieldMask)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.FieldMask value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestFieldMask::_class_data_ = {
+    TestFieldMask::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestFieldMask::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestFieldMask::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestFieldMask*>(&to_msg);
+  auto& from = static_cast<const TestFieldMask&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestFieldMask)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::FieldMask::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestFieldMask::CopyFrom(const TestFieldMask& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestFieldMask)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestFieldMask::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestFieldMask::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestFieldMask::InternalSwap(TestFieldMask* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestFieldMask::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[23]);
+}
+// ===================================================================
+
+class TestStruct::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestStruct>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestStruct, _impl_._has_bits_);
+  static const ::google::protobuf::Struct& value(const TestStruct* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::Struct& TestStruct::_Internal::value(const TestStruct* msg) {
+  return *msg->_impl_.value_;
+}
+void TestStruct::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestStruct::clear_repeated_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_value_.Clear();
+}
+TestStruct::TestStruct(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestStruct)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStruct::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_value_{visibility, arena, from.repeated_value_} {}
+
+TestStruct::TestStruct(
+    ::google::protobuf::Arena* arena,
+    const TestStruct& from)
+    : ::google::protobuf::Message(arena) {
+  TestStruct* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Struct>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestStruct)
+}
+inline PROTOBUF_NDEBUG_INLINE TestStruct::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_value_{visibility, arena} {}
+
+inline void TestStruct::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestStruct::~TestStruct() {
+  // @@protoc_insertion_point(destructor:proto3.TestStruct)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestStruct::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestStruct::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestStruct)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestStruct::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> TestStruct::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestStruct, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestStruct_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.Struct repeated_value = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(TestStruct, _impl_.repeated_value_)}},
+    // .google.protobuf.Struct value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestStruct, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Struct value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestStruct, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Struct repeated_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestStruct, _impl_.repeated_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Struct>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Struct>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestStruct::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestStruct)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Struct value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Struct repeated_value = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestStruct)
+  return target;
+}
+
+::size_t TestStruct::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestStruct)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Struct repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->_internal_repeated_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .google.protobuf.Struct value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestStruct::_class_data_ = {
+    TestStruct::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestStruct::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestStruct::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestStruct*>(&to_msg);
+  auto& from = static_cast<const TestStruct&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestStruct)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_value()->MergeFrom(
+      from._internal_repeated_value());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::Struct::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestStruct::CopyFrom(const TestStruct& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestStruct)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestStruct::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestStruct::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestStruct::InternalSwap(TestStruct* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_value_.InternalSwap(&other->_impl_.repeated_value_);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestStruct::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[24]);
+}
+// ===================================================================
+
+class TestAny::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestAny>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestAny, _impl_._has_bits_);
+  static const ::google::protobuf::Any& value(const TestAny* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::Any& TestAny::_Internal::value(const TestAny* msg) {
+  return *msg->_impl_.value_;
+}
+void TestAny::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestAny::clear_repeated_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_value_.Clear();
+}
+TestAny::TestAny(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestAny)
+}
+inline PROTOBUF_NDEBUG_INLINE TestAny::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_value_{visibility, arena, from.repeated_value_} {}
+
+TestAny::TestAny(
+    ::google::protobuf::Arena* arena,
+    const TestAny& from)
+    : ::google::protobuf::Message(arena) {
+  TestAny* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Any>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestAny)
+}
+inline PROTOBUF_NDEBUG_INLINE TestAny::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_value_{visibility, arena} {}
+
+inline void TestAny::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestAny::~TestAny() {
+  // @@protoc_insertion_point(destructor:proto3.TestAny)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestAny::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestAny::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestAny)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestAny::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> TestAny::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestAny, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestAny_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.Any repeated_value = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(TestAny, _impl_.repeated_value_)}},
+    // .google.protobuf.Any value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestAny, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Any value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestAny, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Any repeated_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestAny, _impl_.repeated_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestAny::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestAny)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Any value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Any repeated_value = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestAny)
+  return target;
+}
+
+::size_t TestAny::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestAny)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->_internal_repeated_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .google.protobuf.Any value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestAny::_class_data_ = {
+    TestAny::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestAny::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestAny::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestAny*>(&to_msg);
+  auto& from = static_cast<const TestAny&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestAny)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_value()->MergeFrom(
+      from._internal_repeated_value());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::Any::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestAny::CopyFrom(const TestAny& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestAny)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestAny::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestAny::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestAny::InternalSwap(TestAny* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_value_.InternalSwap(&other->_impl_.repeated_value_);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestAny::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[25]);
+}
+// ===================================================================
+
+class TestValue::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestValue, _impl_._has_bits_);
+  static const ::google::protobuf::Value& value(const TestValue* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::Value& TestValue::_Internal::value(const TestValue* msg) {
+  return *msg->_impl_.value_;
+}
+void TestValue::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestValue::clear_repeated_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_value_.Clear();
+}
+TestValue::TestValue(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_value_{visibility, arena, from.repeated_value_} {}
+
+TestValue::TestValue(
+    ::google::protobuf::Arena* arena,
+    const TestValue& from)
+    : ::google::protobuf::Message(arena) {
+  TestValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::Value>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_value_{visibility, arena} {}
+
+inline void TestValue::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestValue::~TestValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestValue)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestValue::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestValue)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestValue::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> TestValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestValue, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestValue_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.Value repeated_value = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(TestValue, _impl_.repeated_value_)}},
+    // .google.protobuf.Value value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestValue, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.Value value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestValue, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Value repeated_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestValue, _impl_.repeated_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::Value>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Value>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestValue::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.Value value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Value repeated_value = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestValue)
+  return target;
+}
+
+::size_t TestValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Value repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->_internal_repeated_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .google.protobuf.Value value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestValue::_class_data_ = {
+    TestValue::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestValue::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestValue::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestValue*>(&to_msg);
+  auto& from = static_cast<const TestValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_value()->MergeFrom(
+      from._internal_repeated_value());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::Value::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestValue::CopyFrom(const TestValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestValue::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestValue::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestValue::InternalSwap(TestValue* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_value_.InternalSwap(&other->_impl_.repeated_value_);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[26]);
+}
+// ===================================================================
+
+class TestListValue::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestListValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestListValue, _impl_._has_bits_);
+  static const ::google::protobuf::ListValue& value(const TestListValue* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::google::protobuf::ListValue& TestListValue::_Internal::value(const TestListValue* msg) {
+  return *msg->_impl_.value_;
+}
+void TestListValue::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void TestListValue::clear_repeated_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_value_.Clear();
+}
+TestListValue::TestListValue(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestListValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestListValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        repeated_value_{visibility, arena, from.repeated_value_} {}
+
+TestListValue::TestListValue(
+    ::google::protobuf::Arena* arena,
+    const TestListValue& from)
+    : ::google::protobuf::Message(arena) {
+  TestListValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::google::protobuf::ListValue>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestListValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestListValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        repeated_value_{visibility, arena} {}
+
+inline void TestListValue::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestListValue::~TestListValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestListValue)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestListValue::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestListValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestListValue)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_value_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestListValue::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> TestListValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestListValue, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestListValue_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.ListValue repeated_value = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(TestListValue, _impl_.repeated_value_)}},
+    // .google.protobuf.ListValue value = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestListValue, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.ListValue value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestListValue, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.ListValue repeated_value = 2;
+    {PROTOBUF_FIELD_OFFSET(TestListValue, _impl_.repeated_value_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::google::protobuf::ListValue>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::ListValue>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestListValue::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestListValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .google.protobuf.ListValue value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.ListValue repeated_value = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repeated_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repeated_value().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestListValue)
+  return target;
+}
+
+::size_t TestListValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestListValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.ListValue repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->_internal_repeated_value()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .google.protobuf.ListValue value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestListValue::_class_data_ = {
+    TestListValue::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestListValue::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestListValue::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestListValue*>(&to_msg);
+  auto& from = static_cast<const TestListValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestListValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_value()->MergeFrom(
+      from._internal_repeated_value());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::google::protobuf::ListValue::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestListValue::CopyFrom(const TestListValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestListValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestListValue::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestListValue::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestListValue::InternalSwap(TestListValue* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repeated_value_.InternalSwap(&other->_impl_.repeated_value_);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestListValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[27]);
+}
+// ===================================================================
+
+TestBoolValue_BoolMapEntry_DoNotUse::TestBoolValue_BoolMapEntry_DoNotUse() {}
+TestBoolValue_BoolMapEntry_DoNotUse::TestBoolValue_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestBoolValue_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[28]);
+}
+// ===================================================================
+
+class TestBoolValue::_Internal {
+ public:
+};
+
+TestBoolValue::TestBoolValue(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestBoolValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestBoolValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : bool_map_{visibility, arena, from.bool_map_},
+        _cached_size_{0} {}
+
+TestBoolValue::TestBoolValue(
+    ::google::protobuf::Arena* arena,
+    const TestBoolValue& from)
+    : ::google::protobuf::Message(arena) {
+  TestBoolValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.bool_value_ = from._impl_.bool_value_;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestBoolValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestBoolValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : bool_map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void TestBoolValue::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.bool_value_ = {};
+}
+TestBoolValue::~TestBoolValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestBoolValue)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestBoolValue::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestBoolValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestBoolValue)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bool_map_.Clear();
+  _impl_.bool_value_ = false;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestBoolValue::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 1, 0, 2> TestBoolValue::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestBoolValue_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // bool bool_value = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestBoolValue, _impl_.bool_value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestBoolValue, _impl_.bool_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool bool_value = 1;
+    {PROTOBUF_FIELD_OFFSET(TestBoolValue, _impl_.bool_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // map<bool, int32> bool_map = 2;
+    {PROTOBUF_FIELD_OFFSET(TestBoolValue, _impl_.bool_map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestBoolValue()._impl_.bool_map_)>(
+        1, 0, 0, 8,
+        5)},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestBoolValue::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestBoolValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // bool bool_value = 1;
+  if (this->_internal_bool_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_bool_value(), target);
+  }
+
+  // map<bool, int32> bool_map = 2;
+  if (!_internal_bool_map().empty()) {
+    using MapType = ::google::protobuf::Map<bool, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_bool_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestBoolValue)
+  return target;
+}
+
+::size_t TestBoolValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestBoolValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_bool_map_size());
+  for (const auto& entry : _internal_bool_map()) {
+    total_size += _pbi::MapEntryFuncs<bool, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  // bool bool_value = 1;
+  if (this->_internal_bool_value() != 0) {
+    total_size += 2;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestBoolValue::_class_data_ = {
+    TestBoolValue::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestBoolValue::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestBoolValue::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestBoolValue*>(&to_msg);
+  auto& from = static_cast<const TestBoolValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestBoolValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bool_map_.MergeFrom(from._impl_.bool_map_);
+  if (from._internal_bool_value() != 0) {
+    _this->_internal_set_bool_value(from._internal_bool_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestBoolValue::CopyFrom(const TestBoolValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestBoolValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestBoolValue::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestBoolValue::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestBoolValue::InternalSwap(TestBoolValue* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bool_map_.InternalSwap(&other->_impl_.bool_map_);
+        swap(_impl_.bool_value_, other->_impl_.bool_value_);
+}
+
+::google::protobuf::Metadata TestBoolValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[29]);
+}
+// ===================================================================
+
+class TestNullValue::_Internal {
+ public:
+};
+
+TestNullValue::TestNullValue(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestNullValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestNullValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : repeated_null_value_{visibility, arena, from.repeated_null_value_},
+        _repeated_null_value_cached_byte_size_{0},
+        _cached_size_{0} {}
+
+TestNullValue::TestNullValue(
+    ::google::protobuf::Arena* arena,
+    const TestNullValue& from)
+    : ::google::protobuf::Message(arena) {
+  TestNullValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.null_value_ = from._impl_.null_value_;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestNullValue)
+}
+inline PROTOBUF_NDEBUG_INLINE TestNullValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : repeated_null_value_{visibility, arena},
+        _repeated_null_value_cached_byte_size_{0},
+        _cached_size_{0} {}
+
+inline void TestNullValue::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.null_value_ = {};
+}
+TestNullValue::~TestNullValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestNullValue)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestNullValue::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestNullValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestNullValue)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repeated_null_value_.Clear();
+  _impl_.null_value_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestNullValue::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> TestNullValue::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    21, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4293394431,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestNullValue_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .google.protobuf.NullValue null_value = 20;
+    {::_pbi::TcParser::FastV32S2,
+     {416, 63, 0, PROTOBUF_FIELD_OFFSET(TestNullValue, _impl_.null_value_)}},
+    // repeated .google.protobuf.NullValue repeated_null_value = 21;
+    {::_pbi::TcParser::FastV32P2,
+     {426, 63, 0, PROTOBUF_FIELD_OFFSET(TestNullValue, _impl_.repeated_null_value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .google.protobuf.NullValue null_value = 20;
+    {PROTOBUF_FIELD_OFFSET(TestNullValue, _impl_.null_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // repeated .google.protobuf.NullValue repeated_null_value = 21;
+    {PROTOBUF_FIELD_OFFSET(TestNullValue, _impl_.repeated_null_value_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestNullValue::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestNullValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // .google.protobuf.NullValue null_value = 20;
+  if (this->_internal_null_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        20, this->_internal_null_value(), target);
+  }
+
+  // repeated .google.protobuf.NullValue repeated_null_value = 21;
+  {
+    std::size_t byte_size = _impl_._repeated_null_value_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(21, _internal_repeated_null_value(),
+                                       byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestNullValue)
+  return target;
+}
+
+::size_t TestNullValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestNullValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.NullValue repeated_null_value = 21;
+  {
+    std::size_t data_size = 0;
+    auto count = static_cast<std::size_t>(this->_internal_repeated_null_value_size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+          this->_internal_repeated_null_value().Get(static_cast<int>(i)));
+    }
+    total_size += data_size;
+    if (data_size > 0) {
+      total_size += 2;
+      total_size += ::_pbi::WireFormatLite::Int32Size(
+          static_cast<int32_t>(data_size));
+    }
+    _impl_._repeated_null_value_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+  }
+  // .google.protobuf.NullValue null_value = 20;
+  if (this->_internal_null_value() != 0) {
+    total_size += 2 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_null_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestNullValue::_class_data_ = {
+    TestNullValue::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestNullValue::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestNullValue::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestNullValue*>(&to_msg);
+  auto& from = static_cast<const TestNullValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestNullValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_repeated_null_value()->MergeFrom(from._internal_repeated_null_value());
+  if (from._internal_null_value() != 0) {
+    _this->_internal_set_null_value(from._internal_null_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestNullValue::CopyFrom(const TestNullValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestNullValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestNullValue::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestNullValue::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestNullValue::InternalSwap(TestNullValue* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.repeated_null_value_.InternalSwap(&other->_impl_.repeated_null_value_);
+  swap(_impl_.null_value_, other->_impl_.null_value_);
+}
+
+::google::protobuf::Metadata TestNullValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[30]);
+}
+// ===================================================================
+
+class TestCustomJsonName::_Internal {
+ public:
+};
+
+TestCustomJsonName::TestCustomJsonName(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestCustomJsonName)
+}
+TestCustomJsonName::TestCustomJsonName(
+    ::google::protobuf::Arena* arena, const TestCustomJsonName& from)
+    : TestCustomJsonName(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestCustomJsonName::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestCustomJsonName::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+TestCustomJsonName::~TestCustomJsonName() {
+  // @@protoc_insertion_point(destructor:proto3.TestCustomJsonName)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestCustomJsonName::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestCustomJsonName::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestCustomJsonName)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestCustomJsonName::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> TestCustomJsonName::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestCustomJsonName_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // int32 value = 1 [json_name = "@value"];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestCustomJsonName, _impl_.value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestCustomJsonName, _impl_.value_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 value = 1 [json_name = "@value"];
+    {PROTOBUF_FIELD_OFFSET(TestCustomJsonName, _impl_.value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestCustomJsonName::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestCustomJsonName)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 11 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[11];
+  ::uint8_t* ptr = buffer;
+  // int32 value = 1 [json_name = "@value"];
+  if (this->_internal_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_value(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestCustomJsonName)
+  return target;
+}
+
+::size_t TestCustomJsonName::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestCustomJsonName)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 value = 1 [json_name = "@value"];
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestCustomJsonName::_class_data_ = {
+    TestCustomJsonName::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestCustomJsonName::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestCustomJsonName::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestCustomJsonName*>(&to_msg);
+  auto& from = static_cast<const TestCustomJsonName&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestCustomJsonName)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestCustomJsonName::CopyFrom(const TestCustomJsonName& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestCustomJsonName)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestCustomJsonName::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestCustomJsonName::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestCustomJsonName::InternalSwap(TestCustomJsonName* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata TestCustomJsonName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[31]);
+}
+// ===================================================================
+
+class TestEvilJson::_Internal {
+ public:
+};
+
+TestEvilJson::TestEvilJson(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestEvilJson)
+}
+TestEvilJson::TestEvilJson(
+    ::google::protobuf::Arena* arena, const TestEvilJson& from)
+    : TestEvilJson(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestEvilJson::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestEvilJson::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, regular_value_),
+           0,
+           offsetof(Impl_, script_and_quotes_) -
+               offsetof(Impl_, regular_value_) +
+               sizeof(Impl_::script_and_quotes_));
+}
+TestEvilJson::~TestEvilJson() {
+  // @@protoc_insertion_point(destructor:proto3.TestEvilJson)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestEvilJson::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestEvilJson::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestEvilJson)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.regular_value_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.script_and_quotes_) -
+      reinterpret_cast<char*>(&_impl_.regular_value_)) + sizeof(_impl_.script_and_quotes_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestEvilJson::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 0, 2> TestEvilJson::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestEvilJson_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // int32 script_and_quotes = 4 [json_name = "\"<script>alert(\'hello!);</script>"];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEvilJson, _impl_.script_and_quotes_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.script_and_quotes_)}},
+    // int32 regular_value = 1 [json_name = "regular_name"];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEvilJson, _impl_.regular_value_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.regular_value_)}},
+    // int32 script = 2 [json_name = "</script>"];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEvilJson, _impl_.script_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.script_)}},
+    // int32 quotes = 3 [json_name = "unbalanced\"quotes"];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEvilJson, _impl_.quotes_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.quotes_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 regular_value = 1 [json_name = "regular_name"];
+    {PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.regular_value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 script = 2 [json_name = "</script>"];
+    {PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.script_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 quotes = 3 [json_name = "unbalanced\"quotes"];
+    {PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.quotes_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 script_and_quotes = 4 [json_name = "\"<script>alert(\'hello!);</script>"];
+    {PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.script_and_quotes_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestEvilJson::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestEvilJson)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 44 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[44];
+  ::uint8_t* ptr = buffer;
+  // int32 regular_value = 1 [json_name = "regular_name"];
+  if (this->_internal_regular_value() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_regular_value(), ptr);
+  }
+
+  // int32 script = 2 [json_name = "</script>"];
+  if (this->_internal_script() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_script(), ptr);
+  }
+
+  // int32 quotes = 3 [json_name = "unbalanced\"quotes"];
+  if (this->_internal_quotes() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        3, this->_internal_quotes(), ptr);
+  }
+
+  // int32 script_and_quotes = 4 [json_name = "\"<script>alert(\'hello!);</script>"];
+  if (this->_internal_script_and_quotes() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        4, this->_internal_script_and_quotes(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestEvilJson)
+  return target;
+}
+
+::size_t TestEvilJson::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestEvilJson)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 regular_value = 1 [json_name = "regular_name"];
+  if (this->_internal_regular_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_regular_value());
+  }
+
+  // int32 script = 2 [json_name = "</script>"];
+  if (this->_internal_script() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_script());
+  }
+
+  // int32 quotes = 3 [json_name = "unbalanced\"quotes"];
+  if (this->_internal_quotes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_quotes());
+  }
+
+  // int32 script_and_quotes = 4 [json_name = "\"<script>alert(\'hello!);</script>"];
+  if (this->_internal_script_and_quotes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_script_and_quotes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestEvilJson::_class_data_ = {
+    TestEvilJson::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestEvilJson::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestEvilJson::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestEvilJson*>(&to_msg);
+  auto& from = static_cast<const TestEvilJson&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestEvilJson)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_regular_value() != 0) {
+    _this->_internal_set_regular_value(from._internal_regular_value());
+  }
+  if (from._internal_script() != 0) {
+    _this->_internal_set_script(from._internal_script());
+  }
+  if (from._internal_quotes() != 0) {
+    _this->_internal_set_quotes(from._internal_quotes());
+  }
+  if (from._internal_script_and_quotes() != 0) {
+    _this->_internal_set_script_and_quotes(from._internal_script_and_quotes());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestEvilJson::CopyFrom(const TestEvilJson& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestEvilJson)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestEvilJson::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestEvilJson::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestEvilJson::InternalSwap(TestEvilJson* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.script_and_quotes_)
+      + sizeof(TestEvilJson::_impl_.script_and_quotes_)
+      - PROTOBUF_FIELD_OFFSET(TestEvilJson, _impl_.regular_value_)>(
+          reinterpret_cast<char*>(&_impl_.regular_value_),
+          reinterpret_cast<char*>(&other->_impl_.regular_value_));
+}
+
+::google::protobuf::Metadata TestEvilJson::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[32]);
+}
+// ===================================================================
+
+class TestExtensions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestExtensions>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestExtensions, _impl_._has_bits_);
+  static const ::protobuf_unittest::TestAllExtensions& extensions(const TestExtensions* msg);
+  static void set_has_extensions(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestAllExtensions& TestExtensions::_Internal::extensions(const TestExtensions* msg) {
+  return *msg->_impl_.extensions_;
+}
+void TestExtensions::clear_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.extensions_ != nullptr) _impl_.extensions_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+TestExtensions::TestExtensions(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestExtensions)
+}
+inline PROTOBUF_NDEBUG_INLINE TestExtensions::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+TestExtensions::TestExtensions(
+    ::google::protobuf::Arena* arena,
+    const TestExtensions& from)
+    : ::google::protobuf::Message(arena) {
+  TestExtensions* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.extensions_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestAllExtensions>(arena, *from._impl_.extensions_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.TestExtensions)
+}
+inline PROTOBUF_NDEBUG_INLINE TestExtensions::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestExtensions::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.extensions_ = {};
+}
+TestExtensions::~TestExtensions() {
+  // @@protoc_insertion_point(destructor:proto3.TestExtensions)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestExtensions::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.extensions_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestExtensions::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestExtensions)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.extensions_ != nullptr);
+    _impl_.extensions_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestExtensions::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TestExtensions::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestExtensions, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestExtensions_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .protobuf_unittest.TestAllExtensions extensions = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TestExtensions, _impl_.extensions_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .protobuf_unittest.TestAllExtensions extensions = 1;
+    {PROTOBUF_FIELD_OFFSET(TestExtensions, _impl_.extensions_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestAllExtensions>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestExtensions::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestExtensions)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .protobuf_unittest.TestAllExtensions extensions = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::extensions(this),
+        _Internal::extensions(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestExtensions)
+  return target;
+}
+
+::size_t TestExtensions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestExtensions)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestAllExtensions extensions = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.extensions_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestExtensions::_class_data_ = {
+    TestExtensions::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestExtensions::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestExtensions::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestExtensions*>(&to_msg);
+  auto& from = static_cast<const TestExtensions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestExtensions)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_extensions()->::protobuf_unittest::TestAllExtensions::MergeFrom(
+        from._internal_extensions());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestExtensions::CopyFrom(const TestExtensions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestExtensions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestExtensions::IsInitialized() const {
+  if ((_impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (!_impl_.extensions_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestExtensions::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestExtensions::InternalSwap(TestExtensions* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.extensions_, other->_impl_.extensions_);
+}
+
+::google::protobuf::Metadata TestExtensions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[33]);
+}
+// ===================================================================
+
+class TestEnumValue::_Internal {
+ public:
+};
+
+TestEnumValue::TestEnumValue(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestEnumValue)
+}
+TestEnumValue::TestEnumValue(
+    ::google::protobuf::Arena* arena, const TestEnumValue& from)
+    : TestEnumValue(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE TestEnumValue::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void TestEnumValue::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, enum_value1_),
+           0,
+           offsetof(Impl_, enum_value3_) -
+               offsetof(Impl_, enum_value1_) +
+               sizeof(Impl_::enum_value3_));
+}
+TestEnumValue::~TestEnumValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestEnumValue)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestEnumValue::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestEnumValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestEnumValue)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.enum_value1_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.enum_value3_) -
+      reinterpret_cast<char*>(&_impl_.enum_value1_)) + sizeof(_impl_.enum_value3_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestEnumValue::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2> TestEnumValue::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_TestEnumValue_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .proto3.EnumType enum_value1 = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEnumValue, _impl_.enum_value1_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value1_)}},
+    // .proto3.EnumType enum_value2 = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEnumValue, _impl_.enum_value2_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value2_)}},
+    // .proto3.EnumType enum_value3 = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestEnumValue, _impl_.enum_value3_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value3_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .proto3.EnumType enum_value1 = 1;
+    {PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value1_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // .proto3.EnumType enum_value2 = 2;
+    {PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value2_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // .proto3.EnumType enum_value3 = 3;
+    {PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value3_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* TestEnumValue::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestEnumValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // All known fields are scalars that encode to at most 33 bytes,
+  // so they are written to a stack buffer without per-field bounds
+  // checks and then copied to the stream at once.
+  ::uint8_t buffer[33];
+  ::uint8_t* ptr = buffer;
+  // .proto3.EnumType enum_value1 = 1;
+  if (this->_internal_enum_value1() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_enum_value1(), ptr);
+  }
+
+  // .proto3.EnumType enum_value2 = 2;
+  if (this->_internal_enum_value2() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, this->_internal_enum_value2(), ptr);
+  }
+
+  // .proto3.EnumType enum_value3 = 3;
+  if (this->_internal_enum_value3() != 0) {
+    ptr = ::_pbi::WireFormatLite::WriteEnumToArray(
+        3, this->_internal_enum_value3(), ptr);
+  }
+
+  target = stream->WriteRaw(
+      buffer, static_cast<int>(ptr - buffer), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestEnumValue)
+  return target;
+}
+
+::size_t TestEnumValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestEnumValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto3.EnumType enum_value1 = 1;
+  if (this->_internal_enum_value1() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value1());
+  }
+
+  // .proto3.EnumType enum_value2 = 2;
+  if (this->_internal_enum_value2() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value2());
+  }
+
+  // .proto3.EnumType enum_value3 = 3;
+  if (this->_internal_enum_value3() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_enum_value3());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestEnumValue::_class_data_ = {
+    TestEnumValue::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestEnumValue::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestEnumValue::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestEnumValue*>(&to_msg);
+  auto& from = static_cast<const TestEnumValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestEnumValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_enum_value1() != 0) {
+    _this->_internal_set_enum_value1(from._internal_enum_value1());
+  }
+  if (from._internal_enum_value2() != 0) {
+    _this->_internal_set_enum_value2(from._internal_enum_value2());
+  }
+  if (from._internal_enum_value3() != 0) {
+    _this->_internal_set_enum_value3(from._internal_enum_value3());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestEnumValue::CopyFrom(const TestEnumValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestEnumValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestEnumValue::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestEnumValue::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestEnumValue::InternalSwap(TestEnumValue* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value3_)
+      + sizeof(TestEnumValue::_impl_.enum_value3_)
+      - PROTOBUF_FIELD_OFFSET(TestEnumValue, _impl_.enum_value1_)>(
+          reinterpret_cast<char*>(&_impl_.enum_value1_),
+          reinterpret_cast<char*>(&other->_impl_.enum_value1_));
+}
+
+::google::protobuf::Metadata TestEnumValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[34]);
+}
+// ===================================================================
+
+class MapsTestCases::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MapsTestCases>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_._has_bits_);
+  static const ::proto3::EmptyMap& empty_map(const MapsTestCases* msg);
+  static void set_has_empty_map(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::proto3::StringtoInt& string_to_int(const MapsTestCases* msg);
+  static void set_has_string_to_int(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::proto3::IntToString& int_to_string(const MapsTestCases* msg);
+  static void set_has_int_to_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::proto3::Mixed1& mixed1(const MapsTestCases* msg);
+  static void set_has_mixed1(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::proto3::Mixed2& mixed2(const MapsTestCases* msg);
+  static void set_has_mixed2(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::proto3::MapOfObjects& map_of_objects(const MapsTestCases* msg);
+  static void set_has_map_of_objects(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::proto3::StringtoInt& empty_key_string_to_int1(const MapsTestCases* msg);
+  static void set_has_empty_key_string_to_int1(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::proto3::StringtoInt& empty_key_string_to_int2(const MapsTestCases* msg);
+  static void set_has_empty_key_string_to_int2(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::proto3::StringtoInt& empty_key_string_to_int3(const MapsTestCases* msg);
+  static void set_has_empty_key_string_to_int3(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::proto3::BoolToString& empty_key_bool_to_string(const MapsTestCases* msg);
+  static void set_has_empty_key_bool_to_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::proto3::IntToString& empty_key_int_to_string(const MapsTestCases* msg);
+  static void set_has_empty_key_int_to_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::proto3::Mixed1& empty_key_mixed(const MapsTestCases* msg);
+  static void set_has_empty_key_mixed(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::proto3::MapOfObjects& empty_key_map_objects(const MapsTestCases* msg);
+  static void set_has_empty_key_map_objects(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+};
+
+const ::proto3::EmptyMap& MapsTestCases::_Internal::empty_map(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_map_;
+}
+const ::proto3::StringtoInt& MapsTestCases::_Internal::string_to_int(const MapsTestCases* msg) {
+  return *msg->_impl_.string_to_int_;
+}
+const ::proto3::IntToString& MapsTestCases::_Internal::int_to_string(const MapsTestCases* msg) {
+  return *msg->_impl_.int_to_string_;
+}
+const ::proto3::Mixed1& MapsTestCases::_Internal::mixed1(const MapsTestCases* msg) {
+  return *msg->_impl_.mixed1_;
+}
+const ::proto3::Mixed2& MapsTestCases::_Internal::mixed2(const MapsTestCases* msg) {
+  return *msg->_impl_.mixed2_;
+}
+const ::proto3::MapOfObjects& MapsTestCases::_Internal::map_of_objects(const MapsTestCases* msg) {
+  return *msg->_impl_.map_of_objects_;
+}
+const ::proto3::StringtoInt& MapsTestCases::_Internal::empty_key_string_to_int1(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_string_to_int1_;
+}
+const ::proto3::StringtoInt& MapsTestCases::_Internal::empty_key_string_to_int2(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_string_to_int2_;
+}
+const ::proto3::StringtoInt& MapsTestCases::_Internal::empty_key_string_to_int3(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_string_to_int3_;
+}
+const ::proto3::BoolToString& MapsTestCases::_Internal::empty_key_bool_to_string(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_bool_to_string_;
+}
+const ::proto3::IntToString& MapsTestCases::_Internal::empty_key_int_to_string(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_int_to_string_;
+}
+const ::proto3::Mixed1& MapsTestCases::_Internal::empty_key_mixed(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_mixed_;
+}
+const ::proto3::MapOfObjects& MapsTestCases::_Internal::empty_key_map_objects(const MapsTestCases* msg) {
+  return *msg->_impl_.empty_key_map_objects_;
+}
+MapsTestCases::MapsTestCases(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapsTestCases)
+}
+inline PROTOBUF_NDEBUG_INLINE MapsTestCases::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+MapsTestCases::MapsTestCases(
+    ::google::protobuf::Arena* arena,
+    const MapsTestCases& from)
+    : ::google::protobuf::Message(arena) {
+  MapsTestCases* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.empty_map_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::proto3::EmptyMap>(arena, *from._impl_.empty_map_)
+                : nullptr;
+  _impl_.string_to_int_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::proto3::StringtoInt>(arena, *from._impl_.string_to_int_)
+                : nullptr;
+  _impl_.int_to_string_ = (cached_has_bits & 0x00000004u)
+                ? CreateMaybeMessage<::proto3::IntToString>(arena, *from._impl_.int_to_string_)
+                : nullptr;
+  _impl_.mixed1_ = (cached_has_bits & 0x00000008u)
+                ? CreateMaybeMessage<::proto3::Mixed1>(arena, *from._impl_.mixed1_)
+                : nullptr;
+  _impl_.mixed2_ = (cached_has_bits & 0x00000010u)
+                ? CreateMaybeMessage<::proto3::Mixed2>(arena, *from._impl_.mixed2_)
+                : nullptr;
+  _impl_.map_of_objects_ = (cached_has_bits & 0x00000020u)
+                ? CreateMaybeMessage<::proto3::MapOfObjects>(arena, *from._impl_.map_of_objects_)
+                : nullptr;
+  _impl_.empty_key_string_to_int1_ = (cached_has_bits & 0x00000040u)
+                ? CreateMaybeMessage<::proto3::StringtoInt>(arena, *from._impl_.empty_key_string_to_int1_)
+                : nullptr;
+  _impl_.empty_key_string_to_int2_ = (cached_has_bits & 0x00000080u)
+                ? CreateMaybeMessage<::proto3::StringtoInt>(arena, *from._impl_.empty_key_string_to_int2_)
+                : nullptr;
+  _impl_.empty_key_string_to_int3_ = (cached_has_bits & 0x00000100u)
+                ? CreateMaybeMessage<::proto3::StringtoInt>(arena, *from._impl_.empty_key_string_to_int3_)
+                : nullptr;
+  _impl_.empty_key_bool_to_string_ = (cached_has_bits & 0x00000200u)
+                ? CreateMaybeMessage<::proto3::BoolToString>(arena, *from._impl_.empty_key_bool_to_string_)
+                : nullptr;
+  _impl_.empty_key_int_to_string_ = (cached_has_bits & 0x00000400u)
+                ? CreateMaybeMessage<::proto3::IntToString>(arena, *from._impl_.empty_key_int_to_string_)
+                : nullptr;
+  _impl_.empty_key_mixed_ = (cached_has_bits & 0x00000800u)
+                ? CreateMaybeMessage<::proto3::Mixed1>(arena, *from._impl_.empty_key_mixed_)
+                : nullptr;
+  _impl_.empty_key_map_objects_ = (cached_has_bits & 0x00001000u)
+                ? CreateMaybeMessage<::proto3::MapOfObjects>(arena, *from._impl_.empty_key_map_objects_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapsTestCases)
+}
+inline PROTOBUF_NDEBUG_INLINE MapsTestCases::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void MapsTestCases::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, empty_map_),
+           0,
+           offsetof(Impl_, empty_key_map_objects_) -
+               offsetof(Impl_, empty_map_) +
+               sizeof(Impl_::empty_key_map_objects_));
+}
+MapsTestCases::~MapsTestCases() {
+  // @@protoc_insertion_point(destructor:proto3.MapsTestCases)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapsTestCases::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.empty_map_;
+  delete _impl_.string_to_int_;
+  delete _impl_.int_to_string_;
+  delete _impl_.mixed1_;
+  delete _impl_.mixed2_;
+  delete _impl_.map_of_objects_;
+  delete _impl_.empty_key_string_to_int1_;
+  delete _impl_.empty_key_string_to_int2_;
+  delete _impl_.empty_key_string_to_int3_;
+  delete _impl_.empty_key_bool_to_string_;
+  delete _impl_.empty_key_int_to_string_;
+  delete _impl_.empty_key_mixed_;
+  delete _impl_.empty_key_map_objects_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapsTestCases::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapsTestCases)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.empty_map_ != nullptr);
+      _impl_.empty_map_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.string_to_int_ != nullptr);
+      _impl_.string_to_int_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      ABSL_DCHECK(_impl_.int_to_string_ != nullptr);
+      _impl_.int_to_string_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      ABSL_DCHECK(_impl_.mixed1_ != nullptr);
+      _impl_.mixed1_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      ABSL_DCHECK(_impl_.mixed2_ != nullptr);
+      _impl_.mixed2_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      ABSL_DCHECK(_impl_.map_of_objects_ != nullptr);
+      _impl_.map_of_objects_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      ABSL_DCHECK(_impl_.empty_key_string_to_int1_ != nullptr);
+      _impl_.empty_key_string_to_int1_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      ABSL_DCHECK(_impl_.empty_key_string_to_int2_ != nullptr);
+      _impl_.empty_key_string_to_int2_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      ABSL_DCHECK(_impl_.empty_key_string_to_int3_ != nullptr);
+      _impl_.empty_key_string_to_int3_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      ABSL_DCHECK(_impl_.empty_key_bool_to_string_ != nullptr);
+      _impl_.empty_key_bool_to_string_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      ABSL_DCHECK(_impl_.empty_key_int_to_string_ != nullptr);
+      _impl_.empty_key_int_to_string_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      ABSL_DCHECK(_impl_.empty_key_mixed_ != nullptr);
+      _impl_.empty_key_mixed_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      ABSL_DCHECK(_impl_.empty_key_map_objects_ != nullptr);
+      _impl_.empty_key_map_objects_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapsTestCases::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<4, 13, 13, 0, 2> MapsTestCases::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_._has_bits_),
+    0, // no _extensions_
+    13, 120,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294959104,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    13,  // num_field_entries
+    13,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapsTestCases_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .proto3.EmptyMap empty_map = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_map_)}},
+    // .proto3.StringtoInt string_to_int = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.string_to_int_)}},
+    // .proto3.IntToString int_to_string = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 2, 2, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.int_to_string_)}},
+    // .proto3.Mixed1 mixed1 = 4;
+    {::_pbi::TcParser::FastMtS1,
+     {34, 3, 3, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.mixed1_)}},
+    // .proto3.Mixed2 mixed2 = 5;
+    {::_pbi::TcParser::FastMtS1,
+     {42, 4, 4, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.mixed2_)}},
+    // .proto3.MapOfObjects map_of_objects = 6;
+    {::_pbi::TcParser::FastMtS1,
+     {50, 5, 5, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.map_of_objects_)}},
+    // .proto3.StringtoInt empty_key_string_to_int1 = 7;
+    {::_pbi::TcParser::FastMtS1,
+     {58, 6, 6, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_string_to_int1_)}},
+    // .proto3.StringtoInt empty_key_string_to_int2 = 8;
+    {::_pbi::TcParser::FastMtS1,
+     {66, 7, 7, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_string_to_int2_)}},
+    // .proto3.StringtoInt empty_key_string_to_int3 = 9;
+    {::_pbi::TcParser::FastMtS1,
+     {74, 8, 8, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_string_to_int3_)}},
+    // .proto3.BoolToString empty_key_bool_to_string = 10;
+    {::_pbi::TcParser::FastMtS1,
+     {82, 9, 9, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_bool_to_string_)}},
+    // .proto3.IntToString empty_key_int_to_string = 11;
+    {::_pbi::TcParser::FastMtS1,
+     {90, 10, 10, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_int_to_string_)}},
+    // .proto3.Mixed1 empty_key_mixed = 12;
+    {::_pbi::TcParser::FastMtS1,
+     {98, 11, 11, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_mixed_)}},
+    // .proto3.MapOfObjects empty_key_map_objects = 13;
+    {::_pbi::TcParser::FastMtS1,
+     {106, 12, 12, PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_map_objects_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .proto3.EmptyMap empty_map = 1;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_map_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.StringtoInt string_to_int = 2;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.string_to_int_), _Internal::kHasBitsOffset + 1, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.IntToString int_to_string = 3;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.int_to_string_), _Internal::kHasBitsOffset + 2, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.Mixed1 mixed1 = 4;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.mixed1_), _Internal::kHasBitsOffset + 3, 3,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.Mixed2 mixed2 = 5;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.mixed2_), _Internal::kHasBitsOffset + 4, 4,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.MapOfObjects map_of_objects = 6;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.map_of_objects_), _Internal::kHasBitsOffset + 5, 5,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.StringtoInt empty_key_string_to_int1 = 7;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_string_to_int1_), _Internal::kHasBitsOffset + 6, 6,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.StringtoInt empty_key_string_to_int2 = 8;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_string_to_int2_), _Internal::kHasBitsOffset + 7, 7,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.StringtoInt empty_key_string_to_int3 = 9;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_string_to_int3_), _Internal::kHasBitsOffset + 8, 8,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.BoolToString empty_key_bool_to_string = 10;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_bool_to_string_), _Internal::kHasBitsOffset + 9, 9,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.IntToString empty_key_int_to_string = 11;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_int_to_string_), _Internal::kHasBitsOffset + 10, 10,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.Mixed1 empty_key_mixed = 12;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_mixed_), _Internal::kHasBitsOffset + 11, 11,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .proto3.MapOfObjects empty_key_map_objects = 13;
+    {PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_map_objects_), _Internal::kHasBitsOffset + 12, 12,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3::EmptyMap>()},
+    {::_pbi::TcParser::GetTable<::proto3::StringtoInt>()},
+    {::_pbi::TcParser::GetTable<::proto3::IntToString>()},
+    {::_pbi::TcParser::GetTable<::proto3::Mixed1>()},
+    {::_pbi::TcParser::GetTable<::proto3::Mixed2>()},
+    {::_pbi::TcParser::GetTable<::proto3::MapOfObjects>()},
+    {::_pbi::TcParser::GetTable<::proto3::StringtoInt>()},
+    {::_pbi::TcParser::GetTable<::proto3::StringtoInt>()},
+    {::_pbi::TcParser::GetTable<::proto3::StringtoInt>()},
+    {::_pbi::TcParser::GetTable<::proto3::BoolToString>()},
+    {::_pbi::TcParser::GetTable<::proto3::IntToString>()},
+    {::_pbi::TcParser::GetTable<::proto3::Mixed1>()},
+    {::_pbi::TcParser::GetTable<::proto3::MapOfObjects>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* MapsTestCases::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapsTestCases)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .proto3.EmptyMap empty_map = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::empty_map(this),
+        _Internal::empty_map(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.StringtoInt string_to_int = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::string_to_int(this),
+        _Internal::string_to_int(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.IntToString int_to_string = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::int_to_string(this),
+        _Internal::int_to_string(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.Mixed1 mixed1 = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        4, _Internal::mixed1(this),
+        _Internal::mixed1(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.Mixed2 mixed2 = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        5, _Internal::mixed2(this),
+        _Internal::mixed2(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.MapOfObjects map_of_objects = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        6, _Internal::map_of_objects(this),
+        _Internal::map_of_objects(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.StringtoInt empty_key_string_to_int1 = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        7, _Internal::empty_key_string_to_int1(this),
+        _Internal::empty_key_string_to_int1(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.StringtoInt empty_key_string_to_int2 = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        8, _Internal::empty_key_string_to_int2(this),
+        _Internal::empty_key_string_to_int2(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.StringtoInt empty_key_string_to_int3 = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        9, _Internal::empty_key_string_to_int3(this),
+        _Internal::empty_key_string_to_int3(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.BoolToString empty_key_bool_to_string = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        10, _Internal::empty_key_bool_to_string(this),
+        _Internal::empty_key_bool_to_string(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.IntToString empty_key_int_to_string = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        11, _Internal::empty_key_int_to_string(this),
+        _Internal::empty_key_int_to_string(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.Mixed1 empty_key_mixed = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        12, _Internal::empty_key_mixed(this),
+        _Internal::empty_key_mixed(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto3.MapOfObjects empty_key_map_objects = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        13, _Internal::empty_key_map_objects(this),
+        _Internal::empty_key_map_objects(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapsTestCases)
+  return target;
+}
+
+::size_t MapsTestCases::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapsTestCases)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // .proto3.EmptyMap empty_map = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_map_);
+    }
+
+    // .proto3.StringtoInt string_to_int = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.string_to_int_);
+    }
+
+    // .proto3.IntToString int_to_string = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.int_to_string_);
+    }
+
+    // .proto3.Mixed1 mixed1 = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.mixed1_);
+    }
+
+    // .proto3.Mixed2 mixed2 = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.mixed2_);
+    }
+
+    // .proto3.MapOfObjects map_of_objects = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.map_of_objects_);
+    }
+
+    // .proto3.StringtoInt empty_key_string_to_int1 = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_string_to_int1_);
+    }
+
+    // .proto3.StringtoInt empty_key_string_to_int2 = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_string_to_int2_);
+    }
+
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    // .proto3.StringtoInt empty_key_string_to_int3 = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_string_to_int3_);
+    }
+
+    // .proto3.BoolToString empty_key_bool_to_string = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_bool_to_string_);
+    }
+
+    // .proto3.IntToString empty_key_int_to_string = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_int_to_string_);
+    }
+
+    // .proto3.Mixed1 empty_key_mixed = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_mixed_);
+    }
+
+    // .proto3.MapOfObjects empty_key_map_objects = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.empty_key_map_objects_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapsTestCases::_class_data_ = {
+    MapsTestCases::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapsTestCases::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapsTestCases::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapsTestCases*>(&to_msg);
+  auto& from = static_cast<const MapsTestCases&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapsTestCases)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_empty_map()->::proto3::EmptyMap::MergeFrom(
+          from._internal_empty_map());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_string_to_int()->::proto3::StringtoInt::MergeFrom(
+          from._internal_string_to_int());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_int_to_string()->::proto3::IntToString::MergeFrom(
+          from._internal_int_to_string());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_mixed1()->::proto3::Mixed1::MergeFrom(
+          from._internal_mixed1());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_mixed2()->::proto3::Mixed2::MergeFrom(
+          from._internal_mixed2());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_map_of_objects()->::proto3::MapOfObjects::MergeFrom(
+          from._internal_map_of_objects());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_empty_key_string_to_int1()->::proto3::StringtoInt::MergeFrom(
+          from._internal_empty_key_string_to_int1());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_empty_key_string_to_int2()->::proto3::StringtoInt::MergeFrom(
+          from._internal_empty_key_string_to_int2());
+    }
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_empty_key_string_to_int3()->::proto3::StringtoInt::MergeFrom(
+          from._internal_empty_key_string_to_int3());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_empty_key_bool_to_string()->::proto3::BoolToString::MergeFrom(
+          from._internal_empty_key_bool_to_string());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_empty_key_int_to_string()->::proto3::IntToString::MergeFrom(
+          from._internal_empty_key_int_to_string());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_empty_key_mixed()->::proto3::Mixed1::MergeFrom(
+          from._internal_empty_key_mixed());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_internal_mutable_empty_key_map_objects()->::proto3::MapOfObjects::MergeFrom(
+          from._internal_empty_key_map_objects());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapsTestCases::CopyFrom(const MapsTestCases& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapsTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapsTestCases::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapsTestCases::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapsTestCases::InternalSwap(MapsTestCases* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_key_map_objects_)
+      + sizeof(MapsTestCases::_impl_.empty_key_map_objects_)
+      - PROTOBUF_FIELD_OFFSET(MapsTestCases, _impl_.empty_map_)>(
+          reinterpret_cast<char*>(&_impl_.empty_map_),
+          reinterpret_cast<char*>(&other->_impl_.empty_map_));
+}
+
+::google::protobuf::Metadata MapsTestCases::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[35]);
+}
+// ===================================================================
+
+EmptyMap_MapEntry_DoNotUse::EmptyMap_MapEntry_DoNotUse() {}
+EmptyMap_MapEntry_DoNotUse::EmptyMap_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata EmptyMap_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[36]);
+}
+// ===================================================================
+
+class EmptyMap::_Internal {
+ public:
+};
+
+EmptyMap::EmptyMap(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.EmptyMap)
+}
+inline PROTOBUF_NDEBUG_INLINE EmptyMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        _cached_size_{0} {}
+
+EmptyMap::EmptyMap(
+    ::google::protobuf::Arena* arena,
+    const EmptyMap& from)
+    : ::google::protobuf::Message(arena) {
+  EmptyMap* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.EmptyMap)
+}
+inline PROTOBUF_NDEBUG_INLINE EmptyMap::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void EmptyMap::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+EmptyMap::~EmptyMap() {
+  // @@protoc_insertion_point(destructor:proto3.EmptyMap)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void EmptyMap::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void EmptyMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.EmptyMap)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* EmptyMap::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> EmptyMap::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_EmptyMap_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, int32> map = 1;
+    {PROTOBUF_FIELD_OFFSET(EmptyMap, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(EmptyMap()._impl_.map_)>(
+        1, 0, 0, 5,
+        5)},
+  }}, {{
+  }},
+};
+
+::uint8_t* EmptyMap::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.EmptyMap)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, int32> map = 1;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.EmptyMap)
+  return target;
+}
+
+::size_t EmptyMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.EmptyMap)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData EmptyMap::_class_data_ = {
+    EmptyMap::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* EmptyMap::GetClassData() const {
+  return &_class_data_;
+}
+
+void EmptyMap::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<EmptyMap*>(&to_msg);
+  auto& from = static_cast<const EmptyMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.EmptyMap)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EmptyMap::CopyFrom(const EmptyMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.EmptyMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool EmptyMap::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* EmptyMap::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void EmptyMap::InternalSwap(EmptyMap* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+}
+
+::google::protobuf::Metadata EmptyMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[37]);
+}
+// ===================================================================
+
+StringtoInt_MapEntry_DoNotUse::StringtoInt_MapEntry_DoNotUse() {}
+StringtoInt_MapEntry_DoNotUse::StringtoInt_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata StringtoInt_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[38]);
+}
+// ===================================================================
+
+class StringtoInt::_Internal {
+ public:
+};
+
+StringtoInt::StringtoInt(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.StringtoInt)
+}
+inline PROTOBUF_NDEBUG_INLINE StringtoInt::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        _cached_size_{0} {}
+
+StringtoInt::StringtoInt(
+    ::google::protobuf::Arena* arena,
+    const StringtoInt& from)
+    : ::google::protobuf::Message(arena) {
+  StringtoInt* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.StringtoInt)
+}
+inline PROTOBUF_NDEBUG_INLINE StringtoInt::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void StringtoInt::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+StringtoInt::~StringtoInt() {
+  // @@protoc_insertion_point(destructor:proto3.StringtoInt)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void StringtoInt::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void StringtoInt::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.StringtoInt)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* StringtoInt::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 30, 2> StringtoInt::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_StringtoInt_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, int32> map = 1;
+    {PROTOBUF_FIELD_OFFSET(StringtoInt, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(StringtoInt()._impl_.map_)>(
+        1, 0, 0, 9,
+        5)},
+  }}, {{
+    "\22\3\0\0\0\0\0\0"
+    "proto3.StringtoInt"
+    "map"
+  }},
+};
+
+::uint8_t* StringtoInt::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.StringtoInt)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, int32> map = 1;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.StringtoInt.map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.StringtoInt.map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.StringtoInt)
+  return target;
+}
+
+::size_t StringtoInt::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.StringtoInt)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, int32> map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData StringtoInt::_class_data_ = {
+    StringtoInt::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* StringtoInt::GetClassData() const {
+  return &_class_data_;
+}
+
+void StringtoInt::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StringtoInt*>(&to_msg);
+  auto& from = static_cast<const StringtoInt&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.StringtoInt)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StringtoInt::CopyFrom(const StringtoInt& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.StringtoInt)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool StringtoInt::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* StringtoInt::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void StringtoInt::InternalSwap(StringtoInt* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+}
+
+::google::protobuf::Metadata StringtoInt::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[39]);
+}
+// ===================================================================
+
+IntToString_MapEntry_DoNotUse::IntToString_MapEntry_DoNotUse() {}
+IntToString_MapEntry_DoNotUse::IntToString_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata IntToString_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[40]);
+}
+// ===================================================================
+
+class IntToString::_Internal {
+ public:
+};
+
+IntToString::IntToString(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.IntToString)
+}
+inline PROTOBUF_NDEBUG_INLINE IntToString::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        _cached_size_{0} {}
+
+IntToString::IntToString(
+    ::google::protobuf::Arena* arena,
+    const IntToString& from)
+    : ::google::protobuf::Message(arena) {
+  IntToString* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.IntToString)
+}
+inline PROTOBUF_NDEBUG_INLINE IntToString::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void IntToString::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+IntToString::~IntToString() {
+  // @@protoc_insertion_point(destructor:proto3.IntToString)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void IntToString::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void IntToString::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.IntToString)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* IntToString::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 30, 2> IntToString::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_IntToString_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, string> map = 1;
+    {PROTOBUF_FIELD_OFFSET(IntToString, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(IntToString()._impl_.map_)>(
+        1, 0, 0, 5,
+        9)},
+  }}, {{
+    "\22\3\0\0\0\0\0\0"
+    "proto3.IntToString"
+    "map"
+  }},
+};
+
+::uint8_t* IntToString::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.IntToString)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, string> map = 1;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.IntToString.map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.IntToString.map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.IntToString)
+  return target;
+}
+
+::size_t IntToString::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.IntToString)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, string> map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData IntToString::_class_data_ = {
+    IntToString::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* IntToString::GetClassData() const {
+  return &_class_data_;
+}
+
+void IntToString::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<IntToString*>(&to_msg);
+  auto& from = static_cast<const IntToString&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.IntToString)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IntToString::CopyFrom(const IntToString& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.IntToString)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool IntToString::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* IntToString::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void IntToString::InternalSwap(IntToString* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+}
+
+::google::protobuf::Metadata IntToString::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[41]);
+}
+// ===================================================================
+
+BoolToString_MapEntry_DoNotUse::BoolToString_MapEntry_DoNotUse() {}
+BoolToString_MapEntry_DoNotUse::BoolToString_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata BoolToString_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[42]);
+}
+// ===================================================================
+
+class BoolToString::_Internal {
+ public:
+};
+
+BoolToString::BoolToString(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.BoolToString)
+}
+inline PROTOBUF_NDEBUG_INLINE BoolToString::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        _cached_size_{0} {}
+
+BoolToString::BoolToString(
+    ::google::protobuf::Arena* arena,
+    const BoolToString& from)
+    : ::google::protobuf::Message(arena) {
+  BoolToString* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.BoolToString)
+}
+inline PROTOBUF_NDEBUG_INLINE BoolToString::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void BoolToString::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+BoolToString::~BoolToString() {
+  // @@protoc_insertion_point(destructor:proto3.BoolToString)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void BoolToString::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void BoolToString::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.BoolToString)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* BoolToString::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 31, 2> BoolToString::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_BoolToString_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<bool, string> map = 1;
+    {PROTOBUF_FIELD_OFFSET(BoolToString, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(BoolToString()._impl_.map_)>(
+        1, 0, 0, 8,
+        9)},
+  }}, {{
+    "\23\3\0\0\0\0\0\0"
+    "proto3.BoolToString"
+    "map"
+  }},
+};
+
+::uint8_t* BoolToString::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.BoolToString)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<bool, string> map = 1;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<bool, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, std::string,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.BoolToString.map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.BoolToString.map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.BoolToString)
+  return target;
+}
+
+::size_t BoolToString::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.BoolToString)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, string> map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<bool, std::string,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData BoolToString::_class_data_ = {
+    BoolToString::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* BoolToString::GetClassData() const {
+  return &_class_data_;
+}
+
+void BoolToString::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<BoolToString*>(&to_msg);
+  auto& from = static_cast<const BoolToString&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.BoolToString)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BoolToString::CopyFrom(const BoolToString& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.BoolToString)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool BoolToString::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* BoolToString::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void BoolToString::InternalSwap(BoolToString* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+}
+
+::google::protobuf::Metadata BoolToString::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[43]);
+}
+// ===================================================================
+
+Mixed1_MapEntry_DoNotUse::Mixed1_MapEntry_DoNotUse() {}
+Mixed1_MapEntry_DoNotUse::Mixed1_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata Mixed1_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[44]);
+}
+// ===================================================================
+
+class Mixed1::_Internal {
+ public:
+};
+
+Mixed1::Mixed1(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.Mixed1)
+}
+inline PROTOBUF_NDEBUG_INLINE Mixed1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        msg_(arena, from.msg_),
+        _cached_size_{0} {}
+
+Mixed1::Mixed1(
+    ::google::protobuf::Arena* arena,
+    const Mixed1& from)
+    : ::google::protobuf::Message(arena) {
+  Mixed1* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.Mixed1)
+}
+inline PROTOBUF_NDEBUG_INLINE Mixed1::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        msg_(arena),
+        _cached_size_{0} {}
+
+inline void Mixed1::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+Mixed1::~Mixed1() {
+  // @@protoc_insertion_point(destructor:proto3.Mixed1)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Mixed1::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.msg_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Mixed1::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.Mixed1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _impl_.msg_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Mixed1::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 1, 28, 2> Mixed1::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_Mixed1_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string msg = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Mixed1, _impl_.msg_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string msg = 1;
+    {PROTOBUF_FIELD_OFFSET(Mixed1, _impl_.msg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // map<string, float> map = 2;
+    {PROTOBUF_FIELD_OFFSET(Mixed1, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(Mixed1()._impl_.map_)>(
+        1, 0, 0, 9,
+        2)},
+  }}, {{
+    "\15\3\3\0\0\0\0\0"
+    "proto3.Mixed1"
+    "msg"
+    "map"
+  }},
+};
+
+::uint8_t* Mixed1::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.Mixed1)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string msg = 1;
+  if (!this->_internal_msg().empty()) {
+    const std::string& _s = this->_internal_msg();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.Mixed1.msg");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // map<string, float> map = 2;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, float>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, float,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_FLOAT>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.Mixed1.map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.Mixed1.map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.Mixed1)
+  return target;
+}
+
+::size_t Mixed1::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.Mixed1)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, float> map = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, float,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_FLOAT>::ByteSizeLong(entry.first, entry.second);
+  }
+  // string msg = 1;
+  if (!this->_internal_msg().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_msg());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Mixed1::_class_data_ = {
+    Mixed1::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Mixed1::GetClassData() const {
+  return &_class_data_;
+}
+
+void Mixed1::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Mixed1*>(&to_msg);
+  auto& from = static_cast<const Mixed1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.Mixed1)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Mixed1::CopyFrom(const Mixed1& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.Mixed1)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Mixed1::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* Mixed1::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Mixed1::InternalSwap(Mixed1* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
+}
+
+::google::protobuf::Metadata Mixed1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[45]);
+}
+// ===================================================================
+
+Mixed2_MapEntry_DoNotUse::Mixed2_MapEntry_DoNotUse() {}
+Mixed2_MapEntry_DoNotUse::Mixed2_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata Mixed2_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[46]);
+}
+// ===================================================================
+
+class Mixed2::_Internal {
+ public:
+};
+
+Mixed2::Mixed2(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.Mixed2)
+}
+inline PROTOBUF_NDEBUG_INLINE Mixed2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        _cached_size_{0} {}
+
+Mixed2::Mixed2(
+    ::google::protobuf::Arena* arena,
+    const Mixed2& from)
+    : ::google::protobuf::Message(arena) {
+  Mixed2* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.ee_ = from._impl_.ee_;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.Mixed2)
+}
+inline PROTOBUF_NDEBUG_INLINE Mixed2::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void Mixed2::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.ee_ = {};
+}
+Mixed2::~Mixed2() {
+  // @@protoc_insertion_point(destructor:proto3.Mixed2)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Mixed2::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Mixed2::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.Mixed2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _impl_.ee_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Mixed2::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 2, 1, 0, 2> Mixed2::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_Mixed2_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .proto3.Mixed2.E ee = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Mixed2, _impl_.ee_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(Mixed2, _impl_.ee_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<int32, bool> map = 1;
+    {PROTOBUF_FIELD_OFFSET(Mixed2, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // .proto3.Mixed2.E ee = 2;
+    {PROTOBUF_FIELD_OFFSET(Mixed2, _impl_.ee_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(Mixed2()._impl_.map_)>(
+        1, 0, 0, 5,
+        8)},
+  }}, {{
+  }},
+};
+
+::uint8_t* Mixed2::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.Mixed2)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<int32, bool> map = 1;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, bool>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, bool,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BOOL>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // .proto3.Mixed2.E ee = 2;
+  if (this->_internal_ee() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, this->_internal_ee(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.Mixed2)
+  return target;
+}
+
+::size_t Mixed2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.Mixed2)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, bool> map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, bool,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_BOOL>::ByteSizeLong(entry.first, entry.second);
+  }
+  // .proto3.Mixed2.E ee = 2;
+  if (this->_internal_ee() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_ee());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Mixed2::_class_data_ = {
+    Mixed2::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Mixed2::GetClassData() const {
+  return &_class_data_;
+}
+
+void Mixed2::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Mixed2*>(&to_msg);
+  auto& from = static_cast<const Mixed2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.Mixed2)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  if (from._internal_ee() != 0) {
+    _this->_internal_set_ee(from._internal_ee());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Mixed2::CopyFrom(const Mixed2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.Mixed2)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Mixed2::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* Mixed2::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Mixed2::InternalSwap(Mixed2* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+  swap(_impl_.ee_, other->_impl_.ee_);
+}
+
+::google::protobuf::Metadata Mixed2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[47]);
+}
+// ===================================================================
+
+class MapOfObjects_M::_Internal {
+ public:
+};
+
+MapOfObjects_M::MapOfObjects_M(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOfObjects.M)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOfObjects_M::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : inner_text_(arena, from.inner_text_),
+        _cached_size_{0} {}
+
+MapOfObjects_M::MapOfObjects_M(
+    ::google::protobuf::Arena* arena,
+    const MapOfObjects_M& from)
+    : ::google::protobuf::Message(arena) {
+  MapOfObjects_M* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOfObjects.M)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOfObjects_M::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : inner_text_(arena),
+        _cached_size_{0} {}
+
+inline void MapOfObjects_M::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapOfObjects_M::~MapOfObjects_M() {
+  // @@protoc_insertion_point(destructor:proto3.MapOfObjects.M)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOfObjects_M::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.inner_text_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOfObjects_M::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOfObjects.M)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.inner_text_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOfObjects_M::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 40, 2> MapOfObjects_M::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MapOfObjects_M_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string inner_text = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(MapOfObjects_M, _impl_.inner_text_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string inner_text = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOfObjects_M, _impl_.inner_text_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\25\12\0\0\0\0\0\0"
+    "proto3.MapOfObjects.M"
+    "inner_text"
+  }},
+};
+
+::uint8_t* MapOfObjects_M::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOfObjects.M)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string inner_text = 1;
+  if (!this->_internal_inner_text().empty()) {
+    const std::string& _s = this->_internal_inner_text();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOfObjects.M.inner_text");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOfObjects.M)
+  return target;
+}
+
+::size_t MapOfObjects_M::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOfObjects.M)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string inner_text = 1;
+  if (!this->_internal_inner_text().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_inner_text());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOfObjects_M::_class_data_ = {
+    MapOfObjects_M::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOfObjects_M::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOfObjects_M::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOfObjects_M*>(&to_msg);
+  auto& from = static_cast<const MapOfObjects_M&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOfObjects.M)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_inner_text().empty()) {
+    _this->_internal_set_inner_text(from._internal_inner_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOfObjects_M::CopyFrom(const MapOfObjects_M& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOfObjects.M)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOfObjects_M::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOfObjects_M::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOfObjects_M::InternalSwap(MapOfObjects_M* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.inner_text_, &other->_impl_.inner_text_, arena);
+}
+
+::google::protobuf::Metadata MapOfObjects_M::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[48]);
+}
+// ===================================================================
+
+MapOfObjects_MapEntry_DoNotUse::MapOfObjects_MapEntry_DoNotUse() {}
+MapOfObjects_MapEntry_DoNotUse::MapOfObjects_MapEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapOfObjects_MapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[49]);
+}
+// ===================================================================
+
+class MapOfObjects::_Internal {
+ public:
+};
+
+MapOfObjects::MapOfObjects(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOfObjects)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOfObjects::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map_{visibility, arena, from.map_},
+        _cached_size_{0} {}
+
+MapOfObjects::MapOfObjects(
+    ::google::protobuf::Arena* arena,
+    const MapOfObjects& from)
+    : ::google::protobuf::Message(arena) {
+  MapOfObjects* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOfObjects)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOfObjects::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void MapOfObjects::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapOfObjects::~MapOfObjects() {
+  // @@protoc_insertion_point(destructor:proto3.MapOfObjects)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOfObjects::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOfObjects::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOfObjects)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOfObjects::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 31, 2> MapOfObjects::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapOfObjects_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, .proto3.MapOfObjects.M> map = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOfObjects, _impl_.map_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapOfObjects()._impl_.map_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::proto3::MapOfObjects_M>},
+  }}, {{
+    "\23\3\0\0\0\0\0\0"
+    "proto3.MapOfObjects"
+    "map"
+  }},
+};
+
+::uint8_t* MapOfObjects::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOfObjects)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, .proto3.MapOfObjects.M> map = 1;
+  if (!_internal_map().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::proto3::MapOfObjects_M,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOfObjects.map");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOfObjects.map");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOfObjects)
+  return target;
+}
+
+::size_t MapOfObjects::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOfObjects)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .proto3.MapOfObjects.M> map = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_size());
+  for (const auto& entry : _internal_map()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::proto3::MapOfObjects_M,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOfObjects::_class_data_ = {
+    MapOfObjects::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOfObjects::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOfObjects::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOfObjects*>(&to_msg);
+  auto& from = static_cast<const MapOfObjects&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOfObjects)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map_.MergeFrom(from._impl_.map_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOfObjects::CopyFrom(const MapOfObjects& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOfObjects)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOfObjects::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOfObjects::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOfObjects::InternalSwap(MapOfObjects* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map_.InternalSwap(&other->_impl_.map_);
+}
+
+::google::protobuf::Metadata MapOfObjects::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[50]);
+}
+// ===================================================================
+
+MapIn_MapInputEntry_DoNotUse::MapIn_MapInputEntry_DoNotUse() {}
+MapIn_MapInputEntry_DoNotUse::MapIn_MapInputEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapIn_MapInputEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[51]);
+}
+// ===================================================================
+
+MapIn_MapAnyEntry_DoNotUse::MapIn_MapAnyEntry_DoNotUse() {}
+MapIn_MapAnyEntry_DoNotUse::MapIn_MapAnyEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapIn_MapAnyEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[52]);
+}
+// ===================================================================
+
+class MapIn::_Internal {
+ public:
+};
+
+void MapIn::clear_map_any() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_any_.Clear();
+}
+MapIn::MapIn(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapIn)
+}
+inline PROTOBUF_NDEBUG_INLINE MapIn::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : things_{visibility, arena, from.things_},
+        map_input_{visibility, arena, from.map_input_},
+        map_any_{visibility, arena, from.map_any_},
+        other_(arena, from.other_),
+        _cached_size_{0} {}
+
+MapIn::MapIn(
+    ::google::protobuf::Arena* arena,
+    const MapIn& from)
+    : ::google::protobuf::Message(arena) {
+  MapIn* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapIn)
+}
+inline PROTOBUF_NDEBUG_INLINE MapIn::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : things_{visibility, arena},
+        map_input_{visibility, arena},
+        map_any_{visibility, arena},
+        other_(arena),
+        _cached_size_{0} {}
+
+inline void MapIn::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapIn::~MapIn() {
+  // @@protoc_insertion_point(destructor:proto3.MapIn)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapIn::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.other_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapIn::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapIn)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.things_.Clear();
+  _impl_.map_input_.Clear();
+  _impl_.map_any_.Clear();
+  _impl_.other_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapIn::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 4, 3, 48, 2> MapIn::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    4, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    3,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapIn_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated string things = 2;
+    {::_pbi::TcParser::FastUR1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(MapIn, _impl_.things_)}},
+    // string other = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(MapIn, _impl_.other_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string other = 1;
+    {PROTOBUF_FIELD_OFFSET(MapIn, _impl_.other_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // repeated string things = 2;
+    {PROTOBUF_FIELD_OFFSET(MapIn, _impl_.things_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
+    // map<string, string> map_input = 3;
+    {PROTOBUF_FIELD_OFFSET(MapIn, _impl_.map_input_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .google.protobuf.Any> map_any = 4;
+    {PROTOBUF_FIELD_OFFSET(MapIn, _impl_.map_any_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapIn()._impl_.map_input_)>(
+        1, 0, 0, 9,
+        9)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapIn()._impl_.map_any_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::google::protobuf::Any>},
+  }}, {{
+    "\14\5\6\11\7\0\0\0"
+    "proto3.MapIn"
+    "other"
+    "things"
+    "map_input"
+    "map_any"
+  }},
+};
+
+::uint8_t* MapIn::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapIn)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string other = 1;
+  if (!this->_internal_other().empty()) {
+    const std::string& _s = this->_internal_other();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.other");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // repeated string things = 2;
+  for (int i = 0, n = this->_internal_things_size(); i < n; ++i) {
+    const auto& s = this->_internal_things().Get(i);
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.things");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // map<string, string> map_input = 3;
+  if (!_internal_map_input().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map_input();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.map_input");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.map_input");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.map_input");
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.map_input");
+      }
+    }
+  }
+
+  // map<string, .google.protobuf.Any> map_any = 4;
+  if (!_internal_map_any().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::google::protobuf::Any>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::google::protobuf::Any,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map_any();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.map_any");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            4, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapIn.map_any");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapIn)
+  return target;
+}
+
+::size_t MapIn::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapIn)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string things = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_things().size());
+  for (int i = 0, n = _internal_things().size(); i < n; ++i) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+        _internal_things().Get(i));
+  }
+  // map<string, string> map_input = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_input_size());
+  for (const auto& entry : _internal_map_input()) {
+    total_size += _pbi::MapEntryFuncs<std::string, std::string,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .google.protobuf.Any> map_any = 4;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map_any_size());
+  for (const auto& entry : _internal_map_any()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::google::protobuf::Any,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // string other = 1;
+  if (!this->_internal_other().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_other());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapIn::_class_data_ = {
+    MapIn::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapIn::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapIn::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapIn*>(&to_msg);
+  auto& from = static_cast<const MapIn&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapIn)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_things()->MergeFrom(from._internal_things());
+  _this->_impl_.map_input_.MergeFrom(from._impl_.map_input_);
+  _this->_impl_.map_any_.MergeFrom(from._impl_.map_any_);
+  if (!from._internal_other().empty()) {
+    _this->_internal_set_other(from._internal_other());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapIn::CopyFrom(const MapIn& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapIn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapIn::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapIn::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapIn::InternalSwap(MapIn* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.things_.InternalSwap(&other->_impl_.things_);
+  _impl_.map_input_.InternalSwap(&other->_impl_.map_input_);
+  _impl_.map_any_.InternalSwap(&other->_impl_.map_any_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.other_, &other->_impl_.other_, arena);
+}
+
+::google::protobuf::Metadata MapIn::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[53]);
+}
+// ===================================================================
+
+MapOut_Map1Entry_DoNotUse::MapOut_Map1Entry_DoNotUse() {}
+MapOut_Map1Entry_DoNotUse::MapOut_Map1Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapOut_Map1Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[54]);
+}
+// ===================================================================
+
+MapOut_Map2Entry_DoNotUse::MapOut_Map2Entry_DoNotUse() {}
+MapOut_Map2Entry_DoNotUse::MapOut_Map2Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapOut_Map2Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[55]);
+}
+// ===================================================================
+
+MapOut_Map3Entry_DoNotUse::MapOut_Map3Entry_DoNotUse() {}
+MapOut_Map3Entry_DoNotUse::MapOut_Map3Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapOut_Map3Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[56]);
+}
+// ===================================================================
+
+MapOut_Map4Entry_DoNotUse::MapOut_Map4Entry_DoNotUse() {}
+MapOut_Map4Entry_DoNotUse::MapOut_Map4Entry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata MapOut_Map4Entry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[57]);
+}
+// ===================================================================
+
+class MapOut::_Internal {
+ public:
+};
+
+MapOut::MapOut(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOut)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOut::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map1_{visibility, arena, from.map1_},
+        map2_{visibility, arena, from.map2_},
+        map3_{visibility, arena, from.map3_},
+        map4_{visibility, arena, from.map4_},
+        bar_(arena, from.bar_),
+        _cached_size_{0} {}
+
+MapOut::MapOut(
+    ::google::protobuf::Arena* arena,
+    const MapOut& from)
+    : ::google::protobuf::Message(arena) {
+  MapOut* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOut)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOut::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map1_{visibility, arena},
+        map2_{visibility, arena},
+        map3_{visibility, arena},
+        map4_{visibility, arena},
+        bar_(arena),
+        _cached_size_{0} {}
+
+inline void MapOut::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapOut::~MapOut() {
+  // @@protoc_insertion_point(destructor:proto3.MapOut)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOut::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.bar_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOut::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOut)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map1_.Clear();
+  _impl_.map2_.Clear();
+  _impl_.map3_.Clear();
+  _impl_.map4_.Clear();
+  _impl_.bar_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOut::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 5, 6, 41, 2> MapOut::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    5, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    6,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapOut_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string bar = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(MapOut, _impl_.bar_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, .proto3.MapM> map1 = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOut, _impl_.map1_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<string, .proto3.MapOut> map2 = 2;
+    {PROTOBUF_FIELD_OFFSET(MapOut, _impl_.map2_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // map<int32, string> map3 = 3;
+    {PROTOBUF_FIELD_OFFSET(MapOut, _impl_.map3_), 0, 4,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+    // string bar = 4;
+    {PROTOBUF_FIELD_OFFSET(MapOut, _impl_.bar_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // map<bool, string> map4 = 5;
+    {PROTOBUF_FIELD_OFFSET(MapOut, _impl_.map4_), 0, 5,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapOut()._impl_.map1_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::proto3::MapM>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapOut()._impl_.map2_)>(
+        1, 0, 0, 9,
+        11)},
+    {::_pbi::TcParser::CreateInArenaStorageCb<::proto3::MapOut>},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapOut()._impl_.map3_)>(
+        1, 0, 0, 5,
+        9)},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(MapOut()._impl_.map4_)>(
+        1, 0, 0, 8,
+        9)},
+  }}, {{
+    "\15\4\4\4\3\4\0\0"
+    "proto3.MapOut"
+    "map1"
+    "map2"
+    "map3"
+    "bar"
+    "map4"
+  }},
+};
+
+::uint8_t* MapOut::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOut)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // map<string, .proto3.MapM> map1 = 1;
+  if (!_internal_map1().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::proto3::MapM>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::proto3::MapM,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map1();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map1");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            1, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map1");
+      }
+    }
+  }
+
+  // map<string, .proto3.MapOut> map2 = 2;
+  if (!_internal_map2().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::proto3::MapOut>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::proto3::MapOut,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>;
+    const auto& field = _internal_map2();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map2");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            2, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map2");
+      }
+    }
+  }
+
+  // map<int32, string> map3 = 3;
+  if (!_internal_map3().empty()) {
+    using MapType = ::google::protobuf::Map<::int32_t, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map3();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map3");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            3, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map3");
+      }
+    }
+  }
+
+  // string bar = 4;
+  if (!this->_internal_bar().empty()) {
+    const std::string& _s = this->_internal_bar();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.bar");
+    target = stream->WriteStringMaybeAliased(4, _s, target);
+  }
+
+  // map<bool, string> map4 = 5;
+  if (!_internal_map4().empty()) {
+    using MapType = ::google::protobuf::Map<bool, std::string>;
+    using WireHelper = _pbi::MapEntryFuncs<bool, std::string,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_STRING>;
+    const auto& field = _internal_map4();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterFlat<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map4");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            5, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            entry.second.data(), static_cast<int>(entry.second.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOut.map4");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOut)
+  return target;
+}
+
+::size_t MapOut::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOut)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .proto3.MapM> map1 = 1;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map1_size());
+  for (const auto& entry : _internal_map1()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::proto3::MapM,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<string, .proto3.MapOut> map2 = 2;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map2_size());
+  for (const auto& entry : _internal_map2()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::proto3::MapOut,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<int32, string> map3 = 3;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map3_size());
+  for (const auto& entry : _internal_map3()) {
+    total_size += _pbi::MapEntryFuncs<::int32_t, std::string,
+                                   _pbi::WireFormatLite::TYPE_INT32,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // map<bool, string> map4 = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_map4_size());
+  for (const auto& entry : _internal_map4()) {
+    total_size += _pbi::MapEntryFuncs<bool, std::string,
+                                   _pbi::WireFormatLite::TYPE_BOOL,
+                                   _pbi::WireFormatLite::TYPE_STRING>::ByteSizeLong(entry.first, entry.second);
+  }
+  // string bar = 4;
+  if (!this->_internal_bar().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_bar());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOut::_class_data_ = {
+    MapOut::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOut::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOut::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOut*>(&to_msg);
+  auto& from = static_cast<const MapOut&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOut)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.map1_.MergeFrom(from._impl_.map1_);
+  _this->_impl_.map2_.MergeFrom(from._impl_.map2_);
+  _this->_impl_.map3_.MergeFrom(from._impl_.map3_);
+  _this->_impl_.map4_.MergeFrom(from._impl_.map4_);
+  if (!from._internal_bar().empty()) {
+    _this->_internal_set_bar(from._internal_bar());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOut::CopyFrom(const MapOut& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOut)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOut::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOut::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOut::InternalSwap(MapOut* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map1_.InternalSwap(&other->_impl_.map1_);
+  _impl_.map2_.InternalSwap(&other->_impl_.map2_);
+  _impl_.map3_.InternalSwap(&other->_impl_.map3_);
+  _impl_.map4_.InternalSwap(&other->_impl_.map4_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.bar_, &other->_impl_.bar_, arena);
+}
+
+::google::protobuf::Metadata MapOut::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[58]);
+}
+// ===================================================================
+
+class MapOutWireFormat_Map1Entry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MapOutWireFormat_Map1Entry>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map1Entry, _impl_._has_bits_);
+  static const ::proto3::MapM& value(const MapOutWireFormat_Map1Entry* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::proto3::MapM& MapOutWireFormat_Map1Entry::_Internal::value(const MapOutWireFormat_Map1Entry* msg) {
+  return *msg->_impl_.value_;
+}
+MapOutWireFormat_Map1Entry::MapOutWireFormat_Map1Entry(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOutWireFormat.Map1Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map1Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        key_(arena, from.key_) {}
+
+MapOutWireFormat_Map1Entry::MapOutWireFormat_Map1Entry(
+    ::google::protobuf::Arena* arena,
+    const MapOutWireFormat_Map1Entry& from)
+    : ::google::protobuf::Message(arena) {
+  MapOutWireFormat_Map1Entry* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::proto3::MapM>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOutWireFormat.Map1Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map1Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        key_(arena) {}
+
+inline void MapOutWireFormat_Map1Entry::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+MapOutWireFormat_Map1Entry::~MapOutWireFormat_Map1Entry() {
+  // @@protoc_insertion_point(destructor:proto3.MapOutWireFormat.Map1Entry)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOutWireFormat_Map1Entry::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.key_.Destroy();
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOutWireFormat_Map1Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOutWireFormat.Map1Entry)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOutWireFormat_Map1Entry::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 45, 2> MapOutWireFormat_Map1Entry::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map1Entry, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapOutWireFormat_Map1Entry_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .proto3.MapM value = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map1Entry, _impl_.value_)}},
+    // string key = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map1Entry, _impl_.key_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string key = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map1Entry, _impl_.key_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // .proto3.MapM value = 2;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map1Entry, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3::MapM>()},
+  }}, {{
+    "\41\3\0\0\0\0\0\0"
+    "proto3.MapOutWireFormat.Map1Entry"
+    "key"
+  }},
+};
+
+::uint8_t* MapOutWireFormat_Map1Entry::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOutWireFormat.Map1Entry)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    const std::string& _s = this->_internal_key();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOutWireFormat.Map1Entry.key");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .proto3.MapM value = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOutWireFormat.Map1Entry)
+  return target;
+}
+
+::size_t MapOutWireFormat_Map1Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOutWireFormat.Map1Entry)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_key());
+  }
+
+  // .proto3.MapM value = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOutWireFormat_Map1Entry::_class_data_ = {
+    MapOutWireFormat_Map1Entry::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOutWireFormat_Map1Entry::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOutWireFormat_Map1Entry::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOutWireFormat_Map1Entry*>(&to_msg);
+  auto& from = static_cast<const MapOutWireFormat_Map1Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOutWireFormat.Map1Entry)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::proto3::MapM::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOutWireFormat_Map1Entry::CopyFrom(const MapOutWireFormat_Map1Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOutWireFormat.Map1Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOutWireFormat_Map1Entry::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOutWireFormat_Map1Entry::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOutWireFormat_Map1Entry::InternalSwap(MapOutWireFormat_Map1Entry* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata MapOutWireFormat_Map1Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[59]);
+}
+// ===================================================================
+
+class MapOutWireFormat_Map2Entry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MapOutWireFormat_Map2Entry>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map2Entry, _impl_._has_bits_);
+  static const ::proto3::MapOut& value(const MapOutWireFormat_Map2Entry* msg);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::proto3::MapOut& MapOutWireFormat_Map2Entry::_Internal::value(const MapOutWireFormat_Map2Entry* msg) {
+  return *msg->_impl_.value_;
+}
+MapOutWireFormat_Map2Entry::MapOutWireFormat_Map2Entry(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOutWireFormat.Map2Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map2Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        key_(arena, from.key_) {}
+
+MapOutWireFormat_Map2Entry::MapOutWireFormat_Map2Entry(
+    ::google::protobuf::Arena* arena,
+    const MapOutWireFormat_Map2Entry& from)
+    : ::google::protobuf::Message(arena) {
+  MapOutWireFormat_Map2Entry* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::proto3::MapOut>(arena, *from._impl_.value_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOutWireFormat.Map2Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map2Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        key_(arena) {}
+
+inline void MapOutWireFormat_Map2Entry::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.value_ = {};
+}
+MapOutWireFormat_Map2Entry::~MapOutWireFormat_Map2Entry() {
+  // @@protoc_insertion_point(destructor:proto3.MapOutWireFormat.Map2Entry)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOutWireFormat_Map2Entry::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.key_.Destroy();
+  delete _impl_.value_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOutWireFormat_Map2Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOutWireFormat.Map2Entry)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.value_ != nullptr);
+    _impl_.value_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOutWireFormat_Map2Entry::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 45, 2> MapOutWireFormat_Map2Entry::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map2Entry, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapOutWireFormat_Map2Entry_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .proto3.MapOut value = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map2Entry, _impl_.value_)}},
+    // string key = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map2Entry, _impl_.key_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string key = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map2Entry, _impl_.key_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // .proto3.MapOut value = 2;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map2Entry, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3::MapOut>()},
+  }}, {{
+    "\41\3\0\0\0\0\0\0"
+    "proto3.MapOutWireFormat.Map2Entry"
+    "key"
+  }},
+};
+
+::uint8_t* MapOutWireFormat_Map2Entry::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOutWireFormat.Map2Entry)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    const std::string& _s = this->_internal_key();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOutWireFormat.Map2Entry.key");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .proto3.MapOut value = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::value(this),
+        _Internal::value(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOutWireFormat.Map2Entry)
+  return target;
+}
+
+::size_t MapOutWireFormat_Map2Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOutWireFormat.Map2Entry)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_key());
+  }
+
+  // .proto3.MapOut value = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.value_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOutWireFormat_Map2Entry::_class_data_ = {
+    MapOutWireFormat_Map2Entry::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOutWireFormat_Map2Entry::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOutWireFormat_Map2Entry::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOutWireFormat_Map2Entry*>(&to_msg);
+  auto& from = static_cast<const MapOutWireFormat_Map2Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOutWireFormat.Map2Entry)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_value()->::proto3::MapOut::MergeFrom(
+        from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOutWireFormat_Map2Entry::CopyFrom(const MapOutWireFormat_Map2Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOutWireFormat.Map2Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOutWireFormat_Map2Entry::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOutWireFormat_Map2Entry::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOutWireFormat_Map2Entry::InternalSwap(MapOutWireFormat_Map2Entry* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::google::protobuf::Metadata MapOutWireFormat_Map2Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[60]);
+}
+// ===================================================================
+
+class MapOutWireFormat_Map3Entry::_Internal {
+ public:
+};
+
+MapOutWireFormat_Map3Entry::MapOutWireFormat_Map3Entry(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOutWireFormat.Map3Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map3Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : value_(arena, from.value_),
+        _cached_size_{0} {}
+
+MapOutWireFormat_Map3Entry::MapOutWireFormat_Map3Entry(
+    ::google::protobuf::Arena* arena,
+    const MapOutWireFormat_Map3Entry& from)
+    : ::google::protobuf::Message(arena) {
+  MapOutWireFormat_Map3Entry* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.key_ = from._impl_.key_;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOutWireFormat.Map3Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map3Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : value_(arena),
+        _cached_size_{0} {}
+
+inline void MapOutWireFormat_Map3Entry::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.key_ = {};
+}
+MapOutWireFormat_Map3Entry::~MapOutWireFormat_Map3Entry() {
+  // @@protoc_insertion_point(destructor:proto3.MapOutWireFormat.Map3Entry)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOutWireFormat_Map3Entry::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.value_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOutWireFormat_Map3Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOutWireFormat.Map3Entry)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  _impl_.key_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOutWireFormat_Map3Entry::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 47, 2> MapOutWireFormat_Map3Entry::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MapOutWireFormat_Map3Entry_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string value = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map3Entry, _impl_.value_)}},
+    // int32 key = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(MapOutWireFormat_Map3Entry, _impl_.key_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map3Entry, _impl_.key_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 key = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map3Entry, _impl_.key_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string value = 2;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map3Entry, _impl_.value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\41\0\5\0\0\0\0\0"
+    "proto3.MapOutWireFormat.Map3Entry"
+    "value"
+  }},
+};
+
+::uint8_t* MapOutWireFormat_Map3Entry::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOutWireFormat.Map3Entry)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // int32 key = 1;
+  if (this->_internal_key() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_key(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    const std::string& _s = this->_internal_value();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOutWireFormat.Map3Entry.value");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOutWireFormat.Map3Entry)
+  return target;
+}
+
+::size_t MapOutWireFormat_Map3Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOutWireFormat.Map3Entry)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_value());
+  }
+
+  // int32 key = 1;
+  if (this->_internal_key() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_key());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOutWireFormat_Map3Entry::_class_data_ = {
+    MapOutWireFormat_Map3Entry::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOutWireFormat_Map3Entry::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOutWireFormat_Map3Entry::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOutWireFormat_Map3Entry*>(&to_msg);
+  auto& from = static_cast<const MapOutWireFormat_Map3Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOutWireFormat.Map3Entry)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_key() != 0) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOutWireFormat_Map3Entry::CopyFrom(const MapOutWireFormat_Map3Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOutWireFormat.Map3Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOutWireFormat_Map3Entry::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOutWireFormat_Map3Entry::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOutWireFormat_Map3Entry::InternalSwap(MapOutWireFormat_Map3Entry* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.value_, &other->_impl_.value_, arena);
+        swap(_impl_.key_, other->_impl_.key_);
+}
+
+::google::protobuf::Metadata MapOutWireFormat_Map3Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[61]);
+}
+// ===================================================================
+
+class MapOutWireFormat_Map4Entry::_Internal {
+ public:
+};
+
+MapOutWireFormat_Map4Entry::MapOutWireFormat_Map4Entry(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOutWireFormat.Map4Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map4Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : value_(arena, from.value_),
+        _cached_size_{0} {}
+
+MapOutWireFormat_Map4Entry::MapOutWireFormat_Map4Entry(
+    ::google::protobuf::Arena* arena,
+    const MapOutWireFormat_Map4Entry& from)
+    : ::google::protobuf::Message(arena) {
+  MapOutWireFormat_Map4Entry* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.key_ = from._impl_.key_;
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOutWireFormat.Map4Entry)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat_Map4Entry::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : value_(arena),
+        _cached_size_{0} {}
+
+inline void MapOutWireFormat_Map4Entry::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.key_ = {};
+}
+MapOutWireFormat_Map4Entry::~MapOutWireFormat_Map4Entry() {
+  // @@protoc_insertion_point(destructor:proto3.MapOutWireFormat.Map4Entry)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOutWireFormat_Map4Entry::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.value_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOutWireFormat_Map4Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOutWireFormat.Map4Entry)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  _impl_.key_ = false;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOutWireFormat_Map4Entry::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 47, 2> MapOutWireFormat_Map4Entry::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MapOutWireFormat_Map4Entry_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string value = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map4Entry, _impl_.value_)}},
+    // bool key = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(MapOutWireFormat_Map4Entry, _impl_.key_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map4Entry, _impl_.key_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool key = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map4Entry, _impl_.key_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // string value = 2;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat_Map4Entry, _impl_.value_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\41\0\5\0\0\0\0\0"
+    "proto3.MapOutWireFormat.Map4Entry"
+    "value"
+  }},
+};
+
+::uint8_t* MapOutWireFormat_Map4Entry::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOutWireFormat.Map4Entry)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // bool key = 1;
+  if (this->_internal_key() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_key(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    const std::string& _s = this->_internal_value();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOutWireFormat.Map4Entry.value");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOutWireFormat.Map4Entry)
+  return target;
+}
+
+::size_t MapOutWireFormat_Map4Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOutWireFormat.Map4Entry)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_value());
+  }
+
+  // bool key = 1;
+  if (this->_internal_key() != 0) {
+    total_size += 2;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOutWireFormat_Map4Entry::_class_data_ = {
+    MapOutWireFormat_Map4Entry::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOutWireFormat_Map4Entry::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOutWireFormat_Map4Entry::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOutWireFormat_Map4Entry*>(&to_msg);
+  auto& from = static_cast<const MapOutWireFormat_Map4Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOutWireFormat.Map4Entry)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_key() != 0) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOutWireFormat_Map4Entry::CopyFrom(const MapOutWireFormat_Map4Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOutWireFormat.Map4Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOutWireFormat_Map4Entry::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOutWireFormat_Map4Entry::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOutWireFormat_Map4Entry::InternalSwap(MapOutWireFormat_Map4Entry* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.value_, &other->_impl_.value_, arena);
+        swap(_impl_.key_, other->_impl_.key_);
+}
+
+::google::protobuf::Metadata MapOutWireFormat_Map4Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[62]);
+}
+// ===================================================================
+
+class MapOutWireFormat::_Internal {
+ public:
+};
+
+MapOutWireFormat::MapOutWireFormat(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapOutWireFormat)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : map1_{visibility, arena, from.map1_},
+        map2_{visibility, arena, from.map2_},
+        map3_{visibility, arena, from.map3_},
+        map4_{visibility, arena, from.map4_},
+        bar_(arena, from.bar_),
+        _cached_size_{0} {}
+
+MapOutWireFormat::MapOutWireFormat(
+    ::google::protobuf::Arena* arena,
+    const MapOutWireFormat& from)
+    : ::google::protobuf::Message(arena) {
+  MapOutWireFormat* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapOutWireFormat)
+}
+inline PROTOBUF_NDEBUG_INLINE MapOutWireFormat::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : map1_{visibility, arena},
+        map2_{visibility, arena},
+        map3_{visibility, arena},
+        map4_{visibility, arena},
+        bar_(arena),
+        _cached_size_{0} {}
+
+inline void MapOutWireFormat::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapOutWireFormat::~MapOutWireFormat() {
+  // @@protoc_insertion_point(destructor:proto3.MapOutWireFormat)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapOutWireFormat::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.bar_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapOutWireFormat::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapOutWireFormat)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.map1_.Clear();
+  _impl_.map2_.Clear();
+  _impl_.map3_.Clear();
+  _impl_.map4_.Clear();
+  _impl_.bar_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapOutWireFormat::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 4, 35, 2> MapOutWireFormat::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    4,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_MapOutWireFormat_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // repeated .proto3.MapOutWireFormat.Map1Entry map1 = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map1_)}},
+    // repeated .proto3.MapOutWireFormat.Map2Entry map2 = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map2_)}},
+    // repeated .proto3.MapOutWireFormat.Map3Entry map3 = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 63, 2, PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map3_)}},
+    // string bar = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.bar_)}},
+    // repeated .proto3.MapOutWireFormat.Map4Entry map4 = 5;
+    {::_pbi::TcParser::FastMtR1,
+     {42, 63, 3, PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map4_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .proto3.MapOutWireFormat.Map1Entry map1 = 1;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map1_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .proto3.MapOutWireFormat.Map2Entry map2 = 2;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map2_), 0, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .proto3.MapOutWireFormat.Map3Entry map3 = 3;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map3_), 0, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // string bar = 4;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.bar_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // repeated .proto3.MapOutWireFormat.Map4Entry map4 = 5;
+    {PROTOBUF_FIELD_OFFSET(MapOutWireFormat, _impl_.map4_), 0, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3::MapOutWireFormat_Map1Entry>()},
+    {::_pbi::TcParser::GetTable<::proto3::MapOutWireFormat_Map2Entry>()},
+    {::_pbi::TcParser::GetTable<::proto3::MapOutWireFormat_Map3Entry>()},
+    {::_pbi::TcParser::GetTable<::proto3::MapOutWireFormat_Map4Entry>()},
+  }}, {{
+    "\27\0\0\0\3\0\0\0"
+    "proto3.MapOutWireFormat"
+    "bar"
+  }},
+};
+
+::uint8_t* MapOutWireFormat::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapOutWireFormat)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // repeated .proto3.MapOutWireFormat.Map1Entry map1 = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_map1_size()); i < n; i++) {
+    const auto& repfield = this->_internal_map1().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto3.MapOutWireFormat.Map2Entry map2 = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_map2_size()); i < n; i++) {
+    const auto& repfield = this->_internal_map2().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto3.MapOutWireFormat.Map3Entry map3 = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_map3_size()); i < n; i++) {
+    const auto& repfield = this->_internal_map3().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string bar = 4;
+  if (!this->_internal_bar().empty()) {
+    const std::string& _s = this->_internal_bar();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapOutWireFormat.bar");
+    target = stream->WriteStringMaybeAliased(4, _s, target);
+  }
+
+  // repeated .proto3.MapOutWireFormat.Map4Entry map4 = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_map4_size()); i < n; i++) {
+    const auto& repfield = this->_internal_map4().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapOutWireFormat)
+  return target;
+}
+
+::size_t MapOutWireFormat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapOutWireFormat)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto3.MapOutWireFormat.Map1Entry map1 = 1;
+  total_size += 1UL * this->_internal_map1_size();
+  for (const auto& msg : this->_internal_map1()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .proto3.MapOutWireFormat.Map2Entry map2 = 2;
+  total_size += 1UL * this->_internal_map2_size();
+  for (const auto& msg : this->_internal_map2()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .proto3.MapOutWireFormat.Map3Entry map3 = 3;
+  total_size += 1UL * this->_internal_map3_size();
+  for (const auto& msg : this->_internal_map3()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .proto3.MapOutWireFormat.Map4Entry map4 = 5;
+  total_size += 1UL * this->_internal_map4_size();
+  for (const auto& msg : this->_internal_map4()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // string bar = 4;
+  if (!this->_internal_bar().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_bar());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapOutWireFormat::_class_data_ = {
+    MapOutWireFormat::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapOutWireFormat::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapOutWireFormat::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapOutWireFormat*>(&to_msg);
+  auto& from = static_cast<const MapOutWireFormat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapOutWireFormat)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_map1()->MergeFrom(
+      from._internal_map1());
+  _this->_internal_mutable_map2()->MergeFrom(
+      from._internal_map2());
+  _this->_internal_mutable_map3()->MergeFrom(
+      from._internal_map3());
+  _this->_internal_mutable_map4()->MergeFrom(
+      from._internal_map4());
+  if (!from._internal_bar().empty()) {
+    _this->_internal_set_bar(from._internal_bar());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapOutWireFormat::CopyFrom(const MapOutWireFormat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapOutWireFormat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapOutWireFormat::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapOutWireFormat::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapOutWireFormat::InternalSwap(MapOutWireFormat* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.map1_.InternalSwap(&other->_impl_.map1_);
+  _impl_.map2_.InternalSwap(&other->_impl_.map2_);
+  _impl_.map3_.InternalSwap(&other->_impl_.map3_);
+  _impl_.map4_.InternalSwap(&other->_impl_.map4_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.bar_, &other->_impl_.bar_, arena);
+}
+
+::google::protobuf::Metadata MapOutWireFormat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[63]);
+}
+// ===================================================================
+
+class MapM::_Internal {
+ public:
+};
+
+MapM::MapM(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MapM)
+}
+inline PROTOBUF_NDEBUG_INLINE MapM::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : foo_(arena, from.foo_),
+        _cached_size_{0} {}
+
+MapM::MapM(
+    ::google::protobuf::Arena* arena,
+    const MapM& from)
+    : ::google::protobuf::Message(arena) {
+  MapM* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:proto3.MapM)
+}
+inline PROTOBUF_NDEBUG_INLINE MapM::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : foo_(arena),
+        _cached_size_{0} {}
+
+inline void MapM::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+MapM::~MapM() {
+  // @@protoc_insertion_point(destructor:proto3.MapM)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void MapM::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.foo_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void MapM::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MapM)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.foo_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* MapM::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 23, 2> MapM::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_MapM_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string foo = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(MapM, _impl_.foo_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string foo = 1;
+    {PROTOBUF_FIELD_OFFSET(MapM, _impl_.foo_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\13\3\0\0\0\0\0\0"
+    "proto3.MapM"
+    "foo"
+  }},
+};
+
+::uint8_t* MapM::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MapM)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string foo = 1;
+  if (!this->_internal_foo().empty()) {
+    const std::string& _s = this->_internal_foo();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "proto3.MapM.foo");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MapM)
+  return target;
+}
+
+::size_t MapM::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MapM)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string foo = 1;
+  if (!this->_internal_foo().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_foo());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData MapM::_class_data_ = {
+    MapM::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* MapM::GetClassData() const {
+  return &_class_data_;
+}
+
+void MapM::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<MapM*>(&to_msg);
+  auto& from = static_cast<const MapM&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3.MapM)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_foo().empty()) {
+    _this->_internal_set_foo(from._internal_foo());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MapM::CopyFrom(const MapM& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MapM)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool MapM::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* MapM::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void MapM::InternalSwap(MapM* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.foo_, &other->_impl_.foo_, arena);
+}
+
+::google::protobuf::Metadata MapM::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[64]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
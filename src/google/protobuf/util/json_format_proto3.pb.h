@@ -0,0 +1,16839 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/json_format_proto3.proto
+// Protobuf C++ Version: 4.25.3
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/port_def.inc"
+#if PROTOBUF_VERSION < 4025000
+#error "This file was generated by a newer version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please update"
+#error "your headers."
+#endif  // PROTOBUF_VERSION
+
+#if 4025003 < PROTOBUF_MIN_PROTOC_VERSION
+#error "This file was generated by an older version of protoc which is"
+#error "incompatible with your Protocol Buffer headers. Please"
+#error "regenerate this file with a newer version of protoc."
+#endif  // PROTOBUF_MIN_PROTOC_VERSION
+#include "google/protobuf/port_undef.inc"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/map.h"  // IWYU pragma: export
+#include "google/protobuf/map_entry.h"
+#include "google/protobuf/map_field_inl.h"
+#include "google/protobuf/generated_enum_reflection.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "google/protobuf/any.pb.h"
+#include "google/protobuf/duration.pb.h"
+#include "google/protobuf/field_mask.pb.h"
+#include "google/protobuf/struct.pb.h"
+#include "google/protobuf/timestamp.pb.h"
+#include "google/protobuf/wrappers.pb.h"
+#include "google/protobuf/unittest.pb.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+namespace proto3 {
+class BoolToString;
+struct BoolToStringDefaultTypeInternal;
+extern BoolToStringDefaultTypeInternal _BoolToString_default_instance_;
+class BoolToString_MapEntry_DoNotUse;
+struct BoolToString_MapEntry_DoNotUseDefaultTypeInternal;
+extern BoolToString_MapEntry_DoNotUseDefaultTypeInternal _BoolToString_MapEntry_DoNotUse_default_instance_;
+class EmptyMap;
+struct EmptyMapDefaultTypeInternal;
+extern EmptyMapDefaultTypeInternal _EmptyMap_default_instance_;
+class EmptyMap_MapEntry_DoNotUse;
+struct EmptyMap_MapEntry_DoNotUseDefaultTypeInternal;
+extern EmptyMap_MapEntry_DoNotUseDefaultTypeInternal _EmptyMap_MapEntry_DoNotUse_default_instance_;
+class IntToString;
+struct IntToStringDefaultTypeInternal;
+extern IntToStringDefaultTypeInternal _IntToString_default_instance_;
+class IntToString_MapEntry_DoNotUse;
+struct IntToString_MapEntry_DoNotUseDefaultTypeInternal;
+extern IntToString_MapEntry_DoNotUseDefaultTypeInternal _IntToString_MapEntry_DoNotUse_default_instance_;
+class MapIn;
+struct MapInDefaultTypeInternal;
+extern MapInDefaultTypeInternal _MapIn_default_instance_;
+class MapIn_MapAnyEntry_DoNotUse;
+struct MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal;
+extern MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal _MapIn_MapAnyEntry_DoNotUse_default_instance_;
+class MapIn_MapInputEntry_DoNotUse;
+struct MapIn_MapInputEntry_DoNotUseDefaultTypeInternal;
+extern MapIn_MapInputEntry_DoNotUseDefaultTypeInternal _MapIn_MapInputEntry_DoNotUse_default_instance_;
+class MapM;
+struct MapMDefaultTypeInternal;
+extern MapMDefaultTypeInternal _MapM_default_instance_;
+class MapOfObjects;
+struct MapOfObjectsDefaultTypeInternal;
+extern MapOfObjectsDefaultTypeInternal _MapOfObjects_default_instance_;
+class MapOfObjects_M;
+struct MapOfObjects_MDefaultTypeInternal;
+extern MapOfObjects_MDefaultTypeInternal _MapOfObjects_M_default_instance_;
+class MapOfObjects_MapEntry_DoNotUse;
+struct MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal;
+extern MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal _MapOfObjects_MapEntry_DoNotUse_default_instance_;
+class MapOut;
+struct MapOutDefaultTypeInternal;
+extern MapOutDefaultTypeInternal _MapOut_default_instance_;
+class MapOutWireFormat;
+struct MapOutWireFormatDefaultTypeInternal;
+extern MapOutWireFormatDefaultTypeInternal _MapOutWireFormat_default_instance_;
+class MapOutWireFormat_Map1Entry;
+struct MapOutWireFormat_Map1EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map1EntryDefaultTypeInternal _MapOutWireFormat_Map1Entry_default_instance_;
+class MapOutWireFormat_Map2Entry;
+struct MapOutWireFormat_Map2EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map2EntryDefaultTypeInternal _MapOutWireFormat_Map2Entry_default_instance_;
+class MapOutWireFormat_Map3Entry;
+struct MapOutWireFormat_Map3EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map3EntryDefaultTypeInternal _MapOutWireFormat_Map3Entry_default_instance_;
+class MapOutWireFormat_Map4Entry;
+struct MapOutWireFormat_Map4EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map4EntryDefaultTypeInternal _MapOutWireFormat_Map4Entry_default_instance_;
+class MapOut_Map1Entry_DoNotUse;
+struct MapOut_Map1Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map1Entry_DoNotUseDefaultTypeInternal _MapOut_Map1Entry_DoNotUse_default_instance_;
+class MapOut_Map2Entry_DoNotUse;
+struct MapOut_Map2Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map2Entry_DoNotUseDefaultTypeInternal _MapOut_Map2Entry_DoNotUse_default_instance_;
+class MapOut_Map3Entry_DoNotUse;
+struct MapOut_Map3Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map3Entry_DoNotUseDefaultTypeInternal _MapOut_Map3Entry_DoNotUse_default_instance_;
+class MapOut_Map4Entry_DoNotUse;
+struct MapOut_Map4Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map4Entry_DoNotUseDefaultTypeInternal _MapOut_Map4Entry_DoNotUse_default_instance_;
+class MapsTestCases;
+struct MapsTestCasesDefaultTypeInternal;
+extern MapsTestCasesDefaultTypeInternal _MapsTestCases_default_instance_;
+class MessageType;
+struct MessageTypeDefaultTypeInternal;
+extern MessageTypeDefaultTypeInternal _MessageType_default_instance_;
+class Mixed1;
+struct Mixed1DefaultTypeInternal;
+extern Mixed1DefaultTypeInternal _Mixed1_default_instance_;
+class Mixed1_MapEntry_DoNotUse;
+struct Mixed1_MapEntry_DoNotUseDefaultTypeInternal;
+extern Mixed1_MapEntry_DoNotUseDefaultTypeInternal _Mixed1_MapEntry_DoNotUse_default_instance_;
+class Mixed2;
+struct Mixed2DefaultTypeInternal;
+extern Mixed2DefaultTypeInternal _Mixed2_default_instance_;
+class Mixed2_MapEntry_DoNotUse;
+struct Mixed2_MapEntry_DoNotUseDefaultTypeInternal;
+extern Mixed2_MapEntry_DoNotUseDefaultTypeInternal _Mixed2_MapEntry_DoNotUse_default_instance_;
+class StringtoInt;
+struct StringtoIntDefaultTypeInternal;
+extern StringtoIntDefaultTypeInternal _StringtoInt_default_instance_;
+class StringtoInt_MapEntry_DoNotUse;
+struct StringtoInt_MapEntry_DoNotUseDefaultTypeInternal;
+extern StringtoInt_MapEntry_DoNotUseDefaultTypeInternal _StringtoInt_MapEntry_DoNotUse_default_instance_;
+class TestAny;
+struct TestAnyDefaultTypeInternal;
+extern TestAnyDefaultTypeInternal _TestAny_default_instance_;
+class TestBoolValue;
+struct TestBoolValueDefaultTypeInternal;
+extern TestBoolValueDefaultTypeInternal _TestBoolValue_default_instance_;
+class TestBoolValue_BoolMapEntry_DoNotUse;
+struct TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal;
+extern TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal _TestBoolValue_BoolMapEntry_DoNotUse_default_instance_;
+class TestCustomJsonName;
+struct TestCustomJsonNameDefaultTypeInternal;
+extern TestCustomJsonNameDefaultTypeInternal _TestCustomJsonName_default_instance_;
+class TestDuration;
+struct TestDurationDefaultTypeInternal;
+extern TestDurationDefaultTypeInternal _TestDuration_default_instance_;
+class TestEnumValue;
+struct TestEnumValueDefaultTypeInternal;
+extern TestEnumValueDefaultTypeInternal _TestEnumValue_default_instance_;
+class TestEvilJson;
+struct TestEvilJsonDefaultTypeInternal;
+extern TestEvilJsonDefaultTypeInternal _TestEvilJson_default_instance_;
+class TestExtensions;
+struct TestExtensionsDefaultTypeInternal;
+extern TestExtensionsDefaultTypeInternal _TestExtensions_default_instance_;
+class TestFieldMask;
+struct TestFieldMaskDefaultTypeInternal;
+extern TestFieldMaskDefaultTypeInternal _TestFieldMask_default_instance_;
+class TestListValue;
+struct TestListValueDefaultTypeInternal;
+extern TestListValueDefaultTypeInternal _TestListValue_default_instance_;
+class TestMap;
+struct TestMapDefaultTypeInternal;
+extern TestMapDefaultTypeInternal _TestMap_default_instance_;
+class TestMap_BoolMapEntry_DoNotUse;
+struct TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal _TestMap_BoolMapEntry_DoNotUse_default_instance_;
+class TestMap_Int32MapEntry_DoNotUse;
+struct TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal _TestMap_Int32MapEntry_DoNotUse_default_instance_;
+class TestMap_Int64MapEntry_DoNotUse;
+struct TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal _TestMap_Int64MapEntry_DoNotUse_default_instance_;
+class TestMap_StringMapEntry_DoNotUse;
+struct TestMap_StringMapEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestMap_StringMapEntry_DoNotUse_default_instance_;
+class TestMap_Uint32MapEntry_DoNotUse;
+struct TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal _TestMap_Uint32MapEntry_DoNotUse_default_instance_;
+class TestMap_Uint64MapEntry_DoNotUse;
+struct TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal _TestMap_Uint64MapEntry_DoNotUse_default_instance_;
+class TestMessage;
+struct TestMessageDefaultTypeInternal;
+extern TestMessageDefaultTypeInternal _TestMessage_default_instance_;
+class TestNestedMap;
+struct TestNestedMapDefaultTypeInternal;
+extern TestNestedMapDefaultTypeInternal _TestNestedMap_default_instance_;
+class TestNestedMap_BoolMapEntry_DoNotUse;
+struct TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_BoolMapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Int32MapEntry_DoNotUse;
+struct TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Int32MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Int64MapEntry_DoNotUse;
+struct TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Int64MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_MapMapEntry_DoNotUse;
+struct TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_MapMapEntry_DoNotUse_default_instance_;
+class TestNestedMap_StringMapEntry_DoNotUse;
+struct TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_StringMapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Uint32MapEntry_DoNotUse;
+struct TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Uint64MapEntry_DoNotUse;
+struct TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal;
+extern TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal _TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_;
+class TestNullValue;
+struct TestNullValueDefaultTypeInternal;
+extern TestNullValueDefaultTypeInternal _TestNullValue_default_instance_;
+class TestOneof;
+struct TestOneofDefaultTypeInternal;
+extern TestOneofDefaultTypeInternal _TestOneof_default_instance_;
+class TestStringMap;
+struct TestStringMapDefaultTypeInternal;
+extern TestStringMapDefaultTypeInternal _TestStringMap_default_instance_;
+class TestStringMap_StringMapEntry_DoNotUse;
+struct TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal;
+extern TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestStringMap_StringMapEntry_DoNotUse_default_instance_;
+class TestStruct;
+struct TestStructDefaultTypeInternal;
+extern TestStructDefaultTypeInternal _TestStruct_default_instance_;
+class TestTimestamp;
+struct TestTimestampDefaultTypeInternal;
+extern TestTimestampDefaultTypeInternal _TestTimestamp_default_instance_;
+class TestValue;
+struct TestValueDefaultTypeInternal;
+extern TestValueDefaultTypeInternal _TestValue_default_instance_;
+class TestWrapper;
+struct TestWrapperDefaultTypeInternal;
+extern TestWrapperDefaultTypeInternal _TestWrapper_default_instance_;
+}  // namespace proto3
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace proto3 {
+enum Mixed2_E : int {
+  Mixed2_E_E0 = 0,
+  Mixed2_E_E1 = 1,
+  Mixed2_E_E2 = 2,
+  Mixed2_E_E3 = 3,
+  Mixed2_E_Mixed2_E_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  Mixed2_E_Mixed2_E_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool Mixed2_E_IsValid(int value);
+extern const uint32_t Mixed2_E_internal_data_[];
+constexpr Mixed2_E Mixed2_E_E_MIN = static_cast<Mixed2_E>(0);
+constexpr Mixed2_E Mixed2_E_E_MAX = static_cast<Mixed2_E>(3);
+constexpr int Mixed2_E_E_ARRAYSIZE = 3 + 1;
+const ::google::protobuf::EnumDescriptor*
+Mixed2_E_descriptor();
+template <typename T>
+const std::string& Mixed2_E_Name(T value) {
+  static_assert(std::is_same<T, Mixed2_E>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to E_Name().");
+  return Mixed2_E_Name(static_cast<Mixed2_E>(value));
+}
+template <>
+inline const std::string& Mixed2_E_Name(Mixed2_E value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<Mixed2_E_descriptor,
+                                                 0, 3>(
+      static_cast<int>(value));
+}
+inline bool Mixed2_E_Parse(absl::string_view name, Mixed2_E* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<Mixed2_E>(
+      Mixed2_E_descriptor(), name, value);
+}
+enum EnumType : int {
+  FOO = 0,
+  BAR = 1,
+  TLSv1_2 = 2,
+  EnumType_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  EnumType_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool EnumType_IsValid(int value);
+extern const uint32_t EnumType_internal_data_[];
+constexpr EnumType EnumType_MIN = static_cast<EnumType>(0);
+constexpr EnumType EnumType_MAX = static_cast<EnumType>(2);
+constexpr int EnumType_ARRAYSIZE = 2 + 1;
+const ::google::protobuf::EnumDescriptor*
+EnumType_descriptor();
+template <typename T>
+const std::string& EnumType_Name(T value) {
+  static_assert(std::is_same<T, EnumType>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to EnumType_Name().");
+  return EnumType_Name(static_cast<EnumType>(value));
+}
+template <>
+inline const std::string& EnumType_Name(EnumType value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<EnumType_descriptor,
+                                                 0, 2>(
+      static_cast<int>(value));
+}
+inline bool EnumType_Parse(absl::string_view name, EnumType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<EnumType>(
+      EnumType_descriptor(), name, value);
+}
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class TestStringMap_StringMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestStringMap_StringMapEntry_DoNotUse, std::string, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestStringMap_StringMapEntry_DoNotUse, std::string, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  TestStringMap_StringMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestStringMap_StringMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestStringMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestStringMap_StringMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestStringMap_StringMapEntry_DoNotUse*>(
+        &_TestStringMap_StringMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.TestStringMap.StringMapEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.TestStringMap.StringMapEntry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNullValue final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestNullValue) */ {
+ public:
+  inline TestNullValue() : TestNullValue(nullptr) {}
+  ~TestNullValue() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNullValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestNullValue(const TestNullValue& from)
+      : TestNullValue(nullptr, from) {}
+  TestNullValue(TestNullValue&& from) noexcept
+    : TestNullValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TestNullValue& operator=(const TestNullValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestNullValue& operator=(TestNullValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestNullValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestNullValue* internal_default_instance() {
+    return reinterpret_cast<const TestNullValue*>(
+               &_TestNullValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(TestNullValue& a, TestNullValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestNullValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestNullValue* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestNullValue* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestNullValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestNullValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestNullValue& from) {
+    TestNullValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestNullValue* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestNullValue";
+  }
+  protected:
+  explicit TestNullValue(::google::protobuf::Arena* arena);
+  TestNullValue(::google::protobuf::Arena* arena, const TestNullValue& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedNullValueFieldNumber = 21,
+    kNullValueFieldNumber = 20,
+  };
+  // repeated .google.protobuf.NullValue repeated_null_value = 21;
+  int repeated_null_value_size() const;
+  private:
+  int _internal_repeated_null_value_size() const;
+
+  public:
+  void clear_repeated_null_value() ;
+  public:
+  ::google::protobuf::NullValue repeated_null_value(int index) const;
+  void set_repeated_null_value(int index, ::google::protobuf::NullValue value);
+  void add_repeated_null_value(::google::protobuf::NullValue value);
+  const ::google::protobuf::RepeatedField<int>& repeated_null_value() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_null_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_null_value() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_null_value();
+
+  public:
+  // .google.protobuf.NullValue null_value = 20;
+  void clear_null_value() ;
+  ::google::protobuf::NullValue null_value() const;
+  void set_null_value(::google::protobuf::NullValue value);
+
+  private:
+  ::google::protobuf::NullValue _internal_null_value() const;
+  void _internal_set_null_value(::google::protobuf::NullValue value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestNullValue)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedField<int> repeated_null_value_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_null_value_cached_byte_size_;
+    int null_value_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestNestedMap_Uint64MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_Uint64MapEntry_DoNotUse, ::uint64_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_Uint64MapEntry_DoNotUse, ::uint64_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestNestedMap_Uint64MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_Uint64MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_Uint64MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_Uint64MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_Uint64MapEntry_DoNotUse*>(
+        &_TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNestedMap_Uint32MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_Uint32MapEntry_DoNotUse, ::uint32_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_Uint32MapEntry_DoNotUse, ::uint32_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestNestedMap_Uint32MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_Uint32MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_Uint32MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_Uint32MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_Uint32MapEntry_DoNotUse*>(
+        &_TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNestedMap_StringMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_StringMapEntry_DoNotUse, std::string, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_StringMapEntry_DoNotUse, std::string, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestNestedMap_StringMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_StringMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_StringMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_StringMapEntry_DoNotUse*>(
+        &_TestNestedMap_StringMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.TestNestedMap.StringMapEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNestedMap_Int64MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_Int64MapEntry_DoNotUse, ::int64_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_Int64MapEntry_DoNotUse, ::int64_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestNestedMap_Int64MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_Int64MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_Int64MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_Int64MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_Int64MapEntry_DoNotUse*>(
+        &_TestNestedMap_Int64MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNestedMap_Int32MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_Int32MapEntry_DoNotUse, ::int32_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_Int32MapEntry_DoNotUse, ::int32_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestNestedMap_Int32MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_Int32MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_Int32MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_Int32MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_Int32MapEntry_DoNotUse*>(
+        &_TestNestedMap_Int32MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNestedMap_BoolMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_BoolMapEntry_DoNotUse, bool, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_BoolMapEntry_DoNotUse, bool, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestNestedMap_BoolMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_BoolMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_BoolMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_BoolMapEntry_DoNotUse*>(
+        &_TestNestedMap_BoolMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMap_Uint64MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMap_Uint64MapEntry_DoNotUse, ::uint64_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMap_Uint64MapEntry_DoNotUse, ::uint64_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestMap_Uint64MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap_Uint64MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMap_Uint64MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMap_Uint64MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMap_Uint64MapEntry_DoNotUse*>(
+        &_TestMap_Uint64MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMap_Uint32MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMap_Uint32MapEntry_DoNotUse, ::uint32_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMap_Uint32MapEntry_DoNotUse, ::uint32_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestMap_Uint32MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap_Uint32MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMap_Uint32MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMap_Uint32MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMap_Uint32MapEntry_DoNotUse*>(
+        &_TestMap_Uint32MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMap_StringMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMap_StringMapEntry_DoNotUse, std::string, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMap_StringMapEntry_DoNotUse, std::string, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestMap_StringMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap_StringMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMap_StringMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMap_StringMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMap_StringMapEntry_DoNotUse*>(
+        &_TestMap_StringMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.TestMap.StringMapEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMap_Int64MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMap_Int64MapEntry_DoNotUse, ::int64_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMap_Int64MapEntry_DoNotUse, ::int64_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestMap_Int64MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap_Int64MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMap_Int64MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMap_Int64MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMap_Int64MapEntry_DoNotUse*>(
+        &_TestMap_Int64MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMap_Int32MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMap_Int32MapEntry_DoNotUse, ::int32_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMap_Int32MapEntry_DoNotUse, ::int32_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestMap_Int32MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap_Int32MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMap_Int32MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMap_Int32MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMap_Int32MapEntry_DoNotUse*>(
+        &_TestMap_Int32MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMap_BoolMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestMap_BoolMapEntry_DoNotUse, bool, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestMap_BoolMapEntry_DoNotUse, bool, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestMap_BoolMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap_BoolMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestMap_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestMap_BoolMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestMap_BoolMapEntry_DoNotUse*>(
+        &_TestMap_BoolMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEvilJson final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestEvilJson) */ {
+ public:
+  inline TestEvilJson() : TestEvilJson(nullptr) {}
+  ~TestEvilJson() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEvilJson(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEvilJson(const TestEvilJson& from)
+      : TestEvilJson(nullptr, from) {}
+  TestEvilJson(TestEvilJson&& from) noexcept
+    : TestEvilJson() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEvilJson& operator=(const TestEvilJson& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEvilJson& operator=(TestEvilJson&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestEvilJson& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEvilJson* internal_default_instance() {
+    return reinterpret_cast<const TestEvilJson*>(
+               &_TestEvilJson_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(TestEvilJson& a, TestEvilJson& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEvilJson* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEvilJson* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEvilJson* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEvilJson>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestEvilJson& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestEvilJson& from) {
+    TestEvilJson::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEvilJson* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestEvilJson";
+  }
+  protected:
+  explicit TestEvilJson(::google::protobuf::Arena* arena);
+  TestEvilJson(::google::protobuf::Arena* arena, const TestEvilJson& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRegularValueFieldNumber = 1,
+    kScriptFieldNumber = 2,
+    kQuotesFieldNumber = 3,
+    kScriptAndQuotesFieldNumber = 4,
+  };
+  // int32 regular_value = 1 [json_name = "regular_name"];
+  void clear_regular_value() ;
+  ::int32_t regular_value() const;
+  void set_regular_value(::int32_t value);
+
+  private:
+  ::int32_t _internal_regular_value() const;
+  void _internal_set_regular_value(::int32_t value);
+
+  public:
+  // int32 script = 2 [json_name = "</script>"];
+  void clear_script() ;
+  ::int32_t script() const;
+  void set_script(::int32_t value);
+
+  private:
+  ::int32_t _internal_script() const;
+  void _internal_set_script(::int32_t value);
+
+  public:
+  // int32 quotes = 3 [json_name = "unbalanced\"quotes"];
+  void clear_quotes() ;
+  ::int32_t quotes() const;
+  void set_quotes(::int32_t value);
+
+  private:
+  ::int32_t _internal_quotes() const;
+  void _internal_set_quotes(::int32_t value);
+
+  public:
+  // int32 script_and_quotes = 4 [json_name = "\"<script>alert(\'hello!);</script>"];
+  void clear_script_and_quotes() ;
+  ::int32_t script_and_quotes() const;
+  void set_script_and_quotes(::int32_t value);
+
+  private:
+  ::int32_t _internal_script_and_quotes() const;
+  void _internal_set_script_and_quotes(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestEvilJson)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t regular_value_;
+    ::int32_t script_;
+    ::int32_t quotes_;
+    ::int32_t script_and_quotes_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestEnumValue final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestEnumValue) */ {
+ public:
+  inline TestEnumValue() : TestEnumValue(nullptr) {}
+  ~TestEnumValue() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestEnumValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestEnumValue(const TestEnumValue& from)
+      : TestEnumValue(nullptr, from) {}
+  TestEnumValue(TestEnumValue&& from) noexcept
+    : TestEnumValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEnumValue& operator=(const TestEnumValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEnumValue& operator=(TestEnumValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestEnumValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestEnumValue* internal_default_instance() {
+    return reinterpret_cast<const TestEnumValue*>(
+               &_TestEnumValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(TestEnumValue& a, TestEnumValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEnumValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEnumValue* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestEnumValue* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestEnumValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestEnumValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestEnumValue& from) {
+    TestEnumValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestEnumValue* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestEnumValue";
+  }
+  protected:
+  explicit TestEnumValue(::google::protobuf::Arena* arena);
+  TestEnumValue(::google::protobuf::Arena* arena, const TestEnumValue& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnumValue1FieldNumber = 1,
+    kEnumValue2FieldNumber = 2,
+    kEnumValue3FieldNumber = 3,
+  };
+  // .proto3.EnumType enum_value1 = 1;
+  void clear_enum_value1() ;
+  ::proto3::EnumType enum_value1() const;
+  void set_enum_value1(::proto3::EnumType value);
+
+  private:
+  ::proto3::EnumType _internal_enum_value1() const;
+  void _internal_set_enum_value1(::proto3::EnumType value);
+
+  public:
+  // .proto3.EnumType enum_value2 = 2;
+  void clear_enum_value2() ;
+  ::proto3::EnumType enum_value2() const;
+  void set_enum_value2(::proto3::EnumType value);
+
+  private:
+  ::proto3::EnumType _internal_enum_value2() const;
+  void _internal_set_enum_value2(::proto3::EnumType value);
+
+  public:
+  // .proto3.EnumType enum_value3 = 3;
+  void clear_enum_value3() ;
+  ::proto3::EnumType enum_value3() const;
+  void set_enum_value3(::proto3::EnumType value);
+
+  private:
+  ::proto3::EnumType _internal_enum_value3() const;
+  void _internal_set_enum_value3(::proto3::EnumType value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestEnumValue)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    int enum_value1_;
+    int enum_value2_;
+    int enum_value3_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestCustomJsonName final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestCustomJsonName) */ {
+ public:
+  inline TestCustomJsonName() : TestCustomJsonName(nullptr) {}
+  ~TestCustomJsonName() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestCustomJsonName(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestCustomJsonName(const TestCustomJsonName& from)
+      : TestCustomJsonName(nullptr, from) {}
+  TestCustomJsonName(TestCustomJsonName&& from) noexcept
+    : TestCustomJsonName() {
+    *this = ::std::move(from);
+  }
+
+  inline TestCustomJsonName& operator=(const TestCustomJsonName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestCustomJsonName& operator=(TestCustomJsonName&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestCustomJsonName& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestCustomJsonName* internal_default_instance() {
+    return reinterpret_cast<const TestCustomJsonName*>(
+               &_TestCustomJsonName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(TestCustomJsonName& a, TestCustomJsonName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestCustomJsonName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestCustomJsonName* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestCustomJsonName* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestCustomJsonName>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestCustomJsonName& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestCustomJsonName& from) {
+    TestCustomJsonName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestCustomJsonName* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestCustomJsonName";
+  }
+  protected:
+  explicit TestCustomJsonName(::google::protobuf::Arena* arena);
+  TestCustomJsonName(::google::protobuf::Arena* arena, const TestCustomJsonName& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // int32 value = 1 [json_name = "@value"];
+  void clear_value() ;
+  ::int32_t value() const;
+  void set_value(::int32_t value);
+
+  private:
+  ::int32_t _internal_value() const;
+  void _internal_set_value(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestCustomJsonName)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t value_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestBoolValue_BoolMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestBoolValue_BoolMapEntry_DoNotUse, bool, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestBoolValue_BoolMapEntry_DoNotUse, bool, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  TestBoolValue_BoolMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestBoolValue_BoolMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestBoolValue_BoolMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestBoolValue_BoolMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestBoolValue_BoolMapEntry_DoNotUse*>(
+        &_TestBoolValue_BoolMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StringtoInt_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          StringtoInt_MapEntry_DoNotUse, std::string, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      StringtoInt_MapEntry_DoNotUse, std::string, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  StringtoInt_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR StringtoInt_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit StringtoInt_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const StringtoInt_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const StringtoInt_MapEntry_DoNotUse*>(
+        &_StringtoInt_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.StringtoInt.MapEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Mixed2_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          Mixed2_MapEntry_DoNotUse, ::int32_t, bool,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      Mixed2_MapEntry_DoNotUse, ::int32_t, bool,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>;
+  Mixed2_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR Mixed2_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit Mixed2_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const Mixed2_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const Mixed2_MapEntry_DoNotUse*>(
+        &_Mixed2_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Mixed1_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          Mixed1_MapEntry_DoNotUse, std::string, float,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      Mixed1_MapEntry_DoNotUse, std::string, float,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>;
+  Mixed1_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR Mixed1_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit Mixed1_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const Mixed1_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const Mixed1_MapEntry_DoNotUse*>(
+        &_Mixed1_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.Mixed1.MapEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MessageType final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MessageType) */ {
+ public:
+  inline MessageType() : MessageType(nullptr) {}
+  ~MessageType() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MessageType(::google::protobuf::internal::ConstantInitialized);
+
+  inline MessageType(const MessageType& from)
+      : MessageType(nullptr, from) {}
+  MessageType(MessageType&& from) noexcept
+    : MessageType() {
+    *this = ::std::move(from);
+  }
+
+  inline MessageType& operator=(const MessageType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MessageType& operator=(MessageType&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageType& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageType* internal_default_instance() {
+    return reinterpret_cast<const MessageType*>(
+               &_MessageType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MessageType& a, MessageType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageType* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageType* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MessageType* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageType>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MessageType& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MessageType& from) {
+    MessageType::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MessageType* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MessageType";
+  }
+  protected:
+  explicit MessageType(::google::protobuf::Arena* arena);
+  MessageType(::google::protobuf::Arena* arena, const MessageType& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // int32 value = 1;
+  void clear_value() ;
+  ::int32_t value() const;
+  void set_value(::int32_t value);
+
+  private:
+  ::int32_t _internal_value() const;
+  void _internal_set_value(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MessageType)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t value_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map4Entry final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOutWireFormat.Map4Entry) */ {
+ public:
+  inline MapOutWireFormat_Map4Entry() : MapOutWireFormat_Map4Entry(nullptr) {}
+  ~MapOutWireFormat_Map4Entry() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOutWireFormat_Map4Entry(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOutWireFormat_Map4Entry(const MapOutWireFormat_Map4Entry& from)
+      : MapOutWireFormat_Map4Entry(nullptr, from) {}
+  MapOutWireFormat_Map4Entry(MapOutWireFormat_Map4Entry&& from) noexcept
+    : MapOutWireFormat_Map4Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map4Entry& operator=(const MapOutWireFormat_Map4Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map4Entry& operator=(MapOutWireFormat_Map4Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOutWireFormat_Map4Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOutWireFormat_Map4Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map4Entry*>(
+               &_MapOutWireFormat_Map4Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    62;
+
+  friend void swap(MapOutWireFormat_Map4Entry& a, MapOutWireFormat_Map4Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOutWireFormat_Map4Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOutWireFormat_Map4Entry* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOutWireFormat_Map4Entry* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map4Entry>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOutWireFormat_Map4Entry& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOutWireFormat_Map4Entry& from) {
+    MapOutWireFormat_Map4Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOutWireFormat_Map4Entry* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOutWireFormat.Map4Entry";
+  }
+  protected:
+  explicit MapOutWireFormat_Map4Entry(::google::protobuf::Arena* arena);
+  MapOutWireFormat_Map4Entry(::google::protobuf::Arena* arena, const MapOutWireFormat_Map4Entry& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kKeyFieldNumber = 1,
+  };
+  // string value = 2;
+  void clear_value() ;
+  const std::string& value() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_value(Arg_&& arg, Args_... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(
+      const std::string& value);
+  std::string* _internal_mutable_value();
+
+  public:
+  // bool key = 1;
+  void clear_key() ;
+  bool key() const;
+  void set_key(bool value);
+
+  private:
+  bool _internal_key() const;
+  void _internal_set_key(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOutWireFormat.Map4Entry)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      47, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ArenaStringPtr value_;
+    bool key_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map3Entry final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOutWireFormat.Map3Entry) */ {
+ public:
+  inline MapOutWireFormat_Map3Entry() : MapOutWireFormat_Map3Entry(nullptr) {}
+  ~MapOutWireFormat_Map3Entry() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOutWireFormat_Map3Entry(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOutWireFormat_Map3Entry(const MapOutWireFormat_Map3Entry& from)
+      : MapOutWireFormat_Map3Entry(nullptr, from) {}
+  MapOutWireFormat_Map3Entry(MapOutWireFormat_Map3Entry&& from) noexcept
+    : MapOutWireFormat_Map3Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map3Entry& operator=(const MapOutWireFormat_Map3Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map3Entry& operator=(MapOutWireFormat_Map3Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOutWireFormat_Map3Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOutWireFormat_Map3Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map3Entry*>(
+               &_MapOutWireFormat_Map3Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    61;
+
+  friend void swap(MapOutWireFormat_Map3Entry& a, MapOutWireFormat_Map3Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOutWireFormat_Map3Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOutWireFormat_Map3Entry* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOutWireFormat_Map3Entry* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map3Entry>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOutWireFormat_Map3Entry& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOutWireFormat_Map3Entry& from) {
+    MapOutWireFormat_Map3Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOutWireFormat_Map3Entry* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOutWireFormat.Map3Entry";
+  }
+  protected:
+  explicit MapOutWireFormat_Map3Entry(::google::protobuf::Arena* arena);
+  MapOutWireFormat_Map3Entry(::google::protobuf::Arena* arena, const MapOutWireFormat_Map3Entry& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kKeyFieldNumber = 1,
+  };
+  // string value = 2;
+  void clear_value() ;
+  const std::string& value() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_value(Arg_&& arg, Args_... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(
+      const std::string& value);
+  std::string* _internal_mutable_value();
+
+  public:
+  // int32 key = 1;
+  void clear_key() ;
+  ::int32_t key() const;
+  void set_key(::int32_t value);
+
+  private:
+  ::int32_t _internal_key() const;
+  void _internal_set_key(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOutWireFormat.Map3Entry)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      47, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ArenaStringPtr value_;
+    ::int32_t key_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOut_Map4Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapOut_Map4Entry_DoNotUse, bool, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapOut_Map4Entry_DoNotUse, bool, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  MapOut_Map4Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOut_Map4Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapOut_Map4Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapOut_Map4Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapOut_Map4Entry_DoNotUse*>(
+        &_MapOut_Map4Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapOut.Map4Entry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOut_Map3Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapOut_Map3Entry_DoNotUse, ::int32_t, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapOut_Map3Entry_DoNotUse, ::int32_t, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  MapOut_Map3Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOut_Map3Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapOut_Map3Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapOut_Map3Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapOut_Map3Entry_DoNotUse*>(
+        &_MapOut_Map3Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapOut.Map3Entry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOfObjects_M final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOfObjects.M) */ {
+ public:
+  inline MapOfObjects_M() : MapOfObjects_M(nullptr) {}
+  ~MapOfObjects_M() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOfObjects_M(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOfObjects_M(const MapOfObjects_M& from)
+      : MapOfObjects_M(nullptr, from) {}
+  MapOfObjects_M(MapOfObjects_M&& from) noexcept
+    : MapOfObjects_M() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOfObjects_M& operator=(const MapOfObjects_M& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOfObjects_M& operator=(MapOfObjects_M&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOfObjects_M& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOfObjects_M* internal_default_instance() {
+    return reinterpret_cast<const MapOfObjects_M*>(
+               &_MapOfObjects_M_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    48;
+
+  friend void swap(MapOfObjects_M& a, MapOfObjects_M& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOfObjects_M* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOfObjects_M* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOfObjects_M* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOfObjects_M>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOfObjects_M& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOfObjects_M& from) {
+    MapOfObjects_M::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOfObjects_M* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOfObjects.M";
+  }
+  protected:
+  explicit MapOfObjects_M(::google::protobuf::Arena* arena);
+  MapOfObjects_M(::google::protobuf::Arena* arena, const MapOfObjects_M& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInnerTextFieldNumber = 1,
+  };
+  // string inner_text = 1;
+  void clear_inner_text() ;
+  const std::string& inner_text() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_inner_text(Arg_&& arg, Args_... args);
+  std::string* mutable_inner_text();
+  PROTOBUF_NODISCARD std::string* release_inner_text();
+  void set_allocated_inner_text(std::string* value);
+
+  private:
+  const std::string& _internal_inner_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_inner_text(
+      const std::string& value);
+  std::string* _internal_mutable_inner_text();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOfObjects.M)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      40, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ArenaStringPtr inner_text_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapM final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapM) */ {
+ public:
+  inline MapM() : MapM(nullptr) {}
+  ~MapM() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapM(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapM(const MapM& from)
+      : MapM(nullptr, from) {}
+  MapM(MapM&& from) noexcept
+    : MapM() {
+    *this = ::std::move(from);
+  }
+
+  inline MapM& operator=(const MapM& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapM& operator=(MapM&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapM& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapM* internal_default_instance() {
+    return reinterpret_cast<const MapM*>(
+               &_MapM_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    64;
+
+  friend void swap(MapM& a, MapM& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapM* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapM* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapM* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapM>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapM& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapM& from) {
+    MapM::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapM* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapM";
+  }
+  protected:
+  explicit MapM(::google::protobuf::Arena* arena);
+  MapM(::google::protobuf::Arena* arena, const MapM& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFooFieldNumber = 1,
+  };
+  // string foo = 1;
+  void clear_foo() ;
+  const std::string& foo() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_foo(Arg_&& arg, Args_... args);
+  std::string* mutable_foo();
+  PROTOBUF_NODISCARD std::string* release_foo();
+  void set_allocated_foo(std::string* value);
+
+  private:
+  const std::string& _internal_foo() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_foo(
+      const std::string& value);
+  std::string* _internal_mutable_foo();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapM)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      23, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ArenaStringPtr foo_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapIn_MapInputEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapIn_MapInputEntry_DoNotUse, std::string, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapIn_MapInputEntry_DoNotUse, std::string, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  MapIn_MapInputEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapIn_MapInputEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapIn_MapInputEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapIn_MapInputEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapIn_MapInputEntry_DoNotUse*>(
+        &_MapIn_MapInputEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapIn.MapInputEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapIn.MapInputEntry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IntToString_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          IntToString_MapEntry_DoNotUse, ::int32_t, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      IntToString_MapEntry_DoNotUse, ::int32_t, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  IntToString_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR IntToString_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit IntToString_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const IntToString_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const IntToString_MapEntry_DoNotUse*>(
+        &_IntToString_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.IntToString.MapEntry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EmptyMap_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          EmptyMap_MapEntry_DoNotUse, ::int32_t, ::int32_t,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+          ::google::protobuf::internal::WireFormatLite::TYPE_INT32> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      EmptyMap_MapEntry_DoNotUse, ::int32_t, ::int32_t,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>;
+  EmptyMap_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR EmptyMap_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit EmptyMap_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const EmptyMap_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const EmptyMap_MapEntry_DoNotUse*>(
+        &_EmptyMap_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BoolToString_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          BoolToString_MapEntry_DoNotUse, bool, std::string,
+          ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      BoolToString_MapEntry_DoNotUse, bool, std::string,
+      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  BoolToString_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR BoolToString_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit BoolToString_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const BoolToString_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const BoolToString_MapEntry_DoNotUse*>(
+        &_BoolToString_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.BoolToString.MapEntry.value");
+ }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestWrapper final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestWrapper) */ {
+ public:
+  inline TestWrapper() : TestWrapper(nullptr) {}
+  ~TestWrapper() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestWrapper(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestWrapper(const TestWrapper& from)
+      : TestWrapper(nullptr, from) {}
+  TestWrapper(TestWrapper&& from) noexcept
+    : TestWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline TestWrapper& operator=(const TestWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestWrapper& operator=(TestWrapper&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestWrapper& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestWrapper* internal_default_instance() {
+    return reinterpret_cast<const TestWrapper*>(
+               &_TestWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TestWrapper& a, TestWrapper& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestWrapper* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestWrapper* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestWrapper* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestWrapper>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestWrapper& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestWrapper& from) {
+    TestWrapper::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestWrapper* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestWrapper";
+  }
+  protected:
+  explicit TestWrapper(::google::protobuf::Arena* arena);
+  TestWrapper(::google::protobuf::Arena* arena, const TestWrapper& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedBoolValueFieldNumber = 11,
+    kRepeatedInt32ValueFieldNumber = 12,
+    kRepeatedInt64ValueFieldNumber = 13,
+    kRepeatedUint32ValueFieldNumber = 14,
+    kRepeatedUint64ValueFieldNumber = 15,
+    kRepeatedFloatValueFieldNumber = 16,
+    kRepeatedDoubleValueFieldNumber = 17,
+    kRepeatedStringValueFieldNumber = 18,
+    kRepeatedBytesValueFieldNumber = 19,
+    kBoolValueFieldNumber = 1,
+    kInt32ValueFieldNumber = 2,
+    kInt64ValueFieldNumber = 3,
+    kUint32ValueFieldNumber = 4,
+    kUint64ValueFieldNumber = 5,
+    kFloatValueFieldNumber = 6,
+    kDoubleValueFieldNumber = 7,
+    kStringValueFieldNumber = 8,
+    kBytesValueFieldNumber = 9,
+  };
+  // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+  int repeated_bool_value_size() const;
+  private:
+  int _internal_repeated_bool_value_size() const;
+
+  public:
+  void clear_repeated_bool_value() ;
+  ::google::protobuf::BoolValue* mutable_repeated_bool_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::BoolValue >*
+      mutable_repeated_bool_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>& _internal_repeated_bool_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>* _internal_mutable_repeated_bool_value();
+  public:
+  const ::google::protobuf::BoolValue& repeated_bool_value(int index) const;
+  ::google::protobuf::BoolValue* add_repeated_bool_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::BoolValue >&
+      repeated_bool_value() const;
+  // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+  int repeated_int32_value_size() const;
+  private:
+  int _internal_repeated_int32_value_size() const;
+
+  public:
+  void clear_repeated_int32_value() ;
+  ::google::protobuf::Int32Value* mutable_repeated_int32_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int32Value >*
+      mutable_repeated_int32_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>& _internal_repeated_int32_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>* _internal_mutable_repeated_int32_value();
+  public:
+  const ::google::protobuf::Int32Value& repeated_int32_value(int index) const;
+  ::google::protobuf::Int32Value* add_repeated_int32_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int32Value >&
+      repeated_int32_value() const;
+  // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+  int repeated_int64_value_size() const;
+  private:
+  int _internal_repeated_int64_value_size() const;
+
+  public:
+  void clear_repeated_int64_value() ;
+  ::google::protobuf::Int64Value* mutable_repeated_int64_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int64Value >*
+      mutable_repeated_int64_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>& _internal_repeated_int64_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>* _internal_mutable_repeated_int64_value();
+  public:
+  const ::google::protobuf::Int64Value& repeated_int64_value(int index) const;
+  ::google::protobuf::Int64Value* add_repeated_int64_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int64Value >&
+      repeated_int64_value() const;
+  // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+  int repeated_uint32_value_size() const;
+  private:
+  int _internal_repeated_uint32_value_size() const;
+
+  public:
+  void clear_repeated_uint32_value() ;
+  ::google::protobuf::UInt32Value* mutable_repeated_uint32_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt32Value >*
+      mutable_repeated_uint32_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>& _internal_repeated_uint32_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>* _internal_mutable_repeated_uint32_value();
+  public:
+  const ::google::protobuf::UInt32Value& repeated_uint32_value(int index) const;
+  ::google::protobuf::UInt32Value* add_repeated_uint32_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt32Value >&
+      repeated_uint32_value() const;
+  // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+  int repeated_uint64_value_size() const;
+  private:
+  int _internal_repeated_uint64_value_size() const;
+
+  public:
+  void clear_repeated_uint64_value() ;
+  ::google::protobuf::UInt64Value* mutable_repeated_uint64_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt64Value >*
+      mutable_repeated_uint64_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>& _internal_repeated_uint64_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>* _internal_mutable_repeated_uint64_value();
+  public:
+  const ::google::protobuf::UInt64Value& repeated_uint64_value(int index) const;
+  ::google::protobuf::UInt64Value* add_repeated_uint64_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt64Value >&
+      repeated_uint64_value() const;
+  // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+  int repeated_float_value_size() const;
+  private:
+  int _internal_repeated_float_value_size() const;
+
+  public:
+  void clear_repeated_float_value() ;
+  ::google::protobuf::FloatValue* mutable_repeated_float_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::FloatValue >*
+      mutable_repeated_float_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>& _internal_repeated_float_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>* _internal_mutable_repeated_float_value();
+  public:
+  const ::google::protobuf::FloatValue& repeated_float_value(int index) const;
+  ::google::protobuf::FloatValue* add_repeated_float_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::FloatValue >&
+      repeated_float_value() const;
+  // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+  int repeated_double_value_size() const;
+  private:
+  int _internal_repeated_double_value_size() const;
+
+  public:
+  void clear_repeated_double_value() ;
+  ::google::protobuf::DoubleValue* mutable_repeated_double_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::DoubleValue >*
+      mutable_repeated_double_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>& _internal_repeated_double_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>* _internal_mutable_repeated_double_value();
+  public:
+  const ::google::protobuf::DoubleValue& repeated_double_value(int index) const;
+  ::google::protobuf::DoubleValue* add_repeated_double_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::DoubleValue >&
+      repeated_double_value() const;
+  // repeated .google.protobuf.StringValue repeated_string_value = 18;
+  int repeated_string_value_size() const;
+  private:
+  int _internal_repeated_string_value_size() const;
+
+  public:
+  void clear_repeated_string_value() ;
+  ::google::protobuf::StringValue* mutable_repeated_string_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::StringValue >*
+      mutable_repeated_string_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>& _internal_repeated_string_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>* _internal_mutable_repeated_string_value();
+  public:
+  const ::google::protobuf::StringValue& repeated_string_value(int index) const;
+  ::google::protobuf::StringValue* add_repeated_string_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::StringValue >&
+      repeated_string_value() const;
+  // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+  int repeated_bytes_value_size() const;
+  private:
+  int _internal_repeated_bytes_value_size() const;
+
+  public:
+  void clear_repeated_bytes_value() ;
+  ::google::protobuf::BytesValue* mutable_repeated_bytes_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::BytesValue >*
+      mutable_repeated_bytes_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>& _internal_repeated_bytes_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>* _internal_mutable_repeated_bytes_value();
+  public:
+  const ::google::protobuf::BytesValue& repeated_bytes_value(int index) const;
+  ::google::protobuf::BytesValue* add_repeated_bytes_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::BytesValue >&
+      repeated_bytes_value() const;
+  // .google.protobuf.BoolValue bool_value = 1;
+  bool has_bool_value() const;
+  void clear_bool_value() ;
+  const ::google::protobuf::BoolValue& bool_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::BoolValue* release_bool_value();
+  ::google::protobuf::BoolValue* mutable_bool_value();
+  void set_allocated_bool_value(::google::protobuf::BoolValue* value);
+  void unsafe_arena_set_allocated_bool_value(::google::protobuf::BoolValue* value);
+  ::google::protobuf::BoolValue* unsafe_arena_release_bool_value();
+
+  private:
+  const ::google::protobuf::BoolValue& _internal_bool_value() const;
+  ::google::protobuf::BoolValue* _internal_mutable_bool_value();
+
+  public:
+  // .google.protobuf.Int32Value int32_value = 2;
+  bool has_int32_value() const;
+  void clear_int32_value() ;
+  const ::google::protobuf::Int32Value& int32_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Int32Value* release_int32_value();
+  ::google::protobuf::Int32Value* mutable_int32_value();
+  void set_allocated_int32_value(::google::protobuf::Int32Value* value);
+  void unsafe_arena_set_allocated_int32_value(::google::protobuf::Int32Value* value);
+  ::google::protobuf::Int32Value* unsafe_arena_release_int32_value();
+
+  private:
+  const ::google::protobuf::Int32Value& _internal_int32_value() const;
+  ::google::protobuf::Int32Value* _internal_mutable_int32_value();
+
+  public:
+  // .google.protobuf.Int64Value int64_value = 3;
+  bool has_int64_value() const;
+  void clear_int64_value() ;
+  const ::google::protobuf::Int64Value& int64_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Int64Value* release_int64_value();
+  ::google::protobuf::Int64Value* mutable_int64_value();
+  void set_allocated_int64_value(::google::protobuf::Int64Value* value);
+  void unsafe_arena_set_allocated_int64_value(::google::protobuf::Int64Value* value);
+  ::google::protobuf::Int64Value* unsafe_arena_release_int64_value();
+
+  private:
+  const ::google::protobuf::Int64Value& _internal_int64_value() const;
+  ::google::protobuf::Int64Value* _internal_mutable_int64_value();
+
+  public:
+  // .google.protobuf.UInt32Value uint32_value = 4;
+  bool has_uint32_value() const;
+  void clear_uint32_value() ;
+  const ::google::protobuf::UInt32Value& uint32_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::UInt32Value* release_uint32_value();
+  ::google::protobuf::UInt32Value* mutable_uint32_value();
+  void set_allocated_uint32_value(::google::protobuf::UInt32Value* value);
+  void unsafe_arena_set_allocated_uint32_value(::google::protobuf::UInt32Value* value);
+  ::google::protobuf::UInt32Value* unsafe_arena_release_uint32_value();
+
+  private:
+  const ::google::protobuf::UInt32Value& _internal_uint32_value() const;
+  ::google::protobuf::UInt32Value* _internal_mutable_uint32_value();
+
+  public:
+  // .google.protobuf.UInt64Value uint64_value = 5;
+  bool has_uint64_value() const;
+  void clear_uint64_value() ;
+  const ::google::protobuf::UInt64Value& uint64_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::UInt64Value* release_uint64_value();
+  ::google::protobuf::UInt64Value* mutable_uint64_value();
+  void set_allocated_uint64_value(::google::protobuf::UInt64Value* value);
+  void unsafe_arena_set_allocated_uint64_value(::google::protobuf::UInt64Value* value);
+  ::google::protobuf::UInt64Value* unsafe_arena_release_uint64_value();
+
+  private:
+  const ::google::protobuf::UInt64Value& _internal_uint64_value() const;
+  ::google::protobuf::UInt64Value* _internal_mutable_uint64_value();
+
+  public:
+  // .google.protobuf.FloatValue float_value = 6;
+  bool has_float_value() const;
+  void clear_float_value() ;
+  const ::google::protobuf::FloatValue& float_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FloatValue* release_float_value();
+  ::google::protobuf::FloatValue* mutable_float_value();
+  void set_allocated_float_value(::google::protobuf::FloatValue* value);
+  void unsafe_arena_set_allocated_float_value(::google::protobuf::FloatValue* value);
+  ::google::protobuf::FloatValue* unsafe_arena_release_float_value();
+
+  private:
+  const ::google::protobuf::FloatValue& _internal_float_value() const;
+  ::google::protobuf::FloatValue* _internal_mutable_float_value();
+
+  public:
+  // .google.protobuf.DoubleValue double_value = 7;
+  bool has_double_value() const;
+  void clear_double_value() ;
+  const ::google::protobuf::DoubleValue& double_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::DoubleValue* release_double_value();
+  ::google::protobuf::DoubleValue* mutable_double_value();
+  void set_allocated_double_value(::google::protobuf::DoubleValue* value);
+  void unsafe_arena_set_allocated_double_value(::google::protobuf::DoubleValue* value);
+  ::google::protobuf::DoubleValue* unsafe_arena_release_double_value();
+
+  private:
+  const ::google::protobuf::DoubleValue& _internal_double_value() const;
+  ::google::protobuf::DoubleValue* _internal_mutable_double_value();
+
+  public:
+  // .google.protobuf.StringValue string_value = 8;
+  bool has_string_value() const;
+  void clear_string_value() ;
+  const ::google::protobuf::StringValue& string_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::StringValue* release_string_value();
+  ::google::protobuf::StringValue* mutable_string_value();
+  void set_allocated_string_value(::google::protobuf::StringValue* value);
+  void unsafe_arena_set_allocated_string_value(::google::protobuf::StringValue* value);
+  ::google::protobuf::StringValue* unsafe_arena_release_string_value();
+
+  private:
+  const ::google::protobuf::StringValue& _internal_string_value() const;
+  ::google::protobuf::StringValue* _internal_mutable_string_value();
+
+  public:
+  // .google.protobuf.BytesValue bytes_value = 9;
+  bool has_bytes_value() const;
+  void clear_bytes_value() ;
+  const ::google::protobuf::BytesValue& bytes_value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::BytesValue* release_bytes_value();
+  ::google::protobuf::BytesValue* mutable_bytes_value();
+  void set_allocated_bytes_value(::google::protobuf::BytesValue* value);
+  void unsafe_arena_set_allocated_bytes_value(::google::protobuf::BytesValue* value);
+  ::google::protobuf::BytesValue* unsafe_arena_release_bytes_value();
+
+  private:
+  const ::google::protobuf::BytesValue& _internal_bytes_value() const;
+  ::google::protobuf::BytesValue* _internal_mutable_bytes_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestWrapper)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 18, 18,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::BoolValue > repeated_bool_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int32Value > repeated_int32_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Int64Value > repeated_int64_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt32Value > repeated_uint32_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::UInt64Value > repeated_uint64_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::FloatValue > repeated_float_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::DoubleValue > repeated_double_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::StringValue > repeated_string_value_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::BytesValue > repeated_bytes_value_;
+    ::google::protobuf::BoolValue* bool_value_;
+    ::google::protobuf::Int32Value* int32_value_;
+    ::google::protobuf::Int64Value* int64_value_;
+    ::google::protobuf::UInt32Value* uint32_value_;
+    ::google::protobuf::UInt64Value* uint64_value_;
+    ::google::protobuf::FloatValue* float_value_;
+    ::google::protobuf::DoubleValue* double_value_;
+    ::google::protobuf::StringValue* string_value_;
+    ::google::protobuf::BytesValue* bytes_value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestValue final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestValue) */ {
+ public:
+  inline TestValue() : TestValue(nullptr) {}
+  ~TestValue() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestValue(const TestValue& from)
+      : TestValue(nullptr, from) {}
+  TestValue(TestValue&& from) noexcept
+    : TestValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TestValue& operator=(const TestValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestValue& operator=(TestValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestValue* internal_default_instance() {
+    return reinterpret_cast<const TestValue*>(
+               &_TestValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(TestValue& a, TestValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestValue* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestValue* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestValue& from) {
+    TestValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestValue* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestValue";
+  }
+  protected:
+  explicit TestValue(::google::protobuf::Arena* arena);
+  TestValue(::google::protobuf::Arena* arena, const TestValue& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedValueFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.Value repeated_value = 2;
+  int repeated_value_size() const;
+  private:
+  int _internal_repeated_value_size() const;
+
+  public:
+  void clear_repeated_value() ;
+  ::google::protobuf::Value* mutable_repeated_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Value >*
+      mutable_repeated_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Value>& _internal_repeated_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Value>* _internal_mutable_repeated_value();
+  public:
+  const ::google::protobuf::Value& repeated_value(int index) const;
+  ::google::protobuf::Value* add_repeated_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Value >&
+      repeated_value() const;
+  // .google.protobuf.Value value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::Value& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Value* release_value();
+  ::google::protobuf::Value* mutable_value();
+  void set_allocated_value(::google::protobuf::Value* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::Value* value);
+  ::google::protobuf::Value* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::Value& _internal_value() const;
+  ::google::protobuf::Value* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestValue)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Value > repeated_value_;
+    ::google::protobuf::Value* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestTimestamp final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestTimestamp) */ {
+ public:
+  inline TestTimestamp() : TestTimestamp(nullptr) {}
+  ~TestTimestamp() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestTimestamp(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestTimestamp(const TestTimestamp& from)
+      : TestTimestamp(nullptr, from) {}
+  TestTimestamp(TestTimestamp&& from) noexcept
+    : TestTimestamp() {
+    *this = ::std::move(from);
+  }
+
+  inline TestTimestamp& operator=(const TestTimestamp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestTimestamp& operator=(TestTimestamp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestTimestamp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestTimestamp* internal_default_instance() {
+    return reinterpret_cast<const TestTimestamp*>(
+               &_TestTimestamp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(TestTimestamp& a, TestTimestamp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestTimestamp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestTimestamp* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestTimestamp* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestTimestamp>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestTimestamp& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestTimestamp& from) {
+    TestTimestamp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestTimestamp* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestTimestamp";
+  }
+  protected:
+  explicit TestTimestamp(::google::protobuf::Arena* arena);
+  TestTimestamp(::google::protobuf::Arena* arena, const TestTimestamp& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedValueFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.Timestamp repeated_value = 2;
+  int repeated_value_size() const;
+  private:
+  int _internal_repeated_value_size() const;
+
+  public:
+  void clear_repeated_value() ;
+  ::google::protobuf::Timestamp* mutable_repeated_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Timestamp >*
+      mutable_repeated_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>& _internal_repeated_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>* _internal_mutable_repeated_value();
+  public:
+  const ::google::protobuf::Timestamp& repeated_value(int index) const;
+  ::google::protobuf::Timestamp* add_repeated_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Timestamp >&
+      repeated_value() const;
+  // .google.protobuf.Timestamp value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::Timestamp& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Timestamp* release_value();
+  ::google::protobuf::Timestamp* mutable_value();
+  void set_allocated_value(::google::protobuf::Timestamp* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::Timestamp* value);
+  ::google::protobuf::Timestamp* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::Timestamp& _internal_value() const;
+  ::google::protobuf::Timestamp* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestTimestamp)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Timestamp > repeated_value_;
+    ::google::protobuf::Timestamp* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestStruct final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestStruct) */ {
+ public:
+  inline TestStruct() : TestStruct(nullptr) {}
+  ~TestStruct() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestStruct(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestStruct(const TestStruct& from)
+      : TestStruct(nullptr, from) {}
+  TestStruct(TestStruct&& from) noexcept
+    : TestStruct() {
+    *this = ::std::move(from);
+  }
+
+  inline TestStruct& operator=(const TestStruct& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestStruct& operator=(TestStruct&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestStruct& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestStruct* internal_default_instance() {
+    return reinterpret_cast<const TestStruct*>(
+               &_TestStruct_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(TestStruct& a, TestStruct& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestStruct* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestStruct* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestStruct* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestStruct>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestStruct& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestStruct& from) {
+    TestStruct::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestStruct* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestStruct";
+  }
+  protected:
+  explicit TestStruct(::google::protobuf::Arena* arena);
+  TestStruct(::google::protobuf::Arena* arena, const TestStruct& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedValueFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.Struct repeated_value = 2;
+  int repeated_value_size() const;
+  private:
+  int _internal_repeated_value_size() const;
+
+  public:
+  void clear_repeated_value() ;
+  ::google::protobuf::Struct* mutable_repeated_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Struct >*
+      mutable_repeated_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>& _internal_repeated_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>* _internal_mutable_repeated_value();
+  public:
+  const ::google::protobuf::Struct& repeated_value(int index) const;
+  ::google::protobuf::Struct* add_repeated_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Struct >&
+      repeated_value() const;
+  // .google.protobuf.Struct value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::Struct& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Struct* release_value();
+  ::google::protobuf::Struct* mutable_value();
+  void set_allocated_value(::google::protobuf::Struct* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::Struct* value);
+  ::google::protobuf::Struct* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::Struct& _internal_value() const;
+  ::google::protobuf::Struct* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestStruct)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Struct > repeated_value_;
+    ::google::protobuf::Struct* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestStringMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestStringMap) */ {
+ public:
+  inline TestStringMap() : TestStringMap(nullptr) {}
+  ~TestStringMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestStringMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestStringMap(const TestStringMap& from)
+      : TestStringMap(nullptr, from) {}
+  TestStringMap(TestStringMap&& from) noexcept
+    : TestStringMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestStringMap& operator=(const TestStringMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestStringMap& operator=(TestStringMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestStringMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestStringMap* internal_default_instance() {
+    return reinterpret_cast<const TestStringMap*>(
+               &_TestStringMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TestStringMap& a, TestStringMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestStringMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestStringMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestStringMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestStringMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestStringMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestStringMap& from) {
+    TestStringMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestStringMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestStringMap";
+  }
+  protected:
+  explicit TestStringMap(::google::protobuf::Arena* arena);
+  TestStringMap(::google::protobuf::Arena* arena, const TestStringMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStringMapFieldNumber = 1,
+  };
+  // map<string, string> string_map = 1;
+  int string_map_size() const;
+  private:
+  int _internal_string_map_size() const;
+
+  public:
+  void clear_string_map() ;
+  const ::google::protobuf::Map<std::string, std::string>& string_map() const;
+  ::google::protobuf::Map<std::string, std::string>* mutable_string_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, std::string>& _internal_string_map() const;
+  ::google::protobuf::Map<std::string, std::string>* _internal_mutable_string_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestStringMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      39, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestStringMap_StringMapEntry_DoNotUse, std::string, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        string_map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestOneof final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestOneof) */ {
+ public:
+  inline TestOneof() : TestOneof(nullptr) {}
+  ~TestOneof() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestOneof(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestOneof(const TestOneof& from)
+      : TestOneof(nullptr, from) {}
+  TestOneof(TestOneof&& from) noexcept
+    : TestOneof() {
+    *this = ::std::move(from);
+  }
+
+  inline TestOneof& operator=(const TestOneof& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestOneof& operator=(TestOneof&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestOneof& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OneofValueCase {
+    kOneofInt32Value = 1,
+    kOneofStringValue = 2,
+    kOneofBytesValue = 3,
+    kOneofEnumValue = 4,
+    kOneofMessageValue = 5,
+    kOneofNullValue = 6,
+    ONEOF_VALUE_NOT_SET = 0,
+  };
+
+  static inline const TestOneof* internal_default_instance() {
+    return reinterpret_cast<const TestOneof*>(
+               &_TestOneof_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestOneof& a, TestOneof& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestOneof* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestOneof* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestOneof* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestOneof>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestOneof& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestOneof& from) {
+    TestOneof::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestOneof* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestOneof";
+  }
+  protected:
+  explicit TestOneof(::google::protobuf::Arena* arena);
+  TestOneof(::google::protobuf::Arena* arena, const TestOneof& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOneofInt32ValueFieldNumber = 1,
+    kOneofStringValueFieldNumber = 2,
+    kOneofBytesValueFieldNumber = 3,
+    kOneofEnumValueFieldNumber = 4,
+    kOneofMessageValueFieldNumber = 5,
+    kOneofNullValueFieldNumber = 6,
+  };
+  // int32 oneof_int32_value = 1;
+  bool has_oneof_int32_value() const;
+  void clear_oneof_int32_value() ;
+  ::int32_t oneof_int32_value() const;
+  void set_oneof_int32_value(::int32_t value);
+
+  private:
+  ::int32_t _internal_oneof_int32_value() const;
+  void _internal_set_oneof_int32_value(::int32_t value);
+
+  public:
+  // string oneof_string_value = 2;
+  bool has_oneof_string_value() const;
+  void clear_oneof_string_value() ;
+  const std::string& oneof_string_value() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_string_value(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_string_value();
+  PROTOBUF_NODISCARD std::string* release_oneof_string_value();
+  void set_allocated_oneof_string_value(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_string_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_string_value(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_string_value();
+
+  public:
+  // bytes oneof_bytes_value = 3;
+  bool has_oneof_bytes_value() const;
+  void clear_oneof_bytes_value() ;
+  const std::string& oneof_bytes_value() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_oneof_bytes_value(Arg_&& arg, Args_... args);
+  std::string* mutable_oneof_bytes_value();
+  PROTOBUF_NODISCARD std::string* release_oneof_bytes_value();
+  void set_allocated_oneof_bytes_value(std::string* value);
+
+  private:
+  const std::string& _internal_oneof_bytes_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oneof_bytes_value(
+      const std::string& value);
+  std::string* _internal_mutable_oneof_bytes_value();
+
+  public:
+  // .proto3.EnumType oneof_enum_value = 4;
+  bool has_oneof_enum_value() const;
+  void clear_oneof_enum_value() ;
+  ::proto3::EnumType oneof_enum_value() const;
+  void set_oneof_enum_value(::proto3::EnumType value);
+
+  private:
+  ::proto3::EnumType _internal_oneof_enum_value() const;
+  void _internal_set_oneof_enum_value(::proto3::EnumType value);
+
+  public:
+  // .proto3.MessageType oneof_message_value = 5;
+  bool has_oneof_message_value() const;
+  private:
+  bool _internal_has_oneof_message_value() const;
+
+  public:
+  void clear_oneof_message_value() ;
+  const ::proto3::MessageType& oneof_message_value() const;
+  PROTOBUF_NODISCARD ::proto3::MessageType* release_oneof_message_value();
+  ::proto3::MessageType* mutable_oneof_message_value();
+  void set_allocated_oneof_message_value(::proto3::MessageType* value);
+  void unsafe_arena_set_allocated_oneof_message_value(::proto3::MessageType* value);
+  ::proto3::MessageType* unsafe_arena_release_oneof_message_value();
+
+  private:
+  const ::proto3::MessageType& _internal_oneof_message_value() const;
+  ::proto3::MessageType* _internal_mutable_oneof_message_value();
+
+  public:
+  // .google.protobuf.NullValue oneof_null_value = 6;
+  bool has_oneof_null_value() const;
+  void clear_oneof_null_value() ;
+  ::google::protobuf::NullValue oneof_null_value() const;
+  void set_oneof_null_value(::google::protobuf::NullValue value);
+
+  private:
+  ::google::protobuf::NullValue _internal_oneof_null_value() const;
+  void _internal_set_oneof_null_value(::google::protobuf::NullValue value);
+
+  public:
+  void clear_oneof_value();
+  OneofValueCase oneof_value_case() const;
+  // @@protoc_insertion_point(class_scope:proto3.TestOneof)
+ private:
+  class _Internal;
+  void set_has_oneof_int32_value();
+  void set_has_oneof_string_value();
+  void set_has_oneof_bytes_value();
+  void set_has_oneof_enum_value();
+  void set_has_oneof_message_value();
+  void set_has_oneof_null_value();
+
+  inline bool has_oneof_value() const;
+  inline void clear_has_oneof_value();
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 6, 1,
+      43, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    union OneofValueUnion {
+      constexpr OneofValueUnion() : _constinit_{} {}
+        ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::int32_t oneof_int32_value_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_string_value_;
+      ::google::protobuf::internal::ArenaStringPtr oneof_bytes_value_;
+      int oneof_enum_value_;
+      ::proto3::MessageType* oneof_message_value_;
+      int oneof_null_value_;
+    } oneof_value_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestNestedMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestNestedMap) */ {
+ public:
+  inline TestNestedMap() : TestNestedMap(nullptr) {}
+  ~TestNestedMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestNestedMap(const TestNestedMap& from)
+      : TestNestedMap(nullptr, from) {}
+  TestNestedMap(TestNestedMap&& from) noexcept
+    : TestNestedMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestNestedMap& operator=(const TestNestedMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestNestedMap& operator=(TestNestedMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestNestedMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestNestedMap* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap*>(
+               &_TestNestedMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(TestNestedMap& a, TestNestedMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestNestedMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestNestedMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestNestedMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestNestedMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestNestedMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestNestedMap& from) {
+    TestNestedMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestNestedMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestNestedMap";
+  }
+  protected:
+  explicit TestNestedMap(::google::protobuf::Arena* arena);
+  TestNestedMap(::google::protobuf::Arena* arena, const TestNestedMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBoolMapFieldNumber = 1,
+    kInt32MapFieldNumber = 2,
+    kInt64MapFieldNumber = 3,
+    kUint32MapFieldNumber = 4,
+    kUint64MapFieldNumber = 5,
+    kStringMapFieldNumber = 6,
+    kMapMapFieldNumber = 7,
+  };
+  // map<bool, int32> bool_map = 1;
+  int bool_map_size() const;
+  private:
+  int _internal_bool_map_size() const;
+
+  public:
+  void clear_bool_map() ;
+  const ::google::protobuf::Map<bool, ::int32_t>& bool_map() const;
+  ::google::protobuf::Map<bool, ::int32_t>* mutable_bool_map();
+
+  private:
+  const ::google::protobuf::Map<bool, ::int32_t>& _internal_bool_map() const;
+  ::google::protobuf::Map<bool, ::int32_t>* _internal_mutable_bool_map();
+
+  public:
+  // map<int32, int32> int32_map = 2;
+  int int32_map_size() const;
+  private:
+  int _internal_int32_map_size() const;
+
+  public:
+  void clear_int32_map() ;
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& int32_map() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* mutable_int32_map();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& _internal_int32_map() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* _internal_mutable_int32_map();
+
+  public:
+  // map<int64, int32> int64_map = 3;
+  int int64_map_size() const;
+  private:
+  int _internal_int64_map_size() const;
+
+  public:
+  void clear_int64_map() ;
+  const ::google::protobuf::Map<::int64_t, ::int32_t>& int64_map() const;
+  ::google::protobuf::Map<::int64_t, ::int32_t>* mutable_int64_map();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::int32_t>& _internal_int64_map() const;
+  ::google::protobuf::Map<::int64_t, ::int32_t>* _internal_mutable_int64_map();
+
+  public:
+  // map<uint32, int32> uint32_map = 4;
+  int uint32_map_size() const;
+  private:
+  int _internal_uint32_map_size() const;
+
+  public:
+  void clear_uint32_map() ;
+  const ::google::protobuf::Map<::uint32_t, ::int32_t>& uint32_map() const;
+  ::google::protobuf::Map<::uint32_t, ::int32_t>* mutable_uint32_map();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::int32_t>& _internal_uint32_map() const;
+  ::google::protobuf::Map<::uint32_t, ::int32_t>* _internal_mutable_uint32_map();
+
+  public:
+  // map<uint64, int32> uint64_map = 5;
+  int uint64_map_size() const;
+  private:
+  int _internal_uint64_map_size() const;
+
+  public:
+  void clear_uint64_map() ;
+  const ::google::protobuf::Map<::uint64_t, ::int32_t>& uint64_map() const;
+  ::google::protobuf::Map<::uint64_t, ::int32_t>* mutable_uint64_map();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::int32_t>& _internal_uint64_map() const;
+  ::google::protobuf::Map<::uint64_t, ::int32_t>* _internal_mutable_uint64_map();
+
+  public:
+  // map<string, int32> string_map = 6;
+  int string_map_size() const;
+  private:
+  int _internal_string_map_size() const;
+
+  public:
+  void clear_string_map() ;
+  const ::google::protobuf::Map<std::string, ::int32_t>& string_map() const;
+  ::google::protobuf::Map<std::string, ::int32_t>* mutable_string_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::int32_t>& _internal_string_map() const;
+  ::google::protobuf::Map<std::string, ::int32_t>* _internal_mutable_string_map();
+
+  public:
+  // map<string, .proto3.TestNestedMap> map_map = 7;
+  int map_map_size() const;
+  private:
+  int _internal_map_map_size() const;
+
+  public:
+  void clear_map_map() ;
+  const ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>& map_map() const;
+  ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>* mutable_map_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>& _internal_map_map() const;
+  ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>* _internal_mutable_map_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestNestedMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 7, 8,
+      46, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestNestedMap_BoolMapEntry_DoNotUse, bool, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        bool_map_;
+    ::google::protobuf::internal::MapField<TestNestedMap_Int32MapEntry_DoNotUse, ::int32_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        int32_map_;
+    ::google::protobuf::internal::MapField<TestNestedMap_Int64MapEntry_DoNotUse, ::int64_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        int64_map_;
+    ::google::protobuf::internal::MapField<TestNestedMap_Uint32MapEntry_DoNotUse, ::uint32_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        uint32_map_;
+    ::google::protobuf::internal::MapField<TestNestedMap_Uint64MapEntry_DoNotUse, ::uint64_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        uint64_map_;
+    ::google::protobuf::internal::MapField<TestNestedMap_StringMapEntry_DoNotUse, std::string, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        string_map_;
+    ::google::protobuf::internal::MapField<TestNestedMap_MapMapEntry_DoNotUse, std::string, ::proto3::TestNestedMap,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        map_map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestNestedMap_MapMapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          TestNestedMap_MapMapEntry_DoNotUse, std::string, ::proto3::TestNestedMap,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      TestNestedMap_MapMapEntry_DoNotUse, std::string, ::proto3::TestNestedMap,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  TestNestedMap_MapMapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR TestNestedMap_MapMapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit TestNestedMap_MapMapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const TestNestedMap_MapMapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const TestNestedMap_MapMapEntry_DoNotUse*>(
+        &_TestNestedMap_MapMapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.TestNestedMap.MapMapEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMessage final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestMessage) */ {
+ public:
+  inline TestMessage() : TestMessage(nullptr) {}
+  ~TestMessage() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMessage(const TestMessage& from)
+      : TestMessage(nullptr, from) {}
+  TestMessage(TestMessage&& from) noexcept
+    : TestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessage& operator=(const TestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessage& operator=(TestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMessage* internal_default_instance() {
+    return reinterpret_cast<const TestMessage*>(
+               &_TestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestMessage& a, TestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessage* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMessage* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestMessage& from) {
+    TestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMessage* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestMessage";
+  }
+  protected:
+  explicit TestMessage(::google::protobuf::Arena* arena);
+  TestMessage(::google::protobuf::Arena* arena, const TestMessage& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedBoolValueFieldNumber = 21,
+    kRepeatedInt32ValueFieldNumber = 22,
+    kRepeatedInt64ValueFieldNumber = 23,
+    kRepeatedUint32ValueFieldNumber = 24,
+    kRepeatedUint64ValueFieldNumber = 25,
+    kRepeatedFloatValueFieldNumber = 26,
+    kRepeatedDoubleValueFieldNumber = 27,
+    kRepeatedStringValueFieldNumber = 28,
+    kRepeatedBytesValueFieldNumber = 29,
+    kRepeatedEnumValueFieldNumber = 30,
+    kRepeatedMessageValueFieldNumber = 31,
+    kStringValueFieldNumber = 8,
+    kBytesValueFieldNumber = 9,
+    kMessageValueFieldNumber = 11,
+    kBoolValueFieldNumber = 1,
+    kInt32ValueFieldNumber = 2,
+    kInt64ValueFieldNumber = 3,
+    kUint64ValueFieldNumber = 5,
+    kUint32ValueFieldNumber = 4,
+    kFloatValueFieldNumber = 6,
+    kDoubleValueFieldNumber = 7,
+    kEnumValueFieldNumber = 10,
+  };
+  // repeated bool repeated_bool_value = 21;
+  int repeated_bool_value_size() const;
+  private:
+  int _internal_repeated_bool_value_size() const;
+
+  public:
+  void clear_repeated_bool_value() ;
+  bool repeated_bool_value(int index) const;
+  void set_repeated_bool_value(int index, bool value);
+  void add_repeated_bool_value(bool value);
+  const ::google::protobuf::RepeatedField<bool>& repeated_bool_value() const;
+  ::google::protobuf::RepeatedField<bool>* mutable_repeated_bool_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<bool>& _internal_repeated_bool_value() const;
+  ::google::protobuf::RepeatedField<bool>* _internal_mutable_repeated_bool_value();
+
+  public:
+  // repeated int32 repeated_int32_value = 22;
+  int repeated_int32_value_size() const;
+  private:
+  int _internal_repeated_int32_value_size() const;
+
+  public:
+  void clear_repeated_int32_value() ;
+  ::int32_t repeated_int32_value(int index) const;
+  void set_repeated_int32_value(int index, ::int32_t value);
+  void add_repeated_int32_value(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& repeated_int32_value() const;
+  ::google::protobuf::RepeatedField<::int32_t>* mutable_repeated_int32_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_repeated_int32_value() const;
+  ::google::protobuf::RepeatedField<::int32_t>* _internal_mutable_repeated_int32_value();
+
+  public:
+  // repeated int64 repeated_int64_value = 23;
+  int repeated_int64_value_size() const;
+  private:
+  int _internal_repeated_int64_value_size() const;
+
+  public:
+  void clear_repeated_int64_value() ;
+  ::int64_t repeated_int64_value(int index) const;
+  void set_repeated_int64_value(int index, ::int64_t value);
+  void add_repeated_int64_value(::int64_t value);
+  const ::google::protobuf::RepeatedField<::int64_t>& repeated_int64_value() const;
+  ::google::protobuf::RepeatedField<::int64_t>* mutable_repeated_int64_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int64_t>& _internal_repeated_int64_value() const;
+  ::google::protobuf::RepeatedField<::int64_t>* _internal_mutable_repeated_int64_value();
+
+  public:
+  // repeated uint32 repeated_uint32_value = 24;
+  int repeated_uint32_value_size() const;
+  private:
+  int _internal_repeated_uint32_value_size() const;
+
+  public:
+  void clear_repeated_uint32_value() ;
+  ::uint32_t repeated_uint32_value(int index) const;
+  void set_repeated_uint32_value(int index, ::uint32_t value);
+  void add_repeated_uint32_value(::uint32_t value);
+  const ::google::protobuf::RepeatedField<::uint32_t>& repeated_uint32_value() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* mutable_repeated_uint32_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint32_t>& _internal_repeated_uint32_value() const;
+  ::google::protobuf::RepeatedField<::uint32_t>* _internal_mutable_repeated_uint32_value();
+
+  public:
+  // repeated uint64 repeated_uint64_value = 25;
+  int repeated_uint64_value_size() const;
+  private:
+  int _internal_repeated_uint64_value_size() const;
+
+  public:
+  void clear_repeated_uint64_value() ;
+  ::uint64_t repeated_uint64_value(int index) const;
+  void set_repeated_uint64_value(int index, ::uint64_t value);
+  void add_repeated_uint64_value(::uint64_t value);
+  const ::google::protobuf::RepeatedField<::uint64_t>& repeated_uint64_value() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* mutable_repeated_uint64_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<::uint64_t>& _internal_repeated_uint64_value() const;
+  ::google::protobuf::RepeatedField<::uint64_t>* _internal_mutable_repeated_uint64_value();
+
+  public:
+  // repeated float repeated_float_value = 26;
+  int repeated_float_value_size() const;
+  private:
+  int _internal_repeated_float_value_size() const;
+
+  public:
+  void clear_repeated_float_value() ;
+  float repeated_float_value(int index) const;
+  void set_repeated_float_value(int index, float value);
+  void add_repeated_float_value(float value);
+  const ::google::protobuf::RepeatedField<float>& repeated_float_value() const;
+  ::google::protobuf::RepeatedField<float>* mutable_repeated_float_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<float>& _internal_repeated_float_value() const;
+  ::google::protobuf::RepeatedField<float>* _internal_mutable_repeated_float_value();
+
+  public:
+  // repeated double repeated_double_value = 27;
+  int repeated_double_value_size() const;
+  private:
+  int _internal_repeated_double_value_size() const;
+
+  public:
+  void clear_repeated_double_value() ;
+  double repeated_double_value(int index) const;
+  void set_repeated_double_value(int index, double value);
+  void add_repeated_double_value(double value);
+  const ::google::protobuf::RepeatedField<double>& repeated_double_value() const;
+  ::google::protobuf::RepeatedField<double>* mutable_repeated_double_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_repeated_double_value() const;
+  ::google::protobuf::RepeatedField<double>* _internal_mutable_repeated_double_value();
+
+  public:
+  // repeated string repeated_string_value = 28;
+  int repeated_string_value_size() const;
+  private:
+  int _internal_repeated_string_value_size() const;
+
+  public:
+  void clear_repeated_string_value() ;
+  const std::string& repeated_string_value(int index) const;
+  std::string* mutable_repeated_string_value(int index);
+  void set_repeated_string_value(int index, const std::string& value);
+  void set_repeated_string_value(int index, std::string&& value);
+  void set_repeated_string_value(int index, const char* value);
+  void set_repeated_string_value(int index, const char* value, std::size_t size);
+  void set_repeated_string_value(int index, absl::string_view value);
+  std::string* add_repeated_string_value();
+  void add_repeated_string_value(const std::string& value);
+  void add_repeated_string_value(std::string&& value);
+  void add_repeated_string_value(const char* value);
+  void add_repeated_string_value(const char* value, std::size_t size);
+  void add_repeated_string_value(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_string_value() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_string_value();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_string_value() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_string_value();
+
+  public:
+  // repeated bytes repeated_bytes_value = 29;
+  int repeated_bytes_value_size() const;
+  private:
+  int _internal_repeated_bytes_value_size() const;
+
+  public:
+  void clear_repeated_bytes_value() ;
+  const std::string& repeated_bytes_value(int index) const;
+  std::string* mutable_repeated_bytes_value(int index);
+  void set_repeated_bytes_value(int index, const std::string& value);
+  void set_repeated_bytes_value(int index, std::string&& value);
+  void set_repeated_bytes_value(int index, const char* value);
+  void set_repeated_bytes_value(int index, const void* value, std::size_t size);
+  void set_repeated_bytes_value(int index, absl::string_view value);
+  std::string* add_repeated_bytes_value();
+  void add_repeated_bytes_value(const std::string& value);
+  void add_repeated_bytes_value(std::string&& value);
+  void add_repeated_bytes_value(const char* value);
+  void add_repeated_bytes_value(const void* value, std::size_t size);
+  void add_repeated_bytes_value(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& repeated_bytes_value() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_repeated_bytes_value();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_repeated_bytes_value() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_repeated_bytes_value();
+
+  public:
+  // repeated .proto3.EnumType repeated_enum_value = 30;
+  int repeated_enum_value_size() const;
+  private:
+  int _internal_repeated_enum_value_size() const;
+
+  public:
+  void clear_repeated_enum_value() ;
+  public:
+  ::proto3::EnumType repeated_enum_value(int index) const;
+  void set_repeated_enum_value(int index, ::proto3::EnumType value);
+  void add_repeated_enum_value(::proto3::EnumType value);
+  const ::google::protobuf::RepeatedField<int>& repeated_enum_value() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_enum_value();
+
+  private:
+  const ::google::protobuf::RepeatedField<int>& _internal_repeated_enum_value() const;
+  ::google::protobuf::RepeatedField<int>* _internal_mutable_repeated_enum_value();
+
+  public:
+  // repeated .proto3.MessageType repeated_message_value = 31;
+  int repeated_message_value_size() const;
+  private:
+  int _internal_repeated_message_value_size() const;
+
+  public:
+  void clear_repeated_message_value() ;
+  ::proto3::MessageType* mutable_repeated_message_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3::MessageType >*
+      mutable_repeated_message_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3::MessageType>& _internal_repeated_message_value() const;
+  ::google::protobuf::RepeatedPtrField<::proto3::MessageType>* _internal_mutable_repeated_message_value();
+  public:
+  const ::proto3::MessageType& repeated_message_value(int index) const;
+  ::proto3::MessageType* add_repeated_message_value();
+  const ::google::protobuf::RepeatedPtrField< ::proto3::MessageType >&
+      repeated_message_value() const;
+  // string string_value = 8;
+  void clear_string_value() ;
+  const std::string& string_value() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_string_value(Arg_&& arg, Args_... args);
+  std::string* mutable_string_value();
+  PROTOBUF_NODISCARD std::string* release_string_value();
+  void set_allocated_string_value(std::string* value);
+
+  private:
+  const std::string& _internal_string_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(
+      const std::string& value);
+  std::string* _internal_mutable_string_value();
+
+  public:
+  // bytes bytes_value = 9;
+  void clear_bytes_value() ;
+  const std::string& bytes_value() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_bytes_value(Arg_&& arg, Args_... args);
+  std::string* mutable_bytes_value();
+  PROTOBUF_NODISCARD std::string* release_bytes_value();
+  void set_allocated_bytes_value(std::string* value);
+
+  private:
+  const std::string& _internal_bytes_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bytes_value(
+      const std::string& value);
+  std::string* _internal_mutable_bytes_value();
+
+  public:
+  // .proto3.MessageType message_value = 11;
+  bool has_message_value() const;
+  void clear_message_value() ;
+  const ::proto3::MessageType& message_value() const;
+  PROTOBUF_NODISCARD ::proto3::MessageType* release_message_value();
+  ::proto3::MessageType* mutable_message_value();
+  void set_allocated_message_value(::proto3::MessageType* value);
+  void unsafe_arena_set_allocated_message_value(::proto3::MessageType* value);
+  ::proto3::MessageType* unsafe_arena_release_message_value();
+
+  private:
+  const ::proto3::MessageType& _internal_message_value() const;
+  ::proto3::MessageType* _internal_mutable_message_value();
+
+  public:
+  // bool bool_value = 1;
+  void clear_bool_value() ;
+  bool bool_value() const;
+  void set_bool_value(bool value);
+
+  private:
+  bool _internal_bool_value() const;
+  void _internal_set_bool_value(bool value);
+
+  public:
+  // int32 int32_value = 2;
+  void clear_int32_value() ;
+  ::int32_t int32_value() const;
+  void set_int32_value(::int32_t value);
+
+  private:
+  ::int32_t _internal_int32_value() const;
+  void _internal_set_int32_value(::int32_t value);
+
+  public:
+  // int64 int64_value = 3;
+  void clear_int64_value() ;
+  ::int64_t int64_value() const;
+  void set_int64_value(::int64_t value);
+
+  private:
+  ::int64_t _internal_int64_value() const;
+  void _internal_set_int64_value(::int64_t value);
+
+  public:
+  // uint64 uint64_value = 5;
+  void clear_uint64_value() ;
+  ::uint64_t uint64_value() const;
+  void set_uint64_value(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_uint64_value() const;
+  void _internal_set_uint64_value(::uint64_t value);
+
+  public:
+  // uint32 uint32_value = 4;
+  void clear_uint32_value() ;
+  ::uint32_t uint32_value() const;
+  void set_uint32_value(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_uint32_value() const;
+  void _internal_set_uint32_value(::uint32_t value);
+
+  public:
+  // float float_value = 6;
+  void clear_float_value() ;
+  float float_value() const;
+  void set_float_value(float value);
+
+  private:
+  float _internal_float_value() const;
+  void _internal_set_float_value(float value);
+
+  public:
+  // double double_value = 7;
+  void clear_double_value() ;
+  double double_value() const;
+  void set_double_value(double value);
+
+  private:
+  double _internal_double_value() const;
+  void _internal_set_double_value(double value);
+
+  public:
+  // .proto3.EnumType enum_value = 10;
+  void clear_enum_value() ;
+  ::proto3::EnumType enum_value() const;
+  void set_enum_value(::proto3::EnumType value);
+
+  private:
+  ::proto3::EnumType _internal_enum_value() const;
+  void _internal_set_enum_value(::proto3::EnumType value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestMessage)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      5, 22, 2,
+      76, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<bool> repeated_bool_value_;
+    ::google::protobuf::RepeatedField<::int32_t> repeated_int32_value_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int32_value_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int64_t> repeated_int64_value_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_int64_value_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint32_t> repeated_uint32_value_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_uint32_value_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::uint64_t> repeated_uint64_value_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_uint64_value_cached_byte_size_;
+    ::google::protobuf::RepeatedField<float> repeated_float_value_;
+    ::google::protobuf::RepeatedField<double> repeated_double_value_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_string_value_;
+    ::google::protobuf::RepeatedPtrField<std::string> repeated_bytes_value_;
+    ::google::protobuf::RepeatedField<int> repeated_enum_value_;
+    mutable ::google::protobuf::internal::CachedSize _repeated_enum_value_cached_byte_size_;
+    ::google::protobuf::RepeatedPtrField< ::proto3::MessageType > repeated_message_value_;
+    ::google::protobuf::internal::ArenaStringPtr string_value_;
+    ::google::protobuf::internal::ArenaStringPtr bytes_value_;
+    ::proto3::MessageType* message_value_;
+    bool bool_value_;
+    ::int32_t int32_value_;
+    ::int64_t int64_value_;
+    ::uint64_t uint64_value_;
+    ::uint32_t uint32_value_;
+    float float_value_;
+    double double_value_;
+    int enum_value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestMap) */ {
+ public:
+  inline TestMap() : TestMap(nullptr) {}
+  ~TestMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestMap(const TestMap& from)
+      : TestMap(nullptr, from) {}
+  TestMap(TestMap&& from) noexcept
+    : TestMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMap& operator=(const TestMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMap& operator=(TestMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestMap* internal_default_instance() {
+    return reinterpret_cast<const TestMap*>(
+               &_TestMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(TestMap& a, TestMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestMap& from) {
+    TestMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestMap";
+  }
+  protected:
+  explicit TestMap(::google::protobuf::Arena* arena);
+  TestMap(::google::protobuf::Arena* arena, const TestMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBoolMapFieldNumber = 1,
+    kInt32MapFieldNumber = 2,
+    kInt64MapFieldNumber = 3,
+    kUint32MapFieldNumber = 4,
+    kUint64MapFieldNumber = 5,
+    kStringMapFieldNumber = 6,
+  };
+  // map<bool, int32> bool_map = 1;
+  int bool_map_size() const;
+  private:
+  int _internal_bool_map_size() const;
+
+  public:
+  void clear_bool_map() ;
+  const ::google::protobuf::Map<bool, ::int32_t>& bool_map() const;
+  ::google::protobuf::Map<bool, ::int32_t>* mutable_bool_map();
+
+  private:
+  const ::google::protobuf::Map<bool, ::int32_t>& _internal_bool_map() const;
+  ::google::protobuf::Map<bool, ::int32_t>* _internal_mutable_bool_map();
+
+  public:
+  // map<int32, int32> int32_map = 2;
+  int int32_map_size() const;
+  private:
+  int _internal_int32_map_size() const;
+
+  public:
+  void clear_int32_map() ;
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& int32_map() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* mutable_int32_map();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& _internal_int32_map() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* _internal_mutable_int32_map();
+
+  public:
+  // map<int64, int32> int64_map = 3;
+  int int64_map_size() const;
+  private:
+  int _internal_int64_map_size() const;
+
+  public:
+  void clear_int64_map() ;
+  const ::google::protobuf::Map<::int64_t, ::int32_t>& int64_map() const;
+  ::google::protobuf::Map<::int64_t, ::int32_t>* mutable_int64_map();
+
+  private:
+  const ::google::protobuf::Map<::int64_t, ::int32_t>& _internal_int64_map() const;
+  ::google::protobuf::Map<::int64_t, ::int32_t>* _internal_mutable_int64_map();
+
+  public:
+  // map<uint32, int32> uint32_map = 4;
+  int uint32_map_size() const;
+  private:
+  int _internal_uint32_map_size() const;
+
+  public:
+  void clear_uint32_map() ;
+  const ::google::protobuf::Map<::uint32_t, ::int32_t>& uint32_map() const;
+  ::google::protobuf::Map<::uint32_t, ::int32_t>* mutable_uint32_map();
+
+  private:
+  const ::google::protobuf::Map<::uint32_t, ::int32_t>& _internal_uint32_map() const;
+  ::google::protobuf::Map<::uint32_t, ::int32_t>* _internal_mutable_uint32_map();
+
+  public:
+  // map<uint64, int32> uint64_map = 5;
+  int uint64_map_size() const;
+  private:
+  int _internal_uint64_map_size() const;
+
+  public:
+  void clear_uint64_map() ;
+  const ::google::protobuf::Map<::uint64_t, ::int32_t>& uint64_map() const;
+  ::google::protobuf::Map<::uint64_t, ::int32_t>* mutable_uint64_map();
+
+  private:
+  const ::google::protobuf::Map<::uint64_t, ::int32_t>& _internal_uint64_map() const;
+  ::google::protobuf::Map<::uint64_t, ::int32_t>* _internal_mutable_uint64_map();
+
+  public:
+  // map<string, int32> string_map = 6;
+  int string_map_size() const;
+  private:
+  int _internal_string_map_size() const;
+
+  public:
+  void clear_string_map() ;
+  const ::google::protobuf::Map<std::string, ::int32_t>& string_map() const;
+  ::google::protobuf::Map<std::string, ::int32_t>* mutable_string_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::int32_t>& _internal_string_map() const;
+  ::google::protobuf::Map<std::string, ::int32_t>* _internal_mutable_string_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 6, 6,
+      33, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestMap_BoolMapEntry_DoNotUse, bool, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        bool_map_;
+    ::google::protobuf::internal::MapField<TestMap_Int32MapEntry_DoNotUse, ::int32_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        int32_map_;
+    ::google::protobuf::internal::MapField<TestMap_Int64MapEntry_DoNotUse, ::int64_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        int64_map_;
+    ::google::protobuf::internal::MapField<TestMap_Uint32MapEntry_DoNotUse, ::uint32_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        uint32_map_;
+    ::google::protobuf::internal::MapField<TestMap_Uint64MapEntry_DoNotUse, ::uint64_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        uint64_map_;
+    ::google::protobuf::internal::MapField<TestMap_StringMapEntry_DoNotUse, std::string, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        string_map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestListValue final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestListValue) */ {
+ public:
+  inline TestListValue() : TestListValue(nullptr) {}
+  ~TestListValue() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestListValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestListValue(const TestListValue& from)
+      : TestListValue(nullptr, from) {}
+  TestListValue(TestListValue&& from) noexcept
+    : TestListValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TestListValue& operator=(const TestListValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestListValue& operator=(TestListValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestListValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestListValue* internal_default_instance() {
+    return reinterpret_cast<const TestListValue*>(
+               &_TestListValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(TestListValue& a, TestListValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestListValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestListValue* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestListValue* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestListValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestListValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestListValue& from) {
+    TestListValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestListValue* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestListValue";
+  }
+  protected:
+  explicit TestListValue(::google::protobuf::Arena* arena);
+  TestListValue(::google::protobuf::Arena* arena, const TestListValue& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedValueFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.ListValue repeated_value = 2;
+  int repeated_value_size() const;
+  private:
+  int _internal_repeated_value_size() const;
+
+  public:
+  void clear_repeated_value() ;
+  ::google::protobuf::ListValue* mutable_repeated_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::ListValue >*
+      mutable_repeated_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::ListValue>& _internal_repeated_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::ListValue>* _internal_mutable_repeated_value();
+  public:
+  const ::google::protobuf::ListValue& repeated_value(int index) const;
+  ::google::protobuf::ListValue* add_repeated_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::ListValue >&
+      repeated_value() const;
+  // .google.protobuf.ListValue value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::ListValue& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::ListValue* release_value();
+  ::google::protobuf::ListValue* mutable_value();
+  void set_allocated_value(::google::protobuf::ListValue* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::ListValue* value);
+  ::google::protobuf::ListValue* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::ListValue& _internal_value() const;
+  ::google::protobuf::ListValue* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestListValue)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::ListValue > repeated_value_;
+    ::google::protobuf::ListValue* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestFieldMask final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestFieldMask) */ {
+ public:
+  inline TestFieldMask() : TestFieldMask(nullptr) {}
+  ~TestFieldMask() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestFieldMask(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestFieldMask(const TestFieldMask& from)
+      : TestFieldMask(nullptr, from) {}
+  TestFieldMask(TestFieldMask&& from) noexcept
+    : TestFieldMask() {
+    *this = ::std::move(from);
+  }
+
+  inline TestFieldMask& operator=(const TestFieldMask& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestFieldMask& operator=(TestFieldMask&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestFieldMask& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestFieldMask* internal_default_instance() {
+    return reinterpret_cast<const TestFieldMask*>(
+               &_TestFieldMask_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(TestFieldMask& a, TestFieldMask& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestFieldMask* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestFieldMask* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestFieldMask* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestFieldMask>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestFieldMask& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestFieldMask& from) {
+    TestFieldMask::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestFieldMask* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestFieldMask";
+  }
+  protected:
+  explicit TestFieldMask(::google::protobuf::Arena* arena);
+  TestFieldMask(::google::protobuf::Arena* arena, const TestFieldMask& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // .google.protobuf.FieldMask value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::FieldMask& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::FieldMask* release_value();
+  ::google::protobuf::FieldMask* mutable_value();
+  void set_allocated_value(::google::protobuf::FieldMask* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::FieldMask* value);
+  ::google::protobuf::FieldMask* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::FieldMask& _internal_value() const;
+  ::google::protobuf::FieldMask* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestFieldMask)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::FieldMask* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestExtensions final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestExtensions) */ {
+ public:
+  inline TestExtensions() : TestExtensions(nullptr) {}
+  ~TestExtensions() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestExtensions(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestExtensions(const TestExtensions& from)
+      : TestExtensions(nullptr, from) {}
+  TestExtensions(TestExtensions&& from) noexcept
+    : TestExtensions() {
+    *this = ::std::move(from);
+  }
+
+  inline TestExtensions& operator=(const TestExtensions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestExtensions& operator=(TestExtensions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestExtensions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestExtensions* internal_default_instance() {
+    return reinterpret_cast<const TestExtensions*>(
+               &_TestExtensions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(TestExtensions& a, TestExtensions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestExtensions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestExtensions* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestExtensions* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestExtensions>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestExtensions& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestExtensions& from) {
+    TestExtensions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestExtensions* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestExtensions";
+  }
+  protected:
+  explicit TestExtensions(::google::protobuf::Arena* arena);
+  TestExtensions(::google::protobuf::Arena* arena, const TestExtensions& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExtensionsFieldNumber = 1,
+  };
+  // .protobuf_unittest.TestAllExtensions extensions = 1;
+  bool has_extensions() const;
+  void clear_extensions() ;
+  const ::protobuf_unittest::TestAllExtensions& extensions() const;
+  PROTOBUF_NODISCARD ::protobuf_unittest::TestAllExtensions* release_extensions();
+  ::protobuf_unittest::TestAllExtensions* mutable_extensions();
+  void set_allocated_extensions(::protobuf_unittest::TestAllExtensions* value);
+  void unsafe_arena_set_allocated_extensions(::protobuf_unittest::TestAllExtensions* value);
+  ::protobuf_unittest::TestAllExtensions* unsafe_arena_release_extensions();
+
+  private:
+  const ::protobuf_unittest::TestAllExtensions& _internal_extensions() const;
+  ::protobuf_unittest::TestAllExtensions* _internal_mutable_extensions();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestExtensions)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::protobuf_unittest::TestAllExtensions* extensions_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestDuration final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestDuration) */ {
+ public:
+  inline TestDuration() : TestDuration(nullptr) {}
+  ~TestDuration() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestDuration(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestDuration(const TestDuration& from)
+      : TestDuration(nullptr, from) {}
+  TestDuration(TestDuration&& from) noexcept
+    : TestDuration() {
+    *this = ::std::move(from);
+  }
+
+  inline TestDuration& operator=(const TestDuration& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestDuration& operator=(TestDuration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestDuration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestDuration* internal_default_instance() {
+    return reinterpret_cast<const TestDuration*>(
+               &_TestDuration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(TestDuration& a, TestDuration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestDuration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestDuration* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestDuration* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestDuration>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestDuration& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestDuration& from) {
+    TestDuration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestDuration* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestDuration";
+  }
+  protected:
+  explicit TestDuration(::google::protobuf::Arena* arena);
+  TestDuration(::google::protobuf::Arena* arena, const TestDuration& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedValueFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.Duration repeated_value = 2;
+  int repeated_value_size() const;
+  private:
+  int _internal_repeated_value_size() const;
+
+  public:
+  void clear_repeated_value() ;
+  ::google::protobuf::Duration* mutable_repeated_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Duration >*
+      mutable_repeated_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>& _internal_repeated_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>* _internal_mutable_repeated_value();
+  public:
+  const ::google::protobuf::Duration& repeated_value(int index) const;
+  ::google::protobuf::Duration* add_repeated_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Duration >&
+      repeated_value() const;
+  // .google.protobuf.Duration value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::Duration& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Duration* release_value();
+  ::google::protobuf::Duration* mutable_value();
+  void set_allocated_value(::google::protobuf::Duration* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::Duration* value);
+  ::google::protobuf::Duration* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::Duration& _internal_value() const;
+  ::google::protobuf::Duration* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestDuration)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Duration > repeated_value_;
+    ::google::protobuf::Duration* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestBoolValue final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestBoolValue) */ {
+ public:
+  inline TestBoolValue() : TestBoolValue(nullptr) {}
+  ~TestBoolValue() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestBoolValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestBoolValue(const TestBoolValue& from)
+      : TestBoolValue(nullptr, from) {}
+  TestBoolValue(TestBoolValue&& from) noexcept
+    : TestBoolValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TestBoolValue& operator=(const TestBoolValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestBoolValue& operator=(TestBoolValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestBoolValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestBoolValue* internal_default_instance() {
+    return reinterpret_cast<const TestBoolValue*>(
+               &_TestBoolValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(TestBoolValue& a, TestBoolValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestBoolValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestBoolValue* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestBoolValue* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestBoolValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestBoolValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestBoolValue& from) {
+    TestBoolValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestBoolValue* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestBoolValue";
+  }
+  protected:
+  explicit TestBoolValue(::google::protobuf::Arena* arena);
+  TestBoolValue(::google::protobuf::Arena* arena, const TestBoolValue& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBoolMapFieldNumber = 2,
+    kBoolValueFieldNumber = 1,
+  };
+  // map<bool, int32> bool_map = 2;
+  int bool_map_size() const;
+  private:
+  int _internal_bool_map_size() const;
+
+  public:
+  void clear_bool_map() ;
+  const ::google::protobuf::Map<bool, ::int32_t>& bool_map() const;
+  ::google::protobuf::Map<bool, ::int32_t>* mutable_bool_map();
+
+  private:
+  const ::google::protobuf::Map<bool, ::int32_t>& _internal_bool_map() const;
+  ::google::protobuf::Map<bool, ::int32_t>* _internal_mutable_bool_map();
+
+  public:
+  // bool bool_value = 1;
+  void clear_bool_value() ;
+  bool bool_value() const;
+  void set_bool_value(bool value);
+
+  private:
+  bool _internal_bool_value() const;
+  void _internal_set_bool_value(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestBoolValue)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 2, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<TestBoolValue_BoolMapEntry_DoNotUse, bool, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        bool_map_;
+    bool bool_value_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class TestAny final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.TestAny) */ {
+ public:
+  inline TestAny() : TestAny(nullptr) {}
+  ~TestAny() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR TestAny(::google::protobuf::internal::ConstantInitialized);
+
+  inline TestAny(const TestAny& from)
+      : TestAny(nullptr, from) {}
+  TestAny(TestAny&& from) noexcept
+    : TestAny() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAny& operator=(const TestAny& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAny& operator=(TestAny&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestAny& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestAny* internal_default_instance() {
+    return reinterpret_cast<const TestAny*>(
+               &_TestAny_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(TestAny& a, TestAny& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAny* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAny* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TestAny* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestAny>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const TestAny& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const TestAny& from) {
+    TestAny::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(TestAny* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.TestAny";
+  }
+  protected:
+  explicit TestAny(::google::protobuf::Arena* arena);
+  TestAny(::google::protobuf::Arena* arena, const TestAny& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedValueFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // repeated .google.protobuf.Any repeated_value = 2;
+  int repeated_value_size() const;
+  private:
+  int _internal_repeated_value_size() const;
+
+  public:
+  void clear_repeated_value() ;
+  ::google::protobuf::Any* mutable_repeated_value(int index);
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any >*
+      mutable_repeated_value();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>& _internal_repeated_value() const;
+  ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>* _internal_mutable_repeated_value();
+  public:
+  const ::google::protobuf::Any& repeated_value(int index) const;
+  ::google::protobuf::Any* add_repeated_value();
+  const ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any >&
+      repeated_value() const;
+  // .google.protobuf.Any value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::google::protobuf::Any& value() const;
+  PROTOBUF_NODISCARD ::google::protobuf::Any* release_value();
+  ::google::protobuf::Any* mutable_value();
+  void set_allocated_value(::google::protobuf::Any* value);
+  void unsafe_arena_set_allocated_value(::google::protobuf::Any* value);
+  ::google::protobuf::Any* unsafe_arena_release_value();
+
+  private:
+  const ::google::protobuf::Any& _internal_value() const;
+  ::google::protobuf::Any* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.TestAny)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 2,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::google::protobuf::Any > repeated_value_;
+    ::google::protobuf::Any* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class StringtoInt final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.StringtoInt) */ {
+ public:
+  inline StringtoInt() : StringtoInt(nullptr) {}
+  ~StringtoInt() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR StringtoInt(::google::protobuf::internal::ConstantInitialized);
+
+  inline StringtoInt(const StringtoInt& from)
+      : StringtoInt(nullptr, from) {}
+  StringtoInt(StringtoInt&& from) noexcept
+    : StringtoInt() {
+    *this = ::std::move(from);
+  }
+
+  inline StringtoInt& operator=(const StringtoInt& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StringtoInt& operator=(StringtoInt&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StringtoInt& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StringtoInt* internal_default_instance() {
+    return reinterpret_cast<const StringtoInt*>(
+               &_StringtoInt_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(StringtoInt& a, StringtoInt& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StringtoInt* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StringtoInt* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StringtoInt* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StringtoInt>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StringtoInt& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const StringtoInt& from) {
+    StringtoInt::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(StringtoInt* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.StringtoInt";
+  }
+  protected:
+  explicit StringtoInt(::google::protobuf::Arena* arena);
+  StringtoInt(::google::protobuf::Arena* arena, const StringtoInt& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 1,
+  };
+  // map<string, int32> map = 1;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<std::string, ::int32_t>& map() const;
+  ::google::protobuf::Map<std::string, ::int32_t>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::int32_t>& _internal_map() const;
+  ::google::protobuf::Map<std::string, ::int32_t>* _internal_mutable_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.StringtoInt)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      30, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<StringtoInt_MapEntry_DoNotUse, std::string, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class Mixed2 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.Mixed2) */ {
+ public:
+  inline Mixed2() : Mixed2(nullptr) {}
+  ~Mixed2() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR Mixed2(::google::protobuf::internal::ConstantInitialized);
+
+  inline Mixed2(const Mixed2& from)
+      : Mixed2(nullptr, from) {}
+  Mixed2(Mixed2&& from) noexcept
+    : Mixed2() {
+    *this = ::std::move(from);
+  }
+
+  inline Mixed2& operator=(const Mixed2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Mixed2& operator=(Mixed2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mixed2& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Mixed2* internal_default_instance() {
+    return reinterpret_cast<const Mixed2*>(
+               &_Mixed2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(Mixed2& a, Mixed2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Mixed2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mixed2* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Mixed2* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Mixed2>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const Mixed2& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const Mixed2& from) {
+    Mixed2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(Mixed2* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.Mixed2";
+  }
+  protected:
+  explicit Mixed2(::google::protobuf::Arena* arena);
+  Mixed2(::google::protobuf::Arena* arena, const Mixed2& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  using E = Mixed2_E;
+  static constexpr E E0 = Mixed2_E_E0;
+  static constexpr E E1 = Mixed2_E_E1;
+  static constexpr E E2 = Mixed2_E_E2;
+  static constexpr E E3 = Mixed2_E_E3;
+  static inline bool E_IsValid(int value) {
+    return Mixed2_E_IsValid(value);
+  }
+  static constexpr E E_MIN = Mixed2_E_E_MIN;
+  static constexpr E E_MAX = Mixed2_E_E_MAX;
+  static constexpr int E_ARRAYSIZE = Mixed2_E_E_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* E_descriptor() {
+    return Mixed2_E_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& E_Name(T value) {
+    return Mixed2_E_Name(value);
+  }
+  static inline bool E_Parse(absl::string_view name, E* value) {
+    return Mixed2_E_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 1,
+    kEeFieldNumber = 2,
+  };
+  // map<int32, bool> map = 1;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<::int32_t, bool>& map() const;
+  ::google::protobuf::Map<::int32_t, bool>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, bool>& _internal_map() const;
+  ::google::protobuf::Map<::int32_t, bool>* _internal_mutable_map();
+
+  public:
+  // .proto3.Mixed2.E ee = 2;
+  void clear_ee() ;
+  ::proto3::Mixed2_E ee() const;
+  void set_ee(::proto3::Mixed2_E value);
+
+  private:
+  ::proto3::Mixed2_E _internal_ee() const;
+  void _internal_set_ee(::proto3::Mixed2_E value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.Mixed2)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 2, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<Mixed2_MapEntry_DoNotUse, ::int32_t, bool,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>
+        map_;
+    int ee_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class Mixed1 final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.Mixed1) */ {
+ public:
+  inline Mixed1() : Mixed1(nullptr) {}
+  ~Mixed1() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR Mixed1(::google::protobuf::internal::ConstantInitialized);
+
+  inline Mixed1(const Mixed1& from)
+      : Mixed1(nullptr, from) {}
+  Mixed1(Mixed1&& from) noexcept
+    : Mixed1() {
+    *this = ::std::move(from);
+  }
+
+  inline Mixed1& operator=(const Mixed1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Mixed1& operator=(Mixed1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mixed1& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Mixed1* internal_default_instance() {
+    return reinterpret_cast<const Mixed1*>(
+               &_Mixed1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(Mixed1& a, Mixed1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Mixed1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mixed1* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Mixed1* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Mixed1>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const Mixed1& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const Mixed1& from) {
+    Mixed1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(Mixed1* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.Mixed1";
+  }
+  protected:
+  explicit Mixed1(::google::protobuf::Arena* arena);
+  Mixed1(::google::protobuf::Arena* arena, const Mixed1& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 2,
+    kMsgFieldNumber = 1,
+  };
+  // map<string, float> map = 2;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<std::string, float>& map() const;
+  ::google::protobuf::Map<std::string, float>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, float>& _internal_map() const;
+  ::google::protobuf::Map<std::string, float>* _internal_mutable_map();
+
+  public:
+  // string msg = 1;
+  void clear_msg() ;
+  const std::string& msg() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_msg(Arg_&& arg, Args_... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* value);
+
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(
+      const std::string& value);
+  std::string* _internal_mutable_msg();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.Mixed1)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 2, 1,
+      28, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<Mixed1_MapEntry_DoNotUse, std::string, float,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>
+        map_;
+    ::google::protobuf::internal::ArenaStringPtr msg_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map1Entry final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOutWireFormat.Map1Entry) */ {
+ public:
+  inline MapOutWireFormat_Map1Entry() : MapOutWireFormat_Map1Entry(nullptr) {}
+  ~MapOutWireFormat_Map1Entry() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOutWireFormat_Map1Entry(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOutWireFormat_Map1Entry(const MapOutWireFormat_Map1Entry& from)
+      : MapOutWireFormat_Map1Entry(nullptr, from) {}
+  MapOutWireFormat_Map1Entry(MapOutWireFormat_Map1Entry&& from) noexcept
+    : MapOutWireFormat_Map1Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map1Entry& operator=(const MapOutWireFormat_Map1Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map1Entry& operator=(MapOutWireFormat_Map1Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOutWireFormat_Map1Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOutWireFormat_Map1Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map1Entry*>(
+               &_MapOutWireFormat_Map1Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    59;
+
+  friend void swap(MapOutWireFormat_Map1Entry& a, MapOutWireFormat_Map1Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOutWireFormat_Map1Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOutWireFormat_Map1Entry* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOutWireFormat_Map1Entry* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map1Entry>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOutWireFormat_Map1Entry& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOutWireFormat_Map1Entry& from) {
+    MapOutWireFormat_Map1Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOutWireFormat_Map1Entry* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOutWireFormat.Map1Entry";
+  }
+  protected:
+  explicit MapOutWireFormat_Map1Entry(::google::protobuf::Arena* arena);
+  MapOutWireFormat_Map1Entry(::google::protobuf::Arena* arena, const MapOutWireFormat_Map1Entry& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key() ;
+  const std::string& key() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_key(Arg_&& arg, Args_... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* value);
+
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(
+      const std::string& value);
+  std::string* _internal_mutable_key();
+
+  public:
+  // .proto3.MapM value = 2;
+  bool has_value() const;
+  void clear_value() ;
+  const ::proto3::MapM& value() const;
+  PROTOBUF_NODISCARD ::proto3::MapM* release_value();
+  ::proto3::MapM* mutable_value();
+  void set_allocated_value(::proto3::MapM* value);
+  void unsafe_arena_set_allocated_value(::proto3::MapM* value);
+  ::proto3::MapM* unsafe_arena_release_value();
+
+  private:
+  const ::proto3::MapM& _internal_value() const;
+  ::proto3::MapM* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOutWireFormat.Map1Entry)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 1,
+      45, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr key_;
+    ::proto3::MapM* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOut_Map1Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapOut_Map1Entry_DoNotUse, std::string, ::proto3::MapM,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapOut_Map1Entry_DoNotUse, std::string, ::proto3::MapM,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapOut_Map1Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOut_Map1Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapOut_Map1Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapOut_Map1Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapOut_Map1Entry_DoNotUse*>(
+        &_MapOut_Map1Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapOut.Map1Entry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOfObjects_MapEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapOfObjects_MapEntry_DoNotUse, std::string, ::proto3::MapOfObjects_M,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapOfObjects_MapEntry_DoNotUse, std::string, ::proto3::MapOfObjects_M,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapOfObjects_MapEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOfObjects_MapEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapOfObjects_MapEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapOfObjects_MapEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapOfObjects_MapEntry_DoNotUse*>(
+        &_MapOfObjects_MapEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapOfObjects.MapEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapIn_MapAnyEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapIn_MapAnyEntry_DoNotUse, std::string, ::google::protobuf::Any,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapIn_MapAnyEntry_DoNotUse, std::string, ::google::protobuf::Any,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapIn_MapAnyEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapIn_MapAnyEntry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapIn_MapAnyEntry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapIn_MapAnyEntry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapIn_MapAnyEntry_DoNotUse*>(
+        &_MapIn_MapAnyEntry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapIn.MapAnyEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IntToString final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.IntToString) */ {
+ public:
+  inline IntToString() : IntToString(nullptr) {}
+  ~IntToString() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR IntToString(::google::protobuf::internal::ConstantInitialized);
+
+  inline IntToString(const IntToString& from)
+      : IntToString(nullptr, from) {}
+  IntToString(IntToString&& from) noexcept
+    : IntToString() {
+    *this = ::std::move(from);
+  }
+
+  inline IntToString& operator=(const IntToString& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IntToString& operator=(IntToString&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IntToString& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IntToString* internal_default_instance() {
+    return reinterpret_cast<const IntToString*>(
+               &_IntToString_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(IntToString& a, IntToString& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IntToString* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IntToString* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IntToString* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IntToString>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const IntToString& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const IntToString& from) {
+    IntToString::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(IntToString* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.IntToString";
+  }
+  protected:
+  explicit IntToString(::google::protobuf::Arena* arena);
+  IntToString(::google::protobuf::Arena* arena, const IntToString& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 1,
+  };
+  // map<int32, string> map = 1;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<::int32_t, std::string>& map() const;
+  ::google::protobuf::Map<::int32_t, std::string>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, std::string>& _internal_map() const;
+  ::google::protobuf::Map<::int32_t, std::string>* _internal_mutable_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.IntToString)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      30, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<IntToString_MapEntry_DoNotUse, ::int32_t, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class EmptyMap final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.EmptyMap) */ {
+ public:
+  inline EmptyMap() : EmptyMap(nullptr) {}
+  ~EmptyMap() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR EmptyMap(::google::protobuf::internal::ConstantInitialized);
+
+  inline EmptyMap(const EmptyMap& from)
+      : EmptyMap(nullptr, from) {}
+  EmptyMap(EmptyMap&& from) noexcept
+    : EmptyMap() {
+    *this = ::std::move(from);
+  }
+
+  inline EmptyMap& operator=(const EmptyMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EmptyMap& operator=(EmptyMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EmptyMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EmptyMap* internal_default_instance() {
+    return reinterpret_cast<const EmptyMap*>(
+               &_EmptyMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(EmptyMap& a, EmptyMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EmptyMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EmptyMap* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EmptyMap* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EmptyMap>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const EmptyMap& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const EmptyMap& from) {
+    EmptyMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(EmptyMap* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.EmptyMap";
+  }
+  protected:
+  explicit EmptyMap(::google::protobuf::Arena* arena);
+  EmptyMap(::google::protobuf::Arena* arena, const EmptyMap& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 1,
+  };
+  // map<int32, int32> map = 1;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& map() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, ::int32_t>& _internal_map() const;
+  ::google::protobuf::Map<::int32_t, ::int32_t>* _internal_mutable_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.EmptyMap)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<EmptyMap_MapEntry_DoNotUse, ::int32_t, ::int32_t,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32>
+        map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class BoolToString final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.BoolToString) */ {
+ public:
+  inline BoolToString() : BoolToString(nullptr) {}
+  ~BoolToString() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR BoolToString(::google::protobuf::internal::ConstantInitialized);
+
+  inline BoolToString(const BoolToString& from)
+      : BoolToString(nullptr, from) {}
+  BoolToString(BoolToString&& from) noexcept
+    : BoolToString() {
+    *this = ::std::move(from);
+  }
+
+  inline BoolToString& operator=(const BoolToString& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoolToString& operator=(BoolToString&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BoolToString& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BoolToString* internal_default_instance() {
+    return reinterpret_cast<const BoolToString*>(
+               &_BoolToString_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    43;
+
+  friend void swap(BoolToString& a, BoolToString& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BoolToString* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BoolToString* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BoolToString* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BoolToString>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const BoolToString& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const BoolToString& from) {
+    BoolToString::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(BoolToString* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.BoolToString";
+  }
+  protected:
+  explicit BoolToString(::google::protobuf::Arena* arena);
+  BoolToString(::google::protobuf::Arena* arena, const BoolToString& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 1,
+  };
+  // map<bool, string> map = 1;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<bool, std::string>& map() const;
+  ::google::protobuf::Map<bool, std::string>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<bool, std::string>& _internal_map() const;
+  ::google::protobuf::Map<bool, std::string>* _internal_mutable_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.BoolToString)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      31, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<BoolToString_MapEntry_DoNotUse, bool, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOut final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOut) */ {
+ public:
+  inline MapOut() : MapOut(nullptr) {}
+  ~MapOut() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOut(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOut(const MapOut& from)
+      : MapOut(nullptr, from) {}
+  MapOut(MapOut&& from) noexcept
+    : MapOut() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOut& operator=(const MapOut& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOut& operator=(MapOut&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOut& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOut* internal_default_instance() {
+    return reinterpret_cast<const MapOut*>(
+               &_MapOut_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    58;
+
+  friend void swap(MapOut& a, MapOut& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOut* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOut* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOut* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOut>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOut& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOut& from) {
+    MapOut::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOut* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOut";
+  }
+  protected:
+  explicit MapOut(::google::protobuf::Arena* arena);
+  MapOut(::google::protobuf::Arena* arena, const MapOut& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMap1FieldNumber = 1,
+    kMap2FieldNumber = 2,
+    kMap3FieldNumber = 3,
+    kMap4FieldNumber = 5,
+    kBarFieldNumber = 4,
+  };
+  // map<string, .proto3.MapM> map1 = 1;
+  int map1_size() const;
+  private:
+  int _internal_map1_size() const;
+
+  public:
+  void clear_map1() ;
+  const ::google::protobuf::Map<std::string, ::proto3::MapM>& map1() const;
+  ::google::protobuf::Map<std::string, ::proto3::MapM>* mutable_map1();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::proto3::MapM>& _internal_map1() const;
+  ::google::protobuf::Map<std::string, ::proto3::MapM>* _internal_mutable_map1();
+
+  public:
+  // map<string, .proto3.MapOut> map2 = 2;
+  int map2_size() const;
+  private:
+  int _internal_map2_size() const;
+
+  public:
+  void clear_map2() ;
+  const ::google::protobuf::Map<std::string, ::proto3::MapOut>& map2() const;
+  ::google::protobuf::Map<std::string, ::proto3::MapOut>* mutable_map2();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::proto3::MapOut>& _internal_map2() const;
+  ::google::protobuf::Map<std::string, ::proto3::MapOut>* _internal_mutable_map2();
+
+  public:
+  // map<int32, string> map3 = 3;
+  int map3_size() const;
+  private:
+  int _internal_map3_size() const;
+
+  public:
+  void clear_map3() ;
+  const ::google::protobuf::Map<::int32_t, std::string>& map3() const;
+  ::google::protobuf::Map<::int32_t, std::string>* mutable_map3();
+
+  private:
+  const ::google::protobuf::Map<::int32_t, std::string>& _internal_map3() const;
+  ::google::protobuf::Map<::int32_t, std::string>* _internal_mutable_map3();
+
+  public:
+  // map<bool, string> map4 = 5;
+  int map4_size() const;
+  private:
+  int _internal_map4_size() const;
+
+  public:
+  void clear_map4() ;
+  const ::google::protobuf::Map<bool, std::string>& map4() const;
+  ::google::protobuf::Map<bool, std::string>* mutable_map4();
+
+  private:
+  const ::google::protobuf::Map<bool, std::string>& _internal_map4() const;
+  ::google::protobuf::Map<bool, std::string>* _internal_mutable_map4();
+
+  public:
+  // string bar = 4;
+  void clear_bar() ;
+  const std::string& bar() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_bar(Arg_&& arg, Args_... args);
+  std::string* mutable_bar();
+  PROTOBUF_NODISCARD std::string* release_bar();
+  void set_allocated_bar(std::string* value);
+
+  private:
+  const std::string& _internal_bar() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bar(
+      const std::string& value);
+  std::string* _internal_mutable_bar();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOut)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 5, 6,
+      41, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<MapOut_Map1Entry_DoNotUse, std::string, ::proto3::MapM,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        map1_;
+    ::google::protobuf::internal::MapField<MapOut_Map2Entry_DoNotUse, std::string, ::proto3::MapOut,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        map2_;
+    ::google::protobuf::internal::MapField<MapOut_Map3Entry_DoNotUse, ::int32_t, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map3_;
+    ::google::protobuf::internal::MapField<MapOut_Map4Entry_DoNotUse, bool, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map4_;
+    ::google::protobuf::internal::ArenaStringPtr bar_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOut_Map2Entry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<
+          MapOut_Map2Entry_DoNotUse, std::string, ::proto3::MapOut,
+          ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+          ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType = ::google::protobuf::internal::MapEntry<
+      MapOut_Map2Entry_DoNotUse, std::string, ::proto3::MapOut,
+      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  MapOut_Map2Entry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOut_Map2Entry_DoNotUse(
+      ::google::protobuf::internal::ConstantInitialized);
+  explicit MapOut_Map2Entry_DoNotUse(::google::protobuf::Arena* arena);
+  static const MapOut_Map2Entry_DoNotUse* internal_default_instance() {
+    return reinterpret_cast<const MapOut_Map2Entry_DoNotUse*>(
+        &_MapOut_Map2Entry_DoNotUse_default_instance_);
+  }
+  static bool ValidateKey(std::string* s) {
+    return ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::google::protobuf::internal::WireFormatLite::PARSE, "proto3.MapOut.Map2Entry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  ::google::protobuf::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOfObjects final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOfObjects) */ {
+ public:
+  inline MapOfObjects() : MapOfObjects(nullptr) {}
+  ~MapOfObjects() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOfObjects(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOfObjects(const MapOfObjects& from)
+      : MapOfObjects(nullptr, from) {}
+  MapOfObjects(MapOfObjects&& from) noexcept
+    : MapOfObjects() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOfObjects& operator=(const MapOfObjects& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOfObjects& operator=(MapOfObjects&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOfObjects& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOfObjects* internal_default_instance() {
+    return reinterpret_cast<const MapOfObjects*>(
+               &_MapOfObjects_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    50;
+
+  friend void swap(MapOfObjects& a, MapOfObjects& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOfObjects* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOfObjects* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOfObjects* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOfObjects>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOfObjects& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOfObjects& from) {
+    MapOfObjects::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOfObjects* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOfObjects";
+  }
+  protected:
+  explicit MapOfObjects(::google::protobuf::Arena* arena);
+  MapOfObjects(::google::protobuf::Arena* arena, const MapOfObjects& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using M = MapOfObjects_M;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldNumber = 1,
+  };
+  // map<string, .proto3.MapOfObjects.M> map = 1;
+  int map_size() const;
+  private:
+  int _internal_map_size() const;
+
+  public:
+  void clear_map() ;
+  const ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>& map() const;
+  ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>* mutable_map();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>& _internal_map() const;
+  ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>* _internal_mutable_map();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOfObjects)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 2,
+      31, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::MapField<MapOfObjects_MapEntry_DoNotUse, std::string, ::proto3::MapOfObjects_M,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        map_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapIn final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapIn) */ {
+ public:
+  inline MapIn() : MapIn(nullptr) {}
+  ~MapIn() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapIn(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapIn(const MapIn& from)
+      : MapIn(nullptr, from) {}
+  MapIn(MapIn&& from) noexcept
+    : MapIn() {
+    *this = ::std::move(from);
+  }
+
+  inline MapIn& operator=(const MapIn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapIn& operator=(MapIn&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapIn& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapIn* internal_default_instance() {
+    return reinterpret_cast<const MapIn*>(
+               &_MapIn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    53;
+
+  friend void swap(MapIn& a, MapIn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapIn* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapIn* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapIn* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapIn>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapIn& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapIn& from) {
+    MapIn::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapIn* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapIn";
+  }
+  protected:
+  explicit MapIn(::google::protobuf::Arena* arena);
+  MapIn(::google::protobuf::Arena* arena, const MapIn& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kThingsFieldNumber = 2,
+    kMapInputFieldNumber = 3,
+    kMapAnyFieldNumber = 4,
+    kOtherFieldNumber = 1,
+  };
+  // repeated string things = 2;
+  int things_size() const;
+  private:
+  int _internal_things_size() const;
+
+  public:
+  void clear_things() ;
+  const std::string& things(int index) const;
+  std::string* mutable_things(int index);
+  void set_things(int index, const std::string& value);
+  void set_things(int index, std::string&& value);
+  void set_things(int index, const char* value);
+  void set_things(int index, const char* value, std::size_t size);
+  void set_things(int index, absl::string_view value);
+  std::string* add_things();
+  void add_things(const std::string& value);
+  void add_things(std::string&& value);
+  void add_things(const char* value);
+  void add_things(const char* value, std::size_t size);
+  void add_things(absl::string_view value);
+  const ::google::protobuf::RepeatedPtrField<std::string>& things() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* mutable_things();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_things() const;
+  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_things();
+
+  public:
+  // map<string, string> map_input = 3;
+  int map_input_size() const;
+  private:
+  int _internal_map_input_size() const;
+
+  public:
+  void clear_map_input() ;
+  const ::google::protobuf::Map<std::string, std::string>& map_input() const;
+  ::google::protobuf::Map<std::string, std::string>* mutable_map_input();
+
+  private:
+  const ::google::protobuf::Map<std::string, std::string>& _internal_map_input() const;
+  ::google::protobuf::Map<std::string, std::string>* _internal_mutable_map_input();
+
+  public:
+  // map<string, .google.protobuf.Any> map_any = 4;
+  int map_any_size() const;
+  private:
+  int _internal_map_any_size() const;
+
+  public:
+  void clear_map_any() ;
+  const ::google::protobuf::Map<std::string, ::google::protobuf::Any>& map_any() const;
+  ::google::protobuf::Map<std::string, ::google::protobuf::Any>* mutable_map_any();
+
+  private:
+  const ::google::protobuf::Map<std::string, ::google::protobuf::Any>& _internal_map_any() const;
+  ::google::protobuf::Map<std::string, ::google::protobuf::Any>* _internal_mutable_map_any();
+
+  public:
+  // string other = 1;
+  void clear_other() ;
+  const std::string& other() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_other(Arg_&& arg, Args_... args);
+  std::string* mutable_other();
+  PROTOBUF_NODISCARD std::string* release_other();
+  void set_allocated_other(std::string* value);
+
+  private:
+  const std::string& _internal_other() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_other(
+      const std::string& value);
+  std::string* _internal_mutable_other();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapIn)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 4, 3,
+      48, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedPtrField<std::string> things_;
+    ::google::protobuf::internal::MapField<MapIn_MapInputEntry_DoNotUse, std::string, std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        map_input_;
+    ::google::protobuf::internal::MapField<MapIn_MapAnyEntry_DoNotUse, std::string, ::google::protobuf::Any,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        map_any_;
+    ::google::protobuf::internal::ArenaStringPtr other_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapsTestCases final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapsTestCases) */ {
+ public:
+  inline MapsTestCases() : MapsTestCases(nullptr) {}
+  ~MapsTestCases() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapsTestCases(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapsTestCases(const MapsTestCases& from)
+      : MapsTestCases(nullptr, from) {}
+  MapsTestCases(MapsTestCases&& from) noexcept
+    : MapsTestCases() {
+    *this = ::std::move(from);
+  }
+
+  inline MapsTestCases& operator=(const MapsTestCases& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapsTestCases& operator=(MapsTestCases&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapsTestCases& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapsTestCases* internal_default_instance() {
+    return reinterpret_cast<const MapsTestCases*>(
+               &_MapsTestCases_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(MapsTestCases& a, MapsTestCases& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapsTestCases* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapsTestCases* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapsTestCases* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapsTestCases>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapsTestCases& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapsTestCases& from) {
+    MapsTestCases::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapsTestCases* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapsTestCases";
+  }
+  protected:
+  explicit MapsTestCases(::google::protobuf::Arena* arena);
+  MapsTestCases(::google::protobuf::Arena* arena, const MapsTestCases& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEmptyMapFieldNumber = 1,
+    kStringToIntFieldNumber = 2,
+    kIntToStringFieldNumber = 3,
+    kMixed1FieldNumber = 4,
+    kMixed2FieldNumber = 5,
+    kMapOfObjectsFieldNumber = 6,
+    kEmptyKeyStringToInt1FieldNumber = 7,
+    kEmptyKeyStringToInt2FieldNumber = 8,
+    kEmptyKeyStringToInt3FieldNumber = 9,
+    kEmptyKeyBoolToStringFieldNumber = 10,
+    kEmptyKeyIntToStringFieldNumber = 11,
+    kEmptyKeyMixedFieldNumber = 12,
+    kEmptyKeyMapObjectsFieldNumber = 13,
+  };
+  // .proto3.EmptyMap empty_map = 1;
+  bool has_empty_map() const;
+  void clear_empty_map() ;
+  const ::proto3::EmptyMap& empty_map() const;
+  PROTOBUF_NODISCARD ::proto3::EmptyMap* release_empty_map();
+  ::proto3::EmptyMap* mutable_empty_map();
+  void set_allocated_empty_map(::proto3::EmptyMap* value);
+  void unsafe_arena_set_allocated_empty_map(::proto3::EmptyMap* value);
+  ::proto3::EmptyMap* unsafe_arena_release_empty_map();
+
+  private:
+  const ::proto3::EmptyMap& _internal_empty_map() const;
+  ::proto3::EmptyMap* _internal_mutable_empty_map();
+
+  public:
+  // .proto3.StringtoInt string_to_int = 2;
+  bool has_string_to_int() const;
+  void clear_string_to_int() ;
+  const ::proto3::StringtoInt& string_to_int() const;
+  PROTOBUF_NODISCARD ::proto3::StringtoInt* release_string_to_int();
+  ::proto3::StringtoInt* mutable_string_to_int();
+  void set_allocated_string_to_int(::proto3::StringtoInt* value);
+  void unsafe_arena_set_allocated_string_to_int(::proto3::StringtoInt* value);
+  ::proto3::StringtoInt* unsafe_arena_release_string_to_int();
+
+  private:
+  const ::proto3::StringtoInt& _internal_string_to_int() const;
+  ::proto3::StringtoInt* _internal_mutable_string_to_int();
+
+  public:
+  // .proto3.IntToString int_to_string = 3;
+  bool has_int_to_string() const;
+  void clear_int_to_string() ;
+  const ::proto3::IntToString& int_to_string() const;
+  PROTOBUF_NODISCARD ::proto3::IntToString* release_int_to_string();
+  ::proto3::IntToString* mutable_int_to_string();
+  void set_allocated_int_to_string(::proto3::IntToString* value);
+  void unsafe_arena_set_allocated_int_to_string(::proto3::IntToString* value);
+  ::proto3::IntToString* unsafe_arena_release_int_to_string();
+
+  private:
+  const ::proto3::IntToString& _internal_int_to_string() const;
+  ::proto3::IntToString* _internal_mutable_int_to_string();
+
+  public:
+  // .proto3.Mixed1 mixed1 = 4;
+  bool has_mixed1() const;
+  void clear_mixed1() ;
+  const ::proto3::Mixed1& mixed1() const;
+  PROTOBUF_NODISCARD ::proto3::Mixed1* release_mixed1();
+  ::proto3::Mixed1* mutable_mixed1();
+  void set_allocated_mixed1(::proto3::Mixed1* value);
+  void unsafe_arena_set_allocated_mixed1(::proto3::Mixed1* value);
+  ::proto3::Mixed1* unsafe_arena_release_mixed1();
+
+  private:
+  const ::proto3::Mixed1& _internal_mixed1() const;
+  ::proto3::Mixed1* _internal_mutable_mixed1();
+
+  public:
+  // .proto3.Mixed2 mixed2 = 5;
+  bool has_mixed2() const;
+  void clear_mixed2() ;
+  const ::proto3::Mixed2& mixed2() const;
+  PROTOBUF_NODISCARD ::proto3::Mixed2* release_mixed2();
+  ::proto3::Mixed2* mutable_mixed2();
+  void set_allocated_mixed2(::proto3::Mixed2* value);
+  void unsafe_arena_set_allocated_mixed2(::proto3::Mixed2* value);
+  ::proto3::Mixed2* unsafe_arena_release_mixed2();
+
+  private:
+  const ::proto3::Mixed2& _internal_mixed2() const;
+  ::proto3::Mixed2* _internal_mutable_mixed2();
+
+  public:
+  // .proto3.MapOfObjects map_of_objects = 6;
+  bool has_map_of_objects() const;
+  void clear_map_of_objects() ;
+  const ::proto3::MapOfObjects& map_of_objects() const;
+  PROTOBUF_NODISCARD ::proto3::MapOfObjects* release_map_of_objects();
+  ::proto3::MapOfObjects* mutable_map_of_objects();
+  void set_allocated_map_of_objects(::proto3::MapOfObjects* value);
+  void unsafe_arena_set_allocated_map_of_objects(::proto3::MapOfObjects* value);
+  ::proto3::MapOfObjects* unsafe_arena_release_map_of_objects();
+
+  private:
+  const ::proto3::MapOfObjects& _internal_map_of_objects() const;
+  ::proto3::MapOfObjects* _internal_mutable_map_of_objects();
+
+  public:
+  // .proto3.StringtoInt empty_key_string_to_int1 = 7;
+  bool has_empty_key_string_to_int1() const;
+  void clear_empty_key_string_to_int1() ;
+  const ::proto3::StringtoInt& empty_key_string_to_int1() const;
+  PROTOBUF_NODISCARD ::proto3::StringtoInt* release_empty_key_string_to_int1();
+  ::proto3::StringtoInt* mutable_empty_key_string_to_int1();
+  void set_allocated_empty_key_string_to_int1(::proto3::StringtoInt* value);
+  void unsafe_arena_set_allocated_empty_key_string_to_int1(::proto3::StringtoInt* value);
+  ::proto3::StringtoInt* unsafe_arena_release_empty_key_string_to_int1();
+
+  private:
+  const ::proto3::StringtoInt& _internal_empty_key_string_to_int1() const;
+  ::proto3::StringtoInt* _internal_mutable_empty_key_string_to_int1();
+
+  public:
+  // .proto3.StringtoInt empty_key_string_to_int2 = 8;
+  bool has_empty_key_string_to_int2() const;
+  void clear_empty_key_string_to_int2() ;
+  const ::proto3::StringtoInt& empty_key_string_to_int2() const;
+  PROTOBUF_NODISCARD ::proto3::StringtoInt* release_empty_key_string_to_int2();
+  ::proto3::StringtoInt* mutable_empty_key_string_to_int2();
+  void set_allocated_empty_key_string_to_int2(::proto3::StringtoInt* value);
+  void unsafe_arena_set_allocated_empty_key_string_to_int2(::proto3::StringtoInt* value);
+  ::proto3::StringtoInt* unsafe_arena_release_empty_key_string_to_int2();
+
+  private:
+  const ::proto3::StringtoInt& _internal_empty_key_string_to_int2() const;
+  ::proto3::StringtoInt* _internal_mutable_empty_key_string_to_int2();
+
+  public:
+  // .proto3.StringtoInt empty_key_string_to_int3 = 9;
+  bool has_empty_key_string_to_int3() const;
+  void clear_empty_key_string_to_int3() ;
+  const ::proto3::StringtoInt& empty_key_string_to_int3() const;
+  PROTOBUF_NODISCARD ::proto3::StringtoInt* release_empty_key_string_to_int3();
+  ::proto3::StringtoInt* mutable_empty_key_string_to_int3();
+  void set_allocated_empty_key_string_to_int3(::proto3::StringtoInt* value);
+  void unsafe_arena_set_allocated_empty_key_string_to_int3(::proto3::StringtoInt* value);
+  ::proto3::StringtoInt* unsafe_arena_release_empty_key_string_to_int3();
+
+  private:
+  const ::proto3::StringtoInt& _internal_empty_key_string_to_int3() const;
+  ::proto3::StringtoInt* _internal_mutable_empty_key_string_to_int3();
+
+  public:
+  // .proto3.BoolToString empty_key_bool_to_string = 10;
+  bool has_empty_key_bool_to_string() const;
+  void clear_empty_key_bool_to_string() ;
+  const ::proto3::BoolToString& empty_key_bool_to_string() const;
+  PROTOBUF_NODISCARD ::proto3::BoolToString* release_empty_key_bool_to_string();
+  ::proto3::BoolToString* mutable_empty_key_bool_to_string();
+  void set_allocated_empty_key_bool_to_string(::proto3::BoolToString* value);
+  void unsafe_arena_set_allocated_empty_key_bool_to_string(::proto3::BoolToString* value);
+  ::proto3::BoolToString* unsafe_arena_release_empty_key_bool_to_string();
+
+  private:
+  const ::proto3::BoolToString& _internal_empty_key_bool_to_string() const;
+  ::proto3::BoolToString* _internal_mutable_empty_key_bool_to_string();
+
+  public:
+  // .proto3.IntToString empty_key_int_to_string = 11;
+  bool has_empty_key_int_to_string() const;
+  void clear_empty_key_int_to_string() ;
+  const ::proto3::IntToString& empty_key_int_to_string() const;
+  PROTOBUF_NODISCARD ::proto3::IntToString* release_empty_key_int_to_string();
+  ::proto3::IntToString* mutable_empty_key_int_to_string();
+  void set_allocated_empty_key_int_to_string(::proto3::IntToString* value);
+  void unsafe_arena_set_allocated_empty_key_int_to_string(::proto3::IntToString* value);
+  ::proto3::IntToString* unsafe_arena_release_empty_key_int_to_string();
+
+  private:
+  const ::proto3::IntToString& _internal_empty_key_int_to_string() const;
+  ::proto3::IntToString* _internal_mutable_empty_key_int_to_string();
+
+  public:
+  // .proto3.Mixed1 empty_key_mixed = 12;
+  bool has_empty_key_mixed() const;
+  void clear_empty_key_mixed() ;
+  const ::proto3::Mixed1& empty_key_mixed() const;
+  PROTOBUF_NODISCARD ::proto3::Mixed1* release_empty_key_mixed();
+  ::proto3::Mixed1* mutable_empty_key_mixed();
+  void set_allocated_empty_key_mixed(::proto3::Mixed1* value);
+  void unsafe_arena_set_allocated_empty_key_mixed(::proto3::Mixed1* value);
+  ::proto3::Mixed1* unsafe_arena_release_empty_key_mixed();
+
+  private:
+  const ::proto3::Mixed1& _internal_empty_key_mixed() const;
+  ::proto3::Mixed1* _internal_mutable_empty_key_mixed();
+
+  public:
+  // .proto3.MapOfObjects empty_key_map_objects = 13;
+  bool has_empty_key_map_objects() const;
+  void clear_empty_key_map_objects() ;
+  const ::proto3::MapOfObjects& empty_key_map_objects() const;
+  PROTOBUF_NODISCARD ::proto3::MapOfObjects* release_empty_key_map_objects();
+  ::proto3::MapOfObjects* mutable_empty_key_map_objects();
+  void set_allocated_empty_key_map_objects(::proto3::MapOfObjects* value);
+  void unsafe_arena_set_allocated_empty_key_map_objects(::proto3::MapOfObjects* value);
+  ::proto3::MapOfObjects* unsafe_arena_release_empty_key_map_objects();
+
+  private:
+  const ::proto3::MapOfObjects& _internal_empty_key_map_objects() const;
+  ::proto3::MapOfObjects* _internal_mutable_empty_key_map_objects();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapsTestCases)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      4, 13, 13,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::proto3::EmptyMap* empty_map_;
+    ::proto3::StringtoInt* string_to_int_;
+    ::proto3::IntToString* int_to_string_;
+    ::proto3::Mixed1* mixed1_;
+    ::proto3::Mixed2* mixed2_;
+    ::proto3::MapOfObjects* map_of_objects_;
+    ::proto3::StringtoInt* empty_key_string_to_int1_;
+    ::proto3::StringtoInt* empty_key_string_to_int2_;
+    ::proto3::StringtoInt* empty_key_string_to_int3_;
+    ::proto3::BoolToString* empty_key_bool_to_string_;
+    ::proto3::IntToString* empty_key_int_to_string_;
+    ::proto3::Mixed1* empty_key_mixed_;
+    ::proto3::MapOfObjects* empty_key_map_objects_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map2Entry final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOutWireFormat.Map2Entry) */ {
+ public:
+  inline MapOutWireFormat_Map2Entry() : MapOutWireFormat_Map2Entry(nullptr) {}
+  ~MapOutWireFormat_Map2Entry() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOutWireFormat_Map2Entry(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOutWireFormat_Map2Entry(const MapOutWireFormat_Map2Entry& from)
+      : MapOutWireFormat_Map2Entry(nullptr, from) {}
+  MapOutWireFormat_Map2Entry(MapOutWireFormat_Map2Entry&& from) noexcept
+    : MapOutWireFormat_Map2Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map2Entry& operator=(const MapOutWireFormat_Map2Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map2Entry& operator=(MapOutWireFormat_Map2Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOutWireFormat_Map2Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOutWireFormat_Map2Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map2Entry*>(
+               &_MapOutWireFormat_Map2Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    60;
+
+  friend void swap(MapOutWireFormat_Map2Entry& a, MapOutWireFormat_Map2Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOutWireFormat_Map2Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOutWireFormat_Map2Entry* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOutWireFormat_Map2Entry* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map2Entry>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOutWireFormat_Map2Entry& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOutWireFormat_Map2Entry& from) {
+    MapOutWireFormat_Map2Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOutWireFormat_Map2Entry* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOutWireFormat.Map2Entry";
+  }
+  protected:
+  explicit MapOutWireFormat_Map2Entry(::google::protobuf::Arena* arena);
+  MapOutWireFormat_Map2Entry(::google::protobuf::Arena* arena, const MapOutWireFormat_Map2Entry& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key() ;
+  const std::string& key() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_key(Arg_&& arg, Args_... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* value);
+
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(
+      const std::string& value);
+  std::string* _internal_mutable_key();
+
+  public:
+  // .proto3.MapOut value = 2;
+  bool has_value() const;
+  void clear_value() ;
+  const ::proto3::MapOut& value() const;
+  PROTOBUF_NODISCARD ::proto3::MapOut* release_value();
+  ::proto3::MapOut* mutable_value();
+  void set_allocated_value(::proto3::MapOut* value);
+  void unsafe_arena_set_allocated_value(::proto3::MapOut* value);
+  ::proto3::MapOut* unsafe_arena_release_value();
+
+  private:
+  const ::proto3::MapOut& _internal_value() const;
+  ::proto3::MapOut* _internal_mutable_value();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOutWireFormat.Map2Entry)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 1,
+      45, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr key_;
+    ::proto3::MapOut* value_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};// -------------------------------------------------------------------
+
+class MapOutWireFormat final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:proto3.MapOutWireFormat) */ {
+ public:
+  inline MapOutWireFormat() : MapOutWireFormat(nullptr) {}
+  ~MapOutWireFormat() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR MapOutWireFormat(::google::protobuf::internal::ConstantInitialized);
+
+  inline MapOutWireFormat(const MapOutWireFormat& from)
+      : MapOutWireFormat(nullptr, from) {}
+  MapOutWireFormat(MapOutWireFormat&& from) noexcept
+    : MapOutWireFormat() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat& operator=(const MapOutWireFormat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat& operator=(MapOutWireFormat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MapOutWireFormat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MapOutWireFormat* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat*>(
+               &_MapOutWireFormat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    63;
+
+  friend void swap(MapOutWireFormat& a, MapOutWireFormat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MapOutWireFormat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MapOutWireFormat* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MapOutWireFormat* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MapOutWireFormat>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const MapOutWireFormat& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const MapOutWireFormat& from) {
+    MapOutWireFormat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(MapOutWireFormat* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "proto3.MapOutWireFormat";
+  }
+  protected:
+  explicit MapOutWireFormat(::google::protobuf::Arena* arena);
+  MapOutWireFormat(::google::protobuf::Arena* arena, const MapOutWireFormat& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using Map1Entry = MapOutWireFormat_Map1Entry;
+  using Map2Entry = MapOutWireFormat_Map2Entry;
+  using Map3Entry = MapOutWireFormat_Map3Entry;
+  using Map4Entry = MapOutWireFormat_Map4Entry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMap1FieldNumber = 1,
+    kMap2FieldNumber = 2,
+    kMap3FieldNumber = 3,
+    kMap4FieldNumber = 5,
+    kBarFieldNumber = 4,
+  };
+  // repeated .proto3.MapOutWireFormat.Map1Entry map1 = 1;
+  int map1_size() const;
+  private:
+  int _internal_map1_size() const;
+
+  public:
+  void clear_map1() ;
+  ::proto3::MapOutWireFormat_Map1Entry* mutable_map1(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map1Entry >*
+      mutable_map1();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map1Entry>& _internal_map1() const;
+  ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map1Entry>* _internal_mutable_map1();
+  public:
+  const ::proto3::MapOutWireFormat_Map1Entry& map1(int index) const;
+  ::proto3::MapOutWireFormat_Map1Entry* add_map1();
+  const ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map1Entry >&
+      map1() const;
+  // repeated .proto3.MapOutWireFormat.Map2Entry map2 = 2;
+  int map2_size() const;
+  private:
+  int _internal_map2_size() const;
+
+  public:
+  void clear_map2() ;
+  ::proto3::MapOutWireFormat_Map2Entry* mutable_map2(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map2Entry >*
+      mutable_map2();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map2Entry>& _internal_map2() const;
+  ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map2Entry>* _internal_mutable_map2();
+  public:
+  const ::proto3::MapOutWireFormat_Map2Entry& map2(int index) const;
+  ::proto3::MapOutWireFormat_Map2Entry* add_map2();
+  const ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map2Entry >&
+      map2() const;
+  // repeated .proto3.MapOutWireFormat.Map3Entry map3 = 3;
+  int map3_size() const;
+  private:
+  int _internal_map3_size() const;
+
+  public:
+  void clear_map3() ;
+  ::proto3::MapOutWireFormat_Map3Entry* mutable_map3(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map3Entry >*
+      mutable_map3();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map3Entry>& _internal_map3() const;
+  ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map3Entry>* _internal_mutable_map3();
+  public:
+  const ::proto3::MapOutWireFormat_Map3Entry& map3(int index) const;
+  ::proto3::MapOutWireFormat_Map3Entry* add_map3();
+  const ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map3Entry >&
+      map3() const;
+  // repeated .proto3.MapOutWireFormat.Map4Entry map4 = 5;
+  int map4_size() const;
+  private:
+  int _internal_map4_size() const;
+
+  public:
+  void clear_map4() ;
+  ::proto3::MapOutWireFormat_Map4Entry* mutable_map4(int index);
+  ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map4Entry >*
+      mutable_map4();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map4Entry>& _internal_map4() const;
+  ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map4Entry>* _internal_mutable_map4();
+  public:
+  const ::proto3::MapOutWireFormat_Map4Entry& map4(int index) const;
+  ::proto3::MapOutWireFormat_Map4Entry* add_map4();
+  const ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map4Entry >&
+      map4() const;
+  // string bar = 4;
+  void clear_bar() ;
+  const std::string& bar() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_bar(Arg_&& arg, Args_... args);
+  std::string* mutable_bar();
+  PROTOBUF_NODISCARD std::string* release_bar();
+  void set_allocated_bar(std::string* value);
+
+  private:
+  const std::string& _internal_bar() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bar(
+      const std::string& value);
+  std::string* _internal_mutable_bar();
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto3.MapOutWireFormat)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 5, 4,
+      35, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map1Entry > map1_;
+    ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map2Entry > map2_;
+    ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map3Entry > map3_;
+    ::google::protobuf::RepeatedPtrField< ::proto3::MapOutWireFormat_Map4Entry > map4_;
+    ::google::protobuf::internal::ArenaStringPtr bar_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// MessageType
+
+// int32 value = 1;
+inline void MessageType::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_ = 0;
+}
+inline ::int32_t MessageType::value() const {
+  // @@protoc_insertion_point(field_get:proto3.MessageType.value)
+  return _internal_value();
+}
+inline void MessageType::set_value(::int32_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:proto3.MessageType.value)
+}
+inline ::int32_t MessageType::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.value_;
+}
+inline void MessageType::_internal_set_value(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.value_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestMessage
+
+// bool bool_value = 1;
+inline void TestMessage::clear_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_value_ = false;
+}
+inline bool TestMessage::bool_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.bool_value)
+  return _internal_bool_value();
+}
+inline void TestMessage::set_bool_value(bool value) {
+  _internal_set_bool_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.bool_value)
+}
+inline bool TestMessage::_internal_bool_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_value_;
+}
+inline void TestMessage::_internal_set_bool_value(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bool_value_ = value;
+}
+
+// int32 int32_value = 2;
+inline void TestMessage::clear_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int32_value_ = 0;
+}
+inline ::int32_t TestMessage::int32_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.int32_value)
+  return _internal_int32_value();
+}
+inline void TestMessage::set_int32_value(::int32_t value) {
+  _internal_set_int32_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.int32_value)
+}
+inline ::int32_t TestMessage::_internal_int32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int32_value_;
+}
+inline void TestMessage::_internal_set_int32_value(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.int32_value_ = value;
+}
+
+// int64 int64_value = 3;
+inline void TestMessage::clear_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int64_value_ = ::int64_t{0};
+}
+inline ::int64_t TestMessage::int64_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.int64_value)
+  return _internal_int64_value();
+}
+inline void TestMessage::set_int64_value(::int64_t value) {
+  _internal_set_int64_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.int64_value)
+}
+inline ::int64_t TestMessage::_internal_int64_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int64_value_;
+}
+inline void TestMessage::_internal_set_int64_value(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.int64_value_ = value;
+}
+
+// uint32 uint32_value = 4;
+inline void TestMessage::clear_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint32_value_ = 0u;
+}
+inline ::uint32_t TestMessage::uint32_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.uint32_value)
+  return _internal_uint32_value();
+}
+inline void TestMessage::set_uint32_value(::uint32_t value) {
+  _internal_set_uint32_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.uint32_value)
+}
+inline ::uint32_t TestMessage::_internal_uint32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint32_value_;
+}
+inline void TestMessage::_internal_set_uint32_value(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.uint32_value_ = value;
+}
+
+// uint64 uint64_value = 5;
+inline void TestMessage::clear_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint64_value_ = ::uint64_t{0u};
+}
+inline ::uint64_t TestMessage::uint64_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.uint64_value)
+  return _internal_uint64_value();
+}
+inline void TestMessage::set_uint64_value(::uint64_t value) {
+  _internal_set_uint64_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.uint64_value)
+}
+inline ::uint64_t TestMessage::_internal_uint64_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint64_value_;
+}
+inline void TestMessage::_internal_set_uint64_value(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.uint64_value_ = value;
+}
+
+// float float_value = 6;
+inline void TestMessage::clear_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.float_value_ = 0;
+}
+inline float TestMessage::float_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.float_value)
+  return _internal_float_value();
+}
+inline void TestMessage::set_float_value(float value) {
+  _internal_set_float_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.float_value)
+}
+inline float TestMessage::_internal_float_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.float_value_;
+}
+inline void TestMessage::_internal_set_float_value(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.float_value_ = value;
+}
+
+// double double_value = 7;
+inline void TestMessage::clear_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.double_value_ = 0;
+}
+inline double TestMessage::double_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.double_value)
+  return _internal_double_value();
+}
+inline void TestMessage::set_double_value(double value) {
+  _internal_set_double_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.double_value)
+}
+inline double TestMessage::_internal_double_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.double_value_;
+}
+inline void TestMessage::_internal_set_double_value(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.double_value_ = value;
+}
+
+// string string_value = 8;
+inline void TestMessage::clear_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_value_.ClearToEmpty();
+}
+inline const std::string& TestMessage::string_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.string_value)
+  return _internal_string_value();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestMessage::set_string_value(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.string_value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.string_value)
+}
+inline std::string* TestMessage::mutable_string_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_string_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestMessage.string_value)
+  return _s;
+}
+inline const std::string& TestMessage::_internal_string_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_value_.Get();
+}
+inline void TestMessage::_internal_set_string_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.string_value_.Set(value, GetArena());
+}
+inline std::string* TestMessage::_internal_mutable_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.string_value_.Mutable( GetArena());
+}
+inline std::string* TestMessage::release_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestMessage.string_value)
+  return _impl_.string_value_.Release();
+}
+inline void TestMessage::set_allocated_string_value(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_value_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.string_value_.IsDefault()) {
+          _impl_.string_value_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestMessage.string_value)
+}
+
+// bytes bytes_value = 9;
+inline void TestMessage::clear_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bytes_value_.ClearToEmpty();
+}
+inline const std::string& TestMessage::bytes_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.bytes_value)
+  return _internal_bytes_value();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestMessage::set_bytes_value(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bytes_value_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.bytes_value)
+}
+inline std::string* TestMessage::mutable_bytes_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_bytes_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestMessage.bytes_value)
+  return _s;
+}
+inline const std::string& TestMessage::_internal_bytes_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bytes_value_.Get();
+}
+inline void TestMessage::_internal_set_bytes_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bytes_value_.Set(value, GetArena());
+}
+inline std::string* TestMessage::_internal_mutable_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.bytes_value_.Mutable( GetArena());
+}
+inline std::string* TestMessage::release_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestMessage.bytes_value)
+  return _impl_.bytes_value_.Release();
+}
+inline void TestMessage::set_allocated_bytes_value(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bytes_value_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.bytes_value_.IsDefault()) {
+          _impl_.bytes_value_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestMessage.bytes_value)
+}
+
+// .proto3.EnumType enum_value = 10;
+inline void TestMessage::clear_enum_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.enum_value_ = 0;
+}
+inline ::proto3::EnumType TestMessage::enum_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.enum_value)
+  return _internal_enum_value();
+}
+inline void TestMessage::set_enum_value(::proto3::EnumType value) {
+  _internal_set_enum_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.enum_value)
+}
+inline ::proto3::EnumType TestMessage::_internal_enum_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3::EnumType>(_impl_.enum_value_);
+}
+inline void TestMessage::_internal_set_enum_value(::proto3::EnumType value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.enum_value_ = value;
+}
+
+// .proto3.MessageType message_value = 11;
+inline bool TestMessage::has_message_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_value_ != nullptr);
+  return value;
+}
+inline void TestMessage::clear_message_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.message_value_ != nullptr) _impl_.message_value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto3::MessageType& TestMessage::_internal_message_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::MessageType* p = _impl_.message_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::MessageType&>(::proto3::_MessageType_default_instance_);
+}
+inline const ::proto3::MessageType& TestMessage::message_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.message_value)
+  return _internal_message_value();
+}
+inline void TestMessage::unsafe_arena_set_allocated_message_value(::proto3::MessageType* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.message_value_);
+  }
+  _impl_.message_value_ = reinterpret_cast<::proto3::MessageType*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestMessage.message_value)
+}
+inline ::proto3::MessageType* TestMessage::release_message_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::MessageType* released = _impl_.message_value_;
+  _impl_.message_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::MessageType* TestMessage::unsafe_arena_release_message_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestMessage.message_value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::MessageType* temp = _impl_.message_value_;
+  _impl_.message_value_ = nullptr;
+  return temp;
+}
+inline ::proto3::MessageType* TestMessage::_internal_mutable_message_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.message_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::MessageType>(GetArena());
+    _impl_.message_value_ = reinterpret_cast<::proto3::MessageType*>(p);
+  }
+  return _impl_.message_value_;
+}
+inline ::proto3::MessageType* TestMessage::mutable_message_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::MessageType* _msg = _internal_mutable_message_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestMessage.message_value)
+  return _msg;
+}
+inline void TestMessage::set_allocated_message_value(::proto3::MessageType* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::MessageType*>(_impl_.message_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::MessageType*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.message_value_ = reinterpret_cast<::proto3::MessageType*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestMessage.message_value)
+}
+
+// repeated bool repeated_bool_value = 21;
+inline int TestMessage::_internal_repeated_bool_value_size() const {
+  return _internal_repeated_bool_value().size();
+}
+inline int TestMessage::repeated_bool_value_size() const {
+  return _internal_repeated_bool_value_size();
+}
+inline void TestMessage::clear_repeated_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bool_value_.Clear();
+}
+inline bool TestMessage::repeated_bool_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_bool_value)
+  return _internal_repeated_bool_value().Get(index);
+}
+inline void TestMessage::set_repeated_bool_value(int index, bool value) {
+  _internal_mutable_repeated_bool_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_bool_value)
+}
+inline void TestMessage::add_repeated_bool_value(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bool_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_bool_value)
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestMessage::repeated_bool_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_bool_value)
+  return _internal_repeated_bool_value();
+}
+inline ::google::protobuf::RepeatedField<bool>* TestMessage::mutable_repeated_bool_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_bool_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bool_value();
+}
+inline const ::google::protobuf::RepeatedField<bool>& TestMessage::_internal_repeated_bool_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bool_value_;
+}
+inline ::google::protobuf::RepeatedField<bool>* TestMessage::_internal_mutable_repeated_bool_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bool_value_;
+}
+
+// repeated int32 repeated_int32_value = 22;
+inline int TestMessage::_internal_repeated_int32_value_size() const {
+  return _internal_repeated_int32_value().size();
+}
+inline int TestMessage::repeated_int32_value_size() const {
+  return _internal_repeated_int32_value_size();
+}
+inline void TestMessage::clear_repeated_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int32_value_.Clear();
+}
+inline ::int32_t TestMessage::repeated_int32_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_int32_value)
+  return _internal_repeated_int32_value().Get(index);
+}
+inline void TestMessage::set_repeated_int32_value(int index, ::int32_t value) {
+  _internal_mutable_repeated_int32_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_int32_value)
+}
+inline void TestMessage::add_repeated_int32_value(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int32_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_int32_value)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestMessage::repeated_int32_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_int32_value)
+  return _internal_repeated_int32_value();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestMessage::mutable_repeated_int32_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_int32_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32_value();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& TestMessage::_internal_repeated_int32_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_value_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* TestMessage::_internal_mutable_repeated_int32_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_value_;
+}
+
+// repeated int64 repeated_int64_value = 23;
+inline int TestMessage::_internal_repeated_int64_value_size() const {
+  return _internal_repeated_int64_value().size();
+}
+inline int TestMessage::repeated_int64_value_size() const {
+  return _internal_repeated_int64_value_size();
+}
+inline void TestMessage::clear_repeated_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_int64_value_.Clear();
+}
+inline ::int64_t TestMessage::repeated_int64_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_int64_value)
+  return _internal_repeated_int64_value().Get(index);
+}
+inline void TestMessage::set_repeated_int64_value(int index, ::int64_t value) {
+  _internal_mutable_repeated_int64_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_int64_value)
+}
+inline void TestMessage::add_repeated_int64_value(::int64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_int64_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_int64_value)
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestMessage::repeated_int64_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_int64_value)
+  return _internal_repeated_int64_value();
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestMessage::mutable_repeated_int64_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_int64_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int64_value();
+}
+inline const ::google::protobuf::RepeatedField<::int64_t>& TestMessage::_internal_repeated_int64_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int64_value_;
+}
+inline ::google::protobuf::RepeatedField<::int64_t>* TestMessage::_internal_mutable_repeated_int64_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int64_value_;
+}
+
+// repeated uint32 repeated_uint32_value = 24;
+inline int TestMessage::_internal_repeated_uint32_value_size() const {
+  return _internal_repeated_uint32_value().size();
+}
+inline int TestMessage::repeated_uint32_value_size() const {
+  return _internal_repeated_uint32_value_size();
+}
+inline void TestMessage::clear_repeated_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint32_value_.Clear();
+}
+inline ::uint32_t TestMessage::repeated_uint32_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_uint32_value)
+  return _internal_repeated_uint32_value().Get(index);
+}
+inline void TestMessage::set_repeated_uint32_value(int index, ::uint32_t value) {
+  _internal_mutable_repeated_uint32_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_uint32_value)
+}
+inline void TestMessage::add_repeated_uint32_value(::uint32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint32_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_uint32_value)
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestMessage::repeated_uint32_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_uint32_value)
+  return _internal_repeated_uint32_value();
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestMessage::mutable_repeated_uint32_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_uint32_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint32_value();
+}
+inline const ::google::protobuf::RepeatedField<::uint32_t>& TestMessage::_internal_repeated_uint32_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint32_value_;
+}
+inline ::google::protobuf::RepeatedField<::uint32_t>* TestMessage::_internal_mutable_repeated_uint32_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint32_value_;
+}
+
+// repeated uint64 repeated_uint64_value = 25;
+inline int TestMessage::_internal_repeated_uint64_value_size() const {
+  return _internal_repeated_uint64_value().size();
+}
+inline int TestMessage::repeated_uint64_value_size() const {
+  return _internal_repeated_uint64_value_size();
+}
+inline void TestMessage::clear_repeated_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_uint64_value_.Clear();
+}
+inline ::uint64_t TestMessage::repeated_uint64_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_uint64_value)
+  return _internal_repeated_uint64_value().Get(index);
+}
+inline void TestMessage::set_repeated_uint64_value(int index, ::uint64_t value) {
+  _internal_mutable_repeated_uint64_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_uint64_value)
+}
+inline void TestMessage::add_repeated_uint64_value(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_uint64_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_uint64_value)
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestMessage::repeated_uint64_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_uint64_value)
+  return _internal_repeated_uint64_value();
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestMessage::mutable_repeated_uint64_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_uint64_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint64_value();
+}
+inline const ::google::protobuf::RepeatedField<::uint64_t>& TestMessage::_internal_repeated_uint64_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint64_value_;
+}
+inline ::google::protobuf::RepeatedField<::uint64_t>* TestMessage::_internal_mutable_repeated_uint64_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint64_value_;
+}
+
+// repeated float repeated_float_value = 26;
+inline int TestMessage::_internal_repeated_float_value_size() const {
+  return _internal_repeated_float_value().size();
+}
+inline int TestMessage::repeated_float_value_size() const {
+  return _internal_repeated_float_value_size();
+}
+inline void TestMessage::clear_repeated_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_float_value_.Clear();
+}
+inline float TestMessage::repeated_float_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_float_value)
+  return _internal_repeated_float_value().Get(index);
+}
+inline void TestMessage::set_repeated_float_value(int index, float value) {
+  _internal_mutable_repeated_float_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_float_value)
+}
+inline void TestMessage::add_repeated_float_value(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_float_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_float_value)
+}
+inline const ::google::protobuf::RepeatedField<float>& TestMessage::repeated_float_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_float_value)
+  return _internal_repeated_float_value();
+}
+inline ::google::protobuf::RepeatedField<float>* TestMessage::mutable_repeated_float_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_float_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_float_value();
+}
+inline const ::google::protobuf::RepeatedField<float>& TestMessage::_internal_repeated_float_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_float_value_;
+}
+inline ::google::protobuf::RepeatedField<float>* TestMessage::_internal_mutable_repeated_float_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_float_value_;
+}
+
+// repeated double repeated_double_value = 27;
+inline int TestMessage::_internal_repeated_double_value_size() const {
+  return _internal_repeated_double_value().size();
+}
+inline int TestMessage::repeated_double_value_size() const {
+  return _internal_repeated_double_value_size();
+}
+inline void TestMessage::clear_repeated_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_double_value_.Clear();
+}
+inline double TestMessage::repeated_double_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_double_value)
+  return _internal_repeated_double_value().Get(index);
+}
+inline void TestMessage::set_repeated_double_value(int index, double value) {
+  _internal_mutable_repeated_double_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_double_value)
+}
+inline void TestMessage::add_repeated_double_value(double value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_double_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_double_value)
+}
+inline const ::google::protobuf::RepeatedField<double>& TestMessage::repeated_double_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_double_value)
+  return _internal_repeated_double_value();
+}
+inline ::google::protobuf::RepeatedField<double>* TestMessage::mutable_repeated_double_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_double_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_double_value();
+}
+inline const ::google::protobuf::RepeatedField<double>& TestMessage::_internal_repeated_double_value()
+    const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_double_value_;
+}
+inline ::google::protobuf::RepeatedField<double>* TestMessage::_internal_mutable_repeated_double_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_double_value_;
+}
+
+// repeated string repeated_string_value = 28;
+inline int TestMessage::_internal_repeated_string_value_size() const {
+  return _internal_repeated_string_value().size();
+}
+inline int TestMessage::repeated_string_value_size() const {
+  return _internal_repeated_string_value_size();
+}
+inline void TestMessage::clear_repeated_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_string_value_.Clear();
+}
+inline std::string* TestMessage::add_repeated_string_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_string_value()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3.TestMessage.repeated_string_value)
+  return _s;
+}
+inline const std::string& TestMessage::repeated_string_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_string_value)
+  return _internal_repeated_string_value().Get(index);
+}
+inline std::string* TestMessage::mutable_repeated_string_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestMessage.repeated_string_value)
+  return _internal_mutable_repeated_string_value()->Mutable(index);
+}
+inline void TestMessage::set_repeated_string_value(int index, const std::string& value) {
+  _internal_mutable_repeated_string_value()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::set_repeated_string_value(int index, std::string&& value) {
+  _internal_mutable_repeated_string_value()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::set_repeated_string_value(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_string_value()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::set_repeated_string_value(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_string_value()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::set_repeated_string_value(int index, absl::string_view value) {
+  _internal_mutable_repeated_string_value()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::add_repeated_string_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_value()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::add_repeated_string_value(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_value()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::add_repeated_string_value(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_value()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::add_repeated_string_value(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_value()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3.TestMessage.repeated_string_value)
+}
+inline void TestMessage::add_repeated_string_value(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_string_value()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3.TestMessage.repeated_string_value)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestMessage::repeated_string_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_string_value)
+  return _internal_repeated_string_value();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestMessage::mutable_repeated_string_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_string_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestMessage::_internal_repeated_string_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestMessage::_internal_mutable_repeated_string_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_value_;
+}
+
+// repeated bytes repeated_bytes_value = 29;
+inline int TestMessage::_internal_repeated_bytes_value_size() const {
+  return _internal_repeated_bytes_value().size();
+}
+inline int TestMessage::repeated_bytes_value_size() const {
+  return _internal_repeated_bytes_value_size();
+}
+inline void TestMessage::clear_repeated_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_bytes_value_.Clear();
+}
+inline std::string* TestMessage::add_repeated_bytes_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_repeated_bytes_value()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3.TestMessage.repeated_bytes_value)
+  return _s;
+}
+inline const std::string& TestMessage::repeated_bytes_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_bytes_value)
+  return _internal_repeated_bytes_value().Get(index);
+}
+inline std::string* TestMessage::mutable_repeated_bytes_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestMessage.repeated_bytes_value)
+  return _internal_mutable_repeated_bytes_value()->Mutable(index);
+}
+inline void TestMessage::set_repeated_bytes_value(int index, const std::string& value) {
+  _internal_mutable_repeated_bytes_value()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::set_repeated_bytes_value(int index, std::string&& value) {
+  _internal_mutable_repeated_bytes_value()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::set_repeated_bytes_value(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_repeated_bytes_value()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::set_repeated_bytes_value(int index, const void* value,
+                              std::size_t size) {
+  _internal_mutable_repeated_bytes_value()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::set_repeated_bytes_value(int index, absl::string_view value) {
+  _internal_mutable_repeated_bytes_value()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::add_repeated_bytes_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes_value()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::add_repeated_bytes_value(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes_value()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::add_repeated_bytes_value(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes_value()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::add_repeated_bytes_value(const void* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes_value()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3.TestMessage.repeated_bytes_value)
+}
+inline void TestMessage::add_repeated_bytes_value(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_bytes_value()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3.TestMessage.repeated_bytes_value)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestMessage::repeated_bytes_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_bytes_value)
+  return _internal_repeated_bytes_value();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestMessage::mutable_repeated_bytes_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_bytes_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bytes_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+TestMessage::_internal_repeated_bytes_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bytes_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+TestMessage::_internal_mutable_repeated_bytes_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bytes_value_;
+}
+
+// repeated .proto3.EnumType repeated_enum_value = 30;
+inline int TestMessage::_internal_repeated_enum_value_size() const {
+  return _internal_repeated_enum_value().size();
+}
+inline int TestMessage::repeated_enum_value_size() const {
+  return _internal_repeated_enum_value_size();
+}
+inline void TestMessage::clear_repeated_enum_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_enum_value_.Clear();
+}
+inline ::proto3::EnumType TestMessage::repeated_enum_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_enum_value)
+  return static_cast<::proto3::EnumType>(_internal_repeated_enum_value().Get(index));
+}
+inline void TestMessage::set_repeated_enum_value(int index, ::proto3::EnumType value) {
+  _internal_mutable_repeated_enum_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestMessage.repeated_enum_value)
+}
+inline void TestMessage::add_repeated_enum_value(::proto3::EnumType value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_enum_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_enum_value)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestMessage::repeated_enum_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_enum_value)
+  return _internal_repeated_enum_value();
+}
+inline ::google::protobuf::RepeatedField<int>* TestMessage::mutable_repeated_enum_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_enum_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_enum_value();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestMessage::_internal_repeated_enum_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_enum_value_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestMessage::_internal_mutable_repeated_enum_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_enum_value_;
+}
+
+// repeated .proto3.MessageType repeated_message_value = 31;
+inline int TestMessage::_internal_repeated_message_value_size() const {
+  return _internal_repeated_message_value().size();
+}
+inline int TestMessage::repeated_message_value_size() const {
+  return _internal_repeated_message_value_size();
+}
+inline void TestMessage::clear_repeated_message_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_message_value_.Clear();
+}
+inline ::proto3::MessageType* TestMessage::mutable_repeated_message_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestMessage.repeated_message_value)
+  return _internal_mutable_repeated_message_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MessageType>* TestMessage::mutable_repeated_message_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestMessage.repeated_message_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_message_value();
+}
+inline const ::proto3::MessageType& TestMessage::repeated_message_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestMessage.repeated_message_value)
+  return _internal_repeated_message_value().Get(index);
+}
+inline ::proto3::MessageType* TestMessage::add_repeated_message_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3::MessageType* _add = _internal_mutable_repeated_message_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestMessage.repeated_message_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MessageType>& TestMessage::repeated_message_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestMessage.repeated_message_value)
+  return _internal_repeated_message_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MessageType>&
+TestMessage::_internal_repeated_message_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_message_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MessageType>*
+TestMessage::_internal_mutable_repeated_message_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_message_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestOneof
+
+// int32 oneof_int32_value = 1;
+inline bool TestOneof::has_oneof_int32_value() const {
+  return oneof_value_case() == kOneofInt32Value;
+}
+inline void TestOneof::set_has_oneof_int32_value() {
+  _impl_._oneof_case_[0] = kOneofInt32Value;
+}
+inline void TestOneof::clear_oneof_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() == kOneofInt32Value) {
+    _impl_.oneof_value_.oneof_int32_value_ = 0;
+    clear_has_oneof_value();
+  }
+}
+inline ::int32_t TestOneof::oneof_int32_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestOneof.oneof_int32_value)
+  return _internal_oneof_int32_value();
+}
+inline void TestOneof::set_oneof_int32_value(::int32_t value) {
+  _internal_set_oneof_int32_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestOneof.oneof_int32_value)
+}
+inline ::int32_t TestOneof::_internal_oneof_int32_value() const {
+  if (oneof_value_case() == kOneofInt32Value) {
+    return _impl_.oneof_value_.oneof_int32_value_;
+  }
+  return 0;
+}
+inline void TestOneof::_internal_set_oneof_int32_value(::int32_t value) {
+  if (oneof_value_case() != kOneofInt32Value) {
+    clear_oneof_value();
+    set_has_oneof_int32_value();
+  }
+  _impl_.oneof_value_.oneof_int32_value_ = value;
+}
+
+// string oneof_string_value = 2;
+inline bool TestOneof::has_oneof_string_value() const {
+  return oneof_value_case() == kOneofStringValue;
+}
+inline void TestOneof::set_has_oneof_string_value() {
+  _impl_._oneof_case_[0] = kOneofStringValue;
+}
+inline void TestOneof::clear_oneof_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() == kOneofStringValue) {
+    _impl_.oneof_value_.oneof_string_value_.Destroy();
+    clear_has_oneof_value();
+  }
+}
+inline const std::string& TestOneof::oneof_string_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestOneof.oneof_string_value)
+  return _internal_oneof_string_value();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneof::set_oneof_string_value(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofStringValue) {
+    clear_oneof_value();
+
+    set_has_oneof_string_value();
+    _impl_.oneof_value_.oneof_string_value_.InitDefault();
+  }
+  _impl_.oneof_value_.oneof_string_value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.TestOneof.oneof_string_value)
+}
+inline std::string* TestOneof::mutable_oneof_string_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_string_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestOneof.oneof_string_value)
+  return _s;
+}
+inline const std::string& TestOneof::_internal_oneof_string_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofStringValue) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_value_.oneof_string_value_.Get();
+}
+inline void TestOneof::_internal_set_oneof_string_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofStringValue) {
+    clear_oneof_value();
+
+    set_has_oneof_string_value();
+    _impl_.oneof_value_.oneof_string_value_.InitDefault();
+  }
+  _impl_.oneof_value_.oneof_string_value_.Set(value, GetArena());
+}
+inline std::string* TestOneof::_internal_mutable_oneof_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofStringValue) {
+    clear_oneof_value();
+
+    set_has_oneof_string_value();
+    _impl_.oneof_value_.oneof_string_value_.InitDefault();
+  }
+  return _impl_.oneof_value_.oneof_string_value_.Mutable( GetArena());
+}
+inline std::string* TestOneof::release_oneof_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestOneof.oneof_string_value)
+  if (oneof_value_case() != kOneofStringValue) {
+    return nullptr;
+  }
+  clear_has_oneof_value();
+  return _impl_.oneof_value_.oneof_string_value_.Release();
+}
+inline void TestOneof::set_allocated_oneof_string_value(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_value()) {
+    clear_oneof_value();
+  }
+  if (value != nullptr) {
+    set_has_oneof_string_value();
+    _impl_.oneof_value_.oneof_string_value_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestOneof.oneof_string_value)
+}
+
+// bytes oneof_bytes_value = 3;
+inline bool TestOneof::has_oneof_bytes_value() const {
+  return oneof_value_case() == kOneofBytesValue;
+}
+inline void TestOneof::set_has_oneof_bytes_value() {
+  _impl_._oneof_case_[0] = kOneofBytesValue;
+}
+inline void TestOneof::clear_oneof_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() == kOneofBytesValue) {
+    _impl_.oneof_value_.oneof_bytes_value_.Destroy();
+    clear_has_oneof_value();
+  }
+}
+inline const std::string& TestOneof::oneof_bytes_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestOneof.oneof_bytes_value)
+  return _internal_oneof_bytes_value();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void TestOneof::set_oneof_bytes_value(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofBytesValue) {
+    clear_oneof_value();
+
+    set_has_oneof_bytes_value();
+    _impl_.oneof_value_.oneof_bytes_value_.InitDefault();
+  }
+  _impl_.oneof_value_.oneof_bytes_value_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.TestOneof.oneof_bytes_value)
+}
+inline std::string* TestOneof::mutable_oneof_bytes_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_oneof_bytes_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestOneof.oneof_bytes_value)
+  return _s;
+}
+inline const std::string& TestOneof::_internal_oneof_bytes_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofBytesValue) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.oneof_value_.oneof_bytes_value_.Get();
+}
+inline void TestOneof::_internal_set_oneof_bytes_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofBytesValue) {
+    clear_oneof_value();
+
+    set_has_oneof_bytes_value();
+    _impl_.oneof_value_.oneof_bytes_value_.InitDefault();
+  }
+  _impl_.oneof_value_.oneof_bytes_value_.Set(value, GetArena());
+}
+inline std::string* TestOneof::_internal_mutable_oneof_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() != kOneofBytesValue) {
+    clear_oneof_value();
+
+    set_has_oneof_bytes_value();
+    _impl_.oneof_value_.oneof_bytes_value_.InitDefault();
+  }
+  return _impl_.oneof_value_.oneof_bytes_value_.Mutable( GetArena());
+}
+inline std::string* TestOneof::release_oneof_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestOneof.oneof_bytes_value)
+  if (oneof_value_case() != kOneofBytesValue) {
+    return nullptr;
+  }
+  clear_has_oneof_value();
+  return _impl_.oneof_value_.oneof_bytes_value_.Release();
+}
+inline void TestOneof::set_allocated_oneof_bytes_value(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (has_oneof_value()) {
+    clear_oneof_value();
+  }
+  if (value != nullptr) {
+    set_has_oneof_bytes_value();
+    _impl_.oneof_value_.oneof_bytes_value_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestOneof.oneof_bytes_value)
+}
+
+// .proto3.EnumType oneof_enum_value = 4;
+inline bool TestOneof::has_oneof_enum_value() const {
+  return oneof_value_case() == kOneofEnumValue;
+}
+inline void TestOneof::set_has_oneof_enum_value() {
+  _impl_._oneof_case_[0] = kOneofEnumValue;
+}
+inline void TestOneof::clear_oneof_enum_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() == kOneofEnumValue) {
+    _impl_.oneof_value_.oneof_enum_value_ = 0;
+    clear_has_oneof_value();
+  }
+}
+inline ::proto3::EnumType TestOneof::oneof_enum_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestOneof.oneof_enum_value)
+  return _internal_oneof_enum_value();
+}
+inline void TestOneof::set_oneof_enum_value(::proto3::EnumType value) {
+  _internal_set_oneof_enum_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestOneof.oneof_enum_value)
+}
+inline ::proto3::EnumType TestOneof::_internal_oneof_enum_value() const {
+  if (oneof_value_case() == kOneofEnumValue) {
+    return static_cast<::proto3::EnumType>(_impl_.oneof_value_.oneof_enum_value_);
+  }
+  return static_cast<::proto3::EnumType>(0);
+}
+inline void TestOneof::_internal_set_oneof_enum_value(::proto3::EnumType value) {
+  if (oneof_value_case() != kOneofEnumValue) {
+    clear_oneof_value();
+    set_has_oneof_enum_value();
+  }
+  _impl_.oneof_value_.oneof_enum_value_ = value;
+}
+
+// .proto3.MessageType oneof_message_value = 5;
+inline bool TestOneof::has_oneof_message_value() const {
+  return oneof_value_case() == kOneofMessageValue;
+}
+inline bool TestOneof::_internal_has_oneof_message_value() const {
+  return oneof_value_case() == kOneofMessageValue;
+}
+inline void TestOneof::set_has_oneof_message_value() {
+  _impl_._oneof_case_[0] = kOneofMessageValue;
+}
+inline void TestOneof::clear_oneof_message_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() == kOneofMessageValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.oneof_value_.oneof_message_value_;
+    }
+    clear_has_oneof_value();
+  }
+}
+inline ::proto3::MessageType* TestOneof::release_oneof_message_value() {
+  // @@protoc_insertion_point(field_release:proto3.TestOneof.oneof_message_value)
+  if (oneof_value_case() == kOneofMessageValue) {
+    clear_has_oneof_value();
+    auto* temp = _impl_.oneof_value_.oneof_message_value_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.oneof_value_.oneof_message_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto3::MessageType& TestOneof::_internal_oneof_message_value() const {
+  return oneof_value_case() == kOneofMessageValue ? *_impl_.oneof_value_.oneof_message_value_ : reinterpret_cast<::proto3::MessageType&>(::proto3::_MessageType_default_instance_);
+}
+inline const ::proto3::MessageType& TestOneof::oneof_message_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestOneof.oneof_message_value)
+  return _internal_oneof_message_value();
+}
+inline ::proto3::MessageType* TestOneof::unsafe_arena_release_oneof_message_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto3.TestOneof.oneof_message_value)
+  if (oneof_value_case() == kOneofMessageValue) {
+    clear_has_oneof_value();
+    auto* temp = _impl_.oneof_value_.oneof_message_value_;
+    _impl_.oneof_value_.oneof_message_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestOneof::unsafe_arena_set_allocated_oneof_message_value(::proto3::MessageType* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_oneof_value();
+  if (value) {
+    set_has_oneof_message_value();
+    _impl_.oneof_value_.oneof_message_value_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestOneof.oneof_message_value)
+}
+inline ::proto3::MessageType* TestOneof::_internal_mutable_oneof_message_value() {
+  if (oneof_value_case() != kOneofMessageValue) {
+    clear_oneof_value();
+    set_has_oneof_message_value();
+    _impl_.oneof_value_.oneof_message_value_ = CreateMaybeMessage<::proto3::MessageType>(GetArena());
+  }
+  return _impl_.oneof_value_.oneof_message_value_;
+}
+inline ::proto3::MessageType* TestOneof::mutable_oneof_message_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::MessageType* _msg = _internal_mutable_oneof_message_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestOneof.oneof_message_value)
+  return _msg;
+}
+
+// .google.protobuf.NullValue oneof_null_value = 6;
+inline bool TestOneof::has_oneof_null_value() const {
+  return oneof_value_case() == kOneofNullValue;
+}
+inline void TestOneof::set_has_oneof_null_value() {
+  _impl_._oneof_case_[0] = kOneofNullValue;
+}
+inline void TestOneof::clear_oneof_null_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (oneof_value_case() == kOneofNullValue) {
+    _impl_.oneof_value_.oneof_null_value_ = 0;
+    clear_has_oneof_value();
+  }
+}
+inline ::google::protobuf::NullValue TestOneof::oneof_null_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestOneof.oneof_null_value)
+  return _internal_oneof_null_value();
+}
+inline void TestOneof::set_oneof_null_value(::google::protobuf::NullValue value) {
+  _internal_set_oneof_null_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestOneof.oneof_null_value)
+}
+inline ::google::protobuf::NullValue TestOneof::_internal_oneof_null_value() const {
+  if (oneof_value_case() == kOneofNullValue) {
+    return static_cast<::google::protobuf::NullValue>(_impl_.oneof_value_.oneof_null_value_);
+  }
+  return static_cast<::google::protobuf::NullValue>(0);
+}
+inline void TestOneof::_internal_set_oneof_null_value(::google::protobuf::NullValue value) {
+  if (oneof_value_case() != kOneofNullValue) {
+    clear_oneof_value();
+    set_has_oneof_null_value();
+  }
+  _impl_.oneof_value_.oneof_null_value_ = value;
+}
+
+inline bool TestOneof::has_oneof_value() const {
+  return oneof_value_case() != ONEOF_VALUE_NOT_SET;
+}
+inline void TestOneof::clear_has_oneof_value() {
+  _impl_._oneof_case_[0] = ONEOF_VALUE_NOT_SET;
+}
+inline TestOneof::OneofValueCase TestOneof::oneof_value_case() const {
+  return TestOneof::OneofValueCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMap
+
+// map<bool, int32> bool_map = 1;
+inline int TestMap::_internal_bool_map_size() const {
+  return _internal_bool_map().size();
+}
+inline int TestMap::bool_map_size() const {
+  return _internal_bool_map_size();
+}
+inline void TestMap::clear_bool_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_map_.Clear();
+}
+inline const ::google::protobuf::Map<bool, ::int32_t>& TestMap::_internal_bool_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_map_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, ::int32_t>& TestMap::bool_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestMap.bool_map)
+  return _internal_bool_map();
+}
+inline ::google::protobuf::Map<bool, ::int32_t>* TestMap::_internal_mutable_bool_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.bool_map_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, ::int32_t>* TestMap::mutable_bool_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestMap.bool_map)
+  return _internal_mutable_bool_map();
+}
+
+// map<int32, int32> int32_map = 2;
+inline int TestMap::_internal_int32_map_size() const {
+  return _internal_int32_map().size();
+}
+inline int TestMap::int32_map_size() const {
+  return _internal_int32_map_size();
+}
+inline void TestMap::clear_int32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int32_map_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& TestMap::_internal_int32_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int32_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& TestMap::int32_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestMap.int32_map)
+  return _internal_int32_map();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* TestMap::_internal_mutable_int32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.int32_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* TestMap::mutable_int32_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestMap.int32_map)
+  return _internal_mutable_int32_map();
+}
+
+// map<int64, int32> int64_map = 3;
+inline int TestMap::_internal_int64_map_size() const {
+  return _internal_int64_map().size();
+}
+inline int TestMap::int64_map_size() const {
+  return _internal_int64_map_size();
+}
+inline void TestMap::clear_int64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int64_map_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::int32_t>& TestMap::_internal_int64_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int64_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::int32_t>& TestMap::int64_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestMap.int64_map)
+  return _internal_int64_map();
+}
+inline ::google::protobuf::Map<::int64_t, ::int32_t>* TestMap::_internal_mutable_int64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.int64_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::int32_t>* TestMap::mutable_int64_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestMap.int64_map)
+  return _internal_mutable_int64_map();
+}
+
+// map<uint32, int32> uint32_map = 4;
+inline int TestMap::_internal_uint32_map_size() const {
+  return _internal_uint32_map().size();
+}
+inline int TestMap::uint32_map_size() const {
+  return _internal_uint32_map_size();
+}
+inline void TestMap::clear_uint32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint32_map_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::int32_t>& TestMap::_internal_uint32_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint32_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::int32_t>& TestMap::uint32_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestMap.uint32_map)
+  return _internal_uint32_map();
+}
+inline ::google::protobuf::Map<::uint32_t, ::int32_t>* TestMap::_internal_mutable_uint32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.uint32_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::int32_t>* TestMap::mutable_uint32_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestMap.uint32_map)
+  return _internal_mutable_uint32_map();
+}
+
+// map<uint64, int32> uint64_map = 5;
+inline int TestMap::_internal_uint64_map_size() const {
+  return _internal_uint64_map().size();
+}
+inline int TestMap::uint64_map_size() const {
+  return _internal_uint64_map_size();
+}
+inline void TestMap::clear_uint64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint64_map_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::int32_t>& TestMap::_internal_uint64_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint64_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::int32_t>& TestMap::uint64_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestMap.uint64_map)
+  return _internal_uint64_map();
+}
+inline ::google::protobuf::Map<::uint64_t, ::int32_t>* TestMap::_internal_mutable_uint64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.uint64_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::int32_t>* TestMap::mutable_uint64_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestMap.uint64_map)
+  return _internal_mutable_uint64_map();
+}
+
+// map<string, int32> string_map = 6;
+inline int TestMap::_internal_string_map_size() const {
+  return _internal_string_map().size();
+}
+inline int TestMap::string_map_size() const {
+  return _internal_string_map_size();
+}
+inline void TestMap::clear_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::int32_t>& TestMap::_internal_string_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::int32_t>& TestMap::string_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestMap.string_map)
+  return _internal_string_map();
+}
+inline ::google::protobuf::Map<std::string, ::int32_t>* TestMap::_internal_mutable_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.string_map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::int32_t>* TestMap::mutable_string_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestMap.string_map)
+  return _internal_mutable_string_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestNestedMap
+
+// map<bool, int32> bool_map = 1;
+inline int TestNestedMap::_internal_bool_map_size() const {
+  return _internal_bool_map().size();
+}
+inline int TestNestedMap::bool_map_size() const {
+  return _internal_bool_map_size();
+}
+inline void TestNestedMap::clear_bool_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_map_.Clear();
+}
+inline const ::google::protobuf::Map<bool, ::int32_t>& TestNestedMap::_internal_bool_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_map_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, ::int32_t>& TestNestedMap::bool_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.bool_map)
+  return _internal_bool_map();
+}
+inline ::google::protobuf::Map<bool, ::int32_t>* TestNestedMap::_internal_mutable_bool_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.bool_map_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, ::int32_t>* TestNestedMap::mutable_bool_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.bool_map)
+  return _internal_mutable_bool_map();
+}
+
+// map<int32, int32> int32_map = 2;
+inline int TestNestedMap::_internal_int32_map_size() const {
+  return _internal_int32_map().size();
+}
+inline int TestNestedMap::int32_map_size() const {
+  return _internal_int32_map_size();
+}
+inline void TestNestedMap::clear_int32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int32_map_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& TestNestedMap::_internal_int32_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int32_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& TestNestedMap::int32_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.int32_map)
+  return _internal_int32_map();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* TestNestedMap::_internal_mutable_int32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.int32_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* TestNestedMap::mutable_int32_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.int32_map)
+  return _internal_mutable_int32_map();
+}
+
+// map<int64, int32> int64_map = 3;
+inline int TestNestedMap::_internal_int64_map_size() const {
+  return _internal_int64_map().size();
+}
+inline int TestNestedMap::int64_map_size() const {
+  return _internal_int64_map_size();
+}
+inline void TestNestedMap::clear_int64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.int64_map_.Clear();
+}
+inline const ::google::protobuf::Map<::int64_t, ::int32_t>& TestNestedMap::_internal_int64_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.int64_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int64_t, ::int32_t>& TestNestedMap::int64_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.int64_map)
+  return _internal_int64_map();
+}
+inline ::google::protobuf::Map<::int64_t, ::int32_t>* TestNestedMap::_internal_mutable_int64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.int64_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int64_t, ::int32_t>* TestNestedMap::mutable_int64_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.int64_map)
+  return _internal_mutable_int64_map();
+}
+
+// map<uint32, int32> uint32_map = 4;
+inline int TestNestedMap::_internal_uint32_map_size() const {
+  return _internal_uint32_map().size();
+}
+inline int TestNestedMap::uint32_map_size() const {
+  return _internal_uint32_map_size();
+}
+inline void TestNestedMap::clear_uint32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint32_map_.Clear();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::int32_t>& TestNestedMap::_internal_uint32_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint32_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint32_t, ::int32_t>& TestNestedMap::uint32_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.uint32_map)
+  return _internal_uint32_map();
+}
+inline ::google::protobuf::Map<::uint32_t, ::int32_t>* TestNestedMap::_internal_mutable_uint32_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.uint32_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint32_t, ::int32_t>* TestNestedMap::mutable_uint32_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.uint32_map)
+  return _internal_mutable_uint32_map();
+}
+
+// map<uint64, int32> uint64_map = 5;
+inline int TestNestedMap::_internal_uint64_map_size() const {
+  return _internal_uint64_map().size();
+}
+inline int TestNestedMap::uint64_map_size() const {
+  return _internal_uint64_map_size();
+}
+inline void TestNestedMap::clear_uint64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.uint64_map_.Clear();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::int32_t>& TestNestedMap::_internal_uint64_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.uint64_map_.GetMap();
+}
+inline const ::google::protobuf::Map<::uint64_t, ::int32_t>& TestNestedMap::uint64_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.uint64_map)
+  return _internal_uint64_map();
+}
+inline ::google::protobuf::Map<::uint64_t, ::int32_t>* TestNestedMap::_internal_mutable_uint64_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.uint64_map_.MutableMap();
+}
+inline ::google::protobuf::Map<::uint64_t, ::int32_t>* TestNestedMap::mutable_uint64_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.uint64_map)
+  return _internal_mutable_uint64_map();
+}
+
+// map<string, int32> string_map = 6;
+inline int TestNestedMap::_internal_string_map_size() const {
+  return _internal_string_map().size();
+}
+inline int TestNestedMap::string_map_size() const {
+  return _internal_string_map_size();
+}
+inline void TestNestedMap::clear_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::int32_t>& TestNestedMap::_internal_string_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::int32_t>& TestNestedMap::string_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.string_map)
+  return _internal_string_map();
+}
+inline ::google::protobuf::Map<std::string, ::int32_t>* TestNestedMap::_internal_mutable_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.string_map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::int32_t>* TestNestedMap::mutable_string_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.string_map)
+  return _internal_mutable_string_map();
+}
+
+// map<string, .proto3.TestNestedMap> map_map = 7;
+inline int TestNestedMap::_internal_map_map_size() const {
+  return _internal_map_map().size();
+}
+inline int TestNestedMap::map_map_size() const {
+  return _internal_map_map_size();
+}
+inline void TestNestedMap::clear_map_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>& TestNestedMap::_internal_map_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>& TestNestedMap::map_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestNestedMap.map_map)
+  return _internal_map_map();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>* TestNestedMap::_internal_mutable_map_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::TestNestedMap>* TestNestedMap::mutable_map_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestNestedMap.map_map)
+  return _internal_mutable_map_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestStringMap
+
+// map<string, string> string_map = 1;
+inline int TestStringMap::_internal_string_map_size() const {
+  return _internal_string_map().size();
+}
+inline int TestStringMap::string_map_size() const {
+  return _internal_string_map_size();
+}
+inline void TestStringMap::clear_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.string_map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& TestStringMap::_internal_string_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.string_map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& TestStringMap::string_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestStringMap.string_map)
+  return _internal_string_map();
+}
+inline ::google::protobuf::Map<std::string, std::string>* TestStringMap::_internal_mutable_string_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.string_map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, std::string>* TestStringMap::mutable_string_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestStringMap.string_map)
+  return _internal_mutable_string_map();
+}
+
+// -------------------------------------------------------------------
+
+// TestWrapper
+
+// .google.protobuf.BoolValue bool_value = 1;
+inline bool TestWrapper::has_bool_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.bool_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::BoolValue& TestWrapper::_internal_bool_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::BoolValue* p = _impl_.bool_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::BoolValue&>(::google::protobuf::_BoolValue_default_instance_);
+}
+inline const ::google::protobuf::BoolValue& TestWrapper::bool_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.bool_value)
+  return _internal_bool_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_bool_value(::google::protobuf::BoolValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bool_value_);
+  }
+  _impl_.bool_value_ = reinterpret_cast<::google::protobuf::BoolValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.bool_value)
+}
+inline ::google::protobuf::BoolValue* TestWrapper::release_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::BoolValue* released = _impl_.bool_value_;
+  _impl_.bool_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::BoolValue* TestWrapper::unsafe_arena_release_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.bool_value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::BoolValue* temp = _impl_.bool_value_;
+  _impl_.bool_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::BoolValue* TestWrapper::_internal_mutable_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.bool_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::BoolValue>(GetArena());
+    _impl_.bool_value_ = reinterpret_cast<::google::protobuf::BoolValue*>(p);
+  }
+  return _impl_.bool_value_;
+}
+inline ::google::protobuf::BoolValue* TestWrapper::mutable_bool_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::BoolValue* _msg = _internal_mutable_bool_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.bool_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_bool_value(::google::protobuf::BoolValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bool_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.bool_value_ = reinterpret_cast<::google::protobuf::BoolValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.bool_value)
+}
+
+// .google.protobuf.Int32Value int32_value = 2;
+inline bool TestWrapper::has_int32_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.int32_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Int32Value& TestWrapper::_internal_int32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Int32Value* p = _impl_.int32_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Int32Value&>(::google::protobuf::_Int32Value_default_instance_);
+}
+inline const ::google::protobuf::Int32Value& TestWrapper::int32_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.int32_value)
+  return _internal_int32_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_int32_value(::google::protobuf::Int32Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int32_value_);
+  }
+  _impl_.int32_value_ = reinterpret_cast<::google::protobuf::Int32Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.int32_value)
+}
+inline ::google::protobuf::Int32Value* TestWrapper::release_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::google::protobuf::Int32Value* released = _impl_.int32_value_;
+  _impl_.int32_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Int32Value* TestWrapper::unsafe_arena_release_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.int32_value)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::google::protobuf::Int32Value* temp = _impl_.int32_value_;
+  _impl_.int32_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Int32Value* TestWrapper::_internal_mutable_int32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.int32_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Int32Value>(GetArena());
+    _impl_.int32_value_ = reinterpret_cast<::google::protobuf::Int32Value*>(p);
+  }
+  return _impl_.int32_value_;
+}
+inline ::google::protobuf::Int32Value* TestWrapper::mutable_int32_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Int32Value* _msg = _internal_mutable_int32_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.int32_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_int32_value(::google::protobuf::Int32Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int32_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.int32_value_ = reinterpret_cast<::google::protobuf::Int32Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.int32_value)
+}
+
+// .google.protobuf.Int64Value int64_value = 3;
+inline bool TestWrapper::has_int64_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.int64_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Int64Value& TestWrapper::_internal_int64_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Int64Value* p = _impl_.int64_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Int64Value&>(::google::protobuf::_Int64Value_default_instance_);
+}
+inline const ::google::protobuf::Int64Value& TestWrapper::int64_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.int64_value)
+  return _internal_int64_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_int64_value(::google::protobuf::Int64Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int64_value_);
+  }
+  _impl_.int64_value_ = reinterpret_cast<::google::protobuf::Int64Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.int64_value)
+}
+inline ::google::protobuf::Int64Value* TestWrapper::release_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::google::protobuf::Int64Value* released = _impl_.int64_value_;
+  _impl_.int64_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Int64Value* TestWrapper::unsafe_arena_release_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.int64_value)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::google::protobuf::Int64Value* temp = _impl_.int64_value_;
+  _impl_.int64_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Int64Value* TestWrapper::_internal_mutable_int64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.int64_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Int64Value>(GetArena());
+    _impl_.int64_value_ = reinterpret_cast<::google::protobuf::Int64Value*>(p);
+  }
+  return _impl_.int64_value_;
+}
+inline ::google::protobuf::Int64Value* TestWrapper::mutable_int64_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Int64Value* _msg = _internal_mutable_int64_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.int64_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_int64_value(::google::protobuf::Int64Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int64_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.int64_value_ = reinterpret_cast<::google::protobuf::Int64Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.int64_value)
+}
+
+// .google.protobuf.UInt32Value uint32_value = 4;
+inline bool TestWrapper::has_uint32_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.uint32_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::UInt32Value& TestWrapper::_internal_uint32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::UInt32Value* p = _impl_.uint32_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::UInt32Value&>(::google::protobuf::_UInt32Value_default_instance_);
+}
+inline const ::google::protobuf::UInt32Value& TestWrapper::uint32_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.uint32_value)
+  return _internal_uint32_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_uint32_value(::google::protobuf::UInt32Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint32_value_);
+  }
+  _impl_.uint32_value_ = reinterpret_cast<::google::protobuf::UInt32Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.uint32_value)
+}
+inline ::google::protobuf::UInt32Value* TestWrapper::release_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::google::protobuf::UInt32Value* released = _impl_.uint32_value_;
+  _impl_.uint32_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::UInt32Value* TestWrapper::unsafe_arena_release_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.uint32_value)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::google::protobuf::UInt32Value* temp = _impl_.uint32_value_;
+  _impl_.uint32_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::UInt32Value* TestWrapper::_internal_mutable_uint32_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.uint32_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::UInt32Value>(GetArena());
+    _impl_.uint32_value_ = reinterpret_cast<::google::protobuf::UInt32Value*>(p);
+  }
+  return _impl_.uint32_value_;
+}
+inline ::google::protobuf::UInt32Value* TestWrapper::mutable_uint32_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::UInt32Value* _msg = _internal_mutable_uint32_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.uint32_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_uint32_value(::google::protobuf::UInt32Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint32_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.uint32_value_ = reinterpret_cast<::google::protobuf::UInt32Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.uint32_value)
+}
+
+// .google.protobuf.UInt64Value uint64_value = 5;
+inline bool TestWrapper::has_uint64_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.uint64_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::UInt64Value& TestWrapper::_internal_uint64_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::UInt64Value* p = _impl_.uint64_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::UInt64Value&>(::google::protobuf::_UInt64Value_default_instance_);
+}
+inline const ::google::protobuf::UInt64Value& TestWrapper::uint64_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.uint64_value)
+  return _internal_uint64_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_uint64_value(::google::protobuf::UInt64Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint64_value_);
+  }
+  _impl_.uint64_value_ = reinterpret_cast<::google::protobuf::UInt64Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.uint64_value)
+}
+inline ::google::protobuf::UInt64Value* TestWrapper::release_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::google::protobuf::UInt64Value* released = _impl_.uint64_value_;
+  _impl_.uint64_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::UInt64Value* TestWrapper::unsafe_arena_release_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.uint64_value)
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::google::protobuf::UInt64Value* temp = _impl_.uint64_value_;
+  _impl_.uint64_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::UInt64Value* TestWrapper::_internal_mutable_uint64_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.uint64_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::UInt64Value>(GetArena());
+    _impl_.uint64_value_ = reinterpret_cast<::google::protobuf::UInt64Value*>(p);
+  }
+  return _impl_.uint64_value_;
+}
+inline ::google::protobuf::UInt64Value* TestWrapper::mutable_uint64_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::UInt64Value* _msg = _internal_mutable_uint64_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.uint64_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_uint64_value(::google::protobuf::UInt64Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.uint64_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+
+  _impl_.uint64_value_ = reinterpret_cast<::google::protobuf::UInt64Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.uint64_value)
+}
+
+// .google.protobuf.FloatValue float_value = 6;
+inline bool TestWrapper::has_float_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.float_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::FloatValue& TestWrapper::_internal_float_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::FloatValue* p = _impl_.float_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::FloatValue&>(::google::protobuf::_FloatValue_default_instance_);
+}
+inline const ::google::protobuf::FloatValue& TestWrapper::float_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.float_value)
+  return _internal_float_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_float_value(::google::protobuf::FloatValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.float_value_);
+  }
+  _impl_.float_value_ = reinterpret_cast<::google::protobuf::FloatValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.float_value)
+}
+inline ::google::protobuf::FloatValue* TestWrapper::release_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::google::protobuf::FloatValue* released = _impl_.float_value_;
+  _impl_.float_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::FloatValue* TestWrapper::unsafe_arena_release_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.float_value)
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::google::protobuf::FloatValue* temp = _impl_.float_value_;
+  _impl_.float_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::FloatValue* TestWrapper::_internal_mutable_float_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.float_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::FloatValue>(GetArena());
+    _impl_.float_value_ = reinterpret_cast<::google::protobuf::FloatValue*>(p);
+  }
+  return _impl_.float_value_;
+}
+inline ::google::protobuf::FloatValue* TestWrapper::mutable_float_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FloatValue* _msg = _internal_mutable_float_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.float_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_float_value(::google::protobuf::FloatValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.float_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+
+  _impl_.float_value_ = reinterpret_cast<::google::protobuf::FloatValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.float_value)
+}
+
+// .google.protobuf.DoubleValue double_value = 7;
+inline bool TestWrapper::has_double_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.double_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::DoubleValue& TestWrapper::_internal_double_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::DoubleValue* p = _impl_.double_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::DoubleValue&>(::google::protobuf::_DoubleValue_default_instance_);
+}
+inline const ::google::protobuf::DoubleValue& TestWrapper::double_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.double_value)
+  return _internal_double_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_double_value(::google::protobuf::DoubleValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.double_value_);
+  }
+  _impl_.double_value_ = reinterpret_cast<::google::protobuf::DoubleValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.double_value)
+}
+inline ::google::protobuf::DoubleValue* TestWrapper::release_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::google::protobuf::DoubleValue* released = _impl_.double_value_;
+  _impl_.double_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::DoubleValue* TestWrapper::unsafe_arena_release_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.double_value)
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::google::protobuf::DoubleValue* temp = _impl_.double_value_;
+  _impl_.double_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::DoubleValue* TestWrapper::_internal_mutable_double_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.double_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::DoubleValue>(GetArena());
+    _impl_.double_value_ = reinterpret_cast<::google::protobuf::DoubleValue*>(p);
+  }
+  return _impl_.double_value_;
+}
+inline ::google::protobuf::DoubleValue* TestWrapper::mutable_double_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::DoubleValue* _msg = _internal_mutable_double_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.double_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_double_value(::google::protobuf::DoubleValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.double_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+
+  _impl_.double_value_ = reinterpret_cast<::google::protobuf::DoubleValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.double_value)
+}
+
+// .google.protobuf.StringValue string_value = 8;
+inline bool TestWrapper::has_string_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.string_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::StringValue& TestWrapper::_internal_string_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::StringValue* p = _impl_.string_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::StringValue&>(::google::protobuf::_StringValue_default_instance_);
+}
+inline const ::google::protobuf::StringValue& TestWrapper::string_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.string_value)
+  return _internal_string_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_string_value(::google::protobuf::StringValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.string_value_);
+  }
+  _impl_.string_value_ = reinterpret_cast<::google::protobuf::StringValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.string_value)
+}
+inline ::google::protobuf::StringValue* TestWrapper::release_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::google::protobuf::StringValue* released = _impl_.string_value_;
+  _impl_.string_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::StringValue* TestWrapper::unsafe_arena_release_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.string_value)
+
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::google::protobuf::StringValue* temp = _impl_.string_value_;
+  _impl_.string_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::StringValue* TestWrapper::_internal_mutable_string_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.string_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::StringValue>(GetArena());
+    _impl_.string_value_ = reinterpret_cast<::google::protobuf::StringValue*>(p);
+  }
+  return _impl_.string_value_;
+}
+inline ::google::protobuf::StringValue* TestWrapper::mutable_string_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::StringValue* _msg = _internal_mutable_string_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.string_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_string_value(::google::protobuf::StringValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.string_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+
+  _impl_.string_value_ = reinterpret_cast<::google::protobuf::StringValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.string_value)
+}
+
+// .google.protobuf.BytesValue bytes_value = 9;
+inline bool TestWrapper::has_bytes_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.bytes_value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::BytesValue& TestWrapper::_internal_bytes_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::BytesValue* p = _impl_.bytes_value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::BytesValue&>(::google::protobuf::_BytesValue_default_instance_);
+}
+inline const ::google::protobuf::BytesValue& TestWrapper::bytes_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.bytes_value)
+  return _internal_bytes_value();
+}
+inline void TestWrapper::unsafe_arena_set_allocated_bytes_value(::google::protobuf::BytesValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bytes_value_);
+  }
+  _impl_.bytes_value_ = reinterpret_cast<::google::protobuf::BytesValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestWrapper.bytes_value)
+}
+inline ::google::protobuf::BytesValue* TestWrapper::release_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::google::protobuf::BytesValue* released = _impl_.bytes_value_;
+  _impl_.bytes_value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::BytesValue* TestWrapper::unsafe_arena_release_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestWrapper.bytes_value)
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::google::protobuf::BytesValue* temp = _impl_.bytes_value_;
+  _impl_.bytes_value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::BytesValue* TestWrapper::_internal_mutable_bytes_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.bytes_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::BytesValue>(GetArena());
+    _impl_.bytes_value_ = reinterpret_cast<::google::protobuf::BytesValue*>(p);
+  }
+  return _impl_.bytes_value_;
+}
+inline ::google::protobuf::BytesValue* TestWrapper::mutable_bytes_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::BytesValue* _msg = _internal_mutable_bytes_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.bytes_value)
+  return _msg;
+}
+inline void TestWrapper::set_allocated_bytes_value(::google::protobuf::BytesValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.bytes_value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+
+  _impl_.bytes_value_ = reinterpret_cast<::google::protobuf::BytesValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestWrapper.bytes_value)
+}
+
+// repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+inline int TestWrapper::_internal_repeated_bool_value_size() const {
+  return _internal_repeated_bool_value().size();
+}
+inline int TestWrapper::repeated_bool_value_size() const {
+  return _internal_repeated_bool_value_size();
+}
+inline ::google::protobuf::BoolValue* TestWrapper::mutable_repeated_bool_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_bool_value)
+  return _internal_mutable_repeated_bool_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>* TestWrapper::mutable_repeated_bool_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_bool_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bool_value();
+}
+inline const ::google::protobuf::BoolValue& TestWrapper::repeated_bool_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_bool_value)
+  return _internal_repeated_bool_value().Get(index);
+}
+inline ::google::protobuf::BoolValue* TestWrapper::add_repeated_bool_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::BoolValue* _add = _internal_mutable_repeated_bool_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_bool_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>& TestWrapper::repeated_bool_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_bool_value)
+  return _internal_repeated_bool_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>&
+TestWrapper::_internal_repeated_bool_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bool_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BoolValue>*
+TestWrapper::_internal_mutable_repeated_bool_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bool_value_;
+}
+
+// repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+inline int TestWrapper::_internal_repeated_int32_value_size() const {
+  return _internal_repeated_int32_value().size();
+}
+inline int TestWrapper::repeated_int32_value_size() const {
+  return _internal_repeated_int32_value_size();
+}
+inline ::google::protobuf::Int32Value* TestWrapper::mutable_repeated_int32_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_int32_value)
+  return _internal_mutable_repeated_int32_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>* TestWrapper::mutable_repeated_int32_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_int32_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int32_value();
+}
+inline const ::google::protobuf::Int32Value& TestWrapper::repeated_int32_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_int32_value)
+  return _internal_repeated_int32_value().Get(index);
+}
+inline ::google::protobuf::Int32Value* TestWrapper::add_repeated_int32_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Int32Value* _add = _internal_mutable_repeated_int32_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_int32_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>& TestWrapper::repeated_int32_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_int32_value)
+  return _internal_repeated_int32_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>&
+TestWrapper::_internal_repeated_int32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int32_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int32Value>*
+TestWrapper::_internal_mutable_repeated_int32_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int32_value_;
+}
+
+// repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+inline int TestWrapper::_internal_repeated_int64_value_size() const {
+  return _internal_repeated_int64_value().size();
+}
+inline int TestWrapper::repeated_int64_value_size() const {
+  return _internal_repeated_int64_value_size();
+}
+inline ::google::protobuf::Int64Value* TestWrapper::mutable_repeated_int64_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_int64_value)
+  return _internal_mutable_repeated_int64_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>* TestWrapper::mutable_repeated_int64_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_int64_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_int64_value();
+}
+inline const ::google::protobuf::Int64Value& TestWrapper::repeated_int64_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_int64_value)
+  return _internal_repeated_int64_value().Get(index);
+}
+inline ::google::protobuf::Int64Value* TestWrapper::add_repeated_int64_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Int64Value* _add = _internal_mutable_repeated_int64_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_int64_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>& TestWrapper::repeated_int64_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_int64_value)
+  return _internal_repeated_int64_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>&
+TestWrapper::_internal_repeated_int64_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_int64_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Int64Value>*
+TestWrapper::_internal_mutable_repeated_int64_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_int64_value_;
+}
+
+// repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+inline int TestWrapper::_internal_repeated_uint32_value_size() const {
+  return _internal_repeated_uint32_value().size();
+}
+inline int TestWrapper::repeated_uint32_value_size() const {
+  return _internal_repeated_uint32_value_size();
+}
+inline ::google::protobuf::UInt32Value* TestWrapper::mutable_repeated_uint32_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_uint32_value)
+  return _internal_mutable_repeated_uint32_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>* TestWrapper::mutable_repeated_uint32_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_uint32_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint32_value();
+}
+inline const ::google::protobuf::UInt32Value& TestWrapper::repeated_uint32_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_uint32_value)
+  return _internal_repeated_uint32_value().Get(index);
+}
+inline ::google::protobuf::UInt32Value* TestWrapper::add_repeated_uint32_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::UInt32Value* _add = _internal_mutable_repeated_uint32_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_uint32_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>& TestWrapper::repeated_uint32_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_uint32_value)
+  return _internal_repeated_uint32_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>&
+TestWrapper::_internal_repeated_uint32_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint32_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt32Value>*
+TestWrapper::_internal_mutable_repeated_uint32_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint32_value_;
+}
+
+// repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+inline int TestWrapper::_internal_repeated_uint64_value_size() const {
+  return _internal_repeated_uint64_value().size();
+}
+inline int TestWrapper::repeated_uint64_value_size() const {
+  return _internal_repeated_uint64_value_size();
+}
+inline ::google::protobuf::UInt64Value* TestWrapper::mutable_repeated_uint64_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_uint64_value)
+  return _internal_mutable_repeated_uint64_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>* TestWrapper::mutable_repeated_uint64_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_uint64_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_uint64_value();
+}
+inline const ::google::protobuf::UInt64Value& TestWrapper::repeated_uint64_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_uint64_value)
+  return _internal_repeated_uint64_value().Get(index);
+}
+inline ::google::protobuf::UInt64Value* TestWrapper::add_repeated_uint64_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::UInt64Value* _add = _internal_mutable_repeated_uint64_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_uint64_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>& TestWrapper::repeated_uint64_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_uint64_value)
+  return _internal_repeated_uint64_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>&
+TestWrapper::_internal_repeated_uint64_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_uint64_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::UInt64Value>*
+TestWrapper::_internal_mutable_repeated_uint64_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_uint64_value_;
+}
+
+// repeated .google.protobuf.FloatValue repeated_float_value = 16;
+inline int TestWrapper::_internal_repeated_float_value_size() const {
+  return _internal_repeated_float_value().size();
+}
+inline int TestWrapper::repeated_float_value_size() const {
+  return _internal_repeated_float_value_size();
+}
+inline ::google::protobuf::FloatValue* TestWrapper::mutable_repeated_float_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_float_value)
+  return _internal_mutable_repeated_float_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>* TestWrapper::mutable_repeated_float_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_float_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_float_value();
+}
+inline const ::google::protobuf::FloatValue& TestWrapper::repeated_float_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_float_value)
+  return _internal_repeated_float_value().Get(index);
+}
+inline ::google::protobuf::FloatValue* TestWrapper::add_repeated_float_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::FloatValue* _add = _internal_mutable_repeated_float_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_float_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>& TestWrapper::repeated_float_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_float_value)
+  return _internal_repeated_float_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>&
+TestWrapper::_internal_repeated_float_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_float_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::FloatValue>*
+TestWrapper::_internal_mutable_repeated_float_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_float_value_;
+}
+
+// repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+inline int TestWrapper::_internal_repeated_double_value_size() const {
+  return _internal_repeated_double_value().size();
+}
+inline int TestWrapper::repeated_double_value_size() const {
+  return _internal_repeated_double_value_size();
+}
+inline ::google::protobuf::DoubleValue* TestWrapper::mutable_repeated_double_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_double_value)
+  return _internal_mutable_repeated_double_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>* TestWrapper::mutable_repeated_double_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_double_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_double_value();
+}
+inline const ::google::protobuf::DoubleValue& TestWrapper::repeated_double_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_double_value)
+  return _internal_repeated_double_value().Get(index);
+}
+inline ::google::protobuf::DoubleValue* TestWrapper::add_repeated_double_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::DoubleValue* _add = _internal_mutable_repeated_double_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_double_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>& TestWrapper::repeated_double_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_double_value)
+  return _internal_repeated_double_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>&
+TestWrapper::_internal_repeated_double_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_double_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::DoubleValue>*
+TestWrapper::_internal_mutable_repeated_double_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_double_value_;
+}
+
+// repeated .google.protobuf.StringValue repeated_string_value = 18;
+inline int TestWrapper::_internal_repeated_string_value_size() const {
+  return _internal_repeated_string_value().size();
+}
+inline int TestWrapper::repeated_string_value_size() const {
+  return _internal_repeated_string_value_size();
+}
+inline ::google::protobuf::StringValue* TestWrapper::mutable_repeated_string_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_string_value)
+  return _internal_mutable_repeated_string_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>* TestWrapper::mutable_repeated_string_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_string_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_string_value();
+}
+inline const ::google::protobuf::StringValue& TestWrapper::repeated_string_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_string_value)
+  return _internal_repeated_string_value().Get(index);
+}
+inline ::google::protobuf::StringValue* TestWrapper::add_repeated_string_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::StringValue* _add = _internal_mutable_repeated_string_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_string_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>& TestWrapper::repeated_string_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_string_value)
+  return _internal_repeated_string_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>&
+TestWrapper::_internal_repeated_string_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_string_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::StringValue>*
+TestWrapper::_internal_mutable_repeated_string_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_string_value_;
+}
+
+// repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+inline int TestWrapper::_internal_repeated_bytes_value_size() const {
+  return _internal_repeated_bytes_value().size();
+}
+inline int TestWrapper::repeated_bytes_value_size() const {
+  return _internal_repeated_bytes_value_size();
+}
+inline ::google::protobuf::BytesValue* TestWrapper::mutable_repeated_bytes_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestWrapper.repeated_bytes_value)
+  return _internal_mutable_repeated_bytes_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>* TestWrapper::mutable_repeated_bytes_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestWrapper.repeated_bytes_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_bytes_value();
+}
+inline const ::google::protobuf::BytesValue& TestWrapper::repeated_bytes_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestWrapper.repeated_bytes_value)
+  return _internal_repeated_bytes_value().Get(index);
+}
+inline ::google::protobuf::BytesValue* TestWrapper::add_repeated_bytes_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::BytesValue* _add = _internal_mutable_repeated_bytes_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestWrapper.repeated_bytes_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>& TestWrapper::repeated_bytes_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestWrapper.repeated_bytes_value)
+  return _internal_repeated_bytes_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>&
+TestWrapper::_internal_repeated_bytes_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_bytes_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::BytesValue>*
+TestWrapper::_internal_mutable_repeated_bytes_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_bytes_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestTimestamp
+
+// .google.protobuf.Timestamp value = 1;
+inline bool TestTimestamp::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Timestamp& TestTimestamp::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Timestamp* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Timestamp&>(::google::protobuf::_Timestamp_default_instance_);
+}
+inline const ::google::protobuf::Timestamp& TestTimestamp::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestTimestamp.value)
+  return _internal_value();
+}
+inline void TestTimestamp::unsafe_arena_set_allocated_value(::google::protobuf::Timestamp* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Timestamp*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestTimestamp.value)
+}
+inline ::google::protobuf::Timestamp* TestTimestamp::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Timestamp* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Timestamp* TestTimestamp::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestTimestamp.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Timestamp* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Timestamp* TestTimestamp::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Timestamp>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::Timestamp*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::Timestamp* TestTimestamp::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Timestamp* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestTimestamp.value)
+  return _msg;
+}
+inline void TestTimestamp::set_allocated_value(::google::protobuf::Timestamp* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Timestamp*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestTimestamp.value)
+}
+
+// repeated .google.protobuf.Timestamp repeated_value = 2;
+inline int TestTimestamp::_internal_repeated_value_size() const {
+  return _internal_repeated_value().size();
+}
+inline int TestTimestamp::repeated_value_size() const {
+  return _internal_repeated_value_size();
+}
+inline ::google::protobuf::Timestamp* TestTimestamp::mutable_repeated_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestTimestamp.repeated_value)
+  return _internal_mutable_repeated_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>* TestTimestamp::mutable_repeated_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestTimestamp.repeated_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_value();
+}
+inline const ::google::protobuf::Timestamp& TestTimestamp::repeated_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestTimestamp.repeated_value)
+  return _internal_repeated_value().Get(index);
+}
+inline ::google::protobuf::Timestamp* TestTimestamp::add_repeated_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Timestamp* _add = _internal_mutable_repeated_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestTimestamp.repeated_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>& TestTimestamp::repeated_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestTimestamp.repeated_value)
+  return _internal_repeated_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>&
+TestTimestamp::_internal_repeated_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Timestamp>*
+TestTimestamp::_internal_mutable_repeated_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestDuration
+
+// .google.protobuf.Duration value = 1;
+inline bool TestDuration::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Duration& TestDuration::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Duration* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Duration&>(::google::protobuf::_Duration_default_instance_);
+}
+inline const ::google::protobuf::Duration& TestDuration::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestDuration.value)
+  return _internal_value();
+}
+inline void TestDuration::unsafe_arena_set_allocated_value(::google::protobuf::Duration* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Duration*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestDuration.value)
+}
+inline ::google::protobuf::Duration* TestDuration::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Duration* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Duration* TestDuration::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestDuration.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Duration* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Duration* TestDuration::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Duration>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::Duration*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::Duration* TestDuration::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Duration* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestDuration.value)
+  return _msg;
+}
+inline void TestDuration::set_allocated_value(::google::protobuf::Duration* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Duration*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestDuration.value)
+}
+
+// repeated .google.protobuf.Duration repeated_value = 2;
+inline int TestDuration::_internal_repeated_value_size() const {
+  return _internal_repeated_value().size();
+}
+inline int TestDuration::repeated_value_size() const {
+  return _internal_repeated_value_size();
+}
+inline ::google::protobuf::Duration* TestDuration::mutable_repeated_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestDuration.repeated_value)
+  return _internal_mutable_repeated_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>* TestDuration::mutable_repeated_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestDuration.repeated_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_value();
+}
+inline const ::google::protobuf::Duration& TestDuration::repeated_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestDuration.repeated_value)
+  return _internal_repeated_value().Get(index);
+}
+inline ::google::protobuf::Duration* TestDuration::add_repeated_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Duration* _add = _internal_mutable_repeated_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestDuration.repeated_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>& TestDuration::repeated_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestDuration.repeated_value)
+  return _internal_repeated_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>&
+TestDuration::_internal_repeated_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Duration>*
+TestDuration::_internal_mutable_repeated_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestFieldMask
+
+// .google.protobuf.FieldMask value = 1;
+inline bool TestFieldMask::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::FieldMask& TestFieldMask::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::FieldMask* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::FieldMask&>(::google::protobuf::_FieldMask_default_instance_);
+}
+inline const ::google::protobuf::FieldMask& TestFieldMask::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestFieldMask.value)
+  return _internal_value();
+}
+inline void TestFieldMask::unsafe_arena_set_allocated_value(::google::protobuf::FieldMask* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::FieldMask*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestFieldMask.value)
+}
+inline ::google::protobuf::FieldMask* TestFieldMask::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::FieldMask* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::FieldMask* TestFieldMask::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestFieldMask.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::FieldMask* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::FieldMask* TestFieldMask::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::FieldMask>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::FieldMask*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::FieldMask* TestFieldMask::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::FieldMask* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestFieldMask.value)
+  return _msg;
+}
+inline void TestFieldMask::set_allocated_value(::google::protobuf::FieldMask* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::FieldMask*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestFieldMask.value)
+}
+
+// -------------------------------------------------------------------
+
+// TestStruct
+
+// .google.protobuf.Struct value = 1;
+inline bool TestStruct::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Struct& TestStruct::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Struct* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Struct&>(::google::protobuf::_Struct_default_instance_);
+}
+inline const ::google::protobuf::Struct& TestStruct::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestStruct.value)
+  return _internal_value();
+}
+inline void TestStruct::unsafe_arena_set_allocated_value(::google::protobuf::Struct* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Struct*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestStruct.value)
+}
+inline ::google::protobuf::Struct* TestStruct::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Struct* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Struct* TestStruct::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestStruct.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Struct* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Struct* TestStruct::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Struct>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::Struct*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::Struct* TestStruct::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Struct* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestStruct.value)
+  return _msg;
+}
+inline void TestStruct::set_allocated_value(::google::protobuf::Struct* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Struct*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestStruct.value)
+}
+
+// repeated .google.protobuf.Struct repeated_value = 2;
+inline int TestStruct::_internal_repeated_value_size() const {
+  return _internal_repeated_value().size();
+}
+inline int TestStruct::repeated_value_size() const {
+  return _internal_repeated_value_size();
+}
+inline ::google::protobuf::Struct* TestStruct::mutable_repeated_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestStruct.repeated_value)
+  return _internal_mutable_repeated_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>* TestStruct::mutable_repeated_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestStruct.repeated_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_value();
+}
+inline const ::google::protobuf::Struct& TestStruct::repeated_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestStruct.repeated_value)
+  return _internal_repeated_value().Get(index);
+}
+inline ::google::protobuf::Struct* TestStruct::add_repeated_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Struct* _add = _internal_mutable_repeated_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestStruct.repeated_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>& TestStruct::repeated_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestStruct.repeated_value)
+  return _internal_repeated_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>&
+TestStruct::_internal_repeated_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Struct>*
+TestStruct::_internal_mutable_repeated_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestAny
+
+// .google.protobuf.Any value = 1;
+inline bool TestAny::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Any& TestAny::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Any* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Any&>(::google::protobuf::_Any_default_instance_);
+}
+inline const ::google::protobuf::Any& TestAny::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestAny.value)
+  return _internal_value();
+}
+inline void TestAny::unsafe_arena_set_allocated_value(::google::protobuf::Any* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestAny.value)
+}
+inline ::google::protobuf::Any* TestAny::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Any* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Any* TestAny::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestAny.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Any* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Any* TestAny::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Any>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::Any*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::Any* TestAny::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Any* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestAny.value)
+  return _msg;
+}
+inline void TestAny::set_allocated_value(::google::protobuf::Any* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Any*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestAny.value)
+}
+
+// repeated .google.protobuf.Any repeated_value = 2;
+inline int TestAny::_internal_repeated_value_size() const {
+  return _internal_repeated_value().size();
+}
+inline int TestAny::repeated_value_size() const {
+  return _internal_repeated_value_size();
+}
+inline ::google::protobuf::Any* TestAny::mutable_repeated_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestAny.repeated_value)
+  return _internal_mutable_repeated_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>* TestAny::mutable_repeated_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestAny.repeated_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_value();
+}
+inline const ::google::protobuf::Any& TestAny::repeated_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestAny.repeated_value)
+  return _internal_repeated_value().Get(index);
+}
+inline ::google::protobuf::Any* TestAny::add_repeated_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Any* _add = _internal_mutable_repeated_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestAny.repeated_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>& TestAny::repeated_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestAny.repeated_value)
+  return _internal_repeated_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>&
+TestAny::_internal_repeated_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Any>*
+TestAny::_internal_mutable_repeated_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestValue
+
+// .google.protobuf.Value value = 1;
+inline bool TestValue::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::Value& TestValue::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::Value* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::Value&>(::google::protobuf::_Value_default_instance_);
+}
+inline const ::google::protobuf::Value& TestValue::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestValue.value)
+  return _internal_value();
+}
+inline void TestValue::unsafe_arena_set_allocated_value(::google::protobuf::Value* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Value*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestValue.value)
+}
+inline ::google::protobuf::Value* TestValue::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Value* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::Value* TestValue::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestValue.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::Value* TestValue::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::Value>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::Value*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::Value* TestValue::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::Value* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestValue.value)
+  return _msg;
+}
+inline void TestValue::set_allocated_value(::google::protobuf::Value* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::Value*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestValue.value)
+}
+
+// repeated .google.protobuf.Value repeated_value = 2;
+inline int TestValue::_internal_repeated_value_size() const {
+  return _internal_repeated_value().size();
+}
+inline int TestValue::repeated_value_size() const {
+  return _internal_repeated_value_size();
+}
+inline ::google::protobuf::Value* TestValue::mutable_repeated_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestValue.repeated_value)
+  return _internal_mutable_repeated_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Value>* TestValue::mutable_repeated_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestValue.repeated_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_value();
+}
+inline const ::google::protobuf::Value& TestValue::repeated_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestValue.repeated_value)
+  return _internal_repeated_value().Get(index);
+}
+inline ::google::protobuf::Value* TestValue::add_repeated_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::Value* _add = _internal_mutable_repeated_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestValue.repeated_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Value>& TestValue::repeated_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestValue.repeated_value)
+  return _internal_repeated_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::Value>&
+TestValue::_internal_repeated_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::Value>*
+TestValue::_internal_mutable_repeated_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestListValue
+
+// .google.protobuf.ListValue value = 1;
+inline bool TestListValue::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline const ::google::protobuf::ListValue& TestListValue::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::google::protobuf::ListValue* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::google::protobuf::ListValue&>(::google::protobuf::_ListValue_default_instance_);
+}
+inline const ::google::protobuf::ListValue& TestListValue::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestListValue.value)
+  return _internal_value();
+}
+inline void TestListValue::unsafe_arena_set_allocated_value(::google::protobuf::ListValue* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::google::protobuf::ListValue*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestListValue.value)
+}
+inline ::google::protobuf::ListValue* TestListValue::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::ListValue* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::google::protobuf::ListValue* TestListValue::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestListValue.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::google::protobuf::ListValue* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::google::protobuf::ListValue* TestListValue::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::google::protobuf::ListValue>(GetArena());
+    _impl_.value_ = reinterpret_cast<::google::protobuf::ListValue*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::google::protobuf::ListValue* TestListValue::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::ListValue* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.TestListValue.value)
+  return _msg;
+}
+inline void TestListValue::set_allocated_value(::google::protobuf::ListValue* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::google::protobuf::ListValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestListValue.value)
+}
+
+// repeated .google.protobuf.ListValue repeated_value = 2;
+inline int TestListValue::_internal_repeated_value_size() const {
+  return _internal_repeated_value().size();
+}
+inline int TestListValue::repeated_value_size() const {
+  return _internal_repeated_value_size();
+}
+inline ::google::protobuf::ListValue* TestListValue::mutable_repeated_value(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.TestListValue.repeated_value)
+  return _internal_mutable_repeated_value()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::ListValue>* TestListValue::mutable_repeated_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestListValue.repeated_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_value();
+}
+inline const ::google::protobuf::ListValue& TestListValue::repeated_value(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestListValue.repeated_value)
+  return _internal_repeated_value().Get(index);
+}
+inline ::google::protobuf::ListValue* TestListValue::add_repeated_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::google::protobuf::ListValue* _add = _internal_mutable_repeated_value()->Add();
+  // @@protoc_insertion_point(field_add:proto3.TestListValue.repeated_value)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::ListValue>& TestListValue::repeated_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestListValue.repeated_value)
+  return _internal_repeated_value();
+}
+inline const ::google::protobuf::RepeatedPtrField<::google::protobuf::ListValue>&
+TestListValue::_internal_repeated_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_value_;
+}
+inline ::google::protobuf::RepeatedPtrField<::google::protobuf::ListValue>*
+TestListValue::_internal_mutable_repeated_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_value_;
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestBoolValue
+
+// bool bool_value = 1;
+inline void TestBoolValue::clear_bool_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_value_ = false;
+}
+inline bool TestBoolValue::bool_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestBoolValue.bool_value)
+  return _internal_bool_value();
+}
+inline void TestBoolValue::set_bool_value(bool value) {
+  _internal_set_bool_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestBoolValue.bool_value)
+}
+inline bool TestBoolValue::_internal_bool_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_value_;
+}
+inline void TestBoolValue::_internal_set_bool_value(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bool_value_ = value;
+}
+
+// map<bool, int32> bool_map = 2;
+inline int TestBoolValue::_internal_bool_map_size() const {
+  return _internal_bool_map().size();
+}
+inline int TestBoolValue::bool_map_size() const {
+  return _internal_bool_map_size();
+}
+inline void TestBoolValue::clear_bool_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bool_map_.Clear();
+}
+inline const ::google::protobuf::Map<bool, ::int32_t>& TestBoolValue::_internal_bool_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bool_map_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, ::int32_t>& TestBoolValue::bool_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.TestBoolValue.bool_map)
+  return _internal_bool_map();
+}
+inline ::google::protobuf::Map<bool, ::int32_t>* TestBoolValue::_internal_mutable_bool_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.bool_map_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, ::int32_t>* TestBoolValue::mutable_bool_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.TestBoolValue.bool_map)
+  return _internal_mutable_bool_map();
+}
+
+// -------------------------------------------------------------------
+
+// TestNullValue
+
+// .google.protobuf.NullValue null_value = 20;
+inline void TestNullValue::clear_null_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.null_value_ = 0;
+}
+inline ::google::protobuf::NullValue TestNullValue::null_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestNullValue.null_value)
+  return _internal_null_value();
+}
+inline void TestNullValue::set_null_value(::google::protobuf::NullValue value) {
+  _internal_set_null_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestNullValue.null_value)
+}
+inline ::google::protobuf::NullValue TestNullValue::_internal_null_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::google::protobuf::NullValue>(_impl_.null_value_);
+}
+inline void TestNullValue::_internal_set_null_value(::google::protobuf::NullValue value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.null_value_ = value;
+}
+
+// repeated .google.protobuf.NullValue repeated_null_value = 21;
+inline int TestNullValue::_internal_repeated_null_value_size() const {
+  return _internal_repeated_null_value().size();
+}
+inline int TestNullValue::repeated_null_value_size() const {
+  return _internal_repeated_null_value_size();
+}
+inline void TestNullValue::clear_repeated_null_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.repeated_null_value_.Clear();
+}
+inline ::google::protobuf::NullValue TestNullValue::repeated_null_value(int index) const {
+  // @@protoc_insertion_point(field_get:proto3.TestNullValue.repeated_null_value)
+  return static_cast<::google::protobuf::NullValue>(_internal_repeated_null_value().Get(index));
+}
+inline void TestNullValue::set_repeated_null_value(int index, ::google::protobuf::NullValue value) {
+  _internal_mutable_repeated_null_value()->Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3.TestNullValue.repeated_null_value)
+}
+inline void TestNullValue::add_repeated_null_value(::google::protobuf::NullValue value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_repeated_null_value()->Add(value);
+  // @@protoc_insertion_point(field_add:proto3.TestNullValue.repeated_null_value)
+}
+inline const ::google::protobuf::RepeatedField<int>& TestNullValue::repeated_null_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.TestNullValue.repeated_null_value)
+  return _internal_repeated_null_value();
+}
+inline ::google::protobuf::RepeatedField<int>* TestNullValue::mutable_repeated_null_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.TestNullValue.repeated_null_value)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_repeated_null_value();
+}
+inline const ::google::protobuf::RepeatedField<int>& TestNullValue::_internal_repeated_null_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.repeated_null_value_;
+}
+inline ::google::protobuf::RepeatedField<int>* TestNullValue::_internal_mutable_repeated_null_value() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.repeated_null_value_;
+}
+
+// -------------------------------------------------------------------
+
+// TestCustomJsonName
+
+// int32 value = 1 [json_name = "@value"];
+inline void TestCustomJsonName::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_ = 0;
+}
+inline ::int32_t TestCustomJsonName::value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestCustomJsonName.value)
+  return _internal_value();
+}
+inline void TestCustomJsonName::set_value(::int32_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestCustomJsonName.value)
+}
+inline ::int32_t TestCustomJsonName::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.value_;
+}
+inline void TestCustomJsonName::_internal_set_value(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.value_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestEvilJson
+
+// int32 regular_value = 1 [json_name = "regular_name"];
+inline void TestEvilJson::clear_regular_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.regular_value_ = 0;
+}
+inline ::int32_t TestEvilJson::regular_value() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEvilJson.regular_value)
+  return _internal_regular_value();
+}
+inline void TestEvilJson::set_regular_value(::int32_t value) {
+  _internal_set_regular_value(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEvilJson.regular_value)
+}
+inline ::int32_t TestEvilJson::_internal_regular_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.regular_value_;
+}
+inline void TestEvilJson::_internal_set_regular_value(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.regular_value_ = value;
+}
+
+// int32 script = 2 [json_name = "</script>"];
+inline void TestEvilJson::clear_script() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.script_ = 0;
+}
+inline ::int32_t TestEvilJson::script() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEvilJson.script)
+  return _internal_script();
+}
+inline void TestEvilJson::set_script(::int32_t value) {
+  _internal_set_script(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEvilJson.script)
+}
+inline ::int32_t TestEvilJson::_internal_script() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.script_;
+}
+inline void TestEvilJson::_internal_set_script(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.script_ = value;
+}
+
+// int32 quotes = 3 [json_name = "unbalanced\"quotes"];
+inline void TestEvilJson::clear_quotes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.quotes_ = 0;
+}
+inline ::int32_t TestEvilJson::quotes() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEvilJson.quotes)
+  return _internal_quotes();
+}
+inline void TestEvilJson::set_quotes(::int32_t value) {
+  _internal_set_quotes(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEvilJson.quotes)
+}
+inline ::int32_t TestEvilJson::_internal_quotes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.quotes_;
+}
+inline void TestEvilJson::_internal_set_quotes(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.quotes_ = value;
+}
+
+// int32 script_and_quotes = 4 [json_name = "\"<script>alert(\'hello!);</script>"];
+inline void TestEvilJson::clear_script_and_quotes() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.script_and_quotes_ = 0;
+}
+inline ::int32_t TestEvilJson::script_and_quotes() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEvilJson.script_and_quotes)
+  return _internal_script_and_quotes();
+}
+inline void TestEvilJson::set_script_and_quotes(::int32_t value) {
+  _internal_set_script_and_quotes(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEvilJson.script_and_quotes)
+}
+inline ::int32_t TestEvilJson::_internal_script_and_quotes() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.script_and_quotes_;
+}
+inline void TestEvilJson::_internal_set_script_and_quotes(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.script_and_quotes_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestExtensions
+
+// .protobuf_unittest.TestAllExtensions extensions = 1;
+inline bool TestExtensions::has_extensions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.extensions_ != nullptr);
+  return value;
+}
+inline const ::protobuf_unittest::TestAllExtensions& TestExtensions::_internal_extensions() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::protobuf_unittest::TestAllExtensions* p = _impl_.extensions_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protobuf_unittest::TestAllExtensions&>(::protobuf_unittest::_TestAllExtensions_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllExtensions& TestExtensions::extensions() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.TestExtensions.extensions)
+  return _internal_extensions();
+}
+inline void TestExtensions::unsafe_arena_set_allocated_extensions(::protobuf_unittest::TestAllExtensions* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.extensions_);
+  }
+  _impl_.extensions_ = reinterpret_cast<::protobuf_unittest::TestAllExtensions*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.TestExtensions.extensions)
+}
+inline ::protobuf_unittest::TestAllExtensions* TestExtensions::release_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllExtensions* released = _impl_.extensions_;
+  _impl_.extensions_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::protobuf_unittest::TestAllExtensions* TestExtensions::unsafe_arena_release_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.TestExtensions.extensions)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllExtensions* temp = _impl_.extensions_;
+  _impl_.extensions_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllExtensions* TestExtensions::_internal_mutable_extensions() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.extensions_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllExtensions>(GetArena());
+    _impl_.extensions_ = reinterpret_cast<::protobuf_unittest::TestAllExtensions*>(p);
+  }
+  return _impl_.extensions_;
+}
+inline ::protobuf_unittest::TestAllExtensions* TestExtensions::mutable_extensions() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::protobuf_unittest::TestAllExtensions* _msg = _internal_mutable_extensions();
+  // @@protoc_insertion_point(field_mutable:proto3.TestExtensions.extensions)
+  return _msg;
+}
+inline void TestExtensions::set_allocated_extensions(::protobuf_unittest::TestAllExtensions* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.extensions_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::google::protobuf::MessageLite*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.extensions_ = reinterpret_cast<::protobuf_unittest::TestAllExtensions*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestExtensions.extensions)
+}
+
+// -------------------------------------------------------------------
+
+// TestEnumValue
+
+// .proto3.EnumType enum_value1 = 1;
+inline void TestEnumValue::clear_enum_value1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.enum_value1_ = 0;
+}
+inline ::proto3::EnumType TestEnumValue::enum_value1() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEnumValue.enum_value1)
+  return _internal_enum_value1();
+}
+inline void TestEnumValue::set_enum_value1(::proto3::EnumType value) {
+  _internal_set_enum_value1(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEnumValue.enum_value1)
+}
+inline ::proto3::EnumType TestEnumValue::_internal_enum_value1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3::EnumType>(_impl_.enum_value1_);
+}
+inline void TestEnumValue::_internal_set_enum_value1(::proto3::EnumType value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.enum_value1_ = value;
+}
+
+// .proto3.EnumType enum_value2 = 2;
+inline void TestEnumValue::clear_enum_value2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.enum_value2_ = 0;
+}
+inline ::proto3::EnumType TestEnumValue::enum_value2() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEnumValue.enum_value2)
+  return _internal_enum_value2();
+}
+inline void TestEnumValue::set_enum_value2(::proto3::EnumType value) {
+  _internal_set_enum_value2(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEnumValue.enum_value2)
+}
+inline ::proto3::EnumType TestEnumValue::_internal_enum_value2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3::EnumType>(_impl_.enum_value2_);
+}
+inline void TestEnumValue::_internal_set_enum_value2(::proto3::EnumType value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.enum_value2_ = value;
+}
+
+// .proto3.EnumType enum_value3 = 3;
+inline void TestEnumValue::clear_enum_value3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.enum_value3_ = 0;
+}
+inline ::proto3::EnumType TestEnumValue::enum_value3() const {
+  // @@protoc_insertion_point(field_get:proto3.TestEnumValue.enum_value3)
+  return _internal_enum_value3();
+}
+inline void TestEnumValue::set_enum_value3(::proto3::EnumType value) {
+  _internal_set_enum_value3(value);
+  // @@protoc_insertion_point(field_set:proto3.TestEnumValue.enum_value3)
+}
+inline ::proto3::EnumType TestEnumValue::_internal_enum_value3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3::EnumType>(_impl_.enum_value3_);
+}
+inline void TestEnumValue::_internal_set_enum_value3(::proto3::EnumType value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.enum_value3_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// MapsTestCases
+
+// .proto3.EmptyMap empty_map = 1;
+inline bool MapsTestCases::has_empty_map() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_map_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_map_ != nullptr) _impl_.empty_map_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto3::EmptyMap& MapsTestCases::_internal_empty_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::EmptyMap* p = _impl_.empty_map_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::EmptyMap&>(::proto3::_EmptyMap_default_instance_);
+}
+inline const ::proto3::EmptyMap& MapsTestCases::empty_map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_map)
+  return _internal_empty_map();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_map(::proto3::EmptyMap* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_map_);
+  }
+  _impl_.empty_map_ = reinterpret_cast<::proto3::EmptyMap*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_map)
+}
+inline ::proto3::EmptyMap* MapsTestCases::release_empty_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::EmptyMap* released = _impl_.empty_map_;
+  _impl_.empty_map_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::EmptyMap* MapsTestCases::unsafe_arena_release_empty_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_map)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::EmptyMap* temp = _impl_.empty_map_;
+  _impl_.empty_map_ = nullptr;
+  return temp;
+}
+inline ::proto3::EmptyMap* MapsTestCases::_internal_mutable_empty_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.empty_map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::EmptyMap>(GetArena());
+    _impl_.empty_map_ = reinterpret_cast<::proto3::EmptyMap*>(p);
+  }
+  return _impl_.empty_map_;
+}
+inline ::proto3::EmptyMap* MapsTestCases::mutable_empty_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::EmptyMap* _msg = _internal_mutable_empty_map();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_map)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_map(::proto3::EmptyMap* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::EmptyMap*>(_impl_.empty_map_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::EmptyMap*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.empty_map_ = reinterpret_cast<::proto3::EmptyMap*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_map)
+}
+
+// .proto3.StringtoInt string_to_int = 2;
+inline bool MapsTestCases::has_string_to_int() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.string_to_int_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_string_to_int() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.string_to_int_ != nullptr) _impl_.string_to_int_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto3::StringtoInt& MapsTestCases::_internal_string_to_int() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::StringtoInt* p = _impl_.string_to_int_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::StringtoInt&>(::proto3::_StringtoInt_default_instance_);
+}
+inline const ::proto3::StringtoInt& MapsTestCases::string_to_int() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.string_to_int)
+  return _internal_string_to_int();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_string_to_int(::proto3::StringtoInt* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.string_to_int_);
+  }
+  _impl_.string_to_int_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.string_to_int)
+}
+inline ::proto3::StringtoInt* MapsTestCases::release_string_to_int() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto3::StringtoInt* released = _impl_.string_to_int_;
+  _impl_.string_to_int_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::StringtoInt* MapsTestCases::unsafe_arena_release_string_to_int() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.string_to_int)
+
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto3::StringtoInt* temp = _impl_.string_to_int_;
+  _impl_.string_to_int_ = nullptr;
+  return temp;
+}
+inline ::proto3::StringtoInt* MapsTestCases::_internal_mutable_string_to_int() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.string_to_int_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::StringtoInt>(GetArena());
+    _impl_.string_to_int_ = reinterpret_cast<::proto3::StringtoInt*>(p);
+  }
+  return _impl_.string_to_int_;
+}
+inline ::proto3::StringtoInt* MapsTestCases::mutable_string_to_int() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::StringtoInt* _msg = _internal_mutable_string_to_int();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.string_to_int)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_string_to_int(::proto3::StringtoInt* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::StringtoInt*>(_impl_.string_to_int_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::StringtoInt*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+
+  _impl_.string_to_int_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.string_to_int)
+}
+
+// .proto3.IntToString int_to_string = 3;
+inline bool MapsTestCases::has_int_to_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.int_to_string_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.int_to_string_ != nullptr) _impl_.int_to_string_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::proto3::IntToString& MapsTestCases::_internal_int_to_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::IntToString* p = _impl_.int_to_string_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::IntToString&>(::proto3::_IntToString_default_instance_);
+}
+inline const ::proto3::IntToString& MapsTestCases::int_to_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.int_to_string)
+  return _internal_int_to_string();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_int_to_string(::proto3::IntToString* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.int_to_string_);
+  }
+  _impl_.int_to_string_ = reinterpret_cast<::proto3::IntToString*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.int_to_string)
+}
+inline ::proto3::IntToString* MapsTestCases::release_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::proto3::IntToString* released = _impl_.int_to_string_;
+  _impl_.int_to_string_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::IntToString* MapsTestCases::unsafe_arena_release_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.int_to_string)
+
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::proto3::IntToString* temp = _impl_.int_to_string_;
+  _impl_.int_to_string_ = nullptr;
+  return temp;
+}
+inline ::proto3::IntToString* MapsTestCases::_internal_mutable_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.int_to_string_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::IntToString>(GetArena());
+    _impl_.int_to_string_ = reinterpret_cast<::proto3::IntToString*>(p);
+  }
+  return _impl_.int_to_string_;
+}
+inline ::proto3::IntToString* MapsTestCases::mutable_int_to_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::IntToString* _msg = _internal_mutable_int_to_string();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.int_to_string)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_int_to_string(::proto3::IntToString* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::IntToString*>(_impl_.int_to_string_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::IntToString*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+
+  _impl_.int_to_string_ = reinterpret_cast<::proto3::IntToString*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.int_to_string)
+}
+
+// .proto3.Mixed1 mixed1 = 4;
+inline bool MapsTestCases::has_mixed1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mixed1_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_mixed1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.mixed1_ != nullptr) _impl_.mixed1_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::proto3::Mixed1& MapsTestCases::_internal_mixed1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::Mixed1* p = _impl_.mixed1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::Mixed1&>(::proto3::_Mixed1_default_instance_);
+}
+inline const ::proto3::Mixed1& MapsTestCases::mixed1() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.mixed1)
+  return _internal_mixed1();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_mixed1(::proto3::Mixed1* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.mixed1_);
+  }
+  _impl_.mixed1_ = reinterpret_cast<::proto3::Mixed1*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.mixed1)
+}
+inline ::proto3::Mixed1* MapsTestCases::release_mixed1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::proto3::Mixed1* released = _impl_.mixed1_;
+  _impl_.mixed1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::Mixed1* MapsTestCases::unsafe_arena_release_mixed1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.mixed1)
+
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::proto3::Mixed1* temp = _impl_.mixed1_;
+  _impl_.mixed1_ = nullptr;
+  return temp;
+}
+inline ::proto3::Mixed1* MapsTestCases::_internal_mutable_mixed1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.mixed1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::Mixed1>(GetArena());
+    _impl_.mixed1_ = reinterpret_cast<::proto3::Mixed1*>(p);
+  }
+  return _impl_.mixed1_;
+}
+inline ::proto3::Mixed1* MapsTestCases::mutable_mixed1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::Mixed1* _msg = _internal_mutable_mixed1();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.mixed1)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_mixed1(::proto3::Mixed1* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::Mixed1*>(_impl_.mixed1_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::Mixed1*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+
+  _impl_.mixed1_ = reinterpret_cast<::proto3::Mixed1*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.mixed1)
+}
+
+// .proto3.Mixed2 mixed2 = 5;
+inline bool MapsTestCases::has_mixed2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mixed2_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_mixed2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.mixed2_ != nullptr) _impl_.mixed2_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::proto3::Mixed2& MapsTestCases::_internal_mixed2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::Mixed2* p = _impl_.mixed2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::Mixed2&>(::proto3::_Mixed2_default_instance_);
+}
+inline const ::proto3::Mixed2& MapsTestCases::mixed2() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.mixed2)
+  return _internal_mixed2();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_mixed2(::proto3::Mixed2* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.mixed2_);
+  }
+  _impl_.mixed2_ = reinterpret_cast<::proto3::Mixed2*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.mixed2)
+}
+inline ::proto3::Mixed2* MapsTestCases::release_mixed2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::proto3::Mixed2* released = _impl_.mixed2_;
+  _impl_.mixed2_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::Mixed2* MapsTestCases::unsafe_arena_release_mixed2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.mixed2)
+
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::proto3::Mixed2* temp = _impl_.mixed2_;
+  _impl_.mixed2_ = nullptr;
+  return temp;
+}
+inline ::proto3::Mixed2* MapsTestCases::_internal_mutable_mixed2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.mixed2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::Mixed2>(GetArena());
+    _impl_.mixed2_ = reinterpret_cast<::proto3::Mixed2*>(p);
+  }
+  return _impl_.mixed2_;
+}
+inline ::proto3::Mixed2* MapsTestCases::mutable_mixed2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::Mixed2* _msg = _internal_mutable_mixed2();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.mixed2)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_mixed2(::proto3::Mixed2* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::Mixed2*>(_impl_.mixed2_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::Mixed2*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+
+  _impl_.mixed2_ = reinterpret_cast<::proto3::Mixed2*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.mixed2)
+}
+
+// .proto3.MapOfObjects map_of_objects = 6;
+inline bool MapsTestCases::has_map_of_objects() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.map_of_objects_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_map_of_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.map_of_objects_ != nullptr) _impl_.map_of_objects_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::proto3::MapOfObjects& MapsTestCases::_internal_map_of_objects() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::MapOfObjects* p = _impl_.map_of_objects_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::MapOfObjects&>(::proto3::_MapOfObjects_default_instance_);
+}
+inline const ::proto3::MapOfObjects& MapsTestCases::map_of_objects() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.map_of_objects)
+  return _internal_map_of_objects();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_map_of_objects(::proto3::MapOfObjects* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.map_of_objects_);
+  }
+  _impl_.map_of_objects_ = reinterpret_cast<::proto3::MapOfObjects*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.map_of_objects)
+}
+inline ::proto3::MapOfObjects* MapsTestCases::release_map_of_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::proto3::MapOfObjects* released = _impl_.map_of_objects_;
+  _impl_.map_of_objects_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::MapOfObjects* MapsTestCases::unsafe_arena_release_map_of_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.map_of_objects)
+
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::proto3::MapOfObjects* temp = _impl_.map_of_objects_;
+  _impl_.map_of_objects_ = nullptr;
+  return temp;
+}
+inline ::proto3::MapOfObjects* MapsTestCases::_internal_mutable_map_of_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.map_of_objects_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::MapOfObjects>(GetArena());
+    _impl_.map_of_objects_ = reinterpret_cast<::proto3::MapOfObjects*>(p);
+  }
+  return _impl_.map_of_objects_;
+}
+inline ::proto3::MapOfObjects* MapsTestCases::mutable_map_of_objects() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::MapOfObjects* _msg = _internal_mutable_map_of_objects();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.map_of_objects)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_map_of_objects(::proto3::MapOfObjects* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::MapOfObjects*>(_impl_.map_of_objects_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::MapOfObjects*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+
+  _impl_.map_of_objects_ = reinterpret_cast<::proto3::MapOfObjects*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.map_of_objects)
+}
+
+// .proto3.StringtoInt empty_key_string_to_int1 = 7;
+inline bool MapsTestCases::has_empty_key_string_to_int1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_string_to_int1_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_string_to_int1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_string_to_int1_ != nullptr) _impl_.empty_key_string_to_int1_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::proto3::StringtoInt& MapsTestCases::_internal_empty_key_string_to_int1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::StringtoInt* p = _impl_.empty_key_string_to_int1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::StringtoInt&>(::proto3::_StringtoInt_default_instance_);
+}
+inline const ::proto3::StringtoInt& MapsTestCases::empty_key_string_to_int1() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_string_to_int1)
+  return _internal_empty_key_string_to_int1();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_string_to_int1(::proto3::StringtoInt* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_string_to_int1_);
+  }
+  _impl_.empty_key_string_to_int1_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_string_to_int1)
+}
+inline ::proto3::StringtoInt* MapsTestCases::release_empty_key_string_to_int1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::proto3::StringtoInt* released = _impl_.empty_key_string_to_int1_;
+  _impl_.empty_key_string_to_int1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::StringtoInt* MapsTestCases::unsafe_arena_release_empty_key_string_to_int1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_string_to_int1)
+
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::proto3::StringtoInt* temp = _impl_.empty_key_string_to_int1_;
+  _impl_.empty_key_string_to_int1_ = nullptr;
+  return temp;
+}
+inline ::proto3::StringtoInt* MapsTestCases::_internal_mutable_empty_key_string_to_int1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.empty_key_string_to_int1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::StringtoInt>(GetArena());
+    _impl_.empty_key_string_to_int1_ = reinterpret_cast<::proto3::StringtoInt*>(p);
+  }
+  return _impl_.empty_key_string_to_int1_;
+}
+inline ::proto3::StringtoInt* MapsTestCases::mutable_empty_key_string_to_int1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::StringtoInt* _msg = _internal_mutable_empty_key_string_to_int1();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_string_to_int1)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_string_to_int1(::proto3::StringtoInt* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::StringtoInt*>(_impl_.empty_key_string_to_int1_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::StringtoInt*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+
+  _impl_.empty_key_string_to_int1_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_string_to_int1)
+}
+
+// .proto3.StringtoInt empty_key_string_to_int2 = 8;
+inline bool MapsTestCases::has_empty_key_string_to_int2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_string_to_int2_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_string_to_int2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_string_to_int2_ != nullptr) _impl_.empty_key_string_to_int2_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::proto3::StringtoInt& MapsTestCases::_internal_empty_key_string_to_int2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::StringtoInt* p = _impl_.empty_key_string_to_int2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::StringtoInt&>(::proto3::_StringtoInt_default_instance_);
+}
+inline const ::proto3::StringtoInt& MapsTestCases::empty_key_string_to_int2() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_string_to_int2)
+  return _internal_empty_key_string_to_int2();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_string_to_int2(::proto3::StringtoInt* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_string_to_int2_);
+  }
+  _impl_.empty_key_string_to_int2_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_string_to_int2)
+}
+inline ::proto3::StringtoInt* MapsTestCases::release_empty_key_string_to_int2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::proto3::StringtoInt* released = _impl_.empty_key_string_to_int2_;
+  _impl_.empty_key_string_to_int2_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::StringtoInt* MapsTestCases::unsafe_arena_release_empty_key_string_to_int2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_string_to_int2)
+
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::proto3::StringtoInt* temp = _impl_.empty_key_string_to_int2_;
+  _impl_.empty_key_string_to_int2_ = nullptr;
+  return temp;
+}
+inline ::proto3::StringtoInt* MapsTestCases::_internal_mutable_empty_key_string_to_int2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.empty_key_string_to_int2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::StringtoInt>(GetArena());
+    _impl_.empty_key_string_to_int2_ = reinterpret_cast<::proto3::StringtoInt*>(p);
+  }
+  return _impl_.empty_key_string_to_int2_;
+}
+inline ::proto3::StringtoInt* MapsTestCases::mutable_empty_key_string_to_int2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::StringtoInt* _msg = _internal_mutable_empty_key_string_to_int2();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_string_to_int2)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_string_to_int2(::proto3::StringtoInt* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::StringtoInt*>(_impl_.empty_key_string_to_int2_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::StringtoInt*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+
+  _impl_.empty_key_string_to_int2_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_string_to_int2)
+}
+
+// .proto3.StringtoInt empty_key_string_to_int3 = 9;
+inline bool MapsTestCases::has_empty_key_string_to_int3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_string_to_int3_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_string_to_int3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_string_to_int3_ != nullptr) _impl_.empty_key_string_to_int3_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::proto3::StringtoInt& MapsTestCases::_internal_empty_key_string_to_int3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::StringtoInt* p = _impl_.empty_key_string_to_int3_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::StringtoInt&>(::proto3::_StringtoInt_default_instance_);
+}
+inline const ::proto3::StringtoInt& MapsTestCases::empty_key_string_to_int3() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_string_to_int3)
+  return _internal_empty_key_string_to_int3();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_string_to_int3(::proto3::StringtoInt* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_string_to_int3_);
+  }
+  _impl_.empty_key_string_to_int3_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_string_to_int3)
+}
+inline ::proto3::StringtoInt* MapsTestCases::release_empty_key_string_to_int3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::proto3::StringtoInt* released = _impl_.empty_key_string_to_int3_;
+  _impl_.empty_key_string_to_int3_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::StringtoInt* MapsTestCases::unsafe_arena_release_empty_key_string_to_int3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_string_to_int3)
+
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::proto3::StringtoInt* temp = _impl_.empty_key_string_to_int3_;
+  _impl_.empty_key_string_to_int3_ = nullptr;
+  return temp;
+}
+inline ::proto3::StringtoInt* MapsTestCases::_internal_mutable_empty_key_string_to_int3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.empty_key_string_to_int3_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::StringtoInt>(GetArena());
+    _impl_.empty_key_string_to_int3_ = reinterpret_cast<::proto3::StringtoInt*>(p);
+  }
+  return _impl_.empty_key_string_to_int3_;
+}
+inline ::proto3::StringtoInt* MapsTestCases::mutable_empty_key_string_to_int3() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::StringtoInt* _msg = _internal_mutable_empty_key_string_to_int3();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_string_to_int3)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_string_to_int3(::proto3::StringtoInt* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::StringtoInt*>(_impl_.empty_key_string_to_int3_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::StringtoInt*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+
+  _impl_.empty_key_string_to_int3_ = reinterpret_cast<::proto3::StringtoInt*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_string_to_int3)
+}
+
+// .proto3.BoolToString empty_key_bool_to_string = 10;
+inline bool MapsTestCases::has_empty_key_bool_to_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_bool_to_string_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_bool_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_bool_to_string_ != nullptr) _impl_.empty_key_bool_to_string_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::proto3::BoolToString& MapsTestCases::_internal_empty_key_bool_to_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::BoolToString* p = _impl_.empty_key_bool_to_string_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::BoolToString&>(::proto3::_BoolToString_default_instance_);
+}
+inline const ::proto3::BoolToString& MapsTestCases::empty_key_bool_to_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_bool_to_string)
+  return _internal_empty_key_bool_to_string();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_bool_to_string(::proto3::BoolToString* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_bool_to_string_);
+  }
+  _impl_.empty_key_bool_to_string_ = reinterpret_cast<::proto3::BoolToString*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_bool_to_string)
+}
+inline ::proto3::BoolToString* MapsTestCases::release_empty_key_bool_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::proto3::BoolToString* released = _impl_.empty_key_bool_to_string_;
+  _impl_.empty_key_bool_to_string_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::BoolToString* MapsTestCases::unsafe_arena_release_empty_key_bool_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_bool_to_string)
+
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::proto3::BoolToString* temp = _impl_.empty_key_bool_to_string_;
+  _impl_.empty_key_bool_to_string_ = nullptr;
+  return temp;
+}
+inline ::proto3::BoolToString* MapsTestCases::_internal_mutable_empty_key_bool_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.empty_key_bool_to_string_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::BoolToString>(GetArena());
+    _impl_.empty_key_bool_to_string_ = reinterpret_cast<::proto3::BoolToString*>(p);
+  }
+  return _impl_.empty_key_bool_to_string_;
+}
+inline ::proto3::BoolToString* MapsTestCases::mutable_empty_key_bool_to_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::BoolToString* _msg = _internal_mutable_empty_key_bool_to_string();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_bool_to_string)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_bool_to_string(::proto3::BoolToString* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::BoolToString*>(_impl_.empty_key_bool_to_string_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::BoolToString*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+
+  _impl_.empty_key_bool_to_string_ = reinterpret_cast<::proto3::BoolToString*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_bool_to_string)
+}
+
+// .proto3.IntToString empty_key_int_to_string = 11;
+inline bool MapsTestCases::has_empty_key_int_to_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_int_to_string_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_int_to_string_ != nullptr) _impl_.empty_key_int_to_string_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline const ::proto3::IntToString& MapsTestCases::_internal_empty_key_int_to_string() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::IntToString* p = _impl_.empty_key_int_to_string_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::IntToString&>(::proto3::_IntToString_default_instance_);
+}
+inline const ::proto3::IntToString& MapsTestCases::empty_key_int_to_string() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_int_to_string)
+  return _internal_empty_key_int_to_string();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_int_to_string(::proto3::IntToString* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_int_to_string_);
+  }
+  _impl_.empty_key_int_to_string_ = reinterpret_cast<::proto3::IntToString*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_int_to_string)
+}
+inline ::proto3::IntToString* MapsTestCases::release_empty_key_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::proto3::IntToString* released = _impl_.empty_key_int_to_string_;
+  _impl_.empty_key_int_to_string_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::IntToString* MapsTestCases::unsafe_arena_release_empty_key_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_int_to_string)
+
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::proto3::IntToString* temp = _impl_.empty_key_int_to_string_;
+  _impl_.empty_key_int_to_string_ = nullptr;
+  return temp;
+}
+inline ::proto3::IntToString* MapsTestCases::_internal_mutable_empty_key_int_to_string() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.empty_key_int_to_string_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::IntToString>(GetArena());
+    _impl_.empty_key_int_to_string_ = reinterpret_cast<::proto3::IntToString*>(p);
+  }
+  return _impl_.empty_key_int_to_string_;
+}
+inline ::proto3::IntToString* MapsTestCases::mutable_empty_key_int_to_string() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::IntToString* _msg = _internal_mutable_empty_key_int_to_string();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_int_to_string)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_int_to_string(::proto3::IntToString* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::IntToString*>(_impl_.empty_key_int_to_string_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::IntToString*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+
+  _impl_.empty_key_int_to_string_ = reinterpret_cast<::proto3::IntToString*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_int_to_string)
+}
+
+// .proto3.Mixed1 empty_key_mixed = 12;
+inline bool MapsTestCases::has_empty_key_mixed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_mixed_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_mixed() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_mixed_ != nullptr) _impl_.empty_key_mixed_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline const ::proto3::Mixed1& MapsTestCases::_internal_empty_key_mixed() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::Mixed1* p = _impl_.empty_key_mixed_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::Mixed1&>(::proto3::_Mixed1_default_instance_);
+}
+inline const ::proto3::Mixed1& MapsTestCases::empty_key_mixed() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_mixed)
+  return _internal_empty_key_mixed();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_mixed(::proto3::Mixed1* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_mixed_);
+  }
+  _impl_.empty_key_mixed_ = reinterpret_cast<::proto3::Mixed1*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_mixed)
+}
+inline ::proto3::Mixed1* MapsTestCases::release_empty_key_mixed() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::proto3::Mixed1* released = _impl_.empty_key_mixed_;
+  _impl_.empty_key_mixed_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::Mixed1* MapsTestCases::unsafe_arena_release_empty_key_mixed() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_mixed)
+
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::proto3::Mixed1* temp = _impl_.empty_key_mixed_;
+  _impl_.empty_key_mixed_ = nullptr;
+  return temp;
+}
+inline ::proto3::Mixed1* MapsTestCases::_internal_mutable_empty_key_mixed() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.empty_key_mixed_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::Mixed1>(GetArena());
+    _impl_.empty_key_mixed_ = reinterpret_cast<::proto3::Mixed1*>(p);
+  }
+  return _impl_.empty_key_mixed_;
+}
+inline ::proto3::Mixed1* MapsTestCases::mutable_empty_key_mixed() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::Mixed1* _msg = _internal_mutable_empty_key_mixed();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_mixed)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_mixed(::proto3::Mixed1* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::Mixed1*>(_impl_.empty_key_mixed_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::Mixed1*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+
+  _impl_.empty_key_mixed_ = reinterpret_cast<::proto3::Mixed1*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_mixed)
+}
+
+// .proto3.MapOfObjects empty_key_map_objects = 13;
+inline bool MapsTestCases::has_empty_key_map_objects() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.empty_key_map_objects_ != nullptr);
+  return value;
+}
+inline void MapsTestCases::clear_empty_key_map_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.empty_key_map_objects_ != nullptr) _impl_.empty_key_map_objects_->Clear();
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline const ::proto3::MapOfObjects& MapsTestCases::_internal_empty_key_map_objects() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::MapOfObjects* p = _impl_.empty_key_map_objects_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::MapOfObjects&>(::proto3::_MapOfObjects_default_instance_);
+}
+inline const ::proto3::MapOfObjects& MapsTestCases::empty_key_map_objects() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapsTestCases.empty_key_map_objects)
+  return _internal_empty_key_map_objects();
+}
+inline void MapsTestCases::unsafe_arena_set_allocated_empty_key_map_objects(::proto3::MapOfObjects* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.empty_key_map_objects_);
+  }
+  _impl_.empty_key_map_objects_ = reinterpret_cast<::proto3::MapOfObjects*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapsTestCases.empty_key_map_objects)
+}
+inline ::proto3::MapOfObjects* MapsTestCases::release_empty_key_map_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::proto3::MapOfObjects* released = _impl_.empty_key_map_objects_;
+  _impl_.empty_key_map_objects_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::MapOfObjects* MapsTestCases::unsafe_arena_release_empty_key_map_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapsTestCases.empty_key_map_objects)
+
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::proto3::MapOfObjects* temp = _impl_.empty_key_map_objects_;
+  _impl_.empty_key_map_objects_ = nullptr;
+  return temp;
+}
+inline ::proto3::MapOfObjects* MapsTestCases::_internal_mutable_empty_key_map_objects() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00001000u;
+  if (_impl_.empty_key_map_objects_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::MapOfObjects>(GetArena());
+    _impl_.empty_key_map_objects_ = reinterpret_cast<::proto3::MapOfObjects*>(p);
+  }
+  return _impl_.empty_key_map_objects_;
+}
+inline ::proto3::MapOfObjects* MapsTestCases::mutable_empty_key_map_objects() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::MapOfObjects* _msg = _internal_mutable_empty_key_map_objects();
+  // @@protoc_insertion_point(field_mutable:proto3.MapsTestCases.empty_key_map_objects)
+  return _msg;
+}
+inline void MapsTestCases::set_allocated_empty_key_map_objects(::proto3::MapOfObjects* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::MapOfObjects*>(_impl_.empty_key_map_objects_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::MapOfObjects*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+
+  _impl_.empty_key_map_objects_ = reinterpret_cast<::proto3::MapOfObjects*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapsTestCases.empty_key_map_objects)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// EmptyMap
+
+// map<int32, int32> map = 1;
+inline int EmptyMap::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int EmptyMap::map_size() const {
+  return _internal_map_size();
+}
+inline void EmptyMap::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& EmptyMap::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, ::int32_t>& EmptyMap::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.EmptyMap.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* EmptyMap::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, ::int32_t>* EmptyMap::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.EmptyMap.map)
+  return _internal_mutable_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// StringtoInt
+
+// map<string, int32> map = 1;
+inline int StringtoInt::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int StringtoInt::map_size() const {
+  return _internal_map_size();
+}
+inline void StringtoInt::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::int32_t>& StringtoInt::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::int32_t>& StringtoInt::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.StringtoInt.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<std::string, ::int32_t>* StringtoInt::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::int32_t>* StringtoInt::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.StringtoInt.map)
+  return _internal_mutable_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// IntToString
+
+// map<int32, string> map = 1;
+inline int IntToString::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int IntToString::map_size() const {
+  return _internal_map_size();
+}
+inline void IntToString::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& IntToString::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& IntToString::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.IntToString.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* IntToString::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* IntToString::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.IntToString.map)
+  return _internal_mutable_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// BoolToString
+
+// map<bool, string> map = 1;
+inline int BoolToString::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int BoolToString::map_size() const {
+  return _internal_map_size();
+}
+inline void BoolToString::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<bool, std::string>& BoolToString::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, std::string>& BoolToString::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.BoolToString.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<bool, std::string>* BoolToString::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, std::string>* BoolToString::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.BoolToString.map)
+  return _internal_mutable_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Mixed1
+
+// string msg = 1;
+inline void Mixed1::clear_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.msg_.ClearToEmpty();
+}
+inline const std::string& Mixed1::msg() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.Mixed1.msg)
+  return _internal_msg();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void Mixed1::set_msg(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.msg_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.Mixed1.msg)
+}
+inline std::string* Mixed1::mutable_msg() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:proto3.Mixed1.msg)
+  return _s;
+}
+inline const std::string& Mixed1::_internal_msg() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.msg_.Get();
+}
+inline void Mixed1::_internal_set_msg(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.msg_.Set(value, GetArena());
+}
+inline std::string* Mixed1::_internal_mutable_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.msg_.Mutable( GetArena());
+}
+inline std::string* Mixed1::release_msg() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.Mixed1.msg)
+  return _impl_.msg_.Release();
+}
+inline void Mixed1::set_allocated_msg(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.msg_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.msg_.IsDefault()) {
+          _impl_.msg_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.Mixed1.msg)
+}
+
+// map<string, float> map = 2;
+inline int Mixed1::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int Mixed1::map_size() const {
+  return _internal_map_size();
+}
+inline void Mixed1::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, float>& Mixed1::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, float>& Mixed1::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.Mixed1.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<std::string, float>* Mixed1::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, float>* Mixed1::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.Mixed1.map)
+  return _internal_mutable_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Mixed2
+
+// map<int32, bool> map = 1;
+inline int Mixed2::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int Mixed2::map_size() const {
+  return _internal_map_size();
+}
+inline void Mixed2::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, bool>& Mixed2::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, bool>& Mixed2::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.Mixed2.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<::int32_t, bool>* Mixed2::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, bool>* Mixed2::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.Mixed2.map)
+  return _internal_mutable_map();
+}
+
+// .proto3.Mixed2.E ee = 2;
+inline void Mixed2::clear_ee() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.ee_ = 0;
+}
+inline ::proto3::Mixed2_E Mixed2::ee() const {
+  // @@protoc_insertion_point(field_get:proto3.Mixed2.ee)
+  return _internal_ee();
+}
+inline void Mixed2::set_ee(::proto3::Mixed2_E value) {
+  _internal_set_ee(value);
+  // @@protoc_insertion_point(field_set:proto3.Mixed2.ee)
+}
+inline ::proto3::Mixed2_E Mixed2::_internal_ee() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::proto3::Mixed2_E>(_impl_.ee_);
+}
+inline void Mixed2::_internal_set_ee(::proto3::Mixed2_E value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.ee_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// MapOfObjects_M
+
+// string inner_text = 1;
+inline void MapOfObjects_M::clear_inner_text() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.inner_text_.ClearToEmpty();
+}
+inline const std::string& MapOfObjects_M::inner_text() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOfObjects.M.inner_text)
+  return _internal_inner_text();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOfObjects_M::set_inner_text(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.inner_text_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOfObjects.M.inner_text)
+}
+inline std::string* MapOfObjects_M::mutable_inner_text() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_inner_text();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOfObjects.M.inner_text)
+  return _s;
+}
+inline const std::string& MapOfObjects_M::_internal_inner_text() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.inner_text_.Get();
+}
+inline void MapOfObjects_M::_internal_set_inner_text(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.inner_text_.Set(value, GetArena());
+}
+inline std::string* MapOfObjects_M::_internal_mutable_inner_text() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.inner_text_.Mutable( GetArena());
+}
+inline std::string* MapOfObjects_M::release_inner_text() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOfObjects.M.inner_text)
+  return _impl_.inner_text_.Release();
+}
+inline void MapOfObjects_M::set_allocated_inner_text(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.inner_text_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.inner_text_.IsDefault()) {
+          _impl_.inner_text_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOfObjects.M.inner_text)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapOfObjects
+
+// map<string, .proto3.MapOfObjects.M> map = 1;
+inline int MapOfObjects::_internal_map_size() const {
+  return _internal_map().size();
+}
+inline int MapOfObjects::map_size() const {
+  return _internal_map_size();
+}
+inline void MapOfObjects::clear_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>& MapOfObjects::_internal_map() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>& MapOfObjects::map() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapOfObjects.map)
+  return _internal_map();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>* MapOfObjects::_internal_mutable_map() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::MapOfObjects_M>* MapOfObjects::mutable_map() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapOfObjects.map)
+  return _internal_mutable_map();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapIn
+
+// string other = 1;
+inline void MapIn::clear_other() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.other_.ClearToEmpty();
+}
+inline const std::string& MapIn::other() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapIn.other)
+  return _internal_other();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapIn::set_other(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.other_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapIn.other)
+}
+inline std::string* MapIn::mutable_other() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_other();
+  // @@protoc_insertion_point(field_mutable:proto3.MapIn.other)
+  return _s;
+}
+inline const std::string& MapIn::_internal_other() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.other_.Get();
+}
+inline void MapIn::_internal_set_other(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.other_.Set(value, GetArena());
+}
+inline std::string* MapIn::_internal_mutable_other() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.other_.Mutable( GetArena());
+}
+inline std::string* MapIn::release_other() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapIn.other)
+  return _impl_.other_.Release();
+}
+inline void MapIn::set_allocated_other(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.other_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.other_.IsDefault()) {
+          _impl_.other_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapIn.other)
+}
+
+// repeated string things = 2;
+inline int MapIn::_internal_things_size() const {
+  return _internal_things().size();
+}
+inline int MapIn::things_size() const {
+  return _internal_things_size();
+}
+inline void MapIn::clear_things() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.things_.Clear();
+}
+inline std::string* MapIn::add_things()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  std::string* _s = _internal_mutable_things()->Add();
+  // @@protoc_insertion_point(field_add_mutable:proto3.MapIn.things)
+  return _s;
+}
+inline const std::string& MapIn::things(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapIn.things)
+  return _internal_things().Get(index);
+}
+inline std::string* MapIn::mutable_things(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.MapIn.things)
+  return _internal_mutable_things()->Mutable(index);
+}
+inline void MapIn::set_things(int index, const std::string& value) {
+  _internal_mutable_things()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto3.MapIn.things)
+}
+inline void MapIn::set_things(int index, std::string&& value) {
+  _internal_mutable_things()->Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto3.MapIn.things)
+}
+inline void MapIn::set_things(int index, const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  _internal_mutable_things()->Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3.MapIn.things)
+}
+inline void MapIn::set_things(int index, const char* value,
+                              std::size_t size) {
+  _internal_mutable_things()->Mutable(index)->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3.MapIn.things)
+}
+inline void MapIn::set_things(int index, absl::string_view value) {
+  _internal_mutable_things()->Mutable(index)->assign(value.data(),
+                                                     value.size());
+  // @@protoc_insertion_point(field_set_string_piece:proto3.MapIn.things)
+}
+inline void MapIn::add_things(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_things()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3.MapIn.things)
+}
+inline void MapIn::add_things(std::string&& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_things()->Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3.MapIn.things)
+}
+inline void MapIn::add_things(const char* value) {
+  ABSL_DCHECK(value != nullptr);
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_things()->Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3.MapIn.things)
+}
+inline void MapIn::add_things(const char* value, std::size_t size) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_things()->Add()->assign(
+      reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3.MapIn.things)
+}
+inline void MapIn::add_things(absl::string_view value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _internal_mutable_things()->Add()->assign(value.data(), value.size());
+  // @@protoc_insertion_point(field_add_string_piece:proto3.MapIn.things)
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+MapIn::things() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.MapIn.things)
+  return _internal_things();
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+MapIn::mutable_things() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.MapIn.things)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_things();
+}
+inline const ::google::protobuf::RepeatedPtrField<std::string>&
+MapIn::_internal_things() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.things_;
+}
+inline ::google::protobuf::RepeatedPtrField<std::string>*
+MapIn::_internal_mutable_things() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.things_;
+}
+
+// map<string, string> map_input = 3;
+inline int MapIn::_internal_map_input_size() const {
+  return _internal_map_input().size();
+}
+inline int MapIn::map_input_size() const {
+  return _internal_map_input_size();
+}
+inline void MapIn::clear_map_input() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map_input_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& MapIn::_internal_map_input() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_input_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, std::string>& MapIn::map_input() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapIn.map_input)
+  return _internal_map_input();
+}
+inline ::google::protobuf::Map<std::string, std::string>* MapIn::_internal_mutable_map_input() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_input_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, std::string>* MapIn::mutable_map_input() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapIn.map_input)
+  return _internal_mutable_map_input();
+}
+
+// map<string, .google.protobuf.Any> map_any = 4;
+inline int MapIn::_internal_map_any_size() const {
+  return _internal_map_any().size();
+}
+inline int MapIn::map_any_size() const {
+  return _internal_map_any_size();
+}
+inline const ::google::protobuf::Map<std::string, ::google::protobuf::Any>& MapIn::_internal_map_any() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map_any_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::google::protobuf::Any>& MapIn::map_any() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapIn.map_any)
+  return _internal_map_any();
+}
+inline ::google::protobuf::Map<std::string, ::google::protobuf::Any>* MapIn::_internal_mutable_map_any() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map_any_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::google::protobuf::Any>* MapIn::mutable_map_any() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapIn.map_any)
+  return _internal_mutable_map_any();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapOut
+
+// map<string, .proto3.MapM> map1 = 1;
+inline int MapOut::_internal_map1_size() const {
+  return _internal_map1().size();
+}
+inline int MapOut::map1_size() const {
+  return _internal_map1_size();
+}
+inline void MapOut::clear_map1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map1_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::MapM>& MapOut::_internal_map1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map1_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::MapM>& MapOut::map1() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapOut.map1)
+  return _internal_map1();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::MapM>* MapOut::_internal_mutable_map1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map1_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::MapM>* MapOut::mutable_map1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapOut.map1)
+  return _internal_mutable_map1();
+}
+
+// map<string, .proto3.MapOut> map2 = 2;
+inline int MapOut::_internal_map2_size() const {
+  return _internal_map2().size();
+}
+inline int MapOut::map2_size() const {
+  return _internal_map2_size();
+}
+inline void MapOut::clear_map2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map2_.Clear();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::MapOut>& MapOut::_internal_map2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map2_.GetMap();
+}
+inline const ::google::protobuf::Map<std::string, ::proto3::MapOut>& MapOut::map2() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapOut.map2)
+  return _internal_map2();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::MapOut>* MapOut::_internal_mutable_map2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map2_.MutableMap();
+}
+inline ::google::protobuf::Map<std::string, ::proto3::MapOut>* MapOut::mutable_map2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapOut.map2)
+  return _internal_mutable_map2();
+}
+
+// map<int32, string> map3 = 3;
+inline int MapOut::_internal_map3_size() const {
+  return _internal_map3().size();
+}
+inline int MapOut::map3_size() const {
+  return _internal_map3_size();
+}
+inline void MapOut::clear_map3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map3_.Clear();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& MapOut::_internal_map3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map3_.GetMap();
+}
+inline const ::google::protobuf::Map<::int32_t, std::string>& MapOut::map3() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapOut.map3)
+  return _internal_map3();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* MapOut::_internal_mutable_map3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map3_.MutableMap();
+}
+inline ::google::protobuf::Map<::int32_t, std::string>* MapOut::mutable_map3() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapOut.map3)
+  return _internal_mutable_map3();
+}
+
+// map<bool, string> map4 = 5;
+inline int MapOut::_internal_map4_size() const {
+  return _internal_map4().size();
+}
+inline int MapOut::map4_size() const {
+  return _internal_map4_size();
+}
+inline void MapOut::clear_map4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map4_.Clear();
+}
+inline const ::google::protobuf::Map<bool, std::string>& MapOut::_internal_map4() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map4_.GetMap();
+}
+inline const ::google::protobuf::Map<bool, std::string>& MapOut::map4() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:proto3.MapOut.map4)
+  return _internal_map4();
+}
+inline ::google::protobuf::Map<bool, std::string>* MapOut::_internal_mutable_map4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _impl_.map4_.MutableMap();
+}
+inline ::google::protobuf::Map<bool, std::string>* MapOut::mutable_map4() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_map:proto3.MapOut.map4)
+  return _internal_mutable_map4();
+}
+
+// string bar = 4;
+inline void MapOut::clear_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bar_.ClearToEmpty();
+}
+inline const std::string& MapOut::bar() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOut.bar)
+  return _internal_bar();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOut::set_bar(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bar_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOut.bar)
+}
+inline std::string* MapOut::mutable_bar() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_bar();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOut.bar)
+  return _s;
+}
+inline const std::string& MapOut::_internal_bar() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bar_.Get();
+}
+inline void MapOut::_internal_set_bar(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bar_.Set(value, GetArena());
+}
+inline std::string* MapOut::_internal_mutable_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.bar_.Mutable( GetArena());
+}
+inline std::string* MapOut::release_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOut.bar)
+  return _impl_.bar_.Release();
+}
+inline void MapOut::set_allocated_bar(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bar_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.bar_.IsDefault()) {
+          _impl_.bar_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOut.bar)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map1Entry
+
+// string key = 1;
+inline void MapOutWireFormat_Map1Entry::clear_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& MapOutWireFormat_Map1Entry::key() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map1Entry.key)
+  return _internal_key();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOutWireFormat_Map1Entry::set_key(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.Map1Entry.key)
+}
+inline std::string* MapOutWireFormat_Map1Entry::mutable_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.Map1Entry.key)
+  return _s;
+}
+inline const std::string& MapOutWireFormat_Map1Entry::_internal_key() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.key_.Get();
+}
+inline void MapOutWireFormat_Map1Entry::_internal_set_key(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.key_.Set(value, GetArena());
+}
+inline std::string* MapOutWireFormat_Map1Entry::_internal_mutable_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.key_.Mutable( GetArena());
+}
+inline std::string* MapOutWireFormat_Map1Entry::release_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.Map1Entry.key)
+  return _impl_.key_.Release();
+}
+inline void MapOutWireFormat_Map1Entry::set_allocated_key(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.key_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.key_.IsDefault()) {
+          _impl_.key_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.Map1Entry.key)
+}
+
+// .proto3.MapM value = 2;
+inline bool MapOutWireFormat_Map1Entry::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline void MapOutWireFormat_Map1Entry::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto3::MapM& MapOutWireFormat_Map1Entry::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::MapM* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::MapM&>(::proto3::_MapM_default_instance_);
+}
+inline const ::proto3::MapM& MapOutWireFormat_Map1Entry::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map1Entry.value)
+  return _internal_value();
+}
+inline void MapOutWireFormat_Map1Entry::unsafe_arena_set_allocated_value(::proto3::MapM* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::proto3::MapM*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapOutWireFormat.Map1Entry.value)
+}
+inline ::proto3::MapM* MapOutWireFormat_Map1Entry::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::MapM* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::MapM* MapOutWireFormat_Map1Entry::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.Map1Entry.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::MapM* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::proto3::MapM* MapOutWireFormat_Map1Entry::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::MapM>(GetArena());
+    _impl_.value_ = reinterpret_cast<::proto3::MapM*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::proto3::MapM* MapOutWireFormat_Map1Entry::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::MapM* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.Map1Entry.value)
+  return _msg;
+}
+inline void MapOutWireFormat_Map1Entry::set_allocated_value(::proto3::MapM* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::MapM*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::MapM*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::proto3::MapM*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.Map1Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map2Entry
+
+// string key = 1;
+inline void MapOutWireFormat_Map2Entry::clear_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& MapOutWireFormat_Map2Entry::key() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map2Entry.key)
+  return _internal_key();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOutWireFormat_Map2Entry::set_key(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.Map2Entry.key)
+}
+inline std::string* MapOutWireFormat_Map2Entry::mutable_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.Map2Entry.key)
+  return _s;
+}
+inline const std::string& MapOutWireFormat_Map2Entry::_internal_key() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.key_.Get();
+}
+inline void MapOutWireFormat_Map2Entry::_internal_set_key(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.key_.Set(value, GetArena());
+}
+inline std::string* MapOutWireFormat_Map2Entry::_internal_mutable_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.key_.Mutable( GetArena());
+}
+inline std::string* MapOutWireFormat_Map2Entry::release_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.Map2Entry.key)
+  return _impl_.key_.Release();
+}
+inline void MapOutWireFormat_Map2Entry::set_allocated_key(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.key_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.key_.IsDefault()) {
+          _impl_.key_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.Map2Entry.key)
+}
+
+// .proto3.MapOut value = 2;
+inline bool MapOutWireFormat_Map2Entry::has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline void MapOutWireFormat_Map2Entry::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto3::MapOut& MapOutWireFormat_Map2Entry::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::proto3::MapOut* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto3::MapOut&>(::proto3::_MapOut_default_instance_);
+}
+inline const ::proto3::MapOut& MapOutWireFormat_Map2Entry::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map2Entry.value)
+  return _internal_value();
+}
+inline void MapOutWireFormat_Map2Entry::unsafe_arena_set_allocated_value(::proto3::MapOut* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::proto3::MapOut*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3.MapOutWireFormat.Map2Entry.value)
+}
+inline ::proto3::MapOut* MapOutWireFormat_Map2Entry::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::MapOut* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::proto3::MapOut* MapOutWireFormat_Map2Entry::unsafe_arena_release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.Map2Entry.value)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::proto3::MapOut* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::proto3::MapOut* MapOutWireFormat_Map2Entry::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3::MapOut>(GetArena());
+    _impl_.value_ = reinterpret_cast<::proto3::MapOut*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::proto3::MapOut* MapOutWireFormat_Map2Entry::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::proto3::MapOut* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.Map2Entry.value)
+  return _msg;
+}
+inline void MapOutWireFormat_Map2Entry::set_allocated_value(::proto3::MapOut* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::proto3::MapOut*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::proto3::MapOut*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.value_ = reinterpret_cast<::proto3::MapOut*>(value);
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.Map2Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map3Entry
+
+// int32 key = 1;
+inline void MapOutWireFormat_Map3Entry::clear_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.key_ = 0;
+}
+inline ::int32_t MapOutWireFormat_Map3Entry::key() const {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map3Entry.key)
+  return _internal_key();
+}
+inline void MapOutWireFormat_Map3Entry::set_key(::int32_t value) {
+  _internal_set_key(value);
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.Map3Entry.key)
+}
+inline ::int32_t MapOutWireFormat_Map3Entry::_internal_key() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.key_;
+}
+inline void MapOutWireFormat_Map3Entry::_internal_set_key(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.key_ = value;
+}
+
+// string value = 2;
+inline void MapOutWireFormat_Map3Entry::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& MapOutWireFormat_Map3Entry::value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map3Entry.value)
+  return _internal_value();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOutWireFormat_Map3Entry::set_value(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.Map3Entry.value)
+}
+inline std::string* MapOutWireFormat_Map3Entry::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.Map3Entry.value)
+  return _s;
+}
+inline const std::string& MapOutWireFormat_Map3Entry::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.value_.Get();
+}
+inline void MapOutWireFormat_Map3Entry::_internal_set_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.value_.Set(value, GetArena());
+}
+inline std::string* MapOutWireFormat_Map3Entry::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.value_.Mutable( GetArena());
+}
+inline std::string* MapOutWireFormat_Map3Entry::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.Map3Entry.value)
+  return _impl_.value_.Release();
+}
+inline void MapOutWireFormat_Map3Entry::set_allocated_value(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.value_.IsDefault()) {
+          _impl_.value_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.Map3Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map4Entry
+
+// bool key = 1;
+inline void MapOutWireFormat_Map4Entry::clear_key() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.key_ = false;
+}
+inline bool MapOutWireFormat_Map4Entry::key() const {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map4Entry.key)
+  return _internal_key();
+}
+inline void MapOutWireFormat_Map4Entry::set_key(bool value) {
+  _internal_set_key(value);
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.Map4Entry.key)
+}
+inline bool MapOutWireFormat_Map4Entry::_internal_key() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.key_;
+}
+inline void MapOutWireFormat_Map4Entry::_internal_set_key(bool value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.key_ = value;
+}
+
+// string value = 2;
+inline void MapOutWireFormat_Map4Entry::clear_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& MapOutWireFormat_Map4Entry::value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.Map4Entry.value)
+  return _internal_value();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOutWireFormat_Map4Entry::set_value(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.Map4Entry.value)
+}
+inline std::string* MapOutWireFormat_Map4Entry::mutable_value() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.Map4Entry.value)
+  return _s;
+}
+inline const std::string& MapOutWireFormat_Map4Entry::_internal_value() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.value_.Get();
+}
+inline void MapOutWireFormat_Map4Entry::_internal_set_value(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.value_.Set(value, GetArena());
+}
+inline std::string* MapOutWireFormat_Map4Entry::_internal_mutable_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.value_.Mutable( GetArena());
+}
+inline std::string* MapOutWireFormat_Map4Entry::release_value() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.Map4Entry.value)
+  return _impl_.value_.Release();
+}
+inline void MapOutWireFormat_Map4Entry::set_allocated_value(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.value_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.value_.IsDefault()) {
+          _impl_.value_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.Map4Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat
+
+// repeated .proto3.MapOutWireFormat.Map1Entry map1 = 1;
+inline int MapOutWireFormat::_internal_map1_size() const {
+  return _internal_map1().size();
+}
+inline int MapOutWireFormat::map1_size() const {
+  return _internal_map1_size();
+}
+inline void MapOutWireFormat::clear_map1() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map1_.Clear();
+}
+inline ::proto3::MapOutWireFormat_Map1Entry* MapOutWireFormat::mutable_map1(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.map1)
+  return _internal_mutable_map1()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map1Entry>* MapOutWireFormat::mutable_map1()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.MapOutWireFormat.map1)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_map1();
+}
+inline const ::proto3::MapOutWireFormat_Map1Entry& MapOutWireFormat::map1(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.map1)
+  return _internal_map1().Get(index);
+}
+inline ::proto3::MapOutWireFormat_Map1Entry* MapOutWireFormat::add_map1() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3::MapOutWireFormat_Map1Entry* _add = _internal_mutable_map1()->Add();
+  // @@protoc_insertion_point(field_add:proto3.MapOutWireFormat.map1)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map1Entry>& MapOutWireFormat::map1() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.MapOutWireFormat.map1)
+  return _internal_map1();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map1Entry>&
+MapOutWireFormat::_internal_map1() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map1_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map1Entry>*
+MapOutWireFormat::_internal_mutable_map1() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.map1_;
+}
+
+// repeated .proto3.MapOutWireFormat.Map2Entry map2 = 2;
+inline int MapOutWireFormat::_internal_map2_size() const {
+  return _internal_map2().size();
+}
+inline int MapOutWireFormat::map2_size() const {
+  return _internal_map2_size();
+}
+inline void MapOutWireFormat::clear_map2() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map2_.Clear();
+}
+inline ::proto3::MapOutWireFormat_Map2Entry* MapOutWireFormat::mutable_map2(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.map2)
+  return _internal_mutable_map2()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map2Entry>* MapOutWireFormat::mutable_map2()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.MapOutWireFormat.map2)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_map2();
+}
+inline const ::proto3::MapOutWireFormat_Map2Entry& MapOutWireFormat::map2(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.map2)
+  return _internal_map2().Get(index);
+}
+inline ::proto3::MapOutWireFormat_Map2Entry* MapOutWireFormat::add_map2() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3::MapOutWireFormat_Map2Entry* _add = _internal_mutable_map2()->Add();
+  // @@protoc_insertion_point(field_add:proto3.MapOutWireFormat.map2)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map2Entry>& MapOutWireFormat::map2() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.MapOutWireFormat.map2)
+  return _internal_map2();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map2Entry>&
+MapOutWireFormat::_internal_map2() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map2_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map2Entry>*
+MapOutWireFormat::_internal_mutable_map2() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.map2_;
+}
+
+// repeated .proto3.MapOutWireFormat.Map3Entry map3 = 3;
+inline int MapOutWireFormat::_internal_map3_size() const {
+  return _internal_map3().size();
+}
+inline int MapOutWireFormat::map3_size() const {
+  return _internal_map3_size();
+}
+inline void MapOutWireFormat::clear_map3() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map3_.Clear();
+}
+inline ::proto3::MapOutWireFormat_Map3Entry* MapOutWireFormat::mutable_map3(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.map3)
+  return _internal_mutable_map3()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map3Entry>* MapOutWireFormat::mutable_map3()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.MapOutWireFormat.map3)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_map3();
+}
+inline const ::proto3::MapOutWireFormat_Map3Entry& MapOutWireFormat::map3(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.map3)
+  return _internal_map3().Get(index);
+}
+inline ::proto3::MapOutWireFormat_Map3Entry* MapOutWireFormat::add_map3() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3::MapOutWireFormat_Map3Entry* _add = _internal_mutable_map3()->Add();
+  // @@protoc_insertion_point(field_add:proto3.MapOutWireFormat.map3)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map3Entry>& MapOutWireFormat::map3() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.MapOutWireFormat.map3)
+  return _internal_map3();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map3Entry>&
+MapOutWireFormat::_internal_map3() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map3_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map3Entry>*
+MapOutWireFormat::_internal_mutable_map3() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.map3_;
+}
+
+// repeated .proto3.MapOutWireFormat.Map4Entry map4 = 5;
+inline int MapOutWireFormat::_internal_map4_size() const {
+  return _internal_map4().size();
+}
+inline int MapOutWireFormat::map4_size() const {
+  return _internal_map4_size();
+}
+inline void MapOutWireFormat::clear_map4() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.map4_.Clear();
+}
+inline ::proto3::MapOutWireFormat_Map4Entry* MapOutWireFormat::mutable_map4(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.map4)
+  return _internal_mutable_map4()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map4Entry>* MapOutWireFormat::mutable_map4()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:proto3.MapOutWireFormat.map4)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_map4();
+}
+inline const ::proto3::MapOutWireFormat_Map4Entry& MapOutWireFormat::map4(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.map4)
+  return _internal_map4().Get(index);
+}
+inline ::proto3::MapOutWireFormat_Map4Entry* MapOutWireFormat::add_map4() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::proto3::MapOutWireFormat_Map4Entry* _add = _internal_mutable_map4()->Add();
+  // @@protoc_insertion_point(field_add:proto3.MapOutWireFormat.map4)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map4Entry>& MapOutWireFormat::map4() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:proto3.MapOutWireFormat.map4)
+  return _internal_map4();
+}
+inline const ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map4Entry>&
+MapOutWireFormat::_internal_map4() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.map4_;
+}
+inline ::google::protobuf::RepeatedPtrField<::proto3::MapOutWireFormat_Map4Entry>*
+MapOutWireFormat::_internal_mutable_map4() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.map4_;
+}
+
+// string bar = 4;
+inline void MapOutWireFormat::clear_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bar_.ClearToEmpty();
+}
+inline const std::string& MapOutWireFormat::bar() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapOutWireFormat.bar)
+  return _internal_bar();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapOutWireFormat::set_bar(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bar_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapOutWireFormat.bar)
+}
+inline std::string* MapOutWireFormat::mutable_bar() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_bar();
+  // @@protoc_insertion_point(field_mutable:proto3.MapOutWireFormat.bar)
+  return _s;
+}
+inline const std::string& MapOutWireFormat::_internal_bar() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.bar_.Get();
+}
+inline void MapOutWireFormat::_internal_set_bar(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.bar_.Set(value, GetArena());
+}
+inline std::string* MapOutWireFormat::_internal_mutable_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.bar_.Mutable( GetArena());
+}
+inline std::string* MapOutWireFormat::release_bar() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapOutWireFormat.bar)
+  return _impl_.bar_.Release();
+}
+inline void MapOutWireFormat::set_allocated_bar(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.bar_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.bar_.IsDefault()) {
+          _impl_.bar_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapOutWireFormat.bar)
+}
+
+// -------------------------------------------------------------------
+
+// MapM
+
+// string foo = 1;
+inline void MapM::clear_foo() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.foo_.ClearToEmpty();
+}
+inline const std::string& MapM::foo() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:proto3.MapM.foo)
+  return _internal_foo();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void MapM::set_foo(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.foo_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:proto3.MapM.foo)
+}
+inline std::string* MapM::mutable_foo() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_foo();
+  // @@protoc_insertion_point(field_mutable:proto3.MapM.foo)
+  return _s;
+}
+inline const std::string& MapM::_internal_foo() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.foo_.Get();
+}
+inline void MapM::_internal_set_foo(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.foo_.Set(value, GetArena());
+}
+inline std::string* MapM::_internal_mutable_foo() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.foo_.Mutable( GetArena());
+}
+inline std::string* MapM::release_foo() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:proto3.MapM.foo)
+  return _impl_.foo_.Release();
+}
+inline void MapM::set_allocated_foo(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.foo_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.foo_.IsDefault()) {
+          _impl_.foo_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto3.MapM.foo)
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3
+
+
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::proto3::Mixed2_E> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto3::Mixed2_E>() {
+  return ::proto3::Mixed2_E_descriptor();
+}
+template <>
+struct is_proto_enum<::proto3::EnumType> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::proto3::EnumType>() {
+  return ::proto3::EnumType_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_2epb_2eh
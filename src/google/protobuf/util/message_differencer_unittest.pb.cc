@@ -0,0 +1,1504 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/message_differencer_unittest.proto
+
+#include "google/protobuf/util/message_differencer_unittest.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace protobuf_unittest {
+
+inline constexpr TestField::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        rc_{},
+        m_{nullptr},
+        c_{0},
+        a_{0},
+        b_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestField::TestField(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestFieldDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestFieldDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestFieldDefaultTypeInternal() {}
+  union {
+    TestField _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestFieldDefaultTypeInternal _TestField_default_instance_;
+      template <typename>
+PROTOBUF_CONSTEXPR TestDiffMessage_Item_MpEntry_DoNotUse::TestDiffMessage_Item_MpEntry_DoNotUse(::_pbi::ConstantInitialized) {}
+struct TestDiffMessage_Item_MpEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestDiffMessage_Item_MpEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestDiffMessage_Item_MpEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TestDiffMessage_Item_MpEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestDiffMessage_Item_MpEntry_DoNotUseDefaultTypeInternal _TestDiffMessage_Item_MpEntry_DoNotUse_default_instance_;
+
+inline constexpr TestDiffMessage_Item::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        ra_{},
+        rb_{},
+        rm_{},
+        mp_{},
+        b_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        m_{nullptr},
+        a_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestDiffMessage_Item::TestDiffMessage_Item(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestDiffMessage_ItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestDiffMessage_ItemDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestDiffMessage_ItemDefaultTypeInternal() {}
+  union {
+    TestDiffMessage_Item _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestDiffMessage_ItemDefaultTypeInternal _TestDiffMessage_Item_default_instance_;
+
+inline constexpr TestDiffMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        item_{},
+        rw_{},
+        rv_{},
+        rm_{},
+        rany_{},
+        w_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        m_{nullptr},
+        v_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestDiffMessage::TestDiffMessage(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestDiffMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestDiffMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestDiffMessageDefaultTypeInternal() {}
+  union {
+    TestDiffMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestDiffMessageDefaultTypeInternal _TestDiffMessage_default_instance_;
+}  // namespace protobuf_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto[4];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _impl_.b_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _impl_.c_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _impl_.rc_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestField, _impl_.m_),
+    2,
+    3,
+    1,
+    ~0u,
+    0,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item_MpEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item_MpEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item_MpEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item_MpEntry_DoNotUse, value_),
+    0,
+    1,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.a_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.b_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.ra_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.rb_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.m_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.rm_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage_Item, _impl_.mp_),
+    2,
+    0,
+    ~0u,
+    ~0u,
+    1,
+    ~0u,
+    ~0u,
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _internal_metadata_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_._extensions_),
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.item_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.v_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.w_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.m_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.rv_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.rw_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.rm_),
+    PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestDiffMessage, _impl_.rany_),
+    ~0u,
+    2,
+    0,
+    1,
+    ~0u,
+    ~0u,
+    ~0u,
+    ~0u,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 13, -1, sizeof(::protobuf_unittest::TestField)},
+        {18, 28, -1, sizeof(::protobuf_unittest::TestDiffMessage_Item_MpEntry_DoNotUse)},
+        {30, 45, -1, sizeof(::protobuf_unittest::TestDiffMessage_Item)},
+        {52, 68, -1, sizeof(::protobuf_unittest::TestDiffMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::protobuf_unittest::_TestField_default_instance_._instance,
+    &::protobuf_unittest::_TestDiffMessage_Item_MpEntry_DoNotUse_default_instance_._instance,
+    &::protobuf_unittest::_TestDiffMessage_Item_default_instance_._instance,
+    &::protobuf_unittest::_TestDiffMessage_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n7google/protobuf/util/message_differenc"
+    "er_unittest.proto\022\021protobuf_unittest\032\031go"
+    "ogle/protobuf/any.proto\"\257\001\n\tTestField\022\t\n"
+    "\001a\030\003 \001(\005\022\t\n\001b\030\004 \001(\005\022\t\n\001c\030\001 \001(\005\022\n\n\002rc\030\002 \003"
+    "(\005\022\'\n\001m\030\005 \001(\0132\034.protobuf_unittest.TestFi"
+    "eld2L\n\002tf\022\".protobuf_unittest.TestDiffMe"
+    "ssage\030d \001(\0132\034.protobuf_unittest.TestFiel"
+    "d\"\356\003\n\017TestDiffMessage\0225\n\004item\030\001 \003(\n2\'.pr"
+    "otobuf_unittest.TestDiffMessage.Item\022\r\n\001"
+    "v\030\r \001(\005B\002\030\001\022\t\n\001w\030\016 \001(\t\022\'\n\001m\030\017 \001(\0132\034.prot"
+    "obuf_unittest.TestField\022\n\n\002rv\030\013 \003(\005\022\n\n\002r"
+    "w\030\n \003(\t\022,\n\002rm\030\014 \003(\0132\034.protobuf_unittest."
+    "TestFieldB\002\030\001\022\"\n\004rany\030\020 \003(\0132\024.google.pro"
+    "tobuf.Any\032\357\001\n\004Item\022\t\n\001a\030\002 \001(\005\022\t\n\001b\030\004 \001(\t"
+    "\022\n\n\002ra\030\003 \003(\005\022\n\n\002rb\030\005 \003(\t\022\'\n\001m\030\006 \001(\0132\034.pr"
+    "otobuf_unittest.TestField\022(\n\002rm\030\007 \003(\0132\034."
+    "protobuf_unittest.TestField\022;\n\002mp\030\010 \003(\0132"
+    "/.protobuf_unittest.TestDiffMessage.Item"
+    ".MpEntry\032)\n\007MpEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005valu"
+    "e\030\002 \001(\005:\0028\001*\005\010d\020\310\001B\002H\001"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto = {
+    false,
+    false,
+    782,
+    descriptor_table_protodef_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto,
+    "google/protobuf/util/message_differencer_unittest.proto",
+    &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_once,
+    descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_deps,
+    1,
+    4,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto(&descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto);
+namespace protobuf_unittest {
+// ===================================================================
+
+class TestField::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestField>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestField, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::TestField& m(const TestField* msg);
+  static void set_has_m(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestField& TestField::_Internal::m(const TestField* msg) {
+  return *msg->_impl_.m_;
+}
+TestField::TestField(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestField)
+}
+inline PROTOBUF_NDEBUG_INLINE TestField::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        rc_{visibility, arena, from.rc_} {}
+
+TestField::TestField(
+    ::google::protobuf::Arena* arena,
+    const TestField& from)
+    : ::google::protobuf::Message(arena) {
+  TestField* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.m_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestField>(arena, *from._impl_.m_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, c_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, c_),
+           offsetof(Impl_, b_) -
+               offsetof(Impl_, c_) +
+               sizeof(Impl_::b_));
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestField)
+}
+inline PROTOBUF_NDEBUG_INLINE TestField::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        rc_{visibility, arena} {}
+
+inline void TestField::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, m_),
+           0,
+           offsetof(Impl_, b_) -
+               offsetof(Impl_, m_) +
+               sizeof(Impl_::b_));
+}
+TestField::~TestField() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestField)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestField::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.m_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestField::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestField)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rc_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.m_ != nullptr);
+    _impl_.m_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.c_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.b_) -
+        reinterpret_cast<char*>(&_impl_.c_)) + sizeof(_impl_.b_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestField::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 1, 0, 2> TestField::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestField, _impl_._has_bits_),
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestField_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // optional int32 c = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestField, _impl_.c_), 1>(),
+     {8, 1, 0, PROTOBUF_FIELD_OFFSET(TestField, _impl_.c_)}},
+    // repeated int32 rc = 2;
+    {::_pbi::TcParser::FastV32R1,
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TestField, _impl_.rc_)}},
+    // optional int32 a = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestField, _impl_.a_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TestField, _impl_.a_)}},
+    // optional int32 b = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestField, _impl_.b_), 3>(),
+     {32, 3, 0, PROTOBUF_FIELD_OFFSET(TestField, _impl_.b_)}},
+    // optional .protobuf_unittest.TestField m = 5;
+    {::_pbi::TcParser::FastMtS1,
+     {42, 0, 0, PROTOBUF_FIELD_OFFSET(TestField, _impl_.m_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 c = 1;
+    {PROTOBUF_FIELD_OFFSET(TestField, _impl_.c_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // repeated int32 rc = 2;
+    {PROTOBUF_FIELD_OFFSET(TestField, _impl_.rc_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kInt32)},
+    // optional int32 a = 3;
+    {PROTOBUF_FIELD_OFFSET(TestField, _impl_.a_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional int32 b = 4;
+    {PROTOBUF_FIELD_OFFSET(TestField, _impl_.b_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional .protobuf_unittest.TestField m = 5;
+    {PROTOBUF_FIELD_OFFSET(TestField, _impl_.m_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestField>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestField::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestField)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 c = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_c(), target);
+  }
+
+  // repeated int32 rc = 2;
+  for (int i = 0, n = this->_internal_rc_size(); i < n; ++i) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        2, this->_internal_rc().Get(i), target);
+  }
+
+  // optional int32 a = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<3>(
+            stream, this->_internal_a(), target);
+  }
+
+  // optional int32 b = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<4>(
+            stream, this->_internal_b(), target);
+  }
+
+  // optional .protobuf_unittest.TestField m = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        5, _Internal::m(this),
+        _Internal::m(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestField)
+  return target;
+}
+
+::size_t TestField::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestField)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 rc = 2;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_rc())
+    ;
+    std::size_t tag_size = std::size_t{1} *
+        ::_pbi::FromIntSize(this->_internal_rc_size());
+    ;
+    total_size += tag_size + data_size;
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .protobuf_unittest.TestField m = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.m_);
+    }
+
+    // optional int32 c = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_c());
+    }
+
+    // optional int32 a = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_a());
+    }
+
+    // optional int32 b = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_b());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestField::_class_data_ = {
+    TestField::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestField::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestField::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestField*>(&to_msg);
+  auto& from = static_cast<const TestField&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestField)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_rc()->MergeFrom(from._internal_rc());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_m()->::protobuf_unittest::TestField::MergeFrom(
+          from._internal_m());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.b_ = from._impl_.b_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestField::CopyFrom(const TestField& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestField)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestField::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestField::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestField::InternalSwap(TestField* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.rc_.InternalSwap(&other->_impl_.rc_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestField, _impl_.b_)
+      + sizeof(TestField::_impl_.b_)
+      - PROTOBUF_FIELD_OFFSET(TestField, _impl_.m_)>(
+          reinterpret_cast<char*>(&_impl_.m_),
+          reinterpret_cast<char*>(&other->_impl_.m_));
+}
+
+::google::protobuf::Metadata TestField::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto[0]);
+}
+// ===================================================================
+
+TestDiffMessage_Item_MpEntry_DoNotUse::TestDiffMessage_Item_MpEntry_DoNotUse() {}
+TestDiffMessage_Item_MpEntry_DoNotUse::TestDiffMessage_Item_MpEntry_DoNotUse(::google::protobuf::Arena* arena)
+    : SuperType(arena) {}
+::google::protobuf::Metadata TestDiffMessage_Item_MpEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto[1]);
+}
+// ===================================================================
+
+class TestDiffMessage_Item::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestDiffMessage_Item>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_b(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::protobuf_unittest::TestField& m(const TestDiffMessage_Item* msg);
+  static void set_has_m(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::protobuf_unittest::TestField& TestDiffMessage_Item::_Internal::m(const TestDiffMessage_Item* msg) {
+  return *msg->_impl_.m_;
+}
+TestDiffMessage_Item::TestDiffMessage_Item(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestDiffMessage.Item)
+}
+inline PROTOBUF_NDEBUG_INLINE TestDiffMessage_Item::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        ra_{visibility, arena, from.ra_},
+        rb_{visibility, arena, from.rb_},
+        rm_{visibility, arena, from.rm_},
+        mp_{visibility, arena, from.mp_},
+        b_(arena, from.b_) {}
+
+TestDiffMessage_Item::TestDiffMessage_Item(
+    ::google::protobuf::Arena* arena,
+    const TestDiffMessage_Item& from)
+    : ::google::protobuf::Message(arena) {
+  TestDiffMessage_Item* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.m_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestField>(arena, *from._impl_.m_)
+                : nullptr;
+  _impl_.a_ = from._impl_.a_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestDiffMessage.Item)
+}
+inline PROTOBUF_NDEBUG_INLINE TestDiffMessage_Item::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        ra_{visibility, arena},
+        rb_{visibility, arena},
+        rm_{visibility, arena},
+        mp_{visibility, arena},
+        b_(arena) {}
+
+inline void TestDiffMessage_Item::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, m_),
+           0,
+           offsetof(Impl_, a_) -
+               offsetof(Impl_, m_) +
+               sizeof(Impl_::a_));
+}
+TestDiffMessage_Item::~TestDiffMessage_Item() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestDiffMessage.Item)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestDiffMessage_Item::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.b_.Destroy();
+  delete _impl_.m_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestDiffMessage_Item::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestDiffMessage.Item)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ra_.Clear();
+  _impl_.rb_.Clear();
+  _impl_.rm_.Clear();
+  _impl_.mp_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.b_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.m_ != nullptr);
+      _impl_.m_->Clear();
+    }
+  }
+  _impl_.a_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestDiffMessage_Item::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 3, 52, 2> TestDiffMessage_Item::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_._has_bits_),
+    0, // no _extensions_
+    8, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967041,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    3,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestDiffMessage_Item_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::FastEndG1, {12, 12}},
+    // optional int32 a = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestDiffMessage_Item, _impl_.a_), 2>(),
+     {16, 2, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.a_)}},
+    // repeated int32 ra = 3;
+    {::_pbi::TcParser::FastV32R1,
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.ra_)}},
+    // optional string b = 4;
+    {::_pbi::TcParser::FastSS1,
+     {34, 0, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.b_)}},
+    // repeated string rb = 5;
+    {::_pbi::TcParser::FastSR1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.rb_)}},
+    // optional .protobuf_unittest.TestField m = 6;
+    {::_pbi::TcParser::FastMtS1,
+     {50, 1, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.m_)}},
+    // repeated .protobuf_unittest.TestField rm = 7;
+    {::_pbi::TcParser::FastMtR1,
+     {58, 63, 1, PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.rm_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // optional int32 a = 2;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.a_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // repeated int32 ra = 3;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.ra_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kInt32)},
+    // optional string b = 4;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.b_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // repeated string rb = 5;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.rb_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kRawString | ::_fl::kRepSString)},
+    // optional .protobuf_unittest.TestField m = 6;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.m_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .protobuf_unittest.TestField rm = 7;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.rm_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // map<string, int32> mp = 8;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.mp_), -1, 2,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestField>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestField>()},
+    {::_pbi::TcParser::GetMapAuxInfo<
+        decltype(TestDiffMessage_Item()._impl_.mp_)>(
+        0, 1, 0, 9,
+        5)},
+  }}, {{
+    "\46\0\0\1\2\0\0\2"
+    "protobuf_unittest.TestDiffMessage.Item"
+    "b"
+    "rb"
+    "mp"
+  }},
+};
+
+::uint8_t* TestDiffMessage_Item::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestDiffMessage.Item)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 a = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<2>(
+            stream, this->_internal_a(), target);
+  }
+
+  // repeated int32 ra = 3;
+  for (int i = 0, n = this->_internal_ra_size(); i < n; ++i) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        3, this->_internal_ra().Get(i), target);
+  }
+
+  // optional string b = 4;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_b();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestDiffMessage.Item.b");
+    target = stream->WriteStringMaybeAliased(4, _s, target);
+  }
+
+  // repeated string rb = 5;
+  for (int i = 0, n = this->_internal_rb_size(); i < n; ++i) {
+    const auto& s = this->_internal_rb().Get(i);
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestDiffMessage.Item.rb");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // optional .protobuf_unittest.TestField m = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        6, _Internal::m(this),
+        _Internal::m(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestField rm = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rm_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rm().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // map<string, int32> mp = 8;
+  if (!_internal_mp().empty()) {
+    using MapType = ::google::protobuf::Map<std::string, ::int32_t>;
+    using WireHelper = _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>;
+    const auto& field = _internal_mp();
+
+    if (stream->IsSerializationDeterministic() && field.size() > 1) {
+      for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestDiffMessage.Item.mp");
+      }
+    } else {
+      for (const auto& entry : field) {
+        target = WireHelper::InternalSerialize(
+            8, entry.first, entry.second, target, stream);
+        ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                    "protobuf_unittest.TestDiffMessage.Item.mp");
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestDiffMessage.Item)
+  return target;
+}
+
+::size_t TestDiffMessage_Item::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestDiffMessage.Item)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 ra = 3;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_ra())
+    ;
+    std::size_t tag_size = std::size_t{1} *
+        ::_pbi::FromIntSize(this->_internal_ra_size());
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated string rb = 5;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_rb().size());
+  for (int i = 0, n = _internal_rb().size(); i < n; ++i) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+        _internal_rb().Get(i));
+  }
+  // repeated .protobuf_unittest.TestField rm = 7;
+  total_size += 1UL * this->_internal_rm_size();
+  for (const auto& msg : this->_internal_rm()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // map<string, int32> mp = 8;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_mp_size());
+  for (const auto& entry : _internal_mp()) {
+    total_size += _pbi::MapEntryFuncs<std::string, ::int32_t,
+                                   _pbi::WireFormatLite::TYPE_STRING,
+                                   _pbi::WireFormatLite::TYPE_INT32>::ByteSizeLong(entry.first, entry.second);
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string b = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_b());
+    }
+
+    // optional .protobuf_unittest.TestField m = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.m_);
+    }
+
+    // optional int32 a = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_a());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestDiffMessage_Item::_class_data_ = {
+    TestDiffMessage_Item::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestDiffMessage_Item::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestDiffMessage_Item::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestDiffMessage_Item*>(&to_msg);
+  auto& from = static_cast<const TestDiffMessage_Item&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestDiffMessage.Item)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_ra()->MergeFrom(from._internal_ra());
+  _this->_internal_mutable_rb()->MergeFrom(from._internal_rb());
+  _this->_internal_mutable_rm()->MergeFrom(
+      from._internal_rm());
+  _this->_impl_.mp_.MergeFrom(from._impl_.mp_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_b(from._internal_b());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_m()->::protobuf_unittest::TestField::MergeFrom(
+          from._internal_m());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestDiffMessage_Item::CopyFrom(const TestDiffMessage_Item& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestDiffMessage.Item)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestDiffMessage_Item::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestDiffMessage_Item::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestDiffMessage_Item::InternalSwap(TestDiffMessage_Item* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ra_.InternalSwap(&other->_impl_.ra_);
+  _impl_.rb_.InternalSwap(&other->_impl_.rb_);
+  _impl_.rm_.InternalSwap(&other->_impl_.rm_);
+  _impl_.mp_.InternalSwap(&other->_impl_.mp_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.b_, &other->_impl_.b_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.a_)
+      + sizeof(TestDiffMessage_Item::_impl_.a_)
+      - PROTOBUF_FIELD_OFFSET(TestDiffMessage_Item, _impl_.m_)>(
+          reinterpret_cast<char*>(&_impl_.m_),
+          reinterpret_cast<char*>(&other->_impl_.m_));
+}
+
+::google::protobuf::Metadata TestDiffMessage_Item::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto[2]);
+}
+// ===================================================================
+
+class TestDiffMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestDiffMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_._has_bits_);
+  static void set_has_v(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::protobuf_unittest::TestField& m(const TestDiffMessage* msg);
+  static void set_has_m(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::protobuf_unittest::TestField& TestDiffMessage::_Internal::m(const TestDiffMessage* msg) {
+  return *msg->_impl_.m_;
+}
+void TestDiffMessage::clear_rany() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.rany_.Clear();
+}
+TestDiffMessage::TestDiffMessage(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestDiffMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestDiffMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _extensions_{visibility, arena},
+        _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        item_{visibility, arena, from.item_},
+        rw_{visibility, arena, from.rw_},
+        rv_{visibility, arena, from.rv_},
+        rm_{visibility, arena, from.rm_},
+        rany_{visibility, arena, from.rany_},
+        w_(arena, from.w_) {}
+
+TestDiffMessage::TestDiffMessage(
+    ::google::protobuf::Arena* arena,
+    const TestDiffMessage& from)
+    : ::google::protobuf::Message(arena) {
+  TestDiffMessage* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_._extensions_.MergeFrom(this, from._impl_._extensions_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.m_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::protobuf_unittest::TestField>(arena, *from._impl_.m_)
+                : nullptr;
+  _impl_.v_ = from._impl_.v_;
+
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestDiffMessage)
+}
+inline PROTOBUF_NDEBUG_INLINE TestDiffMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _extensions_{visibility, arena},
+        _cached_size_{0},
+        item_{visibility, arena},
+        rw_{visibility, arena},
+        rv_{visibility, arena},
+        rm_{visibility, arena},
+        rany_{visibility, arena},
+        w_(arena) {}
+
+inline void TestDiffMessage::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, m_),
+           0,
+           offsetof(Impl_, v_) -
+               offsetof(Impl_, m_) +
+               sizeof(Impl_::v_));
+}
+TestDiffMessage::~TestDiffMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestDiffMessage)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestDiffMessage::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.w_.Destroy();
+  delete _impl_.m_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestDiffMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestDiffMessage)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.item_.Clear();
+  _impl_.rw_.Clear();
+  _impl_.rv_.Clear();
+  _impl_.rm_.Clear();
+  _impl_.rany_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.w_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.m_ != nullptr);
+      _impl_.m_->Clear();
+    }
+  }
+  _impl_.v_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestDiffMessage::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 8, 4, 53, 2> TestDiffMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_._extensions_),
+    16, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294902270,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    8,  // num_field_entries
+    4,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestDiffMessage_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // repeated .google.protobuf.Any rany = 16;
+    {::_pbi::TcParser::FastMtR2,
+     {386, 63, 3, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rany_)}},
+    // repeated group Item = 1 { ... };
+    {::_pbi::TcParser::FastGtR1,
+     {11, 63, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.item_)}},
+    // repeated string rw = 10;
+    {::_pbi::TcParser::FastSR1,
+     {82, 63, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rw_)}},
+    // repeated int32 rv = 11;
+    {::_pbi::TcParser::FastV32R1,
+     {88, 63, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rv_)}},
+    // repeated .protobuf_unittest.TestField rm = 12 [deprecated = true];
+    {::_pbi::TcParser::FastMtR1,
+     {98, 63, 1, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rm_)}},
+    // optional int32 v = 13 [deprecated = true];
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TestDiffMessage, _impl_.v_), 2>(),
+     {104, 2, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.v_)}},
+    // optional string w = 14;
+    {::_pbi::TcParser::FastSS1,
+     {114, 0, 0, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.w_)}},
+    // optional .protobuf_unittest.TestField m = 15;
+    {::_pbi::TcParser::FastMtS1,
+     {122, 1, 2, PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.m_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated group Item = 1 { ... };
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.item_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kRepGroup | ::_fl::kTvTable)},
+    // repeated string rw = 10;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rw_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kRawString | ::_fl::kRepSString)},
+    // repeated int32 rv = 11;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rv_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kInt32)},
+    // repeated .protobuf_unittest.TestField rm = 12 [deprecated = true];
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rm_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional int32 v = 13 [deprecated = true];
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.v_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // optional string w = 14;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.w_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kRawString | ::_fl::kRepAString)},
+    // optional .protobuf_unittest.TestField m = 15;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.m_), _Internal::kHasBitsOffset + 1, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .google.protobuf.Any rany = 16;
+    {PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.rany_), -1, 3,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestDiffMessage_Item>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestField>()},
+    {::_pbi::TcParser::GetTable<::protobuf_unittest::TestField>()},
+    {::_pbi::TcParser::GetTable<::google::protobuf::Any>()},
+  }}, {{
+    "\41\0\2\0\0\0\1\0\0\0\0\0\0\0\0\0"
+    "protobuf_unittest.TestDiffMessage"
+    "rw"
+    "w"
+  }},
+};
+
+::uint8_t* TestDiffMessage::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestDiffMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // repeated group Item = 1 { ... };
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_item_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteGroup(1, this->_internal_item().Get(i), target, stream);
+  }
+
+  // repeated string rw = 10;
+  for (int i = 0, n = this->_internal_rw_size(); i < n; ++i) {
+    const auto& s = this->_internal_rw().Get(i);
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestDiffMessage.rw");
+    target = stream->WriteString(10, s, target);
+  }
+
+  // repeated int32 rv = 11;
+  for (int i = 0, n = this->_internal_rv_size(); i < n; ++i) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        11, this->_internal_rv().Get(i), target);
+  }
+
+  // repeated .protobuf_unittest.TestField rm = 12 [deprecated = true];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rm_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rm().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 v = 13 [deprecated = true];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<13>(
+            stream, this->_internal_v(), target);
+  }
+
+  // optional string w = 14;
+  if (cached_has_bits & 0x00000001u) {
+    const std::string& _s = this->_internal_w();
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(_s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormat::SERIALIZE,
+                                "protobuf_unittest.TestDiffMessage.w");
+    target = stream->WriteStringMaybeAliased(14, _s, target);
+  }
+
+  // optional .protobuf_unittest.TestField m = 15;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        15, _Internal::m(this),
+        _Internal::m(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .google.protobuf.Any rany = 16;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rany_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rany().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(16, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // Extension range [100, 200)
+  target = _impl_._extensions_._InternalSerialize(
+      internal_default_instance(), 100, 200, target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestDiffMessage)
+  return target;
+}
+
+::size_t TestDiffMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestDiffMessage)
+  ::size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated group Item = 1 { ... };
+  total_size += 2UL * this->_internal_item_size();
+  for (const auto& msg : this->_internal_item()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::GroupSize(msg);
+  }
+  // repeated string rw = 10;
+  total_size += 1 * ::google::protobuf::internal::FromIntSize(_internal_rw().size());
+  for (int i = 0, n = _internal_rw().size(); i < n; ++i) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+        _internal_rw().Get(i));
+  }
+  // repeated int32 rv = 11;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_rv())
+    ;
+    std::size_t tag_size = std::size_t{1} *
+        ::_pbi::FromIntSize(this->_internal_rv_size());
+    ;
+    total_size += tag_size + data_size;
+  }
+  // repeated .protobuf_unittest.TestField rm = 12 [deprecated = true];
+  total_size += 1UL * this->_internal_rm_size();
+  for (const auto& msg : this->_internal_rm()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // repeated .google.protobuf.Any rany = 16;
+  total_size += 2UL * this->_internal_rany_size();
+  for (const auto& msg : this->_internal_rany()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string w = 14;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this->_internal_w());
+    }
+
+    // optional .protobuf_unittest.TestField m = 15;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.m_);
+    }
+
+    // optional int32 v = 13 [deprecated = true];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this->_internal_v());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestDiffMessage::_class_data_ = {
+    TestDiffMessage::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestDiffMessage::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestDiffMessage::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestDiffMessage*>(&to_msg);
+  auto& from = static_cast<const TestDiffMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestDiffMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_item()->MergeFrom(
+      from._internal_item());
+  _this->_internal_mutable_rw()->MergeFrom(from._internal_rw());
+  _this->_internal_mutable_rv()->MergeFrom(from._internal_rv());
+  _this->_internal_mutable_rm()->MergeFrom(
+      from._internal_rm());
+  _this->_internal_mutable_rany()->MergeFrom(
+      from._internal_rany());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_w(from._internal_w());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_m()->::protobuf_unittest::TestField::MergeFrom(
+          from._internal_m());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.v_ = from._impl_.v_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestDiffMessage::CopyFrom(const TestDiffMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestDiffMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestDiffMessage::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized(internal_default_instance())) {
+    return false;
+  }
+  return true;
+}
+
+::_pbi::CachedSize* TestDiffMessage::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestDiffMessage::InternalSwap(TestDiffMessage* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.item_.InternalSwap(&other->_impl_.item_);
+  _impl_.rw_.InternalSwap(&other->_impl_.rw_);
+  _impl_.rv_.InternalSwap(&other->_impl_.rv_);
+  _impl_.rm_.InternalSwap(&other->_impl_.rm_);
+  _impl_.rany_.InternalSwap(&other->_impl_.rany_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.w_, &other->_impl_.w_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.v_)
+      + sizeof(TestDiffMessage::_impl_.v_)
+      - PROTOBUF_FIELD_OFFSET(TestDiffMessage, _impl_.m_)>(
+          reinterpret_cast<char*>(&_impl_.m_),
+          reinterpret_cast<char*>(&other->_impl_.m_));
+}
+
+::google::protobuf::Metadata TestDiffMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_2eproto[3]);
+}
+#if !defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912)
+const int TestField::kTfFieldNumber;
+#endif
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestDiffMessage,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestField >, 11, false>
+  TestField::tf(kTfFieldNumber, ::protobuf_unittest::TestField::default_instance(), nullptr);
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
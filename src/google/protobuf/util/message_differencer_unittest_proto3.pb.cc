@@ -0,0 +1,399 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/message_differencer_unittest_proto3.proto
+
+#include "google/protobuf/util/message_differencer_unittest_proto3.pb.h"
+
+#include <algorithm>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace proto3_unittest {
+
+inline constexpr TestNoPresenceField::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        no_presence_repeated_nested_{},
+        no_presence_nested_{nullptr},
+        no_presence_bool_{false} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR TestNoPresenceField::TestNoPresenceField(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct TestNoPresenceFieldDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestNoPresenceFieldDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestNoPresenceFieldDefaultTypeInternal() {}
+  union {
+    TestNoPresenceField _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestNoPresenceFieldDefaultTypeInternal _TestNoPresenceField_default_instance_;
+}  // namespace proto3_unittest
+static ::_pb::Metadata file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto[1];
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto = nullptr;
+const ::uint32_t TableStruct_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
+    protodesc_cold) = {
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestNoPresenceField, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestNoPresenceField, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestNoPresenceField, _impl_.no_presence_bool_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestNoPresenceField, _impl_.no_presence_nested_),
+    PROTOBUF_FIELD_OFFSET(::proto3_unittest::TestNoPresenceField, _impl_.no_presence_repeated_nested_),
+    ~0u,
+    0,
+    ~0u,
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+        {0, 11, -1, sizeof(::proto3_unittest::TestNoPresenceField)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+    &::proto3_unittest::_TestNoPresenceField_default_instance_._instance,
+};
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+    "\n>google/protobuf/util/message_differenc"
+    "er_unittest_proto3.proto\022\017proto3_unittes"
+    "t\"\274\001\n\023TestNoPresenceField\022\030\n\020no_presence"
+    "_bool\030\001 \001(\010\022@\n\022no_presence_nested\030\002 \001(\0132"
+    "$.proto3_unittest.TestNoPresenceField\022I\n"
+    "\033no_presence_repeated_nested\030\003 \003(\0132$.pro"
+    "to3_unittest.TestNoPresenceFieldB\002H\001b\006pr"
+    "oto3"
+};
+static ::absl::once_flag descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto = {
+    false,
+    false,
+    284,
+    descriptor_table_protodef_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto,
+    "google/protobuf/util/message_differencer_unittest_proto3.proto",
+    &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto_once,
+    nullptr,
+    0,
+    1,
+    schemas,
+    file_default_instances,
+    TableStruct_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto::offsets,
+    file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto,
+    file_level_enum_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto,
+    file_level_service_descriptors_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto,
+};
+
+// This function exists to be marked as weak.
+// It can significantly speed up compilation by breaking up LLVM's SCC
+// in the .pb.cc translation units. Large translation units see a
+// reduction of more than 35% of walltime for optimized builds. Without
+// the weak attribute all the messages in the file, including all the
+// vtables and everything they use become part of the same SCC through
+// a cycle like:
+// GetMetadata -> descriptor table -> default instances ->
+//   vtables -> GetMetadata
+// By adding a weak function here we break the connection from the
+// individual vtables back into the descriptor table.
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto_getter() {
+  return &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto;
+}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
+static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto(&descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto);
+namespace proto3_unittest {
+// ===================================================================
+
+class TestNoPresenceField::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestNoPresenceField>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_._has_bits_);
+  static const ::proto3_unittest::TestNoPresenceField& no_presence_nested(const TestNoPresenceField* msg);
+  static void set_has_no_presence_nested(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::proto3_unittest::TestNoPresenceField& TestNoPresenceField::_Internal::no_presence_nested(const TestNoPresenceField* msg) {
+  return *msg->_impl_.no_presence_nested_;
+}
+TestNoPresenceField::TestNoPresenceField(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3_unittest.TestNoPresenceField)
+}
+inline PROTOBUF_NDEBUG_INLINE TestNoPresenceField::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        no_presence_repeated_nested_{visibility, arena, from.no_presence_repeated_nested_} {}
+
+TestNoPresenceField::TestNoPresenceField(
+    ::google::protobuf::Arena* arena,
+    const TestNoPresenceField& from)
+    : ::google::protobuf::Message(arena) {
+  TestNoPresenceField* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.no_presence_nested_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::proto3_unittest::TestNoPresenceField>(arena, *from._impl_.no_presence_nested_)
+                : nullptr;
+  _impl_.no_presence_bool_ = from._impl_.no_presence_bool_;
+
+  // @@protoc_insertion_point(copy_constructor:proto3_unittest.TestNoPresenceField)
+}
+inline PROTOBUF_NDEBUG_INLINE TestNoPresenceField::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        no_presence_repeated_nested_{visibility, arena} {}
+
+inline void TestNoPresenceField::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, no_presence_nested_),
+           0,
+           offsetof(Impl_, no_presence_bool_) -
+               offsetof(Impl_, no_presence_nested_) +
+               sizeof(Impl_::no_presence_bool_));
+}
+TestNoPresenceField::~TestNoPresenceField() {
+  // @@protoc_insertion_point(destructor:proto3_unittest.TestNoPresenceField)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void TestNoPresenceField::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.no_presence_nested_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void TestNoPresenceField::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3_unittest.TestNoPresenceField)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.no_presence_repeated_nested_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.no_presence_nested_ != nullptr);
+    _impl_.no_presence_nested_->Clear();
+  }
+  _impl_.no_presence_bool_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* TestNoPresenceField::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 2, 0, 2> TestNoPresenceField::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_TestNoPresenceField_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // bool no_presence_bool = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(TestNoPresenceField, _impl_.no_presence_bool_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_bool_)}},
+    // .proto3_unittest.TestNoPresenceField no_presence_nested = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_nested_)}},
+    // repeated .proto3_unittest.TestNoPresenceField no_presence_repeated_nested = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 63, 1, PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_repeated_nested_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool no_presence_bool = 1;
+    {PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_bool_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // .proto3_unittest.TestNoPresenceField no_presence_nested = 2;
+    {PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_nested_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .proto3_unittest.TestNoPresenceField no_presence_repeated_nested = 3;
+    {PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_repeated_nested_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::proto3_unittest::TestNoPresenceField>()},
+    {::_pbi::TcParser::GetTable<::proto3_unittest::TestNoPresenceField>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* TestNoPresenceField::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3_unittest.TestNoPresenceField)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // bool no_presence_bool = 1;
+  if (this->_internal_no_presence_bool() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_no_presence_bool(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .proto3_unittest.TestNoPresenceField no_presence_nested = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::no_presence_nested(this),
+        _Internal::no_presence_nested(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto3_unittest.TestNoPresenceField no_presence_repeated_nested = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_no_presence_repeated_nested_size()); i < n; i++) {
+    const auto& repfield = this->_internal_no_presence_repeated_nested().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3_unittest.TestNoPresenceField)
+  return target;
+}
+
+::size_t TestNoPresenceField::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3_unittest.TestNoPresenceField)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto3_unittest.TestNoPresenceField no_presence_repeated_nested = 3;
+  total_size += 1UL * this->_internal_no_presence_repeated_nested_size();
+  for (const auto& msg : this->_internal_no_presence_repeated_nested()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .proto3_unittest.TestNoPresenceField no_presence_nested = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.no_presence_nested_);
+  }
+
+  // bool no_presence_bool = 1;
+  if (this->_internal_no_presence_bool() != 0) {
+    total_size += 2;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData TestNoPresenceField::_class_data_ = {
+    TestNoPresenceField::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* TestNoPresenceField::GetClassData() const {
+  return &_class_data_;
+}
+
+void TestNoPresenceField::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<TestNoPresenceField*>(&to_msg);
+  auto& from = static_cast<const TestNoPresenceField&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto3_unittest.TestNoPresenceField)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_no_presence_repeated_nested()->MergeFrom(
+      from._internal_no_presence_repeated_nested());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_no_presence_nested()->::proto3_unittest::TestNoPresenceField::MergeFrom(
+        from._internal_no_presence_nested());
+  }
+  if (from._internal_no_presence_bool() != 0) {
+    _this->_internal_set_no_presence_bool(from._internal_no_presence_bool());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestNoPresenceField::CopyFrom(const TestNoPresenceField& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3_unittest.TestNoPresenceField)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool TestNoPresenceField::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* TestNoPresenceField::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void TestNoPresenceField::InternalSwap(TestNoPresenceField* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.no_presence_repeated_nested_.InternalSwap(&other->_impl_.no_presence_repeated_nested_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_bool_)
+      + sizeof(TestNoPresenceField::_impl_.no_presence_bool_)
+      - PROTOBUF_FIELD_OFFSET(TestNoPresenceField, _impl_.no_presence_nested_)>(
+          reinterpret_cast<char*>(&_impl_.no_presence_nested_),
+          reinterpret_cast<char*>(&other->_impl_.no_presence_nested_));
+}
+
+::google::protobuf::Metadata TestNoPresenceField::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto_getter, &descriptor_table_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto_once,
+      file_level_metadata_google_2fprotobuf_2futil_2fmessage_5fdifferencer_5funittest_5fproto3_2eproto[0]);
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3_unittest
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,161 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/util/parallel_parse.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/wire_format_lite.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace {
+
+using internal::WireFormatLite;
+
+struct Split {
+  // The payload of every occurrence of the split field, in input order.
+  std::vector<absl::string_view> elements;
+  size_t element_bytes = 0;
+  // Everything else, with tags, in input order.
+  std::string rest;
+};
+
+// Walks the top level of `data` without parsing anything, separating the
+// elements of `field` from all other fields.
+bool SplitInput(absl::string_view data, const FieldDescriptor* field,
+                Split* split) {
+  const uint32_t element_tag = WireFormatLite::MakeTag(
+      field->number(), WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+  io::CodedInputStream input(reinterpret_cast<const uint8_t*>(data.data()),
+                             static_cast<int>(data.size()));
+  while (true) {
+    const int start = input.CurrentPosition();
+    const uint32_t tag = input.ReadTag();
+    if (tag == 0) return input.ConsumedEntireMessage();
+    if (tag == element_tag) {
+      int length;
+      if (!input.ReadVarintSizeAsInt(&length)) return false;
+      const int offset = input.CurrentPosition();
+      if (!input.Skip(length)) return false;
+      split->elements.push_back(data.substr(offset, length));
+      split->element_bytes += length;
+    } else {
+      if (!WireFormatLite::SkipField(&input, tag)) return false;
+      split->rest.append(data.data() + start, input.CurrentPosition() - start);
+    }
+  }
+}
+
+// Parses elements [begin, end) into the corresponding entries of `targets`.
+void ParseElements(const std::vector<absl::string_view>& elements,
+                   const std::vector<Message*>& targets, size_t begin,
+                   size_t end, std::atomic<bool>* ok) {
+  for (size_t i = begin; i < end; ++i) {
+    if (!ok->load(std::memory_order_relaxed)) return;
+    if (!targets[i]->ParsePartialFromString(elements[i])) {
+      ok->store(false, std::memory_order_relaxed);
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+bool ParsePartialWithParallelism(absl::string_view data,
+                                 const FieldDescriptor* field,
+                                 Message* message,
+                                 const ParallelParseOptions& options) {
+  if (field == nullptr || !field->is_repeated() || field->is_map() ||
+      field->type() != FieldDescriptor::TYPE_MESSAGE ||
+      field->containing_type() != message->GetDescriptor()) {
+    return false;
+  }
+  if (data.size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    return false;
+  }
+
+  if (options.parallelism <= 1) {
+    return message->ParsePartialFromString(data);
+  }
+
+  Split split;
+  if (!SplitInput(data, field, &split)) return false;
+  if (!message->ParsePartialFromString(split.rest)) return false;
+
+  // Elements are created up front on this thread so they land in the repeated
+  // field in input order; only their contents are parsed concurrently.
+  const Reflection* reflection = message->GetReflection();
+  const size_t num_elements = split.elements.size();
+  std::vector<Message*> targets;
+  targets.reserve(num_elements);
+  reflection->MutableRepeatedPtrField<Message>(message, field)
+      ->Reserve(static_cast<int>(num_elements));
+  for (size_t i = 0; i < num_elements; ++i) {
+    targets.push_back(reflection->AddMessage(message, field));
+  }
+
+  size_t num_threads = static_cast<size_t>(options.parallelism);
+  if (options.min_bytes_per_thread > 0) {
+    num_threads = std::min(
+        num_threads,
+        std::max<size_t>(1, split.element_bytes / options.min_bytes_per_thread));
+  }
+  num_threads = std::min(num_threads, std::max<size_t>(1, num_elements));
+
+  // Cut the elements into `num_threads` contiguous runs of roughly equal size
+  // in bytes.
+  std::vector<size_t> bounds = {0};
+  size_t consumed = 0;
+  for (size_t i = 0; i < num_elements && bounds.size() < num_threads; ++i) {
+    consumed += split.elements[i].size();
+    if (consumed * num_threads >= split.element_bytes * bounds.size()) {
+      bounds.push_back(i + 1);
+    }
+  }
+  bounds.push_back(num_elements);
+
+  std::atomic<bool> ok{true};
+  std::vector<std::thread> workers;
+  workers.reserve(bounds.size() - 2);
+  for (size_t t = 1; t + 1 < bounds.size(); ++t) {
+    workers.emplace_back(ParseElements, std::cref(split.elements),
+                         std::cref(targets), bounds[t], bounds[t + 1], &ok);
+  }
+  ParseElements(split.elements, targets, bounds[0], bounds[1], &ok);
+  for (std::thread& worker : workers) worker.join();
+  return ok.load(std::memory_order_relaxed);
+}
+
+bool ParseWithParallelism(absl::string_view data,
+                          const FieldDescriptor* field, Message* message,
+                          const ParallelParseOptions& options) {
+  return ParsePartialWithParallelism(data, field, message, options) &&
+         message->IsInitialized();
+}
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,79 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+// Utilities for parsing very large messages on several threads.
+//
+// Many large payloads are dominated by a single top-level repeated message
+// field, e.g.
+//
+//   message Batch {
+//     repeated Record records = 1;
+//   }
+//
+// Parsing such a message normally uses a single core.  The functions in this
+// file do a cheap first pass over the input that only skips fields in order to
+// find the boundaries of each element of the chosen field, then parse the
+// elements on worker threads.  The result is identical to a serial parse:
+// elements keep their order in the repeated field, and all other fields are
+// parsed (on the calling thread) in their original order.
+
+#ifndef GOOGLE_PROTOBUF_UTIL_PARALLEL_PARSE_H__
+#define GOOGLE_PROTOBUF_UTIL_PARALLEL_PARSE_H__
+
+#include <cstddef>
+
+#include "absl/strings/string_view.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/message.h"
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+namespace google {
+namespace protobuf {
+namespace util {
+
+struct ParallelParseOptions {
+  // Maximum number of threads used to parse elements, including the calling
+  // thread.  A value of 1 (or less) parses everything on the calling thread.
+  int parallelism = 1;
+
+  // Elements are handed to threads in contiguous runs of at least this many
+  // bytes.  Inputs too small to give every thread such a run use fewer
+  // threads, so small messages are not slowed down by thread start-up costs.
+  size_t min_bytes_per_thread = size_t{1} << 20;
+};
+
+// Parses `data` into `message`, splitting the elements of `field` across up
+// to `options.parallelism` threads.  `field` must be a repeated, length
+// delimited message field of `message`'s type; map fields are not supported.
+// Like MessageLite::ParseFromString(), `message` is cleared first and the
+// function fails if required fields are missing.
+//
+// If `message` lives on an arena, the elements are allocated on that arena;
+// each worker thread allocates the elements' contents from its own
+// SerialArena, so the workers do not contend with each other.
+//
+// Returns false if `data` is not a valid serialization of `message` or if
+// `field` is not suitable; `message` is left in an unspecified state.
+bool PROTOBUF_EXPORT ParseWithParallelism(absl::string_view data,
+                                          const FieldDescriptor* field,
+                                          Message* message,
+                                          const ParallelParseOptions& options);
+
+// Same as ParseWithParallelism(), but does not check required fields.
+bool PROTOBUF_EXPORT ParsePartialWithParallelism(
+    absl::string_view data, const FieldDescriptor* field, Message* message,
+    const ParallelParseOptions& options);
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // GOOGLE_PROTOBUF_UTIL_PARALLEL_PARSE_H__
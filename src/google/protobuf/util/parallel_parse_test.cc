@@ -0,0 +1,165 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "google/protobuf/util/parallel_parse.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "absl/strings/str_cat.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/dynamic_message.h"
+#include "google/protobuf/test_util.h"
+#include "google/protobuf/unittest.pb.h"
+#include "google/protobuf/util/message_differencer.h"
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace {
+
+using ::protobuf_unittest::TestAllTypes;
+using ::protobuf_unittest::TestRequired;
+using ::protobuf_unittest::TestRequiredForeign;
+
+const FieldDescriptor* RepeatedNestedMessage() {
+  return TestAllTypes::descriptor()->FindFieldByName(
+      "repeated_nested_message");
+}
+
+// Serializes a message whose repeated_nested_message elements are interleaved
+// with other fields, including later occurrences of singular fields.
+std::string MakeInput(int num_elements) {
+  std::string data;
+  for (int i = 0; i < num_elements; ++i) {
+    TestAllTypes chunk;
+    chunk.add_repeated_nested_message()->set_bb(i);
+    chunk.set_optional_int32(i);
+    chunk.add_repeated_string(absl::StrCat("s", i));
+    if (i % 7 == 0) chunk.mutable_optional_nested_message()->set_bb(i);
+    data += chunk.SerializeAsString();
+  }
+  return data;
+}
+
+ParallelParseOptions Options(int parallelism) {
+  ParallelParseOptions options;
+  options.parallelism = parallelism;
+  options.min_bytes_per_thread = 1;
+  return options;
+}
+
+TEST(ParallelParseTest, MatchesSerialParse) {
+  const std::string data = MakeInput(1000);
+  TestAllTypes expected;
+  ASSERT_TRUE(expected.ParseFromString(data));
+
+  for (int parallelism : {1, 2, 3, 8, 2000}) {
+    SCOPED_TRACE(parallelism);
+    TestAllTypes message;
+    message.set_optional_string("cleared");
+    ASSERT_TRUE(ParseWithParallelism(data, RepeatedNestedMessage(), &message,
+                                     Options(parallelism)));
+    EXPECT_TRUE(MessageDifferencer::Equals(expected, message));
+  }
+}
+
+TEST(ParallelParseTest, AllFieldsAndEmptyInput) {
+  TestAllTypes expected;
+  TestUtil::SetAllFields(&expected);
+  TestAllTypes message;
+  ASSERT_TRUE(ParseWithParallelism(expected.SerializeAsString(),
+                                   RepeatedNestedMessage(), &message,
+                                   Options(4)));
+  TestUtil::ExpectAllFieldsSet(message);
+
+  ASSERT_TRUE(ParseWithParallelism("", RepeatedNestedMessage(), &message,
+                                   Options(4)));
+  EXPECT_EQ(message.ByteSizeLong(), 0);
+}
+
+TEST(ParallelParseTest, OnArena) {
+  const std::string data = MakeInput(500);
+  Arena arena;
+  auto* message = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(ParseWithParallelism(data, RepeatedNestedMessage(), message,
+                                   Options(4)));
+  ASSERT_EQ(message->repeated_nested_message_size(), 500);
+  for (int i = 0; i < 500; ++i) {
+    EXPECT_EQ(message->repeated_nested_message(i).bb(), i);
+    EXPECT_EQ(message->repeated_nested_message(i).GetArena(), &arena);
+  }
+}
+
+TEST(ParallelParseTest, DynamicMessage) {
+  const std::string data = MakeInput(300);
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> message(
+      factory.GetPrototype(TestAllTypes::descriptor())->New());
+  const FieldDescriptor* field = message->GetDescriptor()->FindFieldByName(
+      "repeated_nested_message");
+  ASSERT_TRUE(ParseWithParallelism(data, field, message.get(), Options(4)));
+
+  TestAllTypes expected;
+  ASSERT_TRUE(expected.ParseFromString(data));
+  EXPECT_EQ(message->SerializeAsString(), expected.SerializeAsString());
+}
+
+TEST(ParallelParseTest, RejectsMalformedInput) {
+  std::string data = MakeInput(100);
+
+  // Truncated in the middle of the input.
+  TestAllTypes message;
+  EXPECT_FALSE(ParseWithParallelism(data.substr(0, data.size() / 2 + 1),
+                                    RepeatedNestedMessage(), &message,
+                                    Options(4)));
+
+  // A corrupt element: field 1 of NestedMessage declared as length delimited
+  // with a length running past the element.
+  TestAllTypes outer;
+  outer.add_repeated_nested_message()->set_bb(1);
+  std::string bad = outer.SerializeAsString();
+  bad.back() = '\x7f';
+  bad[bad.size() - 2] = '\x0a';
+  EXPECT_FALSE(ParseWithParallelism(data + bad, RepeatedNestedMessage(),
+                                    &message, Options(4)));
+}
+
+TEST(ParallelParseTest, ChecksRequiredFields) {
+  TestRequiredForeign message;
+  message.add_repeated_message()->set_a(1);
+  const std::string data = message.SerializePartialAsString();
+  const FieldDescriptor* field =
+      TestRequiredForeign::descriptor()->FindFieldByName("repeated_message");
+
+  TestRequiredForeign parsed;
+  EXPECT_FALSE(ParseWithParallelism(data, field, &parsed, Options(2)));
+  EXPECT_TRUE(ParsePartialWithParallelism(data, field, &parsed, Options(2)));
+  EXPECT_EQ(parsed.repeated_message(0).a(), 1);
+}
+
+TEST(ParallelParseTest, RejectsUnsuitableFields) {
+  TestAllTypes message;
+  const Descriptor* descriptor = TestAllTypes::descriptor();
+  EXPECT_FALSE(ParseWithParallelism(
+      "", descriptor->FindFieldByName("optional_nested_message"), &message,
+      Options(2)));
+  EXPECT_FALSE(ParseWithParallelism(
+      "", descriptor->FindFieldByName("repeated_int32"), &message,
+      Options(2)));
+  EXPECT_FALSE(ParseWithParallelism(
+      "", TestRequired::descriptor()->FindFieldByName("a"), &message,
+      Options(2)));
+  EXPECT_FALSE(ParseWithParallelism("", nullptr, &message, Options(2)));
+}
+
+}  // namespace
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
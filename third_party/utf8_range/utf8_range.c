@@ -0,0 +1,212 @@
+// Copyright 2023 Google LLC
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+/* Runtime dispatch between the compile-time selected utf8_range2() and an
+ * AVX2 validator, so that binaries built for a baseline x86-64 target still
+ * validate 32 bytes at a time on CPUs that can.
+ *
+ * The AVX2 validator is the "lookup" algorithm of Keiser and Lemire,
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" (2021): every
+ * error in a pair of adjacent bytes is identified by looking up the high
+ * nibble of the first byte, its low nibble and the high nibble of the second
+ * byte in three 16-entry tables and ANDing the results. Three- and four-byte
+ * sequences additionally need their third and fourth bytes to be
+ * continuations, which is checked separately. Runs of ASCII are skipped 64
+ * bytes at a time.
+ */
+
+#include "utf8_range.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define UTF8_RANGE_AVX2_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+#ifdef UTF8_RANGE_AVX2_DISPATCH
+
+#define UTF8_RANGE_AVX2 __attribute__((target("avx2")))
+
+/* Returns the bytes of (prev, input) starting |n| bytes before |input|. */
+#define UTF8_RANGE_PREV(input, prev, n)                                     \
+  _mm256_alignr_epi8((input), _mm256_permute2x128_si256((prev), (input),    \
+                                                        0x21),              \
+                     16 - (n))
+
+/* Error bits, named after the byte pair they are set for. */
+#define TOO_SHORT (1 << 0)  /* 11______ 0_______ or 11______ 11______ */
+#define TOO_LONG (1 << 1)   /* 0_______ 10______ */
+#define OVERLONG_3 (1 << 2) /* 11100000 100_____ */
+#define TOO_LARGE (1 << 3)  /* 11110100 1001____ and above */
+#define SURROGATE (1 << 4)  /* 11101101 101_____ */
+#define OVERLONG_2 (1 << 5) /* 1100000_ 10______ */
+#define TOO_LARGE_1000 (1 << 6) /* 11110101 1000____ and above */
+#define OVERLONG_4 (1 << 6)     /* 11110000 1000____ */
+#define TWO_CONTS (1 << 7)      /* 10______ 10______ */
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+static UTF8_RANGE_AVX2 inline __m256i utf8_range_HighNibbles(__m256i v) {
+  return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+/* Returns nonzero bytes wherever |input| does not correctly continue the
+ * bytes before it. */
+static UTF8_RANGE_AVX2 inline __m256i utf8_range_CheckBlock(__m256i input,
+                                                           __m256i prev) {
+  const __m256i byte_1_high_table = _mm256_setr_epi8(
+      TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+      TOO_LONG, TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+      TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+      TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+      /* Repeated for the high lane. */
+      TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+      TOO_LONG, TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+      TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+      TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+  const __m256i byte_1_low_table = _mm256_setr_epi8(
+      CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY,
+      CARRY, CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      /* Repeated for the high lane. */
+      CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY,
+      CARRY, CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000,
+      CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+      CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000);
+  const __m256i byte_2_high_table = _mm256_setr_epi8(
+      TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+      TOO_SHORT, TOO_SHORT,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |
+          OVERLONG_4,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_SHORT,
+      TOO_SHORT, TOO_SHORT, TOO_SHORT,
+      /* Repeated for the high lane. */
+      TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+      TOO_SHORT, TOO_SHORT,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |
+          OVERLONG_4,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_SHORT,
+      TOO_SHORT, TOO_SHORT, TOO_SHORT);
+
+  __m256i prev1 = UTF8_RANGE_PREV(input, prev, 1);
+  __m256i special_cases = _mm256_and_si256(
+      _mm256_and_si256(
+          _mm256_shuffle_epi8(byte_1_high_table, utf8_range_HighNibbles(prev1)),
+          _mm256_shuffle_epi8(byte_1_low_table,
+                              _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)))),
+      _mm256_shuffle_epi8(byte_2_high_table, utf8_range_HighNibbles(input)));
+
+  /* The third and fourth bytes of a sequence are continuations, which the
+   * tables flag as TWO_CONTS. Flip that bit where a continuation is required,
+   * which both clears the expected ones and flags the missing ones. */
+  __m256i prev2 = UTF8_RANGE_PREV(input, prev, 2);
+  __m256i prev3 = UTF8_RANGE_PREV(input, prev, 3);
+  __m256i is_third_byte =
+      _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+  __m256i is_fourth_byte =
+      _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+  __m256i must_be_continuation =
+      _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                       _mm256_set1_epi8((char)0x80));
+  return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+/* Returns nonzero bytes if |input| ends in the middle of a sequence. */
+static UTF8_RANGE_AVX2 inline __m256i utf8_range_IsIncomplete(__m256i input) {
+  const __m256i max_value = _mm256_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1),
+      (char)(0xE0 - 1), (char)(0xC0 - 1));
+  return _mm256_subs_epu8(input, max_value);
+}
+
+static UTF8_RANGE_AVX2 int utf8_range_IsValidAvx2(const char* data,
+                                                  size_t len) {
+  const char* end = data + len;
+  __m256i prev = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  __m256i error = _mm256_setzero_si256();
+
+  while (end - data >= 64) {
+    __m256i lo = _mm256_loadu_si256((const __m256i*)data);
+    __m256i hi = _mm256_loadu_si256((const __m256i*)(data + 32));
+    if (_mm256_movemask_epi8(_mm256_or_si256(lo, hi)) == 0) {
+      /* All ASCII: only a sequence left open by the previous block can be
+       * wrong. */
+      error = _mm256_or_si256(error, prev_incomplete);
+      prev_incomplete = _mm256_setzero_si256();
+    } else {
+      error = _mm256_or_si256(error, utf8_range_CheckBlock(lo, prev));
+      error = _mm256_or_si256(error, utf8_range_CheckBlock(hi, lo));
+      prev_incomplete = utf8_range_IsIncomplete(hi);
+    }
+    prev = hi;
+    data += 64;
+  }
+
+  /* Pad the remainder with zeros; a sequence cut short by the end of the
+   * input is then reported as too short. */
+  while (data < end) {
+    char buf[32] = {0};
+    size_t n = (size_t)(end - data) < 32 ? (size_t)(end - data) : 32;
+    memcpy(buf, data, n);
+    __m256i input = _mm256_loadu_si256((const __m256i*)buf);
+    error = _mm256_or_si256(error, utf8_range_CheckBlock(input, prev));
+    prev_incomplete = utf8_range_IsIncomplete(input);
+    prev = input;
+    data += n;
+  }
+  error = _mm256_or_si256(error, prev_incomplete);
+  return _mm256_testz_si256(error, error);
+}
+
+#undef UTF8_RANGE_PREV
+#undef TOO_SHORT
+#undef TOO_LONG
+#undef OVERLONG_3
+#undef TOO_LARGE
+#undef SURROGATE
+#undef OVERLONG_2
+#undef TOO_LARGE_1000
+#undef OVERLONG_4
+#undef TWO_CONTS
+#undef CARRY
+
+#endif  // UTF8_RANGE_AVX2_DISPATCH
+
+int utf8_range_HasAvx2(void) {
+#ifdef UTF8_RANGE_AVX2_DISPATCH
+  return __builtin_cpu_supports("avx2");
+#else
+  return 0;
+#endif
+}
+
+int utf8_range_IsValid(const char* data, size_t len) {
+#ifdef UTF8_RANGE_AVX2_DISPATCH
+  /* Shorter inputs would be copied into a padded block, which costs more
+   * than validating them one byte at a time. */
+  if (len >= 32 && utf8_range_HasAvx2()) {
+    return utf8_range_IsValidAvx2(data, len);
+  }
+#endif
+  return utf8_range2((const unsigned char*)data, (int)len) == 0;
+}
@@ -1,6 +1,8 @@
 #ifndef THIRD_PARTY_UTF8_RANGE_UTF8_RANGE_H_
 #define THIRD_PARTY_UTF8_RANGE_UTF8_RANGE_H_
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,6 +16,17 @@ static inline int utf8_range2(const unsigned char* data, int len) {
 }
 #endif
 
+/* Returns 1 if the |len| bytes at |data| are valid UTF-8, and 0 otherwise.
+ *
+ * Unlike utf8_range2(), whose implementation is fixed at compile time, this
+ * uses an AVX2 validator for inputs of 32 bytes or more when the CPU running
+ * it supports AVX2, and falls back to utf8_range2() (which limits |len| to
+ * INT_MAX) everywhere else. */
+int utf8_range_IsValid(const char* data, size_t len);
+
+/* Returns 1 if utf8_range_IsValid() uses its AVX2 implementation. */
+int utf8_range_HasAvx2(void);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -1,7 +1,12 @@
 #include "utf8_validity.h"
 
+#include <cstddef>
+#include <random>
+#include <string>
+
 #include "gtest/gtest.h"
 #include "absl/strings/string_view.h"
+#include "utf8_range.h"
 
 namespace utf8_range {
 
@@ -73,4 +78,63 @@ TEST(Utf8Validity, IsStructurallyValid) {
   EXPECT_FALSE(IsStructurallyValid("\xc7\xc8\xcd\xcb"));
 }
 
+// Strings of at least a vector's length go through the runtime-selected SIMD
+// validator. Checks it against the byte-at-a-time validator behind
+// SpanStructurallyValid() with each of the cases above at every position of
+// a long string, so that they land on both sides of every block boundary.
+TEST(Utf8Validity, LongStringsMatchSpan) {
+  const absl::string_view kCases[] = {
+      "\xc2\x81",         "\xe2\x81\x81",     "\xf2\x81\x81\x81",
+      "\xf4\x8f\xbf\xbf", "\xed\x9f\xbf",     "\xee\x80\x80",
+      "\x80",             "\xc2",             "\xe2\x81",
+      "\xf2\x81\x81",     "\xc0\x81",         "\xe0\x81\x81",
+      "\xf0\x81\x81\x81", "\xf4\xbf\xbf\xbf", "\xED\xA0\x80",
+      "\xED\xBF\xBF",     "\xc1\xbf",         "\xe0\x9f\xbf",
+      "\xf0\x83\xbf\xbf", "\xc7\xc8\xcd\xcb", "\xf5\x80\x80\x80",
+      "\xff",             "\xc2\x81\x81",     "\xe2\x81\x81\x81",
+  };
+  for (absl::string_view c : kCases) {
+    for (size_t size : {32, 63, 64, 65, 100, 130}) {
+      for (size_t pos = 0; pos + c.size() <= size; ++pos) {
+        std::string str(size, 'a');
+        str.replace(pos, c.size(), c.data(), c.size());
+        bool expected = SpanStructurallyValid(str) == str.size();
+        EXPECT_EQ(IsStructurallyValid(str), expected) << size << " " << pos;
+        EXPECT_EQ(utf8_range_IsValid(str.data(), str.size()) != 0, expected)
+            << size << " " << pos;
+      }
+    }
+  }
+}
+
+TEST(Utf8Validity, RandomStringsMatchSpan) {
+  std::mt19937 rng(1234);
+  // Mostly valid text, with the occasional random byte to break it.
+  const absl::string_view kPieces[] = {
+      "a", "z", "\xc2\x81", "\xdf\xbf", "\xe0\xa0\x80", "\xed\x9f\xbf",
+      "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf4\x8f\xbf\xbf",
+  };
+  int valid = 0;
+  for (int iter = 0; iter < 20000; ++iter) {
+    std::string str;
+    size_t size = rng() % 300;
+    while (str.size() < size) {
+      if (rng() % 200 == 0) {
+        str.push_back(static_cast<char>(rng()));
+      } else {
+        str.append(std::string(kPieces[rng() % (sizeof(kPieces) /
+                                                sizeof(kPieces[0]))]));
+      }
+    }
+    bool expected = SpanStructurallyValid(str) == str.size();
+    valid += expected;
+    ASSERT_EQ(IsStructurallyValid(str), expected) << str;
+    ASSERT_EQ(utf8_range_IsValid(str.data(), str.size()) != 0, expected)
+        << str;
+  }
+  // Both outcomes should have been exercised plenty.
+  EXPECT_GT(valid, 1000);
+  EXPECT_LT(valid, 19000);
+}
+
 }  // namespace utf8_range
@@ -10,8 +10,10 @@
  * upb/def.c and tests/conformance_upb.c, respectively).
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 #include <gtest/gtest.h>
 #include "google/protobuf/test_messages_proto2.upb.h"
@@ -21,6 +23,7 @@
 #include "upb/mem/arena.hpp"
 #include "upb/message/array.h"
 #include "upb/test/test.upb.h"
+#include "upb/wire/encode.h"
 
 // Must be last.
 #include "upb/port/def.inc"
@@ -827,6 +830,53 @@ TEST(GeneratedCode, NullDecodeBuffer) {
   upb_Arena_Free(arena);
 }
 
+TEST(GeneratedCode, EncodeChunked) {
+  upb::Arena arena;
+  protobuf_test_messages_proto3_TestAllTypesProto3* msg =
+      protobuf_test_messages_proto3_TestAllTypesProto3_new(arena.ptr());
+  std::string big(10000, 'x');
+  protobuf_test_messages_proto3_TestAllTypesProto3_set_optional_bytes(
+      msg, upb_StringView_FromDataAndSize(big.data(), big.size()));
+  for (int i = 0; i < 1000; i++) {
+    protobuf_test_messages_proto3_TestAllTypesProto3_add_repeated_int32(
+        msg, i, arena.ptr());
+    protobuf_test_messages_proto3_TestAllTypesProto3_add_repeated_string(
+        msg, test_str_view4, arena.ptr());
+  }
+
+  size_t size;
+  char* expected = protobuf_test_messages_proto3_TestAllTypesProto3_serialize(
+      msg, arena.ptr(), &size);
+  ASSERT_NE(nullptr, expected);
+
+  for (size_t chunk_size : {1, 16, 100, 4096, 1 << 20}) {
+    upb_StringView* chunks;
+    size_t count;
+    ASSERT_EQ(kUpb_EncodeStatus_Ok,
+              upb_EncodeChunked(
+                  msg, &protobuf__test__messages__proto3__TestAllTypesProto3_msg_init,
+                  0, arena.ptr(), chunk_size, &chunks, &count));
+    std::string joined;
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_GT(chunks[i].size, 0);
+      EXPECT_LE(chunks[i].size, std::max<size_t>(chunk_size, 10));
+      joined.append(chunks[i].data, chunks[i].size);
+    }
+    EXPECT_EQ(std::string(expected, size), joined) << chunk_size;
+  }
+
+  // An empty message has no chunks.
+  upb_StringView* chunks;
+  size_t count;
+  ASSERT_EQ(kUpb_EncodeStatus_Ok,
+            upb_EncodeChunked(
+                protobuf_test_messages_proto3_TestAllTypesProto3_new(
+                    arena.ptr()),
+                &protobuf__test__messages__proto3__TestAllTypesProto3_msg_init,
+                0, arena.ptr(), 64, &chunks, &count));
+  EXPECT_EQ(0, count);
+}
+
 TEST(GeneratedCode, StatusTruncation) {
   int i, j;
   upb_Status status;
@@ -69,6 +69,14 @@ typedef struct {
   int options;
   int depth;
   _upb_mapsorter sorter;
+
+  // Chunked mode only (chunk_size != 0).  Chunks that are already full, in
+  // the order they were filled (ie. last chunk of the output first), and the
+  // total number of bytes in them.
+  size_t chunk_size;
+  upb_StringView* chunks;
+  size_t chunk_count, chunk_capacity;
+  size_t prev_chunks_size;
 } upb_encstate;
 
 static size_t upb_roundup_pow2(size_t bytes) {
@@ -85,8 +93,54 @@ UPB_NORETURN static void encode_err(upb_encstate* e, upb_EncodeStatus s) {
   UPB_LONGJMP(e->err, 1);
 }
 
+// Returns the number of bytes written so far.
+UPB_FORCEINLINE
+static size_t encode_written(const upb_encstate* e) {
+  return e->prev_chunks_size + (e->limit - e->ptr);
+}
+
+// Appends the written part of the current chunk to the list of full chunks.
+static void encode_retirechunk(upb_encstate* e) {
+  size_t used = e->limit - e->ptr;
+  if (used == 0) return;
+
+  if (e->chunk_count == e->chunk_capacity) {
+    size_t old_capacity = e->chunk_capacity;
+    size_t new_capacity = old_capacity ? old_capacity * 2 : 8;
+    upb_StringView* chunks =
+        upb_Arena_Realloc(e->arena, e->chunks, old_capacity * sizeof(*chunks),
+                          new_capacity * sizeof(*chunks));
+    if (!chunks) encode_err(e, kUpb_EncodeStatus_OutOfMemory);
+    e->chunks = chunks;
+    e->chunk_capacity = new_capacity;
+  }
+  e->chunks[e->chunk_count++] = upb_StringView_FromDataAndSize(e->ptr, used);
+  e->prev_chunks_size += used;
+  e->limit = e->ptr;
+}
+
+// Retires the current chunk and starts a new one of at least "bytes" bytes.
+// Nothing already written is copied.
+static void encode_newchunk(upb_encstate* e, size_t bytes) {
+  size_t new_size = UPB_MAX(e->chunk_size, bytes);
+  char* new_buf;
+
+  encode_retirechunk(e);
+  new_buf = upb_Arena_Malloc(e->arena, new_size);
+  if (!new_buf) encode_err(e, kUpb_EncodeStatus_OutOfMemory);
+
+  e->buf = new_buf;
+  e->limit = new_buf + new_size;
+  e->ptr = e->limit - bytes;
+}
+
 UPB_NOINLINE
 static void encode_growbuffer(upb_encstate* e, size_t bytes) {
+  if (e->chunk_size) {
+    encode_newchunk(e, bytes);
+    return;
+  }
+
   size_t old_size = e->limit - e->buf;
   size_t new_size = upb_roundup_pow2(bytes + (e->limit - e->ptr));
   char* new_buf = upb_Arena_Realloc(e->arena, e->buf, old_size, new_size);
@@ -119,9 +173,30 @@ static void encode_reserve(upb_encstate* e, size_t bytes) {
   e->ptr -= bytes;
 }
 
+// Chunked mode: writes "data" into the free space of the current chunk and
+// as many new chunks as it takes, so that chunks keep their fixed size.
+UPB_NOINLINE
+static void encode_splitbytes(upb_encstate* e, const char* data, size_t len) {
+  size_t avail = e->ptr - e->buf;
+  if (avail > 0) memcpy(e->buf, data + len - avail, avail);
+  e->ptr = e->buf;
+  len -= avail;
+
+  while (len > 0) {
+    size_t n = UPB_MIN(len, e->chunk_size);
+    encode_newchunk(e, n);
+    memcpy(e->ptr, data + len - n, n);
+    len -= n;
+  }
+}
+
 /* Writes the given bytes to the buffer, handling reserve/advance. */
 static void encode_bytes(upb_encstate* e, const void* data, size_t len) {
   if (len == 0) return; /* memcpy() with zero size is UB */
+  if ((size_t)(e->ptr - e->buf) < len && e->chunk_size) {
+    encode_splitbytes(e, data, len);
+    return;
+  }
   encode_reserve(e, len);
   memcpy(e->ptr, data, len);
 }
@@ -307,7 +382,7 @@ static void encode_array(upb_encstate* e, const upb_Message* msg,
                          const upb_MiniTableField* f) {
   const upb_Array* arr = *UPB_PTR_AT(msg, f->offset, upb_Array*);
   bool packed = f->mode & kUpb_LabelFlags_IsPacked;
-  size_t pre_len = e->limit - e->ptr;
+  size_t pre_len = encode_written(e);
 
   if (arr == NULL || arr->size == 0) {
     return;
@@ -403,7 +478,7 @@ static void encode_array(upb_encstate* e, const upb_Message* msg,
 #undef VARINT_CASE
 
   if (packed) {
-    encode_varint(e, e->limit - e->ptr - pre_len);
+    encode_varint(e, encode_written(e) - pre_len);
     encode_tag(e, f->number, kUpb_WireType_Delimited);
   }
 }
@@ -413,11 +488,11 @@ static void encode_mapentry(upb_encstate* e, uint32_t number,
                             const upb_MapEntry* ent) {
   const upb_MiniTableField* key_field = &layout->fields[0];
   const upb_MiniTableField* val_field = &layout->fields[1];
-  size_t pre_len = e->limit - e->ptr;
+  size_t pre_len = encode_written(e);
   size_t size;
   encode_scalar(e, &ent->data.v, layout->subs, val_field);
   encode_scalar(e, &ent->data.k, layout->subs, key_field);
-  size = (e->limit - e->ptr) - pre_len;
+  size = encode_written(e) - pre_len;
   encode_varint(e, size);
   encode_tag(e, number, kUpb_WireType_Delimited);
 }
@@ -533,7 +608,7 @@ static void encode_ext(upb_encstate* e, const upb_Message_Extension* ext,
 
 static void encode_message(upb_encstate* e, const upb_Message* msg,
                            const upb_MiniTable* m, size_t* size) {
-  size_t pre_len = e->limit - e->ptr;
+  size_t pre_len = encode_written(e);
 
   if ((e->options & kUpb_EncodeOption_CheckRequired) && m->required_count) {
     uint64_t msg_head;
@@ -587,7 +662,7 @@ static void encode_message(upb_encstate* e, const upb_Message* msg,
     }
   }
 
-  *size = (e->limit - e->ptr) - pre_len;
+  *size = encode_written(e) - pre_len;
 }
 
 static upb_EncodeStatus upb_Encoder_Encode(upb_encstate* const encoder,
@@ -601,7 +676,7 @@ static upb_EncodeStatus upb_Encoder_Encode(upb_encstate* const encoder,
   // NULL on error and we still set it to non-NULL on a successful empty result.
   if (UPB_SETJMP(encoder->err) == 0) {
     encode_message(encoder, msg, l, size);
-    *size = encoder->limit - encoder->ptr;
+    *size = encode_written(encoder);
     if (*size == 0) {
       static char ch;
       *buf = &ch;
@@ -619,20 +694,61 @@ static upb_EncodeStatus upb_Encoder_Encode(upb_encstate* const encoder,
   return encoder->status;
 }
 
+static void upb_Encoder_Init(upb_encstate* e, int options, upb_Arena* arena,
+                             size_t chunk_size) {
+  unsigned depth = (unsigned)options >> 16;
+
+  e->status = kUpb_EncodeStatus_Ok;
+  e->arena = arena;
+  e->buf = NULL;
+  e->limit = NULL;
+  e->ptr = NULL;
+  e->depth = depth ? depth : kUpb_WireFormat_DefaultDepthLimit;
+  e->options = options;
+  e->chunk_size = chunk_size;
+  e->chunks = NULL;
+  e->chunk_count = 0;
+  e->chunk_capacity = 0;
+  e->prev_chunks_size = 0;
+  _upb_mapsorter_init(&e->sorter);
+}
+
 upb_EncodeStatus upb_Encode(const void* msg, const upb_MiniTable* l,
                             int options, upb_Arena* arena, char** buf,
                             size_t* size) {
   upb_encstate e;
-  unsigned depth = (unsigned)options >> 16;
+  upb_Encoder_Init(&e, options, arena, 0);
+  return upb_Encoder_Encode(&e, msg, l, buf, size);
+}
 
-  e.status = kUpb_EncodeStatus_Ok;
-  e.arena = arena;
-  e.buf = NULL;
-  e.limit = NULL;
-  e.ptr = NULL;
-  e.depth = depth ? depth : kUpb_WireFormat_DefaultDepthLimit;
-  e.options = options;
-  _upb_mapsorter_init(&e.sorter);
+upb_EncodeStatus upb_EncodeChunked(const void* msg, const upb_MiniTable* l,
+                                   int options, upb_Arena* arena,
+                                   size_t chunk_size, upb_StringView** chunks,
+                                   size_t* chunk_count) {
+  upb_encstate e;
+  size_t size;
 
-  return upb_Encoder_Encode(&e, msg, l, buf, size);
+  // A varint is never split across chunks.
+  if (chunk_size < UPB_PB_VARINT_MAX_LEN) chunk_size = UPB_PB_VARINT_MAX_LEN;
+  upb_Encoder_Init(&e, options, arena, chunk_size);
+
+  if (UPB_SETJMP(e.err) == 0) {
+    encode_message(&e, msg, l, &size);
+    // Retire the last chunk, then put the chunks in output order.
+    encode_retirechunk(&e);
+    for (size_t i = 0, j = e.chunk_count; i + 1 < j; i++, j--) {
+      upb_StringView tmp = e.chunks[i];
+      e.chunks[i] = e.chunks[j - 1];
+      e.chunks[j - 1] = tmp;
+    }
+    *chunks = e.chunks;
+    *chunk_count = e.chunk_count;
+  } else {
+    UPB_ASSERT(e.status != kUpb_EncodeStatus_Ok);
+    *chunks = NULL;
+    *chunk_count = 0;
+  }
+
+  _upb_mapsorter_destroy(&e.sorter);
+  return e.status;
 }
@@ -13,6 +13,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "upb/base/string_view.h"
 #include "upb/mem/arena.h"
 #include "upb/mini_table/message.h"
 
@@ -67,6 +68,21 @@ UPB_API upb_EncodeStatus upb_Encode(const void* msg, const upb_MiniTable* l,
                                     int options, upb_Arena* arena, char** buf,
                                     size_t* size);
 
+// Like upb_Encode(), but writes the output into a list of separately
+// allocated chunks of "chunk_size" bytes instead of a single buffer, so that
+// large messages are serialized without reallocating and copying the output
+// as it grows.  On success "*chunks" points to "*chunk_count" non-empty
+// pieces of the output, in order, all allocated on "arena".  They are suited
+// to writev() or to copying into a stream.
+//
+// Since the output is written back to front, chunks can be partly unused and
+// their views are often shorter than "chunk_size".
+UPB_API upb_EncodeStatus upb_EncodeChunked(const void* msg,
+                                           const upb_MiniTable* l, int options,
+                                           upb_Arena* arena, size_t chunk_size,
+                                           upb_StringView** chunks,
+                                           size_t* chunk_count);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
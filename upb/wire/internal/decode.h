@@ -75,7 +75,8 @@ bool _upb_Decoder_VerifyUtf8Inline(const char* ptr, int len) {
   return true;
 
 non_ascii:
-  return utf8_range2((const unsigned char*)ptr, end - ptr) == 0;
+  // Uses AVX2 when the CPU supports it, regardless of the compiler flags.
+  return utf8_range_IsValid(ptr, end - ptr);
 }
 
 const char* _upb_Decoder_CheckRequired(upb_Decoder* d, const char* ptr,